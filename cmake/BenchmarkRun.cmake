@@ -0,0 +1,87 @@
+
+# Runs one benchmark model and measures it, for RunBenchmark.cmake and RunScalingBenchmark.cmake.
+# The caller sets ENERGYPLUS_EXE and the ENV{SimulationProfile} the profile zones need.
+
+# Peak memory is measured through the time program where there is one
+set(TIME_CMD "")
+if( APPLE )
+  find_program(TIME_EXE time PATHS /usr/bin NO_DEFAULT_PATH)
+  if( TIME_EXE )
+    set(TIME_CMD "${TIME_EXE}" -l)
+  endif()
+elseif( UNIX )
+  find_program(TIME_EXE time PATHS /usr/bin NO_DEFAULT_PATH)
+  if( TIME_EXE )
+    set(TIME_CMD "${TIME_EXE}" -f "PeakMemory=%M")
+  endif()
+endif()
+
+# Runs EnergyPlus on IDF_PATH in OUTPUT_DIR_PATH with the arguments after IDF_PATH, then appends
+# one "<MODEL_KEY>,Metric,Value" line per measurement to REPORT:
+#   WallTime [ms]          elapsed time reported by EnergyPlus
+#   PeakMemory [kB]        maximum resident set size, when a time program can measure it
+#   Profile:<zone> [us]    self time of the profile zone and the zones below it, by zone
+#                          directly under ManageSimulation
+# A model that does not complete successfully is appended to FAILED_MODELS instead.
+function( RUN_BENCHMARK_MODEL MODEL_KEY OUTPUT_DIR_PATH IDF_PATH )
+  execute_process(COMMAND "${CMAKE_COMMAND}" -E remove_directory "${OUTPUT_DIR_PATH}" )
+  execute_process(COMMAND "${CMAKE_COMMAND}" -E make_directory "${OUTPUT_DIR_PATH}" )
+
+  execute_process(COMMAND ${TIME_CMD} "${ENERGYPLUS_EXE}" -d "${OUTPUT_DIR_PATH}" ${ARGN} "${IDF_PATH}"
+                  WORKING_DIRECTORY "${OUTPUT_DIR_PATH}"
+                  RESULT_VARIABLE RESULT
+                  OUTPUT_QUIET
+                  ERROR_VARIABLE TIME_OUTPUT)
+
+  set(END_CONTENT "")
+  if( EXISTS "${OUTPUT_DIR_PATH}/eplusout.end" )
+    file(READ "${OUTPUT_DIR_PATH}/eplusout.end" END_CONTENT)
+  endif()
+  string(FIND "${END_CONTENT}" "EnergyPlus Completed Successfully" SUCCESS)
+  if( NOT RESULT EQUAL 0 OR SUCCESS LESS 0 )
+    message("${MODEL_KEY} did not complete successfully")
+    set(FAILED_MODELS ${FAILED_MODELS} "${MODEL_KEY}" PARENT_SCOPE)
+    return()
+  endif()
+
+  set(LINES "")
+  # Elapsed Time=00hr 00min  2.37sec
+  string(REGEX MATCH "Elapsed Time=([0-9]+)hr ([0-9]+)min +([0-9]+)\\.([0-9][0-9])sec" ELAPSED "${END_CONTENT}")
+  if( ELAPSED )
+    math(EXPR WALL_TIME "((${CMAKE_MATCH_1} * 60 + ${CMAKE_MATCH_2}) * 60 + ${CMAKE_MATCH_3}) * 1000 + ${CMAKE_MATCH_4} * 10")
+    set(LINES "${LINES}${MODEL_KEY},WallTime [ms],${WALL_TIME}\n")
+  endif()
+
+  # GNU time gives kilobytes, BSD time bytes
+  if( TIME_OUTPUT MATCHES "PeakMemory=([0-9]+)" )
+    set(LINES "${LINES}${MODEL_KEY},PeakMemory [kB],${CMAKE_MATCH_1}\n")
+  elseif( TIME_OUTPUT MATCHES "([0-9]+) +maximum resident set size" )
+    math(EXPR PEAK_MEMORY "${CMAKE_MATCH_1} / 1024")
+    set(LINES "${LINES}${MODEL_KEY},PeakMemory [kB],${PEAK_MEMORY}\n")
+  endif()
+
+  # Fold the calling paths of the profile into the zones called from the simulation itself
+  set(ZONES "")
+  if( EXISTS "${OUTPUT_DIR_PATH}/eplusout.prof" )
+    file(STRINGS "${OUTPUT_DIR_PATH}/eplusout.prof" PROFILE_LINES)
+    foreach( PROFILE_LINE ${PROFILE_LINES} )
+      if( PROFILE_LINE MATCHES "^([^ ]+) ([0-9]+)$" )
+        set(SELF_TIME ${CMAKE_MATCH_2})
+        string(REPLACE ";" "|" PROFILE_PATH "${CMAKE_MATCH_1}")
+        string(REGEX REPLACE "^[^|]+\\|([^|]+).*$" "\\1" ZONE "${PROFILE_PATH}")
+        string(MAKE_C_IDENTIFIER "${ZONE}" ZONE_VAR)
+        if( NOT DEFINED ZONE_TIME_${ZONE_VAR} )
+          set(ZONE_TIME_${ZONE_VAR} 0)
+          list(APPEND ZONES "${ZONE}")
+        endif()
+        math(EXPR ZONE_TIME_${ZONE_VAR} "${ZONE_TIME_${ZONE_VAR}} + ${SELF_TIME}")
+      endif()
+    endforeach()
+  endif()
+  foreach( ZONE ${ZONES} )
+    string(MAKE_C_IDENTIFIER "${ZONE}" ZONE_VAR)
+    set(LINES "${LINES}${MODEL_KEY},Profile:${ZONE} [us],${ZONE_TIME_${ZONE_VAR}}\n")
+  endforeach()
+
+  set(REPORT "${REPORT}${LINES}" PARENT_SCOPE)
+endfunction()
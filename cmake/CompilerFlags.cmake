@@ -68,6 +68,13 @@ ELSEIF ( CMAKE_COMPILER_IS_GNUCXX OR "${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang"
 
     mark_as_advanced(ENABLE_THREAD_SANITIZER ENABLE_ADDRESS_SANITIZER ENABLE_UNDEFINED_SANITIZER)
 
+    option(ENABLE_OPENMP "Enable OpenMP threading of the parallel simulation paths (HBIRE_USE_OMP)" FALSE)
+    if(ENABLE_OPENMP)
+      ADD_CXX_DEFINITIONS("-fopenmp")
+      add_definitions(-DHBIRE_USE_OMP)
+      set(LINKER_FLAGS "${LINKER_FLAGS} -fopenmp")
+    endif()
+
     if(CMAKE_HOST_UNIX)
       if(NOT APPLE)
         set(LINKER_FLAGS "${LINKER_FLAGS} -pthread")
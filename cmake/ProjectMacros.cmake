@@ -212,6 +212,81 @@ function( ADD_SIMULATION_TEST )
 
 endfunction()
 
+# Named arguments
+# IDF_FILE <filename> IDF input file
+# EPW_FILE <filename> EPW weather file
+#
+# Optional Arguments
+# ANNUAL_SIMULATION force annual simulation
+# ENERGYPLUS_FLAGS <flags> command line flags added for this model
+#
+# Adds the model to the ones run by the benchmark target, which is created by ADD_BENCHMARK_TARGET
+function( ADD_BENCHMARK )
+  set(options ANNUAL_SIMULATION)
+  set(oneValueArgs IDF_FILE EPW_FILE)
+  set(multiValueArgs ENERGYPLUS_FLAGS)
+  cmake_parse_arguments(ADD_BENCHMARK "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN} )
+
+  if( ADD_BENCHMARK_ANNUAL_SIMULATION OR BENCHMARK_ANNUAL_SIMULATION )
+    set( ENERGYPLUS_FLAGS "${ADD_BENCHMARK_ENERGYPLUS_FLAGS} -a" )
+  else()
+    set( ENERGYPLUS_FLAGS "${ADD_BENCHMARK_ENERGYPLUS_FLAGS} -D" )
+  endif()
+  string(STRIP "${ENERGYPLUS_FLAGS}" ENERGYPLUS_FLAGS)
+
+  set_property(GLOBAL APPEND PROPERTY BENCHMARK_MODELS "${ADD_BENCHMARK_IDF_FILE}|${ADD_BENCHMARK_EPW_FILE}|${ENERGYPLUS_FLAGS}")
+endfunction()
+
+# Creates the benchmark target, which runs the models added by ADD_BENCHMARK one after the other
+# and writes their wall time, peak memory and profile breakdown to benchmark/benchmark.csv in
+# the build directory.  The report is compared with the one at BENCHMARK_BASELINE, which is
+# written from this run if it does not exist yet; the target fails if a model got slower or
+# larger by more than BENCHMARK_THRESHOLD percent.
+function( ADD_BENCHMARK_TARGET )
+  set( BENCHMARK_BASELINE "${CMAKE_BINARY_DIR}/benchmark/baseline.csv" CACHE FILEPATH "Benchmark report the benchmark target compares against" )
+  set( BENCHMARK_THRESHOLD 10 CACHE STRING "Increase of the benchmark wall time or peak memory reported as a regression (percent)" )
+
+  get_property(MODELS GLOBAL PROPERTY BENCHMARK_MODELS)
+  set( MODELS_FILE "${CMAKE_BINARY_DIR}/benchmark/models.txt" )
+  string(REPLACE ";" "\n" MODELS_LINES "${MODELS}")
+  file(WRITE "${MODELS_FILE}" "${MODELS_LINES}\n")
+
+  add_custom_target( benchmark
+    COMMAND ${CMAKE_COMMAND}
+      -DSOURCE_DIR=${CMAKE_SOURCE_DIR}
+      -DBINARY_DIR=${CMAKE_BINARY_DIR}
+      -DENERGYPLUS_EXE=$<TARGET_FILE:energyplus>
+      -DMODELS_FILE=${MODELS_FILE}
+      -DBASELINE_FILE=${BENCHMARK_BASELINE}
+      -DTHRESHOLD=${BENCHMARK_THRESHOLD}
+      -P ${CMAKE_SOURCE_DIR}/cmake/RunBenchmark.cmake
+    DEPENDS energyplus
+    COMMENT "Running the benchmark models"
+  )
+endfunction()
+
+# Creates the benchmark_scaling target, which writes a model of each BENCHMARK_SCALING_MODELS
+# size with the ScalingModelGenerator, runs it, and writes the wall time, peak memory and profile
+# breakdown against the model size to benchmark/scaling.csv in the build directory.
+function( ADD_SCALING_BENCHMARK_TARGET )
+  set( BENCHMARK_SCALING_MODELS "10:6:10:1:1;40:10:40:4:1;160:10:160:8:2;640:10:640:16:4" CACHE STRING "Model sizes of the benchmark_scaling target, each ZONES:SURFACES:SHADING:AIRLOOPS:PLANTLOOPS" )
+
+  set( MODELS_FILE "${CMAKE_BINARY_DIR}/benchmark/scaling_models.txt" )
+  string(REPLACE ";" "\n" MODELS_LINES "${BENCHMARK_SCALING_MODELS}")
+  file(WRITE "${MODELS_FILE}" "${MODELS_LINES}\n")
+
+  add_custom_target( benchmark_scaling
+    COMMAND ${CMAKE_COMMAND}
+      -DBINARY_DIR=${CMAKE_BINARY_DIR}
+      -DENERGYPLUS_EXE=$<TARGET_FILE:energyplus>
+      -DGENERATOR_EXE=$<TARGET_FILE:ScalingModelGenerator>
+      -DMODELS_FILE=${MODELS_FILE}
+      -P ${CMAKE_SOURCE_DIR}/cmake/RunScalingBenchmark.cmake
+    DEPENDS energyplus ScalingModelGenerator
+    COMMENT "Running the scaling benchmark models"
+  )
+endfunction()
+
 macro( ADD_CXX_DEFINITIONS NEWFLAGS )
   SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${NEWFLAGS}")
 endmacro()
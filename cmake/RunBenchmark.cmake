@@ -0,0 +1,83 @@
+
+# These need to be defined by the caller
+# SOURCE_DIR
+# BINARY_DIR
+# ENERGYPLUS_EXE
+# MODELS_FILE, one "IDF_FILE|EPW_FILE|ENERGYPLUS_FLAGS" line per model
+# BASELINE_FILE
+# THRESHOLD, in percent
+
+# The report has one "Model,Metric,Value" line per measurement, as described in BenchmarkRun.cmake
+
+get_filename_component(EXE_PATH "${ENERGYPLUS_EXE}" PATH)
+set (PRODUCT_PATH "${BINARY_DIR}/Products/")
+set (BENCHMARK_DIR "${BINARY_DIR}/benchmark")
+set (REPORT_FILE "${BENCHMARK_DIR}/benchmark.csv")
+
+# Copy IDD to Executable directory if it is not already there
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${PRODUCT_PATH}/Energy+.idd" "${EXE_PATH}/")
+
+include("${CMAKE_CURRENT_LIST_DIR}/BenchmarkRun.cmake")
+
+# The profile zones are timed only with this set
+set(ENV{SimulationProfile} "yes")
+
+file(STRINGS "${MODELS_FILE}" MODELS)
+set(REPORT "Model,Metric,Value\n")
+set(FAILED_MODELS "")
+
+foreach( MODEL ${MODELS} )
+  string(REPLACE "|" ";" MODEL_FIELDS "${MODEL}")
+  list(GET MODEL_FIELDS 0 IDF_FILE)
+  list(GET MODEL_FIELDS 1 EPW_FILE)
+  list(GET MODEL_FIELDS 2 ENERGYPLUS_FLAGS)
+  string(REPLACE " " ";" ENERGYPLUS_FLAGS_LIST "${ENERGYPLUS_FLAGS}")
+  get_filename_component(IDF_NAME "${IDF_FILE}" NAME_WE)
+
+  message("Running ${IDF_NAME}")
+  RUN_BENCHMARK_MODEL("${IDF_NAME}" "${BENCHMARK_DIR}/${IDF_NAME}/" "${SOURCE_DIR}/testfiles/${IDF_FILE}" -w "${SOURCE_DIR}/weather/${EPW_FILE}" ${ENERGYPLUS_FLAGS_LIST})
+endforeach()
+
+file(WRITE "${REPORT_FILE}" "${REPORT}")
+message("Benchmark report written to ${REPORT_FILE}")
+
+if( FAILED_MODELS )
+  message(FATAL_ERROR "Benchmark models failed: ${FAILED_MODELS}")
+endif()
+
+if( NOT EXISTS "${BASELINE_FILE}" )
+  file(WRITE "${BASELINE_FILE}" "${REPORT}")
+  message("No benchmark baseline found, this report is kept as the baseline at ${BASELINE_FILE}")
+  return()
+endif()
+
+# Only the wall time and the peak memory are held to the threshold; the profile is for finding where a regression is
+file(STRINGS "${BASELINE_FILE}" BASELINE_LINES)
+file(STRINGS "${REPORT_FILE}" REPORT_LINES)
+set(REGRESSIONS "")
+foreach( REPORT_LINE ${REPORT_LINES} )
+  if( REPORT_LINE MATCHES "^([^,]+),(WallTime \\[ms\\]|PeakMemory \\[kB\\]),([0-9]+)$" )
+    set(MODEL_NAME "${CMAKE_MATCH_1}")
+    set(METRIC "${CMAKE_MATCH_2}")
+    set(VALUE ${CMAKE_MATCH_3})
+    foreach( BASELINE_LINE ${BASELINE_LINES} )
+      string(FIND "${BASELINE_LINE}" "${MODEL_NAME},${METRIC}," FOUND)
+      if( FOUND EQUAL 0 )
+        string(REGEX REPLACE "^.*,([0-9]+)$" "\\1" BASELINE_VALUE "${BASELINE_LINE}")
+        math(EXPR LIMIT "${BASELINE_VALUE} * (100 + ${THRESHOLD}) / 100")
+        if( VALUE GREATER LIMIT )
+          math(EXPR CHANGE "(${VALUE} - ${BASELINE_VALUE}) * 100 / ${BASELINE_VALUE}")
+          message("Regression: ${MODEL_NAME} ${METRIC} ${VALUE}, baseline ${BASELINE_VALUE} (+${CHANGE}%)")
+          list(APPEND REGRESSIONS "${MODEL_NAME}")
+        endif()
+      endif()
+    endforeach()
+  endif()
+endforeach()
+
+if( REGRESSIONS )
+  list(REMOVE_DUPLICATES REGRESSIONS)
+  message(FATAL_ERROR "Benchmark regressions beyond ${THRESHOLD}%: ${REGRESSIONS}")
+else()
+  message("Benchmark Passed")
+endif()
@@ -0,0 +1,53 @@
+
+# These need to be defined by the caller
+# BINARY_DIR
+# ENERGYPLUS_EXE
+# GENERATOR_EXE, the ScalingModelGenerator
+# MODELS_FILE, one "ZONES:SURFACES:SHADING:AIRLOOPS:PLANTLOOPS" line per model size
+
+# The report has one "Zones,SurfacesPerZone,ShadingSurfaces,AirLoops,PlantLoops,Metric,Value"
+# line per measurement, with the metrics described in BenchmarkRun.cmake.  Only design days are
+# simulated, so the sizes can be compared without a weather file.
+
+get_filename_component(EXE_PATH "${ENERGYPLUS_EXE}" PATH)
+set (PRODUCT_PATH "${BINARY_DIR}/Products/")
+set (SCALING_DIR "${BINARY_DIR}/benchmark/scaling")
+set (REPORT_FILE "${BINARY_DIR}/benchmark/scaling.csv")
+
+# Copy IDD to Executable directory if it is not already there
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${PRODUCT_PATH}/Energy+.idd" "${EXE_PATH}/")
+
+include("${CMAKE_CURRENT_LIST_DIR}/BenchmarkRun.cmake")
+
+# The profile zones are timed only with this set
+set(ENV{SimulationProfile} "yes")
+
+file(STRINGS "${MODELS_FILE}" MODELS)
+set(REPORT "Zones,SurfacesPerZone,ShadingSurfaces,AirLoops,PlantLoops,Metric,Value\n")
+set(FAILED_MODELS "")
+execute_process(COMMAND "${CMAKE_COMMAND}" -E make_directory "${SCALING_DIR}" )
+
+foreach( MODEL ${MODELS} )
+  if( NOT MODEL MATCHES "^([0-9]+):([0-9]+):([0-9]+):([0-9]+):([0-9]+)$" )
+    message(FATAL_ERROR "Scaling model size \"${MODEL}\" is not ZONES:SURFACES:SHADING:AIRLOOPS:PLANTLOOPS")
+  endif()
+  string(REPLACE ":" "," MODEL_KEY "${MODEL}")
+  string(REPLACE ":" "_" MODEL_NAME "${MODEL}")
+  set (IDF_PATH "${SCALING_DIR}/Scaling_${MODEL_NAME}.idf")
+
+  execute_process(COMMAND "${GENERATOR_EXE}" --zones=${CMAKE_MATCH_1} --surfaces=${CMAKE_MATCH_2} --shading=${CMAKE_MATCH_3} --airloops=${CMAKE_MATCH_4} --plantloops=${CMAKE_MATCH_5} "${IDF_PATH}"
+                  RESULT_VARIABLE RESULT)
+  if( NOT RESULT EQUAL 0 )
+    message(FATAL_ERROR "ScalingModelGenerator could not write the ${MODEL} model")
+  endif()
+
+  message("Running ${MODEL_KEY}")
+  RUN_BENCHMARK_MODEL("${MODEL_KEY}" "${SCALING_DIR}/Scaling_${MODEL_NAME}/" "${IDF_PATH}")
+endforeach()
+
+file(WRITE "${REPORT_FILE}" "${REPORT}")
+message("Scaling report written to ${REPORT_FILE}")
+
+if( FAILED_MODELS )
+  message(FATAL_ERROR "Scaling models failed: ${FAILED_MODELS}")
+endif()
@@ -181,6 +181,9 @@ namespace AirflowNetworkBalanceManager {
 	Array1D< Real64 > MA;
 	Array1D< Real64 > MV;
 	Array1D_int IVEC;
+	// Contaminant matrix as assembled by the CO2 balance, and its inverse, for the generic contaminant balance
+	Array1D< Real64 > MAContam;
+	Array1D< Real64 > MAContamInverse;
 	Array1D_int SplitterNodeNumbers;
 
 	bool AirflowNetworkGetInputFlag( true );
@@ -3489,6 +3492,8 @@ namespace AirflowNetworkBalanceManager {
 		AllocateAirflowNetworkData();
 
 		// CurrentModuleObject='AirflowNetwork Simulations'
+		SetupOutputVariable( "AFN Solver Iterations []", AirflowNetworkSolver::SolverIterations, "System", "Average", AirflowNetworkSimu.AirflowNetworkSimuName );
+		SetupOutputVariable( "AFN Solver Jacobian Factorizations []", AirflowNetworkSolver::SolverFactorizations, "System", "Average", AirflowNetworkSimu.AirflowNetworkSimuName );
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
 			SetupOutputVariable( "AFN Node Temperature [C]", AirflowNetworkNodeSimu( i ).TZ, "System", "Average", AirflowNetworkNodeData( i ).Name );
 			SetupOutputVariable( "AFN Node Humidity Ratio [kgWater/kgDryAir]", AirflowNetworkNodeSimu( i ).WZ, "System", "Average", AirflowNetworkNodeData( i ).Name );
@@ -4821,8 +4826,10 @@ namespace AirflowNetworkBalanceManager {
 			}
 		}
 
-		// Get an inverse matrix
+		// Get an inverse matrix, kept for the generic contaminant balance that follows
+		if ( Contaminant.GenericContamSimulation ) MAContam = MA;
 		MRXINV( AirflowNetworkNumOfNodes );
+		if ( Contaminant.GenericContamSimulation ) MAContamInverse = MA;
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
@@ -5037,7 +5044,12 @@ namespace AirflowNetworkBalanceManager {
 		}
 
 		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// The CO2 balance assembles the same matrix from the same flows, so its inverse is reused when it matches
+		if ( Contaminant.CO2Simulation && MAContam.size() == MA.size() && eq( MAContam, MA ) ) {
+			MA = MAContamInverse;
+		} else {
+			MRXINV( AirflowNetworkNumOfNodes );
+		}
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
@@ -35,6 +35,9 @@ namespace AirflowNetworkBalanceManager {
 	extern Array1D< Real64 > MA;
 	extern Array1D< Real64 > MV;
 	extern Array1D_int IVEC;
+	// Contaminant matrix as assembled by the CO2 balance, and its inverse, for the generic contaminant balance
+	extern Array1D< Real64 > MAContam;
+	extern Array1D< Real64 > MAContamInverse;
 	extern Array1D_int SplitterNodeNumbers;
 
 	extern bool AirflowNetworkGetInputFlag;
@@ -1,5 +1,7 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <string>
 
 // ObjexxFCL Headers
@@ -19,6 +21,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <OutputProcessor.hh>
 #include <Psychrometrics.hh>
@@ -122,6 +125,19 @@ namespace AirflowNetworkSolver {
 	Array1D< Real64 > RhoProfT; // Density profile in TO zone [kg/m3]
 	Array2D< Real64 > DpL; // Array of stack pressures in link
 
+	// Jacobian reuse variables
+	Real64 const JacobianReuseRatio( 0.5 ); // Factors are kept while each iteration cuts the relative residual by this ratio
+	Array1D_int JacIK; // Column pointers of the factored skyline Jacobian
+	Array1D< Real64 > JacAD; // Main diagonal of the factored skyline Jacobian
+	Array1D< Real64 > JacAU; // Upper triangle of the factored skyline Jacobian
+	bool JacobianFactored( false ); // TRUE if the factors hold a Newton Jacobian that may be reused
+	int SolverIterations( 0 ); // Newton iterations of the last pressure solution
+	int SolverFactorizations( 0 ); // Jacobian factorizations of the last pressure solution
+
+	// Object Data
+	SparseJacobianData SparseJacobian;
+	CrackBatchData CrackBatch;
+
 	// Functions
 
 	void
@@ -421,6 +437,10 @@ namespace AirflowNetworkSolver {
 			IK( k + 1 ) = IK( k ) + j;
 			j = i;
 		}
+		// The sparse factors follow the new network
+		SparseJacobian.SymbolicDone = false;
+		JacobianFactored = false;
+		CrackBatch.Built = false;
 
 	}
 
@@ -507,6 +527,7 @@ namespace AirflowNetworkSolver {
 		PStack();
 
 		SOLVZP( IK, AD, AU, ITER );
+		SolverIterations = ITER;
 
 		// Report element flows and zone pressures.
 		for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
@@ -595,13 +616,18 @@ namespace AirflowNetworkSolver {
 		// This subroutine solves zone pressures by modified Newton-Raphson iteration
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// When AirflowNetworkJacobianReuse is set, the factored Jacobian is kept from one
+		// iteration to the next (and from the previous solution) as long as each iteration cuts
+		// the relative residual by JacobianReuseRatio; it is refactored when the reduction stalls
+		// and on every iteration past half of the iteration limit.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using General::RoundSigDigits;
+		using DataSystemVariables::AirflowNetworkSparseSolver;
+		using DataSystemVariables::AirflowNetworkJacobianReuse;
 
 		// Argument array dimensioning
 		IK.dim( NetworkNumOfNodes+1 );
@@ -642,6 +668,7 @@ namespace AirflowNetworkSolver {
 		int LFLAG;
 		int CONVG;
 		int ACCEL;
+		bool Refactor; // TRUE if the Jacobian of this iteration is factored
 		Array1D< Real64 > PCF( NetworkNumOfNodes );
 		Array1D< Real64 > CEF( NetworkNumOfNodes );
 		Real64 C;
@@ -661,11 +688,13 @@ namespace AirflowNetworkSolver {
 		NNZE = IK( NetworkNumOfNodes + 1 ) - 1;
 		if ( LIST >= 2 ) gio::write( Unit21, fmtLD ) << "Initialization" << NetworkNumOfNodes << NetworkNumOfLinks << NNZE;
 		ITER = 0;
+		SolverFactorizations = 0;
 
 		for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
 			PCF( n ) = 0.0;
 			CEF( n ) = 0.0;
 		}
+		if ( AirflowNetworkSparseSolver && ! SparseJacobian.SymbolicDone ) SETSPR();
 
 		if ( AirflowNetworkSimu.InitFlag != 1 ) {
 			// Initialize node/zone pressure values by assuming only linear relationship between
@@ -682,13 +711,9 @@ namespace AirflowNetworkSolver {
 				DUMPVR( "AF:", SUMF, NetworkNumOfNodes, Unit21 );
 			}
 			// Solve linear system for approximate PZ.
-#ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
-			FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
-			SLVSKY( newAU, AD, newAU, PZ, newIK, NetworkNumOfNodes, NSYM ); //noel
-#else
-			FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
-			SLVSKY( AU, AD, AU, PZ, IK, NetworkNumOfNodes, NSYM );
-#endif
+			FACJAC();
+			SLVJAC( PZ );
+			JacobianFactored = false; // The linear Jacobian is not kept for the Newton iterations
 			if ( LIST >= 2 ) DUMPVD( "PZ:", PZ, NetworkNumOfNodes, Unit21 );
 		}
 		// Solve nonlinear airflow network equations by modified Newton's method.
@@ -729,13 +754,15 @@ namespace AirflowNetworkSolver {
 			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
 				CCF( n ) = SUMF( n );
 			}
-#ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
-			FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
-			SLVSKY( newAU, AD, newAU, CCF, newIK, NetworkNumOfNodes, NSYM ); //noel
-#else
-			FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
-			SLVSKY( AU, AD, AU, CCF, IK, NetworkNumOfNodes, NSYM );
-#endif
+			Refactor = true;
+			if ( AirflowNetworkJacobianReuse && JacobianFactored && ITER <= AirflowNetworkSimu.MaxIteration / 2 ) {
+				Refactor = ( ITER > 1 && ACC1 > JacobianReuseRatio * ACC0 );
+			}
+			if ( Refactor ) {
+				FACJAC();
+				JacobianFactored = true;
+			}
+			SLVJAC( CCF );
 			// Revise PZ (Steffensen iteration on the N-R correction factors to handle oscillating corrections).
 			if ( ACCEL == 1 ) {
 				ACCEL = 0;
@@ -837,6 +864,7 @@ namespace AirflowNetworkSolver {
 		int n;
 		int FLAG;
 		int NF;
+		int k;
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
 		int LHK; // noel
 		int JHK;
@@ -870,6 +898,11 @@ namespace AirflowNetworkSolver {
 		for ( n = 1; n <= NNZE; ++n ) {
 			AU( n ) = 0.0;
 		}
+		// Surface cracks are evaluated together ahead of the link loop (AFESCR writes its own dump).
+		if ( LIST < 4 ) {
+			if ( ! CrackBatch.Built ) SETCRK();
+			AFESCRBatch( LFLAG );
+		}
 		//                              Set up the Jacobian matrix.
 		for ( i = 1; i <= NetworkNumOfLinks; ++i ) {
 			n = AirflowNetworkLinkageData( i ).NodeNums( 1 );
@@ -905,7 +938,14 @@ namespace AirflowNetworkSolver {
 			} else if ( SELECT_CASE_var == CompTypeNum_SOP ) { // Simple opening
 				AFESOP( j, LFLAG, DP, i, n, M, F, DF, NF );
 			} else if ( SELECT_CASE_var == CompTypeNum_SCR ) { // Surface crack component
-				AFESCR( j, LFLAG, DP, i, n, M, F, DF, NF );
+				if ( LIST < 4 && CrackBatch.Pos[ i - 1 ] > 0 ) {
+					k = CrackBatch.Pos[ i - 1 ] - 1;
+					F( 1 ) = CrackBatch.F[ k ];
+					DF( 1 ) = CrackBatch.DF[ k ];
+					NF = 1;
+				} else {
+					AFESCR( j, LFLAG, DP, i, n, M, F, DF, NF );
+				}
 			} else if ( SELECT_CASE_var == CompTypeNum_SEL ) { // Surface effective leakage ratio component
 				AFESEL( j, LFLAG, DP, i, n, M, F, DF, NF );
 			} else if ( SELECT_CASE_var == CompTypeNum_COI ) { // Distribution system coil component
@@ -1298,6 +1338,111 @@ namespace AirflowNetworkSolver {
 		}
 	}
 
+	void
+	SETCRK()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine gathers the surface crack links and their crack constants for AFESCRBatch.
+
+		auto & cb( CrackBatch );
+		cb.Pos.assign( NetworkNumOfLinks, 0 );
+		cb.Link.clear();
+		cb.Node1.clear();
+		cb.Node2.clear();
+		cb.FlowCoef.clear();
+		cb.Corr.clear();
+		cb.Expn.clear();
+		cb.RhozNorm.clear();
+		cb.VisczNorm.clear();
+		for ( int i = 1; i <= NetworkNumOfLinks; ++i ) {
+			int const j( AirflowNetworkLinkageData( i ).CompNum );
+			if ( AirflowNetworkCompData( j ).CompTypeNum != CompTypeNum_SCR ) continue;
+			int const CompNum( AirflowNetworkCompData( j ).TypeNum );
+			auto const & crack( MultizoneSurfaceCrackData( CompNum ) );
+			cb.Link.push_back( i );
+			cb.Pos[ i - 1 ] = int( cb.Link.size() );
+			cb.Node1.push_back( AirflowNetworkLinkageData( i ).NodeNums( 1 ) );
+			cb.Node2.push_back( AirflowNetworkLinkageData( i ).NodeNums( 2 ) );
+			cb.FlowCoef.push_back( crack.FlowCoef );
+			cb.Corr.push_back( MultizoneSurfaceData( i ).Factor );
+			cb.Expn.push_back( crack.FlowExpo );
+			cb.RhozNorm.push_back( PsyRhoAirFnPbTdbW( crack.StandardP, crack.StandardT, crack.StandardW ) );
+			cb.VisczNorm.push_back( 1.71432e-5 + 4.828e-8 * crack.StandardT );
+		}
+		std::size_t const NumCracks( cb.Link.size() );
+		cb.DP.assign( NumCracks, 0.0 );
+		cb.RhoUp.assign( NumCracks, 0.0 );
+		cb.ViscUp.assign( NumCracks, 0.0 );
+		cb.SqrtUp.assign( NumCracks, 0.0 );
+		cb.TUp.assign( NumCracks, 0.0 );
+		cb.VisAve.assign( NumCracks, 0.0 );
+		cb.Tave.assign( NumCracks, 0.0 );
+		cb.F.assign( NumCracks, 0.0 );
+		cb.DF.assign( NumCracks, 0.0 );
+		cb.Built = true;
+
+	}
+
+	void
+	AFESCRBatch( int const LFLAG ) // Initialization flag.If = 1, use laminar relationship
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine solves airflow for all surface crack links at the current pressures.
+
+		// METHODOLOGY EMPLOYED:
+		// Same relations as AFESCR, in two passes: the node properties on the upstream side of
+		// each crack are gathered into contiguous arrays, then the flows are computed in a loop
+		// without calls or subscript lookups that the compiler can vectorize.  The crack
+		// standard condition properties are computed once by SETCRK instead of on every call.
+		// The expressions are those of AFESCR, so the flows are the same to the last bit.
+
+		auto & cb( CrackBatch );
+		int const NumCracks( int( cb.Link.size() ) );
+
+		// Gather the node properties
+		for ( int k = 0; k < NumCracks; ++k ) {
+			int const i( cb.Link[ k ] );
+			int const n( cb.Node1[ k ] );
+			int const M( cb.Node2[ k ] );
+			Real64 const PDROP( i > NumOfLinksMultiZone ? PZ( n ) - PZ( M ) + PS( i ) + PW( i ) : PZ( n ) - PZ( M ) + DpL( i, 1 ) + PW( i ) );
+			int const Up( PDROP >= 0.0 ? n : M );
+			cb.DP[ k ] = PDROP;
+			cb.RhoUp[ k ] = RHOZ( Up );
+			cb.ViscUp[ k ] = VISCZ( Up );
+			cb.SqrtUp[ k ] = SQRTDZ( Up );
+			cb.TUp[ k ] = TZ( Up );
+			cb.VisAve[ k ] = ( VISCZ( n ) + VISCZ( M ) ) / 2.0;
+			cb.Tave[ k ] = ( TZ( n ) + TZ( M ) ) / 2.0;
+		}
+
+		// Crack flows
+		for ( int k = 0; k < NumCracks; ++k ) {
+			Real64 const PDROP( cb.DP[ k ] );
+			Real64 const expn( cb.Expn[ k ] );
+			Real64 const coef( cb.FlowCoef[ k ] / cb.SqrtUp[ k ] * cb.Corr[ k ] );
+			Real64 const RhoCor( ( cb.TUp[ k ] + KelvinConv ) / ( cb.Tave[ k ] + KelvinConv ) );
+			Real64 const Ctl( std::pow( cb.RhozNorm[ k ] / cb.RhoUp[ k ] / RhoCor, expn - 1.0 ) * std::pow( cb.VisczNorm[ k ] / cb.VisAve[ k ], 2.0 * expn - 1.0 ) );
+			Real64 const CDM( coef * cb.RhoUp[ k ] / cb.ViscUp[ k ] * Ctl );
+			if ( LFLAG == 1 ) {
+				// Initialization by linear relation.
+				cb.DF[ k ] = CDM;
+				cb.F[ k ] = -CDM * PDROP;
+			} else {
+				// Laminar and turbulent flow, taking the smaller
+				Real64 const FL( CDM * PDROP );
+				Real64 const APDROP( std::abs( PDROP ) );
+				Real64 FT( coef * cb.SqrtUp[ k ] * ( expn == 0.5 ? std::sqrt( APDROP ) : std::pow( APDROP, expn ) ) * Ctl );
+				if ( PDROP < 0.0 ) FT = -FT;
+				bool const Laminar( std::abs( FL ) <= std::abs( FT ) );
+				cb.F[ k ] = ( Laminar ? FL : FT );
+				cb.DF[ k ] = ( Laminar ? CDM : FT * expn / PDROP );
+			}
+		}
+
+	}
+
 	void
 	AFEDWC(
 		int const j, // Component number
@@ -3612,6 +3757,265 @@ Label90: ;
 
 	}
 
+	void
+	FACJAC()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine factors the Jacobian filled by FILJAC.  The factors are kept apart from
+		// AD and AU, so SLVJAC may use them again after FILJAC has refilled the Jacobian.
+
+		// Using/Aliasing
+		using DataSystemVariables::AirflowNetworkSparseSolver;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const NSYM( 0 ); // The Jacobian is symmetric
+
+		++SolverFactorizations;
+		if ( AirflowNetworkSparseSolver ) {
+			FACSPR( AD, AU );
+			return;
+		}
+#ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
+		JacIK = newIK; //noel
+		JacAU = newAU;
+#else
+		JacIK = IK;
+		JacAU = AU;
+#endif
+		JacAD = AD;
+		FACSKY( JacAU, JacAD, JacAU, JacIK, NetworkNumOfNodes, NSYM );
+
+	}
+
+	void
+	SLVJAC( Array1< Real64 > & B ) // "B" vector (input); "X" vector (output).
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine solves [A] * X = B with the factors from the last FACJAC.
+
+		// Using/Aliasing
+		using DataSystemVariables::AirflowNetworkSparseSolver;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const NSYM( 0 ); // The Jacobian is symmetric
+
+		if ( AirflowNetworkSparseSolver ) {
+			SLVSPR( B );
+		} else {
+			SLVSKY( JacAU, JacAD, JacAU, B, JacIK, NetworkNumOfNodes, NSYM );
+		}
+
+	}
+
+	void
+	SETSPR()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets the ordering and the pattern of the sparse LDL' factors of the
+		// Jacobian.  It is done once per network topology; FACSPR then only does the numeric
+		// factorization on each Newton iteration.
+
+		// METHODOLOGY EMPLOYED:
+		// Minimum degree ordering of the node graph of the links (ties go to the lowest node),
+		// then the elimination tree and the column counts of L.  The Jacobian entries are
+		// gathered from the skyline arrays filled by FILJAC.
+
+		// REFERENCES:
+		// Davis, T. A., 2005, "Algorithm 849: A concise sparse Cholesky factorization package,"
+		// ACM Transactions on Mathematical Software 31(4), 587-591.
+
+		auto & sp( SparseJacobian );
+		int const NEQ( NetworkNumOfNodes );
+		sp.NumNodes = NEQ;
+
+		// Node graph of the links, as used by SETSKY for the skyline profile
+		std::vector< std::vector< int > > Links( NEQ );
+		for ( int M = 1; M <= NetworkNumOfLinks; ++M ) {
+			int const N1( AirflowNetworkLinkageData( M ).NodeNums( 1 ) );
+			int const N2( AirflowNetworkLinkageData( M ).NodeNums( 2 ) );
+			if ( N1 < 1 || N2 < 1 || N1 == N2 ) continue;
+			Links[ N1 - 1 ].push_back( N2 - 1 );
+			Links[ N2 - 1 ].push_back( N1 - 1 );
+		}
+		for ( auto & Adj : Links ) {
+			std::sort( Adj.begin(), Adj.end() );
+			Adj.erase( std::unique( Adj.begin(), Adj.end() ), Adj.end() );
+		}
+
+		// Minimum degree ordering on the elimination graph
+		std::vector< std::vector< int > > Graph( Links );
+		std::vector< bool > Eliminated( NEQ, false );
+		std::vector< int > Merged;
+		sp.Perm.clear();
+		sp.Perm.reserve( NEQ );
+		for ( int Step = 0; Step < NEQ; ++Step ) {
+			int Node( -1 );
+			for ( int i = 0; i < NEQ; ++i ) {
+				if ( Eliminated[ i ] ) continue;
+				if ( Node < 0 || Graph[ i ].size() < Graph[ Node ].size() ) Node = i;
+			}
+			Eliminated[ Node ] = true;
+			sp.Perm.push_back( Node + 1 );
+			std::vector< int > Neighbors;
+			Neighbors.swap( Graph[ Node ] );
+			for ( int const u : Neighbors ) {
+				Merged.clear();
+				std::set_union( Graph[ u ].begin(), Graph[ u ].end(), Neighbors.begin(), Neighbors.end(), std::back_inserter( Merged ) );
+				Merged.erase( std::remove_if( Merged.begin(), Merged.end(), [ u, Node ]( int const w ) { return w == u || w == Node; } ), Merged.end() );
+				Graph[ u ].swap( Merged );
+			}
+		}
+		std::vector< int > Position( NEQ ); // Position of each node in the ordered matrix
+		for ( int k = 0; k < NEQ; ++k ) Position[ sp.Perm[ k ] - 1 ] = k;
+
+		// Upper triangle of the ordered matrix by column, with the AU entry of each
+		sp.Ap.assign( NEQ + 1, 0 );
+		sp.Ai.clear();
+		sp.AUIndex.clear();
+		std::vector< std::pair< int, int > > Column;
+		for ( int k = 0; k < NEQ; ++k ) {
+			int const Node( sp.Perm[ k ] );
+			Column.clear();
+			for ( int const w : Links[ Node - 1 ] ) {
+				if ( Position[ w ] >= k ) continue;
+				int const Lo( min( Node, w + 1 ) );
+				int const Hi( max( Node, w + 1 ) );
+				Column.push_back( std::make_pair( Position[ w ], IK( Hi + 1 ) - Hi + Lo ) );
+			}
+			std::sort( Column.begin(), Column.end() );
+			for ( auto const & Entry : Column ) {
+				sp.Ai.push_back( Entry.first );
+				sp.AUIndex.push_back( Entry.second );
+			}
+			sp.Ai.push_back( k );
+			sp.AUIndex.push_back( 0 );
+			sp.Ap[ k + 1 ] = int( sp.Ai.size() );
+		}
+
+		// Elimination tree and column counts of L
+		sp.Parent.assign( NEQ, -1 );
+		sp.Lnz.assign( NEQ, 0 );
+		sp.Flag.assign( NEQ, -1 );
+		for ( int k = 0; k < NEQ; ++k ) {
+			sp.Flag[ k ] = k;
+			for ( int p = sp.Ap[ k ]; p < sp.Ap[ k + 1 ]; ++p ) {
+				for ( int i = sp.Ai[ p ]; sp.Flag[ i ] != k; i = sp.Parent[ i ] ) {
+					if ( sp.Parent[ i ] == -1 ) sp.Parent[ i ] = k;
+					++sp.Lnz[ i ];
+					sp.Flag[ i ] = k;
+				}
+			}
+		}
+		sp.Lp.assign( NEQ + 1, 0 );
+		for ( int k = 0; k < NEQ; ++k ) sp.Lp[ k + 1 ] = sp.Lp[ k ] + sp.Lnz[ k ];
+		sp.Li.assign( sp.Lp[ NEQ ], 0 );
+		sp.Lx.assign( sp.Lp[ NEQ ], 0.0 );
+		sp.D.assign( NEQ, 0.0 );
+		sp.Y.assign( NEQ, 0.0 );
+		sp.Pattern.assign( NEQ, 0 );
+		sp.SymbolicDone = true;
+
+	}
+
+	void
+	FACSPR(
+		Array1< Real64 > const & AD, // the main diagonal of [A]
+		Array1< Real64 > const & AU // the upper triangle of [A] in skyline form
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine does the numeric LDL' factorization of the Jacobian on the pattern set
+		// by SETSPR.  AD and AU are left as filled by FILJAC.
+
+		// METHODOLOGY EMPLOYED:
+		// Up-looking factorization, one row of L at a time, following the elimination tree.
+		// No pivoting, as for FACSKY.
+
+		// REFERENCES:
+		// Davis, T. A., 2005, "Algorithm 849: A concise sparse Cholesky factorization package,"
+		// ACM Transactions on Mathematical Software 31(4), 587-591.
+
+		auto & sp( SparseJacobian );
+		int const NEQ( sp.NumNodes );
+
+		for ( int k = 0; k < NEQ; ++k ) {
+			// Scatter column k of the upper triangle and find the pattern of row k of L
+			sp.Y[ k ] = 0.0;
+			int Top( NEQ );
+			sp.Flag[ k ] = k;
+			sp.Lnz[ k ] = 0;
+			for ( int p = sp.Ap[ k ]; p < sp.Ap[ k + 1 ]; ++p ) {
+				int i( sp.Ai[ p ] );
+				sp.Y[ i ] += ( sp.AUIndex[ p ] > 0 ? AU( sp.AUIndex[ p ] ) : AD( sp.Perm[ k ] ) );
+				int Len( 0 );
+				for ( ; sp.Flag[ i ] != k; i = sp.Parent[ i ] ) {
+					sp.Pattern[ Len++ ] = i;
+					sp.Flag[ i ] = k;
+				}
+				while ( Len > 0 ) sp.Pattern[ --Top ] = sp.Pattern[ --Len ];
+			}
+			// Row k of L and the k-th entry of D
+			sp.D[ k ] = sp.Y[ k ];
+			sp.Y[ k ] = 0.0;
+			for ( ; Top < NEQ; ++Top ) {
+				int const i( sp.Pattern[ Top ] );
+				Real64 const Yi( sp.Y[ i ] );
+				sp.Y[ i ] = 0.0;
+				int const pEnd( sp.Lp[ i ] + sp.Lnz[ i ] );
+				for ( int p = sp.Lp[ i ]; p < pEnd; ++p ) {
+					sp.Y[ sp.Li[ p ] ] -= sp.Lx[ p ] * Yi;
+				}
+				Real64 const Lki( Yi / sp.D[ i ] );
+				sp.D[ k ] -= Lki * Yi;
+				sp.Li[ pEnd ] = k;
+				sp.Lx[ pEnd ] = Lki;
+				++sp.Lnz[ i ];
+			}
+			if ( sp.D[ k ] == 0.0 ) {
+				ShowSevereError( "AirflowNetworkSolver: LDL' factorization in Subroutine FACSPR." );
+				ShowContinueError( "The pivot used in LDL' factorization is equal to 0.0 at node = " + AirflowNetworkNodeData( sp.Perm[ k ] ).Name + '.' );
+				ShowContinueError( "One possible cause is that this node may not be connected directly, or indirectly via airflow network connections " );
+				ShowContinueError( "(e.g., AirflowNetwork:Multizone:SurfaceCrack, AirflowNetwork:Multizone:Component:SimpleOpening, etc.), to an external" );
+				ShowContinueError( "node (AirflowNetwork:MultiZone:Surface)." );
+				ShowFatalError( "Preceding condition causes termination." );
+			}
+		}
+
+	}
+
+	void
+	SLVSPR( Array1< Real64 > & B ) // "B" vector (input); "X" vector (output).
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine solves [A] * X = B using the LDL' factors from FACSPR.
+
+		auto & sp( SparseJacobian );
+		int const NEQ( sp.NumNodes );
+		auto & X( sp.Y );
+
+		for ( int k = 0; k < NEQ; ++k ) X[ k ] = B( sp.Perm[ k ] );
+		for ( int j = 0; j < NEQ; ++j ) {
+			Real64 const Xj( X[ j ] );
+			for ( int p = sp.Lp[ j ]; p < sp.Lp[ j + 1 ]; ++p ) X[ sp.Li[ p ] ] -= sp.Lx[ p ] * Xj;
+		}
+		for ( int j = 0; j < NEQ; ++j ) X[ j ] /= sp.D[ j ];
+		for ( int j = NEQ - 1; j >= 0; --j ) {
+			Real64 Xj( X[ j ] );
+			for ( int p = sp.Lp[ j ]; p < sp.Lp[ j + 1 ]; ++p ) Xj -= sp.Lx[ p ] * X[ sp.Li[ p ] ];
+			X[ j ] = Xj;
+		}
+		for ( int k = 0; k < NEQ; ++k ) {
+			B( sp.Perm[ k ] ) = X[ k ];
+			X[ k ] = 0.0;
+		}
+
+	}
+
 	void
 	FILSKY(
 		Array1A< Real64 > const X, // element array (row-wise sequence)
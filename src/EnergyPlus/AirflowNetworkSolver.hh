@@ -1,6 +1,9 @@
 #ifndef AirflowNetworkSolver_hh_INCLUDED
 #define AirflowNetworkSolver_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -63,6 +66,84 @@ namespace AirflowNetworkSolver {
 	extern Array1D< Real64 > RhoProfT; // Density profile in TO zone [kg/m3]
 	extern Array2D< Real64 > DpL; // Array of stack pressures in link
 
+	// Jacobian reuse variables
+	extern Real64 const JacobianReuseRatio; // Factors are kept while each iteration cuts the relative residual by this ratio
+	extern Array1D_int JacIK; // Column pointers of the factored skyline Jacobian
+	extern Array1D< Real64 > JacAD; // Main diagonal of the factored skyline Jacobian
+	extern Array1D< Real64 > JacAU; // Upper triangle of the factored skyline Jacobian
+	extern bool JacobianFactored; // TRUE if the factors hold a Newton Jacobian that may be reused
+	extern int SolverIterations; // Newton iterations of the last pressure solution
+	extern int SolverFactorizations; // Jacobian factorizations of the last pressure solution
+
+	// Types
+
+	struct SparseJacobianData
+	{
+		// Sparse LDL' factors of the Jacobian, used instead of the skyline factors when selected.
+		// Positions are 0 based; nodes are the 1 based airflow network node numbers.
+
+		// Members
+		bool SymbolicDone; // True once the ordering and the pattern of L are set for the network
+		int NumNodes; // Number of equations
+		std::vector< int > Perm; // Node at each position of the ordered matrix
+		std::vector< int > Ap; // Column starts of the upper triangle (diagonal last) of the ordered matrix
+		std::vector< int > Ai; // Row position of each entry
+		std::vector< int > AUIndex; // AU index of each entry, 0 for the diagonal (taken from AD)
+		std::vector< int > Parent; // Elimination tree, -1 for a root
+		std::vector< int > Lp; // Column starts of L
+		std::vector< int > Lnz; // Entries of each column of L
+		std::vector< int > Li; // Row position of each entry of L
+		std::vector< Real64 > Lx; // Entries of L
+		std::vector< Real64 > D; // Diagonal of D
+		std::vector< Real64 > Y; // Work vector
+		std::vector< int > Pattern; // Work vector
+		std::vector< int > Flag; // Work vector
+
+		// Default Constructor
+		SparseJacobianData() :
+			SymbolicDone( false ),
+			NumNodes( 0 )
+		{}
+
+	};
+
+	struct CrackBatchData
+	{
+		// Surface crack links, gathered so FILJAC evaluates them in one pass instead of one
+		// AFESCR call each.  Positions are 0 based.
+
+		// Members
+		bool Built; // True once the crack links have been gathered
+		std::vector< int > Pos; // Batch position plus 1 of each link (by link number - 1), 0 if not batched
+		std::vector< int > Link; // Link number
+		std::vector< int > Node1; // Node 1 number
+		std::vector< int > Node2; // Node 2 number
+		std::vector< Real64 > FlowCoef; // Crack flow coefficient
+		std::vector< Real64 > Corr; // Crack factor of the surface
+		std::vector< Real64 > Expn; // Crack flow exponent
+		std::vector< Real64 > RhozNorm; // Air density at the crack standard conditions [kg/m3]
+		std::vector< Real64 > VisczNorm; // Air viscosity at the crack standard conditions [kg/m-s]
+		std::vector< Real64 > DP; // Pressure drop (P1 - P2) [Pa]
+		std::vector< Real64 > RhoUp; // Upstream node properties
+		std::vector< Real64 > ViscUp;
+		std::vector< Real64 > SqrtUp;
+		std::vector< Real64 > TUp;
+		std::vector< Real64 > VisAve; // Average of the node viscosities
+		std::vector< Real64 > Tave; // Average of the node temperatures
+		std::vector< Real64 > F; // Airflow through the crack [kg/s]
+		std::vector< Real64 > DF; // Partial derivative:  DF/DP
+
+		// Default Constructor
+		CrackBatchData() :
+			Built( false )
+		{}
+
+	};
+
+	// Object Data
+	extern SparseJacobianData SparseJacobian;
+	extern CrackBatchData CrackBatch;
+
 	// Functions
 
 	void
@@ -337,6 +418,30 @@ namespace AirflowNetworkSolver {
 		int const NSYM // symmetry:  0 = symmetric matrix, 1 = non-symmetric
 	);
 
+	void
+	SETCRK();
+
+	void
+	AFESCRBatch( int const LFLAG ); // Initialization flag.If = 1, use laminar relationship
+
+	void
+	FACJAC();
+
+	void
+	SLVJAC( Array1< Real64 > & B );
+
+	void
+	SETSPR();
+
+	void
+	FACSPR(
+		Array1< Real64 > const & AD, // the main diagonal of [A]
+		Array1< Real64 > const & AU // the upper triangle of [A] in skyline form
+	);
+
+	void
+	SLVSPR( Array1< Real64 > & B ); // "B" vector (input); "X" vector (output).
+
 	void
 	FILSKY(
 		Array1A< Real64 > const X, // element array (row-wise sequence)
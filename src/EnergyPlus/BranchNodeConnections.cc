@@ -106,7 +106,6 @@ namespace BranchNodeConnections {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		bool ErrorsFoundHere;
-		int Count;
 		bool MakeNew;
 		int Found;
 
@@ -118,8 +117,8 @@ namespace BranchNodeConnections {
 		}
 
 		MakeNew = true;
-		for ( Count = 1; Count <= NumOfNodeConnections; ++Count ) {
-			if ( NodeConnections( Count ).NodeNumber != NodeNumber ) continue;
+		auto & SameNodeConnections( NodeConnectionsOfNode[ NodeNumber ] );
+		for ( int const Count : SameNodeConnections ) {
 			if ( ! SameString( NodeConnections( Count ).ObjectType, ObjectType ) ) continue;
 			if ( ! SameString( NodeConnections( Count ).ObjectName, ObjectName ) ) continue;
 			if ( ! SameString( NodeConnections( Count ).ConnectionType, ConnectionType ) ) continue;
@@ -147,6 +146,8 @@ namespace BranchNodeConnections {
 			NodeConnections( NumOfNodeConnections ).ConnectionType = ConnectionType;
 			NodeConnections( NumOfNodeConnections ).FluidStream = FluidStream;
 			NodeConnections( NumOfNodeConnections ).ObjectIsParent = IsParent;
+			SameNodeConnections.push_back( NumOfNodeConnections );
+			FirstNodeConnectionOfObject.emplace( NodeConnections( NumOfNodeConnections ).ObjectType + ',' + ObjectName, NumOfNodeConnections );
 
 		}
 
@@ -161,7 +162,8 @@ namespace BranchNodeConnections {
 				}
 
 				// Check out AirTerminal inlet/outlet nodes
-				Found = FindItemInList( NodeName, AirTerminalNodeConnections.NodeName(), NumOfAirTerminalNodes - 1 );
+				auto const TerminalNode( AirTerminalNodeOfName.find( NodeName ) );
+				Found = ( TerminalNode != AirTerminalNodeOfName.end() ? TerminalNode->second : 0 );
 				if ( Found != 0 ) { // Nodename already used
 					ShowSevereError( RoutineName + ObjectType + "=\"" + ObjectName + "\" node name duplicated." );
 					ShowContinueError( "NodeName=\"" + NodeName + "\", entered as type=" + ConnectionType );
@@ -175,6 +177,7 @@ namespace BranchNodeConnections {
 					AirTerminalNodeConnections( NumOfAirTerminalNodes ).ObjectName = ObjectName;
 					AirTerminalNodeConnections( NumOfAirTerminalNodes ).ConnectionType = ConnectionType;
 					AirTerminalNodeConnections( NumOfAirTerminalNodes ).InputFieldName = InputFieldName;
+					AirTerminalNodeOfName[ NodeName ] = NumOfAirTerminalNodes;
 				}
 			} else {
 				ShowSevereError( RoutineName + ObjectType + ", Developer Error: Input Field Name not included." );
@@ -239,6 +242,21 @@ namespace BranchNodeConnections {
 
 	}
 
+	std::vector< int > const &
+	NodeConnectionsOfNodeNumber( int const NodeNumber )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the node connections registered for a node number, in registration order.
+
+		static std::vector< int > const NoNodeConnections;
+
+		auto const SameNodeConnections( NodeConnectionsOfNode.find( NodeNumber ) );
+		if ( SameNodeConnections == NodeConnectionsOfNode.end() ) return NoNodeConnections;
+		return SameNodeConnections->second;
+
+	}
+
 	void
 	CheckNodeConnections( bool & ErrorsFound )
 	{
@@ -271,7 +289,9 @@ namespace BranchNodeConnections {
 		// 7.  Any given node can only be an outlet once in the list of Non-Parent Node Connections
 
 		// METHODOLOGY EMPLOYED:
-		// Needs description, as appropriate.
+		// Each check only looks at the other connections of the same node, taken in
+		// registration order from NodeConnectionsOfNode, so the checks scale with the
+		// number of node connections and report as a scan of the whole list would.
 
 		// REFERENCES:
 		// na
@@ -315,11 +335,10 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
 				IsValid = true;
 			}
 			if ( ! IsValid ) {
@@ -333,12 +352,11 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
 				IsValid = true;
 			}
 			if ( ! IsValid ) {
@@ -356,13 +374,12 @@ namespace BranchNodeConnections {
 			IsValid = false;
 			IsInlet = false;
 			IsOutlet = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_SetPoint ) ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Inlet ) ) IsInlet = true;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Outlet ) ) IsOutlet = true;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_SetPoint ) ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Inlet ) ) IsInlet = true;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Outlet ) ) IsOutlet = true;
 				IsValid = true;
 			}
 			if ( ! IsValid ) {
@@ -408,10 +425,9 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_ZoneInlet ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Outlet ) ) continue;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Outlet ) ) continue;
 				IsValid = true;
 			}
 			if ( ! IsValid ) {
@@ -426,10 +442,9 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_ZoneExhaust ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
 				IsValid = true;
 			}
 			if ( ! IsValid ) {
@@ -444,10 +459,9 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_InducedAir ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
 				IsValid = true;
 			}
 			if ( ! IsValid ) {
@@ -467,14 +481,13 @@ namespace BranchNodeConnections {
 			if ( NodeConnections( Loop1 ).ObjectType == "AIRLOOPHVAC" || NodeConnections( Loop1 ).ObjectType == "CONDENSERLOOP" || NodeConnections( Loop1 ).ObjectType == "PLANTLOOP" ) continue;
 			IsValid = false;
 			MatchedAtLeastOne = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Outlet ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ZoneReturn ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ZoneExhaust ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_InducedAir ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ReliefAir ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) {
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Outlet ) || NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ZoneReturn ) || NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ZoneExhaust ) || NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_InducedAir ) || NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ReliefAir ) || NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) {
 					MatchedAtLeastOne = true;
 					continue;
 				}
-				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Inlet ) && ( NodeConnections( Loop2 ).ObjectType == "AIRLOOPHVAC" || NodeConnections( Loop2 ).ObjectType == "CONDENSERLOOP" || NodeConnections( Loop2 ).ObjectType == "PLANTLOOP" ) ) {
+				if ( NodeConnections( OtherConnect ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Inlet ) && ( NodeConnections( OtherConnect ).ObjectType == "AIRLOOPHVAC" || NodeConnections( OtherConnect ).ObjectType == "CONDENSERLOOP" || NodeConnections( OtherConnect ).ObjectType == "PLANTLOOP" ) ) {
 					MatchedAtLeastOne = true;
 					continue;
 				}
@@ -494,14 +507,14 @@ namespace BranchNodeConnections {
 			// Only non-parent node connections
 			if ( NodeConnections( Loop1 ).ObjectIsParent ) continue;
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
-			for ( Loop2 = Loop1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop2 ).ObjectIsParent ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
-				if ( NodeConnections( Loop2 ).NodeNumber == NodeConnections( Loop1 ).NodeNumber ) {
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect <= Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ObjectIsParent ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
+				if ( NodeConnections( OtherConnect ).NodeNumber == NodeConnections( Loop1 ).NodeNumber ) {
 					ShowSevereError( "Node Connection Error, Node=\"" + NodeConnections( Loop1 ).NodeName + "\", The same node appears as a non-parent Inlet node more than once." );
 					ShowContinueError( "Reference Object=" + NodeConnections( Loop1 ).ObjectType + ", Name=" + NodeConnections( Loop1 ).ObjectName );
-					ShowContinueError( "Reference Object=" + NodeConnections( Loop2 ).ObjectType + ", Name=" + NodeConnections( Loop2 ).ObjectName );
+					ShowContinueError( "Reference Object=" + NodeConnections( OtherConnect ).ObjectType + ", Name=" + NodeConnections( OtherConnect ).ObjectName );
 					++ErrorCounter;
 					//        ErrorsFound=.TRUE.
 					break;
@@ -517,17 +530,17 @@ namespace BranchNodeConnections {
 			// Skip if DIRECT AIR, because it only has one node which is an outlet, so it dupes the outlet which feeds it
 			if ( NodeConnections( Loop1 ).ObjectType == "AIRTERMINAL:SINGLEDUCT:UNCONTROLLED" ) continue;
 			IsValid = true;
-			for ( Loop2 = Loop1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop2 ).ObjectIsParent ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Outlet ) ) continue;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect <= Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ObjectIsParent ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Outlet ) ) continue;
 				// Skip if DIRECT AIR, because it only has one node which is an outlet, so it dupes the outlet which feeds it
-				if ( NodeConnections( Loop2 ).ObjectType == "AIRTERMINAL:SINGLEDUCT:UNCONTROLLED" ) continue;
-				if ( NodeConnections( Loop2 ).NodeNumber == NodeConnections( Loop1 ).NodeNumber ) {
+				if ( NodeConnections( OtherConnect ).ObjectType == "AIRTERMINAL:SINGLEDUCT:UNCONTROLLED" ) continue;
+				if ( NodeConnections( OtherConnect ).NodeNumber == NodeConnections( Loop1 ).NodeNumber ) {
 					// Skip if one of the
 					ShowSevereError( "Node Connection Error, Node=\"" + NodeConnections( Loop1 ).NodeName + "\", The same node appears as a non-parent Outlet node more than once." );
 					ShowContinueError( "Reference Object=" + NodeConnections( Loop1 ).ObjectType + ", Name=" + NodeConnections( Loop1 ).ObjectName );
-					ShowContinueError( "Reference Object=" + NodeConnections( Loop2 ).ObjectType + ", Name=" + NodeConnections( Loop2 ).ObjectName );
+					ShowContinueError( "Reference Object=" + NodeConnections( OtherConnect ).ObjectType + ", Name=" + NodeConnections( OtherConnect ).ObjectName );
 					++ErrorCounter;
 					//        ErrorsFound=.TRUE.
 					break;
@@ -539,10 +552,9 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_OutsideAirReference ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
-				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
+			for ( int const OtherConnect : NodeConnectionsOfNodeNumber( NodeConnections( Loop1 ).NodeNumber ) ) {
+				if ( OtherConnect == Loop1 ) continue;
+				if ( NodeConnections( OtherConnect ).ConnectionType != ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
 				IsValid = true;
 				break;
 			}
@@ -666,12 +678,11 @@ namespace BranchNodeConnections {
 		int Loop;
 
 		IsParent = false;
-		for ( Loop = 1; Loop <= NumOfNodeConnections; ++Loop ) {
-			if ( NodeConnections( Loop ).ObjectType == ComponentType && NodeConnections( Loop ).ObjectName == ComponentName ) {
-				if ( NodeConnections( Loop ).ObjectIsParent ) {
-					IsParent = true;
-				}
-				break;
+		auto const FirstConnection( FirstNodeConnectionOfObject.find( ComponentType + ',' + ComponentName ) );
+		if ( FirstConnection != FirstNodeConnectionOfObject.end() ) {
+			Loop = FirstConnection->second;
+			if ( NodeConnections( Loop ).ObjectIsParent ) {
+				IsParent = true;
 			}
 		}
 		if ( ! IsParent ) {
@@ -883,14 +894,10 @@ namespace BranchNodeConnections {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Loop;
-
 		IsParent = false;
-		for ( Loop = 1; Loop <= NumCompSets; ++Loop ) {
-			if ( CompSets( Loop ).ParentCType == ComponentType && CompSets( Loop ).ParentCName == ComponentName ) {
-				IsParent = true;
-				break;
-			}
+		auto const ParentSets( NumCompSetsOfParent.find( ComponentType + ',' + ComponentName ) );
+		if ( ParentSets != NumCompSetsOfParent.end() && ParentSets->second > 0 ) {
+			IsParent = true;
 		}
 
 		return IsParent;
@@ -1466,8 +1473,10 @@ namespace BranchNodeConnections {
 			//  See if something undefined and set here
 			if ( CompSets( Count ).ParentCType == "UNDEFINED" && CompSets( Count ).ParentCName == "UNDEFINED" ) {
 				// Assume this is a further definition for this compset
+				--NumCompSetsOfParent[ CompSets( Count ).ParentCType + ',' + CompSets( Count ).ParentCName ];
 				CompSets( Count ).ParentCType = ParentTypeUC;
 				CompSets( Count ).ParentCName = ParentName;
+				++NumCompSetsOfParent[ ParentTypeUC + ',' + ParentName ];
 				if ( present( Description ) ) CompSets( Count ).Description = Description;
 				Found = Count;
 				break;
@@ -1549,6 +1558,7 @@ namespace BranchNodeConnections {
 			CompSets.redimension( ++NumCompSets );
 			CompSets( NumCompSets ).ParentCType = ParentTypeUC;
 			CompSets( NumCompSets ).ParentCName = ParentName;
+			++NumCompSetsOfParent[ ParentTypeUC + ',' + ParentName ];
 			CompSets( NumCompSets ).CType = CompTypeUC;
 			CompSets( NumCompSets ).CName = CompName;
 			CompSets( NumCompSets ).InletNodeName = InletNode;
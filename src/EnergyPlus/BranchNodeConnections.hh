@@ -1,6 +1,9 @@
 #ifndef BranchNodeConnections_hh_INCLUDED
 #define BranchNodeConnections_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -43,6 +46,9 @@ namespace BranchNodeConnections {
 	bool
 	IsValidConnectionType( std::string const & ConnectionType );
 
+	std::vector< int > const &
+	NodeConnectionsOfNodeNumber( int const NodeNumber );
+
 	void
 	CheckNodeConnections( bool & ErrorsFound );
 
@@ -0,0 +1,666 @@
+// C++ Headers
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// Third-party Headers
+#include <zlib.h>
+
+// EnergyPlus Headers
+#include <ColumnarOutput.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <InputProcessor.hh>
+#include <OutputProcessor.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace ColumnarOutput {
+
+	// PURPOSE OF THIS MODULE:
+	// Writes the report variable and meter time series to a binary columnar file (Output:Columnar),
+	// so detailed output on large models need not be formatted as text and parsed back again.
+
+	// METHODOLOGY EMPLOYED:
+	// The output processor passes the same dictionary entries, time stamps and values it gives
+	// the eso, mtr and SQLite outputs.  Each variable or meter is a column: its values, with the
+	// time table row each belongs to, are held until a chunk is full and then written as one
+	// zlib compressed record.  Time stamps go to one of four time tables (time step and hourly,
+	// daily, monthly, run period) the same way.  Within a chunk each field is stored for all the
+	// rows in turn, and the 8 byte reals are split into byte planes first, which is what lets
+	// the compressor find the repetition in slowly changing series.
+
+	// File layout (native byte order): the signature, then records of a one byte record type, a
+	// 32 bit payload length and the payload.
+	//   DictionaryRecord: report ID, reporting interval, store type, index type (32 bit), meter
+	//     flag (one byte), key, name and units (32 bit length and the characters).
+	//   TimeChunkRecord: time table, row count, raw size (32 bit), then compressed: environment,
+	//     day of simulation (32 bit), month, day of month, hour, DST, warmup (one byte), start and
+	//     end minute (byte planes), day type (one byte length and the characters) for each row.
+	//   ValueChunkRecord: report ID, value count (32 bit), min/max flag (one byte), raw size (32
+	//     bit), then compressed: row number step from the previous value of the column (32 bit),
+	//     value (byte planes) and, with the flag, minimum, its date, maximum, its date.
+
+	// REFERENCES: na
+
+	// OTHER NOTES: na
+
+	// Using/Aliasing
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	std::string const ColumnarMagic( "EPCOL001" ); // Signature at the start of the columnar output file
+	int const ChunkSize( 1024 ); // Values held for a column before its chunk is written
+	int const NumTimeTables( 4 ); // Time step (and hourly), daily, monthly and run period stamps
+
+	int const DictionaryRecord( 1 ); // Record types of the columnar output file
+	int const TimeChunkRecord( 2 );
+	int const ValueChunkRecord( 3 );
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool WriteColumnarOutput( false ); // True when Output:Columnar is given
+	bool ColumnarOutputOnly( false ); // True when the values are not formatted into the eso and mtr files
+
+	// Object Data
+	std::ofstream ColumnarFile;
+	Array1D< ColumnarTimeTable > TimeTables;
+	std::vector< ColumnarSeries > Series;
+	std::unordered_map< int, int > SeriesIndex; // Report ID to position in Series
+
+	// Functions
+
+	void
+	InitColumnarOutput()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gets the Output:Columnar input and opens the columnar output file when it is given.
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectItem;
+		using InputProcessor::SameString;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D_string Alphas( 1 );
+		Array1D< Real64 > Numbers( 1 );
+		int NumAlphas;
+		int NumNumbers;
+		int IOStatus;
+
+		WriteColumnarOutput = false;
+		ColumnarOutputOnly = false;
+		if ( GetNumObjectsFound( "Output:Columnar" ) == 0 ) return;
+
+		GetObjectItem( "Output:Columnar", 1, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus );
+		bool ValuesOnly( false );
+		if ( NumAlphas > 0 && SameString( Alphas( 1 ), "ColumnarOnly" ) ) ValuesOnly = true;
+		OpenColumnarOutput( DataStringGlobals::outputColFileName, ValuesOnly );
+		if ( ! WriteColumnarOutput ) {
+			ShowSevereError( "InitColumnarOutput: Could not open file " + DataStringGlobals::outputColFileName + " for output (write)." );
+			ShowContinueError( "...Output:Columnar will not be written." );
+		}
+
+	}
+
+	void
+	OpenColumnarOutput(
+		std::string const & FileName,
+		bool const ValuesOnly // The values are not formatted into the eso and mtr files
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts a new columnar output file.
+
+		if ( ColumnarFile.is_open() ) ColumnarFile.close();
+		ColumnarFile.clear();
+		ColumnarFile.open( FileName, std::ios::out | std::ios::binary | std::ios::trunc );
+		TimeTables.deallocate();
+		TimeTables.allocate( NumTimeTables );
+		Series.clear();
+		SeriesIndex.clear();
+		WriteColumnarOutput = bool( ColumnarFile );
+		ColumnarOutputOnly = WriteColumnarOutput && ValuesOnly;
+		if ( WriteColumnarOutput ) ColumnarFile.write( ColumnarMagic.data(), ColumnarMagic.size() );
+
+	}
+
+	int
+	ColumnarTimeTableNum( int const ReportingInterval )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the time table whose stamps the values of the reporting interval belong to.
+
+		// METHODOLOGY EMPLOYED:
+		// Detailed, time step and hourly values follow the time step stamp, as in the eso file.
+
+		// Using/Aliasing
+		using OutputProcessor::ReportDaily;
+		using OutputProcessor::ReportMonthly;
+		using OutputProcessor::ReportSim;
+
+		if ( ReportingInterval == ReportDaily ) return 2;
+		if ( ReportingInterval == ReportMonthly ) return 3;
+		if ( ReportingInterval == ReportSim ) return 4;
+		return 1;
+
+	}
+
+	void
+	WriteColumnarDictionaryItem(
+		int const ReportID,
+		int const ReportingInterval,
+		int const StoreType,
+		int const IndexType,
+		bool const Meter,
+		std::string const & KeyedValue,
+		std::string const & VariableName,
+		std::string const & Units
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the column of a report variable or meter and writes its dictionary entry.
+
+		if ( ! WriteColumnarOutput ) return;
+		if ( SeriesIndex.find( ReportID ) != SeriesIndex.end() ) return;
+
+		ColumnarSeries Column;
+		Column.ReportID = ReportID;
+		Column.ReportingInterval = ReportingInterval;
+		Column.StoreType = StoreType;
+		Column.IndexType = IndexType;
+		Column.Meter = Meter;
+		Column.KeyedValue = KeyedValue;
+		Column.VariableName = VariableName;
+		Column.Units = Units;
+		Column.Table = ColumnarTimeTableNum( ReportingInterval );
+		SeriesIndex[ ReportID ] = int( Series.size() );
+		Series.push_back( Column );
+
+		std::string Payload;
+		auto put_int = [&]( int const Value ) {
+			std::int32_t const Value32( Value );
+			Payload.append( reinterpret_cast< char const * >( &Value32 ), sizeof( Value32 ) );
+		};
+		auto put_string = [&]( std::string const & Value ) {
+			put_int( int( Value.size() ) );
+			Payload.append( Value );
+		};
+		put_int( ReportID );
+		put_int( ReportingInterval );
+		put_int( StoreType );
+		put_int( IndexType );
+		Payload.push_back( Meter ? 1 : 0 );
+		put_string( KeyedValue );
+		put_string( VariableName );
+		put_string( Units );
+		WriteColumnarRecord( DictionaryRecord, Payload );
+
+	}
+
+	void
+	WriteColumnarTimeIndex(
+		int const ReportingInterval,
+		int const DayOfSim,
+		int const Month,
+		int const DayOfMonth,
+		int const Hour,
+		int const DST,
+		Real64 const StartMinute,
+		Real64 const EndMinute,
+		std::string const & DayType
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a time stamp to the time table of the reporting interval; the values reported
+		// until the next stamp of that table belong to it.
+
+		if ( ! WriteColumnarOutput ) return;
+
+		ColumnarTimeRow Row;
+		Row.EnvNum = DataEnvironment::CurEnvirNum;
+		Row.DayOfSim = DayOfSim;
+		Row.Month = Month;
+		Row.DayOfMonth = DayOfMonth;
+		Row.Hour = Hour;
+		Row.DST = DST;
+		Row.Warmup = DataGlobals::WarmupFlag;
+		Row.StartMinute = StartMinute;
+		Row.EndMinute = EndMinute;
+		Row.DayType = DayType;
+
+		auto & Table( TimeTables( ColumnarTimeTableNum( ReportingInterval ) ) );
+		if ( Table.NumRows > 0 ) {
+			auto const & Last( Table.LastRow );
+			if ( Last.EnvNum == Row.EnvNum && Last.DayOfSim == Row.DayOfSim && Last.Month == Row.Month && Last.DayOfMonth == Row.DayOfMonth && Last.Hour == Row.Hour && Last.Warmup == Row.Warmup && Last.StartMinute == Row.StartMinute && Last.EndMinute == Row.EndMinute ) return;
+		}
+		Table.LastRow = Row;
+		Table.Rows.push_back( Row );
+		++Table.NumRows;
+		if ( int( Table.Rows.size() ) >= ChunkSize ) FlushColumnarTimeTable( ColumnarTimeTableNum( ReportingInterval ) );
+
+	}
+
+	void
+	WriteColumnarValue(
+		int const ReportID,
+		Real64 const Value
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a value of a detailed, time step or hourly column at the current time stamp.
+
+		if ( ! WriteColumnarOutput ) return;
+		auto const Found( SeriesIndex.find( ReportID ) );
+		if ( Found == SeriesIndex.end() ) return;
+
+		auto & Column( Series[ Found->second ] );
+		Column.Rows.push_back( TimeTables( Column.Table ).NumRows - 1 );
+		Column.Values.push_back( Value );
+		if ( int( Column.Rows.size() ) >= ChunkSize ) FlushColumnarSeries( Column );
+
+	}
+
+	void
+	WriteColumnarValue(
+		int const ReportID,
+		Real64 const Value,
+		Real64 const MinValue,
+		int const MinValueDate,
+		Real64 const MaxValue,
+		int const MaxValueDate
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a value of a column at the current time stamp, with its minimum and maximum over
+		// the interval for daily and longer intervals.
+
+		if ( ! WriteColumnarOutput ) return;
+		auto const Found( SeriesIndex.find( ReportID ) );
+		if ( Found == SeriesIndex.end() ) return;
+
+		auto & Column( Series[ Found->second ] );
+		if ( Column.Table == 1 ) {
+			WriteColumnarValue( ReportID, Value );
+			return;
+		}
+		Column.Rows.push_back( TimeTables( Column.Table ).NumRows - 1 );
+		Column.Values.push_back( Value );
+		Column.MinValues.push_back( MinValue );
+		Column.MinValueDates.push_back( MinValueDate );
+		Column.MaxValues.push_back( MaxValue );
+		Column.MaxValueDates.push_back( MaxValueDate );
+		if ( int( Column.Rows.size() ) >= ChunkSize ) FlushColumnarSeries( Column );
+
+	}
+
+	void
+	WriteColumnarRecord(
+		int const RecordType,
+		std::string const & Payload
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes one record to the columnar output file.
+
+		char const Type( static_cast< char >( RecordType ) );
+		std::uint32_t const Length( static_cast< std::uint32_t >( Payload.size() ) );
+		ColumnarFile.write( &Type, 1 );
+		ColumnarFile.write( reinterpret_cast< char const * >( &Length ), sizeof( Length ) );
+		ColumnarFile.write( Payload.data(), Payload.size() );
+
+	}
+
+	// Chunk encoding of the flush routines
+
+	static
+	void
+	PutInt32( std::string & Buffer, int const Value )
+	{
+		std::int32_t const Value32( Value );
+		Buffer.append( reinterpret_cast< char const * >( &Value32 ), sizeof( Value32 ) );
+	}
+
+	static
+	void
+	PutRealPlanes( std::string & Buffer, std::vector< Real64 > const & Values )
+	{
+		// Byte b of every value, for b = 0..7
+		std::string::size_type const Start( Buffer.size() );
+		std::string::size_type const NumValues( Values.size() );
+		Buffer.resize( Start + NumValues * sizeof( Real64 ) );
+		for ( std::string::size_type Loop = 0; Loop < NumValues; ++Loop ) {
+			unsigned char Bytes[ sizeof( Real64 ) ];
+			std::memcpy( Bytes, &Values[ Loop ], sizeof( Real64 ) );
+			for ( std::string::size_type Byte = 0; Byte < sizeof( Real64 ); ++Byte ) {
+				Buffer[ Start + Byte * NumValues + Loop ] = static_cast< char >( Bytes[ Byte ] );
+			}
+		}
+	}
+
+	static
+	void
+	PutCompressed( std::string & Payload, std::string const & Raw )
+	{
+		uLongf CompressedSize( compressBound( static_cast< uLong >( Raw.size() ) ) );
+		std::string Compressed( CompressedSize, '\0' );
+		if ( compress2( reinterpret_cast< Bytef * >( &Compressed[ 0 ] ), &CompressedSize, reinterpret_cast< Bytef const * >( Raw.data() ), static_cast< uLong >( Raw.size() ), Z_BEST_SPEED ) != Z_OK ) {
+			CompressedSize = 0;
+		}
+		PutInt32( Payload, int( Raw.size() ) );
+		Payload.append( Compressed, 0, CompressedSize );
+	}
+
+	void
+	FlushColumnarTimeTable( int const Table )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the held rows of a time table as one chunk.
+
+		auto & TimeTable( TimeTables( Table ) );
+		if ( TimeTable.Rows.empty() ) return;
+
+		std::string Raw;
+		std::vector< Real64 > StartMinutes;
+		std::vector< Real64 > EndMinutes;
+		for ( auto const & Row : TimeTable.Rows ) PutInt32( Raw, Row.EnvNum );
+		for ( auto const & Row : TimeTable.Rows ) PutInt32( Raw, Row.DayOfSim );
+		for ( auto const & Row : TimeTable.Rows ) Raw.push_back( static_cast< char >( Row.Month ) );
+		for ( auto const & Row : TimeTable.Rows ) Raw.push_back( static_cast< char >( Row.DayOfMonth ) );
+		for ( auto const & Row : TimeTable.Rows ) Raw.push_back( static_cast< char >( Row.Hour ) );
+		for ( auto const & Row : TimeTable.Rows ) Raw.push_back( static_cast< char >( Row.DST ) );
+		for ( auto const & Row : TimeTable.Rows ) Raw.push_back( Row.Warmup ? 1 : 0 );
+		for ( auto const & Row : TimeTable.Rows ) {
+			StartMinutes.push_back( Row.StartMinute );
+			EndMinutes.push_back( Row.EndMinute );
+		}
+		PutRealPlanes( Raw, StartMinutes );
+		PutRealPlanes( Raw, EndMinutes );
+		for ( auto const & Row : TimeTable.Rows ) {
+			std::string::size_type const Len( std::min( Row.DayType.size(), std::string::size_type( 255 ) ) );
+			Raw.push_back( static_cast< char >( static_cast< unsigned char >( Len ) ) );
+			Raw.append( Row.DayType, 0, Len );
+		}
+
+		std::string Payload;
+		PutInt32( Payload, Table );
+		PutInt32( Payload, int( TimeTable.Rows.size() ) );
+		PutCompressed( Payload, Raw );
+		WriteColumnarRecord( TimeChunkRecord, Payload );
+		TimeTable.Rows.clear();
+
+	}
+
+	void
+	FlushColumnarSeries( ColumnarSeries & Column )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the held values of a column as one chunk.
+
+		if ( Column.Rows.empty() ) return;
+
+		bool const MinMax( ! Column.MinValues.empty() );
+		std::string Raw;
+		for ( auto const Row : Column.Rows ) {
+			PutInt32( Raw, Row - Column.LastRow );
+			Column.LastRow = Row;
+		}
+		PutRealPlanes( Raw, Column.Values );
+		if ( MinMax ) {
+			PutRealPlanes( Raw, Column.MinValues );
+			for ( auto const Date : Column.MinValueDates ) PutInt32( Raw, Date );
+			PutRealPlanes( Raw, Column.MaxValues );
+			for ( auto const Date : Column.MaxValueDates ) PutInt32( Raw, Date );
+		}
+
+		std::string Payload;
+		PutInt32( Payload, Column.ReportID );
+		PutInt32( Payload, int( Column.Rows.size() ) );
+		Payload.push_back( MinMax ? 1 : 0 );
+		PutCompressed( Payload, Raw );
+		WriteColumnarRecord( ValueChunkRecord, Payload );
+
+		Column.Rows.clear();
+		Column.Values.clear();
+		Column.MinValues.clear();
+		Column.MinValueDates.clear();
+		Column.MaxValues.clear();
+		Column.MaxValueDates.clear();
+
+	}
+
+	void
+	CloseColumnarOutput()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the held chunks and closes the columnar output file.
+
+		if ( ! WriteColumnarOutput ) return;
+		for ( int Table = 1; Table <= NumTimeTables; ++Table ) FlushColumnarTimeTable( Table );
+		for ( auto & Column : Series ) FlushColumnarSeries( Column );
+		ColumnarFile.close();
+		TimeTables.deallocate();
+		Series.clear();
+		SeriesIndex.clear();
+		WriteColumnarOutput = false;
+		ColumnarOutputOnly = false;
+
+	}
+
+	bool
+	ReadColumnarOutput(
+		std::string const & FileName,
+		Array1D< ColumnarTimeTable > & Tables, // Time stamps of each time table
+		std::vector< ColumnarSeries > & Columns // Dictionary and values of each variable and meter
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads a whole columnar output file back, for post-processing; returns false if it is
+		// missing or damaged.
+
+		// METHODOLOGY EMPLOYED:
+		// The reverse of the writing routines (layout at the top of the module); row numbers are
+		// rebuilt from their steps, so Rows of each column indexes Tables( Table ).Rows from 0.
+
+		Tables.deallocate();
+		Tables.allocate( NumTimeTables );
+		Columns.clear();
+
+		std::ifstream File( FileName, std::ios::in | std::ios::binary );
+		if ( ! File ) return false;
+		std::string const Image( ( std::istreambuf_iterator< char >( File ) ), std::istreambuf_iterator< char >() );
+		File.close();
+		if ( Image.compare( 0, ColumnarMagic.size(), ColumnarMagic ) != 0 ) return false;
+
+		std::unordered_map< int, int > ColumnIndex;
+		bool Good( true );
+		std::string const * Source( &Image );
+		std::string::size_type Pos( ColumnarMagic.size() );
+		auto get_bytes = [&]( void * Dest, std::string::size_type const Size ) {
+			if ( ! Good || Source->size() - Pos < Size ) {
+				Good = false;
+				std::memset( Dest, 0, Size );
+				return;
+			}
+			std::memcpy( Dest, Source->data() + Pos, Size );
+			Pos += Size;
+		};
+		auto get_int = [&]() -> int {
+			std::int32_t Value( 0 );
+			get_bytes( &Value, sizeof( Value ) );
+			return Value;
+		};
+		auto get_byte = [&]() -> int {
+			unsigned char Value( 0 );
+			get_bytes( &Value, 1 );
+			return Value;
+		};
+		auto get_string = [&]( std::string::size_type const Len ) -> std::string {
+			if ( ! Good || Source->size() - Pos < Len ) {
+				Good = false;
+				return std::string();
+			}
+			std::string Value( *Source, Pos, Len );
+			Pos += Len;
+			return Value;
+		};
+		auto get_real_planes = [&]( int const NumValues ) -> std::vector< Real64 > {
+			std::vector< Real64 > Values( NumValues, 0.0 );
+			std::string const Planes( get_string( std::string::size_type( NumValues ) * sizeof( Real64 ) ) );
+			if ( ! Good ) return Values;
+			for ( int Loop = 0; Loop < NumValues; ++Loop ) {
+				unsigned char Bytes[ sizeof( Real64 ) ];
+				for ( std::string::size_type Byte = 0; Byte < sizeof( Real64 ); ++Byte ) {
+					Bytes[ Byte ] = static_cast< unsigned char >( Planes[ Byte * NumValues + Loop ] );
+				}
+				std::memcpy( &Values[ Loop ], Bytes, sizeof( Real64 ) );
+			}
+			return Values;
+		};
+		auto get_raw = [&]( std::string::size_type const End, std::string & Raw ) { // Uncompresses the rest of the record
+			uLongf RawSize( static_cast< uLongf >( get_int() ) );
+			if ( ! Good || Pos > End ) {
+				Good = false;
+				return;
+			}
+			Raw.assign( RawSize, '\0' );
+			if ( uncompress( reinterpret_cast< Bytef * >( &Raw[ 0 ] ), &RawSize, reinterpret_cast< Bytef const * >( Image.data() + Pos ), static_cast< uLong >( End - Pos ) ) != Z_OK || RawSize != Raw.size() ) Good = false;
+			Pos = End;
+		};
+
+		while ( Good && Pos < Image.size() ) {
+			int const RecordType( get_byte() );
+			std::uint32_t Length( 0u );
+			get_bytes( &Length, sizeof( Length ) );
+			if ( ! Good || Image.size() - Pos < Length ) return false;
+			std::string::size_type const End( Pos + Length );
+
+			if ( RecordType == DictionaryRecord ) {
+				ColumnarSeries Column;
+				Column.ReportID = get_int();
+				Column.ReportingInterval = get_int();
+				Column.StoreType = get_int();
+				Column.IndexType = get_int();
+				Column.Meter = ( get_byte() != 0 );
+				Column.KeyedValue = get_string( get_int() );
+				Column.VariableName = get_string( get_int() );
+				Column.Units = get_string( get_int() );
+				Column.Table = ColumnarTimeTableNum( Column.ReportingInterval );
+				ColumnIndex[ Column.ReportID ] = int( Columns.size() );
+				Columns.push_back( Column );
+
+			} else if ( RecordType == TimeChunkRecord ) {
+				int const Table( get_int() );
+				int const NumRows( get_int() );
+				if ( Table < 1 || Table > NumTimeTables || NumRows < 0 ) return false;
+				std::string Raw;
+				get_raw( End, Raw );
+				if ( ! Good ) return false;
+				std::string::size_type const RecordEnd( Pos );
+				Source = &Raw;
+				Pos = 0;
+				std::vector< ColumnarTimeRow > Rows( NumRows );
+				for ( auto & Row : Rows ) Row.EnvNum = get_int();
+				for ( auto & Row : Rows ) Row.DayOfSim = get_int();
+				for ( auto & Row : Rows ) Row.Month = get_byte();
+				for ( auto & Row : Rows ) Row.DayOfMonth = get_byte();
+				for ( auto & Row : Rows ) Row.Hour = get_byte();
+				for ( auto & Row : Rows ) Row.DST = get_byte();
+				for ( auto & Row : Rows ) Row.Warmup = ( get_byte() != 0 );
+				std::vector< Real64 > const StartMinutes( get_real_planes( NumRows ) );
+				std::vector< Real64 > const EndMinutes( get_real_planes( NumRows ) );
+				for ( int Loop = 0; Loop < NumRows; ++Loop ) {
+					Rows[ Loop ].StartMinute = StartMinutes[ Loop ];
+					Rows[ Loop ].EndMinute = EndMinutes[ Loop ];
+					Rows[ Loop ].DayType = get_string( get_byte() );
+				}
+				Source = &Image;
+				Pos = RecordEnd;
+				auto & TimeTable( Tables( Table ) );
+				TimeTable.Rows.insert( TimeTable.Rows.end(), Rows.begin(), Rows.end() );
+				TimeTable.NumRows = int( TimeTable.Rows.size() );
+				if ( ! Rows.empty() ) TimeTable.LastRow = Rows.back();
+
+			} else if ( RecordType == ValueChunkRecord ) {
+				int const ReportID( get_int() );
+				int const NumValues( get_int() );
+				bool const MinMax( get_byte() != 0 );
+				auto const Found( ColumnIndex.find( ReportID ) );
+				if ( Found == ColumnIndex.end() || NumValues < 0 ) return false;
+				std::string Raw;
+				get_raw( End, Raw );
+				if ( ! Good ) return false;
+				std::string::size_type const RecordEnd( Pos );
+				Source = &Raw;
+				Pos = 0;
+				auto & Column( Columns[ Found->second ] );
+				for ( int Loop = 0; Loop < NumValues; ++Loop ) {
+					Column.LastRow += get_int();
+					Column.Rows.push_back( Column.LastRow );
+				}
+				std::vector< Real64 > Values( get_real_planes( NumValues ) );
+				Column.Values.insert( Column.Values.end(), Values.begin(), Values.end() );
+				if ( MinMax ) {
+					Values = get_real_planes( NumValues );
+					Column.MinValues.insert( Column.MinValues.end(), Values.begin(), Values.end() );
+					for ( int Loop = 0; Loop < NumValues; ++Loop ) Column.MinValueDates.push_back( get_int() );
+					Values = get_real_planes( NumValues );
+					Column.MaxValues.insert( Column.MaxValues.end(), Values.begin(), Values.end() );
+					for ( int Loop = 0; Loop < NumValues; ++Loop ) Column.MaxValueDates.push_back( get_int() );
+				}
+				Source = &Image;
+				Pos = RecordEnd;
+
+			} else {
+				Pos = End; // Record types added later are skipped
+			}
+			if ( Pos != End ) Good = false;
+		}
+
+		return Good;
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // ColumnarOutput
+
+} // EnergyPlus
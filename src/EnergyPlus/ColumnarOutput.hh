@@ -0,0 +1,224 @@
+#ifndef ColumnarOutput_hh_INCLUDED
+#define ColumnarOutput_hh_INCLUDED
+
+// C++ Headers
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace ColumnarOutput {
+
+	// Using/Aliasing
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern std::string const ColumnarMagic; // Signature at the start of the columnar output file
+	extern int const ChunkSize; // Values held for a column before its chunk is written
+	extern int const NumTimeTables; // Time step (and hourly), daily, monthly and run period stamps
+
+	extern int const DictionaryRecord; // Record types of the columnar output file
+	extern int const TimeChunkRecord;
+	extern int const ValueChunkRecord;
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool WriteColumnarOutput; // True when Output:Columnar is given
+	extern bool ColumnarOutputOnly; // True when the values are not formatted into the eso and mtr files
+
+	// Types
+
+	struct ColumnarTimeRow
+	{
+		// Members
+		int EnvNum; // Environment of the stamp
+		int DayOfSim;
+		int Month;
+		int DayOfMonth;
+		int Hour;
+		int DST;
+		bool Warmup;
+		Real64 StartMinute;
+		Real64 EndMinute;
+		std::string DayType;
+
+		// Default Constructor
+		ColumnarTimeRow() :
+			EnvNum( 0 ),
+			DayOfSim( 0 ),
+			Month( 0 ),
+			DayOfMonth( 0 ),
+			Hour( 0 ),
+			DST( 0 ),
+			Warmup( false ),
+			StartMinute( 0.0 ),
+			EndMinute( 0.0 )
+		{}
+
+	};
+
+	struct ColumnarTimeTable
+	{
+		// Members
+		int NumRows; // Rows written so far, held or not
+		std::vector< ColumnarTimeRow > Rows; // Rows not yet written (all rows when read back)
+		ColumnarTimeRow LastRow; // Stamps repeated for the eso and mtr files give one row
+
+		// Default Constructor
+		ColumnarTimeTable() :
+			NumRows( 0 )
+		{}
+
+	};
+
+	struct ColumnarSeries
+	{
+		// Members
+		int ReportID;
+		int ReportingInterval;
+		int StoreType;
+		int IndexType;
+		bool Meter;
+		std::string KeyedValue;
+		std::string VariableName;
+		std::string Units;
+		int Table; // Time table of the reporting interval
+		int LastRow; // Time table row of the last value, -1 before the first
+		std::vector< int > Rows; // Values not yet written (all values when read back)
+		std::vector< Real64 > Values;
+		std::vector< Real64 > MinValues; // Daily and longer intervals only
+		std::vector< int > MinValueDates;
+		std::vector< Real64 > MaxValues;
+		std::vector< int > MaxValueDates;
+
+		// Default Constructor
+		ColumnarSeries() :
+			ReportID( 0 ),
+			ReportingInterval( 0 ),
+			StoreType( 0 ),
+			IndexType( 0 ),
+			Meter( false ),
+			Table( 1 ),
+			LastRow( -1 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::ofstream ColumnarFile;
+	extern Array1D< ColumnarTimeTable > TimeTables;
+	extern std::vector< ColumnarSeries > Series;
+	extern std::unordered_map< int, int > SeriesIndex; // Report ID to position in Series
+
+	// Functions
+
+	void
+	InitColumnarOutput();
+
+	void
+	OpenColumnarOutput(
+		std::string const & FileName,
+		bool const ValuesOnly // The values are not formatted into the eso and mtr files
+	);
+
+	int
+	ColumnarTimeTableNum( int const ReportingInterval );
+
+	void
+	WriteColumnarDictionaryItem(
+		int const ReportID,
+		int const ReportingInterval,
+		int const StoreType,
+		int const IndexType,
+		bool const Meter,
+		std::string const & KeyedValue,
+		std::string const & VariableName,
+		std::string const & Units
+	);
+
+	void
+	WriteColumnarTimeIndex(
+		int const ReportingInterval,
+		int const DayOfSim,
+		int const Month,
+		int const DayOfMonth,
+		int const Hour,
+		int const DST,
+		Real64 const StartMinute,
+		Real64 const EndMinute,
+		std::string const & DayType
+	);
+
+	void
+	WriteColumnarValue(
+		int const ReportID,
+		Real64 const Value
+	);
+
+	void
+	WriteColumnarValue(
+		int const ReportID,
+		Real64 const Value,
+		Real64 const MinValue,
+		int const MinValueDate,
+		Real64 const MaxValue,
+		int const MaxValueDate
+	);
+
+	void
+	WriteColumnarRecord(
+		int const RecordType,
+		std::string const & Payload
+	);
+
+	void
+	FlushColumnarTimeTable( int const Table );
+
+	void
+	FlushColumnarSeries( ColumnarSeries & Column );
+
+	void
+	CloseColumnarOutput();
+
+	bool
+	ReadColumnarOutput(
+		std::string const & FileName,
+		Array1D< ColumnarTimeTable > & Tables, // Time stamps of each time table
+		std::vector< ColumnarSeries > & Columns // Dictionary and values of each variable and meter
+	);
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // ColumnarOutput
+
+} // EnergyPlus
+
+#endif
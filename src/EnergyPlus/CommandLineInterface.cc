@@ -103,6 +103,8 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("", 0, 0, 0, "Run EPMacro prior to simulation", "-m", "--epmacro");
 
+	opt.add("", 0, 0, 0, "Report the memory of the main arrays by module, after initialization and at peak", "--memory-report");
+
 	opt.add("", 0, 1, 0, "Prefix for output file names (default: eplus)", "-p", "--output-prefix");
 
 	opt.add("", 0, 0, 0, "Run ReadVarsESO after simulation", "-r", "--readvars");
@@ -115,6 +117,8 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("", 0, 0, 0, "Run ExpandObjects prior to simulation", "-x", "--expandobjects");
 
+	opt.add("", 0, 0, 0, "Serve runs from one process: read the options and input file of each run as a line of\n   standard input, and write its exit status as a line of standard output (not on Windows)", "--serve");
+
 	opt.example = "energyplus -w weather.epw -r input.idf";
 
 	std::string errorFollowUp = "Type 'energyplus --help' for usage.";
@@ -150,6 +154,8 @@ ProcessArgs(int argc, const char * argv[])
 
 	AnnualSimulation = opt.isSet("-a");
 
+	MemoryUsageReport = opt.isSet("--memory-report");
+
 	// Process standard arguments
 	if (opt.isSet("-h")) {
 		DisplayString(usage);
@@ -251,6 +257,7 @@ ProcessArgs(int argc, const char * argv[])
 	std::string sqliteSuffix;
 	std::string adsSuffix;
 	std::string screenSuffix;
+	std::string emsSuffix;
 
 	if (suffixType == "L" || suffixType == "l")	{
 
@@ -263,6 +270,7 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "sqlite";
 		adsSuffix = "ADS";
 		screenSuffix = "screen";
+		emsSuffix = "ems";
 
 	} else if (suffixType == "D" || suffixType == "d") {
 
@@ -275,6 +283,7 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "-sqlite";
 		adsSuffix = "-ads";
 		screenSuffix = "-screen";
+		emsSuffix = "-ems";
 
 	} else if (suffixType == "C" || suffixType == "c") {
 
@@ -287,6 +296,7 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "Sqlite";
 		adsSuffix = "Ads";
 		screenSuffix = "Screen";
+		emsSuffix = "Ems";
 
 	} else {
 		DisplayString("ERROR: Unrecognized argument for output suffix style: " + suffixType);
@@ -300,6 +310,7 @@ ProcessArgs(int argc, const char * argv[])
 	outputDxfFileName = outputFilePrefix + normalSuffix + ".dxf";
 	outputEioFileName = outputFilePrefix + normalSuffix + ".eio";
 	outputEndFileName = outputFilePrefix + normalSuffix + ".end";
+	outputProfFileName = outputFilePrefix + normalSuffix + ".prof";
 	outputErrFileName = outputFilePrefix + normalSuffix + ".err";
 	outputEsoFileName = outputFilePrefix + normalSuffix + ".eso";
 	outputMtdFileName = outputFilePrefix + normalSuffix + ".mtd";
@@ -314,6 +325,7 @@ ProcessArgs(int argc, const char * argv[])
 	outputSciFileName = outputFilePrefix + normalSuffix + ".sci";
 	outputWrlFileName = outputFilePrefix + normalSuffix + ".wrl";
 	outputSqlFileName = outputFilePrefix + normalSuffix + ".sql";
+	outputColFileName = outputFilePrefix + normalSuffix + ".col";
 	outputDbgFileName = outputFilePrefix + normalSuffix + ".dbg";
 	outputTblCsvFileName = outputFilePrefix + tableSuffix + ".csv";
 	outputTblHtmFileName = outputFilePrefix + tableSuffix + ".htm";
@@ -332,6 +344,7 @@ ProcessArgs(int argc, const char * argv[])
 	outputAdsFileName = outputFilePrefix + adsSuffix + ".out";
 	outputSqliteErrFileName = dirPathName + sqliteSuffix + ".err";
 	outputScreenCsvFileName = outputFilePrefix + screenSuffix + ".csv";
+	outputEmsCsvFileName = outputFilePrefix + emsSuffix + ".csv";
 	outputDelightInFileName = "eplusout.delightin";
 	outputDelightOutFileName = "eplusout.delightout";
 	outputDelightEldmpFileName = "eplusout.delighteldmp";
@@ -432,8 +445,11 @@ ProcessArgs(int argc, const char * argv[])
 		exit(EXIT_FAILURE);
 	}
 
+	// The runs served give their own input files
+	if (opt.isSet("--serve")) return ServeRuns;
+
 	{ IOFlags flags; gio::inquire( inputIdfFileName, flags ); FileExists = flags.exists(); }
-	if ( ! FileExists ) {
+	if ( ! FileExists && inputIdfBuffer.empty() ) {
 		DisplayString("ERROR: Could not find input data file: " + getAbsolutePath(inputIdfFileName) + "." );
 		DisplayString(errorFollowUp);
 		exit(EXIT_FAILURE);
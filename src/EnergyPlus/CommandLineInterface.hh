@@ -8,6 +8,8 @@ namespace EnergyPlus{
 
 namespace CommandLineInterface {
 
+ int const ServeRuns( 1 ); // ProcessArgs result when --serve is given, else 0
+
  // Process command line arguments
  int
  ENERGYPLUSLIB_API ProcessArgs( int argc, const char * argv[] );
@@ -126,6 +126,8 @@ namespace CondenserLoopTowers {
 	int const CellCtrl_MinCell( 1 );
 	int const CellCtrl_MaxCell( 2 );
 
+	int const MaxVSTowerOperatingPoints( 4 );
+
 	static std::string const BlankString;
 
 	// DERIVED TYPE DEFINITIONS
@@ -4963,6 +4965,10 @@ namespace CondenserLoopTowers {
 		// York International Corporation, "YORKcalcTM Software, Chiller-Plant Energy-Estimating Program",
 		// Form 160.00-SG2 (0502).  2002.
 
+		// The balance depends only on the arguments and the inlet water temperature, and the tower is
+		// usually simulated at the same few air flow rate ratios on every plant iteration, so the last
+		// converged balances are kept and reused when all of these match exactly.
+
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
 		using DataPlant::SingleSetPoint;
@@ -4986,6 +4992,19 @@ namespace CondenserLoopTowers {
 		Array1D< Real64 > Par( 4 ); // Parameter array for regula falsi solver
 		Real64 Tr; // range temperature which results in an energy balance
 		Real64 TempSetPoint( 0.0 ); // local temporary for loop setpoint
+		int Point; // index into the operating points of the tower
+
+		auto & ThisVSTower( VSTower( SimpleTower( TowerNum ).VSTower ) );
+		Real64 const InletWaterTemp( Node( SimpleTower( TowerNum ).WaterInletNodeNum ).Temp );
+		for ( Point = 1; Point <= ThisVSTower.NumOperatingPoints; ++Point ) {
+			auto const & OperatingPoint( ThisVSTower.OperatingPoints( Point ) );
+			if ( OperatingPoint.AirFlowRateRatio != AirFlowRateRatio ) continue;
+			if ( OperatingPoint.WaterFlowRateRatio != WaterFlowRateRatio ) continue;
+			if ( OperatingPoint.Twb != Twb ) continue;
+			if ( OperatingPoint.InletWaterTemp != InletWaterTemp ) continue;
+			OutletWaterTemp = SimpleTowerInlet( TowerNum ).WaterTemp - OperatingPoint.Tr;
+			return;
+		}
 
 		//   determine tower outlet water temperature
 		Par( 1 ) = TowerNum; // Index to cooling tower
@@ -4996,6 +5015,19 @@ namespace CondenserLoopTowers {
 
 		OutletWaterTemp = SimpleTowerInlet( TowerNum ).WaterTemp - Tr;
 
+		// Only converged balances are kept, the others report or depend on the loop setpoint
+		if ( SolFla > 0 ) {
+			if ( ! allocated( ThisVSTower.OperatingPoints ) ) ThisVSTower.OperatingPoints.allocate( MaxVSTowerOperatingPoints );
+			ThisVSTower.LastOperatingPoint = ThisVSTower.LastOperatingPoint % MaxVSTowerOperatingPoints + 1;
+			ThisVSTower.NumOperatingPoints = max( ThisVSTower.NumOperatingPoints, ThisVSTower.LastOperatingPoint );
+			auto & OperatingPoint( ThisVSTower.OperatingPoints( ThisVSTower.LastOperatingPoint ) );
+			OperatingPoint.WaterFlowRateRatio = WaterFlowRateRatio;
+			OperatingPoint.AirFlowRateRatio = AirFlowRateRatio;
+			OperatingPoint.Twb = Twb;
+			OperatingPoint.InletWaterTemp = InletWaterTemp;
+			OperatingPoint.Tr = Tr;
+		}
+
 		if ( SolFla == -1 ) {
 			ShowSevereError( "Iteration limit exceeded in calculating tower nominal capacity at minimum air flow ratio" );
 			ShowContinueError( "Design inlet air wet-bulb or approach temperature must be modified to achieve an acceptable range at the minimum air flow rate" );
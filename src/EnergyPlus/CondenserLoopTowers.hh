@@ -50,6 +50,8 @@ namespace CondenserLoopTowers {
 	extern int const CellCtrl_MinCell;
 	extern int const CellCtrl_MaxCell;
 
+	extern int const MaxVSTowerOperatingPoints; // Converged balances kept for each variable speed tower
+
 	// DERIVED TYPE DEFINITIONS
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -403,6 +405,26 @@ namespace CondenserLoopTowers {
 
 	};
 
+	struct VSTowerOperatingPointData
+	{
+		// Members
+		Real64 WaterFlowRateRatio; // water flow rate ratio (capped if applicable)
+		Real64 AirFlowRateRatio; // air flow rate ratio
+		Real64 Twb; // inlet air wet-bulb temperature (C, capped if applicable)
+		Real64 InletWaterTemp; // tower inlet water temperature (C)
+		Real64 Tr; // range temperature which results in an energy balance (C)
+
+		// Default Constructor
+		VSTowerOperatingPointData() :
+			WaterFlowRateRatio( 0.0 ),
+			AirFlowRateRatio( 0.0 ),
+			Twb( 0.0 ),
+			InletWaterTemp( 0.0 ),
+			Tr( 0.0 )
+		{}
+
+	};
+
 	struct VSTowerData
 	{
 		// Members
@@ -459,6 +481,9 @@ namespace CondenserLoopTowers {
 		Real64 TaLast; // value of Ta when warning occurred (passed to Recurring Warning)
 		Real64 WaterFlowRateRatioLast; // value of WFRR when warning occurred (passed to Recurring Warn)
 		Real64 LGLast; // value of LG when warning occurred (passed to Recurring Warn)
+		Array1D< VSTowerOperatingPointData > OperatingPoints; // converged range temperature balances of SimVariableTower
+		int NumOperatingPoints; // number of OperatingPoints filled in
+		int LastOperatingPoint; // OperatingPoints entry written last
 
 		// Default Constructor
 		VSTowerData() :
@@ -492,7 +517,9 @@ namespace CondenserLoopTowers {
 			TwbLast( 0.0 ),
 			TaLast( 0.0 ),
 			WaterFlowRateRatioLast( 0.0 ),
-			LGLast( 0.0 )
+			LGLast( 0.0 ),
+			NumOperatingPoints( 0 ),
+			LastOperatingPoint( 0 )
 		{}
 
 		// Member Constructor
@@ -591,7 +618,9 @@ namespace CondenserLoopTowers {
 			TwbLast( TwbLast ),
 			TaLast( TaLast ),
 			WaterFlowRateRatioLast( WaterFlowRateRatioLast ),
-			LGLast( LGLast )
+			LGLast( LGLast ),
+			NumOperatingPoints( 0 ),
+			LastOperatingPoint( 0 )
 		{}
 
 	};
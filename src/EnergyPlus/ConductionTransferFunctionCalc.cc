@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -14,6 +15,7 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
@@ -71,6 +73,7 @@ namespace ConductionTransferFunctionCalc {
 	// perpendicular to the main direction of heat transfer.  This is only used
 	// when a two-dimensional solution has been requested for a construction
 	// with a heat source/sink.
+	static std::string const CTFCacheMagic( "EPCTFC01" ); // File signature and format version of the cache file
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -100,6 +103,9 @@ namespace ConductionTransferFunctionCalc {
 	Real64 TinyLimit;
 	Array2D< Real64 > IdenMatrix; // Identity Matrix
 
+	// Object Data
+	CTFCacheData CTFCache;
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
 	// MODULE SUBROUTINES:
@@ -268,6 +274,7 @@ namespace ConductionTransferFunctionCalc {
 		// Subroutine initializations
 		TinyLimit = rTinyValue;
 		DoCTFErrorReport = false;
+		InitCTFCache( DataSystemVariables::CTFCacheFileName );
 
 		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) { // Begin construction loop ...
 
@@ -559,7 +566,33 @@ namespace ConductionTransferFunctionCalc {
 
 				} // ... end of construct loop (check reversed--Constr)
 
-				if ( ! RevConst ) { // Calculate CTFs (non-reversed constr)
+				// Constructions whose layers and time step are in the cache file skip the calculation
+				std::vector< Real64 > CTFKey; // Everything the state space results depend on
+				bool CTFsCached( false );
+				if ( ! RevConst && CTFCache.Active ) {
+					CTFKey.reserve( 11 + 5 * LayersInConstruct );
+					CTFKey.push_back( TimeStepZone );
+					CTFKey.push_back( MaxCTFTerms );
+					CTFKey.push_back( MinNodes );
+					CTFKey.push_back( NumOfPerpendNodes );
+					CTFKey.push_back( MaxAllowedCTFSumError );
+					CTFKey.push_back( Construct( ConstrNum ).SolutionDimensions );
+					CTFKey.push_back( dyn );
+					CTFKey.push_back( Construct( ConstrNum ).SourceSinkPresent ? 1.0 : 0.0 );
+					CTFKey.push_back( Construct( ConstrNum ).SourceAfterLayer );
+					CTFKey.push_back( Construct( ConstrNum ).TempAfterLayer );
+					CTFKey.push_back( LayersInConstruct );
+					for ( Layer = 1; Layer <= LayersInConstruct; ++Layer ) {
+						CTFKey.push_back( ResLayer( Layer ) ? 1.0 : 0.0 );
+						CTFKey.push_back( dl( Layer ) );
+						CTFKey.push_back( rk( Layer ) );
+						CTFKey.push_back( rho( Layer ) );
+						CTFKey.push_back( cp( Layer ) );
+					}
+					CTFsCached = RestoreCTFsFromCache( CTFKey, ConstrNum );
+				}
+
+				if ( ! RevConst && ! CTFsCached ) { // Calculate CTFs (non-reversed constr)
 
 					// Estimate number of nodes each layer of the construct will require
 					// and calculate the nodal spacing from that
@@ -1068,6 +1101,8 @@ namespace ConductionTransferFunctionCalc {
 
 					} // ... end of CTF calculation loop.
 
+					if ( CTFCache.Active && CTFConvrg && Construct( ConstrNum ).CTFTimeStep < MaxAllowedTimeStep ) SaveCTFsToCache( CTFKey, ConstrNum );
+
 				} // ... end of IF block for non-reversed constructs.
 
 			} else { // Construct has only resistive layers (no thermal mass).
@@ -1173,6 +1208,12 @@ namespace ConductionTransferFunctionCalc {
 
 		} // ... end of construction loop.
 
+		if ( CTFCache.Active ) {
+			ShowMessage( "InitConductionTransferFunctions: CTFs of " + RoundSigDigits( CTFCache.NumHits ) + " constructions were taken from cache file \"" + CTFCache.FileName + "\", " + RoundSigDigits( CTFCache.NumMisses ) + " were calculated." );
+			CTFCache.File.close();
+			CTFCache.Active = false;
+		}
+
 		ReportCTFs( DoCTFErrorReport );
 
 		if ( ErrorsFound ) {
@@ -2180,6 +2221,221 @@ namespace ConductionTransferFunctionCalc {
 
 	}
 
+	void
+	InitCTFCache( std::string const & FileName ) // Cache file name, empty for no cache
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the CTF cache file and indexes the records it already holds.
+
+		// METHODOLOGY EMPLOYED:
+		// The file starts with a signature; a file without it (or unreadable) is started over.
+		// Each record holds the hash and the full key of a construction followed by its state
+		// space results.  Records are only appended, so each run adds the constructions it
+		// calculated, whatever else the input file changed.
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		CTFCache.Active = false;
+		CTFCache.Index.clear();
+		CTFCache.NumHits = 0;
+		CTFCache.NumMisses = 0;
+		if ( CTFCache.File.is_open() ) CTFCache.File.close();
+		if ( FileName.empty() ) return;
+
+		CTFCache.FileName = FileName;
+
+		// Try the existing file first
+		bool Valid( false );
+		CTFCache.File.open( FileName, std::ios::in | std::ios::out | std::ios::binary );
+		if ( CTFCache.File.is_open() ) {
+			CTFCache.File.seekg( 0, std::ios::end );
+			std::streamoff const FileSize( CTFCache.File.tellg() );
+			CTFCache.File.seekg( 0 );
+			char Magic[ 8 ];
+			CTFCache.File.read( Magic, 8 );
+			Valid = CTFCache.File.good() && ( std::string( Magic, 8 ) == CTFCacheMagic );
+			while ( Valid ) { // Index the records
+				std::streamoff const Offset( CTFCache.File.tellg() );
+				std::uint64_t Hash( 0u );
+				int Head[ 3 ]; // Number of key entries, CTF terms and histories
+				CTFCache.File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+				if ( CTFCache.File.gcount() == 0 && CTFCache.File.eof() ) break; // End of file
+				CTFCache.File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+				if ( ! CTFCache.File.good() || Head[ 0 ] < 0 || Head[ 1 ] < 0 ) {
+					Valid = false; // Truncated record
+					break;
+				}
+				std::streamoff const Skip( ( 1 + Head[ 0 ] + 12 + 13 * Head[ 1 ] ) * sizeof( Real64 ) ); // Time step, key, s0, s and e
+				if ( CTFCache.File.tellg() + Skip > FileSize ) {
+					Valid = false; // Truncated record
+					break;
+				}
+				CTFCache.File.seekg( Skip, std::ios::cur );
+				CTFCache.Index[ Hash ] = Offset;
+			}
+			CTFCache.File.clear();
+			if ( ! Valid ) CTFCache.File.close();
+		}
+
+		if ( ! Valid ) { // Start a new file
+			CTFCache.Index.clear();
+			CTFCache.File.open( FileName, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc );
+			if ( ! CTFCache.File.is_open() ) {
+				ShowWarningError( "InitCTFCache: Could not open CTF cache file \"" + FileName + "\"; CTFs are calculated without the cache." );
+				return;
+			}
+			CTFCache.File.write( CTFCacheMagic.c_str(), 8 );
+			CTFCache.File.flush();
+		}
+
+		CTFCache.Active = CTFCache.File.good();
+		if ( CTFCache.Active ) {
+			ShowMessage( "InitCTFCache: Using CTF cache file \"" + FileName + "\" with " + TrimSigDigits( int( CTFCache.Index.size() ) ) + " cached constructions." );
+		}
+
+	}
+
+	std::uint64_t
+	CTFCacheHash( std::vector< Real64 > const & Key ) // Cache key
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the 64 bit FNV-1a hash of a cache key.
+
+		std::uint64_t Hash( 14695981039346656037ull ); // FNV offset basis
+		unsigned char const * Bytes( reinterpret_cast< unsigned char const * >( Key.data() ) );
+		for ( std::size_t i = 0, n = Key.size() * sizeof( Real64 ); i < n; ++i ) {
+			Hash ^= Bytes[ i ];
+			Hash *= 1099511628211ull; // FNV prime
+		}
+		return Hash;
+
+	}
+
+	bool
+	RestoreCTFsFromCache(
+		std::vector< Real64 > const & Key, // Cache key of the construction
+		int const ConstrNum // Construction number
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets the CTF time step, history counts and the state space results (s0, s and e) of
+		// the construction from the cache file, as the CTF calculation loop leaves them.
+		// Returns false if the key is not cached (or the record cannot be read).
+
+		// METHODOLOGY EMPLOYED:
+		// The stored key must match the whole key, not just its hash.
+
+		auto const Found( CTFCache.Index.find( CTFCacheHash( Key ) ) );
+		if ( Found == CTFCache.Index.end() ) return false;
+
+		auto & File( CTFCache.File );
+		File.clear();
+		File.seekg( Found->second );
+		std::uint64_t Hash( 0u );
+		int Head[ 3 ];
+		Real64 CTFTimeStep( 0.0 );
+		File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+		File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+		File.read( reinterpret_cast< char * >( &CTFTimeStep ), sizeof( CTFTimeStep ) );
+		if ( ! File.good() || Head[ 0 ] != int( Key.size() ) ) {
+			File.clear();
+			return false;
+		}
+		int const NumTerms( Head[ 1 ] );
+		std::vector< Real64 > StoredKey( Key.size() );
+		std::vector< Real64 > Reals( 12 + 13 * NumTerms ); // s0, then s and e for each term
+		File.read( reinterpret_cast< char * >( StoredKey.data() ), StoredKey.size() * sizeof( Real64 ) );
+		if ( ! File.good() || StoredKey != Key ) {
+			File.clear();
+			return false;
+		}
+		File.read( reinterpret_cast< char * >( Reals.data() ), Reals.size() * sizeof( Real64 ) );
+		if ( ! File.good() ) {
+			File.clear();
+			CTFCache.Index.erase( Found );
+			return false;
+		}
+
+		Construct( ConstrNum ).CTFTimeStep = CTFTimeStep;
+		Construct( ConstrNum ).NumCTFTerms = NumTerms;
+		Construct( ConstrNum ).NumHistories = Head[ 2 ];
+		Real64 const * Real( Reals.data() );
+		for ( int i = 1; i <= 3; ++i ) {
+			for ( int j = 1; j <= 4; ++j ) {
+				s0( i, j ) = *Real++;
+			}
+		}
+		s.allocate( 3, 4, max( NumTerms, 1 ) );
+		s = 0.0;
+		e.dimension( max( NumTerms, 1 ), 0.0 );
+		for ( int HistTerm = 1; HistTerm <= NumTerms; ++HistTerm ) {
+			for ( int i = 1; i <= 3; ++i ) {
+				for ( int j = 1; j <= 4; ++j ) {
+					s( i, j, HistTerm ) = *Real++;
+				}
+			}
+			e( HistTerm ) = *Real++;
+		}
+		++CTFCache.NumHits;
+		return true;
+
+	}
+
+	void
+	SaveCTFsToCache(
+		std::vector< Real64 > const & Key, // Cache key of the construction
+		int const ConstrNum // Construction number
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the CTF time step, history counts and state space results of the construction
+		// to the cache file.
+
+		int const NumTerms( Construct( ConstrNum ).NumCTFTerms );
+		std::uint64_t const Hash( CTFCacheHash( Key ) );
+		int const Head[ 3 ] = { int( Key.size() ), NumTerms, Construct( ConstrNum ).NumHistories };
+		Real64 const CTFTimeStep( Construct( ConstrNum ).CTFTimeStep );
+		std::vector< Real64 > Reals;
+		Reals.reserve( 12 + 13 * NumTerms );
+		for ( int i = 1; i <= 3; ++i ) {
+			for ( int j = 1; j <= 4; ++j ) {
+				Reals.push_back( s0( i, j ) );
+			}
+		}
+		for ( int HistTerm = 1; HistTerm <= NumTerms; ++HistTerm ) {
+			for ( int i = 1; i <= 3; ++i ) {
+				for ( int j = 1; j <= 4; ++j ) {
+					Reals.push_back( s( i, j, HistTerm ) );
+				}
+			}
+			Reals.push_back( e( HistTerm ) );
+		}
+
+		auto & File( CTFCache.File );
+		File.clear();
+		File.seekp( 0, std::ios::end );
+		std::streamoff const Offset( File.tellp() );
+		File.write( reinterpret_cast< char const * >( &Hash ), sizeof( Hash ) );
+		File.write( reinterpret_cast< char const * >( Head ), sizeof( Head ) );
+		File.write( reinterpret_cast< char const * >( &CTFTimeStep ), sizeof( CTFTimeStep ) );
+		File.write( reinterpret_cast< char const * >( Key.data() ), Key.size() * sizeof( Real64 ) );
+		File.write( reinterpret_cast< char const * >( Reals.data() ), Reals.size() * sizeof( Real64 ) );
+		File.flush();
+		if ( File.good() ) {
+			CTFCache.Index[ Hash ] = Offset;
+			++CTFCache.NumMisses;
+		} else {
+			ShowWarningError( "SaveCTFsToCache: Could not write CTF cache file \"" + CTFCache.FileName + "\"; remaining CTFs are calculated without the cache." );
+			CTFCache.Active = false;
+		}
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
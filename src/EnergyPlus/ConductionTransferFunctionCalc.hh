@@ -1,6 +1,13 @@
 #ifndef ConductionTransferFunctionCalc_hh_INCLUDED
 #define ConductionTransferFunctionCalc_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -52,6 +59,34 @@ namespace ConductionTransferFunctionCalc {
 	extern Real64 TinyLimit;
 	extern Array2D< Real64 > IdenMatrix; // Identity Matrix
 
+	// Types
+
+	struct CTFCacheData
+	{
+		// On-disk cache of the state space results of the constructions, keyed by the layer
+		// properties and time step they were calculated from, so later runs (parametric runs
+		// included) skip the matrix work for the constructions that did not change.
+
+		// Members
+		bool Active; // True when CTFs are read from and written to the cache file
+		std::string FileName; // Cache file name
+		std::fstream File; // Cache file, records are appended as they are computed
+		std::map< std::uint64_t, std::streamoff > Index; // Record offset of each cached key hash
+		int NumHits; // Number of constructions whose CTFs came from the cache
+		int NumMisses; // Number of constructions calculated and added to the cache
+
+		// Default Constructor
+		CTFCacheData() :
+			Active( false ),
+			NumHits( 0 ),
+			NumMisses( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern CTFCacheData CTFCache;
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
 	// Functions
@@ -80,6 +115,24 @@ namespace ConductionTransferFunctionCalc {
 	void
 	ReportCTFs( bool const DoReportBecauseError );
 
+	void
+	InitCTFCache( std::string const & FileName ); // Cache file name, empty for no cache
+
+	std::uint64_t
+	CTFCacheHash( std::vector< Real64 > const & Key ); // Cache key
+
+	bool
+	RestoreCTFsFromCache(
+		std::vector< Real64 > const & Key, // Cache key of the construction
+		int const ConstrNum // Construction number
+	);
+
+	void
+	SaveCTFsToCache(
+		std::vector< Real64 > const & Key, // Cache key of the construction
+		int const ConstrNum // Construction number
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
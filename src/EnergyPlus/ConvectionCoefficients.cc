@@ -181,6 +181,9 @@ namespace ConvectionCoefficients {
 	bool ConvectionGeometryMetaDataSetup( false ); // set to true once geometry meta data are setup
 	Real64 CubeRootOfOverallBuildingVolume( 0.0 ); // building meta data. cube root of the volume of all the zones
 	Real64 RoofLongAxisOutwardAzimuth( 0.0 ); // roof surfaces meta data. outward normal azimuth for longest roof edge
+	Array1D< Real64 > TARPIntDeltaTemp; // Surface less zone air temperature of the last TARP inside coefficient, by surface
+	Array1D< Real64 > TARPIntCosTilt; // Cosine of the tilt of the surface for the last TARP inside coefficient
+	Array1D< Real64 > TARPIntHConvIn; // Last TARP inside coefficient before the lower limit, -1 if none
 
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
@@ -3729,6 +3732,20 @@ namespace ConvectionCoefficients {
 
 		DeltaTemp = SurfaceTemperature - ZoneMeanAirTemperature;
 
+		// The coefficient depends only on DeltaTemp and the tilt, so it is kept by surface and
+		// reused while neither changes, as for surfaces of zones at rest and repeated iterations
+		if ( isize( TARPIntHConvIn ) < SurfNum ) {
+			int const NumSurfs( max( SurfNum, isize( Surface ) ) );
+			TARPIntDeltaTemp.dimension( NumSurfs, 0.0 );
+			TARPIntCosTilt.dimension( NumSurfs, 0.0 );
+			TARPIntHConvIn.dimension( NumSurfs, -1.0 );
+		}
+		if ( TARPIntHConvIn( SurfNum ) >= 0.0 && DeltaTemp == TARPIntDeltaTemp( SurfNum ) && Surface( SurfNum ).CosTilt == TARPIntCosTilt( SurfNum ) ) {
+			HConvIn( SurfNum ) = TARPIntHConvIn( SurfNum );
+			if ( HConvIn( SurfNum ) < LowHConvLimit ) HConvIn( SurfNum ) = LowHConvLimit;
+			return;
+		}
+
 		// Set HConvIn using the proper correlation based on DeltaTemp and Surface (Cosine Tilt)
 
 		if ( ( DeltaTemp == 0.0 ) || ( Surface( SurfNum ).CosTilt == 0.0 ) ) { // Vertical Surface
@@ -3745,6 +3762,10 @@ namespace ConvectionCoefficients {
 
 		} // ...end of IF-THEN block to set HConvIn
 
+		TARPIntDeltaTemp( SurfNum ) = DeltaTemp;
+		TARPIntCosTilt( SurfNum ) = Surface( SurfNum ).CosTilt;
+		TARPIntHConvIn( SurfNum ) = HConvIn( SurfNum );
+
 		// Establish some lower limit to avoid a zero convection coefficient (and potential divide by zero problems)
 		if ( HConvIn( SurfNum ) < LowHConvLimit ) HConvIn( SurfNum ) = LowHConvLimit;
 
@@ -132,6 +132,9 @@ namespace ConvectionCoefficients {
 	extern bool ConvectionGeometryMetaDataSetup; // set to true once geometry meta data are setup
 	extern Real64 CubeRootOfOverallBuildingVolume; // building meta data. cube root of the volume of all the zones
 	extern Real64 RoofLongAxisOutwardAzimuth; // roof surfaces meta data. outward normal azimuth for longest roof edge
+	extern Array1D< Real64 > TARPIntDeltaTemp; // Surface less zone air temperature of the last TARP inside coefficient, by surface
+	extern Array1D< Real64 > TARPIntCosTilt; // Cosine of the tilt of the surface for the last TARP inside coefficient
+	extern Array1D< Real64 > TARPIntHConvIn; // Last TARP inside coefficient before the lower limit, -1 if none
 
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
@@ -0,0 +1,456 @@
+// C++ Headers
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <CsvOutput.hh>
+#include <ColumnarOutput.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <OutputProcessor.hh>
+#include <OutputWriterThread.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace CsvOutput {
+
+	// PURPOSE OF THIS MODULE:
+	// Writes eplusout.csv and eplusmtr.csv while the simulation runs, with the same content
+	// ReadVarsESO gives them afterwards from the eso and mtr files, so those files need not be
+	// read back in a second pass.
+
+	// METHODOLOGY EMPLOYED:
+	// The output processor passes each dictionary entry, time stamp and value it writes to the
+	// eso or mtr file.  One row is pending at a time: a value goes to the column of its report
+	// ID and the row is written when ReadVarsESO would write it, which is when a time step or
+	// hourly stamp for another hour or end minute comes, or a daily, monthly or run period stamp
+	// when no shorter stamp was seen, and at the end of the run.  Only the pending row is held,
+	// so memory does not grow with the length of the run.  All the variables of the file are
+	// written, as by ReadVarsESO run from the -r option ("unlimited", no variable list); value
+	// and heading lengths and the splitting of long runs of empty columns follow ReadVarsESO.
+
+	// REFERENCES:
+	// src/ReadVars/ReadVarsESO.f90
+
+	// OTHER NOTES: na
+
+	// Using/Aliasing
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const EsoCsv( 0 ); // The csv file of the eso file
+	int const MtrCsv( 1 ); // The csv file of the mtr file
+	int const NumCsvFiles( 2 );
+
+	std::string::size_type const MaxValueLength( 25 ); // Characters of a value kept, as by ReadVarsESO
+	std::string::size_type const MaxHeadingLength( 145 ); // Characters of a column heading kept, with its separator
+	std::string::size_type const MaxPieceLength( 3000 ); // Characters of a row held before a piece is written
+	int const CommaLimit( 2990 ); // Separators of empty columns written at most in one piece
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool WriteCsvOutput( false ); // True while the csv files are written during the run
+
+	// Object Data
+	std::vector< CsvFileData > CsvFiles; // Indexed by EsoCsv and MtrCsv
+
+	// Functions
+
+	void
+	InitCsvOutput()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the csv files when they are to be written during the run.
+
+		// Using/Aliasing
+		using DataSystemVariables::CsvOutputDuringRun;
+		using DataStringGlobals::outputCsvFileName;
+		using DataStringGlobals::outputMtrCsvFileName;
+
+		CloseCsvOutput();
+		if ( ! CsvOutputDuringRun ) return;
+		if ( ColumnarOutput::ColumnarOutputOnly ) {
+			ShowWarningError( "InitCsvOutput: Output:Columnar writes the values to the columnar file only; the csv files will not be written." );
+			return;
+		}
+
+		CsvFiles.resize( NumCsvFiles );
+		OpenCsvFile( EsoCsv, outputCsvFileName );
+		OpenCsvFile( MtrCsv, outputMtrCsvFileName );
+
+	}
+
+	void
+	OpenCsvFile(
+		int const CsvFileNum,
+		std::string const & FileName
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts one csv file.
+
+		// Using/Aliasing
+		using DataSystemVariables::UseOutputWriterThread;
+		using OutputWriterThread::StartOutputWriter;
+
+		auto & Csv( CsvFiles[ CsvFileNum ] );
+		Csv.FileName = FileName;
+		Csv.Stream.open( FileName, std::ios::out | std::ios::trunc );
+		Csv.Open = bool( Csv.Stream );
+		if ( ! Csv.Open ) {
+			ShowSevereError( "InitCsvOutput: Could not open file " + FileName + " for output (write)." );
+			Csv.FileName.clear();
+			return;
+		}
+		WriteCsvOutput = true;
+		if ( UseOutputWriterThread ) StartOutputWriter( &Csv.Stream );
+
+	}
+
+	void
+	AddCsvColumn(
+		int const CsvFileNum,
+		int const ReportID,
+		std::string const & Entry // Dictionary entry after the report ID and item count
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the column of a variable or meter written to the dictionary of the eso or mtr file.
+
+		if ( ! WriteCsvOutput || ReportID < 0 ) return;
+		auto & Csv( CsvFiles[ CsvFileNum ] );
+		if ( ! Csv.Open || Csv.HeadingWritten ) return; // ReadVarsESO reads the dictionary up to its end only
+
+		if ( ReportID >= int( Csv.ColumnOfReport.size() ) ) Csv.ColumnOfReport.resize( ReportID + 1, -1 );
+		if ( Csv.ColumnOfReport[ ReportID ] >= 0 ) return;
+		Csv.ColumnOfReport[ ReportID ] = int( Csv.Headings.size() );
+		Csv.Headings.push_back( CsvColumnHeading( Entry ) );
+		Csv.Values.push_back( std::string() );
+		Csv.Values.back().reserve( MaxValueLength );
+		Csv.Found.push_back( false );
+
+	}
+
+	std::string
+	CsvColumnHeading( std::string const & Entry ) // Dictionary entry after the report ID and item count
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the column heading ReadVarsESO makes from a dictionary entry, such as
+		// "ZONE ONE:Zone Mean Air Temperature [C](Hourly)".
+
+		// METHODOLOGY EMPLOYED:
+		// The key, name and units are followed by the reporting frequency in parentheses, without
+		// the bracketed list of the values given for daily and longer frequencies but with the
+		// schedule name that may follow it; commas become colons.
+
+		std::string Heading;
+		std::string::size_type const Notice( Entry.find( '!' ) );
+		if ( Notice != std::string::npos ) {
+			Heading.assign( Entry, 0, Notice );
+			rstrip( Heading );
+			Heading += '(';
+			std::string const Frequency( Entry, Notice + 1 );
+			std::string::size_type const Bracket( Frequency.find( '[' ) );
+			if ( Bracket != std::string::npos ) {
+				Heading.append( Frequency, 0, Bracket > 0 ? Bracket - 1 : 0 ); // Without the space before the bracket
+				std::string::size_type const Close( Frequency.find( ']' ) );
+				std::string::size_type const After( Close == std::string::npos ? 0 : Close + 1 );
+				if ( After < Frequency.size() && Frequency[ After ] == ',' ) Heading.append( Frequency, After, std::string::npos );
+			} else {
+				Heading += Frequency;
+			}
+			rstrip( Heading );
+			Heading += ')';
+		}
+		for ( auto & Character : Heading ) {
+			if ( Character == ',' ) Character = ':';
+		}
+		return Heading;
+
+	}
+
+	void
+	EndCsvDictionary()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the heading line of each csv file when the end of the data dictionary is written
+		// to the eso and mtr files.
+
+		if ( ! WriteCsvOutput ) return;
+		for ( auto & Csv : CsvFiles ) {
+			if ( Csv.Open && ! Csv.HeadingWritten ) WriteCsvHeading( Csv );
+		}
+
+	}
+
+	void
+	WriteCsvHeading( CsvFileData & Csv )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the heading line of a csv file; no columns are added afterwards.
+
+		// Using/Aliasing
+		using DataStringGlobals::NL;
+
+		std::string Part;
+		Csv.Stream << "Date/Time";
+		for ( auto const & Heading : Csv.Headings ) {
+			Part = ',';
+			Part.append( Heading, 0, MaxHeadingLength - 1 );
+			rstrip( Part );
+			Csv.Stream << Part;
+		}
+		Csv.Stream << ' ' << NL;
+		Csv.HeadingWritten = true;
+		std::vector< std::string >().swap( Csv.Headings );
+
+	}
+
+	void
+	WriteCsvTimeStamp(
+		int const CsvFileNum,
+		int const ReportingInterval,
+		int const DayOfSim,
+		int const Month,
+		int const DayOfMonth,
+		int const Hour,
+		Real64 const EndMinute
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Takes a time stamp written to the eso or mtr file, writing the pending row when
+		// ReadVarsESO would write it there.
+
+		// METHODOLOGY EMPLOYED:
+		// The end minute is compared and converted as ReadVarsESO reads it from the stamp: from two
+		// decimals, in single precision.
+
+		// Using/Aliasing
+		using OutputProcessor::ReportEach;
+		using OutputProcessor::ReportTimeStep;
+		using OutputProcessor::ReportHourly;
+		using OutputProcessor::ReportDaily;
+		using OutputProcessor::ReportMonthly;
+		using OutputProcessor::ReportSim;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static char const * const MonthNames[ 12 ] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		char Buffer[ 64 ];
+
+		if ( ! WriteCsvOutput || CsvFileNum < 0 ) return;
+		auto & Csv( CsvFiles[ CsvFileNum ] );
+		if ( ! Csv.Open ) return;
+		if ( ! Csv.HeadingWritten ) WriteCsvHeading( Csv );
+
+		if ( ( ReportingInterval == ReportEach ) || ( ReportingInterval == ReportTimeStep ) || ( ReportingInterval == ReportHourly ) ) {
+			Csv.NoDetails = false;
+			std::snprintf( Buffer, sizeof( Buffer ), "%.2f", EndMinute );
+			float const NewEndMinute( std::strtof( Buffer, nullptr ) );
+			if ( ! Csv.CurDate.empty() && ( Hour != Csv.HourOfDay || NewEndMinute != Csv.EndMinute ) ) WriteCsvRow( Csv, Csv.CurDate );
+			Csv.HourOfDay = Hour;
+			Csv.EndMinute = NewEndMinute;
+			int CurHour( Hour - 1 );
+			int CurMinute( static_cast< int >( NewEndMinute ) );
+			int const CurSecond( static_cast< int >( ( NewEndMinute - static_cast< float >( CurMinute ) ) * 60.0f ) );
+			if ( NewEndMinute == 60.0f ) {
+				CurHour = Hour;
+				CurMinute = 0;
+			}
+			std::snprintf( Buffer, sizeof( Buffer ), " %02d/%02d  %02d:%02d:%02d", Month, DayOfMonth, CurHour, CurMinute, CurSecond );
+			Csv.CurDate = Buffer;
+
+		} else if ( ReportingInterval == ReportDaily ) {
+			if ( ! Csv.NoDetails ) return;
+			Csv.NoMonDay = false;
+			if ( ! Csv.CurMonDay.empty() ) WriteCsvRow( Csv, Csv.CurMonDay );
+			std::snprintf( Buffer, sizeof( Buffer ), " %02d/%02d", Month, DayOfMonth );
+			Csv.CurMonDay = Buffer;
+
+		} else if ( ReportingInterval == ReportMonthly ) {
+			if ( ! Csv.NoDetails || ! Csv.NoMonDay ) return;
+			Csv.NoMon = false;
+			if ( ! Csv.CurMon.empty() ) WriteCsvRow( Csv, Csv.CurMon );
+			Csv.CurMon = ( Month >= 1 && Month <= 12 ) ? MonthNames[ Month - 1 ] : "";
+
+		} else if ( ReportingInterval == ReportSim ) {
+			if ( ! Csv.NoDetails || ! Csv.NoMonDay || ! Csv.NoMon ) return;
+			if ( ! Csv.CurPer.empty() ) WriteCsvRow( Csv, Csv.CurPer );
+			Csv.CurPer = "simdays=" + std::to_string( DayOfSim );
+
+		}
+
+	}
+
+	void
+	WriteCsvValue(
+		int const CsvFileNum,
+		int const ReportID,
+		char const * Value // Value as written to the eso or mtr file
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Puts a value written to the eso or mtr file into the pending row.
+
+		if ( ! WriteCsvOutput ) return;
+		auto & Csv( CsvFiles[ CsvFileNum ] );
+		if ( ReportID < 0 || ReportID >= int( Csv.ColumnOfReport.size() ) ) return;
+		int const Column( Csv.ColumnOfReport[ ReportID ] );
+		if ( Column < 0 ) return;
+
+		std::string::size_type Length( std::strlen( Value ) );
+		if ( Length > MaxValueLength ) Length = MaxValueLength;
+		while ( Length > 0 && Value[ Length - 1 ] == ' ' ) --Length;
+		Csv.Values[ Column ].assign( Value, Length );
+		Csv.Found[ Column ] = true;
+
+	}
+
+	void
+	WriteCsvRow(
+		CsvFileData & Csv,
+		std::string const & Stamp
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the pending row of a csv file, if it has any value.
+
+		// METHODOLOGY EMPLOYED:
+		// As ReadVarsESO: the separators of empty columns are written only when a later column has
+		// a value, except that a run of more than CommaLimit of them is written as a piece
+		// without waiting, and a row with no value is not written.
+
+		// Using/Aliasing
+		using DataStringGlobals::NL;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::string Piece; // Text of the row not yet written
+
+		Piece = Stamp;
+		bool AnyToPrint( false );
+		int CommaCount( 0 );
+		int const NumColumns( int( Csv.Values.size() ) );
+		for ( int Column = 0; Column < NumColumns; ++Column ) {
+			if ( Csv.Found[ Column ] ) {
+				Csv.Stream << Piece << ',' << Csv.Values[ Column ];
+				Piece.clear();
+				CommaCount = 0;
+				AnyToPrint = true;
+			} else {
+				if ( Piece.size() < MaxPieceLength ) Piece += ',';
+				++CommaCount;
+				if ( CommaCount > CommaLimit ) {
+					Csv.Stream << Piece;
+					Piece.clear();
+					CommaCount = 0;
+				}
+			}
+		}
+		if ( AnyToPrint ) Csv.Stream << ' ' << NL;
+		Csv.Found.assign( Csv.Found.size(), false );
+
+	}
+
+	void
+	CloseCsvFile(
+		int const CsvFileNum,
+		bool const Keep // False to delete the file, as when the eso or mtr file holds no records
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the last row of a csv file, as at the end of the data of the eso or mtr file, and
+		// closes it.
+
+		if ( CsvFileNum >= int( CsvFiles.size() ) ) return;
+		auto & Csv( CsvFiles[ CsvFileNum ] );
+		if ( ! Csv.Open ) return;
+
+		if ( ! Csv.HeadingWritten ) WriteCsvHeading( Csv );
+		if ( ! Csv.NoDetails ) {
+			WriteCsvRow( Csv, Csv.CurDate );
+		} else if ( ! Csv.NoMonDay ) {
+			WriteCsvRow( Csv, Csv.CurMonDay );
+		} else if ( ! Csv.NoMon ) {
+			WriteCsvRow( Csv, Csv.CurMon );
+		} else {
+			WriteCsvRow( Csv, Csv.CurPer );
+		}
+		OutputWriterThread::StopOutputWriter( &Csv.Stream );
+		Csv.Stream.close();
+		Csv.Open = false;
+		if ( ! Keep ) std::remove( Csv.FileName.c_str() );
+
+		WriteCsvOutput = false;
+		for ( auto const & Other : CsvFiles ) {
+			if ( Other.Open ) WriteCsvOutput = true;
+		}
+
+	}
+
+	void
+	CloseCsvOutput()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Closes the csv files still open, as when the run ends early.
+
+		for ( int CsvFileNum = 0; CsvFileNum < int( CsvFiles.size() ); ++CsvFileNum ) {
+			CloseCsvFile( CsvFileNum, true );
+		}
+		CsvFiles.clear();
+		WriteCsvOutput = false;
+
+	}
+
+	bool
+	CsvFileWritten( int const CsvFileNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// True if the csv file was written during this run, so that ReadVarsESO need not make it.
+
+		return ( CsvFileNum < int( CsvFiles.size() ) ) && ( ! CsvFiles[ CsvFileNum ].FileName.empty() );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // CsvOutput
+
+} // EnergyPlus
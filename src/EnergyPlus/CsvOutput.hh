@@ -0,0 +1,161 @@
+#ifndef CsvOutput_hh_INCLUDED
+#define CsvOutput_hh_INCLUDED
+
+// C++ Headers
+#include <fstream>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace CsvOutput {
+
+	// Using/Aliasing
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const EsoCsv; // The csv file of the eso file
+	extern int const MtrCsv; // The csv file of the mtr file
+	extern int const NumCsvFiles;
+
+	extern std::string::size_type const MaxValueLength; // Characters of a value kept, as by ReadVarsESO
+	extern std::string::size_type const MaxHeadingLength; // Characters of a column heading kept, with its separator
+	extern std::string::size_type const MaxPieceLength; // Characters of a row held before a piece is written
+	extern int const CommaLimit; // Separators of empty columns written at most in one piece
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool WriteCsvOutput; // True while the csv files are written during the run
+
+	// Types
+
+	struct CsvFileData
+	{
+		// Members
+		std::string FileName;
+		std::ofstream Stream;
+		bool Open;
+		bool HeadingWritten; // Columns are not added once the heading line is written
+		std::vector< std::string > Headings; // Column headings, released once written
+		std::vector< int > ColumnOfReport; // Column (0 based) of each report ID, -1 if none
+		std::vector< std::string > Values; // Value of each column in the pending row
+		std::vector< bool > Found; // Column has a value in the pending row
+		std::string CurDate; // Stamp of the pending row, by reporting interval
+		std::string CurMonDay;
+		std::string CurMon;
+		std::string CurPer;
+		bool NoDetails; // No time step or hourly stamp seen yet
+		bool NoMonDay; // No daily stamp seen yet
+		bool NoMon; // No monthly stamp seen yet
+		int HourOfDay; // Hour and end minute of the last time step or hourly stamp
+		float EndMinute;
+
+		// Default Constructor
+		CsvFileData() :
+			Open( false ),
+			HeadingWritten( false ),
+			NoDetails( true ),
+			NoMonDay( true ),
+			NoMon( true ),
+			HourOfDay( 0 ),
+			EndMinute( 0.0f )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< CsvFileData > CsvFiles; // Indexed by EsoCsv and MtrCsv
+
+	// Functions
+
+	void
+	InitCsvOutput();
+
+	void
+	OpenCsvFile(
+		int const CsvFileNum,
+		std::string const & FileName
+	);
+
+	void
+	AddCsvColumn(
+		int const CsvFileNum,
+		int const ReportID,
+		std::string const & Entry // Dictionary entry after the report ID and item count
+	);
+
+	std::string
+	CsvColumnHeading( std::string const & Entry ); // Dictionary entry after the report ID and item count
+
+	void
+	EndCsvDictionary();
+
+	void
+	WriteCsvHeading( CsvFileData & Csv );
+
+	void
+	WriteCsvTimeStamp(
+		int const CsvFileNum,
+		int const ReportingInterval,
+		int const DayOfSim,
+		int const Month,
+		int const DayOfMonth,
+		int const Hour,
+		Real64 const EndMinute
+	);
+
+	void
+	WriteCsvValue(
+		int const CsvFileNum,
+		int const ReportID,
+		char const * Value // Value as written to the eso or mtr file
+	);
+
+	void
+	WriteCsvRow(
+		CsvFileData & Csv,
+		std::string const & Stamp
+	);
+
+	void
+	CloseCsvFile(
+		int const CsvFileNum,
+		bool const Keep // False to delete the file, as when the eso or mtr file holds no records
+	);
+
+	void
+	CloseCsvOutput();
+
+	bool
+	CsvFileWritten( int const CsvFileNum );
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // CsvOutput
+
+} // EnergyPlus
+
+#endif
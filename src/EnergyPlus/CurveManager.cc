@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <string>
 
@@ -280,7 +281,14 @@ namespace CurveManager {
 			ShowFatalError( "CurveValue: Invalid curve passed." );
 		}
 
-		{ auto const SELECT_CASE_var( PerfCurve( CurveIndex ).InterpolationType );
+		auto const & Curve( PerfCurve( CurveIndex ) );
+		if ( Curve.Evaluator != nullptr ) { // Curve object bound to the evaluator of its form
+			auto const & Coeffs( Curve.Coeffs );
+			Real64 const V1( max( min( Var1, Coeffs.VarMax[ 0 ] ), Coeffs.VarMin[ 0 ] ) );
+			Real64 const V2( Var2.present() ? max( min( Var2, Coeffs.VarMax[ 1 ] ), Coeffs.VarMin[ 1 ] ) : 0.0 );
+			Real64 const V3( Var3.present() ? max( min( Var3, Coeffs.VarMax[ 2 ] ), Coeffs.VarMin[ 2 ] ) : 0.0 );
+			CurveValue = Curve.Evaluator( Coeffs, V1, V2, V3, 0.0 ); // Var4 is not passed to PerformanceCurveObject either
+		} else { auto const SELECT_CASE_var( Curve.InterpolationType );
 		if ( SELECT_CASE_var == EvaluateCurveToLimits ) {
 			CurveValue = PerformanceCurveObject( CurveIndex, Var1, Var2, Var3 );
 		} else if ( SELECT_CASE_var == LinearInterpolationOfTable ) {
@@ -2450,6 +2458,10 @@ namespace CurveManager {
 			ShowFatalError( "GetCurveInput: Errors found in getting Curve Objects.  Preceding condition(s) cause termination." );
 		}
 
+		for ( CurveIndex = 1; CurveIndex <= NumCurves; ++CurveIndex ) {
+			BindCurveEvaluator( CurveIndex );
+		}
+
 	}
 
 	void
@@ -3410,9 +3422,6 @@ Label999: ;
 		// USE STATEMENTS:
 		// na
 
-		// Return value
-		Real64 DLAG;
-
 		// Argument array dimensioning
 
 		// Locals
@@ -3428,36 +3437,52 @@ Label999: ;
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:!
-		int I;
-		int ISXPT( 0 );
-		int IEXPT( 0 );
-		int J;
-		int ISYPT( 0 );
-		int IEYPT( 0 );
-		int K;
-		int M1;
-		Real64 MIDX;
-		Real64 MIDY;
-
-		//       INITIALIZE
-		bool QUITX = false;
-		bool QUITY = false;
-		IEXTX = 0;
-		IEXTY = 0;
+		TableAxisStencil XStencil;
+		TableAxisStencil YStencil;
+
 		//       The following code has been upgraded to current Fortran standards
 		//       See Starteam Revision 33, August 17, 2010 for legacy code if comparison is needed
-		//       FIND THE RANGE OF INTERPOLATION ALONG X
-		M1 = M; // number of points to be interpolated (X direction is first)
+		FindTableAxisStencil( XX, X, NX, M, XStencil ); // X direction is first
+		FindTableAxisStencil( YY, Y, NY, M, YStencil );
+		IEXTX = XStencil.Extrap;
+		IEXTY = YStencil.Extrap;
+
+		return DLAG( XX, YY, X, Y, Z, XStencil, YStencil );
+	}
+
+	void
+	FindTableAxisStencil(
+		Real64 const XX, // Value of the independent variable
+		Array1S< Real64 > X, // Points of the axis
+		int const NX, // Number of points of the axis
+		int const M, // Number of points to interpolate between
+		TableAxisStencil & Stencil
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the points of one axis DLAG uses for a value, so a table lookup can find them
+		// once for all the interpolations along that axis.
+
+		// METHODOLOGY EMPLOYED:
+		// Search of DLAG (extrapolation always uses at most two points).
+
+		int ISXPT( 0 );
+		int IEXPT( 0 );
+		int MIDX;
+
+		Stencil = TableAxisStencil();
+		int M1 = M; // number of points to be interpolated
 		if ( M1 > NX ) M1 = NX; // limit to number of X points if necessary
 
 		//       loop through X data and find the first x-coordinate less than the interpolated point
 		//       if the interpolation point is less than or greater than the X data then linearly extrapolate
 		//       linear extrapolation uses only 2 points (M1=2)
-		for ( I = 1; I <= NX; ++I ) {
+		for ( int I = 1; I <= NX; ++I ) {
 			if ( XX - X( I ) < 0.0 ) {
 				MIDX = I; // found X point just greater than interpolation point
 				if ( MIDX == 1 ) {
-					IEXTX = -1; // extrapolating at the lower bound of x
+					Stencil.Extrap = -1; // extrapolating at the lower bound of x
 					if ( M1 > 2 ) M1 = 2; // limit to linear extrapolation
 				}
 				ISXPT = MIDX - ( ( M1 + 1 ) / 2 ); // calculate starting point in X array
@@ -3469,60 +3494,59 @@ Label999: ;
 				}
 				break;
 			} else if ( XX - X( I ) == 0.0 ) { // interpolation point is equal to element in X array
-				QUITX = true; // exact interpolation point found in X array, do not interpolate
+				Stencil.Exact = true; // exact interpolation point found in X array, do not interpolate
+				ISXPT = IEXPT = I;
 				break;
 			} else if ( I == NX ) { // interpolation point is greater than max X value
-				IEXTX = 1; // extrapolating at the upper bound of X
+				Stencil.Extrap = 1; // extrapolating at the upper bound of X
 				if ( M1 > 2 ) M1 = 2; // limit to linear extrapolation
 				ISXPT = NX - M1 + 1; // calculate starting point in X array
 				IEXPT = NX; // ending point equals upper bound of X array
 				break;
 			}
 		}
+		Stencil.Lo = ISXPT;
+		Stencil.Hi = IEXPT;
 
-		M1 = M; // number of points to be interpolated (Y direction is second)
-		if ( M1 > NY ) M1 = NY; // limit to number of Y points if necessary
+	}
 
-		for ( J = 1; J <= NY; ++J ) {
-			if ( YY - Y( J ) < 0.0 ) {
-				MIDY = J; // found Y point just greater than interpolation point
-				if ( MIDY <= 1 ) {
-					IEXTY = -1; // extrapolating at the lower bound of y
-					if ( M1 > 2 ) M1 = 2; // limit to linear extrapolation
-				}
-				ISYPT = MIDY - ( ( M1 + 1 ) / 2 ); // calculate starting point in Y array
-				if ( ISYPT <= 0 ) ISYPT = 1; // limit to first element in array
-				IEYPT = ISYPT + M1 - 1; // calculate ending point in X array
-				if ( IEYPT > NY ) {
-					ISYPT = NY - M1 + 1; // if upper Y array boundary exceeded, recalculate starting point
-					IEYPT = NY; // limit ending point to upper boundary of Y array
-				}
-				break;
-			} else if ( YY - Y( J ) == 0.0 ) { // interpolation point is equal to element in Y array
-				QUITY = true; // exact interpolation point found in Y array, do not interpolate
-				break;
-			} else if ( J == NY ) { // interpolation point is greater than max Y value
-				IEXTY = 1; // extrapolating at the upper bound of Y
-				if ( M1 > 2 ) M1 = 2; // limit to linear extrapolation
-				ISYPT = NY - M1 + 1; // calculate starting point in Y array
-				IEYPT = NY; // ending point equals upper bound of Y array
-				break;
-			}
-		}
+	Real64
+	DLAG(
+		Real64 const XX,
+		Real64 const YY,
+		Array1S< Real64 > X,
+		Array1S< Real64 > Y,
+		Array2S< Real64 > Z,
+		TableAxisStencil const & XStencil, // Points of X used for XX
+		TableAxisStencil const & YStencil // Points of Y used for YY
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Two-dimensional Lagrangian interpolation of DLAG over the points of X and Y already
+		// found for XX and YY.
 
-		if ( QUITX && QUITY ) {
-			DLAG = Z( J, I ); // found exact X and Y point in Z array
-		} else if ( QUITX && ! QUITY ) { // only interpolate in Y direction
+		// Return value
+		Real64 DLAG;
+
+		int const ISXPT( XStencil.Lo );
+		int const IEXPT( XStencil.Hi );
+		int const ISYPT( YStencil.Lo );
+		int const IEYPT( YStencil.Hi );
+
+		if ( XStencil.Exact && YStencil.Exact ) {
+			DLAG = Z( ISYPT, ISXPT ); // found exact X and Y point in Z array
+		} else if ( XStencil.Exact ) { // only interpolate in Y direction
 			Array1D< Real64 > XLAG( IEYPT );
 			for ( int l = ISYPT; l <= IEYPT; ++l ) {
-				XLAG( l ) = Z( l, I ); // store X's at each Y (I = midpoint of array from above)
+				XLAG( l ) = Z( l, ISXPT ); // store X's at each Y (exact X point)
 			}
 			Interpolate_Lagrange( YY, XLAG, Y, ISYPT, IEYPT, DLAG ); // now interpolate these X's
-		} else if ( ! QUITX && QUITY ) { // only interpolate in X direction
-			Interpolate_Lagrange( XX, Z( J, _ ), X, ISXPT, IEXPT, DLAG ); // (:,J) interpolate X array at fixed Y (J here)
+		} else if ( YStencil.Exact ) { // only interpolate in X direction
+			Interpolate_Lagrange( XX, Z( ISYPT, _ ), X, ISXPT, IEXPT, DLAG ); // interpolate X array at the exact Y point
 		} else { // else interpolate in X and Y directions
 			Array1D< Real64 > XLAG( IEYPT );
-			for ( K = ISYPT; K <= IEYPT; ++K ) {
+			for ( int K = ISYPT; K <= IEYPT; ++K ) {
 				Interpolate_Lagrange( XX, Z( K, _ ), X, ISXPT, IEXPT, XLAG( K ) ); // (:,K) interpolate X array at all Y's (K here)
 			}
 			Interpolate_Lagrange( YY, XLAG, Y, ISYPT, IEYPT, DLAG ); // final interpolation of X array
@@ -3661,6 +3685,272 @@ Label999: ;
 		return CurveValue;
 	}
 
+	// Curve forms evaluated by CurveFormValue, with the expressions of PerformanceCurveObject
+
+	struct LinearCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + V1 * C[ 1 ];
+		}
+	};
+
+	struct QuadraticCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + V1 * ( C[ 1 ] + V1 * C[ 2 ] );
+		}
+	};
+
+	struct QuadLinearCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const V4 )
+		{
+			return C[ 0 ] + V1 * C[ 1 ] + V2 * C[ 2 ] + V3 * C[ 3 ] + V4 * C[ 4 ];
+		}
+	};
+
+	struct CubicCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + V1 * ( C[ 1 ] + V1 * ( C[ 2 ] + V1 * C[ 3 ] ) );
+		}
+	};
+
+	struct QuarticCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + V1 * ( C[ 1 ] + V1 * ( C[ 2 ] + V1 * ( C[ 3 ] + V1 * C[ 4 ] ) ) );
+		}
+	};
+
+	struct BiQuadraticCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + V1 * ( C[ 1 ] + V1 * C[ 2 ] ) + V2 * ( C[ 3 ] + V2 * C[ 4 ] ) + V1 * V2 * C[ 5 ];
+		}
+	};
+
+	struct QuadraticLinearCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return ( C[ 0 ] + V1 * ( C[ 1 ] + V1 * C[ 2 ] ) ) + ( C[ 3 ] + V1 * ( C[ 4 ] + V1 * C[ 5 ] ) ) * V2;
+		}
+	};
+
+	struct CubicLinearCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return ( C[ 0 ] + V1 * ( C[ 1 ] + V1 * ( C[ 2 ] + V1 * C[ 3 ] ) ) ) + ( C[ 4 ] + V1 * C[ 5 ] ) * V2;
+		}
+	};
+
+	struct BiCubicCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + V1 * C[ 1 ] + V1 * V1 * C[ 2 ] + V2 * C[ 3 ] + V2 * V2 * C[ 4 ] + V1 * V2 * C[ 5 ] + V1 * V1 * V1 * C[ 6 ] + V2 * V2 * V2 * C[ 7 ] + V1 * V1 * V2 * C[ 8 ] + V1 * V2 * V2 * C[ 9 ];
+		}
+	};
+
+	struct ChillerPartLoadWithLiftCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const )
+		{
+			return C[ 0 ] + C[ 1 ]*V1 + C[ 2 ]*V1*V1 + C[ 3 ]*V2 + C[ 4 ]*V2*V2 + C[ 5 ]*V1*V2  + C[ 6 ]*V1*V1*V1 + C[ 7 ]*V2*V2*V2 + C[ 8 ]*V1*V1*V2 + C[ 9 ]*V1*V2*V2 + C[ 10 ]*V1*V1*V2*V2 + C[ 11 ]*V3*V2*V2*V2;
+		}
+	};
+
+	struct TriQuadraticCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const )
+		{
+			auto const V1s( V1 * V1 );
+			auto const V2s( V2 * V2 );
+			auto const V3s( V3 * V3 );
+			return C[ 0 ] + C[ 1 ] * V1s + C[ 2 ] * V1 + C[ 3 ] * V2s + C[ 4 ] * V2 + C[ 5 ] * V3s + C[ 6 ] * V3 + C[ 7 ] * V1s * V2s + C[ 8 ] * V1 * V2 + C[ 9 ] * V1 * V2s + C[ 10 ] * V1s * V2 + C[ 11 ] * V1s * V3s + C[ 12 ] * V1 * V3 + C[ 13 ] * V1 * V3s + C[ 14 ] * V1s * V3 + C[ 15 ] * V2s * V3s + C[ 16 ] * V2 * V3 + C[ 17 ] * V2 * V3s + C[ 18 ] * V2s * V3 + C[ 19 ] * V1s * V2s * V3s + C[ 20 ] * V1s * V2s * V3 + C[ 21 ] * V1s * V2 * V3s + C[ 22 ] * V1 * V2s * V3s + C[ 23 ] * V1s * V2 * V3 + C[ 24 ] * V1 * V2s * V3 + C[ 25 ] * V1 * V2 * V3s + C[ 26 ] * V1 * V2 * V3;
+		}
+	};
+
+	struct ExponentCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + C[ 1 ] * std::pow( V1, C[ 2 ] );
+		}
+	};
+
+	struct FanPressureRiseCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return V1 * ( C[ 0 ] * V1 + C[ 1 ] + C[ 2 ] * std::sqrt( V2 ) ) + C[ 3 ] * V2;
+		}
+	};
+
+	struct ExponentialSkewNormalCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			static Real64 const sqrt_2_inv( 1.0 / std::sqrt( 2.0 ) );
+			Real64 const CoeffZ1( ( V1 - C[ 0 ] ) / C[ 1 ] );
+			Real64 const CoeffZ2( ( C[ 3 ] * V1 * std::exp( C[ 2 ] * V1 ) - C[ 0 ] ) / C[ 1 ] );
+			Real64 const CoeffZ3( -C[ 0 ] / C[ 1 ] );
+			Real64 const CurveValueNumer( std::exp( -0.5 * ( CoeffZ1 * CoeffZ1 ) ) * ( 1.0 + sign( 1.0, CoeffZ2 ) * std::erf( std::abs( CoeffZ2 ) * sqrt_2_inv ) ) );
+			Real64 const CurveValueDenom( std::exp( -0.5 * ( CoeffZ3 * CoeffZ3 ) ) * ( 1.0 + sign( 1.0, CoeffZ3 ) * std::erf( std::abs( CoeffZ3 ) * sqrt_2_inv ) ) );
+			return CurveValueNumer / CurveValueDenom;
+		}
+	};
+
+	struct SigmoidCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			Real64 const CurveValueExp( std::exp( ( C[ 2 ] - V1 ) / C[ 3 ] ) );
+			return C[ 0 ] + C[ 1 ] / std::pow( 1.0 + CurveValueExp, C[ 4 ] );
+		}
+	};
+
+	struct RectangularHyperbola1CurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return ( ( C[ 0 ] * V1 ) / ( C[ 1 ] + V1 ) ) + C[ 2 ];
+		}
+	};
+
+	struct RectangularHyperbola2CurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return ( ( C[ 0 ] * V1 ) / ( C[ 1 ] + V1 ) ) + ( C[ 2 ] * V1 );
+		}
+	};
+
+	struct ExponentialDecayCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + C[ 1 ] * std::exp( C[ 2 ] * V1 );
+		}
+	};
+
+	struct DoubleExponentialDecayCurveForm
+	{
+		static Real64 value( Real64 const * const C, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return C[ 0 ] + C[ 1 ] * std::exp( C[ 2 ] * V1 ) + C[ 3 ] * std::exp( C[ 4 ] * V1 );
+		}
+	};
+
+	template< typename CurveForm >
+	Real64
+	CurveFormValue(
+		CurveCoeffData const & Data, // Coefficients and limits of the curve
+		Real64 const V1, // 1st independent variable after limits imposed
+		Real64 const V2, // 2nd independent variable after limits imposed
+		Real64 const V3, // 3rd independent variable after limits imposed
+		Real64 const V4 // 4th independent variable after limits imposed
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Value of a curve of the given form with the output limits imposed.
+
+		Real64 CurveValue( CurveForm::value( Data.Coeff, V1, V2, V3, V4 ) );
+		if ( Data.CurveMinPresent ) CurveValue = max( CurveValue, Data.CurveMin );
+		if ( Data.CurveMaxPresent ) CurveValue = min( CurveValue, Data.CurveMax );
+		return CurveValue;
+
+	}
+
+	void
+	BindCurveEvaluator( int const CurveIndex ) // index of curve in curve array
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs the coefficients and limits of a curve object and binds it to the evaluator of
+		// its form, so CurveValue does not select on the curve type at each call.  Tables and
+		// types without an evaluator are left to the selection in CurveValue.
+
+		// METHODOLOGY EMPLOYED:
+		// Must be called again whenever the coefficients or limits of the curve change.
+
+		auto & Curve( PerfCurve( CurveIndex ) );
+		auto & Coeffs( Curve.Coeffs );
+		Curve.Evaluator = nullptr;
+
+		Coeffs = CurveCoeffData();
+		Real64 const CurveCoeffs[ 12 ] = { Curve.Coeff1, Curve.Coeff2, Curve.Coeff3, Curve.Coeff4, Curve.Coeff5, Curve.Coeff6, Curve.Coeff7, Curve.Coeff8, Curve.Coeff9, Curve.Coeff10, Curve.Coeff11, Curve.Coeff12 };
+		std::copy( CurveCoeffs, CurveCoeffs + 12, Coeffs.Coeff );
+		Coeffs.VarMin[ 0 ] = Curve.Var1Min;
+		Coeffs.VarMax[ 0 ] = Curve.Var1Max;
+		Coeffs.VarMin[ 1 ] = Curve.Var2Min;
+		Coeffs.VarMax[ 1 ] = Curve.Var2Max;
+		Coeffs.VarMin[ 2 ] = Curve.Var3Min;
+		Coeffs.VarMax[ 2 ] = Curve.Var3Max;
+		Coeffs.VarMin[ 3 ] = Curve.Var4Min;
+		Coeffs.VarMax[ 3 ] = Curve.Var4Max;
+		Coeffs.CurveMin = Curve.CurveMin;
+		Coeffs.CurveMax = Curve.CurveMax;
+		Coeffs.CurveMinPresent = Curve.CurveMinPresent;
+		Coeffs.CurveMaxPresent = Curve.CurveMaxPresent;
+
+		if ( Curve.InterpolationType != EvaluateCurveToLimits ) return;
+
+		{ auto const SELECT_CASE_var( Curve.CurveType );
+		if ( SELECT_CASE_var == Linear ) {
+			Curve.Evaluator = CurveFormValue< LinearCurveForm >;
+		} else if ( SELECT_CASE_var == Quadratic ) {
+			Curve.Evaluator = CurveFormValue< QuadraticCurveForm >;
+		} else if ( SELECT_CASE_var == QuadLinear ) {
+			Curve.Evaluator = CurveFormValue< QuadLinearCurveForm >;
+		} else if ( SELECT_CASE_var == Cubic ) {
+			Curve.Evaluator = CurveFormValue< CubicCurveForm >;
+		} else if ( SELECT_CASE_var == Quartic ) {
+			Curve.Evaluator = CurveFormValue< QuarticCurveForm >;
+		} else if ( SELECT_CASE_var == BiQuadratic ) {
+			Curve.Evaluator = CurveFormValue< BiQuadraticCurveForm >;
+		} else if ( SELECT_CASE_var == QuadraticLinear ) {
+			Curve.Evaluator = CurveFormValue< QuadraticLinearCurveForm >;
+		} else if ( SELECT_CASE_var == CubicLinear ) {
+			Curve.Evaluator = CurveFormValue< CubicLinearCurveForm >;
+		} else if ( SELECT_CASE_var == BiCubic ) {
+			Curve.Evaluator = CurveFormValue< BiCubicCurveForm >;
+		} else if ( SELECT_CASE_var == ChillerPartLoadWithLift ) {
+			Curve.Evaluator = CurveFormValue< ChillerPartLoadWithLiftCurveForm >;
+		} else if ( SELECT_CASE_var == TriQuadratic ) {
+			if ( Curve.Tri2ndOrder.empty() ) return;
+			auto const & Tri2ndOrder( Curve.Tri2ndOrder( 1 ) );
+			Real64 const TriCoeffs[ 27 ] = { Tri2ndOrder.CoeffA0, Tri2ndOrder.CoeffA1, Tri2ndOrder.CoeffA2, Tri2ndOrder.CoeffA3, Tri2ndOrder.CoeffA4, Tri2ndOrder.CoeffA5, Tri2ndOrder.CoeffA6, Tri2ndOrder.CoeffA7, Tri2ndOrder.CoeffA8, Tri2ndOrder.CoeffA9, Tri2ndOrder.CoeffA10, Tri2ndOrder.CoeffA11, Tri2ndOrder.CoeffA12, Tri2ndOrder.CoeffA13, Tri2ndOrder.CoeffA14, Tri2ndOrder.CoeffA15, Tri2ndOrder.CoeffA16, Tri2ndOrder.CoeffA17, Tri2ndOrder.CoeffA18, Tri2ndOrder.CoeffA19, Tri2ndOrder.CoeffA20, Tri2ndOrder.CoeffA21, Tri2ndOrder.CoeffA22, Tri2ndOrder.CoeffA23, Tri2ndOrder.CoeffA24, Tri2ndOrder.CoeffA25, Tri2ndOrder.CoeffA26 };
+			std::copy( TriCoeffs, TriCoeffs + 27, Coeffs.Coeff );
+			Curve.Evaluator = CurveFormValue< TriQuadraticCurveForm >;
+		} else if ( SELECT_CASE_var == Exponent ) {
+			Curve.Evaluator = CurveFormValue< ExponentCurveForm >;
+		} else if ( SELECT_CASE_var == FanPressureRise ) {
+			Curve.Evaluator = CurveFormValue< FanPressureRiseCurveForm >;
+		} else if ( SELECT_CASE_var == ExponentialSkewNormal ) {
+			Curve.Evaluator = CurveFormValue< ExponentialSkewNormalCurveForm >;
+		} else if ( SELECT_CASE_var == Sigmoid ) {
+			Curve.Evaluator = CurveFormValue< SigmoidCurveForm >;
+		} else if ( SELECT_CASE_var == RectangularHyperbola1 ) {
+			Curve.Evaluator = CurveFormValue< RectangularHyperbola1CurveForm >;
+		} else if ( SELECT_CASE_var == RectangularHyperbola2 ) {
+			Curve.Evaluator = CurveFormValue< RectangularHyperbola2CurveForm >;
+		} else if ( SELECT_CASE_var == ExponentialDecay ) {
+			Curve.Evaluator = CurveFormValue< ExponentialDecayCurveForm >;
+		} else if ( SELECT_CASE_var == DoubleExponentialDecay ) {
+			Curve.Evaluator = CurveFormValue< DoubleExponentialDecayCurveForm >;
+		}}
+
+	}
+
 	Real64
 	PerformanceTableObject(
 		int const CurveIndex, // index of curve in curve array
@@ -3905,13 +4195,13 @@ Label999: ;
 		int NV5;
 		int TableIndex;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:)     :: ONEDVALS
-		Array2D< Real64 > TWODVALS;
-		Array3D< Real64 > THREEDVALS;
-		Array1D< Real64 > VALSX;
-		Array1D< Real64 > VALSY;
-		Array1D< Real64 > VALSV3;
-		Array1D< Real64 > VALSV4;
-		Array1D< Real64 > VALSV5;
+		static Array2D< Real64 > TWODVALS; // Interpolated values at the points of the variables after V2 (only those used are set)
+		static Array3D< Real64 > THREEDVALS;
+		TableAxisStencil XStencil; // Points of each axis used (searched once per call)
+		TableAxisStencil YStencil;
+		TableAxisStencil V3Stencil;
+		TableAxisStencil V4Stencil;
+		TableAxisStencil V5Stencil;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:) :: HPVAL
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:) :: HPVALS
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:,:) :: DVLTRN
@@ -4014,120 +4304,84 @@ Label999: ;
 			V5 = 0.0;
 		}
 
-		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
+		auto & Table( TableLookup( TableIndex ) );
+		{ auto const SELECT_CASE_var( Table.NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
+			NX = Table.NumX1Vars;
 			NY = 1;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			TableValue = DLAG( V1, VALSX( 1 ), VALSX, VALSX, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
+			NUMPT = Table.InterpolationOrder;
+			TableValue = DLAG( V1, Table.X1Var( 1 ), Table.X1Var, Table.X1Var, Table.TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 2 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			TableValue = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
-			VALSY.deallocate();
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NUMPT = Table.InterpolationOrder;
+			TableValue = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 3 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			TWODVALS.allocate( 1, NV3 );
-			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
-			for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-				TWODVALS( 1, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, 1, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NUMPT = Table.InterpolationOrder;
+			FindTableAxisStencil( V1, Table.X1Var, NX, NUMPT, XStencil );
+			FindTableAxisStencil( V2, Table.X2Var, NY, NUMPT, YStencil );
+			FindTableAxisStencil( V3, Table.X3Var, NV3, NUMPT, V3Stencil );
+			TWODVALS.dimension( 1, NV3, 0.0 );
+			// perform 2-D interpolation of X (V1) and Y (V2) at the points of V3 used below and save in 2-D array
+			for ( IV3 = V3Stencil.Lo; IV3 <= V3Stencil.Hi; ++IV3 ) {
+				TWODVALS( 1, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, 1, IV3, _, _ ), XStencil, YStencil );
 			}
 			if ( NV3 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V3, 1.0, VALSV3, VALSV3, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
+				TableValue = DLAG( V3, 1.0, Table.X3Var, Table.X3Var, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
 			}
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
 		} else if ( SELECT_CASE_var == 4 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			TWODVALS.allocate( NV4, NV3 );
-			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
-			for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
-				for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-					TWODVALS( IV4, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NV4 = Table.NumX4Vars;
+			NUMPT = Table.InterpolationOrder;
+			FindTableAxisStencil( V1, Table.X1Var, NX, NUMPT, XStencil );
+			FindTableAxisStencil( V2, Table.X2Var, NY, NUMPT, YStencil );
+			FindTableAxisStencil( V3, Table.X3Var, NV3, NUMPT, V3Stencil );
+			FindTableAxisStencil( V4, Table.X4Var, NV4, NUMPT, V4Stencil );
+			TWODVALS.dimension( NV4, NV3, 0.0 );
+			// perform 2-D interpolation of X (V1) and Y (V2) at the points of V3 and V4 used below and save in 2-D array
+			for ( IV4 = V4Stencil.Lo; IV4 <= V4Stencil.Hi; ++IV4 ) {
+				for ( IV3 = V3Stencil.Lo; IV3 <= V3Stencil.Hi; ++IV3 ) {
+					TWODVALS( IV4, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, IV4, IV3, _, _ ), XStencil, YStencil );
 				}
 			}
 			// final interpolation of 2-D array in V3 and V4
-			TableValue = DLAG( V3, V4, VALSV3, VALSV4, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
+			TableValue = DLAG( V3, V4, Table.X3Var, Table.X4Var, TWODVALS, V3Stencil, V4Stencil );
 		} else if ( SELECT_CASE_var == 5 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NV5 = TableLookup( TableIndex ).NumX5Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			VALSV5.allocate( NV5 );
-			VALSV5 = TableLookup( TableIndex ).X5Var;
-			THREEDVALS.allocate( NV5, NV4, NV3 );
-			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
-				for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
-					for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-						THREEDVALS( IV5, IV4, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( IV5, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NV4 = Table.NumX4Vars;
+			NV5 = Table.NumX5Vars;
+			NUMPT = Table.InterpolationOrder;
+			FindTableAxisStencil( V1, Table.X1Var, NX, NUMPT, XStencil );
+			FindTableAxisStencil( V2, Table.X2Var, NY, NUMPT, YStencil );
+			FindTableAxisStencil( V3, Table.X3Var, NV3, NUMPT, V3Stencil );
+			FindTableAxisStencil( V4, Table.X4Var, NV4, NUMPT, V4Stencil );
+			FindTableAxisStencil( V5, Table.X5Var, NV5, NUMPT, V5Stencil );
+			THREEDVALS.dimension( NV5, NV4, NV3, 0.0 );
+			for ( IV5 = V5Stencil.Lo; IV5 <= V5Stencil.Hi; ++IV5 ) {
+				for ( IV4 = V4Stencil.Lo; IV4 <= V4Stencil.Hi; ++IV4 ) {
+					for ( IV3 = V3Stencil.Lo; IV3 <= V3Stencil.Hi; ++IV3 ) {
+						THREEDVALS( IV5, IV4, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( IV5, IV4, IV3, _, _ ), XStencil, YStencil );
 					}
 				}
 			}
-			TWODVALS.allocate( 1, NV5 );
-			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
-				TWODVALS( 1, IV5 ) = DLAG( V3, V4, VALSV3, VALSV4, THREEDVALS( IV5, _, _ ), NV3, NV4, NUMPT, IEXTX, IEXTY );
+			TWODVALS.dimension( 1, NV5, 0.0 );
+			for ( IV5 = V5Stencil.Lo; IV5 <= V5Stencil.Hi; ++IV5 ) {
+				TWODVALS( 1, IV5 ) = DLAG( V3, V4, Table.X3Var, Table.X4Var, THREEDVALS( IV5, _, _ ), V3Stencil, V4Stencil );
 			}
 			if ( NV5 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V5, 1.0, VALSV5, VALSV5, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
-			}
-			TWODVALS.deallocate();
-			THREEDVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
-			VALSV5.deallocate();
+				TableValue = DLAG( V5, 1.0, Table.X5Var, Table.X5Var, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
+			}
 		} else {
 			TableValue = 0.0;
 			ShowSevereError( "Errors found in table output calculation for " + PerfCurve( CurveIndex ).Name );
@@ -5267,6 +5521,8 @@ Label999: ;
 				PerfCurve( CurveIndex ).CurveMaxPresent = true;
 			}
 
+			BindCurveEvaluator( CurveIndex );
+
 		} else {
 
 			ShowSevereError( "SetCurveOutputMinMaxValues: CurveIndex=[" + TrimSigDigits( CurveIndex ) + "] not in range of curves=[1:" + TrimSigDigits( NumCurves ) + "]." );
@@ -5634,6 +5890,8 @@ Label999: ;
 		std::string RR;
 		std::string Re;
 		static bool FrictionFactorErrorHasOccurred( false );
+		static EP_THREAD_LOCAL Real64 RoughnessRatioSave( -1.0 ); // Roughness ratio of the last Term1 calculated
+		static EP_THREAD_LOCAL Real64 Term1Save( 0.0 ); // Roughness term of RoughnessRatioSave
 
 		//Check for no flow before calculating values
 		if ( ReynoldsNumber == 0.0 ) {
@@ -5648,7 +5906,12 @@ Label999: ;
 		}
 
 		//Calculate the friction factor
-		Term1 = std::pow( RoughnessRatio / 3.7, 1.11 );
+		// The roughness term is fixed for a pipe, so keep the last one, as the psychrometric functions do
+		if ( RoughnessRatio != RoughnessRatioSave ) {
+			Term1Save = std::pow( RoughnessRatio / 3.7, 1.11 );
+			RoughnessRatioSave = RoughnessRatio;
+		}
+		Term1 = Term1Save;
 		Term2 = 6.9 / ReynoldsNumber;
 		Term3 = -1.8 * std::log10( Term1 + Term2 );
 		if ( Term3 != 0.0 ) {
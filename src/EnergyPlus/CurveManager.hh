@@ -46,6 +46,7 @@ namespace CurveManager {
 	extern int const QuadLinear;
 	extern int const CubicLinear;
 	extern int const ChillerPartLoadCustom;
+	extern int const ChillerPartLoadWithLift;
 
 	// Interpolation Types
 	extern int const LinearInterpolationOfTable;
@@ -276,6 +277,24 @@ namespace CurveManager {
 
 	};
 
+	struct CurveCoeffData
+	{
+		// Coefficients and limits of a curve packed for its bound evaluator
+
+		// Members
+		Real64 Coeff[ 27 ]; // Coeff1 to Coeff12, or CoeffA0 to CoeffA26 of a triquadratic
+		Real64 VarMin[ 4 ]; // Limits of the independent variables 1 to 4
+		Real64 VarMax[ 4 ];
+		Real64 CurveMin; // Limits of the curve output
+		Real64 CurveMax;
+		bool CurveMinPresent;
+		bool CurveMaxPresent;
+
+	};
+
+	// Curve form evaluator: independent variables already limited, output limits applied
+	typedef Real64 ( *CurveEvaluator )( CurveCoeffData const & Data, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const V4 );
+
 	struct PerfomanceCurveData
 	{
 		// Members
@@ -319,6 +338,8 @@ namespace CurveManager {
 		Array1D< TriQuadraticCurveDataStruct > Tri2ndOrder; // structure for triquadratic curve data
 		bool EMSOverrideOn; // if TRUE, then EMS is calling to override curve value
 		Real64 EMSOverrideCurveValue; // Value of curve result EMS is directing to use
+		CurveCoeffData Coeffs; // Copy of the coefficients and limits read by Evaluator
+		CurveEvaluator Evaluator; // Evaluator of the curve form (null: evaluated by type in CurveValue)
 		// report variables
 		Real64 CurveOutput; // curve output or result
 		Real64 CurveInput1; // curve input #1 (e.g., x or X1 variable)
@@ -367,6 +388,8 @@ namespace CurveManager {
 			CurveMaxPresent( false ),
 			EMSOverrideOn( false ),
 			EMSOverrideCurveValue( 0.0 ),
+			Coeffs(),
+			Evaluator( nullptr ),
 			CurveOutput( 0.0 ),
 			CurveInput1( 0.0 ),
 			CurveInput2( 0.0 ),
@@ -464,6 +487,8 @@ namespace CurveManager {
 			Tri2ndOrder( Tri2ndOrder ),
 			EMSOverrideOn( EMSOverrideOn ),
 			EMSOverrideCurveValue( EMSOverrideCurveValue ),
+			Coeffs(),
+			Evaluator( nullptr ),
 			CurveOutput( CurveOutput ),
 			CurveInput1( CurveInput1 ),
 			CurveInput2( CurveInput2 ),
@@ -535,6 +560,26 @@ namespace CurveManager {
 
 	};
 
+	struct TableAxisStencil
+	{
+		// Points of a table axis DLAG interpolates between for one value of the variable
+
+		// Members
+		int Lo; // First point used
+		int Hi; // Last point used
+		bool Exact; // Value equals point Lo (= Hi), which is used without interpolation
+		int Extrap; // 1 extrapolation above the axis, 0 interpolation, -1 extrapolation below
+
+		// Default Constructor
+		TableAxisStencil() :
+			Lo( 0 ),
+			Hi( 0 ),
+			Exact( false ),
+			Extrap( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< PerfomanceCurveData > PerfCurve;
 	extern Array1D< PerfCurveTableDataStruct > PerfCurveTableData;
@@ -564,6 +609,9 @@ namespace CurveManager {
 	void
 	InitCurveReporting();
 
+	void
+	BindCurveEvaluator( int const CurveIndex ); // index of curve in curve array
+
 	void
 	ReadTableData(
 		int const CurveNum,
@@ -590,6 +638,26 @@ namespace CurveManager {
 		int & IEXTY
 	);
 
+	void
+	FindTableAxisStencil(
+		Real64 const XX, // Value of the independent variable
+		Array1S< Real64 > X, // Points of the axis
+		int const NX, // Number of points of the axis
+		int const M, // Number of points to interpolate between
+		TableAxisStencil & Stencil
+	);
+
+	Real64
+	DLAG(
+		Real64 const XX,
+		Real64 const YY,
+		Array1S< Real64 > X,
+		Array1S< Real64 > Y,
+		Array2S< Real64 > Z,
+		TableAxisStencil const & XStencil, // Points of X used for XX
+		TableAxisStencil const & YStencil // Points of Y used for YY
+	);
+
 	Real64
 	PerformanceCurveObject(
 		int const CurveIndex, // index of curve in curve array
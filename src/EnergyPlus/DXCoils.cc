@@ -22,6 +22,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataWater.hh>
 #include <DataZoneEquipment.hh>
 #include <EMSManager.hh>
@@ -207,6 +208,7 @@ namespace DXCoils {
 	// Object Data
 	Array1D< DXCoilData > DXCoil;
 	Array1D< DXCoilNumericFieldData > DXCoilNumericFields;
+	Array2D< DXCoilSolutionData > DXCoilSolution; // Last full load solution (Mode,DXCoilNum)
 
 	// Functions
 
@@ -990,6 +992,7 @@ namespace DXCoils {
 		// Derived types
 		DXCoil.allocate( NumDXCoils );
 		DXCoilNumericFields.allocate( NumDXCoils );
+		DXCoilSolution.allocate( MaxModes, NumDXCoils );
 		HeatReclaimDXCoil.allocate( NumDXCoils );
 		CheckEquipName.dimension( NumDXCoils, true );
 
@@ -6726,6 +6729,7 @@ namespace DXCoils {
 		using General::CreateSysTimeIntervalString;
 		using DataWater::WaterStorage;	
 		using DataHeatBalance::Zone;
+		using DataSystemVariables::DXCoilSolutionReuse;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -7054,7 +7058,22 @@ namespace DXCoils {
 			//  InletAirHumRat may be modified in this ADP/BF loop, use temporary varible for calculations
 			InletAirHumRatTemp = InletAirHumRat;
 			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
-			while ( true ) {
+
+			// The full load solution depends only on the conditions below, so parent objects solving
+			// for a part load ratio at unchanged inlet conditions can take it from their last call
+			auto & Solution( DXCoilSolution( Mode, DXCoilNum ) );
+			bool const SolutionReusable( DXCoilSolutionReuse && DXCoilSolutionReusable( DXCoilNum, Mode ) );
+			bool SolutionReused( false );
+			bool CurveOutputNegative( false ); // Keep the negative curve warnings and their counts
+			if ( SolutionReusable && Solution.Valid && Solution.InletAirDryBulbTemp == InletAirDryBulbTemp && Solution.InletAirHumRat == InletAirHumRat && Solution.InletAirEnthalpy == InletAirEnthalpy && Solution.OutdoorPressure == OutdoorPressure && Solution.CondInletTemp == CondInletTemp && Solution.RatedTotCap == DXCoil( DXCoilNum ).RatedTotCap( Mode ) && std::abs( Solution.AirMassFlow - AirMassFlow ) <= 1.0e-10 * AirMassFlow && std::abs( Solution.CBF - CBF ) <= 1.0e-10 ) {
+				TotCap = Solution.TotCap;
+				SHR = Solution.SHR;
+				hDelta = Solution.hDelta;
+				InletAirWetBulbC = Solution.InletAirWetBulbC;
+				Counter = Solution.Counter;
+				SolutionReused = true;
+			}
+			while ( ! SolutionReused ) {
 				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
 					// Coil:DX:HeatPumpWaterHeater does not have total cooling capacity as a function of temp or flow curve
 					TotCapTempModFac = 1.0;
@@ -7083,6 +7102,7 @@ namespace DXCoils {
 						}
 						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFTempErrorIndex, TotCapTempModFac, TotCapTempModFac );
 						TotCapTempModFac = 0.0;
+						CurveOutputNegative = true;
 					}
 
 					//    Get total capacity modifying factor (function of mass flow) for off-rated conditions
@@ -7100,6 +7120,7 @@ namespace DXCoils {
 						}
 						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFFlowErrorIndex, TotCapFlowModFac, TotCapFlowModFac );
 						TotCapFlowModFac = 0.0;
+						CurveOutputNegative = true;
 					}
 				}
 				TotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode ) * TotCapFlowModFac * TotCapTempModFac;
@@ -7142,6 +7163,23 @@ namespace DXCoils {
 				}
 			} // end of DO iteration loop
 
+			if ( SolutionReusable && ! SolutionReused ) {
+				Solution.Valid = ! CurveOutputNegative;
+				Solution.InletAirDryBulbTemp = InletAirDryBulbTemp;
+				Solution.InletAirHumRat = InletAirHumRat;
+				Solution.InletAirEnthalpy = InletAirEnthalpy;
+				Solution.OutdoorPressure = OutdoorPressure;
+				Solution.CondInletTemp = CondInletTemp;
+				Solution.AirMassFlow = AirMassFlow;
+				Solution.CBF = CBF;
+				Solution.RatedTotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode );
+				Solution.TotCap = TotCap;
+				Solution.SHR = SHR;
+				Solution.hDelta = hDelta;
+				Solution.InletAirWetBulbC = InletAirWetBulbC;
+				Solution.Counter = Counter;
+			}
+
 			if ( DXCoil( DXCoilNum ).PLFFPLR( Mode ) > 0 ) {
 				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), PartLoadRatio ); // Calculate part-load factor
 			} else {
@@ -7531,6 +7569,37 @@ namespace DXCoils {
 
 	}
 
+	bool
+	DXCoilSolutionReusable(
+		int const DXCoilNum, // the number of the DX coil
+		int const Mode // performance mode
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Tells whether the full load solution of CalcDoe2DXCoil for the coil and mode may be kept
+		// for later calls at the same conditions.
+
+		// METHODOLOGY EMPLOYED:
+		// The capacity and SHR curves must not be overridden by EMS and must be evaluated by their
+		// bound evaluator, which gives no warnings of its own.
+
+		// Using/Aliasing
+		using CurveManager::PerfCurve;
+
+		auto const & coil( DXCoil( DXCoilNum ) );
+		if ( coil.DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) return true;
+		int const NumCurves( coil.UserSHRCurveExists ? 4 : 2 );
+		int const Curves[ 4 ] = { coil.CCapFTemp( Mode ), coil.CCapFFlow( Mode ), coil.SHRFTemp( Mode ), coil.SHRFFlow( Mode ) };
+		for ( int i = 0; i < NumCurves; ++i ) {
+			if ( Curves[ i ] <= 0 ) return false;
+			if ( PerfCurve( Curves[ i ] ).EMSOverrideOn || PerfCurve( Curves[ i ] ).Evaluator == nullptr ) return false;
+		}
+		return true;
+
+	}
+
+
 	void
 	CalcVRFCoolingCoil(
 		int const DXCoilNum, // the number of the DX coil to be simulated
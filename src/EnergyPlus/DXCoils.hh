@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -1223,9 +1224,51 @@ namespace DXCoils {
 		{}
 	};
 
+	struct DXCoilSolutionData
+	{
+		// Full load total capacity and SHR found by the ADP/BF iteration of CalcDoe2DXCoil for
+		// one coil and performance mode, with the conditions they were found for.
+
+		// Members
+		bool Valid; // True once a solution is held
+		Real64 InletAirDryBulbTemp; // Conditions of the solution
+		Real64 InletAirHumRat;
+		Real64 InletAirEnthalpy;
+		Real64 OutdoorPressure;
+		Real64 CondInletTemp;
+		Real64 AirMassFlow;
+		Real64 CBF;
+		Real64 RatedTotCap;
+		Real64 TotCap; // Gross total capacity [W]
+		Real64 SHR; // Sensible heat ratio
+		Real64 hDelta; // Enthalpy difference across the coil at full load [J/kg]
+		Real64 InletAirWetBulbC; // Inlet wet-bulb at the end of the dry coil iteration [C]
+		int Counter; // Dry coil iterations
+
+		// Default Constructor
+		DXCoilSolutionData() :
+			Valid( false ),
+			InletAirDryBulbTemp( 0.0 ),
+			InletAirHumRat( 0.0 ),
+			InletAirEnthalpy( 0.0 ),
+			OutdoorPressure( 0.0 ),
+			CondInletTemp( 0.0 ),
+			AirMassFlow( 0.0 ),
+			CBF( 0.0 ),
+			RatedTotCap( 0.0 ),
+			TotCap( 0.0 ),
+			SHR( 0.0 ),
+			hDelta( 0.0 ),
+			InletAirWetBulbC( 0.0 ),
+			Counter( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< DXCoilData > DXCoil;
 	extern Array1D< DXCoilNumericFieldData > DXCoilNumericFields;
+	extern Array2D< DXCoilSolutionData > DXCoilSolution; // Last full load solution (Mode,DXCoilNum)
 
 	// Functions
 
@@ -1292,6 +1335,12 @@ namespace DXCoils {
 		Optional< Real64 const > CoolingHeatingPLR = _ // used for cycling fan RH control
 	);
 
+	bool
+	DXCoilSolutionReusable(
+		int const DXCoilNum, // the number of the DX coil
+		int const Mode // performance mode
+	);
+
 	void
 	CalcVRFCoolingCoil(
 		int const DXCoilNum, // the number of the DX coil to be simulated
@@ -52,6 +52,12 @@ namespace DataBranchNodeConnections {
 	Array1D< NodeConnectionDef > NodeConnections;
 	Array1D< EqNodeConnectionDef > AirTerminalNodeConnections;
 
+	// Indexes kept up to date as node connections and component sets are registered
+	std::unordered_map< int, std::vector< int > > NodeConnectionsOfNode; // Node connections of each node number, in registration order
+	std::unordered_map< std::string, int > FirstNodeConnectionOfObject; // First node connection of each object, by "OBJECTTYPE,ObjectName"
+	std::unordered_map< std::string, int > NumCompSetsOfParent; // Component sets of each parent, by "PARENTTYPE,ParentName"
+	std::unordered_map< std::string, int > AirTerminalNodeOfName; // Air terminal node connection of each node name
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
@@ -1,6 +1,11 @@
 #ifndef DataBranchNodeConnections_hh_INCLUDED
 #define DataBranchNodeConnections_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -183,6 +188,12 @@ namespace DataBranchNodeConnections {
 	extern Array1D< NodeConnectionDef > NodeConnections;
 	extern Array1D< EqNodeConnectionDef > AirTerminalNodeConnections;
 
+	// Indexes kept up to date as node connections and component sets are registered
+	extern std::unordered_map< int, std::vector< int > > NodeConnectionsOfNode; // Node connections of each node number, in registration order
+	extern std::unordered_map< std::string, int > FirstNodeConnectionOfObject; // First node connection of each object, by "OBJECTTYPE,ObjectName"
+	extern std::unordered_map< std::string, int > NumCompSetsOfParent; // Component sets of each parent, by "PARENTTYPE,ParentName"
+	extern std::unordered_map< std::string, int > AirTerminalNodeOfName; // Air terminal node connection of each node name
+
 } // DataBranchNodeConnections
 
 } // EnergyPlus
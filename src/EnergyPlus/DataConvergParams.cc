@@ -94,6 +94,29 @@ namespace DataConvergParams {
 	Array1D< HVACAirLoopIterationConvergenceStruct > AirLoopConvergence;
 	Array1D< PlantIterationConvergenceStruct > PlantConvergence;
 
+	// Functions
+
+	Real64
+	ConvergLogStackData::sum() const
+	{
+		// Summed most recent first, as the shifted stacks were
+		Real64 Sum( 0.0 );
+		for ( int StackDepth = 1; StackDepth <= ConvergLogStackDepth; ++StackDepth ) {
+			Sum += ( *this )( StackDepth );
+		}
+		return Sum;
+	}
+
+	Real64
+	ConvergLogStackData::weighted_sum( Array1< Real64 > const & Weights ) const
+	{
+		Real64 Sum( 0.0 );
+		for ( int StackDepth = 1; StackDepth <= ConvergLogStackDepth; ++StackDepth ) {
+			Sum += Weights( StackDepth ) * ( *this )( StackDepth );
+		}
+		return Sum;
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
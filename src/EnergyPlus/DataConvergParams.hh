@@ -88,6 +88,55 @@ namespace DataConvergParams {
 
 	// Types
 
+	struct ConvergLogStackData
+	{
+		// Members
+		Array1D< Real64 > Values; // Ring of the last ConvergLogStackDepth results
+		int Newest; // Slot in Values of the most recent result
+
+		// Default Constructor
+		ConvergLogStackData() :
+			Values( ConvergLogStackDepth, 0.0 ),
+			Newest( 1 )
+		{}
+
+		// Member Constructor
+		explicit
+		ConvergLogStackData(
+			Array1< Real64 > const & History // Results, most recent first
+		) :
+			Values( ConvergLogStackDepth, History ),
+			Newest( 1 )
+		{}
+
+		// Record a result as the most recent one, dropping the oldest
+		inline
+		void
+		push( Real64 const Value )
+		{
+			Newest = ( Newest == 1 ? ConvergLogStackDepth : Newest - 1 );
+			Values( Newest ) = Value;
+		}
+
+		// Result StackDepth results back, 1 being the most recent
+		inline
+		Real64
+		operator ()( int const StackDepth ) const
+		{
+			int const Slot( Newest + StackDepth - 1 );
+			return Values( Slot > ConvergLogStackDepth ? Slot - ConvergLogStackDepth : Slot );
+		}
+
+		// Sum of the results, most recent first
+		Real64
+		sum() const;
+
+		// Sum of the results times Weights( StackDepth ), most recent first
+		Real64
+		weighted_sum( Array1< Real64 > const & Weights ) const;
+
+	};
+
 	struct HVACNodeConvergLogStruct
 	{
 		// Members
@@ -95,15 +144,12 @@ namespace DataConvergParams {
 		bool NotConvergedHumRate;
 		bool NotConvergedMassFlow;
 		bool NotConvergedTemp;
-		Array1D< Real64 > HumidityRatio;
-		Array1D< Real64 > MassFlowRate;
-		Array1D< Real64 > Temperature;
+		ConvergLogStackData HumidityRatio;
+		ConvergLogStackData MassFlowRate;
+		ConvergLogStackData Temperature;
 
 		// Default Constructor
-		HVACNodeConvergLogStruct() :
-			HumidityRatio( ConvergLogStackDepth ),
-			MassFlowRate( ConvergLogStackDepth ),
-			Temperature( ConvergLogStackDepth )
+		HVACNodeConvergLogStruct()
 		{}
 
 		// Member Constructor
@@ -120,9 +166,9 @@ namespace DataConvergParams {
 			NotConvergedHumRate( NotConvergedHumRate ),
 			NotConvergedMassFlow( NotConvergedMassFlow ),
 			NotConvergedTemp( NotConvergedTemp ),
-			HumidityRatio( ConvergLogStackDepth, HumidityRatio ),
-			MassFlowRate( ConvergLogStackDepth, MassFlowRate ),
-			Temperature( ConvergLogStackDepth, Temperature )
+			HumidityRatio( HumidityRatio ),
+			MassFlowRate( MassFlowRate ),
+			Temperature( Temperature )
 		{}
 
 	};
@@ -156,64 +202,43 @@ namespace DataConvergParams {
 	{
 		// Members
 		Array1D_bool HVACMassFlowNotConverged; // Flag to show mass flow convergence
-		Array1D< Real64 > HVACFlowDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACFlowSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACFlowSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACFlowDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACFlowSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACFlowSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
 		Array1D_bool HVACHumRatNotConverged; // Flag to show humidity ratio convergence   or failure
-		Array1D< Real64 > HVACHumDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACHumSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACHumSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACHumDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACHumSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACHumSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
 		Array1D_bool HVACTempNotConverged; // Flag to show temperature convergence  or failure
-		Array1D< Real64 > HVACTempDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACTempSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACTempSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACTempDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACTempSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACTempSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
 		Array1D_bool HVACEnergyNotConverged; // Flag to show energy convergence   or failure
-		Array1D< Real64 > HVACEnergyDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACEnergySupplyDeck1ToDemandTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACEnergySupplyDeck2ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACEnergyDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACEnergySupplyDeck1ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACEnergySupplyDeck2ToDemandTolValue; // Queue of convergence "results"
 		Array1D_bool HVACEnthalpyNotConverged; // Flag to show energy convergence   or failure
-		Array1D< Real64 > HVACEnthalpyDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACEnthalpySupplyDeck1ToDemandTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACEnthalpySupplyDeck2ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACEnthalpyDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACEnthalpySupplyDeck1ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACEnthalpySupplyDeck2ToDemandTolValue; // Queue of convergence "results"
 		Array1D_bool HVACPressureNotConverged; // Flag to show energy convergence   or failure
-		Array1D< Real64 > HVACPressureDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACPressureSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACPressueSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACPressureDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACPressureSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACPressueSupplyDeck2ToDemandTolValue; // Queue of convergence "results"
 		Array1D_bool HVACQualityNotConverged; // Flag to show energy convergence   or failure
-		Array1D< Real64 > HVACQualityDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACQualitSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
-		Array1D< Real64 > HVACQualitySupplyDeck2ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACQualityDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACQualitSupplyDeck1ToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData HVACQualitySupplyDeck2ToDemandTolValue; // Queue of convergence "results"
 
 		// Default Constructor
 		HVACAirLoopIterationConvergenceStruct() :
 			HVACMassFlowNotConverged( 3, false ),
-			HVACFlowDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACFlowSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACFlowSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
 			HVACHumRatNotConverged( 3, false ),
-			HVACHumDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACHumSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACHumSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
 			HVACTempNotConverged( 3, false ),
-			HVACTempDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACTempSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACTempSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
 			HVACEnergyNotConverged( 3, false ),
-			HVACEnergyDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACEnergySupplyDeck1ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACEnergySupplyDeck2ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
 			HVACEnthalpyNotConverged( 3, false ),
-			HVACEnthalpyDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACEnthalpySupplyDeck1ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACEnthalpySupplyDeck2ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
 			HVACPressureNotConverged( 3, false ),
-			HVACPressureDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACPressureSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACPressueSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACQualityNotConverged( 3, false ),
-			HVACQualityDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACQualitSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			HVACQualitySupplyDeck2ToDemandTolValue( ConvergLogStackDepth, 0.0 )
+			HVACQualityNotConverged( 3, false )
 		{}
 
 		// Member Constructor
@@ -248,33 +273,33 @@ namespace DataConvergParams {
 			Array1< Real64 > const & HVACQualitySupplyDeck2ToDemandTolValue // Queue of convergence "results"
 		) :
 			HVACMassFlowNotConverged( 3, HVACMassFlowNotConverged ),
-			HVACFlowDemandToSupplyTolValue( ConvergLogStackDepth, HVACFlowDemandToSupplyTolValue ),
-			HVACFlowSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, HVACFlowSupplyDeck1ToDemandTolValue ),
-			HVACFlowSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, HVACFlowSupplyDeck2ToDemandTolValue ),
+			HVACFlowDemandToSupplyTolValue( HVACFlowDemandToSupplyTolValue ),
+			HVACFlowSupplyDeck1ToDemandTolValue( HVACFlowSupplyDeck1ToDemandTolValue ),
+			HVACFlowSupplyDeck2ToDemandTolValue( HVACFlowSupplyDeck2ToDemandTolValue ),
 			HVACHumRatNotConverged( 3, HVACHumRatNotConverged ),
-			HVACHumDemandToSupplyTolValue( ConvergLogStackDepth, HVACHumDemandToSupplyTolValue ),
-			HVACHumSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, HVACHumSupplyDeck1ToDemandTolValue ),
-			HVACHumSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, HVACHumSupplyDeck2ToDemandTolValue ),
+			HVACHumDemandToSupplyTolValue( HVACHumDemandToSupplyTolValue ),
+			HVACHumSupplyDeck1ToDemandTolValue( HVACHumSupplyDeck1ToDemandTolValue ),
+			HVACHumSupplyDeck2ToDemandTolValue( HVACHumSupplyDeck2ToDemandTolValue ),
 			HVACTempNotConverged( 3, HVACTempNotConverged ),
-			HVACTempDemandToSupplyTolValue( ConvergLogStackDepth, HVACTempDemandToSupplyTolValue ),
-			HVACTempSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, HVACTempSupplyDeck1ToDemandTolValue ),
-			HVACTempSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, HVACTempSupplyDeck2ToDemandTolValue ),
+			HVACTempDemandToSupplyTolValue( HVACTempDemandToSupplyTolValue ),
+			HVACTempSupplyDeck1ToDemandTolValue( HVACTempSupplyDeck1ToDemandTolValue ),
+			HVACTempSupplyDeck2ToDemandTolValue( HVACTempSupplyDeck2ToDemandTolValue ),
 			HVACEnergyNotConverged( 3, HVACEnergyNotConverged ),
-			HVACEnergyDemandToSupplyTolValue( ConvergLogStackDepth, HVACEnergyDemandToSupplyTolValue ),
-			HVACEnergySupplyDeck1ToDemandTolValue( ConvergLogStackDepth, HVACEnergySupplyDeck1ToDemandTolValue ),
-			HVACEnergySupplyDeck2ToDemandTolValue( ConvergLogStackDepth, HVACEnergySupplyDeck2ToDemandTolValue ),
+			HVACEnergyDemandToSupplyTolValue( HVACEnergyDemandToSupplyTolValue ),
+			HVACEnergySupplyDeck1ToDemandTolValue( HVACEnergySupplyDeck1ToDemandTolValue ),
+			HVACEnergySupplyDeck2ToDemandTolValue( HVACEnergySupplyDeck2ToDemandTolValue ),
 			HVACEnthalpyNotConverged( 3, HVACEnthalpyNotConverged ),
-			HVACEnthalpyDemandToSupplyTolValue( ConvergLogStackDepth, HVACEnthalpyDemandToSupplyTolValue ),
-			HVACEnthalpySupplyDeck1ToDemandTolValue( ConvergLogStackDepth, HVACEnthalpySupplyDeck1ToDemandTolValue ),
-			HVACEnthalpySupplyDeck2ToDemandTolValue( ConvergLogStackDepth, HVACEnthalpySupplyDeck2ToDemandTolValue ),
+			HVACEnthalpyDemandToSupplyTolValue( HVACEnthalpyDemandToSupplyTolValue ),
+			HVACEnthalpySupplyDeck1ToDemandTolValue( HVACEnthalpySupplyDeck1ToDemandTolValue ),
+			HVACEnthalpySupplyDeck2ToDemandTolValue( HVACEnthalpySupplyDeck2ToDemandTolValue ),
 			HVACPressureNotConverged( 3, HVACPressureNotConverged ),
-			HVACPressureDemandToSupplyTolValue( ConvergLogStackDepth, HVACPressureDemandToSupplyTolValue ),
-			HVACPressureSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, HVACPressureSupplyDeck1ToDemandTolValue ),
-			HVACPressueSupplyDeck2ToDemandTolValue( ConvergLogStackDepth, HVACPressueSupplyDeck2ToDemandTolValue ),
+			HVACPressureDemandToSupplyTolValue( HVACPressureDemandToSupplyTolValue ),
+			HVACPressureSupplyDeck1ToDemandTolValue( HVACPressureSupplyDeck1ToDemandTolValue ),
+			HVACPressueSupplyDeck2ToDemandTolValue( HVACPressueSupplyDeck2ToDemandTolValue ),
 			HVACQualityNotConverged( 3, HVACQualityNotConverged ),
-			HVACQualityDemandToSupplyTolValue( ConvergLogStackDepth, HVACQualityDemandToSupplyTolValue ),
-			HVACQualitSupplyDeck1ToDemandTolValue( ConvergLogStackDepth, HVACQualitSupplyDeck1ToDemandTolValue ),
-			HVACQualitySupplyDeck2ToDemandTolValue( ConvergLogStackDepth, HVACQualitySupplyDeck2ToDemandTolValue )
+			HVACQualityDemandToSupplyTolValue( HVACQualityDemandToSupplyTolValue ),
+			HVACQualitSupplyDeck1ToDemandTolValue( HVACQualitSupplyDeck1ToDemandTolValue ),
+			HVACQualitySupplyDeck2ToDemandTolValue( HVACQualitySupplyDeck2ToDemandTolValue )
 		{}
 
 	};
@@ -283,20 +308,16 @@ namespace DataConvergParams {
 	{
 		// Members
 		bool PlantMassFlowNotConverged; // Flag to show mass flow convergence
-		Array1D< Real64 > PlantFlowDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > PlantFlowSupplyToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData PlantFlowDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData PlantFlowSupplyToDemandTolValue; // Queue of convergence "results"
 		bool PlantTempNotConverged; // Flag to show temperature convergence (0) or failure (1)
-		Array1D< Real64 > PlantTempDemandToSupplyTolValue; // Queue of convergence "results"
-		Array1D< Real64 > PlantTempSupplyToDemandTolValue; // Queue of convergence "results"
+		ConvergLogStackData PlantTempDemandToSupplyTolValue; // Queue of convergence "results"
+		ConvergLogStackData PlantTempSupplyToDemandTolValue; // Queue of convergence "results"
 
 		// Default Constructor
 		PlantIterationConvergenceStruct() :
 			PlantMassFlowNotConverged( false ),
-			PlantFlowDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			PlantFlowSupplyToDemandTolValue( ConvergLogStackDepth, 0.0 ),
-			PlantTempNotConverged( false ),
-			PlantTempDemandToSupplyTolValue( ConvergLogStackDepth, 0.0 ),
-			PlantTempSupplyToDemandTolValue( ConvergLogStackDepth, 0.0 )
+			PlantTempNotConverged( false )
 		{}
 
 		// Member Constructor
@@ -309,11 +330,11 @@ namespace DataConvergParams {
 			Array1< Real64 > const & PlantTempSupplyToDemandTolValue // Queue of convergence "results"
 		) :
 			PlantMassFlowNotConverged( PlantMassFlowNotConverged ),
-			PlantFlowDemandToSupplyTolValue( ConvergLogStackDepth, PlantFlowDemandToSupplyTolValue ),
-			PlantFlowSupplyToDemandTolValue( ConvergLogStackDepth, PlantFlowSupplyToDemandTolValue ),
+			PlantFlowDemandToSupplyTolValue( PlantFlowDemandToSupplyTolValue ),
+			PlantFlowSupplyToDemandTolValue( PlantFlowSupplyToDemandTolValue ),
 			PlantTempNotConverged( PlantTempNotConverged ),
-			PlantTempDemandToSupplyTolValue( ConvergLogStackDepth, PlantTempDemandToSupplyTolValue ),
-			PlantTempSupplyToDemandTolValue( ConvergLogStackDepth, PlantTempSupplyToDemandTolValue )
+			PlantTempDemandToSupplyTolValue( PlantTempDemandToSupplyTolValue ),
+			PlantTempSupplyToDemandTolValue( PlantTempSupplyToDemandTolValue )
 		{}
 
 	};
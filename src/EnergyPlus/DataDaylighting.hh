@@ -22,6 +22,14 @@ namespace DataDaylighting {
 	// -only module should be available to other modules and routines.
 	// Thus, all variables in this module must be PUBLIC.
 
+	// Storage of the daylighting and glare factors: single precision with the
+	// ENABLE_DAYLIGHTING_FLOAT_FACTORS build option, which halves their memory
+#ifdef EP_DAYLIGHTING_FLOAT_FACTORS
+	typedef float DaylFactorType;
+#else
+	typedef Real64 DaylFactorType;
+#endif
+
 	// MODULE PARAMETER DEFINITIONS:
 	// Two kinds of reference points: used directly in daylighting, used to show illuminance map of zone
 	extern int const MaxRefPoints; // Maximum number of daylighting reference points, 2
@@ -144,21 +152,21 @@ namespace DataDaylighting {
 		//  4: Shading index (1 to MaxSlatAngs+1; 1 = bare window; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
 		//  5: Sun position index (1 to 24)
-		Array5D< Real64 > DaylIllFacSky;
-		Array5D< Real64 > DaylSourceFacSky;
-		Array5D< Real64 > DaylBackFacSky;
+		Array5D< DaylFactorType > DaylIllFacSky;
+		Array5D< DaylFactorType > DaylSourceFacSky;
+		Array5D< DaylFactorType > DaylBackFacSky;
 		// Arguments for Dayl---Sun are:
 		//  1: Daylit window number (1 to NumOfDayltgExtWins)
 		//  2: Reference point number (1 to MaxRefPoints)
 		//  3: Shading index (1 to MaxShadeIndex; 1 = no shade; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
 		//  4: Sun position index (1 to 24)
-		Array4D< Real64 > DaylIllFacSun;
-		Array4D< Real64 > DaylIllFacSunDisk;
-		Array4D< Real64 > DaylSourceFacSun;
-		Array4D< Real64 > DaylSourceFacSunDisk;
-		Array4D< Real64 > DaylBackFacSun;
-		Array4D< Real64 > DaylBackFacSunDisk;
+		Array4D< DaylFactorType > DaylIllFacSun;
+		Array4D< DaylFactorType > DaylIllFacSunDisk;
+		Array4D< DaylFactorType > DaylSourceFacSun;
+		Array4D< DaylFactorType > DaylSourceFacSunDisk;
+		Array4D< DaylFactorType > DaylBackFacSun;
+		Array4D< DaylFactorType > DaylBackFacSunDisk;
 		// Time exceeding maximum allowable discomfort glare index at reference points (hours)
 		Array1D< Real64 > TimeExceedingGlareIndexSPAtRefPt;
 		// Time exceeding daylight illuminance setpoint at reference points (hours)
@@ -167,6 +175,8 @@ namespace DataDaylighting {
 		bool AdjZoneHasDayltgCtrl;
 		int MapCount; // Number of maps assigned to Zone
 		Array1D_int ZoneToMap; // Pointers to maps allocated to Zone
+		int NumShadeStates; // Extent of the shading index of the factor arrays: MaxSlatAngs + 1 with a movable-slat blind, 2 otherwise
+		Real64 MaxFactorRoundingError; // Largest relative error of the reference point factors as stored, against full precision
 
 		// Default Constructor
 		ZoneDaylightCalc() :
@@ -192,7 +202,9 @@ namespace DataDaylighting {
 			FloorVisRefl( 0.0 ),
 			InterReflIllFrIntWins( 0.0 ),
 			AdjZoneHasDayltgCtrl( false ),
-			MapCount( 0 )
+			MapCount( 0 ),
+			NumShadeStates( 0 ),
+			MaxFactorRoundingError( 0.0 )
 		{}
 
 		// Member Constructor
@@ -235,15 +247,15 @@ namespace DataDaylighting {
 			Array3< Real64 > const & IllumFromWinAtRefPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & BackLumFromWinAtRefPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & SourceLumFromWinAtRefPt, // (MaxRefPoints,2,50)
-			Array5< Real64 > const & DaylIllFacSky,
-			Array5< Real64 > const & DaylSourceFacSky,
-			Array5< Real64 > const & DaylBackFacSky,
-			Array4< Real64 > const & DaylIllFacSun,
-			Array4< Real64 > const & DaylIllFacSunDisk,
-			Array4< Real64 > const & DaylSourceFacSun,
-			Array4< Real64 > const & DaylSourceFacSunDisk,
-			Array4< Real64 > const & DaylBackFacSun,
-			Array4< Real64 > const & DaylBackFacSunDisk,
+			Array5< DaylFactorType > const & DaylIllFacSky,
+			Array5< DaylFactorType > const & DaylSourceFacSky,
+			Array5< DaylFactorType > const & DaylBackFacSky,
+			Array4< DaylFactorType > const & DaylIllFacSun,
+			Array4< DaylFactorType > const & DaylIllFacSunDisk,
+			Array4< DaylFactorType > const & DaylSourceFacSun,
+			Array4< DaylFactorType > const & DaylSourceFacSunDisk,
+			Array4< DaylFactorType > const & DaylBackFacSun,
+			Array4< DaylFactorType > const & DaylBackFacSunDisk,
 			Array1< Real64 > const & TimeExceedingGlareIndexSPAtRefPt,
 			Array1< Real64 > const & TimeExceedingDaylightIlluminanceSPAtRefPt,
 			bool const AdjZoneHasDayltgCtrl,
@@ -301,7 +313,9 @@ namespace DataDaylighting {
 			TimeExceedingDaylightIlluminanceSPAtRefPt( TimeExceedingDaylightIlluminanceSPAtRefPt ),
 			AdjZoneHasDayltgCtrl( AdjZoneHasDayltgCtrl ),
 			MapCount( MapCount ),
-			ZoneToMap( ZoneToMap )
+			ZoneToMap( ZoneToMap ),
+			NumShadeStates( 0 ),
+			MaxFactorRoundingError( 0.0 )
 		{}
 
 	};
@@ -395,27 +409,28 @@ namespace DataDaylighting {
 		Array3D< Real64 > IllumFromWinAtMapPt; // (MaxRefPoints,2,50)
 		Array3D< Real64 > BackLumFromWinAtMapPt; // (MaxRefPoints,2,50)
 		Array3D< Real64 > SourceLumFromWinAtMapPt; // (MaxRefPoints,2,50)
-		//  1: Daylit window number (1 to NumOfDayltgExtWins)
-		//  2: Reference point number (1 to MaxRefPoints)
-		//  3: Sky type (1 to 4; 1 = clear, 2 = clear turbid, 3 = intermediate, 4 = overcast
-		//  4: Shading index (1 to MaxSlatAngs+1; 1 = bare window; 2 = with shade, or, if blinds
+		// Arguments for Dayl---Sky are, with the map points last so that they are contiguous:
+		//  1: Sun position index (1 to 24)
+		//  2: Shading index (1 to MaxSlatAngs+1; 1 = bare window; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
-		//  5: Sun position index (1 to 24)
-		Array5D< Real64 > DaylIllFacSky;
-		Array5D< Real64 > DaylSourceFacSky;
-		Array5D< Real64 > DaylBackFacSky;
+		//  3: Sky type (1 to 4; 1 = clear, 2 = clear turbid, 3 = intermediate, 4 = overcast
+		//  4: Daylit window number (1 to NumOfDayltgExtWins)
+		//  5: Map point number (1 to TotalMapRefPoints)
+		Array5D< DaylFactorType > DaylIllFacSky;
+		Array5D< DaylFactorType > DaylSourceFacSky;
+		Array5D< DaylFactorType > DaylBackFacSky;
 		// Arguments for Dayl---Sun are:
-		//  1: Daylit window number (1 to NumOfDayltgExtWins)
-		//  2: Reference point number (1 to MaxRefPoints)
-		//  3: Shading index (1 to MaxShadeIndex; 1 = no shade; 2 = with shade, or, if blinds
+		//  1: Sun position index (1 to 24)
+		//  2: Shading index (1 to MaxShadeIndex; 1 = no shade; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
-		//  4: Sun position index (1 to 24)
-		Array4D< Real64 > DaylIllFacSun;
-		Array4D< Real64 > DaylIllFacSunDisk;
-		Array4D< Real64 > DaylSourceFacSun;
-		Array4D< Real64 > DaylSourceFacSunDisk;
-		Array4D< Real64 > DaylBackFacSun;
-		Array4D< Real64 > DaylBackFacSunDisk;
+		//  3: Daylit window number (1 to NumOfDayltgExtWins)
+		//  4: Map point number (1 to TotalMapRefPoints)
+		Array4D< DaylFactorType > DaylIllFacSun;
+		Array4D< DaylFactorType > DaylIllFacSunDisk;
+		Array4D< DaylFactorType > DaylSourceFacSun;
+		Array4D< DaylFactorType > DaylSourceFacSunDisk;
+		Array4D< DaylFactorType > DaylBackFacSun;
+		Array4D< DaylFactorType > DaylBackFacSunDisk;
 
 		// Default Constructor
 		MapCalcData() :
@@ -438,15 +453,15 @@ namespace DataDaylighting {
 			Array3< Real64 > const & IllumFromWinAtMapPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & BackLumFromWinAtMapPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & SourceLumFromWinAtMapPt, // (MaxRefPoints,2,50)
-			Array5< Real64 > const & DaylIllFacSky,
-			Array5< Real64 > const & DaylSourceFacSky,
-			Array5< Real64 > const & DaylBackFacSky,
-			Array4< Real64 > const & DaylIllFacSun,
-			Array4< Real64 > const & DaylIllFacSunDisk,
-			Array4< Real64 > const & DaylSourceFacSun,
-			Array4< Real64 > const & DaylSourceFacSunDisk,
-			Array4< Real64 > const & DaylBackFacSun,
-			Array4< Real64 > const & DaylBackFacSunDisk
+			Array5< DaylFactorType > const & DaylIllFacSky,
+			Array5< DaylFactorType > const & DaylSourceFacSky,
+			Array5< DaylFactorType > const & DaylBackFacSky,
+			Array4< DaylFactorType > const & DaylIllFacSun,
+			Array4< DaylFactorType > const & DaylIllFacSunDisk,
+			Array4< DaylFactorType > const & DaylSourceFacSun,
+			Array4< DaylFactorType > const & DaylSourceFacSunDisk,
+			Array4< DaylFactorType > const & DaylBackFacSun,
+			Array4< DaylFactorType > const & DaylBackFacSunDisk
 		) :
 			TotalMapRefPoints( TotalMapRefPoints ),
 			Zone( Zone ),
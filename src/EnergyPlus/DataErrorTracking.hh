@@ -1,6 +1,9 @@
 #ifndef DataErrorTracking_hh_INCLUDED
 #define DataErrorTracking_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -89,6 +92,8 @@ namespace DataErrorTracking {
 		bool ReportMax; // Flag to report max value
 		bool ReportMin; // Flag to report min value
 		bool ReportSum; // Flag to report sum value
+		bool SearchMatchesKnown; // TRUE once the MessageSearch entries found in the message are recorded
+		std::vector< int > SearchMatches; // MessageSearch entries found in the message, counted again on each repeat
 
 		// Default Constructor
 		RecurringErrorData() :
@@ -100,7 +105,8 @@ namespace DataErrorTracking {
 			SumValue( 0.0 ),
 			ReportMax( false ),
 			ReportMin( false ),
-			ReportSum( false )
+			ReportSum( false ),
+			SearchMatchesKnown( false )
 		{}
 
 		// Member Constructor
@@ -131,7 +137,8 @@ namespace DataErrorTracking {
 			SumUnits( SumUnits ),
 			ReportMax( ReportMax ),
 			ReportMin( ReportMin ),
-			ReportSum( ReportSum )
+			ReportSum( ReportSum ),
+			SearchMatchesKnown( false )
 		{}
 
 	};
@@ -196,6 +196,7 @@ namespace DataGlobals {
 	int Progress( 0 ); // current progress (0-100)
 	void ( *fProgressPtr )( int const );
 	void ( *fMessagePtr )( std::string const & );
+	void ( *fCallingPointPtr )( int const ); // Library callback run at each EMS calling point
 
 	//     NOTICE
 	//     Copyright © 1996-2014 The Board of Trustees of the University of Illinois
@@ -171,6 +171,7 @@ namespace DataGlobals {
 	extern int Progress;
 	extern void ( *fProgressPtr )( int const );
 	extern void ( *fMessagePtr )( std::string const & );
+	extern void ( *fCallingPointPtr )( int const ); // Library callback run at each EMS calling point
 
 } // DataGlobals
 
@@ -193,6 +193,42 @@ namespace DataHeatBalSurface {
 	Array1D_bool RecDifShortFromZ; // True if Zone gets short radiation from another
 	bool InterZoneWindow( false ); // True if there is an interzone window
 
+	// Object Data
+	SurfaceHotStateData InsideSurfHotState; // Re-entrant surfaces of the inside surface heat balance
+	SurfaceHotStateData HistorySurfHotState; // CTF surfaces of the thermal history update
+
+	// Functions
+
+	void
+	SurfaceHotStateData::resize( int const n )
+	{
+		NumSurfs = n;
+		if ( int( SurfNum.size() ) >= n ) return;
+		SurfNum.dimension( n, 0 );
+		ConstrNum.dimension( n, 0 );
+		ExtBoundCond.dimension( n, 0 );
+		Partition.dimension( n, false );
+		OpaqueClass.dimension( n, false );
+		LimitTemp.dimension( n, false );
+		Area.dimension( n, 0.0 );
+		CTFOutside0.dimension( n, 0.0 );
+		CTFCross0.dimension( n, 0.0 );
+		CTFInside0.dimension( n, 0.0 );
+		CTFSourceIn0.dimension( n, 0.0 );
+		CTFSourceOut0.dimension( n, 0.0 );
+		CTFConstIn.dimension( n, 0.0 );
+		CTFConstOut.dimension( n, 0.0 );
+		QsrcHist1.dimension( n, 0.0 );
+		TempOut.dimension( n, 0.0 );
+		TempIn.dimension( n, 0.0 );
+		TempInOld.dimension( n, 0.0 );
+		NetLWRad.dimension( n, 0.0 );
+		ConstTerm.dimension( n, 0.0 );
+		TempDiv.dimension( n, 0.0 );
+		QIn.dimension( n, 0.0 );
+		QOut.dimension( n, 0.0 );
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
@@ -180,6 +180,55 @@ namespace DataHeatBalSurface {
 	extern Array1D_bool RecDifShortFromZ; // True if Zone gets short radiation from another
 	extern bool InterZoneWindow; // True if there is an interzone window
 
+	// Types
+
+	struct SurfaceHotStateData
+	{
+		// Packed (structure of arrays) copy of the surface state touched by the plain CTF heat
+		// balance kernels.  Entries are stored in sweep order (1..NumSurfs) rather than by surface
+		// number so the kernels run over contiguous arrays with unit stride.
+
+		// Members
+		int NumSurfs; // Number of surfaces packed into the block
+		Array1D_int SurfNum; // Surface number of each entry
+		Array1D_int ConstrNum; // Construction number of each entry
+		Array1D_int ExtBoundCond; // Outside boundary condition of each entry
+		Array1D_bool Partition; // True if the surface is its own outside boundary
+		Array1D_bool OpaqueClass; // True for wall, floor, roof, door and internal mass surfaces
+		Array1D_bool LimitTemp; // True if the result is clamped to the surface temperature limits
+		Array1D< Real64 > Area; // Surface area [m2]
+		Array1D< Real64 > CTFOutside0; // Current outside CTF term of the construction
+		Array1D< Real64 > CTFCross0; // Current cross CTF term of the construction
+		Array1D< Real64 > CTFInside0; // Current inside CTF term of the construction
+		Array1D< Real64 > CTFSourceIn0; // Current inside source CTF term of the construction
+		Array1D< Real64 > CTFSourceOut0; // Current outside source CTF term of the construction
+		Array1D< Real64 > CTFConstIn; // Constant inside portion of the CTF calculation
+		Array1D< Real64 > CTFConstOut; // Constant outside portion of the CTF calculation
+		Array1D< Real64 > QsrcHist1; // Current heat source/sink term
+		Array1D< Real64 > TempOut; // Outside face temperature, TH(1,1,SurfNum)
+		Array1D< Real64 > TempIn; // Inside face temperature
+		Array1D< Real64 > TempInOld; // Inside face temperature of the previous iteration
+		Array1D< Real64 > NetLWRad; // Net interior long wavelength radiation to the surface
+		Array1D< Real64 > ConstTerm; // Iteration invariant part of the inside face balance numerator
+		Array1D< Real64 > TempDiv; // Inverse of the inside face balance denominator
+		Array1D< Real64 > QIn; // Current inside face conduction flux
+		Array1D< Real64 > QOut; // Current outside face conduction flux
+
+		// Default Constructor
+		SurfaceHotStateData() :
+			NumSurfs( 0 )
+		{}
+
+		// Size the block for NumSurfs entries (storage is only reallocated when it grows)
+		void
+		resize( int const n );
+
+	};
+
+	// Object Data
+	extern SurfaceHotStateData InsideSurfHotState; // Re-entrant surfaces of the inside surface heat balance
+	extern SurfaceHotStateData HistorySurfHotState; // CTF surfaces of the thermal history update
+
 } // DataHeatBalSurface
 
 } // EnergyPlus
@@ -309,6 +309,7 @@ namespace DataHeatBalance {
 	int DefaultOutsideConvectionAlgo( 1 ); // 1 = simple (ASHRAE); 2 = detailed; etc (BLAST, TARP, MOWITT, DOE-2)
 	int SolarDistribution( 0 ); // Solar Distribution Algorithm
 	int InsideSurfIterations( 0 ); // Counts inside surface iterations
+	Array1D_int ZoneInsideSurfIterations; // Inside surface iterations each zone needed to converge, by zone
 	int OverallHeatTransferSolutionAlgo( UseCTF ); // UseCTF Solution, UseEMPD moisture solution, UseCondFD solution
 	int NumberOfHeatTransferAlgosUsed( 1 );
 	Array1D_int HeatTransferAlgosUsed;
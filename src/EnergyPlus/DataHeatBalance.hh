@@ -290,6 +290,7 @@ namespace DataHeatBalance {
 	extern int DefaultOutsideConvectionAlgo; // 1 = simple (ASHRAE); 2 = detailed; etc (BLAST, TARP, MOWITT, DOE-2)
 	extern int SolarDistribution; // Solar Distribution Algorithm
 	extern int InsideSurfIterations; // Counts inside surface iterations
+	extern Array1D_int ZoneInsideSurfIterations; // Inside surface iterations each zone needed to converge, by zone
 	extern int OverallHeatTransferSolutionAlgo; // UseCTF Solution, UseEMPD moisture solution, UseCondFD solution
 	extern int NumberOfHeatTransferAlgosUsed;
 	extern Array1D_int HeatTransferAlgosUsed;
@@ -3802,6 +3803,13 @@ namespace DataHeatBalance {
 		int NumberOfDevices;
 		int MaxNumberOfDevices;
 		Array1D< GenericComponentZoneIntGainStruct > Device;
+		Real64 SumConvGainRate; // Convected gains of the devices, summed by UpdateInternalGainValues
+		Real64 SumReturnAirConvGainRate; // Return air convected gains of the devices
+		Real64 SumRadiantGainRate; // Radiant gains of the devices
+		Real64 SumLatentGainRate; // Latent gains of the devices
+		Real64 SumReturnAirLatentGainRate; // Return air latent gains of the devices
+		Real64 SumCarbonDioxideGainRate; // Carbon dioxide gains of the devices
+		Real64 SumGenericContamGainRate; // Generic contaminant gains of the devices
 
 		// Default Constructor
 		ZoneSimData() :
@@ -3839,7 +3847,14 @@ namespace DataHeatBalance {
 			QBBCON( 0.0 ),
 			QBBRAD( 0.0 ),
 			NumberOfDevices( 0 ),
-			MaxNumberOfDevices( 0 )
+			MaxNumberOfDevices( 0 ),
+			SumConvGainRate( 0.0 ),
+			SumReturnAirConvGainRate( 0.0 ),
+			SumRadiantGainRate( 0.0 ),
+			SumLatentGainRate( 0.0 ),
+			SumReturnAirLatentGainRate( 0.0 ),
+			SumCarbonDioxideGainRate( 0.0 ),
+			SumGenericContamGainRate( 0.0 )
 		{}
 
 		// Member Constructor
@@ -3916,7 +3931,14 @@ namespace DataHeatBalance {
 			QBBRAD( QBBRAD ),
 			NumberOfDevices( NumberOfDevices ),
 			MaxNumberOfDevices( MaxNumberOfDevices ),
-			Device( Device )
+			Device( Device ),
+			SumConvGainRate( 0.0 ),
+			SumReturnAirConvGainRate( 0.0 ),
+			SumRadiantGainRate( 0.0 ),
+			SumLatentGainRate( 0.0 ),
+			SumReturnAirLatentGainRate( 0.0 ),
+			SumCarbonDioxideGainRate( 0.0 ),
+			SumGenericContamGainRate( 0.0 )
 		{}
 
 	};
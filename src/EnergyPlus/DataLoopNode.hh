@@ -73,25 +73,28 @@ namespace DataLoopNode {
 	struct NodeData
 	{
 		// Members
+		// The conditions read and set by every component and loop solution come first, in the
+		// same 64 bytes of the node, ahead of the limits, setpoints, outdoor air, contaminant and
+		// EMS values.
+		Real64 Temp; // {C}
+		Real64 HumRat; // {}
+		Real64 Enthalpy; // {J/kg}
+		Real64 MassFlowRate; // {kg/s}
+		Real64 MassFlowRateMinAvail; // {kg/s}
+		Real64 MassFlowRateMaxAvail; // {kg/s}
+		Real64 Press; // {Pa}
+		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
 		int FluidType; // must be one of the valid parameters
 		int FluidIndex; // For Fluid Properties
-		Real64 Temp; // {C}
 		Real64 TempMin; // {C}
 		Real64 TempMax; // {C}
 		Real64 TempSetPoint; // {C}
 		Real64 TempLastTimestep; // [C}   DSU
 		Real64 MassFlowRateRequest; // {kg/s}  DSU
-		Real64 MassFlowRate; // {kg/s}
 		Real64 MassFlowRateMin; // {kg/s}
 		Real64 MassFlowRateMax; // {kg/s}
-		Real64 MassFlowRateMinAvail; // {kg/s}
-		Real64 MassFlowRateMaxAvail; // {kg/s}
 		Real64 MassFlowRateSetPoint; // {kg/s}
-		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
-		Real64 Press; // {Pa}
-		Real64 Enthalpy; // {J/kg}
 		Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
-		Real64 HumRat; // {}
 		Real64 HumRatMin; // {}
 		Real64 HumRatMax; // {}
 		Real64 HumRatSetPoint; // {}
@@ -100,39 +103,39 @@ namespace DataLoopNode {
 		Real64 Height; // {m}
 		//  Following are for Outdoor Air Nodes "read only"
 		Real64 OutAirDryBulb; // {C}
-		bool EMSOverrideOutAirDryBulb; // if true, the EMS is calling to override outdoor air node drybulb setting
 		Real64 EMSValueForOutAirDryBulb; // value EMS is directing to use for outdoor air node's drybulb {C}
 		Real64 OutAirWetBulb; // {C}
-		bool EMSOverrideOutAirWetBulb; // if true, the EMS is calling to override outdoor air node wetbulb setting
 		Real64 EMSValueForOutAirWetBulb; // value EMS is directing to use for outdoor air node's wetbulb {C}
 		// Contaminant
 		Real64 CO2; // {ppm}
 		Real64 CO2SetPoint; // {ppm}
 		Real64 GenContam; // {ppm}
 		Real64 GenContamSetPoint; // {ppm}
+		bool EMSOverrideOutAirDryBulb; // if true, the EMS is calling to override outdoor air node drybulb setting
+		bool EMSOverrideOutAirWetBulb; // if true, the EMS is calling to override outdoor air node wetbulb setting
 		bool SPMNodeWetBulbRepReq; // Set to true when node has SPM which follows wetbulb
 
 		// Default Constructor
 		NodeData() :
+			Temp( 0.0 ),
+			HumRat( 0.0 ),
+			Enthalpy( 0.0 ),
+			MassFlowRate( 0.0 ),
+			MassFlowRateMinAvail( 0.0 ),
+			MassFlowRateMaxAvail( 0.0 ),
+			Press( 0.0 ),
+			Quality( 0.0 ),
 			FluidType( 0 ),
 			FluidIndex( 0 ),
-			Temp( 0.0 ),
 			TempMin( 0.0 ),
 			TempMax( 0.0 ),
 			TempSetPoint( SensedNodeFlagValue ),
 			TempLastTimestep( 0.0 ),
 			MassFlowRateRequest( 0.0 ),
-			MassFlowRate( 0.0 ),
 			MassFlowRateMin( 0.0 ),
 			MassFlowRateMax( SensedNodeFlagValue ),
-			MassFlowRateMinAvail( 0.0 ),
-			MassFlowRateMaxAvail( 0.0 ),
 			MassFlowRateSetPoint( 0.0 ),
-			Quality( 0.0 ),
-			Press( 0.0 ),
-			Enthalpy( 0.0 ),
 			EnthalpyLastTimestep( 0.0 ),
-			HumRat( 0.0 ),
 			HumRatMin( SensedNodeFlagValue ),
 			HumRatMax( SensedNodeFlagValue ),
 			HumRatSetPoint( SensedNodeFlagValue ),
@@ -140,39 +143,39 @@ namespace DataLoopNode {
 			TempSetPointLo( SensedNodeFlagValue ),
 			Height( -1.0 ),
 			OutAirDryBulb( 0.0 ),
-			EMSOverrideOutAirDryBulb( false ),
 			EMSValueForOutAirDryBulb( 0.0 ),
 			OutAirWetBulb( 0.0 ),
-			EMSOverrideOutAirWetBulb( false ),
 			EMSValueForOutAirWetBulb( 0.0 ),
 			CO2( 0.0 ),
 			CO2SetPoint( 0.0 ),
 			GenContam( 0.0 ),
 			GenContamSetPoint( 0.0 ),
+			EMSOverrideOutAirDryBulb( false ),
+			EMSOverrideOutAirWetBulb( false ),
 			SPMNodeWetBulbRepReq( false )
 		{}
 
 		// Member Constructor
 		NodeData(
+			Real64 const Temp, // {C}
+			Real64 const HumRat, // {}
+			Real64 const Enthalpy, // {J/kg}
+			Real64 const MassFlowRate, // {kg/s}
+			Real64 const MassFlowRateMinAvail, // {kg/s}
+			Real64 const MassFlowRateMaxAvail, // {kg/s}
+			Real64 const Press, // {Pa}
+			Real64 const Quality, // {0.0-1.0 vapor fraction/percent}
 			int const FluidType, // must be one of the valid parameters
 			int const FluidIndex, // For Fluid Properties
-			Real64 const Temp, // {C}
 			Real64 const TempMin, // {C}
 			Real64 const TempMax, // {C}
 			Real64 const TempSetPoint, // {C}
 			Real64 const TempLastTimestep, // [C}   DSU
 			Real64 const MassFlowRateRequest, // {kg/s}  DSU
-			Real64 const MassFlowRate, // {kg/s}
 			Real64 const MassFlowRateMin, // {kg/s}
 			Real64 const MassFlowRateMax, // {kg/s}
-			Real64 const MassFlowRateMinAvail, // {kg/s}
-			Real64 const MassFlowRateMaxAvail, // {kg/s}
 			Real64 const MassFlowRateSetPoint, // {kg/s}
-			Real64 const Quality, // {0.0-1.0 vapor fraction/percent}
-			Real64 const Press, // {Pa}
-			Real64 const Enthalpy, // {J/kg}
 			Real64 const EnthalpyLastTimestep, // {J/kg}  DSU for steam?
-			Real64 const HumRat, // {}
 			Real64 const HumRatMin, // {}
 			Real64 const HumRatMax, // {}
 			Real64 const HumRatSetPoint, // {}
@@ -180,36 +183,36 @@ namespace DataLoopNode {
 			Real64 const TempSetPointLo, // {C}
 			Real64 const Height, // {m}
 			Real64 const OutAirDryBulb, // {C}
-			bool const EMSOverrideOutAirDryBulb, // if true, the EMS is calling to override outdoor air node drybulb setting
 			Real64 const EMSValueForOutAirDryBulb, // value EMS is directing to use for outdoor air node's drybulb {C}
 			Real64 const OutAirWetBulb, // {C}
-			bool const EMSOverrideOutAirWetBulb, // if true, the EMS is calling to override outdoor air node wetbulb setting
 			Real64 const EMSValueForOutAirWetBulb, // value EMS is directing to use for outdoor air node's wetbulb {C}
 			Real64 const CO2, // {ppm}
 			Real64 const CO2SetPoint, // {ppm}
 			Real64 const GenContam, // {ppm}
 			Real64 const GenContamSetPoint, // {ppm}
+			bool const EMSOverrideOutAirDryBulb, // if true, the EMS is calling to override outdoor air node drybulb setting
+			bool const EMSOverrideOutAirWetBulb, // if true, the EMS is calling to override outdoor air node wetbulb setting
 			bool const SPMNodeWetBulbRepReq // Set to true when node has SPM which follows wetbulb
 		) :
+			Temp( Temp ),
+			HumRat( HumRat ),
+			Enthalpy( Enthalpy ),
+			MassFlowRate( MassFlowRate ),
+			MassFlowRateMinAvail( MassFlowRateMinAvail ),
+			MassFlowRateMaxAvail( MassFlowRateMaxAvail ),
+			Press( Press ),
+			Quality( Quality ),
 			FluidType( FluidType ),
 			FluidIndex( FluidIndex ),
-			Temp( Temp ),
 			TempMin( TempMin ),
 			TempMax( TempMax ),
 			TempSetPoint( TempSetPoint ),
 			TempLastTimestep( TempLastTimestep ),
 			MassFlowRateRequest( MassFlowRateRequest ),
-			MassFlowRate( MassFlowRate ),
 			MassFlowRateMin( MassFlowRateMin ),
 			MassFlowRateMax( MassFlowRateMax ),
-			MassFlowRateMinAvail( MassFlowRateMinAvail ),
-			MassFlowRateMaxAvail( MassFlowRateMaxAvail ),
 			MassFlowRateSetPoint( MassFlowRateSetPoint ),
-			Quality( Quality ),
-			Press( Press ),
-			Enthalpy( Enthalpy ),
 			EnthalpyLastTimestep( EnthalpyLastTimestep ),
-			HumRat( HumRat ),
 			HumRatMin( HumRatMin ),
 			HumRatMax( HumRatMax ),
 			HumRatSetPoint( HumRatSetPoint ),
@@ -217,15 +220,15 @@ namespace DataLoopNode {
 			TempSetPointLo( TempSetPointLo ),
 			Height( Height ),
 			OutAirDryBulb( OutAirDryBulb ),
-			EMSOverrideOutAirDryBulb( EMSOverrideOutAirDryBulb ),
 			EMSValueForOutAirDryBulb( EMSValueForOutAirDryBulb ),
 			OutAirWetBulb( OutAirWetBulb ),
-			EMSOverrideOutAirWetBulb( EMSOverrideOutAirWetBulb ),
 			EMSValueForOutAirWetBulb( EMSValueForOutAirWetBulb ),
 			CO2( CO2 ),
 			CO2SetPoint( CO2SetPoint ),
 			GenContam( GenContam ),
 			GenContamSetPoint( GenContamSetPoint ),
+			EMSOverrideOutAirDryBulb( EMSOverrideOutAirDryBulb ),
+			EMSOverrideOutAirWetBulb( EMSOverrideOutAirWetBulb ),
 			SPMNodeWetBulbRepReq( SPMNodeWetBulbRepReq )
 		{}
 
@@ -53,9 +53,26 @@ namespace DataOutputs {
 
 	// Object Data
 	Array1D< OutputReportingVariables > OutputVariablesForSimulation;
+	std::unordered_map< std::string, int > OutputVariablesForSimulationByName; // First record of each variable name (upper case), empty if not indexed
 
 	// Functions
 
+	void
+	IndexOutputVariablesForSimulation()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Indexes the pre-scanned output variables by name once the list is complete, so
+		// FindItemInVariableList finds the first record of a variable name without a search.
+
+		OutputVariablesForSimulationByName.clear();
+		OutputVariablesForSimulationByName.reserve( NumConsideredOutputVariables );
+		for ( int Item = 1; Item <= NumConsideredOutputVariables; ++Item ) {
+			OutputVariablesForSimulationByName.emplace( uppercased( OutputVariablesForSimulation( Item ).VarName ), Item ); // Keeps the first record of a name
+		}
+
+	}
+
 	bool
 	FindItemInVariableList(
 		std::string const & KeyedValue,
@@ -103,10 +120,15 @@ namespace DataOutputs {
 
 		InVariableList = false;
 		Found = 0;
-		for ( Item = 1; Item <= NumConsideredOutputVariables; ++Item ) {
-			if ( ! equali( VariableName, OutputVariablesForSimulation( Item ).VarName ) ) continue;
-			Found = Item;
-			break;
+		if ( ! OutputVariablesForSimulationByName.empty() ) {
+			auto const ByName( OutputVariablesForSimulationByName.find( uppercased( VariableName ) ) );
+			if ( ByName != OutputVariablesForSimulationByName.end() ) Found = ByName->second;
+		} else {
+			for ( Item = 1; Item <= NumConsideredOutputVariables; ++Item ) {
+				if ( ! equali( VariableName, OutputVariablesForSimulation( Item ).VarName ) ) continue;
+				Found = Item;
+				break;
+			}
 		}
 		if ( Found != 0 ) {
 			if ( equali( KeyedValue, OutputVariablesForSimulation( Found ).Key ) || OutputVariablesForSimulation( Found ).Key == "*" ) {
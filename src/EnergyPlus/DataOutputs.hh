@@ -1,6 +1,10 @@
 #ifndef DataOutputs_hh_INCLUDED
 #define DataOutputs_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -65,9 +69,13 @@ namespace DataOutputs {
 
 	// Object Data
 	extern Array1D< OutputReportingVariables > OutputVariablesForSimulation;
+	extern std::unordered_map< std::string, int > OutputVariablesForSimulationByName; // First record of each variable name (upper case), empty if not indexed
 
 	// Functions
 
+	void
+	IndexOutputVariablesForSimulation();
+
 	bool
 	FindItemInVariableList(
 		std::string const & KeyedValue,
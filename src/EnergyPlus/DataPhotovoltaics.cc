@@ -73,6 +73,7 @@ namespace DataPhotovoltaics {
 
 	// Object Data
 	Array1D< PVArrayStruct > PVarray;
+	Array1D< PVModuleGroupStruct > PVModuleGroups;
 
 	// ___________________________________________________________________________
 
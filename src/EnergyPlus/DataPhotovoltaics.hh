@@ -604,6 +604,45 @@ namespace DataPhotovoltaics {
 
 	};
 
+	struct PVModuleGroupStruct
+	{
+		// Equivalent one-diode and Sandia PV generators with the same performance object and cell
+		// integration mode.  The module model of a group is a function of the conditions below, so
+		// the module results of the last evaluation are kept for the next generator of the group.
+
+		// Members
+		int PVModelType; // iTRNSYSPVModel or iSandiaPVModel
+		int CellIntegrationMode; // as of the generators of the group
+		std::string PerfObjName; // Performance object of the generators of the group
+		bool Evaluated; // True once the conditions and module results below are set
+		Array1D< Real64 > Conditions; // Inputs of the module model at the last evaluation
+		SNLPVCalcStruct SNLPVCalc; // Sandia module results (one module, before scaling to the array)
+		Real64 ETA; // Equivalent one-diode module efficiency [0..1]
+		Real64 IM; // Equivalent one-diode module current at maximum power [A]
+		Real64 VM; // Equivalent one-diode module voltage at maximum power [V]
+		Real64 PM; // Equivalent one-diode module maximum power [W]
+		Real64 ISC; // Equivalent one-diode module short circuit current [A]
+		Real64 VOC; // Equivalent one-diode module open circuit voltage [V]
+		Real64 CellTemp; // Equivalent one-diode cell temperature [K]
+		Real64 HeatLossCoef; // Equivalent one-diode module heat loss coefficient of the evaluation
+
+		// Default Constructor
+		PVModuleGroupStruct() :
+			PVModelType( 0 ),
+			CellIntegrationMode( 0 ),
+			Evaluated( false ),
+			ETA( 0.0 ),
+			IM( 0.0 ),
+			VM( 0.0 ),
+			PM( 0.0 ),
+			ISC( 0.0 ),
+			VOC( 0.0 ),
+			CellTemp( 0.0 ),
+			HeatLossCoef( 0.0 )
+		{}
+
+	};
+
 	struct PVArrayStruct
 	{
 		// Members
@@ -618,6 +657,7 @@ namespace DataPhotovoltaics {
 		int UTSCPtr; // pointer to UTSC number for INTEGRATED TRANSPIRED COLLECTOR mode
 		int ExtVentCavPtr; // pointer to Exterior Vented Cavity EXTERIOR VENTED CAVITY
 		int PVTPtr; // pointer to PVT model
+		int ModuleGroup; // index in PVModuleGroups, 0 for the simple model
 		Real64 SurfaceSink; // PV power "sink" for integration
 		PVReportVariables Report; // report variables
 		// nested structs for user input parameters
@@ -639,6 +679,7 @@ namespace DataPhotovoltaics {
 			UTSCPtr( 0 ),
 			ExtVentCavPtr( 0 ),
 			PVTPtr( 0 ),
+			ModuleGroup( 0 ),
 			SurfaceSink( 0.0 )
 		{}
 
@@ -675,6 +716,7 @@ namespace DataPhotovoltaics {
 			UTSCPtr( UTSCPtr ),
 			ExtVentCavPtr( ExtVentCavPtr ),
 			PVTPtr( PVTPtr ),
+			ModuleGroup( 0 ),
 			SurfaceSink( SurfaceSink ),
 			Report( Report ),
 			SimplePVModule( SimplePVModule ),
@@ -689,6 +731,7 @@ namespace DataPhotovoltaics {
 
 	// Object Data
 	extern Array1D< PVArrayStruct > PVarray;
+	extern Array1D< PVModuleGroupStruct > PVModuleGroups;
 
 } // DataPhotovoltaics
 
@@ -10,6 +10,7 @@
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
 #include <DataLoopNode.hh>
+#include <FluidProperties.hh>
 
 namespace EnergyPlus {
 
@@ -1191,6 +1192,8 @@ namespace DataPlant {
 		Real64 LoopSideInlet_TankTemp;
 		PlantConvergencePoint InletNode;
 		PlantConvergencePoint OutletNode;
+		FluidProperties::GlycolPropsHandle FluidProps; // Loop fluid with its last specific heat on this side
+		Array1D< Real64 > SolvedPlantState; // Plant node conditions after the last solve of this side
 
 		// Default Constructor
 		HalfLoopData() :
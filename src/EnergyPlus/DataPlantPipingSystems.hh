@@ -1,6 +1,9 @@
 #ifndef DataPlantPipingSystems_hh_INCLUDED
 #define DataPlantPipingSystems_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array3D.hh>
@@ -1279,6 +1282,41 @@ namespace DataPlantPipingSystems {
 
 	};
 
+	struct FieldCellSolverData
+	{
+		// Field cells of a domain with their neighbors and resistances, which do not change once
+		// the domain is meshed, in flat arrays for the field cell sweeps and the conjugate
+		// gradient solution.  Positions and linear cell indexes are 0 based.
+
+		// Members
+		bool Built; // True once the field cells have been numbered
+		Array3D_int CellPos; // Position of each cell among the field cells, -1 if not a field cell
+		std::vector< int > CellX; // Cell indexes of each field cell
+		std::vector< int > CellY;
+		std::vector< int > CellZ;
+		std::vector< int > Np; // Start of the neighbors of each field cell
+		std::vector< int > NbIndex; // Linear cell index of each neighbor
+		std::vector< int > NbPos; // Field cell position of each neighbor, -1 if not a field cell
+		std::vector< Real64 > NbResistance; // Resistance to each neighbor [K/W]
+		std::vector< Real64 > NbConductance; // Inverse of the resistance [W/K]
+		std::vector< Real64 > CellTemp; // Temperature of every cell by linear index, kept with the cells during sweeps [C]
+		std::vector< Real64 > Diag; // Diagonal of each row [W/K]
+		std::vector< Real64 > B; // Right hand side [W]
+		std::vector< Real64 > T; // Cell temperatures [C]
+		std::vector< Real64 > R; // Residual [W]
+		std::vector< Real64 > Z; // Preconditioned residual [C]
+		std::vector< Real64 > P; // Search direction [C]
+		std::vector< Real64 > Q; // Matrix times search direction [W]
+		int Iterations; // Conjugate gradient iterations of the last solution
+
+		// Default Constructor
+		FieldCellSolverData() :
+			Built( false ),
+			Iterations( 0 )
+		{}
+
+	};
+
 	struct FullDomainStructureInfo
 	{
 		// Members
@@ -1362,6 +1400,7 @@ namespace DataPlantPipingSystems {
 
 		// Main 3D cells array
 		Array3D< CartesianCell > Cells;
+		FieldCellSolverData FieldSolver; // Used when the field cells are solved together
 
 		// Default Constructor
 		FullDomainStructureInfo() :
@@ -132,6 +132,8 @@ namespace DataRoomAirModel {
 	Array1D_bool ZoneAirSystemON;
 	Array1D< Real64 > TCMF; // comfort temperature
 	Array1D< Real64 > ZoneCeilingHeight;
+	Array1D< Real64 > SurfMinZ; // [m] lowest vertex height of each surface
+	Array1D< Real64 > SurfMaxZ; // [m] highest vertex height of each surface
 	Array1D< Real64 > MATFloor; // [C] floor level mean air temp
 	Array1D< Real64 > XMATFloor; // [C] floor level mean air temp at t minus 1 zone time step
 	Array1D< Real64 > XM2TFloor; // [C] floor level mean air temp at t minus 2 zone time step
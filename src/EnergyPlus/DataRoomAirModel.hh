@@ -124,6 +124,8 @@ namespace DataRoomAirModel {
 	extern Array1D_bool ZoneAirSystemON;
 	extern Array1D< Real64 > TCMF; // comfort temperature
 	extern Array1D< Real64 > ZoneCeilingHeight;
+	extern Array1D< Real64 > SurfMinZ; // [m] lowest vertex height of each surface
+	extern Array1D< Real64 > SurfMaxZ; // [m] highest vertex height of each surface
 	extern Array1D< Real64 > MATFloor; // [C] floor level mean air temp
 	extern Array1D< Real64 > XMATFloor; // [C] floor level mean air temp at t minus 1 zone time step
 	extern Array1D< Real64 > XM2TFloor; // [C] floor level mean air temp at t minus 2 zone time step
@@ -184,6 +184,7 @@ namespace DataRuntimeLanguage {
 	bool OutputEMSActuatorAvailSmall( false ); // how much to write out to EDD file, if true dump actuator list without key names
 	bool OutputEMSInternalVarsFull( false ); // how much to write out to EDD file, if true dump full combinatorial internal list
 	bool OutputEMSInternalVarsSmall( false ); // how much to write out to EDD file, if true dump internal list without key names
+	bool OutputEMSProfile( false ); // if true, time the Erl programs and subroutines and write the statistics at the end
 
 	Array2D_bool EMSConstructActuatorChecked;
 	Array2D_bool EMSConstructActuatorIsOkay;
@@ -191,7 +192,9 @@ namespace DataRuntimeLanguage {
 	// Object Data
 	Array1D< ErlVariableType > ErlVariable; // holds Erl variables in a structure array
 	Array1D< ErlStackType > ErlStack; // holds Erl programs in separate "stacks"
+	Array1D< ErlStackProfileType > ErlStackProfile; // run time statistics of the Erl stacks
 	Array1D< ErlExpressionType > ErlExpression; // holds Erl expressions in structure array
+	Array1D< ErlCompiledExpressionType > ErlCompiledExpression; // compiled form of ErlExpression, same index
 	Array1D< OperatorType > PossibleOperators; // hard library of available operators and functions
 	Array1D< TrendVariableType > TrendVariable; // holds Erl trend varialbes in a structure array
 	Array1D< OutputVarSensorType > Sensor; // EMS:SENSOR objects used (from output variables)
@@ -5,6 +5,7 @@
 #include <functional>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -182,6 +183,7 @@ namespace DataRuntimeLanguage {
 	extern bool OutputEMSActuatorAvailSmall; // how much to write out to EDD file, if true dump actuator list without key names
 	extern bool OutputEMSInternalVarsFull; // how much to write out to EDD file, if true dump full combinatorial internal list
 	extern bool OutputEMSInternalVarsSmall; // how much to write out to EDD file, if true dump internal list without key names
+	extern bool OutputEMSProfile; // if true, time the Erl programs and subroutines and write the statistics at the end
 
 	extern Array2D_bool EMSConstructActuatorChecked;
 	extern Array2D_bool EMSConstructActuatorIsOkay;
@@ -572,6 +574,25 @@ namespace DataRuntimeLanguage {
 
 	};
 
+	struct ErlStackProfileType
+	{
+		// Members
+		// run time statistics of an Erl program or subroutine, same index as ErlStack
+		Int64 NumCalls; // count of times the stack was run
+		Int64 NumInstructions; // count of instructions run in the stack, not counting the subroutines it runs
+		Real64 Time; // wall time spent in the stack and the subroutines it runs (s)
+		Real64 SelfTime; // wall time spent in the stack, not counting the subroutines it runs (s)
+
+		// Default Constructor
+		ErlStackProfileType() :
+			NumCalls( 0 ),
+			NumInstructions( 0 ),
+			Time( 0.0 ),
+			SelfTime( 0.0 )
+		{}
+
+	};
+
 	struct ErlExpressionType
 	{
 		// Members
@@ -598,6 +619,71 @@ namespace DataRuntimeLanguage {
 
 	};
 
+	struct ErlRegisterType
+	{
+		// Members
+		// value held in a register while running a compiled Erl expression
+		int Type; // value type, eg. ValueNumber, ValueNull or ValueError
+		Real64 Number; // numeric value
+
+		// Default Constructor
+		ErlRegisterType() :
+			Type( 0 ),
+			Number( 0.0 )
+		{}
+
+		// Member Constructor
+		ErlRegisterType(
+			int const Type, // value type, eg. ValueNumber, ValueNull or ValueError
+			Real64 const Number // numeric value
+		) :
+			Type( Type ),
+			Number( Number )
+		{}
+
+	};
+
+	struct ErlCodeType
+	{
+		// Members
+		// one operation of a compiled Erl expression
+		int Operator; // operator or built-in function, as in ErlExpressionType
+		int Result; // register receiving the result (0 based)
+		int FirstOperand; // first of the operand registers in ErlCompiledExpressionType::Operands
+		int NumOperands; // count of operands
+
+		// Default Constructor
+		ErlCodeType() :
+			Operator( 0 ),
+			Result( 0 ),
+			FirstOperand( 0 ),
+			NumOperands( 0 )
+		{}
+
+	};
+
+	struct ErlCompiledExpressionType
+	{
+		// Members
+		// Erl expression tree flattened into operations on a register file
+		bool Compiled; // false if the expression is left to the tree interpreter
+		ErlValueType const * CopyValue; // value given back as is by a literal expression, else null
+		std::vector< ErlRegisterType > Registers; // initial register file: constants, then zeros
+		std::vector< int > LoadRegisters; // registers loaded from Erl variables before running
+		std::vector< ErlValueType const * > LoadValues; // Erl variable values loaded into LoadRegisters
+		std::vector< ErlCodeType > Code; // operations in order of evaluation
+		std::vector< int > Operands; // operand registers of the operations
+		int Result; // register holding the value of the expression
+
+		// Default Constructor
+		ErlCompiledExpressionType() :
+			Compiled( false ),
+			CopyValue( nullptr ),
+			Result( 0 )
+		{}
+
+	};
+
 	struct OperatorType
 	{
 		// Members
@@ -663,7 +749,9 @@ namespace DataRuntimeLanguage {
 	// Object Data
 	extern Array1D< ErlVariableType > ErlVariable; // holds Erl variables in a structure array
 	extern Array1D< ErlStackType > ErlStack; // holds Erl programs in separate "stacks"
+	extern Array1D< ErlStackProfileType > ErlStackProfile; // run time statistics of the Erl stacks
 	extern Array1D< ErlExpressionType > ErlExpression; // holds Erl expressions in structure array
+	extern Array1D< ErlCompiledExpressionType > ErlCompiledExpression; // compiled form of ErlExpression, same index
 	extern Array1D< OperatorType > PossibleOperators; // hard library of available operators and functions
 	extern Array1D< TrendVariableType > TrendVariable; // holds Erl trend varialbes in a structure array
 	extern Array1D< OutputVarSensorType > Sensor; // EMS:SENSOR objects used (from output variables)
@@ -33,6 +33,7 @@ namespace DataStringGlobals {
 	extern std::string outputTblTxtFileName;
 	extern std::string outputTblXmlFileName;
 	extern std::string inputIdfFileName;
+	extern std::string inputIdfBuffer; // Input data given in memory by the library caller, read instead of inputIdfFileName
 	extern	std::string inputIddFileName;
 	extern	std::string inputWeatherFileName;
 	extern std::string outputAdsFileName;
@@ -57,7 +58,10 @@ namespace DataStringGlobals {
 	extern std::string outputSszTabFileName;
 	extern std::string outputSszTxtFileName;
 	extern std::string outputScreenCsvFileName;
+	extern std::string outputEmsCsvFileName;
+	extern std::string outputProfFileName;
 	extern std::string outputSqlFileName;
+	extern std::string outputColFileName;
 	extern std::string outputSqliteErrFileName;
 	extern std::string EnergyPlusIniFileName;
 	extern std::string inStatFileName;
@@ -90,6 +90,7 @@ namespace DataStringGlobals {
 	std::string outputTblTxtFileName("eplustbl.txt");
 	std::string outputTblXmlFileName("eplustbl.xml");
 	std::string inputIdfFileName;
+	std::string inputIdfBuffer; // Input data given in memory by the library caller, read instead of inputIdfFileName
 	std::string inputIddFileName;
 	std::string inputWeatherFileName;
 	std::string outputAdsFileName("eplusADS.out");
@@ -114,7 +115,10 @@ namespace DataStringGlobals {
 	std::string outputSszTabFileName("eplusssz.tab");
 	std::string outputSszTxtFileName("eplusssz.txt");
 	std::string outputScreenCsvFileName("eplusscreen.csv");
+	std::string outputEmsCsvFileName("eplusems.csv");
+	std::string outputProfFileName("eplusout.prof");
 	std::string outputSqlFileName("eplusout.sql");
+	std::string outputColFileName("eplusout.col");
 	std::string outputSqliteErrFileName("eplussqlite.err");
 	std::string EnergyPlusIniFileName;
 	std::string inStatFileName;
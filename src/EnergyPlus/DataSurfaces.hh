@@ -446,6 +446,7 @@ namespace DataSurfaces {
 		// Equals 0 for detached shading.
 		// BaseSurf equals surface number for all other surfaces.
 		int NumSubSurfaces; // Number of subsurfaces this surface has (doors/windows)
+		int MergedSurfaces; // Number of coplanar surfaces merged into this one, whose area it carries
 		std::string ZoneName; // User supplied name of the Zone
 		int Zone; // Interior environment or zone the surface is a part of
 		// Note that though attached shading surfaces are part of a zone, this
@@ -599,6 +600,7 @@ namespace DataSurfaces {
 			HeatTransferAlgorithm( HeatTransferModel_NotSet ),
 			BaseSurf( 0 ),
 			NumSubSurfaces( 0 ),
+			MergedSurfaces( 0 ),
 			Zone( 0 ),
 			ExtBoundCond( 0 ),
 			LowTempErrCount( 0 ),
@@ -839,6 +841,7 @@ namespace DataSurfaces {
 			BaseSurfName( BaseSurfName ),
 			BaseSurf( BaseSurf ),
 			NumSubSurfaces( NumSubSurfaces ),
+			MergedSurfaces( 0 ),
 			ZoneName( ZoneName ),
 			Zone( Zone ),
 			ExtBoundCondName( ExtBoundCondName ),
@@ -1,3 +1,6 @@
+// C++ Headers
+#include <algorithm>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/environment.hh>
 #include <ObjexxFCL/gio.hh>
@@ -79,6 +82,61 @@ namespace DataSystemVariables {
 	std::string const cInputPath2( "input_path" ); // RunEplus.bat setting.  Full path
 	std::string const cProgramPath( "program_path" );
 	std::string const cTimingFlag( "TimingFlag" );
+	std::string const cCTFReferenceKernel( "CTFReferenceKernel" );
+	std::string const cShadowCacheFile( "ShadowCacheFile" );
+	std::string const cDaylightingCacheFile( "DaylightingCacheFile" );
+	std::string const cIDDCacheFile( "IDDCacheFile" );
+	std::string const cCTFCacheFile( "CTFCacheFile" );
+	std::string const cGlazingOpticsCacheFile( "GlazingOpticsCacheFile" );
+	std::string const cScheduleFileCacheFile( "ScheduleFileCacheFile" );
+	std::string const cRuntimeMetricsFile( "RuntimeMetricsFile" );
+	std::string const cSQLiteWriterThread( "SQLiteWriterThread" );
+	std::string const cOutputWriterThread( "OutputWriterThread" );
+	std::string const cCacheWeatherFile( "CacheWeatherFile" );
+	std::string const cAirflowNetworkSparseSolver( "AirflowNetworkSparseSolver" );
+	std::string const cAirflowNetworkJacobianReuse( "AirflowNetworkJacobianReuse" );
+	std::string const cGroundDomainPCGSolver( "GroundDomainPCGSolver" );
+	std::string const cCondFDTridiagonalSolver( "CondFDTridiagonalSolver" );
+	std::string const cIntRadScriptFUpdate( "IntRadScriptFUpdate" );
+	std::string const cWindowHeatBalanceReuse( "WindowHeatBalanceReuse" );
+	std::string const cWindowHeatBalanceBatch( "WindowHeatBalanceBatch" );
+	std::string const cEQLBeamPropertyTables( "EQLBeamPropertyTables" );
+	std::string const cWarmStartRootSolves( "WarmStartRootSolves" );
+	std::string const cReportRootSolverStatistics( "ReportRootSolverStatistics" );
+	std::string const cDXCoilSolutionReuse( "DXCoilSolutionReuse" );
+	std::string const cUserDefinedComponentMemoization( "UserDefinedComponentMemoization" );
+	std::string const cSlinkyAdaptiveQuadrature( "SlinkyAdaptiveQuadrature" );
+	std::string const cGLHEMultilevelLoadAggregation( "GLHEMultilevelLoadAggregation" );
+	std::string const cStratifiedTankImplicitSolver( "StratifiedTankImplicitSolver" );
+	std::string const cPlantHalfLoopChangeDetection( "PlantHalfLoopChangeDetection" );
+	std::string const cInsideSurfaceZoneMasking( "InsideSurfaceZoneMasking" );
+	std::string const cEagerIndependentInput( "EagerIndependentInput" );
+	std::string const cDemandManagerZoneResimulation( "DemandManagerZoneResimulation" );
+	std::string const cHVACIterationAcceleration( "HVACIterationAcceleration" );
+	std::string const cSimulationProfile( "SimulationProfile" );
+	std::string const cComponentRuntimeAccounting( "ComponentRuntimeAccounting" );
+	std::string const cHVACConvergenceTelemetry( "HVACConvergenceTelemetry" );
+	std::string const cCsvOutputDuringRun( "CsvOutputDuringRun" );
+	std::string const cVRFReusePLRBounds( "VRFReusePLRBounds" );
+	std::string const cMultiSpeedBracketSearch( "MultiSpeedBracketSearch" );
+	std::string const cControllerWarmStart( "ControllerWarmStart" );
+	std::string const cComfortWarmStart( "ComfortWarmStart" );
+	std::string const cMergeCoplanarSurfaces( "MergeCoplanarSurfaces" );
+	std::string const cZoneAggregationReport( "ZoneAggregationReport" );
+	std::string const cAdaptiveSystemTimestep( "AdaptiveSystemTimestep" );
+	std::string const cDormantHVAC( "DormantHVAC" );
+	std::string const cWarmupStateFile( "WarmupStateFile" );
+	std::string const cRadiantSysLinearCoupling( "RadiantSysLinearCoupling" );
+	std::string const cParallelEnvironments( "ParallelEnvironments" ); // Environments of the primary simulation simulated side by side
+	std::string const cEnsembleWeatherFiles( "EnsembleWeatherFiles" ); // File listing the weather files the primary simulation is also run with
+	std::string const cEnsembleProcesses( "EnsembleProcesses" ); // Weather files of the ensemble simulated at once
+	std::string const cRunPeriodSlice( "RunPeriodSlice" ); // First and last day of year of the weather file run periods simulated
+	std::string const cRunPeriodSliceOverlapDays( "RunPeriodSliceOverlapDays" ); // Days simulated ahead of the first day of the slice
+	std::string const cPsychTwbCacheSize( "PsychTwbCacheSize" ); // Entries in the wet-bulb cache
+	std::string const cPsychTwbPrecisionBits( "PsychTwbPrecisionBits" ); // Mantissa bits kept by the wet-bulb cache
+	std::string const cPsychPsatCacheSize( "PsychPsatCacheSize" ); // Entries in the saturation pressure cache
+	std::string const cPsychPsatPrecisionBits( "PsychPsatPrecisionBits" ); // Mantissa bits kept by the saturation pressure cache
+	std::string const cBCVTBBinaryProtocol( "BCVTBBinaryProtocol" ); // Offer the BCVTB server binary frames instead of text
 	std::string const TrackAirLoopEnvVar( "TRACK_AIRLOOP" ); // To generate a file with runtime statistics
 	// for each controller on each air loop
 	std::string const TraceAirLoopEnvVar( "TRACE_AIRLOOP" ); // To generate a trace file with the converged
@@ -122,6 +180,53 @@ namespace DataSystemVariables {
 	int MinReportFrequency( -2 ); // Frequency var turned into integer during get report var input.
 	bool SortedIDD( true ); // after processing, use sorted IDD to obtain Defs, etc.
 	bool lMinimalShadowing( false ); // TRUE if MinimalShadowing is to override Solar Distribution flag
+	bool CTFReferenceKernel( false ); // TRUE if the scalar per-surface CTF history sums are to be used instead of the batched kernel
+	std::string ShadowCacheFileName; // Sunlit fraction cache file, empty if shadowing results are not cached
+	std::string DaylightingCacheFileName; // Daylighting factor cache file, empty if daylighting factors are not cached
+	std::string IDDCacheFileName; // Pre-parsed data dictionary file, empty if the IDD is always parsed
+	std::string CTFCacheFileName; // Construction CTF cache file, empty if CTFs are always calculated
+	std::string GlazingOpticsCacheFileName; // Glazing system optics cache file, empty if the spectral integration is always done
+	std::string ScheduleFileCacheFileName; // Schedule:File column cache file, empty if Schedule:File files are always read as text
+	std::string RuntimeMetricsFileName; // File the live runtime metrics are written to while the simulation runs, empty if none
+	bool SQLiteWriterThread( false ); // TRUE if report data rows are written to the SQLite file from a separate thread
+	bool UseOutputWriterThread( false ); // TRUE if the eso, mtr and tabular files are written from separate threads
+	bool CacheWeatherFile( false ); // TRUE if the weather file is read into memory once and each data record parsed once
+	bool AirflowNetworkSparseSolver( false ); // TRUE if the airflow network Jacobian is factored by the sparse LDL' solver
+	bool AirflowNetworkJacobianReuse( false ); // TRUE if the airflow network Jacobian factors are kept while the pressure iterations converge well
+	bool GroundDomainPCGSolver( false ); // TRUE if the field cells of the ground heat transfer domains are solved together by conjugate gradients
+	bool CondFDTridiagonalSolver( false ); // TRUE if the interior nodes of each conduction finite difference layer are solved directly in each iteration
+	bool IntRadScriptFUpdate( false ); // TRUE if ScriptF is updated for the windows whose interior shade or blind changed instead of formed again
+	bool WindowHeatBalanceReuse( false ); // TRUE if an unshaded window reuses its last heat balance solution while its boundary conditions barely change
+	bool WindowHeatBalanceBatch( false ); // TRUE if windows of a construction whose heat balance inputs are identical share one solution
+	bool EQLBeamPropertyTables( false ); // TRUE if equivalent layer window beam properties are interpolated from tables formed at initialization
+	bool WarmStartRootSolves( false ); // TRUE if part load ratio solves start from the previous solution (heat pump water heater float mode)
+	bool ReportRootSolverStatistics( false ); // TRUE if the root solves are counted by call site for the Root Solver Summary
+	bool DXCoilSolutionReuse( false ); // TRUE if a DX coil reuses its last full load capacity and SHR solution while its inlet conditions are unchanged
+	bool UserDefinedComponentMemoization( false ); // TRUE if a user defined component skips its Erl simulation programs while its internal variables are unchanged in a system time step
+	bool SlinkyAdaptiveQuadrature( false ); // TRUE if the slinky ground heat exchanger ring integrals are found by adaptive Simpson quadrature instead of the fixed grids
+	bool GLHEMultilevelLoadAggregation( false ); // TRUE if the ground heat exchanger loads older than the hourly history are aggregated in levels of bins instead of months
+	bool StratifiedTankImplicitSolver( false ); // TRUE if the stratified water tank node temperatures are found by a backward Euler solve over the system time step instead of one second steps
+	bool PlantHalfLoopChangeDetection( false ); // TRUE if plant half loop solves are skipped in the minimum sub iterations when no plant node has changed since the last solve
+	bool InsideSurfaceZoneMasking( false ); // TRUE if the inside surface heat balance iterations stop recomputing zones whose surfaces have converged
+	bool EagerIndependentInput( false ); // TRUE if the schedules, curves and fluid properties are gotten before sizing rather than on first use
+	bool DemandManagerZoneResimulation( false ); // TRUE if demand limiting of lights and electric equipment resimulates the surface heat balance of only the zones limited
+	bool HVACIterationAcceleration( false ); // TRUE if the node temperatures and humidity ratios are extrapolated between HVAC iterations by the Aitken method
+	bool SimulationProfile( false ); // TRUE if the time spent in the main simulation routines is written as folded stacks at the end of the run
+	bool ComponentRuntimeAccounting( false ); // TRUE if the calls and time of each air loop, zone and plant component are accounted and the components taking the most time are reported
+	bool HVACConvergenceTelemetry( false ); // TRUE if the iteration counts of each HVAC system time step are written to the HVACConvergence table of the SQLite output
+	bool CsvOutputDuringRun( false ); // TRUE if eplusout.csv and eplusmtr.csv are written as the simulation runs instead of by ReadVarsESO afterwards
+	bool VRFReusePLRBounds( false ); // TRUE if the VRF terminal unit part load ratio solution reuses the outputs found at part load ratios 0 and 1
+	bool MultiSpeedBracketSearch( false ); // TRUE if multispeed units bracket the speed meeting the load instead of trying each speed in turn
+	bool ControllerWarmStart( false ); // TRUE if the water coil controllers start from the solution of the previous HVAC step and bracket the root around it
+	bool ComfortWarmStart( false ); // TRUE if the clothing surface temperature of the Fanger model for comfort control starts from that of the previous evaluation
+	bool MergeCoplanarSurfaces( false ); // TRUE if coplanar base surfaces of a zone with the same construction and exterior condition are merged into one surface
+	bool ZoneAggregationReport( false ); // TRUE if the zones alike enough to be simulated as one zone with a multiplier are reported
+	bool AdaptiveSystemTimestep( false ); // TRUE if the system timestep is resized within a zone timestep from the zone temperature change of each system timestep
+	bool DormantHVAC( false ); // Skip the HVAC solution while no system is available or has flow
+	bool RadiantSysLinearCoupling( false ); // TRUE if the low temperature radiant systems take their trial surface temperatures from the linearized surface heat balance instead of resimulating the zone
+	bool BCVTBBinaryProtocol( false ); // TRUE if the values are exchanged with the BCVTB server as binary frames once the server accepts them
+	bool MemoryUsageReport( false ); // TRUE if the memory of the main arrays by module is reported after the initialization and at peak (--memory-report)
+	std::string WarmupStateFileName; // Converged warmup state file, empty if warmup always starts from the initial conditions
 	std::string TempFullFileName;
 	std::string envinputpath1;
 	std::string envinputpath2;
@@ -137,6 +242,14 @@ namespace DataSystemVariables {
 	bool lnumActiveSims( false );
 	int MaxNumberOfThreads( 1 );
 	int NumberIntRadThreads( 1 );
+	int NumberInsideSurfThreads( 1 ); // threads used for the partitioned inside surface heat balance sweep
+	int NumberShadowThreads( 1 ); // threads used for the hourly sun positions of the shadowing calculations
+	int NumberDaylightingThreads( 1 ); // threads used for the illuminance map point daylighting factors
+	int NumberBSDFThreads( 1 ); // threads used for the complex fenestration window geometry
+	int NumberGLHEThreads( 1 ); // threads used for the g-functions of the vertical ground heat exchanger arrays
+	int NumberZoneSumsThreads( 1 ); // threads used for the zone heat balance sums of the predictor and corrector
+	int MaxParallelEnvironments( 1 ); // environments of the primary simulation simulated at once by forked workers
+	int MaxEnsembleProcesses( 1 ); // weather files of the ensemble simulated at once, by this process and forked members
 	int iNominalTotSurfaces( 0 );
 	bool Threading( false );
 
@@ -287,6 +400,47 @@ namespace DataSystemVariables {
 
 	}
 
+	void
+	SetParallelThreads( int const NumThreads ) // Threads every parallel feature may use
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       DATE WRITTEN   October 2026
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the thread count of every parallel feature.  The features all run their loops through
+		// the one OpenMP runtime, so CheckThreading and the forked environment workers set the counts
+		// here together rather than feature by feature.
+
+		NumberIntRadThreads = NumThreads;
+		NumberInsideSurfThreads = NumThreads;
+		NumberShadowThreads = NumThreads;
+		NumberDaylightingThreads = NumThreads;
+		NumberBSDFThreads = NumThreads;
+		NumberGLHEThreads = NumThreads;
+		NumberZoneSumsThreads = NumThreads;
+
+	}
+
+	int
+	ParallelLoopThreads(
+		int const FeatureThreads, // Threads set for the feature (NumberShadowThreads etc.)
+		int const NumItems, // Iterations of the loop
+		int const MinItemsPerThread // Fewest iterations worth a thread of their own
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       DATE WRITTEN   October 2026
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the threads a parallel loop of the feature should use: no more than the feature is
+		// allowed, no more than gives each thread MinItemsPerThread iterations, and at least one.
+
+		return std::max( 1, std::min( FeatureThreads, NumItems / MinItemsPerThread ) );
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
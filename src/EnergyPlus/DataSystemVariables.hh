@@ -48,6 +48,61 @@ namespace DataSystemVariables {
 	extern std::string const cInputPath2; // RunEplus.bat setting.  Full path
 	extern std::string const cProgramPath;
 	extern std::string const cTimingFlag;
+	extern std::string const cCTFReferenceKernel;
+	extern std::string const cShadowCacheFile;
+	extern std::string const cDaylightingCacheFile;
+	extern std::string const cIDDCacheFile;
+	extern std::string const cCTFCacheFile;
+	extern std::string const cGlazingOpticsCacheFile;
+	extern std::string const cScheduleFileCacheFile;
+	extern std::string const cRuntimeMetricsFile;
+	extern std::string const cSQLiteWriterThread;
+	extern std::string const cOutputWriterThread;
+	extern std::string const cCacheWeatherFile;
+	extern std::string const cAirflowNetworkSparseSolver;
+	extern std::string const cAirflowNetworkJacobianReuse;
+	extern std::string const cGroundDomainPCGSolver;
+	extern std::string const cCondFDTridiagonalSolver;
+	extern std::string const cIntRadScriptFUpdate;
+	extern std::string const cWindowHeatBalanceReuse;
+	extern std::string const cWindowHeatBalanceBatch;
+	extern std::string const cEQLBeamPropertyTables;
+	extern std::string const cWarmStartRootSolves;
+	extern std::string const cReportRootSolverStatistics;
+	extern std::string const cDXCoilSolutionReuse;
+	extern std::string const cUserDefinedComponentMemoization;
+	extern std::string const cSlinkyAdaptiveQuadrature;
+	extern std::string const cGLHEMultilevelLoadAggregation;
+	extern std::string const cStratifiedTankImplicitSolver;
+	extern std::string const cPlantHalfLoopChangeDetection;
+	extern std::string const cInsideSurfaceZoneMasking;
+	extern std::string const cEagerIndependentInput;
+	extern std::string const cDemandManagerZoneResimulation;
+	extern std::string const cHVACIterationAcceleration;
+	extern std::string const cSimulationProfile;
+	extern std::string const cComponentRuntimeAccounting;
+	extern std::string const cHVACConvergenceTelemetry;
+	extern std::string const cCsvOutputDuringRun;
+	extern std::string const cVRFReusePLRBounds;
+	extern std::string const cMultiSpeedBracketSearch;
+	extern std::string const cControllerWarmStart;
+	extern std::string const cComfortWarmStart;
+	extern std::string const cMergeCoplanarSurfaces;
+	extern std::string const cZoneAggregationReport;
+	extern std::string const cAdaptiveSystemTimestep;
+	extern std::string const cDormantHVAC;
+	extern std::string const cWarmupStateFile;
+	extern std::string const cRadiantSysLinearCoupling;
+	extern std::string const cParallelEnvironments;
+	extern std::string const cEnsembleWeatherFiles;
+	extern std::string const cEnsembleProcesses;
+	extern std::string const cRunPeriodSlice;
+	extern std::string const cRunPeriodSliceOverlapDays;
+	extern std::string const cPsychTwbCacheSize;
+	extern std::string const cPsychTwbPrecisionBits;
+	extern std::string const cPsychPsatCacheSize;
+	extern std::string const cPsychPsatPrecisionBits;
+	extern std::string const cBCVTBBinaryProtocol;
 	extern std::string const TrackAirLoopEnvVar; // To generate a file with runtime statistics
 	// for each controller on each air loop
 	extern std::string const TraceAirLoopEnvVar; // To generate a trace file with the converged
@@ -91,6 +146,53 @@ namespace DataSystemVariables {
 	extern int MinReportFrequency; // Frequency var turned into integer during get report var input.
 	extern bool SortedIDD; // after processing, use sorted IDD to obtain Defs, etc.
 	extern bool lMinimalShadowing; // TRUE if MinimalShadowing is to override Solar Distribution flag
+	extern bool CTFReferenceKernel; // TRUE if the scalar per-surface CTF history sums are to be used instead of the batched kernel
+	extern std::string ShadowCacheFileName; // Sunlit fraction cache file, empty if shadowing results are not cached
+	extern std::string DaylightingCacheFileName; // Daylighting factor cache file, empty if daylighting factors are not cached
+	extern std::string IDDCacheFileName; // Pre-parsed data dictionary file, empty if the IDD is always parsed
+	extern std::string CTFCacheFileName; // Construction CTF cache file, empty if CTFs are always calculated
+	extern std::string GlazingOpticsCacheFileName; // Glazing system optics cache file, empty if the spectral integration is always done
+	extern std::string ScheduleFileCacheFileName; // Schedule:File column cache file, empty if Schedule:File files are always read as text
+	extern std::string RuntimeMetricsFileName; // File the live runtime metrics are written to while the simulation runs, empty if none
+	extern bool SQLiteWriterThread; // TRUE if report data rows are written to the SQLite file from a separate thread
+	extern bool UseOutputWriterThread; // TRUE if the eso, mtr and tabular files are written from separate threads
+	extern bool CacheWeatherFile; // TRUE if the weather file is read into memory once and each data record parsed once
+	extern bool AirflowNetworkSparseSolver; // TRUE if the airflow network Jacobian is factored by the sparse LDL' solver
+	extern bool AirflowNetworkJacobianReuse; // TRUE if the airflow network Jacobian factors are kept while the pressure iterations converge well
+	extern bool GroundDomainPCGSolver; // TRUE if the field cells of the ground heat transfer domains are solved together by conjugate gradients
+	extern bool CondFDTridiagonalSolver; // TRUE if the interior nodes of each conduction finite difference layer are solved directly in each iteration
+	extern bool IntRadScriptFUpdate; // TRUE if ScriptF is updated for the windows whose interior shade or blind changed instead of formed again
+	extern bool WindowHeatBalanceReuse; // TRUE if an unshaded window reuses its last heat balance solution while its boundary conditions barely change
+	extern bool WindowHeatBalanceBatch; // TRUE if windows of a construction whose heat balance inputs are identical share one solution
+	extern bool EQLBeamPropertyTables; // TRUE if equivalent layer window beam properties are interpolated from tables formed at initialization
+	extern bool WarmStartRootSolves; // TRUE if part load ratio solves start from the previous solution (heat pump water heater float mode)
+	extern bool ReportRootSolverStatistics; // TRUE if the root solves are counted by call site for the Root Solver Summary
+	extern bool DXCoilSolutionReuse; // TRUE if a DX coil reuses its last full load capacity and SHR solution while its inlet conditions are unchanged
+	extern bool UserDefinedComponentMemoization; // TRUE if a user defined component skips its Erl simulation programs while its internal variables are unchanged in a system time step
+	extern bool SlinkyAdaptiveQuadrature; // TRUE if the slinky ground heat exchanger ring integrals are found by adaptive Simpson quadrature instead of the fixed grids
+	extern bool GLHEMultilevelLoadAggregation; // TRUE if the ground heat exchanger loads older than the hourly history are aggregated in levels of bins instead of months
+	extern bool StratifiedTankImplicitSolver; // TRUE if the stratified water tank node temperatures are found by a backward Euler solve over the system time step instead of one second steps
+	extern bool PlantHalfLoopChangeDetection; // TRUE if plant half loop solves are skipped in the minimum sub iterations when no plant node has changed since the last solve
+	extern bool InsideSurfaceZoneMasking; // TRUE if the inside surface heat balance iterations stop recomputing zones whose surfaces have converged
+	extern bool EagerIndependentInput; // TRUE if the schedules, curves and fluid properties are gotten before sizing rather than on first use
+	extern bool DemandManagerZoneResimulation; // TRUE if demand limiting of lights and electric equipment resimulates the surface heat balance of only the zones limited
+	extern bool HVACIterationAcceleration; // TRUE if the node temperatures and humidity ratios are extrapolated between HVAC iterations by the Aitken method
+	extern bool SimulationProfile; // TRUE if the time spent in the main simulation routines is written as folded stacks at the end of the run
+	extern bool ComponentRuntimeAccounting; // TRUE if the calls and time of each air loop, zone and plant component are accounted and the components taking the most time are reported
+	extern bool HVACConvergenceTelemetry; // TRUE if the iteration counts of each HVAC system time step are written to the HVACConvergence table of the SQLite output
+	extern bool CsvOutputDuringRun; // TRUE if eplusout.csv and eplusmtr.csv are written as the simulation runs instead of by ReadVarsESO afterwards
+	extern bool VRFReusePLRBounds; // TRUE if the VRF terminal unit part load ratio solution reuses the outputs found at part load ratios 0 and 1
+	extern bool MultiSpeedBracketSearch; // TRUE if multispeed units bracket the speed meeting the load instead of trying each speed in turn
+	extern bool ControllerWarmStart; // TRUE if the water coil controllers start from the solution of the previous HVAC step and bracket the root around it
+	extern bool ComfortWarmStart; // TRUE if the clothing surface temperature of the Fanger model for comfort control starts from that of the previous evaluation
+	extern bool MergeCoplanarSurfaces; // TRUE if coplanar base surfaces of a zone with the same construction and exterior condition are merged into one surface
+	extern bool ZoneAggregationReport; // TRUE if the zones alike enough to be simulated as one zone with a multiplier are reported
+	extern bool AdaptiveSystemTimestep; // TRUE if the system timestep is resized within a zone timestep from the zone temperature change of each system timestep
+	extern bool DormantHVAC; // Skip the HVAC solution while no system is available or has flow
+	extern bool RadiantSysLinearCoupling; // TRUE if the low temperature radiant systems take their trial surface temperatures from the linearized surface heat balance instead of resimulating the zone
+	extern bool BCVTBBinaryProtocol; // TRUE if the values are exchanged with the BCVTB server as binary frames once the server accepts them
+	extern bool MemoryUsageReport; // TRUE if the memory of the main arrays by module is reported after the initialization and at peak (--memory-report)
+	extern std::string WarmupStateFileName; // Converged warmup state file, empty if warmup always starts from the initial conditions
 	extern std::string TempFullFileName;
 	extern std::string envinputpath1;
 	extern std::string envinputpath2;
@@ -106,6 +208,14 @@ namespace DataSystemVariables {
 	extern bool lnumActiveSims;
 	extern int MaxNumberOfThreads;
 	extern int NumberIntRadThreads;
+	extern int NumberInsideSurfThreads;
+	extern int NumberShadowThreads;
+	extern int NumberDaylightingThreads;
+	extern int NumberBSDFThreads;
+	extern int NumberGLHEThreads;
+	extern int NumberZoneSumsThreads;
+	extern int MaxParallelEnvironments;
+	extern int MaxEnsembleProcesses;
 	extern int iNominalTotSurfaces;
 	extern bool Threading;
 
@@ -118,6 +228,16 @@ namespace DataSystemVariables {
 		std::string & CheckedFileName // Blank if not found.
 	);
 
+	void
+	SetParallelThreads( int const NumThreads ); // Threads every parallel feature may use
+
+	int
+	ParallelLoopThreads(
+		int const FeatureThreads, // Threads set for the feature (NumberShadowThreads etc.)
+		int const NumItems, // Iterations of the loop
+		int const MinItemsPerThread = 1 // Fewest iterations worth a thread of their own
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -38,10 +38,14 @@ namespace DataViewFactorInformation {
 		Array1D< Real64 > Tilt; // Tilt angle of the surface (in degrees)
 		Array1D_int SurfacePtr; // Surface ALLOCATABLE (to Surface derived type)
 		Array1D_string Class; // Class of surface (Wall, Roof, etc.)
+		Array2D< Real64 > Cinverse; // Inverse of the ScriptF partial radiosity matrix, kept for updates (IntRadScriptFUpdate only)
+		Array1D< Real64 > CinverseEmissivity; // Surface emissivities Cinverse is for
+		int NumScriptFUpdates; // Updates of Cinverse since it was last formed from scratch
 
 		// Default Constructor
 		ZoneViewFactorInformation() :
-			NumOfSurfaces( 0 )
+			NumOfSurfaces( 0 ),
+			NumScriptFUpdates( 0 )
 		{}
 
 		// Member Constructor
@@ -66,7 +70,8 @@ namespace DataViewFactorInformation {
 			Azimuth( Azimuth ),
 			Tilt( Tilt ),
 			SurfacePtr( SurfacePtr ),
-			Class( Class )
+			Class( Class ),
+			NumScriptFUpdates( 0 )
 		{}
 
 	};
@@ -58,6 +58,7 @@ namespace DataWindowEquivalentLayer {
 	Array1D< CFSLAYER > CFSLayers;
 	Array1D< CFSTY > CFS;
 	Array1D< CFSGAP > CFSGaps;
+	Array1D< CFSBEAMTAB > CFSBeamTable; // Beam property table of each CFS (EQLBeamPropertyTables only)
 
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
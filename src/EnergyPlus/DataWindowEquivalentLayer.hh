@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array4D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -360,11 +361,35 @@ namespace DataWindowEquivalentLayer {
 
 	};
 
+	struct CFSBEAMTAB
+	{
+		// Beam absorptances and transmittance of a CFS tabulated by incidence angle and, with
+		// venetian blind layers, by the profile angle passed on for them
+
+		// Members
+		bool Tabulated; // True if the CFS beam properties are taken from the table
+		int ProfAxis; // 0: no profile angle axis, 1: vertical profile angle, 2: horizontal profile angle
+		int NInc; // Number of incidence angles, from 0 to 90 deg
+		int NProf; // Number of profile angles, from -90 to 90 deg
+		Array4D< Real64 > Abs; // Front and back absorptances of each layer, transmittance after the last
+		//  layer, (front or back, layer, incidence angle, profile angle)
+
+		// Default Constructor
+		CFSBEAMTAB() :
+			Tabulated( false ),
+			ProfAxis( 0 ),
+			NInc( 0 ),
+			NProf( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern CFSSWP SWP_ROOMBLK; // Solar reflectance, BEAM-BEAM, front | Solar reflectance, BEAM-BEAM, back | Solar transmittance, BEAM-BEAM, front | Solar transmittance, BEAM-BEAM, back | Solar reflectance, BEAM-DIFFUSE, front | Solar reflectance, BEAM-DIFFUSE, back | Solar transmittance, BEAM-DIFFUSE, front | Solar transmittance, BEAM-DIFFUSE, back | Solar reflectance, DIFFUSE-DIFFUSE, front | Solar reflectance, DIFFUSE-DIFFUSE, back | Solar transmittance, DIFFUSE-DIFFUSE
 	extern Array1D< CFSLAYER > CFSLayers;
 	extern Array1D< CFSTY > CFS;
 	extern Array1D< CFSGAP > CFSGaps;
+	extern Array1D< CFSBEAMTAB > CFSBeamTable; // Beam property table of each CFS (EQLBeamPropertyTables only)
 
 } // DataWindowEquivalentLayer
 
@@ -1,7 +1,12 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <tuple>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -34,9 +39,11 @@
 #include <InternalHeatGains.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <Profiler.hh>
 #include <ScheduleManager.hh>
 #include <SolarReflectionManager.hh>
 #include <SQLiteProcedures.hh>
+#include <SurfaceBVH.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -108,15 +115,16 @@ namespace DaylightingManager {
 	// Data
 	// MODULE PARAMETER DEFINITIONS:
 	static std::string const BlankString;
+	static std::string const DaylightingCacheMagic( "EPDLTC03" ); // File signature and format version of the cache file
 
 	// MODULE VARIABLE DECLARATIONS:
 	int TotWindowsWithDayl( 0 ); // Total number of exterior windows in all daylit zones
 	int OutputFileDFS( 0 ); // Unit number for daylight factors
 	Array1D< Real64 > DaylIllum( MaxRefPoints, 0.0 ); // Daylight illuminance at reference points (lux)
-	Real64 PHSUN( 0.0 ); // Solar altitude (radians)
-	Real64 SPHSUN( 0.0 ); // Sine of solar altitude
-	Real64 CPHSUN( 0.0 ); // Cosine of solar altitude
-	Real64 THSUN( 0.0 ); // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+	EP_THREAD_LOCAL Real64 PHSUN( 0.0 ); // Solar altitude (radians)
+	EP_THREAD_LOCAL Real64 SPHSUN( 0.0 ); // Sine of solar altitude
+	EP_THREAD_LOCAL Real64 CPHSUN( 0.0 ); // Cosine of solar altitude
+	EP_THREAD_LOCAL Real64 THSUN( 0.0 ); // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
 	Array1D< Real64 > PHSUNHR( 24, 0.0 ); // Hourly values of PHSUN
 	Array1D< Real64 > SPHSUNHR( 24, 0.0 ); // Hourly values of the sine of PHSUN
 	Array1D< Real64 > CPHSUNHR( 24, 0.0 ); // Hourly values of the cosine of PHSUN
@@ -126,24 +134,24 @@ namespace DaylightingManager {
 	// I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
 	// J = 1 for bare window, 2 - 12 for shaded;
 	// K = sun position index.
-	Array3D< Real64 > EINTSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related portion of internally reflected illuminance
-	Array2D< Real64 > EINTSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance,
+	EP_THREAD_LOCAL Array3D< Real64 > EINTSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related portion of internally reflected illuminance
+	EP_THREAD_LOCAL Array2D< Real64 > EINTSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance,
 	// excluding entering beam
-	Array2D< Real64 > EINTSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance
+	EP_THREAD_LOCAL Array2D< Real64 > EINTSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance
 	// due to entering beam
-	Array3D< Real64 > WLUMSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related window luminance
-	Array2D< Real64 > WLUMSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, excluding view of solar disk
-	Array2D< Real64 > WLUMSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, due to view of solar disk
+	EP_THREAD_LOCAL Array3D< Real64 > WLUMSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related window luminance
+	EP_THREAD_LOCAL Array2D< Real64 > WLUMSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, excluding view of solar disk
+	EP_THREAD_LOCAL Array2D< Real64 > WLUMSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, due to view of solar disk
 
 	Array2D< Real64 > GILSK( 24, 4, 0.0 ); // Horizontal illuminance from sky, by sky type, for each hour of the day
 	Array1D< Real64 > GILSU( 24, 0.0 ); // Horizontal illuminance from sun for each hour of the day
 
-	Array3D< Real64 > EDIRSK( 24, MaxSlatAngs+1, 4 ); // Sky-related component of direct illuminance
-	Array2D< Real64 > EDIRSU( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-	Array2D< Real64 > EDIRSUdisk( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance due to beam solar at ref pt
-	Array3D< Real64 > AVWLSK( 24, MaxSlatAngs+1, 4 ); // Sky-related average window luminance
-	Array2D< Real64 > AVWLSU( 24, MaxSlatAngs+1 ); // Sun-related average window luminance, excluding view of solar disk
-	Array2D< Real64 > AVWLSUdisk( 24, MaxSlatAngs+1 ); // Sun-related average window luminance due to view of solar disk
+	EP_THREAD_LOCAL Array3D< Real64 > EDIRSK( 24, MaxSlatAngs+1, 4 ); // Sky-related component of direct illuminance
+	EP_THREAD_LOCAL Array2D< Real64 > EDIRSU( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+	EP_THREAD_LOCAL Array2D< Real64 > EDIRSUdisk( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance due to beam solar at ref pt
+	EP_THREAD_LOCAL Array3D< Real64 > AVWLSK( 24, MaxSlatAngs+1, 4 ); // Sky-related average window luminance
+	EP_THREAD_LOCAL Array2D< Real64 > AVWLSU( 24, MaxSlatAngs+1 ); // Sun-related average window luminance, excluding view of solar disk
+	EP_THREAD_LOCAL Array2D< Real64 > AVWLSUdisk( 24, MaxSlatAngs+1 ); // Sun-related average window luminance due to view of solar disk
 
 	// Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -158,6 +166,9 @@ namespace DaylightingManager {
 
 	std::string mapLine; // character variable to hold map outputs
 
+	// Object Data
+	DaylightingCacheData DaylightingCache;
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE DaylightingModule
 
 	// MODULE SUBROUTINES:
@@ -464,11 +475,15 @@ namespace DaylightingManager {
 		static gio::Fmt Format_700( "('! <Sky Daylight Factors>, MonthAndDay, Zone Name, Window Name, Daylight Fac: Ref Pt #1, Daylight Fac: Ref Pt #2')" );
 
 		// FLOW:
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "CalcDayltgCoefficients" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		if ( firstTime ) {
 			GetDaylightingParametersInput();
 			CheckTDDsAndLightShelvesInDaylitZones();
 			firstTime = false;
 			if ( allocated( CheckTDDZone ) ) CheckTDDZone.deallocate();
+			if ( ! DataSystemVariables::DaylightingCacheFileName.empty() ) InitDaylightingCache( DataSystemVariables::DaylightingCacheFileName );
 		} // End of check if firstTime
 
 		// Find the total number of exterior windows associated with all Daylighting:Detailed zones.
@@ -608,7 +623,17 @@ namespace DaylightingManager {
 			// Skip zones with no exterior windows in the zone or in adjacent zone with which an interior window is shared
 			if ( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins == 0 ) continue;
 
-			CalcDayltgCoeffsRefMapPoints( ZoneNum );
+			if ( DaylightingCacheUsable( ZoneNum ) ) {
+				// The window geometry set up by the first calculation of the zone is not cached
+				bool const IncludeMaps( ! DoingSizing && ! KickOffSimulation && ZoneDaylight( ZoneNum ).MapCount > 0 );
+				if ( ! DaylightingCache.ZoneCalculated( ZoneNum ) || ! RestoreDayltgCoeffsFromCache( ZoneNum, IncludeMaps ) ) {
+					CalcDayltgCoeffsRefMapPoints( ZoneNum );
+					DaylightingCache.ZoneCalculated( ZoneNum ) = true;
+					SaveDayltgCoeffsToCache( ZoneNum, IncludeMaps );
+				}
+			} else {
+				CalcDayltgCoeffsRefMapPoints( ZoneNum );
+			}
 
 		} // End of zone loop, ZoneNum
 
@@ -652,6 +677,14 @@ namespace DaylightingManager {
 							}
 						}
 					}
+#ifdef EP_DAYLIGHTING_FLOAT_FACTORS
+					// Error of the factors stored in single precision against the factors as calculated
+					gio::write( OutputFileInits, fmtA ) << "! <Daylighting Factor Precision>, Zone Name, Storage, Largest Relative Error {ppm}";
+					for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+						if ( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins == 0 ) continue;
+						gio::write( OutputFileInits, fmtA ) << " Daylighting Factor Precision," + Zone( ZoneNum ).Name + ",Single," + RoundSigDigits( 1.0e6 * ZoneDaylight( ZoneNum ).MaxFactorRoundingError, 4 );
+					}
+#endif
 					FirstTimeDaylFacCalc = false;
 					doSkyReporting = false;
 				}
@@ -762,6 +795,369 @@ namespace DaylightingManager {
 
 	}
 
+	void
+	DaylightingCacheHash(
+		std::uint64_t & Hash, // Running hash
+		void const * Data, // Bytes to add
+		std::size_t const NumBytes // Number of bytes
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a block of bytes to a running 64 bit FNV-1a hash.
+
+		unsigned char const * Bytes( static_cast< unsigned char const * >( Data ) );
+		for ( std::size_t i = 0; i < NumBytes; ++i ) {
+			Hash ^= Bytes[ i ];
+			Hash *= 1099511628211ull; // FNV prime
+		}
+
+	}
+
+	std::uint64_t
+	DaylightingInputHash()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns a hash of the input the daylighting factors depend on other than the sun
+		// positions: building geometry, constructions and materials, window shading, daylighting
+		// and illuminance map objects, and the (constant) transmittance of shading surfaces.
+
+		// METHODOLOGY EMPLOYED:
+		// The IDF records of the relevant object classes are hashed field by field, followed by
+		// the resulting surface vertices and zone window lists as a check on the processed input.
+
+		// Using/Aliasing
+		using InputProcessor::IDFRecords;
+		using InputProcessor::NumIDFRecords;
+		using InputProcessor::MakeUPPERCase;
+		using ScheduleManager::GetScheduleMaxValue;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::vector< std::string > const ExactClasses( { "BUILDING", "ZONE", "ZONELIST", "GLOBALGEOMETRYRULES", "GEOMETRYTRANSFORM", "INTERNALMASS", "SHADOWCALCULATION", "SITE:LOCATION" } );
+		static std::vector< std::string > const ClassPrefixes( { "BUILDINGSURFACE:", "FENESTRATIONSURFACE:", "WALL:", "ROOFCEILING:", "FLOOR:", "ROOF", "CEILING:", "WINDOW", "DOOR", "GLAZEDDOOR", "SHADING:", "SHADINGPROPERTY:", "MATERIAL", "CONSTRUCTION", "DAYLIGHTING:", "DAYLIGHTINGDEVICE:", "OUTPUT:ILLUMINANCEMAP", "OUTPUTCONTROL:ILLUMINANCEMAP", "SITE:GROUNDREFLECTANCE" } );
+
+		std::uint64_t Hash( 14695981039346656037ull ); // FNV offset basis
+		DaylightingCacheHash( Hash, DaylightingCacheMagic.data(), DaylightingCacheMagic.size() );
+
+		for ( int RecNum = 1; RecNum <= NumIDFRecords; ++RecNum ) {
+			auto const & rec( IDFRecords( RecNum ) );
+			std::string const ClassName( MakeUPPERCase( rec.Name ) );
+			bool Relevant( false );
+			for ( auto const & Name : ExactClasses ) {
+				if ( ClassName == Name ) Relevant = true;
+			}
+			for ( auto const & Prefix : ClassPrefixes ) {
+				if ( ClassName.compare( 0, Prefix.size(), Prefix ) == 0 ) Relevant = true;
+			}
+			if ( ! Relevant ) continue;
+			DaylightingCacheHash( Hash, ClassName.data(), ClassName.size() + 1 );
+			for ( int Field = 1; Field <= rec.NumAlphas; ++Field ) {
+				DaylightingCacheHash( Hash, rec.Alphas( Field ).c_str(), rec.Alphas( Field ).size() + 1 );
+			}
+			for ( int Field = 1; Field <= rec.NumNumbers; ++Field ) {
+				DaylightingCacheHash( Hash, &rec.Numbers( Field ), sizeof( Real64 ) );
+			}
+		}
+
+		std::vector< Real64 > Geom;
+		Geom.reserve( 16 * TotSurfaces + 8 );
+		Geom.push_back( TotSurfaces );
+		Geom.push_back( NumOfZones );
+		Geom.push_back( TotIllumMaps );
+		Geom.push_back( MaxSlatAngs );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			Geom.push_back( surface.Class );
+			Geom.push_back( surface.Construction );
+			Geom.push_back( surface.Sides );
+			for ( int Vert = 1; Vert <= surface.Sides; ++Vert ) {
+				Geom.push_back( surface.Vertex( Vert ).x );
+				Geom.push_back( surface.Vertex( Vert ).y );
+				Geom.push_back( surface.Vertex( Vert ).z );
+			}
+			if ( surface.SchedShadowSurfIndex > 0 ) Geom.push_back( GetScheduleMaxValue( surface.SchedShadowSurfIndex ) );
+		}
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			Geom.push_back( ZoneDaylight( ZoneNum ).TotalDaylRefPoints );
+			Geom.push_back( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins );
+			for ( int loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
+				Geom.push_back( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop ) );
+			}
+		}
+		DaylightingCacheHash( Hash, Geom.data(), Geom.size() * sizeof( Real64 ) );
+		return Hash;
+
+	}
+
+	void
+	InitDaylightingCache( std::string const & FileName ) // Cache file name, empty for no cache
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the daylighting factor cache file and indexes the records it already holds.
+
+		// METHODOLOGY EMPLOYED:
+		// Same layout as the sunlit fraction cache: a signature and the input hash, then appended
+		// records of the zone, the sun key and the zone's factor arrays in DaylightingCacheArrays
+		// order.  A file written for other input (or unreadable) is started over.
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		DaylightingCache.Active = false;
+		DaylightingCache.Index.clear();
+		DaylightingCache.NumHits = 0;
+		DaylightingCache.NumMisses = 0;
+		DaylightingCache.ZoneCalculated.dimension( NumOfZones, false );
+		if ( DaylightingCache.File.is_open() ) DaylightingCache.File.close();
+		if ( FileName.empty() ) return;
+
+		DaylightingCache.FileName = FileName;
+		DaylightingCache.InputHash = DaylightingInputHash();
+
+		// Try the existing file first
+		bool Valid( false );
+		DaylightingCache.File.open( FileName, std::ios::in | std::ios::out | std::ios::binary );
+		if ( DaylightingCache.File.is_open() ) {
+			char Magic[ 8 ];
+			std::uint64_t Hash( 0u );
+			DaylightingCache.File.read( Magic, 8 );
+			DaylightingCache.File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+			Valid = DaylightingCache.File.good() && ( std::string( Magic, 8 ) == DaylightingCacheMagic ) && ( Hash == DaylightingCache.InputHash );
+			while ( Valid ) { // Index the records
+				std::streamoff const Offset( DaylightingCache.File.tellg() );
+				int Head[ 3 ]; // Zone, maps included, number of values
+				std::uint64_t SunKey( 0u );
+				DaylightingCache.File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+				if ( DaylightingCache.File.gcount() == 0 && DaylightingCache.File.eof() ) break; // End of file
+				DaylightingCache.File.read( reinterpret_cast< char * >( &SunKey ), sizeof( SunKey ) );
+				if ( ! DaylightingCache.File.good() || Head[ 0 ] < 1 || Head[ 0 ] > NumOfZones ) {
+					Valid = false; // Truncated or foreign record
+					break;
+				}
+				DaylightingCache.File.seekg( std::streamoff( Head[ 2 ] ) * sizeof( Real64 ), std::ios::cur );
+				DaylightingCache.File.peek(); // Sets eof if the record was cut short
+				if ( DaylightingCache.File.fail() ) {
+					Valid = false;
+					break;
+				}
+				DaylightingCache.Index[ std::make_tuple( Head[ 0 ], Head[ 1 ], SunKey ) ] = Offset;
+			}
+			DaylightingCache.File.clear();
+			if ( ! Valid ) DaylightingCache.File.close();
+		}
+
+		if ( ! Valid ) { // Start a new file for this input
+			DaylightingCache.Index.clear();
+			DaylightingCache.File.open( FileName, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc );
+			if ( ! DaylightingCache.File.is_open() ) {
+				ShowWarningError( "InitDaylightingCache: Could not open daylighting factor cache file \"" + FileName + "\"; daylighting factors are calculated without the cache." );
+				return;
+			}
+			std::uint64_t const Hash( DaylightingCache.InputHash );
+			DaylightingCache.File.write( DaylightingCacheMagic.c_str(), 8 );
+			DaylightingCache.File.write( reinterpret_cast< char const * >( &Hash ), sizeof( Hash ) );
+			DaylightingCache.File.flush();
+		}
+
+		DaylightingCache.Active = DaylightingCache.File.good();
+		if ( DaylightingCache.Active ) {
+			ShowMessage( "InitDaylightingCache: Using daylighting factor cache file \"" + FileName + "\" with " + TrimSigDigits( int( DaylightingCache.Index.size() ) ) + " cached zone calculations." );
+		}
+
+	}
+
+	bool
+	DaylightingCacheUsable( int const ZoneNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the daylighting factors of the zone can be taken from the cache.
+
+		// METHODOLOGY EMPLOYED:
+		// The cache holds the factor arrays only, so zones whose calculation has other effects or
+		// depends on more than the sun positions are always calculated: see
+		// DayltgZoneHasSharedWindowState, timestep integrated solar, and shading surfaces with
+		// scheduled transmittance.
+
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSolarTimestepIntegration;
+
+		if ( ! DaylightingCache.Active ) return false;
+		if ( DetailedSolarTimestepIntegration || ShadingTransmittanceVaries ) return false;
+		return ! DayltgZoneHasSharedWindowState( ZoneNum );
+
+	}
+
+	bool
+	DayltgZoneHasSharedWindowState( int const ZoneNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the daylighting factor calculation of the zone updates state held by its
+		// windows rather than only the zone and map factor arrays.
+
+		// METHODOLOGY EMPLOYED:
+		// Windows seen through tubular daylighting devices accumulate the TDD fluxes and
+		// complex fenestration windows keep their BSDF daylighting geometry.
+
+		for ( int loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
+			int const IWin( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop ) );
+			if ( SurfaceWindow( IWin ).OriginalClass == SurfaceClass_TDD_Diffuser ) return true;
+			if ( SurfaceWindow( IWin ).WindowModelType == WindowBSDFModel ) return true;
+		}
+		return false;
+
+	}
+
+	std::uint64_t
+	DaylightingCacheSunKey()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the cache key of the current daylighting factor calculation.
+
+		// METHODOLOGY EMPLOYED:
+		// Hash of the hourly sun directions, exterior horizontal illuminances, ground reflectance
+		// and storm window states the factors were calculated for.
+
+		std::uint64_t Hash( 14695981039346656037ull ); // FNV offset basis
+		DaylightingCacheHash( Hash, SUNCOSHR.data(), SUNCOSHR.size() * sizeof( Real64 ) );
+		DaylightingCacheHash( Hash, GILSK.data(), GILSK.size() * sizeof( Real64 ) );
+		DaylightingCacheHash( Hash, GILSU.data(), GILSU.size() * sizeof( Real64 ) );
+		DaylightingCacheHash( Hash, &GndReflectanceForDayltg, sizeof( Real64 ) );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( Surface( SurfNum ).Class != SurfaceClass_Window ) continue;
+			DaylightingCacheHash( Hash, &SurfaceWindow( SurfNum ).StormWinFlag, sizeof( int ) );
+		}
+		return Hash;
+
+	}
+
+	void
+	DaylightingCacheArrays(
+		int const ZoneNum,
+		bool const IncludeMaps, // True if the zone's illuminance map factors are included
+		std::vector< Array< Real64 > * > & Arrays, // Solid angle arrays
+		std::vector< Array< DaylFactorType > * > & FactorArrays // Daylighting and glare factor arrays
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the arrays a daylighting factor calculation of the zone sets, in cache record order:
+		// the solid angle arrays, then the factor arrays.
+
+		auto & zone( ZoneDaylight( ZoneNum ) );
+		Arrays = { &zone.SolidAngAtRefPt, &zone.SolidAngAtRefPtWtd };
+		FactorArrays = { &zone.DaylIllFacSky, &zone.DaylSourceFacSky, &zone.DaylBackFacSky, &zone.DaylIllFacSun, &zone.DaylIllFacSunDisk, &zone.DaylSourceFacSun, &zone.DaylSourceFacSunDisk, &zone.DaylBackFacSun, &zone.DaylBackFacSunDisk };
+		if ( ! IncludeMaps ) return;
+		for ( int MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
+			auto & map( IllumMapCalc( MapNum ) );
+			if ( map.Zone != ZoneNum ) continue;
+			Arrays.insert( Arrays.end(), { &map.SolidAngAtMapPt, &map.SolidAngAtMapPtWtd } );
+			FactorArrays.insert( FactorArrays.end(), { &map.DaylIllFacSky, &map.DaylSourceFacSky, &map.DaylBackFacSky, &map.DaylIllFacSun, &map.DaylIllFacSunDisk, &map.DaylSourceFacSun, &map.DaylSourceFacSunDisk, &map.DaylBackFacSun, &map.DaylBackFacSunDisk } );
+		}
+
+	}
+
+	bool
+	RestoreDayltgCoeffsFromCache(
+		int const ZoneNum,
+		bool const IncludeMaps // True if the zone's illuminance map factors are included
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets the daylighting factors of the zone from the cache file.  Returns false if the
+		// calculation is not cached (or the record cannot be read).
+
+		auto const Found( DaylightingCache.Index.find( std::make_tuple( ZoneNum, int( IncludeMaps ), DaylightingCacheSunKey() ) ) );
+		if ( Found == DaylightingCache.Index.end() ) return false;
+
+		std::vector< Array< Real64 > * > Arrays;
+		std::vector< Array< DaylFactorType > * > FactorArrays;
+		DaylightingCacheArrays( ZoneNum, IncludeMaps, Arrays, FactorArrays );
+		std::size_t NumValues( 0u );
+		for ( auto const * Arr : Arrays ) NumValues += Arr->size();
+		for ( auto const * Arr : FactorArrays ) NumValues += Arr->size();
+
+		auto & File( DaylightingCache.File );
+		File.clear();
+		File.seekg( Found->second );
+		int Head[ 3 ];
+		std::uint64_t SunKey( 0u );
+		File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+		File.read( reinterpret_cast< char * >( &SunKey ), sizeof( SunKey ) );
+		std::vector< Real64 > Values( File.good() && Head[ 2 ] == int( NumValues ) ? NumValues : 0u );
+		File.read( reinterpret_cast< char * >( Values.data() ), Values.size() * sizeof( Real64 ) );
+		if ( ! File.good() || Values.size() != NumValues ) {
+			File.clear();
+			DaylightingCache.Index.erase( Found );
+			return false;
+		}
+
+		Real64 const * Value( Values.data() );
+		for ( auto * Arr : Arrays ) {
+			std::copy( Value, Value + Arr->size(), Arr->data() );
+			Value += Arr->size();
+		}
+		for ( auto * Arr : FactorArrays ) {
+			std::copy( Value, Value + Arr->size(), Arr->data() );
+			Value += Arr->size();
+		}
+		++DaylightingCache.NumHits;
+		return true;
+
+	}
+
+	void
+	SaveDayltgCoeffsToCache(
+		int const ZoneNum,
+		bool const IncludeMaps // True if the zone's illuminance map factors are included
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the daylighting factors just calculated for the zone to the cache file.
+
+		std::uint64_t const SunKey( DaylightingCacheSunKey() );
+		auto const Key( std::make_tuple( ZoneNum, int( IncludeMaps ), SunKey ) );
+		if ( DaylightingCache.Index.find( Key ) != DaylightingCache.Index.end() ) return;
+
+		std::vector< Array< Real64 > * > Arrays;
+		std::vector< Array< DaylFactorType > * > FactorArrays;
+		DaylightingCacheArrays( ZoneNum, IncludeMaps, Arrays, FactorArrays );
+		std::size_t NumValues( 0u );
+		for ( auto const * Arr : Arrays ) NumValues += Arr->size();
+		for ( auto const * Arr : FactorArrays ) NumValues += Arr->size();
+		int const Head[ 3 ] = { ZoneNum, int( IncludeMaps ), int( NumValues ) };
+
+		auto & File( DaylightingCache.File );
+		File.clear();
+		File.seekp( 0, std::ios::end );
+		std::streamoff const Offset( File.tellp() );
+		File.write( reinterpret_cast< char const * >( Head ), sizeof( Head ) );
+		File.write( reinterpret_cast< char const * >( &SunKey ), sizeof( SunKey ) );
+		for ( auto const * Arr : Arrays ) {
+			File.write( reinterpret_cast< char const * >( Arr->data() ), Arr->size() * sizeof( Real64 ) );
+		}
+		for ( auto const * Arr : FactorArrays ) { // Written in full precision whatever the factor storage
+			std::vector< Real64 > const Values( Arr->data(), Arr->data() + Arr->size() );
+			File.write( reinterpret_cast< char const * >( Values.data() ), Values.size() * sizeof( Real64 ) );
+		}
+		File.flush();
+		if ( ! File.good() ) {
+			ShowWarningError( "SaveDayltgCoeffsToCache: Could not write to daylighting factor cache file \"" + DaylightingCache.FileName + "\"; the cache is no longer used." );
+			File.close();
+			DaylightingCache.Active = false;
+			return;
+		}
+		DaylightingCache.Index[ Key ] = Offset;
+		++DaylightingCache.NumMisses;
+
+	}
+
 	void
 	CalcDayltgCoeffsRefMapPoints( int const ZoneNum )
 	{
@@ -1004,15 +1400,15 @@ namespace DaylightingManager {
 			ZoneDaylight( ZoneNum ).DaylBackFacSunDisk = 0.0;
 		} else {
 
-			ZoneDaylight( ZoneNum ).DaylIllFacSky( HourOfDay, {1,MaxSlatAngs + 1}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylSourceFacSky( HourOfDay, {1,MaxSlatAngs + 1}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylBackFacSky( HourOfDay, {1,MaxSlatAngs + 1}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-			ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylIllFacSky( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylSourceFacSky( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylBackFacSky( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+			ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
 		}
 
 		NRF = ZoneDaylight( ZoneNum ).TotalDaylRefPoints;
@@ -1129,29 +1525,24 @@ namespace DaylightingManager {
 
 		// METHODOLOGY EMPLOYED:
 		// Was previously part of CalcDayltgCoeffsRefMapPoints -- broken out to all multiple
-		// maps per zone
+		// maps per zone.  The map points are independent of each other and are calculated
+		// by CalcDayltgCoeffsMapPoint, in parallel when the zone's windows allow it.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using General::POLYF;
-		using General::BlindBeamBeamTrans;
-		using General::SafeDivide;
-		using General::RoundSigDigits;
-		using DaylightingDevices::FindTDDPipe;
-		using DaylightingDevices::TransTDD;
-		using namespace Vectors;
-		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
-		using DataEnvironment::SunIsUp;
+#ifdef HBIRE_USE_OMP
+		using DataSystemVariables::NumberDaylightingThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const tmpDFCalc( 0.05 ); // cut off illuminance (lux) for exterior horizontal in calculating
-		// the daylighting and glare factors
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -1161,72 +1552,16 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Array1D< Real64 > W2( 3 ); // Second vertex of window
-		static Array1D< Real64 > W3( 3 ); // Third vertex of window
-		static Array1D< Real64 > U2( 3 ); // Second vertex of window for TDD:DOME (if exists)
-		static Array1D< Real64 > RREF( 3 ); // Location of a reference point in absolute coordinate system
-		static Array1D< Real64 > RREF2( 3 ); // Location of virtual reference point in absolute coordinate system
-		static Array1D< Real64 > RWIN( 3 ); // Center of a window element in absolute coordinate system
-		static Array1D< Real64 > RWIN2( 3 ); // Center of a window element for TDD:DOME (if exists) in abs coord sys
-		static Array1D< Real64 > Ray( 3 ); // Unit vector along ray from reference point to window element
-		static Array1D< Real64 > W21( 3 ); // Vector from window vertex 2 to window vertex 1
-		static Array1D< Real64 > W23( 3 ); // Vector from window vertex 2 to window vertex 3
-		static Array1D< Real64 > U21( 3 ); // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-		static Array1D< Real64 > U23( 3 ); // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
-		static Array1D< Real64 > WNORM2( 3 ); // Unit vector normal to TDD:DOME (if exists)
 		static Array1D< Real64 > VIEWVC( 3 ); // View vector in absolute coordinate system
-		static Array1D< Real64 > VIEWVC2( 3 ); // Virtual view vector in absolute coordinate system
 		static Array1D< Real64 > ZF( 2 ); // Fraction of zone controlled by each reference point
-		//  In the following four variables, I=1 for clear sky, 2 for overcast.
-		int IHR; // Hour of day counter
 		int NRF; // Number of daylighting reference points in a zone
 		int IL; // Reference point counter
 		Real64 AZVIEW; // Azimuth of view vector in absolute coord system for
 		//  glare calculation (radians)
-		int IConst; // Construction counter
-		int ICtrl; // Window control counter
-		int IWin; // Window counter
-		int IWin2; // Secondary window counter (for TDD:DOME object, if exists)
-		int InShelfSurf; // Inside daylighting shelf surface number
-		int ShType; // Window shading type
-		int BlNum; // Window Blind Number
-		int LSHCAL; // Interior shade calculation flag: 0=not yet
-		//  calculated, 1=already calculated
-		int NWX; // Number of window elements in x direction for dayltg calc
-		int NWY; // Number of window elements in y direction for dayltg calc
-		int NWYlim; // For triangle, largest NWY for a given IX
-		Real64 DWX; // Horizontal dimension of window element (m)
-		Real64 DWY; // Vertical dimension of window element (m)
-		int IX; // Counter for window elements in the x direction
-		int IY; // Counter for window elements in the y direction
-		Real64 COSB; // Cosine of angle between window outward normal and ray from
-		//  reference point to window element
-		Real64 PHRAY; // Altitude of ray from reference point to window element (radians)
-		Real64 THRAY; // Azimuth of ray from reference point to window element (radians)
-		Real64 DOMEGA; // Solid angle subtended by window element wrt reference point (steradians)
-		Real64 TVISB; // Visible transmittance of window for COSB angle of incidence (times light well
-		//   efficiency, if appropriate)
-		int ISunPos; // Sun position counter; used to avoid calculating various
-		//  quantities that do not depend on sun position.
-		Real64 ObTrans; // Product of solar transmittances of exterior obstructions hit by ray
-		// from reference point through a window element
-		int loopwin; // loop index for exterior windows associated with a daylit zone
-		bool Rectangle; // True if window is rectangular
-		bool Triangle; // True if window is triangular
-		Real64 DAXY; // Area of window element
-		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
-		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
-		int ILB;
 		int MapNum; // Loop for map number
-		int IHitIntObs; // = 1 if interior obstruction hit, = 0 otherwise
-		int IHitExtObs; // 1 if ray from ref pt to ext win hits an exterior obstruction
-		Real64 TVISIntWin; // Visible transmittance of int win at COSBIntWin for light from ext win
-		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
 		Array2D< Real64 > MapWindowSolidAngAtRefPt;
 		Array2D< Real64 > MapWindowSolidAngAtRefPtWtd;
 		static bool mapFirstTime( true );
-		static bool MySunIsUpFlag( false );
-		int WinEl; // window elements counter
 
 		if ( mapFirstTime && TotIllumMaps > 0 ) {
 			IL = -999;
@@ -1245,6 +1580,15 @@ namespace DaylightingManager {
 		VIEWVC( 2 ) = std::cos( AZVIEW );
 		VIEWVC( 3 ) = 0.0;
 
+#ifdef HBIRE_USE_OMP
+		// Screen transmittance, TDD fluxes, BSDF state and the timestep sun-up flag are shared
+		// between map points, so those zones are calculated serially
+		bool SerialMapPoints( DetailedSolarTimestepIntegration || DayltgZoneHasSharedWindowState( ZoneNum ) );
+		for ( int loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+			if ( SurfaceWindow( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loopwin ) ).ScreenNumber > 0 ) SerialMapPoints = true;
+		}
+#endif
+
 		for ( MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
 
 			if ( IllumMapCalc( MapNum ).Zone != ZoneNum ) continue;
@@ -1267,15 +1611,15 @@ namespace DaylightingManager {
 				IllumMapCalc( MapNum ).DaylBackFacSun = 0.0;
 				IllumMapCalc( MapNum ).DaylBackFacSunDisk = 0.0;
 			} else {
-				IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, {1,MaxSlatAngs + 1}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {1,MaxSlatAngs + 1}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {1,MaxSlatAngs + 1}, {1,4}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
-				IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, {1,MaxSlatAngs + 1}, {1,MaxRefPoints}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,4}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,4}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,4}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
+				IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, {1,ZoneDaylight( ZoneNum ).NumShadeStates}, {1,ZoneDaylight( ZoneNum ).NumOfDayltgExtWins}, {1,IllumMapCalc( MapNum ).TotalMapRefPoints} ) = 0.0;
 			}
 			NRF = IllumMapCalc( MapNum ).TotalMapRefPoints;
 			ZF = 0.0;
@@ -1283,88 +1627,181 @@ namespace DaylightingManager {
 			MapWindowSolidAngAtRefPt.allocate( NRF, ZoneDaylight( ZoneNum ).NumOfDayltgExtWins );
 			MapWindowSolidAngAtRefPtWtd.allocate( NRF, ZoneDaylight( ZoneNum ).NumOfDayltgExtWins );
 
+#ifdef HBIRE_USE_OMP
+			int const nMapThreads( SerialMapPoints ? 1 : ParallelLoopThreads( NumberDaylightingThreads, NRF ) );
+#pragma omp parallel for schedule(dynamic) num_threads(nMapThreads) if(nMapThreads > 1)
+#endif
 			for ( IL = 1; IL <= NRF; ++IL ) {
+				CalcDayltgCoeffsMapPoint( ZoneNum, MapNum, IL, VIEWVC, AZVIEW, MapWindowSolidAngAtRefPt, MapWindowSolidAngAtRefPtWtd );
+			} // End of reference point loop, IL
+
+			MapWindowSolidAngAtRefPt.deallocate();
+			MapWindowSolidAngAtRefPtWtd.deallocate();
+
+		} // MapNum
+
+	}
+
+	void
+	CalcDayltgCoeffsMapPoint(
+		int const ZoneNum,
+		int const MapNum,
+		int const IL, // Map point number
+		Array1A< Real64 > const VIEWVC, // View vector in absolute coordinate system
+		Real64 const AZVIEW, // Azimuth of view vector in absolute coord system (radians)
+		Array2D< Real64 > & MapWindowSolidAngAtRefPt,
+		Array2D< Real64 > & MapWindowSolidAngAtRefPtWtd
+	)
+	{
 
-				RREF = IllumMapCalc( MapNum ).MapRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the daylighting coefficients of one illuminance map point for all of
+		// the zone's exterior windows.
 
-				//           -------------
-				// ---------- WINDOW LOOP ----------
-				//           -------------
+		// METHODOLOGY EMPLOYED:
+		// Body of the map point loop of CalcDayltgCoeffsMapPoints.  Only row IL of the solid angle
+		// arrays and map point IL of the map factors are written, so different points may be
+		// calculated at the same time.
 
-				MapWindowSolidAngAtRefPt = 0.0;
-				MapWindowSolidAngAtRefPtWtd = 0.0;
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataEnvironment::SunIsUp;
 
-				for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+		// Argument array dimensioning
+		VIEWVC.dim( 3 );
 
-					FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForMapPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, Rectangle, Triangle, MapNum, MapWindowSolidAngAtRefPt, MapWindowSolidAngAtRefPtWtd );
-					//           ---------------------
-					// ---------- WINDOW ELEMENT LOOP ----------
-					//           ---------------------
-					WinEl = 0;
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D< Real64 > W2( 3 ); // Second vertex of window
+		Array1D< Real64 > W3( 3 ); // Third vertex of window
+		Array1D< Real64 > U2( 3 ); // Second vertex of window for TDD:DOME (if exists)
+		Array1D< Real64 > RREF( 3 ); // Location of a reference point in absolute coordinate system
+		Array1D< Real64 > RREF2( 3 ); // Location of virtual reference point in absolute coordinate system
+		Array1D< Real64 > RWIN( 3 ); // Center of a window element in absolute coordinate system
+		Array1D< Real64 > RWIN2( 3 ); // Center of a window element for TDD:DOME (if exists) in abs coord sys
+		Array1D< Real64 > Ray( 3 ); // Unit vector along ray from reference point to window element
+		Array1D< Real64 > W21( 3 ); // Vector from window vertex 2 to window vertex 1
+		Array1D< Real64 > W23( 3 ); // Vector from window vertex 2 to window vertex 3
+		Array1D< Real64 > U21( 3 ); // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		Array1D< Real64 > U23( 3 ); // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+		Array1D< Real64 > WNORM2( 3 ); // Unit vector normal to TDD:DOME (if exists)
+		Array1D< Real64 > VIEWVC2( 3 ); // Virtual view vector in absolute coordinate system
+		int IHR; // Hour of day counter
+		int IConst; // Construction counter
+		int ICtrl; // Window control counter
+		int IWin; // Window counter
+		int IWin2; // Secondary window counter (for TDD:DOME object, if exists)
+		int InShelfSurf; // Inside daylighting shelf surface number
+		int ShType; // Window shading type
+		int BlNum; // Window Blind Number
+		int LSHCAL; // Interior shade calculation flag: 0=not yet
+		//  calculated, 1=already calculated
+		int NWX; // Number of window elements in x direction for dayltg calc
+		int NWY; // Number of window elements in y direction for dayltg calc
+		int NWYlim; // For triangle, largest NWY for a given IX
+		Real64 DWX; // Horizontal dimension of window element (m)
+		Real64 DWY; // Vertical dimension of window element (m)
+		int IX; // Counter for window elements in the x direction
+		int IY; // Counter for window elements in the y direction
+		Real64 COSB; // Cosine of angle between window outward normal and ray from
+		//  reference point to window element
+		Real64 PHRAY; // Altitude of ray from reference point to window element (radians)
+		Real64 THRAY; // Azimuth of ray from reference point to window element (radians)
+		Real64 DOMEGA; // Solid angle subtended by window element wrt reference point (steradians)
+		Real64 TVISB; // Visible transmittance of window for COSB angle of incidence (times light well
+		//   efficiency, if appropriate)
+		int ISunPos; // Sun position counter; used to avoid calculating various
+		//  quantities that do not depend on sun position.
+		Real64 ObTrans; // Product of solar transmittances of exterior obstructions hit by ray
+		// from reference point through a window element
+		int loopwin; // loop index for exterior windows associated with a daylit zone
+		bool Rectangle; // True if window is rectangular
+		bool Triangle; // True if window is triangular
+		Real64 DAXY; // Area of window element
+		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
+		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
+		int ILB;
+		int IHitIntObs; // = 1 if interior obstruction hit, = 0 otherwise
+		int IHitExtObs; // 1 if ray from ref pt to ext win hits an exterior obstruction
+		Real64 TVISIntWin; // Visible transmittance of int win at COSBIntWin for light from ext win
+		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
+		static bool MySunIsUpFlag( false ); // Only used with timestep integration, which is not threaded
+		int WinEl; // window elements counter
 
-					for ( IX = 1; IX <= NWX; ++IX ) {
-						if ( Rectangle ) {
-							NWYlim = NWY;
-						} else if ( Triangle ) {
-							NWYlim = NWY - IX + 1;
-						}
+		RREF = IllumMapCalc( MapNum ).MapRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
 
-						for ( IY = 1; IY <= NWYlim; ++IY ) {
+		//           -------------
+		// ---------- WINDOW LOOP ----------
+		//           -------------
 
-							++WinEl;
+		for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+			MapWindowSolidAngAtRefPt( IL, loopwin ) = 0.0;
+			MapWindowSolidAngAtRefPtWtd( IL, loopwin ) = 0.0;
+		}
 
-							FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForMapPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, IHitIntObs, IHitExtObs, WNORM2, ExtWinType, IConst, RREF2, Triangle, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPt, MapWindowSolidAngAtRefPtWtd );
-							//           -------------------
-							// ---------- SUN POSITION LOOP ----------
-							//           -------------------
+		for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
 
-							// Sun position counter. Used to avoid calculating various quantities
-							// that do not depend on sun position.
-							if ( ! DetailedSolarTimestepIntegration ) {
-								ISunPos = 0;
-								for ( IHR = 1; IHR <= 24; ++IHR ) {
-									FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, loopwin, IHitIntObs, IHitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
-								} // End of hourly sun position loop, IHR
-							} else {
-								if ( SunIsUp && ! MySunIsUpFlag ) {
-									ISunPos = 0;
-									MySunIsUpFlag = true;
-								} else if ( SunIsUp && MySunIsUpFlag ) {
-									ISunPos = 1;
-								} else if ( ! SunIsUp && MySunIsUpFlag ) {
-									MySunIsUpFlag = false;
-									ISunPos = -1;
-								} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
-									ISunPos = -1;
-								}
-								FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, loopwin, IHitIntObs, IHitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
+			FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForMapPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, Rectangle, Triangle, MapNum, MapWindowSolidAngAtRefPt, MapWindowSolidAngAtRefPtWtd );
+			//           ---------------------
+			// ---------- WINDOW ELEMENT LOOP ----------
+			//           ---------------------
+			WinEl = 0;
 
-							}
-						} // End of window Y-element loop, IY
-					} // End of window X-element loop, IX
+			for ( IX = 1; IX <= NWX; ++IX ) {
+				if ( Rectangle ) {
+					NWYlim = NWY;
+				} else if ( Triangle ) {
+					NWYlim = NWY - IX + 1;
+				}
+
+				for ( IY = 1; IY <= NWYlim; ++IY ) {
+
+					++WinEl;
 
+					FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForMapPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, IHitIntObs, IHitExtObs, WNORM2, ExtWinType, IConst, RREF2, Triangle, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPt, MapWindowSolidAngAtRefPtWtd );
+					//           -------------------
+					// ---------- SUN POSITION LOOP ----------
+					//           -------------------
+
+					// Sun position counter. Used to avoid calculating various quantities
+					// that do not depend on sun position.
 					if ( ! DetailedSolarTimestepIntegration ) {
-						// Loop again over hourly sun positions and calculate daylight factors by adding
-						// direct and inter-reflected illum components, then dividing by exterior horiz illum.
-						// Also calculate corresponding glare factors.
-						ILB = IL;
+						ISunPos = 0;
 						for ( IHR = 1; IHR <= 24; ++IHR ) {
-							FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, IHR, IWin, loopwin, NWX, NWY, ICtrl );
-						} // End of sun position loop, IHR
+							FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, loopwin, IHitIntObs, IHitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
+						} // End of hourly sun position loop, IHR
 					} else {
-						ILB = IL;
-						FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, HourOfDay, IWin, loopwin, NWX, NWY, ICtrl );
+						if ( SunIsUp && ! MySunIsUpFlag ) {
+							ISunPos = 0;
+							MySunIsUpFlag = true;
+						} else if ( SunIsUp && MySunIsUpFlag ) {
+							ISunPos = 1;
+						} else if ( ! SunIsUp && MySunIsUpFlag ) {
+							MySunIsUpFlag = false;
+							ISunPos = -1;
+						} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
+							ISunPos = -1;
+						}
+						FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, loopwin, IHitIntObs, IHitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
 
 					}
+				} // End of window Y-element loop, IY
+			} // End of window X-element loop, IX
 
-				} // End of window loop, loopwin - IWin
-
-			} // End of reference point loop, IL
+			if ( ! DetailedSolarTimestepIntegration ) {
+				// Loop again over hourly sun positions and calculate daylight factors by adding
+				// direct and inter-reflected illum components, then dividing by exterior horiz illum.
+				// Also calculate corresponding glare factors.
+				ILB = IL;
+				for ( IHR = 1; IHR <= 24; ++IHR ) {
+					FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, IHR, IWin, loopwin, NWX, NWY, ICtrl );
+				} // End of sun position loop, IHR
+			} else {
+				ILB = IL;
+				FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, HourOfDay, IWin, loopwin, NWX, NWY, ICtrl );
 
-			MapWindowSolidAngAtRefPt.deallocate();
-			MapWindowSolidAngAtRefPtWtd.deallocate();
+			}
 
-		} // MapNum
+		} // End of window loop, loopwin - IWin
 
 	}
 
@@ -1461,20 +1898,20 @@ namespace DaylightingManager {
 		int ZoneNumThisWin; // A window's zone number
 		int ShelfNum; // Daylighting shelf object number
 
-		static Array1D< Real64 > W1( 3 ); // First vertex of window (where vertices are numbered
+		static EP_THREAD_LOCAL Array1D< Real64 > W1( 3 ); // First vertex of window (where vertices are numbered
 		// counter-clockwise starting at upper left as viewed
 		// from inside of room
 		int IConstShaded; // Shaded construction counter
 		int ScNum; // Window screen number
 		Real64 WW; // Window width (m)
 		Real64 HW; // Window height (m)
-		static Array1D< Real64 > WC( 3 ); // Center point of window
-		static Array1D< Real64 > REFWC( 3 ); // Vector from reference point to center of window
-		static Array1D< Real64 > WNORM( 3 ); // Unit vector normal to window (pointing away from room)
+		static EP_THREAD_LOCAL Array1D< Real64 > WC( 3 ); // Center point of window
+		static EP_THREAD_LOCAL Array1D< Real64 > REFWC( 3 ); // Vector from reference point to center of window
+		static EP_THREAD_LOCAL Array1D< Real64 > WNORM( 3 ); // Unit vector normal to window (pointing away from room)
 		int NDIVX; // Number of window x divisions for daylighting calc
 		int NDIVY; // Number of window y divisions for daylighting calc
 		Real64 ALF; // Distance from reference point to window plane (m)
-		static Array1D< Real64 > W2REF( 3 ); // Vector from window origin to project of ref. pt. on window plane
+		static EP_THREAD_LOCAL Array1D< Real64 > W2REF( 3 ); // Vector from window origin to project of ref. pt. on window plane
 		Real64 D1a; // Projection of vector from window origin to reference
 		//  on window X  axis (m)
 		Real64 D1b; // Projection of vector from window origin to reference
@@ -1483,10 +1920,10 @@ namespace DaylightingManager {
 		Real64 SolidAngMinIntWin; // Approx. smallest solid angle subtended by an int. window wrt ref pt
 		Real64 SolidAngRatio; // Ratio of SolidAngExtWin and SolidAngMinIntWin
 		int PipeNum; // TDD pipe object number
-		static Array1D< Real64 > REFD( 3 ); // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
-		static Array1D< Real64 > VIEWVD( 3 ); // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
-		static Array1D< Real64 > U1( 3 ); // First vertex of window for TDD:DOME (if exists)
-		static Array1D< Real64 > U3( 3 ); // Third vertex of window for TDD:DOME (if exists)
+		static EP_THREAD_LOCAL Array1D< Real64 > REFD( 3 ); // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
+		static EP_THREAD_LOCAL Array1D< Real64 > VIEWVD( 3 ); // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
+		static EP_THREAD_LOCAL Array1D< Real64 > U1( 3 ); // First vertex of window for TDD:DOME (if exists)
+		static EP_THREAD_LOCAL Array1D< Real64 > U3( 3 ); // Third vertex of window for TDD:DOME (if exists)
 		Real64 SinCornerAng; // For triangle, sine of corner angle of window element
 
 		// Complex fenestration variables
@@ -1494,7 +1931,7 @@ namespace DaylightingManager {
 		int NReflSurf; // Number of blocked beams for complex fenestration
 		int NRefPts; // number of reference points
 		int WinEl; // Current window element
-		static Array1D< Real64 > RayVector( 3 );
+		static EP_THREAD_LOCAL Array1D< Real64 > RayVector( 3 );
 		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable)
 
 		// Complex fenestration variables
@@ -1569,15 +2006,19 @@ namespace DaylightingManager {
 		// Shade/blind calculation flag
 		LSHCAL = 0;
 
-		// Visible transmittance at normal incidence
-		SurfaceWindow( IWin ).VisTransSelected = POLYF( 1.0, Construct( IConst ).TransVisBeamCoef( 1 ) ) * SurfaceWindow( IWin ).GlazedFrac;
-		// For windows with switchable glazing, ratio of visible transmittance at normal
-		// incidence for fully switched (dark) state to that of unswitched state
-		SurfaceWindow( IWin ).VisTransRatio = 1.0;
-		if ( ICtrl > 0 ) {
-			if ( ShType == WSC_ST_SwitchableGlazing ) {
-				IConstShaded = Surface( IWin ).ShadedConstruction;
-				SurfaceWindow( IWin ).VisTransRatio = SafeDivide( POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef( 1 ) ), POLYF( 1.0, Construct( IConst ).TransVisBeamCoef( 1 ) ) );
+		// The window values below are set by the reference point pass, which always runs for the
+		// zone before its map points; the map point pass only reads them so map points can be threaded
+		if ( CalledFrom == CalledForRefPoint ) {
+			// Visible transmittance at normal incidence
+			SurfaceWindow( IWin ).VisTransSelected = POLYF( 1.0, Construct( IConst ).TransVisBeamCoef( 1 ) ) * SurfaceWindow( IWin ).GlazedFrac;
+			// For windows with switchable glazing, ratio of visible transmittance at normal
+			// incidence for fully switched (dark) state to that of unswitched state
+			SurfaceWindow( IWin ).VisTransRatio = 1.0;
+			if ( ICtrl > 0 ) {
+				if ( ShType == WSC_ST_SwitchableGlazing ) {
+					IConstShaded = Surface( IWin ).ShadedConstruction;
+					SurfaceWindow( IWin ).VisTransRatio = SafeDivide( POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef( 1 ) ), POLYF( 1.0, Construct( IConst ).TransVisBeamCoef( 1 ) ) );
+				}
 			}
 		}
 
@@ -1592,7 +2033,7 @@ namespace DaylightingManager {
 		} else if ( Triangle ) {
 			WC = W2 + ( W23 + W21 ) / 3.0;
 		}
-		SurfaceWindow( IWin ).WinCenter = WC;
+		if ( CalledFrom == CalledForRefPoint ) SurfaceWindow( IWin ).WinCenter = WC;
 		REFWC = WC - RREF;
 		// Unit vectors
 		W21 /= HW;
@@ -1633,8 +2074,13 @@ namespace DaylightingManager {
 		} else if ( CalledFrom == CalledForMapPoint ) {
 			if ( ALF < 0.1524 && ExtWinType == AdjZoneExtWin ) {
 				if ( MapErrIndex( iRefPoint, IWin ) == 0 ) { // only show error message once
-					ShowWarningError( "CalcDaylightCoeffMapPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" map point is less than 0.15m (6\") from window plane " );
-					ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] map point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Map Calcs may result." );
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (DaylightingMapErrors)
+#endif
+					{
+						ShowWarningError( "CalcDaylightCoeffMapPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" map point is less than 0.15m (6\") from window plane " );
+						ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] map point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Map Calcs may result." );
+					}
 					MapErrIndex( iRefPoint, IWin ) = 1;
 				}
 			}
@@ -1669,11 +2115,13 @@ namespace DaylightingManager {
 		DWY = HW / NWY;
 
 		// Azimuth and altitude of window normal
-		SurfaceWindow( IWin ).Phi = std::asin( WNORM( 3 ) );
-		if ( std::abs( WNORM( 1 ) ) > 1.0e-5 || std::abs( WNORM( 2 ) ) > 1.0e-5 ) {
-			SurfaceWindow( IWin ).Theta = std::atan2( WNORM( 2 ), WNORM( 1 ) );
-		} else {
-			SurfaceWindow( IWin ).Theta = 0.0;
+		if ( CalledFrom == CalledForRefPoint ) {
+			SurfaceWindow( IWin ).Phi = std::asin( WNORM( 3 ) );
+			if ( std::abs( WNORM( 1 ) ) > 1.0e-5 || std::abs( WNORM( 2 ) ) > 1.0e-5 ) {
+				SurfaceWindow( IWin ).Theta = std::atan2( WNORM( 2 ), WNORM( 1 ) );
+			} else {
+				SurfaceWindow( IWin ).Theta = 0.0;
+			}
 		}
 
 		// Recalculation of values for TDD:DOME
@@ -1937,7 +2385,7 @@ namespace DaylightingManager {
 		int IHitIntWin; // Ray from ref pt passes through interior window
 		int PipeNum; // TDD pipe object number
 		int IntWin; // Interior window surface index
-		static Array1D< Real64 > HitPtIntWin( 3 ); // Intersection point on an interior window for ray from ref pt to ext win (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > HitPtIntWin( 3 ); // Intersection point on an interior window for ray from ref pt to ext win (m)
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
 
@@ -1945,16 +2393,16 @@ namespace DaylightingManager {
 		Real64 Beta; // Intermediate variable
 		Real64 HorDis; // Distance between ground hit point and proj'n of center
 		//  of window element onto ground (m)
-		static Array1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
-		static Array1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
-		static Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
+		static EP_THREAD_LOCAL Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 
 		// Local complex fenestration variables
 		int CplxFenState; // Current complex fenestration state
 		int NReflSurf; // Number of blocked beams for complex fenestration
 		int ICplxFen; // Complex fenestration counter
 		int RayIndex;
-		static Array1D< Real64 > RayVector( 3 );
+		static EP_THREAD_LOCAL Array1D< Real64 > RayVector( 3 );
 		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable)
 
 		++LSHCAL;
@@ -2950,7 +3398,7 @@ namespace DaylightingManager {
 		GroundHitPt.dim( 3 );
 
 		// Locals
-		static Array1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
+		static EP_THREAD_LOCAL Array1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
 		Real64 DPhi; // Phi increment (radians)
 		Real64 DTheta; // Theta increment (radians)
 		Real64 SkyGndUnObs; // Unobstructed sky irradiance at a ground point
@@ -2968,7 +3416,7 @@ namespace DaylightingManager {
 		Real64 IncAngSolidAngFac; // CosIncAngURay*dOmegaGnd/Pi
 		int IHitObs; // 1 if obstruction is hit; 0 otherwise
 		int ObsSurfNum; // Surface number of obstruction
-		static Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 
 		DPhi = PiOvr2 / ( AltSteps / 2.0 );
 		DTheta = Pi / AzimSteps;
@@ -3105,13 +3553,13 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static Array1D< Real64 > const RREF( 3, 0.0 ); // Location of a reference point in absolute coordinate system //Autodesk Was used uninitialized: Never set here // Made static for performance and const for now until issue addressed
-		static Array1D< Real64 > XEDIRSK( 4 ); // Illuminance contribution from luminance element, sky-related
+		static EP_THREAD_LOCAL Array1D< Real64 > XEDIRSK( 4 ); // Illuminance contribution from luminance element, sky-related
 		Real64 XEDIRSU; // Illuminance contribution from luminance element, sun-related
-		static Array1D< Real64 > XAVWLSK( 4 ); // Luminance of window element, sky-related
-		static Array1D< Real64 > RAYCOS( 3 ); // Unit vector from reference point to sun
+		static EP_THREAD_LOCAL Array1D< Real64 > XAVWLSK( 4 ); // Luminance of window element, sky-related
+		static EP_THREAD_LOCAL Array1D< Real64 > RAYCOS( 3 ); // Unit vector from reference point to sun
 		int JB; // Slat angle counter
-		static Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
-		static Array1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
+		static EP_THREAD_LOCAL Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
+		static EP_THREAD_LOCAL Array1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
 		Real64 ProfAng; // Solar profile angle on a window (radians)
 		Real64 POSFAC; // Position factor for a window element / ref point / view vector combination
 		Real64 XR; // Horizontal displacement ratio
@@ -3121,7 +3569,7 @@ namespace DaylightingManager {
 
 		Real64 ObTransDisk; // Product of solar transmittances of exterior obstructions hit by ray
 		// from reference point to sun
-		static Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits
+		static EP_THREAD_LOCAL Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits
 		Real64 LumAtHitPtFrSun; // Luminance at hit point of obstruction by reflection of direct light from
 		//  sun (cd/m2)
 		int ISky; // Sky type index: 1=clear, 2=clear turbid, 3=intermediate, 4=overcast
@@ -3139,13 +3587,13 @@ namespace DaylightingManager {
 		int loop2;
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static Array1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction
+		static EP_THREAD_LOCAL Array1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction
 //		Real64 SunObstructionMult; // = 1.0 if sun hits a ground point; otherwise = 0.0
 		Real64 Alfa; // Intermediate variables
 		Real64 Beta;
-		static Array1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray hits ground (m)
 		int IHitObs; // 1 if obstruction is hit; 0 otherwise
-		static Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 		int ObsSurfNum; // Surface number of obstruction
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
@@ -3154,15 +3602,15 @@ namespace DaylightingManager {
 		int RecSurfNum; // Receiving surface number
 		int ReflSurfNum; // Reflecting surface number
 		int ReflSurfNumX;
-		static Array1D< Real64 > ReflNorm( 3 ); // Normal vector to reflecting surface
+		static EP_THREAD_LOCAL Array1D< Real64 > ReflNorm( 3 ); // Normal vector to reflecting surface
 		Real64 CosIncAngRefl; // Cos of angle of incidence of beam on reflecting surface
-		static Array1D< Real64 > SunVecMir( 3 ); // Sun ray mirrored in reflecting surface
+		static EP_THREAD_LOCAL Array1D< Real64 > SunVecMir( 3 ); // Sun ray mirrored in reflecting surface
 		Real64 CosIncAngRec; // Cos of angle of incidence of reflected beam on receiving window
 		int IHitRefl; // 1 if ray hits reflecting surface; 0 otherwise
-		static Array1D< Real64 > HitPtRefl( 3 ); // Point that ray hits reflecting surface
+		static EP_THREAD_LOCAL Array1D< Real64 > HitPtRefl( 3 ); // Point that ray hits reflecting surface
 		Real64 ReflDistance; // Distance between ref pt and hit point on reflecting surf (m)
 		int IHitObsRefl; // > 0 if obstruction hit between ref pt and reflection point
-		static Array1D< Real64 > HitPtObs( 3 ); // Hit point on obstruction
+		static EP_THREAD_LOCAL Array1D< Real64 > HitPtObs( 3 ); // Hit point on obstruction
 		Real64 ObsDistance; // Distance from ref pt to reflection point
 		int ReflSurfRecNum; // Receiving surface number for a reflecting window
 		Real64 SpecReflectance; // Specular reflectance of a reflecting surface
@@ -3177,7 +3625,7 @@ namespace DaylightingManager {
 		int IHitExtObsDisk; // 1 if ray from ref pt to sun hits an exterior obstruction; 0 otherwise
 
 		int IntWinDisk; // Surface loop index for finding int windows betw ref pt and sun
-		static Array1D< Real64 > HitPtIntWinDisk( 3 ); // Intersection point on an interior window for ray from ref pt to sun (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > HitPtIntWinDisk( 3 ); // Intersection point on an interior window for ray from ref pt to sun (m)
 		int IntWinDiskHitNum; // Surface number of int window intersected by ray betw ref pt and sun
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
@@ -3729,6 +4177,23 @@ namespace DaylightingManager {
 
 	}
 
+	void
+	StoreDaylFactor(
+		DaylFactorType & Factor, // Factor array element
+		Real64 const Value, // Factor as calculated
+		Real64 & MaxError // Largest relative error of the factors stored so far
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores a daylighting factor, keeping the largest relative error of the stored factors
+		// against the calculated ones (zero unless the factors are stored in single precision).
+
+		Factor = Value;
+		if ( Value != 0.0 ) MaxError = max( MaxError, std::abs( Factor - Value ) / std::abs( Value ) );
+
+	}
+
 	void
 	FigureRefPointDayltgFactorsToAddIllums(
 		int const ZoneNum,
@@ -3806,9 +4271,9 @@ namespace DaylightingManager {
 				if ( ! SurfaceWindow( IWin ).MovableSlats && JSH > 2 ) break;
 
 				if ( GILSK( iHour, ISky ) > tmpDFCalc ) {
-					ZoneDaylight( ZoneNum ).DaylIllFacSky( iHour, JSH, ISky, iRefPoint, loopwin ) = ( EDIRSK( iHour, JSH, ISky ) + EINTSK( iHour, JSH, ISky ) ) / GILSK( iHour, ISky );
-					ZoneDaylight( ZoneNum ).DaylSourceFacSky( iHour, JSH, ISky, iRefPoint, loopwin ) = AVWLSK( iHour, JSH, ISky ) / ( NWX * NWY * GILSK( iHour, ISky ) );
-					ZoneDaylight( ZoneNum ).DaylBackFacSky( iHour, JSH, ISky, iRefPoint, loopwin ) = EINTSK( iHour, JSH, ISky ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * GILSK( iHour, ISky ) );
+					StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylIllFacSky( iHour, JSH, ISky, iRefPoint, loopwin ), ( EDIRSK( iHour, JSH, ISky ) + EINTSK( iHour, JSH, ISky ) ) / GILSK( iHour, ISky ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
+					StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylSourceFacSky( iHour, JSH, ISky, iRefPoint, loopwin ), AVWLSK( iHour, JSH, ISky ) / ( NWX * NWY * GILSK( iHour, ISky ) ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
+					StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylBackFacSky( iHour, JSH, ISky, iRefPoint, loopwin ), EINTSK( iHour, JSH, ISky ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * GILSK( iHour, ISky ) ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
 				} else {
 					ZoneDaylight( ZoneNum ).DaylIllFacSky( iHour, JSH, ISky, iRefPoint, loopwin ) = 0.0;
 					ZoneDaylight( ZoneNum ).DaylSourceFacSky( iHour, JSH, ISky, iRefPoint, loopwin ) = 0.0;
@@ -3817,14 +4282,14 @@ namespace DaylightingManager {
 
 				if ( ISky == 1 ) {
 					if ( GILSU( iHour ) > tmpDFCalc ) {
-						ZoneDaylight( ZoneNum ).DaylIllFacSun( iHour, JSH, iRefPoint, loopwin ) = ( EDIRSU( iHour, JSH ) + EINTSU( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 );
-						ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( iHour, JSH, iRefPoint, loopwin ) = ( EDIRSUdisk( iHour, JSH ) + EINTSUdisk( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 );
+						StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylIllFacSun( iHour, JSH, iRefPoint, loopwin ), ( EDIRSU( iHour, JSH ) + EINTSU( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
+						StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( iHour, JSH, iRefPoint, loopwin ), ( EDIRSUdisk( iHour, JSH ) + EINTSUdisk( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
 
-						ZoneDaylight( ZoneNum ).DaylSourceFacSun( iHour, JSH, iRefPoint, loopwin ) = AVWLSU( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
-						ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( iHour, JSH, iRefPoint, loopwin ) = AVWLSUdisk( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
+						StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylSourceFacSun( iHour, JSH, iRefPoint, loopwin ), AVWLSU( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
+						StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( iHour, JSH, iRefPoint, loopwin ), AVWLSUdisk( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
 
-						ZoneDaylight( ZoneNum ).DaylBackFacSun( iHour, JSH, iRefPoint, loopwin ) = EINTSU( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
-						ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( iHour, JSH, iRefPoint, loopwin ) = EINTSUdisk( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
+						StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylBackFacSun( iHour, JSH, iRefPoint, loopwin ), EINTSU( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
+						StoreDaylFactor( ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( iHour, JSH, iRefPoint, loopwin ), EINTSUdisk( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) ), ZoneDaylight( ZoneNum ).MaxFactorRoundingError );
 					} else {
 						ZoneDaylight( ZoneNum ).DaylIllFacSun( iHour, JSH, iRefPoint, loopwin ) = 0.0;
 						ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( iHour, JSH, iRefPoint, loopwin ) = 0.0;
@@ -3936,34 +4401,34 @@ namespace DaylightingManager {
 				if ( ! SurfaceWindow( IWin ).MovableSlats && JSH > 2 ) break;
 
 				if ( GILSK( iHour, ISky ) > tmpDFCalc ) {
-					IllumMapCalc( MapNum ).DaylIllFacSky( iHour, JSH, ISky, iMapPoint, loopwin ) = ( EDIRSK( iHour, JSH, ISky ) + EINTSK( iHour, JSH, ISky ) ) / GILSK( iHour, ISky );
-					IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, JSH, ISky, iMapPoint, loopwin ) = AVWLSK( iHour, JSH, ISky ) / ( NWX * NWY * GILSK( iHour, ISky ) );
-					IllumMapCalc( MapNum ).DaylBackFacSky( iHour, JSH, ISky, iMapPoint, loopwin ) = EINTSK( iHour, JSH, ISky ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * GILSK( iHour, ISky ) );
+					IllumMapCalc( MapNum ).DaylIllFacSky( iHour, JSH, ISky, loopwin, iMapPoint ) = ( EDIRSK( iHour, JSH, ISky ) + EINTSK( iHour, JSH, ISky ) ) / GILSK( iHour, ISky );
+					IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, JSH, ISky, loopwin, iMapPoint ) = AVWLSK( iHour, JSH, ISky ) / ( NWX * NWY * GILSK( iHour, ISky ) );
+					IllumMapCalc( MapNum ).DaylBackFacSky( iHour, JSH, ISky, loopwin, iMapPoint ) = EINTSK( iHour, JSH, ISky ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * GILSK( iHour, ISky ) );
 				} else {
-					IllumMapCalc( MapNum ).DaylIllFacSky( iHour, JSH, ISky, iMapPoint, loopwin ) = 0.0;
-					IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, JSH, ISky, iMapPoint, loopwin ) = 0.0;
-					IllumMapCalc( MapNum ).DaylBackFacSky( iHour, JSH, ISky, iMapPoint, loopwin ) = 0.0;
+					IllumMapCalc( MapNum ).DaylIllFacSky( iHour, JSH, ISky, loopwin, iMapPoint ) = 0.0;
+					IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, JSH, ISky, loopwin, iMapPoint ) = 0.0;
+					IllumMapCalc( MapNum ).DaylBackFacSky( iHour, JSH, ISky, loopwin, iMapPoint ) = 0.0;
 				}
 
 				if ( ISky == 1 ) {
 					if ( GILSU( iHour ) > tmpDFCalc ) {
-						IllumMapCalc( MapNum ).DaylIllFacSun( iHour, JSH, iMapPoint, loopwin ) = ( EDIRSU( iHour, JSH ) + EINTSU( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 );
-						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, JSH, iMapPoint, loopwin ) = ( EDIRSUdisk( iHour, JSH ) + EINTSUdisk( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 );
+						IllumMapCalc( MapNum ).DaylIllFacSun( iHour, JSH, loopwin, iMapPoint ) = ( EDIRSU( iHour, JSH ) + EINTSU( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 );
+						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, JSH, loopwin, iMapPoint ) = ( EDIRSUdisk( iHour, JSH ) + EINTSUdisk( iHour, JSH ) ) / ( GILSU( iHour ) + 0.0001 );
 
-						IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, JSH, iMapPoint, loopwin ) = AVWLSU( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
-						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, JSH, iMapPoint, loopwin ) = AVWLSUdisk( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, JSH, loopwin, iMapPoint ) = AVWLSU( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, JSH, loopwin, iMapPoint ) = AVWLSUdisk( iHour, JSH ) / ( NWX * NWY * ( GILSU( iHour ) + 0.0001 ) );
 
-						IllumMapCalc( MapNum ).DaylBackFacSun( iHour, JSH, iMapPoint, loopwin ) = EINTSU( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
-						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, JSH, iMapPoint, loopwin ) = EINTSUdisk( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylBackFacSun( iHour, JSH, loopwin, iMapPoint ) = EINTSU( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
+						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, JSH, loopwin, iMapPoint ) = EINTSUdisk( iHour, JSH ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / ( Pi * ( GILSU( iHour ) + 0.0001 ) );
 					} else {
-						IllumMapCalc( MapNum ).DaylIllFacSun( iHour, JSH, iMapPoint, loopwin ) = 0.0;
-						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, JSH, iMapPoint, loopwin ) = 0.0;
+						IllumMapCalc( MapNum ).DaylIllFacSun( iHour, JSH, loopwin, iMapPoint ) = 0.0;
+						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, JSH, loopwin, iMapPoint ) = 0.0;
 
-						IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, JSH, iMapPoint, loopwin ) = 0.0;
-						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, JSH, iMapPoint, loopwin ) = 0.0;
+						IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, JSH, loopwin, iMapPoint ) = 0.0;
+						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, JSH, loopwin, iMapPoint ) = 0.0;
 
-						IllumMapCalc( MapNum ).DaylBackFacSun( iHour, JSH, iMapPoint, loopwin ) = 0.0;
-						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, JSH, iMapPoint, loopwin ) = 0.0;
+						IllumMapCalc( MapNum ).DaylBackFacSun( iHour, JSH, loopwin, iMapPoint ) = 0.0;
+						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, JSH, loopwin, iMapPoint ) = 0.0;
 					}
 				}
 			} // End of shading index loop, JSH
@@ -3972,16 +4437,16 @@ namespace DaylightingManager {
 			if ( ICtrl > 0 ) {
 				if ( WindowShadingControl( ICtrl ).ShadingType == WSC_ST_SwitchableGlazing ) {
 					VTR = SurfaceWindow( IWin ).VisTransRatio;
-					IllumMapCalc( MapNum ).DaylIllFacSky( iHour, 2, ISky, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylIllFacSky( iHour, 1, ISky, iMapPoint, loopwin ) * VTR;
-					IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, 2, ISky, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, 1, ISky, iMapPoint, loopwin ) * VTR;
-					IllumMapCalc( MapNum ).DaylBackFacSky( iHour, 2, ISky, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylBackFacSky( iHour, 1, ISky, iMapPoint, loopwin ) * VTR;
+					IllumMapCalc( MapNum ).DaylIllFacSky( iHour, 2, ISky, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylIllFacSky( iHour, 1, ISky, loopwin, iMapPoint ) * VTR;
+					IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, 2, ISky, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylSourceFacSky( iHour, 1, ISky, loopwin, iMapPoint ) * VTR;
+					IllumMapCalc( MapNum ).DaylBackFacSky( iHour, 2, ISky, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylBackFacSky( iHour, 1, ISky, loopwin, iMapPoint ) * VTR;
 					if ( ISky == 1 ) {
-						IllumMapCalc( MapNum ).DaylIllFacSun( iHour, 2, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylIllFacSun( iHour, 1, iMapPoint, loopwin ) * VTR;
-						IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, 2, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, 1, iMapPoint, loopwin ) * VTR;
-						IllumMapCalc( MapNum ).DaylBackFacSun( iHour, 2, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylBackFacSun( iHour, 1, iMapPoint, loopwin ) * VTR;
-						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, 2, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, 1, iMapPoint, loopwin ) * VTR;
-						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, 2, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, 1, iMapPoint, loopwin ) * VTR;
-						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, 2, iMapPoint, loopwin ) = IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, 1, iMapPoint, loopwin ) * VTR;
+						IllumMapCalc( MapNum ).DaylIllFacSun( iHour, 2, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylIllFacSun( iHour, 1, loopwin, iMapPoint ) * VTR;
+						IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, 2, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylSourceFacSun( iHour, 1, loopwin, iMapPoint ) * VTR;
+						IllumMapCalc( MapNum ).DaylBackFacSun( iHour, 2, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylBackFacSun( iHour, 1, loopwin, iMapPoint ) * VTR;
+						IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, 2, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylIllFacSunDisk( iHour, 1, loopwin, iMapPoint ) * VTR;
+						IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, 2, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylSourceFacSunDisk( iHour, 1, loopwin, iMapPoint ) * VTR;
+						IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, 2, loopwin, iMapPoint ) = IllumMapCalc( MapNum ).DaylBackFacSunDisk( iHour, 1, loopwin, iMapPoint ) * VTR;
 					}
 				}
 			} // ICtrl > 0
@@ -5449,19 +5914,19 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int NV; // Number of vertices (3 or 4)
-		static Array1D< Real64 > V1( 3 ); // First vertex
-		static Array1D< Real64 > V2( 3 ); // Second vertex
-		static Array1D< Real64 > V3( 3 ); // Third vertex
-		static Array1D< Real64 > A1( 3 ); // Vector from vertex 1 to 2
-		static Array1D< Real64 > A2( 3 ); // Vector from vertex 2 to 3
-		static Array1D< Real64 > AXC( 3 ); // Cross product of A and C
-		static Array1D< Real64 > SN( 3 ); // Vector normal to surface (SN = A1 X A2)
-		static Array1D< Real64 > AA( 3 ); // AA(I) = A(N,I)
-		static Array1D< Real64 > CC( 3 ); // CC(I) = C(N,I)
-		static Array1D< Real64 > CCC( 3 ); // Vector from vertex 2 to CP
-		static Array1D< Real64 > AAA( 3 ); // Vector from vertex 2 to vertex 1
-		static Array1D< Real64 > BBB( 3 ); // Vector from vertex 2 to vertex 3
-		static Array1D< Real64 > V_tmp( 3 ); // Vector to avoid array temporary
+		static EP_THREAD_LOCAL Array1D< Real64 > V1( 3 ); // First vertex
+		static EP_THREAD_LOCAL Array1D< Real64 > V2( 3 ); // Second vertex
+		static EP_THREAD_LOCAL Array1D< Real64 > V3( 3 ); // Third vertex
+		static EP_THREAD_LOCAL Array1D< Real64 > A1( 3 ); // Vector from vertex 1 to 2
+		static EP_THREAD_LOCAL Array1D< Real64 > A2( 3 ); // Vector from vertex 2 to 3
+		static EP_THREAD_LOCAL Array1D< Real64 > AXC( 3 ); // Cross product of A and C
+		static EP_THREAD_LOCAL Array1D< Real64 > SN( 3 ); // Vector normal to surface (SN = A1 X A2)
+		static EP_THREAD_LOCAL Array1D< Real64 > AA( 3 ); // AA(I) = A(N,I)
+		static EP_THREAD_LOCAL Array1D< Real64 > CC( 3 ); // CC(I) = C(N,I)
+		static EP_THREAD_LOCAL Array1D< Real64 > CCC( 3 ); // Vector from vertex 2 to CP
+		static EP_THREAD_LOCAL Array1D< Real64 > AAA( 3 ); // Vector from vertex 2 to vertex 1
+		static EP_THREAD_LOCAL Array1D< Real64 > BBB( 3 ); // Vector from vertex 2 to vertex 3
+		static EP_THREAD_LOCAL Array1D< Real64 > V_tmp( 3 ); // Vector to avoid array temporary
 		int N; // Vertex loop index
 		int I; // Vertex-to-vertex index
 		Real64 F1; // Intermediate variables
@@ -5474,10 +5939,10 @@ namespace DaylightingManager {
 		//  REAL(r64)      :: A(4,3)                   ! Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
 		//  REAL(r64)      :: C(4,3)                   ! Vectors from vertices to intersection point
 		//  REAL(r64)      :: V(4,3)                   ! Vertices of surfaces
-		static Array2D< Real64 > A; // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
-		static Array2D< Real64 > C; // Vectors from vertices to intersection point
-		static Array2D< Real64 > V; // Vertices of surfaces
-		static bool FirstTimeFlag( true );
+		static EP_THREAD_LOCAL Array2D< Real64 > A; // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
+		static EP_THREAD_LOCAL Array2D< Real64 > C; // Vectors from vertices to intersection point
+		static EP_THREAD_LOCAL Array2D< Real64 > V; // Vertices of surfaces
+		static EP_THREAD_LOCAL bool FirstTimeFlag( true );
 
 		// FLOW:
 		if ( FirstTimeFlag ) {
@@ -5647,7 +6112,8 @@ namespace DaylightingManager {
 		int ISurf; // Surface index
 		int IType; // Surface type/class
 		//  mirror surfaces of shading surfaces
-		static Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
+		static EP_THREAD_LOCAL Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
+		static EP_THREAD_LOCAL std::vector< int > Candidates; // Surfaces the ray may hit
 		int Pierce; // 1 if a particular obstruction is hit, 0 otherwise
 		Real64 Trans; // Solar transmittance of a shading surface
 		// FLOW:
@@ -5658,8 +6124,11 @@ namespace DaylightingManager {
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin.
 		// Building elements are assumed to be opaque. A shadowing surface is opaque unless
 		// its transmittance schedule value is non-zero.
+		// Only the surfaces whose bounding box the ray passes through are checked.
 
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		SurfaceBVH::RayCandidates( SurfaceBVH::AllSurfaces, R1( 1 ), R1( 2 ), R1( 3 ), RN( 1 ), RN( 2 ), RN( 3 ), std::numeric_limits< Real64 >::max(), Candidates );
+		for ( int const Cand : Candidates ) {
+			ISurf = Cand;
 			if ( ! Surface( ISurf ).ShadowSurfPossibleObstruction ) continue;
 			IType = Surface( ISurf ).Class;
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf ) {
@@ -5736,10 +6205,11 @@ namespace DaylightingManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
 		int IType; // Surface type/class
-		static Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
+		static EP_THREAD_LOCAL Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
 		Real64 r12; // Distance between R1 and R2
 		Real64 d; // Distance between R1 and pierced surface
-		static Array1D< Real64 > RN( 3 ); // Unit vector along ray
+		static EP_THREAD_LOCAL Array1D< Real64 > RN( 3 ); // Unit vector along ray
+		static EP_THREAD_LOCAL std::vector< int > Candidates; // Surfaces the ray may hit
 
 		// FLOW:
 		IHit = 0;
@@ -5750,7 +6220,9 @@ namespace DaylightingManager {
 
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		SurfaceBVH::RayCandidates( SurfaceBVH::AllSurfaces, R1( 1 ), R1( 2 ), R1( 3 ), RN( 1 ), RN( 2 ), RN( 3 ), r12, Candidates );
+		for ( int const Cand : Candidates ) {
+			ISurf = Cand;
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf && ISurf != Surface( Surface( IWin ).BaseSurf ).ExtBoundCond ) {
@@ -5822,10 +6294,11 @@ namespace DaylightingManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ISurf; // Surface index
 		int IType; // Surface type/class
-		static Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction surface (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction surface (m)
 		Real64 r12; // Distance between R1 and R2 (m)
 		Real64 d; // Distance between R1 and obstruction surface (m)
-		static Array1D< Real64 > RN( 3 ); // Unit vector along ray from R1 to R2
+		static EP_THREAD_LOCAL Array1D< Real64 > RN( 3 ); // Unit vector along ray from R1 to R2
+		static EP_THREAD_LOCAL std::vector< int > Candidates; // Surfaces the ray may hit
 
 		// FLOW:
 		IHit = 0;
@@ -5837,7 +6310,9 @@ namespace DaylightingManager {
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin1.
 		// Exclude base surface of window IWin2.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		SurfaceBVH::RayCandidates( SurfaceBVH::AllSurfaces, R1( 1 ), R1( 2 ), R1( 3 ), RN( 1 ), RN( 2 ), RN( 3 ), r12, Candidates );
+		for ( int const Cand : Candidates ) {
+			ISurf = Cand;
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin2 ).BaseSurf && ISurf != Surface( IWin1 ).BaseSurf && ISurf != Surface( Surface( IWin2 ).BaseSurf ).ExtBoundCond && ISurf != Surface( Surface( IWin1 ).BaseSurf ).ExtBoundCond ) {
@@ -6058,20 +6533,21 @@ namespace DaylightingManager {
 			for ( IL = 1; IL <= NREFPT; ++IL ) {
 
 				// Daylight factors for current sun position
-				for ( ISky = 1; ISky <= 4; ++ISky ) {
+				//Tuned Only the two sky types averaged for the current sky are used; the sun factors are set with the first
+				for ( ISky = ISky1; ISky <= ISky2; ++ISky ) {
 
 					// ===Bare window===
 					DFSKHR( 1, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSky( HourOfDay, 1, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSky( PreviousHour, 1, ISky, IL, loop ) );
 
-					if ( ISky == 1 ) DFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylIllFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( PreviousHour, 1, IL, loop ) ) );
+					if ( ISky == ISky1 ) DFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylIllFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( PreviousHour, 1, IL, loop ) ) );
 
 					BFSKHR( 1, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSky( HourOfDay, 1, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSky( PreviousHour, 1, ISky, IL, loop ) );
 
-					if ( ISky == 1 ) BFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylBackFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( PreviousHour, 1, IL, loop ) ) );
+					if ( ISky == ISky1 ) BFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylBackFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( PreviousHour, 1, IL, loop ) ) );
 
 					SFSKHR( 1, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSky( HourOfDay, 1, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSky( PreviousHour, 1, ISky, IL, loop ) );
 
-					if ( ISky == 1 ) SFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylSourceFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( PreviousHour, 1, IL, loop ) ) );
+					if ( ISky == ISky1 ) SFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylSourceFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( PreviousHour, 1, IL, loop ) ) );
 
 					if ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) {
 
@@ -6080,7 +6556,7 @@ namespace DaylightingManager {
 							// Shade, screen, blind with fixed slats, or diffusing glass
 							DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSky( HourOfDay, 2, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSky( PreviousHour, 2, ISky, IL, loop ) );
 
-							if ( ISky == 1 ) {
+							if ( ISky == ISky1 ) {
 								DFSUHR( 2 ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSun( PreviousHour, 2, IL, loop ) );
 
 								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) DFSUHR( 2 ) += VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( PreviousHour, 2, IL, loop ) );
@@ -6088,14 +6564,14 @@ namespace DaylightingManager {
 
 							BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSky( HourOfDay, 2, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSky( PreviousHour, 2, ISky, IL, loop ) );
 
-							if ( ISky == 1 ) {
+							if ( ISky == ISky1 ) {
 								BFSUHR( 2 ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSun( PreviousHour, 2, IL, loop ) );
 								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) BFSUHR( 2 ) += VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( PreviousHour, 2, IL, loop ) );
 							}
 
 							SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSky( HourOfDay, 2, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSky( PreviousHour, 2, ISky, IL, loop ) );
 
-							if ( ISky == 1 ) {
+							if ( ISky == ISky1 ) {
 								SFSUHR( 2 ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSun( PreviousHour, 2, IL, loop ) );
 								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) SFSUHR( 2 ) += VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( PreviousHour, 2, IL, loop ) );
 							}
@@ -6106,7 +6582,7 @@ namespace DaylightingManager {
 
 							DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylIllFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, IL, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylIllFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, IL, loop ) ) );
 
-							if ( ISky == 1 ) {
+							if ( ISky == ISky1 ) {
 								DFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, {2,MaxSlatAngs + 1}, IL, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylIllFacSun( PreviousHour, {2,MaxSlatAngs + 1}, IL, loop ) ) );
 
 								// We add the contribution from the solar disk if slats do not block beam solar
@@ -6119,7 +6595,7 @@ namespace DaylightingManager {
 
 							BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylBackFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, IL, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylBackFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, IL, loop ) ) );
 
-							if ( ISky == 1 ) {
+							if ( ISky == ISky1 ) {
 								BFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, {2,MaxSlatAngs + 1}, IL, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylBackFacSun( PreviousHour, {2,MaxSlatAngs + 1}, IL, loop ) ) );
 
 								// TH CR 8010. DaylBackFacSunDisk needs to be interpolated!
@@ -6134,7 +6610,7 @@ namespace DaylightingManager {
 
 							SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylSourceFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, IL, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylSourceFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, IL, loop ) ) );
 
-							if ( ISky == 1 ) {
+							if ( ISky == ISky1 ) {
 								SFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, {2,MaxSlatAngs + 1}, IL, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, ZoneDaylight( ZoneNum ).DaylSourceFacSun( PreviousHour, {2,MaxSlatAngs + 1}, IL, loop ) ) );
 
 								// TH CR 8010. DaylSourceFacSunDisk needs to be interpolated!
@@ -7049,16 +7525,16 @@ namespace DaylightingManager {
 		// In the following I,J arrays:
 		// I = sky type;
 		// J = 1 for bare window, 2 and above for window with shade or blind.
-		static Array2D< Real64 > FLFWSK( MaxSlatAngs+1, 4 ); // Sky-related downgoing luminous flux
-		static Array1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
-		static Array1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
-		static Array2D< Real64 > FLCWSK( MaxSlatAngs+1, 4 ); // Sky-related upgoing luminous flux
-		static Array1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
+		static EP_THREAD_LOCAL Array2D< Real64 > FLFWSK( MaxSlatAngs+1, 4 ); // Sky-related downgoing luminous flux
+		static EP_THREAD_LOCAL Array1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
+		static EP_THREAD_LOCAL Array1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
+		static EP_THREAD_LOCAL Array2D< Real64 > FLCWSK( MaxSlatAngs+1, 4 ); // Sky-related upgoing luminous flux
+		static EP_THREAD_LOCAL Array1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
 
 		int ISky; // Sky type index: 1=clear, 2=clear turbid,
 		//  3=intermediate, 4=overcast
-		static Array1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
-		static Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
+		static EP_THREAD_LOCAL Array1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
+		static EP_THREAD_LOCAL Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
 		Real64 DPH; // Sky/ground element altitude and azimuth increments (radians)
 		Real64 DTH;
 		int IPH; // Sky/ground element altitude and azimuth indices
@@ -7079,12 +7555,12 @@ namespace DaylightingManager {
 		Real64 COSB; // Cosine of angle of incidence of light from sky or ground
 		Real64 TVISBR; // Transmittance of window without shading at COSB
 		//  (times light well efficiency, if appropriate)
-		static Array1D< Real64 > ZSK( 4 ); // Sky-related and sun-related illuminance on window from sky/ground
+		static EP_THREAD_LOCAL Array1D< Real64 > ZSK( 4 ); // Sky-related and sun-related illuminance on window from sky/ground
 		Real64 ZSU;
 		//  element for clear and overcast sky
-		static Array1D< Real64 > U( 3 ); // Unit vector in (PH,TH) direction
+		static EP_THREAD_LOCAL Array1D< Real64 > U( 3 ); // Unit vector in (PH,TH) direction
 		Real64 ObTrans; // Product of solar transmittances of obstructions seen by a light ray
-		static Array2D< Real64 > ObTransM( NPHMAX, NTHMAX ); // ObTrans value for each (TH,PH) direction
+		static EP_THREAD_LOCAL Array2D< Real64 > ObTransM( NPHMAX, NTHMAX ); // ObTrans value for each (TH,PH) direction
 		//unused  REAL(r64)         :: HitPointLumFrClearSky     ! Luminance of obstruction from clear sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrOvercSky     ! Luminance of obstruction from overcast sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrSun          ! Luminance of obstruction from sun (cd/m2)
@@ -7136,26 +7612,26 @@ namespace DaylightingManager {
 		//  obstruction (for unit beam normal illuminance)
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static Array1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > NearestHitPt( 3 ); // Hit point of ray on nearest obstruction (m)
 		Real64 LumAtHitPtFrSun; // Luminance at hit point on obstruction from solar reflection
 		//  for unit beam normal illuminance (cd/m2)
 		Real64 SunObstructionMult; // = 1 if sun hits a ground point; otherwise = 0
-		static Array2D< Real64 > SkyObstructionMult( NPHMAX, NTHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
+		static EP_THREAD_LOCAL Array2D< Real64 > SkyObstructionMult( NPHMAX, NTHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
 		// a ground point for each (TH,PH) direction
 		Real64 Alfa; // Direction angles for ray heading towards the ground (radians)
 		Real64 Beta;
 		Real64 HorDis; // Distance between ground hit point and proj'n of window center onto ground (m)
-		static Array1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
 		int ObsSurfNum; // Obstruction surface number
 		int IHitObs; // = 1 if obstruction is hit, = 0 otherwise
-		static Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by unobstructed sky
 		//  diffuse horizontal illuminance [(cd/m2)/lux]
 		Real64 dReflObsSky; // Contribution to sky-related illuminance on window due to sky diffuse
 		//  reflection from an obstruction
-		static Array1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
+		static EP_THREAD_LOCAL Array1D< Real64 > URay( 3 ); // Unit vector in (Phi,Theta) direction
 		Real64 TVisSunRefl; // Diffuse vis trans of bare window for beam reflection calc
 		//  (times light well efficiency, if appropriate)
 		Real64 ZSU1refl; // Beam normal illuminance times ZSU1refl = illuminance on window
@@ -8626,12 +9102,12 @@ namespace DaylightingManager {
 		Real64 ElevWin; // Window elevation: angle between window outward normal and horizontal (radians)
 		Real64 AzimWin; // Window azimuth (radians)
 		Real64 AzimSun; // Sun azimuth (radians)
-		static Array1D< Real64 > WinNorm( 3 ); // Window outward normal unit vector
+		static EP_THREAD_LOCAL Array1D< Real64 > WinNorm( 3 ); // Window outward normal unit vector
 		Real64 ThWin; // Azimuth angle of WinNorm
-		static Array1D< Real64 > SunPrime( 3 ); // Projection of sun vector onto plane (perpendicular to
+		static EP_THREAD_LOCAL Array1D< Real64 > SunPrime( 3 ); // Projection of sun vector onto plane (perpendicular to
 		//  window plane) determined by WinNorm and vector along
 		//  baseline of window
-		static Array1D< Real64 > WinNormCrossBase( 3 ); // Cross product of WinNorm and vector along window baseline
+		static EP_THREAD_LOCAL Array1D< Real64 > WinNormCrossBase( 3 ); // Cross product of WinNorm and vector along window baseline
 		//  INTEGER            :: IComp             ! Vector component index
 
 		// FLOW:
@@ -8710,7 +9186,7 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
-		static Array1D< Real64 > HitPt( 3 ); // Hit point on an obstruction (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > HitPt( 3 ); // Hit point on an obstruction (m)
 		int IHit; // > 0 if obstruction is hit, 0 otherwise
 		int ObsSurfNum; // Obstruction surface number
 
@@ -8798,10 +9274,10 @@ namespace DaylightingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D< Real64 > ReflNorm( 3 ); // Unit normal to reflecting surface (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > ReflNorm( 3 ); // Unit normal to reflecting surface (m)
 		int ObsSurfNum; // Obstruction surface number
 		int IHitObs; // > 0 if obstruction is hit
-		static Array1D< Real64 > ObsHitPt( 3 ); // Hit point on obstruction (m)
+		static EP_THREAD_LOCAL Array1D< Real64 > ObsHitPt( 3 ); // Hit point on obstruction (m)
 		Real64 CosIncAngAtHitPt; // Cosine of angle of incidence of sun at HitPt
 		Real64 DiffVisRefl; // Diffuse visible reflectance of ReflSurfNum
 
@@ -8934,7 +9410,6 @@ namespace DaylightingManager {
 		Real64 SlatAng; // Blind slat angle (rad)
 		bool VarSlats; // True if slats are movable, i.e., variable angle
 		int loop; // Window loop index
-		Real64 GTOT;
 		Real64 GTOT1;
 		Real64 GTOT2;
 		static Array1D< Real64 > BACLUM;
@@ -8988,6 +9463,17 @@ namespace DaylightingManager {
 				ISky2 = 4;
 			}
 
+			// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
+			// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
+			for ( ISky = 1; ISky <= 4; ++ISky ) {
+				HorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
+			}
+
+			// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
+			// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
+			// also calculated in DayltgLuminousEfficacy.
+			HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
+
 			//              First loop over windows in this space.
 			//              Find contribution of each window to the daylight illum
 			//              and to the glare numerator at each reference point.
@@ -9011,136 +9497,65 @@ namespace DaylightingManager {
 					}
 				}
 
-				//              Loop over reference points
-				for ( ILB = 1; ILB <= NREFPT; ++ILB ) {
+				//Tuned Bare and fixed shade factors are interpolated over the contiguous map points
+				DayltgInterpolateMapFactors( MapNum, loop, 1, true, VTRatio, ISky1, ISky2, SkyWeight, HorIllSky, HorIllSkyFac );
 
-					//          Daylight factors for current sun position
-					for ( ISky = 1; ISky <= 4; ++ISky ) {
-						//                                ===Bare window===
-						DFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 1, ISky, ILB, loop ) );
-
-						if ( ISky == 1 ) {
-							DFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
-						}
+				if ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) {
 
-						BFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 1, ISky, ILB, loop ) );
+					if ( ! SurfaceWindow( IWin ).MovableSlats ) {
+						// Shade, screen, blind with fixed slats, or diffusing glass
+						DayltgInterpolateMapFactors( MapNum, loop, 2, ! SurfaceWindow( IWin ).SlatsBlockBeam, VTRatio, ISky1, ISky2, SkyWeight, HorIllSky, HorIllSkyFac );
 
-						if ( ISky == 1 ) {
-							BFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
-						}
-
-						SFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 1, ISky, ILB, loop ) );
-
-						if ( ISky == 1 ) {
-							SFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
-						}
-
-						if ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) {
-
-							//                                 ===Shaded window===
-							if ( ! SurfaceWindow( IWin ).MovableSlats ) {
-								// Shade, screen, blind with fixed slats, or diffusing glass
-								DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 2, ISky, ILB, loop ) );
-
-								if ( ISky == 1 ) {
-									DFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 2, ILB, loop ) );
-
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										DFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 2, ILB, loop ) );
-									}
-								}
-
-								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 2, ISky, ILB, loop ) );
-
-								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 2, ILB, loop ) );
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 2, ILB, loop ) );
-									}
-								}
-
-								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 2, ISky, ILB, loop ) );
-
-								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 2, ILB, loop ) );
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 2, ILB, loop ) );
-									}
-								}
-
-							} else { // Blind with movable slats
-								VarSlats = SurfaceWindow( IWin ).MovableSlats;
-								SlatAng = SurfaceWindow( IWin ).SlatAngThisTS;
-
-								DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
-
-								if ( ISky == 1 ) {
-									DFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-
-									// We add the contribution from the solar disk if slats do not block beam solar
-									// TH CR 8010, DaylIllFacSunDisk needs to be interpolated
-									//IF(.NOT.SurfaceWindow(IWin)%SlatsBlockBeam) DFSUHR(2) = DFSUHR(2) + &
-									//  VTRatio * (WeightNow * ZoneDaylight(ZoneNum)%DaylIllFacSunDisk(loop,ILB,2,HourOfDay) + &
-									//            WeightPreviousHour * ZoneDaylight(ZoneNum)%DaylIllFacSunDisk(loop,ILB,2,PreviousHour))
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										DFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-									}
-								}
-
-								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
-
-								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-
-									// TH CR 8010, DaylBackFacSunDisk needs to be interpolated
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-									}
-								}
+					} else { // Blind with movable slats
+						VarSlats = SurfaceWindow( IWin ).MovableSlats;
+						SlatAng = SurfaceWindow( IWin ).SlatAngThisTS;
 
-								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
+						for ( ILB = 1; ILB <= NREFPT; ++ILB ) {
+							// Only the two sky types averaged for the current sky are needed
+							for ( ISky = ISky1; ISky <= ISky2; ++ISky ) {
+								DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, loop, ILB ) ) );
 
-								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
+								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, loop, ILB ) ) );
 
-									// TH CR 8010, DaylSourceFacSunDisk needs to be interpolated
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-									}
-								}
+								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, loop, ILB ) ) );
+							}
 
-							} // End of check if window has blind with movable slats
+							DFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, {2,MaxSlatAngs + 1}, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, {2,MaxSlatAngs + 1}, loop, ILB ) ) );
 
-						} // End of check if window is shaded or has diffusing glass
+							// We add the contribution from the solar disk if slats do not block beam solar
+							// TH CR 8010, DaylIllFacSunDisk needs to be interpolated
+							//IF(.NOT.SurfaceWindow(IWin)%SlatsBlockBeam) DFSUHR(2) = DFSUHR(2) + &
+							//  VTRatio * (WeightNow * ZoneDaylight(ZoneNum)%DaylIllFacSunDisk(loop,ILB,2,HourOfDay) + &
+							//            WeightPreviousHour * ZoneDaylight(ZoneNum)%DaylIllFacSunDisk(loop,ILB,2,PreviousHour))
+							if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
+								DFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, loop, ILB ) ) );
+							}
 
-					}
+							BFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {2,MaxSlatAngs + 1}, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, {2,MaxSlatAngs + 1}, loop, ILB ) ) );
 
-					//              Get illuminance at ref point from bare and shaded window by
-					//              multiplying daylight factors by exterior horizontal illuminance
+							// TH CR 8010, DaylBackFacSunDisk needs to be interpolated
+							if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
+								BFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, loop, ILB ) ) );
+							}
 
-					// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
-					// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
-					for ( ISky = 1; ISky <= 4; ++ISky ) {
-						HorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
-					}
+							SFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {2,MaxSlatAngs + 1}, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, {2,MaxSlatAngs + 1}, loop, ILB ) ) );
 
-					// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
-					// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
-					// also calculated in DayltgLuminousEfficacy.
-					HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
+							// TH CR 8010, DaylSourceFacSunDisk needs to be interpolated
+							if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
+								SFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, loop, ILB ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, loop, ILB ) ) );
+							}
 
-					for ( IS = 1; IS <= 2; ++IS ) {
-						if ( IS == 2 && SurfaceWindow( IWin ).ShadingFlag <= 0 && ! SurfaceWindow( IWin ).SolarDiffusing ) break;
+							IllumMapCalc( MapNum ).IllumFromWinAtMapPt( loop, 2, ILB ) = DFSUHR( 2 ) * HISUNF + HorIllSkyFac * ( DFSKHR( 2, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + DFSKHR( 2, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
 
-						IllumMapCalc( MapNum ).IllumFromWinAtMapPt( loop, IS, ILB ) = DFSUHR( IS ) * HISUNF + HorIllSkyFac * ( DFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + DFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+							IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( loop, 2, ILB ) = BFSUHR( 2 ) * HISUNF + HorIllSkyFac * ( BFSKHR( 2, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + BFSKHR( 2, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
 
-						IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( loop, IS, ILB ) = BFSUHR( IS ) * HISUNF + HorIllSkyFac * ( BFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + BFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+							IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, 2, ILB ) = SFSUHR( 2 ) * HISUNF + HorIllSkyFac * ( SFSKHR( 2, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + SFSKHR( 2, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+							IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, 2, ILB ) = max( IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, 2, ILB ), 0.0 );
+						} // End of map point loop
 
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ) = SFSUHR( IS ) * HISUNF + HorIllSkyFac * ( SFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + SFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ) = max( IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ), 0.0 );
-					}
+					} // End of check if window has blind with movable slats
 
-				} // End of reference point loop
+				} // End of check if window is shaded or has diffusing glass
 			} // End of first loop over windows
 
 			//              Second loop over windows. Find total daylight illuminance
@@ -9177,40 +9592,47 @@ namespace DaylightingManager {
 			} // End of second window loop
 
 			//              Calculate glare index at each reference point
-			for ( IL = 1; IL <= NREFPT; ++IL ) {
-				//        Following code taken directly from DayltgGlare ... duplicate calculation
-				// Initialize glare constant
-				GTOT = 0.0;
-
-				// Loop over exterior windows associated with zone
-				for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
-					IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
-					IS = 1;
-					if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 && SurfaceWindow( IWin ).ShadingFlag <= 9 ) || SurfaceWindow( IWin ).SolarDiffusing ) IS = 2;
+			//Tuned Windows are the outer loop so the map points are contiguous; GLRNDX holds the glare
+			// constant of each point until the index is taken, summed over the windows in the same order
+			//        Following code taken directly from DayltgGlare ... duplicate calculation
+			// Loop over exterior windows associated with zone
+			for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
+				IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
+				IS = 1;
+				if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 && SurfaceWindow( IWin ).ShadingFlag <= 9 ) || SurfaceWindow( IWin ).SolarDiffusing ) IS = 2;
 
-					// CR 8057. 3/17/2010
-					VTMULT = 1.0;
+				// CR 8057. 3/17/2010
+				VTMULT = 1.0;
 
-					ICtrl = Surface( IWin ).WindowShadingControlPtr;
-					if ( ICtrl > 0 ) {
-						if ( WindowShadingControl( ICtrl ).ShadingControlType == WSCT_MeetDaylIlumSetp && SurfaceWindow( IWin ).ShadingFlag == SwitchableGlazing ) {
-							// switchable windows in partial or fully switched state,
-							//  get its intermediate VT calculated in DayltgInteriorIllum
-							IConstShaded = Surface( IWin ).ShadedConstruction;
-							if ( IConstShaded > 0 ) VTDark = POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef( 1 ) ) * SurfaceWindow( IWin ).GlazedFrac;
-							if ( VTDark > 0 ) VTMULT = SurfaceWindow( IWin ).VisTransSelected / VTDark;
-						}
+				ICtrl = Surface( IWin ).WindowShadingControlPtr;
+				if ( ICtrl > 0 ) {
+					if ( WindowShadingControl( ICtrl ).ShadingControlType == WSCT_MeetDaylIlumSetp && SurfaceWindow( IWin ).ShadingFlag == SwitchableGlazing ) {
+						// switchable windows in partial or fully switched state,
+						//  get its intermediate VT calculated in DayltgInteriorIllum
+						IConstShaded = Surface( IWin ).ShadedConstruction;
+						if ( IConstShaded > 0 ) VTDark = POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef( 1 ) ) * SurfaceWindow( IWin ).GlazedFrac;
+						if ( VTDark > 0 ) VTMULT = SurfaceWindow( IWin ).VisTransSelected / VTDark;
 					}
+				}
 
+				auto const & SourceLum( IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt );
+				auto const & SolidAng( IllumMapCalc( MapNum ).SolidAngAtMapPt );
+				auto const & SolidAngWtd( IllumMapCalc( MapNum ).SolidAngAtMapPtWtd );
+				auto lS( SourceLum.index( loop, IS, 1 ) );
+				auto lA( SolidAng.index( loop, 1 ) );
+				assert( equal_dimensions( SolidAng, SolidAngWtd ) );
+				for ( IL = 1; IL <= NREFPT; ++IL, ++lS, ++lA ) { // [ lS ] == ( loop, IS, IL ) // [ lA ] == ( loop, IL )
 					// Conversion from ft-L to cd/m2, with cd/m2 = 0.2936 ft-L, gives the 0.4794 factor
 					// below, which is (0.2936)**0.6
-					GTOT1 = 0.4794 * ( std::pow( VTMULT * IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, IL ), 1.6 ) ) * std::pow( IllumMapCalc( MapNum ).SolidAngAtMapPtWtd( loop, IL ), 0.8 );
-					GTOT2 = BACLUM( IL ) + 0.07 * ( std::sqrt( IllumMapCalc( MapNum ).SolidAngAtMapPt( loop, IL ) ) ) * VTMULT * IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, IL );
-					GTOT += GTOT1 / ( GTOT2 + 0.000001 );
+					GTOT1 = 0.4794 * ( std::pow( VTMULT * SourceLum[ lS ], 1.6 ) ) * std::pow( SolidAngWtd[ lA ], 0.8 );
+					GTOT2 = BACLUM( IL ) + 0.07 * ( std::sqrt( SolidAng[ lA ] ) ) * VTMULT * SourceLum[ lS ];
+					GLRNDX( IL ) += GTOT1 / ( GTOT2 + 0.000001 );
 				}
+			}
 
+			for ( IL = 1; IL <= NREFPT; ++IL ) {
 				// Glare index (adding 0.000001 prevents LOG10 (0))
-				GLRNDX( IL ) = 10.0 * std::log10( GTOT + 0.000001 );
+				GLRNDX( IL ) = 10.0 * std::log10( GLRNDX( IL ) + 0.000001 );
 				// Set glare index to zero for GTOT < 1
 				GLRNDX( IL ) = max( 0.0, GLRNDX( IL ) );
 			}
@@ -9224,6 +9646,71 @@ namespace DaylightingManager {
 
 	}
 
+	void
+	DayltgInterpolateMapFactors(
+		int const MapNum, // Illuminance map number
+		int const loop, // Daylit window index of the zone
+		int const IS, // Shading index: 1 = bare window, 2 = shade, screen, fixed slat blind or diffusing glass
+		bool const AddSunDisk, // True if the sun disk factors are added to the sun factors
+		Real64 const VTRatio, // Visible transmittance ratio of a thermochromic window to its master construction
+		int const ISky1, // First of the two sky types averaged for the current sky
+		int const ISky2, // Second of the two sky types averaged for the current sky
+		Real64 const SkyWeight, // Weighting factor of ISky1
+		Array1< Real64 > const & HorIllSky, // Horizontal illuminance of each sky type (lux)
+		Real64 const HorIllSkyFac // Ratio of the current horizontal sky illuminance to the averaged one
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the illuminance, background luminance and source luminance from one window of a map
+		// with a fixed shading state at every map point, from the hourly daylight factors.
+
+		// METHODOLOGY EMPLOYED:
+		// Same interpolation between HourOfDay and PreviousHour as DayltgInteriorIllum, done for the
+		// two sky types in use only. The map points are the last index of the factor arrays, so the
+		// loops run over contiguous factors.
+
+		auto & map( IllumMapCalc( MapNum ) );
+		int const NREFPT( map.TotalMapRefPoints );
+		Array5D< DaylFactorType > const * const FacSky[ 3 ] = { &map.DaylIllFacSky, &map.DaylBackFacSky, &map.DaylSourceFacSky };
+		Array4D< DaylFactorType > const * const FacSun[ 3 ] = { &map.DaylIllFacSun, &map.DaylBackFacSun, &map.DaylSourceFacSun };
+		Array4D< DaylFactorType > const * const FacSunDisk[ 3 ] = { &map.DaylIllFacSunDisk, &map.DaylBackFacSunDisk, &map.DaylSourceFacSunDisk };
+		Array3D< Real64 > * const FromWin[ 3 ] = { &map.IllumFromWinAtMapPt, &map.BackLumFromWinAtMapPt, &map.SourceLumFromWinAtMapPt };
+
+		for ( int Fac = 0; Fac < 3; ++Fac ) { // Illuminance, background luminance, source luminance
+			auto const & Sky( *FacSky[ Fac ] );
+			auto const & Sun( *FacSun[ Fac ] );
+			auto const & SunDisk( *FacSunDisk[ Fac ] );
+			auto & Lum( *FromWin[ Fac ] );
+			assert( equal_dimensions( Sun, SunDisk ) );
+			auto const lSky1( Sky.index( HourOfDay, IS, ISky1, loop, 1 ) );
+			auto const lSky1Prev( Sky.index( PreviousHour, IS, ISky1, loop, 1 ) );
+			auto const lSky2( Sky.index( HourOfDay, IS, ISky2, loop, 1 ) );
+			auto const lSky2Prev( Sky.index( PreviousHour, IS, ISky2, loop, 1 ) );
+			auto const lSun( Sun.index( HourOfDay, IS, loop, 1 ) );
+			auto const lSunPrev( Sun.index( PreviousHour, IS, loop, 1 ) );
+			auto const lLum( Lum.index( loop, IS, 1 ) );
+			for ( int i = 0; i < NREFPT; ++i ) { // [ lSky1 + i ] == ( HourOfDay, IS, ISky1, loop, i + 1 ) ...
+				Real64 const SkyFac1( VTRatio * ( WeightNow * Sky[ lSky1 + i ] + WeightPreviousHour * Sky[ lSky1Prev + i ] ) );
+				Real64 const SkyFac2( VTRatio * ( WeightNow * Sky[ lSky2 + i ] + WeightPreviousHour * Sky[ lSky2Prev + i ] ) );
+				Real64 SunFac;
+				if ( IS == 1 ) {
+					SunFac = VTRatio * ( WeightNow * ( Sun[ lSun + i ] + SunDisk[ lSun + i ] ) + WeightPreviousHour * ( Sun[ lSunPrev + i ] + SunDisk[ lSunPrev + i ] ) );
+				} else {
+					SunFac = VTRatio * ( WeightNow * Sun[ lSun + i ] + WeightPreviousHour * Sun[ lSunPrev + i ] );
+					if ( AddSunDisk ) SunFac += VTRatio * ( WeightNow * SunDisk[ lSun + i ] + WeightPreviousHour * SunDisk[ lSunPrev + i ] );
+				}
+				Lum[ lLum + i ] = SunFac * HISUNF + HorIllSkyFac * ( SkyFac1 * SkyWeight * HorIllSky( ISky1 ) + SkyFac2 * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+			}
+		}
+		auto & SourceLum( map.SourceLumFromWinAtMapPt );
+		auto l( SourceLum.index( loop, IS, 1 ) );
+		for ( int i = 0; i < NREFPT; ++i, ++l ) {
+			SourceLum[ l ] = max( SourceLum[ l ], 0.0 );
+		}
+
+	}
+
 	void
 	ReportIllumMap( int const MapNum )
 	{
@@ -9637,6 +10124,7 @@ Label903: ;
 		Array1D_int ZoneExtWin;
 		int WinSize;
 		int RefSize;
+		int ShadeSize; // Extent of the shading index of the zone's factor arrays
 		int MapNum;
 
 		// Formats
@@ -9903,28 +10391,35 @@ Label903: ;
 				ZoneDaylight( ZoneNum ).NumOfDayltgExtWins = ZoneExtWin( ZoneNum );
 				WinSize = ZoneExtWin( ZoneNum );
 				RefSize = 2;
-				ZoneDaylight( ZoneNum ).DaylIllFacSky.allocate( 24, MaxSlatAngs + 1, 4, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylSourceFacSky.allocate( 24, MaxSlatAngs + 1, 4, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylBackFacSky.allocate( 24, MaxSlatAngs + 1, 4, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylIllFacSun.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylIllFacSunDisk.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylSourceFacSun.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylBackFacSun.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-				ZoneDaylight( ZoneNum ).DaylBackFacSunDisk.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
+
+				// Only a blind with movable slats has factors beyond the shading index 2 (one per slat angle)
+				ShadeSize = 2;
+				for ( loop = 1; loop <= WinSize; ++loop ) {
+					if ( SurfaceWindow( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop ) ).MovableSlats ) ShadeSize = MaxSlatAngs + 1;
+				}
+				ZoneDaylight( ZoneNum ).NumShadeStates = ShadeSize;
+				ZoneDaylight( ZoneNum ).DaylIllFacSky.allocate( 24, ShadeSize, 4, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylSourceFacSky.allocate( 24, ShadeSize, 4, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylBackFacSky.allocate( 24, ShadeSize, 4, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylIllFacSun.allocate( 24, ShadeSize, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylIllFacSunDisk.allocate( 24, ShadeSize, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylSourceFacSun.allocate( 24, ShadeSize, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk.allocate( 24, ShadeSize, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylBackFacSun.allocate( 24, ShadeSize, RefSize, WinSize );
+				ZoneDaylight( ZoneNum ).DaylBackFacSunDisk.allocate( 24, ShadeSize, RefSize, WinSize );
 
 				for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).MapCount; ++loop ) {
 					MapNum = ZoneDaylight( ZoneNum ).ZoneToMap( loop );
 					RefSize = IllumMapCalc( MapNum ).TotalMapRefPoints;
-					IllumMapCalc( MapNum ).DaylIllFacSky.allocate( 24, MaxSlatAngs + 1, 4, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylSourceFacSky.allocate( 24, MaxSlatAngs + 1, 4, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylBackFacSky.allocate( 24, MaxSlatAngs + 1, 4, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylIllFacSun.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylIllFacSunDisk.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylSourceFacSun.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylSourceFacSunDisk.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylBackFacSun.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
-					IllumMapCalc( MapNum ).DaylBackFacSunDisk.allocate( 24, MaxSlatAngs + 1, RefSize, WinSize );
+					IllumMapCalc( MapNum ).DaylIllFacSky.allocate( 24, ShadeSize, 4, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylSourceFacSky.allocate( 24, ShadeSize, 4, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylBackFacSky.allocate( 24, ShadeSize, 4, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylIllFacSun.allocate( 24, ShadeSize, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylIllFacSunDisk.allocate( 24, ShadeSize, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylSourceFacSun.allocate( 24, ShadeSize, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylSourceFacSunDisk.allocate( 24, ShadeSize, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylBackFacSun.allocate( 24, ShadeSize, WinSize, RefSize );
+					IllumMapCalc( MapNum ).DaylBackFacSunDisk.allocate( 24, ShadeSize, WinSize, RefSize );
 				}
 
 			} // End of check if a Daylighting:Detailed zone
@@ -1,9 +1,19 @@
 #ifndef DaylightingManager_hh_INCLUDED
 #define DaylightingManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array2A.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array2S.hh>
 #include <ObjexxFCL/Array3D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -11,6 +21,7 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataBSDFWindow.hh>
+#include <DataDaylighting.hh>
 
 namespace EnergyPlus {
 
@@ -27,10 +38,10 @@ namespace DaylightingManager {
 	extern int TotWindowsWithDayl; // Total number of exterior windows in all daylit zones
 	extern int OutputFileDFS; // Unit number for daylight factors
 	extern Array1D< Real64 > DaylIllum; // Daylight illuminance at reference points (lux)
-	extern Real64 PHSUN; // Solar altitude (radians)
-	extern Real64 SPHSUN; // Sine of solar altitude
-	extern Real64 CPHSUN; // Cosine of solar altitude
-	extern Real64 THSUN; // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+	extern EP_THREAD_LOCAL Real64 PHSUN; // Solar altitude (radians)
+	extern EP_THREAD_LOCAL Real64 SPHSUN; // Sine of solar altitude
+	extern EP_THREAD_LOCAL Real64 CPHSUN; // Cosine of solar altitude
+	extern EP_THREAD_LOCAL Real64 THSUN; // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
 	extern Array1D< Real64 > PHSUNHR; // Hourly values of PHSUN
 	extern Array1D< Real64 > SPHSUNHR; // Hourly values of the sine of PHSUN
 	extern Array1D< Real64 > CPHSUNHR; // Hourly values of the cosine of PHSUN
@@ -40,24 +51,24 @@ namespace DaylightingManager {
 	// I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
 	// J = 1 for bare window, 2 - 12 for shaded;
 	// K = sun position index.
-	extern Array3D< Real64 > EINTSK; // Sky-related portion of internally reflected illuminance
-	extern Array2D< Real64 > EINTSU; // Sun-related portion of internally reflected illuminance,
+	extern EP_THREAD_LOCAL Array3D< Real64 > EINTSK; // Sky-related portion of internally reflected illuminance
+	extern EP_THREAD_LOCAL Array2D< Real64 > EINTSU; // Sun-related portion of internally reflected illuminance,
 	// excluding entering beam
-	extern Array2D< Real64 > EINTSUdisk; // Sun-related portion of internally reflected illuminance
+	extern EP_THREAD_LOCAL Array2D< Real64 > EINTSUdisk; // Sun-related portion of internally reflected illuminance
 	// due to entering beam
-	extern Array3D< Real64 > WLUMSK; // Sky-related window luminance
-	extern Array2D< Real64 > WLUMSU; // Sun-related window luminance, excluding view of solar disk
-	extern Array2D< Real64 > WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
+	extern EP_THREAD_LOCAL Array3D< Real64 > WLUMSK; // Sky-related window luminance
+	extern EP_THREAD_LOCAL Array2D< Real64 > WLUMSU; // Sun-related window luminance, excluding view of solar disk
+	extern EP_THREAD_LOCAL Array2D< Real64 > WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
 
 	extern Array2D< Real64 > GILSK; // Horizontal illuminance from sky, by sky type, for each hour of the day
 	extern Array1D< Real64 > GILSU; // Horizontal illuminance from sun for each hour of the day
 
-	extern Array3D< Real64 > EDIRSK; // Sky-related component of direct illuminance
-	extern Array2D< Real64 > EDIRSU; // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-	extern Array2D< Real64 > EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
-	extern Array3D< Real64 > AVWLSK; // Sky-related average window luminance
-	extern Array2D< Real64 > AVWLSU; // Sun-related average window luminance, excluding view of solar disk
-	extern Array2D< Real64 > AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
+	extern EP_THREAD_LOCAL Array3D< Real64 > EDIRSK; // Sky-related component of direct illuminance
+	extern EP_THREAD_LOCAL Array2D< Real64 > EDIRSU; // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+	extern EP_THREAD_LOCAL Array2D< Real64 > EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
+	extern EP_THREAD_LOCAL Array3D< Real64 > AVWLSK; // Sky-related average window luminance
+	extern EP_THREAD_LOCAL Array2D< Real64 > AVWLSU; // Sun-related average window luminance, excluding view of solar disk
+	extern EP_THREAD_LOCAL Array2D< Real64 > AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
 
 	// Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -72,6 +83,38 @@ namespace DaylightingManager {
 
 	extern std::string mapLine; // character variable to hold map outputs
 
+	// Types
+
+	struct DaylightingCacheData
+	{
+		// On-disk cache of the daylighting factors of each daylit zone, keyed by the zone and a
+		// hash of the hourly sun positions and exterior illuminances of the calculation.  The file
+		// is tied to the geometry, construction and daylighting input through a hash, so a run
+		// that only changes other input (e.g. HVAC) reuses the factors of an earlier run.
+
+		// Members
+		bool Active; // True when daylighting factors are read from and written to the cache file
+		std::string FileName; // Cache file name
+		std::uint64_t InputHash; // Hash of the input the file belongs to
+		std::fstream File; // Cache file, records are appended as they are computed
+		std::map< std::tuple< int, int, std::uint64_t >, std::streamoff > Index; // Record offset of each cached (zone, maps included, sun key)
+		Array1D_bool ZoneCalculated; // True once the zone's factors have been calculated in this run
+		int NumHits; // Number of zone calculations satisfied from the cache
+		int NumMisses; // Number of zone calculations computed and added to the cache
+
+		// Default Constructor
+		DaylightingCacheData() :
+			Active( false ),
+			InputHash( 0u ),
+			NumHits( 0 ),
+			NumMisses( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern DaylightingCacheData DaylightingCache;
+
 	// Functions
 
 	void
@@ -80,6 +123,48 @@ namespace DaylightingManager {
 	void
 	CalcDayltgCoefficients();
 
+	void
+	DaylightingCacheHash(
+		std::uint64_t & Hash, // Running hash
+		void const * Data, // Bytes to add
+		std::size_t const NumBytes // Number of bytes
+	);
+
+	std::uint64_t
+	DaylightingInputHash();
+
+	void
+	InitDaylightingCache( std::string const & FileName ); // Cache file name, empty for no cache
+
+	bool
+	DaylightingCacheUsable( int const ZoneNum );
+
+	bool
+	DayltgZoneHasSharedWindowState( int const ZoneNum );
+
+	std::uint64_t
+	DaylightingCacheSunKey();
+
+	void
+	DaylightingCacheArrays(
+		int const ZoneNum,
+		bool const IncludeMaps, // True if the zone's illuminance map factors are included
+		std::vector< Array< Real64 > * > & Arrays, // Solid angle arrays
+		std::vector< Array< DataDaylighting::DaylFactorType > * > & FactorArrays // Daylighting and glare factor arrays
+	);
+
+	bool
+	RestoreDayltgCoeffsFromCache(
+		int const ZoneNum,
+		bool const IncludeMaps // True if the zone's illuminance map factors are included
+	);
+
+	void
+	SaveDayltgCoeffsToCache(
+		int const ZoneNum,
+		bool const IncludeMaps // True if the zone's illuminance map factors are included
+	);
+
 	void
 	CalcDayltgCoeffsRefMapPoints( int const ZoneNum );
 
@@ -89,6 +174,17 @@ namespace DaylightingManager {
 	void
 	CalcDayltgCoeffsMapPoints( int const ZoneNum );
 
+	void
+	CalcDayltgCoeffsMapPoint(
+		int const ZoneNum,
+		int const MapNum,
+		int const IL, // Map point number
+		Array1A< Real64 > const VIEWVC, // View vector in absolute coordinate system
+		Real64 const AZVIEW, // Azimuth of view vector in absolute coord system (radians)
+		Array2D< Real64 > & MapWindowSolidAngAtRefPt,
+		Array2D< Real64 > & MapWindowSolidAngAtRefPtWtd
+	);
+
 	void
 	FigureDayltgCoeffsAtPointsSetupForWindow(
 		int const ZoneNum,
@@ -301,6 +397,13 @@ namespace DaylightingManager {
 		Optional< Array2S< Real64 > const > MapWindowSolidAngAtRefPtWtd = _
 	);
 
+	void
+	StoreDaylFactor(
+		DataDaylighting::DaylFactorType & Factor, // Factor array element
+		Real64 const Value, // Factor as calculated
+		Real64 & MaxError // Largest relative error of the factors stored so far
+	);
+
 	void
 	FigureRefPointDayltgFactorsToAddIllums(
 		int const ZoneNum,
@@ -537,6 +640,20 @@ namespace DaylightingManager {
 	void
 	DayltgInteriorMapIllum( int & ZoneNum ); // Zone number
 
+	void
+	DayltgInterpolateMapFactors(
+		int const MapNum, // Illuminance map number
+		int const loop, // Daylit window index of the zone
+		int const IS, // Shading index: 1 = bare window, 2 = shade, screen, fixed slat blind or diffusing glass
+		bool const AddSunDisk, // True if the sun disk factors are added to the sun factors
+		Real64 const VTRatio, // Visible transmittance ratio of a thermochromic window to its master construction
+		int const ISky1, // First of the two sky types averaged for the current sky
+		int const ISky2, // Second of the two sky types averaged for the current sky
+		Real64 const SkyWeight, // Weighting factor of ISky1
+		Array1< Real64 > const & HorIllSky, // Horizontal illuminance of each sky type (lux)
+		Real64 const HorIllSkyFac // Ratio of the current horizontal sky illuminance to the averaged one
+	);
+
 	void
 	ReportIllumMap( int const MapNum );
 
@@ -82,6 +82,7 @@ namespace DemandManager {
 	int DemandManagerHBIterations( 0 );
 	int DemandManagerHVACIterations( 0 );
 	bool GetInput( true ); // Flag to prevent input from being read multiple times
+	Array1D_bool LimitChangedZone; // TRUE for the zones whose lights or electric equipment limits changed since the heat balance was last resimulated
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -167,6 +168,9 @@ namespace DemandManager {
 				DemandManagerHBIterations = 0;
 				DemandManagerHVACIterations = 0;
 
+				// The limits set in the last iteration of the previous timestep were simulated in this timestep already
+				if ( allocated( LimitChangedZone ) ) LimitChangedZone = false;
+
 				firstTime = true;
 				ResimExt = false;
 				ResimHB = false;
@@ -1495,6 +1499,7 @@ namespace DemandManager {
 		using DataHeatBalFanSys::ZoneThermostatSetPointHi;
 		using DataHeatBalFanSys::ZoneThermostatSetPointLo;
 		using DataHeatBalFanSys::ComfortControlType;
+		using DataGlobals::NumOfZones;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1504,6 +1509,7 @@ namespace DemandManager {
 
 		// FLOW:
 		CanReduceDemand = false;
+		if ( ! allocated( LimitChangedZone ) ) LimitChangedZone.dimension( NumOfZones, false );
 
 		{ auto const SELECT_CASE_var( DemandMgr( MgrNum ).Type );
 
@@ -1523,9 +1529,11 @@ namespace DemandManager {
 			if ( Action == CheckCanReduce ) {
 				if ( Lights( LoadPtr ).Power > LowestPower ) CanReduceDemand = true;
 			} else if ( Action == SetLimit ) {
+				if ( ! Lights( LoadPtr ).ManageDemand || Lights( LoadPtr ).DemandLimit != LowestPower ) LimitChangedZone( Lights( LoadPtr ).ZonePtr ) = true;
 				Lights( LoadPtr ).ManageDemand = true;
 				Lights( LoadPtr ).DemandLimit = LowestPower;
 			} else if ( Action == ClearLimit ) {
+				if ( Lights( LoadPtr ).ManageDemand ) LimitChangedZone( Lights( LoadPtr ).ZonePtr ) = true;
 				Lights( LoadPtr ).ManageDemand = false;
 			}
 
@@ -1534,9 +1542,11 @@ namespace DemandManager {
 			if ( Action == CheckCanReduce ) {
 				if ( ZoneElectric( LoadPtr ).Power > LowestPower ) CanReduceDemand = true;
 			} else if ( Action == SetLimit ) {
+				if ( ! ZoneElectric( LoadPtr ).ManageDemand || ZoneElectric( LoadPtr ).DemandLimit != LowestPower ) LimitChangedZone( ZoneElectric( LoadPtr ).ZonePtr ) = true;
 				ZoneElectric( LoadPtr ).ManageDemand = true;
 				ZoneElectric( LoadPtr ).DemandLimit = LowestPower;
 			} else if ( Action == ClearLimit ) {
+				if ( ZoneElectric( LoadPtr ).ManageDemand ) LimitChangedZone( ZoneElectric( LoadPtr ).ZonePtr ) = true;
 				ZoneElectric( LoadPtr ).ManageDemand = false;
 			}
 
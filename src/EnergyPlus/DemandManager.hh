@@ -48,6 +48,7 @@ namespace DemandManager {
 	extern int DemandManagerHBIterations;
 	extern int DemandManagerHVACIterations;
 	extern bool GetInput; // Flag to prevent input from being read multiple times
+	extern Array1D_bool LimitChangedZone; // TRUE for the zones whose lights or electric equipment limits changed since the heat balance was last resimulated
 
 	// SUBROUTINE SPECIFICATIONS:
 
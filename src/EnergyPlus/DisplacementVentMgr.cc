@@ -291,8 +291,8 @@ namespace DisplacementVentMgr {
 				SurfNum = APos_Wall( Ctd );
 				Surface( SurfNum ).TAirRef = AdjacentAirTemp;
 				if ( SurfNum == 0 ) continue;
-				Z1 = minval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
-				Z2 = maxval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
+				Z1 = SurfMinZ( SurfNum );
+				Z2 = SurfMaxZ( SurfNum );
 				ZSupSurf = Z2 - ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 1 );
 				ZInfSurf = Z1 - ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 1 );
 
@@ -341,8 +341,8 @@ namespace DisplacementVentMgr {
 				Surface( SurfNum ).TAirRef = AdjacentAirTemp;
 				if ( SurfNum == 0 ) continue;
 				if ( Surface( SurfNum ).Tilt > 10.0 && Surface( SurfNum ).Tilt < 170.0 ) { // Window Wall
-					Z1 = minval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
-					Z2 = maxval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
+					Z1 = SurfMinZ( SurfNum );
+					Z2 = SurfMaxZ( SurfNum );
 					ZSupSurf = Z2 - ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 1 );
 					ZInfSurf = Z1 - ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 1 );
 
@@ -404,8 +404,8 @@ namespace DisplacementVentMgr {
 				SurfNum = APos_Door( Ctd );
 				Surface( SurfNum ).TAirRef = AdjacentAirTemp;
 				if ( SurfNum == 0 ) continue;
-				Z1 = minval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
-				Z2 = maxval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
+				Z1 = SurfMinZ( SurfNum );
+				Z2 = SurfMaxZ( SurfNum );
 				ZSupSurf = Z2 - ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 1 );
 				ZInfSurf = Z1 - ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 1 );
 
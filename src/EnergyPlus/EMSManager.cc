@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 
 // ObjexxFCL Headers
@@ -25,6 +26,7 @@
 #include <InputProcessor.hh>
 #include <OutAirNodeManager.hh>
 #include <OutputProcessor.hh>
+#include <Profiler.hh>
 #include <RuntimeLanguageProcessor.hh>
 #include <ScheduleManager.hh>
 #include <UtilityRoutines.hh>
@@ -73,6 +75,15 @@ namespace EMSManager {
 	bool GetEMSUserInput( true ); // Flag to prevent input from being read multiple times
 	bool ZoneThermostatActuatorsHaveBeenSetup( false );
 	bool FinishProcessingUserInput( true ); // Flag to indicate still need to process input
+	bool EMSBindingsNeeded( true ); // Flag to indicate sensors and actuators need to be bound again
+	int BoundNumSensors( -1 ); // count of sensors when the bindings were made
+	int BoundNumActuators( -1 ); // count of actuators when the bindings were made
+	int BoundNumExpressions( -1 ); // count of Erl expressions when the bindings were made
+
+	// Object Data
+	std::vector< EMSSensorBindingType > AllSensorBindings; // every sensor with a valid variable
+	std::vector< std::vector< EMSSensorBindingType > > CallingPointSensorBindings; // sensors read at each calling point
+	std::vector< EMSActuatorBindingType > ActuatorBindings; // every actuator with a valid variable
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -106,6 +117,7 @@ namespace EMSManager {
 		// Using/Aliasing
 		using InputProcessor::GetNumObjectsFound;
 		using DataGlobals::AnyEnergyManagementSystemInModel;
+		using DataGlobals::fCallingPointPtr;
 		using General::ScanForReports;
 
 		// Locals
@@ -179,7 +191,8 @@ namespace EMSManager {
 		NumEMSConstructionIndices = GetNumObjectsFound( cCurrentModuleObject );
 
 		// added for FMU
-		if ( ( NumSensors + numActuatorsUsed + NumProgramCallManagers + NumErlPrograms + NumErlSubroutines + NumUserGlobalVariables + NumEMSOutputVariables + NumEMSCurveIndices + NumExternalInterfaceGlobalVariables + NumExternalInterfaceActuatorsUsed + NumEMSConstructionIndices + NumEMSMeteredOutputVariables + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportGlobalVariables + NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitExportGlobalVariables ) > 0 ) {
+		if ( ( NumSensors + numActuatorsUsed + NumProgramCallManagers + NumErlPrograms + NumErlSubroutines + NumUserGlobalVariables + NumEMSOutputVariables + NumEMSCurveIndices + NumExternalInterfaceGlobalVariables + NumExternalInterfaceActuatorsUsed + NumEMSConstructionIndices + NumEMSMeteredOutputVariables + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportGlobalVariables + NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitExportGlobalVariables ) > 0 || fCallingPointPtr != nullptr ) {
+			// A calling point callback of the library needs the sensors and actuators set up as well
 			AnyEnergyManagementSystemInModel = true;
 		} else {
 			AnyEnergyManagementSystemInModel = false;
@@ -240,6 +253,7 @@ namespace EMSManager {
 		using DataGlobals::emsCallFromExternalInterface;
 		using DataGlobals::emsCallFromBeginNewEvironment;
 		using DataGlobals::emsCallFromUserDefinedComponentModel;
+		using DataGlobals::fCallingPointPtr;
 
 		using RuntimeLanguageProcessor::EvaluateStack;
 		using RuntimeLanguageProcessor::BeginEnvrnInitializeRuntimeLanguage;
@@ -266,24 +280,24 @@ namespace EMSManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		int ErlVariableNum; // local index
 		int ProgramManagerNum; // local index and loop
 		int ErlProgramNum; // local index
-		int ActuatorUsedLoop; // local loop
-		int EMSActuatorVariableNum;
 		bool AnyProgramRan; // local logical
-		int tmpInteger;
 		//  INTEGER  :: ProgramNum
 
 		// FLOW:
 		if ( ! AnyEnergyManagementSystemInModel ) return; // quick return if nothing to do
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "ManageEMS" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		if ( iCalledFrom == emsCallFromBeginNewEvironment ) BeginEnvrnInitializeRuntimeLanguage();
 
 		InitEMS( iCalledFrom );
 
 		if ( iCalledFrom == emsCallFromSetupSimulation ) {
 			ProcessEMSInput( true );
+			if ( fCallingPointPtr ) fCallingPointPtr( iCalledFrom );
 			return;
 		}
 
@@ -312,44 +326,29 @@ namespace EMSManager {
 			AnyProgramRan = true;
 		}
 
+		// The library callback reads variables and sets actuators itself, through their handles
+		if ( fCallingPointPtr ) fCallingPointPtr( iCalledFrom );
+
 		if ( ! AnyProgramRan ) return;
 
 		// Set actuated variables with new values
-		for ( ActuatorUsedLoop = 1; ActuatorUsedLoop <= numActuatorsUsed + NumExternalInterfaceActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed; ++ActuatorUsedLoop ) {
-			ErlVariableNum = EMSActuatorUsed( ActuatorUsedLoop ).ErlVariableNum;
-			if ( ! ( ErlVariableNum > 0 ) ) continue; // this can happen for good reason during sizing
-
-			EMSActuatorVariableNum = EMSActuatorUsed( ActuatorUsedLoop ).ActuatorVariableNum;
-			if ( ! ( EMSActuatorVariableNum > 0 ) ) continue; // this can happen for good reason during sizing
-
-			if ( ErlVariable( ErlVariableNum ).Value.Type == ValueNull ) {
-				EMSActuatorAvailable( EMSActuatorVariableNum ).Actuated = false;
+		for ( auto const & binding : ActuatorBindings ) {
+			auto const & value( ErlVariable( binding.ErlVariableNum ).Value );
+			if ( value.Type == ValueNull ) {
+				*binding.Actuated = false;
 			} else {
 				// Set the value and the actuated flag remotely on the actuated object via the pointer
-				{ auto const SELECT_CASE_var( EMSActuatorAvailable( EMSActuatorVariableNum ).PntrVarTypeUsed );
-
-				if ( SELECT_CASE_var == PntrReal ) {
-					EMSActuatorAvailable( EMSActuatorVariableNum ).Actuated = true;
-					EMSActuatorAvailable( EMSActuatorVariableNum ).RealValue = ErlVariable( ErlVariableNum ).Value.Number;
-				} else if ( SELECT_CASE_var == PntrInteger ) {
-					EMSActuatorAvailable( EMSActuatorVariableNum ).Actuated = true;
-					tmpInteger = std::floor( ErlVariable( ErlVariableNum ).Value.Number );
-					EMSActuatorAvailable( EMSActuatorVariableNum ).IntValue = tmpInteger;
-				} else if ( SELECT_CASE_var == PntrLogical ) {
-					EMSActuatorAvailable( EMSActuatorVariableNum ).Actuated = true;
-					if ( ErlVariable( ErlVariableNum ).Value.Number == 0.0 ) {
-						EMSActuatorAvailable( EMSActuatorVariableNum ).LogValue = false;
-					} else if ( ErlVariable( ErlVariableNum ).Value.Number == 1.0 ) {
-						EMSActuatorAvailable( EMSActuatorVariableNum ).LogValue = true;
-					} else {
-						EMSActuatorAvailable( EMSActuatorVariableNum ).LogValue = false;
-					}
-
-				} else {
-
-				}}
+				if ( binding.PntrVarTypeUsed == PntrReal ) {
+					*binding.Actuated = true;
+					*binding.RealValue = value.Number;
+				} else if ( binding.PntrVarTypeUsed == PntrInteger ) {
+					*binding.Actuated = true;
+					*binding.IntValue = std::floor( value.Number );
+				} else if ( binding.PntrVarTypeUsed == PntrLogical ) {
+					*binding.Actuated = true;
+					*binding.LogValue = ( value.Number == 1.0 );
+				}
 			}
-
 		}
 
 		ReportEMS();
@@ -404,7 +403,6 @@ namespace EMSManager {
 
 		int InternalVarUsedNum; // local index and loop
 		int InternVarAvailNum; // local index
-		int SensorNum; // local loop and index
 		int ErlVariableNum; // local index
 		Real64 tmpReal; // temporary local integer
 
@@ -464,18 +462,205 @@ namespace EMSManager {
 
 		}
 
-		// Update sensors with current data
-		for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
-			ErlVariableNum = Sensor( SensorNum ).VariableNum;
-			if ( ( ErlVariableNum > 0 ) && ( Sensor( SensorNum ).Index > 0 ) ) {
-				if ( Sensor( SensorNum ).SchedNum == 0 ) { // not a schedule so get from output processor
+		if ( EMSBindingsNeeded || NumSensors != BoundNumSensors || NumExpressions != BoundNumExpressions || numActuatorsUsed + NumExternalInterfaceActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed != BoundNumActuators ) {
+			BindEMSSensorsAndActuators();
+		}
+
+		// Update sensors with current data, only those read at this calling point
+		auto const & sensorBindings( ( iCalledFrom > 0 && iCalledFrom < int( CallingPointSensorBindings.size() ) ) ? CallingPointSensorBindings[ iCalledFrom ] : AllSensorBindings );
+		for ( auto const & binding : sensorBindings ) {
+			auto & value( ErlVariable( binding.ErlVariableNum ).Value );
+			if ( binding.RealValue != nullptr ) {
+				value.Number = *binding.RealValue;
+			} else if ( binding.IntValue != nullptr ) {
+				value.Number = double( *binding.IntValue );
+			} else if ( Sensor( binding.SensorNum ).SchedNum == 0 ) { // not a schedule so get from output processor
+				value.Number = GetInternalVariableValue( Sensor( binding.SensorNum ).Type, Sensor( binding.SensorNum ).Index );
+			} else { // schedule so use schedule service
+				value.Number = GetCurrentScheduleValue( Sensor( binding.SensorNum ).SchedNum );
+			}
+		}
+
+	}
+
+	void
+	BindEMSSensorsAndActuators()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Makes the lists of sensors updated at each calling point and of the actuators set
+		// after the programs run, pointing straight at the values they read and write.
+
+		// METHODOLOGY EMPLOYED:
+		// The programs of the calling managers at each calling point, and the subroutines they
+		// run, are walked for the Erl variables they use; only the sensors of those variables
+		// are updated there.  Sensors feeding report and trend variables are updated at every
+		// calling point, as are all sensors at the calling points that run programs other than
+		// by calling manager.  Real and integer output variables are read through the pointer
+		// held by the output processor; meters and schedules still go through their services.
+		// Must be redone whenever input processing may have changed sensors or actuators.
+
+		// Using/Aliasing
+		using DataGlobals::emsCallFromSetupSimulation;
+		using DataGlobals::emsCallFromExternalInterface;
+		using DataGlobals::emsCallFromUserDefinedComponentModel;
+		using DataGlobals::emsCallFromUnitarySystemSizing;
+		using OutputProcessor::NumOfRVariable;
+		using OutputProcessor::NumOfIVariable;
+		using OutputProcessor::RVariableTypes;
+		using OutputProcessor::IVariableTypes;
+		using RuntimeLanguageProcessor::RuntimeReportVar;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumActuators( numActuatorsUsed + NumExternalInterfaceActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed );
+		std::vector< bool > AlwaysUsed( NumErlVariables + 1, false ); // Erl variables read outside of programs
+		std::vector< bool > VariableUsed; // Erl variables used at a calling point
+		std::vector< bool > StackVisited; // Erl stacks walked for a calling point
+
+		// Sensors
+		AllSensorBindings.clear();
+		for ( int SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
+			auto const & sensor( Sensor( SensorNum ) );
+			if ( ! ( sensor.VariableNum > 0 ) || ! ( sensor.Index > 0 ) ) continue;
+			EMSSensorBindingType binding;
+			binding.SensorNum = SensorNum;
+			binding.ErlVariableNum = sensor.VariableNum;
+			if ( sensor.SchedNum == 0 ) {
+				// Out of range indexes are left to GetInternalVariableValue to report
+				if ( sensor.Type == 1 && sensor.Index <= NumOfIVariable ) {
+					binding.IntValue = &IVariableTypes( sensor.Index ).VarPtr().Which();
+				} else if ( sensor.Type == 2 && sensor.Index <= NumOfRVariable ) {
+					binding.RealValue = &RVariableTypes( sensor.Index ).VarPtr().Which();
+				}
+			}
+			AllSensorBindings.push_back( binding );
+		}
 
-					ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( GetInternalVariableValue( Sensor( SensorNum ).Type, Sensor( SensorNum ).Index ), ErlVariable( ErlVariableNum ).Value );
-				} else { // schedule so use schedule service
+		for ( int VarNum = 1; VarNum <= NumEMSOutputVariables + NumEMSMeteredOutputVariables; ++VarNum ) {
+			int const ErlVariableNum( RuntimeReportVar( VarNum ).VariableNum );
+			if ( ErlVariableNum > 0 && ErlVariableNum <= NumErlVariables ) AlwaysUsed[ ErlVariableNum ] = true;
+		}
+		for ( int TrendNum = 1; TrendNum <= NumErlTrendVariables; ++TrendNum ) {
+			int const ErlVariableNum( TrendVariable( TrendNum ).ErlVariablePointer );
+			if ( ErlVariableNum > 0 && ErlVariableNum <= NumErlVariables ) AlwaysUsed[ ErlVariableNum ] = true;
+		}
 
-					ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( GetCurrentScheduleValue( Sensor( SensorNum ).SchedNum ), ErlVariable( ErlVariableNum ).Value );
+		int MaxCallingPoint( emsCallFromUnitarySystemSizing );
+		for ( int ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum ) {
+			MaxCallingPoint = max( MaxCallingPoint, EMSProgramCallManager( ProgramManagerNum ).CallingPoint );
+		}
+		CallingPointSensorBindings.clear();
+		CallingPointSensorBindings.resize( MaxCallingPoint + 1 );
+		for ( int CallingPoint = 1; CallingPoint <= MaxCallingPoint; ++CallingPoint ) {
+			if ( CallingPoint == emsCallFromSetupSimulation || CallingPoint == emsCallFromExternalInterface || CallingPoint == emsCallFromUserDefinedComponentModel ) {
+				CallingPointSensorBindings[ CallingPoint ] = AllSensorBindings;
+				continue;
+			}
+			VariableUsed = AlwaysUsed;
+			StackVisited.assign( NumErlStacks + 1, false );
+			for ( int ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum ) {
+				auto const & manager( EMSProgramCallManager( ProgramManagerNum ) );
+				if ( manager.CallingPoint != CallingPoint ) continue;
+				for ( int ErlProgramNum = 1; ErlProgramNum <= manager.NumErlPrograms; ++ErlProgramNum ) {
+					MarkEMSStackVariables( manager.ErlProgramARR( ErlProgramNum ), StackVisited, VariableUsed );
 				}
 			}
+			for ( auto const & binding : AllSensorBindings ) {
+				if ( VariableUsed[ binding.ErlVariableNum ] ) CallingPointSensorBindings[ CallingPoint ].push_back( binding );
+			}
+		}
+
+		// Actuators
+		ActuatorBindings.clear();
+		for ( int ActuatorUsedLoop = 1; ActuatorUsedLoop <= NumActuators; ++ActuatorUsedLoop ) {
+			int const ErlVariableNum( EMSActuatorUsed( ActuatorUsedLoop ).ErlVariableNum );
+			if ( ! ( ErlVariableNum > 0 ) ) continue; // this can happen for good reason during sizing
+			int const EMSActuatorVariableNum( EMSActuatorUsed( ActuatorUsedLoop ).ActuatorVariableNum );
+			if ( ! ( EMSActuatorVariableNum > 0 ) ) continue; // this can happen for good reason during sizing
+
+			auto & actuator( EMSActuatorAvailable( EMSActuatorVariableNum ) );
+			EMSActuatorBindingType binding;
+			binding.ErlVariableNum = ErlVariableNum;
+			binding.PntrVarTypeUsed = actuator.PntrVarTypeUsed;
+			binding.Actuated = &actuator.Actuated();
+			if ( actuator.PntrVarTypeUsed == PntrReal ) {
+				binding.RealValue = &actuator.RealValue();
+			} else if ( actuator.PntrVarTypeUsed == PntrInteger ) {
+				binding.IntValue = &actuator.IntValue();
+			} else if ( actuator.PntrVarTypeUsed == PntrLogical ) {
+				binding.LogValue = &actuator.LogValue();
+			} else {
+				continue;
+			}
+			ActuatorBindings.push_back( binding );
+		}
+
+		BoundNumSensors = NumSensors;
+		BoundNumActuators = NumActuators;
+		BoundNumExpressions = NumExpressions;
+		EMSBindingsNeeded = false;
+
+	}
+
+	void
+	MarkEMSStackVariables(
+		int const StackNum, // index in ErlStack structure
+		std::vector< bool > & StackVisited, // stacks already walked
+		std::vector< bool > & VariableUsed // Erl variables used by the stacks
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Marks the Erl variables set or read by a program or subroutine and by the subroutines it runs.
+
+		// Using/Aliasing
+		using RuntimeLanguageProcessor::KeywordReturn;
+		using RuntimeLanguageProcessor::KeywordSet;
+		using RuntimeLanguageProcessor::KeywordRun;
+		using RuntimeLanguageProcessor::KeywordIf;
+		using RuntimeLanguageProcessor::KeywordElseIf;
+		using RuntimeLanguageProcessor::KeywordWhile;
+		using RuntimeLanguageProcessor::KeywordEndWhile;
+
+		if ( StackNum < 1 || StackNum > NumErlStacks || StackVisited[ StackNum ] ) return;
+		StackVisited[ StackNum ] = true;
+
+		auto const & stack( ErlStack( StackNum ) );
+		for ( int InstructionNum = 1; InstructionNum <= stack.NumInstructions; ++InstructionNum ) {
+			auto const & instruction( stack.Instruction( InstructionNum ) );
+			int const Keyword( instruction.Keyword );
+			if ( Keyword == KeywordSet ) {
+				if ( instruction.Argument1 > 0 && instruction.Argument1 <= NumErlVariables ) VariableUsed[ instruction.Argument1 ] = true;
+				MarkEMSExpressionVariables( instruction.Argument2, VariableUsed );
+			} else if ( Keyword == KeywordRun ) {
+				MarkEMSStackVariables( instruction.Argument1, StackVisited, VariableUsed );
+			} else if ( Keyword == KeywordReturn || Keyword == KeywordIf || Keyword == KeywordElseIf || Keyword == KeywordWhile || Keyword == KeywordEndWhile ) {
+				MarkEMSExpressionVariables( instruction.Argument1, VariableUsed );
+			}
+		}
+
+	}
+
+	void
+	MarkEMSExpressionVariables(
+		int const ExpressionNum, // index in ErlExpression structure
+		std::vector< bool > & VariableUsed // Erl variables used by the expression
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Marks the Erl variables read by an expression and its nested expressions.
+
+		if ( ExpressionNum < 1 || ExpressionNum > NumExpressions ) return;
+
+		auto const & expression( ErlExpression( ExpressionNum ) );
+		for ( int OperandNum = 1; OperandNum <= expression.NumOperands; ++OperandNum ) {
+			auto const & operand( expression.Operand( OperandNum ) );
+			if ( operand.Type == ValueExpression ) {
+				MarkEMSExpressionVariables( operand.Expression, VariableUsed );
+			} else if ( operand.Type == ValueVariable ) {
+				if ( operand.Variable > 0 && operand.Variable <= NumErlVariables ) VariableUsed[ operand.Variable ] = true;
+			}
 		}
 
 	}
@@ -603,6 +788,8 @@ namespace EMSManager {
 		bool errFlag;
 
 		// FLOW:
+		EMSBindingsNeeded = true;
+
 		cCurrentModuleObject = "EnergyManagementSystem:Sensor";
 		GetObjectDefMaxArgs( cCurrentModuleObject, TotalArgs, NumAlphas, NumNums );
 		MaxNumNumbers = NumNums;
@@ -1022,6 +1209,8 @@ namespace EMSManager {
 		int InternalVarAvailNum; // local do loop index
 		std::string cCurrentModuleObject;
 
+		EMSBindingsNeeded = true; // sensors and actuators may be resolved below
+
 		cCurrentModuleObject = "EnergyManagementSystem:Sensor";
 		for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
 			if ( Sensor( SensorNum ).CheckedOkay ) continue;
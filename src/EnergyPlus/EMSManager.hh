@@ -1,6 +1,9 @@
 #ifndef EMSManager_hh_INCLUDED
 #define EMSManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Optional.hh>
 
@@ -33,6 +36,56 @@ namespace EMSManager {
 	extern bool GetEMSUserInput; // Flag to prevent input from being read multiple times
 	extern bool ZoneThermostatActuatorsHaveBeenSetup;
 	extern bool FinishProcessingUserInput; // Flag to indicate still need to process input
+	extern bool EMSBindingsNeeded; // Flag to indicate sensors and actuators need to be bound again
+
+	// Types
+
+	struct EMSSensorBindingType
+	{
+		// Members
+		// sensor bound to the storage of the output variable it reads
+		int SensorNum; // index in Sensor structure
+		int ErlVariableNum; // Erl variable updated from the sensor
+		Real64 const * RealValue; // real output variable value, null if not a real output variable
+		int const * IntValue; // integer output variable value, null if not an integer output variable
+
+		// Default Constructor
+		EMSSensorBindingType() :
+			SensorNum( 0 ),
+			ErlVariableNum( 0 ),
+			RealValue( nullptr ),
+			IntValue( nullptr )
+		{}
+
+	};
+
+	struct EMSActuatorBindingType
+	{
+		// Members
+		// actuator bound to the model variables it sets
+		int ErlVariableNum; // Erl variable holding the actuated value
+		int PntrVarTypeUsed; // data type of the actuated value, PntrReal, PntrInteger or PntrLogical
+		bool * Actuated; // flag that signals EMS is actuating
+		Real64 * RealValue; // actuated value when PntrVarTypeUsed is PntrReal
+		int * IntValue; // actuated value when PntrVarTypeUsed is PntrInteger
+		bool * LogValue; // actuated value when PntrVarTypeUsed is PntrLogical
+
+		// Default Constructor
+		EMSActuatorBindingType() :
+			ErlVariableNum( 0 ),
+			PntrVarTypeUsed( 0 ),
+			Actuated( nullptr ),
+			RealValue( nullptr ),
+			IntValue( nullptr ),
+			LogValue( nullptr )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< EMSSensorBindingType > AllSensorBindings; // every sensor with a valid variable
+	extern std::vector< std::vector< EMSSensorBindingType > > CallingPointSensorBindings; // sensors read at each calling point
+	extern std::vector< EMSActuatorBindingType > ActuatorBindings; // every actuator with a valid variable
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -52,6 +105,22 @@ namespace EMSManager {
 	void
 	InitEMS( int const iCalledFrom ); // indicates where subroutine was called from, parameters in DataGlobals.
 
+	void
+	BindEMSSensorsAndActuators();
+
+	void
+	MarkEMSStackVariables(
+		int const StackNum, // index in ErlStack structure
+		std::vector< bool > & StackVisited, // stacks already walked
+		std::vector< bool > & VariableUsed // Erl variables used by the stacks
+	);
+
+	void
+	MarkEMSExpressionVariables(
+		int const ExpressionNum, // index in ErlExpression structure
+		std::vector< bool > & VariableUsed // Erl variables used by the expression
+	);
+
 	void
 	ReportEMS();
 
@@ -267,6 +267,8 @@ namespace EcoRoofManager {
 		//  INTEGER,EXTERNAL :: GetNewUnitNumber ! external function to return a new (unique) unit for ecoroof writing
 		static int unit( 0 );
 		static bool MyEnvrnFlag( true );
+		static int SoilUpdateStep( 0 ); // Zone time step of the environment the soil moisture was last updated for
+		int CurrentStep; // Zone time step of the environment now being simulated
 
 		Ws = WindSpeedAt( Surface( SurfNum ).Centroid.z ); // use windspeed at Z of roof
 		if ( Ws < 2.0 ) { // Later we need to adjust for building roof height...
@@ -370,6 +372,7 @@ namespace EcoRoofManager {
 			CurrentET = 0.0;
 			CurrentPrecipitation = 0.0;
 			CurrentIrrigation = 0.0;
+			SoilUpdateStep = 0;
 			MyEnvrnFlag = false;
 		}
 
@@ -379,7 +382,13 @@ namespace EcoRoofManager {
 
 		// If current surface is = FirstEcoSurf then for this time step we need to update the soil moisture
 		if ( SurfNum == FirstEcoSurf ) {
-			UpdateSoilProps( Moisture, MeanRootMoisture, MoistureMax, MoistureResidual, SoilThickness, Vfluxf, Vfluxg, ConstrNum, Alphag, unit, Tg, Tf, Qsoil );
+			// The outside surface heat balance is resimulated within the time step when radiant systems are on,
+			// so the stamp keeps the moisture from being drawn down (and the depths summed) more than once
+			CurrentStep = ( ( DayOfSim - 1 ) * 24 + HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
+			if ( CurrentStep != SoilUpdateStep ) {
+				UpdateSoilProps( Moisture, MeanRootMoisture, MoistureMax, MoistureResidual, SoilThickness, Vfluxf, Vfluxg, ConstrNum, Alphag, unit, Tg, Tf, Qsoil );
+				SoilUpdateStep = CurrentStep;
+			}
 
 			Ta = OutDryBulbTempAt( Surface( SurfNum ).Centroid.z ); // temperature outdoor - Surface is dry, use normal correlation
 			Tg = Tgold;
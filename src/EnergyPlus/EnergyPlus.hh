@@ -22,4 +22,11 @@ typedef  std::int64_t  Int64;
 typedef  float         Real32; // Platform-specific: C++ has no defined precision floating point types
 typedef  double        Real64; // Platform-specific: C++ has no defined precision floating point types
 
+// Scratch data that each OpenMP thread needs its own copy of
+#ifdef HBIRE_USE_OMP
+#define EP_THREAD_LOCAL thread_local
+#else
+#define EP_THREAD_LOCAL
+#endif
+
 #endif
@@ -3,7 +3,13 @@
 #endif
 
 // C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <unordered_map>
 #ifndef NDEBUG
 #ifdef __unix__
 #include <cfenv>
@@ -20,9 +26,11 @@
 // EnergyPlus Headers
 #include <EnergyPlusPgm.hh>
 #include <CommandLineInterface.hh>
+#include <CsvOutput.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataRuntimeLanguage.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
 #include <DataTimings.hh>
@@ -40,9 +48,133 @@
  #include <stdlib.h>
  #include <direct.h>
 #else //Mac or Linux
+ #include <sys/types.h>
+ #include <sys/wait.h>
  #include <unistd.h>
 #endif
 
+namespace {
+
+	// Variants forked after input processing by EnergyPlusPgmRunVariants
+	std::vector< std::string > const * VariantDirectories( nullptr ); // Run directory of each variant
+	std::vector< std::vector< std::string > > const * VariantOverrides( nullptr ); // Input fields changed for each variant
+	int MaxConcurrentVariants( 1 );
+	int NumVariantsFailed( 0 );
+
+	bool
+	ForkInputVariants()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forks a child for each variant from the process that has processed the input, and returns
+		// true in each child, set up to simulate its variant, or false in this process once all the
+		// variants have ended.
+
+		// METHODOLOGY EMPLOYED:
+		// The child changes to the directory of its variant, taking there the output files already
+		// opened with what was written to them, changes the input fields of its variant, and goes on
+		// with the simulation; input file names are made absolute first, so that they still name
+		// the input of the base run.
+
+		using namespace EnergyPlus;
+		using namespace DataStringGlobals;
+
+#ifdef _WIN32
+		DisplayString( "EnergyPlusPgmRunVariants: Not available on Windows; run each variant with EnergyPlusPgm." );
+		NumVariantsFailed = static_cast< int >( VariantDirectories->size() );
+		return false;
+#else
+		std::vector< std::string > const OpenedFileNames( { outputAuditFileName, outputIperrFileName, outputErrFileName, outputDbgFileName } );
+		std::string const BaseDirectory( FileSystem::getAbsolutePath( "." ) + pathChar );
+
+		std::map< pid_t, std::string > Running; // Run directory of each child still running
+		auto wait_for_run = [&]() {
+			int Status( 0 );
+			pid_t const Child( waitpid( -1, &Status, 0 ) );
+			auto const Run( Running.find( Child ) );
+			if ( Run == Running.end() ) { // No child left to wait for
+				NumVariantsFailed += static_cast< int >( Running.size() );
+				Running.clear();
+				return;
+			}
+			if ( ! WIFEXITED( Status ) || WEXITSTATUS( Status ) != EXIT_SUCCESS ) {
+				DisplayString( "EnergyPlusPgmRunVariants: Variant in " + Run->second + " did not complete successfully." );
+				++NumVariantsFailed;
+			}
+			Running.erase( Run );
+		};
+
+		for ( std::vector< std::string >::size_type Variant = 0; Variant < VariantDirectories->size(); ++Variant ) {
+			std::string const & RunDirectory( ( *VariantDirectories )[ Variant ] );
+			while ( int( Running.size() ) >= std::max( MaxConcurrentVariants, 1 ) ) wait_for_run();
+			for ( auto const & FileName : OpenedFileNames ) {
+				IOFlags flags; gio::inquire( FileName, flags ); if ( flags.open() ) gio::flush( flags.unit() );
+			}
+			std::cout.flush();
+			std::cerr.flush();
+			pid_t const Child( fork() );
+			if ( Child == 0 ) {
+				inputIdfFileName = FileSystem::getAbsolutePath( inputIdfFileName );
+				inputIddFileName = FileSystem::getAbsolutePath( inputIddFileName );
+				inputWeatherFileName = FileSystem::getAbsolutePath( inputWeatherFileName );
+				idfDirPathName = FileSystem::getAbsolutePath( idfDirPathName ) + pathChar;
+				FileSystem::makeDirectory( RunDirectory );
+				if ( chdir( RunDirectory.c_str() ) != 0 ) {
+					DisplayString( "EnergyPlusPgmRunVariants: Could not change directory to " + RunDirectory + "." );
+					std::exit( EXIT_FAILURE );
+				}
+				for ( auto const & FileName : OpenedFileNames ) {
+					int Unit;
+					{ IOFlags flags; gio::inquire( FileName, flags ); if ( ! flags.open() ) continue; Unit = flags.unit(); }
+					gio::close( Unit );
+					{
+						std::ifstream Written( BaseDirectory + FileName, std::ios_base::in | std::ios_base::binary );
+						std::ofstream Copy( FileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+						if ( Written && Written.peek() != std::ifstream::traits_type::eof() ) Copy << Written.rdbuf();
+					}
+					{ IOFlags flags; flags.ACTION( "write" ); flags.POSITION( "APPEND" ); gio::open( Unit, FileName, flags ); }
+				}
+				InputProcessor::echo_stream = gio::out_stream( InputProcessor::EchoInputFile );
+
+				bool ErrorsFound( false );
+				for ( auto const & Override : ( *VariantOverrides )[ Variant ] ) {
+					std::vector< std::string > Fields;
+					std::string::size_type Start( 0 );
+					for ( int Field = 1; Field <= 3; ++Field ) {
+						std::string::size_type const Comma( Override.find( ',', Start ) );
+						if ( Comma == std::string::npos ) break;
+						Fields.push_back( stripped( Override.substr( Start, Comma - Start ) ) );
+						Start = Comma + 1;
+					}
+					bool Overridden( false );
+					if ( Fields.size() == 3u ) {
+						bool ErrorFlag( false );
+						int const FieldNum( static_cast< int >( InputProcessor::ProcessNumber( Fields[ 2 ], ErrorFlag ) ) );
+						Overridden = ! ErrorFlag && InputProcessor::OverrideInputField( Fields[ 0 ], Fields[ 1 ], FieldNum, stripped( Override.substr( Start ) ) );
+					}
+					if ( ! Overridden ) {
+						ShowSevereError( "EnergyPlusPgmRunVariants: Could not change the input field given by \"" + Override + "\"." );
+						ShowContinueError( "...Give the object type, object name, field number (from 1) and new value, separated by commas." );
+						ErrorsFound = true;
+					}
+				}
+				if ( ErrorsFound ) ShowFatalError( "EnergyPlusPgmRunVariants: Errors in the input fields of the variant in " + RunDirectory + " cause program termination." );
+				return true;
+			} else if ( Child < 0 ) {
+				DisplayString( "EnergyPlusPgmRunVariants: Could not start the variant in " + RunDirectory + "." );
+				++NumVariantsFailed;
+			} else {
+				Running[ Child ] = RunDirectory;
+			}
+		}
+		while ( ! Running.empty() ) wait_for_run();
+		return false;
+#endif
+
+	}
+
+}
+
 void
 EnergyPlusPgm( std::string const & filepath )
 {
@@ -344,6 +476,144 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( cTimingFlag, cEnvValue );
 	if ( ! cEnvValue.empty() ) TimingFlag = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( cCTFReferenceKernel, cEnvValue );
+	if ( ! cEnvValue.empty() ) CTFReferenceKernel = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cShadowCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) ShadowCacheFileName = cEnvValue;
+
+	get_environment_variable( cDaylightingCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) DaylightingCacheFileName = cEnvValue;
+
+	get_environment_variable( cIDDCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) IDDCacheFileName = cEnvValue;
+
+	get_environment_variable( cCTFCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) CTFCacheFileName = cEnvValue;
+
+	get_environment_variable( cGlazingOpticsCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) GlazingOpticsCacheFileName = cEnvValue;
+
+	get_environment_variable( cScheduleFileCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) ScheduleFileCacheFileName = cEnvValue;
+
+	get_environment_variable( cRuntimeMetricsFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) RuntimeMetricsFileName = cEnvValue;
+
+	get_environment_variable( cSQLiteWriterThread, cEnvValue );
+	if ( ! cEnvValue.empty() ) SQLiteWriterThread = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cOutputWriterThread, cEnvValue );
+	if ( ! cEnvValue.empty() ) UseOutputWriterThread = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cCacheWeatherFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) CacheWeatherFile = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cAirflowNetworkSparseSolver, cEnvValue );
+	if ( ! cEnvValue.empty() ) AirflowNetworkSparseSolver = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cAirflowNetworkJacobianReuse, cEnvValue );
+	if ( ! cEnvValue.empty() ) AirflowNetworkJacobianReuse = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cGroundDomainPCGSolver, cEnvValue );
+	if ( ! cEnvValue.empty() ) GroundDomainPCGSolver = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cCondFDTridiagonalSolver, cEnvValue );
+	if ( ! cEnvValue.empty() ) CondFDTridiagonalSolver = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cIntRadScriptFUpdate, cEnvValue );
+	if ( ! cEnvValue.empty() ) IntRadScriptFUpdate = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cWindowHeatBalanceReuse, cEnvValue );
+	if ( ! cEnvValue.empty() ) WindowHeatBalanceReuse = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cWindowHeatBalanceBatch, cEnvValue );
+	if ( ! cEnvValue.empty() ) WindowHeatBalanceBatch = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cEQLBeamPropertyTables, cEnvValue );
+	if ( ! cEnvValue.empty() ) EQLBeamPropertyTables = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cWarmStartRootSolves, cEnvValue );
+	if ( ! cEnvValue.empty() ) WarmStartRootSolves = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cReportRootSolverStatistics, cEnvValue );
+	if ( ! cEnvValue.empty() ) ReportRootSolverStatistics = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cDXCoilSolutionReuse, cEnvValue );
+	if ( ! cEnvValue.empty() ) DXCoilSolutionReuse = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cUserDefinedComponentMemoization, cEnvValue );
+	if ( ! cEnvValue.empty() ) UserDefinedComponentMemoization = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cSlinkyAdaptiveQuadrature, cEnvValue );
+	if ( ! cEnvValue.empty() ) SlinkyAdaptiveQuadrature = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cGLHEMultilevelLoadAggregation, cEnvValue );
+	if ( ! cEnvValue.empty() ) GLHEMultilevelLoadAggregation = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cStratifiedTankImplicitSolver, cEnvValue );
+	if ( ! cEnvValue.empty() ) StratifiedTankImplicitSolver = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cPlantHalfLoopChangeDetection, cEnvValue );
+	if ( ! cEnvValue.empty() ) PlantHalfLoopChangeDetection = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cInsideSurfaceZoneMasking, cEnvValue );
+	if ( ! cEnvValue.empty() ) InsideSurfaceZoneMasking = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cEagerIndependentInput, cEnvValue );
+	if ( ! cEnvValue.empty() ) EagerIndependentInput = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cDemandManagerZoneResimulation, cEnvValue );
+	if ( ! cEnvValue.empty() ) DemandManagerZoneResimulation = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cHVACIterationAcceleration, cEnvValue );
+	if ( ! cEnvValue.empty() ) HVACIterationAcceleration = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cSimulationProfile, cEnvValue );
+	if ( ! cEnvValue.empty() ) SimulationProfile = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cComponentRuntimeAccounting, cEnvValue );
+	if ( ! cEnvValue.empty() ) ComponentRuntimeAccounting = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cHVACConvergenceTelemetry, cEnvValue );
+	if ( ! cEnvValue.empty() ) HVACConvergenceTelemetry = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cCsvOutputDuringRun, cEnvValue );
+	if ( ! cEnvValue.empty() ) CsvOutputDuringRun = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cVRFReusePLRBounds, cEnvValue );
+	if ( ! cEnvValue.empty() ) VRFReusePLRBounds = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cMultiSpeedBracketSearch, cEnvValue );
+	if ( ! cEnvValue.empty() ) MultiSpeedBracketSearch = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cControllerWarmStart, cEnvValue );
+	if ( ! cEnvValue.empty() ) ControllerWarmStart = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cComfortWarmStart, cEnvValue );
+	if ( ! cEnvValue.empty() ) ComfortWarmStart = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cMergeCoplanarSurfaces, cEnvValue );
+	if ( ! cEnvValue.empty() ) MergeCoplanarSurfaces = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cZoneAggregationReport, cEnvValue );
+	if ( ! cEnvValue.empty() ) ZoneAggregationReport = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cAdaptiveSystemTimestep, cEnvValue );
+	if ( ! cEnvValue.empty() ) AdaptiveSystemTimestep = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cDormantHVAC, cEnvValue );
+	if ( ! cEnvValue.empty() ) DormantHVAC = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cWarmupStateFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) WarmupStateFileName = cEnvValue;
+
+	get_environment_variable( cRadiantSysLinearCoupling, cEnvValue );
+	if ( ! cEnvValue.empty() ) RadiantSysLinearCoupling = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cBCVTBBinaryProtocol, cEnvValue );
+	if ( ! cEnvValue.empty() ) BCVTBBinaryProtocol = env_var_on( cEnvValue ); // Yes or True
+
 	// Initialize env flags for air loop simulation debugging
 	get_environment_variable( TrackAirLoopEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TrackAirLoopEnvFlag = env_var_on( cEnvValue ); // Yes or True
@@ -383,6 +653,8 @@ EnergyPlusPgm( std::string const & filepath )
 
 	ProcessInput();
 
+	if ( VariantDirectories && ! ForkInputVariants() ) return; // The variants were run from here
+
 	ManageSimulation();
 
 	ShowMessage( "Simulation Error Summary *************" );
@@ -395,15 +667,7 @@ EnergyPlusPgm( std::string const & filepath )
 	ReportOrphanFluids();
 	ReportOrphanSchedules();
 
-    if (runReadVars) {
-		std::string readVarsPath = exeDirectory + "ReadVarsESO" + exeExtension;
-		bool FileExists;
-		{ IOFlags flags; gio::inquire( readVarsPath, flags ); FileExists = flags.exists(); }
-		if (!FileExists) {
-			DisplayString("ERROR: Could not find ReadVarsESO executable: " + getAbsolutePath(readVarsPath) + "." );
-			exit(EXIT_FAILURE);
-		}
-
+    if (runReadVars && SimulationManager::EnsembleMember == 0) { // The members of a weather ensemble leave their eso and mtr files as written
 		std::string RVIfile = idfDirPathName + idfFileNameOnly + ".rvi";
     	std::string MVIfile = idfDirPathName + idfFileNameOnly + ".mvi";
 
@@ -412,10 +676,26 @@ EnergyPlusPgm( std::string const & filepath )
     	bool rviFileExists;
     	bool mviFileExists;
 
+    	{ IOFlags flags; gio::inquire( RVIfile, flags ); rviFileExists = flags.exists(); }
+    	{ IOFlags flags; gio::inquire( MVIfile, flags ); mviFileExists = flags.exists(); }
+
+    	// The csv files already written during the run are not made again, unless an rvi or mvi file selects other variables
+    	bool const runReadVarsRvi( rviFileExists || ! CsvOutput::CsvFileWritten( CsvOutput::EsoCsv ) );
+    	bool const runReadVarsMvi( mviFileExists || ! CsvOutput::CsvFileWritten( CsvOutput::MtrCsv ) );
+
+		std::string readVarsPath = exeDirectory + "ReadVarsESO" + exeExtension;
+		if (runReadVarsRvi || runReadVarsMvi) {
+			bool FileExists;
+			{ IOFlags flags; gio::inquire( readVarsPath, flags ); FileExists = flags.exists(); }
+			if (!FileExists) {
+				DisplayString("ERROR: Could not find ReadVarsESO executable: " + getAbsolutePath(readVarsPath) + "." );
+				exit(EXIT_FAILURE);
+			}
+		}
+
     	gio::Fmt readvarsFmt( "(A)" );
 
-    	{ IOFlags flags; gio::inquire( RVIfile, flags ); rviFileExists = flags.exists(); }
-    	if (!rviFileExists) {
+    	if (runReadVarsRvi && !rviFileExists) {
 			fileUnitNumber = GetNewUnitNumber();
 			{ IOFlags flags; flags.ACTION( "write" ); gio::open( fileUnitNumber, RVIfile, flags ); iostatus = flags.ios(); }
 			if ( iostatus != 0 ) {
@@ -426,8 +706,7 @@ EnergyPlusPgm( std::string const & filepath )
 			gio::close( fileUnitNumber );
     	}
 
-    	{ IOFlags flags; gio::inquire( MVIfile, flags ); mviFileExists = flags.exists(); }
-    	if (!mviFileExists) {
+    	if (runReadVarsMvi && !mviFileExists) {
 			fileUnitNumber = GetNewUnitNumber();
 			{ IOFlags flags; flags.ACTION( "write" ); gio::open( fileUnitNumber, MVIfile, flags ); iostatus = flags.ios(); }
 			if ( iostatus != 0 ) {
@@ -441,22 +720,235 @@ EnergyPlusPgm( std::string const & filepath )
     	std::string readVarsRviCommand = "\"" + readVarsPath + "\"" + " " + RVIfile + " unlimited";
     	std::string readVarsMviCommand = "\"" + readVarsPath + "\"" + " " + MVIfile + " unlimited";
 
-    	systemCall(readVarsRviCommand);
-    	systemCall(readVarsMviCommand);
+    	if (runReadVarsRvi) systemCall(readVarsRviCommand);
+    	if (runReadVarsMvi) systemCall(readVarsMviCommand);
 
-	    if (!rviFileExists)
+	    if (runReadVarsRvi && !rviFileExists)
 	    	removeFile(RVIfile.c_str());
 
-	    if (!mviFileExists)
+	    if (runReadVarsMvi && !mviFileExists)
 	    	removeFile(MVIfile.c_str());
 
-	    moveFile("readvars.audit", outputRvauditFileName);
+	    if (runReadVarsRvi || runReadVarsMvi)
+	    	moveFile("readvars.audit", outputRvauditFileName);
 
 	}
 
 	EndEnergyPlus();
 }
 
+void
+EnergyPlusPgmFromBuffer(
+	std::string const & InputData, // Contents of an input data file
+	std::string const & filepath
+)
+{
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Runs EnergyPlus as EnergyPlusPgm does, on input data held by the caller rather than
+	// read from the input file, so that a generated model does not have to be written out first.
+
+	// METHODOLOGY EMPLOYED:
+	// The input processor reads the data in place of the input file.  The output files are
+	// written to the run directory as usual.
+
+	using namespace EnergyPlus;
+
+	DataStringGlobals::inputIdfBuffer = InputData;
+	EnergyPlusPgm( filepath );
+}
+
+int
+EnergyPlusPgmRunMany(
+	std::vector< std::string > const & RunDirectories,
+	int const MaxConcurrentRuns
+)
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Runs EnergyPlus in each of the run directories from one warm process, up to
+	// MaxConcurrentRuns at a time, and returns the number of runs that did not complete
+	// successfully.
+
+	// METHODOLOGY EMPLOYED:
+	// The data dictionary is read once, here.  Each run is then a child process forked from this
+	// one, so it starts from exactly the state of a process that has only read the IDD, with the
+	// library loaded and its pages (the IDD definitions among them) shared with this process and
+	// the other runs; each run owns the rest of its state, so runs proceed side by side, and the
+	// end of a run, or its fatal error, ends only its child.  Runs whose Energy+.idd differs read
+	// their own (see ProcessInput).
+
+	using namespace EnergyPlus;
+	using DataStringGlobals::pathChar;
+
+	if ( RunDirectories.empty() ) return 0;
+
+#ifdef _WIN32
+	DisplayString( "EnergyPlusPgmRunMany: Not available on Windows; call EnergyPlusPgm once per process." );
+	return static_cast< int >( RunDirectories.size() );
+#else
+	std::string cEnvValue;
+	get_environment_variable( DataSystemVariables::cIDDCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) DataSystemVariables::IDDCacheFileName = cEnvValue;
+	InputProcessor::PreloadDataDictionary( RunDirectories.front() + pathChar + "Energy+.idd" );
+
+	int NumFailed( 0 );
+	std::map< pid_t, std::string > Running; // Run directory of each child still running
+	auto wait_for_run = [&]() {
+		int Status( 0 );
+		pid_t const Child( waitpid( -1, &Status, 0 ) );
+		auto const Run( Running.find( Child ) );
+		if ( Run == Running.end() ) { // No child left to wait for
+			NumFailed += static_cast< int >( Running.size() );
+			Running.clear();
+			return;
+		}
+		if ( ! WIFEXITED( Status ) || WEXITSTATUS( Status ) != EXIT_SUCCESS ) {
+			DisplayString( "EnergyPlusPgmRunMany: Run in " + Run->second + " did not complete successfully." );
+			++NumFailed;
+		}
+		Running.erase( Run );
+	};
+
+	for ( auto const & RunDirectory : RunDirectories ) {
+		while ( int( Running.size() ) >= std::max( MaxConcurrentRuns, 1 ) ) wait_for_run();
+		std::cout.flush();
+		std::cerr.flush();
+		pid_t const Child( fork() );
+		if ( Child == 0 ) {
+			EnergyPlusPgm( RunDirectory ); // Does not return
+			std::exit( EXIT_SUCCESS );
+		} else if ( Child < 0 ) {
+			DisplayString( "EnergyPlusPgmRunMany: Could not start the run in " + RunDirectory + "." );
+			++NumFailed;
+		} else {
+			Running[ Child ] = RunDirectory;
+		}
+	}
+	while ( ! Running.empty() ) wait_for_run();
+	return NumFailed;
+#endif
+}
+
+int
+EnergyPlusPgmServe(
+	std::istream & Requests, // Options and input file of each run, one line per run
+	std::ostream & Results // Exit status of each run, one line per run
+)
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Serves the runs requested one after another from one warm process (energyplus --serve),
+	// and returns the number of runs that did not complete successfully.  Each line of Requests
+	// holds the command line options and input file of a run, as given to energyplus, with
+	// double quotes around an argument holding spaces; the exit status of the run is written
+	// to Results as a line "EXIT <status>" when it ends.  Serving ends at the end of Requests.
+
+	// METHODOLOGY EMPLOYED:
+	// As for EnergyPlusPgmRunMany, the data dictionary is read once here and each run is a child
+	// forked from this process, so that every run starts from the same clean state.
+
+	using namespace EnergyPlus;
+
+#ifdef _WIN32
+	DisplayString( "EnergyPlusPgmServe: Not available on Windows; run energyplus once per simulation." );
+	Results << "EXIT " << EXIT_FAILURE << std::endl;
+	return 1;
+#else
+	std::string cEnvValue;
+	get_environment_variable( DataSystemVariables::cIDDCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) DataSystemVariables::IDDCacheFileName = cEnvValue;
+	InputProcessor::PreloadDataDictionary( DataStringGlobals::inputIddFileName );
+
+	int NumFailed( 0 );
+	std::string Request;
+	while ( std::getline( Requests, Request ) ) {
+		std::vector< std::string > Arguments( 1, "energyplus" );
+		bool InArgument( false );
+		bool InQuotes( false );
+		for ( char const c : Request ) {
+			if ( c == '"' ) {
+				InQuotes = ! InQuotes;
+				if ( ! InArgument ) Arguments.push_back( std::string() );
+				InArgument = true;
+			} else if ( ( c == ' ' || c == '\t' || c == '\r' ) && ! InQuotes ) {
+				InArgument = false;
+			} else {
+				if ( ! InArgument ) Arguments.push_back( std::string() );
+				InArgument = true;
+				Arguments.back() += c;
+			}
+		}
+		if ( Arguments.size() == 1u ) continue; // Blank line
+
+		std::cout.flush();
+		std::cerr.flush();
+		Results.flush();
+		pid_t const Child( fork() );
+		if ( Child == 0 ) {
+			std::vector< const char * > Argv;
+			for ( auto const & Argument : Arguments ) Argv.push_back( Argument.c_str() );
+			CommandLineInterface::ProcessArgs( static_cast< int >( Argv.size() ), Argv.data() );
+			EnergyPlusPgm(); // Does not return
+			std::exit( EXIT_SUCCESS );
+		}
+		int Status( EXIT_FAILURE );
+		if ( Child < 0 ) {
+			DisplayString( "EnergyPlusPgmServe: Could not start the run: " + Request );
+		} else {
+			int WaitStatus( 0 );
+			if ( waitpid( Child, &WaitStatus, 0 ) == Child && WIFEXITED( WaitStatus ) ) Status = WEXITSTATUS( WaitStatus );
+		}
+		if ( Status != EXIT_SUCCESS ) ++NumFailed;
+		Results << "EXIT " << Status << std::endl;
+	}
+	return NumFailed;
+#endif
+}
+
+int
+EnergyPlusPgmRunVariants(
+	std::string const & filepath,
+	std::vector< std::string > const & RunDirectories,
+	std::vector< std::vector< std::string > > const & InputOverrides,
+	int const MaxConcurrentRuns
+)
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Runs variants of the model in filepath that differ only in a few input fields, such as the
+	// values of schedules or setpoints, with the input processed once for all of them, and returns
+	// the number of variants that did not complete successfully.  Each variant writes its output
+	// files to its run directory (made if it does not exist, relative to filepath otherwise) and
+	// changes the input fields given by its list of InputOverrides, each as
+	// "object type,object name,field number,new value" with the fields of the object numbered
+	// from 1, alpha and numeric fields together.
+
+	// METHODOLOGY EMPLOYED:
+	// EnergyPlusPgm processes the input here, then forks a child for each variant (see
+	// ForkInputVariants), up to MaxConcurrentRuns at a time.  The input records stay in pages
+	// shared with this process; the messages of the input processing are written to the files
+	// of each variant.  This process is left with the input processed, so it runs no other
+	// simulation itself.
+
+	using namespace EnergyPlus;
+
+	if ( RunDirectories.empty() ) return 0;
+	if ( InputOverrides.size() != RunDirectories.size() ) {
+		DisplayString( "EnergyPlusPgmRunVariants: Give one list of input overrides for each run directory." );
+		return static_cast< int >( RunDirectories.size() );
+	}
+
+	VariantDirectories = &RunDirectories;
+	VariantOverrides = &InputOverrides;
+	MaxConcurrentVariants = MaxConcurrentRuns;
+	NumVariantsFailed = 0;
+	EnergyPlusPgm( filepath ); // Returns here once the variants have ended
+	VariantDirectories = nullptr;
+	VariantOverrides = nullptr;
+	return NumVariantsFailed;
+}
+
 void StoreProgressCallback( void(*f)( int const ) )
 {
 	using namespace EnergyPlus::DataGlobals;
@@ -468,6 +960,133 @@ void StoreMessageCallback( void(*f)( std::string const & ) )
 	fMessagePtr = f;
 }
 
+void StoreCallingPointCallback( void(*f)( int const ) )
+{
+	using namespace EnergyPlus::DataGlobals;
+	fCallingPointPtr = f;
+}
+
+int
+GetVariableHandle(
+	std::string const & VarName, // Output variable name, without units
+	std::string const & KeyName // Key of the output variable, such as the zone name
+)
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Gives the handle of a real output variable for GetVariableValue, or 0 if it is not set up.
+	// Output variables are set up as the input of each module is read, so handles are best
+	// resolved from the calling point callback at the setup of the simulation or later.
+
+	// METHODOLOGY EMPLOYED:
+	// The variables are indexed by key and name as they are first looked up, adding those set
+	// up since the last look up, so that resolving many handles does not search the whole list
+	// for each.  The handle is the number of the variable in RVariableTypes, which holds for
+	// the run.
+
+	using namespace EnergyPlus;
+	using namespace OutputProcessor;
+	using InputProcessor::MakeUPPERCase;
+
+	static std::unordered_map< std::string, int > VariableMap; // Variable number by key and name
+	static int NumVariablesMapped( 0 );
+
+	if ( NumOfRVariable < NumVariablesMapped ) { // Variables were cleared, as for a new run
+		VariableMap.clear();
+		NumVariablesMapped = 0;
+	}
+	for ( int Loop = NumVariablesMapped + 1; Loop <= NumOfRVariable; ++Loop ) {
+		VariableMap.emplace( RVariableTypes( Loop ).KeyNameOnlyUC + ':' + RVariableTypes( Loop ).VarNameOnlyUC, Loop );
+	}
+	NumVariablesMapped = NumOfRVariable;
+
+	auto const Found( VariableMap.find( MakeUPPERCase( KeyName ) + ':' + MakeUPPERCase( VarName ) ) );
+	if ( Found == VariableMap.end() ) return 0;
+	return Found->second;
+}
+
+double
+GetVariableValue( int const Handle )
+{
+	// Current value of the output variable, read from the model variable itself
+	using namespace EnergyPlus::OutputProcessor;
+	if ( Handle < 1 || Handle > NumOfRVariable ) return 0.0;
+	return RVariableTypes( Handle ).VarPtr().Which();
+}
+
+void
+GetVariableValues(
+	std::vector< int > const & Handles, // Handles from GetVariableHandle
+	std::vector< double > & Values // Current value of each variable, 0 for a handle not set up
+)
+{
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Takes the current values of a set of output variables in one call, as at each time step.
+
+	using namespace EnergyPlus::OutputProcessor;
+
+	Values.resize( Handles.size() );
+	for ( std::vector< int >::size_type Loop = 0; Loop < Handles.size(); ++Loop ) {
+		int const Handle( Handles[ Loop ] );
+		Values[ Loop ] = ( Handle >= 1 && Handle <= NumOfRVariable ) ? RVariableTypes( Handle ).VarPtr().Which() : 0.0;
+	}
+}
+
+int
+GetActuatorHandle(
+	std::string const & ComponentType, // Actuated component type, as in EnergyManagementSystem:Actuator
+	std::string const & ControlType, // Actuated component control type
+	std::string const & UniqueKey // Actuated component unique name
+)
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Gives the handle of an EMS actuator for SetActuatorValue, or 0 if it is not set up.
+
+	using namespace EnergyPlus;
+	using namespace DataRuntimeLanguage;
+	using InputProcessor::MakeUPPERCase;
+
+	std::string const ComponentTypeUC( MakeUPPERCase( ComponentType ) );
+	std::string const ControlTypeUC( MakeUPPERCase( ControlType ) );
+	std::string const UniqueKeyUC( MakeUPPERCase( UniqueKey ) );
+	for ( int Loop = 1; Loop <= numEMSActuatorsAvailable; ++Loop ) {
+		auto const & actuator( EMSActuatorAvailable( Loop ) );
+		if ( actuator.ComponentTypeName == ComponentTypeUC && actuator.ControlTypeName == ControlTypeUC && actuator.UniqueIDName == UniqueKeyUC ) return Loop;
+	}
+	return 0;
+}
+
+void
+SetActuatorValue(
+	int const Handle,
+	double const Value
+)
+{
+	// Overrides the actuated value of the model, as an EMS actuator does, until reset
+	using namespace EnergyPlus::DataRuntimeLanguage;
+	if ( Handle < 1 || Handle > numEMSActuatorsAvailable ) return;
+	auto & actuator( EMSActuatorAvailable( Handle ) );
+	actuator.Actuated() = true;
+	if ( actuator.PntrVarTypeUsed == PntrReal ) {
+		actuator.RealValue() = Value;
+	} else if ( actuator.PntrVarTypeUsed == PntrInteger ) {
+		actuator.IntValue() = std::floor( Value );
+	} else if ( actuator.PntrVarTypeUsed == PntrLogical ) {
+		actuator.LogValue() = ( Value != 0.0 );
+	}
+}
+
+void
+ResetActuator( int const Handle )
+{
+	// Returns the actuated value to the control of the model
+	using namespace EnergyPlus::DataRuntimeLanguage;
+	if ( Handle < 1 || Handle > numEMSActuatorsAvailable ) return;
+	EMSActuatorAvailable( Handle ).Actuated() = false;
+}
+
 void
 CreateCurrentDateTimeString( std::string & CurrentDateTimeString )
 {
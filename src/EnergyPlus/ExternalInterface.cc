@@ -488,6 +488,17 @@ namespace ExternalInterface {
 				if ( socketFD < 0 ) {
 					ShowSevereError( "ExternalInterface: Could not open socket. File descriptor = " + TrimSigDigits( socketFD ) + '.' );
 					ErrorsFound = true;
+				} else if ( DataSystemVariables::BCVTBBinaryProtocol ) {
+					// Offer binary frames; a server that does not answer the offer in kind keeps the text protocol
+					retVal = negotiatebinaryprotocol( &socketFD );
+					if ( retVal > 0 ) {
+						DisplayString( "ExternalInterface exchanges binary frames with the BCVTB server." );
+					} else if ( retVal == 0 ) {
+						ShowWarningError( "ExternalInterface: The BCVTB server declined the binary protocol, the values are exchanged as text." );
+					} else {
+						ShowSevereError( "ExternalInterface: Could not negotiate the protocol with the BCVTB server. Return value = " + TrimSigDigits( retVal ) + '.' );
+						ErrorsFound = true;
+					}
 				}
 			} else {
 				ShowSevereError( "ExternalInterface: Did not find file \"" + socCfgFilNam + "\"." );
@@ -683,90 +694,28 @@ namespace ExternalInterface {
 					for ( k = 1; k <= FMUTemp( i ).Instance( j ).NumOutputVariablesActuator; ++k ) {
 						FMU( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue;
 					}
-				} else {
-					// Get from FMUs, values that will be set in EnergyPlus (Schedule)
-
-					if ( size( FMU(i).Instance(j).fmuOutputVariableSchedule ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec;
-						std::vector<Real64> realVarValueVec;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							valueReferenceVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference );
-							realVarValueVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue );
-						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec[0], &realVarValueVec[0], &FMU( i ).Instance( j ).NumOutputVariablesSchedule, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference = valueReferenceVec[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue = realVarValueVec[x-1];
-						}
-
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
-							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
-						}
-
+				} else if ( ! FMU( i ).Instance( j ).OutputValueReferences.empty() ) {
+					// Get from FMUs, in one call, values that will be set in EnergyPlus (Schedule, Variable and Actuator)
+					auto & instance( FMU( i ).Instance( j ) );
+					int NumOutputs( instance.OutputValueReferences.size() );
+					instance.fmistatus = fmiEPlusGetReal( &instance.fmicomponent, &instance.OutputValueReferences[ 0 ], &instance.OutputValues[ 0 ], &NumOutputs, &instance.Index );
+					if ( instance.fmistatus != fmiOK ) {
+						ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
+						ShowContinueError( "in instance \"" + instance.Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
+						ShowContinueError( "Error Code = \"" + TrimSigDigits( instance.fmistatus ) + "\"" );
+						ErrorsFound = true;
+						StopExternalInterfaceIfError();
 					}
 
-					// generate vectors here first
-					if ( size(FMU(i).Instance(j).fmuOutputVariableVariable) > 0 ) {
-
-						std::vector<unsigned int> valueReferenceVec2;
-						std::vector<Real64> realVarValueVec2;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							valueReferenceVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference );
-							realVarValueVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue );
-						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec2[0], &realVarValueVec2[0], &FMU( i ).Instance( j ).NumOutputVariablesVariable, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference = valueReferenceVec2[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue = realVarValueVec2[x-1];
-						}
-
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
-							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
-						}
-
+					auto Value( instance.OutputValues.begin() );
+					for ( k = 1; k <= instance.NumOutputVariablesSchedule; ++k ) {
+						instance.fmuOutputVariableSchedule( k ).RealVarValue = *Value++;
 					}
-
-					if ( size( FMU( i ).Instance( j ).fmuOutputVariableActuator ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec3;
-						std::vector<Real64> realVarValueVec3;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							valueReferenceVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference );
-							realVarValueVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue );
-						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec3[0], &realVarValueVec3[0], &FMU( i ).Instance( j ).NumOutputVariablesActuator, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference = valueReferenceVec3[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue = realVarValueVec3[x-1];
-						}
-
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
-							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
-						}
+					for ( k = 1; k <= instance.NumOutputVariablesVariable; ++k ) {
+						instance.fmuOutputVariableVariable( k ).RealVarValue = *Value++;
+					}
+					for ( k = 1; k <= instance.NumOutputVariablesActuator; ++k ) {
+						instance.fmuOutputVariableActuator( k ).RealVarValue = *Value++;
 					}
 				}
 
@@ -799,25 +748,18 @@ namespace ExternalInterface {
 					}
 				}
 
-				if ( ! FlagReIni ) {
-
-					// generate vectors here first
-					std::vector<unsigned int> valueReferenceVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuInputVariable ); ++x ) {
-						valueReferenceVec4.push_back( FMU( i ).Instance( j ).fmuInputVariable( x ).ValueReference );
-					}
-
-					std::vector<Real64> rtsValueVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).eplusOutputVariable ); ++x ) {
-						rtsValueVec4.push_back( FMU( i ).Instance( j ).eplusOutputVariable( x ).RTSValue );
+				if ( ! FlagReIni && ! FMU( i ).Instance( j ).InputValueReferences.empty() ) {
+					auto & instance( FMU( i ).Instance( j ) );
+					for ( k = 1; k <= instance.NumInputVariablesInIDF; ++k ) {
+						instance.InputValues[ k - 1 ] = instance.eplusOutputVariable( k ).RTSValue;
 					}
 
-					FMU( i ).Instance( j ).fmistatus = fmiEPlusSetReal( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec4[0], &rtsValueVec4[0], &FMU( i ).Instance( j ).NumInputVariablesInIDF, &FMU( i ).Instance( j ).Index );
+					instance.fmistatus = fmiEPlusSetReal( &instance.fmicomponent, &instance.InputValueReferences[ 0 ], &instance.InputValues[ 0 ], &instance.NumInputVariablesInIDF, &instance.Index );
 
-					if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
+					if ( instance.fmistatus != fmiOK ) {
 						ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to set inputs" );
-						ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-						ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
+						ShowContinueError( "in instance \"" + instance.Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
+						ShowContinueError( "Error Code = \"" + TrimSigDigits( instance.fmistatus ) + "\"" );
 						ErrorsFound = true;
 						StopExternalInterfaceIfError();
 					}
@@ -1589,10 +1531,49 @@ namespace ExternalInterface {
 				}
 			}
 			StopExternalInterfaceIfError();
+			SetUpFMUExchangeBuffers();
 			FirstCallIni = false;
 		}
 	}
 
+	void
+	SetUpFMUExchangeBuffers()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gathers the value references of the inputs and outputs of each FMU instance into the
+		// contiguous arrays that are passed to fmiSetReal and fmiGetReal at each step, so that
+		// the exchange does not rebuild them.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i, j, k; // Loop counters
+
+		for ( i = 1; i <= NumFMUObjects; ++i ) {
+			for ( j = 1; j <= FMU( i ).NumInstances; ++j ) {
+				auto & instance( FMU( i ).Instance( j ) );
+
+				instance.OutputValueReferences.clear();
+				for ( k = 1; k <= instance.NumOutputVariablesSchedule; ++k ) {
+					instance.OutputValueReferences.push_back( instance.fmuOutputVariableSchedule( k ).ValueReference );
+				}
+				for ( k = 1; k <= instance.NumOutputVariablesVariable; ++k ) {
+					instance.OutputValueReferences.push_back( instance.fmuOutputVariableVariable( k ).ValueReference );
+				}
+				for ( k = 1; k <= instance.NumOutputVariablesActuator; ++k ) {
+					instance.OutputValueReferences.push_back( instance.fmuOutputVariableActuator( k ).ValueReference );
+				}
+				instance.OutputValues.assign( instance.OutputValueReferences.size(), 0.0 );
+
+				instance.InputValueReferences.clear();
+				for ( k = 1; k <= instance.NumInputVariablesInIDF; ++k ) {
+					instance.InputValueReferences.push_back( instance.fmuInputVariable( k ).ValueReference );
+				}
+				instance.InputValues.assign( instance.InputValueReferences.size(), 0.0 );
+			}
+		}
+
+	}
+
 	std::string trim(std::string const& str)
 	{
 		std::size_t first = str.find_first_not_of(' ');
@@ -2035,8 +2016,8 @@ namespace ExternalInterface {
 		Real64 curSimTim; // current simulation time
 		Real64 preSimTim; // previous time step's simulation time
 
-		Array1D< Real64 > dblValWri( nDblMax );
-		Array1D< Real64 > dblValRea( nDblMax );
+		static Array1D< Real64 > dblValWri( nDblMax ); // Kept across calls, the socket reads and writes them in place
+		static Array1D< Real64 > dblValRea( nDblMax );
 		std::string retValCha;
 		bool continueSimulation; // Flag, true if simulation should continue
 		static bool firstCall( true );
@@ -19,6 +19,7 @@ extern "C" {
 
 // C++ Standard Library Headers
 #include <string>
+#include <vector>
 
 // Objexx Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -227,6 +228,12 @@ namespace ExternalInterface {
 		Array1D< fmuOutputVariableActuatorType > fmuOutputVariableActuator;
 		// Variable Types structure for energyplus input variables from type actuator
 		Array1D< eplusInputVariableActuatorType > eplusInputVariableActuator;
+		// Value references and values exchanged with the FMU at each step, in one call each way:
+		// the outputs are the schedules, then the variables, then the actuators
+		std::vector< fmiValueReference > OutputValueReferences;
+		std::vector< fmiReal > OutputValues;
+		std::vector< fmiValueReference > InputValueReferences;
+		std::vector< fmiReal > InputValues;
 
 		// Default Constructor
 		InstanceType() :
@@ -359,6 +366,9 @@ namespace ExternalInterface {
 	void
 	StopExternalInterfaceIfError();
 
+	void
+	SetUpFMUExchangeBuffers();
+
 	void
 	ValidateRunControl();
 
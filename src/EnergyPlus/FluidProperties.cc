@@ -1877,6 +1877,8 @@ namespace FluidProperties {
 
 		if ( ! ErrorsFound ) InitializeRefrigerantLimits( ErrorsFound ); // Initialize the limits for the refrigerants
 
+		if ( ! ErrorsFound ) InitializeFluidAxisIndexes(); // Bucket indexes of the property tables
+
 		FluidTemps.deallocate();
 
 		Alphas.deallocate();
@@ -2819,6 +2821,83 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeFluidAxisIndexes()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the bucket indexes of the refrigerant and glycol tables searched by the property
+		// functions.
+
+		for ( int RefrigNum = 1; RefrigNum <= NumOfRefrigerants; ++RefrigNum ) {
+			auto & refrig( RefrigData( RefrigNum ) );
+			if ( refrig.NumPsPoints > 0 ) {
+				BuildAxisIndex( refrig.PsTempAxis, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+				BuildAxisIndex( refrig.PsPresAxis, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex );
+			}
+			if ( refrig.NumHPoints > 0 ) BuildAxisIndex( refrig.HTempAxis, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+			if ( refrig.NumCpPoints > 0 ) BuildAxisIndex( refrig.CpTempAxis, refrig.CpTemps, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex );
+			if ( refrig.NumRhoPoints > 0 ) BuildAxisIndex( refrig.RhoTempAxis, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex );
+			if ( refrig.NumSuperTempPts > 0 && refrig.NumSuperPressPts > 0 ) {
+				BuildAxisIndex( refrig.SHTempAxis, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+				BuildAxisIndex( refrig.SHPressAxis, refrig.SHPress, 1, refrig.NumSuperPressPts );
+			}
+		}
+
+		for ( int GlycolNum = 1; GlycolNum <= NumOfGlycols; ++GlycolNum ) {
+			auto & glycol( GlycolData( GlycolNum ) );
+			if ( glycol.CpDataPresent ) BuildAxisIndex( glycol.CpTempAxis, glycol.CpTemps, 1, glycol.CpTemps.isize() );
+			if ( glycol.RhoDataPresent ) BuildAxisIndex( glycol.RhoTempAxis, glycol.RhoTemps, glycol.RhoLowTempIndex, glycol.RhoHighTempIndex );
+		}
+
+	}
+
+	void
+	BuildAxisIndex(
+		FluidPropsAxisIndex & Axis,
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound
+		int const UpperBound // Valid values upper bound
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the bucket index of an ascending table.
+
+		// METHODOLOGY EMPLOYED:
+		// Uniform buckets, a few per table interval, over the range of the table.  Each bucket
+		// holds the FindArrayIndex result for its lower edge, so a search starts there and
+		// moves up at most the number of table points inside the bucket.  Tables that are
+		// too short, not ascending or out of the array bounds are not indexed.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const BucketsPerInterval( 4 );
+
+		Axis.LowBound = LowBound;
+		Axis.UpperBound = UpperBound;
+		Axis.Start.deallocate();
+		if ( LowBound < Array.l() || UpperBound > Array.u() || UpperBound <= LowBound ) return;
+		for ( int i = LowBound; i < UpperBound; ++i ) {
+			if ( Array( i + 1 ) < Array( i ) ) return;
+		}
+		Real64 const Range( Array( UpperBound ) - Array( LowBound ) );
+		if ( Range <= 0.0 ) return;
+
+		int const NumBuckets( BucketsPerInterval * ( UpperBound - LowBound ) );
+		Axis.Min = Array( LowBound );
+		Axis.InvWidth = NumBuckets / Range;
+		Axis.Start.allocate( {0,NumBuckets-1} );
+		int Index( LowBound );
+		for ( int Bucket = 0; Bucket < NumBuckets; ++Bucket ) {
+			Real64 const Edge( Axis.Min + Bucket / Axis.InvWidth );
+			while ( Index + 1 < UpperBound && Array( Index + 1 ) < Edge ) ++Index;
+			Axis.Start( Bucket ) = Index;
+		}
+
+	}
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols()
 	{
@@ -3464,7 +3543,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// determine array indices for
-		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex, refrig.PsTempAxis );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check for out of data bounds problems
@@ -3579,7 +3658,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// get the array indices
-		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex );
+		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex, refrig.PsPresAxis );
 		HiPresIndex = LoPresIndex + 1;
 
 		// check for out of data bounds problems
@@ -3692,7 +3771,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// Apply linear interpolation function
-		return GetInterpolatedSatProp( Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+		return GetInterpolatedSatProp( Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HfLowTempIndex, refrig.HfHighTempIndex, refrig.HTempAxis );
 
 	}
 
@@ -3791,7 +3870,7 @@ namespace FluidProperties {
 
 		ErrorFlag = false;
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex, refrig.RhoTempAxis );
 		HiTempIndex = LoTempIndex + 1;
 
 		//Error check to make sure the temperature is not out of bounds
@@ -3924,7 +4003,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// Apply linear interpolation function
-		ReturnValue = GetInterpolatedSatProp( Temperature, refrig.CpTemps, refrig.CpfValues, refrig.CpfgValues, Quality, CalledFrom, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex );
+		ReturnValue = GetInterpolatedSatProp( Temperature, refrig.CpTemps, refrig.CpfValues, refrig.CpfgValues, Quality, CalledFrom, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex, refrig.CpTempAxis );
 
 		return ReturnValue;
 
@@ -4045,8 +4124,8 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempAxis );
+		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressAxis );
 
 		// check temperature data range and attempt to cap if necessary
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
@@ -4295,7 +4374,7 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempAxis );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check temperature data range and attempt to cap if necessary
@@ -4565,7 +4644,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// check temperature data range and attempt to cap if necessary
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempAxis );
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
 			HiTempIndex = TempIndex + 1;
 			TempInterpRatio = ( Temperature - refrig.SHTemps( TempIndex ) ) / ( refrig.SHTemps( HiTempIndex ) - refrig.SHTemps( TempIndex ) );
@@ -4585,7 +4664,7 @@ namespace FluidProperties {
 		}
 
 		// check pressure data range and attempt to cap if necessary
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressAxis );
 		if ( ( LoPressIndex > 0 ) && ( LoPressIndex < refrig.NumSuperPressPts ) ) { // in range
 			HiPressIndex = LoPressIndex + 1;
 			Real64 const SHPress_Lo( refrig.SHPress( LoPressIndex ) );
@@ -4963,6 +5042,84 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	Real64
+	GetSpecificHeatGlycol_lookup(
+		GlycolPropsHandle & Handle, // Glycol and last result
+		Real64 const Temperature, // actual temperature given as input
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Specific heat of the glycol of a handle at a temperature other than the saved one.
+
+		// METHODOLOGY EMPLOYED:
+		// Inside the data range the table interval comes from the bucket index and the
+		// interpolation is that of GetSpecificHeatGlycol; the result is saved in the handle.
+		// Anything else (input not read yet, no data, out of range) goes through
+		// GetSpecificHeatGlycol for its messages and is not saved.
+
+		if ( ! GetInput && Handle.GlycolIndex > 0 ) {
+			auto const & glycol_data( GlycolData( Handle.GlycolIndex ) );
+			if ( glycol_data.CpDataPresent && Temperature >= glycol_data.CpLowTempValue && Temperature <= glycol_data.CpHighTempValue ) {
+				auto const & glycol_CpTemps( glycol_data.CpTemps );
+				auto const & glycol_CpValues( glycol_data.CpValues );
+				int const NumTemps( glycol_CpTemps.isize() );
+				int const LoTempIndex( FindArrayIndex( Temperature, glycol_CpTemps, 1, NumTemps, glycol_data.CpTempAxis ) );
+				if ( LoTempIndex > 0 && LoTempIndex < NumTemps ) {
+					Handle.Cp = GetInterpValue_fast( Temperature, glycol_CpTemps( LoTempIndex ), glycol_CpTemps( LoTempIndex + 1 ), glycol_CpValues( LoTempIndex ), glycol_CpValues( LoTempIndex + 1 ) );
+					Handle.CpTemp = Temperature;
+					Handle.CpSaved = true;
+					return Handle.Cp;
+				}
+			}
+		}
+
+		std::string const GlycolName( ( Handle.GlycolIndex > 0 && Handle.GlycolIndex <= NumOfGlycols ) ? GlycolData( Handle.GlycolIndex ).Name : std::string() );
+		return GetSpecificHeatGlycol( GlycolName, Temperature, Handle.GlycolIndex, CalledFrom );
+
+	}
+
+	//*****************************************************************************
+
+	Real64
+	GetDensityGlycol_lookup(
+		GlycolPropsHandle & Handle, // Glycol and last result
+		Real64 const Temperature, // actual temperature given as input
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Density of the glycol of a handle at a temperature other than the saved one.
+
+		// METHODOLOGY EMPLOYED:
+		// As GetSpecificHeatGlycol_lookup, with the interpolation of GetDensityGlycol.
+
+		if ( ! GetInput && Handle.GlycolIndex > 0 ) {
+			auto const & glycol_data( GlycolData( Handle.GlycolIndex ) );
+			int const LowIndex( glycol_data.RhoLowTempIndex );
+			int const HighIndex( glycol_data.RhoHighTempIndex );
+			if ( glycol_data.RhoDataPresent && LowIndex < HighIndex && Temperature >= glycol_data.RhoLowTempValue && Temperature <= glycol_data.RhoHighTempValue ) {
+				auto const & glycol_RhoTemps( glycol_data.RhoTemps );
+				auto const & glycol_RhoValues( glycol_data.RhoValues );
+				int const LoTempIndex( FindArrayIndex( Temperature, glycol_RhoTemps, LowIndex, HighIndex, glycol_data.RhoTempAxis ) );
+				if ( LoTempIndex > 0 && LoTempIndex < HighIndex ) {
+					Handle.Rho = GetInterpValue( Temperature, glycol_RhoTemps( LoTempIndex ), glycol_RhoTemps( LoTempIndex + 1 ), glycol_RhoValues( LoTempIndex ), glycol_RhoValues( LoTempIndex + 1 ) );
+					Handle.RhoTemp = Temperature;
+					Handle.RhoSaved = true;
+					return Handle.Rho;
+				}
+			}
+		}
+
+		std::string const GlycolName( ( Handle.GlycolIndex > 0 && Handle.GlycolIndex <= NumOfGlycols ) ? GlycolData( Handle.GlycolIndex ).Name : std::string() );
+		return GetDensityGlycol( GlycolName, Temperature, Handle.GlycolIndex, CalledFrom );
+
+	}
+
+	//*****************************************************************************
+
 	Real64
 	GetConductivityGlycol(
 		std::string const & Glycol, // carries in substance name
@@ -5335,7 +5492,7 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex, refrig.HTempAxis );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check on the data bounds and adjust indices to give clamped return value
@@ -5677,6 +5834,40 @@ namespace FluidProperties {
 		}
 	}
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsAxisIndex const & Axis // Bucket index of the array
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Same result as FindArrayIndex over the bounds given, found from the bucket index of
+		// the array when it has one.
+
+		// METHODOLOGY EMPLOYED:
+		// The bucket of the value gives the index to start from; the search moves up while the
+		// next point is below the value, and back down when rounding put the value below the
+		// bucket edge.
+
+		if ( Axis.Start.empty() || Axis.LowBound != LowBound || Axis.UpperBound != UpperBound ) {
+			return FindArrayIndex( Value, Array, LowBound, UpperBound );
+		}
+		if ( Value < Array( LowBound ) ) return 0;
+		if ( Value > Array( UpperBound ) ) return UpperBound;
+		Real64 const Position( ( Value - Axis.Min ) * Axis.InvWidth );
+		if ( ! ( Position >= 0.0 ) ) return FindArrayIndex( Value, Array, LowBound, UpperBound ); // Not a number
+		int const Bucket( min( int( Position ), Axis.Start.u() ) );
+		int Index( Axis.Start( Bucket ) );
+		while ( Index + 1 < UpperBound && Array( Index + 1 ) < Value ) ++Index;
+		while ( Index > LowBound && Array( Index ) >= Value ) --Index;
+		return Index;
+
+	}
+
 	//*****************************************************************************
 
 	Real64
@@ -5688,7 +5879,8 @@ namespace FluidProperties {
 		Real64 const Quality, // Quality
 		std::string const & CalledFrom, // routine this function was called from (error messages)
 		int const LowBound, // Valid values lower bound (set by calling program)
-		int const UpperBound // Valid values upper bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsAxisIndex const & TempAxis // Bucket index of PropTemps
 	)
 	{
 
@@ -5740,7 +5932,7 @@ namespace FluidProperties {
 		static int TempRangeErrCount( 0 ); // cumulative error counter
 		static int TempRangeErrIndex( 0 );
 
-		int const LoTempIndex = FindArrayIndex( Temperature, PropTemps, LowBound, UpperBound );  // array index for temp above input temp
+		int const LoTempIndex = FindArrayIndex( Temperature, PropTemps, LowBound, UpperBound, TempAxis );  // array index for temp above input temp
 
 		if ( LoTempIndex == 0 ) {
 			ReturnValue = LiqProp( LowBound ) + Quality * ( VapProp( LowBound ) - LiqProp( LowBound ) );
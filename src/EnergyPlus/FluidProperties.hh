@@ -64,6 +64,28 @@ namespace FluidProperties {
 
 	// Types
 
+	struct FluidPropsAxisIndex
+	{
+		// Uniform buckets over an ascending table, so that FindArrayIndex can start its search
+		// next to the answer.
+
+		// Members
+		int LowBound; // Range of the table covered
+		int UpperBound;
+		Real64 Min; // Table value at LowBound
+		Real64 InvWidth; // Buckets per unit of the table values
+		Array1D_int Start; // (0:NumBuckets-1) FindArrayIndex of the lower edge of each bucket; empty if not built
+
+		// Default Constructor
+		FluidPropsAxisIndex() :
+			LowBound( 0 ),
+			UpperBound( 0 ),
+			Min( 0.0 ),
+			InvWidth( 0.0 )
+		{}
+
+	};
+
 	struct FluidPropsRefrigerantData
 	{
 		// Members
@@ -121,6 +143,13 @@ namespace FluidProperties {
 		Array1D< Real64 > SHPress; // Pressures for superheated gas
 		Array2D< Real64 > HshValues; // Enthalpy of superheated gas at HshTemps, HshPress
 		Array2D< Real64 > RhoshValues; // Density of superheated gas at HshTemps, HshPress
+		FluidPropsAxisIndex PsTempAxis; // Indexes of the tables above for FindArrayIndex
+		FluidPropsAxisIndex PsPresAxis;
+		FluidPropsAxisIndex HTempAxis;
+		FluidPropsAxisIndex CpTempAxis;
+		FluidPropsAxisIndex RhoTempAxis;
+		FluidPropsAxisIndex SHTempAxis;
+		FluidPropsAxisIndex SHPressAxis;
 
 		// Default Constructor
 		FluidPropsRefrigerantData() :
@@ -422,6 +451,8 @@ namespace FluidProperties {
 		int ViscHighTempIndex; // High Temperature Max Index for Visc (>0.0)
 		Array1D< Real64 > ViscTemps; // Temperatures for viscosity of glycol
 		Array1D< Real64 > ViscValues; // viscosity values (mPa-s)
+		FluidPropsAxisIndex CpTempAxis; // Indexes of the tables above for FindArrayIndex
+		FluidPropsAxisIndex RhoTempAxis;
 
 		// Default Constructor
 		FluidPropsGlycolData() :
@@ -646,6 +677,44 @@ namespace FluidProperties {
 
 	};
 
+	struct GlycolPropsHandle
+	{
+		// Glycol index with the last specific heat and density found through it, for callers
+		// that ask again at the same temperature.
+
+		// Members
+		int GlycolIndex; // Index in GlycolData
+		bool CpSaved; // True when CpTemp and Cp hold a result
+		Real64 CpTemp;
+		Real64 Cp;
+		bool RhoSaved; // True when RhoTemp and Rho hold a result
+		Real64 RhoTemp;
+		Real64 Rho;
+
+		// Default Constructor
+		GlycolPropsHandle() :
+			GlycolIndex( 0 ),
+			CpSaved( false ),
+			CpTemp( 0.0 ),
+			Cp( 0.0 ),
+			RhoSaved( false ),
+			RhoTemp( 0.0 ),
+			Rho( 0.0 )
+		{}
+
+		// Member Constructor
+		GlycolPropsHandle( int const GlycolIndex ) :
+			GlycolIndex( GlycolIndex ),
+			CpSaved( false ),
+			CpTemp( 0.0 ),
+			Cp( 0.0 ),
+			RhoSaved( false ),
+			RhoTemp( 0.0 ),
+			Rho( 0.0 )
+		{}
+
+	};
+
 	struct FluidPropsGlycolErrors
 	{
 		// Members
@@ -776,6 +845,19 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeFluidAxisIndexes();
+
+	void
+	BuildAxisIndex(
+		FluidPropsAxisIndex & Axis,
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound
+		int const UpperBound // Valid values upper bound
+	);
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols();
 
@@ -892,6 +974,46 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	Real64
+	GetSpecificHeatGlycol_lookup(
+		GlycolPropsHandle & Handle, // Glycol and last result
+		Real64 const Temperature, // actual temperature given as input
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	);
+
+	inline
+	Real64
+	GetSpecificHeatGlycol(
+		GlycolPropsHandle & Handle, // Glycol and last result
+		Real64 const Temperature, // actual temperature given as input
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+		if ( Handle.CpSaved && Temperature == Handle.CpTemp ) return Handle.Cp;
+		return GetSpecificHeatGlycol_lookup( Handle, Temperature, CalledFrom );
+	}
+
+	Real64
+	GetDensityGlycol_lookup(
+		GlycolPropsHandle & Handle, // Glycol and last result
+		Real64 const Temperature, // actual temperature given as input
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	);
+
+	inline
+	Real64
+	GetDensityGlycol(
+		GlycolPropsHandle & Handle, // Glycol and last result
+		Real64 const Temperature, // actual temperature given as input
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+		if ( Handle.RhoSaved && Temperature == Handle.RhoTemp ) return Handle.Rho;
+		return GetDensityGlycol_lookup( Handle, Temperature, CalledFrom );
+	}
+
+	//*****************************************************************************
+
 	Real64
 	GetConductivityGlycol(
 		std::string const & Glycol, // carries in substance name
@@ -1025,6 +1147,15 @@ namespace FluidProperties {
 		Array1D< Real64 > const & Array // Array of values in ascending order
 	);
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsAxisIndex const & Axis // Bucket index of the array
+	);
+
 	//*****************************************************************************
 
 	Real64
@@ -1036,7 +1167,8 @@ namespace FluidProperties {
 		Real64 const Quality, // Quality
 		std::string const & CalledFrom, // routine this function was called from (error messages)
 		int const LowBound, // Valid values lower bound (set by calling program)
-		int const UpperBound // Valid values upper bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsAxisIndex const & TempAxis // Bucket index of PropTemps
 	);
 
 	//*****************************************************************************
@@ -22,6 +22,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -8481,16 +8482,20 @@ namespace Furnaces {
 
 		// METHODOLOGY EMPLOYED:
 		// Use RegulaFalsi technique to iterate on part-load ratio until convergence is achieved.
+		// With MultiSpeedBracketSearch set, the speed meeting the load is found by SearchSpeedLevel
+		// from the outputs at the lowest and highest speeds instead of trying each speed in turn.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
+		using General::SearchSpeedLevel;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 		using DataGlobals::WarmupFlag;
 		using DataGlobals::CurrentTime;
+		using DataSystemVariables::MultiSpeedBracketSearch;
 		using HeatingCoils::SimulateHeatingCoilComponents;
 		using Psychrometrics::PsyCpAirFnWTdb;
 		using DataEnvironment::OutDryBulbTemp;
@@ -8514,6 +8519,7 @@ namespace Furnaces {
 		Real64 TempOutput; // unit output when iteration limit exceeded [W]
 		Real64 NoCompOutput; // output when no active compressor [W]
 		Real64 LatOutput; // latent capacity output
+		Real64 FullLatOutput; // latent capacity output at full load [W]
 		Real64 ErrorToler; // error tolerance
 		int SolFla; // Flag of RegulaFalsi solver
 		Array1D< Real64 > Par( 10 ); // Parameters passed to RegulaFalsi
@@ -8567,6 +8573,7 @@ namespace Furnaces {
 		}
 
 		CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, SpeedNum, SpeedRatio, PartLoadFrac, FullOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad );
+		FullLatOutput = LatOutput;
 
 		if ( QLatReq < ( -1.0 * SmallLoad ) ) { //dehumidification mode
 			//  ! If the QLatReq <= LatOutput the unit needs to run full out
@@ -8661,7 +8668,25 @@ namespace Furnaces {
 				// Check to see which speed to meet the load
 				PartLoadFrac = 1.0;
 				SpeedRatio = 1.0;
-				if ( ( QZnReq < ( -1.0 * SmallLoad ) ) || ( QLatReq < ( -1.0 * SmallLoad ) ) ) { // Cooling
+				if ( MultiSpeedBracketSearch && Furnace( FurnaceNum ).HeatCoolMode == CoolingMode && Furnace( FurnaceNum ).NumOfSpeedCooling > 1 && ( ( QZnReq < ( -1.0 * SmallLoad ) ) || ( QLatReq < ( -1.0 * SmallLoad ) ) ) ) {
+					// Speed 1 does not meet the load and the highest speed, whose output is FullOutput, does
+					if ( QLatReq < ( -1.0 * SmallLoad ) ) {
+						SpeedNum = SearchSpeedLevel( 1, QLatReq - LatOutput, Furnace( FurnaceNum ).NumOfSpeedCooling, QLatReq - FullLatOutput, [&]( int const Speed ) -> Real64 {
+							CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, Speed, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad );
+							return QLatReq - LatOutput;
+						} );
+					} else {
+						SpeedNum = SearchSpeedLevel( 1, QZnReq - LowOutput, Furnace( FurnaceNum ).NumOfSpeedCooling, QZnReq - FullOutput, [&]( int const Speed ) -> Real64 {
+							CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, Speed, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad );
+							return QZnReq - TempOutput;
+						} );
+					}
+				} else if ( MultiSpeedBracketSearch && Furnace( FurnaceNum ).HeatCoolMode == HeatingMode && Furnace( FurnaceNum ).FurnaceType_Num != UnitarySys_HeatCool && Furnace( FurnaceNum ).NumOfSpeedHeating > 1 && ! ( ( QZnReq < ( -1.0 * SmallLoad ) ) || ( QLatReq < ( -1.0 * SmallLoad ) ) ) ) {
+					SpeedNum = SearchSpeedLevel( 1, LowOutput - QZnReq, Furnace( FurnaceNum ).NumOfSpeedHeating, FullOutput - QZnReq, [&]( int const Speed ) -> Real64 {
+						CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, Speed, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad );
+						return TempOutput - QZnReq;
+					} );
+				} else if ( ( QZnReq < ( -1.0 * SmallLoad ) ) || ( QLatReq < ( -1.0 * SmallLoad ) ) ) { // Cooling
 					for ( i = 2; i <= Furnace( FurnaceNum ).NumOfSpeedCooling; ++i ) {
 						CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, i, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad );
 
@@ -1,10 +1,17 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/fmt.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
 
@@ -17,6 +24,7 @@
 #include <DataRuntimeLanguage.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <InputProcessor.hh>
 #include <UtilityRoutines.hh>
 
@@ -62,6 +70,10 @@ namespace General {
 	// MODULE VARIABLE DECLARATIONS:
 	// na
 
+	// Object Data
+	std::vector< RootSolverCallSiteData > RootSolverCallSites; // Call site N is entry N-1
+	std::map< std::string, int > RootSolverCallSiteMap; // Call site number by solve, type and name
+
 	//SUBROUTINE SPECIFICATIONS FOR MODULE General
 	//PUBLIC  SaveCompDesWaterFlow
 	//PUBLIC  ErfFunction
@@ -77,7 +89,8 @@ namespace General {
 		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
 		Real64 const X_1, // 2nd bound of interval that contains the solution
-		Array1< Real64 > const & Par // array with additional parameters used for function evaluation
+		Array1< Real64 > const & Par, // array with additional parameters used for function evaluation
+		Optional_int_const CallSite // call site counting the solve, from RootSolverCallSiteIndex
 	)
 	{
 
@@ -143,6 +156,7 @@ namespace General {
 		if ( Y0 * Y1 > 0 ) {
 			Flag = -2;
 			XRes = X0;
+			RecordRootSolve( CallSite, Flag, 2 );
 			return;
 		}
 
@@ -198,6 +212,7 @@ namespace General {
 			Flag = -1;
 		}
 		XRes = XTemp;
+		RecordRootSolve( CallSite, Flag, NIte + 2 );
 
 	}
 
@@ -209,7 +224,8 @@ namespace General {
 		Real64 & XRes, // value of x that solves f(x) = 0
 		std::function< Real64( Real64 const ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1 // 2nd bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		Optional_int_const CallSite // call site counting the solve, from RootSolverCallSiteIndex
 	)
 	{
 
@@ -275,6 +291,7 @@ namespace General {
 		if ( Y0 * Y1 > 0 ) {
 			Flag = -2;
 			XRes = X0;
+			RecordRootSolve( CallSite, Flag, 2 );
 			return;
 		}
 
@@ -330,6 +347,297 @@ namespace General {
 			Flag = -1;
 		}
 		XRes = XTemp;
+		RecordRootSolve( CallSite, Flag, NIte + 2 );
+
+	}
+
+	int
+	RootSolverCallSiteIndex(
+		std::string const & Solve, // What the call site solves for
+		std::string const & CompType, // Component type
+		std::string const & CompName // Component name
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the number of the call site of a root solve for a component, 0 when the root
+		// solver statistics are not reported.
+
+		using DataSystemVariables::ReportRootSolverStatistics;
+
+		if ( ! ReportRootSolverStatistics ) return 0;
+
+		std::string const Key( Solve + '|' + CompType + '|' + CompName );
+		auto const Found( RootSolverCallSiteMap.find( Key ) );
+		if ( Found != RootSolverCallSiteMap.end() ) return Found->second;
+
+		RootSolverCallSites.push_back( RootSolverCallSiteData() );
+		RootSolverCallSites.back().Solve = Solve;
+		RootSolverCallSites.back().CompType = CompType;
+		RootSolverCallSites.back().CompName = CompName;
+		int const CallSite( int( RootSolverCallSites.size() ) );
+		RootSolverCallSiteMap[ Key ] = CallSite;
+		return CallSite;
+
+	}
+
+	void
+	RecordRootSolve(
+		Optional_int_const CallSite, // call site of the solve
+		int const Flag, // exit status of the solve
+		int const NumEvaluations // residual evaluations of the solve
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a solve to the statistics of its call site.  Solves from call sites that do not
+		// identify themselves are counted together.
+
+		using DataSystemVariables::ReportRootSolverStatistics;
+
+		if ( ! ReportRootSolverStatistics ) return;
+
+		int Site( 0 );
+		if ( present( CallSite ) ) Site = CallSite;
+		if ( Site <= 0 || Site > int( RootSolverCallSites.size() ) ) {
+			Site = RootSolverCallSiteIndex( "Unidentified", "Other Solves", "All" );
+		}
+
+		RootSolverStatistics & Stats( RootSolverCallSites[ Site - 1 ].Stats );
+		++Stats.NumSolves;
+		Stats.NumEvaluations += NumEvaluations;
+		if ( Flag > 0 ) {
+			Stats.NumIterations += Flag;
+		} else if ( Flag == -1 ) {
+			++Stats.NumNotConverged;
+		} else if ( Flag == -2 ) {
+			++Stats.NumNotBracketed;
+		}
+
+	}
+
+	void
+	SolveRootWarmStart(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status
+		Real64 & XRes, // value of x that solves f(x,Par) = 0
+		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		Array1< Real64 > const & Par, // array with additional parameters used for function evaluation
+		Real64 const XStart, // starting estimate, e.g. the solution of the previous time step
+		Optional< Real64 const > Y_0, // f(X_0,Par) when already calculated by the caller
+		Optional< Real64 const > Y_1, // f(X_1,Par) when already calculated by the caller
+		Optional< RootSolverStatistics > Stats // counts of the caller, updated for this solve
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Find the value of x between x0 and x1 such that f(x,Par) is equal to zero, as
+		// SolveRegulaFalsi does, starting from an estimate of the solution.
+
+		// METHODOLOGY EMPLOYED:
+		// The residual at the starting estimate is tried first; when it is not converged it
+		// replaces the bound with the residual of the same sign.  Brent's method (inverse
+		// quadratic and secant steps, falling back to bisection) then reduces the interval
+		// until the residual is below Eps.  Residuals at the bounds that the caller already
+		// has are not evaluated again.  Flag has the meaning of the SolveRegulaFalsi flag.
+
+		// REFERENCES:
+		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
+		// 2nd edition, 1992. Page 352 ff.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const EPSMach( 1.0e-15 ); // relative precision of x
+
+		int NEval( 0 ); // residual evaluations
+		int NIte( 0 ); // number of iterations
+		bool Conv( false ); // flag, true if convergence is achieved
+		bool NotBracketed( false ); // f(x0) and f(x1) have the same sign
+
+		Real64 A( X_0 ); // bound of the interval opposite to B
+		Real64 B( X_1 ); // best estimate
+		Real64 FA;
+		Real64 FB;
+		if ( present( Y_0 ) ) {
+			FA = Y_0;
+		} else {
+			FA = f( A, Par );
+			++NEval;
+		}
+		if ( present( Y_1 ) ) {
+			FB = Y_1;
+		} else {
+			FB = f( B, Par );
+			++NEval;
+		}
+
+		if ( FA * FB > 0.0 ) {
+			NotBracketed = true;
+			XRes = X_0;
+		} else {
+			// Take the starting estimate as one of the bounds
+			if ( XStart > min( A, B ) && XStart < max( A, B ) ) {
+				Real64 const FStart( f( XStart, Par ) );
+				++NEval;
+				++NIte;
+				if ( FStart * FA > 0.0 ) {
+					A = XStart;
+					FA = FStart;
+				} else {
+					B = XStart;
+					FB = FStart;
+				}
+				if ( std::abs( FStart ) < Eps ) {
+					B = XStart;
+					FB = FStart;
+					Conv = true;
+					if ( present( Stats ) ) ++Stats().NumWarmStarts;
+				}
+			}
+			if ( ! Conv && std::abs( FA ) < std::abs( FB ) ) {
+				std::swap( A, B );
+				std::swap( FA, FB );
+			}
+			if ( ! Conv && std::abs( FB ) < Eps ) {
+				Conv = true;
+				NIte = max( NIte, 1 );
+			}
+
+			Real64 C( A ); // previous value of B
+			Real64 FC( FA );
+			Real64 D( B - A ); // step of this iteration
+			Real64 E( D ); // step of the iteration before the last
+			while ( ! Conv && NIte <= MaxIte ) {
+				if ( FB * FC > 0.0 ) {
+					C = A;
+					FC = FA;
+					D = B - A;
+					E = D;
+				}
+				if ( std::abs( FC ) < std::abs( FB ) ) {
+					A = B;
+					B = C;
+					C = A;
+					FA = FB;
+					FB = FC;
+					FC = FA;
+				}
+				Real64 const Tol( 2.0 * EPSMach * std::abs( B ) + 0.5 * EPSMach );
+				Real64 const XM( 0.5 * ( C - B ) );
+				if ( std::abs( XM ) <= Tol ) break; // Interval exhausted without meeting Eps
+				if ( std::abs( E ) >= Tol && std::abs( FA ) > std::abs( FB ) ) {
+					Real64 P;
+					Real64 Q;
+					Real64 const S( FB / FA );
+					if ( A == C ) { // Secant step
+						P = 2.0 * XM * S;
+						Q = 1.0 - S;
+					} else { // Inverse quadratic step
+						Real64 const QA( FA / FC );
+						Real64 const R( FB / FC );
+						P = S * ( 2.0 * XM * QA * ( QA - R ) - ( B - A ) * ( R - 1.0 ) );
+						Q = ( QA - 1.0 ) * ( R - 1.0 ) * ( S - 1.0 );
+					}
+					if ( P > 0.0 ) Q = -Q;
+					P = std::abs( P );
+					if ( 2.0 * P < min( 3.0 * XM * Q - std::abs( Tol * Q ), std::abs( E * Q ) ) ) {
+						E = D;
+						D = P / Q;
+					} else {
+						D = XM;
+						E = D;
+					}
+				} else {
+					D = XM;
+					E = D;
+				}
+				A = B;
+				FA = FB;
+				if ( std::abs( D ) > Tol ) {
+					B += D;
+				} else {
+					B += sign( Tol, XM );
+				}
+				FB = f( B, Par );
+				++NEval;
+				++NIte;
+				if ( std::abs( FB ) < Eps ) Conv = true;
+			}
+			XRes = B;
+		}
+
+		if ( NotBracketed ) {
+			Flag = -2;
+		} else if ( Conv ) {
+			Flag = NIte;
+		} else {
+			Flag = -1;
+		}
+
+		if ( present( Stats ) ) {
+			RootSolverStatistics & Counts( Stats() );
+			++Counts.NumSolves;
+			Counts.NumEvaluations += NEval;
+			if ( NotBracketed ) {
+				++Counts.NumNotBracketed;
+			} else if ( Conv ) {
+				Counts.NumIterations += NIte;
+			} else {
+				++Counts.NumNotConverged;
+			}
+		}
+
+	}
+
+	int
+	SearchSpeedLevel(
+		int const SpeedLow, // speed known not to meet the load
+		Real64 const ResLow, // f(SpeedLow), negative
+		int const SpeedHigh, // speed known to meet the load
+		Real64 const ResHigh, // f(SpeedHigh), zero or positive
+		std::function< Real64( int const ) > f // residual at a speed, zero or positive when it meets the load
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the lowest speed of a multispeed unit above SpeedLow that meets the load, for
+		// residuals that increase with the speed, without trying each speed in turn.
+
+		// METHODOLOGY EMPLOYED:
+		// The bracket of speeds is narrowed at the speed interpolated linearly from the residuals
+		// of its ends, and at its middle after the same end has moved on two trials running, so
+		// that a residual nearly linear in the speed is bracketed in one or two trials and any
+		// other in about log2 of the speeds.
+
+		int Low( SpeedLow );
+		int High( SpeedHigh );
+		Real64 FLow( ResLow );
+		Real64 FHigh( ResHigh );
+		int LastMoved( 0 ); // End moved by the last trial, -1 for the low end and 1 for the high end
+		bool Bisect( false );
+		while ( High - Low > 1 ) {
+			int Speed;
+			if ( ! Bisect && FHigh > FLow ) {
+				Speed = Low + int( std::ceil( ( High - Low ) * ( -FLow ) / ( FHigh - FLow ) ) );
+			} else {
+				Speed = ( Low + High ) / 2;
+			}
+			Speed = max( Low + 1, min( High - 1, Speed ) );
+			Real64 const FSpeed( f( Speed ) );
+			int const Moved( FSpeed >= 0.0 ? 1 : -1 );
+			Bisect = ! Bisect && Moved == LastMoved;
+			LastMoved = Moved;
+			if ( FSpeed >= 0.0 ) {
+				High = Speed;
+				FHigh = FSpeed;
+			} else {
+				Low = Speed;
+				FLow = FSpeed;
+			}
+		}
+		return High;
 
 	}
 
@@ -618,6 +926,37 @@ namespace General {
 		return InterpSlatAng;
 	}
 
+#ifdef EP_DAYLIGHTING_FLOAT_FACTORS
+	Real64
+	InterpSlatAng(
+		Real64 const SlatAng, // Slat angle (rad)
+		bool const VarSlats, // True if slat angle is variable
+		Array1S< float > const PropArray // Array of single precision properties as function of slat angle
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Slat-angle interpolation as above, of properties stored in single precision such as the
+		// daylighting factors with the ENABLE_DAYLIGHTING_FLOAT_FACTORS build option.
+
+		// Using/Aliasing
+		using DataGlobals::Pi;
+		using DataSurfaces::MaxSlatAngs;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static Real64 const DeltaAng( Pi / ( double( MaxSlatAngs ) - 1.0 ) );
+		static Real64 const DeltaAng_inv( ( double( MaxSlatAngs ) - 1.0 ) / Pi );
+
+		if ( ! VarSlats ) return PropArray( 1 ); // Fixed-angle slats or shade
+
+		Real64 const SlatAng1( min( max( SlatAng, 0.0 ), Pi ) );
+		int const IBeta( 1 + int( SlatAng1 * DeltaAng_inv ) ); // Slat angle index
+		Real64 const InterpFac( ( SlatAng1 - DeltaAng * ( IBeta - 1 ) ) * DeltaAng_inv );
+		return PropArray( IBeta ) + InterpFac * ( Real64( PropArray( min( MaxSlatAngs, IBeta + 1 ) ) ) - PropArray( IBeta ) );
+
+	}
+#endif
+
 	Real64
 	InterpProfSlatAng(
 		Real64 const ProfAng, // Profile angle (rad)
@@ -986,6 +1325,87 @@ namespace General {
 
 	}
 
+	std::string::size_type
+	FormatFixed(
+		char * Buffer, // Receives the text, must hold at least Width + 1 characters
+		Real64 const Value,
+		int const Width, // Field width, as the w of the Fw.d edit descriptor (> 0)
+		int const Decimals // Digits after the decimal point, as the d of Fw.d
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the value into the caller's buffer as the Fortran Fw.d edit descriptor does through
+		// gio, without the stream and strings of the format engine, and gives the length written.
+
+		// METHODOLOGY EMPLOYED:
+		// The fixed conversion of the C library is the one the stream uses.  As gio does, a lead
+		// zero is dropped if the value does not fit otherwise, and the field is filled with
+		// asterisks if it still does not fit.
+
+		char Work[ 400 ]; // Holds the widest double in fixed form with the decimals used in reports
+		int Length( std::snprintf( Work, sizeof( Work ), "%#*.*f", Width, Decimals, Value ) );
+		char * Start( Work );
+		if ( Length > Width && Length < int( sizeof( Work ) ) ) {
+			if ( Work[ 0 ] == '0' ) { // Trim lead zero
+				++Start;
+				--Length;
+			} else if ( Work[ 0 ] == '-' && Work[ 1 ] == '0' ) {
+				Work[ 1 ] = '-';
+				++Start;
+				--Length;
+			}
+		}
+		if ( Length > Width || Length < 0 ) { // Fortran *-fills when output is too wide
+			std::memset( Buffer, '*', Width );
+			Length = Width;
+		} else {
+			std::memcpy( Buffer, Start, Length );
+		}
+		Buffer[ Length ] = '\0';
+		return std::string::size_type( Length );
+
+	}
+
+	std::string::size_type
+	FormatListDirected(
+		char * Buffer, // Receives the text, must hold at least 25 characters
+		Real64 const Value
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the value into the caller's buffer as list directed output of a double (format *)
+		// does through gio, and gives the length written.
+
+		// METHODOLOGY EMPLOYED:
+		// List directed output is the G24.15E3 form with a scale factor of 1: fixed with 15
+		// significant digits in 19 columns followed by 5 blanks for magnitudes from 0.1 up to
+		// 1.0E17, exponent form otherwise.  The fixed form, which nearly all report values
+		// take, is written by FormatFixed; the exponent form is left to the format engine.
+
+		std::size_t const ExpWidth( 5 ); // Width of the exponent part, blank in the fixed form
+		Real64 const Magnitude( std::abs( Value ) );
+		int Decimals;
+		if ( Magnitude == 0.0 ) {
+			Decimals = 14;
+		} else {
+			int const p( static_cast< int >( std::floor( std::log10( Magnitude ) + 1.0 ) ) );
+			if ( ( 0 <= p ) && ( p <= 17 ) ) {
+				Decimals = 15 - std::min( p, 15 );
+			} else {
+				std::string const Exponent( fmt::E( Value, 24, 15, 3, 1 ) );
+				std::memcpy( Buffer, Exponent.c_str(), Exponent.length() + 1 );
+				return Exponent.length();
+			}
+		}
+		std::string::size_type const Length( FormatFixed( Buffer, Value, 19, Decimals ) );
+		std::memset( Buffer + Length, ' ', ExpWidth );
+		Buffer[ Length + ExpWidth ] = '\0';
+		return Length + ExpWidth;
+
+	}
+
 	std::string
 	TrimSigDigits(
 		Real64 const RealValue,
@@ -1021,7 +1441,6 @@ namespace General {
 		// FUNCTION PARAMETER DEFINITIONS:
 		static std::string const NAN_string( "NAN" );
 		static std::string const ZEROOOO( "0.000000000000000000000000000" );
-		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1035,7 +1454,9 @@ namespace General {
 
 		std::string String; // Working string
 		if ( RealValue != 0.0 ) {
-			gio::write( String, fmtLD ) << RealValue;
+			char Buffer[ 32 ];
+			FormatListDirected( Buffer, RealValue );
+			String = Buffer;
 		} else {
 			String = ZEROOOO;
 		}
@@ -1145,7 +1566,6 @@ namespace General {
 		static std::string const DigitChar( "01234567890" );
 		static std::string const NAN_string( "NAN" );
 		static std::string const ZEROOOO( "0.000000000000000000000000000" );
-		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1159,7 +1579,9 @@ namespace General {
 
 		std::string String; // Working string
 		if ( RealValue != 0.0 ) {
-			gio::write( String, fmtLD ) << RealValue;
+			char Buffer[ 32 ];
+			FormatListDirected( Buffer, RealValue );
+			String = Buffer;
 		} else {
 			String = ZEROOOO;
 		}
@@ -3044,6 +3466,7 @@ namespace General {
 		using DataRuntimeLanguage::OutputEMSActuatorAvailSmall;
 		using DataRuntimeLanguage::OutputEMSInternalVarsFull;
 		using DataRuntimeLanguage::OutputEMSInternalVarsSmall;
+		using DataRuntimeLanguage::OutputEMSProfile;
 		using DataGlobals::ShowDecayCurvesInEIO;
 
 		// Locals
@@ -3283,6 +3706,18 @@ namespace General {
 					OutputFullEMSTrace = false;
 				}}
 
+				if ( NumNames >= 4 && ! lAlphaFieldBlanks( 4 ) ) {
+					if ( cAlphaArgs( 4 ) == "YES" ) {
+						OutputEMSProfile = true;
+					} else if ( cAlphaArgs( 4 ) == "NO" ) {
+						OutputEMSProfile = false;
+					} else {
+						ShowWarningError( cCurrentModuleObject + ": Invalid " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\" supplied." );
+						ShowContinueError( " Legal values are: \"No\", \"Yes\". \"No\" will be used." );
+						OutputEMSProfile = false;
+					}
+				}
+
 			}
 
 			//    cCurrentModuleObject='Output:Schedules'
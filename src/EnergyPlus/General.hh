@@ -3,6 +3,9 @@
 
 // C++ Headers
 #include <functional>
+#include <map>
+#include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
@@ -21,13 +24,57 @@ namespace General {
 	// Data
 	// This module should not contain variables in the module sense as it is
 	// intended strictly to provide "interfaces" to routines used by other
-	// parts of the simulation.
+	// parts of the simulation.  The root solver call site statistics, kept only
+	// when they are reported, are the exception.
 
 	// MODULE PARAMETER DEFINITIONS
 	// na
 
 	// DERIVED TYPE DEFINITIONS
-	// na
+
+	struct RootSolverStatistics
+	{
+		// Counts kept by a caller of SolveRootWarmStart over all of its solves
+
+		// Members
+		int NumSolves; // Calls of the solver
+		int NumEvaluations; // Residual function evaluations
+		int NumIterations; // Iterations of the converged solves
+		int NumNotConverged; // Solves stopped at the iteration limit
+		int NumNotBracketed; // Solves with residuals of the same sign at both bounds
+		int NumWarmStarts; // Solves converged at the starting estimate
+
+		// Default Constructor
+		RootSolverStatistics() :
+			NumSolves( 0 ),
+			NumEvaluations( 0 ),
+			NumIterations( 0 ),
+			NumNotConverged( 0 ),
+			NumNotBracketed( 0 ),
+			NumWarmStarts( 0 )
+		{}
+
+	};
+
+	struct RootSolverCallSiteData
+	{
+		// Solves made by one component at one call site of the root solvers
+
+		// Members
+		std::string Solve; // What the call site solves for
+		std::string CompType; // Component type
+		std::string CompName; // Component name
+		RootSolverStatistics Stats;
+
+		// Default Constructor
+		RootSolverCallSiteData()
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< RootSolverCallSiteData > RootSolverCallSites; // Call site N is entry N-1
+	extern std::map< std::string, int > RootSolverCallSiteMap; // Call site number by solve, type and name
 
 	// INTERFACE DEFINITIONS
 
@@ -49,7 +96,8 @@ namespace General {
 		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
 		Real64 const X_1, // 2nd bound of interval that contains the solution
-		Array1< Real64 > const & Par // array with additional parameters used for function evaluation
+		Array1< Real64 > const & Par, // array with additional parameters used for function evaluation
+		Optional_int_const CallSite = _ // call site counting the solve, from RootSolverCallSiteIndex
 	);
 
 	void
@@ -60,7 +108,47 @@ namespace General {
 		Real64 & XRes, // value of x that solves f(x) = 0
 		std::function< Real64( Real64 const ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1 // 2nd bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		Optional_int_const CallSite = _ // call site counting the solve, from RootSolverCallSiteIndex
+	);
+
+	int
+	RootSolverCallSiteIndex(
+		std::string const & Solve, // What the call site solves for
+		std::string const & CompType, // Component type
+		std::string const & CompName // Component name
+	);
+
+	void
+	RecordRootSolve(
+		Optional_int_const CallSite, // call site of the solve
+		int const Flag, // exit status of the solve
+		int const NumEvaluations // residual evaluations of the solve
+	);
+
+	void
+	SolveRootWarmStart(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status
+		Real64 & XRes, // value of x that solves f(x,Par) = 0
+		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		Array1< Real64 > const & Par, // array with additional parameters used for function evaluation
+		Real64 const XStart, // starting estimate, e.g. the solution of the previous time step
+		Optional< Real64 const > Y_0 = _, // f(X_0,Par) when already calculated by the caller
+		Optional< Real64 const > Y_1 = _, // f(X_1,Par) when already calculated by the caller
+		Optional< RootSolverStatistics > Stats = _ // counts of the caller, updated for this solve
+	);
+
+	int
+	SearchSpeedLevel(
+		int const SpeedLow, // speed known not to meet the load
+		Real64 const ResLow, // f(SpeedLow), negative
+		int const SpeedHigh, // speed known to meet the load
+		Real64 const ResHigh, // f(SpeedHigh), zero or positive
+		std::function< Real64( int const ) > f // residual at a speed, zero or positive when it meets the load
 	);
 
 	Real64
@@ -96,6 +184,15 @@ namespace General {
 		Array1S< Real64 > const PropArray // Array of blind properties as function of slat angle
 	);
 
+#ifdef EP_DAYLIGHTING_FLOAT_FACTORS
+	Real64
+	InterpSlatAng(
+		Real64 const SlatAng, // Slat angle (rad)
+		bool const VarSlats, // True if slat angle is variable
+		Array1S< float > const PropArray // Array of single precision properties as function of slat angle
+	);
+#endif
+
 	Real64
 	InterpProfSlatAng(
 		Real64 const ProfAng, // Profile angle (rad)
@@ -145,6 +242,20 @@ namespace General {
 		int & N // number of terms in polynomial
 	);
 
+	std::string::size_type
+	FormatFixed(
+		char * Buffer, // Receives the text, must hold at least Width + 1 characters
+		Real64 const Value,
+		int const Width, // Field width, as the w of the Fw.d edit descriptor (> 0)
+		int const Decimals // Digits after the decimal point, as the d of Fw.d
+	);
+
+	std::string::size_type
+	FormatListDirected(
+		char * Buffer, // Receives the text, must hold at least 25 characters
+		Real64 const Value
+	);
+
 	std::string
 	TrimSigDigits(
 		Real64 const RealValue,
@@ -36,7 +36,6 @@ namespace GlobalNames {
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
 	using namespace DataGlobals;
-	using InputProcessor::FindItemInList;
 	using InputProcessor::MakeUPPERCase;
 
 	// Data
@@ -62,6 +61,10 @@ namespace GlobalNames {
 	Array1D< ComponentNameData > BoilerNames;
 	Array1D< ComponentNameData > BaseboardNames;
 	Array1D< ComponentNameData > CoilNames;
+	std::unordered_map< std::string, int > ChillerNamesIndex;
+	std::unordered_map< std::string, int > BoilerNamesIndex;
+	std::unordered_map< std::string, int > BaseboardNamesIndex;
+	std::unordered_map< std::string, int > CoilNamesIndex;
 
 	// Functions
 
@@ -111,7 +114,10 @@ namespace GlobalNames {
 
 		ErrorFound = false;
 		int Found = 0;
-		if ( NumChillers > 0 ) Found = FindItemInList( NameToVerify, ChillerNames.CompName(), NumChillers );
+		if ( NumChillers > 0 ) {
+			auto const found( ChillerNamesIndex.find( NameToVerify ) );
+			if ( found != ChillerNamesIndex.end() ) Found = found->second;
+		}
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Chiller Type=\"" + ChillerNames( Found ).CompType + "\"." );
 			ShowContinueError( "...Current entry is Chiller Type=\"" + TypeToVerify + "\"." );
@@ -120,13 +126,15 @@ namespace GlobalNames {
 			if ( NumChillers == 0 ) {
 				CurMaxChillers = 4;
 				ChillerNames.allocate( CurMaxChillers );
+				ChillerNamesIndex.clear();
 			} else if ( NumChillers == CurMaxChillers ) {
-				CurMaxChillers += 4;
+				CurMaxChillers *= 2;
 				ChillerNames.redimension( CurMaxChillers );
 			}
 			++NumChillers;
 			ChillerNames( NumChillers ).CompType = MakeUPPERCase( TypeToVerify );
 			ChillerNames( NumChillers ).CompName = NameToVerify;
+			ChillerNamesIndex.emplace( NameToVerify, NumChillers );
 		}
 	}
 
@@ -177,7 +185,10 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumBaseboards > 0 ) Found = FindItemInList( NameToVerify, BaseboardNames.CompName(), NumBaseboards );
+		if ( NumBaseboards > 0 ) {
+			auto const found( BaseboardNamesIndex.find( NameToVerify ) );
+			if ( found != BaseboardNamesIndex.end() ) Found = found->second;
+		}
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Baseboard Type=\"" + BaseboardNames( Found ).CompType + "\"." );
@@ -187,13 +198,15 @@ namespace GlobalNames {
 			if ( NumBaseboards == 0 ) {
 				CurMaxBaseboards = 4;
 				BaseboardNames.allocate( CurMaxBaseboards );
+				BaseboardNamesIndex.clear();
 			} else if ( NumBaseboards == CurMaxBaseboards ) {
-				CurMaxBaseboards += 4;
+				CurMaxBaseboards *= 2;
 				BaseboardNames.redimension( CurMaxBaseboards );
 			}
 			++NumBaseboards;
 			BaseboardNames( NumBaseboards ).CompType = TypeToVerify;
 			BaseboardNames( NumBaseboards ).CompName = NameToVerify;
+			BaseboardNamesIndex.emplace( NameToVerify, NumBaseboards );
 		}
 
 	}
@@ -245,7 +258,10 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumBoilers > 0 ) Found = FindItemInList( NameToVerify, BoilerNames.CompName(), NumBoilers );
+		if ( NumBoilers > 0 ) {
+			auto const found( BoilerNamesIndex.find( NameToVerify ) );
+			if ( found != BoilerNamesIndex.end() ) Found = found->second;
+		}
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Boiler Type=\"" + BoilerNames( Found ).CompType + "\"." );
@@ -255,13 +271,15 @@ namespace GlobalNames {
 			if ( NumBoilers == 0 ) {
 				CurMaxBoilers = 4;
 				BoilerNames.allocate( CurMaxBoilers );
+				BoilerNamesIndex.clear();
 			} else if ( NumBoilers == CurMaxBoilers ) {
-				CurMaxBoilers += 4;
+				CurMaxBoilers *= 2;
 				BoilerNames.redimension( CurMaxBoilers );
 			}
 			++NumBoilers;
 			BoilerNames( NumBoilers ).CompType = TypeToVerify;
 			BoilerNames( NumBoilers ).CompName = NameToVerify;
+			BoilerNamesIndex.emplace( NameToVerify, NumBoilers );
 		}
 
 	}
@@ -313,7 +331,10 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumCoils > 0 ) Found = FindItemInList( NameToVerify, CoilNames.CompName(), NumCoils );
+		if ( NumCoils > 0 ) {
+			auto const found( CoilNamesIndex.find( NameToVerify ) );
+			if ( found != CoilNamesIndex.end() ) Found = found->second;
+		}
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Coil Type=\"" + CoilNames( Found ).CompType + "\"" );
@@ -323,13 +344,15 @@ namespace GlobalNames {
 			if ( NumCoils == 0 ) {
 				CurMaxCoils = 4;
 				CoilNames.allocate( CurMaxCoils );
+				CoilNamesIndex.clear();
 			} else if ( NumCoils == CurMaxCoils ) {
-				CurMaxCoils += 4;
+				CurMaxCoils *= 2;
 				CoilNames.redimension( CurMaxCoils );
 			}
 			++NumCoils;
 			CoilNames( NumCoils ).CompType = MakeUPPERCase( TypeToVerify );
 			CoilNames( NumCoils ).CompName = NameToVerify;
+			CoilNamesIndex.emplace( NameToVerify, NumCoils );
 		}
 
 	}
@@ -1,6 +1,10 @@
 #ifndef GlobalNames_hh_INCLUDED
 #define GlobalNames_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -60,6 +64,10 @@ namespace GlobalNames {
 	extern Array1D< ComponentNameData > BoilerNames;
 	extern Array1D< ComponentNameData > BaseboardNames;
 	extern Array1D< ComponentNameData > CoilNames;
+	extern std::unordered_map< std::string, int > ChillerNamesIndex; // ChillerNames position of each name
+	extern std::unordered_map< std::string, int > BoilerNamesIndex; // BoilerNames position of each name
+	extern std::unordered_map< std::string, int > BaseboardNamesIndex; // BaseboardNames position of each name
+	extern std::unordered_map< std::string, int > CoilNamesIndex; // CoilNames position of each name
 
 	// Functions
 
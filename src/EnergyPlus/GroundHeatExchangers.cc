@@ -1,9 +1,11 @@
 // C++ Headers
 #include <cmath>
+#include <map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
 #include <GroundHeatExchangers.hh>
@@ -14,6 +16,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -45,7 +48,8 @@ namespace GroundHeatExchangers {
 	// applied heat pulses. The response to each pulse is calculated from a non-
 	// dimensionalized response function, or G-function, that is specific to the
 	// given borehole field arrangement, depth and spacing. The data defining
-	// this function is read from input.
+	// this function is read from input, or calculated for a rectangular field
+	// of vertical boreholes by the finite line source.
 	// The heat pulse histories need to be recorded over an extended period (months).
 	// To aid computational efficiency past pulses are continuously agregated into
 	// equivalent heat pulses of longer duration, as each pulse becomes less recent.
@@ -57,6 +61,8 @@ namespace GroundHeatExchangers {
 	//   for Vertical Ground Loop Heat Exchangers. ASHRAE Transactions. 105(2): 475-485.
 	// Xiong, Z., D.E. Fisher, J.D. Spitler. 2015. 'Development and Validation of a Slinky
 	//   Ground Heat Exchanger.' Applied Energy. Vol 114, 57-69.
+	// Claesson, J., S. Javed. 2011. 'An Analytical Method to Calculate Borehole Fluid
+	//   Temperatures for Time-scales from Minutes to Decades.' ASHRAE Transactions. 117(2): 279-288.
 
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
@@ -85,6 +91,10 @@ namespace GroundHeatExchangers {
 	Real64 const hrsPerMonth( 730.0 ); // Number of hours in month
 	Real64 const DeltaTempLimit( 100.0 ); // temp limit for warnings
 	int const maxTSinHr( 60 ); // Max number of time step in a hour
+	Real64 const lnTTsMinArray( -8.5 ); // First Ln(T/Ts) of the g-functions calculated for a borehole array
+	Real64 const lnTTsStepArray( 0.25 ); // Ln(T/Ts) step of the g-functions calculated for a borehole array
+	int const numAggLevels( 16 ); // Levels of the multilevel load aggregation, covering about 120 years
+	int const numAggBins( 8 ); // Bins in each level of the multilevel load aggregation
 
 	// MODULE VARIABLE DECLARATIONS:
 	int numVerticalGLHEs( 0 );
@@ -104,6 +114,8 @@ namespace GroundHeatExchangers {
 	// Object Data
 	Array1D< GLHEVert > verticalGLHE;
 	Array1D< GLHESlinky > slinkyGLHE;
+	std::vector< GFunctionCacheData > gFunctionCache; // G-functions calculated for borehole arrays
+	std::vector< SlinkyGFunctionCacheData > slinkyGFunctionCache; // G-functions calculated for slinky ground heat exchangers
 
 	// MODULE SUBROUTINES:
 
@@ -257,8 +269,206 @@ namespace GroundHeatExchangers {
 	void
 	GLHEVert::calcGFunctions()
 	{
-		// Nothing to see here. Move along.
-		// Just a stub out for future work.
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the g-functions of a ground heat exchanger whose boreholes are given by a
+		// GroundHeatExchanger:Vertical:Array.
+
+		// METHODOLOGY EMPLOYED:
+		// The g-functions depend only on the numbers of boreholes and the spacing, radius and depth
+		// of the boreholes relative to their length, so those found for one ground heat exchanger
+		// are taken by any other of the same geometry.  They are found at the actual borehole radius,
+		// which becomes the reference ratio.
+
+		// Using/Aliasing
+		using DataGlobals::OutputFileInits;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool writeHeader( true );
+
+		gFunctionsCalculated = true;
+		if ( ! gFunctionsFromArray ) return;
+
+		GFunctionCacheData geometry;
+		geometry.numBoreholesX = min( numBoreholesX, numBoreholesY );
+		geometry.numBoreholesY = max( numBoreholesX, numBoreholesY );
+		geometry.spacingRatio = boreholeSpacing / boreholeLength;
+		geometry.radiusRatio = boreholeRadius / boreholeLength;
+		geometry.depthRatio = boreholeTopDepth / boreholeLength;
+
+		// From short times to the end of the simulation, at least to steady state
+		Real64 const timeSteadyState( pow_2( boreholeLength ) / ( 9.0 * diffusivityGround ) ); // [s]
+		Real64 const lnTTsMax( max( 3.0, std::log( maxSimYears * 8760.0 * SecInHour / timeSteadyState ) ) );
+		geometry.NPairs = int( std::ceil( ( lnTTsMax - lnTTsMinArray ) / lnTTsStepArray ) ) + 1;
+
+		NPairs = geometry.NPairs;
+		LNTTS.dimension( NPairs, 0.0 );
+		for ( int pairNum = 1; pairNum <= NPairs; ++pairNum ) {
+			LNTTS( pairNum ) = lnTTsMinArray + ( pairNum - 1 ) * lnTTsStepArray;
+		}
+		gReferenceRatio = geometry.radiusRatio;
+
+		bool found( false );
+		for ( auto const & cached : gFunctionCache ) {
+			if ( cached.numBoreholesX == geometry.numBoreholesX && cached.numBoreholesY == geometry.numBoreholesY && cached.spacingRatio == geometry.spacingRatio && cached.radiusRatio == geometry.radiusRatio && cached.depthRatio == geometry.depthRatio && cached.NPairs == geometry.NPairs ) {
+				GFNC = cached.GFNC;
+				found = true;
+				break;
+			}
+		}
+		if ( ! found ) {
+			GFNC.dimension( NPairs, 0.0 );
+			calcBoreholeFieldGFunctions( geometry.numBoreholesX, geometry.numBoreholesY, geometry.spacingRatio, geometry.radiusRatio, geometry.depthRatio, LNTTS, GFNC );
+			geometry.GFNC = GFNC;
+			gFunctionCache.push_back( geometry );
+		}
+
+		// The data pairs may be entered in the GroundHeatExchanger:Vertical object instead of calculated again
+		if ( writeHeader ) {
+			gio::write( OutputFileInits, fmtA ) << "! <GroundHeatExchanger:Vertical G-Function>, Name, Reference Ratio, Number of Data Pairs, {G-Function Ln(T/Ts) Value, G-Function G Value}";
+			writeHeader = false;
+		}
+		std::string gFunctionLine( "GroundHeatExchanger:Vertical G-Function, " + Name + ", " + RoundSigDigits( gReferenceRatio, 6 ) + ", " + RoundSigDigits( NPairs ) );
+		for ( int pairNum = 1; pairNum <= NPairs; ++pairNum ) {
+			gFunctionLine += ", " + RoundSigDigits( LNTTS( pairNum ), 3 ) + ", " + RoundSigDigits( GFNC( pairNum ), 4 );
+		}
+		gio::write( OutputFileInits, fmtA ) << gFunctionLine;
+
+	}
+
+	//******************************************************************************
+
+	Real64
+	finiteLineSourceResponse(
+		Real64 const dist, // Distance between the borehole axes, the borehole radius for a borehole to itself [m]
+		Real64 const length, // Borehole length [m]
+		Real64 const topDepth, // Depth of the top of the boreholes [m]
+		Real64 const diffusivity, // Ground thermal diffusivity [m2/s]
+		Real64 const time // Time since the heat rate was applied [s]
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Mean temperature response along a borehole to a constant heat rate per unit length in
+		// another of the same length and depth, as a g-function contribution 2 pi k dT / q'.
+
+		// METHODOLOGY EMPLOYED:
+		// Finite line source with the ground surface held at the undisturbed temperature (an image
+		// source above it), in the integral form of Claesson and Javed:
+		//   h = 1/(2H) * integral from 1/sqrt(4 a t) to infinity of exp(-d^2 s^2) / s^2 * Y(s) ds
+		//   Y = 2 ierf(H s) + 2 ierf((H + 2D) s) - ierf(2D s) - ierf((2H + 2D) s)
+		//   ierf(X) = X erf(X) - (1 - exp(-X^2)) / sqrt(pi)
+		// The integral is taken over ln(s) by 8 point Gauss-Legendre quadrature on intervals of
+		// 0.25, up to where exp(-d^2 s^2) is negligible.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const numPoints( 8 );
+		static Real64 const abscissa[ numPoints ] = { -0.9602898564975363, -0.7966664774136267, -0.5255324099163290, -0.1834346424956498, 0.1834346424956498, 0.5255324099163290, 0.7966664774136267, 0.9602898564975363 };
+		static Real64 const weight[ numPoints ] = { 0.1012285362903763, 0.2223810344533745, 0.3137066458778873, 0.3626837833783620, 0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763 };
+		Real64 const intervalWidth( 0.25 ); // Width of the quadrature intervals in ln(s)
+		Real64 const maxDistArg( 6.5 ); // exp(-d^2 s^2) is taken as zero beyond d s = 6.5
+		static Real64 const sqrtPi( std::sqrt( Pi ) );
+
+		auto ierf = []( Real64 const X ) -> Real64 {
+			return X * std::erf( X ) - ( 1.0 - std::exp( -pow_2( X ) ) ) / sqrtPi;
+		};
+
+		Real64 const lnSLow( std::log( 1.0 / std::sqrt( 4.0 * diffusivity * time ) ) );
+		Real64 const lnSHigh( std::log( maxDistArg / dist ) );
+		if ( lnSHigh <= lnSLow ) return 0.0;
+
+		int const numIntervals( max( 1, int( std::ceil( ( lnSHigh - lnSLow ) / intervalWidth ) ) ) );
+		Real64 const halfWidth( 0.5 * ( lnSHigh - lnSLow ) / numIntervals );
+		Real64 integral( 0.0 );
+		for ( int interval = 0; interval < numIntervals; ++interval ) {
+			Real64 const lnSMid( lnSLow + ( 2 * interval + 1 ) * halfWidth );
+			for ( int i = 0; i < numPoints; ++i ) {
+				Real64 const s( std::exp( lnSMid + halfWidth * abscissa[ i ] ) );
+				Real64 const Y( 2.0 * ierf( length * s ) + 2.0 * ierf( ( length + 2.0 * topDepth ) * s ) - ierf( 2.0 * topDepth * s ) - ierf( ( 2.0 * length + 2.0 * topDepth ) * s ) );
+				integral += weight[ i ] * std::exp( -pow_2( dist * s ) ) * Y / s; // ds / s^2 = d(ln s) / s
+			}
+		}
+		return integral * halfWidth / ( 2.0 * length );
+
+	}
+
+	//******************************************************************************
+
+	void
+	calcBoreholeFieldGFunctions(
+		int const numBoreholesX, // Boreholes in each direction
+		int const numBoreholesY,
+		Real64 const spacingRatio, // Borehole spacing / borehole length
+		Real64 const radiusRatio, // Borehole radius / borehole length
+		Real64 const depthRatio, // Borehole top depth / borehole length
+		Array1< Real64 > const & LNTTS, // Ln(T/Ts) of the g-function values
+		Array1< Real64 > & GFNC // G-function values
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the g-functions of a rectangular field of vertical boreholes with equal spacing
+		// in both directions.
+
+		// METHODOLOGY EMPLOYED:
+		// Each borehole takes the same heat rate per unit length; the g-function is the mean over the
+		// boreholes of the finite line source responses of the borehole to all boreholes of the field.
+		// The response of a pair depends only on its distance, and in a rectangular field a pair offset
+		// by (i,j) spacings has the distance of pairs offset by (j,i), so the N^2 pairs reduce to the
+		// distinct values of i^2 + j^2, each with the number of pairs having it.  The responses at each
+		// distance and time are independent and are found in parallel, then summed in a fixed order.
+		// For large fields at long times the uniform heat rate gives somewhat higher g-functions than
+		// the uniform borehole wall temperature of Eskilson's.
+
+#ifdef HBIRE_USE_OMP
+		// Using/Aliasing
+		using DataSystemVariables::NumberGLHEThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+
+#endif
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::map< int, Real64 > pairCounts; // Number of borehole pairs by squared distance in spacings
+
+		for ( int i = 0; i < numBoreholesX; ++i ) {
+			for ( int j = 0; j < numBoreholesY; ++j ) {
+				pairCounts[ i * i + j * j ] += Real64( ( numBoreholesX - i ) * ( numBoreholesY - j ) * ( i > 0 ? 2 : 1 ) * ( j > 0 ? 2 : 1 ) );
+			}
+		}
+		std::vector< Real64 > dists; // Distances relative to the borehole length, the radius for a borehole to itself
+		std::vector< Real64 > counts;
+		for ( auto const & pairCount : pairCounts ) {
+			dists.push_back( pairCount.first == 0 ? radiusRatio : spacingRatio * std::sqrt( Real64( pairCount.first ) ) );
+			counts.push_back( pairCount.second );
+		}
+
+		// Unit length and diffusivity 1/9, so that the steady state time is 1
+		int const numDists( dists.size() );
+		int const numTimes( LNTTS.size() );
+		int const numResponses( numDists * numTimes );
+		std::vector< Real64 > responses( numResponses );
+#ifdef HBIRE_USE_OMP
+		int const nThreads( ParallelLoopThreads( NumberGLHEThreads, numResponses ) );
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads) if(nThreads > 1)
+#endif
+		for ( int response = 0; response < numResponses; ++response ) {
+			int const distNum( response / numTimes );
+			int const timeNum( response % numTimes + 1 );
+			responses[ response ] = finiteLineSourceResponse( dists[ distNum ], 1.0, depthRatio, 1.0 / 9.0, std::exp( LNTTS( timeNum ) ) );
+		}
+
+		Real64 const numBoreholes( numBoreholesX * numBoreholesY );
+		for ( int timeNum = 1; timeNum <= numTimes; ++timeNum ) {
+			Real64 gFunc( 0.0 );
+			for ( int distNum = 0; distNum < numDists; ++distNum ) {
+				gFunc += counts[ distNum ] * responses[ distNum * numTimes + timeNum - 1 ];
+			}
+			GFNC( timeNum ) = gFunc / numBoreholes;
+		}
+
 	}
 
 	//******************************************************************************
@@ -275,36 +485,31 @@ namespace GroundHeatExchangers {
 		// PURPOSE OF THIS SUBROUTINE:
 		// calculates g-functions for the slinky ground heat exchanger model
 
+		// METHODOLOGY EMPLOYED:
+		// The response of a ring to another depends only on their offset in trenches and coils, so the
+		// sum over the pairs of rings is the sum over the offsets of the response times the weighted
+		// number of pairs with the offset.  The responses at each offset and time are independent and are found
+		// in parallel, then summed in a fixed order.  G-functions are kept for the other slinky ground
+		// heat exchangers of the same geometry.
+
+#ifdef HBIRE_USE_OMP
+		// Using/Aliasing
+		using DataSystemVariables::NumberGLHEThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+
+#endif
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 tLg_max( 0.0 );
 		Real64 tLg_min( -2 );
 		Real64 tLg_grid( 0.25 );
 		Real64 ts( 3600 );
-		Real64 tLg;
-		Real64 t;
 		Real64 convertYearsToSeconds( 356 * 24 * 60 * 60 );
-		int NT;
+		Real64 const fieldTolerance( 1.0e-6 ); // Tolerance of the other rings' responses relative to a ring's own
 		int numLC;
 		int numRC;
-		int coil;
-		int trench;
 		Real64 fraction;
-		Array2D< Real64 > valStored( {0, numTrenches}, {0, numCoils}, -1.0 );
-		Real64 gFunc;
-		Real64 gFuncin;
-		int m1;
-		int n1;
-		int m;
-		int n;
-		int mm1;
-		int nn1;
 		int i;
-		int j;
-		Real64 disRing;
-		int I0;
-		int J0;
-		Real64 doubleIntegralVal;
-		Real64 midFieldVal;
 
 		X0.allocate( numCoils );
 		Y0.allocate( numTrenches );
@@ -320,10 +525,11 @@ namespace GroundHeatExchangers {
 		QnHr.allocate( 730 + AGG + SubAGG );
 		QnSubHr.allocate( ( SubAGG + 1 ) * maxTSinHr + 1 );
 		LastHourN.allocate( SubAGG + 1 );
+		QnAggLevel.dimension( numAggBins, numAggLevels, 0.0 );
 
 		for ( i = 1; i <= NPairs; ++i ) {
 			GFNC( i ) = 0.0;
-			LNTTS( i ) = 0.0;
+			LNTTS( i ) = tLg_min + tLg_grid * ( i - 1 );
 		}
 
 		// Calculate the number of loops (per trench) and number of trenchs to be involved
@@ -334,10 +540,10 @@ namespace GroundHeatExchangers {
 		numRC = std::ceil( numTrenches / 2.0 );
 
 		// Calculate coordinates (X0, Y0, Z0) of a ring's center
-		for ( coil = 1; coil <= numCoils; ++coil ) {
+		for ( int coil = 1; coil <= numCoils; ++coil ) {
 			X0( coil ) = coilPitch * ( coil - 1 );
 		}
-		for ( trench = 1; trench <= numTrenches; ++trench ) {
+		for ( int trench = 1; trench <= numTrenches; ++trench ) {
 			Y0( trench ) = ( trench - 1 ) * trenchSpacing;
 		}
 		Z0 = coilDepth;
@@ -350,103 +556,117 @@ namespace GroundHeatExchangers {
 			fraction = 0.5;
 		}
 
-		// Calculate the corresponding time of each temperature response factor
-		for ( NT = 1; NT <= NPairs; ++NT ) {
-			tLg = tLg_min + tLg_grid * ( NT - 1 );
-			t = std::pow( 10, tLg ) * ts;
+		// G-functions found before for the same geometry
+		for ( auto const & cached : slinkyGFunctionCache ) {
+			if ( cached.verticalConfig == verticalConfig && cached.numTrenches == numTrenches && cached.numCoils == numCoils && cached.coilDiameter == coilDiameter && cached.coilPitch == coilPitch && cached.coilDepth == coilDepth && cached.trenchSpacing == trenchSpacing && cached.pipeOutDia == pipeOutDia && cached.diffusivityGround == diffusivityGround && cached.NPairs == NPairs ) {
+				GFNC = cached.GFNC;
+				return;
+			}
+		}
 
-			// Set the average temperature resonse of the whole field to zero
-			gFunc = 0;
-
-			valStored = -1.0;
-
-			for ( m1 = 1; m1 <= numRC; ++m1 ) {
-				for ( n1 = 1; n1 <= numLC; ++n1 ) {
-					for ( m = 1; m <= numTrenches; ++m ) {
-						for ( n = 1; n <= numCoils; ++n ) {
-
-							// Zero out val after each iteration
-							doubleIntegralVal = 0.0;
-							midFieldVal = 0.0;
-
-							// Calculate the distance between ring centers
-							disRing = distToCenter( m, n, m1, n1 );
-
-							// Save mm1 and nn1
-							mm1 = std::abs( m - m1 );
-							nn1 = std::abs( n - n1 );
-
-							// If we're calculating a ring's temperature response to itself as a ring source,
-							// then we nee some extra effort in calculating the double integral
-							if ( m1 == m && n1 == n) {
-								I0 = 33;
-								J0 = 1089;
-							} else {
-								I0 = 33;
-								J0 = 561;
-							}
-
-							// if the ring(n1, m1) is the near-field ring of the ring(n,m)
-							if ( disRing <= 2.5 + coilDiameter ) {
-								// if no calculated value has been stored
-								if ( valStored( mm1, nn1 ) < 0 ) {
-									doubleIntegralVal = doubleIntegral( m, n, m1, n1, t, I0, J0 );
-									valStored( mm1, nn1 ) = doubleIntegralVal;
-								// else: if a stored value is found for the combination of (m, n, m1, n1)
-								} else {
-									doubleIntegralVal = valStored( mm1, nn1 );
-								}
-
-								// due to symmetry, the temperature response of ring(n1, m1) should be 0.25, 0.5, or 1 times its calculated value
-								if ( ! isEven( numTrenches ) && ! isEven( numCoils ) && m1 == numRC && n1 == numLC && numTrenches > 1.5 ) {
-									gFuncin = 0.25 * doubleIntegralVal;
-								} else if ( ! isEven( numTrenches ) && m1 == numRC && numTrenches > 1.5 ) {
-									gFuncin = 0.5 * doubleIntegralVal;
-								} else if ( ! isEven( numCoils ) && n1 == numLC ) {
-									gFuncin = 0.5  * doubleIntegralVal;
-								} else {
-									gFuncin = doubleIntegralVal;
-								}
-
-							// if the ring(n1, m1) is in the far-field or the ring(n,m)
-							} else if ( disRing > (10 + coilDiameter ) ) {
-								gFuncin = 0;
-
-							// else the ring(n1, m1) is in the middle-field of the ring(n,m)
-							} else {
-								// if no calculated value have been stored
-								if ( valStored( mm1, nn1 ) < 0.0 ) {
-									midFieldVal = midFieldResponseFunction( m, n, m1, n1, t );
-									valStored( mm1, nn1 ) = midFieldVal;
-								// if a stored value is found for the comination of (m, n, m1, n1), then
-								} else {
-									midFieldVal = valStored( mm1, nn1 );
-								}
-
-								// due to symmetry, the temperature response of ring(n1, m1) should be 0.25, 0.5, or 1 times its calculated value
-								if ( ! isEven( numTrenches ) && ! isEven( numCoils ) && m1 == numRC && n1 == numLC && numTrenches > 1.5 ) {
-									gFuncin = 0.25 * midFieldVal;
-								} else if ( ! isEven( numTrenches ) && m1 == numRC && numTrenches > 1.5 ) {
-									gFuncin = 0.5 * midFieldVal;
-								} else if ( ! isEven( numCoils ) && n1 == numLC ) {
-									gFuncin = 0.5  * midFieldVal;
-								} else {
-									gFuncin = midFieldVal;
-								}
-
-							}
-
-							gFunc += gFuncin;
-
-						} // n
-					} // m
-				} // n1
-			} // m1
+		// Number of ring pairs of each offset in the near and the middle field, weighted by the symmetry
+		// factor of the receiving ring; the far-field rings give no response.  Each pair is placed by
+		// its own distance, as the rings at the edge of a field may fall on either side of it.
+		Array2D< Real64 > nearFieldPairs( {0, numTrenches - 1}, {0, numCoils - 1}, 0.0 );
+		Array2D< Real64 > midFieldPairs( {0, numTrenches - 1}, {0, numCoils - 1}, 0.0 );
+		for ( int m1 = 1; m1 <= numRC; ++m1 ) {
+			bool const middleTrench( ! isEven( numTrenches ) && m1 == numRC && numTrenches > 1.5 );
+			for ( int n1 = 1; n1 <= numLC; ++n1 ) {
+				bool const middleCoil( ! isEven( numCoils ) && n1 == numLC );
+				Real64 const factor( ( middleTrench ? 0.5 : 1.0 ) * ( middleCoil ? 0.5 : 1.0 ) );
+				for ( int m = 1; m <= numTrenches; ++m ) {
+					for ( int n = 1; n <= numCoils; ++n ) {
+						Real64 const disRing( distToCenter( m, n, m1, n1 ) );
+						if ( disRing <= 2.5 + coilDiameter ) {
+							nearFieldPairs( std::abs( m - m1 ), std::abs( n - n1 ) ) += factor;
+						} else if ( disRing <= ( 10 + coilDiameter ) ) {
+							midFieldPairs( std::abs( m - m1 ), std::abs( n - n1 ) ) += factor;
+						}
+					}
+				}
+			}
+		}
+
+		// Offsets with a response, by the double integral in the near field
+		std::vector< int > offsetTrench;
+		std::vector< int > offsetCoil;
+		std::vector< bool > offsetNearField;
+		std::vector< Real64 > offsetPairs;
+		for ( int mm1 = 0; mm1 < numTrenches; ++mm1 ) {
+			for ( int nn1 = 0; nn1 < numCoils; ++nn1 ) {
+				if ( nearFieldPairs( mm1, nn1 ) > 0.0 ) {
+					offsetTrench.push_back( mm1 );
+					offsetCoil.push_back( nn1 );
+					offsetNearField.push_back( true );
+					offsetPairs.push_back( nearFieldPairs( mm1, nn1 ) );
+				}
+				if ( midFieldPairs( mm1, nn1 ) > 0.0 ) {
+					offsetTrench.push_back( mm1 );
+					offsetCoil.push_back( nn1 );
+					offsetNearField.push_back( false );
+					offsetPairs.push_back( midFieldPairs( mm1, nn1 ) );
+				}
+			}
+		}
+
+		// The response of a ring to itself is the first offset.  It is found first, and with the adaptive
+		// quadrature the responses of the other rings are found to a tolerance relative to it, as they
+		// add to it: those crossing the ring have narrow peaks at early times, but are small there.
+		int const numOffsets( offsetPairs.size() );
+		int const numResponses( numOffsets * NPairs );
+		std::vector< Real64 > responses( numResponses );
+		std::vector< Real64 > tolerances( NPairs, 0.0 );
+		for ( int pass = 1; pass <= 2; ++pass ) {
+			int const firstResponse( pass == 1 ? 0 : NPairs );
+			int const lastResponse( pass == 1 ? NPairs : numResponses );
+#ifdef HBIRE_USE_OMP
+			int const nThreads( ParallelLoopThreads( NumberGLHEThreads, lastResponse - firstResponse ) );
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads) if(nThreads > 1)
+#endif
+			for ( int response = firstResponse; response < lastResponse; ++response ) {
+				int const offsetNum( response / NPairs );
+				int const NT( response % NPairs + 1 );
+				Real64 const t( std::pow( 10, LNTTS( NT ) ) * ts );
+				int const m( 1 + offsetTrench[ offsetNum ] );
+				int const n( 1 + offsetCoil[ offsetNum ] );
+				if ( offsetNearField[ offsetNum ] ) {
+					// A ring's response to itself as a ring source needs a finer integration
+					int const I0( 33 );
+					int const J0( ( m == 1 && n == 1 ) ? 1089 : 561 );
+					responses[ response ] = doubleIntegral( m, n, 1, 1, t, I0, J0, tolerances[ NT - 1 ] );
+				} else {
+					responses[ response ] = midFieldResponseFunction( m, n, 1, 1, t );
+				}
+			}
+			if ( pass == 1 ) {
+				for ( int NT = 1; NT <= NPairs; ++NT ) {
+					tolerances[ NT - 1 ] = fieldTolerance * std::abs( responses[ NT - 1 ] );
+				}
+			}
+		}
 
+		for ( int NT = 1; NT <= NPairs; ++NT ) {
+			// Set the average temperature resonse of the whole field to zero
+			Real64 gFunc( 0.0 );
+			for ( int offsetNum = 0; offsetNum < numOffsets; ++offsetNum ) {
+				gFunc += offsetPairs[ offsetNum ] * responses[ offsetNum * NPairs + NT - 1 ];
+			}
 			GFNC( NT ) = ( gFunc * ( coilDiameter / 2.0 ) ) / ( 4 * Pi	* fraction * numTrenches * numCoils );
-			LNTTS( NT ) = tLg;
+		}
 
-		} // NT time
+		SlinkyGFunctionCacheData geometry;
+		geometry.verticalConfig = verticalConfig;
+		geometry.numTrenches = numTrenches;
+		geometry.numCoils = numCoils;
+		geometry.coilDiameter = coilDiameter;
+		geometry.coilPitch = coilPitch;
+		geometry.coilDepth = coilDepth;
+		geometry.trenchSpacing = trenchSpacing;
+		geometry.pipeOutDia = pipeOutDia;
+		geometry.diffusivityGround = diffusivityGround;
+		geometry.NPairs = NPairs;
+		geometry.GFNC = GFNC;
+		slinkyGFunctionCache.push_back( geometry );
 	}
 	//******************************************************************************
 
@@ -706,7 +926,8 @@ namespace GroundHeatExchangers {
 		int const n1,
 		Real64 const t,
 		Real64 const eta,
-		Real64 const J0
+		Real64 const J0,
+		Real64 const tolerance // Absolute tolerance of the adaptive quadrature
 	)
 	{
 		// SUBROUTINE INFORMATION:
@@ -720,7 +941,14 @@ namespace GroundHeatExchangers {
 		// input from other points
 
 		// METHODOLOGY EMPLOYED:
-		// Simpson's 1/3 rule of integration
+		// Simpson's 1/3 rule of integration, or adaptive Simpson quadrature starting at eta, where
+		// the response of a ring to itself peaks
+
+		// Using/Aliasing
+		using DataSystemVariables::SlinkyAdaptiveQuadrature;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const relTolerance( 1.0e-6 ); // Tolerance of the adaptive quadrature
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 sumIntF( 0.0 );
@@ -729,6 +957,13 @@ namespace GroundHeatExchangers {
 		Real64 theta2( 2 * Pi );
 		Real64 h;
 		int j;
+
+		if ( SlinkyAdaptiveQuadrature ) {
+			return integrateAdaptiveSimpson( [&]( Real64 const theta ) {
+				return nearFieldResponseFunction( m, n, m1, n1, eta, theta, t );
+			}, eta, eta + 2 * Pi, relTolerance, tolerance );
+		}
+
 		Array1D< Real64 > f( J0, 0.0 );
 
 		h = ( theta2 - theta1 ) / ( J0 - 1 );
@@ -763,7 +998,8 @@ namespace GroundHeatExchangers {
 		int const n1,
 		Real64 const t,
 		int const I0,
-		int const J0
+		int const J0,
+		Real64 const tolerance // Absolute tolerance of the adaptive quadrature
 	)
 	{
 		// SUBROUTINE INFORMATION:
@@ -777,7 +1013,13 @@ namespace GroundHeatExchangers {
 		// input from other points
 
 		// METHODOLOGY EMPLOYED:
-		// Simpson's 1/3 rule of integration
+		// Simpson's 1/3 rule of integration, or adaptive Simpson quadrature
+
+		// Using/Aliasing
+		using DataSystemVariables::SlinkyAdaptiveQuadrature;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const relTolerance( 1.0e-5 ); // Tolerance of the adaptive quadrature
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 sumIntF( 0.0 );
@@ -786,6 +1028,13 @@ namespace GroundHeatExchangers {
 		Real64 eta2( 2 * Pi );
 		Real64 h;
 		int i;
+
+		if ( SlinkyAdaptiveQuadrature ) {
+			return integrateAdaptiveSimpson( [&]( Real64 const eta ) {
+				return integral( m, n, m1, n1, t, eta, J0, tolerance / ( 2 * Pi ) );
+			}, eta1, eta2, relTolerance, tolerance );
+		}
+
 		Array1D< Real64 > g( I0, 0.0 );
 
 		h = ( eta2 - eta1 ) / ( I0 - 1 );
@@ -794,7 +1043,7 @@ namespace GroundHeatExchangers {
 		for ( i = 1; i <= I0; ++i ) {
 
 			eta = eta1 + ( i - 1 ) * h;
-			g( i ) = integral( m, n, m1, n1, t, eta, J0 );
+			g( i ) = integral( m, n, m1, n1, t, eta, J0, tolerance );
 
 			if ( i == 1 || i == I0 ) {
 				g( i ) = g( i );
@@ -812,6 +1061,84 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	Real64
+	integrateAdaptiveSimpson(
+		std::function< Real64( Real64 const ) > const & f, // Function to integrate
+		Real64 const a, // Lower limit
+		Real64 const b, // Upper limit
+		Real64 const relTolerance, // Tolerance relative to the magnitude of the integral
+		Real64 const absTolerance // Absolute tolerance, used when larger
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Integrates a function from a to b, to a tolerance relative to the magnitude of the integral
+		// or to an absolute tolerance, whichever is larger.
+
+		// METHODOLOGY EMPLOYED:
+		// Adaptive Simpson quadrature (Lyness), starting from a few panels so that a narrow peak away
+		// from the limits is sampled; the tolerance is shared among the panels by their width.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const numPanels( 16 ); // Starting panels
+		int const maxDepth( 12 ); // Levels of subdivision of a panel
+
+		Real64 const width( ( b - a ) / numPanels );
+		Array1D< Real64 > fPoints( 2 * numPanels + 1 ); // Function at the panel limits and middles
+		for ( int i = 1; i <= 2 * numPanels + 1; ++i ) {
+			fPoints( i ) = f( a + 0.5 * width * ( i - 1 ) );
+		}
+		Real64 magnitude( 0.0 );
+		for ( int panel = 1; panel <= numPanels; ++panel ) {
+			magnitude += width / 6.0 * ( std::abs( fPoints( 2 * panel - 1 ) ) + 4.0 * std::abs( fPoints( 2 * panel ) ) + std::abs( fPoints( 2 * panel + 1 ) ) );
+		}
+		Real64 const tolerance( max( relTolerance * magnitude, absTolerance ) / numPanels );
+
+		Real64 result( 0.0 );
+		for ( int panel = 1; panel <= numPanels; ++panel ) {
+			Real64 const panelA( a + width * ( panel - 1 ) );
+			Real64 const fa( fPoints( 2 * panel - 1 ) );
+			Real64 const fMid( fPoints( 2 * panel ) );
+			Real64 const fb( fPoints( 2 * panel + 1 ) );
+			result += adaptiveSimpsonPanel( f, panelA, panelA + width, fa, fMid, fb, width / 6.0 * ( fa + 4.0 * fMid + fb ), tolerance, maxDepth );
+		}
+		return result;
+
+	}
+
+	//******************************************************************************
+
+	Real64
+	adaptiveSimpsonPanel(
+		std::function< Real64( Real64 const ) > const & f, // Function to integrate
+		Real64 const a, // Panel limits
+		Real64 const b,
+		Real64 const fa, // Function at the limits and the middle of the panel
+		Real64 const fMid,
+		Real64 const fb,
+		Real64 const whole, // Simpson estimate over the panel
+		Real64 const tolerance, // Absolute tolerance of the panel
+		int const depth // Remaining levels of subdivision
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Simpson estimate of the integral over a panel, halving the panel until the estimates over
+		// the halves agree with that over the panel, with Richardson extrapolation.
+
+		Real64 const mid( 0.5 * ( a + b ) );
+		Real64 const fLeft( f( 0.5 * ( a + mid ) ) );
+		Real64 const fRight( f( 0.5 * ( mid + b ) ) );
+		Real64 const left( ( mid - a ) / 6.0 * ( fa + 4.0 * fLeft + fMid ) );
+		Real64 const right( ( b - mid ) / 6.0 * ( fMid + 4.0 * fRight + fb ) );
+		Real64 const diff( left + right - whole );
+		if ( depth <= 0 || std::abs( diff ) <= 15.0 * tolerance ) return left + right + diff / 15.0;
+		return adaptiveSimpsonPanel( f, a, mid, fa, fLeft, fMid, left, 0.5 * tolerance, depth - 1 ) + adaptiveSimpsonPanel( f, mid, b, fMid, fRight, fb, right, 0.5 * tolerance, depth - 1 );
+
+	}
+
+	//******************************************************************************
+
 	void
 	GLHEVert::getAnnualTimeConstant()
 	{
@@ -870,6 +1197,9 @@ namespace GroundHeatExchangers {
 		// The heat pulse histories need to be recorded over an extended period (months).
 		// To aid computational efficiency past pulses are continuously agregated into
 		// equivalent heat pulses of longer duration, as each pulse becomes less recent.
+		// With the multilevel load aggregation the pulses older than the hourly history
+		// are kept in bins of fixed number, so the work of a time step does not grow with
+		// the simulated time.
 
 		// REFERENCES:
 		// Eskilson, P. 'Thermal Analysis of Heat Extraction Boreholes' Ph.D. Thesis:
@@ -879,6 +1209,7 @@ namespace GroundHeatExchangers {
 
 		// Using/Aliasing
 		using DataPlant::PlantLoop;
+		using DataSystemVariables::GLHEMultilevelLoadAggregation;
 		using FluidProperties::GetSpecificHeatGlycol;
 		using FluidProperties::GetDensityGlycol;
 		using General::TrimSigDigits;
@@ -917,12 +1248,11 @@ namespace GroundHeatExchangers {
 		int IndexN; // Used to index the LastHourN array
 		static bool updateCurSimTime( true ); // Used to reset the CurSimTime to reset after WarmupFlag
 		static bool triggerDesignDayReset( false );
-		static bool firstTime( true );
 
 		// Calculate G-Functions
-		if ( firstTime ) {
+		if ( ! gFunctionsCalculated ) {
 			calcGFunctions();
-			firstTime = false;
+			gFunctionsCalculated = true;
 		}
 
 		inletTemp = Node( inletNodeNum ).Temp;
@@ -941,6 +1271,7 @@ namespace GroundHeatExchangers {
 			prevTimeSteps = 0.0;
 			QnHr = 0.0;
 			QnMonthlyAgg = 0.0;
+			QnAggLevel = 0.0;
 			QnSubHr = 0.0;
 			LastHourN = 1;
 			N = 1;
@@ -998,7 +1329,7 @@ namespace GroundHeatExchangers {
 			}
 		} else {
 			// no monthly super position
-			if ( currentSimTime < ( hrsPerMonth + AGG + SubAGG ) ) {
+			if ( GLHEMultilevelLoadAggregation || currentSimTime < ( hrsPerMonth + AGG + SubAGG ) ) {
 
 				// Calculate the Sub Hourly Superposition
 
@@ -1033,16 +1364,20 @@ namespace GroundHeatExchangers {
 
 				hourlyLimit = int( currentSimTime );
 				sumQnHourly = 0.0;
-				for ( I = SubAGG + 1; I <= hourlyLimit; ++I ) {
-					if ( I == hourlyLimit ) {
-						gFuncVal = getGFunc( currentSimTime / ( timeSSFactor ) );
+				if ( GLHEMultilevelLoadAggregation ) {
+					sumQnHourly = calcMultilevelLoadResponse();
+				} else {
+					for ( I = SubAGG + 1; I <= hourlyLimit; ++I ) {
+						if ( I == hourlyLimit ) {
+							gFuncVal = getGFunc( currentSimTime / ( timeSSFactor ) );
+							RQHour = gFuncVal / ( kGroundFactor );
+							sumQnHourly += QnHr( I ) * RQHour;
+							break;
+						}
+						gFuncVal = getGFunc( ( currentSimTime - int( currentSimTime ) + I ) / ( timeSSFactor ) );
 						RQHour = gFuncVal / ( kGroundFactor );
-						sumQnHourly += QnHr( I ) * RQHour;
-						break;
+						sumQnHourly += ( QnHr( I ) - QnHr( I + 1 ) ) * RQHour;
 					}
-					gFuncVal = getGFunc( ( currentSimTime - int( currentSimTime ) + I ) / ( timeSSFactor ) );
-					RQHour = gFuncVal / ( kGroundFactor );
-					sumQnHourly += ( QnHr( I ) - QnHr( I + 1 ) ) * RQHour;
 				}
 
 				// Find the total Sum of the Temperature difference due to all load blocks
@@ -1221,7 +1556,8 @@ namespace GroundHeatExchangers {
 		// The heat pulse histories need to be recorded over an extended period (months).
 		// To aid computational efficiency past pulses are continuously agregated into
 		// equivalent heat pulses of longer duration, as each pulse becomes less recent.
-		// Past sub-hourly loads are re-aggregated into equivalent hourly and monthly loads.
+		// Past sub-hourly loads are re-aggregated into equivalent hourly and monthly loads,
+		// or with the multilevel load aggregation into hourly loads and the aggregation bins.
 
 		// REFERENCES:
 		// Eskilson, P. 'Thermal Analysis of Heat Extraction Boreholes' Ph.D. Thesis:
@@ -1229,8 +1565,8 @@ namespace GroundHeatExchangers {
 		// Yavuzturk, C., J.D. Spitler. 1999. 'A Short Time Step Response Factor Model
 		//   for Vertical Ground Loop Heat Exchangers. ASHRAE Transactions. 105(2): 475-485.
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using DataSystemVariables::GLHEMultilevelLoadAggregation;
 
 		// Locals
 		//LOCAL VARIABLES
@@ -1252,12 +1588,13 @@ namespace GroundHeatExchangers {
 				SumQnHr += QnSubHr( J ) * std::abs( prevTimeSteps( J ) - prevTimeSteps( J + 1 ) );
 			}
 			SumQnHr /= std::abs( prevTimeSteps( 1 ) - prevTimeSteps( J ) );
+			if ( GLHEMultilevelLoadAggregation ) aggregateLoadLevels( QnHr( SubAGG + AGG ) );
 			QnHr = eoshift( QnHr, -1, SumQnHr );
 			LastHourN = eoshift( LastHourN, -1, N );
 		}
 
 		//CHECK IF A MONTH PASSES...
-		if ( mod( ( ( locDayOfSim - 1 ) * hrsPerDay + ( locHourOfDay ) ), hrsPerMonth ) == 0 && prevHour != locHourOfDay ) {
+		if ( ! GLHEMultilevelLoadAggregation && mod( ( ( locDayOfSim - 1 ) * hrsPerDay + ( locHourOfDay ) ), hrsPerMonth ) == 0 && prevHour != locHourOfDay ) {
 			MonthNum = ( locDayOfSim * hrsPerDay + locHourOfDay ) / hrsPerMonth;
 			SumQnMonth = 0.0;
 			for ( J = 1; J <= int( hrsPerMonth ); ++J ) {
@@ -1273,6 +1610,88 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	void
+	GLHEBase::aggregateLoadLevels(
+		Real64 const hourlyQn // Normalized load of the hour leaving the hourly history [W/m]
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves the multilevel aggregated loads on by an hour.
+
+		// METHODOLOGY EMPLOYED:
+		// The bins of level L are 2**L hours wide.  Each hour, the load of a bin moves towards
+		// the next older bin by the fraction of the bin width that has passed, the first bin of
+		// a level taking from the last bin of the level before it, and the load leaving the
+		// hourly history entering the first level.  The loads are moved from the oldest bin so
+		// that each bin takes the load of its neighbour before that is moved.
+
+		// REFERENCES:
+		// Claesson, J., S. Javed. 2012. 'A Load-Aggregation Method to Calculate Extraction
+		//   Temperatures of Borehole Heat Exchangers.' ASHRAE Transactions. 118(1): 530-539.
+
+		for ( int level = numAggLevels; level >= 1; --level ) {
+			Real64 const binWidth( std::pow( 2.0, level ) );
+			for ( int bin = numAggBins; bin >= 1; --bin ) {
+				Real64 newerQn;
+				if ( bin > 1 ) {
+					newerQn = QnAggLevel( bin - 1, level );
+				} else if ( level > 1 ) {
+					newerQn = QnAggLevel( numAggBins, level - 1 );
+				} else {
+					newerQn = hourlyQn;
+				}
+				QnAggLevel( bin, level ) += ( newerQn - QnAggLevel( bin, level ) ) / binWidth;
+			}
+		}
+	}
+
+	//******************************************************************************
+
+	Real64
+	GLHEBase::calcMultilevelLoadResponse()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Superposes the responses to the hourly loads older than the subhourly history and
+		// to the multilevel aggregated loads, as the hourly superposition does.
+
+		// METHODOLOGY EMPLOYED:
+		// Each load steps up from the next older one at the start of its hour or bin.  Loads
+		// equal to the next older one, as the empty bins beyond the start of the simulation,
+		// add nothing and their g-functions are not found.
+
+		Real64 const kGroundFactor( 2.0 * Pi * kGround );
+		Real64 const hourFraction( currentSimTime - int( currentSimTime ) );
+		Real64 sumQn( 0.0 );
+
+		for ( int I = SubAGG + 1; I <= SubAGG + AGG; ++I ) {
+			Real64 const olderQn( I < SubAGG + AGG ? QnHr( I + 1 ) : QnAggLevel( 1, 1 ) );
+			if ( QnHr( I ) == olderQn ) continue;
+			sumQn += ( QnHr( I ) - olderQn ) * getGFunc( ( hourFraction + I ) / timeSSFactor ) / kGroundFactor;
+		}
+
+		Real64 binStart( hourFraction + SubAGG + AGG ); // Hours before the current time
+		for ( int level = 1; level <= numAggLevels; ++level ) {
+			Real64 const binWidth( std::pow( 2.0, level ) );
+			for ( int bin = 1; bin <= numAggBins; ++bin ) {
+				binStart += binWidth;
+				Real64 olderQn( 0.0 );
+				if ( bin < numAggBins ) {
+					olderQn = QnAggLevel( bin + 1, level );
+				} else if ( level < numAggLevels ) {
+					olderQn = QnAggLevel( 1, level + 1 );
+				}
+				if ( QnAggLevel( bin, level ) == olderQn ) continue;
+				sumQn += ( QnAggLevel( bin, level ) - olderQn ) * getGFunc( binStart / timeSSFactor ) / kGroundFactor;
+			}
+		}
+
+		return sumQn;
+	}
+
+	//******************************************************************************
+
 	void
 	GetGroundHeatExchangerInput()
 	{
@@ -1449,6 +1868,7 @@ namespace GroundHeatExchangers {
 				verticalGLHE( GLHENum ).QnHr.dimension( 730 + verticalGLHE( GLHENum ).AGG + verticalGLHE( GLHENum ).SubAGG, 0.0 );
 				verticalGLHE( GLHENum ).QnSubHr.dimension( ( verticalGLHE( GLHENum ).SubAGG + 1 ) * maxTSinHr + 1, 0.0 );
 				verticalGLHE( GLHENum ).LastHourN.dimension( verticalGLHE( GLHENum ).SubAGG + 1, 0 );
+				verticalGLHE( GLHENum ).QnAggLevel.dimension( numAggBins, numAggLevels, 0.0 );
 
 				if ( ! allocated ) {
 					prevTimeSteps.allocate( ( verticalGLHE( GLHENum ).SubAGG + 1 ) * maxTSinHr + 1 );
@@ -1468,6 +1888,56 @@ namespace GroundHeatExchangers {
 				}
 			}
 
+			// Borehole arrays whose g-functions are calculated
+			cCurrentModuleObject = "GroundHeatExchanger:Vertical:Array";
+			int const numArrays( GetNumObjectsFound( cCurrentModuleObject ) );
+			for ( int arrayNum = 1; arrayNum <= numArrays; ++arrayNum ) {
+				GetObjectItem( cCurrentModuleObject, arrayNum, cAlphaArgs, numAlphas, rNumericArgs, numNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+				GLHENum = 0;
+				for ( int i = 1; i <= numVerticalGLHEs; ++i ) {
+					if ( SameString( verticalGLHE( i ).Name, cAlphaArgs( 1 ) ) ) GLHENum = i;
+				}
+				if ( GLHENum == 0 ) {
+					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid " + cAlphaFieldNames( 1 ) + '.' );
+					ShowContinueError( "...GroundHeatExchanger:Vertical not found." );
+					errorsFound = true;
+					continue;
+				}
+				auto & thisGLHE( verticalGLHE( GLHENum ) );
+				if ( thisGLHE.gFunctionsFromArray ) {
+					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", the ground heat exchanger has more than one array." );
+					errorsFound = true;
+				}
+				thisGLHE.gFunctionsFromArray = true;
+				thisGLHE.numBoreholesX = rNumericArgs( 1 );
+				thisGLHE.numBoreholesY = rNumericArgs( 2 );
+				thisGLHE.boreholeSpacing = rNumericArgs( 3 );
+				thisGLHE.boreholeTopDepth = rNumericArgs( 4 );
+				if ( thisGLHE.numBoreholesX * thisGLHE.numBoreholesY != thisGLHE.numBoreholes ) {
+					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid value in field." );
+					ShowContinueError( "..." + cNumericFieldNames( 1 ) + " times " + cNumericFieldNames( 2 ) + "=[" + TrimSigDigits( thisGLHE.numBoreholesX * thisGLHE.numBoreholesY ) + "] is not the Number of Bore Holes=[" + TrimSigDigits( thisGLHE.numBoreholes ) + "] of the GroundHeatExchanger:Vertical." );
+					errorsFound = true;
+				}
+				if ( thisGLHE.boreholeSpacing <= 2.0 * thisGLHE.boreholeRadius ) {
+					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid value in field." );
+					ShowContinueError( "..." + cNumericFieldNames( 3 ) + "=[" + RoundSigDigits( thisGLHE.boreholeSpacing, 3 ) + "] must be larger than the bore hole diameter." );
+					errorsFound = true;
+				}
+			}
+			for ( GLHENum = 1; GLHENum <= numVerticalGLHEs; ++GLHENum ) {
+				if ( ! verticalGLHE( GLHENum ).gFunctionsFromArray && verticalGLHE( GLHENum ).NPairs <= 0 ) {
+					ShowSevereError( "GroundHeatExchanger:Vertical=\"" + verticalGLHE( GLHENum ).Name + "\", no g-function data pairs are given." );
+					ShowContinueError( "...Enter the g-function data pairs or give the boreholes in a " + cCurrentModuleObject + '.' );
+					errorsFound = true;
+				}
+			}
+			if ( errorsFound ) {
+				ShowFatalError( "Errors found in processing input for " + cCurrentModuleObject );
+			}
+			for ( GLHENum = 1; GLHENum <= numVerticalGLHEs; ++GLHENum ) {
+				verticalGLHE( GLHENum ).calcGFunctions();
+			}
+
 			//Set up report variables
 			for ( GLHENum = 1; GLHENum <= numVerticalGLHEs; ++GLHENum ) {
 				SetupOutputVariable( "Ground Heat Exchanger Average Borehole Temperature [C]", verticalGLHE( GLHENum ).boreholeTemp, "System", "Average", verticalGLHE( GLHENum ).Name );
@@ -2127,6 +2597,7 @@ namespace GroundHeatExchangers {
 
 			QnHr = 0.0;
 			QnMonthlyAgg = 0.0;
+			QnAggLevel = 0.0;
 			QnSubHr = 0.0;
 			LastHourN = 0;
 			prevTimeSteps = 0.0;
@@ -2215,6 +2686,7 @@ namespace GroundHeatExchangers {
 
 			QnHr = 0.0;
 			QnMonthlyAgg = 0.0;
+			QnAggLevel = 0.0;
 			QnSubHr = 0.0;
 			LastHourN = 0;
 			prevTimeSteps = 0.0;
@@ -1,8 +1,13 @@
 #ifndef GroundHeatExchangers_hh_INCLUDED
 #define GroundHeatExchangers_hh_INCLUDED
 
+// C++ Headers
+#include <functional>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -21,6 +26,10 @@ namespace GroundHeatExchangers {
 	extern Real64 const hrsPerDay; // Number of hours in a day
 	extern Real64 const hrsPerMonth; // Number of hours in month
 	extern int const maxTSinHr; // Max number of time step in a hour
+	extern Real64 const lnTTsMinArray; // First Ln(T/Ts) of the g-functions calculated for a borehole array
+	extern Real64 const lnTTsStepArray; // Ln(T/Ts) step of the g-functions calculated for a borehole array
+	extern int const numAggLevels; // Levels of the multilevel load aggregation
+	extern int const numAggBins; // Bins in each level of the multilevel load aggregation
 
 	// MODULE VARIABLE DECLARATIONS:
 	//na
@@ -63,6 +72,8 @@ namespace GroundHeatExchangers {
 		int SubAGG; // Minimum subhourly History
 		Array1D_int LastHourN; // Stores the Previous hour's N for past hours
 		// until the minimum subhourly history
+		Array2D< Real64 > QnAggLevel; // (Bin,Level) Multilevel aggregated normalized heat extraction/rejection rate
+		// of the loads older than the hourly history [W/m]
 		//loop topology variables
 		Real64 boreholeTemp; // [C]
 		Real64 massFlowRate; // [kg/s]
@@ -77,6 +88,7 @@ namespace GroundHeatExchangers {
 		Real64 totalTubeLength; // The total length of pipe. NumBoreholes * BoreholeDepth OR Pi * Dcoil * NumCoils
 		Real64 timeSS; // Steady state time
 		Real64 timeSSFactor; // Steady state time factor for calculation
+		bool gFunctionsCalculated; // True once calcGFunctions has been called
 
 		// Default Constructor
 		GLHEBase() :
@@ -114,7 +126,8 @@ namespace GroundHeatExchangers {
 			lastQnSubHr( 0.0 ),
 			HXResistance( 0.0 ),
 			timeSS( 0.0 ),
-			timeSSFactor( 0.0 )
+			timeSSFactor( 0.0 ),
+			gFunctionsCalculated( false )
 		{}
 
 		virtual void
@@ -123,6 +136,14 @@ namespace GroundHeatExchangers {
 		void
 		calcAggregateLoad();
 
+		void
+		aggregateLoadLevels(
+			Real64 const hourlyQn // Normalized load of the hour leaving the hourly history [W/m]
+		);
+
+		Real64
+		calcMultilevelLoadResponse();
+
 		void
 		updateGHX();
 
@@ -166,6 +187,11 @@ namespace GroundHeatExchangers {
 		Real64 kGrout; // Grout thermal conductivity                [W/(mK)]
 		Real64 UtubeDist; // Distance between the legs of the Utube    [m]
 		bool runFlag;
+		bool gFunctionsFromArray; // True if the g-functions are calculated from a GroundHeatExchanger:Vertical:Array
+		int numBoreholesX; // Boreholes of the array in each direction
+		int numBoreholesY;
+		Real64 boreholeSpacing; // Distance between neighbouring boreholes of the array [m]
+		Real64 boreholeTopDepth; // Depth of the top of the boreholes [m]
 
 		// Default Constructor
 		GLHEVert() :
@@ -176,7 +202,12 @@ namespace GroundHeatExchangers {
 			boreholeRadius( 0.0 ),
 			kGrout( 0.0 ),
 			UtubeDist( 0.0 ),
-			runFlag( false )
+			runFlag( false ),
+			gFunctionsFromArray( false ),
+			numBoreholesX( 0 ),
+			numBoreholesY( 0 ),
+			boreholeSpacing( 0.0 ),
+			boreholeTopDepth( 0.0 )
 		{}
 
 		void
@@ -266,7 +297,8 @@ namespace GroundHeatExchangers {
 			int const n1,
 			Real64 const t,
 			int const I0,
-			int const J0
+			int const J0,
+			Real64 const tolerance // Absolute tolerance of the adaptive quadrature
 		);
 
 		Real64
@@ -277,7 +309,8 @@ namespace GroundHeatExchangers {
 			int const n1,
 			Real64 const t,
 			Real64 const eta,
-			Real64 const J0
+			Real64 const J0,
+			Real64 const tolerance // Absolute tolerance of the adaptive quadrature
 		);
 
 		bool
@@ -340,9 +373,71 @@ namespace GroundHeatExchangers {
 
 	};
 
+	struct GFunctionCacheData
+	{
+		// G-functions calculated for a rectangular borehole field, kept for the other ground heat
+		// exchangers of the same dimensionless geometry.
+
+		// Members
+		int numBoreholesX; // Smaller number of boreholes in one direction
+		int numBoreholesY; // Larger number of boreholes in one direction
+		Real64 spacingRatio; // Borehole spacing / borehole length
+		Real64 radiusRatio; // Borehole radius / borehole length
+		Real64 depthRatio; // Borehole top depth / borehole length
+		int NPairs; // Number of pairs of Lntts and Gfunc
+		Array1D< Real64 > GFNC; // G-function at lnTTsMinArray + ( i - 1 ) * lnTTsStepArray
+
+		// Default Constructor
+		GFunctionCacheData() :
+			numBoreholesX( 0 ),
+			numBoreholesY( 0 ),
+			spacingRatio( 0.0 ),
+			radiusRatio( 0.0 ),
+			depthRatio( 0.0 ),
+			NPairs( 0 )
+		{}
+
+	};
+
+	struct SlinkyGFunctionCacheData
+	{
+		// G-functions calculated for a slinky ground heat exchanger, kept for the others of the same
+		// geometry.
+
+		// Members
+		bool verticalConfig;
+		int numTrenches;
+		int numCoils;
+		Real64 coilDiameter; // [m]
+		Real64 coilPitch; // [m]
+		Real64 coilDepth; // [m]
+		Real64 trenchSpacing; // [m]
+		Real64 pipeOutDia; // [m]
+		Real64 diffusivityGround; // [m2/s]
+		int NPairs; // Number of pairs of Lntts and Gfunc
+		Array1D< Real64 > GFNC; // G-function
+
+		// Default Constructor
+		SlinkyGFunctionCacheData() :
+			verticalConfig( false ),
+			numTrenches( 0 ),
+			numCoils( 0 ),
+			coilDiameter( 0.0 ),
+			coilPitch( 0.0 ),
+			coilDepth( 0.0 ),
+			trenchSpacing( 0.0 ),
+			pipeOutDia( 0.0 ),
+			diffusivityGround( 0.0 ),
+			NPairs( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< GLHEVert > verticalGLHE; // Vertical GLHEs
 	extern Array1D< GLHESlinky > slinkyGLHE; // Slinky GLHEs
+	extern std::vector< GFunctionCacheData > gFunctionCache; // G-functions calculated for borehole arrays
+	extern std::vector< SlinkyGFunctionCacheData > slinkyGFunctionCache; // G-functions calculated for slinky ground heat exchangers
 
 	void
 	SimGroundHeatExchangers(
@@ -357,6 +452,48 @@ namespace GroundHeatExchangers {
 	void
 	GetGroundHeatExchangerInput();
 
+	Real64
+	finiteLineSourceResponse(
+		Real64 const dist, // Distance between the borehole axes, the borehole radius for a borehole to itself [m]
+		Real64 const length, // Borehole length [m]
+		Real64 const topDepth, // Depth of the top of the boreholes [m]
+		Real64 const diffusivity, // Ground thermal diffusivity [m2/s]
+		Real64 const time // Time since the heat rate was applied [s]
+	);
+
+	void
+	calcBoreholeFieldGFunctions(
+		int const numBoreholesX, // Boreholes in each direction
+		int const numBoreholesY,
+		Real64 const spacingRatio, // Borehole spacing / borehole length
+		Real64 const radiusRatio, // Borehole radius / borehole length
+		Real64 const depthRatio, // Borehole top depth / borehole length
+		Array1< Real64 > const & LNTTS, // Ln(T/Ts) of the g-function values
+		Array1< Real64 > & GFNC // G-function values
+	);
+
+	Real64
+	integrateAdaptiveSimpson(
+		std::function< Real64( Real64 const ) > const & f, // Function to integrate
+		Real64 const a, // Lower limit
+		Real64 const b, // Upper limit
+		Real64 const relTolerance, // Tolerance relative to the magnitude of the integral
+		Real64 const absTolerance // Absolute tolerance, used when larger
+	);
+
+	Real64
+	adaptiveSimpsonPanel(
+		std::function< Real64( Real64 const ) > const & f, // Function to integrate
+		Real64 const a, // Panel limits
+		Real64 const b,
+		Real64 const fa, // Function at the limits and the middle of the panel
+		Real64 const fMid,
+		Real64 const fb,
+		Real64 const whole, // Simpson estimate over the panel
+		Real64 const tolerance, // Absolute tolerance of the panel
+		int const depth // Remaining levels of subdivision
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -145,6 +145,9 @@ namespace HVACControllers {
 	Real64 const SomeFloatingPoint( 1.0 );
 	int const NumSigDigits( precision( SomeFloatingPoint ) );
 
+	// Fraction of the actuated range stepped from a warm started first iterate towards the root
+	Real64 const WarmStartStepFrac( 0.1 );
+
 	static std::string const BlankString;
 
 	// Parameters for controls used here
@@ -1349,7 +1352,9 @@ namespace HVACControllers {
 		// This subroutine needs a description.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// With ControllerWarmStart set, the first iterate is where the controller ended at the previous
+		// HVAC step: the max actuated value if it was max-constrained, so that the constraint is
+		// detected in 1 iteration as for the min actuated value, or the previous root if it was active.
 
 		// REFERENCES:
 		// na
@@ -1358,6 +1363,7 @@ namespace HVACControllers {
 		using General::TrimSigDigits;
 		using RootFinder::InitializeRootFinder;
 		using RootFinder::CheckRootFinderCandidate;
+		using DataSystemVariables::ControllerWarmStart;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1379,6 +1385,7 @@ namespace HVACControllers {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ActuatedNode;
 		int SensedNode;
+		int PreviousSolutionIndex;
 
 		// Increment counter
 		++ControllerProps( ControlNum ).NumCalcCalls;
@@ -1422,6 +1429,18 @@ namespace HVACControllers {
 					// Always start with min point by default for the other control strategies
 					ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).MinPoint.X;
 
+					if ( ControllerWarmStart ) {
+						PreviousSolutionIndex = ( FirstHVACIteration ? 1 : 2 );
+						auto const & Previous( ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ) );
+						if ( Previous.DefinedFlag && Previous.Mode == iModeMaxActive ) {
+							ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).MaxPoint.X;
+						} else if ( Previous.DefinedFlag && Previous.Mode == iModeActive && CheckRootFinderCandidate( RootFinders( ControlNum ), Previous.ActuatedValue ) ) {
+							ControllerProps( ControlNum ).NextActuatedValue = Previous.ActuatedValue;
+							// The previous solution is the first iterate, not a later candidate
+							ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+						}
+					}
+
 				} else if ( SELECT_CASE_var == iTemperatureAndHumidityRatio ) {
 					if ( ! ControllerProps( ControlNum ).IsSetPointDefinedFlag ) {
 						// Always start with max point if setpoint not yet computed. See routine InitController().
@@ -1513,6 +1532,7 @@ namespace HVACControllers {
 		using General::TrimSigDigits;
 		using RootFinder::IterateRootFinder;
 		using RootFinder::CheckRootFinderCandidate;
+		using DataSystemVariables::ControllerWarmStart;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1579,6 +1599,20 @@ namespace HVACControllers {
 
 				// Turn off flag since we can only use the previous solution once per HVAC iteration
 				ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+			} else if ( ControllerWarmStart && RootFinders( ControlNum ).CurrentMethodType == iMethodBracket && RootFinders( ControlNum ).NumHistory == 1 && ! RootFinders( ControlNum ).MinPoint.DefinedFlag && ! RootFinders( ControlNum ).MaxPoint.DefinedFlag && ( RootFinders( ControlNum ).LowerPoint.DefinedFlag != RootFinders( ControlNum ).UpperPoint.DefinedFlag ) ) {
+				// The warm started first iterate gives one side of the root: step from it towards the root
+				// instead of trying the min or max actuated value, so that the secant bracketing of the
+				// root finder starts from 2 nearby points
+				auto const & Root( RootFinders( ControlNum ) );
+				Real64 const Step( WarmStartStepFrac * ( Root.MaxPoint.X - Root.MinPoint.X ) );
+				if ( Root.LowerPoint.DefinedFlag ) {
+					ControllerProps( ControlNum ).NextActuatedValue = min( Root.LowerPoint.X + Step, Root.MaxPoint.X );
+				} else {
+					ControllerProps( ControlNum ).NextActuatedValue = max( Root.UpperPoint.X - Step, Root.MinPoint.X );
+				}
+				if ( ! CheckRootFinderCandidate( Root, ControllerProps( ControlNum ).NextActuatedValue ) ) {
+					ControllerProps( ControlNum ).NextActuatedValue = Root.XCandidate;
+				}
 			} else {
 				// By default, use candidate value computed by root finder
 				ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
@@ -31,6 +31,9 @@ namespace HVACControllers {
 	extern Real64 const SomeFloatingPoint;
 	extern int const NumSigDigits;
 
+	// Fraction of the actuated range stepped from a warm started first iterate towards the root
+	extern Real64 const WarmStartStepFrac;
+
 	// Parameters for controls used here
 	extern int const iNoControlVariable;
 	extern int const iTemperature;
@@ -122,7 +122,6 @@ namespace HVACInterfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D< Real64 > TmpRealARR( ConvergLogStackDepth ); //Tuned Made static
 		Real64 DeltaEnergy;
 		// FLOW:
 
@@ -138,49 +137,37 @@ namespace HVACInterfaceManager {
 			AirLoopConvergence( AirLoopNum ).HVACEnthalpyNotConverged( 1 ) = false;
 			AirLoopConvergence( AirLoopNum ).HVACPressureNotConverged( 1 ) = false;
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACFlowDemandToSupplyTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACFlowDemandToSupplyTolValue( 1 ) = std::abs( Node( OutletNode ).MassFlowRate - Node( InletNode ).MassFlowRate );
-			AirLoopConvergence( AirLoopNum ).HVACFlowDemandToSupplyTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACFlowDemandToSupplyTolValue.push( std::abs( Node( OutletNode ).MassFlowRate - Node( InletNode ).MassFlowRate ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACFlowDemandToSupplyTolValue( 1 ) > HVACFlowRateToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACMassFlowNotConverged( 1 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACHumDemandToSupplyTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACHumDemandToSupplyTolValue( 1 ) = std::abs( Node( OutletNode ).HumRat - Node( InletNode ).HumRat );
-			AirLoopConvergence( AirLoopNum ).HVACHumDemandToSupplyTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACHumDemandToSupplyTolValue.push( std::abs( Node( OutletNode ).HumRat - Node( InletNode ).HumRat ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACHumDemandToSupplyTolValue( 1 ) > HVACHumRatToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACHumRatNotConverged( 1 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACTempDemandToSupplyTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACTempDemandToSupplyTolValue( 1 ) = std::abs( Node( OutletNode ).Temp - Node( InletNode ).Temp );
-			AirLoopConvergence( AirLoopNum ).HVACTempDemandToSupplyTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACTempDemandToSupplyTolValue.push( std::abs( Node( OutletNode ).Temp - Node( InletNode ).Temp ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACTempDemandToSupplyTolValue( 1 ) > HVACTemperatureToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACTempNotConverged( 1 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACEnergyDemandToSupplyTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACEnergyDemandToSupplyTolValue( 1 ) = std::abs( DeltaEnergy );
-			AirLoopConvergence( AirLoopNum ).HVACEnergyDemandToSupplyTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACEnergyDemandToSupplyTolValue.push( std::abs( DeltaEnergy ) );
 			if ( std::abs( DeltaEnergy ) > HVACEnergyToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACEnergyNotConverged( 1 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACEnthalpyDemandToSupplyTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACEnthalpyDemandToSupplyTolValue( 1 ) = std::abs( Node( OutletNode ).Enthalpy - Node( InletNode ).Enthalpy );
-			AirLoopConvergence( AirLoopNum ).HVACEnthalpyDemandToSupplyTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACEnthalpyDemandToSupplyTolValue.push( std::abs( Node( OutletNode ).Enthalpy - Node( InletNode ).Enthalpy ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACEnthalpyDemandToSupplyTolValue( 1 ) > HVACEnthalpyToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACEnthalpyNotConverged( 1 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACPressureDemandToSupplyTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACPressureDemandToSupplyTolValue( 1 ) = std::abs( Node( OutletNode ).Press - Node( InletNode ).Press );
-			AirLoopConvergence( AirLoopNum ).HVACPressureDemandToSupplyTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACPressureDemandToSupplyTolValue.push( std::abs( Node( OutletNode ).Press - Node( InletNode ).Press ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACPressureDemandToSupplyTolValue( 1 ) > HVACPressToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACPressureNotConverged( 1 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
@@ -195,49 +182,37 @@ namespace HVACInterfaceManager {
 			AirLoopConvergence( AirLoopNum ).HVACEnthalpyNotConverged( 2 ) = false;
 			AirLoopConvergence( AirLoopNum ).HVACPressureNotConverged( 2 ) = false;
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck1ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck1ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).MassFlowRate - Node( InletNode ).MassFlowRate );
-			AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck1ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck1ToDemandTolValue.push( std::abs( Node( OutletNode ).MassFlowRate - Node( InletNode ).MassFlowRate ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck1ToDemandTolValue( 1 ) > HVACFlowRateToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACMassFlowNotConverged( 2 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck1ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck1ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).HumRat - Node( InletNode ).HumRat );
-			AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck1ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck1ToDemandTolValue.push( std::abs( Node( OutletNode ).HumRat - Node( InletNode ).HumRat ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck1ToDemandTolValue( 1 ) > HVACHumRatToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACHumRatNotConverged( 2 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck1ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck1ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).Temp - Node( InletNode ).Temp );
-			AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck1ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck1ToDemandTolValue.push( std::abs( Node( OutletNode ).Temp - Node( InletNode ).Temp ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck1ToDemandTolValue( 1 ) > HVACTemperatureToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACTempNotConverged( 2 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck1ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck1ToDemandTolValue( 1 ) = DeltaEnergy;
-			AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck1ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck1ToDemandTolValue.push( DeltaEnergy );
 			if ( std::abs( DeltaEnergy ) > HVACEnergyToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACEnergyNotConverged( 2 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck1ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck1ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).Enthalpy - Node( InletNode ).Enthalpy );
-			AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck1ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck1ToDemandTolValue.push( std::abs( Node( OutletNode ).Enthalpy - Node( InletNode ).Enthalpy ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck1ToDemandTolValue( 1 ) > HVACEnthalpyToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACEnthalpyNotConverged( 2 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACPressureSupplyDeck1ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACPressureSupplyDeck1ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).Press - Node( InletNode ).Press );
-			AirLoopConvergence( AirLoopNum ).HVACPressureSupplyDeck1ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACPressureSupplyDeck1ToDemandTolValue.push( std::abs( Node( OutletNode ).Press - Node( InletNode ).Press ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACPressureSupplyDeck1ToDemandTolValue( 1 ) > HVACPressToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACPressureNotConverged( 2 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
@@ -252,49 +227,37 @@ namespace HVACInterfaceManager {
 			AirLoopConvergence( AirLoopNum ).HVACEnthalpyNotConverged( 3 ) = false;
 			AirLoopConvergence( AirLoopNum ).HVACPressureNotConverged( 3 ) = false;
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck2ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck2ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).MassFlowRate - Node( InletNode ).MassFlowRate );
-			AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck2ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck2ToDemandTolValue.push( std::abs( Node( OutletNode ).MassFlowRate - Node( InletNode ).MassFlowRate ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACFlowSupplyDeck2ToDemandTolValue( 1 ) > HVACFlowRateToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACMassFlowNotConverged( 3 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck2ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck2ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).HumRat - Node( InletNode ).HumRat );
-			AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck2ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck2ToDemandTolValue.push( std::abs( Node( OutletNode ).HumRat - Node( InletNode ).HumRat ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACHumSupplyDeck2ToDemandTolValue( 1 ) > HVACHumRatToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACHumRatNotConverged( 3 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck2ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck2ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).Temp - Node( InletNode ).Temp );
-			AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck2ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck2ToDemandTolValue.push( std::abs( Node( OutletNode ).Temp - Node( InletNode ).Temp ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACTempSupplyDeck2ToDemandTolValue( 1 ) > HVACTemperatureToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACTempNotConverged( 3 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck2ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck2ToDemandTolValue( 1 ) = DeltaEnergy;
-			AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck2ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACEnergySupplyDeck2ToDemandTolValue.push( DeltaEnergy );
 			if ( std::abs( DeltaEnergy ) > HVACEnergyToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACEnergyNotConverged( 3 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck2ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck2ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).Enthalpy - Node( InletNode ).Enthalpy );
-			AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck2ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck2ToDemandTolValue.push( std::abs( Node( OutletNode ).Enthalpy - Node( InletNode ).Enthalpy ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACEnthalpySupplyDeck2ToDemandTolValue( 1 ) > HVACEnthalpyToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACEnthalpyNotConverged( 3 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
 			}
 
-			TmpRealARR = AirLoopConvergence( AirLoopNum ).HVACPressueSupplyDeck2ToDemandTolValue;
-			AirLoopConvergence( AirLoopNum ).HVACPressueSupplyDeck2ToDemandTolValue( 1 ) = std::abs( Node( OutletNode ).Press - Node( InletNode ).Press );
-			AirLoopConvergence( AirLoopNum ).HVACPressueSupplyDeck2ToDemandTolValue( {2,ConvergLogStackDepth} ) = TmpRealARR( {1,ConvergLogStackDepth - 1} );
+			AirLoopConvergence( AirLoopNum ).HVACPressueSupplyDeck2ToDemandTolValue.push( std::abs( Node( OutletNode ).Press - Node( InletNode ).Press ) );
 			if ( AirLoopConvergence( AirLoopNum ).HVACPressueSupplyDeck2ToDemandTolValue( 1 ) > HVACPressToler ) {
 				AirLoopConvergence( AirLoopNum ).HVACPressureNotConverged( 3 ) = true;
 				OutOfToleranceFlag = true; // Something has changed--resimulate the other side of the loop
@@ -324,16 +287,6 @@ namespace HVACInterfaceManager {
 
 	//***************
 
-	// In-Place Right Shift by 1 of Array Elements
-	void
-	rshift1( Array1< Real64 > & a )
-	{
-		assert( a.size_bounded() );
-		for ( int i = a.u(), e = a.l(); i > e; --i ) {
-			a( i ) = a( i - 1 );
-		}
-	}
-
 	void
 	UpdatePlantLoopInterface(
 		int const LoopNum, // The 'inlet/outlet node' loop number
@@ -430,14 +383,12 @@ namespace HVACInterfaceManager {
 			Node( OtherLoopSideInletNode ).Temp = MixedOutletTemp;
 			TankOutletTemp = MixedOutletTemp;
 			if ( ThisLoopSideNum == DemandSide ) {
-				rshift1( flow_demand_to_supply_tol );
-				flow_demand_to_supply_tol( 1 ) = std::abs( OldOtherLoopSideInletMdot - Node( OtherLoopSideInletNode ).MassFlowRate );
+				flow_demand_to_supply_tol.push( std::abs( OldOtherLoopSideInletMdot - Node( OtherLoopSideInletNode ).MassFlowRate ) );
 				if ( flow_demand_to_supply_tol( 1 ) > PlantFlowRateToler ) {
 					convergence.PlantMassFlowNotConverged = true;
 				}
 			} else {
-				rshift1( flow_supply_to_demand_tol );
-				flow_supply_to_demand_tol( 1 ) = std::abs( OldOtherLoopSideInletMdot - Node( OtherLoopSideInletNode ).MassFlowRate );
+				flow_supply_to_demand_tol.push( std::abs( OldOtherLoopSideInletMdot - Node( OtherLoopSideInletNode ).MassFlowRate ) );
 				if ( flow_supply_to_demand_tol( 1 ) > PlantFlowRateToler ) {
 					convergence.PlantMassFlowNotConverged = true;
 				}
@@ -454,14 +405,12 @@ namespace HVACInterfaceManager {
 			Node( OtherLoopSideInletNode ).Temp = TankOutletTemp;
 			//Set the flow tolerance array
 			if ( ThisLoopSideNum == DemandSide ) {
-				rshift1( flow_demand_to_supply_tol );
-				flow_demand_to_supply_tol( 1 ) = std::abs( Node( ThisLoopSideOutletNode ).MassFlowRate - Node( OtherLoopSideInletNode ).MassFlowRate );
+				flow_demand_to_supply_tol.push( std::abs( Node( ThisLoopSideOutletNode ).MassFlowRate - Node( OtherLoopSideInletNode ).MassFlowRate ) );
 				if ( flow_demand_to_supply_tol( 1 ) > PlantFlowRateToler ) {
 					convergence.PlantMassFlowNotConverged = true;
 				}
 			} else {
-				rshift1( flow_supply_to_demand_tol );
-				flow_supply_to_demand_tol( 1 ) = std::abs( Node( ThisLoopSideOutletNode ).MassFlowRate - Node( OtherLoopSideInletNode ).MassFlowRate );
+				flow_supply_to_demand_tol.push( std::abs( Node( ThisLoopSideOutletNode ).MassFlowRate - Node( OtherLoopSideInletNode ).MassFlowRate ) );
 				if ( flow_supply_to_demand_tol( 1 ) > PlantFlowRateToler ) {
 					convergence.PlantMassFlowNotConverged = true;
 				}
@@ -486,15 +435,13 @@ namespace HVACInterfaceManager {
 		//temperature
 		if ( ThisLoopSideNum == DemandSide ) {
 			auto & temp_demand_to_supply_tol( convergence.PlantTempDemandToSupplyTolValue );
-			rshift1( temp_demand_to_supply_tol );
-			temp_demand_to_supply_tol( 1 ) = std::abs( OldTankOutletTemp - Node( OtherLoopSideInletNode ).Temp );
+			temp_demand_to_supply_tol.push( std::abs( OldTankOutletTemp - Node( OtherLoopSideInletNode ).Temp ) );
 			if ( temp_demand_to_supply_tol( 1 ) > PlantTemperatureToler ) {
 				convergence.PlantTempNotConverged = true;
 			}
 		} else {
 			auto & temp_supply_to_demand_tol( convergence.PlantTempSupplyToDemandTolValue );
-			rshift1( temp_supply_to_demand_tol );
-			temp_supply_to_demand_tol( 1 ) = std::abs( OldTankOutletTemp - Node( OtherLoopSideInletNode ).Temp );
+			temp_supply_to_demand_tol.push( std::abs( OldTankOutletTemp - Node( OtherLoopSideInletNode ).Temp ) );
 			if ( temp_supply_to_demand_tol( 1 ) > PlantTemperatureToler ) {
 				convergence.PlantTempNotConverged = true;
 			}
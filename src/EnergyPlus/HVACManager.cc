@@ -4,6 +4,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
@@ -12,6 +13,7 @@
 #include <HVACManager.hh>
 #include <AirflowNetworkBalanceManager.hh>
 //#include <CoolTower.hh>
+#include <CsvOutput.hh>
 #include <DataAirflowNetwork.hh>
 #include <DataAirLoop.hh>
 #include <DataContaminantBalance.hh>
@@ -29,6 +31,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -48,11 +51,14 @@
 #include <PlantManager.hh>
 #include <PlantUtilities.hh>
 #include <PollutionModule.hh>
+#include <Profiler.hh>
 #include <Psychrometrics.hh>
 #include <RefrigeratedCase.hh>
+#include <RuntimeMetrics.hh>
 #include <ScheduleManager.hh>
 #include <SetPointManager.hh>
 #include <SimAirServingZones.hh>
+#include <SQLiteProcedures.hh>
 #include <SystemAvailabilityManager.hh>
 #include <SystemReports.hh>
 //#include <ThermalChimney.hh>
@@ -143,6 +149,13 @@ namespace HVACManager {
 
 	int HVACManageIteration( 0 ); // counts iterations to enforce maximum iteration limit
 	int RepIterAir( 0 );
+	int HVACAcceleratedIterations( 0 ); // counts iterations whose node conditions were extrapolated
+	int SysTimeStepResizes( 0 ); // counts the system timesteps resized within the zone timestep
+	int HVACDormantSteps( 0 ); // 1 when the HVAC solution of the system timestep was skipped as dormant
+	bool HVACWasIdle( false ); // True when no node had flow at the end of the last HVAC solution
+	int NumNodeHistory( 0 ); // Iterations held in the node histories
+	Array2D< Real64 > NodeTempHistory; // Node temperatures of the last two iterations (C)
+	Array2D< Real64 > NodeHumRatHistory; // Node humidity ratios of the last two iterations (kg/kg)
 
 	//Array1D_bool CrossMixingReportFlag; // TRUE when Cross Mixing is active based on controls
 	//Array1D_bool MixingReportFlag; // TRUE when Mixing is active based on controls
@@ -183,6 +196,7 @@ namespace HVACManager {
 
 		using ZoneTempPredictorCorrector::ManageZoneAirUpdates;
 		using ZoneTempPredictorCorrector::DetectOscillatingZoneTemp;
+		using ZoneTempPredictorCorrector::RespaceSystemTimestepHistories;
 
 		using NodeInputManager::CalcMoreNodeInfo;
 		using ZoneEquipmentManager::UpdateZoneSizing;
@@ -210,6 +224,7 @@ namespace HVACManager {
 		using DataHeatBalFanSys::ZoneAirHumRatAvgComf;
 		using DataSystemVariables::ReportDuringWarmup; // added for FMI
 		using DataSystemVariables::UpdateDataDuringWarmupExternalInterface;
+		using DataSystemVariables::AdaptiveSystemTimestep;
 		using PlantManager::UpdateNodeThermalHistory;
 		using ZoneContaminantPredictorCorrector::ManageZoneContaminanUpdates;
 		using DataContaminantBalance::Contaminant;
@@ -258,6 +273,9 @@ namespace HVACManager {
 		static bool MyEnvrnFlag( true );
 		static bool InitVentReportFlag( true );
 		static bool DebugNamesReported( false );
+		static bool SetupTimestepReport( true );
+		bool ResizeTimeStepSys; // True if the system timesteps are resized as they are simulated
+		int StepsLeft; // System timesteps left of the zone timestep
 
 		static int ZTempTrendsNumSysSteps( 0 );
 		static int SysTimestepLoop( 0 );
@@ -269,6 +287,9 @@ namespace HVACManager {
 		static gio::Fmt Format_20( "(1x,I3,1x,F8.2,2(2x,F8.3),2x,F8.2,4(1x,F13.2),2x,F8.0,2x,F11.2,2x,F9.5,2x,A)" );
 		static gio::Fmt Format_30( "(1x,I3,5x,A)" );
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "ManageHVAC" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		//SYSTEM INITIALIZATION
 		if ( TriggerGetAFN ) {
 			TriggerGetAFN = false;
@@ -304,8 +325,15 @@ namespace HVACManager {
 			MyEnvrnFlag = true;
 		}
 
+		if ( AdaptiveSystemTimestep && SetupTimestepReport ) {
+			SetupOutputVariable( "HVAC System Timestep Count []", NumOfSysTimeSteps, "Zone", "Sum", "SimHVAC" );
+			SetupOutputVariable( "HVAC System Timestep Resize Count []", SysTimeStepResizes, "Zone", "Sum", "SimHVAC" );
+			SetupTimestepReport = false;
+		}
+
 		SysTimeElapsed = 0.0;
 		TimeStepSys = TimeStepZone;
+		SysTimeStepResizes = 0;
 		FirstTimeStepSysFlag = true;
 		ShortenTimeStepSys = false;
 		UseZoneTimeStepHistory = true;
@@ -377,6 +405,9 @@ namespace HVACManager {
 			UseZoneTimeStepHistory = true;
 		}
 
+		// The contaminant histories are kept at an even system timestep
+		ResizeTimeStepSys = AdaptiveSystemTimestep && ShortenTimeStepSys && ! Contaminant.SimulateContaminants;
+
 		if ( UseZoneTimeStepHistory ) PreviousTimeStep = TimeStepZone;
 		for ( SysTimestepLoop = 1; SysTimestepLoop <= NumOfSysTimeSteps; ++SysTimestepLoop ) {
 
@@ -470,6 +501,7 @@ namespace HVACManager {
 					if ( PrintEndDataDictionary && DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EndOfHeaderFormat );
 						gio::write( OutputFileMeters, EndOfHeaderFormat );
+						CsvOutput::EndCsvDictionary();
 						PrintEndDataDictionary = false;
 					}
 					if ( DoOutputReporting && ! PrintedWarmup ) {
@@ -494,6 +526,7 @@ namespace HVACManager {
 					if ( PrintEndDataDictionary && DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EndOfHeaderFormat );
 						gio::write( OutputFileMeters, EndOfHeaderFormat );
+						CsvOutput::EndCsvDictionary();
 						PrintEndDataDictionary = false;
 					}
 					if ( DoOutputReporting && ! PrintedWarmup ) {
@@ -510,12 +543,23 @@ namespace HVACManager {
 			SysTimeElapsed += TimeStepSys;
 
 			FirstTimeStepSysFlag = false;
+
+			if ( ResizeTimeStepSys && SysTimestepLoop < NumOfSysTimeSteps ) {
+				StepsLeft = NextSystemTimestepCount( TimeStepSys, ZoneTempChange, TimeStepZone - SysTimeElapsed );
+				if ( StepsLeft != NumOfSysTimeSteps - SysTimestepLoop ) {
+					RespaceSystemTimestepHistories( TimeStepSys, ( TimeStepZone - SysTimeElapsed ) / StepsLeft );
+					TimeStepSys = ( TimeStepZone - SysTimeElapsed ) / StepsLeft;
+					NumOfSysTimeSteps = SysTimestepLoop + StepsLeft;
+					++SysTimeStepResizes;
+				}
+			}
 		} //system time step  loop (loops once if no downstepping)
 
 		ManageZoneAirUpdates( iPushZoneTimestepHistories, ZoneTempChange, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iPushZoneTimestepHistories, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 
 		NumOfSysTimeStepsLastZoneTimeStep = NumOfSysTimeSteps;
+		if ( SysTimeStepResizes > 0 ) NumOfSysTimeStepsLastZoneTimeStep = 0; // Uneven system timesteps leave no history to reuse
 
 		UpdateDemandManagers();
 
@@ -550,6 +594,36 @@ namespace HVACManager {
 
 	}
 
+	int
+	NextSystemTimestepCount(
+		Real64 const TimeStep, // Length of the system timestep just simulated (hr)
+		Real64 const TempChange, // Largest change of a zone air temperature over it (C)
+		Real64 const TimeLeft // Time left of the zone timestep (hr)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the number of even system timesteps to simulate the rest of the zone timestep in,
+		// from the zone air temperature change over the system timestep just simulated.
+
+		// METHODOLOGY EMPLOYED:
+		// The change over a system timestep is taken in proportion to its length, so the timestep
+		// that would change the zone temperatures by MaxZoneTempDiff is aimed for, with a margin.
+		// The timestep at most doubles or halves at a time, and is no shorter than MinTimeStepSys.
+
+		// Using/Aliasing
+		using DataConvergParams::MaxZoneTempDiff;
+		using DataConvergParams::MinTimeStepSys;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const Margin( 0.9 ); // Fraction of the timestep for MaxZoneTempDiff aimed for
+
+		Real64 const Ratio( TempChange > 0.0 ? Margin * MaxZoneTempDiff / TempChange : 2.0 );
+		Real64 const NewTimeStep( max( TimeStep * max( 0.5, min( 2.0, Ratio ) ), MinTimeStepSys ) );
+		return max( 1, int( std::ceil( TimeLeft / NewTimeStep - 1.0e-6 ) ) );
+
+	}
+
 	void
 	SimHVAC()
 	{
@@ -585,6 +659,10 @@ namespace HVACManager {
 		using General::CreateSysTimeIntervalString;
 		using General::RoundSigDigits;
 		using EMSManager::ManageEMS;
+		using DataSystemVariables::HVACConvergenceTelemetry;
+		using DataSystemVariables::HVACIterationAcceleration;
+		using DataSystemVariables::DormantHVAC;
+		using SimAirServingZones::AirLoopControllerIterations;
 		using PlantManager::GetPlantLoopData;
 		using PlantManager::GetPlantInput;
 		using PlantManager::SetupReports;
@@ -689,12 +767,17 @@ namespace HVACManager {
 		// The plant loop 'get inputs' and initialization are also done here in order to allow plant loop connected components
 		// simulated by managers other than the plant manager to run correctly.
 		HVACManageIteration = 0;
+		HVACAcceleratedIterations = 0;
+		HVACDormantSteps = 0;
+		NumNodeHistory = 0;
 		PlantManageSubIterations = 0;
 		PlantManageHalfLoopCalls = 0;
 		SetAllPlantSimFlagsToValue( true );
 		if ( ! IterSetup ) {
 			SetupOutputVariable( "HVAC System Solver Iteration Count []", HVACManageIteration, "HVAC", "Sum", "SimHVAC" );
 			SetupOutputVariable( "Air System Solver Iteration Count []", RepIterAir, "HVAC", "Sum", "SimHVAC" );
+			if ( HVACIterationAcceleration ) SetupOutputVariable( "HVAC System Solver Accelerated Iteration Count []", HVACAcceleratedIterations, "HVAC", "Sum", "SimHVAC" );
+			if ( DormantHVAC ) SetupOutputVariable( "HVAC System Dormant Timestep Count []", HVACDormantSteps, "HVAC", "Sum", "SimHVAC" );
 			ManageSetPoints(); //need to call this before getting plant loop data so setpoint checks can complete okay
 			GetPlantLoopData();
 			GetPlantInput();
@@ -747,6 +830,14 @@ namespace HVACManager {
 
 		ManageEMS( emsCallFromAfterHVACManagers ); // calling point
 
+		// With every system off and without flow, only the equipment outside the loops is simulated
+		if ( DormantHVAC && HVACIsDormant() ) {
+			HVACDormantSteps = 1;
+			ManageNonZoneEquipment( FirstHVACIteration, SimNonZoneEquipmentFlag );
+			ManageElectricLoadCenters( FirstHVACIteration, SimElecCircuitsFlag, false );
+			return;
+		}
+
 		// first explicitly call each system type with FirstHVACIteration,
 
 		// Manages the various component simulations
@@ -776,6 +867,10 @@ namespace HVACManager {
 
 			UpdateZoneInletConvergenceLog();
 
+			if ( HVACIterationAcceleration && ( SimAirLoopsFlag || SimZoneEquipmentFlag || SimNonZoneEquipmentFlag || SimPlantLoopsFlag || SimElecCircuitsFlag ) ) {
+				AccelerateNodeConvergence();
+			}
+
 			++HVACManageIteration; // Increment the iteration counter
 
 		}
@@ -823,6 +918,12 @@ namespace HVACManager {
 			}
 		}
 
+		if ( HVACConvergenceTelemetry && sqlite ) {
+			sqlite->addSQLiteHVACConvergenceRecord( CurEnvirNum, DayOfSim, HourOfDay, TimeStep, SysTimeElapsed, WarmupFlag, NumOfWarmupDays, HVACManageIteration, PlantManageSubIterations, AirLoopControllerIterations, HVACManageIteration <= MaxIter );
+		}
+
+		RuntimeMetrics::CountHVACIterations( HVACManageIteration );
+
 		if ( ( HVACManageIteration > MaxIter ) && ( ! WarmupFlag ) ) {
 			++ErrCount;
 			if ( ErrCount < 15 ) {
@@ -963,7 +1064,7 @@ namespace HVACManager {
 							MonotonicDecreaseFound = false;
 							MonotonicIncreaseFound = false;
 							// check for evidence of oscillation by indentify duplicates when latest value not equal to average
-							AvgValue = sum( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio ) / double( ConvergLogStackDepth );
+							AvgValue = ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio.sum() / double( ConvergLogStackDepth );
 							if ( std::abs( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio( 1 ) - AvgValue ) > HVACHumRatOscillationToler ) { // last iterate differs from average
 								FoundOscillationByDuplicate = false;
 								for ( StackDepth = 2; StackDepth <= ConvergLogStackDepth; ++StackDepth ) {
@@ -975,7 +1076,7 @@ namespace HVACManager {
 									}
 								}
 								if ( ! FoundOscillationByDuplicate ) {
-									SlopeHumRat = ( sum_ConvergLogStackARR * sum( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio ) - double( ConvergLogStackDepth ) * sum( ( ConvergLogStackARR * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio ) ) ) / ( square_sum_ConvergLogStackARR - double( ConvergLogStackDepth ) * sum_square_ConvergLogStackARR );
+									SlopeHumRat = ( sum_ConvergLogStackARR * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio.sum() - double( ConvergLogStackDepth ) * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio.weighted_sum( ConvergLogStackARR ) ) / ( square_sum_ConvergLogStackARR - double( ConvergLogStackDepth ) * sum_square_ConvergLogStackARR );
 									if ( std::abs( SlopeHumRat ) > HVACHumRatSlopeToler ) {
 
 										if ( SlopeHumRat < 0.0 ) { // check for monotic decrease
@@ -1019,7 +1120,7 @@ namespace HVACManager {
 							MonotonicDecreaseFound = false;
 							MonotonicIncreaseFound = false;
 							// check for evidence of oscillation by indentify duplicates when latest value not equal to average
-							AvgValue = sum( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate ) / double( ConvergLogStackDepth );
+							AvgValue = ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate.sum() / double( ConvergLogStackDepth );
 							if ( std::abs( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate( 1 ) - AvgValue ) > HVACFlowRateOscillationToler ) { // last iterate differs from average
 								FoundOscillationByDuplicate = false;
 								for ( StackDepth = 2; StackDepth <= ConvergLogStackDepth; ++StackDepth ) {
@@ -1031,7 +1132,7 @@ namespace HVACManager {
 									}
 								}
 								if ( ! FoundOscillationByDuplicate ) {
-									SlopeMdot = ( sum_ConvergLogStackARR * sum( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate ) - double( ConvergLogStackDepth ) * sum( ( ConvergLogStackARR * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate ) ) ) / ( square_sum_ConvergLogStackARR - double( ConvergLogStackDepth ) * sum_square_ConvergLogStackARR );
+									SlopeMdot = ( sum_ConvergLogStackARR * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate.sum() - double( ConvergLogStackDepth ) * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate.weighted_sum( ConvergLogStackARR ) ) / ( square_sum_ConvergLogStackARR - double( ConvergLogStackDepth ) * sum_square_ConvergLogStackARR );
 									if ( std::abs( SlopeMdot ) > HVACFlowRateSlopeToler ) {
 										ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).NotConvergedMassFlow = true;
 										if ( SlopeMdot < 0.0 ) { // check for monotic decrease
@@ -1075,7 +1176,7 @@ namespace HVACManager {
 							MonotonicDecreaseFound = false;
 							MonotonicIncreaseFound = false;
 							// check for evidence of oscillation by indentify duplicates when latest value not equal to average
-							AvgValue = sum( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature ) / double( ConvergLogStackDepth );
+							AvgValue = ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature.sum() / double( ConvergLogStackDepth );
 							if ( std::abs( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature( 1 ) - AvgValue ) > HVACTemperatureOscillationToler ) { // last iterate differs from average
 								FoundOscillationByDuplicate = false;
 								for ( StackDepth = 2; StackDepth <= ConvergLogStackDepth; ++StackDepth ) {
@@ -1087,7 +1188,7 @@ namespace HVACManager {
 									}
 								}
 								if ( ! FoundOscillationByDuplicate ) {
-									SlopeTemps = ( sum_ConvergLogStackARR * sum( ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature ) - double( ConvergLogStackDepth ) * sum( ( ConvergLogStackARR * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature ) ) ) / ( square_sum_ConvergLogStackARR - double( ConvergLogStackDepth ) * sum_square_ConvergLogStackARR );
+									SlopeTemps = ( sum_ConvergLogStackARR * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature.sum() - double( ConvergLogStackDepth ) * ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature.weighted_sum( ConvergLogStackARR ) ) / ( square_sum_ConvergLogStackARR - double( ConvergLogStackDepth ) * sum_square_ConvergLogStackARR );
 									if ( std::abs( SlopeTemps ) > HVACTemperatureSlopeToler ) {
 										ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).NotConvergedTemp = true;
 										if ( SlopeTemps < 0.0 ) { // check for monotic decrease
@@ -1395,6 +1496,8 @@ namespace HVACManager {
 			}
 
 		}
+		if ( DormantHVAC ) HVACWasIdle = NoNodeHasFlow();
+
 		// Set node setpoints to a flag value so that controllers can check whether their sensed nodes
 		// have a setpoint
 		if ( ! ZoneSizingCalc && ! SysSizingCalc ) {
@@ -1423,6 +1526,67 @@ namespace HVACManager {
 
 	}
 
+	bool
+	HVACIsDormant()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Tells whether the HVAC solution of this system timestep can be skipped, because no air loop,
+		// zone equipment or plant loop can run.
+
+		// METHODOLOGY EMPLOYED:
+		// The last solution must have left every node without flow, no availability manager may
+		// cycle a system on, and no zone may ask for heating, cooling or moisture.  The off state
+		// then reproduces itself, so the components are not called again.  Models whose controls
+		// act outside these results (EMS, airflow network with distribution) are always solved.
+
+		// Using/Aliasing
+		using DataPlant::PlantAvailMgr;
+		using DataZoneEnergyDemands::ZoneSysEnergyDemand;
+		using DataZoneEnergyDemands::ZoneSysMoistureDemand;
+		using DataZoneEquipment::NumValidSysAvailZoneComponents;
+
+		if ( ! HVACWasIdle || BeginEnvrnFlag || SysSizingCalc ) return false;
+		if ( AnyEnergyManagementSystemInModel || SimulateAirflowNetwork > AirflowNetworkControlSimple ) return false;
+
+		for ( int AirLoopNum = 1, AirLoopNum_end = PriAirSysAvailMgr.isize(); AirLoopNum <= AirLoopNum_end; ++AirLoopNum ) {
+			if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == CycleOn ) return false;
+		}
+		for ( int LoopNum = 1, LoopNum_end = PlantAvailMgr.isize(); LoopNum <= LoopNum_end; ++LoopNum ) {
+			if ( PlantAvailMgr( LoopNum ).AvailStatus == CycleOn ) return false;
+		}
+		if ( allocated( ZoneComp ) ) {
+			for ( int ZoneEquipType = 1; ZoneEquipType <= NumValidSysAvailZoneComponents; ++ZoneEquipType ) {
+				auto const & ZoneCompAvailMgrs( ZoneComp( ZoneEquipType ).ZoneCompAvailMgrs );
+				for ( int CompNum = 1, CompNum_end = ZoneCompAvailMgrs.isize(); CompNum <= CompNum_end; ++CompNum ) {
+					if ( ZoneCompAvailMgrs( CompNum ).AvailStatus == CycleOn ) return false;
+				}
+			}
+		}
+		if ( ! allocated( ZoneSysEnergyDemand ) || ! allocated( ZoneSysMoistureDemand ) ) return false;
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ZoneSysEnergyDemand( ZoneNum ).TotalOutputRequired != 0.0 ) return false;
+			if ( ZoneSysMoistureDemand( ZoneNum ).TotalOutputRequired != 0.0 ) return false;
+		}
+
+		return true;
+
+	}
+
+	bool
+	NoNodeHasFlow()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Tells whether every node is left without flow by the HVAC solution.
+
+		for ( int NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+			if ( Node( NodeNum ).MassFlowRate != 0.0 ) return false;
+		}
+		return true;
+
+	}
+
 	void
 	SimSelectedEquipment(
 		bool & SimAirLoops, // True when the air loops need to be (re)simulated
@@ -2583,6 +2747,86 @@ namespace HVACManager {
 	}
 
 
+	void
+	AccelerateNodeConvergence()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Speeds up the convergence of the HVAC iterations by extrapolating the node conditions toward their
+		// limit once three iterations show how they converge.
+
+		// METHODOLOGY EMPLOYED:
+		// Aitken delta-squared extrapolation of the temperature of air and water nodes and the humidity ratio of
+		// air nodes, from the values after the last three iterations.  Within an iteration the components set
+		// their outlet nodes from their inlet nodes, so the extrapolation acts on the nodes read before they are
+		// set again, those closing the air, zone and plant loops.  A value is extrapolated only while its change
+		// is above the convergence tolerance and the ratio of its last two changes is below one in magnitude.
+		// Mass flow rates are left alone to keep continuity.  After an extrapolation three new iterations are
+		// needed before the next one.
+
+		// Using/Aliasing
+		using Psychrometrics::PsyHFnTdbW;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MaxRatio( 0.95 ); // Largest ratio of successive changes that is extrapolated
+
+		if ( NodeTempHistory.size2() != NumOfNodes ) {
+			NodeTempHistory.allocate( 2, NumOfNodes );
+			NodeHumRatHistory.allocate( 2, NumOfNodes );
+			NumNodeHistory = 0;
+		}
+
+		if ( NumNodeHistory < 2 ) {
+			++NumNodeHistory;
+			for ( int NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+				NodeTempHistory( NumNodeHistory, NodeNum ) = Node( NodeNum ).Temp;
+				NodeHumRatHistory( NumNodeHistory, NodeNum ) = Node( NodeNum ).HumRat;
+			}
+			return;
+		}
+
+		bool Extrapolated( false );
+		for ( int NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+			auto & node( Node( NodeNum ) );
+			if ( node.FluidType != NodeType_Air && node.FluidType != NodeType_Water ) continue;
+			bool NodeExtrapolated( false );
+
+			Real64 const TempChange1( NodeTempHistory( 2, NodeNum ) - NodeTempHistory( 1, NodeNum ) );
+			Real64 const TempChange2( node.Temp - NodeTempHistory( 2, NodeNum ) );
+			if ( std::abs( TempChange2 ) > HVACTemperatureToler && std::abs( TempChange2 ) < MaxRatio * std::abs( TempChange1 ) ) {
+				Real64 const Ratio( TempChange2 / TempChange1 );
+				node.Temp += TempChange2 * Ratio / ( 1.0 - Ratio );
+				NodeExtrapolated = true;
+			}
+
+			if ( node.FluidType == NodeType_Air ) {
+				Real64 const HumRatChange1( NodeHumRatHistory( 2, NodeNum ) - NodeHumRatHistory( 1, NodeNum ) );
+				Real64 const HumRatChange2( node.HumRat - NodeHumRatHistory( 2, NodeNum ) );
+				if ( std::abs( HumRatChange2 ) > HVACHumRatToler && std::abs( HumRatChange2 ) < MaxRatio * std::abs( HumRatChange1 ) ) {
+					Real64 const Ratio( HumRatChange2 / HumRatChange1 );
+					node.HumRat = max( 0.0, node.HumRat + HumRatChange2 * Ratio / ( 1.0 - Ratio ) );
+					NodeExtrapolated = true;
+				}
+				if ( NodeExtrapolated ) node.Enthalpy = PsyHFnTdbW( node.Temp, node.HumRat );
+			}
+
+			if ( NodeExtrapolated ) Extrapolated = true;
+		}
+
+		if ( Extrapolated ) {
+			++HVACAcceleratedIterations;
+			NumNodeHistory = 0;
+		} else {
+			for ( int NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+				NodeTempHistory( 1, NodeNum ) = NodeTempHistory( 2, NodeNum );
+				NodeTempHistory( 2, NodeNum ) = Node( NodeNum ).Temp;
+				NodeHumRatHistory( 1, NodeNum ) = NodeHumRatHistory( 2, NodeNum );
+				NodeHumRatHistory( 2, NodeNum ) = Node( NodeNum ).HumRat;
+			}
+		}
+
+	}
+
 	void
 	UpdateZoneInletConvergenceLog()
 	{
@@ -2604,7 +2848,6 @@ namespace HVACManager {
 
 		// Using/Aliasing
 		using DataConvergParams::ZoneInletConvergence;
-		using DataConvergParams::ConvergLogStackDepth;
 		using DataLoopNode::Node;
 		using DataGlobals::NumOfZones;
 
@@ -2626,24 +2869,17 @@ namespace HVACManager {
 		int ZoneIndex;
 		int NodeIndex;
 		int NodeNum;
-		Array1D< Real64 > tmpRealARR( ConvergLogStackDepth );
 
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
 			for ( NodeIndex = 1; NodeIndex <= ZoneInletConvergence( ZoneNum ).NumInletNodes; ++NodeIndex ) {
 				NodeNum = ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).NodeNum;
 
-				tmpRealARR = ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio;
-				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio( 1 ) = Node( NodeNum ).HumRat;
-				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio( {2,ConvergLogStackDepth} ) = tmpRealARR( {1,ConvergLogStackDepth - 1} );
+				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).HumidityRatio.push( Node( NodeNum ).HumRat );
 
-				tmpRealARR = ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate;
-				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate( 1 ) = Node( NodeNum ).MassFlowRate;
-				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate( {2,ConvergLogStackDepth} ) = tmpRealARR( {1,ConvergLogStackDepth - 1} );
+				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).MassFlowRate.push( Node( NodeNum ).MassFlowRate );
 
-				tmpRealARR = ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature;
-				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature( 1 ) = Node( NodeNum ).Temp;
-				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature( {2,ConvergLogStackDepth} ) = tmpRealARR( {1,ConvergLogStackDepth - 1} );
+				ZoneInletConvergence( ZoneNum ).InletNode( NodeIndex ).Temperature.push( Node( NodeNum ).Temp );
 			}
 		}
 
@@ -19,6 +19,10 @@ namespace HVACManager {
 
 	extern int HVACManageIteration; // counts iterations to enforce maximum iteration limit
 	extern int RepIterAir;
+	extern int HVACAcceleratedIterations; // counts iterations whose node conditions were extrapolated
+	extern int SysTimeStepResizes; // counts the system timesteps resized within the zone timestep
+	extern int HVACDormantSteps; // 1 when the HVAC solution of the system timestep was skipped as dormant
+	extern bool HVACWasIdle; // True when no node had flow at the end of the last HVAC solution
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	// and zone equipment simulations
@@ -28,9 +32,22 @@ namespace HVACManager {
 	void
 	ManageHVAC();
 
+	int
+	NextSystemTimestepCount(
+		Real64 const TimeStep, // Length of the system timestep just simulated (hr)
+		Real64 const TempChange, // Largest change of a zone air temperature over it (C)
+		Real64 const TimeLeft // Time left of the zone timestep (hr)
+	);
+
 	void
 	SimHVAC();
 
+	bool
+	HVACIsDormant();
+
+	bool
+	NoNodeHasFlow();
+
 	void
 	SimSelectedEquipment(
 		bool & SimAirLoops, // True when the air loops need to be (re)simulated
@@ -69,6 +86,9 @@ namespace HVACManager {
 	void
 	UpdateZoneInletConvergenceLog();
 
+	void
+	AccelerateNodeConvergence();
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
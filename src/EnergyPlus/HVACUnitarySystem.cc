@@ -23,6 +23,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -5816,14 +5817,18 @@ namespace HVACUnitarySystem {
 		// This subroutine determines operating PLR and calculates the load based system output.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// With MultiSpeedBracketSearch set, the speed meeting the load of a unit with more than two
+		// speeds is bracketed by SearchSpeedLevel, and speeds are then tried in turn from there.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
+		using General::SearchSpeedLevel;
 		using General::TrimSigDigits;
+		using DataSystemVariables::MultiSpeedBracketSearch;
 		using DataHeatBalFanSys::TempControlType;
 		using Psychrometrics::PsyCpAirFnWTdb;
 
@@ -5865,6 +5870,7 @@ namespace HVACUnitarySystem {
 		Real64 TempMinPLR; // iterative minimum PLR
 		Real64 TempMaxPLR; // iterative maximum PLR
 		int SpeedNum; // multi-speed coil speed number
+		int StartSpeedNum; // multi-speed coil speed number the speeds are tried from
 		int CompressorONFlag; // 0= compressor off, 1= compressor on
 		Real64 CoolingOnlySensibleOutput; // use to calculate dehumidification induced heating [W]
 		Real64 CpAir; // specific heat of air [J/kg_C]
@@ -6122,7 +6128,25 @@ namespace HVACUnitarySystem {
 		UnitarySystem( UnitarySysNum ).CoolingSpeedNum = 0;
 		if ( ! UnitarySystem( UnitarySysNum ).Staged ) {
 			if ( HeatingLoad ) {
-				for ( SpeedNum = 1; SpeedNum <= UnitarySystem( UnitarySysNum ).NumOfSpeedHeating; ++SpeedNum ) {
+				StartSpeedNum = 1;
+				if ( MultiSpeedBracketSearch && UnitarySystem( UnitarySysNum ).NumOfSpeedHeating > 2 ) {
+					auto HeatingResidual = [&]( int const Speed ) -> Real64 {
+						CoolPLR = 0.0;
+						HeatPLR = 1.0;
+						UnitarySystem( UnitarySysNum ).HeatingSpeedRatio = ( Speed == 1 ? 0.0 : 1.0 );
+						UnitarySystem( UnitarySysNum ).HeatingCycRatio = 1.0;
+						UnitarySystem( UnitarySysNum ).HeatingSpeedNum = Speed;
+						CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, SensOutputOn, LatOutputOn, HXUnitOn, _, _, CompressorONFlag );
+						return SensOutputOn - ZoneLoad;
+					};
+					StartSpeedNum = UnitarySystem( UnitarySysNum ).NumOfSpeedHeating;
+					Real64 const ResHigh( HeatingResidual( StartSpeedNum ) );
+					if ( ResHigh >= 0.0 ) {
+						Real64 const ResLow( HeatingResidual( 1 ) );
+						StartSpeedNum = ( ResLow >= 0.0 ) ? 1 : SearchSpeedLevel( 1, ResLow, StartSpeedNum, ResHigh, HeatingResidual );
+					}
+				}
+				for ( SpeedNum = StartSpeedNum; SpeedNum <= UnitarySystem( UnitarySysNum ).NumOfSpeedHeating; ++SpeedNum ) {
 					CoolPLR = 0.0;
 					HeatPLR = 1.0;
 					if ( SpeedNum == 1 ) {
@@ -6151,7 +6175,25 @@ namespace HVACUnitarySystem {
 					}
 				}
 			} else { // Cooling or moisture load
-				for ( SpeedNum = 1; SpeedNum <= UnitarySystem( UnitarySysNum ).NumOfSpeedCooling; ++SpeedNum ) {
+				StartSpeedNum = 1;
+				if ( MultiSpeedBracketSearch && UnitarySystem( UnitarySysNum ).NumOfSpeedCooling > 2 ) {
+					auto CoolingResidual = [&]( int const Speed ) -> Real64 {
+						CoolPLR = 1.0;
+						HeatPLR = 0.0;
+						UnitarySystem( UnitarySysNum ).CoolingSpeedRatio = ( Speed == 1 ? 0.0 : 1.0 );
+						UnitarySystem( UnitarySysNum ).CoolingCycRatio = 1.0;
+						UnitarySystem( UnitarySysNum ).CoolingSpeedNum = Speed;
+						CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, SensOutputOn, LatOutputOn, HXUnitOn, _, _, CompressorONFlag );
+						return ZoneLoad - SensOutputOn;
+					};
+					StartSpeedNum = UnitarySystem( UnitarySysNum ).NumOfSpeedCooling;
+					Real64 const ResHigh( CoolingResidual( StartSpeedNum ) );
+					if ( ResHigh >= 0.0 ) {
+						Real64 const ResLow( CoolingResidual( 1 ) );
+						StartSpeedNum = ( ResLow >= 0.0 ) ? 1 : SearchSpeedLevel( 1, ResLow, StartSpeedNum, ResHigh, CoolingResidual );
+					}
+				}
+				for ( SpeedNum = StartSpeedNum; SpeedNum <= UnitarySystem( UnitarySysNum ).NumOfSpeedCooling; ++SpeedNum ) {
 					CoolPLR = 1.0;
 					HeatPLR = 0.0;
 					if ( SpeedNum == 1 ) {
@@ -6267,7 +6309,7 @@ namespace HVACUnitarySystem {
 				Par( 9 ) = 0.0; // HXUnitOn is always false for HX
 				Par( 10 ) = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
 				//     Tolerance is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par, RootSolverCallSiteIndex( "Sensible Part Load Ratio", UnitarySystem( UnitarySysNum ).UnitarySystemType, UnitarySystem( UnitarySysNum ).Name ) );
 
 				if ( SolFlag == -1 ) {
 					if ( HeatingLoad ) {
@@ -6294,7 +6336,7 @@ namespace HVACUnitarySystem {
 							CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, TempMinPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 						}
 						// Now solve again with tighter PLR limits
-						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, HeatPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, HeatPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par, RootSolverCallSiteIndex( "Heating Part Load Ratio", UnitarySystem( UnitarySysNum ).UnitarySystemType, UnitarySystem( UnitarySysNum ).Name ) );
 						CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 					} else if ( CoolingLoad ) {
 						// RegulaFalsi may not find cooling PLR when the latent degradation model is used.
@@ -6320,7 +6362,7 @@ namespace HVACUnitarySystem {
 							TempSysOutput = TempSensOutput;
 						}
 						// Now solve again with tighter PLR limits
-						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par, RootSolverCallSiteIndex( "Cooling Part Load Ratio", UnitarySystem( UnitarySysNum ).UnitarySystemType, UnitarySystem( UnitarySysNum ).Name ) );
 						CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 					} // IF(HeatingLoad)THEN
 					if ( SolFlag == -1 ) {
@@ -6462,7 +6504,7 @@ namespace HVACUnitarySystem {
 				}
 				Par( 10 ) = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
 				// Tolerance is fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par, RootSolverCallSiteIndex( "Latent Part Load Ratio", UnitarySystem( UnitarySysNum ).UnitarySystemType, UnitarySystem( UnitarySysNum ).Name ) );
 				//      IF (HeatingLoad) THEN
 				//        UnitarySystem(UnitarySysNum)%HeatingPartLoadFrac = PartLoadRatio
 				//      ELSE
@@ -6503,7 +6545,7 @@ namespace HVACUnitarySystem {
 				CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, TempMinPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 			}
 			// Now solve again with tighter PLR limits
-			SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+			SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par, RootSolverCallSiteIndex( "Latent Part Load Ratio", UnitarySystem( UnitarySysNum ).UnitarySystemType, UnitarySystem( UnitarySysNum ).Name ) );
 			CalcUnitarySystemToLoad( UnitarySysNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 			if ( SolFlagLat == -1 ) {
 				if ( std::abs( MoistureLoad - TempLatOutput ) > SmallLoad ) {
@@ -6573,6 +6615,7 @@ namespace HVACUnitarySystem {
 
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 		using DataHeatBalFanSys::TempControlType;
 
 		// Locals
@@ -7353,6 +7396,7 @@ namespace HVACUnitarySystem {
 		using WaterCoils::SimulateWaterCoilComponents;
 		using SteamCoils::SimulateSteamCoilComponents;
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -7538,6 +7582,7 @@ namespace HVACUnitarySystem {
 		using Psychrometrics::PsyHFnTdbW;
 		using Psychrometrics::PsyTdpFnWPb;
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 		using General::RoundSigDigits;
 		using DXCoils::SimDXCoil;
 		using DXCoils::SimDXCoilMultiSpeed;
@@ -8452,6 +8497,7 @@ namespace HVACUnitarySystem {
 		using Psychrometrics::PsyHFnTdbW;
 		using Psychrometrics::PsyTdpFnWPb;
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 		using General::RoundSigDigits;
 		using DXCoils::SimDXCoil;
 		using DXCoils::SimDXCoilMultiSpeed;
@@ -8892,6 +8938,7 @@ namespace HVACUnitarySystem {
 		using Psychrometrics::PsyHFnTdbW;
 		using Psychrometrics::PsyTdpFnWPb;
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 		using General::RoundSigDigits;
 		using HeatingCoils::SimulateHeatingCoilComponents;
 		using SteamCoils::SimulateSteamCoilComponents;
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <string>
@@ -22,6 +23,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <DXCoils.hh>
@@ -170,6 +172,9 @@ namespace HVACVariableRefrigerantFlow {
 	Array1D< Real64 > MinDeltaT; // minimum zone temperature difference from setpoint
 	Array1D< Real64 > SumCoolingLoads; // sum of cooling loads
 	Array1D< Real64 > SumHeatingLoads; // sum of heating loads
+	int PLRBoundsVRFTUNum( 0 ); // TU whose outputs at PLR = 0 and 1 are kept for PLRResidual, 0 if none
+	Real64 PLRBoundsNoCompOutput( 0.0 ); // output of that TU at PLR = 0 [W]
+	Real64 PLRBoundsFullOutput( 0.0 ); // output of that TU at PLR = 1 [W]
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -4672,6 +4677,8 @@ namespace HVACVariableRefrigerantFlow {
 
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
+		using DataSystemVariables::VRFReusePLRBounds;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 		using HeatingCoils::SimulateHeatingCoilComponents;
@@ -4797,7 +4804,14 @@ namespace HVACVariableRefrigerantFlow {
 			//    Par(4) = OpMode
 			Par( 5 ) = QZnReq;
 			Par( 6 ) = OnOffAirFlowRatio;
-			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par );
+			// The solver starts from the residuals at PLR = 0 and 1, whose outputs were just found
+			if ( VRFReusePLRBounds ) {
+				PLRBoundsVRFTUNum = VRFTUNum;
+				PLRBoundsNoCompOutput = NoCompOutput;
+				PLRBoundsFullOutput = FullOutput;
+			}
+			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par, RootSolverCallSiteIndex( "Part Load Ratio", cVRFTUTypes( VRFTU( VRFTUNum ).VRFTUType_Num ), VRFTU( VRFTUNum ).Name ) );
+			PLRBoundsVRFTUNum = 0;
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -4817,7 +4831,7 @@ namespace HVACVariableRefrigerantFlow {
 					if ( VRFHeatingMode && TempOutput < QZnReq ) ContinueIter = false;
 					if ( VRFCoolingMode && TempOutput > QZnReq ) ContinueIter = false;
 				}
-				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, TempMinPLR, TempMaxPLR, Par );
+				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, TempMinPLR, TempMaxPLR, Par, RootSolverCallSiteIndex( "Part Load Ratio", cVRFTUTypes( VRFTU( VRFTUNum ).VRFTUType_Num ), VRFTU( VRFTUNum ).Name ) );
 				if ( SolFla == -1 ) {
 					if ( ! FirstHVACIteration && ! WarmupFlag ) {
 						if ( VRFTU( VRFTUNum ).IterLimitExceeded == 0 ) {
@@ -5339,7 +5353,8 @@ namespace HVACVariableRefrigerantFlow {
 
 		// METHODOLOGY EMPLOYED:
 		//  Calls CalcVRF to get ActualOutput at the given part load ratio
-		//  and calculates the residual as defined above
+		//  and calculates the residual as defined above. With VRFReusePLRBounds set, the outputs
+		//  ControlVRF found at part load ratios 0 and 1 are used instead of calling CalcVRF again.
 
 		// REFERENCES:
 		// na
@@ -5387,7 +5402,13 @@ namespace HVACVariableRefrigerantFlow {
 		if ( std::abs( QZnReq ) < 100.0 ) QZnReqTemp = sign( 100.0, QZnReq );
 		OnOffAirFlowRatio = Par( 6 );
 
-		CalcVRF( VRFTUNum, FirstHVACIteration, PartLoadRatio, ActualOutput, OnOffAirFlowRatio );
+		if ( VRFTUNum == PLRBoundsVRFTUNum && PartLoadRatio == 0.0 ) {
+			ActualOutput = PLRBoundsNoCompOutput;
+		} else if ( VRFTUNum == PLRBoundsVRFTUNum && PartLoadRatio == 1.0 ) {
+			ActualOutput = PLRBoundsFullOutput;
+		} else {
+			CalcVRF( VRFTUNum, FirstHVACIteration, PartLoadRatio, ActualOutput, OnOffAirFlowRatio );
+		}
 		PLRResidual = ( ActualOutput - QZnReq ) / QZnReqTemp;
 
 		return PLRResidual;
@@ -5954,28 +5975,14 @@ namespace HVACVariableRefrigerantFlow {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int NumTU; // loop counter
 		int TempTUIndex; // temp variable used to find max terminal unit limit
-		int MinOutputIndex; // index to TU with lowest load
-		Real64 MinOutput; // used when finding TU "max" capacity limit
 		Real64 RemainingCapacity; // decrement capacity counter to find limiting TU capacity [W]
 		Array1D< Real64 > Temp( NumTUInList, CapArray ); // temporary array for processing terminal units
-		Array1D< Real64 > Temp2( NumTUInList, Temp ); // temporary array for processing terminal units
 
 		RemainingCapacity = TotalCapacity;
 
 		// sort TU capacity from lowest to highest
-		for ( TempTUIndex = 1; TempTUIndex <= NumTUInList; ++TempTUIndex ) {
-			MinOutput = MaxCap;
-			for ( NumTU = 1; NumTU <= NumTUInList; ++NumTU ) {
-				if ( Temp2( NumTU ) < MinOutput ) {
-					MinOutput = Temp2( NumTU );
-					Temp( TempTUIndex ) = MinOutput;
-					MinOutputIndex = NumTU;
-				}
-			}
-			Temp2( MinOutputIndex ) = MaxCap;
-		}
+		std::sort( Temp.data(), Temp.data() + Temp.size() );
 
 		// find limit of "terminal unit" capacity so that sum of all TU's does not exceed condenser capacity
 		// if the terminal unit capacity multiplied by number of remaining TU's does not exceed remaining available, subtract and cycle
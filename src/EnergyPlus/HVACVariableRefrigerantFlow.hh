@@ -105,6 +105,9 @@ namespace HVACVariableRefrigerantFlow {
 	extern Array1D< Real64 > MinDeltaT; // minimum zone temperature difference from setpoint
 	extern Array1D< Real64 > SumCoolingLoads; // sum of cooling loads
 	extern Array1D< Real64 > SumHeatingLoads; // sum of heating loads
+	extern int PLRBoundsVRFTUNum; // TU whose outputs at PLR = 0 and 1 are kept for PLRResidual, 0 if none
+	extern Real64 PLRBoundsNoCompOutput; // output of that TU at PLR = 0 [W]
+	extern Real64 PLRBoundsFullOutput; // output of that TU at PLR = 1 [W]
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -20,6 +21,7 @@
 #include <DataMoistureBalance.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <HeatBalanceMovableInsulation.hh>
 #include <InputProcessor.hh>
@@ -113,6 +115,7 @@ namespace HeatBalFiniteDiffManager {
 	using DataHeatBalFanSys::TCondFDSourceNode;
 	using DataHeatBalFanSys::QPVSysSource;
 	using HeatBalanceMovableInsulation::EvalOutsideMovableInsulation;
+	using DataSystemVariables::CondFDTridiagonalSolver;
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:
@@ -1127,9 +1130,15 @@ namespace HeatBalFiniteDiffManager {
 					// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
 
 					if ( TotNodes != 1 ) {
-						for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
-							++i;
-							InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+						if ( CondFDTridiagonalSolver ) {
+							int const NumInterior( ConstructFD( ConstrNum ).NodeNumPoint( Lay ) - 1 );
+							InteriorNodeLineEqns( Delt, i + 1, i + NumInterior, Lay, Surf, TD, TDT, EnthOld, EnthNew );
+							i += max( NumInterior, 0 );
+						} else {
+							for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
+								++i;
+								InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+							}
 						}
 					}
 
@@ -1730,22 +1739,72 @@ namespace HeatBalFiniteDiffManager {
 
 		int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
 		auto const & mat( Material( MatLay ) );
-		auto const & matFD( MaterialFD( MatLay ) );
 
 		auto const TD_i( TD( i ) );
 
 		auto const TDT_m( TDT( i - 1 ) );
 		auto TDT_i( TDT( i ) );
 		auto const TDT_p( TDT( i + 1 ) );
-		auto const TDT_mi( ( TDT_m + TDT_i ) / 2.0 );
-		auto const TDT_ip( ( TDT_i + TDT_p ) / 2.0 );
+
+		Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
+		Real64 ktA2; // Thermal Inner conductivity in temperature equation
+		Real64 Cp; // Cp used // Will be changed if PCM
+		InteriorNodeProperties( i, MatLay, TD, TDT, EnthOld, EnthNew, ktA1, ktA2, Cp );
+
+		Real64 const RhoS( mat.Density );
+		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
+		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+		if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
+			Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
+			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA1 * ( TD( i + 1 ) - TD_i + TDT_p ) + ktA2 * ( TD( i - 1 ) - TD_i + TDT_m ) ) * inv2DelX ) ) / ( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
+		} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
+			Real64 const invDelX( 1.0 / DelX );
+			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA2 * TDT_m ) + ( ktA1 * TDT_p ) ) * invDelX ) / ( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
+		} else {
+			assert( false ); // Illegal CondFDSchemeType
+		}
+
+		// Limit clipping
+		if ( TDT_i < MinSurfaceTempLimit ) {
+			TDT_i = MinSurfaceTempLimit;
+		} else if ( TDT_i > MaxSurfaceTempLimit ) {
+			TDT_i = MaxSurfaceTempLimit;
+		}
+
+		TDT( i ) = TDT_i;
+	}
+
+	void
+	InteriorNodeProperties(
+		int const i, // Node Index
+		int const MatLay, // Material of the layer holding the node
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > const & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Real64 & ktA1, // Outer thermal conductivity, at the midpoint with node i+1
+		Real64 & ktA2, // Inner thermal conductivity, at the midpoint with node i-1
+		Real64 & Cp // Specific heat, from the enthalpy change over the time step for a phase change material
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates the temperature dependent conductivities and the specific heat of an interior
+		// node from the current iteration temperatures.
+
+		auto const & mat( Material( MatLay ) );
+		auto const & matFD( MaterialFD( MatLay ) );
+
+		auto const TD_i( TD( i ) );
+
+		auto const TDT_i( TDT( i ) );
+		auto const TDT_mi( ( TDT( i - 1 ) + TDT_i ) / 2.0 );
+		auto const TDT_ip( ( TDT_i + TDT( i + 1 ) ) / 2.0 );
 
 		//  Set Thermal Conductivity.  Can be constant, simple linear temp dep or multiple linear segment temp function dep.
 		auto const & matFD_TempCond( matFD.TempCond );
 		assert( matFD_TempCond.u2() >= 3 );
 		auto const lTC( matFD_TempCond.index( 2, 1 ) );
-		Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
-		Real64 ktA2; // Thermal Inner conductivity in temperature equation
 		if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
 			ktA1 = terpld( matFD.TempCond, TDT_ip, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
 			ktA2 = terpld( matFD.TempCond, TDT_mi, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
@@ -1759,7 +1818,7 @@ namespace HeatBalFiniteDiffManager {
 		}
 
 		Real64 const Cpo( mat.SpecHeat ); // Const Cp from input
-		Real64 Cp( Cpo ); // Cp used // Will be changed if PCM
+		Cp = Cpo;
 		auto const & matFD_TempEnth( matFD.TempEnth );
 		assert( matFD_TempEnth.u2() >= 3 );
 		auto const lTE( matFD_TempEnth.index( 2, 1 ) );
@@ -1771,27 +1830,94 @@ namespace HeatBalFiniteDiffManager {
 			}
 		} // Phase Change case
 
+	}
+
+	void
+	InteriorNodeLineEqns(
+		int const Delt, // Time Increment
+		int const iFirst, // First interior node of the layer
+		int const iLast, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew // New Nodal enthalpy
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the interior node equations of one layer together, in place of one InteriorNodeEqns
+		// sweep over them, holding the layer's boundary or interface nodes at their current values.
+
+		// METHODOLOGY EMPLOYED:
+		// The conductivities and the specific heat are evaluated at the current iteration temperatures,
+		// the phase change specific heat being the enthalpy change over the time step divided by the
+		// temperature change as in InteriorNodeEqns.  The resulting tridiagonal system is solved by the
+		// Thomas algorithm, so heat diffuses across the whole layer in one iteration instead of one node
+		// per sweep; the outer iterations still update the properties and the boundary nodes.
+
+		// REFERENCES:
+		// Patankar, S.V. 1980. Numerical Heat Transfer and Fluid Flow, Section 4.2-7 (TDMA).
+
+		static EP_THREAD_LOCAL std::vector< Real64 > Upper; // Coefficients of node i+1 in the eliminated system
+		static EP_THREAD_LOCAL std::vector< Real64 > Rhs; // Right hand sides, then of the eliminated system
+
+		int const ConstrNum( Surface( Surf ).Construction );
+		int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
+		auto const & mat( Material( MatLay ) );
 		Real64 const RhoS( mat.Density );
 		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
-		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
-		if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
-			Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
-			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA1 * ( TD( i + 1 ) - TD_i + TDT_p ) + ktA2 * ( TD( i - 1 ) - TD_i + TDT_m ) ) * inv2DelX ) ) / ( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
-		} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
-			Real64 const invDelX( 1.0 / DelX );
-			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA2 * TDT_m ) + ( ktA1 * TDT_p ) ) * invDelX ) / ( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
-		} else {
-			assert( false ); // Illegal CondFDSchemeType
+		Real64 const RhoS_DelX_Delt( RhoS * DelX / Delt );
+		bool const CrankNicholson( CondFDSchemeType == CrankNicholsonSecondOrder );
+		Real64 const invDelX( CrankNicholson ? 1.0 / ( 2.0 * DelX ) : 1.0 / DelX );
+		assert( CrankNicholson || ( CondFDSchemeType == FullyImplicitFirstOrder ) );
+
+		int const n( iLast - iFirst + 1 );
+		if ( n <= 0 ) return;
+		Upper.resize( n );
+		Rhs.resize( n );
+
+		// Forward elimination, the properties of each node taken before any node of the layer changes
+		Real64 ktA1;
+		Real64 ktA2;
+		Real64 Cp;
+		Real64 Diag;
+		for ( int k = 0; k < n; ++k ) {
+			int const i( iFirst + k );
+			InteriorNodeProperties( i, MatLay, TD, TDT, EnthOld, EnthNew, ktA1, ktA2, Cp );
+			Real64 const Cp_DelX_RhoS_Delt( Cp * RhoS_DelX_Delt );
+			Real64 const Aw( ktA2 * invDelX );
+			Real64 const Ae( ktA1 * invDelX );
+			Real64 R( Cp_DelX_RhoS_Delt * TD( i ) );
+			if ( CrankNicholson ) R += ( ktA1 * ( TD( i + 1 ) - TD( i ) ) + ktA2 * ( TD( i - 1 ) - TD( i ) ) ) * invDelX;
+			if ( k == 0 ) R += Aw * TDT( i - 1 );
+			if ( k == n - 1 ) R += Ae * TDT( i + 1 );
+			Real64 const Ap( Aw + Ae + Cp_DelX_RhoS_Delt );
+			if ( k == 0 ) {
+				Diag = Ap;
+				Rhs[ k ] = R / Diag;
+			} else {
+				Diag = Ap - Aw * Upper[ k - 1 ];
+				Rhs[ k ] = ( R + Aw * Rhs[ k - 1 ] ) / Diag;
+			}
+			Upper[ k ] = Ae / Diag;
 		}
 
-		// Limit clipping
-		if ( TDT_i < MinSurfaceTempLimit ) {
-			TDT_i = MinSurfaceTempLimit;
-		} else if ( TDT_i > MaxSurfaceTempLimit ) {
-			TDT_i = MaxSurfaceTempLimit;
+		// Back substitution with the limit clipping of InteriorNodeEqns
+		Real64 TDT_next( 0.0 );
+		for ( int k = n - 1; k >= 0; --k ) {
+			Real64 TDT_i( Rhs[ k ] );
+			if ( k < n - 1 ) TDT_i += Upper[ k ] * TDT_next;
+			if ( TDT_i < MinSurfaceTempLimit ) {
+				TDT_i = MinSurfaceTempLimit;
+			} else if ( TDT_i > MaxSurfaceTempLimit ) {
+				TDT_i = MaxSurfaceTempLimit;
+			}
+			TDT( iFirst + k ) = TDT_i;
+			TDT_next = TDT_i;
 		}
 
-		TDT( i ) = TDT_i;
 	}
 
 	void
@@ -336,6 +336,32 @@ namespace HeatBalFiniteDiffManager {
 		Array1< Real64 > & EnthNew // New Nodal enthalpy
 	);
 
+	void
+	InteriorNodeProperties(
+		int const i, // Node Index
+		int const MatLay, // Material of the layer holding the node
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > const & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Real64 & ktA1, // Outer thermal conductivity, at the midpoint with node i+1
+		Real64 & ktA2, // Inner thermal conductivity, at the midpoint with node i-1
+		Real64 & Cp // Specific heat, from the enthalpy change over the time step for a phase change material
+	);
+
+	void
+	InteriorNodeLineEqns(
+		int const Delt, // Time Increment
+		int const iFirst, // First interior node of the layer
+		int const iLast, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew // New Nodal enthalpy
+	);
+
 	void
 	IntInterfaceNodeEqns(
 		int const Delt, // Time Increment
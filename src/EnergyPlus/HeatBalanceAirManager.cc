@@ -431,6 +431,7 @@ namespace HeatBalanceAirManager {
 		int MixingNum;
 		int SourceCount;
 		int ReceivingCount;
+		Real64 ZoneMixingFlowSum; // sum of the design mixing flows into a receiving zone
 		int IsSourceZone;
 
 		// Formats
@@ -1952,8 +1953,16 @@ namespace HeatBalanceAirManager {
 				if ( ReceivingCount > 0 ) {
 					MassConservation( ZoneNum ).ZoneMixingReceivingPtr.allocate( ReceivingCount );
 					MassConservation( ZoneNum ).ZoneMixingReceivingFr.allocate( ReceivingCount );
+					ZoneMixingFlowSum = 0.0;
 					for ( Loop = 1; Loop <= ReceivingCount; ++Loop ) {
 						MassConservation( ZoneNum ).ZoneMixingReceivingPtr( Loop ) = ZoneMixingNum( Loop );
+						ZoneMixingFlowSum += Mixing( ZoneMixingNum( Loop ) ).DesignLevel;
+					}
+					// fraction of the zone mixed flow rate contributed by each mixing object, from the design levels
+					if ( ZoneMixingFlowSum > 0.0 ) {
+						for ( Loop = 1; Loop <= ReceivingCount; ++Loop ) {
+							MassConservation( ZoneNum ).ZoneMixingReceivingFr( Loop ) = Mixing( ZoneMixingNum( Loop ) ).DesignLevel / ZoneMixingFlowSum;
+						}
 					}
 				}
 			}
@@ -3129,10 +3138,6 @@ namespace HeatBalanceAirManager {
 		int NZ; // local index for zone number
 		int J; // local index for second zone in refrig door pair
 
-		int ZoneNum;               // zone counter
-		Real64 ZoneMixingFlowSum;  // sum of zone mixing flows for a zone
-		int NumOfMixingObjects;    // number of mixing objects for a receiving zone
-
 		//  Zero out time step variables
 		MTC = 0.0;
 		MVFC = 0.0;
@@ -3150,22 +3155,8 @@ namespace HeatBalanceAirManager {
 				Mixing(Loop).DesiredAirFlowRateSaved = Mixing(Loop).DesiredAirFlowRate;
 			}
 
-			// if zone air mass flow balance enforced calculate the fraction of
-			// contribution of each mixing object to a zone mixed flow rate, BAN Feb 2014
-			if (ZoneAirMassFlow.EnforceZoneMassBalance) {
-				for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
-					ZoneMixingFlowSum = 0.0;
-					NumOfMixingObjects = MassConservation(ZoneNum).NumReceivingZonesMixingObject;
-					for (Loop = 1; Loop <= NumOfMixingObjects; ++Loop) {
-						ZoneMixingFlowSum = ZoneMixingFlowSum + Mixing(Loop).DesignLevel;
-					}
-					if (ZoneMixingFlowSum > 0.0) {
-						for (Loop = 1; Loop <= NumOfMixingObjects; ++Loop) {
-							MassConservation(ZoneNum).ZoneMixingReceivingFr(Loop) = Mixing(Loop).DesignLevel / ZoneMixingFlowSum;
-						}
-					}
-				}
-			}
+			// The fraction of each mixing object in a receiving zone's mixed flow rate for the zone air
+			// mass flow balance depends only on the design levels and is set in GetSimpleAirModelInputs
 
 			// Process the scheduled CrossMixing for air heat balance
 			for ( Loop = 1; Loop <= TotCrossMixing; ++Loop ) {
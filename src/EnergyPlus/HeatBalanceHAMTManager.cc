@@ -1,6 +1,8 @@
 // C++ Headers
+#include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -132,11 +134,14 @@ namespace HeatBalanceHAMTManager {
 
 	bool latswitch( false ); // latent heat switch,
 	bool rainswitch( false ); // rain switch,
+	bool OneTimeFlag( true ); // Input is read and the cells set up on the first call
+	bool CellsSolvedInParallel( false ); // True while SolveHeatBalHAMTCells runs on several threads
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceHAMTManager:
 
 	// Object Data
 	Array1D< subcell > cells;
+	Array1D< MaterialLookupData > MaterialLookups; // Property table lookups of each material
 
 	// Functions
 
@@ -179,8 +184,7 @@ namespace HeatBalanceHAMTManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-
-		static bool OneTimeFlag( true );
+		// na
 
 		if ( OneTimeFlag ) {
 			OneTimeFlag = false;
@@ -193,6 +197,51 @@ namespace HeatBalanceHAMTManager {
 
 	}
 
+	void
+	ManageHeatBalHAMTSurfaces(
+		std::vector< int > const & SurfNums, // Surfaces to calculate
+		int const NumThreads, // Threads the surfaces may be shared out over
+		Array1< Real64 > & TempSurfInTmp, // Inside face temperatures, by surface
+		Array1< Real64 > & TempSurfOutTmp // Outside face temperatures, by surface
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Manages the Heat and Moisture Transfer calculations of several surfaces whose boundary
+		// conditions are all known, as ManageHeatBalHAMT does for one surface.
+
+		// METHODOLOGY EMPLOYED:
+		// The boundary cells are set and the results passed back one surface at a time, as they use
+		// the psychrometric caches.  The cell iterations in between only change the cells of their own
+		// surface, so the surfaces are shared out over the threads.
+
+		if ( OneTimeFlag ) {
+			OneTimeFlag = false;
+			DisplayString( "Initialising Heat and Moisture Transfer Model" );
+			GetHeatBalHAMTInput();
+			InitHeatBalHAMT();
+		}
+
+		int const nSurfs( SurfNums.size() );
+		for ( int i = 0; i < nSurfs; ++i ) {
+			SetHeatBalHAMTBoundaries( SurfNums[ i ] );
+		}
+		int const nThreads( max( 1, min( NumThreads, nSurfs ) ) );
+		CellsSolvedInParallel = ( nThreads > 1 );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads) if(nThreads > 1)
+#endif
+		for ( int i = 0; i < nSurfs; ++i ) {
+			SolveHeatBalHAMTCells( SurfNums[ i ] );
+		}
+		CellsSolvedInParallel = false;
+		for ( int i = 0; i < nSurfs; ++i ) {
+			int const sid( SurfNums[ i ] );
+			FinishHeatBalHAMT( sid, TempSurfInTmp( sid ), TempSurfOutTmp( sid ) );
+		}
+
+	}
+
 	void
 	GetHeatBalHAMTInput()
 	{
@@ -968,6 +1017,17 @@ namespace HeatBalanceHAMTManager {
 
 		}
 
+		MaterialLookups.allocate( TotMaterials );
+		for ( MaterNum = 1; MaterNum <= TotMaterials; ++MaterNum ) {
+			auto const & mat( Material( MaterNum ) );
+			auto & lookups( MaterialLookups( MaterNum ) );
+			SetupPropertyLookup( lookups.iso, mat.niso, mat.isorh );
+			SetupPropertyLookup( lookups.suc, mat.nsuc, mat.sucwater );
+			SetupPropertyLookup( lookups.red, mat.nred, mat.redwater );
+			SetupPropertyLookup( lookups.mu, mat.nmu, mat.murh );
+			SetupPropertyLookup( lookups.tc, mat.ntc, mat.tcwater );
+		}
+
 	}
 
 	void
@@ -993,16 +1053,13 @@ namespace HeatBalanceHAMTManager {
 		// na
 
 		// Using/Aliasing
-		using General::RoundSigDigits;
-		using DataSurfaces::OtherSideCondModeledExt;
-		using DataSurfaces::OSCM;
+		// na
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static std::string const HAMTExt( "HAMT-Ext" );
-		static std::string const HAMTInt( "HAMT-Int" );
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -1011,42 +1068,35 @@ namespace HeatBalanceHAMTManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 TempSurfInP;
+		// na
+
+		SetHeatBalHAMTBoundaries( sid );
+		SolveHeatBalHAMTCells( sid );
+		FinishHeatBalHAMT( sid, TempSurfInTmp, TempSurfOutTmp );
+
+	}
+
+	void
+	SetHeatBalHAMTBoundaries( int const sid )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the boundary cells of the surface from the current zone and outside conditions and
+		// resets the cells at the start of an environment.
+
+		// Using/Aliasing
+		using DataSurfaces::OtherSideCondModeledExt;
+		using DataSurfaces::OSCM;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const HAMTExt( "HAMT-Ext" );
+		static std::string const HAMTInt( "HAMT-Int" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 RhoIn;
 		Real64 RhoOut;
-		Real64 torsum;
-		Real64 oorsum;
-		Real64 phioosum;
-		Real64 phiorsum;
-		Real64 vpoosum;
-		Real64 vporsum;
-		Real64 rhr1;
-		Real64 rhr2;
-		Real64 wcap;
-		Real64 thermr1;
-		Real64 thermr2;
-		Real64 tcap;
-		Real64 qvp;
-		Real64 vaporr1;
-		Real64 vaporr2;
-		Real64 vpdiff;
-		Real64 sumtp1;
-		Real64 tempmax;
-		Real64 tempmin;
-
-		int ii;
 		int matid;
-		int itter;
 		int cid;
-		//unused1208    INTEGER :: cid1
-		int adj;
-		int adjl;
-
-		//    INTEGER, SAVE :: tempErrCount=0
-		static int qvpErrCount( 0 );
-		//    INTEGER, SAVE :: tempErrReport=0
-		static int qvpErrReport( 0 );
-		Real64 denominator;
 
 		if ( BeginEnvrnFlag && MyEnvrnFlag( sid ) ) {
 			cells( Extcell( sid ) ).rh = 0.0;
@@ -1167,6 +1217,64 @@ namespace HeatBalanceHAMTManager {
 			cells( cid ).rhp2 = cells( cid ).rh;
 		}
 
+	}
+
+	void
+	SolveHeatBalHAMTCells( int const sid )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Iterates the temperatures and relative humidities of the cells of a surface whose
+		// boundary cells have been set.
+
+		// METHODOLOGY EMPLOYED:
+		// Only the cells of the surface are changed, the saturation pressures are taken without the
+		// psychrometric cache while the surfaces are being solved on several threads, and the
+		// warnings are issued one thread at a time, so that ManageHeatBalHAMTSurfaces can solve
+		// surfaces side by side.  The vapor diffusion coefficient of each cell is kept from the
+		// update of its temperature instead of being evaluated for each of its neighbors.
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 torsum;
+		Real64 oorsum;
+		Real64 phioosum;
+		Real64 phiorsum;
+		Real64 vpoosum;
+		Real64 vporsum;
+		Real64 rhr1;
+		Real64 rhr2;
+		Real64 wcap;
+		Real64 thermr1;
+		Real64 thermr2;
+		Real64 tcap;
+		Real64 qvp;
+		Real64 vaporr1;
+		Real64 vaporr2;
+		Real64 vpdiff;
+		Real64 sumtp1;
+		Real64 tempmax;
+		Real64 tempmin;
+
+		int ii;
+		int matid;
+		int itter;
+		int cid;
+		int adj;
+		int adjl;
+
+		//    INTEGER, SAVE :: tempErrCount=0
+		static int qvpErrCount( 0 );
+		//    INTEGER, SAVE :: tempErrReport=0
+		static int qvpErrReport( 0 );
+		Real64 denominator;
+
+		static EP_THREAD_LOCAL std::vector< Real64 > CellWVDC; // Vapor diffusion coefficient in air of each cell (from firstcell)
+		int const cell0( firstcell( sid ) );
+		CellWVDC.resize( lastcell( sid ) - cell0 + 1 );
+
 		itter = 0;
 		while ( true ) {
 			++itter;
@@ -1174,18 +1282,21 @@ namespace HeatBalanceHAMTManager {
 
 			for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
 				matid = cells( cid ).matid;
-				cells( cid ).vp = RHtoVP( cells( cid ).rh, cells( cid ).temp );
-				cells( cid ).vpp1 = RHtoVP( cells( cid ).rhp1, cells( cid ).tempp1 );
-				cells( cid ).vpsat = PsyPsatFnTemp( cells( cid ).tempp1 );
+				cells( cid ).vp = cells( cid ).rh * HAMTPsat( cells( cid ).temp );
+				cells( cid ).vpp1 = cells( cid ).rhp1 * HAMTPsat( cells( cid ).tempp1 );
+				cells( cid ).vpsat = HAMTPsat( cells( cid ).tempp1 );
 				if ( matid > 0 ) {
-					interp( Material( matid ).niso, Material( matid ).isorh, Material( matid ).isodata, cells( cid ).rhp1, cells( cid ).water, cells( cid ).dwdphi );
+					auto const & mat( Material( matid ) );
+					auto const & lookups( MaterialLookups( matid ) );
+					interp( lookups.iso, mat.niso, mat.isorh, mat.isodata, cells( cid ).rhp1, cells( cid ).water, cells( cid ).dwdphi );
 					if ( IsRain && rainswitch ) {
-						interp( Material( matid ).nsuc, Material( matid ).sucwater, Material( matid ).sucdata, cells( cid ).water, cells( cid ).dw );
+						interp( lookups.suc, mat.nsuc, mat.sucwater, mat.sucdata, cells( cid ).water, cells( cid ).dw );
 					} else {
-						interp( Material( matid ).nred, Material( matid ).redwater, Material( matid ).reddata, cells( cid ).water, cells( cid ).dw );
+						interp( lookups.red, mat.nred, mat.redwater, mat.reddata, cells( cid ).water, cells( cid ).dw );
 					}
-					interp( Material( matid ).nmu, Material( matid ).murh, Material( matid ).mudata, cells( cid ).rhp1, cells( cid ).mu );
-					interp( Material( matid ).ntc, Material( matid ).tcwater, Material( matid ).tcdata, cells( cid ).water, cells( cid ).wthermalc );
+					interp( lookups.mu, mat.nmu, mat.murh, mat.mudata, cells( cid ).rhp1, cells( cid ).mu );
+					interp( lookups.tc, mat.ntc, mat.tcwater, mat.tcdata, cells( cid ).water, cells( cid ).wthermalc );
+					CellWVDC[ cid - cell0 ] = WVDC( cells( cid ).tempp1, OutBaroPress );
 				}
 			}
 
@@ -1198,6 +1309,7 @@ namespace HeatBalanceHAMTManager {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
 					if ( adj == -1 ) break;
+					assert( ( adj >= cell0 ) && ( adj <= lastcell( sid ) ) );
 
 					if ( cells( cid ).htc > 0 ) {
 						thermr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).htc );
@@ -1210,7 +1322,7 @@ namespace HeatBalanceHAMTManager {
 					if ( cells( cid ).vtc > 0 ) {
 						vaporr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).vtc );
 					} else if ( cells( cid ).matid > 0 ) {
-						vaporr1 = ( cells( cid ).dist( ii ) * cells( cid ).mu ) / ( cells( cid ).overlap( ii ) * WVDC( cells( cid ).tempp1, OutBaroPress ) );
+						vaporr1 = ( cells( cid ).dist( ii ) * cells( cid ).mu ) / ( cells( cid ).overlap( ii ) * CellWVDC[ cid - cell0 ] );
 					} else {
 						vaporr1 = 0.0;
 					}
@@ -1226,7 +1338,7 @@ namespace HeatBalanceHAMTManager {
 					if ( cells( adj ).vtc > 0 ) {
 						vaporr2 = 1.0 / ( cells( cid ).overlap( ii ) * cells( adj ).vtc );
 					} else if ( cells( adj ).matid > 0 ) {
-						vaporr2 = cells( adj ).mu * cells( adj ).dist( adjl ) / ( WVDC( cells( adj ).tempp1, OutBaroPress ) * cells( cid ).overlap( ii ) );
+						vaporr2 = cells( adj ).mu * cells( adj ).dist( adjl ) / ( CellWVDC[ adj - cell0 ] * cells( cid ).overlap( ii ) );
 					} else {
 						vaporr2 = 0.0;
 					}
@@ -1251,11 +1363,16 @@ namespace HeatBalanceHAMTManager {
 				}
 				if ( std::abs( qvp ) > qvplim ) {
 					if ( ! WarmupFlag ) {
-						++qvpErrCount;
-						if ( qvpErrCount < 16 ) {
-							ShowWarningError( "HeatAndMoistureTransfer: Large Latent Heat for Surface " + Surface( sid ).Name );
-						} else {
-							ShowRecurringWarningErrorAtEnd( "HeatAndMoistureTransfer: Large Latent Heat Errors ", qvpErrReport );
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (HAMTErrors)
+#endif
+						{
+							++qvpErrCount;
+							if ( qvpErrCount < 16 ) {
+								ShowWarningError( "HeatAndMoistureTransfer: Large Latent Heat for Surface " + Surface( sid ).Name );
+							} else {
+								ShowRecurringWarningErrorAtEnd( "HeatAndMoistureTransfer: Large Latent Heat Errors ", qvpErrReport );
+							}
 						}
 					}
 					qvp = 0.0;
@@ -1263,41 +1380,53 @@ namespace HeatBalanceHAMTManager {
 
 				// Calculate the temperature for the next time step
 				cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				if ( cells( cid ).matid > 0 ) CellWVDC[ cid - cell0 ] = WVDC( cells( cid ).tempp1, OutBaroPress );
 			}
 
 			//Check for silly temperatures
-			tempmax = maxval( cells.tempp1() );
-			tempmin = minval( cells.tempp1() );
-			if ( tempmax > MaxSurfaceTempLimit ) {
-				if ( ! WarmupFlag ) {
-					if ( Surface( sid ).HighTempErrCount == 0 ) {
-						ShowSevereMessage( "HAMT: Temperature (high) out of bounds (" + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
-						ShowContinueErrorTimeStamp( "" );
-					}
-					ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmax, tempmax, _, "C", "C" );
-				}
-			}
-			if ( tempmax > MaxSurfaceTempLimitBeforeFatal ) {
-				if ( ! WarmupFlag ) {
-					ShowSevereError( "HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
-					ShowContinueErrorTimeStamp( "" );
-					ShowFatalError( "Program terminates due to preceding condition." );
-				}
+			tempmax = cells( cell0 ).tempp1;
+			tempmin = cells( cell0 ).tempp1;
+			for ( cid = cell0 + 1; cid <= lastcell( sid ); ++cid ) {
+				tempmax = max( tempmax, cells( cid ).tempp1 );
+				tempmin = min( tempmin, cells( cid ).tempp1 );
 			}
-			if ( tempmin < MinSurfaceTempLimit ) {
-				if ( ! WarmupFlag ) {
-					if ( Surface( sid ).HighTempErrCount == 0 ) {
-						ShowSevereMessage( "HAMT: Temperature (low) out of bounds (" + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
-						ShowContinueErrorTimeStamp( "" );
+			if ( ( tempmax > MaxSurfaceTempLimit ) || ( tempmin < MinSurfaceTempLimit ) ) {
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (HAMTErrors)
+#endif
+				{
+					if ( tempmax > MaxSurfaceTempLimit ) {
+						if ( ! WarmupFlag ) {
+							if ( Surface( sid ).HighTempErrCount == 0 ) {
+								ShowSevereMessage( "HAMT: Temperature (high) out of bounds (" + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
+								ShowContinueErrorTimeStamp( "" );
+							}
+							ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmax, tempmax, _, "C", "C" );
+						}
+					}
+					if ( tempmax > MaxSurfaceTempLimitBeforeFatal ) {
+						if ( ! WarmupFlag ) {
+							ShowSevereError( "HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
+							ShowContinueErrorTimeStamp( "" );
+							ShowFatalError( "Program terminates due to preceding condition." );
+						}
+					}
+					if ( tempmin < MinSurfaceTempLimit ) {
+						if ( ! WarmupFlag ) {
+							if ( Surface( sid ).HighTempErrCount == 0 ) {
+								ShowSevereMessage( "HAMT: Temperature (low) out of bounds (" + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
+								ShowContinueErrorTimeStamp( "" );
+							}
+							ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmin, tempmin, _, "C", "C" );
+						}
+					}
+					if ( tempmin < MinSurfaceTempLimitBeforeFatal ) {
+						if ( ! WarmupFlag ) {
+							ShowSevereError( "HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
+							ShowContinueErrorTimeStamp( "" );
+							ShowFatalError( "Program terminates due to preceding condition." );
+						}
 					}
-					ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmin, tempmin, _, "C", "C" );
-				}
-			}
-			if ( tempmin < MinSurfaceTempLimitBeforeFatal ) {
-				if ( ! WarmupFlag ) {
-					ShowSevereError( "HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
-					ShowContinueErrorTimeStamp( "" );
-					ShowFatalError( "Program terminates due to preceding condition." );
 				}
 			}
 
@@ -1312,11 +1441,12 @@ namespace HeatBalanceHAMTManager {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
 					if ( adj == -1 ) break;
+					assert( ( adj >= cell0 ) && ( adj <= lastcell( sid ) ) );
 
 					if ( cells( cid ).vtc > 0 ) {
 						vaporr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).vtc );
 					} else if ( cells( cid ).matid > 0 ) {
-						vaporr1 = ( cells( cid ).dist( ii ) * cells( cid ).mu ) / ( cells( cid ).overlap( ii ) * WVDC( cells( cid ).tempp1, OutBaroPress ) );
+						vaporr1 = ( cells( cid ).dist( ii ) * cells( cid ).mu ) / ( cells( cid ).overlap( ii ) * CellWVDC[ cid - cell0 ] );
 					} else {
 						vaporr1 = 0.0;
 					}
@@ -1324,7 +1454,7 @@ namespace HeatBalanceHAMTManager {
 					if ( cells( adj ).vtc > 0 ) {
 						vaporr2 = 1.0 / ( cells( cid ).overlap( ii ) * cells( adj ).vtc );
 					} else if ( cells( adj ).matid > 0 ) {
-						vaporr2 = ( cells( adj ).dist( adjl ) * cells( adj ).mu ) / ( cells( cid ).overlap( ii ) * WVDC( cells( adj ).tempp1, OutBaroPress ) );
+						vaporr2 = ( cells( adj ).dist( adjl ) * cells( adj ).mu ) / ( cells( cid ).overlap( ii ) * CellWVDC[ adj - cell0 ] );
 					} else {
 						vaporr2 = 0.0;
 					}
@@ -1364,9 +1494,14 @@ namespace HeatBalanceHAMTManager {
 				if ( denominator != 0.0 ) {
 					cells( cid ).rhp1 = ( phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat ) / denominator;
 				} else {
-					ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
-					ShowContinueError( "...Problem occurs in Material=\"" + Material( cells( cid ).matid ).Name + "\"." );
-					ShowFatalError( "Program terminates due to preceding condition." );
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (HAMTErrors)
+#endif
+					{
+						ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
+						ShowContinueError( "...Problem occurs in Material=\"" + Material( cells( cid ).matid ).Name + "\"." );
+						ShowFatalError( "Program terminates due to preceding condition." );
+					}
 				}
 
 				if ( cells( cid ).rhp1 > rhmax ) {
@@ -1393,6 +1528,23 @@ namespace HeatBalanceHAMTManager {
 			}
 		}
 
+	}
+
+	void
+	FinishHeatBalHAMT(
+		int const sid,
+		Real64 & TempSurfInTmp,
+		Real64 & TempSurfOutTmp
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Passes the face temperatures and the inside face vapor density of a solved surface back
+		// to the surface heat balance.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 TempSurfInP;
+
 		// report back to CalcHeatBalanceInsideSurf
 		TempSurfOutTmp = cells( Extcell( sid ) ).tempp1;
 		TempSurfInTmp = cells( Intcell( sid ) ).tempp1;
@@ -1554,6 +1706,120 @@ namespace HeatBalanceHAMTManager {
 		}
 	}
 
+	void
+	SetupPropertyLookup(
+		PropertyLookupData & Lookup, // Lookup to set up
+		int const ndata, // Number of data points
+		Array1< Real64 > const & xx // Abscissae of the data points
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the uniform grid lookup into the data points of a property table.
+
+		// METHODOLOGY EMPLOYED:
+		// The range of the abscissae is split into equal intervals, each holding the first data point
+		// whose abscissa is not below the start of the interval.  Tables whose abscissae decrease
+		// somewhere get no grid and are searched from the start.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const IntervalsPerPoint( 4 ); // Grid intervals per data point
+
+		Lookup.FirstStep.clear();
+		if ( ndata < 3 ) return;
+		for ( int step = 2; step <= ndata; ++step ) {
+			if ( xx( step ) < xx( step - 1 ) ) return;
+		}
+		if ( xx( ndata ) <= xx( 1 ) ) return;
+
+		int const nIntervals( IntervalsPerPoint * ndata );
+		Lookup.XMin = xx( 1 );
+		Lookup.InvStep = nIntervals / ( xx( ndata ) - xx( 1 ) );
+		Lookup.FirstStep.resize( nIntervals );
+		int step( 2 );
+		for ( int Interval = 0; Interval < nIntervals; ++Interval ) {
+			Real64 const XStart( Lookup.XMin + Interval / Lookup.InvStep );
+			while ( ( step < ndata ) && ( xx( step ) < XStart ) ) ++step;
+			Lookup.FirstStep[ Interval ] = step;
+		}
+
+	}
+
+	void
+	interp(
+		PropertyLookupData const & Lookup,
+		int const ndata,
+		Array1< Real64 > const & xx,
+		Array1< Real64 > const & yy,
+		Real64 const invalue,
+		Real64 & outvalue,
+		Optional< Real64 > outgrad
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gives the same value and gradient as interp, starting the search at the data point the
+		// lookup gives for the value.
+
+		// METHODOLOGY EMPLOYED:
+		// The search ends at the first data point whose abscissa is not below the value, as in
+		// interp; the grid start is only corrected by the steps back and forth around it, so rounding
+		// in the grid cannot change the result.
+
+		Real64 mygrad( 0.0 );
+		outvalue = 0.0;
+
+		if ( ndata > 1 ) {
+			if ( ! ( invalue <= xx( ndata ) ) ) { // Beyond the table: the last value, as interp gives
+				outvalue = yy( ndata );
+			} else {
+				int step( 2 );
+				if ( ! Lookup.FirstStep.empty() && ( invalue > Lookup.XMin ) ) {
+					int const nIntervals( Lookup.FirstStep.size() );
+					step = Lookup.FirstStep[ min( int( ( invalue - Lookup.XMin ) * Lookup.InvStep ), nIntervals - 1 ) ];
+					while ( ( step > 2 ) && ( invalue <= xx( step - 1 ) ) ) --step;
+				}
+				while ( invalue > xx( step ) ) ++step;
+
+				Real64 const xxlow( xx( step - 1 ) );
+				Real64 const xxhigh( xx( step ) );
+				if ( xxhigh > xxlow ) {
+					mygrad = ( yy( step ) - yy( step - 1 ) ) / ( xxhigh - xxlow );
+					outvalue = ( invalue - xxlow ) * mygrad + yy( step - 1 );
+				} else if ( std::abs( xxhigh - xxlow ) < 0.0000000001 ) {
+					outvalue = yy( step - 1 );
+				}
+			}
+		}
+
+		if ( present( outgrad ) ) {
+			// return gradient if required
+			outgrad = mygrad;
+		}
+	}
+
+	Real64
+	HAMTPsat( Real64 const Temperature )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Saturation vapor pressure for the cell iterations.
+
+		// METHODOLOGY EMPLOYED:
+		// PsyPsatFnTemp, or while several surfaces are being solved at once the same value taken without
+		// the shared cache; temperatures for which the calculation may issue a warning are taken one
+		// thread at a time.
+
+		if ( ! CellsSolvedInParallel ) return PsyPsatFnTemp( Temperature );
+		if ( ( Temperature > -99.0 ) && ( Temperature < 199.0 ) ) return PsyPsatFnTemp_nocache( Temperature );
+		Real64 Psat;
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (HAMTErrors)
+#endif
+		Psat = PsyPsatFnTemp_nocache( Temperature );
+		return Psat;
+	}
+
 	Real64
 	RHtoVP(
 		Real64 const RH,
@@ -1,8 +1,12 @@
 #ifndef HeatBalanceHAMTManager_hh_INCLUDED
 #define HeatBalanceHAMTManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -56,6 +60,8 @@ namespace HeatBalanceHAMTManager {
 
 	extern bool latswitch; // latent heat switch,
 	extern bool rainswitch; // rain switch,
+	extern bool OneTimeFlag; // Input is read and the cells set up on the first call
+	extern bool CellsSolvedInParallel; // True while SolveHeatBalHAMTCells runs on several threads
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceHAMTManager:
 
@@ -196,8 +202,42 @@ namespace HeatBalanceHAMTManager {
 
 	};
 
+	struct PropertyLookupData
+	{
+		// Uniform grid over the abscissae of a material property table, so interp need not search
+		// the table from its start
+
+		// Members
+		Real64 XMin; // First abscissa of the table
+		Real64 InvStep; // Grid intervals per unit of the abscissa
+		std::vector< int > FirstStep; // First data point not below the start of each interval, empty if the table is searched from the start
+
+		// Default Constructor
+		PropertyLookupData() :
+			XMin( 0.0 ),
+			InvStep( 0.0 )
+		{}
+
+	};
+
+	struct MaterialLookupData
+	{
+		// Members
+		PropertyLookupData iso; // Isotherm, by RH
+		PropertyLookupData suc; // Liquid transport coefficient under suction, by water content
+		PropertyLookupData red; // Liquid transport coefficient under redistribution, by water content
+		PropertyLookupData mu; // Vapor diffusion resistance factor, by RH
+		PropertyLookupData tc; // Thermal conductivity, by water content
+
+		// Default Constructor
+		MaterialLookupData()
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< subcell > cells;
+	extern Array1D< MaterialLookupData > MaterialLookups; // Property table lookups of each material
 
 	// Functions
 
@@ -208,6 +248,14 @@ namespace HeatBalanceHAMTManager {
 		Real64 & TempSurfOutTmp
 	);
 
+	void
+	ManageHeatBalHAMTSurfaces(
+		std::vector< int > const & SurfNums, // Surfaces to calculate
+		int const NumThreads, // Threads the surfaces may be shared out over
+		Array1< Real64 > & TempSurfInTmp, // Inside face temperatures, by surface
+		Array1< Real64 > & TempSurfOutTmp // Outside face temperatures, by surface
+	);
+
 	void
 	GetHeatBalHAMTInput();
 
@@ -221,6 +269,19 @@ namespace HeatBalanceHAMTManager {
 		Real64 & TempSurfOutTmp
 	);
 
+	void
+	SetHeatBalHAMTBoundaries( int const sid );
+
+	void
+	SolveHeatBalHAMTCells( int const sid );
+
+	void
+	FinishHeatBalHAMT(
+		int const sid,
+		Real64 & TempSurfInTmp,
+		Real64 & TempSurfOutTmp
+	);
+
 	void
 	UpdateHeatBalHAMT( int const sid );
 
@@ -234,6 +295,27 @@ namespace HeatBalanceHAMTManager {
 		Optional< Real64 > outgrad = _
 	);
 
+	void
+	SetupPropertyLookup(
+		PropertyLookupData & Lookup, // Lookup to set up
+		int const ndata, // Number of data points
+		Array1< Real64 > const & xx // Abscissae of the data points
+	);
+
+	void
+	interp(
+		PropertyLookupData const & Lookup,
+		int const ndata,
+		Array1< Real64 > const & xx,
+		Array1< Real64 > const & yy,
+		Real64 const invalue,
+		Real64 & outvalue,
+		Optional< Real64 > outgrad = _
+	);
+
+	Real64
+	HAMTPsat( Real64 const Temperature );
+
 	Real64
 	RHtoVP(
 		Real64 const RH,
@@ -1,6 +1,8 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -92,7 +94,8 @@ namespace HeatBalanceIntRadExchange {
 		int const SurfIterations, // Number of iterations in calling subroutine
 		Array1< Real64 > & NetLWRadToSurf, // Net long wavelength radiant exchange from other surfaces
 		Optional_int_const ZoneToResimulate, // if passed in, then only calculate for this zone
-		std::string const & CalledFrom
+		std::string const & CalledFrom,
+		Optional< Array1_bool const > FrozenZone // if passed in, then the zones flagged true keep their last results
 	)
 	{
 
@@ -102,6 +105,7 @@ namespace HeatBalanceIntRadExchange {
 		//       MODIFIED       6/18/01, FCW: calculate IR on windows
 		//                      Jan 2002, FCW: add blinds with movable slats
 		//                      Sep 2011 LKL/BG - resimulate only zones needing it for Radiant systems
+		//                      Skip the zones whose inside surface temperatures are held by the caller
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -131,6 +135,7 @@ namespace HeatBalanceIntRadExchange {
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const StefanBoltzmannConst( 5.6697e-8 ); // Stefan-Boltzmann constant in W/(m2*K4)
+		int const MinThreadedZoneSurfaces( 64 ); // Zones with fewer surfaces are not worth sharing over threads
 		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
@@ -141,14 +146,10 @@ namespace HeatBalanceIntRadExchange {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool firstTime( true ); // Logical flag for one-time initializations
-		int RecSurfNum; // Counter within DO loop (refers to main surface derived type index) RECEIVING SURFACE
 		int SendSurfNum; // Counter within DO loop (refers to main surface derived type index) SENDING SURFACE
 
-		int ConstrNumRec; // Receiving surface construction number
 		int ConstrNumSend; // Sending surface construction number
-		Real64 RecSurfTemp; // Receiving surface temperature (C)
 		Real64 SendSurfTemp; // Sending surface temperature (C)
-		Real64 RecSurfEmiss; // Inside surface emissivity
 		int SurfNum; // Surface number
 		int ConstrNum; // Construction number
 		bool IntShadeOrBlindStatusChanged; // True if status of interior shade or blind on at least
@@ -158,7 +159,6 @@ namespace HeatBalanceIntRadExchange {
 
 		//variables added as part of strategy to reduce calculation time - Glazer 2011-04-22
 //		Real64 SendSurfTempInKTo4th; // Sending surface temperature in K to 4th power
-		Real64 RecSurfTempInKTo4th; // Receiving surface temperature in K to 4th power
 		static Array1D< Real64 > SendSurfaceTempInKto4thPrecalc;
 
 		// FLOW:
@@ -176,7 +176,11 @@ namespace HeatBalanceIntRadExchange {
 			firstTime = false;
 			if ( DeveloperFlag ) {
 				std::string tdstring;
+#ifdef HBIRE_USE_OMP
+				gio::write( tdstring, fmtLD ) << " OMP turned on, HBIRE receiving surfaces shared over threads=" << NumberIntRadThreads;
+#else
 				gio::write( tdstring, fmtLD ) << " OMP turned off, HBIRE loop executed in serial";
+#endif
 				DisplayString( tdstring );
 			}
 		}
@@ -202,11 +206,22 @@ namespace HeatBalanceIntRadExchange {
 		}
 #endif
 
-		ConstrNumRec = 0;
+		// The surface temperatures of a frozen zone have not changed since its last exchange, so its results are kept
+		bool const SkipFrozenZones( present( FrozenZone ) );
+
 		if ( PartialResimulate ) {
 			auto const & zone( Zone( ZoneToResimulate ) );
-			NetLWRadToSurf( {zone.SurfaceFirst,zone.SurfaceLast} ) = 0.0;
-			SurfaceWindow( {zone.SurfaceFirst,zone.SurfaceLast} ).IRfromParentZone() = 0.0;
+			if ( ! ( SkipFrozenZones && FrozenZone()( ZoneToResimulate ) ) ) {
+				NetLWRadToSurf( {zone.SurfaceFirst,zone.SurfaceLast} ) = 0.0;
+				SurfaceWindow( {zone.SurfaceFirst,zone.SurfaceLast} ).IRfromParentZone() = 0.0;
+			}
+		} else if ( SkipFrozenZones ) {
+			for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				auto const & zone( Zone( ZoneNum ) );
+				if ( FrozenZone()( ZoneNum ) || ( zone.SurfaceFirst == 0 ) ) continue;
+				NetLWRadToSurf( {zone.SurfaceFirst,zone.SurfaceLast} ) = 0.0;
+				SurfaceWindow( {zone.SurfaceFirst,zone.SurfaceLast} ).IRfromParentZone() = 0.0;
+			}
 		} else {
 			NetLWRadToSurf = 0.0;
 			SurfaceWindow.IRfromParentZone() = 0.0;
@@ -214,6 +229,8 @@ namespace HeatBalanceIntRadExchange {
 
 		for ( int ZoneNum = ( PartialResimulate ? ZoneToResimulate() : 1 ), ZoneNum_end = ( PartialResimulate ? ZoneToResimulate() : NumOfZones ); ZoneNum <= ZoneNum_end; ++ZoneNum ) {
 
+			if ( SkipFrozenZones && FrozenZone()( ZoneNum ) ) continue;
+
 			auto const & zone( Zone( ZoneNum ) );
 			auto & zone_info( ZoneInfo( ZoneNum ) );
 			auto & zone_ScriptF( zone_info.ScriptF ); //Tuned Transposed
@@ -262,7 +279,11 @@ namespace HeatBalanceIntRadExchange {
 						}
 					}
 
-					CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF );
+					if ( IntRadScriptFUpdate ) { // Update the kept inverse for the windows whose shade or blind changed
+						UpdateScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, BeginEnvrnFlag, zone_info.Cinverse, zone_info.CinverseEmissivity, zone_info.NumScriptFUpdates, zone_ScriptF );
+					} else {
+						CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF );
+					}
 					// precalc - multiply by StefanBoltzmannConstant
 					zone_ScriptF *= StefanBoltzmannConst;
 				}
@@ -296,13 +317,20 @@ namespace HeatBalanceIntRadExchange {
 			}
 
 			// These are the money loops
-			size_type lSR( 0u );
+			// Each receiving surface only writes its own results, so large zones share them over the threads
+			int const nThreads( n_zone_Surfaces >= MinThreadedZoneSurfaces ? NumberIntRadThreads : 1 );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(static) num_threads(nThreads) if(nThreads > 1)
+#endif
 			for ( size_type RecZoneSurfNum = 0; RecZoneSurfNum < s_zone_Surfaces; ++RecZoneSurfNum ) {
-				RecSurfNum = zone_SurfacePtr[ RecZoneSurfNum ];
-				ConstrNumRec = Surface( RecSurfNum ).Construction;
+				size_type lSR( RecZoneSurfNum * s_zone_Surfaces ); // [ lSR ] == ( 1, RecZoneSurfNum+1 )
+				int const RecSurfNum( zone_SurfacePtr[ RecZoneSurfNum ] ); // RECEIVING SURFACE
+				int const ConstrNumRec( Surface( RecSurfNum ).Construction ); // Receiving surface construction number
 				auto const & construct( Construct( ConstrNumRec ) );
 				auto & surface_window( SurfaceWindow( RecSurfNum ) );
 				auto & netLWRadToRecSurf( NetLWRadToSurf( RecSurfNum ) );
+				Real64 RecSurfTemp; // Receiving surface temperature (C)
+				Real64 RecSurfEmiss; // Inside surface emissivity
 				if ( construct.WindowTypeEQL ) {
 					RecSurfEmiss = EQLWindowInsideEffectiveEmiss( ConstrNumRec );
 					RecSurfTemp = surface_window.EffInsSurfTemp;
@@ -327,7 +355,7 @@ namespace HeatBalanceIntRadExchange {
 					RecSurfEmiss = construct.InsideAbsorpThermal;
 				}
 				// precalculate the fourth power of surface temperature as part of strategy to reduce calculation time - Glazer 2011-04-22
-				RecSurfTempInKTo4th = pow_4( RecSurfTemp + KelvinConv );
+				Real64 const RecSurfTempInKTo4th( pow_4( RecSurfTemp + KelvinConv ) ); // Receiving surface temperature in K to 4th power
 				//      IF (ABS(RecSurfTempInKTo4th) > 1.d100) THEN
 				//        SendZoneSurfNum=0
 				//      ENDIF
@@ -343,7 +371,7 @@ namespace HeatBalanceIntRadExchange {
 #ifdef EP_HBIRE_SEQ
 						Real64 const scriptF_temp_ink_4th( scriptF * SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] );
 #else
-						SendSurfNum = zone_SurfacePtr[ SendZoneSurfNum ] - 1;
+						int const SendSurfNum( zone_SurfacePtr[ SendZoneSurfNum ] - 1 );
 						Real64 const scriptF_temp_ink_4th( scriptF * SendSurfaceTempInKto4thPrecalc[ SendSurfNum ] );
 #endif
 						// Calculate interior LW incident on window rather than net LW for use in window layer heat balance calculation.
@@ -368,16 +396,15 @@ namespace HeatBalanceIntRadExchange {
 					netLWRadToRecSurf += IRfromParentZone_acc - netLWRadToRecSurf_cor - ( scriptF_acc * RecSurfTempInKTo4th );
 					surface_window.IRfromParentZone += IRfromParentZone_acc / RecSurfEmiss;
 				} else {
+					// The receiving surface's own term is exactly zero, so the loop needs no test for it
 					Real64 netLWRadToRecSurf_acc( 0.0 ); // Local accumulator
 					for ( size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum, ++lSR ) {
-						if ( RecZoneSurfNum != SendZoneSurfNum ) {
 #ifdef EP_HBIRE_SEQ
-							netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
+						netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendZoneSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
 #else
-							SendSurfNum = zone_SurfacePtr[ SendZoneSurfNum ] - 1;
-							netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
+						int const SendSurfNum( zone_SurfacePtr[ SendZoneSurfNum ] - 1 );
+						netLWRadToRecSurf_acc += zone_ScriptF[ lSR ] * ( SendSurfaceTempInKto4thPrecalc[ SendSurfNum ] - RecSurfTempInKTo4th ); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
 #endif
-						}
 					}
 					netLWRadToRecSurf += netLWRadToRecSurf_acc;
 				}
@@ -1241,7 +1268,7 @@ namespace HeatBalanceIntRadExchange {
 		//  A(i)*F(i,j)=A(j)*F(j,i); F(i,i)=0.; SUM(F(i,j)=1.0, j=1,N)
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const MaxEmissLimit( 0.99999 ); // Limit the emissivity internally/avoid a divide by zero error
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1265,6 +1292,29 @@ namespace HeatBalanceIntRadExchange {
 		++NumCalcScriptF_Calls;
 #endif
 
+		// The inverse is formed in ScriptF itself and turned into ScriptF in place, so large zones
+		// only need one extra N x N matrix
+		CalcScriptFInverse( N, A, F, EMISS, ScriptF );
+		CalcScriptFFromInverse( N, A, EMISS, ScriptF, ScriptF );
+
+	}
+
+	void
+	CalcScriptFInverse(
+		int const N, // Number of surfaces
+		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		Array2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
+		Array1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		Array2< Real64 > & Cinverse // Inverse of the partial radiosity coefficient matrix (N X N)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forms and inverts the (AF - EMISS/REFLECTANCE) matrix of the partial radiosity
+		// calculation of CalcScriptF.
+
+		assert( equal_dimensions( F, Cinverse ) );
+
 		// Load Cmatrix with AF (AREA * DIRECT VIEW FACTOR) matrix
 		Array2D< Real64 > Cmatrix( N, N ); // = (AF - EMISS/REFLECTANCE) matrix (but plays other roles)
 		assert( equal_dimensions( Cmatrix, F ) ); // For linear indexing
@@ -1276,50 +1326,210 @@ namespace HeatBalanceIntRadExchange {
 		}
 
 		// Load Cmatrix with (AF - EMISS/REFLECTANCE) matrix
-		Array1D< Real64 > Excite( N ); // Excitation vector = A*EMISS/REFLECTANCE
+		LimitScriptFEmissivity( N, EMISS );
 		l = 0u;
 		for ( int i = 1; i <= N; ++i, l += N + 1 ) {
-			Real64 EMISS_i( EMISS( i ) );
-			if ( EMISS_i > MaxEmissLimit ) { // Check/limit EMISS for this surface to avoid divide by zero below
-				EMISS_i = EMISS( i ) = MaxEmissLimit;
+			Cmatrix[ l ] -= A( i ) / ( 1.0 - EMISS( i ) ); // Coefficient matrix for partial radiosity calculation // [ l ] == ( i, i )
+		}
+
+		CalcMatrixInverse( Cmatrix, Cinverse ); // SOLVE THE LINEAR SYSTEM
+
+	}
+
+	void
+	CalcScriptFFromInverse(
+		int const N, // Number of surfaces
+		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		Array1< Real64 > const & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		Array2< Real64 > const & Cinverse, // Inverse of the partial radiosity coefficient matrix (N X N)
+		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed (may be Cinverse itself)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forms Hottel's ScriptF coefficients from the inverse given by CalcScriptFInverse.
+
+		// METHODOLOGY EMPLOYED:
+		// Each pair of transposed entries is read before either is written, so ScriptF can
+		// overwrite the inverse.
+
+		assert( equal_dimensions( Cinverse, ScriptF ) ); // For linear indexing
+
+		// Excitation vector = A*EMISS/REFLECTANCE, to scale the inverse columns
+		Array1D< Real64 > Excite( N );
+		for ( int i = 1; i <= N; ++i ) {
+			Real64 const EMISS_i( EMISS( i ) );
+			Excite( i ) = -EMISS_i * ( A( i ) / ( 1.0 - EMISS_i ) );
+		}
+
+		// Scale the inverse columns by excitation to get the partial radiosity matrix
+		// (Jmatrix(I,J) = Cinverse(I,J)*Excite(J)) and form Script F matrix transposed:
+		//        ScriptF(I,J) = EMISS(I)/(1.0d0-EMISS(I))*(Jmatrix(I,J)-Delta*EMISS(I))
+		Array1D< Real64 > EMISS_fac( N ); // EMISS(I)/(1.0d0-EMISS(I))
+		for ( int i = 1; i <= N; ++i ) {
+			EMISS_fac( i ) = EMISS( i ) / ( 1.0 - EMISS( i ) );
+		}
+		for ( int i = 1; i <= N; ++i ) {
+			Array2D< Real64 >::size_type ii( ScriptF.index( i, i ) );
+			ScriptF[ ii ] = EMISS_fac( i ) * ( Cinverse[ ii ] * Excite( i ) - EMISS( i ) ); // Delta=1
+			Array2D< Real64 >::size_type ij( ii + N ); // [ ij ] == ( i, j )
+			Array2D< Real64 >::size_type ji( ii + 1 ); // [ ji ] == ( j, i )
+			for ( int j = i + 1; j <= N; ++j, ij += N, ++ji ) { // Delta=0
+				Real64 const Jmatrix_ij( Cinverse[ ij ] * Excite( j ) );
+				Real64 const Jmatrix_ji( Cinverse[ ji ] * Excite( i ) );
+				ScriptF[ ij ] = EMISS_fac( j ) * Jmatrix_ji;
+				ScriptF[ ji ] = EMISS_fac( i ) * Jmatrix_ij;
+			}
+		}
+
+	}
+
+	void
+	LimitScriptFEmissivity(
+		int const N, // Number of surfaces
+		Array1< Real64 > & EMISS // VECTOR OF SURFACE EMISSIVITIES
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Limits the emissivities to avoid a divide by zero in the ScriptF calculation.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MaxEmissLimit( 0.99999 ); // Limit the emissivity internally/avoid a divide by zero error
+
+		for ( int i = 1; i <= N; ++i ) {
+			if ( EMISS( i ) > MaxEmissLimit ) { // Check/limit EMISS for this surface to avoid divide by zero below
+				EMISS( i ) = MaxEmissLimit;
 				ShowWarningError( "A thermal emissivity above 0.99999 was detected. This is not allowed. Value was reset to 0.99999" );
 			}
-			Real64 const EMISS_i_fac( A( i ) / ( 1.0 - EMISS_i ) );
-			Excite( i ) = -EMISS_i * EMISS_i_fac; // Set up matrix columns for partial radiosity calculation
-			Cmatrix[ l ] -= EMISS_i_fac; // Coefficient matrix for partial radiosity calculation // [ l ] == ( i, i )
 		}
 
-		Array2D< Real64 > Cinverse( N, N ); // Inverse of Cmatrix
-		CalcMatrixInverse( Cmatrix, Cinverse ); // SOLVE THE LINEAR SYSTEM
-		Cmatrix.clear(); // Release memory ASAP
+	}
 
-		// Scale Cinverse colums by excitation to get partial radiosity matrix
-		l = 0u;
-		for ( int j = 1; j <= N; ++j ) {
-			Real64 const e_j( Excite( j ) );
-			for ( int i = 1; i <= N; ++i, ++l ) {
-				Cinverse[ l ] *= e_j; // [ l ] == ( i, j )
+	void
+	UpdateScriptF(
+		int const N, // Number of surfaces
+		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		Array2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
+		Array1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		bool const Refresh, // Form the inverse from scratch
+		Array2D< Real64 > & Cinverse, // Inverse of the partial radiosity coefficient matrix, kept between calls
+		Array1D< Real64 > & CinverseEmiss, // Emissivities Cinverse was formed for
+		int & NumUpdates, // Number of updates of Cinverse since it was formed from scratch
+		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gives the same ScriptF coefficients as CalcScriptF, updating the kept inverse for the
+		// surfaces whose emissivity changed (window shades and blinds) instead of forming it again.
+
+		// METHODOLOGY EMPLOYED:
+		// A change of emissivity only changes the diagonal entry of the surface in the coefficient
+		// matrix, so with k changed surfaces the new inverse is a rank k update of the old one
+		// (Sherman-Morrison-Woodbury):
+		//   Cinverse' = Cinverse - Cinverse(:,K) * (D^-1 + Cinverse(K,K))^-1 * Cinverse(K,:)
+		// where D holds the changes of the diagonal entries.  This takes O(k N^2) operations
+		// instead of O(N^3).  The inverse is formed from scratch when asked for, when many
+		// surfaces changed, when the small system is badly conditioned and after a number of
+		// updates in a row, to keep round-off from building up.
+
+		// REFERENCES:
+		// Golub, G. H. and C. F. Van Loan, Matrix Computations, 3rd ed, Sec 2.1.3, Johns Hopkins, 1996.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MaxNumUpdates( 100 ); // Updates in a row before the inverse is formed from scratch
+
+		assert( equal_dimensions( F, ScriptF ) );
+
+		LimitScriptFEmissivity( N, EMISS );
+
+		std::vector< int > Changed; // Surfaces whose emissivity changed
+		bool Update( ! Refresh && Cinverse.isize1() == N && Cinverse.isize2() == N && CinverseEmiss.isize() == N && NumUpdates < MaxNumUpdates );
+		if ( Update ) {
+			for ( int i = 1; i <= N; ++i ) {
+				if ( EMISS( i ) != CinverseEmiss( i ) ) Changed.push_back( i );
 			}
+			Update = ( 4 * int( Changed.size() ) <= N );
 		}
-		Excite.clear(); // Release memory ASAP
 
-		// Form Script F matrix transposed
-		assert( equal_dimensions( Cinverse, ScriptF ) ); // For linear indexing
-		Array2D< Real64 >::size_type m( 0u );
-		for ( int i = 1; i <= N; ++i ) { // Inefficient order for cache but can reuse multiplier so faster choice depends on N
-			Real64 const EMISS_i( EMISS( i ) );
-			Real64 const EMISS_fac( EMISS_i / ( 1.0 - EMISS_i ) );
-			l = static_cast< Array2D< Real64 >::size_type >( i - 1 );
-			for ( int j = 1; j <= N; ++j, l += N, ++m ) {
-				if ( i == j ) {
-					//        ScriptF(I,J) = EMISS(I)/(1.0d0-EMISS(I))*(Jmatrix(I,J)-Delta*EMISS(I)), where Delta=1
-					ScriptF[ m ] = EMISS_fac * ( Cinverse[ l ] - EMISS_i ); // [ l ] = ( i, j ), [ m ] == ( j, i )
-				} else {
-					//        ScriptF(I,J) = EMISS(I)/(1.0d0-EMISS(I))*(Jmatrix(I,J)-Delta*EMISS(I)), where Delta=0
-					ScriptF[ m ] = EMISS_fac * Cinverse[ l ]; // [ l ] == ( i, j ), [ m ] == ( j, i )
+		if ( Update && ! Changed.empty() ) {
+			int const k( Changed.size() );
+
+			// Small system (D^-1 + Cinverse(K,K)) X = Cinverse(K,:)
+			Array2D< Real64 > Small( k, k ); // Small( a, b ) == ( a, b )
+			Array2D< Real64 > X( k, N ); // X( a, j ) == ( a, j )
+			for ( int a = 1; a <= k; ++a ) {
+				int const ia( Changed[ a - 1 ] );
+				for ( int b = 1; b <= k; ++b ) {
+					Small( a, b ) = Cinverse( ia, Changed[ b - 1 ] );
+				}
+				Real64 const Change( A( ia ) / ( 1.0 - CinverseEmiss( ia ) ) - A( ia ) / ( 1.0 - EMISS( ia ) ) ); // Change of the diagonal entry
+				if ( Change == 0.0 ) Update = false;
+				Small( a, a ) += ( Change != 0.0 ? 1.0 / Change : 0.0 );
+				for ( int j = 1; j <= N; ++j ) {
+					X( a, j ) = Cinverse( ia, j );
 				}
 			}
+
+			// Gauss elimination with partial pivoting
+			Real64 BadPivot( 0.0 ); // Pivots below this give up the update
+			for ( int a = 1; a <= k; ++a ) {
+				for ( int b = 1; b <= k; ++b ) BadPivot = max( BadPivot, std::abs( Small( a, b ) ) );
+			}
+			BadPivot *= 1.0e-12;
+			for ( int a = 1; a <= k && Update; ++a ) {
+				int Piv( a );
+				for ( int b = a + 1; b <= k; ++b ) {
+					if ( std::abs( Small( b, a ) ) > std::abs( Small( Piv, a ) ) ) Piv = b;
+				}
+				if ( std::abs( Small( Piv, a ) ) <= BadPivot ) {
+					Update = false;
+					break;
+				}
+				if ( Piv != a ) {
+					for ( int b = 1; b <= k; ++b ) std::swap( Small( a, b ), Small( Piv, b ) );
+					for ( int j = 1; j <= N; ++j ) std::swap( X( a, j ), X( Piv, j ) );
+				}
+				for ( int b = a + 1; b <= k; ++b ) {
+					Real64 const Multiplier( Small( b, a ) / Small( a, a ) );
+					if ( Multiplier == 0.0 ) continue;
+					for ( int c = a; c <= k; ++c ) Small( b, c ) -= Multiplier * Small( a, c );
+					for ( int j = 1; j <= N; ++j ) X( b, j ) -= Multiplier * X( a, j );
+				}
+			}
+			if ( Update ) {
+				for ( int a = k; a >= 1; --a ) {
+					for ( int b = a + 1; b <= k; ++b ) {
+						Real64 const Sab( Small( a, b ) );
+						for ( int j = 1; j <= N; ++j ) X( a, j ) -= Sab * X( b, j );
+					}
+					Real64 const Saa_inv( 1.0 / Small( a, a ) );
+					for ( int j = 1; j <= N; ++j ) X( a, j ) *= Saa_inv;
+				}
+
+				// Cinverse(i,:) -= Cinverse(i,K) * X
+				std::vector< Real64 > CinverseK( k );
+				for ( int i = 1; i <= N; ++i ) {
+					for ( int a = 1; a <= k; ++a ) CinverseK[ a - 1 ] = Cinverse( i, Changed[ a - 1 ] );
+					auto ij( Cinverse.index( i, 1 ) ); // [ ij ] == ( j, i )
+					for ( int j = 1; j <= N; ++j, ++ij ) {
+						Real64 Sum( 0.0 );
+						for ( int a = 1; a <= k; ++a ) Sum += CinverseK[ a - 1 ] * X( a, j );
+						Cinverse[ ij ] -= Sum;
+					}
+				}
+				++NumUpdates;
+			}
+		}
+
+		if ( ! Update ) { // Form the inverse from scratch
+			Cinverse.allocate( N, N );
+			CalcScriptFInverse( N, A, F, EMISS, Cinverse );
+			NumUpdates = 0;
 		}
+		CinverseEmiss = EMISS;
+		CalcScriptFFromInverse( N, A, EMISS, Cinverse, ScriptF );
 
 	}
 
@@ -1340,10 +1550,16 @@ namespace HeatBalanceIntRadExchange {
 
 		// METHODOLOGY EMPLOYED:
 		// Inverse is found using partial pivoting and Gauss elimination
+		// The matrices are held transposed, so the row operations are done a stored row at a time
+		// (contiguous in memory) and, for large matrices, the stored rows are shared over threads.
+		// Each entry sees the same operations in the same order as a row by row elimination.
 
 		// REFERENCES:
 		// Any Linear Algebra book
 
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MinThreadedSize( 128 ); // Smaller matrices are not worth sharing over threads
+
 		// Validation
 		assert( A.square() );
 		assert( A.I1() == A.I2() );
@@ -1354,6 +1570,7 @@ namespace HeatBalanceIntRadExchange {
 		int const u( A.u1() );
 		int const n( u - l + 1 );
 		I.to_identity(); // I starts out as identity
+		int const nThreads( n >= MinThreadedSize ? NumberIntRadThreads : 1 );
 
 		// Could do row scaling here to improve condition and then check min pivot isn't too small
 
@@ -1389,24 +1606,32 @@ namespace HeatBalanceIntRadExchange {
 
 			// Put multipliers in column i and reduce block below A(i,i)
 			Real64 const Aii_inv( 1.0 / A( i, i ) );
+			auto const ik_beg( A.index( i, i + 1 ) ); // [ ik ] == ( i, k )
 			for ( int k = i + 1; k <= u; ++k ) {
-				Real64 const multiplier( A( i, k ) * Aii_inv );
-				A( i, k ) = multiplier;
-				if ( multiplier != 0.0 ) {
-					auto ji( A.index( i + 1, i ) ); // [ ji ] == ( j, i )
-					auto jk( A.index( i + 1, k ) ); // [ jk ] == ( j, k )
-					for ( int j = i + 1; j <= u; ++j, ji += n, jk += n ) {
-						A[ jk ] -= multiplier * A[ ji ];
-					}
-					ji = A.index( l, i );
-					jk = A.index( l, k );
-					for ( int j = l; j <= u; ++j, ji += n, jk += n ) {
-						Real64 const Iij( I[ ji ] );
-						if ( Iij != 0.0 ) {
-							I[ jk ] -= multiplier * Iij;
+				A( i, k ) *= Aii_inv;
+			}
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(static) num_threads(nThreads) if(nThreads > 1)
+#endif
+			for ( int j = l; j <= u; ++j ) {
+				if ( j > i ) {
+					Real64 const Aij( A( j, i ) ); // == ( i, j )
+					if ( Aij != 0.0 ) {
+						auto ik( ik_beg );
+						auto jk( A.index( j, i + 1 ) ); // [ jk ] == ( j, k )
+						for ( int k = i + 1; k <= u; ++k, ++ik, ++jk ) {
+							A[ jk ] -= A[ ik ] * Aij;
 						}
 					}
 				}
+				Real64 const Iij( I( j, i ) ); // == ( i, j )
+				if ( Iij != 0.0 ) {
+					auto ik( ik_beg );
+					auto jk( I.index( j, i + 1 ) ); // [ jk ] == ( j, k )
+					for ( int k = i + 1; k <= u; ++k, ++ik, ++jk ) {
+						I[ jk ] -= A[ ik ] * Iij;
+					}
+				}
 			}
 
 		}
@@ -1414,17 +1639,16 @@ namespace HeatBalanceIntRadExchange {
 		// Perform back-substitution on [U|I] to put inverse in I
 		for ( int k = u; k >= l; --k ) {
 			Real64 const Akk_inv( 1.0 / A( k, k ) );
-			auto jk( A.index( l, k ) ); // [ jk ] == ( j, k )
-			for ( int j = l; j <= u; ++j, jk += n ) {
-				I[ jk ] *= Akk_inv;
-			}
-			auto ik( A.index( k, l ) ); // [ ik ] == ( i, k )
-			for ( int i = l; i < k; ++i, ++ik ) { // Eliminate kth column entries from I in rows above k
-				Real64 const Aik( A[ ik ] );
-				auto ji( A.index( l, i ) ); // [ ji ] == ( j, i )
-				auto jk( A.index( l, k ) ); // [ jk ] == ( k, j )
-				for ( int j = l; j <= u; ++j, ji += n, jk += n ) {
-					I[ ji ] -= Aik * I[ jk ];
+			auto const ki_beg( A.index( k, l ) ); // [ ki ] == ( i, k )
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(static) num_threads(nThreads) if(nThreads > 1)
+#endif
+			for ( int j = l; j <= u; ++j ) {
+				Real64 const Ikj( I( j, k ) *= Akk_inv ); // == ( k, j )
+				auto ki( ki_beg );
+				auto ji( I.index( j, l ) ); // [ ji ] == ( i, j )
+				for ( int i = l; i < k; ++i, ++ki, ++ji ) { // Eliminate kth column entries from I in rows above k
+					I[ ji ] -= A[ ki ] * Ikj;
 				}
 			}
 		}
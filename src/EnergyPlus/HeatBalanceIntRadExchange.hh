@@ -3,8 +3,10 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Array2A.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array2S.hh>
 #include <ObjexxFCL/Optional.hh>
 
@@ -36,7 +38,8 @@ namespace HeatBalanceIntRadExchange {
 		int const SurfIterations, // Number of iterations in calling subroutine
 		Array1< Real64 > & NetLWRadToSurf, // Net long wavelength radiant exchange from other surfaces
 		Optional_int_const ZoneToResimulate = _, // if passed in, then only calculate for this zone
-		std::string const & CalledFrom = ""
+		std::string const & CalledFrom = "",
+		Optional< Array1_bool const > FrozenZone = _ // if passed in, then the zones flagged true keep their last results
 	);
 
 	void
@@ -94,6 +97,43 @@ namespace HeatBalanceIntRadExchange {
 		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
 	);
 
+	void
+	CalcScriptFInverse(
+		int const N, // Number of surfaces
+		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		Array2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
+		Array1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		Array2< Real64 > & Cinverse // Inverse of the partial radiosity coefficient matrix (N X N)
+	);
+
+	void
+	CalcScriptFFromInverse(
+		int const N, // Number of surfaces
+		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		Array1< Real64 > const & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		Array2< Real64 > const & Cinverse, // Inverse of the partial radiosity coefficient matrix (N X N)
+		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed (may be Cinverse itself)
+	);
+
+	void
+	LimitScriptFEmissivity(
+		int const N, // Number of surfaces
+		Array1< Real64 > & EMISS // VECTOR OF SURFACE EMISSIVITIES
+	);
+
+	void
+	UpdateScriptF(
+		int const N, // Number of surfaces
+		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		Array2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
+		Array1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		bool const Refresh, // Form the inverse from scratch
+		Array2D< Real64 > & Cinverse, // Inverse of the partial radiosity coefficient matrix, kept between calls
+		Array1D< Real64 > & CinverseEmiss, // Emissivities Cinverse was formed for
+		int & NumUpdates, // Number of updates of Cinverse since it was formed from scratch
+		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+	);
+
 	void
 	CalcMatrixInverse(
 		Array2< Real64 > & A, // Matrix: Gets reduced to L\U form
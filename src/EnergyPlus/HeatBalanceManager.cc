@@ -13,6 +13,7 @@
 // EnergyPlus Headers
 #include <HeatBalanceManager.hh>
 #include <ConductionTransferFunctionCalc.hh>
+#include <CsvOutput.hh>
 #include <DataBSDFWindow.hh>
 #include <DataComplexFenestration.hh>
 #include <DataContaminantBalance.hh>
@@ -43,10 +44,12 @@
 #include <NodeInputManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportTabular.hh>
+#include <Profiler.hh>
 #include <ScheduleManager.hh>
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
 #include <UtilityRoutines.hh>
+#include <WarmupState.hh>
 #include <WindowComplexManager.hh>
 #include <WindowEquivalentLayer.hh>
 #include <WindowManager.hh>
@@ -234,6 +237,9 @@ namespace HeatBalanceManager {
 
 		// FLOW:
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "ManageHeatBalance" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		// Get the heat balance input at the beginning of the simulation only
 		if ( GetInputFlag ) {
 			GetHeatBalanceInput(); // Obtains heat balance related parameters from input file
@@ -268,10 +274,15 @@ namespace HeatBalanceManager {
 
 			CheckWarmupConvergence();
 			if ( ! WarmupFlag ) {
+				if ( ! DataSystemVariables::WarmupStateFileName.empty() ) WarmupState::SaveWarmupState();
+				WarmupState::WarmupSeeded = false;
 				DayOfSim = 0; // Reset DayOfSim if Warmup converged
 				DayOfSimChr = "0";
 
 				ManageEMS( emsCallFromBeginNewEvironmentAfterWarmUp ); // calling point
+			} else if ( DayOfSim == 1 ) {
+				// Continue the warmup from the converged state of an earlier run, if one was saved
+				WarmupState::WarmupSeeded = ( ! DataSystemVariables::WarmupStateFileName.empty() ) && WarmupState::RestoreWarmupState();
 			}
 
 		}
@@ -4866,7 +4877,7 @@ namespace HeatBalanceManager {
 
 			// Set warmup flag to true depending on value of ConvergenceChecksFailed (true=fail)
 			// and minimum number of warmup days
-			if ( ! ConvergenceChecksFailed && DayOfSim >= MinNumberOfWarmupDays ) {
+			if ( ! ConvergenceChecksFailed && ( DayOfSim >= MinNumberOfWarmupDays || WarmupState::WarmupSeeded ) ) {
 				WarmupFlag = false;
 			} else if ( ! ConvergenceChecksFailed && DayOfSim < MinNumberOfWarmupDays ) {
 				WarmupFlag = true;
@@ -5050,6 +5061,7 @@ namespace HeatBalanceManager {
 				if ( PrintEndDataDictionary && DoOutputReporting ) {
 					gio::write( OutputFileStandard, EndOfHeaderFormat );
 					gio::write( OutputFileMeters, EndOfHeaderFormat );
+					CsvOutput::EndCsvDictionary();
 					PrintEndDataDictionary = false;
 				}
 				if ( DoOutputReporting ) {
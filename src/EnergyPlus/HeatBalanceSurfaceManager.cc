@@ -133,7 +133,11 @@ namespace HeatBalanceSurfaceManager {
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	// na
+	bool CTFHistoryBatchesChanged( true ); // True when the CTF history batches must be regrouped
+
+	// Object Data
+	Array1D< CTFHistoryBatchData > CTFHistoryBatch; // Surfaces grouped by construction for the batched CTF history kernel
+	Array1D< SurfaceReportRequestData > SurfaceReportRequest; // Report quantities of each surface that are computed
 
 	// Subroutine Specifications for the Heat Balance Module
 	// Driver Routines
@@ -291,6 +295,7 @@ namespace HeatBalanceSurfaceManager {
 		using HeatBalanceIntRadExchange::CalcInteriorRadExchange;
 		using HeatBalFiniteDiffManager::InitHeatBalFiniteDiff;
 		using DataSystemVariables::GoodIOStatValue;
+		using DataSystemVariables::CTFReferenceKernel;
 		using DataGlobals::AnyEnergyManagementSystemInModel;
 		// RJH DElight Modification Begin
 		using namespace DElightManagerF;
@@ -309,13 +314,8 @@ namespace HeatBalanceSurfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int ConstrNum; // Construction index
 		int NZ; // DO loop counter for zones
-		Real64 QIC; // Intermediate calculation variable
-		Real64 QOC; // Intermediate calculation variable
 		int SurfNum; // DO loop counter for surfaces
-		int Term; // DO loop counter for conduction equation terms
-		Real64 TSC; // Intermediate calculation variable
 		int ZoneNum; // Counter for zone loop initialization
 
 		// RJH DElight Modification Begin
@@ -636,69 +636,22 @@ namespace HeatBalanceSurfaceManager {
 		CTFConstOutPart = 0.0;
 		CTFConstInPart = 0.0;
 		CTFTsrcConstPart = 0.0;
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
-			auto const & surface( Surface( SurfNum ) );
-
-			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
-			if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
-			if ( surface.Class == SurfaceClass_Window ) continue;
-			// Outside surface temp of "normal" windows not needed in Window5 calculation approach
-			// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
-
-			ConstrNum = surface.Construction;
-			auto const & construct( Construct( ConstrNum ) );
-			if ( construct.NumCTFTerms > 1 ) { // COMPUTE CONSTANT PORTION OF CONDUCTIVE FLUXES.
-
-				QIC = 0.0;
-				QOC = 0.0;
-				TSC = 0.0;
-				auto l11( TH.index( 1, 2, SurfNum ) );
-				auto l12( TH.index( 2, 2, SurfNum ) );
-				auto const s3( TH.size3() );
-				for ( Term = 1; Term <= construct.NumCTFTerms; ++Term, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
-
-					// Sign convention for the various terms in the following two equations
-					// is based on the form of the Conduction Transfer Function equation
-					// given by:
-					// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
-					// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
-					// In both equations, flux is positive from outside to inside.
-
-					//Tuned Aliases and linear indexing
-					Real64 const ctf_cross( construct.CTFCross( Term ) );
-					Real64 const ctf_flux( construct.CTFFlux( Term ) );
-					Real64 const TH11( TH[ l11 ] );
-					Real64 const TH12( TH[ l12 ] );
-
-					QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + construct.CTFFlux( Term ) * QH[ l12 ];
+		if ( CTFReferenceKernel ) { // Scalar per-surface reference path
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
+				auto const & surface( Surface( SurfNum ) );
 
-					QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + construct.CTFFlux( Term ) * QH[ l11 ];
+				if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+				if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
+				if ( surface.Class == SurfaceClass_Window ) continue;
+				// Outside surface temp of "normal" windows not needed in Window5 calculation approach
+				// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
 
-					if ( construct.SourceSinkPresent ) {
-						Real64 const QsrcHist1( QsrcHist( SurfNum, Term + 1 ) );
+				CalcCTFHistoryTerms( SurfNum );
 
-						QIC += construct.CTFSourceIn( Term ) * QsrcHist1;
-
-						QOC += construct.CTFSourceOut( Term ) * QsrcHist1;
-
-						TSC += construct.CTFTSourceOut( Term ) * TH11 + construct.CTFTSourceIn( Term ) * TH12 + construct.CTFTSourceQ( Term ) * QsrcHist1 + construct.CTFFlux( Term ) * TsrcHist( SurfNum, Term + 1 );
-					}
-
-				}
-
-				CTFConstOutPart( SurfNum ) = QOC;
-				CTFConstInPart( SurfNum ) = QIC;
-				CTFTsrcConstPart( SurfNum ) = TSC;
-
-			} else { // Number of CTF Terms = 1-->Resistance only constructions have no history terms.
-
-				CTFConstOutPart( SurfNum ) = 0.0;
-				CTFConstInPart( SurfNum ) = 0.0;
-				CTFTsrcConstPart( SurfNum ) = 0.0;
-
-			}
-
-		} // ...end of surfaces DO loop for initializing temperature history terms for the surface heat balances
+			} // ...end of surfaces DO loop for initializing temperature history terms for the surface heat balances
+		} else {
+			CalcCTFHistoryTermsBatched();
+		}
 
 		// Zero out all of the radiant system heat balance coefficient arrays
 		RadSysTiHBConstCoef = 0.0;
@@ -1299,7 +1252,9 @@ namespace HeatBalanceSurfaceManager {
 		DisplayString( "Setting up Surface Reporting Variables" );
 
 		// Setup surface report variables CurrentModuleObject='Opaque Surfaces'
+		SurfaceReportRequest.allocate( TotSurfaces );
 		for ( loop = 1; loop <= TotSurfaces; ++loop ) {
+			SetSurfaceReportRequests( loop );
 			if ( ! Surface( loop ).HeatTransSurf ) continue;
 			SetupOutputVariable( "Surface Inside Face Temperature [C]", TempSurfInRep( loop ), "Zone", "State", Surface( loop ).Name );
 			SetupOutputVariable( "Surface Outside Face Temperature [C]", TempSurfOut( loop ), "Zone", "State", Surface( loop ).Name );
@@ -1425,6 +1380,39 @@ namespace HeatBalanceSurfaceManager {
 
 	}
 
+	void
+	SetSurfaceReportRequests( int const SurfNum ) // Surface number
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds which groups of report quantities of the surface feed an output variable
+		// requested for the simulation, so ReportSurfaceHeatBalance only computes those.
+
+		// METHODOLOGY EMPLOYED:
+		// A group is computed when any output variable set up on it is requested for the
+		// surface.  None of these quantities are metered.
+
+		auto & request( SurfaceReportRequest( SurfNum ) );
+		std::string const & Name( Surface( SurfNum ).Name );
+
+		if ( ! Surface( SurfNum ).HeatTransSurf ) {
+			request.RadNetIn = request.RadSolarIn = request.RadLightsIn = request.RadIntGainsIn = request.RadHVACIn = false;
+			request.InsFaceCond = request.ExtFaceCond = request.AvgFaceCond = request.Storage = false;
+			return;
+		}
+
+		request.RadNetIn = OutputVariableRequested( "Surface Inside Face Net Surface Thermal Radiation Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Inside Face Net Surface Thermal Radiation Heat Gain Rate per Area", Name ) || OutputVariableRequested( "Surface Inside Face Net Surface Thermal Radiation Heat Gain Energy", Name );
+		request.RadSolarIn = OutputVariableRequested( "Surface Inside Face Solar Radiation Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Inside Face Solar Radiation Heat Gain Rate per Area", Name ) || OutputVariableRequested( "Surface Inside Face Solar Radiation Heat Gain Energy", Name );
+		request.RadLightsIn = OutputVariableRequested( "Surface Inside Face Lights Radiation Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Inside Face Lights Radiation Heat Gain Rate per Area", Name ) || OutputVariableRequested( "Surface Inside Face Lights Radiation Heat Gain Energy", Name );
+		request.RadIntGainsIn = OutputVariableRequested( "Surface Inside Face Internal Gains Radiation Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Inside Face Internal Gains Radiation Heat Gain Rate per Area", Name ) || OutputVariableRequested( "Surface Inside Face Internal Gains Radiation Heat Gain Energy", Name );
+		request.RadHVACIn = OutputVariableRequested( "Surface Inside Face System Radiation Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Inside Face System Radiation Heat Gain Rate per Area", Name ) || OutputVariableRequested( "Surface Inside Face System Radiation Heat Gain Energy", Name );
+		request.InsFaceCond = OutputVariableRequested( "Surface Inside Face Conduction Heat Transfer Energy", Name ) || OutputVariableRequested( "Surface Inside Face Conduction Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Inside Face Conduction Heat Loss Rate", Name );
+		request.ExtFaceCond = OutputVariableRequested( "Surface Outside Face Conduction Heat Transfer Energy", Name ) || OutputVariableRequested( "Surface Outside Face Conduction Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Outside Face Conduction Heat Loss Rate", Name );
+		request.AvgFaceCond = OutputVariableRequested( "Surface Average Face Conduction Heat Transfer Rate", Name ) || OutputVariableRequested( "Surface Average Face Conduction Heat Gain Rate", Name ) || OutputVariableRequested( "Surface Average Face Conduction Heat Loss Rate", Name ) || OutputVariableRequested( "Surface Average Face Conduction Heat Transfer Rate per Area", Name ) || OutputVariableRequested( "Surface Average Face Conduction Heat Transfer Energy", Name );
+		request.Storage = OutputVariableRequested( "Surface Heat Storage Rate", Name ) || OutputVariableRequested( "Surface Heat Storage Gain Rate", Name ) || OutputVariableRequested( "Surface Heat Storage Loss Rate", Name ) || OutputVariableRequested( "Surface Heat Storage Rate per Area", Name ) || OutputVariableRequested( "Surface Heat Storage Energy", Name );
+
+	}
+
 	void
 	InitThermalAndFluxHistories()
 	{
@@ -3523,6 +3511,8 @@ namespace HeatBalanceSurfaceManager {
 
 		if ( ! SurfConstructOverridesPresent ) return;
 
+		CTFHistoryBatchesChanged = true; // Surface constructions may change below
+
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 
 			if ( Surface( SurfNum ).EMSConstructionOverrideON && ( Surface( SurfNum ).EMSConstructionOverrideValue > 0 ) ) {
@@ -3630,6 +3620,182 @@ namespace HeatBalanceSurfaceManager {
 
 	}
 
+	void
+	BuildCTFHistoryBatches()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Groups the CTF/EMPD opaque heat transfer surfaces by construction for the batched
+		// CTF history kernel.
+
+		// METHODOLOGY EMPLOYED:
+		// Constructions with history terms and without an embedded source/sink get one batch
+		// each, holding their surfaces in ascending order.  Surfaces that are not batched are
+		// handled by the scalar per-surface path (CalcCTFHistoryTerms).
+
+		Array1D_int BatchOfConstr( TotConstructs, 0 ); // Batch index of each construction
+
+		CTFHistoryBatch.deallocate();
+		int NumBatches( 0 );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( ! surface.HeatTransSurf ) continue;
+			if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
+			if ( surface.Class == SurfaceClass_Window ) continue;
+			int const ConstrNum( surface.Construction );
+			auto const & construct( Construct( ConstrNum ) );
+			if ( ( construct.NumCTFTerms <= 1 ) || construct.SourceSinkPresent ) continue;
+			if ( BatchOfConstr( ConstrNum ) == 0 ) {
+				BatchOfConstr( ConstrNum ) = ++NumBatches;
+				CTFHistoryBatch.redimension( NumBatches );
+				CTFHistoryBatch( NumBatches ).ConstrNum = ConstrNum;
+				CTFHistoryBatch( NumBatches ).NumCTFTerms = construct.NumCTFTerms;
+			}
+			CTFHistoryBatch( BatchOfConstr( ConstrNum ) ).SurfNums.push_back( SurfNum );
+		}
+
+		CTFHistoryBatchesChanged = false;
+
+	}
+
+	void
+	CalcCTFHistoryTerms( int const SurfNum ) // Surface number
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Computes the constant (history) portion of the conductive fluxes and of the source
+		// temperature of one surface.  This is the scalar reference for the batched kernel.
+
+		// METHODOLOGY EMPLOYED:
+		// Sum over the CTF history terms of the surface construction.
+
+		auto const & construct( Construct( Surface( SurfNum ).Construction ) );
+		if ( construct.NumCTFTerms > 1 ) { // COMPUTE CONSTANT PORTION OF CONDUCTIVE FLUXES.
+
+			Real64 QIC( 0.0 ); // Intermediate calculation variable
+			Real64 QOC( 0.0 ); // Intermediate calculation variable
+			Real64 TSC( 0.0 ); // Intermediate calculation variable
+			auto l11( TH.index( 1, 2, SurfNum ) );
+			auto l12( TH.index( 2, 2, SurfNum ) );
+			auto const s3( TH.size3() );
+			for ( int Term = 1; Term <= construct.NumCTFTerms; ++Term, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
+
+				// Sign convention for the various terms in the following two equations
+				// is based on the form of the Conduction Transfer Function equation
+				// given by:
+				// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
+				// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
+				// In both equations, flux is positive from outside to inside.
+
+				//Tuned Aliases and linear indexing
+				Real64 const ctf_cross( construct.CTFCross( Term ) );
+				Real64 const ctf_flux( construct.CTFFlux( Term ) );
+				Real64 const TH11( TH[ l11 ] );
+				Real64 const TH12( TH[ l12 ] );
+
+				QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + ctf_flux * QH[ l12 ];
+
+				QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + ctf_flux * QH[ l11 ];
+
+				if ( construct.SourceSinkPresent ) {
+					Real64 const QsrcHist1( QsrcHist( SurfNum, Term + 1 ) );
+
+					QIC += construct.CTFSourceIn( Term ) * QsrcHist1;
+
+					QOC += construct.CTFSourceOut( Term ) * QsrcHist1;
+
+					TSC += construct.CTFTSourceOut( Term ) * TH11 + construct.CTFTSourceIn( Term ) * TH12 + construct.CTFTSourceQ( Term ) * QsrcHist1 + ctf_flux * TsrcHist( SurfNum, Term + 1 );
+				}
+
+			}
+
+			CTFConstOutPart( SurfNum ) = QOC;
+			CTFConstInPart( SurfNum ) = QIC;
+			CTFTsrcConstPart( SurfNum ) = TSC;
+
+		} else { // Number of CTF Terms = 1-->Resistance only constructions have no history terms.
+
+			CTFConstOutPart( SurfNum ) = 0.0;
+			CTFConstInPart( SurfNum ) = 0.0;
+			CTFTsrcConstPart( SurfNum ) = 0.0;
+
+		}
+
+	}
+
+	void
+	CalcCTFHistoryTermsBatched()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Computes the constant (history) portion of the conductive fluxes of all CTF/EMPD
+		// opaque surfaces, evaluating the surfaces that share a construction together.
+
+		// METHODOLOGY EMPLOYED:
+		// Within a batch the CTF coefficients of a term are loop invariant, so the inner loop
+		// over the batch surfaces is a plain multiply-add stream over the surface-contiguous
+		// TH/QH history planes that the compiler can vectorize for the target instruction set.
+		// Each surface still accumulates its terms in the same order as CalcCTFHistoryTerms.
+		// Surfaces outside the batches (source/sink and resistance-only constructions) use the
+		// scalar path.
+
+		static std::vector< Real64 > QIC; // Inside accumulators of the current batch
+		static std::vector< Real64 > QOC; // Outside accumulators of the current batch
+		static std::vector< int > ScalarSurfs; // CTF/EMPD opaque surfaces not handled by a batch
+
+		//Tuned Assure the surface index is the contiguous dimension of the history arrays
+		assert( equal_dimensions( TH, QH ) );
+		assert( ( TotSurfaces < 2 ) || ( TH.index( 1, 1, 2 ) == TH.index( 1, 1, 1 ) + 1 ) );
+
+		if ( CTFHistoryBatchesChanged ) {
+			BuildCTFHistoryBatches();
+			ScalarSurfs.clear();
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				auto const & surface( Surface( SurfNum ) );
+				if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+				if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
+				if ( surface.Class == SurfaceClass_Window ) continue;
+				auto const & construct( Construct( surface.Construction ) );
+				if ( ( construct.NumCTFTerms <= 1 ) || construct.SourceSinkPresent ) ScalarSurfs.push_back( SurfNum );
+			}
+		}
+
+		for ( int BatchNum = 1, BatchNum_end = CTFHistoryBatch.u(); BatchNum <= BatchNum_end; ++BatchNum ) {
+			auto const & batch( CTFHistoryBatch( BatchNum ) );
+			auto const & construct( Construct( batch.ConstrNum ) );
+			int const * const surfs( batch.SurfNums.data() );
+			int const n( batch.SurfNums.size() );
+			QIC.assign( n, 0.0 );
+			QOC.assign( n, 0.0 );
+			Real64 * const qic( QIC.data() );
+			Real64 * const qoc( QOC.data() );
+			for ( int Term = 1; Term <= batch.NumCTFTerms; ++Term ) {
+				Real64 const ctf_outside( construct.CTFOutside( Term ) );
+				Real64 const ctf_cross( construct.CTFCross( Term ) );
+				Real64 const ctf_inside( construct.CTFInside( Term ) );
+				Real64 const ctf_flux( construct.CTFFlux( Term ) );
+				auto const l1( TH.index( 1, Term + 1, 1 ) - 1 ); // [ l1 + SurfNum ] == ( 1, Term + 1, SurfNum )
+				auto const l2( TH.index( 2, Term + 1, 1 ) - 1 ); // [ l2 + SurfNum ] == ( 2, Term + 1, SurfNum )
+				for ( int k = 0; k < n; ++k ) {
+					Real64 const TH11( TH[ l1 + surfs[ k ] ] );
+					Real64 const TH12( TH[ l2 + surfs[ k ] ] );
+					qic[ k ] += ctf_cross * TH11 - ctf_inside * TH12 + ctf_flux * QH[ l2 + surfs[ k ] ];
+					qoc[ k ] += ctf_outside * TH11 - ctf_cross * TH12 + ctf_flux * QH[ l1 + surfs[ k ] ];
+				}
+			}
+			for ( int k = 0; k < n; ++k ) {
+				CTFConstOutPart( surfs[ k ] ) = qoc[ k ];
+				CTFConstInPart( surfs[ k ] ) = qic[ k ];
+				CTFTsrcConstPart( surfs[ k ] ) = 0.0;
+			}
+		}
+
+		for ( int const SurfNum : ScalarSurfs ) { // Source/sink and resistance-only constructions
+			CalcCTFHistoryTerms( SurfNum );
+		}
+
+	}
+
 	// End Initialization Section of the Module
 	//******************************************************************************
 
@@ -3788,35 +3954,50 @@ namespace HeatBalanceSurfaceManager {
 			FirstTimeFlag = false;
 		}
 
-		auto const l111( TH.index( 1, 1, 1 ) );
-		auto const l211( TH.index( 2, 1, 1 ) );
-		auto l11( l111 );
-		auto l21( l211 );
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum, ++l11, ++l21 ) { // Loop through all (heat transfer) surfaces...  [ l11 ] = ( 1, 1, SurfNum ), [ l21 ] = ( 2, 1, SurfNum )
+		// Pack the CTF surfaces into the history hot-state block so the current flux equations below
+		// run with unit stride over contiguous coefficient and temperature arrays
+		static std::vector< int > HistorySurfs;
+		HistorySurfs.clear();
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			auto const & surface( Surface( SurfNum ) );
 
 			if ( surface.Class == SurfaceClass_Window || ! surface.HeatTransSurf ) continue;
 
 			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) ) continue;
 
-			int const ConstrNum( surface.Construction );
-			auto const & construct( Construct( ConstrNum ) );
+			if ( Construct( surface.Construction ).NumCTFTerms == 0 ) continue; // Skip surfaces with no history terms
 
-			if ( construct.NumCTFTerms == 0 ) continue; // Skip surfaces with no history terms
+			HistorySurfs.push_back( SurfNum );
+		}
+		auto & HotState( HistorySurfHotState );
+		PackSurfaceHotState( HotState, HistorySurfs );
+		int const nHistorySurfs( HotState.NumSurfs );
+		for ( int i = 1; i <= nHistorySurfs; ++i ) {
+			SurfNum = HotState.SurfNum( i );
+			HotState.TempOut( i ) = TH( 1, 1, SurfNum );
+			HotState.TempIn( i ) = TempSurfIn( SurfNum );
+		}
 
-			// Sign convention for the various terms in the following two equations
-			// is based on the form of the Conduction Transfer Function equation
-			// given by:
-			// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old) + (Sum of)(V Qsrc)
-			// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old) + (Sum of)(W Qsrc)
-			// In both equations, flux is positive from outside to inside.  The V and W terms are for radiant systems only.
+		// Sign convention for the various terms in the following two equations
+		// is based on the form of the Conduction Transfer Function equation
+		// given by:
+		// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old) + (Sum of)(V Qsrc)
+		// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old) + (Sum of)(W Qsrc)
+		// In both equations, flux is positive from outside to inside.  The V and W terms are for radiant systems only.
+		for ( int i = 1; i <= nHistorySurfs; ++i ) {
+			HotState.QIn( i ) = HotState.TempOut( i ) * HotState.CTFCross0( i ) - HotState.TempIn( i ) * HotState.CTFInside0( i ) + HotState.QsrcHist1( i ) * HotState.CTFSourceIn0( i ) + HotState.CTFConstIn( i ); // Heat source/sink term for radiant systems
+			HotState.QOut( i ) = HotState.TempOut( i ) * HotState.CTFOutside0( i ) - HotState.TempIn( i ) * HotState.CTFCross0( i ) + HotState.QsrcHist1( i ) * HotState.CTFSourceOut0( i ) + HotState.CTFConstOut( i ); // Heat source/sink term for radiant systems
+		}
 
-			Real64 const QsrcHist1( QsrcHist( SurfNum, 1 ) );
+		for ( int i = 1; i <= nHistorySurfs; ++i ) { // Scatter the fluxes back to the (heat transfer) surfaces...
+			SurfNum = HotState.SurfNum( i );
+			auto const l11( TH.index( 1, 1, SurfNum ) );
+			auto const l21( TH.index( 2, 1, SurfNum ) );
 
 			// Set current inside flux:
-			Real64 const QH_12 = QH[ l21 ] = TH[ l11 ] * construct.CTFCross( 0 ) - TempSurfIn( SurfNum ) * construct.CTFInside( 0 ) + QsrcHist1 * construct.CTFSourceIn( 0 ) + CTFConstInPart( SurfNum ); // Heat source/sink term for radiant systems
-			if ( surface.Class == SurfaceClass_Floor || surface.Class == SurfaceClass_Wall || surface.Class == SurfaceClass_IntMass || surface.Class == SurfaceClass_Roof || surface.Class == SurfaceClass_Door ) {
-				OpaqSurfInsFaceConduction( SurfNum ) = surface.Area * QH_12;
+			Real64 const QH_12 = QH[ l21 ] = HotState.QIn( i );
+			if ( HotState.OpaqueClass( i ) ) {
+				OpaqSurfInsFaceConduction( SurfNum ) = HotState.Area( i ) * QH_12;
 				OpaqSurfInsFaceConductionFlux( SurfNum ) = QH_12; //CR 8901
 				//      IF (Surface(SurfNum)%Class/=SurfaceClass_IntMass)  &
 				//      ZoneOpaqSurfInsFaceCond(Surface(SurfNum)%Zone) = ZoneOpaqSurfInsFaceCond(Surface(SurfNum)%Zone) + &
@@ -3831,25 +4012,28 @@ namespace HeatBalanceSurfaceManager {
 			}
 
 			// Update the temperature at the source/sink location (if one is present)
+			auto const & construct( Construct( HotState.ConstrNum( i ) ) );
 			if ( construct.SourceSinkPresent ) {
-				TempSource( SurfNum ) = TsrcHist( SurfNum, 1 ) = TH[ l11 ] * construct.CTFTSourceOut( 0 ) + TempSurfIn( SurfNum ) * construct.CTFTSourceIn( 0 ) + QsrcHist1 * construct.CTFTSourceQ( 0 ) + CTFTsrcConstPart( SurfNum );
+				TempSource( SurfNum ) = TsrcHist( SurfNum, 1 ) = TH[ l11 ] * construct.CTFTSourceOut( 0 ) + TempSurfIn( SurfNum ) * construct.CTFTSourceIn( 0 ) + HotState.QsrcHist1( i ) * construct.CTFTSourceQ( 0 ) + CTFTsrcConstPart( SurfNum );
 			}
 
-			if ( surface.ExtBoundCond > 0 ) continue; // Don't need to evaluate outside for partitions
+			if ( HotState.ExtBoundCond( i ) > 0 ) continue; // Don't need to evaluate outside for partitions
 
 			// Set current outside flux:
-			QH[ l11 ] = TH[ l11 ] * construct.CTFOutside( 0 ) - TempSurfIn( SurfNum ) * construct.CTFCross( 0 ) + QsrcHist1 * construct.CTFSourceOut( 0 ) + CTFConstOutPart( SurfNum ); // Heat source/sink term for radiant systems
+			QH[ l11 ] = HotState.QOut( i );
 
-			if ( surface.Class == SurfaceClass_Floor || surface.Class == SurfaceClass_Wall || surface.Class == SurfaceClass_IntMass || surface.Class == SurfaceClass_Roof || surface.Class == SurfaceClass_Door ) {
+			if ( HotState.OpaqueClass( i ) ) {
 				OpaqSurfOutsideFaceConductionFlux( SurfNum ) = -QH[ l11 ]; // switch sign for balance at outside face
-				OpaqSurfOutsideFaceConduction( SurfNum ) = surface.Area * OpaqSurfOutsideFaceConductionFlux( SurfNum );
+				OpaqSurfOutsideFaceConduction( SurfNum ) = HotState.Area( i ) * OpaqSurfOutsideFaceConductionFlux( SurfNum );
 
 			}
 
 		} // ...end of loop over all (heat transfer) surfaces...
 
-		l11 = l111;
-		l21 = l211;
+		auto const l111( TH.index( 1, 1, 1 ) );
+		auto const l211( TH.index( 2, 1, 1 ) );
+		auto l11( l111 );
+		auto l21( l211 );
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum, ++l11, ++l21 ) { // Loop through all (heat transfer) surfaces...  [ l11 ] = ( 1, 1, SurfNum ), [ l21 ] = ( 2, 1, SurfNum )
 			auto const & surface( Surface( SurfNum ) );
 
@@ -4136,20 +4320,28 @@ namespace HeatBalanceSurfaceManager {
 
 		ReportSurfaceShading();
 
-		// update inside face radiation reports
+		// update inside face radiation reports, skipping the quantities no requested output variable uses
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-			QdotRadNetSurfInRep( SurfNum ) = NetLWRadToSurf( SurfNum ) * Surface( SurfNum ).Area;
-			QdotRadNetSurfInRepPerArea( SurfNum ) = NetLWRadToSurf( SurfNum );
-			QRadNetSurfInReport( SurfNum ) = QdotRadNetSurfInRep( SurfNum ) * TimeStepZoneSec;
+			auto const & request( SurfaceReportRequest( SurfNum ) );
+			if ( request.RadNetIn ) {
+				QdotRadNetSurfInRep( SurfNum ) = NetLWRadToSurf( SurfNum ) * Surface( SurfNum ).Area;
+				QdotRadNetSurfInRepPerArea( SurfNum ) = NetLWRadToSurf( SurfNum );
+				QRadNetSurfInReport( SurfNum ) = QdotRadNetSurfInRep( SurfNum ) * TimeStepZoneSec;
+			}
 
 			if ( Surface( SurfNum ).Class != SurfaceClass_Window ) { // not a window...
-				QdotRadSolarInRepPerArea( SurfNum ) = QRadSWInAbs( SurfNum ) - QRadSWLightsInAbs( SurfNum );
-				QdotRadSolarInRep( SurfNum ) = QdotRadSolarInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
-				QRadSolarInReport( SurfNum ) = QdotRadSolarInRep( SurfNum ) * TimeStepZoneSec;
+				// the load component report also uses the solar and lights radiation
+				if ( request.RadSolarIn || ( ZoneSizingCalc && CompLoadReportIsReq ) ) {
+					QdotRadSolarInRepPerArea( SurfNum ) = QRadSWInAbs( SurfNum ) - QRadSWLightsInAbs( SurfNum );
+					QdotRadSolarInRep( SurfNum ) = QdotRadSolarInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
+					QRadSolarInReport( SurfNum ) = QdotRadSolarInRep( SurfNum ) * TimeStepZoneSec;
+				}
 
-				QdotRadLightsInRepPerArea( SurfNum ) = QRadSWLightsInAbs( SurfNum );
-				QdotRadLightsInRep( SurfNum ) = QdotRadLightsInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
-				QRadLightsInReport( SurfNum ) = QdotRadLightsInRep( SurfNum ) * TimeStepZoneSec;
+				if ( request.RadLightsIn || ( ZoneSizingCalc && CompLoadReportIsReq ) ) {
+					QdotRadLightsInRepPerArea( SurfNum ) = QRadSWLightsInAbs( SurfNum );
+					QdotRadLightsInRep( SurfNum ) = QdotRadLightsInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
+					QRadLightsInReport( SurfNum ) = QdotRadLightsInRep( SurfNum ) * TimeStepZoneSec;
+				}
 
 				if ( ZoneSizingCalc && CompLoadReportIsReq ) {
 					TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
@@ -4160,61 +4352,72 @@ namespace HeatBalanceSurfaceManager {
 
 			}
 
-			QdotRadIntGainsInRepPerArea( SurfNum ) = QRadThermInAbs( SurfNum );
-			QdotRadIntGainsInRep( SurfNum ) = QdotRadIntGainsInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
-			QRadIntGainsInReport( SurfNum ) = QdotRadIntGainsInRep( SurfNum ) * TimeStepZoneSec;
+			if ( request.RadIntGainsIn ) {
+				QdotRadIntGainsInRepPerArea( SurfNum ) = QRadThermInAbs( SurfNum );
+				QdotRadIntGainsInRep( SurfNum ) = QdotRadIntGainsInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
+				QRadIntGainsInReport( SurfNum ) = QdotRadIntGainsInRep( SurfNum ) * TimeStepZoneSec;
+			}
 
-			QdotRadHVACInRepPerArea( SurfNum ) = QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum );
-			QdotRadHVACInRep( SurfNum ) = QdotRadHVACInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
-			QRadHVACInReport( SurfNum ) = QdotRadHVACInRep( SurfNum ) * TimeStepZoneSec;
+			if ( request.RadHVACIn ) {
+				QdotRadHVACInRepPerArea( SurfNum ) = QHTRadSysSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum );
+				QdotRadHVACInRep( SurfNum ) = QdotRadHVACInRepPerArea( SurfNum ) * Surface( SurfNum ).Area;
+				QRadHVACInReport( SurfNum ) = QdotRadHVACInRep( SurfNum ) * TimeStepZoneSec;
+			}
 
 			if ( Surface( SurfNum ).Class == SurfaceClass_Floor || Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_IntMass || Surface( SurfNum ).Class == SurfaceClass_Roof || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
-				// inside face conduction updates
-				OpaqSurfInsFaceConductionEnergy( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum ) * TimeStepZoneSec;
+				// inside face conduction updates (the zone sums are always needed)
 				ZoneOpaqSurfInsFaceCond( Surface( SurfNum ).Zone ) += OpaqSurfInsFaceConduction( SurfNum );
-				OpaqSurfInsFaceCondGainRep( SurfNum ) = 0.0;
-				OpaqSurfInsFaceCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfInsFaceConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfInsFaceCondGainRep( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum );
-				} else {
-					OpaqSurfInsFaceCondLossRep( SurfNum ) = -OpaqSurfInsFaceConduction( SurfNum );
+				if ( request.InsFaceCond ) {
+					OpaqSurfInsFaceConductionEnergy( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum ) * TimeStepZoneSec;
+					OpaqSurfInsFaceCondGainRep( SurfNum ) = 0.0;
+					OpaqSurfInsFaceCondLossRep( SurfNum ) = 0.0;
+					if ( OpaqSurfInsFaceConduction( SurfNum ) >= 0.0 ) {
+						OpaqSurfInsFaceCondGainRep( SurfNum ) = OpaqSurfInsFaceConduction( SurfNum );
+					} else {
+						OpaqSurfInsFaceCondLossRep( SurfNum ) = -OpaqSurfInsFaceConduction( SurfNum );
+					}
 				}
 
 				// outside face conduction updates
-				OpaqSurfOutsideFaceConductionEnergy( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum ) * TimeStepZoneSec;
 				ZoneOpaqSurfExtFaceCond( Surface( SurfNum ).Zone ) += OpaqSurfOutsideFaceConduction( SurfNum );
-				OpaqSurfExtFaceCondGainRep( SurfNum ) = 0.0;
-				OpaqSurfExtFaceCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfOutsideFaceConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfExtFaceCondGainRep( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum );
-				} else {
-					OpaqSurfExtFaceCondLossRep( SurfNum ) = -OpaqSurfOutsideFaceConduction( SurfNum );
+				if ( request.ExtFaceCond ) {
+					OpaqSurfOutsideFaceConductionEnergy( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum ) * TimeStepZoneSec;
+					OpaqSurfExtFaceCondGainRep( SurfNum ) = 0.0;
+					OpaqSurfExtFaceCondLossRep( SurfNum ) = 0.0;
+					if ( OpaqSurfOutsideFaceConduction( SurfNum ) >= 0.0 ) {
+						OpaqSurfExtFaceCondGainRep( SurfNum ) = OpaqSurfOutsideFaceConduction( SurfNum );
+					} else {
+						OpaqSurfExtFaceCondLossRep( SurfNum ) = -OpaqSurfOutsideFaceConduction( SurfNum );
+					}
 				}
 
 				// do average surface conduction updates
-
-				OpaqSurfAvgFaceConduction( SurfNum ) = ( OpaqSurfInsFaceConduction( SurfNum ) - OpaqSurfOutsideFaceConduction( SurfNum ) ) / 2.0;
-				OpaqSurfAvgFaceConductionFlux( SurfNum ) = ( OpaqSurfInsFaceConductionFlux( SurfNum ) - OpaqSurfOutsideFaceConductionFlux( SurfNum ) ) / 2.0;
-				OpaqSurfAvgFaceConductionEnergy( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum ) * TimeStepZoneSec;
-				OpaqSurfAvgFaceCondGainRep( SurfNum ) = 0.0;
-				OpaqSurfAvgFaceCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfAvgFaceConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfAvgFaceCondGainRep( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum );
-				} else {
-					OpaqSurfAvgFaceCondLossRep( SurfNum ) = -OpaqSurfAvgFaceConduction( SurfNum );
+				if ( request.AvgFaceCond ) {
+					OpaqSurfAvgFaceConduction( SurfNum ) = ( OpaqSurfInsFaceConduction( SurfNum ) - OpaqSurfOutsideFaceConduction( SurfNum ) ) / 2.0;
+					OpaqSurfAvgFaceConductionFlux( SurfNum ) = ( OpaqSurfInsFaceConductionFlux( SurfNum ) - OpaqSurfOutsideFaceConductionFlux( SurfNum ) ) / 2.0;
+					OpaqSurfAvgFaceConductionEnergy( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum ) * TimeStepZoneSec;
+					OpaqSurfAvgFaceCondGainRep( SurfNum ) = 0.0;
+					OpaqSurfAvgFaceCondLossRep( SurfNum ) = 0.0;
+					if ( OpaqSurfAvgFaceConduction( SurfNum ) >= 0.0 ) {
+						OpaqSurfAvgFaceCondGainRep( SurfNum ) = OpaqSurfAvgFaceConduction( SurfNum );
+					} else {
+						OpaqSurfAvgFaceCondLossRep( SurfNum ) = -OpaqSurfAvgFaceConduction( SurfNum );
+					}
 				}
 
 				// do surface storage rate updates
-				OpaqSurfStorageConductionFlux( SurfNum ) = -( OpaqSurfInsFaceConductionFlux( SurfNum ) + OpaqSurfOutsideFaceConductionFlux( SurfNum ) );
-				OpaqSurfStorageConduction( SurfNum ) = -( OpaqSurfInsFaceConduction( SurfNum ) + OpaqSurfOutsideFaceConduction( SurfNum ) );
-				OpaqSurfStorageConductionEnergy( SurfNum ) = OpaqSurfStorageConduction( SurfNum ) * TimeStepZoneSec;
-				OpaqSurfStorageGainRep( SurfNum ) = 0.0;
-				OpaqSurfStorageCondLossRep( SurfNum ) = 0.0;
-				if ( OpaqSurfStorageConduction( SurfNum ) >= 0.0 ) {
-					OpaqSurfStorageGainRep( SurfNum ) = OpaqSurfStorageConduction( SurfNum );
-				} else {
-					OpaqSurfStorageCondLossRep( SurfNum ) = -OpaqSurfStorageConduction( SurfNum );
+				if ( request.Storage ) {
+					OpaqSurfStorageConductionFlux( SurfNum ) = -( OpaqSurfInsFaceConductionFlux( SurfNum ) + OpaqSurfOutsideFaceConductionFlux( SurfNum ) );
+					OpaqSurfStorageConduction( SurfNum ) = -( OpaqSurfInsFaceConduction( SurfNum ) + OpaqSurfOutsideFaceConduction( SurfNum ) );
+					OpaqSurfStorageConductionEnergy( SurfNum ) = OpaqSurfStorageConduction( SurfNum ) * TimeStepZoneSec;
+					OpaqSurfStorageGainRep( SurfNum ) = 0.0;
+					OpaqSurfStorageCondLossRep( SurfNum ) = 0.0;
+					if ( OpaqSurfStorageConduction( SurfNum ) >= 0.0 ) {
+						OpaqSurfStorageGainRep( SurfNum ) = OpaqSurfStorageConduction( SurfNum );
+					} else {
+						OpaqSurfStorageCondLossRep( SurfNum ) = -OpaqSurfStorageConduction( SurfNum );
+					}
 				}
 
 			} // opaque heat transfer surfaces.
@@ -4822,6 +5025,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using HeatBalFiniteDiffManager::ManageHeatBalFiniteDiff;
 	using HeatBalFiniteDiffManager::SurfaceFD;
 	using HeatBalanceHAMTManager::ManageHeatBalHAMT;
+	using HeatBalanceHAMTManager::ManageHeatBalHAMTSurfaces;
 	using HeatBalanceHAMTManager::UpdateHeatBalHAMT;
 	using ConvectionCoefficients::InitExteriorConvectionCoeff;
 	using ConvectionCoefficients::InitInteriorConvectionCoeffs;
@@ -4844,6 +5048,9 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using namespace DataTimings;
 	using WindowEquivalentLayer::EQLWindowOutsideEffectiveEmiss;
 	using SwimmingPool::SimSwimmingPool;
+	using DataSystemVariables::NumberInsideSurfThreads;
+	using DataSystemVariables::ParallelLoopThreads;
+	using DataSystemVariables::InsideSurfaceZoneMasking;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4851,6 +5058,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	// SUBROUTINE PARAMETER DEFINITIONS:
 	Real64 const Sigma( 5.6697e-08 ); // Stefan-Boltzmann constant
 	Real64 const IterDampConst( 5.0 ); // Damping constant for inside surface temperature iterations
+	int const MinReentrantSurfsPerThread( 64 ); // Smallest share of the partitioned sweep worth handing to a thread
 	int const ItersReevalConvCoeff( 30 ); // Number of iterations between inside convection coefficient reevaluations
 	Real64 const MaxAllowedDelTemp( 0.002 ); // Convergence criteria for inside surface temperatures
 	int const MaxIterations( 500 ); // Maximum number of iterations allowed for inside surface temps
@@ -4907,6 +5115,11 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	Real64 NodeTemp;
 	Real64 CpAir;
 	static Array1D< Real64 > RefAirTemp; // reference air temperatures
+	static Array1D_bool ReentrantInsideSurf; // True if the surface is handled by the partitioned (threadable) sweep
+	static Array1D_bool HAMTSweepSurf; // True if the surface is handled by the HAMT surface sweep
+	static Array1D_bool MaskableZone; // True if the zone has only CTF surfaces, which may be held once converged
+	static Array1D_bool FrozenZone; // True while the zone's surfaces are held at their converged temperatures
+	static Array1D< Real64 > ZoneMaxDelTemp; // Largest opaque surface temperature change of the zone in the iteration
 	static bool MyEnvrnFlag( true );
 	//  LOGICAL, SAVE     :: DoThisLoop
 	static int InsideSurfErrCount( 0 );
@@ -4920,13 +5133,29 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	if ( firstTime ) {
 		TempInsOld.allocate( TotSurfaces );
 		RefAirTemp.allocate( TotSurfaces );
+		ReentrantInsideSurf.dimension( TotSurfaces, false );
+		HAMTSweepSurf.dimension( TotSurfaces, false );
 		if ( any_eq( HeatTransferAlgosUsed, UseEMPD ) ) {
 			MinIterations = MinEMPDIterations;
 		} else {
 			MinIterations = 1;
 		}
+		ZoneInsideSurfIterations.dimension( NumOfZones, 0 );
+		ZoneMaxDelTemp.dimension( NumOfZones, 0.0 );
+		FrozenZone.dimension( NumOfZones, false );
+		MaskableZone.dimension( NumOfZones, true );
+		for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) { // CondFD, HAMT and EMPD surfaces carry state from one iteration to the next
+			for ( int iSurf = Zone( iZone ).SurfaceFirst, eSurf = Zone( iZone ).SurfaceLast; iSurf <= eSurf; ++iSurf ) {
+				if ( iSurf == 0 ) continue;
+				auto const alg( Surface( iSurf ).HeatTransferAlgorithm );
+				if ( ( alg == HeatTransferModel_CondFD ) || ( alg == HeatTransferModel_HAMT ) || ( alg == HeatTransferModel_EMPD ) ) MaskableZone( iZone ) = false;
+			}
+		}
 		if ( DisplayAdvancedReportVariables ) {
 			SetupOutputVariable( "Surface Inside Face Heat Balance Calculation Iteration Count []", InsideSurfIterations, "ZONE", "Sum", "Simulation" );
+			for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
+				SetupOutputVariable( "Zone Inside Face Heat Balance Calculation Iteration Count []", ZoneInsideSurfIterations( iZone ), "Zone", "Sum", Zone( iZone ).Name );
+			}
 		}
 	}
 	if ( BeginEnvrnFlag && MyEnvrnFlag ) {
@@ -5056,13 +5285,67 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		}
 	}
 
+	// Re-entrant surface work partition: plain CTF opaque surfaces (no EMPD/CondFD/HAMT, no movable insulation,
+	// no embedded source, not a pool) only read their own history, flux and coefficient terms in the inside face
+	// equation and only write their own temperatures.  Those are pulled out of the serial loop below into a sweep
+	// that may be split into contiguous (zone ordered) surface groups across threads.  The arithmetic is identical
+	// to the serial path so results do not depend on the number of threads.
+	std::vector< int > ReentrantSurfs;
+	ReentrantSurfs.reserve( nSurfToResimulate );
+	for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+		SurfNum = SurfToResimulate[ iSurfToResimulate ];
+		ReentrantInsideSurf( SurfNum ) = IsReentrantInsideSurface( SurfNum );
+		if ( ReentrantInsideSurf( SurfNum ) ) ReentrantSurfs.push_back( SurfNum );
+	}
+	int const nReentrantSurfs( ReentrantSurfs.size() );
+	int const nInsideSurfThreads( ParallelLoopThreads( NumberInsideSurfThreads, nReentrantSurfs, MinReentrantSurfsPerThread ) );
+
+	// HAMT surfaces without movable insulation only depend on the zone air, the convection coefficients and
+	// the radiation terms of the iteration, so with more than one thread they are solved together ahead of
+	// the serial loop, shared out over the threads
+	std::vector< int > HAMTSweepSurfs;
+	for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+		SurfNum = SurfToResimulate[ iSurfToResimulate ];
+		HAMTSweepSurf( SurfNum ) = IsHAMTSweepSurface( SurfNum );
+		if ( HAMTSweepSurf( SurfNum ) ) HAMTSweepSurfs.push_back( SurfNum );
+	}
+	int const nHAMTThreads( ParallelLoopThreads( NumberInsideSurfThreads, int( HAMTSweepSurfs.size() ) ) );
+	if ( nHAMTThreads == 1 ) {
+		for ( int const iSurf : HAMTSweepSurfs ) HAMTSweepSurf( iSurf ) = false;
+		HAMTSweepSurfs.clear();
+	}
+
+	// The sweep runs over a packed hot-state block (DataHeatBalSurface::SurfaceHotStateData) instead of
+	// the scattered Surface/Construct/per-surface arrays
+	auto & HotState( InsideSurfHotState );
+	PackSurfaceHotState( HotState, ReentrantSurfs );
+	for ( int i = 1; i <= nReentrantSurfs; ++i ) {
+		HotState.LimitTemp( i ) = any_surface_ConFD_or_HAMT( Surface( HotState.SurfNum( i ) ).Zone );
+	}
+
 	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
+	Real64 const ZoneDelTempLimit( useCondFDHTalg ? MaxAllowedDelTempCondFD : MaxAllowedDelTemp ); // Convergence criteria each zone is counted against
+
+	// Per zone iteration counts: a zone has converged from the iteration after its opaque surfaces last moved by more
+	// than the convergence criteria.  With InsideSurfaceZoneMasking those zones (CTF surfaces only) are then held at
+	// their temperatures and skipped by the radiant exchange and the surface loops while the other zones finish.
+	int const FirstZone( PartialResimulate ? ZoneToResimulate() : 1 );
+	int const LastZone( PartialResimulate ? ZoneToResimulate() : NumOfZones );
+	for ( int iZone = FirstZone; iZone <= LastZone; ++iZone ) {
+		ZoneInsideSurfIterations( iZone ) = 1;
+	}
+	FrozenZone = false;
+
 	Converged = false;
 	while ( ! Converged ) { // Start of main inside heat balance DO loop...
 
 		TempInsOld = TempSurfIn; // Keep track of last iteration's temperature values
 
-		CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
+		if ( InsideSurfaceZoneMasking ) {
+			CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside, FrozenZone ); // Update the radiation balance of the zones still iterating
+		} else {
+			CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
+		}
 
 		// Every 30 iterations, recalculate the inside convection coefficients in case
 		// there has been a significant drift in the surface temperatures predicted.
@@ -5070,16 +5353,70 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		// heat balance is in error (potentially) once HConvIn is re-evaluated.
 		// The choice of 30 is not significant--just want to do this a couple of
 		// times before the iteration limit is hit.
-		if ( ( InsideSurfIterations > 0 ) && ( mod( InsideSurfIterations, ItersReevalConvCoeff ) == 0 ) ) {
+		bool const ReevalConvCoeff( ( InsideSurfIterations > 0 ) && ( mod( InsideSurfIterations, ItersReevalConvCoeff ) == 0 ) );
+		if ( ReevalConvCoeff ) {
 			InitInteriorConvectionCoeffs( TempSurfIn, ZoneToResimulate );
 		}
 
+		// Partitioned sweep over the re-entrant surfaces (see above)
+		if ( ( InsideSurfIterations == 0 ) || ReevalConvCoeff ) { // Iteration invariant terms only change with HConvIn
+			for ( int i = 1; i <= nReentrantSurfs; ++i ) {
+				int const iSurf( HotState.SurfNum( i ) );
+				Real64 const HConvIn_surf( HConvIn( iSurf ) );
+				HotState.ConstTerm( i ) = CTFConstInPart( iSurf ) + QRadThermInAbs( iSurf ) + QRadSWInAbs( iSurf ) + HConvIn_surf * RefAirTemp( iSurf ) + QHTRadSysSurf( iSurf ) + QHWBaseboardSurf( iSurf ) + QSteamBaseboardSurf( iSurf ) + QElecBaseboardSurf( iSurf );
+				if ( HotState.Partition( i ) ) { // Partition: both sides at the same temperature
+					HotState.TempDiv( i ) = 1.0 / ( HotState.CTFInside0( i ) - HotState.CTFCross0( i ) + HConvIn_surf + IterDampConst );
+				} else { // Standard or interzone surface
+					HotState.TempDiv( i ) = 1.0 / ( HotState.CTFInside0( i ) + HConvIn_surf + IterDampConst );
+				}
+			}
+		}
+		for ( int i = 1; i <= nReentrantSurfs; ++i ) { // Gather the terms that change every iteration
+			int const iSurf( HotState.SurfNum( i ) );
+			HotState.NetLWRad( i ) = NetLWRadToSurf( iSurf );
+			HotState.TempInOld( i ) = TempInsOld( iSurf );
+			HotState.TempOut( i ) = TH( 1, 1, iSurf );
+		}
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(static) num_threads(nInsideSurfThreads) if(nInsideSurfThreads > 1)
+#endif
+		for ( int i = 1; i <= nReentrantSurfs; ++i ) {
+			Real64 const CrossTerm( HotState.Partition( i ) ? 0.0 : HotState.CTFCross0( i ) * HotState.TempOut( i ) ); // Partition has no outside conduction term
+			Real64 TempIn( ( HotState.ConstTerm( i ) + HotState.NetLWRad( i ) + HotState.CTFSourceIn0( i ) * HotState.QsrcHist1( i ) + IterDampConst * HotState.TempInOld( i ) + CrossTerm ) * HotState.TempDiv( i ) );
+			// if any mixed heat transfer models in zone, apply limits to CTF result
+			if ( HotState.LimitTemp( i ) ) TempIn = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempIn ) );
+			HotState.TempIn( i ) = TempIn;
+		}
+		for ( int i = 1; i <= nReentrantSurfs; ++i ) { // Scatter the results
+			int const iSurf( HotState.SurfNum( i ) );
+			if ( InsideSurfaceZoneMasking && FrozenZone( Surface( iSurf ).Zone ) ) continue; // Held at its converged temperature
+			TempSurfIn( iSurf ) = TempSurfInTmp( iSurf ) = HotState.TempIn( i );
+		}
+
+		// HAMT surface sweep (see above), with the inside moisture terms the serial loop would set first
+		if ( ! HAMTSweepSurfs.empty() ) {
+			for ( int const iSurf : HAMTSweepSurfs ) {
+				auto const & surface( Surface( iSurf ) );
+				Real64 const MAT_zone( MAT( surface.Zone ) );
+				Real64 const ZoneAirHumRat_zone( max( ZoneAirHumRat( surface.Zone ), 1.0e-5 ) );
+				Real64 const HConvIn_surf( HConvInFD( iSurf ) = HConvIn( iSurf ) );
+				RhoVaporAirIn( iSurf ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+				HMassConvInFD( iSurf ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( iSurf ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+				if ( ( surface.ExtBoundCond > 0 ) && ( surface.ExtBoundCond != iSurf ) ) {
+					// HAMT get the correct other side zone zone air temperature --
+					TempOutsideAirFD( iSurf ) = MAT( Surface( surface.ExtBoundCond ).Zone );
+				}
+			}
+			ManageHeatBalHAMTSurfaces( HAMTSweepSurfs, nHAMTThreads, TempSurfInTmp, TempSurfOut );
+		}
+
 		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
 			SurfNum = SurfToResimulate[ iSurfToResimulate ];
 			auto & surface( Surface( SurfNum ) );
 			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 			if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
 			if ( ( ZoneNum = surface.Zone ) == 0 ) continue; // Skip non-heat transfer surfaces
+			if ( InsideSurfaceZoneMasking && FrozenZone( ZoneNum ) ) continue; // Surfaces held at their converged temperatures
 
 			Real64 & TH11( TH( 1, 1, SurfNum ) );
 			Real64 & TH12( TH( 2, 1, SurfNum ) );
@@ -5094,8 +5431,10 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			// calculate the inside surface moisture transfer conditions
 			// check for saturation conditions of air
 			Real64 const HConvIn_surf( HConvInFD( SurfNum ) = HConvIn( SurfNum ) );
-			RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
-			HMassConvInFD( SurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+			if ( ! HAMTSweepSurf( SurfNum ) ) { // Already set for the HAMT surface sweep, which may have changed HMassConvInFD
+				RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+				HMassConvInFD( SurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+			}
 
 			// Perform heat balance on the inside face of the surface ...
 			// The following are possibilities here:
@@ -5112,7 +5451,9 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			//   (d) the HAMT calc (solutionalgo = UseHAMT).
 
 			auto & zone( Zone( ZoneNum ) );
-			if ( surface.ExtBoundCond == SurfNum && surface.Class != SurfaceClass_Window ) {
+			if ( ReentrantInsideSurf( SurfNum ) ) {
+				// Inside face temperature already evaluated by the partitioned sweep
+			} else if ( surface.ExtBoundCond == SurfNum && surface.Class != SurfaceClass_Window ) {
 				//CR6869 -- let Window HB take care of it      IF (Surface(SurfNum)%ExtBoundCond == SurfNum) THEN
 				// Surface is a partition
 				if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
@@ -5150,7 +5491,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 				} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
+					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+						if ( HAMTSweepSurf( SurfNum ) ) {
+							TempSurfOutTmp = TempSurfOut( SurfNum ); // Solved by the HAMT surface sweep
+						} else {
+							ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
+						}
+					}
 
 					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 
@@ -5220,7 +5567,9 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 						} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+							if ( HAMTSweepSurf( SurfNum ) ) {
+								TempSurfOutTmp = TempSurfOut( SurfNum ); // Solved by the HAMT surface sweep
+							} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 								if ( surface.ExtBoundCond > 0 ) {
 									// HAMT get the correct other side zone zone air temperature --
 									OtherSideSurfNum = surface.ExtBoundCond;
@@ -5552,6 +5901,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 		// Convergence check
 		MaxDelTemp = 0.0;
+		ZoneMaxDelTemp = 0.0;
 		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Loop through all relevant surfaces to check for convergence...
 			SurfNum = SurfToResimulate[ iSurfToResimulate ];
 
@@ -5559,15 +5909,22 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 			ConstrNum = Surface( SurfNum ).Construction;
 			if ( Construct( ConstrNum ).TransDiff <= 0.0 ) { // Opaque surface
-				MaxDelTemp = max( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ), MaxDelTemp );
+				Real64 DelTemp( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ) );
 				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
 					// also check all internal nodes as well as surface faces
-					MaxDelTemp = max( MaxDelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
+					DelTemp = max( DelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
 				}
+				MaxDelTemp = max( DelTemp, MaxDelTemp );
+				ZoneNum = Surface( SurfNum ).Zone;
+				ZoneMaxDelTemp( ZoneNum ) = max( DelTemp, ZoneMaxDelTemp( ZoneNum ) );
 			}
 
 		} // ...end of loop to check for convergence
 
+		for ( int iZone = FirstZone; iZone <= LastZone; ++iZone ) {
+			if ( ZoneMaxDelTemp( iZone ) > ZoneDelTempLimit ) ZoneInsideSurfIterations( iZone ) = InsideSurfIterations + 1;
+		}
+
 		if ( ! useCondFDHTalg ) {
 			if ( MaxDelTemp <= MaxAllowedDelTemp ) Converged = true;
 		} else {
@@ -5597,7 +5954,25 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 		if ( InsideSurfIterations < MinIterations ) Converged = false;
 
+		if ( InsideSurfaceZoneMasking && ! Converged ) { // Hold the zones that have converged for the next iteration
+			bool const ReevalConvCoeffNext( mod( InsideSurfIterations, ItersReevalConvCoeff ) == 0 ); // All zones are recomputed with the new HConvIn
+			for ( int iZone = FirstZone; iZone <= LastZone; ++iZone ) {
+				FrozenZone( iZone ) = MaskableZone( iZone ) && ( ! ReevalConvCoeffNext ) && ( ZoneMaxDelTemp( iZone ) <= ZoneDelTempLimit );
+			}
+			// A zone is recomputed while the other side of any of its interzone surfaces is still moving
+			for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+				SurfNum = SurfToResimulate[ iSurfToResimulate ];
+				int const surfExtBoundCond( Surface( SurfNum ).ExtBoundCond );
+				if ( ( surfExtBoundCond > 0 ) && ( surfExtBoundCond != SurfNum ) && FrozenZone( Surface( SurfNum ).Zone ) ) {
+					if ( ZoneMaxDelTemp( Surface( surfExtBoundCond ).Zone ) > ZoneDelTempLimit ) FrozenZone( Surface( SurfNum ).Zone ) = false;
+				}
+			}
+		}
+
 		if ( InsideSurfIterations > MaxIterations ) {
+			for ( int iZone = FirstZone; iZone <= LastZone; ++iZone ) { // Zones still moving at the limit
+				ZoneInsideSurfIterations( iZone ) = min( ZoneInsideSurfIterations( iZone ), InsideSurfIterations );
+			}
 			if ( ! WarmupFlag ) {
 				++ErrCount;
 				if ( ErrCount < 16 ) {
@@ -5704,6 +6079,106 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 }
 
+bool
+IsReentrantInsideSurface( int const SurfNum ) // Surface number
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Determines whether the inside face heat balance of a surface can be evaluated in the
+	// partitioned (threadable) sweep of CalcHeatBalanceInsideSurf.
+
+	// METHODOLOGY EMPLOYED:
+	// Only plain CTF opaque surfaces qualify.  Their inside face equation reads nothing but
+	// per-surface terms and writes nothing but their own temperatures.  Windows, TDDs, pools,
+	// movable insulation, embedded sources (interzone coefficient exchange) and the EMPD,
+	// CondFD and HAMT models call into other modules and stay in the serial loop.
+
+	// Using/Aliasing
+	using namespace DataSurfaces;
+	using DataHeatBalance::Construct;
+
+	auto const & surface( Surface( SurfNum ) );
+	if ( ! surface.HeatTransSurf || ( surface.Zone == 0 ) ) return false;
+	if ( ( surface.Class == SurfaceClass_Window ) || ( surface.Class == SurfaceClass_TDD_Dome ) ) return false;
+	if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) return false;
+	if ( surface.IsPool || ( surface.MaterialMovInsulInt > 0 ) ) return false;
+	if ( Construct( surface.Construction ).SourceSinkPresent ) return false;
+	return true;
+
+}
+
+bool
+IsHAMTSweepSurface( int const SurfNum ) // Surface number
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Determines whether a surface can be solved in the HAMT surface sweep of
+	// CalcHeatBalanceInsideSurf.
+
+	// METHODOLOGY EMPLOYED:
+	// HAMT walls, floors and roofs qualify unless movable insulation may change their inside face
+	// equation; partitions qualify whatever their insulation, as the serial loop ignores it for them.
+
+	// Using/Aliasing
+	using namespace DataSurfaces;
+
+	auto const & surface( Surface( SurfNum ) );
+	if ( ! surface.HeatTransSurf || ( surface.Zone == 0 ) ) return false;
+	if ( ( surface.Class == SurfaceClass_Window ) || ( surface.Class == SurfaceClass_TDD_Dome ) ) return false;
+	if ( surface.HeatTransferAlgorithm != HeatTransferModel_HAMT ) return false;
+	if ( ( surface.ExtBoundCond != SurfNum ) && ( surface.MaterialMovInsulInt > 0 ) ) return false;
+	return true;
+
+}
+
+void
+PackSurfaceHotState(
+	DataHeatBalSurface::SurfaceHotStateData & HotState, // Block to fill
+	std::vector< int > const & SurfNums // Surfaces to pack, in sweep order
+)
+{
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Copies the geometry, current CTF coefficients, constant CTF parts and source history of
+	// the given surfaces into a packed hot-state block.
+
+	// METHODOLOGY EMPLOYED:
+	// One gather pass over the scattered surface and construction data so that the heat
+	// balance kernels can then sweep the block with unit stride.  Terms that change within a
+	// time step (temperatures, radiation exchange) are gathered by the callers.
+
+	// Using/Aliasing
+	using namespace DataSurfaces;
+	using DataHeatBalance::Construct;
+	using DataHeatBalSurface::CTFConstInPart;
+	using DataHeatBalSurface::CTFConstOutPart;
+	using DataHeatBalSurface::QsrcHist;
+
+	int const nSurfs( SurfNums.size() );
+	HotState.resize( nSurfs );
+	for ( int i = 1; i <= nSurfs; ++i ) {
+		int const SurfNum( SurfNums[ i - 1 ] );
+		auto const & surface( Surface( SurfNum ) );
+		auto const & construct( Construct( surface.Construction ) );
+		HotState.SurfNum( i ) = SurfNum;
+		HotState.ConstrNum( i ) = surface.Construction;
+		HotState.ExtBoundCond( i ) = surface.ExtBoundCond;
+		HotState.Partition( i ) = ( surface.ExtBoundCond == SurfNum );
+		HotState.OpaqueClass( i ) = ( surface.Class == SurfaceClass_Floor || surface.Class == SurfaceClass_Wall || surface.Class == SurfaceClass_IntMass || surface.Class == SurfaceClass_Roof || surface.Class == SurfaceClass_Door );
+		HotState.LimitTemp( i ) = false;
+		HotState.Area( i ) = surface.Area;
+		HotState.CTFOutside0( i ) = construct.CTFOutside( 0 );
+		HotState.CTFCross0( i ) = construct.CTFCross( 0 );
+		HotState.CTFInside0( i ) = construct.CTFInside( 0 );
+		HotState.CTFSourceIn0( i ) = construct.CTFSourceIn( 0 );
+		HotState.CTFSourceOut0( i ) = construct.CTFSourceOut( 0 );
+		HotState.CTFConstIn( i ) = CTFConstInPart( SurfNum );
+		HotState.CTFConstOut( i ) = CTFConstOutPart( SurfNum );
+		HotState.QsrcHist1( i ) = QsrcHist( SurfNum, 1 );
+	}
+
+}
+
 void
 CalcOutsideSurfTemp(
 	int const SurfNum, // Surface number DO loop counter
@@ -1,11 +1,16 @@
 #ifndef HeatBalanceSurfaceManager_hh_INCLUDED
 #define HeatBalanceSurfaceManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <DataHeatBalSurface.hh>
 
 namespace EnergyPlus {
 
@@ -16,10 +21,60 @@ namespace HeatBalanceSurfaceManager {
 	// na
 
 	// DERIVED TYPE DEFINITIONS:
-	// na
+
+	// Types
+
+	struct CTFHistoryBatchData
+	{
+		// Members
+		int ConstrNum; // Construction shared by every surface of the batch
+		int NumCTFTerms; // Number of CTF history terms of the construction
+		std::vector< int > SurfNums; // Surfaces of the batch in ascending order
+
+		// Default Constructor
+		CTFHistoryBatchData() :
+			ConstrNum( 0 ),
+			NumCTFTerms( 0 )
+		{}
+
+	};
+
+	struct SurfaceReportRequestData
+	{
+		// Groups of report quantities of a surface that feed requested output variables
+
+		// Members
+		bool RadNetIn; // Inside face net thermal radiation
+		bool RadSolarIn; // Inside face solar radiation
+		bool RadLightsIn; // Inside face lights radiation
+		bool RadIntGainsIn; // Inside face internal gains radiation
+		bool RadHVACIn; // Inside face system radiation
+		bool InsFaceCond; // Inside face conduction
+		bool ExtFaceCond; // Outside face conduction
+		bool AvgFaceCond; // Average face conduction
+		bool Storage; // Heat storage
+
+		// Default Constructor
+		SurfaceReportRequestData() :
+			RadNetIn( true ),
+			RadSolarIn( true ),
+			RadLightsIn( true ),
+			RadIntGainsIn( true ),
+			RadHVACIn( true ),
+			InsFaceCond( true ),
+			ExtFaceCond( true ),
+			AvgFaceCond( true ),
+			Storage( true )
+		{}
+
+	};
 
 	// MODULE VARIABLE DECLARATIONS:
-	// na
+	extern bool CTFHistoryBatchesChanged; // True when the CTF history batches must be regrouped
+
+	// Object Data
+	extern Array1D< CTFHistoryBatchData > CTFHistoryBatch; // Surfaces grouped by construction for the batched CTF history kernel
+	extern Array1D< SurfaceReportRequestData > SurfaceReportRequest; // Report quantities of each surface that are computed
 
 	// Subroutine Specifications for the Heat Balance Module
 	// Driver Routines
@@ -52,6 +107,9 @@ namespace HeatBalanceSurfaceManager {
 	void
 	AllocateSurfaceHeatBalArrays();
 
+	void
+	SetSurfaceReportRequests( int const SurfNum ); // Surface number
+
 	void
 	InitThermalAndFluxHistories();
 
@@ -76,6 +134,15 @@ namespace HeatBalanceSurfaceManager {
 	void
 	InitEMSControlledConstructions();
 
+	void
+	BuildCTFHistoryBatches();
+
+	void
+	CalcCTFHistoryTerms( int const SurfNum ); // Surface number
+
+	void
+	CalcCTFHistoryTermsBatched();
+
 	// End Initialization Section of the Module
 	//******************************************************************************
 
@@ -121,6 +188,18 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate = _ ); // if pas
 void
 CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate = _ ); // if passed in, then only calculate surfaces that have this zone
 
+bool
+IsReentrantInsideSurface( int const SurfNum ); // Surface number
+
+bool
+IsHAMTSweepSurface( int const SurfNum ); // Surface number
+
+void
+PackSurfaceHotState(
+	DataHeatBalSurface::SurfaceHotStateData & HotState, // Block to fill
+	std::vector< int > const & SurfNums // Surfaces to pack, in sweep order
+);
+
 void
 CalcOutsideSurfTemp(
 	int const SurfNum, // Surface number DO loop counter
@@ -1,6 +1,15 @@
 // C++ Headers
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <istream>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Backspace.hh>
@@ -90,6 +99,7 @@ namespace InputProcessor {
 	std::string const Blank;
 	static std::string const BlankString;
 	static std::string const AlphaNum( "ANan" ); // Valid indicators for Alpha or Numeric fields (A or N)
+	static std::string const IDDCacheMagic( "EPIDDC01" ); // Pre-parsed IDD signature; change with the layout or ObjectsDefinition
 	Real64 const DefAutoSizeValue( AutoSize );
 	Real64 const DefAutoCalculateValue( AutoCalculate );
 	static gio::Fmt fmtLD( "*" );
@@ -142,6 +152,7 @@ namespace InputProcessor {
 	Array1D_int iListOfObjects;
 	Array1D_int ObjectGotCount;
 	Array1D_int ObjectStartRecord;
+	std::unordered_map< std::string, int > ListOfObjectsIndex; // Position of each object type in ListOfObjects
 	std::string CurrentFieldName; // Current Field Name (IDD)
 	Array1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	std::string ReplacementName;
@@ -160,6 +171,9 @@ namespace InputProcessor {
 	bool ExtensibleObject( false ); // Set to true when ReadInputLine has an extensible object
 	int ExtensibleNumFields( 0 ); // set to number when ReadInputLine has an extensible object
 	Array1D_bool IDFRecordsGotten; // Denotes that this record has been "gotten" from the IDF
+	int NumIndexedRecords( 0 ); // IDF records entered in ObjectRecords
+	std::uint64_t LoadedIDDHash( 0u ); // Hash of the IDD text the definitions were read from
+	bool PreloadedIDD( false ); // Definitions were read by PreloadDataDictionary and not yet used
 
 	//Derived Types Variables
 
@@ -169,6 +183,7 @@ namespace InputProcessor {
 	Array1D< FileSectionsDefinition > SectionsOnFile; // lists the sections on file (IDF)
 	LineDefinition LineItem; // Description of current record
 	Array1D< LineDefinition > IDFRecords; // All the objects read from the IDF
+	Array1D< ObjectRecordsIndex > ObjectRecords; // IDF records of each object definition
 	Array1D< SecretObjects > RepObjects; // Secret Objects that could replace old ones
 
 	// MODULE SUBROUTINES:
@@ -274,7 +289,7 @@ namespace InputProcessor {
 		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary -- Start";
 		DisplayString( "Processing Data Dictionary" );
 		ProcessingIDD = true;
-		ProcessDataDicFile( idd_stream, ErrorsInIDD );
+		LoadDataDictionary( idd_stream, ErrorsInIDD );
 		idd_stream.close();
 
 		ListOfObjects.allocate( NumObjectDefs );
@@ -283,6 +298,7 @@ namespace InputProcessor {
 			iListOfObjects.allocate( NumObjectDefs );
 			SetupAndSort( ListOfObjects, iListOfObjects );
 		}
+		BuildListOfObjectsIndex();
 		ObjectStartRecord.dimension( NumObjectDefs, 0 );
 		ObjectGotCount.dimension( NumObjectDefs, 0 );
 
@@ -311,16 +327,22 @@ namespace InputProcessor {
 			gio::write( EchoInputFile, fmtLD ) << " Echo of input lines is off. May be activated by setting the environmental variable DISPLAYINPUTINAUDIT=YES";
 		}
 
-		std::ifstream idf_stream( inputIdfFileName, std::ios_base::in | std::ios_base::binary );
-		if ( ! idf_stream ) {
-			if ( idf_stream.is_open() ) idf_stream.close();
-			ShowFatalError( "ProcessInput: Could not open file \"" + inputIdfFileName + "\" for input (read)." );
-		}
 		NumLines = 0;
 		EchoInputLine = true;
-		DisplayString( "Processing Input File" );
-		ProcessInputDataFile( idf_stream );
-		idf_stream.close();
+		if ( ! inputIdfBuffer.empty() ) { // Input data given in memory through the library
+			std::istringstream idf_stream( inputIdfBuffer );
+			DisplayString( "Processing Input Data" );
+			ProcessInputDataFile( idf_stream );
+		} else {
+			std::ifstream idf_stream( inputIdfFileName, std::ios_base::in | std::ios_base::binary );
+			if ( ! idf_stream ) {
+				if ( idf_stream.is_open() ) idf_stream.close();
+				ShowFatalError( "ProcessInput: Could not open file \"" + inputIdfFileName + "\" for input (read)." );
+			}
+			DisplayString( "Processing Input File" );
+			ProcessInputDataFile( idf_stream );
+			idf_stream.close();
+		}
 
 		ListOfSections.allocate( NumSectionDefs );
 		ListOfSections = SectionDef( {1,NumSectionDefs} ).Name();
@@ -358,12 +380,7 @@ namespace InputProcessor {
 			++CountErr;
 			Which = SectionsOnFile( Loop ).FirstRecord;
 			if ( Which > 0 ) {
-				if ( SortedIDD ) {
-					Num1 = FindItemInSortedList( IDFRecords( Which ).Name, ListOfObjects, NumObjectDefs );
-					if ( Num1 != 0 ) Num1 = iListOfObjects( Num1 );
-				} else {
-					Num1 = FindItemInList( IDFRecords( Which ).Name, ListOfObjects, NumObjectDefs );
-				}
+				Num1 = FindObjectDefinition( IDFRecords( Which ).Name );
 				if ( ObjectDef( Num1 ).NameAlpha1 && IDFRecords( Which ).NumAlphas > 0 ) {
 					gio::write( EchoInputFile, fmtA ) << " Potential \"semi-colon\" misplacement=" + SectionsOnFile( Loop ).Name + ", at about line number=[" + IPTrimSigDigits( SectionsOnFile( Loop ).FirstLineNo ) + "], Object Type Preceding=" + IDFRecords( Which ).Name + ", Object Name=" + IDFRecords( Which ).Alphas( 1 );
 				} else {
@@ -426,6 +443,362 @@ namespace InputProcessor {
 
 	}
 
+	void
+	LoadDataDictionary(
+		std::istream & idd_stream,
+		bool & ErrorsFound // set to true if any errors flagged during IDD processing
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the section and object definitions of the data dictionary: those read ahead by
+		// PreloadDataDictionary from the same IDD text, else those of the pre-parsed dictionary
+		// (IDDCacheFile), else by processing the IDD.
+
+		// METHODOLOGY EMPLOYED:
+		// The IDD text is read in one piece and hashed; the hash identifies the text for the
+		// preloaded and the pre-parsed definitions, so an edited IDD is always processed again.
+
+		std::string const IddText( ( std::istreambuf_iterator< char >( idd_stream ) ), std::istreambuf_iterator< char >() );
+		std::uint64_t const IddHash( IDDCacheHash( IddText ) );
+
+		if ( PreloadedIDD && IddHash == LoadedIDDHash ) {
+			PreloadedIDD = false; // Definitions pick up IDF counts from here on, so they serve one run
+			return;
+		}
+		PreloadedIDD = false;
+
+		std::string const & CacheFileName( DataSystemVariables::IDDCacheFileName );
+		if ( ! CacheFileName.empty() && ReadIDDCache( CacheFileName, IddHash ) ) {
+			LoadedIDDHash = IddHash;
+			return;
+		}
+
+		std::istringstream idd_text_stream( IddText );
+		ProcessDataDicFile( idd_text_stream, ErrorsFound );
+		LoadedIDDHash = ErrorsFound ? 0u : IddHash;
+		if ( ! ErrorsFound && ! CacheFileName.empty() ) WriteIDDCache( CacheFileName, IddHash );
+
+	}
+
+	bool
+	PreloadDataDictionary( std::string const & IddFileName ) // Data dictionary to read
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the data dictionary ahead of ProcessInput, for a process that starts several runs
+		// from the same state (EnergyPlusPgmRunMany); ProcessInput of a run with the same IDD text
+		// then uses these definitions.  Returns false if the IDD could not be read or had errors.
+
+		std::ifstream idd_stream( IddFileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! idd_stream ) return false;
+		bool ErrorsFound( false );
+		ProcessingIDD = true;
+		LoadDataDictionary( idd_stream, ErrorsFound );
+		ProcessingIDD = false;
+		PreloadedIDD = ! ErrorsFound;
+		return PreloadedIDD;
+
+	}
+
+	std::uint64_t
+	IDDCacheHash( std::string const & IddText ) // Full text of the data dictionary
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the key of the pre-parsed data dictionary written for this IDD text.
+
+		// METHODOLOGY EMPLOYED:
+		// 64 bit FNV-1a over the text.
+
+		std::uint64_t Hash( 14695981039346656037ull ); // FNV offset basis
+		for ( char const c : IddText ) {
+			Hash ^= static_cast< unsigned char >( c );
+			Hash *= 1099511628211ull; // FNV prime
+		}
+		return Hash;
+
+	}
+
+	bool
+	ReadIDDCache(
+		std::string const & FileName, // Pre-parsed data dictionary file
+		std::uint64_t const IddHash // Hash of the data dictionary text
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Loads the section and object definitions from the pre-parsed data dictionary.  Returns
+		// false, leaving the definitions untouched, if the file is missing, was written for other
+		// IDD text or by another version of the layout, or is damaged.
+
+		// METHODOLOGY EMPLOYED:
+		// The file is read in one piece and decoded from memory into local definitions, which
+		// replace the module ones only when the whole image has been read (layout in WriteIDDCache).
+
+		std::ifstream File( FileName, std::ios::in | std::ios::binary );
+		if ( ! File ) return false;
+		std::string const Image( ( std::istreambuf_iterator< char >( File ) ), std::istreambuf_iterator< char >() );
+		File.close();
+
+		std::string::size_type Pos( 0u );
+		bool Good( true );
+		auto get_bytes = [&]( void * Dest, std::string::size_type const Size ) {
+			if ( ! Good || Image.size() - Pos < Size ) {
+				Good = false;
+				return;
+			}
+			std::memcpy( Dest, Image.data() + Pos, Size );
+			Pos += Size;
+		};
+		auto get_int = [&]() -> int {
+			std::int32_t Value( 0 );
+			get_bytes( &Value, sizeof( Value ) );
+			return Value;
+		};
+		auto get_count = [&]() -> int { // Number of items that follow; each takes at least one byte
+			int const Count( get_int() );
+			if ( Count < 0 || std::string::size_type( Count ) > Image.size() - Pos ) Good = false;
+			return Good ? Count : 0;
+		};
+		auto get_real = [&]() -> Real64 {
+			Real64 Value( 0.0 );
+			get_bytes( &Value, sizeof( Value ) );
+			return Value;
+		};
+		auto get_bool = [&]() -> bool {
+			char Value( 0 );
+			get_bytes( &Value, 1 );
+			return Value != 0;
+		};
+		auto get_string = [&]() -> std::string {
+			int const Len( get_count() );
+			if ( ! Good ) return std::string();
+			std::string Value( Image, Pos, Len );
+			Pos += Len;
+			return Value;
+		};
+		auto get_bools = [&]( Array1D_bool & Values ) {
+			Values.allocate( get_count() );
+			for ( int Loop = 1, e = Values.isize(); Loop <= e; ++Loop ) Values( Loop ) = get_bool();
+		};
+		auto get_strings = [&]( Array1D_string & Values ) {
+			Values.allocate( get_count() );
+			for ( int Loop = 1, e = Values.isize(); Loop <= e; ++Loop ) Values( Loop ) = get_string();
+		};
+
+		if ( Image.compare( 0, IDDCacheMagic.size(), IDDCacheMagic ) != 0 ) return false;
+		Pos = IDDCacheMagic.size();
+		std::uint64_t Hash( 0u );
+		get_bytes( &Hash, sizeof( Hash ) );
+		if ( ! Good || Hash != IddHash ) return false;
+
+		std::string const VerString( get_string() );
+
+		int const MaxSections( get_int() );
+		int const NumSections( get_count() );
+		if ( MaxSections < NumSections ) Good = false;
+		Array1D< SectionsDefinition > Sections( Good ? MaxSections : 0 );
+		for ( int Loop = 1; Loop <= NumSections && Good; ++Loop ) {
+			Sections( Loop ).Name = get_string();
+		}
+
+		int const MaxObjects( get_int() );
+		int const NumObjects( get_count() );
+		if ( MaxObjects < NumObjects ) Good = false;
+		Array1D< ObjectsDefinition > Objects( Good ? MaxObjects : 0 );
+		for ( int Loop = 1; Loop <= NumObjects && Good; ++Loop ) {
+			auto & Object( Objects( Loop ) );
+			Object.Name = get_string();
+			Object.NumParams = get_int();
+			Object.NumAlpha = get_int();
+			Object.NumNumeric = get_int();
+			Object.MinNumFields = get_int();
+			Object.NameAlpha1 = get_bool();
+			Object.UniqueObject = get_bool();
+			Object.RequiredObject = get_bool();
+			Object.ExtensibleObject = get_bool();
+			Object.ExtensibleNum = get_int();
+			Object.LastExtendAlpha = get_int();
+			Object.LastExtendNum = get_int();
+			Object.ObsPtr = get_int();
+			get_bools( Object.AlphaOrNumeric );
+			get_bools( Object.ReqField );
+			get_bools( Object.AlphRetainCase );
+			get_strings( Object.AlphFieldChks );
+			get_strings( Object.AlphFieldDefs );
+			Object.NumRangeChks.allocate( get_count() );
+			for ( int Field = 1, e = Object.NumRangeChks.isize(); Field <= e; ++Field ) {
+				auto & Check( Object.NumRangeChks( Field ) );
+				Check.MinMaxChk = get_bool();
+				Check.FieldNumber = get_int();
+				Check.FieldName = get_string();
+				Check.MinMaxString.x = get_string();
+				Check.MinMaxString.y = get_string();
+				Check.MinMaxValue.x = get_real();
+				Check.MinMaxValue.y = get_real();
+				Check.WhichMinMax.x = get_int();
+				Check.WhichMinMax.y = get_int();
+				Check.DefaultChk = get_bool();
+				Check.Default = get_real();
+				Check.DefAutoSize = get_bool();
+				Check.AutoSizable = get_bool();
+				Check.AutoSizeValue = get_real();
+				Check.DefAutoCalculate = get_bool();
+				Check.AutoCalculatable = get_bool();
+				Check.AutoCalculateValue = get_real();
+			}
+		}
+
+		Array1D_string ObsoleteNames;
+		get_strings( ObsoleteNames );
+		int const MaxAlphaArgs( get_int() );
+		int const MaxNumericArgs( get_int() );
+		int const NumAlphaArgs( get_int() );
+		int const NumNumericArgs( get_int() );
+		if ( ! Good || Pos != Image.size() ) return false;
+
+		IDDVerString = VerString;
+		MaxSectionDefs = MaxSections;
+		NumSectionDefs = NumSections;
+		SectionDef = Sections;
+		MaxObjectDefs = MaxObjects;
+		NumObjectDefs = NumObjects;
+		ObjectDef = Objects;
+		NumObsoleteObjects = ObsoleteNames.isize();
+		ObsoleteObjectsRepNames = ObsoleteNames;
+		MaxAlphaArgsFound = MaxAlphaArgs;
+		MaxNumericArgsFound = MaxNumericArgs;
+		NumAlphaArgsFound = NumAlphaArgs;
+		NumNumericArgsFound = NumNumericArgs;
+		return true;
+
+	}
+
+	void
+	WriteIDDCache(
+		std::string const & FileName, // Pre-parsed data dictionary file
+		std::uint64_t const IddHash // Hash of the data dictionary text
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the section and object definitions just parsed from the data dictionary so
+		// later runs with the same IDD can load them with ReadIDDCache.
+
+		// METHODOLOGY EMPLOYED:
+		// The image holds the signature (which carries the layout version), the IDD text hash and
+		// then the definitions in order: 32 bit integers, 8 byte reals, one byte logicals and
+		// length prefixed strings and arrays.  It is written next to the target and renamed over
+		// it, so runs sharing a cache file never read a partly written one.  Failures are ignored:
+		// the next run simply parses the IDD again.
+
+		std::string Image;
+		auto put_bytes = [&]( void const * Src, std::string::size_type const Size ) {
+			Image.append( static_cast< char const * >( Src ), Size );
+		};
+		auto put_int = [&]( int const Value ) {
+			std::int32_t const Value32( Value );
+			put_bytes( &Value32, sizeof( Value32 ) );
+		};
+		auto put_real = [&]( Real64 const Value ) {
+			put_bytes( &Value, sizeof( Value ) );
+		};
+		auto put_bool = [&]( bool const Value ) {
+			Image.push_back( Value ? 1 : 0 );
+		};
+		auto put_string = [&]( std::string const & Value ) {
+			put_int( int( Value.size() ) );
+			Image.append( Value );
+		};
+		auto put_bools = [&]( Array1D_bool const & Values ) {
+			put_int( Values.isize() );
+			for ( int Loop = 1, e = Values.isize(); Loop <= e; ++Loop ) put_bool( Values( Loop ) );
+		};
+		auto put_strings = [&]( Array1D_string const & Values ) {
+			put_int( Values.isize() );
+			for ( int Loop = 1, e = Values.isize(); Loop <= e; ++Loop ) put_string( Values( Loop ) );
+		};
+
+		Image.reserve( 1u << 22 );
+		Image.append( IDDCacheMagic );
+		put_bytes( &IddHash, sizeof( IddHash ) );
+		put_string( IDDVerString );
+
+		put_int( MaxSectionDefs );
+		put_int( NumSectionDefs );
+		for ( int Loop = 1; Loop <= NumSectionDefs; ++Loop ) {
+			put_string( SectionDef( Loop ).Name );
+		}
+
+		put_int( MaxObjectDefs );
+		put_int( NumObjectDefs );
+		for ( int Loop = 1; Loop <= NumObjectDefs; ++Loop ) {
+			auto const & Object( ObjectDef( Loop ) );
+			put_string( Object.Name );
+			put_int( Object.NumParams );
+			put_int( Object.NumAlpha );
+			put_int( Object.NumNumeric );
+			put_int( Object.MinNumFields );
+			put_bool( Object.NameAlpha1 );
+			put_bool( Object.UniqueObject );
+			put_bool( Object.RequiredObject );
+			put_bool( Object.ExtensibleObject );
+			put_int( Object.ExtensibleNum );
+			put_int( Object.LastExtendAlpha );
+			put_int( Object.LastExtendNum );
+			put_int( Object.ObsPtr );
+			put_bools( Object.AlphaOrNumeric );
+			put_bools( Object.ReqField );
+			put_bools( Object.AlphRetainCase );
+			put_strings( Object.AlphFieldChks );
+			put_strings( Object.AlphFieldDefs );
+			put_int( Object.NumRangeChks.isize() );
+			for ( int Field = 1, e = Object.NumRangeChks.isize(); Field <= e; ++Field ) {
+				auto const & Check( Object.NumRangeChks( Field ) );
+				put_bool( Check.MinMaxChk );
+				put_int( Check.FieldNumber );
+				put_string( Check.FieldName );
+				put_string( Check.MinMaxString.x );
+				put_string( Check.MinMaxString.y );
+				put_real( Check.MinMaxValue.x );
+				put_real( Check.MinMaxValue.y );
+				put_int( Check.WhichMinMax.x );
+				put_int( Check.WhichMinMax.y );
+				put_bool( Check.DefaultChk );
+				put_real( Check.Default );
+				put_bool( Check.DefAutoSize );
+				put_bool( Check.AutoSizable );
+				put_real( Check.AutoSizeValue );
+				put_bool( Check.DefAutoCalculate );
+				put_bool( Check.AutoCalculatable );
+				put_real( Check.AutoCalculateValue );
+			}
+		}
+
+		put_int( NumObsoleteObjects );
+		for ( int Loop = 1; Loop <= NumObsoleteObjects; ++Loop ) {
+			put_string( ObsoleteObjectsRepNames( Loop ) );
+		}
+		put_int( MaxAlphaArgsFound );
+		put_int( MaxNumericArgsFound );
+		put_int( NumAlphaArgsFound );
+		put_int( NumNumericArgsFound );
+
+		std::string const TempFileName( FileName + ".tmp" );
+		std::ofstream File( TempFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+		if ( ! File ) return;
+		File.write( Image.data(), Image.size() );
+		File.close();
+		if ( ! File ) {
+			std::remove( TempFileName.c_str() );
+			return;
+		}
+		std::remove( FileName.c_str() ); // rename does not replace an existing file everywhere
+		if ( std::rename( TempFileName.c_str(), FileName.c_str() ) != 0 ) std::remove( TempFileName.c_str() );
+
+	}
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
@@ -1120,6 +1493,8 @@ namespace InputProcessor {
 
 		MaxIDFRecords = ObjectsIDFAllocInc;
 		NumIDFRecords = 0;
+		ObjectRecords.deallocate();
+		NumIndexedRecords = 0;
 		MaxIDFSections = SectionsIDFAllocInc;
 		NumIDFSections = 0;
 
@@ -1152,11 +1527,10 @@ namespace InputProcessor {
 					if ( NumIDFSections == MaxIDFSections ) {
 						SectionsOnFile.redimension( MaxIDFSections += SectionsIDFAllocInc );
 					}
+					GrowIDFRecords(); // A section may be an object without fields
 				} else {
 					ValidateObjectandParse( idf_stream, InputLine.substr( 0, Pos ), Pos, EndofFile );
-					if ( NumIDFRecords == MaxIDFRecords ) {
-						IDFRecords.redimension( MaxIDFRecords += ObjectsIDFAllocInc );
-					}
+					GrowIDFRecords();
 				}
 			} else { // Error condition, no , or ; on first line
 				ShowMessage( "IP: IDF Line~" + IPTrimSigDigits( NumLines ) + ' ' + InputLine );
@@ -1179,6 +1553,27 @@ namespace InputProcessor {
 
 	}
 
+	void
+	GrowIDFRecords()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Makes room for more IDF records once IDFRecords is full.
+
+		// METHODOLOGY EMPLOYED:
+		// The capacity is doubled and the records already read are moved, not copied, so reading
+		// an IDF takes time in proportion to its size.
+
+		if ( NumIDFRecords < MaxIDFRecords ) return;
+		MaxIDFRecords = max( 2 * MaxIDFRecords, MaxIDFRecords + ObjectsIDFAllocInc );
+		Array1D< LineDefinition > Grown( MaxIDFRecords );
+		for ( int Record = 1; Record <= NumIDFRecords; ++Record ) {
+			Grown( Record ) = std::move( IDFRecords( Record ) );
+		}
+		IDFRecords.swap( Grown );
+
+	}
+
 	void
 	ValidateSection(
 		std::string const & ProposedSection,
@@ -1232,12 +1627,7 @@ namespace InputProcessor {
 			Found = FindItemInList( SqueezedSection, SectionDef.Name(), NumSectionDefs );
 			if ( Found == 0 ) {
 				// Make sure this Section not an object name
-				if ( SortedIDD ) {
-					OFound = FindItemInSortedList( SqueezedSection, ListOfObjects, NumObjectDefs );
-					if ( OFound != 0 ) OFound = iListOfObjects( OFound );
-				} else {
-					OFound = FindItemInList( SqueezedSection, ListOfObjects, NumObjectDefs );
-				}
+				OFound = FindObjectDefinition( SqueezedSection );
 				if ( OFound != 0 ) {
 					AddRecordFromSection( OFound );
 				} else if ( NumSectionDefs == MaxSectionDefs ) {
@@ -1362,12 +1752,7 @@ namespace InputProcessor {
 		while ( TestingObject ) {
 			errFlag = false;
 			IDidntMeanIt = false;
-			if ( SortedIDD ) {
-				Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-				if ( Found != 0 ) Found = iListOfObjects( Found );
-			} else {
-				Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-			}
+			Found = FindObjectDefinition( SqueezedObject );
 			if ( Found != 0 ) {
 				if ( ObjectDef( Found ).ObsPtr > 0 ) {
 					TFound = FindItemInList( SqueezedObject, RepObjects.OldName(), NumSecretObjects );
@@ -1375,21 +1760,11 @@ namespace InputProcessor {
 						if ( RepObjects( TFound ).Transitioned ) {
 							if ( ! RepObjects( TFound ).Used ) ShowWarningError( "IP: Objects=\"" + stripped( ProposedObject ) + "\" are being transitioned to this object=\"" + RepObjects( TFound ).NewName + "\"" );
 							RepObjects( TFound ).Used = true;
-							if ( SortedIDD ) {
-								Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-								if ( Found != 0 ) Found = iListOfObjects( Found );
-							} else {
-								Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							}
+							Found = FindObjectDefinition( SqueezedObject );
 						} else if ( RepObjects( TFound ).TransitionDefer ) {
 							if ( ! RepObjects( TFound ).Used ) ShowWarningError( "IP: Objects=\"" + stripped( ProposedObject ) + "\" are being transitioned to this object=\"" + RepObjects( TFound ).NewName + "\"" );
 							RepObjects( TFound ).Used = true;
-							if ( SortedIDD ) {
-								Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-								if ( Found != 0 ) Found = iListOfObjects( Found );
-							} else {
-								Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							}
+							Found = FindObjectDefinition( SqueezedObject );
 							TransitionDefer = true;
 						} else {
 							Found = 0; // being handled differently for this obsolete object
@@ -1426,23 +1801,13 @@ namespace InputProcessor {
 						} else {
 							ShowWarningError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Objects=\"" + stripped( ProposedObject ) + "\" are being transitioned to this object=\"" + RepObjects( Found ).NewName + "\"" );
 							RepObjects( Found ).Used = true;
-							if ( SortedIDD ) {
-								Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-								if ( Found != 0 ) Found = iListOfObjects( Found );
-							} else {
-								Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							}
+							Found = FindObjectDefinition( SqueezedObject );
 						}
 					} else if ( ! RepObjects( Found ).Transitioned ) {
 						SqueezedObject = RepObjects( Found ).NewName;
 						TestingObject = true;
 					} else {
-						if ( SortedIDD ) {
-							Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							if ( Found != 0 ) Found = iListOfObjects( Found );
-						} else {
-							Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-						}
+						Found = FindObjectDefinition( SqueezedObject );
 					}
 				}
 			} else {
@@ -2045,12 +2410,7 @@ namespace InputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Found;
 
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( MakeUPPERCase( ObjectWord ) );
 
 		if ( Found != 0 ) {
 			GetNumObjectsFound = ObjectDef( Found ).NumFound;
@@ -2111,6 +2471,186 @@ namespace InputProcessor {
 
 	}
 
+	int
+	FindObjectDefinition( std::string const & ObjectWord ) // Object type
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the object definition number of an object type, 0 if it is not in the IDD.
+
+		// METHODOLOGY EMPLOYED:
+		// Hashed lookup of the position in ListOfObjects, mapped through iListOfObjects for the
+		// sorted IDD.  A position that no longer holds the type, or a type that is not found, has the
+		// index rebuilt from ListOfObjects before giving up, so the result is always that of a search
+		// of the list.  The index is keyed by the upper case type and types not found as given are
+		// looked up in upper case, as the sorted search ignores case.
+
+		auto find_position = [&]() -> int {
+			auto Pos( ListOfObjectsIndex.find( ObjectWord ) );
+			if ( Pos == ListOfObjectsIndex.end() ) {
+				std::string const UCObjectWord( MakeUPPERCase( ObjectWord ) );
+				if ( UCObjectWord == ObjectWord ) return 0;
+				Pos = ListOfObjectsIndex.find( UCObjectWord );
+				if ( Pos == ListOfObjectsIndex.end() ) return 0;
+			}
+			int const Which( Pos->second );
+			if ( Which > min( NumObjectDefs, isize( ListOfObjects ) ) || ! equali( ListOfObjects( Which ), Pos->first ) ) return -1;
+			return Which;
+		};
+
+		if ( int( ListOfObjectsIndex.size() ) != NumObjectDefs ) BuildListOfObjectsIndex();
+		int Which( find_position() );
+		if ( Which <= 0 ) {
+			BuildListOfObjectsIndex();
+			Which = max( find_position(), 0 );
+		}
+		if ( Which != 0 && SortedIDD ) Which = iListOfObjects( Which );
+		return Which;
+
+	}
+
+	void
+	BuildListOfObjectsIndex()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the hashed index of ListOfObjects, by upper case object type, used by FindObjectDefinition.
+
+		ListOfObjectsIndex.clear();
+		int const NumObjects( min( NumObjectDefs, isize( ListOfObjects ) ) );
+		ListOfObjectsIndex.reserve( NumObjects );
+		for ( int Loop = 1; Loop <= NumObjects; ++Loop ) {
+			ListOfObjectsIndex.emplace( MakeUPPERCase( ListOfObjects( Loop ) ), Loop );
+		}
+
+	}
+
+	void
+	UpdateObjectRecords()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Brings the list of IDF records of each object type up to date with IDFRecords.
+
+		// METHODOLOGY EMPLOYED:
+		// Records are only ever added at the end, so only records past NumIndexedRecords are
+		// entered; fewer records than indexed, or another number of object definitions, means new
+		// input and the lists are started again.
+
+		if ( NumIndexedRecords > NumIDFRecords || ObjectRecords.isize() != NumObjectDefs ) {
+			ObjectRecords.deallocate();
+			ObjectRecords.allocate( NumObjectDefs );
+			NumIndexedRecords = 0;
+		}
+		for ( int Record = NumIndexedRecords + 1; Record <= NumIDFRecords; ++Record ) {
+			int const Found( FindObjectDefinition( IDFRecords( Record ).Name ) );
+			if ( Found > 0 ) ObjectRecords( Found ).Records.push_back( Record );
+		}
+		NumIndexedRecords = NumIDFRecords;
+
+	}
+
+	int
+	FindObjectRecord(
+		int const ObjectDefNum, // Object definition
+		int const Number // Item number of the object in the IDF
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the IDF record of the Number'th object of a type, 0 if there are fewer.
+
+		UpdateObjectRecords();
+		auto const & Records( ObjectRecords( ObjectDefNum ).Records );
+		if ( Number < 1 || Number > int( Records.size() ) ) return 0;
+		return Records[ Number - 1 ];
+
+	}
+
+	int
+	FindObjectItemByName(
+		int const ObjectDefNum, // Object definition
+		std::string const & ObjName // Name (first alpha field) of the object
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the item number of the first object of a type with this name, 0 if there is none.
+
+		// METHODOLOGY EMPLOYED:
+		// The names of each type are hashed when first looked up, and as records are added.
+
+		UpdateObjectRecords();
+		auto & Index( ObjectRecords( ObjectDefNum ) );
+		int const NumItems( Index.Records.size() );
+		for ( int Item = Index.NumNamed + 1; Item <= NumItems; ++Item ) {
+			auto const & Record( IDFRecords( Index.Records[ Item - 1 ] ) );
+			if ( Record.NumAlphas > 0 ) Index.Names.emplace( Record.Alphas( 1 ), Item );
+		}
+		Index.NumNamed = NumItems;
+		auto const Item( Index.Names.find( ObjName ) );
+		return ( Item != Index.Names.end() ) ? Item->second : 0;
+
+	}
+
+	bool
+	OverrideInputField(
+		std::string const & ObjectType, // Object type (IDD name)
+		std::string const & ObjectName, // Name (first alpha field) of the object
+		int const FieldNum, // Field of the object, counting alpha and numeric fields together from 1
+		std::string const & Value // New value of the field, as it would be written in the IDF
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Changes one field of an object read from the IDF, before the modules get their input, so
+		// that a variant of a model can be run from the input as processed once.  Returns false if
+		// there is no such object or field on the record, or the number is not valid; the name
+		// field itself cannot be changed.
+
+		bool ErrorFlag( false );
+
+		int const Found( FindObjectDefinition( MakeUPPERCase( ObjectType ) ) );
+		if ( Found == 0 ) return false;
+		auto const & Def( ObjectDef( Found ) );
+		if ( FieldNum < 1 || FieldNum > Def.NumParams || ( FieldNum == 1 && Def.NameAlpha1 ) ) return false;
+		std::string const Name( ( Def.NumAlpha > 0 && Def.AlphRetainCase( 1 ) ) ? ObjectName : MakeUPPERCase( ObjectName ) );
+		int const Record( FindObjectRecord( Found, FindObjectItemByName( Found, Name ) ) );
+		if ( Record == 0 ) return false;
+
+		int NumAlpha( 0 );
+		int NumNumeric( 0 );
+		for ( int Field = 1; Field <= FieldNum; ++Field ) {
+			if ( Def.AlphaOrNumeric( Field ) ) {
+				++NumAlpha;
+			} else {
+				++NumNumeric;
+			}
+		}
+		auto & IDFRecord( IDFRecords( Record ) );
+		if ( Def.AlphaOrNumeric( FieldNum ) ) {
+			if ( NumAlpha > IDFRecord.NumAlphas ) return false;
+			IDFRecord.Alphas( NumAlpha ) = Def.AlphRetainCase( NumAlpha ) ? Value : MakeUPPERCase( Value );
+			IDFRecord.AlphBlank( NumAlpha ) = Value.empty();
+		} else {
+			if ( NumNumeric > IDFRecord.NumNumbers ) return false;
+			auto const & RangeChk( Def.NumRangeChks( NumNumeric ) );
+			Real64 Number;
+			if ( RangeChk.AutoSizable && SameString( Value, "AUTOSIZE" ) ) {
+				Number = RangeChk.AutoSizeValue;
+			} else if ( RangeChk.AutoCalculatable && SameString( Value, "AUTOCALCULATE" ) ) {
+				Number = RangeChk.AutoCalculateValue;
+			} else {
+				Number = ProcessNumber( Value, ErrorFlag );
+				if ( ErrorFlag ) return false;
+			}
+			IDFRecord.Numbers( NumNumeric ) = Number;
+			IDFRecord.NumBlank( NumNumeric ) = false;
+		}
+		return true;
+
+	}
+
 	void
 	GetObjectItem(
 		std::string const & Object,
@@ -2160,14 +2700,10 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Count;
 		int LoopIndex;
-		std::string ObjectWord;
+		int Record; // IDF record of the object
 		std::string UCObject;
-		static Array1D_string AlphaArgs;
-		static Array1D< Real64 > NumberArgs;
-		static Array1D_bool AlphaArgsBlank;
-		static Array1D_bool NumberArgsBlank;
+		static bool InputProcessed( false ); // Input has been processed (or checked) on the first call
 		int MaxAlphas;
 		int MaxNumbers;
 		int Found;
@@ -2186,25 +2722,16 @@ namespace InputProcessor {
 		MaxNumbers = isize( Numbers, 1 );
 		GoodItem = false;
 
-		if ( ! allocated( AlphaArgs ) ) {
+		if ( ! InputProcessed ) {
 			if ( NumObjectDefs == 0 ) {
 				ProcessInput();
 			}
-			AlphaArgs.allocate( MaxAlphaArgsFound );
-			NumberArgs.allocate( MaxNumericArgsFound );
-			NumberArgsBlank.allocate( MaxNumericArgsFound );
-			AlphaArgsBlank.allocate( MaxAlphaArgsFound );
+			InputProcessed = true;
 		}
 
-		Count = 0;
 		Status = -1;
 		UCObject = MakeUPPERCase( Object );
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( UCObject, ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( UCObject, ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( UCObject );
 		if ( Found == 0 ) { //  This is more of a developer problem
 			ShowFatalError( "IP: GetObjectItem: Requested object=" + UCObject + ", not found in Object Definitions -- incorrect IDD attached." );
 		}
@@ -2238,43 +2765,38 @@ namespace InputProcessor {
 		}
 		++ObjectGotCount( Found );
 
-		for ( LoopIndex = StartRecord; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( IDFRecords( LoopIndex ).Name == UCObject ) {
-				++Count;
-				if ( Count == Number ) {
-					IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
-					if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
-						ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
-					}
-					NumAlphas = min( MaxAlphas, NumAlphas );
-					NumNumbers = min( MaxNumbers, NumNumbers );
-					GoodItem = true;
-					if ( NumAlphas > 0 ) {
-						Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
-					}
-					if ( NumNumbers > 0 ) {
-						Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
-					}
-					if ( present( NumBlank ) ) {
-						NumBlank = true;
-						if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
-					}
-					if ( present( AlphaBlank ) ) {
-						AlphaBlank = true;
-						if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
-					}
-					if ( present( AlphaFieldNames ) ) {
-						AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
-					}
-					if ( present( NumericFieldNames ) ) {
-						NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
-					}
-					Status = 1;
-					break;
-				}
+		Record = ( StartRecord <= NumIDFRecords ) ? FindObjectRecord( Found, Number ) : 0;
+		if ( Record > 0 ) {
+			// Read this one straight from the stored record into the caller's arrays
+			auto const & IDFRecord( IDFRecords( Record ) );
+			IDFRecordsGotten( Record ) = true; // only object level "gets" recorded
+			NumAlphas = IDFRecord.NumAlphas;
+			NumNumbers = IDFRecord.NumNumbers;
+			if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
+				ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + IDFRecord.Name, EchoInputFile );
+			}
+			GoodItem = true;
+			if ( NumAlphas > 0 ) {
+				Alphas( {1,NumAlphas} ) = IDFRecord.Alphas( {1,NumAlphas} );
+			}
+			if ( NumNumbers > 0 ) {
+				Numbers( {1,NumNumbers} ) = IDFRecord.Numbers( {1,NumNumbers} );
 			}
+			if ( present( NumBlank ) ) {
+				NumBlank = true;
+				if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = IDFRecord.NumBlank( {1,NumNumbers} );
+			}
+			if ( present( AlphaBlank ) ) {
+				AlphaBlank = true;
+				if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = IDFRecord.AlphBlank( {1,NumAlphas} );
+			}
+			if ( present( AlphaFieldNames ) ) {
+				AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
+			}
+			if ( present( NumericFieldNames ) ) {
+				NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
+			}
+			Status = 1;
 		}
 
 #ifdef IDDTEST
@@ -2301,7 +2823,7 @@ namespace InputProcessor {
 				if ( ObjectDef( Found ).AlphaOrNumeric( LoopIndex ) ) {
 					++NAfld;
 					if ( ! ObjectDef( Found ).ReqField( LoopIndex ) ) {
-						if ( AlphaArgsBlank( NAfld ) ) Alphas( NAfld ) = ObjectDef( Found ).AlphFieldDefs( NAfld );
+						if ( IDFRecords( Record ).AlphBlank( NAfld ) ) Alphas( NAfld ) = ObjectDef( Found ).AlphFieldDefs( NAfld );
 						if ( present( AlphaBlank ) ) {
 							if ( is_blank( Alphas( NAfld ) ) ) {
 								AlphaBlank()( NAfld ) = true;
@@ -2373,7 +2895,6 @@ namespace InputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
 		int NumObjOfType; // Total number of Object Type in IDF
-		int ObjNum; // Loop index variable
 		int ItemNum; // Item number for Object Name
 		int Found; // Indicator for Object Type in list of Valid Objects
 		std::string UCObjType; // Upper Case for ObjType
@@ -2385,12 +2906,7 @@ namespace InputProcessor {
 		ItemFound = false;
 		ObjectFound = false;
 		UCObjType = MakeUPPERCase( ObjType );
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( UCObjType, ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( UCObjType, ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( UCObjType );
 
 		if ( Found != 0 ) {
 
@@ -2400,15 +2916,8 @@ namespace InputProcessor {
 			StartRecord = ObjectStartRecord( Found );
 
 			if ( StartRecord > 0 ) {
-				for ( ObjNum = StartRecord; ObjNum <= NumIDFRecords; ++ObjNum ) {
-					if ( IDFRecords( ObjNum ).Name != UCObjType ) continue;
-					++ItemNum;
-					if ( ItemNum > NumObjOfType ) break;
-					if ( IDFRecords( ObjNum ).Alphas( 1 ) == ObjName ) {
-						ItemFound = true;
-						break;
-					}
-				}
+				ItemNum = FindObjectItemByName( Found, ObjName );
+				ItemFound = ( ItemNum > 0 && ItemNum <= NumObjOfType );
 			}
 		}
 
@@ -2466,22 +2975,17 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Count;
+		int Found;
 		int LoopIndex;
 		std::string ObjectWord;
 
-		Count = 0;
 		Status = -1;
-		for ( LoopIndex = 1; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( SameString( IDFRecords( LoopIndex ).Name, Object ) ) {
-				++Count;
-				if ( Count == Number ) {
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlpha, NumNumbers );
-					Status = 1;
-					break;
-				}
-			}
+		Found = FindObjectDefinition( Object );
+		LoopIndex = ( Found != 0 ) ? FindObjectRecord( Found, Number ) : 0;
+		if ( LoopIndex > 0 ) {
+			// Read this one
+			GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlpha, NumNumbers );
+			Status = 1;
 		}
 
 	}
@@ -2533,11 +3037,8 @@ namespace InputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		// Object Data
-		LineDefinition xLineItem; // Description of current record
-
 		if ( Which > 0 && Which <= NumIDFRecords ) {
-			xLineItem = IDFRecords( Which );
+			auto const & xLineItem( IDFRecords( Which ) ); // Description of current record
 			ObjectWord = xLineItem.Name;
 			NumAlpha = xLineItem.NumAlphas;
 			NumNumeric = xLineItem.NumNumbers;
@@ -4103,12 +4604,7 @@ namespace InputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Which; // to determine which object definition to use
 
-		if ( SortedIDD ) {
-			Which = FindItemInSortedList( ObjectWord, ListOfObjects, NumObjectDefs );
-			if ( Which != 0 ) Which = iListOfObjects( Which );
-		} else {
-			Which = FindItemInList( ObjectWord, ListOfObjects, NumObjectDefs );
-		}
+		Which = FindObjectDefinition( ObjectWord );
 		NumArgs = ObjectDef( Which ).NumParams;
 		AlphaOrNumeric( {1,NumArgs} ) = ObjectDef( Which ).AlphaOrNumeric( {1,NumArgs} );
 		RequiredFields( {1,NumArgs} ) = ObjectDef( Which ).ReqField( {1,NumArgs} );
@@ -4160,12 +4656,7 @@ namespace InputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Which; // to determine which object definition to use
 
-		if ( SortedIDD ) {
-			Which = FindItemInSortedList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-			if ( Which != 0 ) Which = iListOfObjects( Which );
-		} else {
-			Which = FindItemInList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-		}
+		Which = FindObjectDefinition( MakeUPPERCase( ObjectWord ) );
 
 		if ( Which > 0 ) {
 			NumArgs = ObjectDef( Which ).NumParams;
@@ -4309,12 +4800,7 @@ namespace InputProcessor {
 			//  This one not gotten
 			Found = FindItemInList( IDFRecords( Count ).Name, OrphanObjectNames, NumOrphObjNames );
 			if ( Found == 0 ) {
-				if ( SortedIDD ) {
-					ObjFound = FindItemInSortedList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-					if ( ObjFound != 0 ) ObjFound = iListOfObjects( ObjFound );
-				} else {
-					ObjFound = FindItemInList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-				}
+				ObjFound = FindObjectDefinition( IDFRecords( Count ).Name );
 				if ( ObjFound > 0 ) {
 					if ( ObjectDef( ObjFound ).ObsPtr > 0 ) continue; // Obsolete object, don't report "orphan"
 					++NumOrphObjNames;
@@ -4331,12 +4817,7 @@ namespace InputProcessor {
 					ShowWarningError( "object not found=" + IDFRecords( Count ).Name );
 				}
 			} else if ( DisplayAllWarnings ) {
-				if ( SortedIDD ) {
-					ObjFound = FindItemInSortedList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-					if ( ObjFound != 0 ) ObjFound = iListOfObjects( ObjFound );
-				} else {
-					ObjFound = FindItemInList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-				}
+				ObjFound = FindObjectDefinition( IDFRecords( Count ).Name );
 				if ( ObjFound > 0 ) {
 					if ( ObjectDef( ObjFound ).ObsPtr > 0 ) continue; // Obsolete object, don't report "orphan"
 					++NumOrphObjNames;
@@ -4574,8 +5055,7 @@ namespace InputProcessor {
 		}}
 
 		--ObjectDef( ObjPtr ).NumFound;
-		ObjPtr = FindItemInList( LineItem.Name, ListOfObjects, NumObjectDefs );
-		ObjPtr = iListOfObjects( ObjPtr );
+		ObjPtr = FindObjectDefinition( LineItem.Name );
 
 		if ( ObjPtr == 0 ) ShowFatalError( "No Object Def for " + LineItem.Name );
 		++ObjectDef( ObjPtr ).NumFound;
@@ -5121,6 +5601,7 @@ namespace InputProcessor {
 			OutputVariablesForSimulation.redimension( NumConsideredOutputVariables );
 			MaxConsideredOutputVariables = NumConsideredOutputVariables;
 		}
+		IndexOutputVariablesForSimulation();
 
 	}
 
@@ -5537,12 +6018,7 @@ namespace InputProcessor {
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 
 		int Found;
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( UCObjType, ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( UCObjType, ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( UCObjType );
 
 		int StartPointer;
 		if ( Found != 0 ) {
@@ -5596,14 +6072,12 @@ namespace InputProcessor {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 
-		int NextPointer = 0;
-		for ( int ObjNum = StartPointer + 1; ObjNum <= NumIDFRecords; ++ObjNum ) {
-			if ( IDFRecords( ObjNum ).Name != UCObjType ) continue;
-			NextPointer = ObjNum;
-			break;
-		}
-
-		return NextPointer;
+		int const Found( FindObjectDefinition( UCObjType ) );
+		if ( Found == 0 ) return 0;
+		UpdateObjectRecords();
+		auto const & Records( ObjectRecords( Found ).Records );
+		auto const Next( std::upper_bound( Records.begin(), Records.end(), StartPointer ) );
+		return ( Next != Records.end() ) ? *Next : 0;
 
 	}
 
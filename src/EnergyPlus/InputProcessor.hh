@@ -2,7 +2,10 @@
 #define InputProcessor_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <iosfwd>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -89,6 +92,7 @@ namespace InputProcessor {
 	extern Array1D_int iListOfObjects;
 	extern Array1D_int ObjectGotCount;
 	extern Array1D_int ObjectStartRecord;
+	extern std::unordered_map< std::string, int > ListOfObjectsIndex; // Position of each object type in ListOfObjects
 	extern std::string CurrentFieldName; // Current Field Name (IDD)
 	extern Array1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	extern std::string ReplacementName;
@@ -107,6 +111,9 @@ namespace InputProcessor {
 	extern bool ExtensibleObject; // Set to true when ReadInputLine has an extensible object
 	extern int ExtensibleNumFields; // set to number when ReadInputLine has an extensible object
 	extern Array1D_bool IDFRecordsGotten; // Denotes that this record has been "gotten" from the IDF
+	extern int NumIndexedRecords; // IDF records entered in ObjectRecords
+	extern std::uint64_t LoadedIDDHash; // Hash of the IDD text the definitions were read from
+	extern bool PreloadedIDD; // Definitions were read by PreloadDataDictionary and not yet used
 
 	//Derived Types Variables
 
@@ -402,12 +409,27 @@ namespace InputProcessor {
 
 	};
 
+	struct ObjectRecordsIndex
+	{
+		// Members
+		std::vector< int > Records; // IDF records of this object type, in file order
+		std::unordered_map< std::string, int > Names; // Name (first alpha field) to item number of its first occurrence
+		int NumNamed; // Items of Records entered in Names
+
+		// Default Constructor
+		ObjectRecordsIndex() :
+			NumNamed( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< ObjectsDefinition > ObjectDef; // Contains all the Valid Objects on the IDD
 	extern Array1D< SectionsDefinition > SectionDef; // Contains all the Valid Sections on the IDD
 	extern Array1D< FileSectionsDefinition > SectionsOnFile; // lists the sections on file (IDF)
 	extern LineDefinition LineItem; // Description of current record
 	extern Array1D< LineDefinition > IDFRecords; // All the objects read from the IDF
+	extern Array1D< ObjectRecordsIndex > ObjectRecords; // IDF records of each object definition
 	extern Array1D< SecretObjects > RepObjects; // Secret Objects that could replace old ones
 
 	// Functions
@@ -415,6 +437,30 @@ namespace InputProcessor {
 	void
 	ProcessInput();
 
+	void
+	LoadDataDictionary(
+		std::istream & idd_stream,
+		bool & ErrorsFound // set to true if any errors flagged during IDD processing
+	);
+
+	bool
+	PreloadDataDictionary( std::string const & IddFileName ); // Data dictionary to read
+
+	std::uint64_t
+	IDDCacheHash( std::string const & IddText ); // Full text of the data dictionary
+
+	bool
+	ReadIDDCache(
+		std::string const & FileName, // Pre-parsed data dictionary file
+		std::uint64_t const IddHash // Hash of the data dictionary text
+	);
+
+	void
+	WriteIDDCache(
+		std::string const & FileName, // Pre-parsed data dictionary file
+		std::uint64_t const IddHash // Hash of the data dictionary text
+	);
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
@@ -439,6 +485,9 @@ namespace InputProcessor {
 	void
 	ProcessInputDataFile( std::istream & idf_stream );
 
+	void
+	GrowIDFRecords();
+
 	void
 	ValidateSection(
 		std::string const & ProposedSection,
@@ -478,6 +527,35 @@ namespace InputProcessor {
 		int & LastRecord
 	);
 
+	int
+	FindObjectDefinition( std::string const & ObjectWord ); // Object type
+
+	void
+	BuildListOfObjectsIndex();
+
+	void
+	UpdateObjectRecords();
+
+	int
+	FindObjectRecord(
+		int const ObjectDefNum, // Object definition
+		int const Number // Item number of the object in the IDF
+	);
+
+	int
+	FindObjectItemByName(
+		int const ObjectDefNum, // Object definition
+		std::string const & ObjName // Name (first alpha field) of the object
+	);
+
+	bool
+	OverrideInputField(
+		std::string const & ObjectType, // Object type (IDD name)
+		std::string const & ObjectName, // Name (first alpha field) of the object
+		int const FieldNum, // Field of the object, counting alpha and numeric fields together from 1
+		std::string const & Value // New value of the field, as it would be written in the IDF
+	);
+
 	void
 	GetObjectItem(
 		std::string const & Object,
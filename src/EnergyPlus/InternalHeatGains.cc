@@ -4432,17 +4432,41 @@ namespace InternalHeatGains {
 			if ( SumLatentGains ) ReSumLatentGains = true;
 		}
 
-		// store pointer values to hold generic internal gain values constant for entire timestep
+		// store pointer values to hold generic internal gain values constant for entire timestep,
+		// and their sums by zone, which change only here
 		for ( NZ = 1; NZ <= NumOfZones; ++NZ ) {
-			for ( Loop = 1; Loop <= ZoneIntGain( NZ ).NumberOfDevices; ++Loop ) {
-				ZoneIntGain( NZ ).Device( Loop ).ConvectGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrConvectGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).ReturnAirConvGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrReturnAirConvGainRate;
-				if ( DoRadiationUpdate ) ZoneIntGain( NZ ).Device( Loop ).RadiantGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrRadiantGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).LatentGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrLatentGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).ReturnAirLatentGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrReturnAirLatentGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).CarbonDioxideGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrCarbonDioxideGainRate;
-				ZoneIntGain( NZ ).Device( Loop ).GenericContamGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrGenericContamGainRate;
+			auto & zoneIntGain( ZoneIntGain( NZ ) );
+			Real64 SumConvGainRate( 0.0 );
+			Real64 SumReturnAirConvGainRate( 0.0 );
+			Real64 SumRadiantGainRate( 0.0 );
+			Real64 SumLatentGainRate( 0.0 );
+			Real64 SumReturnAirLatentGainRate( 0.0 );
+			Real64 SumCarbonDioxideGainRate( 0.0 );
+			Real64 SumGenericContamGainRate( 0.0 );
+			for ( Loop = 1; Loop <= zoneIntGain.NumberOfDevices; ++Loop ) {
+				auto & device( zoneIntGain.Device( Loop ) );
+				device.ConvectGainRate = device.PtrConvectGainRate;
+				device.ReturnAirConvGainRate = device.PtrReturnAirConvGainRate;
+				if ( DoRadiationUpdate ) device.RadiantGainRate = device.PtrRadiantGainRate;
+				device.LatentGainRate = device.PtrLatentGainRate;
+				device.ReturnAirLatentGainRate = device.PtrReturnAirLatentGainRate;
+				device.CarbonDioxideGainRate = device.PtrCarbonDioxideGainRate;
+				device.GenericContamGainRate = device.PtrGenericContamGainRate;
+				SumConvGainRate += device.ConvectGainRate;
+				SumReturnAirConvGainRate += device.ReturnAirConvGainRate;
+				SumRadiantGainRate += device.RadiantGainRate;
+				SumLatentGainRate += device.LatentGainRate;
+				SumReturnAirLatentGainRate += device.ReturnAirLatentGainRate;
+				SumCarbonDioxideGainRate += device.CarbonDioxideGainRate;
+				SumGenericContamGainRate += device.GenericContamGainRate;
 			}
+			zoneIntGain.SumConvGainRate = SumConvGainRate;
+			zoneIntGain.SumReturnAirConvGainRate = SumReturnAirConvGainRate;
+			zoneIntGain.SumRadiantGainRate = SumRadiantGainRate;
+			zoneIntGain.SumLatentGainRate = SumLatentGainRate;
+			zoneIntGain.SumReturnAirLatentGainRate = SumReturnAirLatentGainRate;
+			zoneIntGain.SumCarbonDioxideGainRate = SumCarbonDioxideGainRate;
+			zoneIntGain.SumGenericContamGainRate = SumGenericContamGainRate;
 			if ( ReSumLatentGains ) {
 				SumAllInternalLatentGains( NZ, ZoneLatentGain( NZ ) );
 			}
@@ -4474,7 +4498,8 @@ namespace InternalHeatGains {
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The sum over the devices of the zone is kept by UpdateInternalGainValues, where the
+		// device gains are set.
 
 		// REFERENCES:
 		// na
@@ -4494,22 +4519,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumConvGainRate;
-		int DeviceNum;
-
-		tmpSumConvGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumConvGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumConvGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ConvectGainRate;
-		}
-
-		SumConvGainRate = tmpSumConvGainRate;
+		// FLOW:
+		SumConvGainRate = ZoneIntGain( ZoneNum ).SumConvGainRate;
 
 	}
 
@@ -4598,7 +4609,8 @@ namespace InternalHeatGains {
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The sum over the devices of the zone is kept by UpdateInternalGainValues, where the
+		// device gains are set.
 
 		// REFERENCES:
 		// na
@@ -4618,22 +4630,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumRetAirGainRate;
-		int DeviceNum;
-
-		tmpSumRetAirGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumReturnAirGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumRetAirGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirConvGainRate;
-		}
-
-		SumReturnAirGainRate = tmpSumRetAirGainRate;
+		// FLOW:
+		SumReturnAirGainRate = ZoneIntGain( ZoneNum ).SumReturnAirConvGainRate;
 
 	}
 
@@ -4722,7 +4720,8 @@ namespace InternalHeatGains {
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The sum over the devices of the zone is kept by UpdateInternalGainValues, where the
+		// device gains are set.
 
 		// REFERENCES:
 		// na
@@ -4742,22 +4741,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumRadGainRate;
-		int DeviceNum;
-
-		tmpSumRadGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumRadGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumRadGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).RadiantGainRate;
-		}
-
-		SumRadGainRate = tmpSumRadGainRate;
+		// FLOW:
+		SumRadGainRate = ZoneIntGain( ZoneNum ).SumRadiantGainRate;
 
 	}
 
@@ -4846,7 +4831,8 @@ namespace InternalHeatGains {
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The sum over the devices of the zone is kept by UpdateInternalGainValues, where the
+		// device gains are set.
 
 		// REFERENCES:
 		// na
@@ -4866,22 +4852,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumLatentGainRate;
-		int DeviceNum;
-
-		tmpSumLatentGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumLatentGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).LatentGainRate;
-		}
-
-		SumLatentGainRate = tmpSumLatentGainRate;
+		// FLOW:
+		SumLatentGainRate = ZoneIntGain( ZoneNum ).SumLatentGainRate;
 
 	}
 
@@ -4970,7 +4942,8 @@ namespace InternalHeatGains {
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The sum over the devices of the zone is kept by UpdateInternalGainValues, where the
+		// device gains are set.
 
 		// REFERENCES:
 		// na
@@ -4990,22 +4963,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumLatentGainRate;
-		int DeviceNum;
-
-		tmpSumLatentGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumRetAirLatentGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirLatentGainRate;
-		}
-
-		SumRetAirLatentGainRate = tmpSumLatentGainRate;
+		// FLOW:
+		SumRetAirLatentGainRate = ZoneIntGain( ZoneNum ).SumReturnAirLatentGainRate;
 
 	}
 
@@ -5026,7 +4985,8 @@ namespace InternalHeatGains {
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The sum over the devices of the zone is kept by UpdateInternalGainValues, where the
+		// device gains are set.
 
 		// REFERENCES:
 		// na
@@ -5046,22 +5006,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumCO2GainRate;
-		int DeviceNum;
-
-		tmpSumCO2GainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumCO2GainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumCO2GainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).CarbonDioxideGainRate;
-		}
-
-		SumCO2GainRate = tmpSumCO2GainRate;
+		// FLOW:
+		SumCO2GainRate = ZoneIntGain( ZoneNum ).SumCarbonDioxideGainRate;
 
 	}
 
@@ -5150,7 +5096,8 @@ namespace InternalHeatGains {
 		// worker routine for summing all the internal gain types based on the existing subrotine SumAllInternalCO2Gains
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The sum over the devices of the zone is kept by UpdateInternalGainValues, where the
+		// device gains are set.
 
 		// REFERENCES:
 		// na
@@ -5170,22 +5117,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumGCGainRate;
-		int DeviceNum;
-
-		tmpSumGCGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumGCGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumGCGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).GenericContamGainRate;
-		}
-
-		SumGCGainRate = tmpSumGCGainRate;
+		// FLOW:
+		SumGCGainRate = ZoneIntGain( ZoneNum ).SumGenericContamGainRate;
 
 	}
 
@@ -23,6 +23,7 @@
 #include <DataSizing.hh>
 #include <DataSurfaceLists.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <EMSManager.hh>
@@ -2659,6 +2660,7 @@ namespace LowTempRadiantSystem {
 		using DataSurfaces::Surface;
 		using DataSurfaces::HeatTransferModel_CondFD;
 		using DataSurfaces::HeatTransferModel_CTF;
+		using DataSystemVariables::RadiantSysLinearCoupling;
 		using PlantUtilities::SetComponentFlowRate;
 
 		// Locals
@@ -2680,6 +2682,7 @@ namespace LowTempRadiantSystem {
 		Real64 DewPointTemp; // Dew-point temperature based on the zone air conditions
 		Real64 EpsMdotCp; // Epsilon (heat exchanger terminology) times water mass flow rate times water specific heat
 		Real64 FullWaterMassFlow; // Original water mass flow rate before reducing the flow for condensation concerns
+		bool LinearCoupling; // TRUE if the trial surface temperatures come from the linearized surface heat balances
 		Real64 LowestRadSurfTemp; // Lowest surface temperature of a radiant system (when condensation is a concern)
 		Real64 PredictedCondTemp; // Temperature at which condensation is predicted (includes user parameter)
 		int RadSurfNum; // DO loop counter for the surfaces that comprise a particular radiant system
@@ -2936,7 +2939,13 @@ namespace LowTempRadiantSystem {
 					// the surface that was causing the lowest temperature.  Then, interpolate to find the flow that
 					// would still allow the system to operate without producing condensation.  Rerun the heat balance
 					// and recheck for condensation.  If condensation still exists, shut everything down.  This avoids
-					// excessive iteration and still makes an attempt to vary the flow rate.
+					// excessive iteration and still makes an attempt to vary the flow rate.  With RadiantSysLinearCoupling,
+					// the trial surface temperatures are solved from the heat balance coefficients of the radiant surfaces
+					// and the zone is only resimulated once the flow is known.
+					LinearCoupling = RadiantSysLinearCoupling;
+					for ( RadSurfNum2 = 1; RadSurfNum2 <= HydrRadSys( RadSysNum ).NumOfSurfaces; ++RadSurfNum2 ) {
+						if ( Surface( HydrRadSys( RadSysNum ).SurfacePtr( RadSurfNum2 ) ).HeatTransferAlgorithm != HeatTransferModel_CTF ) LinearCoupling = false;
+					}
 					// First, shut everything off...
 					FullWaterMassFlow = WaterMassFlow;
 					WaterMassFlow = 0.0;
@@ -2948,11 +2957,13 @@ namespace LowTempRadiantSystem {
 						if ( Surface( SurfNum2 ).ExtBoundCond > 0 && Surface( SurfNum2 ).ExtBoundCond != SurfNum2 ) QRadSysSource( Surface( SurfNum2 ).ExtBoundCond ) = 0.0; // Also zero the other side of an interzone
 					}
 					// Redo the heat balances since we have changed the heat source (set it to zero)
-					CalcHeatBalanceOutsideSurf( ZoneNum );
-					CalcHeatBalanceInsideSurf( ZoneNum );
+					if ( ! LinearCoupling ) {
+						CalcHeatBalanceOutsideSurf( ZoneNum );
+						CalcHeatBalanceInsideSurf( ZoneNum );
+					}
 					// Now check all of the surface temperatures.  If any potentially have condensation, leave the system off.
 					for ( RadSurfNum2 = 1; RadSurfNum2 <= HydrRadSys( RadSysNum ).NumOfSurfaces; ++RadSurfNum2 ) {
-						if ( TH( 2, 1, HydrRadSys( RadSysNum ).SurfacePtr( RadSurfNum2 ) ) < ( DewPointTemp + HydrRadSys( RadSysNum ).CondDewPtDeltaT ) ) {
+						if ( RadSysInsideSurfTemp( HydrRadSys( RadSysNum ).SurfacePtr( RadSurfNum2 ), LinearCoupling ) < ( DewPointTemp + HydrRadSys( RadSysNum ).CondDewPtDeltaT ) ) {
 							HydrRadSys( RadSysNum ).CondCausedShutDown = true;
 						}
 					}
@@ -2961,7 +2972,7 @@ namespace LowTempRadiantSystem {
 					// flow rate.
 					if ( ! HydrRadSys( RadSysNum ).CondCausedShutDown ) {
 						PredictedCondTemp = DewPointTemp + HydrRadSys( RadSysNum ).CondDewPtDeltaT;
-						ZeroFlowSurfTemp = TH( 2, 1, HydrRadSys( RadSysNum ).SurfacePtr( CondSurfNum ) );
+						ZeroFlowSurfTemp = RadSysInsideSurfTemp( HydrRadSys( RadSysNum ).SurfacePtr( CondSurfNum ), LinearCoupling );
 						ReductionFrac = ( ZeroFlowSurfTemp - PredictedCondTemp ) / std::abs( ZeroFlowSurfTemp - LowestRadSurfTemp );
 						if ( ReductionFrac < 0.0 ) ReductionFrac = 0.0; // Shouldn't happen as the above check should have screened this out
 						if ( ReductionFrac > 1.0 ) ReductionFrac = 1.0; // Shouldn't happen either because condensation doesn't exist then
@@ -2998,14 +3009,16 @@ namespace LowTempRadiantSystem {
 						}
 
 						// Redo the heat balances since we have changed the heat source
-						CalcHeatBalanceOutsideSurf( ZoneNum );
-						CalcHeatBalanceInsideSurf( ZoneNum );
+						if ( ! LinearCoupling ) {
+							CalcHeatBalanceOutsideSurf( ZoneNum );
+							CalcHeatBalanceInsideSurf( ZoneNum );
+						}
 
 						// Check for condensation one more time.  If no condensation, we are done.  If there is
 						// condensation, shut things down and be done.
 						for ( RadSurfNum2 = 1; RadSurfNum2 <= HydrRadSys( RadSysNum ).NumOfSurfaces; ++RadSurfNum2 ) {
 							if ( HydrRadSys( RadSysNum ).CondCausedShutDown ) break;
-							if ( TH( 2, 1, HydrRadSys( RadSysNum ).SurfacePtr( RadSurfNum2 ) ) < ( PredictedCondTemp ) ) {
+							if ( RadSysInsideSurfTemp( HydrRadSys( RadSysNum ).SurfacePtr( RadSurfNum2 ), LinearCoupling ) < ( PredictedCondTemp ) ) {
 								// Condensation still present--must shut off radiant system
 								HydrRadSys( RadSysNum ).CondCausedShutDown = true;
 								WaterMassFlow = 0.0;
@@ -3029,7 +3042,7 @@ namespace LowTempRadiantSystem {
 								ShowWarningMessage( cHydronicSystem + " [" + HydrRadSys( RadSysNum ).Name + ']' );
 								ShowContinueError( "Surface [" + Surface( HydrRadSys( RadSysNum ).SurfacePtr( CondSurfNum ) ).Name + "] temperature below dew-point temperature--potential for condensation exists" );
 								ShowContinueError( "Flow to the radiant system will be shut-off to avoid condensation" );
-								ShowContinueError( "Predicted radiant system surface temperature = " + RoundSigDigits( TH( 2, 1, HydrRadSys( RadSysNum ).SurfacePtr( CondSurfNum ) ), 2 ) );
+								ShowContinueError( "Predicted radiant system surface temperature = " + RoundSigDigits( RadSysInsideSurfTemp( HydrRadSys( RadSysNum ).SurfacePtr( CondSurfNum ), LinearCoupling ), 2 ) );
 								ShowContinueError( "Zone dew-point temperature + safety delta T= " + RoundSigDigits( DewPointTemp + HydrRadSys( RadSysNum ).CondDewPtDeltaT, 2 ) );
 								ShowContinueErrorTimeStamp( "" );
 								ShowContinueError( "Note that a " + RoundSigDigits( HydrRadSys( RadSysNum ).CondDewPtDeltaT, 4 ) + " C safety was chosen in the input for the shut-off criteria" );
@@ -3100,6 +3113,7 @@ namespace LowTempRadiantSystem {
 		using DataHVACGlobals::SmallLoad;
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
+		using DataSystemVariables::RadiantSysLinearCoupling;
 		using FluidProperties::GetSpecificHeatGlycol;
 		using ScheduleManager::GetCurrentScheduleValue;
 		using General::TrimSigDigits;
@@ -3377,9 +3391,11 @@ namespace LowTempRadiantSystem {
 					// step is to try the inlet temperature and flow rate as in Case 1.  If we can obtain
 					// the proper temperature inlet to the radiant system, then we are done.  If not, we
 					// have to repeat the solution for an unknown inlet temperature and a known recirculation
-					// rate.
+					// rate.  With RadiantSysLinearCoupling, the outlet temperature of this first try comes from the
+					// heat balance coefficients of the radiant surfaces alone and the zone is resimulated once the
+					// injection flow is settled.
 					CFloRadSys( RadSysNum ).WaterInletTemp = RadInTemp;
-					CalcLowTempCFloRadSysComps( RadSysNum, LoopInNode, Iteration, LoadMet );
+					CalcLowTempCFloRadSysComps( RadSysNum, LoopInNode, Iteration, LoadMet, ! RadiantSysLinearCoupling );
 
 					// Now see if we can really get that desired into temperature (RadInTemp) by solving
 					// for the flow that is injected from the loop.  A heat balance for the mixer that relates
@@ -3404,6 +3420,11 @@ namespace LowTempRadiantSystem {
 					} else {
 						CFloRadSys( RadSysNum ).WaterInjectionRate = InjectFlowRate;
 						CFloRadSys( RadSysNum ).WaterRecircRate = CFloRadSys( RadSysNum ).WaterMassFlowRate - CFloRadSys( RadSysNum ).WaterInjectionRate;
+						if ( RadiantSysLinearCoupling ) {
+							CalcHeatBalanceOutsideSurf( ZoneNum );
+							CalcHeatBalanceInsideSurf( ZoneNum );
+							LoadMet = SumHATsurf( ZoneNum ) - ZeroSourceSumHATsurf( ZoneNum );
+						}
 
 					}
 
@@ -3482,7 +3503,7 @@ namespace LowTempRadiantSystem {
 						} else {
 							CFloRadSys( RadSysNum ).WaterInletTemp = LoopReqTemp;
 						}
-						CalcLowTempCFloRadSysComps( RadSysNum, LoopInNode, Iteration, LoadMet );
+						CalcLowTempCFloRadSysComps( RadSysNum, LoopInNode, Iteration, LoadMet, ! RadiantSysLinearCoupling );
 
 						// Now see if we can really get that desired into temperature (RadInTemp) by solving
 						// for the flow that is injected from the loop.  A heat balance for the mixer that relates
@@ -3507,6 +3528,11 @@ namespace LowTempRadiantSystem {
 						} else {
 							CFloRadSys( RadSysNum ).WaterInjectionRate = InjectFlowRate;
 							CFloRadSys( RadSysNum ).WaterRecircRate = CFloRadSys( RadSysNum ).WaterMassFlowRate - CFloRadSys( RadSysNum ).WaterInjectionRate;
+							if ( RadiantSysLinearCoupling ) {
+								CalcHeatBalanceOutsideSurf( ZoneNum );
+								CalcHeatBalanceInsideSurf( ZoneNum );
+								LoadMet = SumHATsurf( ZoneNum ) - ZeroSourceSumHATsurf( ZoneNum );
+							}
 
 						}
 
@@ -3563,7 +3589,8 @@ namespace LowTempRadiantSystem {
 		int const RadSysNum, // Index for the low temperature radiant system under consideration
 		int const MainLoopNodeIn, // Node number on main loop of the inlet node to the radiant system
 		bool const Iteration, // FALSE for the regular solution, TRUE when we had to loop back
-		Real64 & LoadMet // Load met by the low temperature radiant system, in Watts
+		Real64 & LoadMet, // Load met by the low temperature radiant system, in Watts
+		bool const ResimulateZone // FALSE to leave the surface heat balances and LoadMet to the caller
 	)
 	{
 
@@ -4031,10 +4058,12 @@ namespace LowTempRadiantSystem {
 		// the new SumHATsurf value for the zone.  Note that the difference between the new
 		// SumHATsurf and the value originally calculated by the heat balance with a zero
 		// source for all radiant systems in the zone is the load met by the system (approximately).
-		CalcHeatBalanceOutsideSurf( ZoneNum );
-		CalcHeatBalanceInsideSurf( ZoneNum );
+		if ( ResimulateZone ) {
+			CalcHeatBalanceOutsideSurf( ZoneNum );
+			CalcHeatBalanceInsideSurf( ZoneNum );
 
-		LoadMet = SumHATsurf( CFloRadSys( RadSysNum ).ZonePtr ) - ZeroSourceSumHATsurf( CFloRadSys( RadSysNum ).ZonePtr );
+			LoadMet = SumHATsurf( CFloRadSys( RadSysNum ).ZonePtr ) - ZeroSourceSumHATsurf( CFloRadSys( RadSysNum ).ZonePtr );
+		}
 
 		//  DEALLOCATE(Ckj)
 		//  DEALLOCATE(Cmj)
@@ -4541,6 +4570,48 @@ namespace LowTempRadiantSystem {
 
 	}
 
+	Real64
+	RadSysInsideSurfTemp(
+		int const SurfNum, // Index for radiant surface in Surface derived type
+		bool const LinearCoupling // TRUE to solve the temperature from the linearized surface heat balance
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the inside face temperature of a radiant system surface
+		// for the condensation checks of the radiant system.
+
+		// METHODOLOGY EMPLOYED:
+		// Without LinearCoupling this is the temperature of the last surface heat balance.
+		// With it, the inside and outside heat balance coefficients of the CTF surface left
+		// by the last surface heat balance are solved for the current source flux, as in
+		// CalcLowTempHydrRadSysComps:
+		//   Tinside  = (Ca + Cb*Cd + (Cc+Cb*Cf)*q") / (1 - Ce*Cb)
+		// The coefficients hold everything but the source flux fixed, so the temperature
+		// departs from that of a resimulated zone only by the change of the radiant exchange
+		// and convection terms with the source.
+
+		// Using/Aliasing
+		using DataHeatBalFanSys::RadSysTiHBConstCoef;
+		using DataHeatBalFanSys::RadSysTiHBToutCoef;
+		using DataHeatBalFanSys::RadSysTiHBQsrcCoef;
+		using DataHeatBalFanSys::RadSysToHBConstCoef;
+		using DataHeatBalFanSys::RadSysToHBTinCoef;
+		using DataHeatBalFanSys::RadSysToHBQsrcCoef;
+		using DataHeatBalSurface::TH;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 SourceFlux; // Heat source/sink of the surface per unit area, in W/m2
+
+		if ( ! LinearCoupling ) return TH( 2, 1, SurfNum );
+
+		SourceFlux = 0.0;
+		if ( Surface( SurfNum ).Area > 0.0 ) SourceFlux = QRadSysSource( SurfNum ) / Surface( SurfNum ).Area;
+
+		return ( RadSysTiHBConstCoef( SurfNum ) + RadSysTiHBToutCoef( SurfNum ) * RadSysToHBConstCoef( SurfNum ) + ( RadSysTiHBQsrcCoef( SurfNum ) + RadSysTiHBToutCoef( SurfNum ) * RadSysToHBQsrcCoef( SurfNum ) ) * SourceFlux ) / ( 1.0 - RadSysToHBTinCoef( SurfNum ) * RadSysTiHBToutCoef( SurfNum ) );
+
+	}
+
 	Real64
 	CalcRadSysHXEffectTerm(
 		int const RadSysNum, // Index number of radiant system under consideration !unused1208
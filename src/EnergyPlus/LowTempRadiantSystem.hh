@@ -885,7 +885,8 @@ namespace LowTempRadiantSystem {
 		int const RadSysNum, // Index for the low temperature radiant system under consideration
 		int const MainLoopNodeIn, // Node number on main loop of the inlet node to the radiant system
 		bool const Iteration, // FALSE for the regular solution, TRUE when we had to loop back
-		Real64 & LoadMet // Load met by the low temperature radiant system, in Watts
+		Real64 & LoadMet, // Load met by the low temperature radiant system, in Watts
+		bool const ResimulateZone = true // FALSE to leave the surface heat balances and LoadMet to the caller
 	);
 
 	void
@@ -910,6 +911,12 @@ namespace LowTempRadiantSystem {
 		Real64 const mdot
 	);
 
+	Real64
+	RadSysInsideSurfTemp(
+		int const SurfNum, // Index for radiant surface in Surface derived type
+		bool const LinearCoupling // TRUE to solve the temperature from the linearized surface heat balance
+	);
+
 	Real64
 	CalcRadSysHXEffectTerm(
 		int const RadSysNum, // Index number of radiant system under consideration !unused1208
@@ -18,6 +18,7 @@
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataLoopNode.hh>
+#include <DataPhotovoltaics.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <EMSManager.hh>
@@ -315,6 +316,10 @@ namespace ManageElectricPower {
 				Inverter.QdotRadZone() = 0.0;
 			}
 
+			for ( LoadCenterNum = 1; LoadCenterNum <= NumLoadCenters; ++LoadCenterNum ) {
+				ElecLoadCenter( LoadCenterNum ).DispatchInputs.clear();
+			}
+
 			if ( NumElecStorageDevices > 0 ) {
 				ElecStorage.PelNeedFromStorage() = 0.0;
 				ElecStorage.PelFromStorage() = 0.0;
@@ -365,80 +370,43 @@ namespace ManageElectricPower {
 				ElecLoadCenter( LoadCenterNum ).DemandMeterPtr = GetMeterIndex( ElecLoadCenter( LoadCenterNum ).DemandMeterName );
 			}
 
-			ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = 0.0;
-			ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest = 0.0;
-
-			// Check Operation Scheme and assign power generation load
-			// Both the Demand Limit and Track Electrical schemes will sequentially load the available generators.  All demand
-			// not met by available generator capacity will be met by purchased electrical.
-			// If a generator is needed in the simulation for a small load and it is less than the minimum part load ratio
-			// the generator will operate at the minimum part load ratio and the excess will either reduce demand or
-			// be available for storage or sell back to the power company.
-			{ auto const SELECT_CASE_var( ElecLoadCenter( LoadCenterNum ).OperationScheme );
-
-			if ( SELECT_CASE_var == iOpSchemeBaseLoad ) { // 'BASELOAD'
-
-				LoadCenterElectricLoad = WholeBldgRemainingLoad;
-
+			if ( LoadCenterDispatchUnchanged( LoadCenterNum, WholeBldgRemainingLoad, LoadCenterElectricLoad ) ) {
+				// The generators run as they did at the last dispatch, only their power is taken off the building load again
 				for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
-
-					if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 ) {
-						// Set the Operation Flag
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-						// Set the electric generator load request
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).CompType_Num == iGeneratorPV ) {
+						WholeBldgRemainingLoad -= ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).DCElectProdRate;
 					} else {
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
+						WholeBldgRemainingLoad -= ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ElectProdRate;
 					}
-
-					// now handle EMS override
-					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-						} else {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						}
-					}
-
-					// Get generator's actual electrical and thermal power outputs
-					GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
-
-					ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep;
-
-					WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 				}
+			} else {
+				ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = 0.0;
+				ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest = 0.0;
 
-			} else if ( SELECT_CASE_var == iOpSchemeDemandLimit ) { // 'DEMAND LIMIT'
-				// The Demand Limit scheme tries to have the generators meet all of the demand above the purchased Electric
-				//  limit set by the user.
-				RemainingLoad = WholeBldgRemainingLoad - ElecLoadCenter( LoadCenterNum ).DemandLimit;
-				LoadCenterElectricLoad = RemainingLoad;
+				// Check Operation Scheme and assign power generation load
+				// Both the Demand Limit and Track Electrical schemes will sequentially load the available generators.  All demand
+				// not met by available generator capacity will be met by purchased electrical.
+				// If a generator is needed in the simulation for a small load and it is less than the minimum part load ratio
+				// the generator will operate at the minimum part load ratio and the excess will either reduce demand or
+				// be available for storage or sell back to the power company.
+				{ auto const SELECT_CASE_var( ElecLoadCenter( LoadCenterNum ).OperationScheme );
 
-				for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
+				if ( SELECT_CASE_var == iOpSchemeBaseLoad ) { // 'BASELOAD'
 
-					if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
-						// Set the Operation Flag
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+					LoadCenterElectricLoad = WholeBldgRemainingLoad;
 
-						// Set the electric generator load
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
+					for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
 
-						// now handle EMS override
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-							}
+						if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 ) {
+							// Set the Operation Flag
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+							// Set the electric generator load request
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+						} else {
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
 						}
 
-					} else {
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
-
 						// now handle EMS override
 						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
 							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
@@ -448,211 +416,199 @@ namespace ManageElectricPower {
 								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
 							}
 						}
-					}
 
-					// Get generator's actual electrical and thermal power outputs
-					GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+						// Get generator's actual electrical and thermal power outputs
+						GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
 
-					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-						ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-					} else {
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
-						}
+						ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep;
+
+						WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 					}
-					RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
-					WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 
-				}
+				} else if ( SELECT_CASE_var == iOpSchemeDemandLimit ) { // 'DEMAND LIMIT'
+					// The Demand Limit scheme tries to have the generators meet all of the demand above the purchased Electric
+					//  limit set by the user.
+					RemainingLoad = WholeBldgRemainingLoad - ElecLoadCenter( LoadCenterNum ).DemandLimit;
+					LoadCenterElectricLoad = RemainingLoad;
 
-			} else if ( SELECT_CASE_var == iOpSchemeTrackElectrical ) { // 'TRACK ELECTRICAL'
-				//The Track Electrical scheme tries to have the generators meet all of the electrical demand for the building.
-				RemainingLoad = WholeBldgRemainingLoad;
-				LoadCenterElectricLoad = RemainingLoad;
+					for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
 
-				for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
+						if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
+							// Set the Operation Flag
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
 
-					if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
-						// Set the Operation Flag
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+							// Set the electric generator load
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
+
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								}
+							}
 
-						// Set the electric generator load
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
+						} else {
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
 
-						// now handle EMS override
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								}
 							}
 						}
 
-					} else {
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
+						// Get generator's actual electrical and thermal power outputs
+						GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
 
-						// now handle EMS override
 						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+						} else {
 							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
 							}
 						}
-					}
-
-					// Get generator's actual electrical and thermal power outputs
-					GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+						RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
+						WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 
-					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-						ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-					} else {
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
-						}
 					}
-					RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
-					WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 
-				}
+				} else if ( SELECT_CASE_var == iOpSchemeTrackElectrical ) { // 'TRACK ELECTRICAL'
+					//The Track Electrical scheme tries to have the generators meet all of the electrical demand for the building.
+					RemainingLoad = WholeBldgRemainingLoad;
+					LoadCenterElectricLoad = RemainingLoad;
 
-			} else if ( SELECT_CASE_var == iOpSchemeTrackSchedule ) { // 'TRACK SCHEDULE'
-				// The Track Schedule scheme tries to have the generators meet the electrical demand determined from a schedule.
-				//  Code is very similar to 'Track Electrical' except for initial RemainingLoad is replaced by SchedElecDemand
-				//  and PV production is ignored.
-				RemainingLoad = GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).TrackSchedPtr );
-				LoadCenterElectricLoad = RemainingLoad;
+					for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
 
-				for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
+						if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
+							// Set the Operation Flag
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
 
-					if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
-						// Set the Operation Flag
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+							// Set the electric generator load
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
 
-						// Set the electric generator load
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								}
+							}
 
-						// now handle EMS override
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+						} else {
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
+
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								}
 							}
 						}
-					} else {
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
 
-						// now handle EMS override
+						// Get generator's actual electrical and thermal power outputs
+						GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+
 						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+						} else {
 							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
 							}
 						}
-					}
-
-					// Get generator's actual electrical and thermal power outputs
-					GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+						RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
+						WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 
-					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-						ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-					} else {
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
-						}
 					}
-					RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
-					WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 
-				}
+				} else if ( SELECT_CASE_var == iOpSchemeTrackSchedule ) { // 'TRACK SCHEDULE'
+					// The Track Schedule scheme tries to have the generators meet the electrical demand determined from a schedule.
+					//  Code is very similar to 'Track Electrical' except for initial RemainingLoad is replaced by SchedElecDemand
+					//  and PV production is ignored.
+					RemainingLoad = GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).TrackSchedPtr );
+					LoadCenterElectricLoad = RemainingLoad;
 
-			} else if ( SELECT_CASE_var == iOpSchemeTrackMeter ) { // 'TRACK METER'
-				// The TRACK CUSTOM METER scheme tries to have the generators meet all of the
-				//   electrical demand from a meter, it can also be a user-defined Custom Meter
-				//   and PV is ignored.
-				CustomMeterDemand = GetInstantMeterValue( ElecLoadCenter( LoadCenterNum ).DemandMeterPtr, 1 ) / TimeStepZoneSec + GetInstantMeterValue( ElecLoadCenter( LoadCenterNum ).DemandMeterPtr, 2 ) / ( TimeStepSys * SecInHour );
+					for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
 
-				RemainingLoad = CustomMeterDemand;
-				LoadCenterElectricLoad = RemainingLoad;
+						if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
+							// Set the Operation Flag
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
 
-				for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
+							// Set the electric generator load
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
 
-					if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
-						// Set the Operation Flag
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-						// Set the electric generator load
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								}
+							}
+						} else {
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
 
-						// now handle EMS override
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								}
 							}
 						}
 
-					} else {
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
+						// Get generator's actual electrical and thermal power outputs
+						GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
 
-						// now handle EMS override
 						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+						} else {
 							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
 							}
 						}
-					}
+						RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
+						WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
 
-					// Get generator's actual electrical and thermal power outputs
-					GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
-
-					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-						ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-					} else {
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
-						}
 					}
-					RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
-					WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
-
-				}
 
-			} else if ( SELECT_CASE_var == iOpSchemeThermalFollow ) {
-				// Turn thermal load into an electrical load for cogenerators controlled to follow heat loads
-				RemainingThermalLoad = 0.0;
+				} else if ( SELECT_CASE_var == iOpSchemeTrackMeter ) { // 'TRACK METER'
+					// The TRACK CUSTOM METER scheme tries to have the generators meet all of the
+					//   electrical demand from a meter, it can also be a user-defined Custom Meter
+					//   and PV is ignored.
+					CustomMeterDemand = GetInstantMeterValue( ElecLoadCenter( LoadCenterNum ).DemandMeterPtr, 1 ) / TimeStepZoneSec + GetInstantMeterValue( ElecLoadCenter( LoadCenterNum ).DemandMeterPtr, 2 ) / ( TimeStepSys * SecInHour );
 
-				CalcLoadCenterThermalLoad( FirstHVACIteration, LoadCenterNum, RemainingThermalLoad );
-				LoadCenterThermalLoad = RemainingThermalLoad;
+					RemainingLoad = CustomMeterDemand;
+					LoadCenterElectricLoad = RemainingLoad;
 
-				for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
-
-					if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingThermalLoad > 0.0 ) {
-
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
-
-							RemainingLoad = RemainingThermalLoad / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
+					for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
 
+						if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingLoad > 0.0 ) {
+							// Set the Operation Flag
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+							// Set the electric generator load
 							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
 
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
 							// now handle EMS override
 							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
 								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
@@ -663,75 +619,150 @@ namespace ManageElectricPower {
 								}
 							}
 
+						} else {
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
+
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								}
+							}
 						}
-					} else {
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
 
-						// now handle EMS override
+						// Get generator's actual electrical and thermal power outputs
+						GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+
 						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+						} else {
 							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
 							}
 						}
+						RemainingLoad -= ElectricProdRate; // Update remaining load to be met by this load center
+						WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
+
 					}
 
-					// Get generator's actual electrical and thermal power outputs
-					GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+				} else if ( SELECT_CASE_var == iOpSchemeThermalFollow ) {
+					// Turn thermal load into an electrical load for cogenerators controlled to follow heat loads
+					RemainingThermalLoad = 0.0;
 
-					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+					CalcLoadCenterThermalLoad( FirstHVACIteration, LoadCenterNum, RemainingThermalLoad );
+					LoadCenterThermalLoad = RemainingThermalLoad;
 
-						ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) ) * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
-						ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) );
-					} else {
+					for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
 
-						if ( ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest < LoadCenterThermalLoad && ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+						if ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 && RemainingThermalLoad > 0.0 ) {
 
-							ExcessThermalPowerRequest = ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest + ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio - LoadCenterThermalLoad;
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
 
-							if ( ExcessThermalPowerRequest < 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
-								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest = LoadCenterThermalLoad;
-								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
-									ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut - ( ExcessThermalPowerRequest / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio );
+								RemainingLoad = RemainingThermalLoad / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
+
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
+
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								// now handle EMS override
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+									if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+										ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+									} else {
+										ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+									}
+								}
+
+							}
+						} else {
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
+
+							// now handle EMS override
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
 								}
 							}
+						}
+
+						// Get generator's actual electrical and thermal power outputs
+						GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+
+						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+
+							ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) ) * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
+							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) );
+						} else {
+
+							if ( ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest < LoadCenterThermalLoad && ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+
+								ExcessThermalPowerRequest = ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest + ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio - LoadCenterThermalLoad;
+
+								if ( ExcessThermalPowerRequest < 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
+									ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest = LoadCenterThermalLoad;
+									if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
+										ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut - ( ExcessThermalPowerRequest / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio );
+									}
+								}
+
+							}
 
 						}
 
+						RemainingThermalLoad -= ThermalProdRate; // Update remaining load to be met
+						// by this load center
+						WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
+
 					}
 
-					RemainingThermalLoad -= ThermalProdRate; // Update remaining load to be met
-					// by this load center
-					WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining load
+				} else if ( SELECT_CASE_var == iOpSchemeThermalFollowLimitElectrical ) {
+					//  Turn a thermal load into an electrical load for cogenerators controlled to follow heat loads.
+					//  Add intitialization of RemainingThermalLoad as in the ThermalFollow operating scheme above.
+					CalcLoadCenterThermalLoad( FirstHVACIteration, LoadCenterNum, RemainingThermalLoad );
+					// Total current electrical demand for the building is a secondary limit.
+					RemainingLoad = WholeBldgRemainingLoad;
+					LoadCenterElectricLoad = WholeBldgRemainingLoad;
+					LoadCenterThermalLoad = RemainingThermalLoad;
 
-				}
+					for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
 
-			} else if ( SELECT_CASE_var == iOpSchemeThermalFollowLimitElectrical ) {
-				//  Turn a thermal load into an electrical load for cogenerators controlled to follow heat loads.
-				//  Add intitialization of RemainingThermalLoad as in the ThermalFollow operating scheme above.
-				CalcLoadCenterThermalLoad( FirstHVACIteration, LoadCenterNum, RemainingThermalLoad );
-				// Total current electrical demand for the building is a secondary limit.
-				RemainingLoad = WholeBldgRemainingLoad;
-				LoadCenterElectricLoad = WholeBldgRemainingLoad;
-				LoadCenterThermalLoad = RemainingThermalLoad;
+						if ( ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 ) && ( RemainingThermalLoad > 0.0 ) && ( RemainingLoad > 0.0 ) ) {
 
-				for ( GenNum = 1; GenNum <= ElecLoadCenter( LoadCenterNum ).NumGenerators; ++GenNum ) {
+							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
 
-					if ( ( GetCurrentScheduleValue( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).AvailSchedPtr ) > 0.0 ) && ( RemainingThermalLoad > 0.0 ) && ( RemainingLoad > 0.0 ) ) {
+								RemainingLoad = min( WholeBldgRemainingLoad, RemainingThermalLoad / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio );
 
-						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
 
-							RemainingLoad = min( WholeBldgRemainingLoad, RemainingThermalLoad / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio );
+								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+								// now handle EMS override
+								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+									ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
+									if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+										ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+									} else {
+										ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+									}
+								}
 
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = min( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut, RemainingLoad );
+							}
 
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
+						} else {
+
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
+							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
 							// now handle EMS override
 							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
 								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
@@ -744,64 +775,49 @@ namespace ManageElectricPower {
 
 						}
 
-					} else {
+						// Get generator's actual electrical and thermal power outputs
+						GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
 
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-						ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = 0.0;
-						// now handle EMS override
 						if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
-							ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep = max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 );
-							if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = true;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).ONThisTimestep = false;
-							}
-						}
-
-					}
 
-					// Get generator's actual electrical and thermal power outputs
-					GeneratorPowerOutput( LoadCenterNum, GenNum, FirstHVACIteration, ElectricProdRate, ThermalProdRate );
+							ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) ) * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
+							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) );
+						} else {
 
-					if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSRequestOn ) {
+							if ( ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest < LoadCenterThermalLoad && ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
 
-						ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) ) * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
-						ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ( max( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).EMSPowerRequest, 0.0 ) );
-					} else {
+								ExcessThermalPowerRequest = ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest + ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio - LoadCenterThermalLoad;
 
-						if ( ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest < LoadCenterThermalLoad && ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).PowerRequestThisTimestep > 0.0 ) {
+								if ( ExcessThermalPowerRequest < 0.0 ) {
+									ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
+									ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
+								} else {
+									ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest = LoadCenterThermalLoad;
+									if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
+										ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut - ( ExcessThermalPowerRequest / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio );
+									}
+								}
 
-							ExcessThermalPowerRequest = ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest + ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio - LoadCenterThermalLoad;
+								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
 
-							if ( ExcessThermalPowerRequest < 0.0 ) {
-								ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut * ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio;
-								ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut;
-							} else {
-								ElecLoadCenter( LoadCenterNum ).TotalThermalPowerRequest = LoadCenterThermalLoad;
-								if ( ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio > 0.0 ) {
-									ElecLoadCenter( LoadCenterNum ).TotalPowerRequest += ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).MaxPowerOut - ( ExcessThermalPowerRequest / ElecLoadCenter( LoadCenterNum ).ElecGen( GenNum ).NominalThermElectRatio );
-								}
 							}
 
-							ElecLoadCenter( LoadCenterNum ).TotalPowerRequest = min( LoadCenterElectricLoad, ElecLoadCenter( LoadCenterNum ).TotalPowerRequest );
-
 						}
 
-					}
-
-					RemainingThermalLoad -= ThermalProdRate; // Update remaining thermal load to
-					// be met by this load center
+						RemainingThermalLoad -= ThermalProdRate; // Update remaining thermal load to
+						// be met by this load center
 
-					WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining
-					// electric load
-				}
+						WholeBldgRemainingLoad -= ElectricProdRate; // Update whole building remaining
+						// electric load
+					}
 
-			} else if ( SELECT_CASE_var == 0 ) { // This case allows for the reporting to be done without generators specified.
+				} else if ( SELECT_CASE_var == 0 ) { // This case allows for the reporting to be done without generators specified.
 
-			} else {
-				ShowFatalError( "Invalid operation scheme type for Electric Load Center=" + ElecLoadCenter( LoadCenterNum ).Name );
+				} else {
+					ShowFatalError( "Invalid operation scheme type for Electric Load Center=" + ElecLoadCenter( LoadCenterNum ).Name );
 
-			}} // TypeOfEquip
+				}} // TypeOfEquip
+			}
 
 			ElecLoadCenter( LoadCenterNum ).ElectDemand = LoadCenterElectricLoad; //To obtain the load for transformer
 
@@ -2021,6 +2037,96 @@ namespace ManageElectricPower {
 
 	}
 
+	bool
+	LoadCenterDispatchUnchanged(
+		int const LoadCenterNum, // Load Center number counter
+		Real64 const WholeBldgRemainingLoad, // Remaining electric power load for the building (W)
+		Real64 & LoadCenterElectricLoad // Load center electric load to be dispatched (W)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true when the generators of a load center would be dispatched exactly as at its last
+		// dispatch, so that the operation scheme and the generator models need not be run again.
+
+		// METHODOLOGY EMPLOYED:
+		// The dispatch of the electric operation schemes follows from the system timestep, the load to be
+		// dispatched and the availability and EMS requests of each generator. These inputs are kept from
+		// the last dispatch and compared. Only photovoltaic generators with a decoupled cell temperature and
+		// wind turbines take part: their output within a system timestep follows only from these inputs
+		// and the weather, while the other generators and the integrated photovoltaics also depend on plant
+		// or surface conditions that change over the HVAC iterations.
+
+		// Using/Aliasing
+		using ScheduleManager::GetCurrentScheduleValue;
+		using DataGlobals::DayOfSim;
+		using DataGlobals::HourOfDay;
+		using DataGlobals::TimeStep;
+		using DataHVACGlobals::SysTimeElapsed;
+		using DataPhotovoltaics::PVarray;
+		using DataPhotovoltaics::iDecoupledCellIntegration;
+		using DataPhotovoltaics::iDecoupledUllebergDynamicCellIntegration;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int GenNum; // Generator number counter
+		Real64 DispatchLoad; // Load that decides the generator requests (W)
+
+		auto & ThisLoadCenter( ElecLoadCenter( LoadCenterNum ) );
+
+		{ auto const SELECT_CASE_var( ThisLoadCenter.OperationScheme );
+		if ( SELECT_CASE_var == iOpSchemeBaseLoad ) {
+			LoadCenterElectricLoad = WholeBldgRemainingLoad;
+			DispatchLoad = 0.0; // Base load requests do not depend on the load
+		} else if ( SELECT_CASE_var == iOpSchemeDemandLimit ) {
+			LoadCenterElectricLoad = WholeBldgRemainingLoad - ThisLoadCenter.DemandLimit;
+			DispatchLoad = LoadCenterElectricLoad;
+		} else if ( SELECT_CASE_var == iOpSchemeTrackElectrical ) {
+			LoadCenterElectricLoad = WholeBldgRemainingLoad;
+			DispatchLoad = LoadCenterElectricLoad;
+		} else if ( SELECT_CASE_var == iOpSchemeTrackSchedule ) {
+			LoadCenterElectricLoad = GetCurrentScheduleValue( ThisLoadCenter.TrackSchedPtr );
+			DispatchLoad = LoadCenterElectricLoad;
+		} else if ( SELECT_CASE_var == iOpSchemeTrackMeter ) {
+			LoadCenterElectricLoad = GetInstantMeterValue( ThisLoadCenter.DemandMeterPtr, 1 ) / TimeStepZoneSec + GetInstantMeterValue( ThisLoadCenter.DemandMeterPtr, 2 ) / ( TimeStepSys * SecInHour );
+			DispatchLoad = LoadCenterElectricLoad;
+		} else { // The thermal following schemes depend on the plant
+			ThisLoadCenter.DispatchInputs.clear();
+			return false;
+		}}
+
+		if ( ThisLoadCenter.NumGenerators == 0 ) return false;
+		for ( GenNum = 1; GenNum <= ThisLoadCenter.NumGenerators; ++GenNum ) {
+			auto const & ThisGen( ThisLoadCenter.ElecGen( GenNum ) );
+			if ( ThisGen.CompType_Num == iGeneratorWindTurbine ) continue;
+			if ( ( ThisGen.CompType_Num == iGeneratorPV ) && ( ThisGen.GeneratorIndex > 0 ) ) {
+				int const CellIntegrationMode( PVarray( ThisGen.GeneratorIndex ).CellIntegrationMode );
+				if ( ( CellIntegrationMode == iDecoupledCellIntegration ) || ( CellIntegrationMode == iDecoupledUllebergDynamicCellIntegration ) ) continue;
+			}
+			ThisLoadCenter.DispatchInputs.clear();
+			return false;
+		}
+
+		std::vector< Real64 > Inputs;
+		Inputs.reserve( 6 + 3 * ThisLoadCenter.NumGenerators );
+		Inputs.push_back( double( DayOfSim ) );
+		Inputs.push_back( double( HourOfDay ) );
+		Inputs.push_back( double( TimeStep ) );
+		Inputs.push_back( SysTimeElapsed );
+		Inputs.push_back( TimeStepSys );
+		Inputs.push_back( DispatchLoad );
+		for ( GenNum = 1; GenNum <= ThisLoadCenter.NumGenerators; ++GenNum ) {
+			auto const & ThisGen( ThisLoadCenter.ElecGen( GenNum ) );
+			Inputs.push_back( GetCurrentScheduleValue( ThisGen.AvailSchedPtr ) );
+			Inputs.push_back( ThisGen.EMSRequestOn ? 1.0 : 0.0 );
+			Inputs.push_back( ThisGen.EMSPowerRequest );
+		}
+
+		if ( Inputs == ThisLoadCenter.DispatchInputs ) return true;
+		ThisLoadCenter.DispatchInputs.swap( Inputs );
+		return false;
+
+	}
+
 	void
 	CalcLoadCenterThermalLoad(
 		bool const FirstHVACIteration, // unused1208
@@ -3618,7 +3724,9 @@ namespace ManageElectricPower {
 		// Rainflow cycle counting for battery life calculation
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// B1 and X hold the peaks and valleys not yet counted as a stack, the newest at index count.
+		// Each new point counts the cycles it closes and drops their points from the top of the stack,
+		// so only the top few entries are moved and the cost of a point does not grow with the history.
 
 		// REFERENCES:
 		// Ariduru S. 2004. Fatigue life calculation by rainflow cycle counting method.
@@ -3661,8 +3769,7 @@ namespace ManageElectricPower {
 			//  upper-level subroutine. However, it does not hurt to leave it here.
 			if ( X( count ) * X( count - 1 ) >= 0 ) {
 				X( count - 1 ) = B1( count ) - B1( count - 2 );
-				shift( B1, count - 1, count, B1, MaxRainflowArrayBounds + 1 ); // Get rid of (count-1) row in B1
-				shift( X, count, count, X, MaxRainflowArrayBounds + 1 );
+				B1( count - 1 ) = B1( count ); // Get rid of (count-1) row in B1
 				--count; // If the value keep increasing or decreasing, get rid of the middle point.
 			} // Only valley and peak will be stored in the matrix, B1
 
@@ -3671,8 +3778,10 @@ namespace ManageElectricPower {
 				//  algorithm specified in the reference (Ariduru S. 2004)
 				num = nint( ( std::abs( X( 2 ) ) * numbin * 10 + 5 ) / 10 ); // Count half cycle
 				Nmb( num ) += 0.5;
-				B1 = eoshift( B1, 1 ); // Once counting a half cycle, get rid of the value.
-				X = eoshift( X, 1 );
+				B1( 1 ) = B1( 2 ); // Once counting a half cycle, get rid of the value.
+				B1( 2 ) = B1( 3 );
+				X( 1 ) = X( 2 );
+				X( 2 ) = X( 3 );
 				--count; // The number of matrix, B1 and X1 decrease.
 			}
 		} // Counting cyle end
@@ -3686,13 +3795,9 @@ namespace ManageElectricPower {
 				++Nmb( num );
 
 				//     X(count-2) = ABS(X(count))-ABS(X(count-1))+ABS(X(count-2))
-				X( count - 2 ) = B1( count ) - B1( count - 3 ); // Updating X needs to be done before shift operation below
+				X( count - 2 ) = B1( count ) - B1( count - 3 ); // Updating X needs to be done before the points are deleted below
 
-				shift( B1, count - 1, count, B1, MaxRainflowArrayBounds + 1 ); // Get rid of two data points one by one
-				shift( B1, count - 2, count, B1, MaxRainflowArrayBounds + 1 ); // Delete one point
-
-				shift( X, count, count, X, MaxRainflowArrayBounds ); // Get rid of two data points one by one
-				shift( X, count - 1, count, X, MaxRainflowArrayBounds ); // Delete one point
+				B1( count - 2 ) = B1( count ); // Get rid of the two points of the cycle, X( count - 2 ) is already updated
 
 				count -= 2; // If one cycle is counted, two data points are deleted.
 				if ( count < 4 ) break; // When only three data points exists, one cycle cannot be counted.
@@ -3713,62 +3818,6 @@ namespace ManageElectricPower {
 		//   ENDDO
 	}
 
-	void
-	shift(
-		Array1A< Real64 > A,
-		int const m,
-		int const n,
-		Array1A< Real64 > B,
-		int const dim // end dimension of arrays
-	)
-	{
-
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Y. KyungTae & W. Wang
-		//       DATE WRITTEN   July-August, 2011
-		//       MODIFIED       na
-		//       RE-ENGINEERED  na
-
-		// PURPOSE OF THIS SUBROUTINE:
-		// Utility subroutine for rainflow cycle counting
-
-		// METHODOLOGY EMPLOYED:
-		// na
-
-		// REFERENCES:
-		// na
-
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-		A.dim( {1,dim} );
-		B.dim( {1,dim} );
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
-
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
-
-		// DERIVED TYPE DEFINITIONS:
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int ShiftNum; // Loop variable
-
-		for ( ShiftNum = 1; ShiftNum <= m - 1; ++ShiftNum ) {
-			B( ShiftNum ) = A( ShiftNum );
-		}
-
-		for ( ShiftNum = m; ShiftNum <= n; ++ShiftNum ) {
-			B( ShiftNum ) = A( ShiftNum + 1 );
-		}
-	}
-
 	//******************************************************************************************************
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -1,6 +1,9 @@
 #ifndef ManageElectricPower_hh_INCLUDED
 #define ManageElectricPower_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 
@@ -207,6 +210,7 @@ namespace ManageElectricPower {
 		Real64 TotalPowerRequest; // Total electric power request from the load center (W)
 		Real64 TotalThermalPowerRequest; // Total thermal power request from the load center (W)
 		Real64 ElectDemand; // Current electric power demand on the load center (W)
+		std::vector< Real64 > DispatchInputs; // Inputs of the last generator dispatch, empty when it must be run again
 
 		// Default Constructor
 		ElectricPowerLoadCenter() :
@@ -996,6 +1000,13 @@ namespace ManageElectricPower {
 		Real64 & ThermalPowerOutput // Actual generator thermal power output
 	);
 
+	bool
+	LoadCenterDispatchUnchanged(
+		int const LoadCenterNum, // Load Center number counter
+		Real64 const WholeBldgRemainingLoad, // Remaining electric power load for the building (W)
+		Real64 & LoadCenterElectricLoad // Load center electric load to be dispatched (W)
+	);
+
 	void
 	CalcLoadCenterThermalLoad(
 		bool const FirstHVACIteration, // unused1208
@@ -1065,15 +1076,6 @@ namespace ManageElectricPower {
 		int const dim // end dimension of array
 	);
 
-	void
-	shift(
-		Array1A< Real64 > A,
-		int const m,
-		int const n,
-		Array1A< Real64 > B,
-		int const dim // end dimension of arrays
-	);
-
 	//******************************************************************************************************
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
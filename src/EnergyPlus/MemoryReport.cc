@@ -0,0 +1,290 @@
+// C++ Headers
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// EnergyPlus Headers
+#include <MemoryReport.hh>
+#include <DataDaylighting.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataViewFactorInformation.hh>
+#include <DaylightingManager.hh>
+#include <General.hh>
+#include <OutputProcessor.hh>
+#include <OutputReportTabular.hh>
+#include <ScheduleManager.hh>
+#include <SolarShading.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace MemoryReport {
+
+	// PURPOSE OF THIS MODULE:
+	// Accounting of the memory held by the main arrays of the simulation, by module, so that the
+	// growth of the memory of a large model can be traced to the arrays it comes from.
+
+	// METHODOLOGY EMPLOYED:
+	// With the --memory-report option, the bytes of the arrays of each group are summed once after
+	// the initialization of the simulation and again at the end of each environment, keeping the
+	// most found.  An array counts its allocated elements; arrays of structures count the
+	// structures themselves, and the arrays held within them only where they are large (surface
+	// vertices, view factors, daylighting factors, schedule values).  The peak resident memory of
+	// the process is read from the operating system at the same snapshots, for comparison with
+	// the sum of the groups.
+
+	// REFERENCES: na
+
+	// OTHER NOTES: na
+
+	// Using/Aliasing
+	using DataSystemVariables::MemoryUsageReport;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const SurfaceHeatBalanceArrays( 1 );
+	int const SolarAndShadingArrays( 2 );
+	int const SurfaceAndConstructionArrays( 3 );
+	int const InteriorRadiantExchangeArrays( 4 );
+	int const DaylightingArrays( 5 );
+	int const ScheduleArrays( 6 );
+	int const LoadComponentArrays( 7 );
+	int const OutputVariableArrays( 8 );
+	int const NumMemoryGroups( 8 );
+
+	// Object Data
+	std::vector< MemoryGroupData > MemoryGroups; // Indexed by group number - 1
+	Int64 InitProcessBytes( 0 ); // Peak resident memory of the process after the initialization
+	Int64 PeakProcessBytes( 0 ); // Peak resident memory of the process at the last snapshot
+
+	// Functions
+
+	namespace {
+
+		template< typename A >
+		inline
+		Int64
+		ArrayBytes( A const & a )
+		{
+			return Int64( a.size() * sizeof( typename A::value_type ) );
+		}
+
+		template< typename A, typename... Rest >
+		inline
+		Int64
+		ArrayBytes( A const & a, Rest const &... rest )
+		{
+			return ArrayBytes( a ) + ArrayBytes( rest... );
+		}
+
+		std::string const MemoryGroupNames[] = {
+			"Surface Heat Balance (DataHeatBalSurface)",
+			"Solar and Shading (SunlitFrac, CosIncAng, OverlapAreas, ...)",
+			"Surfaces and Constructions (Surface, SurfaceWindow, Construct, Material)",
+			"Interior Radiant Exchange (ZoneInfo view factors and ScriptF)",
+			"Daylighting (ZoneDaylight and IllumMapCalc factors)",
+			"Schedules (Schedule, WeekSchedule, DaySchedule values)",
+			"Load Components (OutputReportTabular sequences)",
+			"Output Variables (OutputProcessor variables and meters)"
+		};
+
+	}
+
+	void
+	TakeMemorySnapshot( bool const AfterInitialization )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sums the bytes of each group of arrays and keeps them as the bytes after the initialization
+		// or, later, as the peak bytes when they are more than found so far.
+
+		if ( ! MemoryUsageReport ) return;
+
+		if ( AfterInitialization || MemoryGroups.empty() ) {
+			MemoryGroups.assign( NumMemoryGroups, MemoryGroupData() );
+			for ( int GroupNum = 1; GroupNum <= NumMemoryGroups; ++GroupNum ) {
+				MemoryGroups[ GroupNum - 1 ].Name = MemoryGroupNames[ GroupNum - 1 ];
+			}
+		}
+
+		for ( int GroupNum = 1; GroupNum <= NumMemoryGroups; ++GroupNum ) {
+			auto & group( MemoryGroups[ GroupNum - 1 ] );
+			Int64 const Bytes( MemoryGroupBytes( GroupNum ) );
+			if ( AfterInitialization ) group.InitBytes = Bytes;
+			if ( Bytes > group.PeakBytes ) group.PeakBytes = Bytes;
+		}
+
+		PeakProcessBytes = ProcessPeakBytes();
+		if ( AfterInitialization ) InitProcessBytes = PeakProcessBytes;
+
+	}
+
+	Int64
+	MemoryGroupBytes( int const GroupNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the bytes now held by the arrays of the group.
+
+		Int64 Bytes( 0 );
+
+		if ( GroupNum == SurfaceHeatBalanceArrays ) {
+			using namespace DataHeatBalSurface;
+			Bytes += ArrayBytes( SUMH, CTFConstInPart, CTFConstOutPart, TempSurfIn, TempSurfInTmp, HcExtSurf, HAirExtSurf, HSkyExtSurf, HGrdExtSurf, TempSource, TempSurfInRep );
+			Bytes += ArrayBytes( QConvInReport, QdotConvInRep, QdotConvInRepPerArea, QRadNetSurfInReport, QdotRadNetSurfInRep, QdotRadNetSurfInRepPerArea, QRadSolarInReport, QdotRadSolarInRep, QdotRadSolarInRepPerArea );
+			Bytes += ArrayBytes( QRadLightsInReport, QdotRadLightsInRep, QdotRadLightsInRepPerArea, QRadIntGainsInReport, QdotRadIntGainsInRep, QdotRadIntGainsInRepPerArea, QRadHVACInReport, QdotRadHVACInRep, QdotRadHVACInRepPerArea );
+			Bytes += ArrayBytes( QConvOutReport, QdotConvOutRep, QdotConvOutRepPerArea, QRadOutReport, QdotRadOutRep, QdotRadOutRepPerArea );
+			Bytes += ArrayBytes( OpaqSurfInsFaceCondGainRep, OpaqSurfInsFaceCondLossRep, OpaqSurfInsFaceConduction, OpaqSurfInsFaceConductionFlux, OpaqSurfInsFaceConductionEnergy );
+			Bytes += ArrayBytes( OpaqSurfExtFaceCondGainRep, OpaqSurfExtFaceCondLossRep, OpaqSurfOutsideFaceConduction, OpaqSurfOutsideFaceConductionFlux, OpaqSurfOutsideFaceConductionEnergy );
+			Bytes += ArrayBytes( OpaqSurfAvgFaceCondGainRep, OpaqSurfAvgFaceCondLossRep, OpaqSurfAvgFaceConduction, OpaqSurfAvgFaceConductionFlux, OpaqSurfAvgFaceConductionEnergy );
+			Bytes += ArrayBytes( OpaqSurfStorageGainRep, OpaqSurfStorageCondLossRep, OpaqSurfStorageConduction, OpaqSurfStorageConductionFlux, OpaqSurfStorageConductionEnergy, OpaqSurfInsFaceBeamSolAbsorbed );
+			Bytes += ArrayBytes( TempSurfOut, QRadSWOutMvIns, QC, QD, QDforDaylight, QDV, TCONV, VMULT, VCONV, NetLWRadToSurf, ZoneMRT, QRadSWLightsInAbs, QRadSWOutAbs, QRadSWInAbs, InitialDifSolInAbs, InitialDifSolInTrans );
+			Bytes += ArrayBytes( TH, QH, THM, QHM, TsrcHist, QsrcHist, TsrcHistM, QsrcHistM, FractDifShortZtoZ, RecDifShortFromZ );
+
+		} else if ( GroupNum == SolarAndShadingArrays ) {
+			using namespace DataHeatBalance;
+			using namespace DataSurfaces;
+			Bytes += ArrayBytes( SunlitFrac, SunlitFracHR, SunlitFracWithoutReveal, CosIncAng, CosIncAngHR, BackSurfaces, OverlapAreas, DifShdgRatioIsoSkyHRTS, DifShdgRatioHorizHRTS );
+			Bytes += ArrayBytes( SUNCOSHR, ReflFacBmToDiffSolObs, ReflFacBmToDiffSolGnd, ReflFacBmToBmSolObs, ReflFacSkySolObs, ReflFacSkySolGnd, CosIncAveBmToBmSolObs, AWinSurf, AWinCFOverlap );
+			Bytes += ArrayBytes( SolarShading::WindowRevealStatus, SolarShading::ShadowCasterBVH, SolarShading::ShadowCasterBVHSurfs );
+
+		} else if ( GroupNum == SurfaceAndConstructionArrays ) {
+			using namespace DataSurfaces;
+			Bytes += ArrayBytes( Surface, SurfaceWindow, DataHeatBalance::Construct, DataHeatBalance::Material );
+			for ( int SurfNum = 1; SurfNum <= int( Surface.size() ); ++SurfNum ) Bytes += ArrayBytes( Surface( SurfNum ).Vertex );
+
+		} else if ( GroupNum == InteriorRadiantExchangeArrays ) {
+			using DataViewFactorInformation::ZoneInfo;
+			Bytes += ArrayBytes( ZoneInfo );
+			for ( int ZoneNum = 1; ZoneNum <= int( ZoneInfo.size() ); ++ZoneNum ) {
+				auto const & zone( ZoneInfo( ZoneNum ) );
+				Bytes += ArrayBytes( zone.F, zone.ScriptF, zone.Area, zone.Emissivity, zone.Azimuth, zone.Tilt, zone.SurfacePtr, zone.Class, zone.Cinverse, zone.CinverseEmissivity );
+			}
+
+		} else if ( GroupNum == DaylightingArrays ) {
+			using DataDaylighting::ZoneDaylight;
+			using DataDaylighting::IllumMapCalc;
+			Bytes += ArrayBytes( ZoneDaylight, IllumMapCalc );
+			for ( int ZoneNum = 1; ZoneNum <= int( ZoneDaylight.size() ); ++ZoneNum ) {
+				auto const & zone( ZoneDaylight( ZoneNum ) );
+				Bytes += ArrayBytes( zone.SolidAngAtRefPt, zone.SolidAngAtRefPtWtd, zone.IllumFromWinAtRefPt, zone.BackLumFromWinAtRefPt, zone.SourceLumFromWinAtRefPt );
+				Bytes += ArrayBytes( zone.DaylIllFacSky, zone.DaylSourceFacSky, zone.DaylBackFacSky );
+				Bytes += ArrayBytes( zone.DaylIllFacSun, zone.DaylIllFacSunDisk, zone.DaylSourceFacSun, zone.DaylSourceFacSunDisk, zone.DaylBackFacSun, zone.DaylBackFacSunDisk );
+			}
+			for ( int MapNum = 1; MapNum <= int( IllumMapCalc.size() ); ++MapNum ) {
+				auto const & map( IllumMapCalc( MapNum ) );
+				Bytes += ArrayBytes( map.MapRefPtAbsCoord, map.SolidAngAtMapPt, map.SolidAngAtMapPtWtd, map.IllumFromWinAtMapPt, map.BackLumFromWinAtMapPt, map.SourceLumFromWinAtMapPt );
+				Bytes += ArrayBytes( map.DaylIllFacSky, map.DaylSourceFacSky, map.DaylBackFacSky );
+				Bytes += ArrayBytes( map.DaylIllFacSun, map.DaylIllFacSunDisk, map.DaylSourceFacSun, map.DaylSourceFacSunDisk, map.DaylBackFacSun, map.DaylBackFacSunDisk );
+			}
+			Bytes += ArrayBytes( DaylightingManager::TDDTransVisBeam, DaylightingManager::TDDFluxInc, DaylightingManager::TDDFluxTrans );
+
+		} else if ( GroupNum == ScheduleArrays ) {
+			using namespace ScheduleManager;
+			Bytes += ArrayBytes( Schedule, WeekSchedule, DaySchedule );
+			for ( int DayNum = 1; DayNum <= int( DaySchedule.size() ); ++DayNum ) Bytes += ArrayBytes( DaySchedule( DayNum ).TSValue );
+
+		} else if ( GroupNum == LoadComponentArrays ) {
+			using namespace OutputReportTabular;
+			Bytes += ArrayBytes( radiantPulseUsed, radiantPulseTimestep, radiantPulseReceived, loadConvectedNormal, loadConvectedWithPulse, netSurfRadSeq, decayCurveCool, decayCurveHeat, ITABSFseq, TMULTseq );
+			Bytes += ArrayBytes( peopleInstantSeq, peopleLatentSeq, peopleRadSeq, peopleDelaySeq, lightInstantSeq, lightRetAirSeq, lightLWRadSeq, lightSWRadSeq, lightDelaySeq );
+			Bytes += ArrayBytes( equipInstantSeq, equipLatentSeq, equipRadSeq, equipDelaySeq, refrigInstantSeq, refrigRetAirSeq, refrigLatentSeq, waterUseInstantSeq, waterUseLatentSeq );
+			Bytes += ArrayBytes( hvacLossInstantSeq, hvacLossRadSeq, hvacLossDelaySeq, powerGenInstantSeq, powerGenRadSeq, powerGenDelaySeq, infilInstantSeq, infilLatentSeq );
+			Bytes += ArrayBytes( zoneVentInstantSeq, zoneVentLatentSeq, interZoneMixInstantSeq, interZoneMixLatentSeq, feneCondInstantSeq, feneSolarRadSeq, feneSolarDelaySeq, surfDelaySeqCool, surfDelaySeqHeat );
+
+		} else if ( GroupNum == OutputVariableArrays ) {
+			using namespace OutputProcessor;
+			Bytes += ArrayBytes( RVariableTypes, IVariableTypes, DDVariableTypes, ReqRepVars, VarMeterArrays, EnergyMeters );
+			Bytes += NumOfRVariable * Int64( sizeof( RealVariables ) ) + NumOfIVariable * Int64( sizeof( IntegerVariables ) );
+
+		}
+
+		return Bytes;
+
+	}
+
+	Int64
+	ProcessPeakBytes()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the peak resident memory of the process so far, or zero where it cannot be read.
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS Counters;
+		if ( ! GetProcessMemoryInfo( GetCurrentProcess(), &Counters, sizeof( Counters ) ) ) return 0;
+		return Int64( Counters.PeakWorkingSetSize );
+#else
+		struct rusage Usage;
+		if ( getrusage( RUSAGE_SELF, &Usage ) != 0 ) return 0;
+#ifdef __APPLE__
+		return Int64( Usage.ru_maxrss ); // Bytes
+#else
+		return Int64( Usage.ru_maxrss ) * 1024; // Kilobytes
+#endif
+#endif
+
+	}
+
+	void
+	ShowMemorySummary()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the memory of each group after the initialization and at peak to the error file.
+
+		if ( ! MemoryUsageReport || MemoryGroups.empty() ) return;
+
+		ShowMessage( "Memory of the main arrays by module [MB], after initialization / at peak:" );
+		for ( auto const & group : MemoryGroups ) {
+			ShowContinueError( group.Name + ": " + MegaBytes( group.InitBytes ) + " / " + MegaBytes( group.PeakBytes ) );
+		}
+		ShowContinueError( "Process Peak Resident Memory: " + MegaBytes( InitProcessBytes ) + " / " + MegaBytes( PeakProcessBytes ) );
+
+	}
+
+	std::string
+	MegaBytes( Int64 const Bytes )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the bytes in megabytes (2^20 bytes) to two decimals.
+
+		using General::RoundSigDigits;
+
+		return RoundSigDigits( Real64( Bytes ) / 1048576.0, 2 );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // MemoryReport
+
+} // EnergyPlus
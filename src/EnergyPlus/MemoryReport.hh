@@ -0,0 +1,93 @@
+#ifndef MemoryReport_hh_INCLUDED
+#define MemoryReport_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace MemoryReport {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const SurfaceHeatBalanceArrays;
+	extern int const SolarAndShadingArrays;
+	extern int const SurfaceAndConstructionArrays;
+	extern int const InteriorRadiantExchangeArrays;
+	extern int const DaylightingArrays;
+	extern int const ScheduleArrays;
+	extern int const LoadComponentArrays;
+	extern int const OutputVariableArrays;
+	extern int const NumMemoryGroups;
+
+	// Types
+
+	struct MemoryGroupData
+	{
+		// Members
+		std::string Name; // Modules and arrays of the group, as reported
+		Int64 InitBytes; // Bytes held after the initialization of the simulation
+		Int64 PeakBytes; // Most bytes held at any snapshot
+
+		// Default Constructor
+		MemoryGroupData() :
+			InitBytes( 0 ),
+			PeakBytes( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< MemoryGroupData > MemoryGroups; // Indexed by group number - 1
+	extern Int64 InitProcessBytes; // Peak resident memory of the process after the initialization
+	extern Int64 PeakProcessBytes; // Peak resident memory of the process at the last snapshot
+
+	// Functions
+
+	void
+	TakeMemorySnapshot( bool const AfterInitialization ); // True for the snapshot after the initialization
+
+	Int64
+	MemoryGroupBytes( int const GroupNum );
+
+	Int64
+	ProcessPeakBytes();
+
+	void
+	ShowMemorySummary();
+
+	std::string
+	MegaBytes( Int64 const Bytes );
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // MemoryReport
+
+} // EnergyPlus
+
+#endif
@@ -2918,6 +2918,17 @@ namespace MixedAir {
 					vent_mech.NumofVentMechZones = TempMechVentArrayCounter;
 				}
 
+				// Sum the OA flow rate of the design occupants of each zone once, as the zone is
+				// otherwise matched against every people object at each call without DCV
+				vent_mech.ZoneOADesignPeople.dimension( vent_mech.NumofVentMechZones, 0.0 );
+				for ( NumMechVentZone = 1; NumMechVentZone <= vent_mech.NumofVentMechZones; ++NumMechVentZone ) {
+					ZoneNum = vent_mech.Zone( NumMechVentZone );
+					for ( PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum ) {
+						if ( People( PeopleNum ).ZonePtr != ZoneNum ) continue;
+						vent_mech.ZoneOADesignPeople( NumMechVentZone ) += People( PeopleNum ).NumberOfPeople * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * vent_mech.ZoneOAPeopleRate( NumMechVentZone );
+					}
+				}
+
 				// predefined report
 				for ( jZone = 1; jZone <= vent_mech.NumofVentMechZones; ++jZone ) {
 					zoneName = Zone( vent_mech.Zone( jZone ) ).Name;
@@ -3586,11 +3597,7 @@ namespace MixedAir {
 						if ( VentilationMechanical( VentMechObjectNum ).DCVFlag ) {
 							ZoneOAPeople = ZoneIntGain( ZoneNum ).NOFOCC * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
 						} else {
-							ZoneOAPeople = 0.0;
-							for ( PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum ) {
-								if ( People( PeopleNum ).ZonePtr != ZoneNum ) continue;
-								ZoneOAPeople += People( PeopleNum ).NumberOfPeople * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
-							}
+							ZoneOAPeople = VentilationMechanical( VentMechObjectNum ).ZoneOADesignPeople( ZoneIndex );
 						}
 
 						// Calc the zone OA flow rate based on the floor area component
@@ -3665,11 +3672,7 @@ namespace MixedAir {
 							if ( VentilationMechanical( VentMechObjectNum ).DCVFlag ) {
 								ZoneOAPeople = ZoneIntGain( ZoneNum ).NOFOCC * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
 							} else {
-								ZoneOAPeople = 0.0;
-								for ( PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum ) {
-									if ( People( PeopleNum ).ZonePtr != ZoneNum ) continue;
-									ZoneOAPeople += People( PeopleNum ).NumberOfPeople * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
-								}
+								ZoneOAPeople = VentilationMechanical( VentMechObjectNum ).ZoneOADesignPeople( ZoneIndex );
 							}
 
 							// Calc the zone OA flow rate based on the floor area component
@@ -462,6 +462,7 @@ namespace MixedAir {
 		Array1D_string ZoneDesignSpecADObjName; // name of the design specification zone air
 		// distribution object for each zone in the zone list
 		Array1D< Real64 > ZoneSecondaryRecirculation; // zone air secondary recirculation ratio
+		Array1D< Real64 > ZoneOADesignPeople; // OA flow rate (m3/s) for the design occupants of each zone, used without DCV
 
 		// Default Constructor
 		VentilationMechanicalProps() :
@@ -432,6 +432,11 @@ namespace MoistureBalanceEMPDManager {
 		Real64 const Taver_237( Taver + 237.7 );
 		Real64 const RHaver_fac( 461.52 * ( Taver + KelvinConv ) * std::exp( -23.7093 + 4111.0 / Taver_237 ) );
 		Real64 const BR_fac( ( 4111.0 / pow_2( Taver_237 ) ) - ( 1.0 / ( Taver + KelvinConv ) ) );
+		// Zone air properties do not change within the iteration
+		Real64 const RhoAirZone( PsyRhoAirFnPbTdbW( OutBaroPress, TempZone, ZoneAirHumRat( ZoneNum ), RoutineName ) );
+		RHOBULK = material.Density;
+		HM = HConvIn( SurfNum ) / ( RhoAirZone * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), TempZone ) );
+		RALPHA = ZoneAirHumRat( ZoneNum ) * OutBaroPress / ( 461.52 * ( TempZone + KelvinConv ) * ( ZoneAirHumRat( ZoneNum ) + 0.62198 ) );
 
 		while ( Flag > 0 ) {
 			RVaver = ( MoistEMPDNew( SurfNum ) + MoistEMPDOld( SurfNum ) ) / 2.0;
@@ -444,10 +449,6 @@ namespace MoistureBalanceEMPDManager {
 
 			AT = ( material.MoistACoeff * material.MoistBCoeff * std::pow( RHaver, material.MoistBCoeff ) + material.MoistCCoeff * material.MoistDCoeff * std::pow( RHaver, material.MoistDCoeff ) ) / RVaver;
 			BR = BR_fac * AT * RVaver;
-			RHOBULK = material.Density;
-			HM = HConvIn( SurfNum ) / ( PsyRhoAirFnPbTdbW( OutBaroPress, TempZone, ZoneAirHumRat( ZoneNum ), RoutineName ) * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), TempZone ) );
-			ZoneNum = Surface( SurfNum ).Zone;
-			RALPHA = ZoneAirHumRat( ZoneNum ) * OutBaroPress / ( 461.52 * ( TempZone + KelvinConv ) * ( ZoneAirHumRat( ZoneNum ) + 0.62198 ) );
 			BB = HM / ( RHOBULK * material.EMPDVALUE * AT );
 			CC = BB * RALPHA + BR / AT * ( TempSurfIn - TempSurfInOld ) / TimeStepZoneSec;
 			SolverMoistureBalanceEMPD( MoistEMPDNew( SurfNum ), MoistEMPDOld( SurfNum ), 1.0, BB, CC );
@@ -470,7 +471,7 @@ namespace MoistureBalanceEMPDManager {
 		// Calculate latent load
 		PVsurf = RHaver * std::exp( 23.7093 - 4111.0 / Taver_237 );
 		Wsurf = 0.62198 * RHaver / ( std::exp( -23.7093 + 4111.0 / Taver_237 ) * OutBaroPress - RHaver );
-		MoistEMPDFlux( SurfNum ) = HM * ( MoistEMPDNew( SurfNum ) - PsyRhoAirFnPbTdbW( OutBaroPress, TempZone, ZoneAirHumRat( ZoneNum ), RoutineName ) * ZoneAirHumRat( ZoneNum ) ) * Lam;
+		MoistEMPDFlux( SurfNum ) = HM * ( MoistEMPDNew( SurfNum ) - RhoAirZone * ZoneAirHumRat( ZoneNum ) ) * Lam;
 		// Calculate surface dew point temperature based on surface vapor density
 		TempSat = 4111.0 / ( 23.7093 - std::log( PVsurf ) ) + 35.45 - KelvinConv;
 
@@ -77,6 +77,7 @@ namespace NodeInputManager {
 	Array1D_int NodeRef; // Number of times a Node is "referenced"
 	std::string CurCheckContextName; // Used in Uniqueness checks
 	Array1D_string UniqueNodeNames; // used in uniqueness checks
+	std::unordered_set< std::string > UniqueNodeNameSet; // Names held in UniqueNodeNames, for the uniqueness lookups
 	int NumCheckNodes( 0 ); // Num of Unique nodes in check
 	int MaxCheckNodes( 0 ); // Current "max" unique nodes in check
 	bool NodeVarsSetup( false ); // Setup indicator of node vars for reporting (also that all nodes have been entered)
@@ -845,6 +846,7 @@ namespace NodeInputManager {
 		NumCheckNodes = 0;
 		MaxCheckNodes = 100;
 		UniqueNodeNames.allocate( MaxCheckNodes );
+		UniqueNodeNameSet.clear();
 		CurCheckContextName = ContextName;
 
 	}
@@ -878,7 +880,7 @@ namespace NodeInputManager {
 		// ObjectName - "Name" field of object (i.e., CurCheckContextName)
 
 		// METHODOLOGY EMPLOYED:
-		// checks the current list of items for this (again)
+		// checks the current list of items for this (again), looked up in UniqueNodeNameSet
 
 		// REFERENCES:
 		// na
@@ -908,7 +910,7 @@ namespace NodeInputManager {
 				ShowFatalError( "Routine CheckUniqueNodes called with Nodetypes=NodeName, but did not include CheckName argument." );
 			}
 			if ( ! CheckName().empty() ) {
-				Found = FindItemInList( CheckName, UniqueNodeNames, NumCheckNodes );
+				Found = UniqueNodeNameSet.count( CheckName );
 				if ( Found != 0 ) {
 					ShowSevereError( CurCheckContextName + "=\"" + ObjectName + "\", duplicate node names found." );
 					ShowContinueError( "...for Node Type(s)=" + NodeTypes + ", duplicate node name=\"" + CheckName + "\"." );
@@ -922,6 +924,7 @@ namespace NodeInputManager {
 						UniqueNodeNames.redimension( MaxCheckNodes += 100 );
 					}
 					UniqueNodeNames( NumCheckNodes ) = CheckName;
+					UniqueNodeNameSet.insert( CheckName );
 				}
 			}
 
@@ -930,7 +933,7 @@ namespace NodeInputManager {
 				ShowFatalError( "Routine CheckUniqueNodes called with Nodetypes=NodeNumber, but did not include CheckNumber argument." );
 			}
 			if ( CheckNumber != 0 ) {
-				Found = FindItemInList( NodeID( CheckNumber ), UniqueNodeNames, NumCheckNodes );
+				Found = UniqueNodeNameSet.count( NodeID( CheckNumber ) );
 				if ( Found != 0 ) {
 					ShowSevereError( CurCheckContextName + "=\"" + ObjectName + "\", duplicate node names found." );
 					ShowContinueError( "...for Node Type(s)=" + NodeTypes + ", duplicate node name=\"" + NodeID( CheckNumber ) + "\"." );
@@ -944,6 +947,7 @@ namespace NodeInputManager {
 						UniqueNodeNames.redimension( MaxCheckNodes += 100 );
 					}
 					UniqueNodeNames( NumCheckNodes ) = NodeID( CheckNumber );
+					UniqueNodeNameSet.insert( NodeID( CheckNumber ) );
 				}
 			}
 
@@ -1002,6 +1006,7 @@ namespace NodeInputManager {
 		if ( allocated( UniqueNodeNames ) ) {
 			UniqueNodeNames.deallocate();
 		}
+		UniqueNodeNameSet.clear();
 
 	}
 
@@ -1086,6 +1091,12 @@ namespace NodeInputManager {
 		Real64 rho;
 		Real64 Cp;
 		Real64 rhoStd;
+		int NumAirNodes; // number of air nodes
+		int AirNode; // index of the current node in the air node arrays
+		static Array1D< Real64 > AirNodeTemp; // temperatures of the air nodes
+		static Array1D< Real64 > AirNodeHumRat; // humidity ratios of the air nodes
+		static Array1D< Real64 > AirNodeDensity; // densities of the air nodes
+		static Array1D< Real64 > AirNodeEnthalpy; // enthalpies of the air nodes
 
 		if ( MyOneTimeFlag ) {
 			RhoAirStdInit = StdRhoAir;
@@ -1126,6 +1137,30 @@ namespace NodeInputManager {
 			MyOneTimeFlag = false;
 		}
 
+		// density and enthalpy of all the air nodes at once
+		NumAirNodes = 0;
+		for ( iNode = 1; iNode <= NumOfNodes; ++iNode ) {
+			if ( Node( iNode ).FluidType == NodeType_Air ) ++NumAirNodes;
+		}
+		if ( AirNodeTemp.isize() != NumAirNodes ) {
+			AirNodeTemp.dimension( NumAirNodes );
+			AirNodeHumRat.dimension( NumAirNodes );
+			AirNodeDensity.dimension( NumAirNodes );
+			AirNodeEnthalpy.dimension( NumAirNodes );
+		}
+		AirNode = 0;
+		for ( iNode = 1; iNode <= NumOfNodes; ++iNode ) {
+			if ( Node( iNode ).FluidType == NodeType_Air ) {
+				++AirNode;
+				AirNodeTemp( AirNode ) = Node( iNode ).Temp;
+				AirNodeHumRat( AirNode ) = Node( iNode ).HumRat;
+			}
+		}
+		// if Node%Press was reliable could be used here.
+		PsyRhoAirFnPbTdbW( OutBaroPress, AirNodeTemp, AirNodeHumRat, AirNodeDensity );
+		PsyHFnTdbW( AirNodeTemp, AirNodeHumRat, AirNodeEnthalpy );
+
+		AirNode = 0;
 		for ( iNode = 1; iNode <= NumOfNodes; ++iNode ) {
 			ReportWetBulb = false;
 			ReportRelHumidity = false;
@@ -1149,12 +1184,12 @@ namespace NodeInputManager {
 			}
 			// calculate the volume flow rate
 			if ( Node( iNode ).FluidType == NodeType_Air ) {
+				++AirNode;
 				MoreNodeInfo( iNode ).VolFlowRateStdRho = Node( iNode ).MassFlowRate / RhoAirStdInit;
-				// if Node%Press was reliable could be used here.
-				RhoAirCurrent = PsyRhoAirFnPbTdbW( OutBaroPress, Node( iNode ).Temp, Node( iNode ).HumRat );
+				RhoAirCurrent = AirNodeDensity( AirNode );
 				MoreNodeInfo( iNode ).Density = RhoAirCurrent;
 				if ( RhoAirCurrent != 0.0 ) MoreNodeInfo( iNode ).VolFlowRateCrntRho = Node( iNode ).MassFlowRate / RhoAirCurrent;
-				MoreNodeInfo( iNode ).ReportEnthalpy = PsyHFnTdbW( Node( iNode ).Temp, Node( iNode ).HumRat );
+				MoreNodeInfo( iNode ).ReportEnthalpy = AirNodeEnthalpy( AirNode );
 				if ( ReportWetBulb ) {
 					// if Node%Press was reliable could be used here.
 					MoreNodeInfo( iNode ).WetBulbTemp = PsyTwbFnTdbWPb( Node( iNode ).Temp, Node( iNode ).HumRat, OutBaroPress, nodeReportingStrings[iNode - 1] );
@@ -1,6 +1,10 @@
 #ifndef NodeInputManager_hh_INCLUDED
 #define NodeInputManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_set>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -37,6 +41,7 @@ namespace NodeInputManager {
 	extern Array1D_int NodeRef; // Number of times a Node is "referenced"
 	extern std::string CurCheckContextName; // Used in Uniqueness checks
 	extern Array1D_string UniqueNodeNames; // used in uniqueness checks
+	extern std::unordered_set< std::string > UniqueNodeNameSet; // Names held in UniqueNodeNames, for the uniqueness lookups
 	extern int NumCheckNodes; // Num of Unique nodes in check
 	extern int MaxCheckNodes; // Current "max" unique nodes in check
 	extern bool NodeVarsSetup; // Setup indicator of node vars for reporting (also that all nodes have been entered)
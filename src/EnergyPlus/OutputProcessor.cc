@@ -17,6 +17,8 @@
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <OutputProcessor.hh>
+#include <ColumnarOutput.hh>
+#include <CsvOutput.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobalConstants.hh>
 #include <DataHeatBalance.hh>
@@ -29,6 +31,7 @@
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <Profiler.hh>
 #include <ScheduleManager.hh>
 #include <SortAndStringUtilities.hh>
 #include <SQLiteProcedures.hh>
@@ -216,7 +219,14 @@ namespace OutputProcessor {
 	Reference< RealVariables > RVar;
 	Reference< IntegerVariables > IVar;
 	Array1D< ReqReportVariables > ReqRepVars;
+	std::unordered_map< std::string, ReqReportVariableGroup > ReqRepVarGroups; // Requested Report Variables by variable name (uppercase)
+	std::unordered_map< std::string, int > DDVariableTypesByName; // First DDVariableTypes index of each variable name
+	Array1D< VariableReportListType > VariableReportLists( 2 ); // By index type (zone, HVAC), see BuildVariableReportLists
+	int VariableReportListsNumRVariable( -1 ); // NumOfRVariable when VariableReportLists were built
+	int VariableReportListsNumIVariable( -1 ); // NumOfIVariable when VariableReportLists were built
+	std::unordered_map< std::string, std::string > ReportKeyAliases; // Key reported for a requested key that no longer exists, by requested key (uppercase)
 	Array1D< MeterArrayType > VarMeterArrays;
+	MeterAggregationPlanType MeterPlan; // Built from VarMeterArrays for UpdateMeterValuesFromPlan
 	Array1D< MeterType > EnergyMeters;
 	Array1D< EndUseCategoryType > EndUseCategory;
 
@@ -441,13 +451,14 @@ namespace OutputProcessor {
 		// This instance being requested will always have a key associated with it.  Matching
 		// instances (from input) may or may not have keys, but only one instance of a reporting
 		// frequency per variable is allowed.  ReportList will be populated with ReqRepVars indices
-		// of those extra things from input that satisfy this condition.
+		// of those extra things from input that satisfy this condition.  The requests are found
+		// through ReqRepVarGroups by variable name rather than by searching all of ReqRepVars.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using InputProcessor::FindItem;
+		using InputProcessor::MakeUPPERCase;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -463,11 +474,6 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool GetInputFlag( true );
-		int Item;
-		int Loop;
-		int Pos;
-		int MinLook;
-		int MaxLook;
 
 		if ( GetInputFlag ) {
 			GetReportVariableInput();
@@ -475,37 +481,20 @@ namespace OutputProcessor {
 		}
 
 		if ( NumOfReqVariables > 0 ) {
-			// Do a quick check
-			Item = FindItem( VarName, ReqRepVars( {1,NumOfReqVariables} ).VarName(), NumOfReqVariables );
-
 			NumExtraVars = 0;
 			ReportList = 0;
-			MinLook = 999999999;
-			MaxLook = -999999999;
-
-			if ( Item != 0 ) {
-				Loop = Item;
-				Pos = Item;
-				MinLook = min( MinLook, Pos );
-				MaxLook = max( MaxLook, Pos );
-				while ( Loop <= NumOfReqVariables && Pos != 0 ) {
-					//  Mark all with blank keys as used
-					if ( ReqRepVars( Loop ).Key.empty() ) {
+
+			auto const Found( ReqRepVarGroups.find( MakeUPPERCase( VarName ) ) );
+			if ( Found != ReqRepVarGroups.end() ) {
+				//  Mark all with blank keys as used
+				auto const BlankKeys( Found->second.ReqRepVarNumsByKey.find( BlankString ) );
+				if ( BlankKeys != Found->second.ReqRepVarNumsByKey.end() ) {
+					for ( int const Loop : BlankKeys->second ) {
 						ReqRepVars( Loop ).Used = true;
 					}
-					if ( Loop < NumOfReqVariables ) {
-						Pos = FindItem( VarName, ReqRepVars( {Loop + 1,NumOfReqVariables} ).VarName(), NumOfReqVariables - Loop );
-						if ( Pos != 0 ) {
-							MinLook = min( MinLook, Loop + Pos );
-							MaxLook = max( MaxLook, Loop + Pos );
-						}
-					} else {
-						Pos = 1;
-					}
-					Loop += Pos;
 				}
-				BuildKeyVarList( KeyedValue, VarName, MinLook, MaxLook );
-				AddBlankKeys( VarName, MinLook, MaxLook );
+				BuildKeyVarList( KeyedValue, Found->second );
+				AddBlankKeys( Found->second );
 			}
 		}
 
@@ -514,9 +503,7 @@ namespace OutputProcessor {
 	void
 	BuildKeyVarList(
 		std::string const & KeyedValue, // Associated Key for this variable
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
+		ReqReportVariableGroup const & Group // Requested Report Variables of this variable name
 	)
 	{
 
@@ -531,13 +518,15 @@ namespace OutputProcessor {
 		// pointers to that data structure for this KeyedValue and VariableName.
 
 		// METHODOLOGY EMPLOYED:
-		// Go through the ReqRepVars list and add those
-		// that match (and dont duplicate ones already in the list).
+		// Go through the requests of this variable name for this key and add those
+		// that match (and dont duplicate ones already in the list).  Keys that are
+		// aliases of this key are only found by going through every request of the name.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
 		using InputProcessor::SameString;
 
 		// Locals
@@ -553,14 +542,18 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Loop;
 		int Loop1;
 		bool Dup;
-		Array1D_int TmpReportList;
+		std::vector< int > const * ReqRepVarNums( &Group.ReqRepVarNums );
 
-		for ( Loop = MinIndx; Loop <= MaxIndx; ++Loop ) {
-			if ( ! SameString( ReqRepVars( Loop ).VarName, VariableName ) ) continue;
-			if ( ! SameString( ReqRepVars( Loop ).Key, KeyedValue ) ) continue;
+		if ( ReportKeyAliases.empty() ) {
+			auto const Found( Group.ReqRepVarNumsByKey.find( MakeUPPERCase( KeyedValue ) ) );
+			if ( Found == Group.ReqRepVarNumsByKey.end() ) return;
+			ReqRepVarNums = &Found->second;
+		}
+
+		for ( int const Loop : *ReqRepVarNums ) {
+			if ( ! SameString( ReqRepVars( Loop ).Key, KeyedValue ) && ! IsReportKeyAlias( ReqRepVars( Loop ).Key, KeyedValue ) ) continue;
 
 			//   A match.  Make sure doesnt duplicate
 
@@ -588,11 +581,47 @@ namespace OutputProcessor {
 
 	}
 
+	bool
+	IsReportKeyAlias(
+		std::string const & RequestedKey, // Key of a requested report variable
+		std::string const & KeyedValue // Associated Key for this variable
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// True if the requested key is one that no longer exists and is reported as this key.
+
+		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
+		using InputProcessor::SameString;
+
+		if ( ReportKeyAliases.empty() || RequestedKey.empty() ) return false;
+		auto const Found( ReportKeyAliases.find( MakeUPPERCase( RequestedKey ) ) );
+		return Found != ReportKeyAliases.end() && SameString( Found->second, KeyedValue );
+
+	}
+
+	void
+	AddReportKeyAlias(
+		std::string const & RequestedKey, // Key that no longer exists, as requested
+		std::string const & KeyedValue // Key reported in its place
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Has the report variables requested for a key that no longer exists, such as a surface
+		// merged into another, reported for the key that took its place.
+
+		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
+
+		ReportKeyAliases[ MakeUPPERCase( RequestedKey ) ] = KeyedValue;
+
+	}
+
 	void
 	AddBlankKeys(
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
+		ReqReportVariableGroup const & Group // Requested Report Variables of this variable name
 	)
 	{
 
@@ -608,15 +637,12 @@ namespace OutputProcessor {
 		// a frequency already on the list).
 
 		// METHODOLOGY EMPLOYED:
-		// Go through the ReqRepVars list and add those
-		// that match (and dont duplicate ones already in the list).
+		// Go through the blank key requests of this variable name and add those
+		// that dont duplicate ones already in the list.
 
 		// REFERENCES:
 		// na
 
-		// Using/Aliasing
-		using InputProcessor::SameString;
-
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -630,14 +656,13 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Loop;
 		int Loop1;
 		bool Dup;
-		Array1D_int TmpReportList;
 
-		for ( Loop = MinIndx; Loop <= MaxIndx; ++Loop ) {
-			if ( ! ReqRepVars( Loop ).Key.empty() ) continue;
-			if ( ! SameString( ReqRepVars( Loop ).VarName, VariableName ) ) continue;
+		auto const BlankKeys( Group.ReqRepVarNumsByKey.find( BlankString ) );
+		if ( BlankKeys == Group.ReqRepVarNumsByKey.end() ) return;
+
+		for ( int const Loop : BlankKeys->second ) {
 
 			//   A match.  Make sure doesnt duplicate
 
@@ -787,6 +812,10 @@ namespace OutputProcessor {
 
 			ReqRepVars( Loop ).Used = false;
 
+			ReqReportVariableGroup & Group( ReqRepVarGroups[ MakeUPPERCase( ReqRepVars( Loop ).VarName ) ] );
+			Group.ReqRepVarNums.push_back( Loop );
+			Group.ReqRepVarNumsByKey[ MakeUPPERCase( ReqRepVars( Loop ).Key ) ].push_back( Loop );
+
 		}
 
 		if ( ErrorsFound ) {
@@ -1146,6 +1175,50 @@ namespace OutputProcessor {
 
 	}
 
+	void
+	BuildVariableReportLists()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sorts the real and integer variables by index type and by what they report, so each
+		// block of UpdateDataandReport visits only the variables it has something to do for.
+
+		// METHODOLOGY EMPLOYED:
+		// Rebuilt whenever variables have been set up since the last build.  The lists keep the
+		// setup order, so the variables are still written in the order of their report numbers.
+
+		for ( int IndexType = ZoneVar; IndexType <= HVACVar; ++IndexType ) {
+			VariableReportLists( IndexType ) = VariableReportListType();
+		}
+
+		for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+			int const IndexType( RVariableTypes( Loop ).IndexType );
+			if ( IndexType < ZoneVar || IndexType > HVACVar ) continue;
+			auto & List( VariableReportLists( IndexType ) );
+			auto const & rVar( RVariableTypes( Loop ).VarPtr() );
+			List.RVariableNums.push_back( Loop );
+			if ( rVar.Report ) {
+				List.ReportedRVariableNums.push_back( Loop );
+				List.ReportedRVariableNumsByFreq( rVar.ReportFreq ).push_back( Loop );
+			} else {
+				List.UnreportedRVariableNums.push_back( Loop );
+			}
+		}
+
+		for ( int Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
+			int const IndexType( IVariableTypes( Loop ).IndexType );
+			if ( IndexType < ZoneVar || IndexType > HVACVar ) continue;
+			auto & List( VariableReportLists( IndexType ) );
+			auto const & iVar( IVariableTypes( Loop ).VarPtr() );
+			List.IVariableNums.push_back( Loop );
+			if ( iVar.Report ) List.ReportedIVariableNumsByFreq( iVar.ReportFreq ).push_back( Loop );
+		}
+
+		VariableReportListsNumRVariable = NumOfRVariable;
+		VariableReportListsNumIVariable = NumOfIVariable;
+
+	}
+
 	int
 	ValidateVariableType( std::string const & VariableTypeKey )
 	{
@@ -2264,6 +2337,8 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
+		MeterPlan.Built = false;
+
 		if ( SameString( Group, "Building" ) ) {
 			ValidateNStandardizeMeterTitles( MtrUnits, ResourceType, EndUse, EndUseSub, Group, ErrorsFound, ZoneName );
 		} else {
@@ -2375,6 +2450,8 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
+		MeterPlan.Built = false;
+
 		if ( MeterArrayPtr == 0 ) {
 			VarMeterArrays.redimension( ++NumVarMeterArrays );
 			MeterArrayPtr = NumVarMeterArrays;
@@ -2820,6 +2897,104 @@ namespace OutputProcessor {
 
 	}
 
+	void
+	BuildMeterAggregationPlan()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the meter aggregation plan from the meters the real variables are on.
+
+		// METHODOLOGY EMPLOYED:
+		// The sources are the metered real variables, zone variables first, in the order of the
+		// zone time step loop in UpdateDataandReport.  Each (meter, source) pair, the meter taken
+		// from OnMeters and then OnCustomMeters of the source, is counted into its meter row and
+		// the rows are filled in source order, so each meter adds up its sources in the same order
+		// as the calls to UpdateMeterValues did.  Repeated meters of a source are kept.
+
+		int NumSources( 0 );
+		int NumEntries( 0 );
+		for ( int IndexType = 1; IndexType <= 2; ++IndexType ) {
+			for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+				int const MeterArrayPtr( RVariableTypes( Loop ).VarPtr().MeterArrayPtr );
+				if ( MeterArrayPtr == 0 ) continue;
+				++NumSources;
+				NumEntries += VarMeterArrays( MeterArrayPtr ).NumOnMeters + max( VarMeterArrays( MeterArrayPtr ).NumOnCustomMeters, 0 );
+			}
+		}
+
+		MeterPlan.NumSources = NumSources;
+		MeterPlan.SourceVar.dimension( NumSources, 0 );
+		MeterPlan.SourceValue.dimension( NumSources, 0.0 );
+		MeterPlan.RowStart.dimension( NumEnergyMeters + 1, 0 );
+		MeterPlan.Source.dimension( NumEntries, 0 );
+
+		// Count the entries of each meter, then turn the counts into row starts
+		Array1D_int & RowStart( MeterPlan.RowStart );
+		int Source( 0 );
+		for ( int IndexType = 1; IndexType <= 2; ++IndexType ) {
+			for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+				int const MeterArrayPtr( RVariableTypes( Loop ).VarPtr().MeterArrayPtr );
+				if ( MeterArrayPtr == 0 ) continue;
+				MeterPlan.SourceVar( ++Source ) = Loop;
+				auto const & onMeters( VarMeterArrays( MeterArrayPtr ) );
+				for ( int Meter = 1; Meter <= onMeters.NumOnMeters; ++Meter ) ++RowStart( onMeters.OnMeters( Meter ) );
+				for ( int Meter = 1; Meter <= onMeters.NumOnCustomMeters; ++Meter ) ++RowStart( onMeters.OnCustomMeters( Meter ) );
+			}
+		}
+		int Start( 1 );
+		for ( int Meter = 1; Meter <= NumEnergyMeters + 1; ++Meter ) {
+			int const Count( RowStart( Meter ) );
+			RowStart( Meter ) = Start;
+			Start += Count;
+		}
+
+		// Fill the rows in source order
+		Array1D_int Next( RowStart );
+		for ( Source = 1; Source <= NumSources; ++Source ) {
+			auto const & onMeters( VarMeterArrays( RVariableTypes( MeterPlan.SourceVar( Source ) ).VarPtr().MeterArrayPtr ) );
+			for ( int Meter = 1; Meter <= onMeters.NumOnMeters; ++Meter ) MeterPlan.Source( Next( onMeters.OnMeters( Meter ) )++ ) = Source;
+			for ( int Meter = 1; Meter <= onMeters.NumOnCustomMeters; ++Meter ) MeterPlan.Source( Next( onMeters.OnCustomMeters( Meter ) )++ ) = Source;
+		}
+
+		MeterPlan.Built = true;
+
+	}
+
+	void
+	UpdateMeterValuesFromPlan()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the time step values of all metered real variables to the meters they are on,
+		// as UpdateMeterValues does for one variable.
+
+		// METHODOLOGY EMPLOYED:
+		// Gathers the source values into one contiguous array, then each meter sums its row of
+		// the plan.  Must be called before the time step values are reset for reporting.
+
+		if ( ! MeterPlan.Built || MeterPlan.RowStart.isize() != NumEnergyMeters + 1 ) BuildMeterAggregationPlan();
+
+		int const NumSources( MeterPlan.NumSources );
+		for ( int Source = 1; Source <= NumSources; ++Source ) {
+			auto const & rVar( RVariableTypes( MeterPlan.SourceVar( Source ) ).VarPtr() );
+			MeterPlan.SourceValue( Source ) = rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult;
+		}
+
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			int const First( MeterPlan.RowStart( Meter ) );
+			int const Last( MeterPlan.RowStart( Meter + 1 ) );
+			if ( First == Last ) continue;
+			Real64 Sum( MeterValue( Meter ) );
+			for ( int Entry = First; Entry < Last; ++Entry ) {
+				Sum += MeterPlan.SourceValue( MeterPlan.Source( Entry ) );
+			}
+			MeterValue( Meter ) = Sum;
+		}
+
+	}
+
 	void
 	UpdateMeters( int const TimeStamp ) // Current TimeStamp (for max/min)
 	{
@@ -3769,28 +3944,41 @@ namespace OutputProcessor {
 		static char stamp[ N ];
 		assert( reportIDString.length() + DayOfSimChr.length() + ( DayType.present() ? DayType().length() : 0u ) + 26 < N ); // Check will fit in stamp size
 
+		if ( ColumnarOutput::WriteColumnarOutput ) {
+			bool const Detailed( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) );
+			Real64 const ColStartMinute( Detailed ? StartMinute() : 0.0 );
+			Real64 const ColEndMinute( Detailed ? EndMinute() : ( reportingInterval == ReportHourly ? 60.0 : 0.0 ) );
+			ColumnarOutput::WriteColumnarTimeIndex( reportingInterval, DayOfSim, ( Month.present() ? Month() : 0 ), ( DayOfMonth.present() ? DayOfMonth() : 0 ), ( Hour.present() ? Hour() : 0 ), ( DST.present() ? DST() : 0 ), ColStartMinute, ColEndMinute, ( DayType.present() ? DayType() : std::string() ) );
+		}
+
 		if ( ( ! out_stream_p ) || ( ! *out_stream_p ) ) return; // Stream
 
 		std::ostream & out_stream( *out_stream_p );
+		bool const WriteText( ! ColumnarOutput::ColumnarOutputOnly ); // Time stamps written to the columnar file only
+		if ( CsvOutput::WriteCsvOutput ) {
+			bool const Detailed( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) );
+			int const CsvFileNum( out_stream_p == DataGlobals::eso_stream ? CsvOutput::EsoCsv : ( out_stream_p == DataGlobals::mtr_stream ? CsvOutput::MtrCsv : -1 ) );
+			CsvOutput::WriteCsvTimeStamp( CsvFileNum, reportingInterval, DayOfSim, ( Month.present() ? Month() : 0 ), ( DayOfMonth.present() ? DayOfMonth() : 0 ), ( Hour.present() ? Hour() : 0 ), ( Detailed ? EndMinute() : 60.0 ) );
+		}
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
 			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), Hour(), StartMinute(), EndMinute(), DayType().c_str() );
-			out_stream << stamp << NL;
+			if ( WriteText ) out_stream << stamp << NL;
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, EndMinute, StartMinute, DST, DayType, DataGlobals::WarmupFlag );
 		} else if ( reportingInterval == ReportHourly ) {
 			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), Hour(), 0.0, 60.0, DayType().c_str() );
-			out_stream << stamp << NL;
+			if ( WriteText ) out_stream << stamp << NL;
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, _, _, DST, DayType, DataGlobals::WarmupFlag );
 		} else if ( reportingInterval == ReportDaily ) {
 			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), DayType().c_str() );
-			out_stream << stamp << NL;
+			if ( WriteText ) out_stream << stamp << NL;
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, _, _, _, DST, DayType, DataGlobals::WarmupFlag );
 		} else if ( reportingInterval == ReportMonthly ) {
 			std::sprintf( stamp, "%s,%s,%2d", reportIDString.c_str(), DayOfSimChr.c_str(), Month() );
-			out_stream << stamp << NL;
+			if ( WriteText ) out_stream << stamp << NL;
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( ReportMonthly, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month );
 		} else if ( reportingInterval == ReportSim ) {
 			std::sprintf( stamp, "%s,%s", reportIDString.c_str(), DayOfSimChr.c_str() );
-			out_stream << stamp << NL;
+			if ( WriteText ) out_stream << stamp << NL;
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum );
 		} else {
 			std::ostringstream ss;
@@ -3873,10 +4061,14 @@ namespace OutputProcessor {
 			if ( eso_stream ) *eso_stream << reportIDChr << ",11," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
 		}
 
+		if ( CsvOutput::WriteCsvOutput && eso_stream ) CsvOutput::AddCsvColumn( CsvOutput::EsoCsv, reportID, keyedValue + ',' + variableName + " [" + UnitsString + ']' + FreqString );
+
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDictionaryRecord( reportID, storeType, indexGroup, keyedValue, variableName, indexType, UnitsString, reportingInterval, false, ScheduleName );
 		}
 
+		ColumnarOutput::WriteColumnarDictionaryItem( reportID, reportingInterval, storeType, indexType, false, keyedValue, variableName, UnitsString );
+
 	}
 
 	void
@@ -4003,10 +4195,19 @@ namespace OutputProcessor {
 		static std::string const keyedValueStringNon;
 		std::string const & keyedValueString( cumulativeMeterFlag ? keyedValueStringCum : keyedValueStringNon );
 
+		if ( CsvOutput::WriteCsvOutput ) {
+			bool const LongInterval( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) );
+			std::string const CsvEntry( keyedValueString + meterName + " [" + UnitsString + ']' + ( ( cumulativeMeterFlag && LongInterval ) ? FreqString.substr( 0, index( FreqString, '[' ) ) : FreqString ) );
+			if ( mtr_stream ) CsvOutput::AddCsvColumn( CsvOutput::MtrCsv, reportID, CsvEntry );
+			if ( eso_stream && ! meterFileOnlyFlag ) CsvOutput::AddCsvColumn( CsvOutput::EsoCsv, reportID, CsvEntry );
+		}
+
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDictionaryRecord( reportID, storeType, indexGroup, keyedValueString, meterName, 1, UnitsString, reportingInterval, true );
 		}
 
+		ColumnarOutput::WriteColumnarDictionaryItem( reportID, reportingInterval, storeType, 1, true, keyedValueString, meterName, UnitsString );
+
 	}
 
 	void
@@ -4104,6 +4305,7 @@ namespace OutputProcessor {
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
+		using General::FormatListDirected;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4122,28 +4324,42 @@ namespace OutputProcessor {
 		std::string NumberOut; // Character for producing "number out"
 		std::string MaxOut; // Character for Max out string
 		std::string MinOut; // Character for Min out string
+		char Buffer[ 32 ]; // Receives each value formatted
 		Real64 repVal; // The variable's value
 
 		repVal = repValue;
 		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
+
+		if ( sqlite ) {
+			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate );
+		}
+
+		if ( ColumnarOutput::WriteColumnarOutput ) {
+			ColumnarOutput::WriteColumnarValue( reportID, repVal, minValue, minValueDate, MaxValue, maxValueDate );
+			if ( ColumnarOutput::ColumnarOutputOnly ) return;
+		}
+
 		if ( repVal == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
-			gio::write( NumberOut, fmtLD ) << repVal;
+			FormatListDirected( Buffer, repVal );
+			NumberOut = Buffer;
 			strip_trailing_zeros( strip( NumberOut ) );
 		}
 
 		if ( MaxValue == 0.0 ) {
 			MaxOut = "0.0";
 		} else {
-			gio::write( MaxOut, fmtLD ) << MaxValue;
+			FormatListDirected( Buffer, MaxValue );
+			MaxOut = Buffer;
 			strip_trailing_zeros( strip( MaxOut ) );
 		}
 
 		if ( minValue == 0.0 ) {
 			MinOut = "0.0";
 		} else {
-			gio::write( MinOut, fmtLD ) << minValue;
+			FormatListDirected( Buffer, minValue );
+			MinOut = Buffer;
 			strip_trailing_zeros( strip( MinOut ) );
 		}
 
@@ -4151,10 +4367,6 @@ namespace OutputProcessor {
 		ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
 		ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
 
-		if ( sqlite ) {
-			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate );
-		}
-
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
 			if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << NL;
 
@@ -4163,6 +4375,8 @@ namespace OutputProcessor {
 
 		}
 
+		if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::EsoCsv, reportID, NumberOut.c_str() );
+
 	}
 
 	void
@@ -4196,6 +4410,7 @@ namespace OutputProcessor {
 		using DataGlobals::StdOutputRecordCount;
 		using DataGlobals::StdMeterRecordCount;
 		using DataStringGlobals::NL;
+		using General::FormatListDirected;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4212,24 +4427,33 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		std::string NumberOut; // Character for producing "number out"
+		char Buffer[ 32 ]; // Receives each value formatted
+
+		if ( sqlite ) {
+			sqlite->createSQLiteReportDataRecord( reportID, repValue );
+		}
+
+		if ( ColumnarOutput::WriteColumnarOutput ) {
+			ColumnarOutput::WriteColumnarValue( reportID, repValue );
+			if ( ColumnarOutput::ColumnarOutputOnly ) return;
+		}
 
 		if ( repValue == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
-			gio::write( NumberOut, fmtLD ) << repValue;
+			FormatListDirected( Buffer, repValue );
+			NumberOut = Buffer;
 			strip_trailing_zeros( strip( NumberOut ) );
 		}
 
-		if ( sqlite ) {
-			sqlite->createSQLiteReportDataRecord( reportID, repValue );
-		}
-
 		if ( mtr_stream ) *mtr_stream << creportID << ',' << NumberOut << NL;
 		++StdMeterRecordCount;
+		if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::MtrCsv, reportID, NumberOut.c_str() );
 
 		if ( ! meterOnlyFlag ) {
 			if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << NL;
 			++StdOutputRecordCount;
+			if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::EsoCsv, reportID, NumberOut.c_str() );
 		}
 
 	}
@@ -4271,6 +4495,7 @@ namespace OutputProcessor {
 		using DataGlobals::StdOutputRecordCount;
 		using DataGlobals::StdMeterRecordCount;
 		using DataStringGlobals::NL;
+		using General::FormatListDirected;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4289,32 +4514,41 @@ namespace OutputProcessor {
 		std::string NumberOut; // Character for producing "number out"
 		std::string MaxOut; // Character for Max out string
 		std::string MinOut; // Character for Min out string
+		char Buffer[ 32 ]; // Receives each value formatted
+
+		if ( sqlite ) {
+			sqlite->createSQLiteReportDataRecord( reportID, repValue, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate, MinutesPerTimeStep );
+		}
+
+		if ( ColumnarOutput::WriteColumnarOutput ) {
+			ColumnarOutput::WriteColumnarValue( reportID, repValue, minValue, minValueDate, MaxValue, maxValueDate );
+			if ( ColumnarOutput::ColumnarOutputOnly ) return;
+		}
 
 		if ( repValue == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
-			gio::write( NumberOut, fmtLD ) << repValue;
+			FormatListDirected( Buffer, repValue );
+			NumberOut = Buffer;
 			strip_trailing_zeros( strip( NumberOut ) );
 		}
 
 		if ( MaxValue == 0.0 ) {
 			MaxOut = "0.0";
 		} else {
-			gio::write( MaxOut, fmtLD ) << MaxValue;
+			FormatListDirected( Buffer, MaxValue );
+			MaxOut = Buffer;
 			strip_trailing_zeros( strip( MaxOut ) );
 		}
 
 		if ( minValue == 0.0 ) {
 			MinOut = "0.0";
 		} else {
-			gio::write( MinOut, fmtLD ) << minValue;
+			FormatListDirected( Buffer, minValue );
+			MinOut = Buffer;
 			strip_trailing_zeros( strip( MinOut ) );
 		}
 
-		if ( sqlite ) {
-			sqlite->createSQLiteReportDataRecord( reportID, repValue, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate, MinutesPerTimeStep );
-		}
-
 		// Append the min and max strings with date information
 		//    CALL ProduceMinMaxStringWStartMinute(MinOut, minValueDate, reportingInterval)
 		//    CALL ProduceMinMaxStringWStartMinute(MaxOut, maxValueDate, reportingInterval)
@@ -4330,6 +4564,7 @@ namespace OutputProcessor {
 			++StdMeterRecordCount;
 
 		}
+		if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::MtrCsv, reportID, NumberOut.c_str() );
 
 		if ( ! meterOnlyFlag ) {
 			if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
@@ -4339,6 +4574,7 @@ namespace OutputProcessor {
 				if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
 				++StdOutputRecordCount;
 			}
+			if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::EsoCsv, reportID, NumberOut.c_str() );
 
 		}
 
@@ -4434,6 +4670,15 @@ namespace OutputProcessor {
 
 		if ( UpdateDataDuringWarmupExternalInterface && ! ReportDuringWarmup ) return;
 
+		if ( sqlite ) {
+			sqlite->createSQLiteReportDataRecord( reportID, repValue );
+		}
+
+		if ( ColumnarOutput::WriteColumnarOutput ) {
+			ColumnarOutput::WriteColumnarValue( reportID, repValue );
+			if ( ColumnarOutput::ColumnarOutputOnly ) return;
+		}
+
 		if ( repValue == 0.0 ) {
 			std::strcpy( s, "0.0" );
 		} else {
@@ -4498,11 +4743,8 @@ namespace OutputProcessor {
 			strip_number( s );
 		}
 
-		if ( sqlite ) {
-			sqlite->createSQLiteReportDataRecord( reportID, repValue );
-		}
-
 		if ( eso_stream ) *eso_stream << creportID << ',' << s << NL;
+		if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::EsoCsv, reportID, s );
 
 	}
 
@@ -4605,6 +4847,7 @@ namespace OutputProcessor {
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
+		using General::FormatListDirected;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4623,16 +4866,30 @@ namespace OutputProcessor {
 		std::string NumberOut; // Character for producing "number out"
 		std::string MaxOut; // Character for Max out string
 		std::string MinOut; // Character for Min out string
+		char Buffer[ 32 ]; // Receives each value formatted
 		Real64 rmaxValue;
 		Real64 rminValue;
 		Real64 repVal; // The variable's value
 
 		repVal = repValue;
 		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
+
+		rminValue = minValue;
+		rmaxValue = MaxValue;
+		if ( sqlite ) {
+			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, rminValue, minValueDate, rmaxValue, maxValueDate );
+		}
+
+		if ( ColumnarOutput::WriteColumnarOutput ) {
+			ColumnarOutput::WriteColumnarValue( reportID, repVal, rminValue, minValueDate, rmaxValue, maxValueDate );
+			if ( ColumnarOutput::ColumnarOutputOnly ) return;
+		}
+
 		if ( repValue == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
-			gio::write( NumberOut, fmtLD ) << repVal;
+			FormatListDirected( Buffer, repVal );
+			NumberOut = Buffer;
 			strip_trailing_zeros( strip( NumberOut ) );
 		}
 
@@ -4642,18 +4899,14 @@ namespace OutputProcessor {
 		ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
 		ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
 
-		rminValue = minValue;
-		rmaxValue = MaxValue;
-		if ( sqlite ) {
-			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, rminValue, minValueDate, rmaxValue, maxValueDate );
-		}
-
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
 			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << NL;
 		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
 			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
 		}
 
+		if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::EsoCsv, reportID, NumberOut.c_str() );
+
 	}
 
 	void
@@ -4687,6 +4940,7 @@ namespace OutputProcessor {
 		// Using/Aliasing
 		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
+		using General::FormatListDirected;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4694,28 +4948,37 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		std::string NumberOut; // Character for producing "number out"
+		char Buffer[ 32 ]; // Receives each value formatted
 		Real64 repValue( 0.0 ); // for SQLite
 
+		if ( present( IntegerValue ) ) repValue = IntegerValue;
+		if ( present( RealValue ) ) repValue = RealValue;
+
+		if ( sqlite ) {
+			sqlite->createSQLiteReportDataRecord( reportID, repValue );
+		}
+
+		if ( ColumnarOutput::WriteColumnarOutput ) {
+			ColumnarOutput::WriteColumnarValue( reportID, repValue );
+			if ( ColumnarOutput::ColumnarOutputOnly ) return;
+		}
+
 		if ( present( IntegerValue ) ) {
 			gio::write( NumberOut, fmtLD ) << IntegerValue;
 			strip( NumberOut );
-			repValue = IntegerValue;
 		}
 		if ( present( RealValue ) ) {
-			repValue = RealValue;
 			if ( RealValue == 0.0 ) {
 				NumberOut = "0.0";
 			} else {
-				gio::write( NumberOut, fmtLD ) << RealValue;
+				FormatListDirected( Buffer, RealValue );
+				NumberOut = Buffer;
 				strip_trailing_zeros( strip( NumberOut ) );
 			}
 		}
 
-		if ( sqlite ) {
-			sqlite->createSQLiteReportDataRecord( reportID, repValue );
-		}
-
 		if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << NL;
+		if ( CsvOutput::WriteCsvOutput ) CsvOutput::WriteCsvValue( CsvOutput::EsoCsv, reportID, NumberOut.c_str() );
 
 	}
 
@@ -5466,7 +5729,9 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	// Report Variables) strings to the standard output file.
 
 	// METHODOLOGY EMPLOYED:
-	// na
+	// Each block goes through the lists of VariableReportLists it needs: the record keeping
+	// through every variable of the index type, the hourly and longer blocks only through
+	// the variables reported at that frequency.
 
 	// REFERENCES:
 	// na
@@ -5497,7 +5762,6 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop; // Loop Variable
 	int IndexType; // Translate Zone=>1, HVAC=>2
 	Real64 CurVal; // Current value for real variables
 	Real64 ICurVal; // Current value for integer variables
@@ -5513,11 +5777,18 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	static bool EndTimeStepFlag( false ); // True when it's the end of the Zone Time Step
 	Real64 rxTime; // (MinuteNow-StartMinute)/REAL(MinutesPerTimeStep,r64) - for execution time
 
+	static int const ProfileZoneNum( Profiler::RegisterProfileZone( "UpdateDataandReport" ) );
+	Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 	IndexType = IndexTypeKey;
 	if ( IndexType != ZoneTSReporting && IndexType != HVACTSReporting ) {
 		ShowFatalError( "Invalid reporting requested -- UpdateDataAndReport" );
 	}
 
+	if ( NumOfRVariable != VariableReportListsNumRVariable || NumOfIVariable != VariableReportListsNumIVariable ) {
+		BuildVariableReportLists();
+	}
+
 	if ( ( IndexType >= ZoneVar ) && ( IndexType <= HVACVar ) ) {
 
 		// Basic record keeping and report out if "detailed"
@@ -5539,8 +5810,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		rxTime = ( MinuteNow - StartMinute ) / double( MinutesPerTimeStep );
 
 		// Main "Record Keeping" Loops for R and I variables
-		for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-			if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+		for ( int const Loop : VariableReportLists( IndexType ).RVariableNums ) {
 
 			// Act on the RVariables variable using the RVar structure
 			RVar >>= RVariableTypes( Loop ).VarPtr;
@@ -5605,8 +5875,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			}
 		}
 
-		for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-			if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
+		for ( int const Loop : VariableReportLists( IndexType ).IVariableNums ) {
 
 			// Act on the IVariables variable using the IVar structure
 			IVar >>= IVariableTypes( Loop ).VarPtr;
@@ -5678,19 +5947,18 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 	if ( EndTimeStepFlag ) {
 
+		// Update meters on the TimeStep  (Zone)
+		UpdateMeterValuesFromPlan();
+
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+			// Variables that are not reported only hand their timestep values to the meters
+			for ( int const Loop : VariableReportLists( IndexType ).UnreportedRVariableNums ) {
+				RVariableTypes( Loop ).VarPtr().TSValue = 0.0;
+			}
+
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedRVariableNums ) {
 				RVar >>= RVariableTypes( Loop ).VarPtr;
 				auto & rVar( RVar() );
-				// Update meters on the TimeStep  (Zone)
-				if ( rVar.MeterArrayPtr != 0 ) {
-					if ( VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters <= 0 ) {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters );
-					} else {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters, VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnCustomMeters );
-					}
-				}
 				ReportNow = true;
 				if ( rVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( rVar.SchedPtr ) != 0.0 ); //SetReportNow(RVar%SchedPtr)
 				if ( ! ReportNow || ! rVar.Report ) {
@@ -5726,8 +5994,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.thisTSStored = false;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
+			for ( int const Loop : VariableReportLists( IndexType ).IVariableNums ) {
 				IVar >>= IVariableTypes( Loop ).VarPtr;
 				auto & iVar( IVar() );
 				ReportNow = true;
@@ -5784,8 +6051,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
 			TimeValue( IndexType ).CurMinute = 0.0;
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedRVariableNums ) { // Nothing is stored for the others
 				RVar >>= RVariableTypes( Loop ).VarPtr;
 				auto & rVar( RVar() );
 				//        ReportNow=.TRUE.
@@ -5811,8 +6077,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.Value = 0.0;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
+			for ( int const Loop : VariableReportLists( IndexType ).IVariableNums ) {
 				IVar >>= IVariableTypes( Loop ).VarPtr;
 				auto & iVar( IVar() );
 				//        ReportNow=.TRUE.
@@ -5855,18 +6120,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		}
 		NumHoursInMonth += 24;
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportDaily );
-				}
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedRVariableNumsByFreq( ReportDaily ) ) {
+				RVar >>= RVariableTypes( Loop ).VarPtr;
+				WriteRealVariableOutput( ReportDaily );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportDaily );
-				}
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedIVariableNumsByFreq( ReportDaily ) ) {
+				IVar >>= IVariableTypes( Loop ).VarPtr;
+				WriteIntegerVariableOutput( ReportDaily );
 			} // Number of I Variables
 		} // Index type (Zone or HVAC)
 
@@ -5885,18 +6146,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		NumHoursInSim += NumHoursInMonth;
 		EndMonthFlag = false;
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportMonthly );
-				}
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedRVariableNumsByFreq( ReportMonthly ) ) {
+				RVar >>= RVariableTypes( Loop ).VarPtr;
+				WriteRealVariableOutput( ReportMonthly );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportMonthly );
-				}
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedIVariableNumsByFreq( ReportMonthly ) ) {
+				IVar >>= IVariableTypes( Loop ).VarPtr;
+				WriteIntegerVariableOutput( ReportMonthly );
 			} // Number of I Variables
 		} // IndexType (Zone, HVAC)
 
@@ -5911,18 +6168,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			WriteTimeStampFormatData( eso_stream, ReportSim, RunPeriodStampReportNbr, RunPeriodStampReportChr, DayOfSim, DayOfSimChr, false );
 		}
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportSim );
-				}
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedRVariableNumsByFreq( ReportSim ) ) {
+				RVar >>= RVariableTypes( Loop ).VarPtr;
+				WriteRealVariableOutput( ReportSim );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportSim );
-				}
+			for ( int const Loop : VariableReportLists( IndexType ).ReportedIVariableNumsByFreq( ReportSim ) ) {
+				IVar >>= IVariableTypes( Loop ).VarPtr;
+				WriteIntegerVariableOutput( ReportSim );
 			} // Number of I Variables
 		} // Index Type (Zone, HVAC)
 
@@ -6962,6 +7215,30 @@ GetInternalVariableValue(
 	return resultVal;
 }
 
+Real64 const *
+GetInternalVariableValuePtr(
+	int const varType, // 1=integer, 2=real, 3=meter
+	int const keyVarIndex // Array index
+)
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Gives the address of the value of a real report variable, so that a caller taking
+	// the value every time step can read it directly instead of calling
+	// GetInternalVariableValue.  Null for the other types of variable, whose value must
+	// still be got from GetInternalVariableValue.
+
+	// METHODOLOGY EMPLOYED:
+	// The variable is bound to its value when set up, so the address holds for the run.
+
+	// Using/Aliasing
+	using namespace OutputProcessor;
+
+	if ( varType != 2 || keyVarIndex < 1 || keyVarIndex > NumOfRVariable ) return nullptr;
+	RVar >>= RVariableTypes( keyVarIndex ).VarPtr;
+	return &RVar().Which();
+}
+
 Real64
 GetInternalVariableValueExternalInterface(
 	int const varType, // 1=integer, 2=REAL(r64), 3=meter
@@ -7636,6 +7913,34 @@ ReportingThisVariable( std::string const & RepVarName )
 
 }
 
+bool
+OutputVariableRequested(
+	std::string const & VariableName, // String Name of variable, units are ignored
+	std::string const & KeyedValue // Associated Key for this variable
+)
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// This function reports back if the output variable for this key is in the list of
+	// variables requested for the simulation, so the caller may skip computing a quantity
+	// that only feeds unrequested output variables.
+
+	// METHODOLOGY EMPLOYED:
+	// Same test SetupOutputVariable uses to decide whether a variable is kept.  Variables that
+	// are only kept because they are on a meter are not seen here, so quantities that are
+	// metered must still be computed.
+
+	// Using/Aliasing
+	using DataOutputs::FindItemInVariableList;
+
+	std::string::size_type const Item( index( VariableName, '[' ) );
+	if ( Item != std::string::npos ) {
+		return FindItemInVariableList( KeyedValue, stripped( VariableName.substr( 0, Item ) ) );
+	}
+	return FindItemInVariableList( KeyedValue, stripped( VariableName ) );
+
+}
+
 void
 InitPollutionMeterReporting( std::string const & ReportFreqName )
 {
@@ -8007,14 +8312,14 @@ AddToOutputVariableList(
 	// Variable Dictionary output.
 
 	// METHODOLOGY EMPLOYED:
-	// na
+	// The first entry of each variable name is found through DDVariableTypesByName,
+	// entries of the same name with other units are chained from it through Next.
 
 	// REFERENCES:
 	// na
 
 	// Using/Aliasing
 	using namespace OutputProcessor;
-	using InputProcessor::FindItemInList;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -8032,16 +8337,19 @@ AddToOutputVariableList(
 
 	int dup = 0;// for duplicate variable name
 	if ( NumVariablesForOutput > 0 ) {
-		dup = FindItemInList( VarName, DDVariableTypes.VarNameOnly(), NumVariablesForOutput );
+		auto const Found( DDVariableTypesByName.find( VarName ) );
+		if ( Found != DDVariableTypesByName.end() ) dup = Found->second;
 	} else {
 		DDVariableTypes.allocate( LVarAllocInc );
 		MaxVariablesForOutput = LVarAllocInc;
+		DDVariableTypesByName.clear();
 	}
 	if ( dup == 0 ) {
 		++NumVariablesForOutput;
 		if ( NumVariablesForOutput > MaxVariablesForOutput ) {
-			DDVariableTypes.redimension( MaxVariablesForOutput += LVarAllocInc );
+			DDVariableTypes.redimension( MaxVariablesForOutput += std::max( LVarAllocInc, MaxVariablesForOutput ) );
 		}
+		DDVariableTypesByName.emplace( VarName, NumVariablesForOutput );
 		DDVariableTypes( NumVariablesForOutput ).IndexType = IndexType;
 		DDVariableTypes( NumVariablesForOutput ).StoreType = StateType;
 		DDVariableTypes( NumVariablesForOutput ).VariableType = VariableType;
@@ -8060,7 +8368,7 @@ AddToOutputVariableList(
 		if ( dup2 == 0 ) {
 			++NumVariablesForOutput;
 			if ( NumVariablesForOutput > MaxVariablesForOutput ) {
-				DDVariableTypes.redimension( MaxVariablesForOutput += LVarAllocInc );
+				DDVariableTypes.redimension( MaxVariablesForOutput += std::max( LVarAllocInc, MaxVariablesForOutput ) );
 			}
 			DDVariableTypes( NumVariablesForOutput ).IndexType = IndexType;
 			DDVariableTypes( NumVariablesForOutput ).StoreType = StateType;
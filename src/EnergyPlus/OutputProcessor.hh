@@ -2,7 +2,10 @@
 #define OutputProcessor_hh_INCLUDED
 
 // C++ Headers
+#include <algorithm>
 #include <iosfwd>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -529,6 +532,36 @@ namespace OutputProcessor {
 
 	};
 
+	struct ReqReportVariableGroup // Requested Report Variables of one variable name
+	{
+		// Members
+		std::vector< int > ReqRepVarNums; // ReqRepVars indices, in input order
+		std::unordered_map< std::string, std::vector< int > > ReqRepVarNumsByKey; // ReqRepVars indices, in input order, by key (uppercase, blank for all keys)
+
+		// Default Constructor
+		ReqReportVariableGroup()
+		{}
+
+	};
+
+	struct VariableReportListType // Variables of one index type (zone or HVAC) as UpdateDataandReport visits them
+	{
+		// Members
+		std::vector< int > RVariableNums; // RVariableTypes indices, in setup order
+		std::vector< int > ReportedRVariableNums; // RVariableTypes indices of the variables that are reported
+		std::vector< int > UnreportedRVariableNums; // RVariableTypes indices of the variables only kept for meters or lookups
+		std::vector< int > IVariableNums; // IVariableTypes indices, in setup order
+		Array1D< std::vector< int > > ReportedRVariableNumsByFreq; // ReportedRVariableNums by reporting frequency
+		Array1D< std::vector< int > > ReportedIVariableNumsByFreq; // IVariableTypes indices of the variables that are reported, by reporting frequency
+
+		// Default Constructor
+		VariableReportListType() :
+			ReportedRVariableNumsByFreq( IndexRange( ReportEach, ReportSim ) ),
+			ReportedIVariableNumsByFreq( IndexRange( ReportEach, ReportSim ) )
+		{}
+
+	};
+
 	struct MeterArrayType
 	{
 		// Members
@@ -563,6 +596,27 @@ namespace OutputProcessor {
 
 	};
 
+	struct MeterAggregationPlanType
+	{
+		// Flattened form of the VarMeterArrays: for each meter (row), the metered variables on
+		// it in the order the time step loop reaches them.
+
+		// Members
+		bool Built; // False when meters have been attached since the plan was built
+		int NumSources; // Number of metered real variables
+		Array1D_int SourceVar; // RVariableTypes index of each source
+		Array1D< Real64 > SourceValue; // Time step value of each source, with zone multipliers
+		Array1D_int RowStart; // Entries of meter m are RowStart(m) to RowStart(m+1)-1
+		Array1D_int Source; // Source of each entry
+
+		// Default Constructor
+		MeterAggregationPlanType() :
+			Built( false ),
+			NumSources( 0 )
+		{}
+
+	};
+
 	struct MeterType
 	{
 		// Members
@@ -897,7 +951,14 @@ namespace OutputProcessor {
 	extern Reference< RealVariables > RVar;
 	extern Reference< IntegerVariables > IVar;
 	extern Array1D< ReqReportVariables > ReqRepVars;
+	extern std::unordered_map< std::string, ReqReportVariableGroup > ReqRepVarGroups; // Requested Report Variables by variable name (uppercase)
+	extern std::unordered_map< std::string, int > DDVariableTypesByName;
+	extern Array1D< VariableReportListType > VariableReportLists; // By index type (zone, HVAC), see BuildVariableReportLists
+	extern int VariableReportListsNumRVariable; // NumOfRVariable when VariableReportLists were built
+	extern int VariableReportListsNumIVariable; // NumOfIVariable when VariableReportLists were built // First DDVariableTypes index of each variable name
+	extern std::unordered_map< std::string, std::string > ReportKeyAliases; // Key reported for a requested key that no longer exists, by requested key (uppercase)
 	extern Array1D< MeterArrayType > VarMeterArrays;
+	extern MeterAggregationPlanType MeterPlan; // Built from VarMeterArrays for UpdateMeterValuesFromPlan
 	extern Array1D< MeterType > EnergyMeters;
 	extern Array1D< EndUseCategoryType > EndUseCategory;
 
@@ -921,16 +982,24 @@ namespace OutputProcessor {
 	void
 	BuildKeyVarList(
 		std::string const & KeyedValue, // Associated Key for this variable
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
+		ReqReportVariableGroup const & Group // Requested Report Variables of this variable name
+	);
+
+	bool
+	IsReportKeyAlias(
+		std::string const & RequestedKey, // Key of a requested report variable
+		std::string const & KeyedValue // Associated Key for this variable
+	);
+
+	void
+	AddReportKeyAlias(
+		std::string const & RequestedKey, // Key that no longer exists, as requested
+		std::string const & KeyedValue // Key reported in its place
 	);
 
 	void
 	AddBlankKeys(
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
+		ReqReportVariableGroup const & Group // Requested Report Variables of this variable name
 	);
 
 	void
@@ -971,14 +1040,15 @@ namespace OutputProcessor {
 	void
 	ReallocateRVar()
 	{
-		RVariableTypes.redimension( MaxRVariable += RVarAllocInc );
+		// Grows geometrically so registering n variables copies the table O(n) times in all
+		RVariableTypes.redimension( MaxRVariable += std::max( RVarAllocInc, MaxRVariable ) );
 	}
 
 	inline
 	void
 	ReallocateIVar()
 	{
-		IVariableTypes.redimension( MaxIVariable += IVarAllocInc );
+		IVariableTypes.redimension( MaxIVariable += std::max( IVarAllocInc, MaxIVariable ) );
 	}
 
 	int
@@ -990,6 +1060,9 @@ namespace OutputProcessor {
 	std::string
 	StandardIndexTypeKey( int const IndexType );
 
+	void
+	BuildVariableReportLists();
+
 	int
 	ValidateVariableType( std::string const & VariableTypeKey );
 
@@ -1076,6 +1149,12 @@ namespace OutputProcessor {
 		Optional< Array1S_int const > OnCustomMeters = _ // Which custom meters this variable is on (index values)
 	);
 
+	void
+	BuildMeterAggregationPlan();
+
+	void
+	UpdateMeterValuesFromPlan();
+
 	void
 	UpdateMeters( int const TimeStamp ); // Current TimeStamp (for max/min)
 
@@ -1364,6 +1443,12 @@ GetInternalVariableValue(
 	int const keyVarIndex // Array index
 );
 
+Real64 const *
+GetInternalVariableValuePtr(
+	int const varType, // 1=integer, 2=real, 3=meter
+	int const keyVarIndex // Array index
+);
+
 Real64
 GetInternalVariableValueExternalInterface(
 	int const varType, // 1=integer, 2=REAL(r64), 3=meter
@@ -1413,6 +1498,12 @@ GetVariableKeys(
 bool
 ReportingThisVariable( std::string const & RepVarName );
 
+bool
+OutputVariableRequested(
+	std::string const & VariableName, // String Name of variable, units are ignored
+	std::string const & KeyedValue // Associated Key for this variable
+);
+
 void
 InitPollutionMeterReporting( std::string const & ReportFreqName );
 
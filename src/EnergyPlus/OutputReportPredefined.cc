@@ -5,6 +5,7 @@
 // EnergyPlus Headers
 #include <OutputReportPredefined.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 
 namespace EnergyPlus {
 
@@ -621,6 +622,18 @@ namespace OutputReportPredefined {
 	int pdstLeedEneUsePerc;
 	int pdchLeedEupPerc;
 
+	// Root Solver Summary
+	int pdrRootSolver( 0 );
+	int pdstRootSolver( 0 );
+	int pdchRootSolverType( 0 );
+	int pdchRootSolverName( 0 );
+	int pdchRootSolverSolve( 0 );
+	int pdchRootSolverSolves( 0 );
+	int pdchRootSolverEvals( 0 );
+	int pdchRootSolverAvgIter( 0 );
+	int pdchRootSolverNotConv( 0 );
+	int pdchRootSolverNotBrack( 0 );
+
 	// Internal data structures to store information provided by calls
 
 	int const sizeIncrement( 100 );
@@ -686,6 +699,7 @@ namespace OutputReportPredefined {
 		// Using/Aliasing
 		using DataGlobals::DoZoneSizing;
 		using DataGlobals::DoSystemSizing;
+		using DataSystemVariables::ReportRootSolverStatistics;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 		// na
@@ -1450,6 +1464,22 @@ namespace OutputReportPredefined {
 		//    Miscellaneous
 		pdchLeedEupPerc = newPreDefColumn( pdstLeedEneUsePerc, "Percent [%]" );
 
+		// Root Solver Summary, only when the solves are counted
+		if ( ReportRootSolverStatistics ) {
+			pdrRootSolver = newPreDefReport( "RootSolverSummary", "Root", "Root Solver Summary" );
+
+			pdstRootSolver = newPreDefSubTable( pdrRootSolver, "Root Solves by Call Site" );
+			pdchRootSolverType = newPreDefColumn( pdstRootSolver, "Component Type" );
+			pdchRootSolverName = newPreDefColumn( pdstRootSolver, "Component Name" );
+			pdchRootSolverSolve = newPreDefColumn( pdstRootSolver, "Solved For" );
+			pdchRootSolverSolves = newPreDefColumn( pdstRootSolver, "Solves" );
+			pdchRootSolverEvals = newPreDefColumn( pdstRootSolver, "Residual Evaluations" );
+			pdchRootSolverAvgIter = newPreDefColumn( pdstRootSolver, "Average Iterations of Converged Solves" );
+			pdchRootSolverNotConv = newPreDefColumn( pdstRootSolver, "Iteration Limit Exceeded" );
+			pdchRootSolverNotBrack = newPreDefColumn( pdstRootSolver, "Solution Not Bracketed" );
+			addFootNoteSubTable( pdstRootSolver, "Call sites are listed from the most residual evaluations to the least" );
+		}
+
 	}
 
 	void
@@ -612,6 +612,18 @@ namespace OutputReportPredefined {
 	extern int pdstLeedEneUsePerc;
 	extern int pdchLeedEupPerc;
 
+	// Root Solver Summary
+	extern int pdrRootSolver;
+	extern int pdstRootSolver;
+	extern int pdchRootSolverType;
+	extern int pdchRootSolverName;
+	extern int pdchRootSolverSolve;
+	extern int pdchRootSolverSolves;
+	extern int pdchRootSolverEvals;
+	extern int pdchRootSolverAvgIter;
+	extern int pdchRootSolverNotConv;
+	extern int pdchRootSolverNotBrack;
+
 	// Internal data structures to store information provided by calls
 
 	extern int const sizeIncrement;
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iomanip>
@@ -30,6 +31,7 @@
 #include <DataShadowingCombinations.hh>
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DataSurfaces.hh>
 #include <DataWater.hh>
 #include <DataZoneEquipment.hh>
@@ -39,9 +41,12 @@
 #include <InputProcessor.hh>
 #include <LowTempRadiantSystem.hh>
 #include <ManageElectricPower.hh>
+#include <MemoryReport.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <OutputWriterThread.hh>
 #include <PollutionModule.hh>
+#include <Profiler.hh>
 #include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
 #include <SQLiteProcedures.hh>
@@ -379,7 +384,8 @@ namespace OutputReportTabular {
 	Array3D< Real64 > feneSolarRadSeq;
 	Array3D< Real64 > feneSolarDelaySeq;
 
-	Array3D< Real64 > surfDelaySeq;
+	Array2D< Real64 > surfDelaySeqCool; // delayed convection of each surface on the cooling design day of its zone
+	Array2D< Real64 > surfDelaySeqHeat; // delayed convection of each surface on the heating design day of its zone
 
 	int maxUniqueKeyCount( 0 );
 
@@ -3048,6 +3054,8 @@ namespace OutputReportTabular {
 		using DataEnvironment::EnvironmentName;
 		using DataEnvironment::WeatherFileLocationTitle;
 		using DataHeatBalance::BuildingName;
+		using DataSystemVariables::UseOutputWriterThread;
+		using OutputWriterThread::StartOutputWriter;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3175,6 +3183,7 @@ namespace OutputReportTabular {
 					}
 					tbl_stream << '\n';
 				}
+				if ( UseOutputWriterThread ) StartOutputWriter( &tbl_stream );
 			}
 		}
 	}
@@ -3229,6 +3238,7 @@ namespace OutputReportTabular {
 					}
 					tbl_stream << "</EnergyPlusTabularReports>\n";
 				}
+				OutputWriterThread::StopOutputWriter( &tbl_stream );
 				tbl_stream.close();
 			}
 		}
@@ -3433,10 +3443,23 @@ namespace OutputReportTabular {
 		int binNum;
 		int repIndex;
 		int curStepType;
+		static bool RunOnce( true );
+		static std::vector< Real64 const * > BinObjValuePtr; // Value of each real variable binned, null for the others
 
 		//REAL(r64), external :: GetInternalVariableValue
 
 		if ( ! DoWeathSim ) return;
+		//address of the value of each real variable, read directly each timestep
+		if ( RunOnce ) {
+			BinObjValuePtr.assign( BinResultsTableCount + 1, nullptr );
+			for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+				for ( jTable = 1; jTable <= OutputTableBinned( iInObj ).numTables; ++jTable ) {
+					repIndex = OutputTableBinned( iInObj ).resIndex + ( jTable - 1 );
+					BinObjValuePtr[ repIndex ] = GetInternalVariableValuePtr( OutputTableBinned( iInObj ).typeOfVar, BinObjVarID( repIndex ).varMeterNum );
+				}
+			}
+			RunOnce = false;
+		}
 		elapsedTime = TimeStepSys;
 		timeInYear += elapsedTime;
 		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
@@ -3465,7 +3488,11 @@ namespace OutputReportTabular {
 					repIndex = curResIndex + ( jTable - 1 );
 					if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
 						// put actual value from OutputProcesser arrays
-						curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
+						if ( BinObjValuePtr[ repIndex ] ) {
+							curValue = *BinObjValuePtr[ repIndex ];
+						} else {
+							curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
+						}
 						// per MJW when a summed variable is used divide it by the length of the time step
 						if ( IndexTypeKey == HVACTSReporting ) {
 							elapsedTime = TimeStepSys;
@@ -3573,6 +3600,7 @@ namespace OutputReportTabular {
 		static Array1D_int MonthlyColumnsAggType;
 		static Array1D_int MonthlyColumnsVarNum;
 		static Array1D_int MonthlyTablesNumColumns;
+		static std::vector< Real64 const * > MonthlyColumnsValuePtr; // Value of each real variable column, null for the others
 		static int curFirstColumn( 0 );
 
 		if ( ! DoWeathSim ) return;
@@ -3586,6 +3614,11 @@ namespace OutputReportTabular {
 			MonthlyColumnsVarNum = MonthlyColumns.varNum();
 			//MonthlyTables
 			MonthlyTablesNumColumns = MonthlyTables.numColumns();
+			//address of the value of each real variable, read directly each timestep
+			MonthlyColumnsValuePtr.assign( MonthlyColumnsCount + 1, nullptr );
+			for ( curCol = 1; curCol <= MonthlyColumnsCount; ++curCol ) {
+				MonthlyColumnsValuePtr[ curCol ] = GetInternalVariableValuePtr( MonthlyColumnsTypeOfVar( curCol ), MonthlyColumnsVarNum( curCol ) );
+			}
 
 			//set flag so this block is only executed once
 			RunOnce = false;
@@ -3598,6 +3631,12 @@ namespace OutputReportTabular {
 			elapsedTime = TimeStepZone;
 		}
 		IsMonthGathered( Month ) = true;
+			// the current timestamp, the same for every column
+			minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
+			//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
+			//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
+			//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
+			EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
 		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
 			activeMinMax = false; //at the beginning of the new timestep
 			activeHoursShown = false; //fix by JG addressing CR6482
@@ -3609,8 +3648,12 @@ namespace OutputReportTabular {
 				if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
 					//  the above condition used to include the following prior to new scan method
 					//  (MonthlyColumns(curCol)%aggType .EQ. aggTypeValueWhenMaxMin)
-					curVarNum = MonthlyColumnsVarNum( curCol );
-					curValue = GetInternalVariableValue( curTypeOfVar, curVarNum );
+					if ( MonthlyColumnsValuePtr[ curCol ] ) {
+						curValue = *MonthlyColumnsValuePtr[ curCol ];
+					} else {
+						curVarNum = MonthlyColumnsVarNum( curCol );
+						curValue = GetInternalVariableValue( curTypeOfVar, curVarNum );
+					}
 					// Get the value from the result array
 					oldResultValue = MonthlyColumns( curCol ).reslt( Month );
 					oldTimeStamp = MonthlyColumns( curCol ).timeStamp( Month );
@@ -3620,12 +3663,6 @@ namespace OutputReportTabular {
 					newTimeStamp = 0;
 					newDuration = 0.0;
 					activeNewValue = false;
-					// the current timestamp
-					minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
-					//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
-					//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
-					//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
-					EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
 					// perform the selected aggregation type
 					// use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
 					{ auto const SELECT_CASE_var( MonthlyColumnsAggType( curCol ) );
@@ -3747,9 +3784,13 @@ namespace OutputReportTabular {
 								break; //do
 							} else if ( SELECT_CASE_var == aggTypeValueWhenMaxMin ) {
 								// this case is when the value should be set
-								scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-								scanVarNum = MonthlyColumns( scanColumn ).varNum;
-								scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+								if ( MonthlyColumnsValuePtr[ scanColumn ] ) {
+									scanValue = *MonthlyColumnsValuePtr[ scanColumn ];
+								} else {
+									scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
+									scanVarNum = MonthlyColumns( scanColumn ).varNum;
+									scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+								}
 								// When a summed variable is used divide it by the length of the time step
 								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
 									if ( IndexTypeKey == HVACTSReporting ) {
@@ -3769,9 +3810,13 @@ namespace OutputReportTabular {
 					if ( activeHoursShown ) {
 						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
 							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-							scanVarNum = MonthlyColumns( scanColumn ).varNum;
-							scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+							if ( MonthlyColumnsValuePtr[ scanColumn ] ) {
+								scanValue = *MonthlyColumnsValuePtr[ scanColumn ];
+							} else {
+								scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
+								scanVarNum = MonthlyColumns( scanColumn ).varNum;
+								scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+							}
 							oldScanValue = MonthlyColumns( scanColumn ).reslt( Month );
 							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
 							if ( ( SELECT_CASE_var == aggTypeHoursZero ) || ( SELECT_CASE_var == aggTypeHoursNonZero ) ) {
@@ -4789,6 +4834,8 @@ namespace OutputReportTabular {
 			WriteCompCostTable();
 			WriteAdaptiveComfortTable();
 			WriteZoneLoadComponentTable();
+			WriteComponentRuntimeTable();
+			WriteMemoryUsageTable();
 			if ( DoWeathSim ) {
 				WriteMonthlyTables();
 				WriteTimeBinTables();
@@ -5507,6 +5554,9 @@ namespace OutputReportTabular {
 		using DataErrorTracking::TotalSevereErrors;
 		using DataErrorTracking::TotalWarningErrors;
 		using General::RoundSigDigits;
+		using General::RootSolverCallSites;
+		using General::RootSolverCallSiteData;
+		using DataSystemVariables::ReportRootSolverStatistics;
 		using DataAirflowNetwork::SimulateAirflowNetwork;
 		using DataAirflowNetwork::AirflowNetworkControlMultizone;
 		using DataAirflowNetwork::AirflowNetworkControlMultiADS;
@@ -5834,6 +5884,34 @@ namespace OutputReportTabular {
 		} else {
 			PreDefTableEntry( pdchLeedGenData, "Total gross floor area [m2]", "-" );
 		}
+
+		// Root Solver Summary
+		if ( ReportRootSolverStatistics ) {
+			std::vector< std::pair< int, int > > CallSiteOrder; // (-evaluations, call site)
+			CallSiteOrder.reserve( RootSolverCallSites.size() );
+			for ( int CallSite = 1; CallSite <= int( RootSolverCallSites.size() ); ++CallSite ) {
+				CallSiteOrder.push_back( std::make_pair( -RootSolverCallSites[ CallSite - 1 ].Stats.NumEvaluations, CallSite ) );
+			}
+			std::sort( CallSiteOrder.begin(), CallSiteOrder.end() );
+			for ( auto const & Entry : CallSiteOrder ) {
+				RootSolverCallSiteData const & Site( RootSolverCallSites[ Entry.second - 1 ] );
+				if ( Site.Stats.NumSolves == 0 ) continue;
+				std::string const RowName( RoundSigDigits( Entry.second ) );
+				int const NumConverged( Site.Stats.NumSolves - Site.Stats.NumNotConverged - Site.Stats.NumNotBracketed );
+				PreDefTableEntry( pdchRootSolverType, RowName, Site.CompType );
+				PreDefTableEntry( pdchRootSolverName, RowName, Site.CompName );
+				PreDefTableEntry( pdchRootSolverSolve, RowName, Site.Solve );
+				PreDefTableEntry( pdchRootSolverSolves, RowName, Site.Stats.NumSolves );
+				PreDefTableEntry( pdchRootSolverEvals, RowName, Site.Stats.NumEvaluations );
+				if ( NumConverged > 0 ) {
+					PreDefTableEntry( pdchRootSolverAvgIter, RowName, Real64( Site.Stats.NumIterations ) / NumConverged, 1 );
+				} else {
+					PreDefTableEntry( pdchRootSolverAvgIter, RowName, "-" );
+				}
+				PreDefTableEntry( pdchRootSolverNotConv, RowName, Site.Stats.NumNotConverged );
+				PreDefTableEntry( pdchRootSolverNotBrack, RowName, Site.Stats.NumNotBracketed );
+			}
+		}
 	}
 
 	void
@@ -9744,6 +9822,118 @@ namespace OutputReportTabular {
 
 	}
 
+	void
+	WriteComponentRuntimeTable()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the air loop, zone and plant components that took the most simulation time, as
+		// accounted with the ComponentRuntimeAccounting environment variable set.
+
+		// Using/Aliasing
+		using DataSystemVariables::ComponentRuntimeAccounting;
+		using Profiler::ComponentTiming;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MaxRows( 50 ); // Components listed
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D_string columnHead( 5 );
+		Array1D_int columnWidth( 5 );
+		Array1D_string rowHead;
+		Array2D_string tableBody;
+		std::vector< int > Order; // Entries of ComponentTiming by decreasing time
+		Real64 TotalTime( 0.0 ); // Time of all components (s)
+
+		if ( ! ComponentRuntimeAccounting || ComponentTiming.empty() ) return;
+
+		for ( int i = 0; i < int( ComponentTiming.size() ); ++i ) {
+			Order.push_back( i );
+			TotalTime += ComponentTiming[ i ].Time * 1.0e-9;
+		}
+		std::stable_sort( Order.begin(), Order.end(), []( int const a, int const b ){ return ComponentTiming[ a ].Time > ComponentTiming[ b ].Time; } );
+		int const NumRows( min( MaxRows, int( Order.size() ) ) );
+
+		rowHead.allocate( NumRows );
+		tableBody.allocate( 5, NumRows );
+
+		WriteReportHeaders( "Component Runtime Summary", "Entire Facility", 0 );
+		WriteSubtitle( "Components Taking the Most Simulation Time" );
+
+		columnWidth = 14;
+		columnHead( 1 ) = "Component Type";
+		columnHead( 2 ) = "Calls";
+		columnHead( 3 ) = "Time [s]";
+		columnHead( 4 ) = "Time per Call [ms]";
+		columnHead( 5 ) = "Share of Component Time [%]";
+
+		for ( int i = 1; i <= NumRows; ++i ) {
+			auto const & timing( ComponentTiming[ Order[ i - 1 ] ] );
+			Real64 const Time( timing.Time * 1.0e-9 );
+			rowHead( i ) = timing.CompName;
+			tableBody( 1, i ) = timing.CompType;
+			tableBody( 2, i ) = std::to_string( timing.Calls );
+			tableBody( 3, i ) = RealToStr( Time, 3 );
+			tableBody( 4, i ) = RealToStr( ( timing.Calls > 0 ? 1000.0 * Time / timing.Calls : 0.0 ), 4 );
+			tableBody( 5, i ) = RealToStr( ( TotalTime > 0.0 ? 100.0 * Time / TotalTime : 0.0 ), 2 );
+		}
+
+		WriteTable( tableBody, rowHead, columnHead, columnWidth );
+		if ( sqlite ) {
+			sqlite->createSQLiteTabularDataRecords( tableBody, rowHead, columnHead, "ComponentRuntimeSummary", "Entire Facility", "Components Taking the Most Simulation Time" );
+		}
+
+	}
+
+	void
+	WriteMemoryUsageTable()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the memory of the main arrays by module after the initialization and at peak, as
+		// accounted with the --memory-report option.
+
+		// Using/Aliasing
+		using DataSystemVariables::MemoryUsageReport;
+		using MemoryReport::MemoryGroups;
+		using MemoryReport::MegaBytes;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D_string columnHead( 2 );
+		Array1D_int columnWidth( 2 );
+		Array1D_string rowHead;
+		Array2D_string tableBody;
+
+		if ( ! MemoryUsageReport || MemoryGroups.empty() ) return;
+
+		int const NumRows( int( MemoryGroups.size() ) + 1 );
+		rowHead.allocate( NumRows );
+		tableBody.allocate( 2, NumRows );
+
+		WriteReportHeaders( "Memory Usage Summary", "Entire Facility", 0 );
+		WriteSubtitle( "Memory of the Main Arrays by Module" );
+
+		columnWidth = 14;
+		columnHead( 1 ) = "After Initialization [MB]";
+		columnHead( 2 ) = "Peak [MB]";
+
+		for ( int i = 1; i < NumRows; ++i ) {
+			auto const & group( MemoryGroups[ i - 1 ] );
+			rowHead( i ) = group.Name;
+			tableBody( 1, i ) = MegaBytes( group.InitBytes );
+			tableBody( 2, i ) = MegaBytes( group.PeakBytes );
+		}
+		rowHead( NumRows ) = "Process Peak Resident Memory";
+		tableBody( 1, NumRows ) = MegaBytes( MemoryReport::InitProcessBytes );
+		tableBody( 2, NumRows ) = MegaBytes( MemoryReport::PeakProcessBytes );
+
+		WriteTable( tableBody, rowHead, columnHead, columnWidth );
+		if ( sqlite ) {
+			sqlite->createSQLiteTabularDataRecords( tableBody, rowHead, columnHead, "MemoryUsageSummary", "Entire Facility", "Memory of the Main Arrays by Module" );
+		}
+
+	}
+
 	void
 	WritePredefinedTables()
 	{
@@ -10515,10 +10705,13 @@ namespace OutputReportTabular {
 			//  feneSolarInstantSeq = 0.0d0
 			feneSolarRadSeq.allocate( TotDesDays + TotRunDesPersDays, NumOfTimeStepInHour * 24, TotSurfaces );
 			feneSolarRadSeq = 0.0;
-			feneSolarDelaySeq.allocate( TotDesDays + TotRunDesPersDays, NumOfTimeStepInHour * 24, TotSurfaces );
+			feneSolarDelaySeq.allocate( TotDesDays + TotRunDesPersDays, NumOfTimeStepInHour * 24, NumOfZones );
 			feneSolarDelaySeq = 0.0;
-			surfDelaySeq.allocate( TotDesDays + TotRunDesPersDays, NumOfTimeStepInHour * 24, TotSurfaces );
-			surfDelaySeq = 0.0;
+			//only the design day selected for the zone of each surface is kept
+			surfDelaySeqCool.allocate( NumOfTimeStepInHour * 24, TotSurfaces );
+			surfDelaySeqCool = 0.0;
+			surfDelaySeqHeat.allocate( NumOfTimeStepInHour * 24, TotSurfaces );
+			surfDelaySeqHeat = 0.0;
 			DoAllocate = false;
 		}
 	}
@@ -10567,10 +10760,16 @@ namespace OutputReportTabular {
 		radiantPulseUsed.deallocate();
 		radiantPulseTimestep.deallocate();
 		radiantPulseReceived.deallocate();
-		//need for reporting  DEALLOCATE(loadConvectedNormal)
+		loadConvectedNormal.deallocate();
 		loadConvectedWithPulse.deallocate();
 		//need for reporting  DEALLOCATE(decayCurveCool)
 		//need for reporting  DEALLOCATE(decayCurveHeat)
+		// the surface sequences of every design day are only needed for the delayed components,
+		// which are computed before this, so they are not kept through the rest of the run
+		netSurfRadSeq.deallocate();
+		ITABSFseq.deallocate();
+		lightSWRadSeq.deallocate();
+		feneSolarRadSeq.deallocate();
 	}
 
 	void
@@ -10840,6 +11039,11 @@ namespace OutputReportTabular {
 		//   which allocates the total radiant to each surface in the zone. The
 		//   formula used is:
 		//       QRadThermInAbs(SurfNum) = QL(NZ) * TMULT(NZ) * ITABSF(SurfNum)
+		//   This is done once zone sizing is complete, so that the sequences of each
+		//   surface for every design day need not be kept until the report is written.
+		//   The delayed convection of each surface is kept only for the design days
+		//   selected for its zone; when one design day is selected for both heating and
+		//   cooling the cooling results are the ones kept for that day, as before.
 
 		// REFERENCES:
 		// na
@@ -10974,7 +11178,7 @@ namespace OutputReportTabular {
 								// determine the remaining convective heat from the surfaces that are not based
 								// on any of these other loads
 								//negative because heat from surface should be positive
-								surfDelaySeq( desSelected, kTimeStep, jSurf ) = -loadConvectedNormal( desSelected, kTimeStep, jSurf ) - netSurfRadSeq( desSelected, kTimeStep, jSurf ) - ( peopleConvFromSurf + equipConvFromSurf + hvacLossConvFromSurf + powerGenConvFromSurf + lightLWConvFromSurf + lightSWConvFromSurf + feneSolarConvFromSurf ); //remove net radiant for the surface
+								( isCooling ? surfDelaySeqCool : surfDelaySeqHeat )( kTimeStep, jSurf ) = -loadConvectedNormal( desSelected, kTimeStep, jSurf ) - netSurfRadSeq( desSelected, kTimeStep, jSurf ) - ( peopleConvFromSurf + equipConvFromSurf + hvacLossConvFromSurf + powerGenConvFromSurf + lightLWConvFromSurf + lightSWConvFromSurf + feneSolarConvFromSurf ); //remove net radiant for the surface
 								// also remove the net radiant component on the instanteous conduction for fenestration
 								if ( Surface( jSurf ).Class == SurfaceClass_Window ) {
 									adjFeneSurfNetRadSeq += netSurfRadSeq( desSelected, kTimeStep, jSurf );
@@ -11155,7 +11359,6 @@ namespace OutputReportTabular {
 		Array2D_string tableBody;
 
 		if ( displayZoneComponentLoadSummary && CompLoadReportIsReq ) {
-			ComputeDelayedComponents();
 			NumOfTimeStepInDay = NumOfTimeStepInHour * 24;
 			seqData.allocate( NumOfTimeStepInDay );
 			AvgData.allocate( NumOfTimeStepInDay );
@@ -11435,7 +11638,7 @@ namespace OutputReportTabular {
 									curExtBoundCond = Ground;
 								}
 							}
-							seqData = surfDelaySeq( CoolDesSelected, _, kSurf );
+							seqData = surfDelaySeqCool( _, kSurf );
 							MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
 							singleSurfDelay = AvgData( timeCoolMax ) * powerConversion;
 							{ auto const SELECT_CASE_var( Surface( kSurf ).Class );
@@ -11907,7 +12110,11 @@ namespace OutputReportTabular {
 									curExtBoundCond = Ground;
 								}
 							}
-							seqData = surfDelaySeq( HeatDesSelected, _, kSurf );
+							if ( HeatDesSelected == CalcFinalZoneSizing( iZone ).CoolDDNum ) {
+								seqData = surfDelaySeqCool( _, kSurf );
+							} else {
+								seqData = surfDelaySeqHeat( _, kSurf );
+							}
 							MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
 							singleSurfDelay = AvgData( timeHeatMax ) * powerConversion;
 							{ auto const SELECT_CASE_var( Surface( kSurf ).Class );
@@ -12471,15 +12678,18 @@ namespace OutputReportTabular {
 				for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
 					outputLine = curDel; // one leading delimiters on column header lines
 					for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-						outputLine += curDel + stripped( colLabelMulti( iCol, jRow ) );
+						outputLine += curDel;
+						outputLine += stripped( colLabelMulti( iCol, jRow ) );
 					}
 					tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
 				}
 				// body with row headers
 				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					outputLine = curDel + rowLabels( jRow ); // one leading delimiters on table body lines
+					outputLine = curDel; // one leading delimiters on table body lines
+					outputLine += rowLabels( jRow );
 					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						outputLine += curDel + stripped( body( iCol, jRow ) );
+						outputLine += curDel;
+						outputLine += stripped( body( iCol, jRow ) );
 					}
 					tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
 				}
@@ -12510,10 +12720,11 @@ namespace OutputReportTabular {
 					//col1start = max( len( outputLine ) + 2u, maxWidthRowLabel + 2u );
 					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
 						if ( iCol != 1 ) {
-							outputLine += "  " + rjustified( sized( body( iCol, jRow ), widthColumn( iCol ) ) );
+							outputLine += "  ";
 						} else {
-							outputLine += "   " + rjustified( sized( body( iCol, jRow ), widthColumn( iCol ) ) );
+							outputLine += "   ";
 						}
+						outputLine += rjustified( sized( body( iCol, jRow ), widthColumn( iCol ) ) );
 					}
 					tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
 				}
@@ -13164,6 +13375,9 @@ namespace OutputReportTabular {
 		// USE STATEMENTS:
 		// na
 
+		// Using/Aliasing
+		using General::FormatFixed;
+
 		// Return value
 		std::string StringOut;
 
@@ -13171,7 +13385,6 @@ namespace OutputReportTabular {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static Array1D< gio::Fmt > formDigits( {0,9}, { "(F12.0)", "(F12.1)", "(F12.2)", "(F12.3)", "(F12.4)", "(F12.5)", "(F12.6)", "(F12.7)", "(F12.8)", "(F12.9)" } ); // formDigits(0) | formDigits(1) | formDigits(2) | formDigits(3) | formDigits(4) | formDigits(5) | formDigits(6) | formDigits(7) | formDigits(8) | formDigits(9)
 		static Array1D< Real64 > const maxvalDigits( {0,9}, { 9999999999.0, 999999999.0, 99999999.0, 9999999.0, 999999.0, 99999.0, 9999.0, 999.0, 99.0, 9.0 } ); // maxvalDigits(0) | maxvalDigits(1) | maxvalDigits(2) | maxvalDigits(3) | maxvalDigits(4) | maxvalDigits(5) | maxvalDigits(6) | maxvalDigits(7) | maxvalDigits(8) | maxvalDigits(9)
 		static gio::Fmt fmtd( "(E12.6)" );
 
@@ -13191,8 +13404,10 @@ namespace OutputReportTabular {
 
 		if ( std::abs( RealIn ) > maxvalDigits( nDigits ) ) {
 			gio::write( StringOut, fmtd ) << RealIn;
-		} else {
-			gio::write( StringOut, formDigits( nDigits ) ) << RealIn;
+		} else { // F12.nDigits
+			char Buffer[ 16 ];
+			FormatFixed( Buffer, RealIn, 12, nDigits );
+			StringOut = Buffer;
 		}
 		//  WRITE(FMT=, UNIT=stringOut) RealIn
 		// check if it did not fit
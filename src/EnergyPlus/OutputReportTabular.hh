@@ -287,7 +287,8 @@ namespace OutputReportTabular {
 	extern Array3D< Real64 > feneSolarRadSeq;
 	extern Array3D< Real64 > feneSolarDelaySeq;
 
-	extern Array3D< Real64 > surfDelaySeq;
+	extern Array2D< Real64 > surfDelaySeqCool; // delayed convection of each surface on the cooling design day of its zone
+	extern Array2D< Real64 > surfDelaySeqHeat; // delayed convection of each surface on the heating design day of its zone
 
 	extern int maxUniqueKeyCount;
 
@@ -878,6 +879,12 @@ namespace OutputReportTabular {
 	void
 	WriteAdaptiveComfortTable();
 
+	void
+	WriteComponentRuntimeTable();
+
+	void
+	WriteMemoryUsageTable();
+
 	void
 	WritePredefinedTables();
 
@@ -0,0 +1,208 @@
+// C++ Headers
+#include <utility>
+
+// EnergyPlus Headers
+#include <OutputWriterThread.hh>
+
+namespace EnergyPlus {
+
+namespace OutputWriterThread {
+
+	// PURPOSE OF THIS MODULE:
+	// Moves the writing of the large text outputs (eso, mtr and tabular files) off the simulation
+	// thread, so a slow file system does not hold up the simulation at each reporting interval.
+
+	// METHODOLOGY EMPLOYED:
+	// The lines are still formatted where they are now, but the stream they go to is given an
+	// OutputWriterBuffer in place of its file buffer.  The characters are collected into blocks
+	// and a full block is queued for a thread that writes it to the file buffer.  Handing over a
+	// block is the only point where the threads meet, so the lock is taken once per block and
+	// not once per record.  A flush of the stream waits until all queued blocks are written;
+	// stopping the writer does the same and gives the stream its file buffer back, which must
+	// happen before the file is closed.
+
+	// REFERENCES: na
+
+	// OTHER NOTES: na
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	std::size_t const BlockSize( 256 * 1024 ); // Characters collected before a block is handed to the writer thread
+	std::size_t const MaxQueuedBlocks( 64 ); // The simulation waits when this many blocks are not yet written
+
+	// Object Data
+	std::map< std::ostream *, std::unique_ptr< OutputWriterBuffer > > WriterBuffers; // Streams written from a writer thread
+
+	// Functions
+
+	OutputWriterBuffer::OutputWriterBuffer( std::streambuf * Target ) :
+		Target( Target ),
+		Busy( false ),
+		Stop( false )
+	{
+		Block.resize( BlockSize );
+		setp( Block.data(), Block.data() + Block.size() );
+		Writer = std::thread( &OutputWriterBuffer::run, this );
+	}
+
+	OutputWriterBuffer::~OutputWriterBuffer()
+	{
+		drain();
+		{
+			std::lock_guard< std::mutex > lock( Mutex );
+			Stop = true;
+		}
+		Condition.notify_all();
+		Writer.join();
+		Target->pubsync();
+	}
+
+	OutputWriterBuffer::int_type
+	OutputWriterBuffer::overflow( int_type c )
+	{
+		handOff();
+		if ( ! traits_type::eq_int_type( c, traits_type::eof() ) ) {
+			*pptr() = traits_type::to_char_type( c );
+			pbump( 1 );
+		}
+		return traits_type::not_eof( c );
+	}
+
+	int
+	OutputWriterBuffer::sync()
+	{
+		drain();
+		return Target->pubsync();
+	}
+
+	void
+	OutputWriterBuffer::handOff()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Queues the block being filled for the writer thread and starts a new one.
+
+		std::size_t const Used( pptr() - pbase() );
+		if ( Used == 0 ) return;
+		Block.resize( Used );
+		{
+			std::unique_lock< std::mutex > lock( Mutex );
+			Condition.wait( lock, [this]{ return Queue.size() < MaxQueuedBlocks; } );
+			Queue.push_back( std::move( Block ) );
+			if ( Spare.empty() ) {
+				Block = std::vector< char >();
+			} else {
+				Block = std::move( Spare.back() );
+				Spare.pop_back();
+			}
+		}
+		Condition.notify_all();
+		Block.resize( BlockSize );
+		setp( Block.data(), Block.data() + Block.size() );
+
+	}
+
+	void
+	OutputWriterBuffer::drain()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Queues the partial block and waits until the writer thread has written everything.
+
+		handOff();
+		std::unique_lock< std::mutex > lock( Mutex );
+		Condition.wait( lock, [this]{ return Queue.empty() && ! Busy; } );
+
+	}
+
+	void
+	OutputWriterBuffer::run()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Body of the writer thread: writes the queued blocks in order until stopped.
+
+		std::unique_lock< std::mutex > lock( Mutex );
+		while ( true ) {
+			Condition.wait( lock, [this]{ return Stop || ! Queue.empty(); } );
+			if ( Queue.empty() ) break; // Stopped with nothing left to write
+			std::vector< char > Full( std::move( Queue.front() ) );
+			Queue.pop_front();
+			Busy = true;
+			lock.unlock();
+			Target->sputn( Full.data(), Full.size() );
+			lock.lock();
+			Spare.push_back( std::move( Full ) );
+			Busy = false;
+			Condition.notify_all();
+		}
+
+	}
+
+	void
+	StartOutputWriter( std::ostream * Stream )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Has the output to the stream written from a writer thread.
+
+		if ( ! Stream || WriterBuffers.count( Stream ) != 0 ) return;
+		std::unique_ptr< OutputWriterBuffer > Buffer( new OutputWriterBuffer( Stream->rdbuf() ) );
+		Stream->rdbuf( Buffer.get() );
+		WriterBuffers[ Stream ] = std::move( Buffer );
+
+	}
+
+	void
+	StopOutputWriter( std::ostream * Stream )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes what is still queued for the stream and gives it its own buffer back.
+
+		auto const Found( WriterBuffers.find( Stream ) );
+		if ( Found == WriterBuffers.end() ) return;
+		Stream->rdbuf( Found->second->target() );
+		WriterBuffers.erase( Found ); // The destructor writes the rest
+
+	}
+
+	void
+	StopAllOutputWriters()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stops the writer of every stream, before the files are closed at the end of a run.
+
+		while ( ! WriterBuffers.empty() ) {
+			StopOutputWriter( WriterBuffers.begin()->first );
+		}
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // OutputWriterThread
+
+} // EnergyPlus
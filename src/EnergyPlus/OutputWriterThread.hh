@@ -0,0 +1,115 @@
+#ifndef OutputWriterThread_hh_INCLUDED
+#define OutputWriterThread_hh_INCLUDED
+
+// C++ Headers
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace OutputWriterThread {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern std::size_t const BlockSize; // Characters collected before a block is handed to the writer thread
+	extern std::size_t const MaxQueuedBlocks; // The simulation waits when this many blocks are not yet written
+
+	// Types
+
+	class OutputWriterBuffer : public std::streambuf
+	{
+		// Stream buffer that collects the formatted output into blocks and writes them to the
+		// original buffer of the stream from its own thread.
+
+	public:
+		explicit
+		OutputWriterBuffer( std::streambuf * Target );
+
+		~OutputWriterBuffer();
+
+		std::streambuf *
+		target() const
+		{
+			return Target;
+		}
+
+	protected:
+		int_type
+		overflow( int_type c );
+
+		int
+		sync();
+
+	private:
+		void
+		handOff();
+
+		void
+		drain();
+
+		void
+		run();
+
+		std::streambuf * Target; // Buffer the stream had before
+		std::vector< char > Block; // Block being filled
+		std::deque< std::vector< char > > Queue; // Blocks to write, guarded by Mutex
+		std::vector< std::vector< char > > Spare; // Written blocks kept for reuse, guarded by Mutex
+		bool Busy; // Writer thread is writing a block, guarded by Mutex
+		bool Stop; // Guarded by Mutex
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		std::thread Writer;
+	};
+
+	// Object Data
+	extern std::map< std::ostream *, std::unique_ptr< OutputWriterBuffer > > WriterBuffers; // Streams written from a writer thread
+
+	// Functions
+
+	void
+	StartOutputWriter( std::ostream * Stream );
+
+	void
+	StopOutputWriter( std::ostream * Stream );
+
+	void
+	StopAllOutputWriters();
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // OutputWriterThread
+
+} // EnergyPlus
+
+#endif
@@ -1,6 +1,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <initializer_list>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -712,12 +713,70 @@ namespace Photovoltaics {
 
 		}
 
+		// Group the equivalent one-diode and Sandia generators that share the module model
+		for ( PVnum = 1; PVnum <= NumPVs; ++PVnum ) {
+			if ( ( PVarray( PVnum ).PVModelType != iTRNSYSPVModel ) && ( PVarray( PVnum ).PVModelType != iSandiaPVModel ) ) continue;
+			int GroupNum( 0 );
+			for ( int Group = 1, Groups = PVModuleGroups.isize(); Group <= Groups; ++Group ) {
+				if ( ( PVModuleGroups( Group ).PVModelType == PVarray( PVnum ).PVModelType ) && ( PVModuleGroups( Group ).CellIntegrationMode == PVarray( PVnum ).CellIntegrationMode ) && ( PVModuleGroups( Group ).PerfObjName == PVarray( PVnum ).PerfObjName ) ) {
+					GroupNum = Group;
+					break;
+				}
+			}
+			if ( GroupNum == 0 ) {
+				GroupNum = PVModuleGroups.isize() + 1;
+				PVModuleGroups.redimension( GroupNum );
+				PVModuleGroups( GroupNum ).PVModelType = PVarray( PVnum ).PVModelType;
+				PVModuleGroups( GroupNum ).CellIntegrationMode = PVarray( PVnum ).CellIntegrationMode;
+				PVModuleGroups( GroupNum ).PerfObjName = PVarray( PVnum ).PerfObjName;
+			}
+			PVarray( PVnum ).ModuleGroup = GroupNum;
+		}
+
 		if ( ErrorsFound ) {
 			ShowFatalError( "Errors found in getting photovoltaic input" );
 		}
 
 	}
 
+	bool
+	MatchModuleGroupConditions(
+		int const GroupNum, // index in PVModuleGroups
+		std::initializer_list< Real64 > const Conditions // Inputs of the module model for the current generator
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the module results kept for the group were found at these conditions, so
+		// the current generator can use them instead of evaluating the module model.  Otherwise the
+		// conditions are kept and the caller stores the module results it finds for them.
+
+		// METHODOLOGY EMPLOYED:
+		// The conditions must be equal, so the results are the ones the model would give.  Large
+		// arrays of like generators with the same orientation are evaluated once per time step.
+
+		auto & group( PVModuleGroups( GroupNum ) );
+		int const NumConditions( Conditions.size() );
+		if ( group.Evaluated && ( group.Conditions.isize() == NumConditions ) ) {
+			int i( 1 );
+			bool Same( true );
+			for ( Real64 const Condition : Conditions ) {
+				if ( Condition != group.Conditions( i++ ) ) {
+					Same = false;
+					break;
+				}
+			}
+			if ( Same ) return true;
+		}
+
+		if ( group.Conditions.isize() != NumConditions ) group.Conditions.dimension( NumConditions );
+		int i( 1 );
+		for ( Real64 const Condition : Conditions ) group.Conditions( i++ ) = Condition;
+		group.Evaluated = false;
+		return false;
+
+	}
+
 	// **************************************
 
 	void
@@ -986,45 +1045,58 @@ namespace Photovoltaics {
 
 			}}
 
-			// Calculate Air Mass function
-			PVarray( PVnum ).SNLPVCalc.AMa = AbsoluteAirMass( PVarray( PVnum ).SNLPVinto.ZenithAngle, PVarray( PVnum ).SNLPVinto.Altitude );
+			// Generators of a module group at the same conditions have the same module results
+			int const GroupNum( PVarray( PVnum ).ModuleGroup );
+			if ( ( GroupNum > 0 ) && MatchModuleGroupConditions( GroupNum, { PVarray( PVnum ).SNLPVinto.IcBeam, PVarray( PVnum ).SNLPVinto.IcDiffuse, PVarray( PVnum ).SNLPVinto.IncidenceAngle, PVarray( PVnum ).SNLPVinto.ZenithAngle, PVarray( PVnum ).SNLPVinto.Altitude, PVarray( PVnum ).SNLPVCalc.Tcell } ) ) {
+				Real64 const Tback( PVarray( PVnum ).SNLPVCalc.Tback ); // Not a condition of the rest of the model
+				PVarray( PVnum ).SNLPVCalc = PVModuleGroups( GroupNum ).SNLPVCalc;
+				PVarray( PVnum ).SNLPVCalc.Tback = Tback;
+			} else {
+				// Calculate Air Mass function
+				PVarray( PVnum ).SNLPVCalc.AMa = AbsoluteAirMass( PVarray( PVnum ).SNLPVinto.ZenithAngle, PVarray( PVnum ).SNLPVinto.Altitude );
+
+				// Calculate F1 polynomial function:
+				PVarray( PVnum ).SNLPVCalc.F1 = SandiaF1( PVarray( PVnum ).SNLPVCalc.AMa, PVarray( PVnum ).SNLPVModule.a_0, PVarray( PVnum ).SNLPVModule.a_1, PVarray( PVnum ).SNLPVModule.a_2, PVarray( PVnum ).SNLPVModule.a_3, PVarray( PVnum ).SNLPVModule.a_4 );
 
-			// Calculate F1 polynomial function:
-			PVarray( PVnum ).SNLPVCalc.F1 = SandiaF1( PVarray( PVnum ).SNLPVCalc.AMa, PVarray( PVnum ).SNLPVModule.a_0, PVarray( PVnum ).SNLPVModule.a_1, PVarray( PVnum ).SNLPVModule.a_2, PVarray( PVnum ).SNLPVModule.a_3, PVarray( PVnum ).SNLPVModule.a_4 );
+				// Calculate F2 polynomial function:
+				PVarray( PVnum ).SNLPVCalc.F2 = SandiaF2( PVarray( PVnum ).SNLPVinto.IncidenceAngle, PVarray( PVnum ).SNLPVModule.b_0, PVarray( PVnum ).SNLPVModule.b_1, PVarray( PVnum ).SNLPVModule.b_2, PVarray( PVnum ).SNLPVModule.b_3, PVarray( PVnum ).SNLPVModule.b_4, PVarray( PVnum ).SNLPVModule.b_5 );
 
-			// Calculate F2 polynomial function:
-			PVarray( PVnum ).SNLPVCalc.F2 = SandiaF2( PVarray( PVnum ).SNLPVinto.IncidenceAngle, PVarray( PVnum ).SNLPVModule.b_0, PVarray( PVnum ).SNLPVModule.b_1, PVarray( PVnum ).SNLPVModule.b_2, PVarray( PVnum ).SNLPVModule.b_3, PVarray( PVnum ).SNLPVModule.b_4, PVarray( PVnum ).SNLPVModule.b_5 );
+				// Calculate short-circuit current function:
+				PVarray( PVnum ).SNLPVCalc.Isc = SandiaIsc( PVarray( PVnum ).SNLPVCalc.Tcell, PVarray( PVnum ).SNLPVModule.Isc0, PVarray( PVnum ).SNLPVinto.IcBeam, PVarray( PVnum ).SNLPVinto.IcDiffuse, PVarray( PVnum ).SNLPVCalc.F1, PVarray( PVnum ).SNLPVCalc.F2, PVarray( PVnum ).SNLPVModule.fd, PVarray( PVnum ).SNLPVModule.aIsc );
 
-			// Calculate short-circuit current function:
-			PVarray( PVnum ).SNLPVCalc.Isc = SandiaIsc( PVarray( PVnum ).SNLPVCalc.Tcell, PVarray( PVnum ).SNLPVModule.Isc0, PVarray( PVnum ).SNLPVinto.IcBeam, PVarray( PVnum ).SNLPVinto.IcDiffuse, PVarray( PVnum ).SNLPVCalc.F1, PVarray( PVnum ).SNLPVCalc.F2, PVarray( PVnum ).SNLPVModule.fd, PVarray( PVnum ).SNLPVModule.aIsc );
+				// Calculate effective irradiance function:
+				Ee = SandiaEffectiveIrradiance( PVarray( PVnum ).SNLPVCalc.Tcell, PVarray( PVnum ).SNLPVCalc.Isc, PVarray( PVnum ).SNLPVModule.Isc0, PVarray( PVnum ).SNLPVModule.aIsc );
+				// Calculate Imp function:
+				PVarray( PVnum ).SNLPVCalc.Imp = SandiaImp( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Imp0, PVarray( PVnum ).SNLPVModule.aImp, PVarray( PVnum ).SNLPVModule.c_0, PVarray( PVnum ).SNLPVModule.c_1 );
 
-			// Calculate effective irradiance function:
-			Ee = SandiaEffectiveIrradiance( PVarray( PVnum ).SNLPVCalc.Tcell, PVarray( PVnum ).SNLPVCalc.Isc, PVarray( PVnum ).SNLPVModule.Isc0, PVarray( PVnum ).SNLPVModule.aIsc );
-			// Calculate Imp function:
-			PVarray( PVnum ).SNLPVCalc.Imp = SandiaImp( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Imp0, PVarray( PVnum ).SNLPVModule.aImp, PVarray( PVnum ).SNLPVModule.c_0, PVarray( PVnum ).SNLPVModule.c_1 );
+				// Calculate Voc function:
+				PVarray( PVnum ).SNLPVCalc.Voc = SandiaVoc( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Voc0, PVarray( PVnum ).SNLPVModule.NcellSer, PVarray( PVnum ).SNLPVModule.DiodeFactor, PVarray( PVnum ).SNLPVModule.BVoc0, PVarray( PVnum ).SNLPVModule.mBVoc );
 
-			// Calculate Voc function:
-			PVarray( PVnum ).SNLPVCalc.Voc = SandiaVoc( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Voc0, PVarray( PVnum ).SNLPVModule.NcellSer, PVarray( PVnum ).SNLPVModule.DiodeFactor, PVarray( PVnum ).SNLPVModule.BVoc0, PVarray( PVnum ).SNLPVModule.mBVoc );
+				// Calculate Vmp: voltagea at maximum powerpoint
+				PVarray( PVnum ).SNLPVCalc.Vmp = SandiaVmp( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Vmp0, PVarray( PVnum ).SNLPVModule.NcellSer, PVarray( PVnum ).SNLPVModule.DiodeFactor, PVarray( PVnum ).SNLPVModule.BVmp0, PVarray( PVnum ).SNLPVModule.mBVmp, PVarray( PVnum ).SNLPVModule.c_2, PVarray( PVnum ).SNLPVModule.c_3 );
 
-			// Calculate Vmp: voltagea at maximum powerpoint
-			PVarray( PVnum ).SNLPVCalc.Vmp = SandiaVmp( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Vmp0, PVarray( PVnum ).SNLPVModule.NcellSer, PVarray( PVnum ).SNLPVModule.DiodeFactor, PVarray( PVnum ).SNLPVModule.BVmp0, PVarray( PVnum ).SNLPVModule.mBVmp, PVarray( PVnum ).SNLPVModule.c_2, PVarray( PVnum ).SNLPVModule.c_3 );
+				// Calculate Ix function:
+				PVarray( PVnum ).SNLPVCalc.Ix = SandiaIx( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Ix0, PVarray( PVnum ).SNLPVModule.aIsc, PVarray( PVnum ).SNLPVModule.aImp, PVarray( PVnum ).SNLPVModule.c_4, PVarray( PVnum ).SNLPVModule.c_5 );
 
-			// Calculate Ix function:
-			PVarray( PVnum ).SNLPVCalc.Ix = SandiaIx( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Ix0, PVarray( PVnum ).SNLPVModule.aIsc, PVarray( PVnum ).SNLPVModule.aImp, PVarray( PVnum ).SNLPVModule.c_4, PVarray( PVnum ).SNLPVModule.c_5 );
+				// Calculate Vx function:
+				PVarray( PVnum ).SNLPVCalc.Vx = PVarray( PVnum ).SNLPVCalc.Voc / 2.0;
 
-			// Calculate Vx function:
-			PVarray( PVnum ).SNLPVCalc.Vx = PVarray( PVnum ).SNLPVCalc.Voc / 2.0;
+				// Calculate Ixx function:
+				PVarray( PVnum ).SNLPVCalc.Ixx = SandiaIxx( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Ixx0, PVarray( PVnum ).SNLPVModule.aImp, PVarray( PVnum ).SNLPVModule.c_6, PVarray( PVnum ).SNLPVModule.c_7 );
+				// Calculate Vxx :
+				PVarray( PVnum ).SNLPVCalc.Vxx = 0.5 * ( PVarray( PVnum ).SNLPVCalc.Voc + PVarray( PVnum ).SNLPVCalc.Vmp );
 
-			// Calculate Ixx function:
-			PVarray( PVnum ).SNLPVCalc.Ixx = SandiaIxx( PVarray( PVnum ).SNLPVCalc.Tcell, Ee, PVarray( PVnum ).SNLPVModule.Ixx0, PVarray( PVnum ).SNLPVModule.aImp, PVarray( PVnum ).SNLPVModule.c_6, PVarray( PVnum ).SNLPVModule.c_7 );
-			// Calculate Vxx :
-			PVarray( PVnum ).SNLPVCalc.Vxx = 0.5 * ( PVarray( PVnum ).SNLPVCalc.Voc + PVarray( PVnum ).SNLPVCalc.Vmp );
+				// Calculate Pmp, single module: power at maximum powerpoint
+				PVarray( PVnum ).SNLPVCalc.Pmp = PVarray( PVnum ).SNLPVCalc.Imp * PVarray( PVnum ).SNLPVCalc.Vmp; // W
 
-			// Calculate Pmp, single module: power at maximum powerpoint
-			PVarray( PVnum ).SNLPVCalc.Pmp = PVarray( PVnum ).SNLPVCalc.Imp * PVarray( PVnum ).SNLPVCalc.Vmp; // W
+				// Calculate PV efficiency at maximum power point
+				PVarray( PVnum ).SNLPVCalc.EffMax = PVarray( PVnum ).SNLPVCalc.Pmp / ( PVarray( PVnum ).SNLPVinto.IcBeam + PVarray( PVnum ).SNLPVinto.IcDiffuse ) / PVarray( PVnum ).SNLPVModule.Acoll;
 
-			// Calculate PV efficiency at maximum power point
-			PVarray( PVnum ).SNLPVCalc.EffMax = PVarray( PVnum ).SNLPVCalc.Pmp / ( PVarray( PVnum ).SNLPVinto.IcBeam + PVarray( PVnum ).SNLPVinto.IcDiffuse ) / PVarray( PVnum ).SNLPVModule.Acoll;
+				if ( GroupNum > 0 ) {
+					PVModuleGroups( GroupNum ).SNLPVCalc = PVarray( PVnum ).SNLPVCalc;
+					PVModuleGroups( GroupNum ).Evaluated = true;
+				}
+			}
 
 			// Scale to NumStrings and NumSeries:
 			PVarray( PVnum ).SNLPVCalc.Pmp *= PVarray( PVnum ).NumSeriesNParall * PVarray( PVnum ).NumModNSeries;
@@ -1150,7 +1222,9 @@ namespace Photovoltaics {
 			PVarray( PVnum ).TRNSYSPVcalc.TimeElapsed = TimeElapsed;
 		}
 
-		if ( any_gt( QRadSWOutIncident, 0.0 ) ) {
+		// Only positive insolation is used (CalcTRNSYSPV zeroes it below MinInsolation), so the test of
+		// the other surfaces for any incident solar is not needed
+		if ( QRadSWOutIncident( PVarray( PVnum ).SurfacePtr ) > 0.0 ) {
 			//  Determine the amount of radiation incident on each PV
 			PVarray( PVnum ).TRNSYSPVcalc.Insolation = QRadSWOutIncident( PVarray( PVnum ).SurfacePtr ); //[W/m2]
 		} else {
@@ -1261,76 +1335,117 @@ namespace Photovoltaics {
 
 		if ( ( PVarray( PVnum ).TRNSYSPVcalc.Insolation > MinInsolation ) && ( RunFlag ) ) {
 
-			// set initial values for eta iteration loop
-			DummyErr = 2.0 * ERR;
-			CC = 1;
-			EtaOld = EtaIni;
-
-			// Begin DO WHILE loop - until the error tolerance is reached.
-			ETA = 0.0;
-			while ( DummyErr > ERR ) {
-
-				{ auto const SELECT_CASE_var( PVarray( PVnum ).CellIntegrationMode );
-				if ( SELECT_CASE_var == iDecoupledCellIntegration ) {
-					//  cell temperature based on energy balance
-					PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef = PVarray( PVnum ).TRNSYSPVModule.TauAlpha * PVarray( PVnum ).TRNSYSPVModule.NOCTInsolation / ( PVarray( PVnum ).TRNSYSPVModule.NOCTCellTemp - PVarray( PVnum ).TRNSYSPVModule.NOCTAmbTemp );
-					CellTemp = Tambient + ( PVarray( PVnum ).TRNSYSPVcalc.Insolation * PVarray( PVnum ).TRNSYSPVModule.TauAlpha / PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef ) * ( 1.0 - ETA / PVarray( PVnum ).TRNSYSPVModule.TauAlpha );
-				} else if ( SELECT_CASE_var == iDecoupledUllebergDynamicCellIntegration ) {
-					//  cell temperature based on energy balance with thermal capacity effects
-					CellTemp = Tambient + ( PVarray( PVnum ).TRNSYSPVcalc.LastCellTempK - Tambient ) * std::exp( -PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef / PVarray( PVnum ).TRNSYSPVModule.HeatCapacity * PVTimeStep ) + ( PVarray( PVnum ).TRNSYSPVModule.TauAlpha - ETA ) * PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef * ( 1.0 - std::exp( -PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef / PVarray( PVnum ).TRNSYSPVModule.HeatCapacity * PVTimeStep ) );
-				} else if ( SELECT_CASE_var == iSurfaceOutsideFaceCellIntegration ) {
-					CellTemp = TempSurfOut( PVarray( PVnum ).SurfacePtr ) + KelvinConv;
-				} else if ( SELECT_CASE_var == iTranspiredCollectorCellIntegration ) {
-					GetUTSCTsColl( PVarray( PVnum ).UTSCPtr, CellTemp );
-					CellTemp += KelvinConv;
-				} else if ( SELECT_CASE_var == iExteriorVentedCavityCellIntegration ) {
-					GetExtVentedCavityTsColl( PVarray( PVnum ).ExtVentCavPtr, CellTemp );
-					CellTemp += KelvinConv;
-				} else if ( SELECT_CASE_var == iPVTSolarCollectorCellIntegration ) {
-					// get PVT model result for cell temp..
-				}}
-
-				//  reference parameters
-				ILRef = PVarray( PVnum ).TRNSYSPVModule.RefIsc;
-				AARef = ( PVarray( PVnum ).TRNSYSPVModule.TempCoefVoc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature - PVarray( PVnum ).TRNSYSPVModule.RefVoc + PVarray( PVnum ).TRNSYSPVModule.SemiConductorBandgap * PVarray( PVnum ).TRNSYSPVModule.CellsInSeries ) / ( PVarray( PVnum ).TRNSYSPVModule.TempCoefIsc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature / ILRef - 3.0 );
-				IORef = ILRef * std::exp( -PVarray( PVnum ).TRNSYSPVModule.RefVoc / AARef );
-
-				//  series resistance
-				SeriesResistance = ( AARef * std::log( 1.0 - PVarray( PVnum ).TRNSYSPVModule.Imp / ILRef ) - PVarray( PVnum ).TRNSYSPVModule.Vmp + PVarray( PVnum ).TRNSYSPVModule.RefVoc ) / PVarray( PVnum ).TRNSYSPVModule.Imp;
-
-				//  temperature depencence
-				IL = PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.RefInsolation * ( ILRef + PVarray( PVnum ).TRNSYSPVModule.TempCoefIsc * ( CellTemp - PVarray( PVnum ).TRNSYSPVModule.RefTemperature ) );
-				Real64 const cell_temp_ratio( CellTemp / PVarray( PVnum ).TRNSYSPVModule.RefTemperature );
-				AA = AARef * cell_temp_ratio;
-				IO = IORef * pow_3( cell_temp_ratio ) * std::exp( PVarray( PVnum ).TRNSYSPVModule.SemiConductorBandgap * PVarray( PVnum ).TRNSYSPVModule.CellsInSeries / AARef * ( 1.0 - PVarray( PVnum ).TRNSYSPVModule.RefTemperature / CellTemp ) );
-
-				//  compute short curcuit current and open circuit voltage
-
-				//   NEWTON --> ISC  (STARTVALUE: ISCG1 - BASED ON IL=ISC)
-				ISCG1 = IL;
-				NEWTON( ISC, FUN, FI, ISC, constant_zero, IO, IL, SeriesResistance, AA, ISCG1, EPS );
-
-				//   NEWTON --> VOC  (STARTVALUE: VOCG1 - BASED ON IM=0.0)
-				VOCG1 = ( std::log( IL / IO ) + 1.0 ) * AA;
-				NEWTON( VOC, FUN, FV, constant_zero, VOC, IO, IL, SeriesResistance, AA, VOCG1, EPS );
-
-				//  maximum power point tracking
-
-				//   SEARCH --> VM AT MAXIMUM POWER POINT
-				VLEFT = 0.0;
-				VRIGHT = VOC;
-				SEARCH( VLEFT, VRIGHT, VM, K, IO, IL, SeriesResistance, AA, EPS, KMAX );
-
-				//   POWER --> IM & PM AT MAXIMUM POWER POINT
-				POWER( IO, IL, SeriesResistance, AA, EPS, IM, VM, PM );
-
-				// calculate overall PV module efficiency
-				ETA = PM / PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.Area;
-				DummyErr = std::abs( ( ETA - EtaOld ) / EtaOld );
-				EtaOld = ETA;
-				++CC;
-
-			} // while
+			// The cell temperature input of the integration modes that take it from elsewhere, or from
+			// the previous time step
+			Real64 CellTempInput( 0.0 );
+			{ auto const SELECT_CASE_var( PVarray( PVnum ).CellIntegrationMode );
+			if ( SELECT_CASE_var == iDecoupledUllebergDynamicCellIntegration ) {
+				CellTempInput = PVarray( PVnum ).TRNSYSPVcalc.LastCellTempK;
+			} else if ( SELECT_CASE_var == iSurfaceOutsideFaceCellIntegration ) {
+				CellTempInput = TempSurfOut( PVarray( PVnum ).SurfacePtr );
+			} else if ( SELECT_CASE_var == iTranspiredCollectorCellIntegration ) {
+				GetUTSCTsColl( PVarray( PVnum ).UTSCPtr, CellTempInput );
+			} else if ( SELECT_CASE_var == iExteriorVentedCavityCellIntegration ) {
+				GetExtVentedCavityTsColl( PVarray( PVnum ).ExtVentCavPtr, CellTempInput );
+			}}
+
+			// Generators of a module group at the same conditions have the same module results
+			int const GroupNum( PVarray( PVnum ).ModuleGroup );
+			if ( ( GroupNum > 0 ) && MatchModuleGroupConditions( GroupNum, { PVarray( PVnum ).TRNSYSPVcalc.Insolation, Tambient, CellTempInput } ) ) {
+				auto const & group( PVModuleGroups( GroupNum ) );
+				ETA = group.ETA;
+				IM = group.IM;
+				VM = group.VM;
+				PM = group.PM;
+				ISC = group.ISC;
+				VOC = group.VOC;
+				CellTemp = group.CellTemp;
+				PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef = group.HeatLossCoef;
+			} else {
+				// set initial values for eta iteration loop
+				DummyErr = 2.0 * ERR;
+				CC = 1;
+				EtaOld = EtaIni;
+
+				// Begin DO WHILE loop - until the error tolerance is reached.
+				ETA = 0.0;
+				while ( DummyErr > ERR ) {
+
+					{ auto const SELECT_CASE_var( PVarray( PVnum ).CellIntegrationMode );
+					if ( SELECT_CASE_var == iDecoupledCellIntegration ) {
+						//  cell temperature based on energy balance
+						PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef = PVarray( PVnum ).TRNSYSPVModule.TauAlpha * PVarray( PVnum ).TRNSYSPVModule.NOCTInsolation / ( PVarray( PVnum ).TRNSYSPVModule.NOCTCellTemp - PVarray( PVnum ).TRNSYSPVModule.NOCTAmbTemp );
+						CellTemp = Tambient + ( PVarray( PVnum ).TRNSYSPVcalc.Insolation * PVarray( PVnum ).TRNSYSPVModule.TauAlpha / PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef ) * ( 1.0 - ETA / PVarray( PVnum ).TRNSYSPVModule.TauAlpha );
+					} else if ( SELECT_CASE_var == iDecoupledUllebergDynamicCellIntegration ) {
+						//  cell temperature based on energy balance with thermal capacity effects
+						CellTemp = Tambient + ( PVarray( PVnum ).TRNSYSPVcalc.LastCellTempK - Tambient ) * std::exp( -PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef / PVarray( PVnum ).TRNSYSPVModule.HeatCapacity * PVTimeStep ) + ( PVarray( PVnum ).TRNSYSPVModule.TauAlpha - ETA ) * PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef * ( 1.0 - std::exp( -PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef / PVarray( PVnum ).TRNSYSPVModule.HeatCapacity * PVTimeStep ) );
+					} else if ( SELECT_CASE_var == iSurfaceOutsideFaceCellIntegration ) {
+						CellTemp = TempSurfOut( PVarray( PVnum ).SurfacePtr ) + KelvinConv;
+					} else if ( SELECT_CASE_var == iTranspiredCollectorCellIntegration ) {
+						GetUTSCTsColl( PVarray( PVnum ).UTSCPtr, CellTemp );
+						CellTemp += KelvinConv;
+					} else if ( SELECT_CASE_var == iExteriorVentedCavityCellIntegration ) {
+						GetExtVentedCavityTsColl( PVarray( PVnum ).ExtVentCavPtr, CellTemp );
+						CellTemp += KelvinConv;
+					} else if ( SELECT_CASE_var == iPVTSolarCollectorCellIntegration ) {
+						// get PVT model result for cell temp..
+					}}
+
+					//  reference parameters
+					ILRef = PVarray( PVnum ).TRNSYSPVModule.RefIsc;
+					AARef = ( PVarray( PVnum ).TRNSYSPVModule.TempCoefVoc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature - PVarray( PVnum ).TRNSYSPVModule.RefVoc + PVarray( PVnum ).TRNSYSPVModule.SemiConductorBandgap * PVarray( PVnum ).TRNSYSPVModule.CellsInSeries ) / ( PVarray( PVnum ).TRNSYSPVModule.TempCoefIsc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature / ILRef - 3.0 );
+					IORef = ILRef * std::exp( -PVarray( PVnum ).TRNSYSPVModule.RefVoc / AARef );
+
+					//  series resistance
+					SeriesResistance = ( AARef * std::log( 1.0 - PVarray( PVnum ).TRNSYSPVModule.Imp / ILRef ) - PVarray( PVnum ).TRNSYSPVModule.Vmp + PVarray( PVnum ).TRNSYSPVModule.RefVoc ) / PVarray( PVnum ).TRNSYSPVModule.Imp;
+
+					//  temperature depencence
+					IL = PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.RefInsolation * ( ILRef + PVarray( PVnum ).TRNSYSPVModule.TempCoefIsc * ( CellTemp - PVarray( PVnum ).TRNSYSPVModule.RefTemperature ) );
+					Real64 const cell_temp_ratio( CellTemp / PVarray( PVnum ).TRNSYSPVModule.RefTemperature );
+					AA = AARef * cell_temp_ratio;
+					IO = IORef * pow_3( cell_temp_ratio ) * std::exp( PVarray( PVnum ).TRNSYSPVModule.SemiConductorBandgap * PVarray( PVnum ).TRNSYSPVModule.CellsInSeries / AARef * ( 1.0 - PVarray( PVnum ).TRNSYSPVModule.RefTemperature / CellTemp ) );
+
+					//  compute short curcuit current and open circuit voltage
+
+					//   NEWTON --> ISC  (STARTVALUE: ISCG1 - BASED ON IL=ISC)
+					ISCG1 = IL;
+					NEWTON( ISC, FUN, FI, ISC, constant_zero, IO, IL, SeriesResistance, AA, ISCG1, EPS );
+
+					//   NEWTON --> VOC  (STARTVALUE: VOCG1 - BASED ON IM=0.0)
+					VOCG1 = ( std::log( IL / IO ) + 1.0 ) * AA;
+					NEWTON( VOC, FUN, FV, constant_zero, VOC, IO, IL, SeriesResistance, AA, VOCG1, EPS );
+
+					//  maximum power point tracking
+
+					//   SEARCH --> VM AT MAXIMUM POWER POINT
+					VLEFT = 0.0;
+					VRIGHT = VOC;
+					SEARCH( VLEFT, VRIGHT, VM, K, IO, IL, SeriesResistance, AA, EPS, KMAX );
+
+					//   POWER --> IM & PM AT MAXIMUM POWER POINT
+					POWER( IO, IL, SeriesResistance, AA, EPS, IM, VM, PM );
+
+					// calculate overall PV module efficiency
+					ETA = PM / PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.Area;
+					DummyErr = std::abs( ( ETA - EtaOld ) / EtaOld );
+					EtaOld = ETA;
+					++CC;
+
+				} // while
+
+				if ( GroupNum > 0 ) {
+					auto & group( PVModuleGroups( GroupNum ) );
+					group.ETA = ETA;
+					group.IM = IM;
+					group.VM = VM;
+					group.PM = PM;
+					group.ISC = ISC;
+					group.VOC = VOC;
+					group.CellTemp = CellTemp;
+					group.HeatLossCoef = PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef;
+					group.Evaluated = true;
+				}
+			}
 
 		} else {
 			// if there is no incident radiation or if the control switch is 'Off'
@@ -3,6 +3,7 @@
 
 // C++ Headers
 #include <functional>
+#include <initializer_list>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -59,6 +60,12 @@ namespace Photovoltaics {
 	void
 	GetPVInput();
 
+	bool
+	MatchModuleGroupConditions(
+		int const GroupNum, // index in PVModuleGroups
+		std::initializer_list< Real64 > const Conditions // Inputs of the module model for the current generator
+	);
+
 	// **************************************
 
 	void
@@ -12,6 +12,7 @@
 #include <BranchNodeConnections.hh>
 #include <ConvectionCoefficients.hh>
 #include <DataEnvironment.hh>
+#include <DataErrorTracking.hh>
 #include <DataHeatBalance.hh>
 #include <DataHeatBalFanSys.hh>
 #include <DataHVACGlobals.hh>
@@ -160,6 +161,7 @@ namespace PipeHeatTransfer {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int InnerTimeStepCtr;
+		int ErrorCount; // warnings and severe errors before the calculations
 
 		// check for input
 		if ( GetPipeInputFlag ) {
@@ -190,14 +192,32 @@ namespace PipeHeatTransfer {
 		// initialize
 		InitPipesHeatTransfer( EquipType, PipeHTNum, FirstHVACIteration );
 		// make the calculations
-		for ( InnerTimeStepCtr = 1; InnerTimeStepCtr <= NumInnerTimeSteps; ++InnerTimeStepCtr ) {
-			{ auto const SELECT_CASE_var( PipeHT( PipeHTNum ).EnvironmentPtr );
-			if ( SELECT_CASE_var == GroundEnv ) {
-				CalcBuriedPipeSoil( PipeHTNum );
+		if ( PipeHT( PipeHTNum ).ReuseResults ) {
+			// the tentative temperatures are still those of the last call, which had the same inputs
+			OutletTemp = PipeHT( PipeHTNum ).LastOutletTemp;
+			EnvHeatLossRate = PipeHT( PipeHTNum ).LastEnvHeatLossRate;
+			FluidHeatLossRate = PipeHT( PipeHTNum ).LastFluidHeatLossRate;
+			EnvironmentTemp = PipeHT( PipeHTNum ).LastEnvironmentTempOut;
+		} else {
+			ErrorCount = DataErrorTracking::TotalWarningErrors + DataErrorTracking::TotalSevereErrors;
+			for ( InnerTimeStepCtr = 1; InnerTimeStepCtr <= NumInnerTimeSteps; ++InnerTimeStepCtr ) {
+				{ auto const SELECT_CASE_var( PipeHT( PipeHTNum ).EnvironmentPtr );
+				if ( SELECT_CASE_var == GroundEnv ) {
+					CalcBuriedPipeSoil( PipeHTNum );
+				} else {
+					CalcPipesHeatTransfer( PipeHTNum );
+				}}
+				PushInnerTimeStepArrays( PipeHTNum );
+			}
+			// results that raised messages are not reused, so that a repeated call repeats its messages
+			if ( PipeHT( PipeHTNum ).ResultsReusable && ErrorCount == DataErrorTracking::TotalWarningErrors + DataErrorTracking::TotalSevereErrors ) {
+				PipeHT( PipeHTNum ).LastOutletTemp = OutletTemp;
+				PipeHT( PipeHTNum ).LastEnvHeatLossRate = EnvHeatLossRate;
+				PipeHT( PipeHTNum ).LastFluidHeatLossRate = FluidHeatLossRate;
+				PipeHT( PipeHTNum ).LastEnvironmentTempOut = EnvironmentTemp;
 			} else {
-				CalcPipesHeatTransfer( PipeHTNum );
-			}}
-			PushInnerTimeStepArrays( PipeHTNum );
+				PipeHT( PipeHTNum ).ResultsReusable = false;
+			}
 		}
 		// update vaiables
 		UpdatePipesHeatTransfer();
@@ -955,6 +975,7 @@ namespace PipeHeatTransfer {
 		int CompCtr;
 		bool PushArrays;
 		bool errFlag;
+		Real64 EnvrAirTemp; // zone or outdoor air node temperature around the pipe [C]
 
 		// Assign variable
 		CurSimDay = double( DayOfSim );
@@ -1075,6 +1096,7 @@ namespace PipeHeatTransfer {
 
 			PipeHT( PipeHTNum ).BeginSimInit = false;
 			PipeHT( PipeHTNum ).BeginSimEnvrn = false;
+			PipeHT( PipeHTNum ).ResultsReusable = false;
 
 		}
 
@@ -1126,6 +1148,7 @@ namespace PipeHeatTransfer {
 
 			PipeHT( PipeHTNum ).BeginEnvrnupdateFlag = false;
 			PipeHT( PipeHTNum ).FirstHVACupdateFlag = false;
+			PipeHT( PipeHTNum ).ResultsReusable = false;
 
 		}
 
@@ -1141,6 +1164,23 @@ namespace PipeHeatTransfer {
 			PushArrays = false; //Time hasn't passed, don't accept the tentative values yet!
 		}
 
+		// Within a time step, a call repeating the inputs of the last one that was not the first of the
+		// time step would revert to the same temperatures and calculate the same tentative values again
+		EnvrAirTemp = 0.0;
+		if ( PipeHT( PipeHTNum ).EnvironmentPtr == ZoneEnv ) {
+			EnvrAirTemp = MAT( PipeHT( PipeHTNum ).EnvrZonePtr );
+		} else if ( PipeHT( PipeHTNum ).EnvironmentPtr == OutsideAirEnv && PipeHT( PipeHTNum ).EnvrAirNodeNum > 0 ) {
+			EnvrAirTemp = Node( PipeHT( PipeHTNum ).EnvrAirNodeNum ).Temp;
+		}
+		PipeHT( PipeHTNum ).ReuseResults = ( ! PushArrays && PipeHT( PipeHTNum ).ResultsReusable && PipeHT( PipeHTNum ).LastSimTime == PipeHT( PipeHTNum ).CurrentSimTime && PipeHT( PipeHTNum ).LastDeltaTime == DeltaTime && PipeHT( PipeHTNum ).LastInletTemp == InletTemp && PipeHT( PipeHTNum ).LastMassFlowRate == MassFlowRate && PipeHT( PipeHTNum ).LastEnvironmentTemp == EnvironmentTemp && PipeHT( PipeHTNum ).LastEnvrAirTemp == EnvrAirTemp );
+		PipeHT( PipeHTNum ).ResultsReusable = ! PushArrays;
+		PipeHT( PipeHTNum ).LastSimTime = PipeHT( PipeHTNum ).CurrentSimTime;
+		PipeHT( PipeHTNum ).LastDeltaTime = DeltaTime;
+		PipeHT( PipeHTNum ).LastInletTemp = InletTemp;
+		PipeHT( PipeHTNum ).LastMassFlowRate = MassFlowRate;
+		PipeHT( PipeHTNum ).LastEnvironmentTemp = EnvironmentTemp;
+		PipeHT( PipeHTNum ).LastEnvrAirTemp = EnvrAirTemp;
+
 		if ( PushArrays ) {
 
 			//If sim time has changed all values from previous runs should have been acceptable.
@@ -1162,7 +1202,7 @@ namespace PipeHeatTransfer {
 			PipeHT( PipeHTNum ).FluidTemp = PipeHT( PipeHTNum ).TentativeFluidTemp;
 			PipeHT( PipeHTNum ).PipeTemp = PipeHT( PipeHTNum ).TentativePipeTemp;
 
-		} else { //  IF(.NOT. FirstHVACIteration)THEN
+		} else if ( ! PipeHT( PipeHTNum ).ReuseResults ) { //  IF(.NOT. FirstHVACIteration)THEN
 
 			//If we don't have FirstHVAC, the last iteration values were not accepted, and we should
 			// not step through time.  Thus we will revert our T(3,:,:,:) array back to T(2,:,:,:) to
@@ -149,6 +149,19 @@ namespace PipeHeatTransfer {
 		int BranchNum; // ..LoopSide%Branch index where this pipe lies
 		int CompNum; // ..Branch%Comp index where this pipe lies
 		bool CheckEquipName;
+		// Results of the last call within a time step, reused when the next call has the same inputs
+		bool ResultsReusable; // true if the last call left results that a repeat of it may reuse
+		bool ReuseResults; // true if this call repeats the last one and skips the calculations
+		Real64 LastSimTime; // simulation time of the last call [hr]
+		Real64 LastDeltaTime; // time step of the last call [s]
+		Real64 LastInletTemp; // inlet temperature of the last call [C]
+		Real64 LastMassFlowRate; // mass flow rate of the last call [kg/s]
+		Real64 LastEnvironmentTemp; // environment temperature at the start of the last call [C]
+		Real64 LastEnvrAirTemp; // zone or outdoor air node temperature of the last call [C]
+		Real64 LastOutletTemp; // outlet temperature calculated by the last call [C]
+		Real64 LastEnvHeatLossRate; // environment heat loss rate summed by the last call [W]
+		Real64 LastFluidHeatLossRate; // fluid heat loss rate calculated by the last call [W]
+		Real64 LastEnvironmentTempOut; // environment temperature at the end of the last call [C]
 
 		// Default Constructor
 		PipeHTData() :
@@ -223,7 +236,19 @@ namespace PipeHeatTransfer {
 			LoopSideNum( 0 ),
 			BranchNum( 0 ),
 			CompNum( 0 ),
-			CheckEquipName( true )
+			CheckEquipName( true ),
+			ResultsReusable( false ),
+			ReuseResults( false ),
+			LastSimTime( 0.0 ),
+			LastDeltaTime( 0.0 ),
+			LastInletTemp( 0.0 ),
+			LastMassFlowRate( 0.0 ),
+			LastEnvironmentTemp( 0.0 ),
+			LastEnvrAirTemp( 0.0 ),
+			LastOutletTemp( 0.0 ),
+			LastEnvHeatLossRate( 0.0 ),
+			LastFluidHeatLossRate( 0.0 ),
+			LastEnvironmentTempOut( 0.0 )
 		{}
 
 		// Member Constructor
@@ -406,7 +431,19 @@ namespace PipeHeatTransfer {
 			LoopSideNum( LoopSideNum ),
 			BranchNum( BranchNum ),
 			CompNum( CompNum ),
-			CheckEquipName( CheckEquipName )
+			CheckEquipName( CheckEquipName ),
+			ResultsReusable( false ),
+			ReuseResults( false ),
+			LastSimTime( 0.0 ),
+			LastDeltaTime( 0.0 ),
+			LastInletTemp( 0.0 ),
+			LastMassFlowRate( 0.0 ),
+			LastEnvironmentTemp( 0.0 ),
+			LastEnvrAirTemp( 0.0 ),
+			LastOutletTemp( 0.0 ),
+			LastEnvHeatLossRate( 0.0 ),
+			LastFluidHeatLossRate( 0.0 ),
+			LastEnvironmentTempOut( 0.0 )
 		{}
 
 	};
@@ -178,7 +178,15 @@ namespace PlantCondLoopOperation {
 		}
 
 		//Return if there are no loop operation schemes available
-		if ( ! any( PlantLoop( LoopNum ).OpScheme.Available() ) ) return;
+		//Scanned in place: the OpScheme.Available() projection builds a temporary array on every component call
+		bool AnyOpSchemeAvailable( false );
+		for ( int OpNum = 1, OpNum_end = PlantLoop( LoopNum ).NumOpSchemes; OpNum <= OpNum_end; ++OpNum ) {
+			if ( PlantLoop( LoopNum ).OpScheme( OpNum ).Available ) {
+				AnyOpSchemeAvailable = true;
+				break;
+			}
+		}
+		if ( ! AnyOpSchemeAvailable ) return;
 
 		// set up references
 		auto & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
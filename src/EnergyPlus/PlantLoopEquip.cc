@@ -42,6 +42,7 @@
 #include <PlantPipingSystemsManager.hh>
 #include <PlantValves.hh>
 #include <PondGroundHeatExchanger.hh>
+#include <Profiler.hh>
 #include <Pumps.hh>
 #include <RefrigeratedCase.hh>
 #include <ScheduleManager.hh>
@@ -235,6 +236,7 @@ namespace PlantLoopEquip {
 
 		// set up a reference for this component
 		auto & sim_component( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ).Comp( Num ) );
+		Profiler::ComponentTimer const Timer( sim_component.TypeOf, sim_component.Name );
 
 		GeneralEquipType = sim_component.GeneralEquipType;
 		// Based on the general equip type and the GetCompSizFac value, see if we can just leave early
@@ -1,5 +1,7 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -58,6 +60,7 @@ namespace PlantLoopSolver {
 	Real64 LoadToLoopSetPointThatWasntMet; // Unmet Demand
 	Real64 InitialDemandToLoopSetPointSAVED;
 	int RefrigIndex( 0 ); // Index denoting refrigerant used (possibly steam)
+	Array1D_int ChangeDetectionNodes; // Nodes of all plant loop components, for half loop change detection
 
 	static std::string const fluidNameSteam( "STEAM" );
 
@@ -297,6 +300,107 @@ namespace PlantLoopSolver {
 
 	}
 
+	void
+	SavePlantState(
+		int const LoopNum,
+		int const LoopSideNum
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps the conditions of the plant nodes after a half loop solve, for PlantStateUnchanged.
+
+		// METHODOLOGY EMPLOYED:
+		// The nodes of every component on every plant loop are kept, not only those of this half loop, since the
+		// components of this side also depend on the loops they connect to (e.g. a chiller condenser).
+
+		// Using/Aliasing
+		using DataLoopNode::Node;
+		using DataPlant::DemandSide;
+		using DataPlant::PlantLoop;
+		using DataPlant::SupplySide;
+		using DataPlant::TotNumLoops;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const NumNodeValues( 6 ); // Conditions kept by node
+
+		if ( ! allocated( ChangeDetectionNodes ) ) {
+			std::vector< int > NodeNums;
+			for ( int PlantLoopNum = 1; PlantLoopNum <= TotNumLoops; ++PlantLoopNum ) {
+				if ( PlantLoop( PlantLoopNum ).TempSetPointNodeNum > 0 ) NodeNums.push_back( PlantLoop( PlantLoopNum ).TempSetPointNodeNum );
+				for ( int SideNum = DemandSide; SideNum <= SupplySide; ++SideNum ) {
+					auto const & loop_side( PlantLoop( PlantLoopNum ).LoopSide( SideNum ) );
+					for ( int BranchNum = 1; BranchNum <= loop_side.TotalBranches; ++BranchNum ) {
+						auto const & branch( loop_side.Branch( BranchNum ) );
+						for ( int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+							auto const & comp( branch.Comp( CompNum ) );
+							if ( comp.NodeNumIn > 0 ) NodeNums.push_back( comp.NodeNumIn );
+							if ( comp.NodeNumOut > 0 ) NodeNums.push_back( comp.NodeNumOut );
+						}
+					}
+				}
+			}
+			std::sort( NodeNums.begin(), NodeNums.end() );
+			NodeNums.erase( std::unique( NodeNums.begin(), NodeNums.end() ), NodeNums.end() );
+			ChangeDetectionNodes.allocate( int( NodeNums.size() ) );
+			for ( int i = 1; i <= ChangeDetectionNodes.isize(); ++i ) ChangeDetectionNodes( i ) = NodeNums[ i - 1 ];
+		}
+
+		auto & State( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).SolvedPlantState );
+		if ( State.isize() != NumNodeValues * ChangeDetectionNodes.isize() ) State.allocate( NumNodeValues * ChangeDetectionNodes.isize() );
+		int Pos( 0 );
+		for ( int i = 1; i <= ChangeDetectionNodes.isize(); ++i ) {
+			auto const & node( Node( ChangeDetectionNodes( i ) ) );
+			State( ++Pos ) = node.Temp;
+			State( ++Pos ) = node.TempSetPoint;
+			State( ++Pos ) = node.MassFlowRate;
+			State( ++Pos ) = node.MassFlowRateRequest;
+			State( ++Pos ) = node.MassFlowRateMinAvail;
+			State( ++Pos ) = node.MassFlowRateMaxAvail;
+		}
+
+	}
+
+	bool
+	PlantStateUnchanged(
+		int const LoopNum,
+		int const LoopSideNum
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Tells if no plant node has changed since the last solve of a half loop, so solving it again would
+		// find the same conditions.
+
+		// METHODOLOGY EMPLOYED:
+		// Temperatures and flow rates are compared to the conditions kept by SavePlantState, within the
+		// tolerances the plant convergence checks take as duplicate values.
+
+		// Using/Aliasing
+		using DataConvergParams::PlantFlowRateOscillationToler;
+		using DataConvergParams::PlantTemperatureOscillationToler;
+		using DataLoopNode::Node;
+		using DataPlant::PlantLoop;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const NumNodeValues( 6 ); // Conditions kept by node, as in SavePlantState
+
+		auto const & State( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).SolvedPlantState );
+		if ( ! allocated( ChangeDetectionNodes ) || State.isize() != NumNodeValues * ChangeDetectionNodes.isize() ) return false;
+		int Pos( 0 );
+		for ( int i = 1; i <= ChangeDetectionNodes.isize(); ++i ) {
+			auto const & node( Node( ChangeDetectionNodes( i ) ) );
+			if ( std::abs( State( ++Pos ) - node.Temp ) > PlantTemperatureOscillationToler ) return false;
+			if ( std::abs( State( ++Pos ) - node.TempSetPoint ) > PlantTemperatureOscillationToler ) return false;
+			if ( std::abs( State( ++Pos ) - node.MassFlowRate ) > PlantFlowRateOscillationToler ) return false;
+			if ( std::abs( State( ++Pos ) - node.MassFlowRateRequest ) > PlantFlowRateOscillationToler ) return false;
+			if ( std::abs( State( ++Pos ) - node.MassFlowRateMinAvail ) > PlantFlowRateOscillationToler ) return false;
+			if ( std::abs( State( ++Pos ) - node.MassFlowRateMaxAvail ) > PlantFlowRateOscillationToler ) return false;
+		}
+		return true;
+
+	}
+
 	//==================================================================!
 	//==================================================================!
 	//==================================================================!
@@ -1639,7 +1743,7 @@ namespace PlantLoopSolver {
 
 		if ( PlantLoop( LoopNum ).FluidType == NodeType_Water ) {
 
-			Cp = GetSpecificHeatGlycol( PlantLoop( LoopNum ).FluidName, WeightedInletTemp, PlantLoop( LoopNum ).FluidIndex, RoutineName );
+			Cp = GetSpecificHeatGlycol( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).FluidProps, WeightedInletTemp, RoutineName );
 
 			{ auto const SELECT_CASE_var( PlantLoop( LoopNum ).LoopDemandCalcScheme );
 
@@ -1777,6 +1881,7 @@ namespace PlantLoopSolver {
 		using DataPlant::FlowLocked;
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
+		using DataLoopNode::NodeType_Water;
 		using FluidProperties::GetSpecificHeatGlycol;
 
 		// Locals
@@ -1837,7 +1942,8 @@ namespace PlantLoopSolver {
 		Real64 const InletTemp( Node( InletNode ).Temp );
 		Real64 const OutletTemp( Node( OutletNode ).Temp );
 		Real64 const AverageTemp( ( InletTemp + OutletTemp ) / 2.0 );
-		Real64 const ComponentCp( GetSpecificHeatGlycol( PlantLoop( LoopNum ).FluidName, AverageTemp, PlantLoop( LoopNum ).FluidIndex, RoutineName ) );
+		// Steam loops find their fluid index on first use, which the loop side handle does not follow
+		Real64 const ComponentCp( PlantLoop( LoopNum ).FluidType == NodeType_Water ? GetSpecificHeatGlycol( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).FluidProps, AverageTemp, RoutineName ) : GetSpecificHeatGlycol( PlantLoop( LoopNum ).FluidName, AverageTemp, PlantLoop( LoopNum ).FluidIndex, RoutineName ) );
 
 		// Calculate the load altered by this component
 		Real64 const LoadAlteration( ComponentMassFlowRate * ComponentCp * ( OutletTemp - InletTemp ) );
@@ -2716,7 +2822,7 @@ namespace PlantLoopSolver {
 
 		if ( this_loop.FluidType == NodeType_Water ) {
 
-			Cp = GetSpecificHeatGlycol( this_loop.FluidName, TargetTemp, this_loop.FluidIndex, RoutineName );
+			Cp = GetSpecificHeatGlycol( this_loop.LoopSide( LoopSideNum ).FluidProps, TargetTemp, RoutineName );
 
 			{ auto const SELECT_CASE_var( this_loop.LoopDemandCalcScheme );
 
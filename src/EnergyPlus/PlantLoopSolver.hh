@@ -2,6 +2,7 @@
 #define PlantLoopSolver_hh_INCLUDED
 
 // ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Optional.hh>
 
@@ -22,6 +23,7 @@ namespace PlantLoopSolver {
 	extern Real64 LoadToLoopSetPointThatWasntMet; // Unmet Demand
 	extern Real64 InitialDemandToLoopSetPointSAVED;
 	extern int RefrigIndex; // Index denoting refrigerant used (possibly steam)
+	extern Array1D_int ChangeDetectionNodes; // Nodes of all plant loop components, for half loop change detection
 
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE EvaluatePumpFlowConditions
@@ -94,6 +96,18 @@ namespace PlantLoopSolver {
 		bool & ReSimOtherSideNeeded
 	);
 
+	void
+	SavePlantState(
+		int const LoopNum,
+		int const LoopSideNum
+	);
+
+	bool
+	PlantStateUnchanged(
+		int const LoopNum,
+		int const LoopSideNum
+	);
+
 	//==================================================================!
 	//==================================================================!
 	//==================================================================!
@@ -18,6 +18,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -30,6 +31,7 @@
 #include <PlantLoopEquip.hh>
 #include <PlantLoopSolver.hh>
 #include <PlantUtilities.hh>
+#include <Profiler.hh>
 #include <ReportSizingManager.hh>
 #include <ScheduleManager.hh>
 #include <SetPointManager.hh>
@@ -143,6 +145,9 @@ namespace PlantManager {
 		using PlantUtilities::LogPlantConvergencePoints;
 		using DataConvergParams::MinPlantSubIterations;
 		using DataConvergParams::MaxPlantSubIterations;
+		using DataSystemVariables::PlantHalfLoopChangeDetection;
+		using PlantLoopSolver::PlantStateUnchanged;
+		using PlantLoopSolver::SavePlantState;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS
 
@@ -159,6 +164,9 @@ namespace PlantManager {
 		int HalfLoopNum;
 		int CurntMinPlantSubIterations;
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "ManagePlantLoops" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		if ( any_eq( PlantLoop.CommonPipeType(), CommonPipe_Single ) || any_eq( PlantLoop.CommonPipeType(), CommonPipe_TwoWay ) ) {
 			CurntMinPlantSubIterations = max( 7, MinPlantSubIterations );
 		} else {
@@ -189,7 +197,11 @@ namespace PlantManager {
 
 				if ( SimHalfLoopFlag || IterPlant <= CurntMinPlantSubIterations ) {
 
+					// A minimum sub iteration of a half loop nothing has changed for would find the same conditions
+					if ( PlantHalfLoopChangeDetection && ! SimHalfLoopFlag && IterPlant > 0 && PlantStateUnchanged( LoopNum, LoopSide ) ) continue;
+
 					PlantHalfLoopSolver( FirstHVACIteration, LoopSide, LoopNum, other_loop_side.SimLoopSideNeeded );
+					if ( PlantHalfLoopChangeDetection ) SavePlantState( LoopNum, LoopSide );
 
 					// Always set this side to false,  so that it won't keep being turned on just because of first hvac
 					this_loop_side.SimLoopSideNeeded = false;
@@ -396,6 +408,8 @@ namespace PlantManager {
 				this_loop.FluidName = "WATER";
 				this_loop.FluidIndex = FindGlycol( "WATER" );
 			}
+			this_demand_side.FluidProps = FluidProperties::GlycolPropsHandle( this_loop.FluidIndex );
+			this_supply_side.FluidProps = FluidProperties::GlycolPropsHandle( this_loop.FluidIndex );
 
 			this_loop.OperationScheme = Alpha( 4 ); // Load the Plant Control Scheme Priority List
 
@@ -24,6 +24,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -5668,6 +5669,7 @@ namespace PlantPipingSystemsManager {
 		//'     one for zero based array
 		//'     one because the boundary points contain one entry more than the number of cells WITHIN the domain
 		PipingSystemDomains( DomainNum ).Cells.allocate( {0,isize( XBoundaryPoints )-2}, {0,isize( YBoundaryPoints )-2}, {0,isize( ZBoundaryPoints )-2} );
+		PipingSystemDomains( DomainNum ).FieldSolver.Built = false;
 
 		YIndexMax = PipingSystemDomains( DomainNum ).Cells.u2();
 		MaxBasementXNodeIndex = PipingSystemDomains( DomainNum ).BasementZone.BasementWallXIndex;
@@ -6537,13 +6539,20 @@ namespace PlantPipingSystemsManager {
 		// na
 		using DataGlobals::TimeStep;
 		using DataEnvironment::CurMnDyHr;
+		using DataSystemVariables::GroundDomainPCGSolver;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
+		// With GroundDomainPCGSolver the field cells are left to SolveFieldCellTemperatures,
+		// after the boundary cells have been updated.  Otherwise the field cells are swept with
+		// the neighbors kept by SetupFieldCellSolver; FieldSolver.CellTemp follows each update.
 		auto & cells( PipingSystemDomains( DomainNum ).Cells );
+		auto & fs( PipingSystemDomains( DomainNum ).FieldSolver );
+		if ( ! fs.Built ) SetupFieldCellSolver( DomainNum );
+		for ( std::size_t l = 0, l_end = cells.size(); l < l_end; ++l ) fs.CellTemp[ l ] = cells[ l ].MyBase.Temperature;
 		for ( int X = cells.l1(), X_end = cells.u1(); X <= X_end; ++X ) {
 			for ( int Y = cells.l2(), Y_end = cells.u2(); Y <= Y_end; ++Y ) {
 				for ( int Z = cells.l3(), Z_end = cells.u3(); Z <= Z_end; ++Z ) {
@@ -6553,7 +6562,7 @@ namespace PlantPipingSystemsManager {
 					if ( SELECT_CASE_var == CellType_Pipe ) {
 						//'pipes are simulated separately
 					} else if ( ( SELECT_CASE_var == CellType_GeneralField ) || ( SELECT_CASE_var == CellType_Slab ) || ( SELECT_CASE_var == CellType_HorizInsulation ) || ( SELECT_CASE_var == CellType_VertInsulation ) ) {
-						cell.MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, cell );
+						if ( ! GroundDomainPCGSolver ) cell.MyBase.Temperature = EvaluateCachedFieldCellTemperature( DomainNum, fs.CellPos( X, Y, Z ) );
 					} else if ( SELECT_CASE_var == CellType_GroundSurface ) {
 						cell.MyBase.Temperature = EvaluateGroundSurfaceTemperature( DomainNum, cell );
 					} else if ( SELECT_CASE_var == CellType_FarfieldBoundary ) {
@@ -6570,10 +6579,209 @@ namespace PlantPipingSystemsManager {
 					} else if ( SELECT_CASE_var == CellType_ZoneGroundInterface ) {
 						cell.MyBase.Temperature = EvaluateZoneInterfaceTemperature( DomainNum, cell );
 					}}
+					fs.CellTemp[ cells.index( X, Y, Z ) ] = cell.MyBase.Temperature;
 				}
 			}
 		}
 
+		if ( GroundDomainPCGSolver ) SolveFieldCellTemperatures( DomainNum );
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SetupFieldCellSolver( int const DomainNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Numbers the field cells of the domain (the cells EvaluateFieldCellTemperature handles)
+		// and keeps their neighbors and resistances for the sweeps and SolveFieldCellTemperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// The neighbors are taken in the order EvaluateFieldCellTemperature visits them and the
+		// resistances from EvaluateNeighborCharacteristics, so EvaluateCachedFieldCellTemperature
+		// gives the same result.  The cell properties and the mesh are fixed once meshed.
+
+		auto const & cells( PipingSystemDomains( DomainNum ).Cells );
+		auto & fs( PipingSystemDomains( DomainNum ).FieldSolver );
+		fs.CellPos.dimension( cells.I1(), cells.I2(), cells.I3(), -1 );
+		fs.CellX.clear();
+		fs.CellY.clear();
+		fs.CellZ.clear();
+		for ( int X = cells.l1(), X_end = cells.u1(); X <= X_end; ++X ) {
+			for ( int Y = cells.l2(), Y_end = cells.u2(); Y <= Y_end; ++Y ) {
+				for ( int Z = cells.l3(), Z_end = cells.u3(); Z <= Z_end; ++Z ) {
+					int const CellType( cells( X, Y, Z ).CellType );
+					if ( CellType == CellType_GeneralField || CellType == CellType_Slab || CellType == CellType_HorizInsulation || CellType == CellType_VertInsulation ) {
+						fs.CellPos( X, Y, Z ) = int( fs.CellX.size() );
+						fs.CellX.push_back( X );
+						fs.CellY.push_back( Y );
+						fs.CellZ.push_back( Z );
+					}
+				}
+			}
+		}
+		int const NumCells( int( fs.CellX.size() ) );
+
+		Real64 NeighborTemp;
+		Real64 Resistance;
+		int NX;
+		int NY;
+		int NZ;
+		fs.Np.assign( NumCells + 1, 0 );
+		fs.NbIndex.clear();
+		fs.NbPos.clear();
+		fs.NbResistance.clear();
+		fs.NbConductance.clear();
+		for ( int k = 0; k < NumCells; ++k ) {
+			auto const & cell( cells( fs.CellX[ k ], fs.CellY[ k ], fs.CellZ[ k ] ) );
+			EvaluateCellNeighborDirections( DomainNum, cell );
+			for ( int DirectionCounter = NeighborFieldCells.l1(); DirectionCounter <= NeighborFieldCells.u1(); ++DirectionCounter ) {
+				EvaluateNeighborCharacteristics( DomainNum, cell, NeighborFieldCells( DirectionCounter ), NeighborTemp, Resistance, NX, NY, NZ );
+				fs.NbIndex.push_back( int( cells.index( NX, NY, NZ ) ) );
+				fs.NbPos.push_back( fs.CellPos( NX, NY, NZ ) );
+				fs.NbResistance.push_back( Resistance );
+				fs.NbConductance.push_back( 1.0 / Resistance );
+			}
+			fs.Np[ k + 1 ] = int( fs.NbIndex.size() );
+		}
+
+		fs.CellTemp.resize( cells.size() );
+		for ( std::size_t l = 0, l_end = cells.size(); l < l_end; ++l ) fs.CellTemp[ l ] = cells[ l ].MyBase.Temperature;
+		fs.Diag.assign( NumCells, 0.0 );
+		fs.B.assign( NumCells, 0.0 );
+		fs.T.assign( NumCells, 0.0 );
+		fs.R.assign( NumCells, 0.0 );
+		fs.Z.assign( NumCells, 0.0 );
+		fs.P.assign( NumCells, 0.0 );
+		fs.Q.assign( NumCells, 0.0 );
+		fs.Built = true;
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	Real64
+	EvaluateCachedFieldCellTemperature(
+		int const DomainNum,
+		int const FieldPos // Position of the cell among the field cells
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Same as EvaluateFieldCellTemperature, with the neighbors and resistances kept by
+		// SetupFieldCellSolver and the neighbor temperatures from FieldSolver.CellTemp.
+
+		auto const & fs( PipingSystemDomains( DomainNum ).FieldSolver );
+		auto const & cell( PipingSystemDomains( DomainNum ).Cells( fs.CellX[ FieldPos ], fs.CellY[ FieldPos ], fs.CellZ[ FieldPos ] ) );
+		Real64 const Beta( cell.MyBase.Beta );
+		Real64 Numerator( cell.MyBase.Temperature_PrevTimeStep );
+		Real64 Denominator( 1.0 );
+		for ( int p = fs.Np[ FieldPos ], p_end = fs.Np[ FieldPos + 1 ]; p < p_end; ++p ) {
+			Numerator += ( Beta / fs.NbResistance[ p ] ) * fs.CellTemp[ fs.NbIndex[ p ] ];
+			Denominator += Beta / fs.NbResistance[ p ];
+		}
+		return Numerator / Denominator;
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SolveFieldCellTemperatures( int const DomainNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the temperatures of all field cells together, with the other cells of the domain
+		// held at their current temperatures, instead of one point Gauss-Seidel sweep.
+
+		// METHODOLOGY EMPLOYED:
+		// The implicit balance of EvaluateFieldCellTemperature, divided by the cell Beta, gives a
+		// symmetric positive definite system over the field cells:
+		//   T/Beta + Sum( (T - Tn)/R ) = T_PrevTimeStep/Beta
+		// It is solved by conjugate gradients with a diagonal preconditioner, starting from the
+		// current temperatures, until the largest diagonally scaled residual is a hundredth of
+		// the domain convergence criterion.
+
+		// REFERENCES:
+		// Saad, Y., 2003, Iterative Methods for Sparse Linear Systems, 2nd ed., SIAM, Algorithm 9.1.
+
+		auto & cells( PipingSystemDomains( DomainNum ).Cells );
+		auto & fs( PipingSystemDomains( DomainNum ).FieldSolver );
+		if ( ! fs.Built ) SetupFieldCellSolver( DomainNum );
+		int const NumCells( int( fs.CellX.size() ) );
+		fs.Iterations = 0;
+		if ( NumCells == 0 ) return;
+
+		// Assemble the system at the current boundary temperatures
+		for ( int k = 0; k < NumCells; ++k ) {
+			auto const & cell( cells( fs.CellX[ k ], fs.CellY[ k ], fs.CellZ[ k ] ) );
+			Real64 const Beta( cell.MyBase.Beta );
+			fs.Diag[ k ] = 1.0 / Beta;
+			fs.B[ k ] = cell.MyBase.Temperature_PrevTimeStep / Beta;
+			fs.T[ k ] = cell.MyBase.Temperature;
+			for ( int p = fs.Np[ k ]; p < fs.Np[ k + 1 ]; ++p ) {
+				fs.Diag[ k ] += fs.NbConductance[ p ];
+				if ( fs.NbPos[ p ] < 0 ) fs.B[ k ] += fs.NbConductance[ p ] * cells[ fs.NbIndex[ p ] ].MyBase.Temperature;
+			}
+		}
+
+		// Preconditioned conjugate gradients
+		Real64 const Tolerance( 0.01 * PipingSystemDomains( DomainNum ).SimControls.Convergence_CurrentToPrevIteration );
+		int const MaxIterations( NumCells );
+		Real64 RZ( 0.0 );
+		Real64 MaxCorrection( 0.0 );
+		for ( int k = 0; k < NumCells; ++k ) {
+			Real64 AT( fs.Diag[ k ] * fs.T[ k ] );
+			for ( int p = fs.Np[ k ]; p < fs.Np[ k + 1 ]; ++p ) {
+				if ( fs.NbPos[ p ] >= 0 ) AT -= fs.NbConductance[ p ] * fs.T[ fs.NbPos[ p ] ];
+			}
+			fs.R[ k ] = fs.B[ k ] - AT;
+			fs.Z[ k ] = fs.R[ k ] / fs.Diag[ k ];
+			fs.P[ k ] = fs.Z[ k ];
+			RZ += fs.R[ k ] * fs.Z[ k ];
+			MaxCorrection = max( MaxCorrection, std::abs( fs.Z[ k ] ) );
+		}
+		while ( MaxCorrection >= Tolerance && fs.Iterations < MaxIterations ) {
+			++fs.Iterations;
+			Real64 PQ( 0.0 );
+			for ( int k = 0; k < NumCells; ++k ) {
+				Real64 AP( fs.Diag[ k ] * fs.P[ k ] );
+				for ( int p = fs.Np[ k ]; p < fs.Np[ k + 1 ]; ++p ) {
+					if ( fs.NbPos[ p ] >= 0 ) AP -= fs.NbConductance[ p ] * fs.P[ fs.NbPos[ p ] ];
+				}
+				fs.Q[ k ] = AP;
+				PQ += fs.P[ k ] * AP;
+			}
+			if ( PQ <= 0.0 ) break;
+			Real64 const Alpha( RZ / PQ );
+			Real64 RZNew( 0.0 );
+			MaxCorrection = 0.0;
+			for ( int k = 0; k < NumCells; ++k ) {
+				fs.T[ k ] += Alpha * fs.P[ k ];
+				fs.R[ k ] -= Alpha * fs.Q[ k ];
+				fs.Z[ k ] = fs.R[ k ] / fs.Diag[ k ];
+				RZNew += fs.R[ k ] * fs.Z[ k ];
+				MaxCorrection = max( MaxCorrection, std::abs( fs.Z[ k ] ) );
+			}
+			Real64 const BetaCG( RZNew / RZ );
+			RZ = RZNew;
+			for ( int k = 0; k < NumCells; ++k ) fs.P[ k ] = fs.Z[ k ] + BetaCG * fs.P[ k ];
+		}
+
+		for ( int k = 0; k < NumCells; ++k ) {
+			int const l( int( cells.index( fs.CellX[ k ], fs.CellY[ k ], fs.CellZ[ k ] ) ) );
+			cells[ l ].MyBase.Temperature = fs.T[ k ];
+			fs.CellTemp[ l ] = fs.T[ k ];
+		}
+
 	}
 
 	//*********************************************************************************************!
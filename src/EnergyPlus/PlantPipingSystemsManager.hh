@@ -781,6 +781,18 @@ namespace PlantPipingSystemsManager {
 	void
 	PerformTemperatureFieldUpdate( int const DomainNum );
 
+	void
+	SetupFieldCellSolver( int const DomainNum );
+
+	Real64
+	EvaluateCachedFieldCellTemperature(
+		int const DomainNum,
+		int const FieldPos // Position of the cell among the field cells
+	);
+
+	void
+	SolveFieldCellTemperatures( int const DomainNum );
+
 	//*********************************************************************************************!
 
 	//*********************************************************************************************!
@@ -1338,7 +1338,9 @@ namespace PlantPressureSystem {
 		bool Converged;
 		static int ZeroKWarningCounter( 0 );
 		static int MaxIterWarningCounter( 0 );
-		Array1D< Real64 > MassFlowIterativeHistory( 3 );
+		Real64 MassFlowIterativeHistory1; // Mass flow of this iteration
+		Real64 MassFlowIterativeHistory2; // Mass flow of the previous iteration
+		Real64 MassFlowIterativeHistory3; // Mass flow of the iteration before the previous one
 		Real64 MdotDeltaLatest;
 		Real64 MdotDeltaPrevious;
 		Real64 DampingFactor;
@@ -1373,7 +1375,9 @@ namespace PlantPressureSystem {
 		Converged = false;
 
 		//Initialize the mass flow history array and damping factor
-		MassFlowIterativeHistory = LocalSystemMassFlow;
+		MassFlowIterativeHistory1 = LocalSystemMassFlow;
+		MassFlowIterativeHistory2 = LocalSystemMassFlow;
+		MassFlowIterativeHistory3 = LocalSystemMassFlow;
 		DampingFactor = 0.9;
 
 		//Start Convergence Loop
@@ -1382,7 +1386,10 @@ namespace PlantPressureSystem {
 			//Calculate System Mass Flow Rate
 			LocalSystemMassFlow = std::sqrt( SystemPressureDrop / LoopEffectiveK );
 
-			MassFlowIterativeHistory = eoshift( MassFlowIterativeHistory, -1, LocalSystemMassFlow );
+			// Shift the history in place rather than building a new array each iteration
+			MassFlowIterativeHistory3 = MassFlowIterativeHistory2;
+			MassFlowIterativeHistory2 = MassFlowIterativeHistory1;
+			MassFlowIterativeHistory1 = LocalSystemMassFlow;
 
 			PhiSystem = LocalSystemMassFlow / ( NodeDensity * PumpSpeed * PumpImpellerDia );
 
@@ -1409,8 +1416,8 @@ namespace PlantPressureSystem {
 			if ( Iteration < 2 ) {
 				//Don't do anything?
 			} else {
-				MdotDeltaLatest = std::abs( MassFlowIterativeHistory( 1 ) - MassFlowIterativeHistory( 2 ) );
-				MdotDeltaPrevious = std::abs( MassFlowIterativeHistory( 2 ) - MassFlowIterativeHistory( 3 ) );
+				MdotDeltaLatest = std::abs( MassFlowIterativeHistory1 - MassFlowIterativeHistory2 );
+				MdotDeltaPrevious = std::abs( MassFlowIterativeHistory2 - MassFlowIterativeHistory3 );
 				if ( MdotDeltaLatest < MdotDeltaPrevious ) {
 					//we are converging
 					//DampingFactor = MIN(DampingFactor * 1.1, 0.9d0)
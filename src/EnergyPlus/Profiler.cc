@@ -0,0 +1,259 @@
+// C++ Headers
+#include <chrono>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include <Profiler.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace Profiler {
+
+	// PURPOSE OF THIS MODULE:
+	// Scoped timing of the main simulation routines, so that the time of a production run can be
+	// broken down by where it is spent.
+
+	// METHODOLOGY EMPLOYED:
+	// A routine declares a ProfileZone with a zone number registered once from its name.  With
+	// the SimulationProfile environment variable set, the zones entered build a calling tree with the calls and time of each
+	// zone within its enclosing zone; otherwise a zone costs one test.  Each thread keeps its own
+	// tree; the summary is written from the tree of the main thread at the end of the run, one
+	// line per calling path with the self time in microseconds ("folded stacks"), which flame
+	// graph tools read directly.
+
+	// REFERENCES: na
+
+	// The time of the air loop, zone and plant components is also accounted to each component
+	// instance, by type and name, for the tabular report of the components taking the most time.
+
+	// OTHER NOTES: na
+
+	// Using/Aliasing
+	using DataSystemVariables::ComponentRuntimeAccounting;
+	using DataSystemVariables::SimulationProfile;
+
+	// Object Data
+	std::vector< std::string > ProfileZoneNames; // Names of the profile zones, by zone number - 1
+	EP_THREAD_LOCAL ProfileTreeData ProfileTree; // Calling tree of the zones entered on this thread
+	std::vector< ComponentTimingData > ComponentTiming; // Calls and time of the components simulated
+	std::unordered_map< std::string, int > ComponentTimingMap; // Entry of ComponentTiming by type and name
+
+	// Functions
+
+	namespace {
+		inline
+		Int64
+		ProfileClock()
+		{
+			// Clock reading (ns)
+			return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+		}
+	}
+
+	ProfileZone::ProfileZone( int const ZoneNum ) :
+		Active( SimulationProfile )
+	{
+		if ( Active ) EnterProfileZone( ZoneNum );
+	}
+
+	ProfileZone::~ProfileZone()
+	{
+		if ( Active ) ExitProfileZone();
+	}
+
+	ComponentTimer::ComponentTimer(
+		std::string const & CompType,
+		std::string const & CompName
+	) :
+		CompTimingNum( ComponentRuntimeAccounting ? ComponentTimingIndex( CompType, CompName ) : -1 ),
+		StartTime( CompTimingNum >= 0 ? ProfileClock() : 0 )
+	{}
+
+	ComponentTimer::~ComponentTimer()
+	{
+		if ( CompTimingNum >= 0 ) {
+			auto & timing( ComponentTiming[ CompTimingNum ] );
+			++timing.Calls;
+			timing.Time += ProfileClock() - StartTime;
+		}
+	}
+
+	int
+	ComponentTimingIndex(
+		std::string const & CompType,
+		std::string const & CompName
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the entry of ComponentTiming of the component, adding it if it is new.
+
+		static std::string Key; // Reused so that finding a component does not allocate
+
+		Key = CompType;
+		Key += ':';
+		Key += CompName;
+		auto const Found( ComponentTimingMap.find( Key ) );
+		if ( Found != ComponentTimingMap.end() ) return Found->second;
+		int const CompTimingNum( int( ComponentTiming.size() ) );
+		ComponentTiming.push_back( ComponentTimingData() );
+		ComponentTiming.back().CompType = CompType;
+		ComponentTiming.back().CompName = CompName;
+		ComponentTimingMap.emplace( Key, CompTimingNum );
+		return CompTimingNum;
+
+	}
+
+	int
+	RegisterProfileZone( std::string const & Name )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the zone number of the profile zone with this name, adding the zone if it is new.
+
+		for ( int ZoneNum = 1; ZoneNum <= int( ProfileZoneNames.size() ); ++ZoneNum ) {
+			if ( ProfileZoneNames[ ZoneNum - 1 ] == Name ) return ZoneNum;
+		}
+		ProfileZoneNames.push_back( Name );
+		return int( ProfileZoneNames.size() );
+
+	}
+
+	void
+	EnterProfileZone( int const ZoneNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the timing of the zone within the innermost zone entered on this thread.
+
+		auto & Tree( ProfileTree );
+		int NodeNum( Tree.Nodes[ Tree.Current ].FirstChild );
+		while ( NodeNum >= 0 && Tree.Nodes[ NodeNum ].ZoneNum != ZoneNum ) NodeNum = Tree.Nodes[ NodeNum ].NextSibling;
+		if ( NodeNum < 0 ) {
+			NodeNum = int( Tree.Nodes.size() );
+			Tree.Nodes.push_back( ProfileNodeData() );
+			auto & node( Tree.Nodes.back() );
+			node.ZoneNum = ZoneNum;
+			node.Parent = Tree.Current;
+			node.NextSibling = Tree.Nodes[ Tree.Current ].FirstChild;
+			Tree.Nodes[ Tree.Current ].FirstChild = NodeNum;
+		}
+		Tree.Current = NodeNum;
+		++Tree.Nodes[ NodeNum ].Calls;
+		Tree.Nodes[ NodeNum ].StartTime = ProfileClock();
+
+	}
+
+	void
+	ExitProfileZone()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Ends the timing of the innermost zone entered on this thread.
+
+		auto & Tree( ProfileTree );
+		if ( Tree.Current <= 0 ) return;
+		auto & node( Tree.Nodes[ Tree.Current ] );
+		node.Time += ProfileClock() - node.StartTime;
+		Tree.Current = node.Parent;
+
+	}
+
+	void
+	WriteProfileSummary()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the self time of each calling path of the profile zones to the profile file.
+
+		// METHODOLOGY EMPLOYED:
+		// Zones still open, such as the one around the whole simulation, are counted up to now.
+
+		// Using/Aliasing
+		using DataStringGlobals::outputProfFileName;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FileUnit;
+
+		if ( ! SimulationProfile || ProfileTree.Nodes.size() <= 1 ) return;
+
+		Int64 const Now( ProfileClock() );
+		ProfileTreeData const Saved( ProfileTree );
+		for ( int NodeNum = ProfileTree.Current; NodeNum > 0; NodeNum = ProfileTree.Nodes[ NodeNum ].Parent ) {
+			ProfileTree.Nodes[ NodeNum ].Time += Now - ProfileTree.Nodes[ NodeNum ].StartTime;
+		}
+
+		FileUnit = GetNewUnitNumber();
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( FileUnit, outputProfFileName, flags ); if ( flags.err() ) goto Label100; }
+		for ( int NodeNum = ProfileTree.Nodes[ 0 ].FirstChild; NodeNum >= 0; NodeNum = ProfileTree.Nodes[ NodeNum ].NextSibling ) {
+			WriteProfileNode( FileUnit, NodeNum, "" );
+		}
+		gio::close( FileUnit );
+		ProfileTree = Saved;
+
+		return;
+
+Label100: ;
+		ProfileTree = Saved;
+		ShowWarningError( "WriteProfileSummary: Could not open file \"" + outputProfFileName + "\" for output (write)." );
+
+	}
+
+	void
+	WriteProfileNode(
+		int const FileUnit,
+		int const NodeNum, // Node of the profile tree (0 based)
+		std::string const & Path // Names of the enclosing zones, separated by semicolons
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the calling path and self time of the node, then those of the zones it encloses.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		auto const & node( ProfileTree.Nodes[ NodeNum ] );
+		std::string const NodePath( ( Path.empty() ? "" : Path + ';' ) + ProfileZoneNames[ node.ZoneNum - 1 ] );
+		Int64 SelfTime( node.Time );
+		for ( int Child = node.FirstChild; Child >= 0; Child = ProfileTree.Nodes[ Child ].NextSibling ) {
+			SelfTime -= ProfileTree.Nodes[ Child ].Time;
+		}
+		if ( SelfTime >= 1000 ) gio::write( FileUnit, fmtA ) << NodePath + ' ' + std::to_string( SelfTime / 1000 );
+		for ( int Child = node.FirstChild; Child >= 0; Child = ProfileTree.Nodes[ Child ].NextSibling ) {
+			WriteProfileNode( FileUnit, Child, NodePath );
+		}
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // Profiler
+
+} // EnergyPlus
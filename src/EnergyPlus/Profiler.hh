@@ -0,0 +1,188 @@
+#ifndef Profiler_hh_INCLUDED
+#define Profiler_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace Profiler {
+
+	// Types
+
+	struct ProfileNodeData
+	{
+		// Members
+		int ZoneNum; // Profile zone of this node, 0 for the root
+		int Parent; // Node of the enclosing zone (0 based), -1 for the root
+		int FirstChild; // First node of the enclosed zones, -1 if none
+		int NextSibling; // Next node with the same parent, -1 if none
+		Int64 Calls; // Times the zone was entered from its parent
+		Int64 Time; // Time spent in the zone, including the enclosed zones (ns)
+		Int64 StartTime; // Clock reading when the zone was last entered (ns)
+
+		// Default Constructor
+		ProfileNodeData() :
+			ZoneNum( 0 ),
+			Parent( -1 ),
+			FirstChild( -1 ),
+			NextSibling( -1 ),
+			Calls( 0 ),
+			Time( 0 ),
+			StartTime( 0 )
+		{}
+
+	};
+
+	struct ProfileTreeData
+	{
+		// Calling tree of the profile zones entered on one thread
+
+		// Members
+		std::vector< ProfileNodeData > Nodes; // Node 0 is the root
+		int Current; // Node of the innermost zone entered
+
+		// Default Constructor
+		ProfileTreeData() :
+			Nodes( 1 ),
+			Current( 0 )
+		{}
+
+	};
+
+	struct ComponentTimingData
+	{
+		// Members
+		std::string CompType; // Component type, as in the input
+		std::string CompName; // Component name
+		Int64 Calls; // Times the component was simulated
+		Int64 Time; // Time spent simulating the component, including what it simulates itself (ns)
+
+		// Default Constructor
+		ComponentTimingData() :
+			Calls( 0 ),
+			Time( 0 )
+		{}
+
+	};
+
+	class ProfileZone
+	{
+		// Times the scope it is declared in as the profile zone given, within the zone
+		// enclosing it.  Usage:
+		//   static int const ProfileZoneNum( RegisterProfileZone( "Name" ) );
+		//   ProfileZone const Profile( ProfileZoneNum );
+
+	public: // Creation
+
+		explicit
+		ProfileZone( int const ZoneNum );
+
+		~ProfileZone();
+
+	private: // Creation
+
+		ProfileZone( ProfileZone const & ); // Not copyable
+
+		ProfileZone &
+		operator =( ProfileZone const & ); // Not assignable
+
+	private: // Data
+
+		bool Active; // True if the zone was entered
+
+	};
+
+	class ComponentTimer
+	{
+		// Accounts the time of the scope it is declared in to the component given
+
+	public: // Creation
+
+		ComponentTimer(
+			std::string const & CompType,
+			std::string const & CompName
+		);
+
+		~ComponentTimer();
+
+	private: // Creation
+
+		ComponentTimer( ComponentTimer const & ); // Not copyable
+
+		ComponentTimer &
+		operator =( ComponentTimer const & ); // Not assignable
+
+	private: // Data
+
+		int CompTimingNum; // Entry of ComponentTiming (0 based), -1 if not accounted
+		Int64 StartTime; // Clock reading when the scope was entered (ns)
+
+	};
+
+	// Object Data
+	extern std::vector< std::string > ProfileZoneNames; // Names of the profile zones, by zone number - 1
+	extern EP_THREAD_LOCAL ProfileTreeData ProfileTree; // Calling tree of the zones entered on this thread
+	extern std::vector< ComponentTimingData > ComponentTiming; // Calls and time of the components simulated
+	extern std::unordered_map< std::string, int > ComponentTimingMap; // Entry of ComponentTiming by type and name
+
+	// Functions
+
+	int
+	RegisterProfileZone( std::string const & Name );
+
+	void
+	EnterProfileZone( int const ZoneNum );
+
+	void
+	ExitProfileZone();
+
+	int
+	ComponentTimingIndex(
+		std::string const & CompType,
+		std::string const & CompName
+	);
+
+	void
+	WriteProfileSummary();
+
+	void
+	WriteProfileNode(
+		int const FileUnit,
+		int const NodeNum, // Node of the profile tree (0 based)
+		std::string const & Path // Names of the enclosing zones, separated by semicolons
+	);
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // Profiler
+
+} // EnergyPlus
+
+#endif
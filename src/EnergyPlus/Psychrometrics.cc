@@ -1,9 +1,11 @@
 // C++ Headers
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
+#include <ObjexxFCL/environment.hh>
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
@@ -13,6 +15,8 @@
 #include <Psychrometrics.hh>
 #include <DataEnvironment.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
 
@@ -98,13 +102,10 @@ namespace Psychrometrics {
 #endif
 
 #ifdef EP_cache_PsyTwbFnTdbWPb
-	int const twbcache_size( 1024 * 1024 );
-	int const twbprecision_bits( 20 );
+	int const twbcache_ways( 4 ); // Entries in each set of the cache
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-	int const psatcache_size( 1024 * 1024 );
-	int const psatprecision_bits( 24 ); // 28  // 24  // 32
-	Int64 const psatcache_mask( psatcache_size - 1 );
+	int const psatcache_ways( 4 ); // Entries in each set of the cache
 #endif
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -117,14 +118,30 @@ namespace Psychrometrics {
 #ifdef EP_psych_stats
 	Array1D< Int64 > NumTimesCalled( NumPsychMonitors, 0 );
 	Array1D_int NumIterations( NumPsychMonitors, 0 );
+#endif
+#ifdef EP_cache_PsyTwbFnTdbWPb
+	int twbcache_size( 16 * 1024 ); // Entries in the cache, a power of 2 no smaller than twbcache_ways
+	int twbprecision_bits( 20 ); // Mantissa bits of the arguments kept in the cache tags
+	Int64 twbcache_mask( twbcache_size / twbcache_ways - 1 ); // Set number mask
+#ifdef EP_psych_stats
+	Int64 NumTwbCacheMisses( 0 );
+#endif
+#endif
+#ifdef EP_cache_PsyPsatFnTemp
+	int psatcache_size( 16 * 1024 ); // Entries in the cache, a power of 2 no smaller than psatcache_ways
+	int psatprecision_bits( 24 ); // Mantissa bits of the argument kept in the cache tags
+	Int64 psatcache_mask( psatcache_size / psatcache_ways - 1 ); // Set number mask
+#ifdef EP_psych_stats
+	Int64 NumPsatCacheMisses( 0 );
+#endif
 #endif
 
 	// Object Data
 #ifdef EP_cache_PsyTwbFnTdbWPb
-	Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
+	Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size-1), twbcache_ways entries per set
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-	Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+	Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size-1), psatcache_ways entries per set
 #endif
 
 	// Subroutine Specifications for the Module
@@ -145,19 +162,19 @@ namespace Psychrometrics {
 		// Initializes some variables for PsychRoutines
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The cache sizes and precisions may be changed by environment variables.
 
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using namespace DataSystemVariables;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 		// na
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -166,13 +183,67 @@ namespace Psychrometrics {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		// na
+		std::string cEnvValue;
+		int const NumSettings( 4 );
+		std::string const * const EnvNames[ NumSettings ] = { &cPsychTwbCacheSize, &cPsychTwbPrecisionBits, &cPsychPsatCacheSize, &cPsychPsatPrecisionBits };
+		int Settings[ NumSettings ] = { 0, 0, 0, 0 };
+#ifdef EP_cache_PsyTwbFnTdbWPb
+		Settings[ 0 ] = twbcache_size;
+		Settings[ 1 ] = twbprecision_bits;
+#endif
+#ifdef EP_cache_PsyPsatFnTemp
+		Settings[ 2 ] = psatcache_size;
+		Settings[ 3 ] = psatprecision_bits;
+#endif
+
+		for ( int Loop = 0; Loop < NumSettings; ++Loop ) {
+			get_environment_variable( *EnvNames[ Loop ], cEnvValue );
+			if ( cEnvValue.empty() ) continue;
+			int Value( 0 );
+			{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> Value; if ( flags.ios() == 0 && Value > 0 ) Settings[ Loop ] = Value; }
+		}
+		SetPsychCacheSizes( Settings[ 0 ], Settings[ 1 ], Settings[ 2 ], Settings[ 3 ] );
+
+	}
+
+	void
+	SetPsychCacheSizes(
+		int const TwbCacheSize, // Entries of the wet-bulb cache
+		int const TwbPrecisionBits, // Mantissa bits kept by the wet-bulb cache
+		int const PsatCacheSize, // Entries of the saturation pressure cache
+		int const PsatPrecisionBits // Mantissa bits kept by the saturation pressure cache
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sizes and clears the wet-bulb and saturation pressure caches.
+
+		// METHODOLOGY EMPLOYED:
+		// Each cache is a set associative table: the hash of the arguments picks a set, and the
+		// entries of the set are searched for the argument tags.  The size is rounded up to a
+		// power of 2 number of sets; the precision is limited to the 52 bits of the mantissa.
 
 #ifdef EP_cache_PsyTwbFnTdbWPb
-		cached_Twb.allocate( {0,twbcache_size} );
+		int TwbSets( 1 );
+		while ( TwbSets * twbcache_ways < TwbCacheSize && TwbSets < 1024 * 1024 ) TwbSets *= 2;
+		twbcache_size = TwbSets * twbcache_ways;
+		twbcache_mask = TwbSets - 1;
+		twbprecision_bits = min( max( TwbPrecisionBits, 1 ), 52 );
+		cached_Twb.dimension( {0,twbcache_size-1}, cached_twb_t() );
+#ifdef EP_psych_stats
+		NumTwbCacheMisses = 0;
+#endif
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-		cached_Psat.allocate( {0,psatcache_size} );
+		int PsatSets( 1 );
+		while ( PsatSets * psatcache_ways < PsatCacheSize && PsatSets < 1024 * 1024 ) PsatSets *= 2;
+		psatcache_size = PsatSets * psatcache_ways;
+		psatcache_mask = PsatSets - 1;
+		psatprecision_bits = min( max( PsatPrecisionBits, 1 ), 52 );
+		cached_Psat.dimension( {0,psatcache_size-1}, cached_psat_t() );
+#ifdef EP_psych_stats
+		NumPsatCacheMisses = 0;
+#endif
 #endif
 
 	}
@@ -220,8 +291,9 @@ namespace Psychrometrics {
 		int Loop;
 		Real64 AverageIterations;
 		std::string istring;
+		std::string mstring;
 
-		EchoInputFile = FindUnitNumber( outputAuditFile );
+		EchoInputFile = FindUnitNumber( DataStringGlobals::outputAuditFileName );
 		if ( EchoInputFile == 0 ) return;
 		if ( any_gt( NumTimesCalled, 0 ) ) {
 			gio::write( EchoInputFile, fmtA ) << "RoutineName,#times Called,Avg Iterations";
@@ -236,6 +308,17 @@ namespace Psychrometrics {
 					gio::write( EchoInputFile, fmtA ) << PsyRoutineNames( Loop ) + ',' + istring;
 				}
 			}
+			gio::write( EchoInputFile, fmtA ) << "CacheName,#entries,#hits,#misses";
+#ifdef EP_cache_PsyTwbFnTdbWPb
+			gio::write( istring, fmtLD ) << NumTimesCalled( iPsyTwbFnTdbWPb_cache ) - NumTwbCacheMisses;
+			gio::write( mstring, fmtLD ) << NumTwbCacheMisses;
+			gio::write( EchoInputFile, fmtA ) << PsyRoutineNames( iPsyTwbFnTdbWPb_cache ) + ',' + RoundSigDigits( twbcache_size ) + ',' + stripped( istring ) + ',' + stripped( mstring );
+#endif
+#ifdef EP_cache_PsyPsatFnTemp
+			gio::write( istring, fmtLD ) << NumTimesCalled( iPsyPsatFnTemp_cache ) - NumPsatCacheMisses;
+			gio::write( mstring, fmtLD ) << NumPsatCacheMisses;
+			gio::write( EchoInputFile, fmtA ) << PsyRoutineNames( iPsyPsatFnTemp_cache ) + ',' + RoundSigDigits( psatcache_size ) + ',' + stripped( istring ) + ',' + stripped( mstring );
+#endif
 		}
 #endif
 
@@ -332,7 +415,9 @@ namespace Psychrometrics {
 
 		// METHODOLOGY EMPLOYED:
 		// Use grid shifting and masking to provide hash into the cache. Use Equivalence to
-		// make Fortran ignore "types".
+		// make Fortran ignore "types".  The hash picks a set of the cache; an entry found in
+		// the set is swapped with the one before it, and a new entry goes to the front of
+		// the set, dropping the last one.
 
 		// REFERENCES:
 		// na
@@ -375,23 +460,28 @@ namespace Psychrometrics {
 		Tdb_tag = bit::bit_shift( Tdb_tag, -Grid_Shift );
 		W_tag = bit::bit_shift( W_tag, -Grid_Shift );
 		Pb_tag = bit::bit_shift( Pb_tag, -Grid_Shift );
-		hash = bit::bit_and( bit::bit_xor( Tdb_tag, bit::bit_xor( W_tag, Pb_tag ) ), Int64( twbcache_size - 1 ) );
-
-		if ( cached_Twb( hash ).iTdb != Tdb_tag || cached_Twb( hash ).iW != W_tag || cached_Twb( hash ).iPb != Pb_tag ) {
-			cached_Twb( hash ).iTdb = Tdb_tag;
-			cached_Twb( hash ).iW = W_tag;
-			cached_Twb( hash ).iPb = Pb_tag;
+		hash = bit::bit_and( bit::bit_xor( Tdb_tag, bit::bit_xor( W_tag, Pb_tag ) ), twbcache_mask ) * twbcache_ways;
+
+		for ( Int64 Way = hash, LastWay = hash + twbcache_ways; Way < LastWay; ++Way ) {
+			auto const & cTwb( cached_Twb( Way ) );
+			if ( cTwb.iTdb == Tdb_tag && cTwb.iW == W_tag && cTwb.iPb == Pb_tag ) {
+				Twb_result = cTwb.Twb;
+				if ( Way > hash ) std::swap( cached_Twb( Way ), cached_Twb( Way - 1 ) );
+				return Twb_result;
+			}
+		}
 
-			Tdb_tag_r = TRANSFER( bit::bit_shift( Tdb_tag, Grid_Shift ), Tdb_tag_r );
-			W_tag_r = TRANSFER( bit::bit_shift( W_tag, Grid_Shift ), W_tag_r );
-			Pb_tag_r = TRANSFER( bit::bit_shift( Pb_tag, Grid_Shift ), Pb_tag_r );
+#ifdef EP_psych_stats
+		++NumTwbCacheMisses;
+#endif
+		for ( Int64 Way = hash + twbcache_ways - 1; Way > hash; --Way ) cached_Twb( Way ) = cached_Twb( Way - 1 );
 
-			cached_Twb( hash ).Twb = PsyTwbFnTdbWPb_raw( Tdb_tag_r, W_tag_r, Pb_tag_r, CalledFrom );
-		}
+		Tdb_tag_r = TRANSFER( bit::bit_shift( Tdb_tag, Grid_Shift ), Tdb_tag_r );
+		W_tag_r = TRANSFER( bit::bit_shift( W_tag, Grid_Shift ), W_tag_r );
+		Pb_tag_r = TRANSFER( bit::bit_shift( Pb_tag, Grid_Shift ), Pb_tag_r );
 
-		//  Twbresult_last = cached_Twb(hash)%Twb
-		//  Twb_result = Twbresult_last
-		Twb_result = cached_Twb( hash ).Twb;
+		Twb_result = PsyTwbFnTdbWPb_raw( Tdb_tag_r, W_tag_r, Pb_tag_r, CalledFrom );
+		cached_Twb( hash ) = cached_twb_t( Tdb_tag, W_tag, Pb_tag, Twb_result );
 
 		return Twb_result;
 
@@ -674,6 +764,44 @@ namespace Psychrometrics {
 
 #ifdef EP_cache_PsyPsatFnTemp
 
+	Real64
+	PsyPsatFnTemp_lookup(
+		Int64 const Tdb_tag, // cache tag of the dry-bulb temperature
+		Int64 const SetStart, // index in cached_Psat of the first entry of the set
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Finds the saturation pressure of a temperature tag not in the first entry of its
+		// cache set, calculating and caching it when it is not in the set.
+
+		// METHODOLOGY EMPLOYED:
+		// Same replacement as the wet-bulb cache: an entry found is swapped with the one before
+		// it, a new entry goes to the front of the set.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Int64 const Grid_Shift( 64 - 12 - psatprecision_bits );
+		Real64 Tdb_tag_r;
+
+		for ( Int64 Way = SetStart + 1, LastWay = SetStart + psatcache_ways; Way < LastWay; ++Way ) {
+			if ( cached_Psat( Way ).iTdb == Tdb_tag ) {
+				std::swap( cached_Psat( Way ), cached_Psat( Way - 1 ) );
+				return cached_Psat( Way - 1 ).Psat;
+			}
+		}
+
+#ifdef EP_psych_stats
+		++NumPsatCacheMisses;
+#endif
+		for ( Int64 Way = SetStart + psatcache_ways - 1; Way > SetStart; --Way ) cached_Psat( Way ) = cached_Psat( Way - 1 );
+		Tdb_tag_r = TRANSFER( bit::bit_shift( Tdb_tag, Grid_Shift ), Tdb_tag_r );
+		cached_Psat( SetStart ) = cached_psat_t( Tdb_tag, PsyPsatFnTemp_raw( Tdb_tag_r, CalledFrom ) );
+
+		return cached_Psat( SetStart ).Psat; // saturation pressure {Pascals}
+
+	}
+
 	Real64
 	PsyPsatFnTemp_raw(
 		Real64 const T, // dry-bulb temperature {C}
@@ -1394,6 +1522,196 @@ Label170: ;
 
 	}
 
+	void
+	PsyRhoAirFnPbTdbW(
+		Real64 const pb, // barometric pressure (Pascals)
+		Array1< Real64 > const & tdb, // dry bulb temperatures (Celsius)
+		Array1< Real64 > const & dw, // humidity ratios (kgWater/kgDryAir)
+		Array1< Real64 > & rhoair // densities of air
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Densities of air for arrays of dry bulb temperatures and humidity ratios at one
+		// barometric pressure.
+
+		// METHODOLOGY EMPLOYED:
+		// Same expression as the scalar function, in a loop over the raw array data with no
+		// calls or branches so that the compiler can vectorize it.  The rare invalid values
+		// are reported in a separate pass.
+
+		assert( ( tdb.size() == dw.size() ) && ( rhoair.size() == tdb.size() ) );
+		int const n( tdb.isize() );
+		Real64 const * const t( tdb.data() );
+		Real64 const * const w( dw.data() );
+		Real64 * const r( rhoair.data() );
+		for ( int i = 0; i < n; ++i ) {
+			r[ i ] = pb / ( 287.0 * ( t[ i ] + KelvinConv ) * ( 1.0 + 1.6077687 * max( w[ i ], 1.0e-5 ) ) );
+		}
+#ifdef EP_psych_errors
+		for ( int i = 0; i < n; ++i ) {
+			if ( r[ i ] < 0.0 ) PsyRhoAirFnPbTdbW_error( pb, t[ i ], w[ i ], r[ i ] );
+		}
+#endif
+
+	}
+
+	void
+	PsyHFnTdbW(
+		Array1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		Array1< Real64 > const & dW, // humidity ratios
+		Array1< Real64 > & H // enthalpies {J/kg}
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Enthalpies for arrays of dry-bulb temperatures and humidity ratios.
+
+		assert( ( TDB.size() == dW.size() ) && ( H.size() == TDB.size() ) );
+		int const n( TDB.isize() );
+		Real64 const * const t( TDB.data() );
+		Real64 const * const w( dW.data() );
+		Real64 * const h( H.data() );
+		for ( int i = 0; i < n; ++i ) {
+			h[ i ] = 1.00484e3 * t[ i ] + max( w[ i ], 1.0e-5 ) * ( 2.50094e6 + 1.85895e3 * t[ i ] );
+		}
+
+	}
+
+	void
+	PsyCpAirFnWTdb(
+		Array1< Real64 > const & dw, // humidity ratios {kgWater/kgDryAir}
+		Array1< Real64 > const & T, // temperatures {Celsius}
+		Array1< Real64 > & cpa // heat capacities of air {J/kg-C}
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Heat capacities of air for arrays of humidity ratios and temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// Same numerical derivative of the enthalpy as the scalar function, without its saved
+		// last call.
+
+		assert( ( dw.size() == T.size() ) && ( cpa.size() == T.size() ) );
+		int const n( T.isize() );
+		Real64 const * const w( dw.data() );
+		Real64 const * const t( T.data() );
+		Real64 * const c( cpa.data() );
+		for ( int i = 0; i < n; ++i ) {
+			Real64 const wi( max( w[ i ], 1.0e-5 ) );
+			Real64 const ti( t[ i ] );
+			Real64 const h1( 1.00484e3 * ( ti + 0.1 ) + wi * ( 2.50094e6 + 1.85895e3 * ( ti + 0.1 ) ) );
+			Real64 const h0( 1.00484e3 * ti + wi * ( 2.50094e6 + 1.85895e3 * ti ) );
+			c[ i ] = ( h1 - h0 ) * 10.0;
+		}
+
+	}
+
+	void
+	PsyTdbFnHW(
+		Array1< Real64 > const & H, // enthalpies {J/kg}
+		Array1< Real64 > const & dW, // humidity ratios
+		Array1< Real64 > & Tdb // dry-bulb temperatures {C}
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Air temperatures for arrays of enthalpies and humidity ratios.
+
+		assert( ( H.size() == dW.size() ) && ( Tdb.size() == H.size() ) );
+		int const n( H.isize() );
+		Real64 const * const h( H.data() );
+		Real64 const * const w( dW.data() );
+		Real64 * const t( Tdb.data() );
+		for ( int i = 0; i < n; ++i ) {
+			Real64 const wi( max( w[ i ], 1.0e-5 ) );
+			t[ i ] = ( h[ i ] - 2.50094e6 * wi ) / ( 1.00484e3 + 1.85895e3 * wi );
+		}
+
+	}
+
+	void
+	PsyWFnTdbH(
+		Array1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		Array1< Real64 > const & H, // enthalpies {J/kg}
+		Array1< Real64 > & W // humidity ratios
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Humidity ratios for arrays of dry-bulb temperatures and enthalpies.
+
+		// METHODOLOGY EMPLOYED:
+		// The ratios are computed in one pass; a second pass reports and resets the negative
+		// ones as the scalar function does.
+
+		assert( ( TDB.size() == H.size() ) && ( W.size() == TDB.size() ) );
+		int const n( TDB.isize() );
+		Real64 const * const t( TDB.data() );
+		Real64 const * const h( H.data() );
+		Real64 * const w( W.data() );
+#ifdef EP_psych_stats
+		NumTimesCalled( iPsyWFnTdbH ) += n;
+#endif
+		for ( int i = 0; i < n; ++i ) {
+			w[ i ] = ( h[ i ] - 1.00484e3 * t[ i ] ) / ( 2.50094e6 + 1.85895e3 * t[ i ] );
+		}
+		for ( int i = 0; i < n; ++i ) {
+			if ( w[ i ] < 0.0 ) {
+#ifdef EP_psych_errors
+				if ( w[ i ] <= -0.0001 ) PsyWFnTdbH_error( t[ i ], h[ i ], w[ i ], blank_string );
+#endif
+				w[ i ] = 1.0e-5;
+			}
+		}
+
+	}
+
+	void
+	PsyPsatFnTemp(
+		Array1< Real64 > const & T, // dry-bulb temperatures {C}
+		Array1< Real64 > & Psat // saturation pressures {Pascals}
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saturation pressures for an array of temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// The piecewise fits do not vectorize, so this goes through the scalar function and
+		// its cache.
+
+		assert( Psat.size() == T.size() );
+		for ( int i = 1, e = T.isize(); i <= e; ++i ) {
+			Psat( i ) = PsyPsatFnTemp( T( i ) );
+		}
+
+	}
+
+	void
+	PsyTwbFnTdbWPb(
+		Array1< Real64 > const & Tdb, // dry-bulb temperatures {C}
+		Array1< Real64 > const & W, // humidity ratios
+		Real64 const Pb, // barometric pressure {Pascals}
+		Array1< Real64 > & Twb // wet-bulb temperatures {C}
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Wet-bulb temperatures for arrays of dry-bulb temperatures and humidity ratios at one
+		// barometric pressure.
+
+		// METHODOLOGY EMPLOYED:
+		// The iterative solution goes through the scalar function and its cache.
+
+		assert( ( Tdb.size() == W.size() ) && ( Twb.size() == Tdb.size() ) );
+		for ( int i = 1, e = Tdb.isize(); i <= e; ++i ) {
+			Twb( i ) = PsyTwbFnTdbWPb( Tdb( i ), W( i ), Pb );
+		}
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
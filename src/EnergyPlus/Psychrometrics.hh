@@ -67,13 +67,10 @@ namespace Psychrometrics {
 #endif
 
 #ifdef EP_cache_PsyTwbFnTdbWPb
-	extern int const twbcache_size;
-	extern int const twbprecision_bits;
+	extern int const twbcache_ways; // Entries in each set of the cache
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-	extern int const psatcache_size;
-	extern int const psatprecision_bits; // 28  //24  //32
-	extern Int64 const psatcache_mask;
+	extern int const psatcache_ways; // Entries in each set of the cache
 #endif
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -86,6 +83,22 @@ namespace Psychrometrics {
 #ifdef EP_psych_stats
 	extern Array1D< Int64 > NumTimesCalled;
 	extern Array1D_int NumIterations;
+#endif
+#ifdef EP_cache_PsyTwbFnTdbWPb
+	extern int twbcache_size; // Entries in the cache, a power of 2 no smaller than twbcache_ways
+	extern int twbprecision_bits; // Mantissa bits of the arguments kept in the cache tags
+	extern Int64 twbcache_mask; // Set number mask
+#ifdef EP_psych_stats
+	extern Int64 NumTwbCacheMisses;
+#endif
+#endif
+#ifdef EP_cache_PsyPsatFnTemp
+	extern int psatcache_size; // Entries in the cache, a power of 2 no smaller than psatcache_ways
+	extern int psatprecision_bits; // Mantissa bits of the argument kept in the cache tags
+	extern Int64 psatcache_mask; // Set number mask
+#ifdef EP_psych_stats
+	extern Int64 NumPsatCacheMisses;
+#endif
 #endif
 
 	// DERIVED TYPE DEFINITIONS
@@ -152,10 +165,10 @@ namespace Psychrometrics {
 
 	// Object Data
 #ifdef EP_cache_PsyTwbFnTdbWPb
-	extern Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
+	extern Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size-1), twbcache_ways entries per set
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-	extern Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+	extern Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size-1), psatcache_ways entries per set
 #endif
 
 	// Subroutine Specifications for the Module
@@ -165,6 +178,14 @@ namespace Psychrometrics {
 	void
 	InitializePsychRoutines();
 
+	void
+	SetPsychCacheSizes(
+		int const TwbCacheSize, // Entries of the wet-bulb cache
+		int const TwbPrecisionBits, // Mantissa bits kept by the wet-bulb cache
+		int const PsatCacheSize, // Entries of the saturation pressure cache
+		int const PsatPrecisionBits // Mantissa bits kept by the saturation pressure cache
+	);
+
 	void
 	ShowPsychrometricSummary();
 
@@ -353,9 +374,9 @@ namespace Psychrometrics {
 		// USAGE:  cpa = PsyCpAirFnWTdb(w,T)
 
 		// Static locals
-		static Real64 dwSave( -100.0 );
-		static Real64 Tsave( -100.0 );
-		static Real64 cpaSave( -100.0 );
+		static EP_THREAD_LOCAL Real64 dwSave( -100.0 );
+		static EP_THREAD_LOCAL Real64 Tsave( -100.0 );
+		static EP_THREAD_LOCAL Real64 cpaSave( -100.0 );
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -383,9 +404,9 @@ namespace Psychrometrics {
 		assert( dw >= 1.0e-5 );
 
 		// Static locals
-		static Real64 dwSave( -100.0 );
-		static Real64 Tsave( -100.0 );
-		static Real64 cpaSave( -100.0 );
+		static EP_THREAD_LOCAL Real64 dwSave( -100.0 );
+		static EP_THREAD_LOCAL Real64 Tsave( -100.0 );
+		static EP_THREAD_LOCAL Real64 cpaSave( -100.0 );
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -687,6 +708,13 @@ namespace Psychrometrics {
 		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
 	);
 
+	Real64
+	PsyPsatFnTemp_lookup(
+		Int64 const Tdb_tag, // cache tag of the dry-bulb temperature
+		Int64 const SetStart, // index in cached_Psat of the first entry of the set
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	);
+
 	inline
 	Real64
 	PsyPsatFnTemp(
@@ -707,30 +735,40 @@ namespace Psychrometrics {
 		// Use grid shifting and masking to provide hash into the cache. Use Equivalence to
 		// make Fortran ignore "types".
 
-		// FUNCTION PARAMETER DEFINITIONS:
-		//  integer(i64), parameter :: Grid_Mask=NOT(ISHFT(1_i64, Grid_Shift)-1)
-		Int64 const Grid_Shift( 28 ); //Tuned This is a hot spot
-		assert( Grid_Shift == 64 - 12 - psatprecision_bits ); // Force Grid_Shift updates when precision bits changes
+		// The most recently used entry of each set is checked here, the rest of the set by
+		// PsyPsatFnTemp_lookup.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Int64 const Grid_Shift( 64 - 12 - psatprecision_bits ); //Tuned This is a hot spot
 
 #ifdef EP_psych_stats
 		++NumTimesCalled( iPsyPsatFnTemp_cache );
 #endif
 
-		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-
 		Int64 const Tdb_tag( bit::bit_shift( TRANSFER( T, Grid_Shift ), -Grid_Shift ) ); // Note that 2nd arg to TRANSFER is not used: Only type matters
-//		Int64 const hash( bit::bit_and( Tdb_tag, psatcache_mask ) ); //Tuned Replaced by below
-		Int64 const hash( Tdb_tag & psatcache_mask );
-		auto & cPsat( cached_Psat( hash ) );
-
-		if ( cPsat.iTdb != Tdb_tag ) {
-			cPsat.iTdb = Tdb_tag;
-			Real64 Tdb_tag_r;
-			Tdb_tag_r = TRANSFER( bit::bit_shift( Tdb_tag, Grid_Shift ), Tdb_tag_r );
-			cPsat.Psat = PsyPsatFnTemp_raw( Tdb_tag_r, CalledFrom );
-		}
+		Int64 const hash( ( Tdb_tag & psatcache_mask ) * psatcache_ways );
+		auto const & cPsat( cached_Psat( hash ) );
 
-		return cPsat.Psat; // saturation pressure {Pascals}
+		if ( cPsat.iTdb == Tdb_tag ) return cPsat.Psat; // saturation pressure {Pascals}
+		return PsyPsatFnTemp_lookup( Tdb_tag, hash, CalledFrom );
+	}
+
+	inline
+	Real64
+	PsyPsatFnTemp_nocache(
+		Real64 const T, // dry-bulb temperature {C}
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	)
+	{
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the same saturation pressure as PsyPsatFnTemp without reading or changing the cache,
+		// for callers running on several threads.
+
+		Int64 const Grid_Shift( 64 - 12 - psatprecision_bits );
+		Int64 const Tdb_tag( bit::bit_shift( TRANSFER( T, Grid_Shift ), -Grid_Shift ) );
+		Real64 Tdb_tag_r;
+		Tdb_tag_r = TRANSFER( bit::bit_shift( Tdb_tag, Grid_Shift ), Tdb_tag_r );
+		return PsyPsatFnTemp_raw( Tdb_tag_r, CalledFrom );
 	}
 
 #else
@@ -741,6 +779,16 @@ namespace Psychrometrics {
 		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
 	);
 
+	inline
+	Real64
+	PsyPsatFnTemp_nocache(
+		Real64 const T, // dry-bulb temperature {C}
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	)
+	{
+		return PsyPsatFnTemp( T, CalledFrom );
+	}
+
 #endif
 
 	Real64
@@ -1281,6 +1329,59 @@ namespace Psychrometrics {
 		return 1000.1207 + 8.3215874e-04 * TB - 4.929976e-03 * pow_2( TB ) + 8.4791863e-06 * pow_3( TB );
 	}
 
+	// Batch versions of the functions above: each element of the result arrays is the scalar
+	// function of the same elements of the argument arrays, which must all have the same size
+
+	void
+	PsyRhoAirFnPbTdbW(
+		Real64 const pb, // barometric pressure (Pascals)
+		Array1< Real64 > const & tdb, // dry bulb temperatures (Celsius)
+		Array1< Real64 > const & dw, // humidity ratios (kgWater/kgDryAir)
+		Array1< Real64 > & rhoair // densities of air
+	);
+
+	void
+	PsyHFnTdbW(
+		Array1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		Array1< Real64 > const & dW, // humidity ratios
+		Array1< Real64 > & H // enthalpies {J/kg}
+	);
+
+	void
+	PsyCpAirFnWTdb(
+		Array1< Real64 > const & dw, // humidity ratios {kgWater/kgDryAir}
+		Array1< Real64 > const & T, // temperatures {Celsius}
+		Array1< Real64 > & cpa // heat capacities of air {J/kg-C}
+	);
+
+	void
+	PsyTdbFnHW(
+		Array1< Real64 > const & H, // enthalpies {J/kg}
+		Array1< Real64 > const & dW, // humidity ratios
+		Array1< Real64 > & Tdb // dry-bulb temperatures {C}
+	);
+
+	void
+	PsyWFnTdbH(
+		Array1< Real64 > const & TDB, // dry-bulb temperatures {C}
+		Array1< Real64 > const & H, // enthalpies {J/kg}
+		Array1< Real64 > & W // humidity ratios
+	);
+
+	void
+	PsyPsatFnTemp(
+		Array1< Real64 > const & T, // dry-bulb temperatures {C}
+		Array1< Real64 > & Psat // saturation pressures {Pascals}
+	);
+
+	void
+	PsyTwbFnTdbWPb(
+		Array1< Real64 > const & Tdb, // dry-bulb temperatures {C}
+		Array1< Real64 > const & W, // humidity ratios
+		Real64 const Pb, // barometric pressure {Pascals}
+		Array1< Real64 > & Twb // wet-bulb temperatures {C}
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -438,6 +438,7 @@ namespace RefrigeratedCase {
 	Array1D< AirChillerSetData > AirChillerSet;
 	Array1D< CoilCreditData > CoilSysCredit;
 	Array1D< CaseWIZoneReportData > CaseWIZoneReport;
+	Array1D< ZoneAirConditionsData > ZoneAirConditions; // By zone node
 
 	// Functions
 
@@ -7305,6 +7306,47 @@ namespace RefrigeratedCase {
 
 	//***************************************************************************************************
 
+	void
+	GetZoneAirConditions(
+		int const ZoneNodeNum, // Zone node number
+		Real64 & ZoneRHFrac, // Zone relative humidity (fraction)
+		Real64 & ZoneDewPoint // Zone dew point (C)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gives the relative humidity and dew point of the air at a zone node.
+
+		// METHODOLOGY EMPLOYED:
+		// The properties are kept by zone node and found again only when the node temperature, humidity ratio
+		// or the barometric pressure change, so the many cases and walk-ins of a zone share one evaluation.
+
+		// Using/Aliasing
+		using DataEnvironment::OutBaroPress;
+		using DataLoopNode::Node;
+		using DataLoopNode::NumOfNodes;
+		using Psychrometrics::PsyRhFnTdbWPb;
+		using Psychrometrics::PsyTdpFnWPb;
+
+		if ( ZoneAirConditions.isize() < NumOfNodes ) ZoneAirConditions.redimension( NumOfNodes );
+
+		auto & conditions( ZoneAirConditions( ZoneNodeNum ) );
+		auto const & node( Node( ZoneNodeNum ) );
+		if ( ! conditions.Valid || conditions.Temp != node.Temp || conditions.HumRat != node.HumRat || conditions.BaroPress != OutBaroPress ) {
+			conditions.Temp = node.Temp;
+			conditions.HumRat = node.HumRat;
+			conditions.BaroPress = OutBaroPress;
+			conditions.RHFrac = PsyRhFnTdbWPb( node.Temp, node.HumRat, OutBaroPress );
+			conditions.DewPoint = PsyTdpFnWPb( node.HumRat, OutBaroPress );
+			conditions.Valid = true;
+		}
+		ZoneRHFrac = conditions.RHFrac;
+		ZoneDewPoint = conditions.DewPoint;
+
+	}
+
+	//***************************************************************************************************
+
 	void
 	CalculateCase( int const CaseID ) // Absolute pointer to refrigerated case
 	{
@@ -7467,8 +7509,8 @@ namespace RefrigeratedCase {
 		//Set local subroutine variables for convenience
 		ActualZoneNum = RefrigCase( CaseID ).ActualZoneNum;
 		ZoneNodeNum = RefrigCase( CaseID ).ZoneNodeNum;
-		ZoneRHPercent = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress ) * 100.0;
-		ZoneDewPoint = PsyTdpFnWPb( Node( ZoneNodeNum ).HumRat, OutBaroPress );
+		GetZoneAirConditions( ZoneNodeNum, ZoneRHPercent, ZoneDewPoint );
+		ZoneRHPercent *= 100.0;
 		Length = RefrigCase( CaseID ).Length;
 		TCase = RefrigCase( CaseID ).Temperature;
 		DesignRatedCap = RefrigCase( CaseID ).DesignRatedCap;
@@ -11132,6 +11174,7 @@ namespace RefrigeratedCase {
 		static Real64 ZoneSensLoad( 0.0 ); // Sensible WalkIn credit delivered to a particular zone (W)
 		static Real64 ZoneLatentLoad( 0.0 ); // Latent WalkIn credit delivered to zone (W)
 		static Real64 ZoneRHFrac( 0.0 ); // Zone relative humidity fraction (decimal)
+		static Real64 ZoneDewPoint( 0.0 ); // Zone dew point (C)
 		static Real64 ZoneInfilLoad( 0.0 ); // Walk in cooler infiltration load (sens + latent) in certain zone (W)
 		static Real64 ZInfilSensLoad( 0.0 ); // Sensible load due to infiltration in one zone
 		static Real64 ZdoorSensLoad( 0.0 ); // Sensible load due to UA delta T through closed door in one zone
@@ -11194,7 +11237,7 @@ namespace RefrigeratedCase {
 
 			//Get infiltration loads if either type of door is present in this zone
 			if ( StockDoorArea > 0.0 || GlassDoorArea > 0.0 ) {
-				ZoneRHFrac = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress, RoutineName );
+				GetZoneAirConditions( ZoneNodeNum, ZoneRHFrac, ZoneDewPoint );
 				EnthalpyZoneAir = PsyHFnTdbRhPb( ZoneDryBulb, ZoneRHFrac, OutBaroPress, RoutineName );
 				HumRatioZoneAir = PsyWFnTdbH( ZoneDryBulb, EnthalpyZoneAir, RoutineName );
 				DensityZoneAir = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneDryBulb, HumRatioZoneAir, RoutineName );
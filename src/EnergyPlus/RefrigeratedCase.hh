@@ -3892,6 +3892,30 @@ namespace RefrigeratedCase {
 
 	};
 
+	struct ZoneAirConditionsData
+	{
+		// Moist air properties of a zone node shared by the cases, walk-ins and coils in the zone
+
+		// Members
+		Real64 Temp; // Zone node temperature the properties were found for (C)
+		Real64 HumRat; // Zone node humidity ratio the properties were found for (kg/kg)
+		Real64 BaroPress; // Barometric pressure the properties were found for (Pa)
+		Real64 RHFrac; // Zone relative humidity (fraction)
+		Real64 DewPoint; // Zone dew point (C)
+		bool Valid; // True once the properties have been found
+
+		// Default Constructor
+		ZoneAirConditionsData() :
+			Temp( 0.0 ),
+			HumRat( 0.0 ),
+			BaroPress( 0.0 ),
+			RHFrac( 0.0 ),
+			DewPoint( 0.0 ),
+			Valid( false )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< RefrigCaseData > RefrigCase;
 	extern Array1D< RefrigRackData > RefrigRack;
@@ -3911,6 +3935,7 @@ namespace RefrigeratedCase {
 	extern Array1D< AirChillerSetData > AirChillerSet;
 	extern Array1D< CoilCreditData > CoilSysCredit;
 	extern Array1D< CaseWIZoneReportData > CaseWIZoneReport;
+	extern Array1D< ZoneAirConditionsData > ZoneAirConditions; // By zone node
 
 	// Functions
 
@@ -3950,6 +3975,15 @@ namespace RefrigeratedCase {
 
 	//***************************************************************************************************
 
+	void
+	GetZoneAirConditions(
+		int const ZoneNodeNum, // Zone node number
+		Real64 & ZoneRHFrac, // Zone relative humidity (fraction)
+		Real64 & ZoneDewPoint // Zone dew point (C)
+	);
+
+	//***************************************************************************************************
+
 	void
 	CalculateCase( int const CaseID ); // Absolute pointer to refrigerated case
 
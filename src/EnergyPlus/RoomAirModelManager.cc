@@ -1475,6 +1475,15 @@ namespace RoomAirModelManager {
 			ZoneCeilingHeight.allocate( NumOfZones * 2 );
 			ZoneCeilingHeight = 0.0;
 
+			// Vertical extent of the surfaces, used by the convection coefficients of the models
+			SurfMinZ.dimension( TotSurfaces, 0.0 );
+			SurfMaxZ.dimension( TotSurfaces, 0.0 );
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) continue;
+				SurfMinZ( SurfNum ) = minval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
+				SurfMaxZ( SurfNum ) = maxval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
+			}
+
 			// Arrays initializations
 			APos_Wall = 0;
 			APos_Floor = 0;
@@ -1510,8 +1519,8 @@ namespace RoomAirModelManager {
 				for ( SurfNum = Zone( ZNum ).SurfaceFirst; SurfNum <= Zone( ZNum ).SurfaceLast; ++SurfNum ) {
 					if ( Surface( SurfNum ).Class != SurfaceClass_IntMass ) {
 						// Recalculate lowest and highest height for the zone
-						Z1Zone = minval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
-						Z2Zone = maxval( Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} ).z() );
+						Z1Zone = SurfMinZ( SurfNum );
+						Z2Zone = SurfMaxZ( SurfNum );
 					}
 
 					if ( SetZoneAux ) {
@@ -1,5 +1,7 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 
 // ObjexxFCL Headers
@@ -20,6 +22,7 @@
 #include <DataHeatBalance.hh>
 #include <DataHVACGlobals.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -116,6 +119,10 @@ namespace RuntimeLanguageProcessor {
 	int ActualTimeNum( 0 );
 	int WarmUpFlagNum( 0 );
 
+	int CompiledNumExpressions( -1 ); // count of Erl expressions when ErlCompiledExpression was built
+	int CompiledNumErlVariables( -1 ); // count of Erl variables when ErlCompiledExpression was built
+	Real64 ProfileNestedTime( 0.0 ); // wall time spent in the subroutines run by the stack being profiled (s)
+
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
 
@@ -815,6 +822,9 @@ namespace RuntimeLanguageProcessor {
 		// Runs a stack with the interpreter.
 
 		// METHODOLOGY EMPLOYED:
+		// When profiling, the wall time of the stack is added to its statistics; the time of the
+		// subroutines it runs is gathered in ProfileNestedTime so it can be taken out of the self time.
+
 		// Using/Aliasing
 
 		// Return value
@@ -830,6 +840,15 @@ namespace RuntimeLanguageProcessor {
 		Real64 ReturnValueActual; // for testing
 		static int VariableNum;
 		int WhileLoopExitCounter; // to avoid infinite loop in While loop
+		Int64 NumInstructionsRun( 0 ); // count of instructions run, for profiling
+		std::chrono::steady_clock::time_point StartTime; // start of the run, for profiling
+		Real64 OuterNestedTime( 0.0 ); // subroutine time of the stack that ran this one, for profiling
+
+		if ( OutputEMSProfile ) {
+			OuterNestedTime = ProfileNestedTime;
+			ProfileNestedTime = 0.0;
+			StartTime = std::chrono::steady_clock::now();
+		}
 
 		WhileLoopExitCounter = 0;
 		ReturnValue.Type = ValueNumber;
@@ -837,6 +856,7 @@ namespace RuntimeLanguageProcessor {
 
 		InstructionNum = 1;
 		while ( InstructionNum <= ErlStack( StackNum ).NumInstructions ) {
+			++NumInstructionsRun;
 
 			{ auto const SELECT_CASE_var( ErlStack( StackNum ).Instruction( InstructionNum ).Keyword );
 
@@ -844,14 +864,14 @@ namespace RuntimeLanguageProcessor {
 				// There probably shouldn't be any of these
 
 			} else if ( SELECT_CASE_var == KeywordReturn ) {
-				if ( ErlStack( StackNum ).Instruction( InstructionNum ).Argument1 > 0 ) ReturnValue = EvaluateExpression( ErlStack( StackNum ).Instruction( InstructionNum ).Argument1 );
+				if ( ErlStack( StackNum ).Instruction( InstructionNum ).Argument1 > 0 ) ReturnValue = EvaluateCompiledExpression( ErlStack( StackNum ).Instruction( InstructionNum ).Argument1 );
 
 				WriteTrace( StackNum, InstructionNum, ReturnValue );
 				break; // RETURN always terminates an instruction stack
 
 			} else if ( SELECT_CASE_var == KeywordSet ) {
 
-				ReturnValue = EvaluateExpression( ErlStack( StackNum ).Instruction( InstructionNum ).Argument2 );
+				ReturnValue = EvaluateCompiledExpression( ErlStack( StackNum ).Instruction( InstructionNum ).Argument2 );
 				VariableNum = ErlStack( StackNum ).Instruction( InstructionNum ).Argument1;
 				if ( ( ! ErlVariable( VariableNum ).ReadOnly ) && ( ! ErlVariable( VariableNum ).Value.TrendVariable ) ) {
 					ErlVariable( VariableNum ).Value = ReturnValue;
@@ -873,7 +893,7 @@ namespace RuntimeLanguageProcessor {
 				InstructionNum2 = ErlStack( StackNum ).Instruction( InstructionNum ).Argument2;
 
 				if ( ExpressionNum > 0 ) { // could be 0 if this was an ELSE
-					ReturnValue = EvaluateExpression( ExpressionNum );
+					ReturnValue = EvaluateCompiledExpression( ExpressionNum );
 					WriteTrace( StackNum, InstructionNum, ReturnValue );
 					if ( ReturnValue.Number == 0.0 ) { //  This is the FALSE case
 						// Eventually should handle strings and arrays too
@@ -906,7 +926,7 @@ namespace RuntimeLanguageProcessor {
 				// evaluate expresssion at while, skip to past endwhile if not true
 				ExpressionNum = ErlStack( StackNum ).Instruction( InstructionNum ).Argument1;
 				InstructionNum2 = ErlStack( StackNum ).Instruction( InstructionNum ).Argument2;
-				ReturnValue = EvaluateExpression( ExpressionNum );
+				ReturnValue = EvaluateCompiledExpression( ExpressionNum );
 				WriteTrace( StackNum, InstructionNum, ReturnValue );
 				if ( ReturnValue.Number == 0.0 ) { //  This is the FALSE case
 					// Eventually should handle strings and arrays too
@@ -918,7 +938,7 @@ namespace RuntimeLanguageProcessor {
 				// reevaluate expression at While and goto there if true, otherwise continue
 				ExpressionNum = ErlStack( StackNum ).Instruction( InstructionNum ).Argument1;
 				InstructionNum2 = ErlStack( StackNum ).Instruction( InstructionNum ).Argument2;
-				ReturnValue = EvaluateExpression( ExpressionNum );
+				ReturnValue = EvaluateCompiledExpression( ExpressionNum );
 				if ( ( ReturnValue.Number != 0.0 ) && ( WhileLoopExitCounter <= MaxWhileLoopIterations ) ) { //  This is the True case
 					// Eventually should handle strings and arrays too
 					WriteTrace( StackNum, InstructionNum, ReturnValue ); // duplicative?
@@ -949,6 +969,16 @@ namespace RuntimeLanguageProcessor {
 
 		ReturnValueActual = ( 4.91 + 632.0 ) / ( 32.0 * ( 4.0 - 10.2 ) ); // must have extra periods
 
+		if ( OutputEMSProfile && StackNum <= ErlStackProfile.isize() ) {
+			Real64 const Elapsed( std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - StartTime ).count() );
+			auto & profile( ErlStackProfile( StackNum ) );
+			++profile.NumCalls;
+			profile.NumInstructions += NumInstructionsRun;
+			profile.Time += Elapsed;
+			profile.SelfTime += max( Elapsed - ProfileNestedTime, 0.0 );
+			ProfileNestedTime = OuterNestedTime + Elapsed;
+		}
+
 		return ReturnValue;
 
 	}
@@ -2435,6 +2465,435 @@ namespace RuntimeLanguageProcessor {
 
 	}
 
+	void
+	CompileErlExpressions()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Compiles every Erl expression for EvaluateCompiledExpression.
+
+		// METHODOLOGY EMPLOYED:
+		// The compiled code points into ErlVariable and ErlExpression, so it is built again whenever
+		// either has grown since.
+
+		ErlCompiledExpression.deallocate();
+		ErlCompiledExpression.allocate( NumExpressions );
+		for ( int ExpressionNum = 1; ExpressionNum <= NumExpressions; ++ExpressionNum ) {
+			CompileExpression( ExpressionNum );
+		}
+		CompiledNumExpressions = NumExpressions;
+		CompiledNumErlVariables = NumErlVariables;
+
+	}
+
+	void
+	CompileExpression( int const ExpressionNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Flattens the tree of an expression into operations on a register file.
+
+		// METHODOLOGY EMPLOYED:
+		// A literal gives back its operand as is (an Erl variable value keeps its trend and error
+		// fields), so nested literals are followed to the value they give back.  Otherwise the tree
+		// is compiled depth first, as EvaluateExpression evaluates it.  Expressions using the random
+		// number, error reporting or trend functions, or anything else the compiler does not know,
+		// are left uncompiled and go to the tree interpreter.
+
+		auto & Compiled( ErlCompiledExpression( ExpressionNum ) );
+		Compiled = ErlCompiledExpressionType();
+
+		int RootNum( ExpressionNum );
+		while ( ( RootNum > 0 ) && ( ErlExpression( RootNum ).Operator == OperatorLiteral ) ) {
+			if ( ErlExpression( RootNum ).NumOperands < 1 ) return;
+			auto const & Operand( ErlExpression( RootNum ).Operand( 1 ) );
+			if ( Operand.Type == ValueExpression ) {
+				RootNum = Operand.Expression;
+			} else {
+				if ( Operand.Type == ValueVariable ) {
+					if ( ( Operand.Variable < 1 ) || ( Operand.Variable > NumErlVariables ) ) return;
+					Compiled.CopyValue = &ErlVariable( Operand.Variable ).Value;
+				} else {
+					Compiled.CopyValue = &Operand;
+				}
+				Compiled.Compiled = true;
+				return;
+			}
+		}
+
+		std::vector< bool > Constant;
+		int Result;
+		if ( RootNum > 0 ) {
+			Result = CompileExpressionNode( RootNum, Compiled, Constant );
+		} else { // an empty expression evaluates to zero
+			Result = AddErlRegister( Compiled, Constant, ErlRegisterType( ValueNumber, 0.0 ), true );
+		}
+		if ( Result < 0 ) {
+			Compiled = ErlCompiledExpressionType();
+			return;
+		}
+		Compiled.Result = Result;
+		Compiled.Compiled = true;
+
+	}
+
+	int
+	CompileExpressionNode(
+		int const ExpressionNum, // expression to compile
+		ErlCompiledExpressionType & Compiled, // code being built
+		std::vector< bool > & Constant // true for the registers that hold constants
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Adds the operations of an expression and its operands to the compiled code; returns the
+		// register holding its value, or -1 if the expression cannot be compiled.
+
+		// METHODOLOGY EMPLOYED:
+		// An operation on constants only is done right away when it gives a number (constant
+		// folding).  The curve and psychrometric functions are always left to run time.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxCodeOperands( 6 ); // most operands of a built-in function (@CurveValue)
+
+		auto const & Expression( ErlExpression( ExpressionNum ) );
+		int const Operator( Expression.Operator );
+		int const NumOperands( Expression.NumOperands );
+
+		if ( Operator == OperatorLiteral ) {
+			if ( NumOperands < 1 ) return -1;
+			return CompileExpressionOperand( Expression.Operand( 1 ), Compiled, Constant );
+		}
+
+		bool const Compiles( ( ( Operator >= OperatorNegative ) && ( Operator <= FuncABS ) ) || ( ( Operator >= FuncRhoAirFnPbTdbW ) && ( Operator <= FuncRhoH2O ) && ( Operator != FuncTsatFnPb ) ) || ( Operator == FuncCurveValue ) );
+		if ( ( ! Compiles ) || ( NumOperands < 1 ) || ( NumOperands > MaxCodeOperands ) ) return -1;
+
+		int OperandRegister[ MaxCodeOperands ];
+		bool AllConstant( true );
+		for ( int OperandNum = 1; OperandNum <= NumOperands; ++OperandNum ) {
+			int const Register( CompileExpressionOperand( Expression.Operand( OperandNum ), Compiled, Constant ) );
+			if ( Register < 0 ) return -1;
+			OperandRegister[ OperandNum - 1 ] = Register;
+			if ( ! Constant[ Register ] ) AllConstant = false;
+		}
+
+		ErlCodeType Code;
+		Code.Operator = Operator;
+		Code.FirstOperand = int( Compiled.Operands.size() );
+		Code.NumOperands = NumOperands;
+		Compiled.Operands.insert( Compiled.Operands.end(), OperandRegister, OperandRegister + NumOperands );
+
+		if ( AllConstant && ( Operator <= FuncABS ) ) {
+			ErlRegisterType const Value( EvaluateErlCode( Code, Compiled.Operands, Compiled.Registers ) );
+			if ( Value.Type == ValueNumber ) { // errors are left to run time, where their message is made
+				Compiled.Operands.resize( Code.FirstOperand );
+				return AddErlRegister( Compiled, Constant, Value, true );
+			}
+		}
+
+		Code.Result = AddErlRegister( Compiled, Constant, ErlRegisterType(), false );
+		Compiled.Code.push_back( Code );
+		return Code.Result;
+
+	}
+
+	int
+	CompileExpressionOperand(
+		ErlValueType const & Operand, // operand of an Erl expression
+		ErlCompiledExpressionType & Compiled, // code being built
+		std::vector< bool > & Constant // true for the registers that hold constants
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the register holding the value of an operand, or -1 if it cannot be compiled.
+
+		// METHODOLOGY EMPLOYED:
+		// Each Erl variable the expression reads is loaded once into its own register, straight
+		// from its value (sensors, internal variables and globals alike).
+
+		if ( Operand.Type == ValueExpression ) {
+			if ( Operand.Expression > 0 ) return CompileExpressionNode( Operand.Expression, Compiled, Constant );
+			return AddErlRegister( Compiled, Constant, ErlRegisterType( ValueNumber, 0.0 ), true );
+		} else if ( Operand.Type == ValueVariable ) {
+			if ( ( Operand.Variable < 1 ) || ( Operand.Variable > NumErlVariables ) ) return -1;
+			ErlValueType const * Value( &ErlVariable( Operand.Variable ).Value );
+			for ( std::size_t Load = 0; Load < Compiled.LoadValues.size(); ++Load ) {
+				if ( Compiled.LoadValues[ Load ] == Value ) return Compiled.LoadRegisters[ Load ];
+			}
+			int const Register( AddErlRegister( Compiled, Constant, ErlRegisterType(), false ) );
+			Compiled.LoadRegisters.push_back( Register );
+			Compiled.LoadValues.push_back( Value );
+			return Register;
+		} else {
+			return AddErlRegister( Compiled, Constant, ErlRegisterType( Operand.Type, Operand.Number ), true );
+		}
+
+	}
+
+	int
+	AddErlRegister(
+		ErlCompiledExpressionType & Compiled, // code being built
+		std::vector< bool > & Constant, // true for the registers that hold constants
+		ErlRegisterType const & Value, // initial value of the register
+		bool const IsConstant // true if the register holds a constant
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Adds a register to the compiled code and returns its index.
+
+		Compiled.Registers.push_back( Value );
+		Constant.push_back( IsConstant );
+		return int( Compiled.Registers.size() ) - 1;
+
+	}
+
+	ErlRegisterType
+	EvaluateErlCode(
+		ErlCodeType const & Code, // operation to run
+		std::vector< int > const & Operands, // operand registers of the compiled expression
+		std::vector< ErlRegisterType > const & Register // register file
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Runs one operation of a compiled expression.
+
+		// METHODOLOGY EMPLOYED:
+		// Follows EvaluateExpression case by case on the value types and numbers, so the results are
+		// the same to the bit.  An error only sets the type; EvaluateCompiledExpression makes the
+		// message when the error is the value of the expression.
+
+		// Using/Aliasing
+		using DataGlobals::DegToRadians;
+		using namespace Psychrometrics;
+		using CurveManager::CurveValue;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const EMSBuiltInFunction( "EMS Built-In Function" );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Type[ 6 ]; // operand value types
+		Real64 X[ 6 ]; // operand numbers
+		for ( int OperandNum = 0; OperandNum < Code.NumOperands; ++OperandNum ) {
+			auto const & Operand( Register[ Operands[ Code.FirstOperand + OperandNum ] ] );
+			Type[ OperandNum ] = Operand.Type;
+			X[ OperandNum ] = Operand.Number;
+		}
+		ErlRegisterType ReturnValue( ValueNumber, 0.0 );
+		ErlRegisterType const TrueValue( True.Type, True.Number );
+		ErlRegisterType const FalseValue( False.Type, False.Number );
+		int const Operator( Code.Operator );
+
+		if ( Operator <= OperatiorLogicalOR ) { // operators
+			bool const Numbers( ( Type[ 0 ] == ValueNumber ) && ( Code.NumOperands >= 2 ) && ( Type[ 1 ] == ValueNumber ) );
+			if ( Operator == OperatorNegative ) {
+				ReturnValue.Number = -1.0 * X[ 0 ];
+			} else if ( Operator == OperatorMultiply ) {
+				if ( Numbers ) ReturnValue.Number = X[ 0 ] * X[ 1 ];
+			} else if ( Operator == OperatorAdd ) {
+				if ( Numbers ) ReturnValue.Number = X[ 0 ] + X[ 1 ];
+			} else if ( Operator == OperatorSubtract ) {
+				if ( Numbers ) ReturnValue.Number = X[ 0 ] - X[ 1 ];
+			} else if ( Operator == OperatorDivide ) {
+				if ( Numbers ) {
+					if ( X[ 1 ] == 0.0 ) {
+						ReturnValue.Type = ValueError;
+					} else {
+						ReturnValue.Number = X[ 0 ] / X[ 1 ];
+					}
+				}
+			} else if ( Operator == OperatorEqual ) {
+				if ( ( Type[ 0 ] == Type[ 1 ] ) && ( ( Type[ 0 ] == ValueNull ) || ( ( Type[ 0 ] == ValueNumber ) && ( X[ 0 ] == X[ 1 ] ) ) ) ) {
+					ReturnValue = TrueValue;
+				} else {
+					ReturnValue = FalseValue;
+				}
+			} else if ( Operator == OperatorNotEqual ) {
+				if ( Numbers ) ReturnValue = ( X[ 0 ] != X[ 1 ] ) ? TrueValue : FalseValue;
+			} else if ( Operator == OperatorLessOrEqual ) {
+				if ( Numbers ) ReturnValue = ( X[ 0 ] <= X[ 1 ] ) ? TrueValue : FalseValue;
+			} else if ( Operator == OperatorGreaterOrEqual ) {
+				if ( Numbers ) ReturnValue = ( X[ 0 ] >= X[ 1 ] ) ? TrueValue : FalseValue;
+			} else if ( Operator == OperatorLessThan ) {
+				if ( Numbers ) ReturnValue = ( X[ 0 ] < X[ 1 ] ) ? TrueValue : FalseValue;
+			} else if ( Operator == OperatorGreaterThan ) {
+				if ( Numbers ) ReturnValue = ( X[ 0 ] > X[ 1 ] ) ? TrueValue : FalseValue;
+			} else if ( Operator == OperatorRaiseToPower ) {
+				if ( Numbers ) {
+					ReturnValue.Number = std::pow( X[ 0 ], X[ 1 ] );
+					if ( std::isnan( ReturnValue.Number ) ) {
+						ReturnValue.Type = ValueError;
+						ReturnValue.Number = 0.0;
+					}
+				}
+			} else if ( Operator == OperatorLogicalAND ) {
+				if ( Numbers ) ReturnValue = ( ( X[ 0 ] == True.Number ) && ( X[ 1 ] == True.Number ) ) ? TrueValue : FalseValue;
+			} else if ( Operator == OperatiorLogicalOR ) {
+				if ( Numbers ) ReturnValue = ( ( X[ 0 ] == True.Number ) || ( X[ 1 ] == True.Number ) ) ? TrueValue : FalseValue;
+			}
+		} else if ( Operator <= FuncABS ) { // math functions
+			if ( Operator == FuncRound ) {
+				ReturnValue.Number = nint( X[ 0 ] );
+			} else if ( Operator == FuncMod ) {
+				ReturnValue.Number = mod( X[ 0 ], X[ 1 ] );
+			} else if ( Operator == FuncSin ) {
+				ReturnValue.Number = std::sin( X[ 0 ] );
+			} else if ( Operator == FuncCos ) {
+				ReturnValue.Number = std::cos( X[ 0 ] );
+			} else if ( Operator == FuncArcSin ) {
+				ReturnValue.Number = std::asin( X[ 0 ] );
+			} else if ( Operator == FuncArcCos ) {
+				ReturnValue.Number = std::acos( X[ 0 ] );
+			} else if ( Operator == FuncDegToRad ) {
+				ReturnValue.Number = X[ 0 ] * DegToRadians;
+			} else if ( Operator == FuncRadToDeg ) {
+				ReturnValue.Number = X[ 0 ] / DegToRadians;
+			} else if ( Operator == FuncExp ) {
+				if ( X[ 0 ] < 700.0 ) {
+					ReturnValue.Number = std::exp( X[ 0 ] );
+				} else {
+					ReturnValue.Type = ValueError;
+				}
+			} else if ( Operator == FuncLn ) {
+				if ( X[ 0 ] > 0.0 ) {
+					ReturnValue.Number = std::log( X[ 0 ] );
+				} else {
+					ReturnValue.Type = ValueError;
+				}
+			} else if ( Operator == FuncMax ) {
+				ReturnValue.Number = max( X[ 0 ], X[ 1 ] );
+			} else if ( Operator == FuncMin ) {
+				ReturnValue.Number = min( X[ 0 ], X[ 1 ] );
+			} else if ( Operator == FuncABS ) {
+				ReturnValue.Number = std::abs( X[ 0 ] );
+			}
+		} else if ( Operator == FuncCurveValue ) {
+			ReturnValue.Number = CurveValue( std::floor( X[ 0 ] ), X[ 1 ], X[ 2 ], X[ 3 ], X[ 4 ], X[ 5 ] );
+		} else if ( Operator == FuncRhoAirFnPbTdbW ) {
+			ReturnValue.Number = PsyRhoAirFnPbTdbW( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncCpAirFnWTdb ) {
+			ReturnValue.Number = PsyCpAirFnWTdb( X[ 0 ], X[ 1 ] );
+		} else if ( Operator == FuncHfgAirFnWTdb ) {
+			ReturnValue.Number = PsyHfgAirFnWTdb( X[ 0 ], X[ 1 ] );
+		} else if ( Operator == FuncHgAirFnWTdb ) {
+			ReturnValue.Number = PsyHgAirFnWTdb( X[ 0 ], X[ 1 ] );
+		} else if ( Operator == FuncTdpFnTdbTwbPb ) {
+			ReturnValue.Number = PsyTdpFnTdbTwbPb( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncTdpFnWPb ) {
+			ReturnValue.Number = PsyTdpFnWPb( X[ 0 ], X[ 1 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncHFnTdbW ) {
+			ReturnValue.Number = PsyHFnTdbW( X[ 0 ], X[ 1 ] );
+		} else if ( Operator == FuncHFnTdbRhPb ) {
+			ReturnValue.Number = PsyHFnTdbRhPb( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncTdbFnHW ) {
+			ReturnValue.Number = PsyTdbFnHW( X[ 0 ], X[ 1 ] );
+		} else if ( Operator == FuncRhovFnTdbRh ) {
+			ReturnValue.Number = PsyRhovFnTdbRh( X[ 0 ], X[ 1 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncRhovFnTdbRhLBnd0C ) {
+			ReturnValue.Number = PsyRhovFnTdbRhLBnd0C( X[ 0 ], X[ 1 ] );
+		} else if ( Operator == FuncRhovFnTdbWPb ) {
+			ReturnValue.Number = PsyRhovFnTdbWPb( X[ 0 ], X[ 1 ], X[ 2 ] );
+		} else if ( Operator == FuncRhFnTdbRhov ) {
+			ReturnValue.Number = PsyRhFnTdbRhov( X[ 0 ], X[ 1 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncRhFnTdbRhovLBnd0C ) {
+			ReturnValue.Number = PsyRhFnTdbRhovLBnd0C( X[ 0 ], X[ 1 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncRhFnTdbWPb ) {
+			ReturnValue.Number = PsyRhFnTdbWPb( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncTwbFnTdbWPb ) {
+			ReturnValue.Number = PsyTwbFnTdbWPb( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncVFnTdbWPb ) {
+			ReturnValue.Number = PsyVFnTdbWPb( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncWFnTdpPb ) {
+			ReturnValue.Number = PsyWFnTdpPb( X[ 0 ], X[ 1 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncWFnTdbH ) {
+			ReturnValue.Number = PsyWFnTdbH( X[ 0 ], X[ 1 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncWFnTdbTwbPb ) {
+			ReturnValue.Number = PsyWFnTdbTwbPb( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncWFnTdbRhPb ) {
+			ReturnValue.Number = PsyWFnTdbRhPb( X[ 0 ], X[ 1 ], X[ 2 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncPsatFnTemp ) {
+			ReturnValue.Number = PsyPsatFnTemp( X[ 0 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncTsatFnHPb ) {
+			ReturnValue.Number = PsyTsatFnHPb( X[ 0 ], X[ 1 ], EMSBuiltInFunction );
+		} else if ( Operator == FuncCpCW ) {
+			ReturnValue.Number = CPCW( X[ 0 ] );
+		} else if ( Operator == FuncCpHW ) {
+			ReturnValue.Number = CPHW( X[ 0 ] );
+		} else if ( Operator == FuncRhoH2O ) {
+			ReturnValue.Number = RhoH2O( X[ 0 ] );
+		}
+
+		return ReturnValue;
+
+	}
+
+	ErlValueType
+	EvaluateCompiledExpression( int const ExpressionNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Evaluates an expression from its compiled code, giving the same value as EvaluateExpression.
+
+		// METHODOLOGY EMPLOYED:
+		// The register file is set from the constants and the Erl variables the expression reads
+		// and the operations run in order, with no allocation once the register file has grown to
+		// the largest expression.  Only an error value carries a string; its message is made from
+		// the last operation, which is the one that gave the value of the expression.
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		// Return value
+		ErlValueType ReturnValue;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static std::vector< ErlRegisterType > Register; // register file
+
+		ReturnValue.Type = ValueNumber;
+		ReturnValue.Number = 0.0;
+		if ( ExpressionNum <= 0 ) return ReturnValue;
+
+		if ( ( CompiledNumExpressions != NumExpressions ) || ( CompiledNumErlVariables != NumErlVariables ) ) CompileErlExpressions();
+		auto const & Compiled( ErlCompiledExpression( ExpressionNum ) );
+		if ( ! Compiled.Compiled ) return EvaluateExpression( ExpressionNum );
+		if ( Compiled.CopyValue != nullptr ) return *Compiled.CopyValue;
+
+		Register = Compiled.Registers;
+		for ( std::size_t Load = 0, NumLoads = Compiled.LoadRegisters.size(); Load < NumLoads; ++Load ) {
+			auto & Value( Register[ Compiled.LoadRegisters[ Load ] ] );
+			Value.Type = Compiled.LoadValues[ Load ]->Type;
+			Value.Number = Compiled.LoadValues[ Load ]->Number;
+		}
+		for ( auto const & Code : Compiled.Code ) {
+			Register[ Code.Result ] = EvaluateErlCode( Code, Compiled.Operands, Register );
+		}
+
+		auto const & Result( Register[ Compiled.Result ] );
+		if ( Result.Type == ValueError ) {
+			auto const & Code( Compiled.Code.back() );
+			Real64 const X1( Register[ Compiled.Operands[ Code.FirstOperand ] ].Number );
+			ReturnValue.Type = ValueError;
+			if ( Code.Operator == OperatorDivide ) {
+				ReturnValue.Error = "Divide by zero!";
+			} else if ( Code.Operator == OperatorRaiseToPower ) {
+				Real64 const X2( Register[ Compiled.Operands[ Code.FirstOperand + 1 ] ].Number );
+				ReturnValue.Error = "Attempted to raise to power with incompatible numbers: " + TrimSigDigits( X1, 6 ) + " raised to " + TrimSigDigits( X2, 6 );
+			} else if ( Code.Operator == FuncExp ) {
+				ReturnValue.Error = "Attempted to calculate exponential value of too large a number: " + TrimSigDigits( X1, 4 );
+			} else if ( Code.Operator == FuncLn ) {
+				ReturnValue.Error = "Natural Log of zero or less!";
+			}
+		} else {
+			ReturnValue.Type = Result.Type;
+			ReturnValue.Number = Result.Number;
+		}
+
+		return ReturnValue;
+
+	}
+
 	void
 	GetRuntimeLanguageUserInput()
 	{
@@ -2727,6 +3186,7 @@ namespace RuntimeLanguageProcessor {
 
 			NumErlStacks = NumErlPrograms + NumErlSubroutines;
 			ErlStack.allocate( NumErlStacks );
+			ErlStackProfile.allocate( NumErlStacks );
 
 			if ( NumErlPrograms > 0 ) {
 				cCurrentModuleObject = "EnergyManagementSystem:Program";
@@ -3294,6 +3754,45 @@ namespace RuntimeLanguageProcessor {
 
 	}
 
+	void
+	ReportRuntimeLanguageProfile()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the run time statistics of the Erl programs and subroutines to a CSV file next
+		// to the EDD file, the stacks taking the most time first.
+
+		// Using/Aliasing
+		using DataStringGlobals::outputEmsCsvFileName;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FileUnit;
+		std::vector< int > StackOrder; // stacks by decreasing self time
+
+		if ( ! OutputEMSProfile || NumErlStacks == 0 || ErlStackProfile.isize() < NumErlStacks ) return;
+
+		FileUnit = GetNewUnitNumber();
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( FileUnit, outputEmsCsvFileName, flags ); if ( flags.err() ) goto Label100; }
+
+		for ( int StackNum = 1; StackNum <= NumErlStacks; ++StackNum ) StackOrder.push_back( StackNum );
+		std::stable_sort( StackOrder.begin(), StackOrder.end(), []( int const a, int const b ){ return ErlStackProfile( a ).SelfTime > ErlStackProfile( b ).SelfTime; } );
+
+		gio::write( FileUnit, fmtA ) << "Name,Type,Calls,Instructions,Time {s},Self Time {s},Self Time per Call {s}";
+		for ( int const StackNum : StackOrder ) {
+			auto const & profile( ErlStackProfile( StackNum ) );
+			gio::write( FileUnit, fmtA ) << ErlStack( StackNum ).Name + ',' + ( StackNum <= NumErlPrograms ? "Program" : "Subroutine" ) + ',' + std::to_string( profile.NumCalls ) + ',' + std::to_string( profile.NumInstructions ) + ',' + RoundSigDigits( profile.Time, 6 ) + ',' + RoundSigDigits( profile.SelfTime, 6 ) + ',' + RoundSigDigits( ( profile.NumCalls > 0 ? profile.SelfTime / double( profile.NumCalls ) : 0.0 ), 9 );
+		}
+
+		gio::close( FileUnit );
+
+		return;
+
+Label100: ;
+		ShowWarningError( "ReportRuntimeLanguageProfile: Could not open file \"" + outputEmsCsvFileName + "\" for output (write)." );
+
+	}
+
 	std::string
 	IntegerToString( int const Number )
 	{
@@ -1,6 +1,9 @@
 #ifndef RuntimeLanguageProcessor_hh_INCLUDED
 #define RuntimeLanguageProcessor_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -86,6 +89,10 @@ namespace RuntimeLanguageProcessor {
 	extern int ActualTimeNum;
 	extern int WarmUpFlagNum;
 
+	extern int CompiledNumExpressions; // count of Erl expressions when ErlCompiledExpression was built
+	extern int CompiledNumErlVariables; // count of Erl variables when ErlCompiledExpression was built
+	extern Real64 ProfileNestedTime; // wall time spent in the subroutines run by the stack being profiled (s)
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Types
@@ -230,12 +237,53 @@ namespace RuntimeLanguageProcessor {
 	ErlValueType
 	EvaluateExpression( int const ExpressionNum );
 
+	void
+	CompileErlExpressions();
+
+	void
+	CompileExpression( int const ExpressionNum );
+
+	int
+	CompileExpressionNode(
+		int const ExpressionNum, // expression to compile
+		DataRuntimeLanguage::ErlCompiledExpressionType & Compiled, // code being built
+		std::vector< bool > & Constant // true for the registers that hold constants
+	);
+
+	int
+	CompileExpressionOperand(
+		ErlValueType const & Operand, // operand of an Erl expression
+		DataRuntimeLanguage::ErlCompiledExpressionType & Compiled, // code being built
+		std::vector< bool > & Constant // true for the registers that hold constants
+	);
+
+	int
+	AddErlRegister(
+		DataRuntimeLanguage::ErlCompiledExpressionType & Compiled, // code being built
+		std::vector< bool > & Constant, // true for the registers that hold constants
+		DataRuntimeLanguage::ErlRegisterType const & Value, // initial value of the register
+		bool const IsConstant // true if the register holds a constant
+	);
+
+	DataRuntimeLanguage::ErlRegisterType
+	EvaluateErlCode(
+		DataRuntimeLanguage::ErlCodeType const & Code, // operation to run
+		std::vector< int > const & Operands, // operand registers of the compiled expression
+		std::vector< DataRuntimeLanguage::ErlRegisterType > const & Register // register file
+	);
+
+	ErlValueType
+	EvaluateCompiledExpression( int const ExpressionNum );
+
 	void
 	GetRuntimeLanguageUserInput();
 
 	void
 	ReportRuntimeLanguage();
 
+	void
+	ReportRuntimeLanguageProfile();
+
 	std::string
 	IntegerToString( int const Number );
 
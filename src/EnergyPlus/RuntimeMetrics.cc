@@ -0,0 +1,257 @@
+// C++ Headers
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+// EnergyPlus Headers
+#include <RuntimeMetrics.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataReportingFlags.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <MemoryReport.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace RuntimeMetrics {
+
+	// PURPOSE OF THIS MODULE:
+	// Live metrics of a running simulation, so that a model running far slower than expected, or
+	// failing to converge, can be found and stopped long before its allotted wall time runs out.
+
+	// METHODOLOGY EMPLOYED:
+	// With the RuntimeMetricsFile environment variable, a small JSON object is written to that
+	// file after the initialization, then after any zone time step once WriteInterval seconds
+	// have passed since the last write, and at the end of the run.  Each write goes to a
+	// temporary file that is then renamed over the metrics file, so a reader never sees a partial
+	// object.  The interval values (simulated to wall time ratio, HVAC iterations) cover the time
+	// since the previous write; the others cover the whole run.  The output bytes are the sizes
+	// of the eso, mtr and sql files as written to disk so far.
+
+	// REFERENCES: na
+
+	// OTHER NOTES: na
+
+	// Using/Aliasing
+	using DataSystemVariables::RuntimeMetricsFileName;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	Real64 const WriteInterval( 5.0 );
+
+	// Object Data
+	RuntimeMetricsData Metrics;
+
+	// Functions
+
+	void
+	InitRuntimeMetrics()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the metrics of the run when a metrics file is requested.
+
+		Metrics = RuntimeMetricsData();
+		if ( RuntimeMetricsFileName.empty() ) return;
+
+		Metrics.Active = true;
+		Metrics.StartTime = MetricsClock();
+		Metrics.LastWriteTime = Metrics.StartTime;
+		WriteRuntimeMetrics( "Initializing" );
+
+	}
+
+	void
+	CountHVACIterations( int const Iterations ) // HVAC iterations of the system time step just simulated
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a system time step and its HVAC iterations to the metrics.
+
+		if ( ! Metrics.Active ) return;
+
+		++Metrics.SystemTimeSteps;
+		Metrics.HVACIterations += Iterations;
+		++Metrics.IntervalSystemTimeSteps;
+		Metrics.IntervalHVACIterations += Iterations;
+		if ( Iterations > Metrics.IntervalMaxHVACIterations ) Metrics.IntervalMaxHVACIterations = Iterations;
+
+	}
+
+	void
+	UpdateRuntimeMetrics()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the zone time step just simulated to the metrics, and writes the metrics file when
+		// the write interval has passed.
+
+		if ( ! Metrics.Active ) return;
+
+		Metrics.SimulatedHours += DataGlobals::TimeStepZone;
+		if ( MetricsClock() - Metrics.LastWriteTime >= WriteInterval ) WriteRuntimeMetrics( "Simulating" );
+
+	}
+
+	void
+	EndRuntimeMetrics()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the metrics of the whole run at its end.
+
+		if ( ! Metrics.Active ) return;
+
+		WriteRuntimeMetrics( "Completed" );
+		Metrics.Active = false;
+
+	}
+
+	void
+	WriteRuntimeMetrics( std::string const & Status ) // Phase of the run: Initializing, Simulating or Completed
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Replaces the metrics file with the metrics now, and starts a new interval.
+
+		Real64 const Now( MetricsClock() );
+		std::string const TempFileName( RuntimeMetricsFileName + ".tmp" );
+		{
+			std::ofstream File( TempFileName, std::ios::out | std::ios::trunc );
+			if ( ! File ) {
+				ShowWarningError( "WriteRuntimeMetrics: Could not open file \"" + TempFileName + "\" for output (write), no more runtime metrics are written." );
+				Metrics.Active = false;
+				return;
+			}
+			File << RuntimeMetricsJSON( Status, Now );
+		}
+		std::remove( RuntimeMetricsFileName.c_str() ); // Windows does not rename over an existing file
+		std::rename( TempFileName.c_str(), RuntimeMetricsFileName.c_str() );
+
+		Metrics.LastWriteTime = Now;
+		Metrics.LastWriteSimulatedHours = Metrics.SimulatedHours;
+		Metrics.IntervalSystemTimeSteps = 0;
+		Metrics.IntervalHVACIterations = 0;
+		Metrics.IntervalMaxHVACIterations = 0;
+
+	}
+
+	std::string
+	RuntimeMetricsJSON(
+		std::string const & Status, // Phase of the run
+		Real64 const Now // Clock reading [s]
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the metrics as a JSON object, one member to a line.
+
+		Real64 const WallTime( Now - Metrics.StartTime );
+		Real64 const IntervalWallTime( Now - Metrics.LastWriteTime );
+		Real64 const SpeedRatio( WallTime > 0.0 ? Metrics.SimulatedHours * DataGlobals::SecInHour / WallTime : 0.0 );
+		Real64 const IntervalSpeedRatio( IntervalWallTime > 0.0 ? ( Metrics.SimulatedHours - Metrics.LastWriteSimulatedHours ) * DataGlobals::SecInHour / IntervalWallTime : 0.0 );
+		Real64 const IterationsPerTimeStep( Metrics.IntervalSystemTimeSteps > 0 ? Real64( Metrics.IntervalHVACIterations ) / Real64( Metrics.IntervalSystemTimeSteps ) : 0.0 );
+		Int64 const OutputBytes( FileBytes( DataStringGlobals::outputEsoFileName ) + FileBytes( DataStringGlobals::outputMtrFileName ) + FileBytes( DataStringGlobals::outputSqlFileName ) );
+
+		std::string JSON( "{\n" );
+		JSON += "  \"Status\": " + JSONString( Status ) + ",\n";
+		JSON += "  \"WallTime\": " + JSONNumber( WallTime, 2 ) + ",\n";
+		JSON += "  \"SimulatedHours\": " + JSONNumber( Metrics.SimulatedHours, 4 ) + ",\n";
+		JSON += "  \"SimulatedToWallTimeRatio\": " + JSONNumber( SpeedRatio, 2 ) + ",\n";
+		JSON += "  \"IntervalSimulatedToWallTimeRatio\": " + JSONNumber( IntervalSpeedRatio, 2 ) + ",\n";
+		JSON += "  \"EnvironmentNum\": " + std::to_string( DataEnvironment::CurEnvirNum ) + ",\n";
+		JSON += "  \"EnvironmentName\": " + JSONString( DataEnvironment::EnvironmentName ) + ",\n";
+		JSON += "  \"DayOfSim\": " + std::to_string( DataGlobals::DayOfSim ) + ",\n";
+		JSON += std::string( "  \"Warmup\": " ) + ( DataGlobals::WarmupFlag ? "true" : "false" ) + ",\n";
+		JSON += "  \"WarmupDays\": " + std::to_string( DataReportingFlags::NumOfWarmupDays ) + ",\n";
+		JSON += "  \"SystemTimeSteps\": " + std::to_string( Metrics.SystemTimeSteps ) + ",\n";
+		JSON += "  \"HVACIterations\": " + std::to_string( Metrics.HVACIterations ) + ",\n";
+		JSON += "  \"IntervalHVACIterationsPerTimeStep\": " + JSONNumber( IterationsPerTimeStep, 2 ) + ",\n";
+		JSON += "  \"IntervalMaxHVACIterations\": " + std::to_string( Metrics.IntervalMaxHVACIterations ) + ",\n";
+		JSON += "  \"OutputBytes\": " + std::to_string( OutputBytes ) + ",\n";
+		JSON += "  \"PeakMemoryBytes\": " + std::to_string( MemoryReport::ProcessPeakBytes() ) + "\n";
+		JSON += "}\n";
+		return JSON;
+
+	}
+
+	Real64
+	MetricsClock()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives a steady clock reading in seconds.
+
+		return std::chrono::duration< Real64 >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+
+	}
+
+	Int64
+	FileBytes( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the size of the file on disk, or zero if it cannot be opened.
+
+		std::ifstream File( FileName, std::ios::in | std::ios::binary | std::ios::ate );
+		if ( ! File ) return 0;
+		return Int64( File.tellg() );
+
+	}
+
+	std::string
+	JSONNumber(
+		Real64 const Value,
+		int const Decimals // Digits after the decimal point
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the value as a JSON number in fixed notation.
+
+		char Buffer[ 64 ];
+		std::snprintf( Buffer, sizeof( Buffer ), "%.*f", Decimals, Value );
+		return Buffer;
+
+	}
+
+	std::string
+	JSONString( std::string const & Value )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the value as a quoted JSON string.
+
+		std::string Quoted( 1, '"' );
+		for ( char const c : Value ) {
+			if ( c == '"' || c == '\\' ) {
+				Quoted += '\\';
+				Quoted += c;
+			} else if ( static_cast< unsigned char >( c ) < 0x20 ) {
+				Quoted += ' ';
+			} else {
+				Quoted += c;
+			}
+		}
+		Quoted += '"';
+		return Quoted;
+
+	}
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // RuntimeMetrics
+
+} // EnergyPlus
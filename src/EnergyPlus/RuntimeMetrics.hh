@@ -0,0 +1,118 @@
+#ifndef RuntimeMetrics_hh_INCLUDED
+#define RuntimeMetrics_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace RuntimeMetrics {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern Real64 const WriteInterval; // Least wall time between writes of the metrics file while simulating [s]
+
+	// Types
+
+	struct RuntimeMetricsData
+	{
+		// Members
+		bool Active; // True while the metrics file is kept
+		Real64 StartTime; // Clock reading at the start of the run [s]
+		Real64 LastWriteTime; // Clock reading at the last write of the file [s]
+		Real64 SimulatedHours; // Zone time steps simulated in all environments, warmup days included [hr]
+		Real64 LastWriteSimulatedHours; // Simulated hours at the last write of the file [hr]
+		Int64 SystemTimeSteps; // HVAC system time steps simulated
+		Int64 HVACIterations; // HVAC iterations of all the system time steps
+		Int64 IntervalSystemTimeSteps; // System time steps since the last write of the file
+		Int64 IntervalHVACIterations; // HVAC iterations since the last write of the file
+		int IntervalMaxHVACIterations; // Most HVAC iterations of a system time step since the last write of the file
+
+		// Default Constructor
+		RuntimeMetricsData() :
+			Active( false ),
+			StartTime( 0.0 ),
+			LastWriteTime( 0.0 ),
+			SimulatedHours( 0.0 ),
+			LastWriteSimulatedHours( 0.0 ),
+			SystemTimeSteps( 0 ),
+			HVACIterations( 0 ),
+			IntervalSystemTimeSteps( 0 ),
+			IntervalHVACIterations( 0 ),
+			IntervalMaxHVACIterations( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern RuntimeMetricsData Metrics;
+
+	// Functions
+
+	void
+	InitRuntimeMetrics();
+
+	void
+	CountHVACIterations( int const Iterations ); // HVAC iterations of the system time step just simulated
+
+	void
+	UpdateRuntimeMetrics();
+
+	void
+	EndRuntimeMetrics();
+
+	void
+	WriteRuntimeMetrics( std::string const & Status ); // Phase of the run: Initializing, Simulating or Completed
+
+	std::string
+	RuntimeMetricsJSON(
+		std::string const & Status, // Phase of the run
+		Real64 const Now // Clock reading [s]
+	);
+
+	Real64
+	MetricsClock();
+
+	Int64
+	FileBytes( std::string const & FileName );
+
+	std::string
+	JSONNumber(
+		Real64 const Value,
+		int const Decimals // Digits after the decimal point
+	);
+
+	std::string
+	JSONString( std::string const & Value );
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // RuntimeMetrics
+
+} // EnergyPlus
+
+#endif
@@ -17,7 +17,7 @@
 
 #include <sstream>
 #include <stdexcept>
-#include <map>
+#include <unordered_map>
 
 namespace EnergyPlus {
 
@@ -33,6 +33,8 @@ const int SQLite::TableNameId         =  3;
 const int SQLite::RowNameId           =  4;
 const int SQLite::ColumnNameId        =  5;
 const int SQLite::UnitsId             =  6;
+const int SQLite::ReportDataBatchSize = 100; // 4 parameters per row, below the default limit of 999 parameters per statement
+const int SQLite::ReportDataBufferSize = 1000;
 
 std::unique_ptr<SQLite> sqlite;
 
@@ -62,7 +64,9 @@ std::unique_ptr<SQLite> CreateSQLiteDatabase()
 			}
 		}
 		std::shared_ptr<std::ofstream> errorStream = std::make_shared<std::ofstream>( DataStringGlobals::outputSqliteErrFileName, std::ofstream::out | std::ofstream::trunc );
-		return std::unique_ptr<SQLite>(new SQLite( errorStream, DataStringGlobals::outputSqlFileName, DataStringGlobals::outputSqliteErrFileName, writeOutputToSQLite, writeTabularDataToSQLite ));
+		std::unique_ptr<SQLite> db( new SQLite( errorStream, DataStringGlobals::outputSqlFileName, DataStringGlobals::outputSqliteErrFileName, writeOutputToSQLite, writeTabularDataToSQLite ) );
+		if ( DataSystemVariables::SQLiteWriterThread ) db->startWriterThread();
+		return db;
 	} catch( const std::runtime_error& error ) {
 		ShowFatalError(error.what());
 		return nullptr;
@@ -143,7 +147,10 @@ SQLite::SQLite( std::shared_ptr<std::ostream> errorStream, std::string const & d
 	SQLiteProcedures(errorStream, writeOutputToSQLite, dbName, errorFileName),
 	m_writeTabularDataToSQLite(writeTabularDataToSQLite),
 	m_sqlDBTimeIndex(0),
+	m_writerBusy(false),
+	m_writerStop(false),
 	m_reportDataInsertStmt(nullptr),
+	m_reportDataBatchInsertStmt(nullptr),
 	m_reportExtendedDataInsertStmt(nullptr),
 	m_reportDictionaryInsertStmt(nullptr),
 	m_timeIndexInsertStmt(nullptr),
@@ -168,6 +175,7 @@ SQLite::SQLite( std::shared_ptr<std::ostream> errorStream, std::string const & d
 	m_zoneSizingInsertStmt(nullptr),
 	m_systemSizingInsertStmt(nullptr),
 	m_componentSizingInsertStmt(nullptr),
+	m_hvacConvergenceInsertStmt(nullptr),
 	m_roomAirModelInsertStmt(nullptr),
 	m_groundTemperatureInsertStmt(nullptr),
 	m_weatherFileInsertStmt(nullptr),
@@ -235,7 +243,12 @@ SQLite::SQLite( std::shared_ptr<std::ostream> errorStream, std::string const & d
 
 SQLite::~SQLite()
 {
+	if ( m_writeOutputToSQLite ) {
+		flushReportData();
+	}
+	stopWriterThread();
 	sqlite3_finalize(m_reportDataInsertStmt);
+	sqlite3_finalize(m_reportDataBatchInsertStmt);
 	sqlite3_finalize(m_reportExtendedDataInsertStmt);
 	sqlite3_finalize(m_reportDictionaryInsertStmt);
 	sqlite3_finalize(m_timeIndexInsertStmt);
@@ -260,6 +273,7 @@ SQLite::~SQLite()
 	sqlite3_finalize(m_zoneSizingInsertStmt);
 	sqlite3_finalize(m_systemSizingInsertStmt);
 	sqlite3_finalize(m_componentSizingInsertStmt);
+	sqlite3_finalize(m_hvacConvergenceInsertStmt);
 	sqlite3_finalize(m_roomAirModelInsertStmt);
 	sqlite3_finalize(m_groundTemperatureInsertStmt);
 	sqlite3_finalize(m_weatherFileInsertStmt);
@@ -298,10 +312,104 @@ void SQLite::sqliteBegin()
 void SQLite::sqliteCommit()
 {
 	if ( m_writeOutputToSQLite ) {
+		flushReportData();
 		sqliteExecuteCommand("COMMIT;");
 	}
 }
 
+void SQLite::flushReportData()
+{
+	queueReportData();
+	if ( m_writerThread.joinable() ) {
+		std::unique_lock<std::mutex> lock(m_writerMutex);
+		m_writerCondition.wait(lock, [this]{ return m_writerQueue.empty() && !m_writerBusy; });
+	}
+}
+
+void SQLite::startWriterThread()
+{
+	if ( m_writeOutputToSQLite && !m_writerThread.joinable() ) {
+		m_writerStop = false;
+		m_writerThread = std::thread(&SQLite::writerThreadLoop, this);
+	}
+}
+
+void SQLite::stopWriterThread()
+{
+	if ( m_writerThread.joinable() ) {
+		{
+			std::lock_guard<std::mutex> lock(m_writerMutex);
+			m_writerStop = true;
+		}
+		m_writerCondition.notify_all();
+		m_writerThread.join();
+	}
+}
+
+void SQLite::queueReportData()
+{
+	if ( m_reportDataBuffer.empty() ) return;
+	if ( m_writerThread.joinable() ) {
+		{
+			std::lock_guard<std::mutex> lock(m_writerMutex);
+			m_writerQueue.push_back(std::move(m_reportDataBuffer));
+		}
+		m_writerCondition.notify_all();
+		m_reportDataBuffer = std::vector<ReportDataRow>();
+		m_reportDataBuffer.reserve(ReportDataBufferSize);
+	} else {
+		writeReportDataRows(m_reportDataBuffer);
+		m_reportDataBuffer.clear();
+	}
+}
+
+void SQLite::writeReportDataRows(std::vector<ReportDataRow> const & rows)
+{
+	// Full batches go through the multi-row statement, the rest one row at a time
+	size_t const numRows = rows.size();
+	size_t row = 0;
+	for ( ; row + ReportDataBatchSize <= numRows; row += ReportDataBatchSize ) {
+		for ( int i = 0; i < ReportDataBatchSize; ++i ) {
+			ReportDataRow const & data = rows[row + i];
+			sqliteBindInteger(m_reportDataBatchInsertStmt, 4 * i + 1, data.dataIndex);
+			sqliteBindForeignKey(m_reportDataBatchInsertStmt, 4 * i + 2, data.timeIndex);
+			sqliteBindForeignKey(m_reportDataBatchInsertStmt, 4 * i + 3, data.recordIndex);
+			sqliteBindDouble(m_reportDataBatchInsertStmt, 4 * i + 4, data.value);
+		}
+		sqliteStepCommand(m_reportDataBatchInsertStmt);
+		sqliteResetCommand(m_reportDataBatchInsertStmt);
+	}
+	for ( ; row < numRows; ++row ) {
+		ReportDataRow const & data = rows[row];
+		sqliteBindInteger(m_reportDataInsertStmt, 1, data.dataIndex);
+		sqliteBindForeignKey(m_reportDataInsertStmt, 2, data.timeIndex);
+		sqliteBindForeignKey(m_reportDataInsertStmt, 3, data.recordIndex);
+		sqliteBindDouble(m_reportDataInsertStmt, 4, data.value);
+
+		sqliteStepCommand(m_reportDataInsertStmt);
+		sqliteResetCommand(m_reportDataInsertStmt);
+	}
+}
+
+void SQLite::writerThreadLoop()
+{
+	// The connection is opened in serialized mode, so the inserts made here may run while the
+	// simulation thread uses its own statements; the two report data statements belong to this thread.
+	std::unique_lock<std::mutex> lock(m_writerMutex);
+	while ( true ) {
+		m_writerCondition.wait(lock, [this]{ return m_writerStop || !m_writerQueue.empty(); });
+		if ( m_writerQueue.empty() ) break; // Stopped with nothing left to write
+		std::vector<ReportDataRow> rows(std::move(m_writerQueue.front()));
+		m_writerQueue.pop_front();
+		m_writerBusy = true;
+		lock.unlock();
+		writeReportDataRows(rows);
+		lock.lock();
+		m_writerBusy = false;
+		m_writerCondition.notify_all();
+	}
+}
+
 void SQLite::sqliteWriteMessage(const std::string & message)
 {
 	if ( m_writeOutputToSQLite ) {
@@ -369,6 +477,21 @@ void SQLite::initializeReportDataTables()
 
 	sqlitePrepareStatement(m_reportDataInsertStmt,reportDataInsertSQL);
 
+	std::string reportDataBatchInsertSQL =
+		"INSERT INTO ReportData ("
+		"ReportDataIndex, "
+		"TimeIndex, "
+		"ReportDataDictionaryIndex, "
+		"Value) "
+		"VALUES(?,?,?,?)";
+	for ( int i = 1; i < ReportDataBatchSize; ++i ) {
+		reportDataBatchInsertSQL += ",(?,?,?,?)";
+	}
+	reportDataBatchInsertSQL += ";";
+
+	sqlitePrepareStatement(m_reportDataBatchInsertStmt,reportDataBatchInsertSQL);
+	m_reportDataBuffer.reserve(ReportDataBufferSize);
+
 	const std::string reportExtendedDataTableSQL =
 		"CREATE TABLE ReportExtendedData ("
 		"ReportExtendedDataIndex INTEGER PRIMARY KEY, "
@@ -934,6 +1057,22 @@ void SQLite::initializeComponentSizingTable()
 	sqlitePrepareStatement(m_componentSizingInsertStmt,componentSizingInsertSQL);
 }
 
+void SQLite::initializeHVACConvergenceTable()
+{
+	const std::string hvacConvergenceTableSQL =
+		"CREATE TABLE HVACConvergence (HVACConvergenceIndex INTEGER PRIMARY KEY, "
+		"EnvironmentPeriodIndex INTEGER, SimulationDay INTEGER, Hour INTEGER, TimeStep INTEGER, SystemTime REAL, "
+		"WarmupFlag INTEGER, WarmupDay INTEGER, HVACIterations INTEGER, PlantSubIterations INTEGER, "
+		"ControllerIterations INTEGER, Converged INTEGER);";
+
+	sqliteExecuteCommand(hvacConvergenceTableSQL);
+
+	const std::string hvacConvergenceInsertSQL =
+		"INSERT INTO HVACConvergence VALUES (?,?,?,?,?,?,?,?,?,?,?,?);";
+
+	sqlitePrepareStatement(m_hvacConvergenceInsertStmt,hvacConvergenceInsertSQL);
+}
+
 void SQLite::initializeRoomAirModelTable()
 {
 	const std::string roomAirModelsTableSQL =
@@ -1424,15 +1563,13 @@ void SQLite::createSQLiteReportDataRecord(
 
 		++dataIndex;
 
-		sqliteBindInteger(m_reportDataInsertStmt, 1, dataIndex);
-		sqliteBindForeignKey(m_reportDataInsertStmt, 2, m_sqlDBTimeIndex);
-		sqliteBindForeignKey(m_reportDataInsertStmt, 3, recordIndex);
-		sqliteBindDouble(m_reportDataInsertStmt, 4, value);
-
-		sqliteStepCommand(m_reportDataInsertStmt);
-		sqliteResetCommand(m_reportDataInsertStmt);
+		// Rows are buffered and written in batches by queueReportData
+		ReportDataRow const row = { dataIndex, m_sqlDBTimeIndex, recordIndex, value };
+		m_reportDataBuffer.push_back(row);
+		if ( int(m_reportDataBuffer.size()) >= ReportDataBufferSize ) queueReportData();
 
 		if (reportingInterval.present() && minValueDate != 0 && maxValueDate != 0) {
+			flushReportData(); // The extended data refers to this row
 			int minMonth;
 			int minDay;
 			int minHour;
@@ -1770,6 +1907,44 @@ void SQLite::addSQLiteComponentSizingRecord(
 	}
 }
 
+void SQLite::addSQLiteHVACConvergenceRecord(
+	int const curEnvirNum, // the environment period
+	int const simulationDay, // the day of the environment period
+	int const hour, // the hour of the day
+	int const timeStep, // the zone time step of the hour
+	Real64 const sysTimeElapsed, // the time of the system time step within the zone time step (hr)
+	bool const warmupFlag, // true during the warmup days
+	int const warmupDay, // the warmup day, counted from 1
+	int const hvacIterations, // the iterations of SimHVAC
+	int const plantSubIterations, // the plant sub iterations of all SimHVAC iterations
+	int const controllerIterations, // the air loop controller iterations of all SimHVAC iterations
+	bool const converged // false if SimHVAC stopped at its iteration limit
+)
+{
+	// One row per system time step; the table is only made once the first row is written
+	static int hvacConvergenceIndex = 0;
+	if ( m_writeOutputToSQLite ) {
+		if ( ! m_hvacConvergenceInsertStmt ) initializeHVACConvergenceTable();
+		++hvacConvergenceIndex;
+
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 1, hvacConvergenceIndex);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 2, curEnvirNum);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 3, simulationDay);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 4, hour);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 5, timeStep);
+		sqliteBindDouble(m_hvacConvergenceInsertStmt, 6, sysTimeElapsed);
+		sqliteBindLogical(m_hvacConvergenceInsertStmt, 7, warmupFlag);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 8, warmupDay);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 9, hvacIterations);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 10, plantSubIterations);
+		sqliteBindInteger(m_hvacConvergenceInsertStmt, 11, controllerIterations);
+		sqliteBindLogical(m_hvacConvergenceInsertStmt, 12, converged);
+
+		sqliteStepCommand(m_hvacConvergenceInsertStmt);
+		sqliteResetCommand(m_hvacConvergenceInsertStmt);
+	}
+}
+
 void SQLite::createSQLiteDaylightMapTitle(
 	int const mapNum,
 	std::string const & mapName,
@@ -1857,6 +2032,16 @@ void SQLite::createSQLiteTabularDataRecords(
 		int const tableNameIndex = createSQLiteStringTableRecord(tableName, TableNameId);
 		int unitsIndex;
 
+		// Row labels are split and their strings found once per table rather than once per cell;
+		// the string records are still created at their first use so the string indexes do not change
+		std::vector< std::string > rowUnitsList(sizeRowLabels);
+		std::vector< std::string > rowDescriptions(sizeRowLabels);
+		for ( size_t iRow = 0; iRow < sizeRowLabels; ++iRow ) {
+			parseUnitsAndDescription(rowLabels[iRow], rowUnitsList[iRow], rowDescriptions[iRow]);
+		}
+		std::vector< int > rowLabelIndexes(sizeRowLabels, 0);
+		std::vector< int > rowUnitsIndexes(sizeRowLabels, 0);
+
 		for ( size_t iCol = 0, k = body.index(1,1); iCol < sizeColumnLabels; ++iCol ) {
 			std::string colUnits;
 			std::string colDescription;
@@ -1870,14 +2055,17 @@ void SQLite::createSQLiteTabularDataRecords(
 
 			for ( size_t iRow = 0; iRow < sizeRowLabels; ++iRow ) {
 				++tabularDataIndex;
-				std::string rowUnits;
-				std::string rowDescription;
-				parseUnitsAndDescription(rowLabels[iRow], rowUnits, rowDescription);
 
-				int const rowLabelIndex = createSQLiteStringTableRecord(rowDescription, RowNameId);
+				if ( rowLabelIndexes[iRow] == 0 ) {
+					rowLabelIndexes[iRow] = createSQLiteStringTableRecord(rowDescriptions[iRow], RowNameId);
+				}
+				int const rowLabelIndex = rowLabelIndexes[iRow];
 
 				if ( colUnits.empty() ) {
-					unitsIndex = createSQLiteStringTableRecord(rowUnits, UnitsId);
+					if ( rowUnitsIndexes[iRow] == 0 ) {
+						rowUnitsIndexes[iRow] = createSQLiteStringTableRecord(rowUnitsList[iRow], UnitsId);
+					}
+					unitsIndex = rowUnitsIndexes[iRow];
 				}
 
 				sqliteBindInteger(m_tabularDataInsertStmt,1,tabularDataIndex);
@@ -1901,12 +2089,23 @@ void SQLite::createSQLiteTabularDataRecords(
 	}
 }
 
+namespace {
+	// Hash of the <stringValue, stringType> keys of the string records
+	struct TabularStringHash
+	{
+		std::size_t operator()( std::pair< std::string, int > const & key ) const
+		{
+			return std::hash< std::string >()( key.first ) ^ ( std::hash< int >()( key.second ) << 1 );
+		}
+	};
+}
+
 int SQLite::createSQLiteStringTableRecord(std::string const & stringValue, int const stringType)
 {
 	static int stringIndex = 1;
 	int rowId = -1;
 	// map of <<stringValue, stringType>, stringIndex>
-	static std::map < std::pair < std::string, int > , int > tabularStrings;
+	static std::unordered_map < std::pair < std::string, int > , int, TabularStringHash > tabularStrings;
 	if ( m_writeOutputToSQLite ) {
 
 		auto ret = tabularStrings.emplace( make_pair(stringValue, stringType), 0 );
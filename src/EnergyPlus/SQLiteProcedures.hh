@@ -13,9 +13,14 @@
 
 #include <sqlite3.h>
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace EnergyPlus {
 
@@ -91,6 +96,12 @@ public:
 	// Commit a transaction
 	void sqliteCommit();
 
+	// Write the report data rows still held in the buffer and wait until they are in the database
+	void flushReportData();
+
+	// Write the report data rows from a separate thread so the simulation does not wait on SQLite
+	void startWriterThread();
+
 	void createSQLiteReportDictionaryRecord(
 		int const reportVariableReportID,
 		int const storeTypeIndex,
@@ -157,6 +168,20 @@ public:
 		Real64 const VarValue // the value from the sizing calculation
 	);
 
+	void addSQLiteHVACConvergenceRecord(
+		int const curEnvirNum, // the environment period
+		int const simulationDay, // the day of the environment period
+		int const hour, // the hour of the day
+		int const timeStep, // the zone time step of the hour
+		Real64 const sysTimeElapsed, // the time of the system time step within the zone time step (hr)
+		bool const warmupFlag, // true during the warmup days
+		int const warmupDay, // the warmup day, counted from 1
+		int const hvacIterations, // the iterations of SimHVAC
+		int const plantSubIterations, // the plant sub iterations of all SimHVAC iterations
+		int const controllerIterations, // the air loop controller iterations of all SimHVAC iterations
+		bool const converged // false if SimHVAC stopped at its iteration limit
+	);
+
 	void createSQLiteDaylightMapTitle(
 		int const mapNum,
 		std::string const & mapName,
@@ -226,6 +251,20 @@ private:
 
 	static int logicalToInteger(const bool value);
 
+	struct ReportDataRow
+	{
+		int dataIndex;
+		int timeIndex;
+		int recordIndex;
+		double value;
+	};
+
+	// Hand the buffered report data rows to the writer thread, or write them if there is none
+	void queueReportData();
+	void writeReportDataRows(std::vector<ReportDataRow> const & rows);
+	void writerThreadLoop();
+	void stopWriterThread();
+
 	void initializeReportDataDictionaryTable();
 	void initializeReportDataTables();
 	void initializeTimeIndicesTable();
@@ -249,6 +288,7 @@ private:
 	void initializeZoneSizingTable();
 	void initializeSystemSizingTable();
 	void initializeComponentSizingTable();
+	void initializeHVACConvergenceTable();
 	void initializeRoomAirModelTable();
 	void initializeSchedulesTable();
 	void initializeDaylightMapTables();
@@ -261,7 +301,15 @@ private:
 
 	bool m_writeTabularDataToSQLite;
 	int m_sqlDBTimeIndex;
+	std::vector<ReportDataRow> m_reportDataBuffer;
+	std::thread m_writerThread;
+	std::mutex m_writerMutex;
+	std::condition_variable m_writerCondition;
+	std::deque< std::vector<ReportDataRow> > m_writerQueue; // Guarded by m_writerMutex
+	bool m_writerBusy; // Guarded by m_writerMutex
+	bool m_writerStop; // Guarded by m_writerMutex
 	sqlite3_stmt * m_reportDataInsertStmt;
+	sqlite3_stmt * m_reportDataBatchInsertStmt;
 	sqlite3_stmt * m_reportExtendedDataInsertStmt;
 	sqlite3_stmt * m_reportDictionaryInsertStmt;
 	sqlite3_stmt * m_timeIndexInsertStmt;
@@ -286,6 +334,7 @@ private:
 	sqlite3_stmt * m_zoneSizingInsertStmt;
 	sqlite3_stmt * m_systemSizingInsertStmt;
 	sqlite3_stmt * m_componentSizingInsertStmt;
+	sqlite3_stmt * m_hvacConvergenceInsertStmt;
 	sqlite3_stmt * m_roomAirModelInsertStmt;
 	sqlite3_stmt * m_groundTemperatureInsertStmt;
 	sqlite3_stmt * m_weatherFileInsertStmt;
@@ -315,6 +364,8 @@ private:
 	static const int RowNameId;
 	static const int ColumnNameId;
 	static const int UnitsId;
+	static const int ReportDataBatchSize; // Rows per multi-row ReportData insert
+	static const int ReportDataBufferSize; // Rows buffered before they are written
 
 	class SQLiteData : public SQLiteProcedures
 	{
@@ -1,3 +1,9 @@
+// C++ Headers
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
@@ -68,6 +74,7 @@ namespace ScheduleManager {
 	//MODULE PARAMETER DEFINITIONS
 	int const MaxDayTypes( 12 );
 	static std::string const BlankString;
+	static std::string const ScheduleFileCacheMagic( "EPSFC001" ); // File signature and format version of the Schedule:File cache file
 	Array1D_string const ValidDayTypes( MaxDayTypes, { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Holiday", "SummerDesignDay", "WinterDesignDay", "CustomDay1", "CustomDay2" } );
 
 	int const NumScheduleTypeLimitUnitTypes( 14 );
@@ -95,6 +102,14 @@ namespace ScheduleManager {
 	bool ScheduleInputProcessed( false ); // This is false until the Schedule Input has been processed.
 	bool ScheduleDSTSFileWarningIssued( false );
 
+	// Day schedules of the current day, resolved once a day for UpdateScheduleValues
+	bool ActiveDayValid( false ); // False when ActiveDayValues must be rebuilt
+	int ActiveDayOfYear( 0 ); // Day the active day schedules were resolved for
+	int ActiveDayOfWeek( 0 );
+	int ActiveHolidayIndex( 0 );
+	Array1D_int ActiveDaySchedulePtr; // Day schedule of each schedule today
+	Array2D< Real64 > ActiveDayValues; // (timestep of the day, schedule) values today
+
 	//Derived Types Variables
 
 	// Object Data
@@ -102,6 +117,7 @@ namespace ScheduleManager {
 	Array1D< DayScheduleData > DaySchedule; // Day Schedule Storage
 	Array1D< WeekScheduleData > WeekSchedule; // Week Schedule Storage
 	Array1D< ScheduleData > Schedule; // Schedule Storage
+	ScheduleFileCacheData ScheduleFileCache;
 
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
@@ -206,6 +222,7 @@ namespace ScheduleManager {
 		// "compact" Schedules ! added for FMU Export
 		int NumLstDaySchedules; // Number of "list" dayschedules
 		int NumRegDaySchedules; // Number of hourly+interval+list dayschedules
+		int LastSharedDaySch; // Last day schedule not written by the external interface
 		int NumRegWeekSchedules; // Number of "regular" Weekschedules
 		int NumRegSchedules; // Number of "regular" Schedules
 		int NumCptWeekSchedules; // Number of "compact" WeekSchedules
@@ -1259,6 +1276,7 @@ namespace ScheduleManager {
 		// continue adding to SchNum,AddWeekSch,AddDaySch
 		if ( NumCommaFileSchedules > 0 ) {
 			hourlyFileValues.allocate( 8784 * 60 ); // sized to accomodate any interval for schedule file.
+			InitScheduleFileCache( DataSystemVariables::ScheduleFileCacheFileName );
 		}
 		CurrentModuleObject = "Schedule:File";
 		for ( LoopIndex = 1; LoopIndex <= NumCommaFileSchedules; ++LoopIndex ) {
@@ -1392,92 +1410,104 @@ namespace ScheduleManager {
 				ShowContinueError( "Try again with putting full path and file name in the field." );
 				ErrorsFound = true;
 			} else {
-				SchdFile = GetNewUnitNumber();
-				{ IOFlags flags; flags.ACTION( "read" ); gio::open( SchdFile, TempFullFileName, flags ); read_stat = flags.ios(); }
-				if ( read_stat != 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
-					ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
-					ShowFatalError( "Program terminates due to previous condition." );
+				// Columns already read from the same file contents are restored from the cache
+				std::vector< Real64 > FileKey; // File contents and column settings
+				bool FileCached( false );
+				bool FirstLineWarned( false ); // Columns with separator warnings are not cached, so the warning is repeated
+				if ( ScheduleFileCache.Active ) {
+					FileKey = ScheduleFileCacheKey( TempFullFileName, curcolCount, skiprowCount, rowLimitCount, ColumnSep );
+					if ( ! FileKey.empty() ) FileCached = RestoreScheduleFileFromCache( FileKey, rowLimitCount, rowCnt, numerrors, hourlyFileValues );
 				}
-				// check for stripping
-				{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-				endLine = len( LineIn );
-				if ( endLine > 0 ) {
-					if ( int( LineIn[ endLine - 1 ] ) == iUnicode_end ) {
-						gio::close( SchdFile );
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + " appears to be a Unicode or binary file." );
-						ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
+				if ( ! FileCached ) {
+					SchdFile = GetNewUnitNumber();
+					{ IOFlags flags; flags.ACTION( "read" ); gio::open( SchdFile, TempFullFileName, flags ); read_stat = flags.ios(); }
+					if ( read_stat != 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
+						ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
 						ShowFatalError( "Program terminates due to previous condition." );
 					}
-				}
-				gio::backspace( SchdFile );
+					// check for stripping
+					{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
+					endLine = len( LineIn );
+					if ( endLine > 0 ) {
+						if ( int( LineIn[ endLine - 1 ] ) == iUnicode_end ) {
+							gio::close( SchdFile );
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + " appears to be a Unicode or binary file." );
+							ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
+							ShowFatalError( "Program terminates due to previous condition." );
+						}
+					}
+					gio::backspace( SchdFile );
+
+					// skip lines if any need to be skipped.
+					numerrors = 0;
+					rowCnt = 0;
+					read_stat = 0;
+					if ( skiprowCount > 0 ) { // Numbers(2) has number of rows to skip
+						while ( read_stat == 0 ) { //end of file
+							{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
+							++rowCnt;
+							if ( rowCnt == skiprowCount ) {
+								break;
+							}
+						}
+					}
 
-				// skip lines if any need to be skipped.
-				numerrors = 0;
-				rowCnt = 0;
-				read_stat = 0;
-				if ( skiprowCount > 0 ) { // Numbers(2) has number of rows to skip
+					//  proper number of lines are skipped.  read the file
+					// for the rest of the lines read from the file
+					rowCnt = 0;
+					firstLine = true;
 					while ( read_stat == 0 ) { //end of file
 						{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
 						++rowCnt;
-						if ( rowCnt == skiprowCount ) {
-							break;
-						}
-					}
-				}
-
-				//  proper number of lines are skipped.  read the file
-				// for the rest of the lines read from the file
-				rowCnt = 0;
-				firstLine = true;
-				while ( read_stat == 0 ) { //end of file
-					{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-					++rowCnt;
-					colCnt = 0;
-					wordStart = 0;
-					columnValue = 0.0;
-					//scan through the line looking for a specific column
-					while ( true ) {
-						sepPos = index( LineIn, ColumnSep );
-						++colCnt;
-						if ( sepPos != std::string::npos ) {
-							if ( sepPos > 0 ) {
-								wordEnd = sepPos - 1;
-							} else {
-								wordEnd = wordStart;
-							}
-							subString = LineIn.substr( wordStart, wordEnd - wordStart + 1 );
-							//the next word will start after the comma
-							wordStart = sepPos + 1;
-							//get rid of separator so next INDEX will find next separator
-							LineIn.erase( 0, wordStart );
-							firstLine = false;
-							wordStart = 0;
-						} else {
-							//no more commas
-							subString = LineIn.substr( wordStart );
-							if ( firstLine && subString == BlankString ) {
-								ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\" first line does not contain the indicated column separator=" + Alphas( 4 ) + '.' );
-								ShowContinueError( "...first 40 characters of line=[" + LineIn.substr( 0, 40 ) + ']' );
+						colCnt = 0;
+						wordStart = 0;
+						columnValue = 0.0;
+						//scan through the line looking for a specific column
+						while ( true ) {
+							sepPos = index( LineIn, ColumnSep );
+							++colCnt;
+							if ( sepPos != std::string::npos ) {
+								if ( sepPos > 0 ) {
+									wordEnd = sepPos - 1;
+								} else {
+									wordEnd = wordStart;
+								}
+								subString = LineIn.substr( wordStart, wordEnd - wordStart + 1 );
+								//the next word will start after the comma
+								wordStart = sepPos + 1;
+								//get rid of separator so next INDEX will find next separator
+								LineIn.erase( 0, wordStart );
 								firstLine = false;
+								wordStart = 0;
+							} else {
+								//no more commas
+								subString = LineIn.substr( wordStart );
+								if ( firstLine && subString == BlankString ) {
+									ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\" first line does not contain the indicated column separator=" + Alphas( 4 ) + '.' );
+									ShowContinueError( "...first 40 characters of line=[" + LineIn.substr( 0, 40 ) + ']' );
+									firstLine = false;
+									FirstLineWarned = true;
+								}
+								break;
 							}
-							break;
+							if ( colCnt == curcolCount ) break;
 						}
-						if ( colCnt == curcolCount ) break;
-					}
-					if ( colCnt == curcolCount ) {
-						columnValue = ProcessNumber( subString, errFlag );
-						if ( errFlag ) {
-							++numerrors;
+						if ( colCnt == curcolCount ) {
+							columnValue = ProcessNumber( subString, errFlag );
+							if ( errFlag ) {
+								++numerrors;
+								columnValue = 0.0;
+							}
+						} else {
 							columnValue = 0.0;
 						}
-					} else {
-						columnValue = 0.0;
+						hourlyFileValues( rowCnt ) = columnValue;
+						if ( rowCnt == rowLimitCount ) break;
 					}
-					hourlyFileValues( rowCnt ) = columnValue;
-					if ( rowCnt == rowLimitCount ) break;
+					gio::close( SchdFile );
+					if ( ScheduleFileCache.Active && ! FileKey.empty() && ! FirstLineWarned ) SaveScheduleFileToCache( FileKey, rowCnt, numerrors, hourlyFileValues );
 				}
-				gio::close( SchdFile );
 
 				// schedule values have been filled into the hourlyFileValues array.
 
@@ -1573,6 +1603,11 @@ namespace ScheduleManager {
 		if ( NumCommaFileSchedules > 0 ) {
 			hourlyFileValues.deallocate();
 		}
+		if ( ScheduleFileCache.Active ) {
+			ShowMessage( "ProcessScheduleInput: " + RoundSigDigits( ScheduleFileCache.NumHits ) + " Schedule:File columns were taken from cache file \"" + ScheduleFileCache.FileName + "\", " + RoundSigDigits( ScheduleFileCache.NumMisses ) + " were read." );
+			ScheduleFileCache.File.close();
+			ScheduleFileCache.Active = false;
+		}
 
 		MinuteValue.deallocate();
 		SetMinuteValue.deallocate();
@@ -1625,6 +1660,8 @@ namespace ScheduleManager {
 			}
 		}
 
+		LastSharedDaySch = AddDaySch;
+
 		CurrentModuleObject = "ExternalInterface:Schedule";
 		for ( LoopIndex = 1; LoopIndex <= NumExternalInterfaceSchedules; ++LoopIndex ) {
 
@@ -1786,6 +1823,8 @@ namespace ScheduleManager {
 
 		}
 
+		ShareDuplicateDaySchedules( NumRegDaySchedules + 1, LastSharedDaySch );
+
 		// Validate by ScheduleLimitsType
 		for ( SchNum = 1; SchNum <= NumSchedules; ++SchNum ) {
 			NumPointer = Schedule( SchNum ).ScheduleTypePtr;
@@ -1845,6 +1884,307 @@ namespace ScheduleManager {
 
 	}
 
+	void
+	ShareDuplicateDaySchedules(
+		int const FirstDaySch, // First day schedule that may be shared
+		int const LastDaySch // Last day schedule that may be shared
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Points the week schedules at one copy of each set of identical day schedules and frees
+		// the values of the others.  Schedule:Compact and Schedule:File make a day schedule for
+		// each "For" field or each day of the file, and most of these repeat one another.
+
+		// METHODOLOGY EMPLOYED:
+		// Day schedules are grouped by a hash of their values; within a group the values are
+		// compared exactly, so the week schedules get the same values as before.  A shared day
+		// schedule keeps its name and its SameAs gives the one holding its values.
+
+		std::unordered_multimap< std::size_t, int > DaySchByHash; // Day schedules holding values, by hash of the values
+		std::hash< Real64 > const HashValue;
+		int NumShared( 0 );
+
+		for ( int DaySch = FirstDaySch; DaySch <= LastDaySch; ++DaySch ) {
+			auto & daySch( DaySchedule( DaySch ) );
+			auto const & TSValue( daySch.TSValue );
+			std::size_t Hash( std::size_t( daySch.ScheduleTypePtr ) * 2u + ( daySch.IntervalInterpolated ? 1u : 0u ) );
+			for ( Array2D< Real64 >::size_type i = 0; i < TSValue.size(); ++i ) {
+				Hash ^= HashValue( TSValue[ i ] ) + 0x9e3779b9 + ( Hash << 6 ) + ( Hash >> 2 );
+			}
+			auto const Group( DaySchByHash.equal_range( Hash ) );
+			for ( auto Other = Group.first; Other != Group.second; ++Other ) {
+				auto const & otherSch( DaySchedule( Other->second ) );
+				if ( otherSch.ScheduleTypePtr != daySch.ScheduleTypePtr ) continue;
+				if ( otherSch.IntervalInterpolated != daySch.IntervalInterpolated ) continue;
+				if ( otherSch.TSValue.size() != TSValue.size() ) continue;
+				bool SameValues( true );
+				for ( Array2D< Real64 >::size_type i = 0; i < TSValue.size(); ++i ) {
+					if ( otherSch.TSValue[ i ] != TSValue[ i ] ) {
+						SameValues = false;
+						break;
+					}
+				}
+				if ( SameValues ) {
+					daySch.SameAs = Other->second;
+					break;
+				}
+			}
+			if ( daySch.SameAs == 0 ) {
+				DaySchByHash.emplace( Hash, DaySch );
+			} else {
+				++NumShared;
+			}
+		}
+		if ( NumShared == 0 ) return;
+
+		for ( int WeekSch = 1; WeekSch <= NumWeekSchedules; ++WeekSch ) {
+			for ( int DayT = 1; DayT <= MaxDayTypes; ++DayT ) {
+				int & DaySchedulePointer( WeekSchedule( WeekSch ).DaySchedulePointer( DayT ) );
+				if ( DaySchedulePointer > 0 && DaySchedule( DaySchedulePointer ).SameAs > 0 ) DaySchedulePointer = DaySchedule( DaySchedulePointer ).SameAs;
+			}
+		}
+		for ( int DaySch = FirstDaySch; DaySch <= LastDaySch; ++DaySch ) {
+			if ( DaySchedule( DaySch ).SameAs > 0 ) DaySchedule( DaySch ).TSValue.deallocate();
+		}
+
+	}
+
+	void
+	InitScheduleFileCache( std::string const & FileName ) // Cache file name, empty for no cache
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the Schedule:File cache file and indexes the records it already holds.
+
+		// METHODOLOGY EMPLOYED:
+		// Same layout as the CTF cache: a signature, then appended records of the key hash, the
+		// key and value counts, the full key and the values.
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		ScheduleFileCache.Active = false;
+		ScheduleFileCache.Index.clear();
+		ScheduleFileCache.NumHits = 0;
+		ScheduleFileCache.NumMisses = 0;
+		if ( ScheduleFileCache.File.is_open() ) ScheduleFileCache.File.close();
+		if ( FileName.empty() ) return;
+
+		ScheduleFileCache.FileName = FileName;
+
+		// Try the existing file first
+		auto & File( ScheduleFileCache.File );
+		bool Valid( false );
+		File.open( FileName, std::ios::in | std::ios::out | std::ios::binary );
+		if ( File.is_open() ) {
+			File.seekg( 0, std::ios::end );
+			std::streamoff const FileSize( File.tellg() );
+			File.seekg( 0 );
+			char Magic[ 8 ];
+			File.read( Magic, 8 );
+			Valid = File.good() && ( std::string( Magic, 8 ) == ScheduleFileCacheMagic );
+			while ( Valid ) { // Index the records
+				std::streamoff const Offset( File.tellg() );
+				std::uint64_t Hash( 0u );
+				int Head[ 2 ]; // Number of key entries and values
+				File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+				if ( File.gcount() == 0 && File.eof() ) break; // End of file
+				File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+				if ( ! File.good() || Head[ 0 ] < 0 || Head[ 1 ] < 0 ) {
+					Valid = false; // Truncated record
+					break;
+				}
+				std::streamoff const Skip( std::streamoff( Head[ 0 ] + Head[ 1 ] ) * sizeof( Real64 ) );
+				if ( File.tellg() + Skip > FileSize ) {
+					Valid = false; // Truncated record
+					break;
+				}
+				File.seekg( Skip, std::ios::cur );
+				ScheduleFileCache.Index[ Hash ] = Offset;
+			}
+			File.clear();
+			if ( ! Valid ) File.close();
+		}
+
+		if ( ! Valid ) { // Start a new file
+			ScheduleFileCache.Index.clear();
+			File.open( FileName, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc );
+			if ( ! File.is_open() ) {
+				ShowWarningError( "InitScheduleFileCache: Could not open Schedule:File cache file \"" + FileName + "\"; Schedule:File files are read without the cache." );
+				return;
+			}
+			File.write( ScheduleFileCacheMagic.c_str(), 8 );
+			File.flush();
+		}
+
+		ScheduleFileCache.Active = File.good();
+		if ( ScheduleFileCache.Active ) {
+			ShowMessage( "InitScheduleFileCache: Using Schedule:File cache file \"" + FileName + "\" with " + TrimSigDigits( int( ScheduleFileCache.Index.size() ) ) + " cached columns." );
+		}
+
+	}
+
+	std::vector< Real64 >
+	ScheduleFileCacheKey(
+		std::string const & FullFileName, // Schedule:File file
+		int const ColumnNum, // Column of the values
+		int const SkipRows, // Number of rows skipped at the top of the file
+		int const RowLimit, // Number of rows read
+		std::string const & ColumnSep // Column separator
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the cache key of a Schedule:File column: the hash and size of the file contents
+		// and the settings the column is read with.  Returns an empty key if the file cannot be read.
+
+		// METHODOLOGY EMPLOYED:
+		// The key follows the contents rather than the file name or time stamp, so an edited file
+		// is read again and copies of a file under other names share the cached columns.  The
+		// interpolation and minutes per item settings only apply after the read and are not part of it.
+
+		std::vector< Real64 > Key;
+		std::ifstream File( FullFileName, std::ios::in | std::ios::binary );
+		if ( ! File.is_open() ) return Key;
+		File.seekg( 0, std::ios::end );
+		std::streamoff const FileSize( File.tellg() );
+		if ( FileSize < 0 ) return Key;
+		File.seekg( 0 );
+		std::string Contents( static_cast< std::string::size_type >( FileSize ), '\0' );
+		File.read( &Contents[ 0 ], FileSize );
+		if ( File.gcount() != FileSize ) return Key;
+
+		std::uint64_t const Hash( ScheduleFileCacheHash( Contents.data(), Contents.size() ) );
+		Key.reserve( 7 );
+		Key.push_back( Real64( Hash >> 32 ) ); // Each half is exact as a double
+		Key.push_back( Real64( Hash & 0xFFFFFFFFull ) );
+		Key.push_back( Real64( FileSize ) );
+		Key.push_back( ColumnNum );
+		Key.push_back( SkipRows );
+		Key.push_back( RowLimit );
+		Key.push_back( ColumnSep.empty() ? 0.0 : Real64( static_cast< unsigned char >( ColumnSep[ 0 ] ) ) );
+		return Key;
+
+	}
+
+	std::uint64_t
+	ScheduleFileCacheHash(
+		char const * Bytes, // Data to hash
+		std::size_t const NumBytes // Number of bytes
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the 64 bit FNV-1a hash of a block of data.
+
+		std::uint64_t Hash( 14695981039346656037ull ); // FNV offset basis
+		for ( std::size_t i = 0; i < NumBytes; ++i ) {
+			Hash ^= static_cast< unsigned char >( Bytes[ i ] );
+			Hash *= 1099511628211ull; // FNV prime
+		}
+		return Hash;
+
+	}
+
+	bool
+	RestoreScheduleFileFromCache(
+		std::vector< Real64 > const & Key, // Cache key of the column
+		int const RowLimit, // Number of rows read
+		int & RowCount, // Number of rows read from the file
+		int & NumErrors, // Number of rows whose value could not be read
+		Array1< Real64 > & Values // Values of the rows read
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets the row count, the number of rows in error and the values of a Schedule:File
+		// column from the cache file, as the text read leaves them.  Returns false if the key
+		// is not cached (or the record cannot be read).
+
+		// METHODOLOGY EMPLOYED:
+		// The stored key must match the whole key, not just its hash.
+
+		auto const Found( ScheduleFileCache.Index.find( ScheduleFileCacheHash( reinterpret_cast< char const * >( Key.data() ), Key.size() * sizeof( Real64 ) ) ) );
+		if ( Found == ScheduleFileCache.Index.end() ) return false;
+
+		auto & File( ScheduleFileCache.File );
+		File.clear();
+		File.seekg( Found->second );
+		std::uint64_t Hash( 0u );
+		int Head[ 2 ];
+		File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+		File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+		if ( ! File.good() || Head[ 0 ] != int( Key.size() ) || Head[ 1 ] < 2 || Head[ 1 ] - 2 > RowLimit || Head[ 1 ] - 2 > int( Values.size() ) ) {
+			File.clear();
+			return false;
+		}
+		std::vector< Real64 > StoredKey( Key.size() );
+		std::vector< Real64 > Stored( Head[ 1 ] );
+		File.read( reinterpret_cast< char * >( StoredKey.data() ), StoredKey.size() * sizeof( Real64 ) );
+		if ( ! File.good() || StoredKey != Key ) {
+			File.clear();
+			return false;
+		}
+		File.read( reinterpret_cast< char * >( Stored.data() ), Stored.size() * sizeof( Real64 ) );
+		if ( ! File.good() || int( Stored[ 0 ] ) != Head[ 1 ] - 2 ) {
+			File.clear();
+			ScheduleFileCache.Index.erase( Found );
+			return false;
+		}
+
+		RowCount = int( Stored[ 0 ] );
+		NumErrors = int( Stored[ 1 ] );
+		for ( int Row = 1; Row <= RowCount; ++Row ) {
+			Values( Row ) = Stored[ Row + 1 ];
+		}
+		++ScheduleFileCache.NumHits;
+		return true;
+
+	}
+
+	void
+	SaveScheduleFileToCache(
+		std::vector< Real64 > const & Key, // Cache key of the column
+		int const RowCount, // Number of rows read from the file
+		int const NumErrors, // Number of rows whose value could not be read
+		Array1< Real64 > const & Values // Values of the rows read
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends a Schedule:File column to the cache file, in RestoreScheduleFileFromCache order.
+
+		std::uint64_t const Hash( ScheduleFileCacheHash( reinterpret_cast< char const * >( Key.data() ), Key.size() * sizeof( Real64 ) ) );
+		if ( ScheduleFileCache.Index.find( Hash ) != ScheduleFileCache.Index.end() ) return;
+		int const Head[ 2 ] = { int( Key.size() ), RowCount + 2 };
+		std::vector< Real64 > Stored;
+		Stored.reserve( Head[ 1 ] );
+		Stored.push_back( RowCount );
+		Stored.push_back( NumErrors );
+		for ( int Row = 1; Row <= RowCount; ++Row ) {
+			Stored.push_back( Values( Row ) );
+		}
+
+		auto & File( ScheduleFileCache.File );
+		File.clear();
+		File.seekp( 0, std::ios::end );
+		std::streamoff const Offset( File.tellp() );
+		File.write( reinterpret_cast< char const * >( &Hash ), sizeof( Hash ) );
+		File.write( reinterpret_cast< char const * >( Head ), sizeof( Head ) );
+		File.write( reinterpret_cast< char const * >( Key.data() ), Key.size() * sizeof( Real64 ) );
+		File.write( reinterpret_cast< char const * >( Stored.data() ), Stored.size() * sizeof( Real64 ) );
+		File.flush();
+		if ( File.good() ) {
+			ScheduleFileCache.Index[ Hash ] = Offset;
+			++ScheduleFileCache.NumMisses;
+		} else {
+			ShowWarningError( "SaveScheduleFileToCache: Could not write Schedule:File cache file \"" + ScheduleFileCache.FileName + "\"; remaining Schedule:File files are read without the cache." );
+			ScheduleFileCache.Active = false;
+		}
+
+	}
+
 	void
 	ReportScheduleDetails( int const LevelOfDetail ) // =1: hourly; =2: timestep; = 3: make IDF excerpt
 	{
@@ -2012,7 +2352,7 @@ namespace ScheduleManager {
 				}
 				for ( Hr = 1; Hr <= 24; ++Hr ) {
 					for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
-						RoundTSValue( TS, Hr ) = RoundSigDigits( DaySchedule( Count ).TSValue( TS, Hr ), 2 );
+						RoundTSValue( TS, Hr ) = RoundSigDigits( DaySchedule( DaySchedule( Count ).SameAs > 0 ? DaySchedule( Count ).SameAs : Count ).TSValue( TS, Hr ), 2 );
 					}
 				}
 				if ( LevelOfDetail == 1 ) {
@@ -2247,6 +2587,71 @@ namespace ScheduleManager {
 		}
 	}
 
+	void
+	SetActiveDaySchedules()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Resolves the day schedule of every schedule for the current day and gathers their
+		// values, so each timestep of the day reads the values of all schedules from one array.
+
+		// METHODOLOGY EMPLOYED:
+		// Week and day schedule selection of UpdateScheduleValues.  The values are stored by
+		// timestep of the day, then by schedule, so a timestep reads consecutive values.
+
+		// Using/Aliasing
+		using DataEnvironment::DayOfYear_Schedule;
+
+		int const NumDayTimeSteps( 24 * NumOfTimeStepInHour );
+		ActiveDaySchedulePtr.dimension( NumSchedules, 0 );
+		ActiveDayValues.dimension( NumDayTimeSteps, NumSchedules );
+
+		for ( int ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+
+			// Determine which Week Schedule is used
+			//  Cant use stored day of year because of leap year inconsistency
+			int const WeekSchedulePointer( Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule ) );
+
+			// Now, which day?
+			int DaySchedulePointer;
+			if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
+				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
+			} else {
+				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
+			}
+			ActiveDaySchedulePtr( ScheduleIndex ) = DaySchedulePointer;
+
+			auto const & TSValue( DaySchedule( DaySchedulePointer ).TSValue );
+			int DayTimeStep( 0 );
+			for ( int Hour = 1; Hour <= 24; ++Hour ) {
+				for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+					ActiveDayValues( ++DayTimeStep, ScheduleIndex ) = TSValue( TS, Hour );
+				}
+			}
+
+		}
+
+		ActiveDayOfYear = DayOfYear_Schedule;
+		ActiveDayOfWeek = DayOfWeek;
+		ActiveHolidayIndex = HolidayIndex;
+		ActiveDayValid = true;
+
+	}
+
+	bool
+	ActiveDayIsCurrent()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// True when the active day schedules are those of the current day.
+
+		// Using/Aliasing
+		using DataEnvironment::DayOfYear_Schedule;
+
+		return ActiveDayValid && DayOfYear_Schedule == ActiveDayOfYear && DayOfWeek == ActiveDayOfWeek && HolidayIndex == ActiveHolidayIndex && ActiveDaySchedulePtr.isize() == NumSchedules;
+
+	}
+
 	void
 	UpdateScheduleValues()
 	{
@@ -2288,38 +2693,28 @@ namespace ScheduleManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ScheduleIndex;
 		int WhichHour;
-		int WeekSchedulePointer;
-		int DaySchedulePointer;
+		int WhichTimeStep;
 
 		if ( ! ScheduleInputProcessed ) {
 			ProcessScheduleInput();
 			ScheduleInputProcessed = true;
 		}
 
-		WhichHour = HourOfDay + DSTIndicator;
-
-		for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
-
-			// Determine which Week Schedule is used
-			//  Cant use stored day of year because of leap year inconsistency
-			WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
+		if ( ! ActiveDayIsCurrent() ) SetActiveDaySchedules();
 
-			// Now, which day?
-			if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
-			} else {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
-			}
+		// Hourly Value
+		WhichHour = HourOfDay + DSTIndicator;
+		WhichTimeStep = TimeStep;
+		if ( WhichHour > 24 ) {
+			WhichHour -= 24;
+			if ( WhichTimeStep > NumOfTimeStepInHour ) WhichTimeStep = NumOfTimeStepInHour;
+		}
 
-			// Hourly Value
-			if ( WhichHour <= 24 ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour );
-			} else if ( TimeStep <= NumOfTimeStepInHour ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour - 24 );
-			} else {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( NumOfTimeStepInHour, WhichHour - 24 );
+		if ( NumSchedules > 0 ) {
+			Real64 const * Values( &ActiveDayValues( ( WhichHour - 1 ) * NumOfTimeStepInHour + WhichTimeStep, 1 ) );
+			for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+				Schedule( ScheduleIndex ).CurrentValue = *Values++;
 			}
-
 		}
 
 	}
@@ -2427,6 +2822,8 @@ namespace ScheduleManager {
 					}
 					WhichHour -= 24;
 				}
+			} else if ( ActiveDayIsCurrent() ) {
+				DaySchedulePointer = ActiveDaySchedulePtr( ScheduleIndex );
 			} else {
 				// Determine which Week Schedule is used
 				//  Cant use stored day of year because of leap year inconsistency
@@ -2641,6 +3038,7 @@ namespace ScheduleManager {
 		if ( NumDaySchedules > 0 ) {
 			GetDayScheduleIndex = FindItemInList( ScheduleName, DaySchedule( {1,NumDaySchedules} ).Name(), NumDaySchedules );
 			if ( GetDayScheduleIndex > 0 ) {
+				if ( DaySchedule( GetDayScheduleIndex ).SameAs > 0 ) GetDayScheduleIndex = DaySchedule( GetDayScheduleIndex ).SameAs;
 				DaySchedule( GetDayScheduleIndex ).Used = true;
 			}
 		} else {
@@ -2782,7 +3180,11 @@ namespace ScheduleManager {
 		}
 
 		// Return Values
-		DayValues( {1,NumOfTimeStepInHour}, {1,24} ) = DaySchedule( DayScheduleIndex ).TSValue;
+		if ( DaySchedule( DayScheduleIndex ).SameAs > 0 ) {
+			DayValues( {1,NumOfTimeStepInHour}, {1,24} ) = DaySchedule( DaySchedule( DayScheduleIndex ).SameAs ).TSValue;
+		} else {
+			DayValues( {1,NumOfTimeStepInHour}, {1,24} ) = DaySchedule( DayScheduleIndex ).TSValue;
+		}
 
 	}
 
@@ -2837,6 +3239,7 @@ namespace ScheduleManager {
 				DaySchedule( ScheduleIndex ).TSValue( TS, Hr ) = Value;
 			}
 		}
+		ActiveDayValid = false; // Day values gathered before this are stale
 	}
 
 	void
@@ -3479,8 +3882,13 @@ namespace ScheduleManager {
 		//precompute the dayschedule max and min so that it is not in nested loop
 		if ( RunOnceOnly ) {
 			for ( Loop = 0; Loop <= NumDaySchedules; ++Loop ) {
-				DaySchedule( Loop ).TSValMin = minval( DaySchedule( Loop ).TSValue );
-				DaySchedule( Loop ).TSValMax = maxval( DaySchedule( Loop ).TSValue );
+				if ( DaySchedule( Loop ).SameAs > 0 ) { // Shared day schedules follow the one holding their values
+					DaySchedule( Loop ).TSValMin = DaySchedule( DaySchedule( Loop ).SameAs ).TSValMin;
+					DaySchedule( Loop ).TSValMax = DaySchedule( DaySchedule( Loop ).SameAs ).TSValMax;
+				} else {
+					DaySchedule( Loop ).TSValMin = minval( DaySchedule( Loop ).TSValue );
+					DaySchedule( Loop ).TSValMax = maxval( DaySchedule( Loop ).TSValue );
+				}
 			}
 			RunOnceOnly = false;
 		}
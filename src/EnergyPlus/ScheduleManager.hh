@@ -1,6 +1,13 @@
 #ifndef ScheduleManager_hh_INCLUDED
 #define ScheduleManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1D.hh>
@@ -50,6 +57,14 @@ namespace ScheduleManager {
 	extern bool ScheduleInputProcessed; // This is false until the Schedule Input has been processed.
 	extern bool ScheduleDSTSFileWarningIssued;
 
+	// Day schedules of the current day, resolved once a day for UpdateScheduleValues
+	extern bool ActiveDayValid; // False when ActiveDayValues must be rebuilt
+	extern int ActiveDayOfYear; // Day the active day schedules were resolved for
+	extern int ActiveDayOfWeek;
+	extern int ActiveHolidayIndex;
+	extern Array1D_int ActiveDaySchedulePtr; // Day schedule of each schedule today
+	extern Array2D< Real64 > ActiveDayValues; // (timestep of the day, schedule) values today
+
 	//Derived Types Variables
 
 	// Types
@@ -102,6 +117,7 @@ namespace ScheduleManager {
 		Array2D< Real64 > TSValue; // Value array by simulation timestep
 		Real64 TSValMax; // maximum of all TSValue's
 		Real64 TSValMin; // minimum of all TSValue's
+		int SameAs; // Day schedule holding the values when this one duplicates it (TSValue is then empty)
 
 		// Default Constructor
 		DayScheduleData() :
@@ -109,7 +125,8 @@ namespace ScheduleManager {
 			IntervalInterpolated( false ),
 			Used( false ),
 			TSValMax( 0.0 ),
-			TSValMin( 0.0 )
+			TSValMin( 0.0 ),
+			SameAs( 0 )
 		{}
 
 		// Member Constructor
@@ -128,7 +145,8 @@ namespace ScheduleManager {
 			Used( Used ),
 			TSValue( TSValue ),
 			TSValMax( TSValMax ),
-			TSValMin( TSValMin )
+			TSValMin( TSValMin ),
+			SameAs( 0 )
 		{}
 
 	};
@@ -217,23 +235,93 @@ namespace ScheduleManager {
 
 	};
 
+	struct ScheduleFileCacheData
+	{
+		// On-disk cache of the columns read from Schedule:File files, keyed by the file contents
+		// and the column settings, so later runs with the same files skip the text parsing
+
+		// Members
+		bool Active; // True when Schedule:File columns are read from and written to the cache file
+		std::string FileName; // Cache file name
+		std::fstream File; // Cache file, records are appended as they are read
+		std::map< std::uint64_t, std::streamoff > Index; // Record offset of each cached key hash
+		int NumHits; // Number of Schedule:File columns taken from the cache
+		int NumMisses; // Number of Schedule:File columns parsed and added to the cache
+
+		// Default Constructor
+		ScheduleFileCacheData() :
+			Active( false ),
+			NumHits( 0 ),
+			NumMisses( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< ScheduleTypeData > ScheduleType; // Allowed Schedule Types
 	extern Array1D< DayScheduleData > DaySchedule; // Day Schedule Storage
 	extern Array1D< WeekScheduleData > WeekSchedule; // Week Schedule Storage
 	extern Array1D< ScheduleData > Schedule; // Schedule Storage
+	extern ScheduleFileCacheData ScheduleFileCache;
 
 	// Functions
 
 	void
 	ProcessScheduleInput();
 
+	void
+	ShareDuplicateDaySchedules(
+		int const FirstDaySch, // First day schedule that may be shared
+		int const LastDaySch // Last day schedule that may be shared
+	);
+
+	void
+	InitScheduleFileCache( std::string const & FileName ); // Cache file name, empty for no cache
+
+	std::vector< Real64 >
+	ScheduleFileCacheKey(
+		std::string const & FullFileName, // Schedule:File file
+		int const ColumnNum, // Column of the values
+		int const SkipRows, // Number of rows skipped at the top of the file
+		int const RowLimit, // Number of rows read
+		std::string const & ColumnSep // Column separator
+	);
+
+	std::uint64_t
+	ScheduleFileCacheHash(
+		char const * Bytes, // Data to hash
+		std::size_t const NumBytes // Number of bytes
+	);
+
+	bool
+	RestoreScheduleFileFromCache(
+		std::vector< Real64 > const & Key, // Cache key of the column
+		int const RowLimit, // Number of rows read
+		int & RowCount, // Number of rows read from the file
+		int & NumErrors, // Number of rows whose value could not be read
+		Array1< Real64 > & Values // Values of the rows read
+	);
+
+	void
+	SaveScheduleFileToCache(
+		std::vector< Real64 > const & Key, // Cache key of the column
+		int const RowCount, // Number of rows read from the file
+		int const NumErrors, // Number of rows whose value could not be read
+		Array1< Real64 > const & Values // Values of the rows read
+	);
+
 	void
 	ReportScheduleDetails( int const LevelOfDetail ); // =1: hourly; =2: timestep; = 3: make IDF excerpt
 
 	Real64
 	GetCurrentScheduleValue( int const ScheduleIndex );
 
+	void
+	SetActiveDaySchedules();
+
+	bool
+	ActiveDayIsCurrent();
+
 	void
 	UpdateScheduleValues();
 
@@ -22,6 +22,7 @@
 #include <DataHVACControllers.hh>
 #include <DataHVACGlobals.hh>
 #include <DataLoopNode.hh>
+#include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSystemVariables.hh>
@@ -50,6 +51,7 @@
 #include <NodeInputManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <Profiler.hh>
 #include <Psychrometrics.hh>
 #include <ReportSizingManager.hh>
 #include <SplitterComponent.hh>
@@ -145,6 +147,10 @@ namespace SimAirServingZones {
 	// MODULE VARIABLE DECLARATIONS:
 	bool GetAirLoopInputFlag( true ); // Flag set to make sure you get input once
 	int NumOfTimeStepInDay; // number of zone time steps in a day
+	bool AirLoopGroupsSet( false ); // True once the independent air loop groups have been found
+	int NumAirLoopGroups( 0 ); // Number of groups of air loops that share nothing with other groups
+	Array1D_int AirLoopGroup; // Group of each air loop
+	int AirLoopControllerIterations( 0 ); // Iterations of all air loop controllers in the current HVAC time step
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -2097,6 +2103,9 @@ namespace SimAirServingZones {
 
 		// FLOW:
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "SimAirLoops" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		// Set up output variables
 		if ( ! OutputSetupFlag ) {
 			SetupOutputVariable( "Air System Simulation Maximum Iteration Count []", IterMax, "HVAC", "Sum", "SimAir" );
@@ -2190,9 +2199,109 @@ namespace SimAirServingZones {
 
 		} // End of Air Loop iteration
 
+		AirLoopControllerIterations = IterTot;
+
 		// Reset current system number for sizing routines
 		CurSysNum = 0;
 
+		// The controllers know their plant loops once they have been simulated
+		if ( ! AirLoopGroupsSet ) SetAirLoopGroups();
+
+	}
+
+	void
+	SetAirLoopGroups()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sorts the primary air systems into groups that share no air nodes and no plant loops, so
+		// the loops of one group do not affect those of another within an HVAC iteration.
+
+		// METHODOLOGY EMPLOYED:
+		// Union-find over the air loops: two loops are joined when a node of one is a node of the
+		// other, or when their controllers or plant connected components are on the same plant
+		// loop.  Groups are numbered in the order of their first air loop.
+
+		// Using/Aliasing
+		using DataPlant::TotNumLoops;
+		using HVACControllers::ControllerProps;
+
+		Array1D_int Parent( NumPrimaryAirSys ); // Union-find forest over the air loops
+		for ( int AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) Parent( AirLoopNum ) = AirLoopNum;
+		auto FindRoot = [ &Parent ]( int AirLoopNum ) -> int {
+			while ( Parent( AirLoopNum ) != AirLoopNum ) {
+				Parent( AirLoopNum ) = Parent( Parent( AirLoopNum ) );
+				AirLoopNum = Parent( AirLoopNum );
+			}
+			return AirLoopNum;
+		};
+		Array1D_int NodeAirLoop( NumOfNodes, 0 ); // First air loop found using each node
+		Array1D_int PlantAirLoop( TotNumLoops, 0 ); // First air loop found using each plant loop
+		auto JoinNode = [ & ]( int const NodeNum, int const AirLoopNum ) {
+			if ( NodeNum < 1 || NodeNum > NumOfNodes ) return;
+			if ( NodeAirLoop( NodeNum ) == 0 ) {
+				NodeAirLoop( NodeNum ) = AirLoopNum;
+			} else {
+				Parent( FindRoot( AirLoopNum ) ) = FindRoot( NodeAirLoop( NodeNum ) );
+			}
+		};
+		auto JoinPlant = [ & ]( int const PlantLoopNum, int const AirLoopNum ) {
+			if ( PlantLoopNum < 1 || PlantLoopNum > TotNumLoops ) return;
+			if ( AirLoopNum < 1 || AirLoopNum > NumPrimaryAirSys ) return;
+			if ( PlantAirLoop( PlantLoopNum ) == 0 ) {
+				PlantAirLoop( PlantLoopNum ) = AirLoopNum;
+			} else {
+				Parent( FindRoot( AirLoopNum ) ) = FindRoot( PlantAirLoop( PlantLoopNum ) );
+			}
+		};
+
+		for ( int AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			auto const & airSys( PrimaryAirSystem( AirLoopNum ) );
+			for ( int BranchNum = 1; BranchNum <= airSys.NumBranches; ++BranchNum ) {
+				auto const & branch( airSys.Branch( BranchNum ) );
+				for ( int NodeIndex = 1; NodeIndex <= branch.TotalNodes; ++NodeIndex ) JoinNode( branch.NodeNum( NodeIndex ), AirLoopNum );
+				for ( int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+					JoinNode( branch.Comp( CompNum ).NodeNumIn, AirLoopNum );
+					JoinNode( branch.Comp( CompNum ).NodeNumOut, AirLoopNum );
+				}
+			}
+			if ( airSys.OASysExists ) {
+				JoinNode( airSys.OASysInletNodeNum, AirLoopNum );
+				JoinNode( airSys.OASysOutletNodeNum, AirLoopNum );
+				JoinNode( airSys.OAMixOAInNodeNum, AirLoopNum );
+			}
+			if ( AirLoopNum <= AirToZoneNodeInfo.isize() ) {
+				auto const & airToZone( AirToZoneNodeInfo( AirLoopNum ) );
+				for ( int OutNum = 1; OutNum <= airToZone.NumSupplyNodes; ++OutNum ) JoinNode( airToZone.AirLoopSupplyNodeNum( OutNum ), AirLoopNum );
+				for ( int InNum = 1; InNum <= airToZone.NumReturnNodes; ++InNum ) JoinNode( airToZone.AirLoopReturnNodeNum( InNum ), AirLoopNum );
+			}
+			for ( int CtrlNum = 1; CtrlNum <= airSys.NumControllers; ++CtrlNum ) {
+				int const ControllerIndex( airSys.ControllerIndex( CtrlNum ) );
+				if ( ControllerIndex < 1 || ControllerIndex > ControllerProps.isize() ) continue;
+				JoinNode( ControllerProps( ControllerIndex ).ActuatedNode, AirLoopNum );
+				JoinPlant( ControllerProps( ControllerIndex ).ActuatedNodePlantLoopNum, AirLoopNum );
+			}
+		}
+		// Plant coils without a controller of their own, as found by the energy reports
+		for ( int Num = 1; Num <= AirSysCompToPlant.isize(); ++Num ) {
+			JoinPlant( AirSysCompToPlant( Num ).PlantLoopNum, AirSysCompToPlant( Num ).AirLoopNum );
+		}
+		for ( int Num = 1; Num <= AirSysSubCompToPlant.isize(); ++Num ) {
+			JoinPlant( AirSysSubCompToPlant( Num ).PlantLoopNum, AirSysSubCompToPlant( Num ).AirLoopNum );
+		}
+		for ( int Num = 1; Num <= AirSysSubSubCompToPlant.isize(); ++Num ) {
+			JoinPlant( AirSysSubSubCompToPlant( Num ).PlantLoopNum, AirSysSubSubCompToPlant( Num ).AirLoopNum );
+		}
+
+		AirLoopGroup.dimension( NumPrimaryAirSys, 0 );
+		NumAirLoopGroups = 0;
+		for ( int AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			int const Root( FindRoot( AirLoopNum ) );
+			if ( AirLoopGroup( Root ) == 0 ) AirLoopGroup( Root ) = ++NumAirLoopGroups;
+			AirLoopGroup( AirLoopNum ) = AirLoopGroup( Root );
+		}
+		AirLoopGroupsSet = true;
+
 	}
 
 	void
@@ -2715,6 +2824,7 @@ namespace SimAirServingZones {
 				CompType_Num = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).CompType_Num;
 
 				// Simulate each component on PrimaryAirSystem(AirLoopNum)%Branch(BranchNum)%Name
+				Profiler::ComponentTimer const Timer( PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).TypeOf, PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name );
 				SimAirLoopComponent( PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name, CompType_Num, FirstHVACIteration, AirLoopNum, PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).CompIndex );
 			} // End of component loop
 
@@ -4401,6 +4511,49 @@ namespace SimAirServingZones {
 
 	}
 
+	void
+	DeallocateSysSizingSequences()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Deallocate the daily sequences of the design day by air loop SysSizing array once
+		// the system sizing is complete; the sizing of the components and the reports after it
+		// use only CalcSysSizing and FinalSysSizing.
+
+		// METHODOLOGY EMPLOYED:
+		// Use the DEALLOCATE command. The sequences are last read in UpdateSysSizing( EndSysSizingCalc ),
+		// which writes them to the system sizing file.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int DesDayEnvrnNum; // design day index
+		int AirLoopNum; // primary air system index
+
+		if ( ! allocated( SysSizing ) ) return;
+
+		for ( DesDayEnvrnNum = 1; DesDayEnvrnNum <= SysSizing.isize1(); ++DesDayEnvrnNum ) {
+			for ( AirLoopNum = 1; AirLoopNum <= SysSizing.isize2(); ++AirLoopNum ) {
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).HeatFlowSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).CoolFlowSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SumZoneCoolLoadSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).CoolZoneAvgTempSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SensCoolCapSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).TotCoolCapSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).HeatCapSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).PreheatCapSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysCoolRetTempSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysCoolRetHumRatSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysHeatRetTempSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysHeatRetHumRatSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysCoolOutTempSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysCoolOutHumRatSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysHeatOutTempSeq.deallocate();
+				SysSizing( DesDayEnvrnNum, AirLoopNum ).SysHeatOutHumRatSeq.deallocate();
+			}
+		}
+
+	}
+
 	void
 	UpdateSysSizing( int const CallIndicator )
 	{
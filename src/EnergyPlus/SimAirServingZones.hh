@@ -4,6 +4,9 @@
 // C++ Headers
 #include <string>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
@@ -54,6 +57,10 @@ namespace SimAirServingZones {
 	// MODULE VARIABLE DECLARATIONS:
 	extern bool GetAirLoopInputFlag; // Flag set to make sure you get input once
 	extern int NumOfTimeStepInDay; // number of zone time steps in a day
+	extern bool AirLoopGroupsSet; // True once the independent air loop groups have been found
+	extern int NumAirLoopGroups; // Number of groups of air loops that share nothing with other groups
+	extern Array1D_int AirLoopGroup; // Group of each air loop
+	extern int AirLoopControllerIterations; // Iterations of all air loop controllers in the current HVAC time step
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -97,6 +104,9 @@ namespace SimAirServingZones {
 		bool & SimZoneEquipment
 	);
 
+	void
+	SetAirLoopGroups();
+
 	void
 	SimAirLoop(
 		bool const FirstHVACIteration,
@@ -169,6 +179,9 @@ namespace SimAirServingZones {
 	void
 	SetUpSysSizingArrays();
 
+	void
+	DeallocateSysSizingSequences();
+
 	void
 	UpdateSysSizing( int const CallIndicator );
 
@@ -4,8 +4,18 @@ extern "C" {
 }
 
 // C++ Headers
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/environment.hh>
@@ -20,12 +30,15 @@ extern "C" {
 #include <SimulationManager.hh>
 #include <BranchInputManager.hh>
 #include <BranchNodeConnections.hh>
+#include <ColumnarOutput.hh>
+#include <CsvOutput.hh>
 #include <CostEstimateManager.hh>
 #include <CurveManager.hh>
 #include <DataAirLoop.hh>
 #include <DataBranchNodeConnections.hh>
 #include <DataContaminantBalance.hh>
 #include <DataConvergParams.hh>
+#include <DataDaylighting.hh>
 #include <DataEnvironment.hh>
 #include <DataErrorTracking.hh>
 #include <DataGlobalConstants.hh>
@@ -45,6 +58,7 @@ extern "C" {
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
 #include <DataTimings.hh>
+#include <DataZoneControls.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -55,6 +69,7 @@ extern "C" {
 #include <ExteriorEnergyUse.hh>
 #include <ExternalInterface.hh>
 #include <FaultsManager.hh>
+#include <FileSystem.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <GeneralRoutines.hh>
@@ -66,6 +81,7 @@ extern "C" {
 #include <HVACSizingSimulationManager.hh>
 #include <InputProcessor.hh>
 #include <ManageElectricPower.hh>
+#include <MemoryReport.hh>
 #include <MixedAir.hh>
 #include <NodeInputManager.hh>
 #include <OutAirNodeManager.hh>
@@ -73,11 +89,16 @@ extern "C" {
 #include <OutputReportPredefined.hh>
 #include <OutputReportTabular.hh>
 #include <OutputReports.hh>
+#include <OutputWriterThread.hh>
 #include <PlantManager.hh>
 #include <PollutionModule.hh>
 #include <PlantPipingSystemsManager.hh>
+#include <Profiler.hh>
 #include <Psychrometrics.hh>
 #include <RefrigeratedCase.hh>
+#include <RuntimeLanguageProcessor.hh>
+#include <RuntimeMetrics.hh>
+#include <ScheduleManager.hh>
 #include <SetPointManager.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
@@ -90,6 +111,12 @@ extern "C" {
 #include <ZoneEquipmentManager.hh>
 #include <Timer.h>
 
+#ifndef _WIN32
+ #include <sys/types.h>
+ #include <sys/wait.h>
+ #include <unistd.h>
+#endif
+
 namespace EnergyPlus {
 
 // HBIRE_USE_OMP defined, then openMP instructions are used.  Compiler may have to have switch for openmp
@@ -150,6 +177,21 @@ namespace SimulationManager {
 	// MODULE VARIABLE DECLARATIONS:
 	bool RunPeriodsInInput( false );
 	bool RunControlInInput( false );
+	bool ParallelEnvironmentsActive( false ); // Each environment of the primary simulation is written to segments joined in order at the end
+	bool EnvironmentWorker( false ); // This process is a forked worker simulating one environment
+	int EnvironmentSegment( 0 ); // Environment count of the segment being written, 0 if none
+	std::vector< int > SegmentEnvironments; // Environment count of each segment to join, in environment order
+	std::vector< int > FailedEnvironments; // Environment count of each worker that did not complete
+	std::vector< int > SegmentStartCounts; // Run counters at the start of the segment
+	std::vector< std::pair< int, std::string > > DivertedOutputFiles; // Unit and name of each output file written to the segment
+	bool WeatherEnsembleActive( false ); // The primary simulation is also run with each weather file of an ensemble, by forked members
+	int EnsembleMember( 0 ); // Member of the ensemble simulated by this process, 0 for the input weather file
+	std::vector< std::string > EnsembleWeatherFileNames; // Weather file of each member, by member number - 1
+	std::vector< int > FailedEnsembleMembers; // Member number of each member that did not complete
+#ifndef _WIN32
+	std::map< pid_t, int > EnvironmentWorkers; // Environment count of each worker still running
+	std::map< pid_t, int > EnsembleMembers; // Member number of each member still running
+#endif
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -205,6 +247,7 @@ namespace SimulationManager {
 		using General::TrimSigDigits;
 		using OutputReportPredefined::SetPredefinedTables;
 		using HVACControllers::DumpAirLoopStatistics;
+		using RuntimeLanguageProcessor::ReportRuntimeLanguageProfile;
 		using NodeInputManager::SetupNodeVarsForReporting;
 		using NodeInputManager::CheckMarkedNodes;
 		using BranchNodeConnections::CheckNodeConnections;
@@ -230,6 +273,7 @@ namespace SimulationManager {
 		using DataSystemVariables::DeveloperFlag;
 		using DataSystemVariables::TimingFlag;
 		using DataSystemVariables::FullAnnualRun;
+		using DataSystemVariables::ZoneAggregationReport;
 		using SetPointManager::CheckIfAnyIdealCondEntSetPoint;
 		using Psychrometrics::InitializePsychRoutines;
 		using namespace FaultsManager;
@@ -263,8 +307,13 @@ namespace SimulationManager {
 		// Formats
 		static gio::Fmt Format_700( "('Environment:WarmupDays,',I3)" );
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "ManageSimulation" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		//CreateSQLiteDatabase();
 		sqlite = EnergyPlus::CreateSQLiteDatabase();
+		ColumnarOutput::InitColumnarOutput();
+		CsvOutput::InitCsvOutput();
 
 		if ( sqlite ) {
 			sqlite->sqliteBegin();
@@ -286,6 +335,7 @@ namespace SimulationManager {
 		AskForConnectionsReport = false; // set to false until sizing is finished
 
 		OpenOutputFiles();
+		RuntimeMetrics::InitRuntimeMetrics();
 		CheckThreading();
 		GetProjectData();
 		CheckForMisMatchedEnvironmentSpecifications();
@@ -306,6 +356,8 @@ namespace SimulationManager {
 
 		ManageBranchInput(); // just gets input and returns.
 
+		if ( EagerIndependentInput ) GetIndependentInput();
+
 		DoingSizing = true;
 		ManageSizing();
 
@@ -331,6 +383,7 @@ namespace SimulationManager {
 		ResetEnvironmentCounter();
 		SetupSimulation( ErrorsFound );
 		InitCurveReporting();
+		MemoryReport::TakeMemorySnapshot( true );
 
 		AskForConnectionsReport = true; // set to true now that input processing and sizing is done.
 		KickOffSimulation = false;
@@ -377,6 +430,8 @@ namespace SimulationManager {
 
 			CreateEnergyReportStructure();
 
+			if ( ZoneAggregationReport ) ReportZoneAggregation();
+
 			ManageEMS( emsCallFromSetupSimulation ); // point to finish setup processing EMS, sensor ready now
 
 			ProduceRDDMDD();
@@ -399,10 +454,13 @@ namespace SimulationManager {
 			ManageHVACSizingSimulation( ErrorsFound );
 		}
 
+		RunWeatherEnsemble();
+
 		ShowMessage( "Beginning Simulation" );
 		DisplayString( "Beginning Primary Simulation" );
 
 		ResetEnvironmentCounter();
+		SetUpParallelEnvironments();
 
 		EnvCount = 0;
 		WarmupFlag = true;
@@ -429,6 +487,7 @@ namespace SimulationManager {
 
 			ExitDuringSimulations = true;
 			SimsDone = true;
+			if ( ParallelEnvironmentsActive && ForkEnvironmentWorker( EnvCount ) ) continue; // Simulated by a worker
 			DisplayString( "Initializing New Environment Parameters" );
 
 			BeginEnvrnFlag = true;
@@ -505,6 +564,8 @@ namespace SimulationManager {
 
 						ManageHeatBalance();
 
+						RuntimeMetrics::UpdateRuntimeMetrics();
+
 						//  After the first iteration of HeatBalance, all the 'input' has been gotten
 						if ( BeginFullSimFlag ) {
 							if ( GetNumRangeCheckErrorsFound() > 0 ) {
@@ -531,8 +592,14 @@ namespace SimulationManager {
 			// Need one last call to send latest states to middleware
 			ExternalInterfaceExchangeVariables();
 
+			MemoryReport::TakeMemorySnapshot( false );
+
+			if ( ParallelEnvironmentsActive ) EndEnvironmentSegment();
+
 		} // ... End environment loop.
 
+		if ( ParallelEnvironmentsActive ) JoinEnvironmentSegments();
+
 		WarmupFlag = false;
 		if ( ! SimsDone && DoDesDaySim ) {
 			if ( ( TotDesDays + TotRunDesPersDays ) == 0 ) { // if sum is 0, then there was no sizing done.
@@ -557,6 +624,8 @@ namespace SimulationManager {
 
 		ReportForTabularReports(); // For Energy Meters (could have other things that need to be pushed to after simulation)
 
+		MemoryReport::TakeMemorySnapshot( false );
+
 		OpenOutputTabularFile();
 
 		WriteTabularReports(); //     Create the tabular reports at completion of each
@@ -569,9 +638,17 @@ namespace SimulationManager {
 
 		DumpAirLoopStatistics(); // Dump runtime statistics for air loop controller simulation to csv file
 
+		ReportRuntimeLanguageProfile(); // Dump runtime statistics for Erl programs to csv file
+
+		Profiler::WriteProfileSummary(); // Dump the time spent in the profile zones
+
+		RuntimeMetrics::EndRuntimeMetrics();
+
 #ifdef EP_Detailed_Timings
 		epStopTime( "Closeout Reporting=" );
 #endif
+		FinishWeatherEnsemble();
+
 		CloseOutputFiles();
 
 		// sqlite->createZoneExtendedOutput();
@@ -1229,6 +1306,8 @@ namespace SimulationManager {
 
 		// Using/Aliasing
 		using DataStringGlobals::VerString;
+		using DataSystemVariables::UseOutputWriterThread;
+		using OutputWriterThread::StartOutputWriter;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1254,6 +1333,7 @@ namespace SimulationManager {
 			ShowFatalError( "OpenOutputFiles: Could not open file "+DataStringGlobals::outputEsoFileName+" for output (write)." );
 		}
 		eso_stream = gio::out_stream( OutputFileStandard );
+		if ( UseOutputWriterThread ) StartOutputWriter( eso_stream );
 		gio::write( OutputFileStandard, fmtA ) << "Program Version," + VerString;
 
 		// Open the Initialization Output File
@@ -1272,6 +1352,7 @@ namespace SimulationManager {
 			ShowFatalError( "OpenOutputFiles: Could not open file "+DataStringGlobals::outputMtrFileName+" for output (write)." );
 		}
 		mtr_stream = gio::out_stream( OutputFileMeters );
+		if ( UseOutputWriterThread ) StartOutputWriter( mtr_stream );
 		gio::write( OutputFileMeters, fmtA ) << "Program Version," + VerString;
 
 		// Open the Branch-Node Details Output File
@@ -1418,12 +1499,15 @@ namespace SimulationManager {
 
 		gio::write( OutputFileStandard, EndOfDataFormat );
 		gio::write( OutputFileStandard, fmtLD ) << "Number of Records Written=" << StdOutputRecordCount;
+		OutputWriterThread::StopOutputWriter( eso_stream );
 		if ( StdOutputRecordCount > 0 ) {
 			gio::close( OutputFileStandard );
 		} else {
 			{ IOFlags flags; flags.DISPOSE( "DELETE" ); gio::close( OutputFileStandard, flags ); }
 		}
 		eso_stream = nullptr;
+		ColumnarOutput::CloseColumnarOutput();
+		CsvOutput::CloseCsvFile( CsvOutput::EsoCsv, StdOutputRecordCount > 0 );
 
 		if ( any_eq( HeatTransferAlgosUsed, UseCondFD ) ) { // echo out relaxation factor, it may have been changed by the program
 			gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference Numerical Parameters>, Starting Relaxation Factor, Final Relaxation Factor";
@@ -1470,12 +1554,14 @@ namespace SimulationManager {
 		// Close the Meters Output File
 		gio::write( OutputFileMeters, EndOfDataFormat );
 		gio::write( OutputFileMeters, fmtLD ) << "Number of Records Written=" << StdMeterRecordCount;
+		OutputWriterThread::StopOutputWriter( mtr_stream );
 		if ( StdMeterRecordCount > 0 ) {
 			gio::close( OutputFileMeters );
 		} else {
 			{ IOFlags flags; flags.DISPOSE( "DELETE" ); gio::close( OutputFileMeters, flags ); }
 		}
 		mtr_stream = nullptr;
+		CsvOutput::CloseCsvFile( CsvOutput::MtrCsv, StdMeterRecordCount > 0 );
 
 	}
 
@@ -2332,6 +2418,137 @@ namespace SimulationManager {
 
 	}
 
+	void
+	ReportZoneAggregation()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reports the groups of zones alike enough that each group could be simulated as one of its
+		// zones with a zone multiplier, as a guide to a reduced model for load forecasting.
+
+		// METHODOLOGY EMPLOYED:
+		// Zones are alike when they have the same multipliers, floor area and volume, the same heat
+		// transfer surfaces (class, construction, exterior condition, rounded orientation and area),
+		// the same internal gains, infiltration and ventilation (schedule and design level), the
+		// same zone equipment and air loop, and the same thermostat schedules.  Where the zones are
+		// does not count, so neighbours facing the same way are alike.
+
+		// Using/Aliasing
+		using namespace DataHeatBalance;
+		using namespace DataSurfaces;
+		using DataGlobals::NumOfZones;
+		using DataGlobals::OutputFileInits;
+		using DataZoneControls::NumTempControlledZones;
+		using DataZoneControls::TempControlledZone;
+		using DataZoneEquipment::ZoneEquipConfig;
+		using DataZoneEquipment::ZoneEquipInputsFilled;
+		using DataZoneEquipment::ZoneEquipList;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< std::vector< std::string > > Traits( NumOfZones ); // What each zone is made of, by zone - 1
+		std::unordered_map< std::string, int > GroupOfSignature; // Group (0 based) of the zones with each signature
+		std::vector< std::vector< int > > Groups; // Zones of each group
+		int NumHTSurfaces( 0 );
+		int NumGroupHTSurfaces( 0 ); // Heat transfer surfaces of the first zone of each group
+
+		if ( NumOfZones == 0 ) return;
+
+		auto const AddGains = [ &Traits ]( std::string const & Kind, Array1D< ZoneEquipData > const & Gains, int const NumGains ) {
+			for ( int Loop = 1; Loop <= NumGains; ++Loop ) {
+				if ( Gains( Loop ).ZonePtr < 1 ) continue;
+				Traits[ Gains( Loop ).ZonePtr - 1 ].push_back( Kind + RoundSigDigits( Gains( Loop ).SchedPtr ) + ';' + RoundSigDigits( Gains( Loop ).DesignLevel, 2 ) );
+			}
+		};
+
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			auto const & zone( Zone( ZoneNum ) );
+			auto & traits( Traits[ ZoneNum - 1 ] );
+			traits.push_back( "Z" + RoundSigDigits( zone.Multiplier ) + ';' + RoundSigDigits( zone.ListMultiplier ) + ';' + RoundSigDigits( zone.FloorArea, 2 ) + ';' + RoundSigDigits( zone.Volume, 2 ) );
+			for ( int SurfNum = zone.SurfaceFirst; SurfNum <= zone.SurfaceLast; ++SurfNum ) {
+				auto const & surf( Surface( SurfNum ) );
+				if ( ! surf.HeatTransSurf ) continue;
+				++NumHTSurfaces;
+				std::string const ExtBound( surf.ExtBoundCond > 0 ? ( surf.ExtBoundCond == SurfNum ? "A" : "I" ) : RoundSigDigits( surf.ExtBoundCond ) );
+				traits.push_back( "S" + RoundSigDigits( surf.Class ) + ';' + RoundSigDigits( surf.Construction ) + ';' + ExtBound + ';' + RoundSigDigits( surf.Azimuth, 0 ) + ';' + RoundSigDigits( surf.Tilt, 0 ) + ';' + RoundSigDigits( surf.Area, 2 ) );
+			}
+		}
+		for ( int Loop = 1; Loop <= TotPeople; ++Loop ) {
+			if ( People( Loop ).ZonePtr < 1 ) continue;
+			Traits[ People( Loop ).ZonePtr - 1 ].push_back( "P" + RoundSigDigits( People( Loop ).NumberOfPeoplePtr ) + ';' + RoundSigDigits( People( Loop ).ActivityLevelPtr ) + ';' + RoundSigDigits( People( Loop ).NumberOfPeople, 2 ) );
+		}
+		for ( int Loop = 1; Loop <= TotLights; ++Loop ) {
+			if ( Lights( Loop ).ZonePtr < 1 ) continue;
+			Traits[ Lights( Loop ).ZonePtr - 1 ].push_back( "L" + RoundSigDigits( Lights( Loop ).SchedPtr ) + ';' + RoundSigDigits( Lights( Loop ).DesignLevel, 2 ) );
+		}
+		AddGains( "E", ZoneElectric, TotElecEquip );
+		AddGains( "G", ZoneGas, TotGasEquip );
+		AddGains( "O", ZoneOtherEq, TotOthEquip );
+		AddGains( "W", ZoneHWEq, TotHWEquip );
+		AddGains( "T", ZoneSteamEq, TotStmEquip );
+		for ( int Loop = 1; Loop <= TotInfiltration; ++Loop ) {
+			if ( Infiltration( Loop ).ZonePtr < 1 ) continue;
+			Traits[ Infiltration( Loop ).ZonePtr - 1 ].push_back( "F" + RoundSigDigits( Infiltration( Loop ).ModelType ) + ';' + RoundSigDigits( Infiltration( Loop ).SchedPtr ) + ';' + RoundSigDigits( Infiltration( Loop ).DesignLevel, 6 ) + ';' + RoundSigDigits( Infiltration( Loop ).LeakageArea, 6 ) );
+		}
+		for ( int Loop = 1; Loop <= TotVentilation; ++Loop ) {
+			if ( DataHeatBalance::Ventilation( Loop ).ZonePtr < 1 ) continue;
+			Traits[ DataHeatBalance::Ventilation( Loop ).ZonePtr - 1 ].push_back( "V" + RoundSigDigits( DataHeatBalance::Ventilation( Loop ).ModelType ) + ';' + RoundSigDigits( DataHeatBalance::Ventilation( Loop ).SchedPtr ) + ';' + RoundSigDigits( DataHeatBalance::Ventilation( Loop ).DesignLevel, 6 ) );
+		}
+		if ( ZoneEquipInputsFilled ) {
+			for ( int Loop = 1; Loop <= int( ZoneEquipConfig.size() ); ++Loop ) {
+				auto const & config( ZoneEquipConfig( Loop ) );
+				if ( config.ActualZoneNum < 1 ) continue;
+				auto & traits( Traits[ config.ActualZoneNum - 1 ] );
+				traits.push_back( "A" + RoundSigDigits( config.AirLoopNum ) );
+				if ( config.EquipListIndex < 1 ) continue;
+				auto const & list( ZoneEquipList( config.EquipListIndex ) );
+				for ( int EquipNum = 1; EquipNum <= list.NumOfEquipTypes; ++EquipNum ) {
+					traits.push_back( "H" + list.EquipType( EquipNum ) );
+				}
+			}
+		}
+		for ( int Loop = 1; Loop <= NumTempControlledZones; ++Loop ) {
+			auto const & control( TempControlledZone( Loop ) );
+			if ( control.ActualZoneNum < 1 ) continue;
+			Traits[ control.ActualZoneNum - 1 ].push_back( "C" + RoundSigDigits( control.CTSchedIndex ) + ';' + RoundSigDigits( control.SchIndx_SingleHeatSetPoint ) + ';' + RoundSigDigits( control.SchIndx_SingleCoolSetPoint ) + ';' + RoundSigDigits( control.SchIndx_SingleHeatCoolSetPoint ) + ';' + RoundSigDigits( control.SchIndx_DualSetPointWDeadBand ) );
+		}
+
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			auto & traits( Traits[ ZoneNum - 1 ] );
+			std::sort( traits.begin() + 1, traits.end() ); // The zone line first, the rest regardless of input order
+			std::string Signature;
+			for ( auto const & trait : traits ) {
+				Signature += trait;
+				Signature += '|';
+			}
+			auto const Found( GroupOfSignature.emplace( Signature, int( Groups.size() ) ) );
+			if ( Found.second ) {
+				Groups.push_back( std::vector< int >() );
+				for ( int SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+					if ( Surface( SurfNum ).HeatTransSurf ) ++NumGroupHTSurfaces;
+				}
+			}
+			Groups[ Found.first->second ].push_back( ZoneNum );
+		}
+
+		gio::write( OutputFileInits, fmtA ) << "! <Zone Aggregation Summary>, Number of Zones, Number of Zone Groups, Number of Heat Transfer Surfaces, Number of Heat Transfer Surfaces in the First Zone of Each Group";
+		gio::write( OutputFileInits, fmtA ) << " Zone Aggregation Summary," + RoundSigDigits( NumOfZones ) + ',' + RoundSigDigits( int( Groups.size() ) ) + ',' + RoundSigDigits( NumHTSurfaces ) + ',' + RoundSigDigits( NumGroupHTSurfaces );
+		gio::write( OutputFileInits, fmtA ) << "! <Zone Aggregation>, Representative Zone Name, Number of Zones in Group, Zone Names";
+		for ( auto const & group : Groups ) {
+			if ( group.size() < 2 ) continue;
+			std::string Names;
+			for ( int const ZoneNum : group ) {
+				if ( ! Names.empty() ) Names += ';';
+				Names += Zone( ZoneNum ).Name;
+			}
+			gio::write( OutputFileInits, fmtA ) << " Zone Aggregation," + Zone( group.front() ).Name + ',' + RoundSigDigits( int( group.size() ) ) + ',' + Names;
+		}
+
+	}
+
 	void
 	PostIPProcessing()
 	{
@@ -2536,11 +2753,6 @@ namespace SimulationManager {
 		using InputProcessor::GetObjectItem;
 		using namespace DataIPShortCuts;
 		using General::RoundSigDigits;
-#if defined(_OPENMP) && defined(HBIRE_USE_OMP)
-		using omp_lib::omp_get_max_threads;
-		using omp_lib::omp_get_num_threads;
-		using omp_lib::omp_set_num_threads;
-#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2634,7 +2846,7 @@ namespace SimulationManager {
 		if ( GetNumObjectsFound( cCurrentModuleObject ) > 0 ) {
 			GetObjectItem( cCurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, ios, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 			iIDFSetThreads = int( rNumericArgs( 1 ) );
-			lIDFsetThreadsInput = true;
+			lIDFSetThreadsInput = true;
 			if ( iIDFSetThreads <= 0 ) {
 				iIDFSetThreads = MaxNumberOfThreads;
 				if ( lEnvSetThreadsInput ) iIDFSetThreads = iEnvSetThreads;
@@ -2657,6 +2869,7 @@ namespace SimulationManager {
 			if ( lepSetThreadsInput ) NumberIntRadThreads = iepEnvSetThreads;
 			if ( lIDFSetThreadsInput ) NumberIntRadThreads = iIDFSetThreads;
 		}
+		SetParallelThreads( NumberIntRadThreads );
 #else
 		Threading = false;
 		cCurrentModuleObject = "ProgramControl";
@@ -2679,6 +2892,698 @@ namespace SimulationManager {
 
 	}
 
+	void
+	GetIndependentInput()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gets the input of the object families that refer to no other family (schedules, curves
+		// and fluid properties) before sizing, one family after another in a fixed order, rather
+		// than from the first call of whichever component needs them first.
+
+		// METHODOLOGY EMPLOYED:
+		// Each family is gotten only if its once only flag shows it has not been, so the calls on
+		// first use find it gotten.  The families that refer to others (materials, constructions,
+		// surfaces and the components) are left to the routines that get them in their own order.
+
+		if ( ! ScheduleManager::ScheduleInputProcessed ) {
+			ScheduleManager::ProcessScheduleInput();
+			ScheduleManager::ScheduleInputProcessed = true;
+		}
+
+		if ( CurveManager::GetCurvesInputFlag ) {
+			CurveManager::GetCurveInput();
+			CurveManager::GetPressureSystemInput();
+			CurveManager::GetCurvesInputFlag = false;
+		}
+
+		if ( FluidProperties::GetInput ) {
+			FluidProperties::GetFluidPropertiesData();
+			FluidProperties::GetInput = false;
+		}
+
+	}
+
+	void
+	SetUpParallelEnvironments()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the ParallelEnvironments environment variable, the number of environments of the
+		// primary simulation to simulate at once, and turns on the environment segments when the
+		// outputs requested allow the environments to be simulated by forked workers.
+
+		// METHODOLOGY EMPLOYED:
+		// Each environment is begun from the state left by sizing rather than by the environment
+		// before it, which is as independent as environments are taken to be once the warmup has
+		// initialized them again.  Outputs kept in one place for the whole run (SQLite, columnar and
+		// csv files, writer threads) and cache files written as the environments go are not joined,
+		// so those runs are simulated one environment after another.
+
+		// Using/Aliasing
+		using DataDaylighting::TotIllumMaps;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string cEnvValue;
+		std::string Reason; // Why the environments cannot be simulated side by side
+
+		ParallelEnvironmentsActive = false;
+		get_environment_variable( cParallelEnvironments, cEnvValue );
+		if ( cEnvValue.empty() ) return;
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> MaxParallelEnvironments; if ( flags.err() ) MaxParallelEnvironments = 1; }
+		if ( MaxParallelEnvironments <= 1 ) return;
+
+#ifdef _WIN32
+		Reason = "forked workers are not available on Windows";
+#else
+		if ( WeatherEnsembleActive ) {
+			Reason = "the primary simulation is run for a weather ensemble";
+		} else if ( sqlite ) {
+			Reason = "Output:SQLite is requested";
+		} else if ( UseOutputWriterThread ) {
+			Reason = "the eso and mtr files are written from writer threads";
+		} else if ( ColumnarOutput::WriteColumnarOutput || CsvOutputDuringRun ) {
+			Reason = "the columnar or csv output files are written during the run";
+		} else if ( NumExternalInterfaces > 0 ) {
+			Reason = "the simulation exchanges data through an ExternalInterface";
+		} else if ( TotIllumMaps > 0 ) {
+			Reason = "daylighting illuminance maps are requested";
+		} else if ( ! ShadowCacheFileName.empty() || ! DaylightingCacheFileName.empty() || ! WarmupStateFileName.empty() ) {
+			Reason = "the sunlit fraction, daylighting or warmup state cache files are written during the environments";
+		}
+#endif
+		if ( ! Reason.empty() ) {
+			ShowWarningError( "SetUpParallelEnvironments: " + cParallelEnvironments + " is set, but the environments are simulated one after another because " + Reason + '.' );
+			return;
+		}
+
+		ParallelEnvironmentsActive = true;
+		SegmentEnvironments.clear();
+		FailedEnvironments.clear();
+
+	}
+
+	std::string
+	EnvironmentSegmentFileName(
+		std::string const & FileName, // Output file the segment is joined to
+		int const EnvNum // Environment count of the segment
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the file holding what an environment wrote to an output file.
+
+		using General::RoundSigDigits;
+
+		return FileName + ".env" + RoundSigDigits( EnvNum );
+
+	}
+
+	std::vector< std::string >
+	SegmentedOutputFileNames()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the output files written as the environments are simulated, which each
+		// environment writes to its own segment.
+
+		using namespace DataStringGlobals;
+
+		return std::vector< std::string >( { outputEsoFileName, outputMtrFileName, outputEioFileName, outputErrFileName, outputAuditFileName, outputDbgFileName, outputDfsFileName, outputEddFileName } );
+
+	}
+
+	std::vector< int * >
+	EnvironmentWorkerCounters()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the run counters a worker hands back to the process that forked it.
+
+		using DataErrorTracking::TotalWarningErrors;
+		using DataErrorTracking::TotalSevereErrors;
+		using DataErrorTracking::TotalWarningErrorsDuringWarmup;
+		using DataErrorTracking::TotalSevereErrorsDuringWarmup;
+
+		return std::vector< int * >( { &StdOutputRecordCount, &StdMeterRecordCount, &TotalWarningErrors, &TotalSevereErrors, &TotalWarningErrorsDuringWarmup, &TotalSevereErrorsDuringWarmup } );
+
+	}
+
+	void
+	RefreshOutputStreams()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Points the streams kept for the eso, mtr and audit files at their units once reopened.
+
+		eso_stream = gio::out_stream( OutputFileStandard );
+		mtr_stream = gio::out_stream( OutputFileMeters );
+		InputProcessor::echo_stream = gio::out_stream( InputProcessor::EchoInputFile );
+
+	}
+
+	void
+	BeginEnvironmentSegment( int const EnvNum ) // Environment count of the segment
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sends what is written to the segmented output files from here on to the segment files
+		// of the environment.
+
+		for ( auto const & FileName : SegmentedOutputFileNames() ) {
+			int Unit;
+			{ IOFlags flags; gio::inquire( FileName, flags ); if ( ! flags.open() ) continue; Unit = flags.unit(); }
+			gio::close( Unit );
+			{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( Unit, EnvironmentSegmentFileName( FileName, EnvNum ), flags ); }
+			DivertedOutputFiles.emplace_back( Unit, FileName );
+		}
+		RefreshOutputStreams();
+		EnvironmentSegment = EnvNum;
+		SegmentStartCounts.clear();
+		for ( int const * Counter : EnvironmentWorkerCounters() ) SegmentStartCounts.push_back( *Counter );
+
+	}
+
+	void
+	EndEnvironmentSegment()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Closes the segment files of the environment just simulated.  A worker then writes what it
+		// added to the run counters next to its segments and ends; otherwise the output files are
+		// taken up again where they were left.
+
+		using DataStringGlobals::outputEndFileName;
+
+		for ( auto const & Diverted : DivertedOutputFiles ) {
+			gio::close( Diverted.first );
+			if ( ! EnvironmentWorker ) {
+				IOFlags flags; flags.ACTION( "write" ); flags.POSITION( "APPEND" ); gio::open( Diverted.first, Diverted.second, flags );
+			}
+		}
+		DivertedOutputFiles.clear();
+
+		if ( EnvironmentWorker ) {
+			{
+				std::ofstream Counts( EnvironmentSegmentFileName( outputEndFileName, EnvironmentSegment ), std::ios_base::out | std::ios_base::trunc );
+				auto const Counters( EnvironmentWorkerCounters() );
+				for ( std::vector< int * >::size_type Counter = 0; Counter < Counters.size(); ++Counter ) {
+					Counts << *Counters[ Counter ] - SegmentStartCounts[ Counter ] << '\n';
+				}
+			}
+			std::cout.flush();
+			std::_Exit( EXIT_SUCCESS ); // The state of this process is the parent's; it must not be written out again
+		}
+		RefreshOutputStreams();
+		EnvironmentSegment = 0;
+
+	}
+
+	void
+	WaitForEnvironmentWorker()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits for one of the workers still running to end, and notes it if it failed.
+
+#ifndef _WIN32
+		int Status( 0 );
+		pid_t const Child( waitpid( -1, &Status, 0 ) );
+		auto const Worker( EnvironmentWorkers.find( Child ) );
+		if ( Worker == EnvironmentWorkers.end() ) { // No child left to wait for
+			for ( auto const & Lost : EnvironmentWorkers ) FailedEnvironments.push_back( Lost.second );
+			EnvironmentWorkers.clear();
+			return;
+		}
+		if ( ! WIFEXITED( Status ) || WEXITSTATUS( Status ) != EXIT_SUCCESS ) FailedEnvironments.push_back( Worker->second );
+		EnvironmentWorkers.erase( Worker );
+#endif
+
+	}
+
+	bool
+	ForkEnvironmentWorker( int const EnvNum ) // Environment count of the environment about to be simulated
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Hands the environment about to be simulated to a forked worker, and returns true in this
+		// process if it did, so that the environment loop goes on with the next environment.  The
+		// worker, and this process for an environment it keeps, write the environment to its
+		// segments and return false.
+
+		// METHODOLOGY EMPLOYED:
+		// Weather file run periods are kept here while the tabular reports are written, since the
+		// tabular reports gather over them.  All the output units are flushed before the fork so
+		// that nothing written before is written again by the worker.  The worker runs its
+		// threaded loops on one thread, as OpenMP teams do not survive a fork.
+
+		using DataEnvironment::EnvironmentName;
+		using OutputReportTabular::WriteTabularFiles;
+
+		SegmentEnvironments.push_back( EnvNum );
+
+#ifndef _WIN32
+		if ( KindOfSim != ksRunPeriodWeather || ! WriteTabularFiles ) {
+			while ( int( EnvironmentWorkers.size() ) >= MaxParallelEnvironments ) WaitForEnvironmentWorker();
+			for ( int Unit = 1; Unit <= 1000; ++Unit ) {
+				IOFlags flags; gio::inquire( Unit, flags ); if ( flags.open() ) gio::flush( Unit );
+			}
+			std::cout.flush();
+			std::cerr.flush();
+			pid_t const Child( fork() );
+			if ( Child == 0 ) {
+				EnvironmentWorker = true;
+				EnvironmentWorkers.clear();
+				SetParallelThreads( 1 );
+				RuntimeMetrics::Metrics.Active = false; // The metrics file is kept by the parent only
+				BeginEnvironmentSegment( EnvNum );
+				return false;
+			} else if ( Child > 0 ) {
+				EnvironmentWorkers[ Child ] = EnvNum;
+				return true;
+			}
+			ShowWarningError( "ForkEnvironmentWorker: Could not start a worker for environment " + EnvironmentName + "; it is simulated here." );
+		}
+#endif
+		BeginEnvironmentSegment( EnvNum );
+		return false;
+
+	}
+
+	void
+	JoinReportSegments(
+		std::vector< std::istream * > const & Segments, // Segments of the environments, in environment order
+		std::ostream & Joined // Report file the segments are joined to
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Joins the eso or mtr file segments of the environments to the report file: the data
+		// dictionary items the segments added first, without repeats, with one end of data dictionary
+		// marker, then the data of each segment in turn.
+
+		// METHODOLOGY EMPLOYED:
+		// A segment written before the marker was written holds its new dictionary items before its
+		// marker; a segment with no marker holds only data.  The end of data lines of a worker that
+		// failed are dropped.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const EndOfHeader( "End of Data Dictionary" );
+		static std::string const EndOfData( "End of Data" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< std::string > DictionaryItems;
+		std::unordered_set< std::string > KnownItems;
+		std::vector< std::istream::pos_type > DataStarts; // Start of the data of each segment
+		bool AnyHeaderEnd( false );
+		std::string Line;
+
+		for ( auto Segment : Segments ) {
+			std::vector< std::string > Items;
+			bool HeaderEnd( false );
+			while ( std::getline( *Segment, Line ) ) {
+				if ( Line == EndOfHeader ) {
+					HeaderEnd = true;
+					break;
+				}
+				Items.push_back( Line );
+			}
+			if ( HeaderEnd ) {
+				AnyHeaderEnd = true;
+				for ( auto & Item : Items ) {
+					if ( KnownItems.insert( Item ).second ) DictionaryItems.push_back( std::move( Item ) );
+				}
+				DataStarts.push_back( Segment->tellg() );
+			} else {
+				DataStarts.push_back( 0 );
+			}
+		}
+
+		for ( auto const & Item : DictionaryItems ) Joined << Item << '\n';
+		if ( AnyHeaderEnd ) Joined << EndOfHeader << '\n';
+		for ( std::vector< std::istream * >::size_type Segment = 0; Segment < Segments.size(); ++Segment ) {
+			auto & In( *Segments[ Segment ] );
+			In.clear();
+			In.seekg( DataStarts[ Segment ] );
+			while ( std::getline( In, Line ) ) {
+				if ( Line == EndOfData ) break;
+				Joined << Line << '\n';
+			}
+		}
+
+	}
+
+	void
+	JoinEnvironmentSegments()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits for the environment workers, joins the segments of all the environments to the
+		// output files in environment order, and adds what the workers counted to the run counters.
+
+		using DataStringGlobals::outputEsoFileName;
+		using DataStringGlobals::outputMtrFileName;
+		using DataStringGlobals::outputEndFileName;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Unit;
+
+		while ( ! EnvironmentWorkers.empty() ) WaitForEnvironmentWorker();
+
+		for ( auto const & FileName : SegmentedOutputFileNames() ) {
+			Unit = 0;
+			{ IOFlags flags; gio::inquire( FileName, flags ); if ( flags.open() ) Unit = flags.unit(); }
+			if ( Unit > 0 ) gio::close( Unit );
+			std::vector< std::unique_ptr< std::ifstream > > Segments;
+			for ( int const EnvNum : SegmentEnvironments ) {
+				std::unique_ptr< std::ifstream > Segment( new std::ifstream( EnvironmentSegmentFileName( FileName, EnvNum ), std::ios_base::in | std::ios_base::binary ) );
+				if ( Segment->is_open() ) Segments.push_back( std::move( Segment ) );
+			}
+			if ( ! Segments.empty() ) {
+				std::ofstream Joined( FileName, std::ios_base::out | std::ios_base::binary | std::ios_base::app );
+				if ( FileName == outputEsoFileName || FileName == outputMtrFileName ) {
+					std::vector< std::istream * > Streams;
+					for ( auto const & Segment : Segments ) Streams.push_back( Segment.get() );
+					JoinReportSegments( Streams, Joined );
+				} else {
+					for ( auto const & Segment : Segments ) {
+						if ( Segment->peek() != std::ifstream::traits_type::eof() ) Joined << Segment->rdbuf();
+					}
+				}
+			}
+			Segments.clear();
+			for ( int const EnvNum : SegmentEnvironments ) std::remove( EnvironmentSegmentFileName( FileName, EnvNum ).c_str() );
+			if ( Unit > 0 ) {
+				IOFlags flags; flags.ACTION( "write" ); flags.POSITION( "APPEND" ); gio::open( Unit, FileName, flags );
+			}
+		}
+		RefreshOutputStreams();
+
+		auto const Counters( EnvironmentWorkerCounters() );
+		for ( int const EnvNum : SegmentEnvironments ) {
+			std::string const CountsFileName( EnvironmentSegmentFileName( outputEndFileName, EnvNum ) );
+			{
+				std::ifstream Counts( CountsFileName );
+				int Count;
+				for ( auto Counter : Counters ) {
+					if ( ! ( Counts >> Count ) ) break;
+					*Counter += Count;
+				}
+			}
+			std::remove( CountsFileName.c_str() );
+		}
+		SegmentEnvironments.clear();
+
+		if ( ! FailedEnvironments.empty() ) {
+			std::sort( FailedEnvironments.begin(), FailedEnvironments.end() );
+			for ( int const EnvNum : FailedEnvironments ) {
+				ShowSevereError( "JoinEnvironmentSegments: The worker simulating environment " + RoundSigDigits( EnvNum ) + " of the primary simulation did not complete; see its messages above." );
+			}
+			ShowFatalError( "Environment workers did not complete; program terminates." );
+		}
+
+	}
+
+	void
+	SetUpWeatherEnsemble()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the EnsembleWeatherFiles environment variable, the name of a file listing one weather
+		// file per line, and the EnsembleProcesses environment variable, the number of weather files
+		// simulated at once.  The ensemble is turned on when the outputs requested allow each weather
+		// file to be simulated by a forked member.
+
+		// METHODOLOGY EMPLOYED:
+		// Blank lines and lines beginning with ! are skipped.  The ensemble is not run for the
+		// outputs that keep the environments from being simulated by forked workers, as a member is
+		// forked in the same way once sizing is done.
+
+		// Using/Aliasing
+		using DataDaylighting::TotIllumMaps;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string cEnvValue;
+		std::string Reason; // Why the ensemble cannot be run
+
+		WeatherEnsembleActive = false;
+		EnsembleWeatherFileNames.clear();
+		FailedEnsembleMembers.clear();
+		get_environment_variable( cEnsembleWeatherFiles, cEnvValue );
+		if ( cEnvValue.empty() ) return;
+
+		{
+			std::ifstream ListFile( cEnvValue );
+			if ( ! ListFile ) {
+				ShowWarningError( "SetUpWeatherEnsemble: Could not open the " + cEnsembleWeatherFiles + " file \"" + cEnvValue + "\"; only the input weather file is simulated." );
+				return;
+			}
+			std::string Line;
+			while ( std::getline( ListFile, Line ) ) {
+				Line = stripped( Line, " \t\r" );
+				if ( Line.empty() || Line[ 0 ] == '!' ) continue;
+				EnsembleWeatherFileNames.push_back( Line );
+			}
+		}
+		if ( EnsembleWeatherFileNames.empty() ) return;
+
+		MaxEnsembleProcesses = 1;
+		get_environment_variable( cEnsembleProcesses, cEnvValue );
+		if ( ! cEnvValue.empty() ) {
+			IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> MaxEnsembleProcesses; if ( flags.err() || MaxEnsembleProcesses < 1 ) MaxEnsembleProcesses = 1;
+		}
+
+#ifdef _WIN32
+		Reason = "forked members are not available on Windows";
+#else
+		if ( ! DoWeathSim || ! WeatherFileExists ) {
+			Reason = "no weather file run period is simulated with the input weather file";
+		} else if ( sqlite ) {
+			Reason = "Output:SQLite is requested";
+		} else if ( UseOutputWriterThread ) {
+			Reason = "the eso and mtr files are written from writer threads";
+		} else if ( ColumnarOutput::WriteColumnarOutput || CsvOutputDuringRun ) {
+			Reason = "the columnar or csv output files are written during the run";
+		} else if ( NumExternalInterfaces > 0 ) {
+			Reason = "the simulation exchanges data through an ExternalInterface";
+		} else if ( TotIllumMaps > 0 ) {
+			Reason = "daylighting illuminance maps are requested";
+		} else if ( ! ShadowCacheFileName.empty() || ! DaylightingCacheFileName.empty() || ! WarmupStateFileName.empty() ) {
+			Reason = "the sunlit fraction, daylighting or warmup state cache files are written during the environments";
+		}
+#endif
+		if ( ! Reason.empty() ) {
+			ShowWarningError( "SetUpWeatherEnsemble: " + cEnsembleWeatherFiles + " is set, but only the input weather file is simulated because " + Reason + '.' );
+			EnsembleWeatherFileNames.clear();
+			return;
+		}
+
+		WeatherEnsembleActive = true;
+
+	}
+
+	std::string
+	EnsembleMemberDirectory( int const Member ) // Member number
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the directory the output files of a member of the ensemble are written to, next to
+		// the output files of the input weather file.
+
+		using General::RoundSigDigits;
+
+		std::string OutputDirectory( FileSystem::getParentDirectoryPath( DataStringGlobals::outputEndFileName ) );
+		if ( OutputDirectory == "." ) OutputDirectory.clear();
+		return OutputDirectory + "ensemble" + RoundSigDigits( Member ) + DataStringGlobals::pathChar;
+
+	}
+
+	std::vector< std::string * >
+	EnsembleOutputFileNames()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the names of the output files a member of the ensemble writes to its own directory.
+
+		using namespace DataStringGlobals;
+
+		return std::vector< std::string * >( { &outputAuditFileName, &outputBndFileName, &outputDxfFileName, &outputEioFileName, &outputEndFileName, &outputErrFileName, &outputEsoFileName, &outputMtdFileName, &outputMddFileName, &outputMtrFileName, &outputRddFileName, &outputShdFileName, &outputTblCsvFileName, &outputTblHtmFileName, &outputTblTabFileName, &outputTblTxtFileName, &outputTblXmlFileName, &outputAdsFileName, &outputDfsFileName, &outputMapTabFileName, &outputMapCsvFileName, &outputMapTxtFileName, &outputEddFileName, &outputDbgFileName, &outputSlnFileName, &outputSciFileName, &outputWrlFileName, &outputZszCsvFileName, &outputZszTabFileName, &outputZszTxtFileName, &outputSszCsvFileName, &outputSszTabFileName, &outputSszTxtFileName, &outputScreenCsvFileName, &outputEmsCsvFileName, &outputProfFileName, &outputSqlFileName, &outputColFileName, &outputSqliteErrFileName, &outputCsvFileName, &outputMtrCsvFileName, &outputRvauditFileName } );
+
+	}
+
+	void
+	BeginEnsembleMember(
+		int const Member, // Member number
+		std::vector< std::streamoff > const & OpenFileSizes // Size at the fork of each output file open then, -1 for the others
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Begins a forked member of the ensemble: the output files are moved to the directory of
+		// the member, keeping what was written to those open at the fork, and the environments
+		// still to be simulated are pointed at the weather file of the member.
+
+		// METHODOLOGY EMPLOYED:
+		// Only the bytes written up to the fork are copied, as the process that forked the member
+		// goes on writing to the same files.  The output files already closed (sizing, surface
+		// and dictionary reports) are left with the input weather file, since they do not depend
+		// on the weather files of the ensemble.
+
+		using General::RoundSigDigits;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string const Directory( EnsembleMemberDirectory( Member ) );
+		std::string const WeatherFileName( EnsembleWeatherFileNames[ Member - 1 ] );
+		std::vector< char > Buffer( 65536 );
+
+		EnsembleMember = Member;
+		FileSystem::makeDirectory( Directory );
+
+		auto const FileNames( EnsembleOutputFileNames() );
+		for ( std::vector< std::string * >::size_type File = 0; File < FileNames.size(); ++File ) {
+			std::string & FileName( *FileNames[ File ] );
+			std::string const MemberFileName( Directory + FileSystem::getFileName( FileName ) );
+			if ( OpenFileSizes[ File ] >= 0 ) {
+				int Unit;
+				{ IOFlags flags; gio::inquire( FileName, flags ); Unit = flags.unit(); }
+				gio::close( Unit );
+				{
+					std::ifstream Source( FileName, std::ios_base::in | std::ios_base::binary );
+					std::ofstream Copy( MemberFileName, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary );
+					std::streamoff Left( OpenFileSizes[ File ] );
+					while ( Left > 0 ) {
+						Source.read( Buffer.data(), std::min( Left, std::streamoff( Buffer.size() ) ) );
+						if ( Source.gcount() <= 0 ) break;
+						Copy.write( Buffer.data(), Source.gcount() );
+						Left -= Source.gcount();
+					}
+				}
+				{ IOFlags flags; flags.ACTION( "write" ); flags.POSITION( "APPEND" ); gio::open( Unit, MemberFileName, flags ); }
+			}
+			FileName = MemberFileName;
+		}
+		RefreshOutputStreams();
+
+		ShowMessage( "Weather ensemble member " + RoundSigDigits( Member ) + " simulates weather file \"" + WeatherFileName + "\"." );
+		DisplayString( "Weather Ensemble Member " + RoundSigDigits( Member ) + ": " + WeatherFileName );
+		if ( ! SwitchWeatherFile( WeatherFileName ) ) {
+			ShowFatalError( "BeginEnsembleMember: Weather file \"" + WeatherFileName + "\" cannot be simulated with the input; program terminates." );
+		}
+		DataStringGlobals::inStatFileName = FileSystem::removeFileExtension( WeatherFileName ) + ".stat";
+
+	}
+
+	void
+	WaitForEnsembleMember()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits for one of the members of the ensemble still running to end, and notes it if it failed.
+
+#ifndef _WIN32
+		int Status( 0 );
+		pid_t const Child( waitpid( -1, &Status, 0 ) );
+		auto const Member( EnsembleMembers.find( Child ) );
+		if ( Member == EnsembleMembers.end() ) { // No child left to wait for
+			for ( auto const & Lost : EnsembleMembers ) FailedEnsembleMembers.push_back( Lost.second );
+			EnsembleMembers.clear();
+			return;
+		}
+		if ( ! WIFEXITED( Status ) || WEXITSTATUS( Status ) != EXIT_SUCCESS ) FailedEnsembleMembers.push_back( Member->second );
+		EnsembleMembers.erase( Member );
+#endif
+
+	}
+
+	void
+	RunWeatherEnsemble()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forks a member for each weather file of the ensemble once the input is processed and
+		// sizing is done, so that the weather independent setup is done once for all of them.
+		// Each member simulates the primary simulation with its weather file and writes its own
+		// output files; this process returns to go on with the input weather file.
+
+		// METHODOLOGY EMPLOYED:
+		// All the output units are flushed before each fork, and the sizes of the open output
+		// files noted for the member.  No more than EnsembleProcesses weather files are simulated
+		// at once, counting the input weather file simulated here last.  A member runs its
+		// threaded loops on one thread, as OpenMP teams do not survive a fork.
+
+		using General::RoundSigDigits;
+
+		SetUpWeatherEnsemble();
+		if ( ! WeatherEnsembleActive ) return;
+
+		int const NumMembers( EnsembleWeatherFileNames.size() );
+		gio::write( OutputFileInits, fmtA ) << "! <Weather Ensemble Member>, Member Number, Weather File, Output Directory";
+		for ( int Member = 1; Member <= NumMembers; ++Member ) {
+			gio::write( OutputFileInits, fmtA ) << " Weather Ensemble Member," + RoundSigDigits( Member ) + ',' + EnsembleWeatherFileNames[ Member - 1 ] + ',' + EnsembleMemberDirectory( Member );
+		}
+
+#ifndef _WIN32
+		auto const FileNames( EnsembleOutputFileNames() );
+		for ( int Member = 1; Member <= NumMembers; ++Member ) {
+			while ( int( EnsembleMembers.size() ) >= max( MaxEnsembleProcesses - 1, 1 ) ) WaitForEnsembleMember();
+			for ( int Unit = 1; Unit <= 1000; ++Unit ) {
+				IOFlags flags; gio::inquire( Unit, flags ); if ( flags.open() ) gio::flush( Unit );
+			}
+			std::cout.flush();
+			std::cerr.flush();
+			std::vector< std::streamoff > OpenFileSizes;
+			for ( std::string const * FileName : FileNames ) {
+				bool FileOpen;
+				{ IOFlags flags; gio::inquire( *FileName, flags ); FileOpen = flags.open(); }
+				std::ifstream File( *FileName, std::ios_base::in | std::ios_base::binary | std::ios_base::ate );
+				OpenFileSizes.push_back( FileOpen && File ? std::streamoff( File.tellg() ) : std::streamoff( -1 ) );
+			}
+			pid_t const Child( fork() );
+			if ( Child == 0 ) {
+				EnsembleMembers.clear();
+				FailedEnsembleMembers.clear();
+				SetParallelThreads( 1 );
+				RuntimeMetrics::Metrics.Active = false; // The metrics file is kept by the parent only
+				BeginEnsembleMember( Member, OpenFileSizes );
+				return;
+			} else if ( Child > 0 ) {
+				EnsembleMembers[ Child ] = Member;
+			} else {
+				ShowWarningError( "RunWeatherEnsemble: Could not start the member for weather file \"" + EnsembleWeatherFileNames[ Member - 1 ] + "\"." );
+				FailedEnsembleMembers.push_back( Member );
+			}
+		}
+#endif
+
+	}
+
+	void
+	FinishWeatherEnsemble()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits for the members of the ensemble to end, in the process that forked them, and
+		// reports those that did not complete.
+
+		using General::RoundSigDigits;
+
+		if ( ! WeatherEnsembleActive || EnsembleMember > 0 ) return;
+
+#ifndef _WIN32
+		while ( ! EnsembleMembers.empty() ) WaitForEnsembleMember();
+#endif
+
+		int const NumMembers( EnsembleWeatherFileNames.size() );
+		std::sort( FailedEnsembleMembers.begin(), FailedEnsembleMembers.end() );
+		for ( int const Member : FailedEnsembleMembers ) {
+			ShowSevereError( "FinishWeatherEnsemble: The member simulating weather file \"" + EnsembleWeatherFileNames[ Member - 1 ] + "\" did not complete." );
+			ShowContinueError( "...see the error file in " + EnsembleMemberDirectory( Member ) );
+		}
+		ShowMessage( "Weather ensemble: " + RoundSigDigits( NumMembers - int( FailedEnsembleMembers.size() ) ) + " of " + RoundSigDigits( NumMembers ) + " members completed." );
+
+	}
+
 } // SimulationManager
 
 // EXTERNAL SUBROUTINES:
@@ -2748,6 +3653,9 @@ Resimulate(
 	using DemandManager::DemandManagerExtIterations;
 	using DemandManager::DemandManagerHBIterations;
 	using DemandManager::DemandManagerHVACIterations;
+	using DemandManager::LimitChangedZone;
+	using DataGlobals::NumOfZones;
+	using DataSystemVariables::DemandManagerZoneResimulation;
 	using ExteriorEnergyUse::ManageExteriorEnergyUse;
 	using HeatBalanceSurfaceManager::InitSurfaceHeatBalance;
 	using HeatBalanceAirManager::InitAirHeatBalance;
@@ -2771,6 +3679,7 @@ Resimulate(
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 	Real64 ZoneTempChange( 0.0 ); // Dummy variable needed for calling ManageZoneAirUpdates
+	int ZoneNum; // Zone number
 
 	// FLOW:
 	if ( ResimExt ) {
@@ -2782,8 +3691,18 @@ Resimulate(
 	if ( ResimHB ) {
 		// Surface simulation
 		InitSurfaceHeatBalance();
-		CalcHeatBalanceOutsideSurf();
-		CalcHeatBalanceInsideSurf();
+		if ( DemandManagerZoneResimulation && allocated( LimitChangedZone ) ) {
+			// Only the zones whose lights or electric equipment limits changed, as the radiant systems resimulate their zones
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				if ( ! LimitChangedZone( ZoneNum ) ) continue;
+				CalcHeatBalanceOutsideSurf( ZoneNum );
+				CalcHeatBalanceInsideSurf( ZoneNum );
+			}
+			LimitChangedZone = false;
+		} else {
+			CalcHeatBalanceOutsideSurf();
+			CalcHeatBalanceInsideSurf();
+		}
 
 		// Air simulation
 		InitAirHeatBalance();
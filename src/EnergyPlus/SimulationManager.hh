@@ -1,6 +1,11 @@
 #ifndef SimulationManager_hh_INCLUDED
 #define SimulationManager_hh_INCLUDED
 
+// C++ Headers
+#include <iosfwd>
+#include <string>
+#include <vector>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
@@ -31,6 +36,10 @@ namespace SimulationManager {
 	// MODULE VARIABLE DECLARATIONS:
 	extern bool RunPeriodsInInput;
 	extern bool RunControlInInput;
+	extern bool ParallelEnvironmentsActive; // Each environment of the primary simulation is written to segments joined in order at the end
+	extern bool EnvironmentWorker; // This process is a forked worker simulating one environment
+	extern bool WeatherEnsembleActive; // The primary simulation is also run with each weather file of an ensemble, by forked members
+	extern int EnsembleMember; // Member of the ensemble simulated by this process, 0 for the input weather file
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -69,6 +78,9 @@ namespace SimulationManager {
 	void
 	ReportCompSetMeterVariables();
 
+	void
+	ReportZoneAggregation();
+
 	void
 	PostIPProcessing();
 
@@ -78,6 +90,72 @@ namespace SimulationManager {
 	void
 	CheckThreading();
 
+	void
+	GetIndependentInput();
+
+	void
+	SetUpParallelEnvironments();
+
+	std::string
+	EnvironmentSegmentFileName(
+		std::string const & FileName, // Output file the segment is joined to
+		int const EnvNum // Environment count of the segment
+	);
+
+	std::vector< std::string >
+	SegmentedOutputFileNames();
+
+	std::vector< int * >
+	EnvironmentWorkerCounters();
+
+	void
+	RefreshOutputStreams();
+
+	void
+	BeginEnvironmentSegment( int const EnvNum ); // Environment count of the segment
+
+	void
+	EndEnvironmentSegment();
+
+	void
+	WaitForEnvironmentWorker();
+
+	bool
+	ForkEnvironmentWorker( int const EnvNum ); // Environment count of the environment about to be simulated
+
+	void
+	JoinReportSegments(
+		std::vector< std::istream * > const & Segments, // Segments of the environments, in environment order
+		std::ostream & Joined // Report file the segments are joined to
+	);
+
+	void
+	JoinEnvironmentSegments();
+
+	void
+	SetUpWeatherEnsemble();
+
+	std::string
+	EnsembleMemberDirectory( int const Member ); // Member number
+
+	std::vector< std::string * >
+	EnsembleOutputFileNames();
+
+	void
+	BeginEnsembleMember(
+		int const Member, // Member number
+		std::vector< std::streamoff > const & OpenFileSizes // Size at the fork of each output file open then, -1 for the others
+	);
+
+	void
+	WaitForEnsembleMember();
+
+	void
+	RunWeatherEnsemble();
+
+	void
+	FinishWeatherEnsemble();
+
 } // SimulationManager
 
 // EXTERNAL SUBROUTINES:
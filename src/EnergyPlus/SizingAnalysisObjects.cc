@@ -66,7 +66,7 @@ namespace EnergyPlus {
 		//We only expect this feature to be used with systems, so there will always be a system timestep update, at least one.
 		hasSystemSubSteps =  true;
 		numSubSteps = 1;
-		subSteps.resize( numSubSteps );
+		subStepValues.resize( numSubSteps );
 
 	}
 
@@ -75,7 +75,7 @@ namespace EnergyPlus {
 	{}
 
 	int SizingLog::GetZtStepIndex (
-		const ZoneTimestepObject tmpztStepStamp )
+		ZoneTimestepObject const & tmpztStepStamp )
 	{
 
 		int vecIndex;
@@ -99,7 +99,7 @@ namespace EnergyPlus {
 	}
 
 	void SizingLog::FillZoneStep(
-		ZoneTimestepObject tmpztStepStamp )
+		ZoneTimestepObject const & tmpztStepStamp )
 	{
 		int index =  GetZtStepIndex( tmpztStepStamp );
 
@@ -117,7 +117,7 @@ namespace EnergyPlus {
 	}
 
 	int SizingLog::GetSysStepZtStepIndex(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	)
 	{
 	// this method finds a zone timestep for the system timestep update to use
@@ -150,13 +150,14 @@ namespace EnergyPlus {
 	}
 
 	void SizingLog::FillSysStep(
-		ZoneTimestepObject tmpztStepStamp ,
-		SystemTimestepObject tmpSysStepStamp
+		ZoneTimestepObject const & tmpztStepStamp ,
+		SystemTimestepObject const & tmpSysStepStamp
 	)
 	{
 		using DataLoopNode::Node;
 		int lastZnStepIndex( 0 );
 		int ztIndex( 0 );
+		int stStepsIntoZoneStep;
 		int oldNumSubSteps;
 		int newNumSubSteps;
 		Real64 const MinutesPerHour( 60.0 );
@@ -170,12 +171,12 @@ namespace EnergyPlus {
 			oldNumSubSteps = ztStepObj[ ztIndex ].numSubSteps;
 			newNumSubSteps = round ( tmpztStepStamp.timeStepDuration / tmpSysStepStamp.TimeStepDuration );
 			if ( newNumSubSteps != oldNumSubSteps ) {
-				ztStepObj[ ztIndex ].subSteps.resize( newNumSubSteps );
+				ztStepObj[ ztIndex ].subStepValues.resize( newNumSubSteps );
 				ztStepObj[ ztIndex ].numSubSteps = newNumSubSteps;
 			}
 		} else {
 			newNumSubSteps = round ( tmpztStepStamp.timeStepDuration / tmpSysStepStamp.TimeStepDuration );
-			ztStepObj[ ztIndex ].subSteps.resize( newNumSubSteps );
+			ztStepObj[ ztIndex ].subStepValues.resize( newNumSubSteps );
 			ztStepObj[ ztIndex ].numSubSteps = newNumSubSteps;
 			ztStepObj[ ztIndex ].hasSystemSubSteps = true;
 		}
@@ -194,12 +195,11 @@ namespace EnergyPlus {
 		ZoneStepStartMinutes = ztStepObj[lastZnStepIndex].stepEndMinute;
 		if (ZoneStepStartMinutes < 0.0 ) ZoneStepStartMinutes = 0.0;
 
-		tmpSysStepStamp.stStepsIntoZoneStep = round(
+		stStepsIntoZoneStep = round(
 			(( ( tmpSysStepStamp.CurMinuteStart - ZoneStepStartMinutes ) / MinutesPerHour)
 			/ tmpSysStepStamp.TimeStepDuration) );
 
-		ztStepObj[ ztIndex ].subSteps[ tmpSysStepStamp.stStepsIntoZoneStep ] = tmpSysStepStamp;
-		ztStepObj[ ztIndex ].subSteps[ tmpSysStepStamp.stStepsIntoZoneStep ].LogDataValue = p_rVariable;
+		ztStepObj[ ztIndex ].subStepValues[ stStepsIntoZoneStep ] = p_rVariable;
 
 	}
 
@@ -210,8 +210,8 @@ namespace EnergyPlus {
 		for ( auto &Zt : ztStepObj ) {
 			if ( Zt.numSubSteps > 0) {
 				RunningSum = 0.0;
-				for ( auto &SysT : Zt.subSteps ) {
-					RunningSum += SysT.LogDataValue;
+				for ( auto const SysValue : Zt.subStepValues ) {
+					RunningSum += SysValue;
 				}
 				Zt.logDataValue = RunningSum / double( Zt.numSubSteps );
 			}
@@ -267,7 +267,7 @@ namespace EnergyPlus {
 	}
 
 	Real64 SizingLog::GetLogVariableDataAtTimestamp(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	)
 	{
 		int const index =  GetZtStepIndex( tmpztStepStamp );
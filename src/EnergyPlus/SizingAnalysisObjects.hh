@@ -18,8 +18,6 @@ public:
 	Real64 CurMinuteStart = 0.0; //minutes at beginning of system timestep
 	Real64 CurMinuteEnd = 0.0; //minutes at end of system timestep
 	Real64 TimeStepDuration = 0.0; //in fractional hours, length of timestep
-	Real64 LogDataValue = 0.0; // raw hard value, obtained from pointer
-	int stStepsIntoZoneStep = 0;
 };
 
 
@@ -39,7 +37,7 @@ public:
 	Real64 runningAvgDataValue = 0.0;
 	bool hasSystemSubSteps = false;
 	int numSubSteps = 0;
-	std::vector< SystemTimestepObject > subSteps; //nested object array for system timesteps inside here.
+	std::vector< Real64 > subStepValues; //raw value logged at each system timestep inside here, only the values are kept
 
 	ZoneTimestepObject (
 		int kindSim,
@@ -72,12 +70,12 @@ public:
 	std::vector< ZoneTimestepObject > ztStepObj; //will be sized to the sum of all steps, eg. timesteps in hour * 24 hours * 2 design days.
 
 	void FillZoneStep(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 
 	void FillSysStep(
-		ZoneTimestepObject tmpztStepStamp ,
-		SystemTimestepObject tmpSysStepStamp
+		ZoneTimestepObject const & tmpztStepStamp ,
+		SystemTimestepObject const & tmpSysStepStamp
 	);
 
 	void AverageSysTimeSteps();
@@ -87,7 +85,7 @@ public:
 	ZoneTimestepObject GetLogVariableDataMax();
 
 	Real64 GetLogVariableDataAtTimestamp(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 
 	void ReInitLogForIteration();
@@ -100,10 +98,10 @@ public:
 private:
 
 	int GetSysStepZtStepIndex(
-		const ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 	int GetZtStepIndex(
-		const ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 
 };
@@ -110,8 +110,10 @@ namespace SizingManager {
 		using ZoneEquipmentManager::UpdateZoneSizing;
 		using ZoneEquipmentManager::ManageZoneEquipment;
 		using ZoneEquipmentManager::RezeroZoneSizingArrays;
+		using ZoneEquipmentManager::DeallocateZoneSizingSequences;
 		using SimAirServingZones::ManageAirLoops;
 		using SimAirServingZones::UpdateSysSizing;
+		using SimAirServingZones::DeallocateSysSizingSequences;
 		using DataEnvironment::TotDesDays;
 		using DataEnvironment::OutDryBulbTemp;
 		using DataEnvironment::OutHumRat;
@@ -129,6 +131,7 @@ namespace SizingManager {
 		using OutputReportTabular::AllocateLoadComponentArrays;
 		using OutputReportTabular::DeallocateLoadComponentArrays;
 		using OutputReportTabular::ComputeLoadComponentDecayCurve;
+		using OutputReportTabular::ComputeDelayedComponents;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -412,9 +415,13 @@ namespace SizingManager {
 			if ( CompLoadReportIsReq ) {
 				// call the routine that computes the decay curve
 				ComputeLoadComponentDecayCurve();
+				// convert the radiant gains into delayed convection with the decay curves
+				ComputeDelayedComponents();
 				// remove some of the arrays used to derive the decay curves
 				DeallocateLoadComponentArrays();
 			}
+			// the design day sequences of the calculated zone sizing were copied into ZoneSizing and the final zone sizing
+			DeallocateZoneSizingSequences( CalcZoneSizing );
 		}
 
 		ZoneSizingCalc = false;
@@ -562,6 +569,9 @@ namespace SizingManager {
 			}
 		}
 		SysSizingCalc = false;
+		// only the final zone and system sizing are used from here on
+		DeallocateZoneSizingSequences( ZoneSizing );
+		DeallocateSysSizingSequences();
 
 		// report sizing results to eio file
 		if ( ZoneSizingRunDone ) {
@@ -1,5 +1,8 @@
 // C++ Headers
 #include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -16,6 +19,8 @@
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <ScheduleManager.hh>
+#include <SolarShading.hh>
+#include <SurfaceBVH.hh>
 #include <Vectors.hh>
 
 namespace EnergyPlus {
@@ -108,6 +113,8 @@ namespace SolarReflectionManager {
 		Vector3< Real64 > VecAB; // Vector from receiving surface vertex to obstruction surface vertex (m)
 		Vector3< Real64 > HitPt; // Hit point (m)
 		Real64 DotProd; // Dot product of vectors (m2)
+		Array1D_bool IsPossibleObs; // True for the possible obstructions of the current receiving surface
+		std::vector< int > Candidates; // Surfaces whose bounding box a ray passes through
 		int RecPtNum; // Receiving point number
 		//unused  REAL(r64)         :: SumX                 ! Sum of X (or Y or Z) coordinate values of a surface
 		//unused  REAL(r64)         :: SumY                 ! Sum of X (or Y or Z) coordinate values of a surface
@@ -416,8 +423,14 @@ namespace SolarReflectionManager {
 		// (hit point = point that ray intersects nearest obstruction, or, if ray is downgoing and hits no
 		// obstructions, point that ray intersects ground plane).
 
+		// Obstructions are taken from the surfaces whose bounding box the ray passes through, in
+		// surface order, which is the order of PossibleObsSurfNums
+		IsPossibleObs.dimension( TotSurfaces, false );
 		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
 			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
+			for ( loop1 = 1; loop1 <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop1 ) {
+				IsPossibleObs( SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop1 ) ) = true;
+			}
 			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
 				RecPt = SolReflRecSurf( RecSurfNum ).RecPt( RecPtNum );
 				for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
@@ -430,9 +443,11 @@ namespace SolarReflectionManager {
 					NearestHitDistance = 1.0e+8;
 					ObsSurfNumToSkip = 0;
 					RayVec = SolReflRecSurf( RecSurfNum ).RayVec( RayNum );
-					for ( loop1 = 1; loop1 <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop1 ) {
+					SurfaceBVH::RayCandidates( SurfaceBVH::AllSurfaces, RecPt.x, RecPt.y, RecPt.z, RayVec.x, RayVec.y, RayVec.z, std::numeric_limits< Real64 >::max(), Candidates );
+					for ( int const Cand : Candidates ) {
+						if ( ! IsPossibleObs( Cand ) ) continue;
 						// Surface number of this obstruction
-						ObsSurfNum = SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop1 );
+						ObsSurfNum = Cand;
 						// If a window was hit previously (see below), ObsSurfNumToSkip was set to the window's base surface in order
 						// to remove that surface from consideration as a hit surface for this ray
 						if ( ObsSurfNum == ObsSurfNumToSkip ) continue;
@@ -520,6 +535,9 @@ namespace SolarReflectionManager {
 					} // End of check if obstruction hit
 				} // End of RayNum loop
 			} // End of receiving point loop
+			for ( loop1 = 1; loop1 <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop1 ) {
+				IsPossibleObs( SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop1 ) ) = false;
+			}
 		} // End of receiving surface loop
 
 	}
@@ -541,6 +559,8 @@ namespace SolarReflectionManager {
 		// beam-to-diffuse solar reflection from obstructions and ground.
 
 		// METHODOLOGY EMPLOYED: call worker routine depending on solar calculation method
+		// With the sunlit fraction cache the factors of each hour are kept with the sun direction
+		// of the hour.  Not with timestep integrated solar, where the hour's factors change with the day.
 
 		// REFERENCES: na
 
@@ -548,6 +568,10 @@ namespace SolarReflectionManager {
 		// Using/Aliasing
 		using DataGlobals::HourOfDay;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using SolarShading::RestoreFactorsFromCache;
+		using SolarShading::SaveFactorsToCache;
+		using SolarShading::ShadowCache;
+		using SolarShading::ShadowCacheBmToDiffReflKey;
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS: na
@@ -556,6 +580,7 @@ namespace SolarReflectionManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static int IHr( 0 ); // Hour number
+		std::vector< Real64 > Factors; // Cached obstruction factors of the surfaces followed by their ground factors
 
 		// FLOW:
 
@@ -568,7 +593,24 @@ namespace SolarReflectionManager {
 			ReflFacBmToDiffSolObs = 0.0;
 			ReflFacBmToDiffSolGnd = 0.0;
 			for ( IHr = 1; IHr <= 24; ++IHr ) {
+				if ( ShadowCache.Active ) {
+					Factors.assign( 2 * TotSurfaces, 0.0 );
+					if ( RestoreFactorsFromCache( ReflCacheKey( IHr, ShadowCacheBmToDiffReflKey ), Factors ) ) {
+						for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+							ReflFacBmToDiffSolObs( IHr, SurfNum ) = Factors[ SurfNum - 1 ];
+							ReflFacBmToDiffSolGnd( IHr, SurfNum ) = Factors[ TotSurfaces + SurfNum - 1 ];
+						}
+						continue;
+					}
+				}
 				FigureBeamSolDiffuseReflFactors( IHr );
+				if ( ShadowCache.Active ) {
+					for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+						Factors[ SurfNum - 1 ] = ReflFacBmToDiffSolObs( IHr, SurfNum );
+						Factors[ TotSurfaces + SurfNum - 1 ] = ReflFacBmToDiffSolGnd( IHr, SurfNum );
+					}
+					SaveFactorsToCache( ReflCacheKey( IHr, ShadowCacheBmToDiffReflKey ), Factors );
+				}
 			} // End of IHr loop
 		} else { // timestep integrated solar, use current hour of day
 			ReflFacBmToDiffSolObs( HourOfDay, {1,TotSurfaces} ) = 0.0;
@@ -593,215 +635,221 @@ namespace SolarReflectionManager {
 		// beam-to-diffuse solar reflection from obstructions and ground.
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The receiving surfaces are independent and are done in parallel with OpenMP.
 
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		// na
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// Using/Aliasing
+		using DataSystemVariables::NumberShadowThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+
+		int const nReflThreads( ParallelLoopThreads( NumberShadowThreads, TotSolReflRecSurf ) );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nReflThreads) if(nReflThreads > 1)
+#endif
+		for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
+			FigureBeamSolDiffuseReflRecSurf( iHour, RecSurfNum );
+		}
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+	}
 
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
+	void
+	FigureBeamSolDiffuseReflRecSurf(
+		int const iHour, // Hour of the sun direction
+		int const RecSurfNum // Receiving surface number
+	)
+	{
 
-		// DERIVED TYPE DEFINITIONS:
-		// na
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the beam-to-diffuse solar reflection factors of one receiving surface for
+		// FigureBeamSolDiffuseReflFactors.  Only the factors of this surface are set.
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
+		Vector3< Real64 > SunVec; // Unit vector to sun
+		int SurfNum; // Heat transfer surface number corresponding to RecSurfNum
+		int RecPtNum; // Receiving point number
+		int NumRecPts; // Number of receiving points on a receiving surface
+		int HitPtSurfNum; // Surface number of hit point: -1 = ground,
 		// 0 = sky or obstruction with receiving point below ground level,
 		// >0 = obstruction with receiving point above ground level
-		Array1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
+		Array1D< Real64 > ReflBmToDiffSolObs( MaxRecPts, 0.0 ); // Irradiance at a receiving point for
 		// beam solar diffusely reflected from obstructions, divided by
 		// beam normal irradiance
-		Array1D< Real64 > ReflBmToDiffSolGnd( MaxRecPts ); // Irradiance at a receiving point for
+		Array1D< Real64 > ReflBmToDiffSolGnd( MaxRecPts, 0.0 ); // Irradiance at a receiving point for
 		// beam solar diffusely reflected from the ground, divided by
 		// beam normal irradiance
-		static int RayNum( 0 ); // Ray number
-		static int IHit( 0 ); // > 0 if obstruction is hit; otherwise = 0
-		static Vector3< Real64 > OriginThisRay( 0.0 ); // Origin point of a ray (m)
-		static Vector3< Real64 > ObsHitPt( 0.0 ); // Hit point on obstruction (m)
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static Real64 CosIncBmAtHitPt( 0.0 ); // Cosine of incidence angle of beam solar at hit point
-		static Real64 CosIncBmAtHitPt2( 0.0 ); // Cosine of incidence angle of beam solar at hit point,
+		int RayNum; // Ray number
+		int IHit; // > 0 if obstruction is hit; otherwise = 0
+		Vector3< Real64 > OriginThisRay; // Origin point of a ray (m)
+		Vector3< Real64 > ObsHitPt; // Hit point on obstruction (m)
+		int ObsSurfNum; // Obstruction surface number
+		Real64 CosIncBmAtHitPt; // Cosine of incidence angle of beam solar at hit point
+		Real64 CosIncBmAtHitPt2; // Cosine of incidence angle of beam solar at hit point,
 		//  the mirrored shading surface
-		static Real64 BmReflSolRadiance( 0.0 ); // Solar radiance at hit point due to incident beam, divided
+		Real64 BmReflSolRadiance; // Solar radiance at hit point due to incident beam, divided
 		//  by beam normal irradiance
-		static Real64 dReflBeamToDiffSol( 0.0 ); // Contribution to reflection factor at a receiving point
+		Real64 dReflBeamToDiffSol; // Contribution to reflection factor at a receiving point
 		//  from beam solar reflected from a hit point
-		static Real64 SunLitFract( 0.0 ); // Sunlit fraction
-
-		ReflBmToDiffSolObs = 0.0;
-		ReflBmToDiffSolGnd = 0.0;
+		Real64 SunLitFract; // Sunlit fraction
+		std::vector< int > Candidates; // Surfaces whose bounding box the ray to the sun passes through
 
 		// Unit vector to sun
 		SunVec = SUNCOSHR( iHour, {1,3} );
 
-		// loop through each surface that can receive beam solar reflected as diffuse solar from other surfaces
-		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
-
-			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
-				ReflBmToDiffSolObs( RecPtNum ) = 0.0;
-				ReflBmToDiffSolGnd( RecPtNum ) = 0.0;
-
-				for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
-					HitPtSurfNum = SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RayNum, RecPtNum );
-
-					// Skip rays that do not hit an obstruction or ground.
-					// (Note that if a downgoing ray does not hit an obstruction it will have HitPtSurfNum = 0
-					// if the receiving point is below ground level (see subr. InitSolReflRecSurf); this means
-					// that a below-ground-level receiving point receives no ground-reflected radiation although
-					// it is allowed to receive obstruction-reflected solar radiation and direct (unreflected)
-					// beam and sky solar radiation. As far as reflected solar is concerned, the program does
-					// not handle a sloped ground plane or a horizontal ground plane whose level is different
-					// from one side of the building to another.)
-					if ( HitPtSurfNum == 0 ) continue; // Ray hits sky or obstruction with receiving pt. below ground level
+		SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
+
+		for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
+			ReflBmToDiffSolObs( RecPtNum ) = 0.0;
+			ReflBmToDiffSolGnd( RecPtNum ) = 0.0;
+
+			for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
+				HitPtSurfNum = SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RayNum, RecPtNum );
+
+				// Skip rays that do not hit an obstruction or ground.
+				// (Note that if a downgoing ray does not hit an obstruction it will have HitPtSurfNum = 0
+				// if the receiving point is below ground level (see subr. InitSolReflRecSurf); this means
+				// that a below-ground-level receiving point receives no ground-reflected radiation although
+				// it is allowed to receive obstruction-reflected solar radiation and direct (unreflected)
+				// beam and sky solar radiation. As far as reflected solar is concerned, the program does
+				// not handle a sloped ground plane or a horizontal ground plane whose level is different
+				// from one side of the building to another.)
+				if ( HitPtSurfNum == 0 ) continue; // Ray hits sky or obstruction with receiving pt. below ground level
+
+				if ( HitPtSurfNum > 0 ) {
+					// Skip rays that hit a daylighting shelf, from which solar reflection is calculated separately.
+					if ( Surface( HitPtSurfNum ).Shelf > 0 ) continue;
+
+					// Skip rays that hit a window
+					// If hit point's surface is a window or glass door go to next ray since it is assumed for now
+					// that windows have only beam-to-beam, not beam-to-diffuse, reflection
+					// TH 3/29/2010. Code modified and moved
+					if ( Surface( HitPtSurfNum ).Class == SurfaceClass_Window || Surface( HitPtSurfNum ).Class == SurfaceClass_GlassDoor ) continue;
+
+					// Skip rays that hit non-sunlit surface. Assume first time step of the hour.
+					SunLitFract = SunlitFrac( 1, iHour, HitPtSurfNum );
+
+					// If hit point's surface is not sunlit go to next ray
+					// TH 3/25/2010. why limit to HeatTransSurf? shading surfaces should also apply
+					//IF(Surface(HitPtSurfNum)%HeatTransSurf .AND. SunLitFract < 0.01d0) CYCLE
+					if ( SunLitFract < 0.01 ) continue;
+
+					// TH 3/26/2010. If the hit point falls into the shadow even though SunLitFract > 0, can Cycle.
+					//  This cannot be done now, therefore there are follow-up checks of blocking sun ray
+					//   from the hit point.
+
+					// TH 3/29/2010. Code modified and moved up
+					// If hit point's surface is a window go to next ray since it is assumed for now
+					// that windows have only beam-to-beam, not beam-to-diffuse, reflection
+					//IF(Surface(HitPtSurfNum)%Construction > 0) THEN
+					//  IF(Construct(Surface(HitPtSurfNum)%Construction)%TypeIsWindow) CYCLE
+					//END IF
+				}
 
-					if ( HitPtSurfNum > 0 ) {
-						// Skip rays that hit a daylighting shelf, from which solar reflection is calculated separately.
-						if ( Surface( HitPtSurfNum ).Shelf > 0 ) continue;
-
-						// Skip rays that hit a window
-						// If hit point's surface is a window or glass door go to next ray since it is assumed for now
-						// that windows have only beam-to-beam, not beam-to-diffuse, reflection
-						// TH 3/29/2010. Code modified and moved
-						if ( Surface( HitPtSurfNum ).Class == SurfaceClass_Window || Surface( HitPtSurfNum ).Class == SurfaceClass_GlassDoor ) continue;
-
-						// Skip rays that hit non-sunlit surface. Assume first time step of the hour.
-						SunLitFract = SunlitFrac( 1, iHour, HitPtSurfNum );
-
-						// If hit point's surface is not sunlit go to next ray
-						// TH 3/25/2010. why limit to HeatTransSurf? shading surfaces should also apply
-						//IF(Surface(HitPtSurfNum)%HeatTransSurf .AND. SunLitFract < 0.01d0) CYCLE
-						if ( SunLitFract < 0.01 ) continue;
-
-						// TH 3/26/2010. If the hit point falls into the shadow even though SunLitFract > 0, can Cycle.
-						//  This cannot be done now, therefore there are follow-up checks of blocking sun ray
-						//   from the hit point.
-
-						// TH 3/29/2010. Code modified and moved up
-						// If hit point's surface is a window go to next ray since it is assumed for now
-						// that windows have only beam-to-beam, not beam-to-diffuse, reflection
-						//IF(Surface(HitPtSurfNum)%Construction > 0) THEN
-						//  IF(Construct(Surface(HitPtSurfNum)%Construction)%TypeIsWindow) CYCLE
-						//END IF
+				// Does an obstruction block the vector from this ray's hit point to the sun?
+				IHit = 0;
+				OriginThisRay = SolReflRecSurf( RecSurfNum ).HitPt( RayNum, RecPtNum );
+
+				// Note: if sun is in back of hit surface relative to receiving point, CosIncBmAtHitPt will be < 0
+				CosIncBmAtHitPt = dot( SolReflRecSurf( RecSurfNum ).HitPtNormVec( RayNum, RecPtNum ), SunVec );
+				if ( CosIncBmAtHitPt <= 0.0 ) continue;
+
+				// CR 7872 - TH 4/6/2010. The shading surfaces should point to the receiveing heat transfer surface
+				//  according to the the right hand rule. If user inputs do not follow the rule, use the following
+				//  code to check the mirrored shading surface
+				if ( HitPtSurfNum > 0 ) {
+					if ( Surface( HitPtSurfNum ).ShadowingSurf ) {
+						if ( HitPtSurfNum + 1 < TotSurfaces ) {
+							if ( Surface( HitPtSurfNum + 1 ).ShadowingSurf && Surface( HitPtSurfNum + 1 ).MirroredSurf ) {
+								// Check whether the sun is behind the mirrored shading surface
+								CosIncBmAtHitPt2 = dot( Surface( HitPtSurfNum + 1 ).OutNormVec, SunVec );
+								if ( CosIncBmAtHitPt2 >= 0.0 ) continue;
+							}
+						}
 					}
+				}
 
-					// Does an obstruction block the vector from this ray's hit point to the sun?
-					IHit = 0;
-					OriginThisRay = SolReflRecSurf( RecSurfNum ).HitPt( RayNum, RecPtNum );
+				// TH 3/25/2010. CR 7872. Seems should loop over all possible obstructions for the HitPtSurfNum
+				//  rather than RecSurfNum, because if the HitPtSurfNum is a shading surface,
+				//  it does not belong to SolReflRecSurf which only contain heat transfer surfaces
+				//  that can receive reflected solar (ExtSolar = True)!
 
-					// Note: if sun is in back of hit surface relative to receiving point, CosIncBmAtHitPt will be < 0
-					CosIncBmAtHitPt = dot( SolReflRecSurf( RecSurfNum ).HitPtNormVec( RayNum, RecPtNum ), SunVec );
-					if ( CosIncBmAtHitPt <= 0.0 ) continue;
+				// To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
+				//  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
+				SurfaceBVH::RayCandidates( SurfaceBVH::AllSurfaces, OriginThisRay.x, OriginThisRay.y, OriginThisRay.z, SunVec.x, SunVec.y, SunVec.z, std::numeric_limits< Real64 >::max(), Candidates );
+				for ( int const Cand : Candidates ) {
+					ObsSurfNum = Cand;
+					//        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
+					//          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
 
-					// CR 7872 - TH 4/6/2010. The shading surfaces should point to the receiveing heat transfer surface
-					//  according to the the right hand rule. If user inputs do not follow the rule, use the following
-					//  code to check the mirrored shading surface
+					//CR 8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
 					if ( HitPtSurfNum > 0 ) {
-						if ( Surface( HitPtSurfNum ).ShadowingSurf ) {
-							if ( HitPtSurfNum + 1 < TotSurfaces ) {
-								if ( Surface( HitPtSurfNum + 1 ).ShadowingSurf && Surface( HitPtSurfNum + 1 ).MirroredSurf ) {
-									// Check whether the sun is behind the mirrored shading surface
-									CosIncBmAtHitPt2 = dot( Surface( HitPtSurfNum + 1 ).OutNormVec, SunVec );
-									if ( CosIncBmAtHitPt2 >= 0.0 ) continue;
-								}
-							}
+						if ( Surface( HitPtSurfNum ).MirroredSurf ) {
+							if ( ObsSurfNum == HitPtSurfNum - 1 ) continue;
 						}
 					}
 
-					// TH 3/25/2010. CR 7872. Seems should loop over all possible obstructions for the HitPtSurfNum
-					//  rather than RecSurfNum, because if the HitPtSurfNum is a shading surface,
-					//  it does not belong to SolReflRecSurf which only contain heat transfer surfaces
-					//  that can receive reflected solar (ExtSolar = True)!
-
-					// To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
-					//  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
-					for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
-						//        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
-						//          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
-
-						//CR 8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
-						if ( HitPtSurfNum > 0 ) {
-							if ( Surface( HitPtSurfNum ).MirroredSurf ) {
-								if ( ObsSurfNum == HitPtSurfNum - 1 ) continue;
-							}
-						}
-
-						// skip the hit surface
-						if ( ObsSurfNum == HitPtSurfNum ) continue;
+					// skip the hit surface
+					if ( ObsSurfNum == HitPtSurfNum ) continue;
 
-						// skip mirrored surfaces
-						if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
-						//IF(Surface(ObsSurfNum)%ShadowingSurf .AND. Surface(ObsSurfNum)%Name(1:3) == 'Mir') THEN
-						//  CYCLE
-						//ENDIF
+					// skip mirrored surfaces
+					if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
+					//IF(Surface(ObsSurfNum)%ShadowingSurf .AND. Surface(ObsSurfNum)%Name(1:3) == 'Mir') THEN
+					//  CYCLE
+					//ENDIF
 
-						// skip interior surfaces
-						if ( Surface( ObsSurfNum ).ExtBoundCond >= 1 ) continue;
+					// skip interior surfaces
+					if ( Surface( ObsSurfNum ).ExtBoundCond >= 1 ) continue;
 
-						// For now it is assumed that obstructions that are shading surfaces are opaque.
-						// An improvement here would be to allow these to have transmittance.
-						PierceSurface( ObsSurfNum, OriginThisRay, SunVec, IHit, ObsHitPt );
-						if ( IHit > 0 ) break; // An obstruction was hit
-					}
-					if ( IHit > 0 ) continue; // Sun does not reach this ray's hit point
+					// For now it is assumed that obstructions that are shading surfaces are opaque.
+					// An improvement here would be to allow these to have transmittance.
+					PierceSurface( ObsSurfNum, OriginThisRay, SunVec, IHit, ObsHitPt );
+					if ( IHit > 0 ) break; // An obstruction was hit
+				}
+				if ( IHit > 0 ) continue; // Sun does not reach this ray's hit point
 
-					// Sun reaches this ray's hit point; get beam-reflected diffuse radiance at hit point for
-					// unit beam normal solar
+				// Sun reaches this ray's hit point; get beam-reflected diffuse radiance at hit point for
+				// unit beam normal solar
 
-					//CosIncBmAtHitPt = DOT_PRODUCT(SolReflRecSurf(RecSurfNum)%HitPtNormVec(RecPtNum,RayNum),SunVec)
-					// Note: if sun is in back of hit surface relative to receiving point, CosIncBmAtHitPt will be < 0
-					// and use of MAX in following gives zero beam solar reflecting at hit point.
-					//BmReflSolRadiance = MAX(0.0d0,CosIncBmAtHitPt)*SolReflRecSurf(RecSurfNum)%HitPtSolRefl(RecPtNum,RayNum)
+				//CosIncBmAtHitPt = DOT_PRODUCT(SolReflRecSurf(RecSurfNum)%HitPtNormVec(RecPtNum,RayNum),SunVec)
+				// Note: if sun is in back of hit surface relative to receiving point, CosIncBmAtHitPt will be < 0
+				// and use of MAX in following gives zero beam solar reflecting at hit point.
+				//BmReflSolRadiance = MAX(0.0d0,CosIncBmAtHitPt)*SolReflRecSurf(RecSurfNum)%HitPtSolRefl(RecPtNum,RayNum)
 
-					BmReflSolRadiance = CosIncBmAtHitPt * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
+				BmReflSolRadiance = CosIncBmAtHitPt * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
 
-					if ( BmReflSolRadiance > 0.0 ) {
-						// Contribution to reflection factor from this hit point
-						if ( HitPtSurfNum > 0 ) {
-							// Ray hits an obstruction
-							dReflBeamToDiffSol = BmReflSolRadiance * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
-							ReflBmToDiffSolObs( RecPtNum ) += dReflBeamToDiffSol;
-						} else {
-							// Ray hits ground (in this case we do not multiply by BmReflSolRadiance since
-							// ground reflectance and cos of incidence angle of sun on
-							// ground is taken into account later when ReflFacBmToDiffSolGnd is used)
-							dReflBeamToDiffSol = SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
-							ReflBmToDiffSolGnd( RecPtNum ) += dReflBeamToDiffSol;
-						}
+				if ( BmReflSolRadiance > 0.0 ) {
+					// Contribution to reflection factor from this hit point
+					if ( HitPtSurfNum > 0 ) {
+						// Ray hits an obstruction
+						dReflBeamToDiffSol = BmReflSolRadiance * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
+						ReflBmToDiffSolObs( RecPtNum ) += dReflBeamToDiffSol;
+					} else {
+						// Ray hits ground (in this case we do not multiply by BmReflSolRadiance since
+						// ground reflectance and cos of incidence angle of sun on
+						// ground is taken into account later when ReflFacBmToDiffSolGnd is used)
+						dReflBeamToDiffSol = SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
+						ReflBmToDiffSolGnd( RecPtNum ) += dReflBeamToDiffSol;
 					}
-				} // End of loop over rays from receiving point
-			} // End of loop over receiving points
-
-			// Average over receiving points
-			ReflFacBmToDiffSolObs( iHour, SurfNum ) = 0.0;
-			ReflFacBmToDiffSolGnd( iHour, SurfNum ) = 0.0;
-			NumRecPts = SolReflRecSurf( RecSurfNum ).NumRecPts;
-			for ( RecPtNum = 1; RecPtNum <= NumRecPts; ++RecPtNum ) {
-				ReflFacBmToDiffSolObs( iHour, SurfNum ) += ReflBmToDiffSolObs( RecPtNum );
-				ReflFacBmToDiffSolGnd( iHour, SurfNum ) += ReflBmToDiffSolGnd( RecPtNum );
-			}
-			ReflFacBmToDiffSolObs( iHour, SurfNum ) /= NumRecPts;
-			ReflFacBmToDiffSolGnd( iHour, SurfNum ) /= NumRecPts;
+				}
+			} // End of loop over rays from receiving point
+		} // End of loop over receiving points
+
+		// Average over receiving points
+		ReflFacBmToDiffSolObs( iHour, SurfNum ) = 0.0;
+		ReflFacBmToDiffSolGnd( iHour, SurfNum ) = 0.0;
+		NumRecPts = SolReflRecSurf( RecSurfNum ).NumRecPts;
+		for ( RecPtNum = 1; RecPtNum <= NumRecPts; ++RecPtNum ) {
+			ReflFacBmToDiffSolObs( iHour, SurfNum ) += ReflBmToDiffSolObs( RecPtNum );
+			ReflFacBmToDiffSolGnd( iHour, SurfNum ) += ReflBmToDiffSolGnd( RecPtNum );
+		}
+		ReflFacBmToDiffSolObs( iHour, SurfNum ) /= NumRecPts;
+		ReflFacBmToDiffSolGnd( iHour, SurfNum ) /= NumRecPts;
 
-			// Do not allow ReflFacBmToDiffSolGnd to exceed the surface's unobstructed ground view factor
-			ReflFacBmToDiffSolGnd( iHour, SurfNum ) = min( 0.5 * ( 1.0 - Surface( SurfNum ).CosTilt ), ReflFacBmToDiffSolGnd( iHour, SurfNum ) );
-			// Note: the above factors are dimensionless; they are equal to
-			// (W/m2 reflected solar incident on SurfNum)/(W/m2 beam normal solar)
-		} // End of loop over receiving surfaces
+		// Do not allow ReflFacBmToDiffSolGnd to exceed the surface's unobstructed ground view factor
+		ReflFacBmToDiffSolGnd( iHour, SurfNum ) = min( 0.5 * ( 1.0 - Surface( SurfNum ).CosTilt ), ReflFacBmToDiffSolGnd( iHour, SurfNum ) );
+		// Note: the above factors are dimensionless; they are equal to
+		// (W/m2 reflected solar incident on SurfNum)/(W/m2 beam normal solar)
 
 	}
 
@@ -823,13 +871,17 @@ namespace SolarReflectionManager {
 		// building.
 
 		// METHODOLOGY EMPLOYED:
-		// call worker routine as appropriate
+		// call worker routine as appropriate; the hourly factors are cached as in CalcBeamSolDiffuseReflFactors
 
 		// REFERENCES: na
 
 		// Using/Aliasing
 		using DataGlobals::HourOfDay;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using SolarShading::RestoreFactorsFromCache;
+		using SolarShading::SaveFactorsToCache;
+		using SolarShading::ShadowCache;
+		using SolarShading::ShadowCacheBmToBmReflKey;
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS: na
@@ -838,6 +890,7 @@ namespace SolarReflectionManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static int IHr( 0 ); // Hour number
+		std::vector< Real64 > Factors; // Cached reflection factors of the surfaces followed by their average cosines
 
 		// FLOW:
 		if ( ! DetailedSolarTimestepIntegration ) {
@@ -849,7 +902,24 @@ namespace SolarReflectionManager {
 			ReflFacBmToBmSolObs = 0.0;
 			CosIncAveBmToBmSolObs = 0.0;
 			for ( IHr = 1; IHr <= 24; ++IHr ) {
+				if ( ShadowCache.Active ) {
+					Factors.assign( 2 * TotSurfaces, 0.0 );
+					if ( RestoreFactorsFromCache( ReflCacheKey( IHr, ShadowCacheBmToBmReflKey ), Factors ) ) {
+						for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+							ReflFacBmToBmSolObs( IHr, SurfNum ) = Factors[ SurfNum - 1 ];
+							CosIncAveBmToBmSolObs( IHr, SurfNum ) = Factors[ TotSurfaces + SurfNum - 1 ];
+						}
+						continue;
+					}
+				}
 				FigureBeamSolSpecularReflFactors( IHr );
+				if ( ShadowCache.Active ) {
+					for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+						Factors[ SurfNum - 1 ] = ReflFacBmToBmSolObs( IHr, SurfNum );
+						Factors[ TotSurfaces + SurfNum - 1 ] = CosIncAveBmToBmSolObs( IHr, SurfNum );
+					}
+					SaveFactorsToCache( ReflCacheKey( IHr, ShadowCacheBmToBmReflKey ), Factors );
+				}
 			} // End of IHr loop
 		} else { // timestep integrated solar, use current hour of day
 			ReflFacBmToBmSolObs( HourOfDay, {1,TotSurfaces} ) = 0.0;
@@ -879,185 +949,192 @@ namespace SolarReflectionManager {
 		// i.e. these surfaces has no specular reflection component.
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The receiving surfaces are independent and are done in parallel with OpenMP.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using General::POLYF;
+		using DataSystemVariables::NumberShadowThreads;
+		using DataSystemVariables::ParallelLoopThreads;
 
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+		if ( SUNCOSHR( iHour, 3 ) < SunIsUpValue ) return; // Skip if sun is below horizon
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+		int const nReflThreads( ParallelLoopThreads( NumberShadowThreads, TotSolReflRecSurf ) );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nReflThreads) if(nReflThreads > 1)
+#endif
+		for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
+			if ( SolReflRecSurf( RecSurfNum ).NumPossibleObs > 0 ) FigureBeamSolSpecularReflRecSurf( iHour, RecSurfNum );
+		}
 
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
+	}
 
-		// DERIVED TYPE DEFINITIONS:
-		// na
+	void
+	FigureBeamSolSpecularReflRecSurf(
+		int const iHour, // Hour of the sun direction
+		int const RecSurfNum // Receiving surface number
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the beam-to-beam solar reflection factors of one receiving surface with possible
+		// obstructions for FigureBeamSolSpecularReflFactors.  Only the factors of this surface are set.
+
+		// METHODOLOGY EMPLOYED:
+		// The obstructions between a building shade and the sun are found with the surface
+		// bounding volume hierarchy.  Any hit blocks the sun, so the candidates give the same
+		// result as a scan of all the surfaces.
+
+		// Using/Aliasing
+		using General::POLYF;
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int loop( 0 ); // DO loop indices
-		static int loop2( 0 ); // DO loop indices
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static Vector3< Real64 > SunVecMir( 0.0 ); // Unit vector to sun mirrored by a reflecting surface
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int RecPtNum( 0 ); // Receiving point number
-		static Vector3< Real64 > RecPt( 0.0 ); // Receiving point (m)
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Hit point on a reflecting surface (m)
-		Array1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
-		// beam solar diffusely reflected from obstructions, divided by
-		// beam normal irradiance
-		//unused  INTEGER           :: RayNum               =0   ! Ray number
-		static int IHitRefl( 0 ); // > 0 if reflecting surface is hit; otherwise = 0
-		static int IHitObs( 0 ); // > 0 if obstruction is hit
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on obstruction (m)
-		static int IHitObsRefl( 0 ); // > 0 if obstruction hit between rec. pt. and reflection point
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static int ReflSurfNum( 0 ); // Reflecting surface number
-		static int ReflSurfRecNum( 0 ); // Receiving surface number corresponding to a reflecting surface number
-		static Vector3< Real64 > ReflNorm( 0.0 ); // Unit normal to reflecting surface
-		Array1D< Real64 > ReflBmToBmSolObs( MaxRecPts ); // Irradiance at a receiving point for
+		int loop; // DO loop indices
+		int loop2; // DO loop indices
+		Vector3< Real64 > SunVec; // Unit vector to sun
+		Vector3< Real64 > SunVecMir; // Unit vector to sun mirrored by a reflecting surface
+		int SurfNum; // Heat transfer surface number corresponding to RecSurfNum
+		int NumRecPts; // Number of receiving points on a receiving surface
+		int RecPtNum; // Receiving point number
+		Vector3< Real64 > RecPt; // Receiving point (m)
+		Vector3< Real64 > HitPtRefl; // Hit point on a reflecting surface (m)
+		int IHitRefl; // > 0 if reflecting surface is hit; otherwise = 0
+		int IHitObs; // > 0 if obstruction is hit
+		Vector3< Real64 > HitPtObs; // Hit point on obstruction (m)
+		int IHitObsRefl; // > 0 if obstruction hit between rec. pt. and reflection point
+		int ObsSurfNum; // Obstruction surface number
+		int ReflSurfNum; // Reflecting surface number
+		int ReflSurfRecNum; // Receiving surface number corresponding to a reflecting surface number
+		Vector3< Real64 > ReflNorm; // Unit normal to reflecting surface
+		Array1D< Real64 > ReflBmToBmSolObs( MaxRecPts, 0.0 ); // Irradiance at a receiving point for
 		// beam solar specularly reflected from obstructions, divided by
 		// beam normal irradiance
-		static Real64 ReflDistance( 0.0 ); // Distance from receiving point to hit point on a reflecting surface (m)
-		static Real64 ObsDistance( 0.0 ); // Distance from receiving point to hit point on an obstruction (m)
-		static Real64 SpecReflectance( 0.0 ); // Specular reflectance of a reflecting surface
-		static int ConstrNumRefl( 0 ); // Construction number of a reflecting surface
-		static Real64 CosIncAngRefl( 0.0 ); // Cosine of incidence angle of beam on reflecting surface
-		static Real64 CosIncAngRec( 0.0 ); // Angle of incidence of reflected beam on receiving surface
-		static Real64 ReflFac( 0.0 ); // Contribution to specular reflection factor
-		Array1D< Real64 > ReflFacTimesCosIncSum( MaxRecPts ); // Sum of ReflFac times CosIncAngRefl
-		static Real64 CosIncWeighted( 0.0 ); // Cosine of incidence angle on receiving surf weighted by reflection factor
-
-		ReflBmToDiffSolObs = 0.0;
-		ReflFacTimesCosIncSum = 0.0;
-
-		if ( SUNCOSHR( iHour, 3 ) < SunIsUpValue ) return; // Skip if sun is below horizon
+		Real64 ReflDistance; // Distance from receiving point to hit point on a reflecting surface (m)
+		Real64 ObsDistance; // Distance from receiving point to hit point on an obstruction (m)
+		Real64 SpecReflectance; // Specular reflectance of a reflecting surface
+		int ConstrNumRefl; // Construction number of a reflecting surface
+		Real64 CosIncAngRefl; // Cosine of incidence angle of beam on reflecting surface
+		Real64 CosIncAngRec; // Angle of incidence of reflected beam on receiving surface
+		Real64 ReflFac; // Contribution to specular reflection factor
+		Array1D< Real64 > ReflFacTimesCosIncSum( MaxRecPts, 0.0 ); // Sum of ReflFac times CosIncAngRefl
+		Real64 CosIncWeighted; // Cosine of incidence angle on receiving surf weighted by reflection factor
+		std::vector< int > Candidates; // Surfaces whose bounding box the ray to the sun passes through
 
 		// Unit vector to sun
 		SunVec = SUNCOSHR( iHour, {1,3} );
 
-		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
-			if ( SolReflRecSurf( RecSurfNum ).NumPossibleObs > 0 ) {
-				ReflBmToBmSolObs = 0.0;
-				ReflFacTimesCosIncSum = 0.0;
-				// Find possible reflecting surfaces for this receiving surface
-				for ( loop = 1; loop <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop ) {
-					ReflSurfNum = SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop );
-					// Keep windows; keep shading surfaces with specular reflectance
-					if ( ( Surface( ReflSurfNum ).Class == SurfaceClass_Window && Surface( ReflSurfNum ).ExtSolar ) || ( Surface( ReflSurfNum ).ShadowSurfGlazingFrac > 0.0 && Surface( ReflSurfNum ).ShadowingSurf ) ) {
-						// Skip if window and not sunlit
-						if ( Surface( ReflSurfNum ).Class == SurfaceClass_Window && SunlitFrac( 1, iHour, ReflSurfNum ) < 0.01 ) continue;
-						// Check if sun is in front of this reflecting surface.
-						ReflNorm = Surface( ReflSurfNum ).OutNormVec;
-						CosIncAngRefl = dot( SunVec, ReflNorm );
-						if ( CosIncAngRefl < 0.0 ) continue;
-
-						// Get sun position unit vector for mirror image of sun in reflecting surface
-						SunVecMir = SunVec - 2.0 * dot( SunVec, ReflNorm ) * ReflNorm;
-						// Angle of incidence of reflected beam on receiving surface
-						CosIncAngRec = dot( SolReflRecSurf( RecSurfNum ).NormVec, SunVecMir );
-						if ( CosIncAngRec <= 0.0 ) continue;
-						for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
-							// See if ray from receiving point to mirrored sun hits the reflecting surface
-							RecPt = SolReflRecSurf( RecSurfNum ).RecPt( RecPtNum );
-							PierceSurface( ReflSurfNum, RecPt, SunVecMir, IHitRefl, HitPtRefl );
-							if ( IHitRefl > 0 ) {
-								// Reflecting surface was hit
-								ReflDistance = distance( HitPtRefl, RecPt );
-								// Determine if ray from receiving point to hit point is obstructed
-								IHitObsRefl = 0;
-								for ( loop2 = 1; loop2 <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop2 ) {
-									ObsSurfNum = SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop2 );
-									if ( ObsSurfNum == ReflSurfNum || ObsSurfNum == Surface( ReflSurfNum ).BaseSurf ) continue;
-									PierceSurface( ObsSurfNum, RecPt, SunVecMir, IHitObs, HitPtObs );
-									if ( IHitObs > 0 ) {
-										ObsDistance = distance( HitPtObs, RecPt );
-										if ( ObsDistance < ReflDistance ) {
-											IHitObsRefl = 1;
-											break;
-										}
-									}
+		SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
+		// Find possible reflecting surfaces for this receiving surface
+		for ( loop = 1; loop <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop ) {
+			ReflSurfNum = SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop );
+			// Keep windows; keep shading surfaces with specular reflectance
+			if ( ( Surface( ReflSurfNum ).Class == SurfaceClass_Window && Surface( ReflSurfNum ).ExtSolar ) || ( Surface( ReflSurfNum ).ShadowSurfGlazingFrac > 0.0 && Surface( ReflSurfNum ).ShadowingSurf ) ) {
+				// Skip if window and not sunlit
+				if ( Surface( ReflSurfNum ).Class == SurfaceClass_Window && SunlitFrac( 1, iHour, ReflSurfNum ) < 0.01 ) continue;
+				// Check if sun is in front of this reflecting surface.
+				ReflNorm = Surface( ReflSurfNum ).OutNormVec;
+				CosIncAngRefl = dot( SunVec, ReflNorm );
+				if ( CosIncAngRefl < 0.0 ) continue;
+
+				// Get sun position unit vector for mirror image of sun in reflecting surface
+				SunVecMir = SunVec - 2.0 * dot( SunVec, ReflNorm ) * ReflNorm;
+				// Angle of incidence of reflected beam on receiving surface
+				CosIncAngRec = dot( SolReflRecSurf( RecSurfNum ).NormVec, SunVecMir );
+				if ( CosIncAngRec <= 0.0 ) continue;
+				for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
+					// See if ray from receiving point to mirrored sun hits the reflecting surface
+					RecPt = SolReflRecSurf( RecSurfNum ).RecPt( RecPtNum );
+					PierceSurface( ReflSurfNum, RecPt, SunVecMir, IHitRefl, HitPtRefl );
+					if ( IHitRefl > 0 ) {
+						// Reflecting surface was hit
+						ReflDistance = distance( HitPtRefl, RecPt );
+						// Determine if ray from receiving point to hit point is obstructed
+						IHitObsRefl = 0;
+						for ( loop2 = 1; loop2 <= SolReflRecSurf( RecSurfNum ).NumPossibleObs; ++loop2 ) {
+							ObsSurfNum = SolReflRecSurf( RecSurfNum ).PossibleObsSurfNums( loop2 );
+							if ( ObsSurfNum == ReflSurfNum || ObsSurfNum == Surface( ReflSurfNum ).BaseSurf ) continue;
+							PierceSurface( ObsSurfNum, RecPt, SunVecMir, IHitObs, HitPtObs );
+							if ( IHitObs > 0 ) {
+								ObsDistance = distance( HitPtObs, RecPt );
+								if ( ObsDistance < ReflDistance ) {
+									IHitObsRefl = 1;
+									break;
 								}
-								if ( IHitObsRefl > 0 ) continue; // Obstruct'n closer than reflect'n pt. was hit; go to next rec. pt.
-								// There is no obstruction for this ray between rec. pt. and hit point on reflecting surface.
-								// See if ray from hit pt. on reflecting surface to original (unmirrored) sun position is obstructed
-								IHitObs = 0;
-								if ( Surface( ReflSurfNum ).Class == SurfaceClass_Window ) {
-									// Reflecting surface is a window.
-									// Receiving surface number for this window.
-									ReflSurfRecNum = Surface( ReflSurfNum ).ShadowSurfRecSurfNum;
-									if ( ReflSurfRecNum > 0 ) {
-										// Loop over possible obstructions for this window
-										for ( loop2 = 1; loop2 <= SolReflRecSurf( ReflSurfRecNum ).NumPossibleObs; ++loop2 ) {
-											ObsSurfNum = SolReflRecSurf( ReflSurfRecNum ).PossibleObsSurfNums( loop2 );
-											PierceSurface( ObsSurfNum, HitPtRefl, SunVec, IHitObs, HitPtObs );
-											if ( IHitObs > 0 ) break;
-										}
-									}
-								} else {
-									// Reflecting surface is a building shade
-									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
-										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
-										if ( ObsSurfNum == ReflSurfNum ) continue;
-
-										//TH2 CR8959 -- Skip mirrored surfaces
-										if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
-										//TH2 CR8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
-										if ( Surface( ReflSurfNum ).MirroredSurf ) {
-											if ( ObsSurfNum == ReflSurfNum - 1 ) continue;
-										}
-
-										PierceSurface( ObsSurfNum, HitPtRefl, SunVec, IHitObs, HitPtObs );
-										if ( IHitObs > 0 ) break;
-									}
+							}
+						}
+						if ( IHitObsRefl > 0 ) continue; // Obstruct'n closer than reflect'n pt. was hit; go to next rec. pt.
+						// There is no obstruction for this ray between rec. pt. and hit point on reflecting surface.
+						// See if ray from hit pt. on reflecting surface to original (unmirrored) sun position is obstructed
+						IHitObs = 0;
+						if ( Surface( ReflSurfNum ).Class == SurfaceClass_Window ) {
+							// Reflecting surface is a window.
+							// Receiving surface number for this window.
+							ReflSurfRecNum = Surface( ReflSurfNum ).ShadowSurfRecSurfNum;
+							if ( ReflSurfRecNum > 0 ) {
+								// Loop over possible obstructions for this window
+								for ( loop2 = 1; loop2 <= SolReflRecSurf( ReflSurfRecNum ).NumPossibleObs; ++loop2 ) {
+									ObsSurfNum = SolReflRecSurf( ReflSurfRecNum ).PossibleObsSurfNums( loop2 );
+									PierceSurface( ObsSurfNum, HitPtRefl, SunVec, IHitObs, HitPtObs );
+									if ( IHitObs > 0 ) break;
+								}
+							}
+						} else {
+							// Reflecting surface is a building shade
+							SurfaceBVH::RayCandidates( SurfaceBVH::AllSurfaces, HitPtRefl.x, HitPtRefl.y, HitPtRefl.z, SunVec.x, SunVec.y, SunVec.z, std::numeric_limits< Real64 >::max(), Candidates );
+							for ( int const Cand : Candidates ) {
+								ObsSurfNum = Cand;
+								if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
+								if ( ObsSurfNum == ReflSurfNum ) continue;
+
+								//TH2 CR8959 -- Skip mirrored surfaces
+								if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
+								//TH2 CR8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
+								if ( Surface( ReflSurfNum ).MirroredSurf ) {
+									if ( ObsSurfNum == ReflSurfNum - 1 ) continue;
 								}
 
-								if ( IHitObs > 0 ) continue; // Obstruct'n hit between reflect'n hit point and sun; go to next receiving pt.
+								PierceSurface( ObsSurfNum, HitPtRefl, SunVec, IHitObs, HitPtObs );
+								if ( IHitObs > 0 ) break;
+							}
+						}
 
-								// No obstructions. Calculate reflected beam irradiance at receiving pt. from this reflecting surface.
-								SpecReflectance = 0.0;
-								if ( Surface( ReflSurfNum ).Class == SurfaceClass_Window ) {
-									ConstrNumRefl = Surface( ReflSurfNum ).Construction;
-									SpecReflectance = POLYF( std::abs( CosIncAngRefl ), Construct( ConstrNumRefl ).ReflSolBeamFrontCoef( {1,6} ) );
-								}
-								if ( Surface( ReflSurfNum ).ShadowingSurf && Surface( ReflSurfNum ).ShadowSurfGlazingConstruct > 0 ) {
-									ConstrNumRefl = Surface( ReflSurfNum ).ShadowSurfGlazingConstruct;
-									SpecReflectance = Surface( ReflSurfNum ).ShadowSurfGlazingFrac * POLYF( std::abs( CosIncAngRefl ), Construct( ConstrNumRefl ).ReflSolBeamFrontCoef( {1,6} ) );
-								}
-								// Angle of incidence of reflected beam on receiving surface
-								CosIncAngRec = dot( SolReflRecSurf( RecSurfNum ).NormVec, SunVecMir );
-								ReflFac = SpecReflectance * CosIncAngRec;
-								// Contribution to specular reflection factor
-								ReflBmToBmSolObs( RecPtNum ) += ReflFac;
-								ReflFacTimesCosIncSum( RecPtNum ) += ReflFac * CosIncAngRec;
-							} // End of check if reflecting surface was hit
-						} // End of loop over receiving points
-					} // End of check if valid reflecting surface
-				} // End of loop over obstructing surfaces
-				// Average over receiving points
-				NumRecPts = SolReflRecSurf( RecSurfNum ).NumRecPts;
-
-				for ( RecPtNum = 1; RecPtNum <= NumRecPts; ++RecPtNum ) {
-					if ( ReflBmToBmSolObs( RecPtNum ) != 0.0 ) {
-						CosIncWeighted = ReflFacTimesCosIncSum( RecPtNum ) / ReflBmToBmSolObs( RecPtNum );
-					} else {
-						CosIncWeighted = 0.0;
-					}
-					CosIncAveBmToBmSolObs( iHour, SurfNum ) += CosIncWeighted;
-					ReflFacBmToBmSolObs( iHour, SurfNum ) += ReflBmToBmSolObs( RecPtNum );
-				}
-				ReflFacBmToBmSolObs( iHour, SurfNum ) /= double( NumRecPts );
-				CosIncAveBmToBmSolObs( iHour, SurfNum ) /= double( NumRecPts );
-			} // End of check if number of possible obstructions > 0
-		} // End of loop over receiving surfaces
+						if ( IHitObs > 0 ) continue; // Obstruct'n hit between reflect'n hit point and sun; go to next receiving pt.
+
+						// No obstructions. Calculate reflected beam irradiance at receiving pt. from this reflecting surface.
+						SpecReflectance = 0.0;
+						if ( Surface( ReflSurfNum ).Class == SurfaceClass_Window ) {
+							ConstrNumRefl = Surface( ReflSurfNum ).Construction;
+							SpecReflectance = POLYF( std::abs( CosIncAngRefl ), Construct( ConstrNumRefl ).ReflSolBeamFrontCoef( {1,6} ) );
+						}
+						if ( Surface( ReflSurfNum ).ShadowingSurf && Surface( ReflSurfNum ).ShadowSurfGlazingConstruct > 0 ) {
+							ConstrNumRefl = Surface( ReflSurfNum ).ShadowSurfGlazingConstruct;
+							SpecReflectance = Surface( ReflSurfNum ).ShadowSurfGlazingFrac * POLYF( std::abs( CosIncAngRefl ), Construct( ConstrNumRefl ).ReflSolBeamFrontCoef( {1,6} ) );
+						}
+						// Angle of incidence of reflected beam on receiving surface
+						CosIncAngRec = dot( SolReflRecSurf( RecSurfNum ).NormVec, SunVecMir );
+						ReflFac = SpecReflectance * CosIncAngRec;
+						// Contribution to specular reflection factor
+						ReflBmToBmSolObs( RecPtNum ) += ReflFac;
+						ReflFacTimesCosIncSum( RecPtNum ) += ReflFac * CosIncAngRec;
+					} // End of check if reflecting surface was hit
+				} // End of loop over receiving points
+			} // End of check if valid reflecting surface
+		} // End of loop over obstructing surfaces
+		// Average over receiving points
+		NumRecPts = SolReflRecSurf( RecSurfNum ).NumRecPts;
+
+		for ( RecPtNum = 1; RecPtNum <= NumRecPts; ++RecPtNum ) {
+			if ( ReflBmToBmSolObs( RecPtNum ) != 0.0 ) {
+				CosIncWeighted = ReflFacTimesCosIncSum( RecPtNum ) / ReflBmToBmSolObs( RecPtNum );
+			} else {
+				CosIncWeighted = 0.0;
+			}
+			CosIncAveBmToBmSolObs( iHour, SurfNum ) += CosIncWeighted;
+			ReflFacBmToBmSolObs( iHour, SurfNum ) += ReflBmToBmSolObs( RecPtNum );
+		}
+		ReflFacBmToBmSolObs( iHour, SurfNum ) /= double( NumRecPts );
+		CosIncAveBmToBmSolObs( iHour, SurfNum ) /= double( NumRecPts );
 
 	}
 
@@ -1077,177 +1154,250 @@ namespace SolarReflectionManager {
 		// Calculates factors for irradiance on exterior heat transfer surfaces due to
 		// reflection of sky diffuse solar radiation from obstructions and ground.
 
-		// METHODOLOGY EMPLOYED: na
+		// METHODOLOGY EMPLOYED:
+		// The receiving surfaces are independent and are done in parallel with OpenMP.  With the
+		// sunlit fraction cache the factors are kept unless the sky shading of the obstructions
+		// varies with the time of the simulation (detailed sky diffuse modeling).
 
 		// REFERENCES: na
 
 		// Using/Aliasing
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
-		using namespace Vectors;
+		using DataSystemVariables::NumberShadowThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+		using SolarShading::RestoreFactorsFromCache;
+		using SolarShading::SaveFactorsToCache;
+		using SolarShading::ShadowCache;
+		using SolarShading::ShadowCacheSkyReflKey;
 
-		// Locals
-		// SUBROUTINE PARAMETER DEFINITIONS: na
-		// INTERFACE BLOCK SPECIFICATIONS: na
-		// DERIVED TYPE DEFINITIONS: na
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< Real64 > Factors; // Cached obstruction factors of the surfaces followed by their ground factors
+		// FLOW:
+
+		DisplayString( "Calculating Sky Diffuse Exterior Solar Reflection Factors" );
+
+		bool const UseCache( ShadowCache.Active && ( ! DetailedSkyDiffuseAlgorithm || ! ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing ) );
+		if ( UseCache ) {
+			Factors.assign( 2 * TotSurfaces, 0.0 );
+			if ( RestoreFactorsFromCache( ReflCacheKey( 0, ShadowCacheSkyReflKey ), Factors ) ) {
+				for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+					ReflFacSkySolObs( SurfNum ) = Factors[ SurfNum - 1 ];
+					ReflFacSkySolGnd( SurfNum ) = Factors[ TotSurfaces + SurfNum - 1 ];
+				}
+				return;
+			}
+		}
+
+		int const nReflThreads( ParallelLoopThreads( NumberShadowThreads, TotSolReflRecSurf ) );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nReflThreads) if(nReflThreads > 1)
+#endif
+		for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
+			FigureSkySolDiffuseReflRecSurf( RecSurfNum );
+		}
+
+		if ( UseCache ) {
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				Factors[ SurfNum - 1 ] = ReflFacSkySolObs( SurfNum );
+				Factors[ TotSurfaces + SurfNum - 1 ] = ReflFacSkySolGnd( SurfNum );
+			}
+			SaveFactorsToCache( ReflCacheKey( 0, ShadowCacheSkyReflKey ), Factors );
+		}
+
+	}
+
+	void
+	FigureSkySolDiffuseReflRecSurf( int const RecSurfNum ) // Receiving surface number
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the sky diffuse solar reflection factors of one receiving surface for
+		// CalcSkySolDiffuseReflFactors.  Only the factors of this surface are set.
+
+		// METHODOLOGY EMPLOYED:
+		// The obstructions of the upward rays from a ground hit point are found with the surface
+		// bounding volume hierarchy.  Any hit blocks the sky, so the candidates give the same
+		// result as a scan of all the surfaces.
+
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+		using namespace Vectors;
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
+		int SurfNum; // Heat transfer surface number corresponding to RecSurfNum
+		int ObsSurfNum; // Obstruction surface number
+		int RecPtNum; // Receiving point number
+		int NumRecPts; // Number of receiving points on a receiving surface
+		int HitPtSurfNum; // Surface number of hit point: -1 = ground,
 		// 0 = sky or obstruction with receiving point below ground level,
 		// >0 = obstruction with receiving point above ground level
-		static int HitPtSurfNumX( 0 ); // For a shading surface, HitPtSurfNum for original surface,
+		int HitPtSurfNumX; // For a shading surface, HitPtSurfNum for original surface,
 		// HitPitSurfNum + 1 for mirror surface
-		Array1D< Real64 > ReflSkySolObs( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
+		Array1D< Real64 > ReflSkySolObs( MaxRecPts, 0.0 ); // Irradiance at a receiving point for sky diffuse solar
 		// reflected from obstructions, divided by unobstructed
 		// sky diffuse horizontal irradiance
-		Array1D< Real64 > ReflSkySolGnd( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
+		Array1D< Real64 > ReflSkySolGnd( MaxRecPts, 0.0 ); // Irradiance at a receiving point for sky diffuse solar
 		// reflected from ground, divided by unobstructed
 		// sky diffuse horizontal irradiance
-		static int RayNum( 0 ); // Ray number
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Coordinates of hit point on obstruction or ground (m)
-		static int IHitObs( 0 ); // > 0 if obstruction is hit; otherwise = 0
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on an obstruction (m)
-		//unused  REAL(r64)         :: ObsHitPt(3)          =0.0 ! Hit point on obstruction (m)
-		static Real64 dOmega( 0.0 ); // Solid angle increment (steradians)
-		static Real64 CosIncAngRayToSky( 0.0 ); // Cosine of incidence angle on ground of ray to sky
-		static Real64 SkyReflSolRadiance( 0.0 ); // Reflected radiance at hit point divided by unobstructed
+		int RayNum; // Ray number
+		Vector3< Real64 > HitPtRefl; // Coordinates of hit point on obstruction or ground (m)
+		int IHitObs; // > 0 if obstruction is hit; otherwise = 0
+		Vector3< Real64 > HitPtObs; // Hit point on an obstruction (m)
+		Real64 dOmega; // Solid angle increment (steradians)
+		Real64 CosIncAngRayToSky; // Cosine of incidence angle on ground of ray to sky
+		Real64 SkyReflSolRadiance; // Reflected radiance at hit point divided by unobstructed
 		//  sky diffuse horizontal irradiance
-		static Real64 dReflSkySol( 0.0 ); // Contribution to reflection factor at a receiving point
+		Real64 dReflSkySol; // Contribution to reflection factor at a receiving point
 		//  from sky solar reflected from a hit point
-		static Real64 Phi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 DPhi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 SPhi( 0.0 ); // Sine of Phi
-		static Real64 CPhi( 0.0 ); // Cosine of Phi
-		static Real64 Theta( 0.0 ); // Azimuth angle (radians)
-		static Real64 DTheta( 0.0 ); // Azimuth increment (radians)
-		static int IPhi( 0 ); // Altitude angle index
-		static int ITheta( 0 ); // Azimuth angle index
-		static Vector3< Real64 > URay( 0.0 ); // Unit vector along ray from ground hit point
-		static Vector3< Real64 > SurfVertToGndPt( 0.0 ); // Vector from a vertex of possible obstructing surface to ground
+		Real64 Phi; // Altitude angle and increment (radians)
+		Real64 DPhi; // Altitude angle and increment (radians)
+		Real64 SPhi; // Sine of Phi
+		Real64 CPhi; // Cosine of Phi
+		Real64 Theta; // Azimuth angle (radians)
+		Real64 DTheta; // Azimuth increment (radians)
+		int IPhi; // Altitude angle index
+		int ITheta; // Azimuth angle index
+		Vector3< Real64 > URay( 0.0 ); // Unit vector along ray from ground hit point
+		Vector3< Real64 > SurfVertToGndPt; // Vector from a vertex of possible obstructing surface to ground
 		//  hit point (m)
-		static Vector3< Real64 > SurfVert( 0.0 ); // Surface vertex (m)
-		static Real64 dReflSkyGnd( 0.0 ); // Factor for ground radiance due to direct sky diffuse reflection
-		// FLOW:
-
-		DisplayString( "Calculating Sky Diffuse Exterior Solar Reflection Factors" );
-		ReflSkySolObs = 0.0;
-		ReflSkySolGnd = 0.0;
-
-		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
-			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
-				ReflSkySolObs( RecPtNum ) = 0.0;
-				ReflSkySolGnd( RecPtNum ) = 0.0;
-				for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
-					HitPtSurfNum = SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RayNum, RecPtNum );
-					// Skip rays that do not hit an obstruction or ground.
-					// (Note that if a downgoing ray does not hit an obstruction it will have HitPtSurfNum = 0
-					// if the receiving point is below ground level (see subr. InitSolReflRecSurf); this means
-					// that a below-ground-level receiving point receives no ground-reflected radiation although
-					// it is allowed to receive obstruction-reflected solar radiation and direct (unreflected)
-					// beam and sky solar radiation. As far as reflected solar is concerned, the program does
-					// not handle a sloped ground plane or a horizontal ground plane whose level is different
-					// from one side of the building to another.)
-					if ( HitPtSurfNum == 0 ) continue; // Ray hits sky or obstruction with receiving pt. below ground level
-					HitPtRefl = SolReflRecSurf( RecSurfNum ).HitPt( RayNum, RecPtNum );
-					if ( HitPtSurfNum > 0 ) {
-						// Ray hits an obstruction
-						// Skip hit points on daylighting shelves, from which solar reflection is separately calculated
-						if ( Surface( HitPtSurfNum ).Shelf > 0 ) continue;
-						// Reflected radiance at hit point divided by unobstructed sky diffuse horizontal irradiance
-						HitPtSurfNumX = HitPtSurfNum;
-						// Each shading surface has a "mirror" duplicate surface facing in the opposite direction.
-						// The following gets the correct side of a shading surface in order to get the right value
-						// of DifShdgRatioIsoSky (the two sides can have different sky shadowing).
-						if ( Surface( HitPtSurfNum ).ShadowingSurf ) {
-							if ( dot( SolReflRecSurf( RecSurfNum ).RayVec( RayNum ), Surface( HitPtSurfNum ).OutNormVec ) > 0.0 ) {
-								if ( HitPtSurfNum + 1 < TotSurfaces ) HitPtSurfNumX = HitPtSurfNum + 1;
-								if ( Surface( HitPtSurfNumX ).Shelf > 0 ) continue;
-							}
+		Vector3< Real64 > SurfVert; // Surface vertex (m)
+		Real64 dReflSkyGnd; // Factor for ground radiance due to direct sky diffuse reflection
+		std::vector< int > Candidates; // Surfaces whose bounding box the ray to the sky passes through
+
+		SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
+		for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
+			ReflSkySolObs( RecPtNum ) = 0.0;
+			ReflSkySolGnd( RecPtNum ) = 0.0;
+			for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
+				HitPtSurfNum = SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RayNum, RecPtNum );
+				// Skip rays that do not hit an obstruction or ground.
+				// (Note that if a downgoing ray does not hit an obstruction it will have HitPtSurfNum = 0
+				// if the receiving point is below ground level (see subr. InitSolReflRecSurf); this means
+				// that a below-ground-level receiving point receives no ground-reflected radiation although
+				// it is allowed to receive obstruction-reflected solar radiation and direct (unreflected)
+				// beam and sky solar radiation. As far as reflected solar is concerned, the program does
+				// not handle a sloped ground plane or a horizontal ground plane whose level is different
+				// from one side of the building to another.)
+				if ( HitPtSurfNum == 0 ) continue; // Ray hits sky or obstruction with receiving pt. below ground level
+				HitPtRefl = SolReflRecSurf( RecSurfNum ).HitPt( RayNum, RecPtNum );
+				if ( HitPtSurfNum > 0 ) {
+					// Ray hits an obstruction
+					// Skip hit points on daylighting shelves, from which solar reflection is separately calculated
+					if ( Surface( HitPtSurfNum ).Shelf > 0 ) continue;
+					// Reflected radiance at hit point divided by unobstructed sky diffuse horizontal irradiance
+					HitPtSurfNumX = HitPtSurfNum;
+					// Each shading surface has a "mirror" duplicate surface facing in the opposite direction.
+					// The following gets the correct side of a shading surface in order to get the right value
+					// of DifShdgRatioIsoSky (the two sides can have different sky shadowing).
+					if ( Surface( HitPtSurfNum ).ShadowingSurf ) {
+						if ( dot( SolReflRecSurf( RecSurfNum ).RayVec( RayNum ), Surface( HitPtSurfNum ).OutNormVec ) > 0.0 ) {
+							if ( HitPtSurfNum + 1 < TotSurfaces ) HitPtSurfNumX = HitPtSurfNum + 1;
+							if ( Surface( HitPtSurfNumX ).Shelf > 0 ) continue;
 						}
+					}
 
-						if ( ! DetailedSkyDiffuseAlgorithm || ! ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing ) {
-							SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSky( HitPtSurfNumX ) * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
-						} else {
-							SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSkyHRTS( 1, 1, HitPtSurfNumX ) * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
-						}
-						dReflSkySol = SkyReflSolRadiance * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
-						ReflSkySolObs( RecPtNum ) += dReflSkySol;
+					if ( ! DetailedSkyDiffuseAlgorithm || ! ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing ) {
+						SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSky( HitPtSurfNumX ) * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
 					} else {
-						// Ray hits ground;
-						// Find radiance at hit point due to reflection of sky diffuse reaching
-						// ground directly, i.e., without reflecting from obstructions.
-						// Send rays upward from hit point and see which ones are unobstructed and so go to sky.
-						// Divide hemisphere centered at ground hit point into elements of altitude Phi and
-						// azimuth Theta and create upward-going ray unit vector at each Phi,Theta pair.
-						// Phi = 0 at the horizon; Phi = Pi/2 at the zenith.
-						DPhi = PiOvr2 / ( AltAngStepsForSolReflCalc / 2.0 );
-						dReflSkyGnd = 0.0;
-						// Altitude loop
-						for ( IPhi = 1; IPhi <= ( AltAngStepsForSolReflCalc / 2 ); ++IPhi ) {
-							Phi = ( IPhi - 0.5 ) * DPhi;
-							SPhi = std::sin( Phi );
-							CPhi = std::cos( Phi );
-							// Third component of ray unit vector in (Theta,Phi) direction
-							URay( 3 ) = SPhi;
-							DTheta = 2.0 * Pi / ( 2.0 * AzimAngStepsForSolReflCalc );
-							dOmega = CPhi * DTheta * DPhi;
-							// Cosine of angle of incidence of ray on ground
-							CosIncAngRayToSky = SPhi;
-							// Azimuth loop
-							for ( ITheta = 1; ITheta <= 2 * AzimAngStepsForSolReflCalc; ++ITheta ) {
-								Theta = ( ITheta - 0.5 ) * DTheta;
-								URay.x = CPhi * std::cos( Theta );
-								URay.y = CPhi * std::sin( Theta );
-								// Does this ray hit an obstruction?
-								IHitObs = 0;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
-									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
-									// Horizontal roof surfaces cannot be obstructions for rays from ground
-									if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
-									if ( ! Surface( ObsSurfNum ).ShadowingSurf ) {
-										if ( dot( URay, Surface( ObsSurfNum ).OutNormVec ) >= 0.0 ) continue;
-										// Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
-										// case where ground hit point is in back of ObsSurfNum
-										if ( Surface( ObsSurfNum ).Tilt > 89.0 && Surface( ObsSurfNum ).Tilt < 91.0 ) {
-											Surface( ObsSurfNum ).Vertex( 2 ).assign_to( SurfVert );
-											SurfVertToGndPt = HitPtRefl - SurfVert;
-											if ( dot( SurfVertToGndPt, Surface( ObsSurfNum ).OutNormVec ) < 0.0 ) continue;
-										}
+						SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSkyHRTS( 1, 1, HitPtSurfNumX ) * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
+					}
+					dReflSkySol = SkyReflSolRadiance * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
+					ReflSkySolObs( RecPtNum ) += dReflSkySol;
+				} else {
+					// Ray hits ground;
+					// Find radiance at hit point due to reflection of sky diffuse reaching
+					// ground directly, i.e., without reflecting from obstructions.
+					// Send rays upward from hit point and see which ones are unobstructed and so go to sky.
+					// Divide hemisphere centered at ground hit point into elements of altitude Phi and
+					// azimuth Theta and create upward-going ray unit vector at each Phi,Theta pair.
+					// Phi = 0 at the horizon; Phi = Pi/2 at the zenith.
+					DPhi = PiOvr2 / ( AltAngStepsForSolReflCalc / 2.0 );
+					dReflSkyGnd = 0.0;
+					// Altitude loop
+					for ( IPhi = 1; IPhi <= ( AltAngStepsForSolReflCalc / 2 ); ++IPhi ) {
+						Phi = ( IPhi - 0.5 ) * DPhi;
+						SPhi = std::sin( Phi );
+						CPhi = std::cos( Phi );
+						// Third component of ray unit vector in (Theta,Phi) direction
+						URay( 3 ) = SPhi;
+						DTheta = 2.0 * Pi / ( 2.0 * AzimAngStepsForSolReflCalc );
+						dOmega = CPhi * DTheta * DPhi;
+						// Cosine of angle of incidence of ray on ground
+						CosIncAngRayToSky = SPhi;
+						// Azimuth loop
+						for ( ITheta = 1; ITheta <= 2 * AzimAngStepsForSolReflCalc; ++ITheta ) {
+							Theta = ( ITheta - 0.5 ) * DTheta;
+							URay.x = CPhi * std::cos( Theta );
+							URay.y = CPhi * std::sin( Theta );
+							// Does this ray hit an obstruction?
+							IHitObs = 0;
+							SurfaceBVH::RayCandidates( SurfaceBVH::AllSurfaces, HitPtRefl.x, HitPtRefl.y, HitPtRefl.z, URay.x, URay.y, URay.z, std::numeric_limits< Real64 >::max(), Candidates );
+							for ( int const Cand : Candidates ) {
+								ObsSurfNum = Cand;
+								if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
+								// Horizontal roof surfaces cannot be obstructions for rays from ground
+								if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
+								if ( ! Surface( ObsSurfNum ).ShadowingSurf ) {
+									if ( dot( URay, Surface( ObsSurfNum ).OutNormVec ) >= 0.0 ) continue;
+									// Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
+									// case where ground hit point is in back of ObsSurfNum
+									if ( Surface( ObsSurfNum ).Tilt > 89.0 && Surface( ObsSurfNum ).Tilt < 91.0 ) {
+										Surface( ObsSurfNum ).Vertex( 2 ).assign_to( SurfVert );
+										SurfVertToGndPt = HitPtRefl - SurfVert;
+										if ( dot( SurfVertToGndPt, Surface( ObsSurfNum ).OutNormVec ) < 0.0 ) continue;
 									}
-									PierceSurface( ObsSurfNum, HitPtRefl, URay, IHitObs, HitPtObs );
-									if ( IHitObs > 0 ) break;
 								}
+								PierceSurface( ObsSurfNum, HitPtRefl, URay, IHitObs, HitPtObs );
+								if ( IHitObs > 0 ) break;
+							}
 
-								if ( IHitObs > 0 ) continue; // Obstruction hit
-								// Sky is hit
-								dReflSkyGnd += CosIncAngRayToSky * dOmega / Pi;
-							} // End of azimuth loop
-						} // End of altitude loop
-						ReflSkySolGnd( RecPtNum ) += dReflSkyGnd * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
-					} // End of check if ray from receiving point hits obstruction or ground
-				} // End of loop over rays from receiving point
-			} // End of loop over receiving points
-
-			// Average over receiving points
-			ReflFacSkySolObs( SurfNum ) = 0.0;
-			ReflFacSkySolGnd( SurfNum ) = 0.0;
-			NumRecPts = SolReflRecSurf( RecSurfNum ).NumRecPts;
-			for ( RecPtNum = 1; RecPtNum <= NumRecPts; ++RecPtNum ) {
-				ReflFacSkySolObs( SurfNum ) += ReflSkySolObs( RecPtNum );
-				ReflFacSkySolGnd( SurfNum ) += ReflSkySolGnd( RecPtNum );
-			}
-			ReflFacSkySolObs( SurfNum ) /= NumRecPts;
-			ReflFacSkySolGnd( SurfNum ) /= NumRecPts;
-			// Do not allow ReflFacBmToDiffSolGnd to exceed the surface's unobstructed ground view factor
-			ReflFacSkySolGnd( SurfNum ) = min( 0.5 * ( 1.0 - Surface( SurfNum ).CosTilt ), ReflFacSkySolGnd( SurfNum ) );
-			// Note: the above factors are dimensionless; they are equal to
-			// (W/m2 reflected solar incident on SurfNum)/(W/m2 unobstructed horizontal sky diffuse irradiance)
-		} // End of loop over receiving surfaces
+							if ( IHitObs > 0 ) continue; // Obstruction hit
+							// Sky is hit
+							dReflSkyGnd += CosIncAngRayToSky * dOmega / Pi;
+						} // End of azimuth loop
+					} // End of altitude loop
+					ReflSkySolGnd( RecPtNum ) += dReflSkyGnd * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
+				} // End of check if ray from receiving point hits obstruction or ground
+			} // End of loop over rays from receiving point
+		} // End of loop over receiving points
+
+		// Average over receiving points
+		ReflFacSkySolObs( SurfNum ) = 0.0;
+		ReflFacSkySolGnd( SurfNum ) = 0.0;
+		NumRecPts = SolReflRecSurf( RecSurfNum ).NumRecPts;
+		for ( RecPtNum = 1; RecPtNum <= NumRecPts; ++RecPtNum ) {
+			ReflFacSkySolObs( SurfNum ) += ReflSkySolObs( RecPtNum );
+			ReflFacSkySolGnd( SurfNum ) += ReflSkySolGnd( RecPtNum );
+		}
+		ReflFacSkySolObs( SurfNum ) /= NumRecPts;
+		ReflFacSkySolGnd( SurfNum ) /= NumRecPts;
+		// Do not allow ReflFacBmToDiffSolGnd to exceed the surface's unobstructed ground view factor
+		ReflFacSkySolGnd( SurfNum ) = min( 0.5 * ( 1.0 - Surface( SurfNum ).CosTilt ), ReflFacSkySolGnd( SurfNum ) );
+		// Note: the above factors are dimensionless; they are equal to
+		// (W/m2 reflected solar incident on SurfNum)/(W/m2 unobstructed horizontal sky diffuse irradiance)
+
+	}
+
+	std::tuple< int, int, int >
+	ReflCacheKey(
+		int const iHour, // Hour of the sun direction, 0 for factors independent of the sun
+		int const KeyOffset // Added to the last key component to keep the kinds of factors apart
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the sunlit fraction cache key of the solar reflection factors of an hour.
+
+		// METHODOLOGY EMPLOYED:
+		// The hourly sun direction cosines are quantized as in SolarShading::ShadowCacheKey.  The
+		// reflection factors use the sunlit fractions of the first time step of the hour, which
+		// follow from that direction for a given location and number of time steps per hour.
+
+		// Using/Aliasing
+		using SolarShading::ShadowCacheSunQuantum;
+
+		if ( iHour == 0 ) return std::make_tuple( 0, 0, KeyOffset );
+		return std::make_tuple( int( std::lround( SUNCOSHR( iHour, 1 ) / ShadowCacheSunQuantum ) ), int( std::lround( SUNCOSHR( iHour, 2 ) / ShadowCacheSunQuantum ) ), int( std::lround( SUNCOSHR( iHour, 3 ) / ShadowCacheSunQuantum ) ) + KeyOffset );
 
 	}
 
@@ -1329,9 +1479,9 @@ namespace SolarReflectionManager {
 		//unused  REAL(r64) :: DOTAXCSN                 ! Dot product of vectors AXC and SN
 
 		// Vertex vectors
-		static Array1D< Vector3< Real64 > > V( MaxVerticesPerSurface ); // Vertices of surfaces
-		static Array1D< Vector3< Real64 > > A( MaxVerticesPerSurface ); // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
-		static Array1D< Vector3< Real64 > > C( MaxVerticesPerSurface ); // Vectors from vertices to intersection point
+		static EP_THREAD_LOCAL Array1D< Vector3< Real64 > > V( MaxVerticesPerSurface ); // Vertices of surfaces
+		static EP_THREAD_LOCAL Array1D< Vector3< Real64 > > A( MaxVerticesPerSurface ); // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
+		static EP_THREAD_LOCAL Array1D< Vector3< Real64 > > C( MaxVerticesPerSurface ); // Vectors from vertices to intersection point
 
 		// FLOW:
 		IPIERC = 0;
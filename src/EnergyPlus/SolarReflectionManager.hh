@@ -1,6 +1,9 @@
 #ifndef SolarReflectionManager_hh_INCLUDED
 #define SolarReflectionManager_hh_INCLUDED
 
+// C++ Headers
+#include <tuple>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -128,6 +131,12 @@ namespace SolarReflectionManager {
 	void
 	FigureBeamSolDiffuseReflFactors( int const iHour );
 
+	void
+	FigureBeamSolDiffuseReflRecSurf(
+		int const iHour, // Hour of the sun direction
+		int const RecSurfNum // Receiving surface number
+	);
+
 	//=================================================================================================
 
 	void
@@ -136,11 +145,26 @@ namespace SolarReflectionManager {
 	void
 	FigureBeamSolSpecularReflFactors( int const iHour );
 
+	void
+	FigureBeamSolSpecularReflRecSurf(
+		int const iHour, // Hour of the sun direction
+		int const RecSurfNum // Receiving surface number
+	);
+
 	//=================================================================================================
 
 	void
 	CalcSkySolDiffuseReflFactors();
 
+	void
+	FigureSkySolDiffuseReflRecSurf( int const RecSurfNum ); // Receiving surface number
+
+	std::tuple< int, int, int >
+	ReflCacheKey(
+		int const iHour, // Hour of the sun direction, 0 for factors independent of the sun
+		int const KeyOffset // Added to the last key component to keep the kinds of factors apart
+	);
+
 	//=================================================================================================
 
 	void
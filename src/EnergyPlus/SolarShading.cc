@@ -1,6 +1,10 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -38,6 +42,7 @@
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <Profiler.hh>
 #include <ScheduleManager.hh>
 #include <SolarReflectionManager.hh>
 #include <UtilityRoutines.hh>
@@ -118,6 +123,14 @@ namespace SolarShading {
 	int const TooManyFigures( 6 );
 	Array1D_string const cOverLapStatus( 6, { "No-Overlap", "1st-Surf-within-2nd", "2nd-Surf-within-1st", "Partial-Overlap", "Too-Many-Vertices", "Too-Many-Figures" } );
 
+	// Sunlit fraction cache
+	Real64 const ShadowCacheSunQuantum( 1.0e-6 ); // Resolution of the quantized sun direction cosines of a cache key
+	int const ShadowCacheSkyPatchKey( 3000000 ); // Added to the last key component of the sky patch records
+	int const ShadowCacheBmToDiffReflKey( 6000000 ); // Added to the last key component of the beam-to-diffuse reflection records
+	int const ShadowCacheBmToBmReflKey( 9000000 ); // Added to the last key component of the beam-to-beam reflection records
+	int const ShadowCacheSkyReflKey( 12000000 ); // Last key component of the sky diffuse reflection record
+	static std::string const ShadowCacheMagic( "EPSHDC02" ); // File signature and format version of the cache file
+
 	// DERIVED TYPE DEFINITIONS:
 	// INTERFACE BLOCK SPECIFICATIONS:
 	// na
@@ -127,71 +140,71 @@ namespace SolarShading {
 	// (needs to be based on maxnumvertices)
 	int MaxHCS( 15000 ); // 200      ! Maximum number of HC surfaces (was 56)
 	// Following are initially set in AllocateModuleArrays
-	int MAXHCArrayBounds( 0 ); // Bounds based on Max Number of Vertices in surfaces
+	EP_THREAD_LOCAL int MAXHCArrayBounds( 0 ); // Bounds based on Max Number of Vertices in surfaces
 	int MAXHCArrayIncrement( 0 ); // Increment based on Max Number of Vertices in surfaces
 	// The following variable should be re-engineered to lower in module hierarchy but need more analysis
-	int NVS; // Number of vertices of the shadow/clipped surface
-	int NumVertInShadowOrClippedSurface;
-	int CurrentSurfaceBeingShadowed;
-	int CurrentShadowingSurface;
-	int OverlapStatus; // Results of overlap calculation:
+	EP_THREAD_LOCAL int NVS; // Number of vertices of the shadow/clipped surface
+	EP_THREAD_LOCAL int NumVertInShadowOrClippedSurface;
+	EP_THREAD_LOCAL int CurrentSurfaceBeingShadowed;
+	EP_THREAD_LOCAL int CurrentShadowingSurface;
+	EP_THREAD_LOCAL int OverlapStatus; // Results of overlap calculation:
 	// 1=No overlap; 2=NS1 completely within NS2
 	// 3=NS2 completely within NS1; 4=Partial overlap
 
-	Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
-	int FBKSHC; // HC location of first back surface
-	int FGSSHC; // HC location of first general shadowing surface
-	int FINSHC; // HC location of first back surface overlap
-	int FRVLHC; // HC location of first reveal surface
-	int FSBSHC; // HC location of first subsurface
-	int LOCHCA( 0 ); // Location of highest data in the HC arrays
-	int NBKSHC; // Number of back surfaces in the HC arrays
-	int NGSSHC; // Number of general shadowing surfaces in the HC arrays
-	int NINSHC; // Number of back surface overlaps in the HC arrays
-	int NRVLHC; // Number of reveal surfaces in HC array
-	int NSBSHC; // Number of subsurfaces in the HC arrays
+	EP_THREAD_LOCAL Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
+	EP_THREAD_LOCAL int FBKSHC; // HC location of first back surface
+	EP_THREAD_LOCAL int FGSSHC; // HC location of first general shadowing surface
+	EP_THREAD_LOCAL int FINSHC; // HC location of first back surface overlap
+	EP_THREAD_LOCAL int FRVLHC; // HC location of first reveal surface
+	EP_THREAD_LOCAL int FSBSHC; // HC location of first subsurface
+	EP_THREAD_LOCAL int LOCHCA( 0 ); // Location of highest data in the HC arrays
+	EP_THREAD_LOCAL int NBKSHC; // Number of back surfaces in the HC arrays
+	EP_THREAD_LOCAL int NGSSHC; // Number of general shadowing surfaces in the HC arrays
+	EP_THREAD_LOCAL int NINSHC; // Number of back surface overlaps in the HC arrays
+	EP_THREAD_LOCAL int NRVLHC; // Number of reveal surfaces in HC array
+	EP_THREAD_LOCAL int NSBSHC; // Number of subsurfaces in the HC arrays
 	bool CalcSkyDifShading; // True when sky diffuse solar shading is
 	int ShadowingCalcFrequency( 0 ); // Frequency for Shadowing Calculations
 	int ShadowingDaysLeft( 0 ); // Days left in current shadowing period
 	bool debugging( false );
 	std::ofstream shd_stream; // Shading file stream
-	Array1D_int HCNS; // Surface number of back surface HC figures
-	Array1D_int HCNV; // Number of vertices of each HC figure
-	Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
-	Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
-	Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
-	Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
-	Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
+	EP_THREAD_LOCAL Array1D_int HCNS; // Surface number of back surface HC figures
+	EP_THREAD_LOCAL Array1D_int HCNV; // Number of vertices of each HC figure
+	EP_THREAD_LOCAL Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
+	EP_THREAD_LOCAL Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
+	EP_THREAD_LOCAL Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
+	EP_THREAD_LOCAL Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
+	EP_THREAD_LOCAL Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
 	Array3D_int WindowRevealStatus;
-	Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+	EP_THREAD_LOCAL Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
 	// - Positive, Shadow - Negative, Overlap between two shadows
 	// - positive, etc., so that sum of HC areas=base sunlit area
-	Array1D< Real64 > HCT; // Transmittance of each HC figure
+	EP_THREAD_LOCAL Array1D< Real64 > HCT; // Transmittance of each HC figure
 	Array1D< Real64 > ISABSF; // For simple interior solar distribution (in which all beam
 	// radiation entering zone is assumed to strike the floor),
 	// fraction of beam radiation absorbed by each floor surface
-	Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
+	EP_THREAD_LOCAL Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
 	// Excludes multiplier for windows
 	// Shadowing combinations data structure...See ShadowingCombinations type
 	int NumTooManyFigures( 0 );
 	int NumTooManyVertices( 0 );
 	int NumBaseSubSurround( 0 );
-	Array1D< Real64 > SUNCOS( 3 ); // Direction cosines of solar position
-	Real64 XShadowProjection; // X projection of a shadow (formerly called C)
-	Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
-	Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
-	Array1D< Real64 > XVC; // X-vertices of the clipped figure
-	Array1D< Real64 > XVS; // X-vertices of the shadow
-	Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
-	Array1D< Real64 > YVC; // Y-vertices of the clipped figure
-	Array1D< Real64 > YVS; // Y-vertices of the shadow
-	Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
+	EP_THREAD_LOCAL Array1D< Real64 > SUNCOS( 3 ); // Direction cosines of solar position
+	EP_THREAD_LOCAL Real64 XShadowProjection; // X projection of a shadow (formerly called C)
+	EP_THREAD_LOCAL Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
+	EP_THREAD_LOCAL Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
+	EP_THREAD_LOCAL Array1D< Real64 > XVC; // X-vertices of the clipped figure
+	EP_THREAD_LOCAL Array1D< Real64 > XVS; // X-vertices of the shadow
+	EP_THREAD_LOCAL Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
+	EP_THREAD_LOCAL Array1D< Real64 > YVC; // Y-vertices of the clipped figure
+	EP_THREAD_LOCAL Array1D< Real64 > YVS; // Y-vertices of the shadow
+	EP_THREAD_LOCAL Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	EP_THREAD_LOCAL Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
+	EP_THREAD_LOCAL Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
+	EP_THREAD_LOCAL Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
+	EP_THREAD_LOCAL Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+	EP_THREAD_LOCAL Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	int maxNumberOfFigures( 0 );
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
@@ -200,6 +213,10 @@ namespace SolarShading {
 	Array1D< SurfaceErrorTracking > TrackTooManyFigures;
 	Array1D< SurfaceErrorTracking > TrackTooManyVertices;
 	Array1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	ShadowCacheData ShadowCache;
+	std::vector< ShadowCasterBVHNode > ShadowCasterBVH; // Node 0 is the root
+	std::vector< int > ShadowCasterBVHSurfs; // Casting surfaces ordered by BVH leaf
+	AnisoSkySurfaceData AnisoSkySurfaces;
 
 	static gio::Fmt fmtLD( "*" );
 
@@ -284,6 +301,12 @@ namespace SolarShading {
 				InitSolReflRecSurf();
 			}
 
+			// After the solar reflection setup, whose hit points are part of the geometry hash
+			if ( ! DataSystemVariables::ShadowCacheFileName.empty() && ! ShadowCache.Active ) {
+				if ( firstTime ) DisplayString( "Initializing Sunlit Fraction Cache" );
+				InitShadowCache( DataSystemVariables::ShadowCacheFileName );
+			}
+
 			if ( firstTime ) DisplayString( "Proceeding with Initializing Solar Calculations" );
 
 		}
@@ -640,6 +663,7 @@ namespace SolarShading {
 		MultIsoSky.dimension( TotSurfaces, 0.0 );
 		MultCircumSolar.dimension( TotSurfaces, 0.0 );
 		MultHorizonZenith.dimension( TotSurfaces, 0.0 );
+		InitAnisoSkySurfaces();
 		WinTransSolar.dimension( TotSurfaces, 0.0 );
 		WinBmSolar.dimension( TotSurfaces, 0.0 );
 		WinBmBmSolar.dimension( TotSurfaces, 0.0 );
@@ -1108,6 +1132,36 @@ namespace SolarShading {
 
 	}
 
+	void
+	InitAnisoSkySurfaces()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gathers the exterior solar surfaces and the geometry used by AnisoSkyViewFactors.
+
+		// METHODOLOGY EMPLOYED:
+		// The surface geometry does not change during the simulation, so it is copied once out of
+		// the Surface records into the contiguous arrays of AnisoSkySurfaces.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum; // Surface number
+
+		// FLOW:
+		AnisoSkySurfaces = AnisoSkySurfaceData();
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ! Surface( SurfNum ).ExtSolar ) continue;
+			AnisoSkySurfaces.SurfNum.push_back( SurfNum );
+			AnisoSkySurfaces.OutNormX.push_back( Surface( SurfNum ).OutNormVec( 1 ) );
+			AnisoSkySurfaces.OutNormY.push_back( Surface( SurfNum ).OutNormVec( 2 ) );
+			AnisoSkySurfaces.OutNormZ.push_back( Surface( SurfNum ).OutNormVec( 3 ) );
+			AnisoSkySurfaces.ViewFactorSky.push_back( Surface( SurfNum ).ViewFactorSky );
+			AnisoSkySurfaces.SinTilt.push_back( Surface( SurfNum ).SinTilt );
+			AnisoSkySurfaces.NearHorizontal.push_back( Surface( SurfNum ).Tilt < 2.0 ? 1 : 0 );
+		}
+		AnisoSkySurfaces.CircumSolarFac.assign( AnisoSkySurfaces.SurfNum.size(), 0.0 );
+
+	}
+
 	void
 	AnisoSkyViewFactors()
 	{
@@ -1178,15 +1232,15 @@ namespace SolarShading {
 		Real64 Epsilon; // Sky clearness parameter
 		Real64 Delta; // Sky brightness parameter
 		Real64 CosIncAngBeamOnSurface; // Cosine of incidence angle of beam solar on surface
-		Real64 IncAng; // Incidence angle of beam solar on surface (radians)
 		int SurfNum; // Surface number
 		int EpsilonBin; // Sky clearness (Epsilon) bin index
 		Real64 AirMass; // Relative air mass
 		Real64 AirMassH; // Intermediate variable for relative air mass calculation
 		Real64 CircumSolarFac; // Ratio of cosine of incidence angle to cosine of zenith angle
 		Real64 KappaZ3; // Intermediate variable
-		Real64 ViewFactorSkyGeom; // Geometrical sky view factor
 		Real64 const cosine_tolerance( 0.0001 );
+		int const NumSurfs( AnisoSkySurfaces.SurfNum.size() ); // Number of exterior solar surfaces
+		bool OutOfRange( false ); // True if a cosine of incidence angle is beyond round-off of [-1, +1]
 
 		// FLOW:
 #ifdef EP_Count_Calls
@@ -1217,46 +1271,59 @@ namespace SolarShading {
 		F1 = max( 0.0, F11R( EpsilonBin ) + F12R( EpsilonBin ) * Delta + F13R( EpsilonBin ) * ZenithAng );
 		F2 = F21R( EpsilonBin ) + F22R( EpsilonBin ) * Delta + F23R( EpsilonBin ) * ZenithAng;
 
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-			if ( ! Surface( SurfNum ).ExtSolar ) continue;
-
-			CosIncAngBeamOnSurface = SOLCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SOLCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SOLCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
+		// The geometry part only reads the contiguous arrays, so this loop can be vectorized
+		Real64 const SunCosX( SOLCOS( 1 ) );
+		Real64 const SunCosY( SOLCOS( 2 ) );
+		Real64 const SunCosZ( SOLCOS( 3 ) );
+		//           0.0871557 below corresponds to a zenith angle of 85 deg
+		Real64 const CircumSolarDenom( max( 0.0871557, CosZenithAng ) );
+		int const LowSun( CosZenithAng < 0.0871557 ? 1 : 0 );
+		Real64 const * const OutNormX( AnisoSkySurfaces.OutNormX.data() );
+		Real64 const * const OutNormY( AnisoSkySurfaces.OutNormY.data() );
+		Real64 const * const OutNormZ( AnisoSkySurfaces.OutNormZ.data() );
+		int const * const NearHorizontal( AnisoSkySurfaces.NearHorizontal.data() );
+		Real64 * const CircumSolarFacs( AnisoSkySurfaces.CircumSolarFac.data() );
+		for ( int i = 0; i < NumSurfs; ++i ) {
+			CosIncAngBeamOnSurface = SunCosX * OutNormX[ i ] + SunCosY * OutNormY[ i ] + SunCosZ * OutNormZ[ i ];
+			// The calcs should always be within -1,+1; it's just round-off that we need to trap for
+			OutOfRange |= ( CosIncAngBeamOnSurface > ( 1.0 + cosine_tolerance ) ) | ( CosIncAngBeamOnSurface < ( -1.0 - cosine_tolerance ) );
+			CosIncAngBeamOnSurface = min( 1.0, max( -1.0, CosIncAngBeamOnSurface ) );
+			CircumSolarFac = max( 0.0, CosIncAngBeamOnSurface ) / CircumSolarDenom;
+			//           For near-horizontal roofs, model has an inconsistency that gives sky diffuse
+			//           irradiance significantly different from DifSolarRad when zenith angle is
+			//           above 85 deg. The following forces irradiance to be very close to DifSolarRad
+			//           in this case.
+			CircumSolarFacs[ i ] = ( CircumSolarFac > 0.0 && ( LowSun & NearHorizontal[ i ] ) ) ? 1.0 : CircumSolarFac;
+		}
 
-			// So I believe this should only be a diagnostic error...the calcs should always be within -1,+1; it's just round-off that we need to trap for
-			if ( CosIncAngBeamOnSurface > 1.0 ) {
+		// So I believe this should only be a diagnostic error...
+		if ( OutOfRange ) {
+			for ( int i = 0; i < NumSurfs; ++i ) {
+				SurfNum = AnisoSkySurfaces.SurfNum[ i ];
+				CosIncAngBeamOnSurface = SunCosX * OutNormX[ i ] + SunCosY * OutNormY[ i ] + SunCosZ * OutNormZ[ i ];
 				if ( CosIncAngBeamOnSurface > ( 1.0 + cosine_tolerance ) ) {
 					ShowSevereError( "Cosine of incident angle of beam solar on surface out of range...too high" );
 					ShowContinueError("This is a diagnostic error that should not be encountered under normal circumstances");
 					ShowContinueError( "Occurs on surface: " + Surface ( SurfNum ).Name );
 					ShowContinueError( "Current value = " + TrimSigDigits( CosIncAngBeamOnSurface ) + " ... should be within [-1, +1]" );
 					ShowFatalError( "Anisotropic solar calculation causes fatal error" );
-				}
-				CosIncAngBeamOnSurface = 1.0;
-			} else if ( CosIncAngBeamOnSurface < -1.0 ) {
-				if ( CosIncAngBeamOnSurface < ( -1.0 - cosine_tolerance ) ) {
+				} else if ( CosIncAngBeamOnSurface < ( -1.0 - cosine_tolerance ) ) {
 					ShowSevereError( "Cosine of incident angle of beam solar on surface out of range...too low" );
 					ShowContinueError("This is a diagnostic error that should not be encountered under normal circumstances");
 					ShowContinueError( "Occurs on surface: " + Surface ( SurfNum ).Name );
 					ShowContinueError( "Current value = " + TrimSigDigits( CosIncAngBeamOnSurface ) + " ... should be within [-1, +1]" );
 					ShowFatalError( "Anisotropic solar calculation causes fatal error" );
 				}
-				CosIncAngBeamOnSurface = -1.0;
 			}
+		}
 
-			IncAng = std::acos( CosIncAngBeamOnSurface );
-
-			ViewFactorSkyGeom = Surface( SurfNum ).ViewFactorSky;
-			MultIsoSky( SurfNum ) = ViewFactorSkyGeom * ( 1.0 - F1 );
-			//           0.0871557 below corresponds to a zenith angle of 85 deg
-			CircumSolarFac = max( 0.0, CosIncAngBeamOnSurface ) / max( 0.0871557, CosZenithAng );
-			//           For near-horizontal roofs, model has an inconsistency that gives sky diffuse
-			//           irradiance significantly different from DifSolarRad when zenith angle is
-			//           above 85 deg. The following forces irradiance to be very close to DifSolarRad
-			//           in this case.
-			if ( CircumSolarFac > 0.0 && CosZenithAng < 0.0871557 && Surface( SurfNum ).Tilt < 2.0 ) CircumSolarFac = 1.0;
-			MultCircumSolar( SurfNum ) = F1 * CircumSolarFac;
-			MultHorizonZenith( SurfNum ) = F2 * Surface( SurfNum ).SinTilt;
-			if ( ! DetailedSkyDiffuseAlgorithm || ! ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing ) {
+		bool const HourlyShdgRatios( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing );
+		for ( int i = 0; i < NumSurfs; ++i ) {
+			SurfNum = AnisoSkySurfaces.SurfNum[ i ];
+			MultIsoSky( SurfNum ) = AnisoSkySurfaces.ViewFactorSky[ i ] * ( 1.0 - F1 );
+			MultCircumSolar( SurfNum ) = F1 * CircumSolarFacs[ i ];
+			MultHorizonZenith( SurfNum ) = F2 * AnisoSkySurfaces.SinTilt[ i ];
+			if ( ! HourlyShdgRatios ) {
 				AnisoSkyMult( SurfNum ) = MultIsoSky( SurfNum ) * DifShdgRatioIsoSky( SurfNum ) + MultCircumSolar( SurfNum ) * SunlitFrac( TimeStep, HourOfDay, SurfNum ) + MultHorizonZenith( SurfNum ) * DifShdgRatioHoriz( SurfNum );
 			} else {
 				AnisoSkyMult( SurfNum ) = MultIsoSky( SurfNum ) * DifShdgRatioIsoSkyHRTS( TimeStep, HourOfDay, SurfNum ) + MultCircumSolar( SurfNum ) * SunlitFrac( TimeStep, HourOfDay, SurfNum ) + MultHorizonZenith( SurfNum ) * DifShdgRatioHorizHRTS( TimeStep, HourOfDay, SurfNum );
@@ -2925,7 +2992,12 @@ namespace SolarShading {
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
 
-		maxNumberOfFigures = max( maxNumberOfFigures, NRFIGS );
+		if ( NRFIGS > maxNumberOfFigures ) {
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (SolarShadingStatistics)
+#endif
+			maxNumberOfFigures = max( maxNumberOfFigures, NRFIGS );
+		}
 
 		NS2 = NNN;
 		for ( I = 1; I <= NRFIGS; ++I ) {
@@ -2988,7 +3060,7 @@ namespace SolarShading {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
+		static EP_THREAD_LOCAL Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
 		Real64 DELTAX; // Difference between X coordinates of two vertices
 		Real64 DELTAY; // Difference between Y coordinates of two vertices
 		Real64 SAVES; // Temporary location for exchange of variables
@@ -3002,7 +3074,7 @@ namespace SolarShading {
 		int M; // Number of slopes to be sorted
 		int N; // Vertex number
 		int P; // Location of first slope to be sorted
-		static bool FirstTimeFlag( true );
+		static EP_THREAD_LOCAL bool FirstTimeFlag( true );
 
 		if ( FirstTimeFlag ) {
 			SLOPE.allocate( max( 10, MaxVerticesPerSurface + 1 ) );
@@ -3161,15 +3233,20 @@ namespace SolarShading {
 
 			OverlapStatus = TooManyFigures;
 
-			if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
-				ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
-				TooManyFiguresMessage = true;
-			}
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (SolarShadingErrors)
+#endif
+			{ // Worker threads of CalcPerSolarBeam share the error tracking
+				if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
+					ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
+					TooManyFiguresMessage = true;
+				}
 
-			if ( DisplayExtraWarnings ) {
-				TrackTooManyFigures.redimension( ++NumTooManyFigures );
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				if ( DisplayExtraWarnings ) {
+					TrackTooManyFigures.redimension( ++NumTooManyFigures );
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				}
 			}
 
 			return;
@@ -3249,30 +3326,40 @@ namespace SolarShading {
 
 			OverlapStatus = TooManyVertices;
 
-			if ( ! TooManyVerticesMessage && ! DisplayExtraWarnings ) {
-				ShowWarningError( "DeterminePolygonOverlap: Too many vertices [>" + RoundSigDigits( MaxHCV ) + "] detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
-				TooManyVerticesMessage = true;
-			}
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (SolarShadingErrors)
+#endif
+			{
+				if ( ! TooManyVerticesMessage && ! DisplayExtraWarnings ) {
+					ShowWarningError( "DeterminePolygonOverlap: Too many vertices [>" + RoundSigDigits( MaxHCV ) + "] detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
+					TooManyVerticesMessage = true;
+				}
 
-			if ( DisplayExtraWarnings ) {
-				TrackTooManyVertices.redimension( ++NumTooManyVertices );
-				TrackTooManyVertices( NumTooManyVertices ).SurfIndex1 = CurrentShadowingSurface;
-				TrackTooManyVertices( NumTooManyVertices ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				if ( DisplayExtraWarnings ) {
+					TrackTooManyVertices.redimension( ++NumTooManyVertices );
+					TrackTooManyVertices( NumTooManyVertices ).SurfIndex1 = CurrentShadowingSurface;
+					TrackTooManyVertices( NumTooManyVertices ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				}
 			}
 
 		} else if ( NS3 > MaxHCS ) {
 
 			OverlapStatus = TooManyFigures;
 
-			if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
-				ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
-				TooManyFiguresMessage = true;
-			}
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (SolarShadingErrors)
+#endif
+			{
+				if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
+					ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
+					TooManyFiguresMessage = true;
+				}
 
-			if ( DisplayExtraWarnings ) {
-				TrackTooManyFigures.redimension( ++NumTooManyFigures );
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				if ( DisplayExtraWarnings ) {
+					TrackTooManyFigures.redimension( ++NumTooManyFigures );
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				}
 			}
 
 		}
@@ -3308,6 +3395,8 @@ namespace SolarShading {
 		using WindowComplexManager::UpdateComplexWindows;
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataSystemVariables::NumberShadowThreads;
+		using DataSystemVariables::ParallelLoopThreads;
 		using DataGlobals::TimeStepZone;
 		using DataGlobals::HourOfDay;
 		using DataGlobals::TimeStep;
@@ -3325,9 +3414,11 @@ namespace SolarShading {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int iHour; // Hour index number
-		int TS; // TimeStep Loop Counter
 		static bool Once( true );
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "CalcPerSolarBeam" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		if ( Once ) InitComplexWindows();
 		Once = false;
 
@@ -3368,7 +3459,7 @@ namespace SolarShading {
 
 		if ( ! DetailedSolarTimestepIntegration ) {
 			for ( iHour = 1; iHour <= 24; ++iHour ) { // Do for all hours
-				for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+				for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
 					FigureSunCosines( iHour, TS, AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin );
 				}
 			}
@@ -3378,8 +3469,15 @@ namespace SolarShading {
 		// Initialize/update the Complex Fenestration geometry and optical properties
 		UpdateComplexWindows();
 		if ( ! DetailedSolarTimestepIntegration ) {
+			// The hours are independent except for the detailed sky diffuse shading, which carries its
+			// isotropic/horizon factors over from one sun position to the next
+			int const nShadowThreads( ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) ? 1 : ParallelLoopThreads( NumberShadowThreads, 24 ) );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nShadowThreads) if(nShadowThreads > 1)
+#endif
 			for ( iHour = 1; iHour <= 24; ++iHour ) { // Do for all hours.
-				for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+				if ( nShadowThreads > 1 ) AllocateShadowingThreadArrays();
+				for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
 					FigureSolarBeamAtTimestep( iHour, TS );
 				} // TimeStep Loop
 			} // Hour Loop
@@ -3389,6 +3487,47 @@ namespace SolarShading {
 
 	}
 
+	void
+	AllocateShadowingThreadArrays()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Dimensions the thread local shadowing work arrays of an OpenMP worker thread the way
+		// AllocateModuleArrays and DetermineShadowingCombinations dimension them for the main
+		// thread.  Arrays already dimensioned (the main thread, or a worker that has been here
+		// before) are left alone.
+
+		if ( ( SAREA.isize() == TotSurfaces ) && ( HCAREA.isize() == 2 * MaxHCS ) ) return;
+
+		CTHETA.dimension( TotSurfaces, 0.0 );
+		SAREA.dimension( TotSurfaces, 0.0 );
+
+		MAXHCArrayBounds = 2 * ( MaxVerticesPerSurface + 1 );
+		XTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		YTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		XVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		XVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		YVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		YVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		ZVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		ATEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		BTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		CTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		XTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		YTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+
+		HCA.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCB.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCC.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCX.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCY.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCAREA.dimension( 2 * MaxHCS, 0.0 );
+		HCNS.dimension( 2 * MaxHCS, 0 );
+		HCNV.dimension( 2 * MaxHCS, 0 );
+		HCT.dimension( 2 * MaxHCS, 0.0 );
+
+	}
+
 	void
 	FigureSunCosines(
 		int const iHour,
@@ -3520,7 +3659,22 @@ namespace SolarShading {
 			CosIncAng( iTimeStep, iHour, SurfNum ) = CTHETA( SurfNum );
 		}
 
-		SHADOW( iHour, iTimeStep ); // Determine sunlit areas and solar multipliers for all surfaces.
+		bool FromCache( false ); // True if the SHADOW results were restored from the cache file
+		if ( ShadowCache.Active ) {
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (ShadowCacheFile)
+#endif
+			FromCache = RestoreShadowFromCache( iHour, iTimeStep );
+		}
+		if ( ! FromCache ) {
+			SHADOW( iHour, iTimeStep ); // Determine sunlit areas and solar multipliers for all surfaces.
+			if ( ShadowCache.Active ) {
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (ShadowCacheFile)
+#endif
+				SaveShadowToCache( iHour, iTimeStep );
+			}
+		}
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( Surface( SurfNum ).Area >= 1.e-10 ) {
@@ -3604,6 +3758,534 @@ namespace SolarShading {
 
 	}
 
+	std::uint64_t
+	ShadowGeometryHash()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns a hash of everything the SHADOW results depend on other than the sun direction:
+		// surface vertices and areas, reveals, glazed fractions, the shadowing combinations and
+		// the shadowing options.  With solar reflection the inputs of the reflection factors are
+		// included too: the hit point reflectances, the specular reflection of windows and glazed
+		// shading surfaces, and the frame and divider shadowing of the sunlit fractions they use.
+
+		// METHODOLOGY EMPLOYED:
+		// The inputs are collected into one buffer (integers are exact as reals) and hashed with
+		// 64 bit FNV-1a.
+
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+		using DataSystemVariables::SutherlandHodgman;
+
+		std::vector< Real64 > Geom;
+		Geom.reserve( 32 * TotSurfaces + 8 );
+		Geom.push_back( TotSurfaces );
+		Geom.push_back( MaxBkSurf );
+		Geom.push_back( SolarDistribution );
+		Geom.push_back( SutherlandHodgman ? 1.0 : 0.0 );
+		Geom.push_back( ShadowCacheSunQuantum );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			Geom.push_back( surface.Class );
+			Geom.push_back( surface.BaseSurf );
+			Geom.push_back( surface.ShadowingSurf ? 1.0 : 0.0 );
+			Geom.push_back( surface.Area );
+			Geom.push_back( surface.NetAreaShadowCalc );
+			Geom.push_back( surface.Reveal );
+			Geom.push_back( surface.Sides );
+			for ( int Vert = 1; Vert <= surface.Sides; ++Vert ) {
+				Geom.push_back( surface.Vertex( Vert ).x );
+				Geom.push_back( surface.Vertex( Vert ).y );
+				Geom.push_back( surface.Vertex( Vert ).z );
+			}
+			if ( surface.Class == SurfaceClass_Window ) Geom.push_back( SurfaceWindow( SurfNum ).GlazedFrac );
+			auto const & comb( ShadowComb( SurfNum ) );
+			Geom.push_back( comb.UseThisSurf ? 1.0 : 0.0 );
+			Geom.push_back( comb.NumGenSurf );
+			for ( int i = 1; i <= comb.NumGenSurf; ++i ) Geom.push_back( comb.GenSurf( i ) );
+			Geom.push_back( comb.NumBackSurf );
+			for ( int i = 1; i <= comb.NumBackSurf; ++i ) Geom.push_back( comb.BackSurf( i ) );
+			Geom.push_back( comb.NumSubSurf );
+			for ( int i = 1; i <= comb.NumSubSurf; ++i ) Geom.push_back( comb.SubSurf( i ) );
+		}
+
+		if ( CalcSolRefl ) {
+			Geom.push_back( NumOfTimeStepInHour ); // The reflection factors use the first time step of the hour
+			Geom.push_back( DetailedSkyDiffuseAlgorithm ? 1.0 : 0.0 );
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				auto const & surface( Surface( SurfNum ) );
+				Geom.push_back( surface.ExtBoundCond );
+				Geom.push_back( surface.Shelf );
+				Geom.push_back( surface.MirroredSurf ? 1.0 : 0.0 );
+				Geom.push_back( surface.ShadowSurfPossibleObstruction ? 1.0 : 0.0 );
+				Geom.push_back( surface.ViewFactorSky );
+				Geom.push_back( surface.ShadowSurfGlazingFrac );
+				int ConstrNum( 0 ); // Construction of the specularly reflecting glazing
+				if ( surface.Class == SurfaceClass_Window ) {
+					ConstrNum = surface.Construction;
+					int const FrDivNum( surface.FrameDivider );
+					if ( FrDivNum > 0 ) {
+						Geom.push_back( FrameDivider( FrDivNum ).FrameWidth );
+						Geom.push_back( FrameDivider( FrDivNum ).FrameProjectionOut );
+						Geom.push_back( FrameDivider( FrDivNum ).DividerWidth );
+						Geom.push_back( FrameDivider( FrDivNum ).DividerProjectionOut );
+						Geom.push_back( FrameDivider( FrDivNum ).HorDividers );
+						Geom.push_back( FrameDivider( FrDivNum ).VertDividers );
+					}
+				} else if ( surface.ShadowingSurf ) {
+					ConstrNum = surface.ShadowSurfGlazingConstruct;
+				}
+				if ( ConstrNum > 0 ) {
+					for ( int i = 1; i <= 6; ++i ) Geom.push_back( Construct( ConstrNum ).ReflSolBeamFrontCoef( i ) );
+				}
+			}
+			for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
+				auto const & recSurf( SolReflRecSurf( RecSurfNum ) );
+				Geom.push_back( recSurf.SurfNum );
+				for ( int RecPtNum = 1; RecPtNum <= recSurf.NumRecPts; ++RecPtNum ) {
+					for ( int RayNum = 1; RayNum <= recSurf.NumReflRays; ++RayNum ) Geom.push_back( recSurf.HitPtSolRefl( RayNum, RecPtNum ) );
+				}
+			}
+		}
+
+		std::uint64_t Hash( 14695981039346656037ull ); // FNV offset basis
+		unsigned char const * Bytes( reinterpret_cast< unsigned char const * >( Geom.data() ) );
+		for ( std::size_t i = 0, e = Geom.size() * sizeof( Real64 ); i < e; ++i ) {
+			Hash ^= Bytes[ i ];
+			Hash *= 1099511628211ull; // FNV prime
+		}
+		return Hash;
+
+	}
+
+	void
+	InitShadowCache( std::string const & FileName ) // Cache file name, empty for no cache
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the sunlit fraction cache file and indexes the records it already holds.
+
+		// METHODOLOGY EMPLOYED:
+		// The file starts with a signature, the geometry hash and the surface count.  A file
+		// written for other geometry (or unreadable) is started over.  Each record holds the
+		// quantized sun direction followed by the sparse SHADOW results for that direction.
+		// Records are only appended, so a run adds the sun positions it computed to the file.
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		ShadowCache.Active = false;
+		ShadowCache.Index.clear();
+		ShadowCache.NumHits = 0;
+		ShadowCache.NumMisses = 0;
+		if ( ShadowCache.File.is_open() ) ShadowCache.File.close();
+		if ( FileName.empty() ) return;
+
+		ShadowCache.FileName = FileName;
+		ShadowCache.GeometryHash = ShadowGeometryHash();
+
+		// Try the existing file first
+		bool Valid( false );
+		ShadowCache.File.open( FileName, std::ios::in | std::ios::out | std::ios::binary );
+		if ( ShadowCache.File.is_open() ) {
+			char Magic[ 8 ];
+			std::uint64_t Hash( 0u );
+			int NumSurfs( 0 );
+			ShadowCache.File.read( Magic, 8 );
+			ShadowCache.File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+			ShadowCache.File.read( reinterpret_cast< char * >( &NumSurfs ), sizeof( NumSurfs ) );
+			Valid = ShadowCache.File.good() && ( std::string( Magic, 8 ) == ShadowCacheMagic ) && ( Hash == ShadowCache.GeometryHash ) && ( NumSurfs == TotSurfaces );
+			while ( Valid ) { // Index the records
+				std::streamoff const Offset( ShadowCache.File.tellg() );
+				int Head[ 6 ]; // Key (3), number of sunlit, reveal and back surface entries
+				ShadowCache.File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+				if ( ShadowCache.File.gcount() == 0 && ShadowCache.File.eof() ) break; // End of file
+				if ( ! ShadowCache.File.good() ) {
+					Valid = false; // Truncated record
+					break;
+				}
+				std::streamoff const Skip( ( Head[ 3 ] + Head[ 4 ] ) * ( sizeof( int ) + sizeof( Real64 ) ) + Head[ 5 ] * ( 3 * sizeof( int ) + sizeof( Real64 ) ) );
+				ShadowCache.File.seekg( Skip, std::ios::cur );
+				ShadowCache.File.peek(); // Sets eof if the record was cut short
+				if ( ShadowCache.File.fail() ) {
+					Valid = false;
+					break;
+				}
+				ShadowCache.Index[ std::make_tuple( Head[ 0 ], Head[ 1 ], Head[ 2 ] ) ] = Offset;
+			}
+			ShadowCache.File.clear();
+			if ( ! Valid ) ShadowCache.File.close();
+		}
+
+		if ( ! Valid ) { // Start a new file for this geometry
+			ShadowCache.Index.clear();
+			ShadowCache.File.open( FileName, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc );
+			if ( ! ShadowCache.File.is_open() ) {
+				ShowWarningError( "InitShadowCache: Could not open sunlit fraction cache file \"" + FileName + "\"; shadowing is calculated without the cache." );
+				return;
+			}
+			std::uint64_t const Hash( ShadowCache.GeometryHash );
+			int const NumSurfs( TotSurfaces );
+			ShadowCache.File.write( ShadowCacheMagic.c_str(), 8 );
+			ShadowCache.File.write( reinterpret_cast< char const * >( &Hash ), sizeof( Hash ) );
+			ShadowCache.File.write( reinterpret_cast< char const * >( &NumSurfs ), sizeof( NumSurfs ) );
+			ShadowCache.File.flush();
+		}
+
+		ShadowCache.Active = ShadowCache.File.good();
+		if ( ShadowCache.Active ) {
+			ShowMessage( "InitShadowCache: Using sunlit fraction cache file \"" + FileName + "\" with " + TrimSigDigits( int( ShadowCache.Index.size() ) ) + " cached sun positions." );
+		}
+
+	}
+
+	std::tuple< int, int, int >
+	ShadowCacheKey( int const iHour ) // Hour index, 0 for a sky patch
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the cache key of the current sun direction.
+
+		// METHODOLOGY EMPLOYED:
+		// Each direction cosine is rounded to a multiple of ShadowCacheSunQuantum.  The sky diffuse
+		// shading of a sky patch (SHADOW called with hour 0) skips the back surfaces and uses the
+		// minimum shading transmittance, so its records are kept apart by moving the last component
+		// beyond the range of a direction cosine.
+
+		return std::make_tuple( int( std::lround( SUNCOS( 1 ) / ShadowCacheSunQuantum ) ), int( std::lround( SUNCOS( 2 ) / ShadowCacheSunQuantum ) ), int( std::lround( SUNCOS( 3 ) / ShadowCacheSunQuantum ) ) + ( iHour == 0 ? ShadowCacheSkyPatchKey : 0 ) );
+
+	}
+
+	bool
+	RestoreShadowFromCache(
+		int const iHour, // Hour index
+		int const iTimeStep // Time Step
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets the SHADOW results for the current sun direction from the cache file.  Returns
+		// false if the direction is not cached (or the record cannot be read).
+
+		// METHODOLOGY EMPLOYED:
+		// SAREA is reset and the sparse sunlit areas, sunlit fractions without reveal and back
+		// surface overlaps of the record are stored in the iHour/iTimeStep slots, as SHADOW does.
+
+		auto const Found( ShadowCache.Index.find( ShadowCacheKey( iHour ) ) );
+		if ( Found == ShadowCache.Index.end() ) return false;
+
+		auto & File( ShadowCache.File );
+		File.clear();
+		File.seekg( Found->second );
+		int Head[ 6 ];
+		File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+		int const NumSun( Head[ 3 ] );
+		int const NumRev( Head[ 4 ] );
+		int const NumBack( Head[ 5 ] );
+		std::vector< int > Ints( NumSun + NumRev + 3 * NumBack );
+		std::vector< Real64 > Reals( NumSun + NumRev + NumBack );
+		File.read( reinterpret_cast< char * >( Ints.data() ), Ints.size() * sizeof( int ) );
+		File.read( reinterpret_cast< char * >( Reals.data() ), Reals.size() * sizeof( Real64 ) );
+		if ( ! File.good() ) {
+			File.clear();
+			ShadowCache.Index.erase( Found );
+			return false;
+		}
+
+		SAREA = 0.0;
+		int const * Int( Ints.data() );
+		Real64 const * Real( Reals.data() );
+		for ( int i = 0; i < NumSun; ++i ) SAREA( *Int++ ) = *Real++;
+		for ( int i = 0; i < NumRev; ++i ) SunlitFracWithoutReveal( iTimeStep, iHour, *Int++ ) = *Real++;
+		for ( int i = 0; i < NumBack; ++i, Int += 3 ) {
+			BackSurfaces( iTimeStep, iHour, Int[ 1 ], Int[ 0 ] ) = Int[ 2 ];
+			OverlapAreas( iTimeStep, iHour, Int[ 1 ], Int[ 0 ] ) = *Real++;
+		}
+		++ShadowCache.NumHits;
+		return true;
+
+	}
+
+	void
+	SaveShadowToCache(
+		int const iHour, // Hour index
+		int const iTimeStep // Time Step
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the SHADOW results for the current sun direction to the cache file.
+
+		// METHODOLOGY EMPLOYED:
+		// Only nonzero entries are written (SHADOW starts from zeroed arrays).  A sky patch (hour 0)
+		// has only the sunlit areas.
+
+		std::vector< int > SunSurfs, RevSurfs, BackEntries;
+		std::vector< Real64 > SunAreas, RevFracs, BackAreas;
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( SAREA( SurfNum ) != 0.0 ) {
+				SunSurfs.push_back( SurfNum );
+				SunAreas.push_back( SAREA( SurfNum ) );
+			}
+			if ( iHour == 0 ) continue; // Sky patch, no hour slots
+			if ( SunlitFracWithoutReveal( iTimeStep, iHour, SurfNum ) != 0.0 ) {
+				RevSurfs.push_back( SurfNum );
+				RevFracs.push_back( SunlitFracWithoutReveal( iTimeStep, iHour, SurfNum ) );
+			}
+			for ( int JBKS = 1; JBKS <= MaxBkSurf; ++JBKS ) {
+				if ( BackSurfaces( iTimeStep, iHour, JBKS, SurfNum ) == 0 ) continue;
+				BackEntries.push_back( SurfNum );
+				BackEntries.push_back( JBKS );
+				BackEntries.push_back( BackSurfaces( iTimeStep, iHour, JBKS, SurfNum ) );
+				BackAreas.push_back( OverlapAreas( iTimeStep, iHour, JBKS, SurfNum ) );
+			}
+		}
+
+		auto const Key( ShadowCacheKey( iHour ) );
+		int const Head[ 6 ] = { std::get< 0 >( Key ), std::get< 1 >( Key ), std::get< 2 >( Key ), int( SunSurfs.size() ), int( RevSurfs.size() ), int( BackAreas.size() ) };
+
+		auto & File( ShadowCache.File );
+		File.clear();
+		File.seekp( 0, std::ios::end );
+		std::streamoff const Offset( File.tellp() );
+		File.write( reinterpret_cast< char const * >( Head ), sizeof( Head ) );
+		File.write( reinterpret_cast< char const * >( SunSurfs.data() ), SunSurfs.size() * sizeof( int ) );
+		File.write( reinterpret_cast< char const * >( RevSurfs.data() ), RevSurfs.size() * sizeof( int ) );
+		File.write( reinterpret_cast< char const * >( BackEntries.data() ), BackEntries.size() * sizeof( int ) );
+		File.write( reinterpret_cast< char const * >( SunAreas.data() ), SunAreas.size() * sizeof( Real64 ) );
+		File.write( reinterpret_cast< char const * >( RevFracs.data() ), RevFracs.size() * sizeof( Real64 ) );
+		File.write( reinterpret_cast< char const * >( BackAreas.data() ), BackAreas.size() * sizeof( Real64 ) );
+		File.flush();
+		if ( ! File.good() ) {
+			ShowWarningError( "SaveShadowToCache: Could not write to sunlit fraction cache file \"" + ShadowCache.FileName + "\"; the cache is no longer used." );
+			File.close();
+			ShadowCache.Active = false;
+			return;
+		}
+		ShadowCache.Index[ Key ] = Offset;
+		++ShadowCache.NumMisses;
+
+	}
+
+	bool
+	RestoreFactorsFromCache(
+		std::tuple< int, int, int > const & Key, // Record key
+		std::vector< Real64 > & Factors // Factors of the record, resized by the caller (zero if not in the record)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets Factors from the factor record of the cache file with the given key, as written by
+		// SaveFactorsToCache.  Returns false if there is no such record (or it cannot be read).
+
+		// METHODOLOGY EMPLOYED:
+		// A factor record has the header of a SHADOW record with the sparse (index, value) entries
+		// in the place of the sunlit areas, so the records of both kinds are indexed alike.
+
+		auto const Found( ShadowCache.Index.find( Key ) );
+		if ( Found == ShadowCache.Index.end() ) return false;
+
+		auto & File( ShadowCache.File );
+		File.clear();
+		File.seekg( Found->second );
+		int Head[ 6 ];
+		File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+		int const NumFactors( Head[ 3 ] );
+		if ( ! File.good() || ( Head[ 4 ] != 0 ) || ( Head[ 5 ] != 0 ) ) {
+			File.clear();
+			return false;
+		}
+		std::vector< int > Ints( NumFactors );
+		std::vector< Real64 > Reals( NumFactors );
+		File.read( reinterpret_cast< char * >( Ints.data() ), Ints.size() * sizeof( int ) );
+		File.read( reinterpret_cast< char * >( Reals.data() ), Reals.size() * sizeof( Real64 ) );
+		if ( ! File.good() ) {
+			File.clear();
+			ShadowCache.Index.erase( Found );
+			return false;
+		}
+		for ( int i = 0; i < NumFactors; ++i ) {
+			if ( ( Ints[ i ] < 0 ) || ( Ints[ i ] >= int( Factors.size() ) ) ) return false;
+		}
+
+		std::fill( Factors.begin(), Factors.end(), 0.0 );
+		for ( int i = 0; i < NumFactors; ++i ) Factors[ Ints[ i ] ] = Reals[ i ];
+		return true;
+
+	}
+
+	void
+	SaveFactorsToCache(
+		std::tuple< int, int, int > const & Key, // Record key
+		std::vector< Real64 > const & Factors // Factors to keep
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends a record of precomputed factors other than the SHADOW results (the solar
+		// reflection factors) to the cache file.  Only the nonzero factors are written.
+
+		std::vector< int > Ints;
+		std::vector< Real64 > Reals;
+		for ( int i = 0, e = int( Factors.size() ); i < e; ++i ) {
+			if ( Factors[ i ] == 0.0 ) continue;
+			Ints.push_back( i );
+			Reals.push_back( Factors[ i ] );
+		}
+		int const Head[ 6 ] = { std::get< 0 >( Key ), std::get< 1 >( Key ), std::get< 2 >( Key ), int( Ints.size() ), 0, 0 };
+
+		auto & File( ShadowCache.File );
+		File.clear();
+		File.seekp( 0, std::ios::end );
+		std::streamoff const Offset( File.tellp() );
+		File.write( reinterpret_cast< char const * >( Head ), sizeof( Head ) );
+		File.write( reinterpret_cast< char const * >( Ints.data() ), Ints.size() * sizeof( int ) );
+		File.write( reinterpret_cast< char const * >( Reals.data() ), Reals.size() * sizeof( Real64 ) );
+		File.flush();
+		if ( ! File.good() ) {
+			ShowWarningError( "SaveFactorsToCache: Could not write to sunlit fraction cache file \"" + ShadowCache.FileName + "\"; the cache is no longer used." );
+			File.close();
+			ShadowCache.Active = false;
+			return;
+		}
+		ShadowCache.Index[ Key ] = Offset;
+
+	}
+
+	void
+	BuildShadowCasterBVH( std::vector< int > const & Casters ) // Possible shadow casting surfaces
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the bounding volume hierarchy over the possible shadow casting surfaces.
+
+		// METHODOLOGY EMPLOYED:
+		// Axis aligned bounding boxes, split at the median centroid along the longest axis of
+		// the node until a node holds a few surfaces.
+
+		ShadowCasterBVH.clear();
+		ShadowCasterBVHSurfs = Casters;
+		if ( Casters.empty() ) return;
+		ShadowCasterBVH.reserve( 2 * Casters.size() );
+		BuildShadowCasterBVHNode( 0, int( Casters.size() ) );
+
+	}
+
+	int
+	BuildShadowCasterBVHNode(
+		int const First, // First entry of ShadowCasterBVHSurfs in the node (0 based)
+		int const Last // One past the last entry of ShadowCasterBVHSurfs in the node
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Adds the BVH node holding ShadowCasterBVHSurfs[First:Last) and its children; returns
+		// the node index.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxLeafSurfs( 4 ); // Nodes with no more surfaces than this are not split
+
+		int const NodeNum( int( ShadowCasterBVH.size() ) );
+		ShadowCasterBVH.push_back( ShadowCasterBVHNode() );
+
+		ShadowCasterBVHNode Node;
+		Node.First = First;
+		Node.Last = Last;
+		Node.XMin = Node.YMin = Node.ZMin = std::numeric_limits< Real64 >::max();
+		Node.XMax = Node.YMax = Node.ZMax = std::numeric_limits< Real64 >::lowest();
+		Real64 CXMin( Node.XMin ), CYMin( Node.YMin ), CZMin( Node.ZMin ); // Centroid bounds
+		Real64 CXMax( Node.XMax ), CYMax( Node.YMax ), CZMax( Node.ZMax );
+		for ( int i = First; i < Last; ++i ) {
+			auto const & surface( Surface( ShadowCasterBVHSurfs[ i ] ) );
+			for ( int Vert = 1; Vert <= surface.Sides; ++Vert ) {
+				auto const & vertex( surface.Vertex( Vert ) );
+				Node.XMin = min( Node.XMin, vertex.x );
+				Node.XMax = max( Node.XMax, vertex.x );
+				Node.YMin = min( Node.YMin, vertex.y );
+				Node.YMax = max( Node.YMax, vertex.y );
+				Node.ZMin = min( Node.ZMin, vertex.z );
+				Node.ZMax = max( Node.ZMax, vertex.z );
+			}
+			CXMin = min( CXMin, surface.Centroid.x );
+			CXMax = max( CXMax, surface.Centroid.x );
+			CYMin = min( CYMin, surface.Centroid.y );
+			CYMax = max( CYMax, surface.Centroid.y );
+			CZMin = min( CZMin, surface.Centroid.z );
+			CZMax = max( CZMax, surface.Centroid.z );
+		}
+
+		if ( Last - First > MaxLeafSurfs ) {
+			// Split at the median centroid along the axis with the largest centroid spread
+			int Axis( 1 );
+			if ( CYMax - CYMin > CXMax - CXMin ) Axis = 2;
+			if ( CZMax - CZMin > max( CXMax - CXMin, CYMax - CYMin ) ) Axis = 3;
+			std::vector< std::pair< Real64, int > > Order;
+			Order.reserve( Last - First );
+			for ( int i = First; i < Last; ++i ) {
+				auto const & centroid( Surface( ShadowCasterBVHSurfs[ i ] ).Centroid );
+				Order.push_back( std::make_pair( Axis == 1 ? centroid.x : ( Axis == 2 ? centroid.y : centroid.z ), ShadowCasterBVHSurfs[ i ] ) );
+			}
+			int const Mid( First + ( Last - First ) / 2 );
+			std::nth_element( Order.begin(), Order.begin() + ( Mid - First ), Order.end() );
+			for ( int i = First; i < Last; ++i ) ShadowCasterBVHSurfs[ i ] = Order[ i - First ].second;
+			Node.Left = BuildShadowCasterBVHNode( First, Mid );
+			Node.Right = BuildShadowCasterBVHNode( Mid, Last );
+		}
+
+		ShadowCasterBVH[ NodeNum ] = Node;
+		return NodeNum;
+
+	}
+
+	void
+	GatherShadowCasterCandidates(
+		int const NRS, // Surface number of the potential shadow receiving surface
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > & Candidates // Casting surfaces not ruled out by their bounding boxes
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the casting surfaces of the BVH that may shade receiving surface NRS.  The
+		// exact test (CHKGSS) is still needed for each candidate.
+
+		// METHODOLOGY EMPLOYED:
+		// A node is skipped when its bounding box shows that none of its surfaces passes the
+		// first or the third test of CHKGSS: the box is no higher than the lowest point of the
+		// receiving surface, or the box lies entirely behind the plane of the receiving surface.
+		// The plane test uses half the CHKGSS tolerance so round-off cannot drop a candidate.
+
+		// Using/Aliasing
+		using namespace Vectors;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const TolValue( 0.5 * 0.0003 ); // Half the CHKGSS tolerance
+
+		if ( ShadowCasterBVH.empty() ) return;
+
+		auto const & vertex_R( Surface( NRS ).Vertex );
+		auto const & vertex_R_2( vertex_R( 2 ) );
+		Vector const CVec( ( vertex_R( 3 ) - vertex_R_2 ) * ( vertex_R( 1 ) - vertex_R_2 ) );
+
+		std::vector< int > Stack;
+		Stack.push_back( 0 );
+		while ( ! Stack.empty() ) {
+			auto const & node( ShadowCasterBVH[ Stack.back() ] );
+			Stack.pop_back();
+			if ( node.ZMax <= ZMIN ) continue;
+			// Highest box corner relative to the receiving surface plane
+			Real64 const DOTP( CVec.x * ( ( CVec.x > 0.0 ? node.XMax : node.XMin ) - vertex_R_2.x ) + CVec.y * ( ( CVec.y > 0.0 ? node.YMax : node.YMin ) - vertex_R_2.y ) + CVec.z * ( ( CVec.z > 0.0 ? node.ZMax : node.ZMin ) - vertex_R_2.z ) );
+			if ( DOTP <= TolValue ) continue;
+			if ( node.Left < 0 ) {
+				Candidates.insert( Candidates.end(), ShadowCasterBVHSurfs.begin() + node.First, ShadowCasterBVHSurfs.begin() + node.Last );
+			} else {
+				Stack.push_back( node.Right );
+				Stack.push_back( node.Left );
+			}
+		}
+
+	}
+
 	void
 	DetermineShadowingCombinations()
 	{
@@ -3660,19 +4342,23 @@ namespace SolarShading {
 		bool CannotShade; // TRUE if subsurface cannot shade receiving surface
 		bool HasWindow; // TRUE if a window is present on receiving surface
 		Real64 ZMIN; // Lowest point on the receiving surface
-		int BackSurfaceNumber; // Back surface number
 		int HTS; // Heat transfer surface number for a receiving surface
 		int GRSNR; // Receiving surface number
-		int GSSNR; // Shadowing surface number
-		int SBSNR; // Subsurface number
 		int NBKS; // Number of back surfaces for a receiving surface
 		int NGSS; // Number of shadowing surfaces for a receiving surface
 		int NSBS; // Number of subsurfaces for a receiving surface
 		bool ShadowingSurf; // True if a receiving surface is a shadowing surface
 		Array1D_bool CastingSurface; // tracking during setup of ShadowComb
+		std::vector< std::vector< int > > SubSurfaces; // Subsurfaces of each surface (BaseSurf), ascending
+		std::vector< std::vector< int > > ZoneSurfaces; // Heat transfer surfaces of each zone, ascending
+		std::vector< int > Casters; // Detached shading and exterior base surfaces
+		std::vector< int > Candidates; // Possible shadow casting surfaces for a receiving surface
 
 		static int MaxDim( 0 );
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "DetermineShadowingCombinations" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 #ifdef EP_Count_Calls
 		++NumDetShadowCombs_Calls;
 #endif
@@ -3702,6 +4388,21 @@ namespace SolarShading {
 			return;
 		}
 
+		// Index the surfaces once so the loops below only visit the surfaces that can qualify
+		// instead of every surface for every receiving surface
+		SubSurfaces.resize( TotSurfaces + 1 );
+		ZoneSurfaces.resize( NumOfZones + 1 );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( ( surface.BaseSurf >= 1 ) && ( surface.BaseSurf <= TotSurfaces ) && ( surface.BaseSurf != SurfNum ) ) SubSurfaces[ surface.BaseSurf ].push_back( SurfNum );
+			if ( surface.HeatTransSurf && ( surface.Zone >= 0 ) ) {
+				if ( surface.Zone >= int( ZoneSurfaces.size() ) ) ZoneSurfaces.resize( surface.Zone + 1 );
+				ZoneSurfaces[ surface.Zone ].push_back( SurfNum );
+			}
+			if ( ( surface.BaseSurf == 0 ) || ( ( surface.BaseSurf == SurfNum ) && ( ( surface.ExtBoundCond == ExternalEnvironment ) || surface.ExtBoundCond == OtherSideCondModeledExt ) ) ) Casters.push_back( SurfNum );
+		}
+		if ( SolarDistribution != MinimalShadowing ) BuildShadowCasterBVH( Casters );
+
 		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) { // Loop through all surfaces (looking for potential receiving surfaces)...
 
 			ShadowingSurf = Surface( GRSNR ).ShadowingSurf;
@@ -3722,7 +4423,12 @@ namespace SolarShading {
 			NGSS = 0;
 			if ( SolarDistribution != MinimalShadowing ) { // Except when doing simplified exterior shadowing.
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces, looking for ones that could shade GRSNR
+				// Subsurfaces of the receiving surface and the casting surfaces the BVH cannot rule out, in surface order
+				Candidates = SubSurfaces[ GRSNR ];
+				GatherShadowCasterCandidates( GRSNR, ZMIN, Candidates );
+				std::sort( Candidates.begin(), Candidates.end() );
+
+				for ( int const GSSNR : Candidates ) { // Loop through the candidates, looking for ones that could shade GRSNR
 
 					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
 					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // A heat transfer subsurface of a receiving surface
@@ -3758,7 +4464,7 @@ namespace SolarShading {
 				} // ...end of surfaces DO loop (GSSNR)
 			} else { // Simplified Distribution -- still check for Shading Subsurfaces
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces (looking for surfaces which could shade GRSNR) ...
+				for ( int const GSSNR : SubSurfaces[ GRSNR ] ) { // Loop through the subsurfaces (looking for surfaces which could shade GRSNR) ...
 
 					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
 					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // Skip heat transfer subsurfaces of receiving surface
@@ -3777,7 +4483,7 @@ namespace SolarShading {
 			NSBS = 0;
 			HasWindow = false;
 			//legacy: IF (OSENV(HTS) > 10) WINDOW=.TRUE. -->Note: WINDOW was set true for roof ponds, solar walls, or other zones
-			for ( SBSNR = 1; SBSNR <= TotSurfaces; ++SBSNR ) { // Loop through the surfaces yet again (looking for subsurfaces of GRSNR)...
+			for ( int const SBSNR : SubSurfaces[ GRSNR ] ) { // Loop through the subsurfaces of GRSNR...
 
 				if ( ! Surface( SBSNR ).HeatTransSurf ) continue; // Skip non heat transfer subsurfaces
 				if ( SBSNR == GRSNR ) continue; // Surface itself cannot be its own subsurface
@@ -3800,7 +4506,7 @@ namespace SolarShading {
 			//                                        interior solar distribution,
 			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
 
-				for ( BackSurfaceNumber = 1; BackSurfaceNumber <= TotSurfaces; ++BackSurfaceNumber ) { // Loop through surfaces yet again, looking for back surfaces to GRSNR
+				for ( int const BackSurfaceNumber : ZoneSurfaces[ Surface( GRSNR ).Zone ] ) { // Loop through the heat transfer surfaces of the zone, looking for back surfaces to GRSNR
 
 					if ( ! Surface( BackSurfaceNumber ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 					if ( Surface( BackSurfaceNumber ).BaseSurf == GRSNR ) continue; // Skip subsurfaces of this GRSNR
@@ -3957,7 +4663,10 @@ namespace SolarShading {
 		// and sunlit areas used in computing the solar beam flux multipliers.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The receiving surfaces are independent: each sets the sunlit areas of itself and its
+		// subsurfaces and the hour slots of its subsurfaces.  When a single sun position is
+		// shadowed at a time (timestep integration), they are shadowed in parallel; a worker
+		// thread works in its own copies of the work arrays and returns the sunlit areas it sets.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
@@ -3977,6 +4686,72 @@ namespace SolarShading {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataSystemVariables::NumberShadowThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+
+#ifdef EP_Count_Calls
+		if ( iHour == 0 ) {
+			++NumShadow_Calls;
+		} else {
+			++NumShadowAtTS_Calls;
+		}
+#endif
+
+		SAREA = 0.0;
+
+		// The hourly sun positions and the sky patches are already shadowed in parallel
+		int const nReceivingThreads( ( DetailedSolarTimestepIntegration && iHour > 0 ) ? ParallelLoopThreads( NumberShadowThreads, TotSurfaces, 16 ) : 1 );
+		if ( nReceivingThreads > 1 ) {
+			Array1D< Real64 > & MainSAREA( SAREA );
+			Array1D< Real64 > const & MainCTHETA( CTHETA );
+			Array1D< Real64 > const MainSUNCOS( SUNCOS );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel num_threads(nReceivingThreads)
+#endif
+			{
+				bool const Worker( &SAREA != &MainSAREA ); // Thread local copies of the work arrays
+				if ( Worker ) {
+					AllocateShadowingThreadArrays();
+					CTHETA = MainCTHETA;
+					SUNCOS = MainSUNCOS;
+					SAREA = 0.0;
+				}
+#ifdef HBIRE_USE_OMP
+#pragma omp for schedule(dynamic)
+#endif
+				for ( int GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
+					if ( ! ShadowComb( GRSNR ).UseThisSurf ) continue;
+					ShadowReceivingSurface( iHour, TS, GRSNR );
+					if ( Worker ) {
+						MainSAREA( GRSNR ) = SAREA( GRSNR );
+						for ( int I = 1; I <= ShadowComb( GRSNR ).NumSubSurf; ++I ) {
+							MainSAREA( ShadowComb( GRSNR ).SubSurf( I ) ) = SAREA( ShadowComb( GRSNR ).SubSurf( I ) );
+						}
+					}
+				}
+			}
+		} else {
+			for ( int GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
+				if ( ! ShadowComb( GRSNR ).UseThisSurf ) continue;
+				ShadowReceivingSurface( iHour, TS, GRSNR );
+			}
+		}
+
+	}
+
+	void
+	ShadowReceivingSurface(
+		int const iHour, // Hour index
+		int const TS, // Time Step
+		int const GRSNR // Surface number of general receiving surface
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Determines the sunlit area of a receiving surface and its subsurfaces for SHADOW.
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 XS; // Intermediate result
 		Real64 YS; // Intermediate result
@@ -3985,12 +4760,11 @@ namespace SolarShading {
 		int NGRS; // Coordinate transformation index
 		int NZ; // Zone Number of surface
 		int NVT;
-		static Array1D< Real64 > XVT; // X Vertices of Shadows
-		static Array1D< Real64 > YVT; // Y vertices of Shadows
-		static Array1D< Real64 > ZVT; // Z vertices of Shadows
-		static bool OneTimeFlag( true );
+		static EP_THREAD_LOCAL Array1D< Real64 > XVT; // X Vertices of Shadows
+		static EP_THREAD_LOCAL Array1D< Real64 > YVT; // Y vertices of Shadows
+		static EP_THREAD_LOCAL Array1D< Real64 > ZVT; // Z vertices of Shadows
+		static EP_THREAD_LOCAL bool OneTimeFlag( true );
 		int HTS; // Heat transfer surface number of the general receiving surface
-		int GRSNR; // Surface number of general receiving surface
 		int NBKS; // Number of back surfaces
 		int NGSS; // Number of general shadowing surfaces
 		int NSBS; // Number of subsurfaces (windows and doors)
@@ -4007,95 +4781,79 @@ namespace SolarShading {
 			OneTimeFlag = false;
 		}
 
-#ifdef EP_Count_Calls
-		if ( iHour == 0 ) {
-			++NumShadow_Calls;
-		} else {
-			++NumShadowAtTS_Calls;
-		}
-#endif
-
-		SAREA = 0.0;
-
-		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
+		SAREA( GRSNR ) = 0.0;
 
-			if ( ! ShadowComb( GRSNR ).UseThisSurf ) continue;
-
-			SAREA( GRSNR ) = 0.0;
-
-			NZ = Surface( GRSNR ).Zone;
-			NGSS = ShadowComb( GRSNR ).NumGenSurf;
-			NGSSHC = 0;
-			NBKS = ShadowComb( GRSNR ).NumBackSurf;
-			NBKSHC = 0;
-			NSBS = ShadowComb( GRSNR ).NumSubSurf;
-			NRVLHC = 0;
-			NSBSHC = 0;
-			LOCHCA = 1;
-			// Temporarily determine the old heat transfer surface number (HTS)
-			HTS = GRSNR;
+		NZ = Surface( GRSNR ).Zone;
+		NGSS = ShadowComb( GRSNR ).NumGenSurf;
+		NGSSHC = 0;
+		NBKS = ShadowComb( GRSNR ).NumBackSurf;
+		NBKSHC = 0;
+		NSBS = ShadowComb( GRSNR ).NumSubSurf;
+		NRVLHC = 0;
+		NSBSHC = 0;
+		LOCHCA = 1;
+		// Temporarily determine the old heat transfer surface number (HTS)
+		HTS = GRSNR;
 
-			if ( CTHETA( GRSNR ) < SunIsUpValue ) { //.001) THEN ! Receiving surface is not in the sun
+		if ( CTHETA( GRSNR ) < SunIsUpValue ) { //.001) THEN ! Receiving surface is not in the sun
 
-				SAREA( HTS ) = 0.0;
-				SHDSBS( iHour, GRSNR, NBKS, NSBS, HTS, TS );
+			SAREA( HTS ) = 0.0;
+			SHDSBS( iHour, GRSNR, NBKS, NSBS, HTS, TS );
 
-			} else if ( ( NGSS <= 0 ) && ( NSBS <= 0 ) ) { // Simple surface--no shaders or subsurfaces
+		} else if ( ( NGSS <= 0 ) && ( NSBS <= 0 ) ) { // Simple surface--no shaders or subsurfaces
 
-				SAREA( HTS ) = Surface( GRSNR ).NetAreaShadowCalc;
-			} else { // Surface in sun and either shading surfaces or subsurfaces present (or both)
+			SAREA( HTS ) = Surface( GRSNR ).NetAreaShadowCalc;
+		} else { // Surface in sun and either shading surfaces or subsurfaces present (or both)
 
-				NGRS = Surface( GRSNR ).BaseSurf;
-				if ( Surface( GRSNR ).ShadowingSurf ) NGRS = GRSNR;
+			NGRS = Surface( GRSNR ).BaseSurf;
+			if ( Surface( GRSNR ).ShadowingSurf ) NGRS = GRSNR;
 
-				// Compute the X and Y displacements of a shadow.
-				XS = Surface( NGRS ).lcsx.x * SUNCOS( 1 ) + Surface( NGRS ).lcsx.y * SUNCOS( 2 ) + Surface( NGRS ).lcsx.z * SUNCOS( 3 );
-				YS = Surface( NGRS ).lcsy.x * SUNCOS( 1 ) + Surface( NGRS ).lcsy.y * SUNCOS( 2 ) + Surface( NGRS ).lcsy.z * SUNCOS( 3 );
-				ZS = Surface( NGRS ).lcsz.x * SUNCOS( 1 ) + Surface( NGRS ).lcsz.y * SUNCOS( 2 ) + Surface( NGRS ).lcsz.z * SUNCOS( 3 );
+			// Compute the X and Y displacements of a shadow.
+			XS = Surface( NGRS ).lcsx.x * SUNCOS( 1 ) + Surface( NGRS ).lcsx.y * SUNCOS( 2 ) + Surface( NGRS ).lcsx.z * SUNCOS( 3 );
+			YS = Surface( NGRS ).lcsy.x * SUNCOS( 1 ) + Surface( NGRS ).lcsy.y * SUNCOS( 2 ) + Surface( NGRS ).lcsy.z * SUNCOS( 3 );
+			ZS = Surface( NGRS ).lcsz.x * SUNCOS( 1 ) + Surface( NGRS ).lcsz.y * SUNCOS( 2 ) + Surface( NGRS ).lcsz.z * SUNCOS( 3 );
 
-				if ( std::abs( ZS ) > 1.e-4 ) {
-					XShadowProjection = XS / ZS;
-					YShadowProjection = YS / ZS;
-					if ( std::abs( XShadowProjection ) < 1.e-8 ) XShadowProjection = 0.0;
-					if ( std::abs( YShadowProjection ) < 1.e-8 ) YShadowProjection = 0.0;
-				} else {
-					XShadowProjection = 0.0;
-					YShadowProjection = 0.0;
-				}
-
-				CTRANS( GRSNR, NGRS, NVT, XVT, YVT, ZVT ); // Transform coordinates of the receiving surface to 2-D form
+			if ( std::abs( ZS ) > 1.e-4 ) {
+				XShadowProjection = XS / ZS;
+				YShadowProjection = YS / ZS;
+				if ( std::abs( XShadowProjection ) < 1.e-8 ) XShadowProjection = 0.0;
+				if ( std::abs( YShadowProjection ) < 1.e-8 ) YShadowProjection = 0.0;
+			} else {
+				XShadowProjection = 0.0;
+				YShadowProjection = 0.0;
+			}
 
-				// Re-order its vertices to clockwise sequential.
-				for ( N = 1; N <= NVT; ++N ) {
-					XVS( N ) = XVT( NVT + 1 - N );
-					YVS( N ) = YVT( NVT + 1 - N );
-				}
+			CTRANS( GRSNR, NGRS, NVT, XVT, YVT, ZVT ); // Transform coordinates of the receiving surface to 2-D form
 
-				HTRANS1( 1, NVT ); // Transform to homogeneous coordinates.
+			// Re-order its vertices to clockwise sequential.
+			for ( N = 1; N <= NVT; ++N ) {
+				XVS( N ) = XVT( NVT + 1 - N );
+				YVS( N ) = YVT( NVT + 1 - N );
+			}
 
-				HCAREA( 1 ) = -HCAREA( 1 ); // Compute (+) gross surface area.
-				HCT( 1 ) = 1.0;
+			HTRANS1( 1, NVT ); // Transform to homogeneous coordinates.
 
-				SHDGSS( NGRS, iHour, TS, GRSNR, NGSS, HTS ); // Determine shadowing on surface.
-				if ( ! CalcSkyDifShading ) {
-					SHDBKS( NGRS, GRSNR, NBKS, HTS ); // Determine possible back surfaces.
-				}
+			HCAREA( 1 ) = -HCAREA( 1 ); // Compute (+) gross surface area.
+			HCT( 1 ) = 1.0;
 
-				SHDSBS( iHour, GRSNR, NBKS, NSBS, HTS, TS ); // Subtract subsurf areas from total
+			SHDGSS( NGRS, iHour, TS, GRSNR, NGSS, HTS ); // Determine shadowing on surface.
+			if ( ! CalcSkyDifShading ) {
+				SHDBKS( NGRS, GRSNR, NBKS, HTS ); // Determine possible back surfaces.
+			}
 
-				// Error checking:  require that 0 <= SAREA <= AREA.  + or - .01*AREA added for round-off errors
-				SurfArea = Surface( GRSNR ).NetAreaShadowCalc;
-				SAREA( HTS ) = max( 0.0, SAREA( HTS ) );
+			SHDSBS( iHour, GRSNR, NBKS, NSBS, HTS, TS ); // Subtract subsurf areas from total
 
-				SAREA( HTS ) = min( SAREA( HTS ), SurfArea );
+			// Error checking:  require that 0 <= SAREA <= AREA.  + or - .01*AREA added for round-off errors
+			SurfArea = Surface( GRSNR ).NetAreaShadowCalc;
+			SAREA( HTS ) = max( 0.0, SAREA( HTS ) );
 
-			} // ...end of surface in sun/surface with shaders and/or subsurfaces IF-THEN block
+			SAREA( HTS ) = min( SAREA( HTS ), SurfArea );
 
-			// NOTE:
-			// There used to be a call to legacy subroutine SHDCVR here when the
-			// zone type was not a standard zone.
+		} // ...end of surface in sun/surface with shaders and/or subsurfaces IF-THEN block
 
-		}
+		// NOTE:
+		// There used to be a call to legacy subroutine SHDCVR here when the
+		// zone type was not a standard zone.
 
 	}
 
@@ -4146,10 +4904,10 @@ namespace SolarShading {
 		int N;
 		int NVR;
 		int NVT; // Number of vertices of back surface
-		static Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
-		static Array1D< Real64 > YVT; // back surfaces projected into system
-		static Array1D< Real64 > ZVT; // relative to receiving surface
-		static bool OneTimeFlag( true );
+		static EP_THREAD_LOCAL Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
+		static EP_THREAD_LOCAL Array1D< Real64 > YVT; // back surfaces projected into system
+		static EP_THREAD_LOCAL Array1D< Real64 > ZVT; // relative to receiving surface
+		static EP_THREAD_LOCAL bool OneTimeFlag( true );
 		int BackSurfaceNumber;
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
@@ -4289,10 +5047,10 @@ namespace SolarShading {
 		int GSSNR; // General shadowing surface number
 		int MainOverlapStatus; // Overlap status of the main overlap calculation not the check for
 		// multiple overlaps (unless there was an error)
-		static Array1D< Real64 > XVT;
-		static Array1D< Real64 > YVT;
-		static Array1D< Real64 > ZVT;
-		static bool OneTimeFlag( true );
+		static EP_THREAD_LOCAL Array1D< Real64 > XVT;
+		static EP_THREAD_LOCAL Array1D< Real64 > YVT;
+		static EP_THREAD_LOCAL Array1D< Real64 > ZVT;
+		static EP_THREAD_LOCAL bool OneTimeFlag( true );
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
@@ -8198,6 +8956,8 @@ namespace SolarShading {
 
 		// Using/Aliasing
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+		using DataSystemVariables::NumberShadowThreads;
+		using DataSystemVariables::ParallelLoopThreads;
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS:
@@ -8240,6 +9000,9 @@ namespace SolarShading {
 
 		// FLOW:
 
+		static int const ProfileZoneNum( Profiler::RegisterProfileZone( "SkyDifSolarShading" ) );
+		Profiler::ProfileZone const Profile( ProfileZoneNum );
+
 		// Initialize Surfaces Arrays
 		SAREA = 0.0;
 		WithShdgIsoSky.dimension( TotSurfaces, 0.0 );
@@ -8282,6 +9045,54 @@ namespace SolarShading {
 		DThetaDPhi = DTheta * DPhi;
 		PhiMin = 0.5 * DPhi; // 7.5 deg for DPhi = 15 deg
 
+		// The patches are shadowed independently, in parallel and from the sunlit fraction cache when
+		// there is one, and their sunlit areas are summed below in patch order
+		int const NumPatches( NPhi * NTheta );
+		Array2D< Real64 > PatchSAREA( TotSurfaces, NumPatches, 0.0 ); // Sunlit area of each surface by patch
+		int const nPatchThreads( ParallelLoopThreads( NumberShadowThreads, NumPatches ) );
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nPatchThreads) if(nPatchThreads > 1)
+#endif
+		for ( int IPatch = 1; IPatch <= NumPatches; ++IPatch ) {
+			if ( nPatchThreads > 1 ) AllocateShadowingThreadArrays();
+			int const PatchPhi( ( IPatch - 1 ) / NTheta + 1 );
+			int const PatchTheta( IPatch - ( PatchPhi - 1 ) * NTheta );
+			Real64 const PatchAltitude( PhiMin + ( PatchPhi - 1 ) * DPhi );
+			Real64 const PatchAzimuth( ( PatchTheta - 1 ) * DTheta );
+			Real64 const CosPatchAltitude( std::cos( PatchAltitude ) );
+			SUNCOS( 3 ) = std::sin( PatchAltitude );
+			SUNCOS( 1 ) = CosPatchAltitude * std::cos( PatchAzimuth );
+			SUNCOS( 2 ) = CosPatchAltitude * std::sin( PatchAzimuth );
+
+			for ( int PatchSurfNum = 1; PatchSurfNum <= TotSurfaces; ++PatchSurfNum ) { // Cosine of angle of incidence on surface of solar
+				// radiation from patch
+				if ( ! Surface( PatchSurfNum ).ShadowingSurf && ! Surface( PatchSurfNum ).HeatTransSurf ) continue;
+
+				CTHETA( PatchSurfNum ) = SUNCOS( 1 ) * Surface( PatchSurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( PatchSurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( PatchSurfNum ).OutNormVec( 3 );
+			}
+
+			bool FromCache( false ); // True if the SHADOW results were restored from the cache file
+			if ( ShadowCache.Active ) {
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (ShadowCacheFile)
+#endif
+				FromCache = RestoreShadowFromCache( 0, 0 );
+			}
+			if ( ! FromCache ) {
+				SHADOW( 0, 0 );
+				if ( ShadowCache.Active ) {
+#ifdef HBIRE_USE_OMP
+#pragma omp critical (ShadowCacheFile)
+#endif
+					SaveShadowToCache( 0, 0 );
+				}
+			}
+
+			for ( int PatchSurfNum = 1; PatchSurfNum <= TotSurfaces; ++PatchSurfNum ) {
+				PatchSAREA( PatchSurfNum, IPatch ) = SAREA( PatchSurfNum );
+			}
+		}
+
 		for ( IPhi = 1; IPhi <= NPhi; ++IPhi ) { // Loop over patch altitude values
 			Phi = PhiMin + ( IPhi - 1 ) * DPhi; // 7.5,22.5,37.5,52.5,67.5,82.5 for NPhi = 6
 			SUNCOS( 3 ) = std::sin( Phi );
@@ -8291,6 +9102,7 @@ namespace SolarShading {
 				Theta = ( ITheta - 1 ) * DTheta; // 0,15,30,....,330,345 for NTheta = 24
 				SUNCOS( 1 ) = CosPhi * std::cos( Theta );
 				SUNCOS( 2 ) = CosPhi * std::sin( Theta );
+				int const IPatch( ( IPhi - 1 ) * NTheta + ITheta );
 
 				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Cosine of angle of incidence on surface of solar
 					// radiation from patch
@@ -8301,8 +9113,6 @@ namespace SolarShading {
 					CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
 				}
 
-				SHADOW( 0, 0 );
-
 				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 					ShadowingSurf = Surface( SurfNum ).ShadowingSurf;
 
@@ -8313,9 +9123,9 @@ namespace SolarShading {
 					Fac1WoShdg = CosPhi * DThetaDPhi * CTHETA( SurfNum );
 					SurfArea = Surface( SurfNum ).NetAreaShadowCalc;
 					if ( SurfArea > Eps ) {
-						FracIlluminated = SAREA( SurfNum ) / SurfArea;
+						FracIlluminated = PatchSAREA( SurfNum, IPatch ) / SurfArea;
 					} else {
-						FracIlluminated = SAREA( SurfNum ) / ( SurfArea + Eps );
+						FracIlluminated = PatchSAREA( SurfNum, IPatch ) / ( SurfArea + Eps );
 					}
 					Fac1WithShdg = Fac1WoShdg * FracIlluminated;
 					WithShdgIsoSky( SurfNum ) += Fac1WithShdg;
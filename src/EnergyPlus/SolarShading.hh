@@ -2,7 +2,12 @@
 #define SolarShading_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
@@ -52,77 +57,159 @@ namespace SolarShading {
 	// (needs to be based on maxnumvertices)
 	extern int MaxHCS; // 200      ! Maximum number of HC surfaces (was 56)
 	// Following are initially set in AllocateModuleArrays
-	extern int MAXHCArrayBounds; // Bounds based on Max Number of Vertices in surfaces
+	extern EP_THREAD_LOCAL int MAXHCArrayBounds; // Bounds based on Max Number of Vertices in surfaces
 	extern int MAXHCArrayIncrement; // Increment based on Max Number of Vertices in surfaces
 	// The following variable should be re-engineered to lower in module hierarchy but need more analysis
-	extern int NVS; // Number of vertices of the shadow/clipped surface
-	extern int NumVertInShadowOrClippedSurface;
-	extern int CurrentSurfaceBeingShadowed;
-	extern int CurrentShadowingSurface;
-	extern int OverlapStatus; // Results of overlap calculation:
+	extern EP_THREAD_LOCAL int NVS; // Number of vertices of the shadow/clipped surface
+	extern EP_THREAD_LOCAL int NumVertInShadowOrClippedSurface;
+	extern EP_THREAD_LOCAL int CurrentSurfaceBeingShadowed;
+	extern EP_THREAD_LOCAL int CurrentShadowingSurface;
+	extern EP_THREAD_LOCAL int OverlapStatus; // Results of overlap calculation:
 	// 1=No overlap; 2=NS1 completely within NS2
 	// 3=NS2 completely within NS1; 4=Partial overlap
 
-	extern Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
-	extern int FBKSHC; // HC location of first back surface
-	extern int FGSSHC; // HC location of first general shadowing surface
-	extern int FINSHC; // HC location of first back surface overlap
-	extern int FRVLHC; // HC location of first reveal surface
-	extern int FSBSHC; // HC location of first subsurface
-	extern int LOCHCA; // Location of highest data in the HC arrays
-	extern int NBKSHC; // Number of back surfaces in the HC arrays
-	extern int NGSSHC; // Number of general shadowing surfaces in the HC arrays
-	extern int NINSHC; // Number of back surface overlaps in the HC arrays
-	extern int NRVLHC; // Number of reveal surfaces in HC array
-	extern int NSBSHC; // Number of subsurfaces in the HC arrays
+	extern EP_THREAD_LOCAL Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
+	extern EP_THREAD_LOCAL int FBKSHC; // HC location of first back surface
+	extern EP_THREAD_LOCAL int FGSSHC; // HC location of first general shadowing surface
+	extern EP_THREAD_LOCAL int FINSHC; // HC location of first back surface overlap
+	extern EP_THREAD_LOCAL int FRVLHC; // HC location of first reveal surface
+	extern EP_THREAD_LOCAL int FSBSHC; // HC location of first subsurface
+	extern EP_THREAD_LOCAL int LOCHCA; // Location of highest data in the HC arrays
+	extern EP_THREAD_LOCAL int NBKSHC; // Number of back surfaces in the HC arrays
+	extern EP_THREAD_LOCAL int NGSSHC; // Number of general shadowing surfaces in the HC arrays
+	extern EP_THREAD_LOCAL int NINSHC; // Number of back surface overlaps in the HC arrays
+	extern EP_THREAD_LOCAL int NRVLHC; // Number of reveal surfaces in HC array
+	extern EP_THREAD_LOCAL int NSBSHC; // Number of subsurfaces in the HC arrays
 	extern bool CalcSkyDifShading; // True when sky diffuse solar shading is
 	extern int ShadowingCalcFrequency; // Frequency for Shadowing Calculations
 	extern int ShadowingDaysLeft; // Days left in current shadowing period
 	extern bool debugging;
 	extern std::ofstream shd_stream; // Shading file stream
-	extern Array1D_int HCNS; // Surface number of back surface HC figures
-	extern Array1D_int HCNV; // Number of vertices of each HC figure
-	extern Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
-	extern Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
+	extern EP_THREAD_LOCAL Array1D_int HCNS; // Surface number of back surface HC figures
+	extern EP_THREAD_LOCAL Array1D_int HCNV; // Number of vertices of each HC figure
+	extern EP_THREAD_LOCAL Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
+	extern EP_THREAD_LOCAL Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
+	extern EP_THREAD_LOCAL Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
+	extern EP_THREAD_LOCAL Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
+	extern EP_THREAD_LOCAL Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
 	extern Array3D_int WindowRevealStatus;
-	extern Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+	extern EP_THREAD_LOCAL Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
 	// - Positive, Shadow - Negative, Overlap between two shadows
 	// - positive, etc., so that sum of HC areas=base sunlit area
-	extern Array1D< Real64 > HCT; // Transmittance of each HC figure
+	extern EP_THREAD_LOCAL Array1D< Real64 > HCT; // Transmittance of each HC figure
 	extern Array1D< Real64 > ISABSF; // For simple interior solar distribution (in which all beam
 	// radiation entering zone is assumed to strike the floor),
 	// fraction of beam radiation absorbed by each floor surface
-	extern Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
+	extern EP_THREAD_LOCAL Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
 	// Excludes multiplier for windows
 	// Shadowing combinations data structure...See ShadowingCombinations type
 	extern int NumTooManyFigures;
 	extern int NumTooManyVertices;
 	extern int NumBaseSubSurround;
-	extern Array1D< Real64 > SUNCOS; // Direction cosines of solar position
-	extern Real64 XShadowProjection; // X projection of a shadow (formerly called C)
-	extern Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
-	extern Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
-	extern Array1D< Real64 > XVC; // X-vertices of the clipped figure
-	extern Array1D< Real64 > XVS; // X-vertices of the shadow
-	extern Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
-	extern Array1D< Real64 > YVC; // Y-vertices of the clipped figure
-	extern Array1D< Real64 > YVS; // Y-vertices of the shadow
-	extern Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
+	extern EP_THREAD_LOCAL Array1D< Real64 > SUNCOS; // Direction cosines of solar position
+	extern EP_THREAD_LOCAL Real64 XShadowProjection; // X projection of a shadow (formerly called C)
+	extern EP_THREAD_LOCAL Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
+	extern EP_THREAD_LOCAL Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
+	extern EP_THREAD_LOCAL Array1D< Real64 > XVC; // X-vertices of the clipped figure
+	extern EP_THREAD_LOCAL Array1D< Real64 > XVS; // X-vertices of the shadow
+	extern EP_THREAD_LOCAL Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
+	extern EP_THREAD_LOCAL Array1D< Real64 > YVC; // Y-vertices of the clipped figure
+	extern EP_THREAD_LOCAL Array1D< Real64 > YVS; // Y-vertices of the shadow
+	extern EP_THREAD_LOCAL Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	extern Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	extern Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	extern Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	extern Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	extern Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	extern EP_THREAD_LOCAL Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
+	extern EP_THREAD_LOCAL Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
+	extern EP_THREAD_LOCAL Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
+	extern EP_THREAD_LOCAL Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+	extern EP_THREAD_LOCAL Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	extern int maxNumberOfFigures;
 
+	// Sunlit fraction cache
+	extern Real64 const ShadowCacheSunQuantum; // Resolution of the quantized sun direction cosines of a cache key
+	extern int const ShadowCacheSkyPatchKey; // Added to the last key component of the sky patch records
+	extern int const ShadowCacheBmToDiffReflKey; // Added to the last key component of the beam-to-diffuse reflection records
+	extern int const ShadowCacheBmToBmReflKey; // Added to the last key component of the beam-to-beam reflection records
+	extern int const ShadowCacheSkyReflKey; // Last key component of the sky diffuse reflection record
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
 	// Types
 
+	struct ShadowCacheData
+	{
+		// On-disk cache of the SHADOW results (sunlit areas, sunlit fractions without reveal
+		// and interior back surface overlaps) keyed by the quantized sun direction.  The file is
+		// tied to the shadowing geometry through a hash, so any geometry change starts a new file.
+
+		// Members
+		bool Active; // True when SHADOW results are read from and written to the cache file
+		std::string FileName; // Cache file name
+		std::uint64_t GeometryHash; // Hash of the shadowing geometry the file belongs to
+		std::fstream File; // Cache file, records are appended as they are computed
+		std::map< std::tuple< int, int, int >, std::streamoff > Index; // Record offset of each cached sun direction
+		int NumHits; // Number of SHADOW calls satisfied from the cache
+		int NumMisses; // Number of SHADOW calls computed and added to the cache
+
+		// Default Constructor
+		ShadowCacheData() :
+			Active( false ),
+			GeometryHash( 0u ),
+			NumHits( 0 ),
+			NumMisses( 0 )
+		{}
+
+	};
+
+	struct ShadowCasterBVHNode
+	{
+		// Node of the bounding volume hierarchy over the possible shadow casting surfaces used
+		// by DetermineShadowingCombinations to avoid checking every casting/receiving pair.
+
+		// Members
+		Real64 XMin; // Bounding box of the casting surfaces below this node
+		Real64 XMax;
+		Real64 YMin;
+		Real64 YMax;
+		Real64 ZMin;
+		Real64 ZMax;
+		int Left; // Child nodes (0 based), -1 for a leaf
+		int Right;
+		int First; // Range of ShadowCasterBVHSurfs (0 based, Last excluded) below this node
+		int Last;
+
+		// Default Constructor
+		ShadowCasterBVHNode() :
+			XMin( 0.0 ),
+			XMax( 0.0 ),
+			YMin( 0.0 ),
+			YMax( 0.0 ),
+			ZMin( 0.0 ),
+			ZMax( 0.0 ),
+			Left( -1 ),
+			Right( -1 ),
+			First( 0 ),
+			Last( 0 )
+		{}
+
+	};
+
+	struct AnisoSkySurfaceData
+	{
+		// Exterior solar surfaces and their fixed geometry, gathered once by InitAnisoSkySurfaces
+		// so that AnisoSkyViewFactors can run over contiguous arrays (0 based) every timestep.
+
+		// Members
+		std::vector< int > SurfNum; // Surface number of each entry
+		std::vector< Real64 > OutNormX; // Outward normal vector of the surface
+		std::vector< Real64 > OutNormY;
+		std::vector< Real64 > OutNormZ;
+		std::vector< Real64 > ViewFactorSky; // Geometrical sky view factor
+		std::vector< Real64 > SinTilt; // Sine of the surface tilt
+		std::vector< int > NearHorizontal; // 1 when the tilt is below 2 deg
+		std::vector< Real64 > CircumSolarFac; // Ratio of cosine of incidence angle to cosine of zenith angle
+
+	};
+
 	struct SurfaceErrorTracking
 	{
 		// Members
@@ -154,6 +241,10 @@ namespace SolarShading {
 	extern Array1D< SurfaceErrorTracking > TrackTooManyFigures;
 	extern Array1D< SurfaceErrorTracking > TrackTooManyVertices;
 	extern Array1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	extern ShadowCacheData ShadowCache;
+	extern std::vector< ShadowCasterBVHNode > ShadowCasterBVH; // Node 0 is the root
+	extern std::vector< int > ShadowCasterBVHSurfs; // Casting surfaces ordered by BVH leaf
+	extern AnisoSkySurfaceData AnisoSkySurfaces;
 
 	// Functions
 
@@ -166,6 +257,9 @@ namespace SolarShading {
 	void
 	AllocateModuleArrays();
 
+	void
+	InitAnisoSkySurfaces();
+
 	void
 	AnisoSkyViewFactors();
 
@@ -295,6 +389,9 @@ namespace SolarShading {
 		Real64 const AvgCosSolarDeclin // Average value of Cosine of Solar Declination for period
 	);
 
+	void
+	AllocateShadowingThreadArrays();
+
 	void
 	FigureSunCosines(
 		int const iHour,
@@ -310,6 +407,55 @@ namespace SolarShading {
 		int const iTimeStep
 	);
 
+	std::uint64_t
+	ShadowGeometryHash();
+
+	void
+	InitShadowCache( std::string const & FileName ); // Cache file name, empty for no cache
+
+	std::tuple< int, int, int >
+	ShadowCacheKey( int const iHour ); // Hour index, 0 for a sky patch
+
+	bool
+	RestoreShadowFromCache(
+		int const iHour, // Hour index
+		int const iTimeStep // Time Step
+	);
+
+	void
+	SaveShadowToCache(
+		int const iHour, // Hour index
+		int const iTimeStep // Time Step
+	);
+
+	bool
+	RestoreFactorsFromCache(
+		std::tuple< int, int, int > const & Key, // Record key
+		std::vector< Real64 > & Factors // Factors of the record, resized by the caller (zero if not in the record)
+	);
+
+	void
+	SaveFactorsToCache(
+		std::tuple< int, int, int > const & Key, // Record key
+		std::vector< Real64 > const & Factors // Factors to keep
+	);
+
+	void
+	BuildShadowCasterBVH( std::vector< int > const & Casters ); // Possible shadow casting surfaces
+
+	int
+	BuildShadowCasterBVHNode(
+		int const First, // First entry of ShadowCasterBVHSurfs in the node (0 based)
+		int const Last // One past the last entry of ShadowCasterBVHSurfs in the node
+	);
+
+	void
+	GatherShadowCasterCandidates(
+		int const NRS, // Surface number of the potential shadow receiving surface
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > & Candidates // Casting surfaces not ruled out by their bounding boxes
+	);
+
 	void
 	DetermineShadowingCombinations();
 
@@ -319,6 +465,13 @@ namespace SolarShading {
 		int const TS // Time Step
 	);
 
+	void
+	ShadowReceivingSurface(
+		int const iHour, // Hour index
+		int const TS, // Time Step
+		int const GRSNR // Surface number of general receiving surface
+	);
+
 	void
 	SHDBKS(
 		int const NGRS, // Number of the general receiving surface
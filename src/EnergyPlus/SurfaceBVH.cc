@@ -0,0 +1,256 @@
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Fmath.hh>
+
+// EnergyPlus Headers
+#include <SurfaceBVH.hh>
+#include <DataSurfaces.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceBVH {
+
+	// PURPOSE OF THIS MODULE:
+	// Bounding volume hierarchy over the building surfaces for the ray casting of the
+	// daylighting and the solar reflection calculations.
+
+	// METHODOLOGY EMPLOYED:
+	// Axis aligned bounding boxes, split at the median box center along the longest axis of
+	// the node until a node holds a few surfaces (as for the shadow casting hierarchy in
+	// SolarShading).  A query gives the surfaces whose box the ray passes through; the exact
+	// intersection test of each caller is still done for each of them, in surface order, so
+	// the results do not depend on the hierarchy.
+
+	// REFERENCES: na
+
+	// OTHER NOTES: na
+
+	// Using/Aliasing
+	using namespace DataSurfaces;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	Real64 const BoxTolerance( 1.0e-4 ); // Bounding boxes are enlarged by this much (m) so grazing rays are kept
+
+	// Object Data
+	SurfaceBVHData AllSurfaces; // Every surface of the building, built after the surface input
+
+	// Functions
+
+	void
+	BuildAllSurfacesBVH()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the hierarchy over all surfaces once their vertices are final.
+
+		std::vector< int > SurfNums;
+		SurfNums.reserve( TotSurfaces );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( Surface( SurfNum ).Sides >= 3 ) SurfNums.push_back( SurfNum );
+		}
+		BuildSurfaceBVH( AllSurfaces, SurfNums );
+
+	}
+
+	void
+	BuildSurfaceBVH(
+		SurfaceBVHData & Tree,
+		std::vector< int > const & SurfNums // Surfaces held by the hierarchy
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the hierarchy over the given surfaces.
+
+		Tree.Nodes.clear();
+		Tree.Surfs = SurfNums;
+		if ( ! SurfNums.empty() ) {
+			Tree.Nodes.reserve( 2 * SurfNums.size() );
+			BuildSurfaceBVHNode( Tree, 0, int( SurfNums.size() ) );
+		}
+		Tree.Built = true;
+
+	}
+
+	int
+	BuildSurfaceBVHNode(
+		SurfaceBVHData & Tree,
+		int const First, // First entry of Tree.Surfs in the node (0 based)
+		int const Last // One past the last entry of Tree.Surfs in the node
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Adds the node holding Tree.Surfs[First:Last) and its children; returns the node index.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxLeafSurfs( 4 ); // Nodes with no more surfaces than this are not split
+
+		int const NodeNum( int( Tree.Nodes.size() ) );
+		Tree.Nodes.push_back( SurfaceBVHNode() );
+
+		SurfaceBVHNode Node;
+		Node.First = First;
+		Node.Last = Last;
+		Node.XMin = Node.YMin = Node.ZMin = std::numeric_limits< Real64 >::max();
+		Node.XMax = Node.YMax = Node.ZMax = std::numeric_limits< Real64 >::lowest();
+		Real64 CXMin( Node.XMin ), CYMin( Node.YMin ), CZMin( Node.ZMin ); // Box center bounds
+		Real64 CXMax( Node.XMax ), CYMax( Node.YMax ), CZMax( Node.ZMax );
+		std::vector< Real64 > CX, CY, CZ; // Box centers of the surfaces
+		CX.reserve( Last - First );
+		CY.reserve( Last - First );
+		CZ.reserve( Last - First );
+		for ( int i = First; i < Last; ++i ) {
+			auto const & surface( Surface( Tree.Surfs[ i ] ) );
+			Real64 SXMin( std::numeric_limits< Real64 >::max() ), SYMin( SXMin ), SZMin( SXMin );
+			Real64 SXMax( std::numeric_limits< Real64 >::lowest() ), SYMax( SXMax ), SZMax( SXMax );
+			for ( int Vert = 1; Vert <= surface.Sides; ++Vert ) {
+				auto const & vertex( surface.Vertex( Vert ) );
+				SXMin = min( SXMin, vertex.x );
+				SXMax = max( SXMax, vertex.x );
+				SYMin = min( SYMin, vertex.y );
+				SYMax = max( SYMax, vertex.y );
+				SZMin = min( SZMin, vertex.z );
+				SZMax = max( SZMax, vertex.z );
+			}
+			Node.XMin = min( Node.XMin, SXMin - BoxTolerance );
+			Node.XMax = max( Node.XMax, SXMax + BoxTolerance );
+			Node.YMin = min( Node.YMin, SYMin - BoxTolerance );
+			Node.YMax = max( Node.YMax, SYMax + BoxTolerance );
+			Node.ZMin = min( Node.ZMin, SZMin - BoxTolerance );
+			Node.ZMax = max( Node.ZMax, SZMax + BoxTolerance );
+			CX.push_back( 0.5 * ( SXMin + SXMax ) );
+			CY.push_back( 0.5 * ( SYMin + SYMax ) );
+			CZ.push_back( 0.5 * ( SZMin + SZMax ) );
+			CXMin = min( CXMin, CX.back() );
+			CXMax = max( CXMax, CX.back() );
+			CYMin = min( CYMin, CY.back() );
+			CYMax = max( CYMax, CY.back() );
+			CZMin = min( CZMin, CZ.back() );
+			CZMax = max( CZMax, CZ.back() );
+		}
+
+		if ( Last - First > MaxLeafSurfs ) {
+			// Split at the median box center along the axis with the largest spread of centers
+			int Axis( 1 );
+			if ( CYMax - CYMin > CXMax - CXMin ) Axis = 2;
+			if ( CZMax - CZMin > max( CXMax - CXMin, CYMax - CYMin ) ) Axis = 3;
+			std::vector< Real64 > const & C( Axis == 1 ? CX : ( Axis == 2 ? CY : CZ ) );
+			std::vector< std::pair< Real64, int > > Order;
+			Order.reserve( Last - First );
+			for ( int i = First; i < Last; ++i ) {
+				Order.push_back( std::make_pair( C[ i - First ], Tree.Surfs[ i ] ) );
+			}
+			int const Mid( First + ( Last - First ) / 2 );
+			std::nth_element( Order.begin(), Order.begin() + ( Mid - First ), Order.end() );
+			for ( int i = First; i < Last; ++i ) Tree.Surfs[ i ] = Order[ i - First ].second;
+			Node.Left = BuildSurfaceBVHNode( Tree, First, Mid );
+			Node.Right = BuildSurfaceBVHNode( Tree, Mid, Last );
+		}
+
+		Tree.Nodes[ NodeNum ] = Node;
+		return NodeNum;
+
+	}
+
+	void
+	RayCandidates(
+		SurfaceBVHData const & Tree,
+		Real64 const OrigX, // Origin of ray (m)
+		Real64 const OrigY,
+		Real64 const OrigZ,
+		Real64 const DirX, // Direction of ray
+		Real64 const DirY,
+		Real64 const DirZ,
+		Real64 const MaxDist, // Rays are followed this far, in units of the direction vector length
+		std::vector< int > & Candidates // Surfaces whose box the ray passes through, in surface order
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gives the surfaces of the hierarchy the ray from the origin along the direction may hit
+		// before MaxDist.
+
+		// METHODOLOGY EMPLOYED:
+		// Slab test of the ray against the node boxes.  A hierarchy that has not been built
+		// gives all surfaces, so callers never miss an obstruction.
+
+		Candidates.clear();
+		if ( ! Tree.Built ) {
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) Candidates.push_back( SurfNum );
+			return;
+		}
+		if ( Tree.Nodes.empty() ) return;
+
+		Real64 const Orig[ 3 ] = { OrigX, OrigY, OrigZ };
+		Real64 const Dir[ 3 ] = { DirX, DirY, DirZ };
+
+		static EP_THREAD_LOCAL std::vector< int > Stack; // Nodes still to visit
+		Stack.clear();
+		Stack.push_back( 0 );
+		while ( ! Stack.empty() ) {
+			auto const & node( Tree.Nodes[ Stack.back() ] );
+			Stack.pop_back();
+			Real64 const BoxMin[ 3 ] = { node.XMin, node.YMin, node.ZMin };
+			Real64 const BoxMax[ 3 ] = { node.XMax, node.YMax, node.ZMax };
+			Real64 TNear( 0.0 );
+			Real64 TFar( MaxDist );
+			bool Hit( true );
+			for ( int Axis = 0; Axis < 3 && Hit; ++Axis ) {
+				if ( std::abs( Dir[ Axis ] ) < 1.0e-12 ) {
+					// Ray parallel to the slab: inside it or never
+					if ( Orig[ Axis ] < BoxMin[ Axis ] || Orig[ Axis ] > BoxMax[ Axis ] ) Hit = false;
+				} else {
+					Real64 const InvDir( 1.0 / Dir[ Axis ] );
+					Real64 T1( ( BoxMin[ Axis ] - Orig[ Axis ] ) * InvDir );
+					Real64 T2( ( BoxMax[ Axis ] - Orig[ Axis ] ) * InvDir );
+					if ( T1 > T2 ) std::swap( T1, T2 );
+					TNear = max( TNear, T1 );
+					TFar = min( TFar, T2 );
+					if ( TNear > TFar ) Hit = false;
+				}
+			}
+			if ( ! Hit ) continue;
+			if ( node.Left < 0 ) {
+				Candidates.insert( Candidates.end(), Tree.Surfs.begin() + node.First, Tree.Surfs.begin() + node.Last );
+			} else {
+				Stack.push_back( node.Right );
+				Stack.push_back( node.Left );
+			}
+		}
+		std::sort( Candidates.begin(), Candidates.end() );
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // SurfaceBVH
+
+} // EnergyPlus
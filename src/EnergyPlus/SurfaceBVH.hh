@@ -0,0 +1,128 @@
+#ifndef SurfaceBVH_hh_INCLUDED
+#define SurfaceBVH_hh_INCLUDED
+
+// C++ Headers
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceBVH {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern Real64 const BoxTolerance; // Bounding boxes are enlarged by this much (m) so grazing rays are kept
+
+	// Types
+
+	struct SurfaceBVHNode
+	{
+		// Members
+		Real64 XMin; // Bounding box of the surfaces below this node
+		Real64 XMax;
+		Real64 YMin;
+		Real64 YMax;
+		Real64 ZMin;
+		Real64 ZMax;
+		int Left; // Child nodes (0 based), -1 for a leaf
+		int Right;
+		int First; // Range of SurfaceBVHData::Surfs (0 based, Last excluded) below this node
+		int Last;
+
+		// Default Constructor
+		SurfaceBVHNode() :
+			XMin( 0.0 ),
+			XMax( 0.0 ),
+			YMin( 0.0 ),
+			YMax( 0.0 ),
+			ZMin( 0.0 ),
+			ZMax( 0.0 ),
+			Left( -1 ),
+			Right( -1 ),
+			First( 0 ),
+			Last( 0 )
+		{}
+
+	};
+
+	struct SurfaceBVHData
+	{
+		// Bounding volume hierarchy over a set of surfaces, used to find the surfaces a ray may
+		// hit without testing each of them.
+
+		// Members
+		bool Built; // True once the hierarchy has been built
+		std::vector< SurfaceBVHNode > Nodes; // Node 0 is the root
+		std::vector< int > Surfs; // Surface numbers ordered by leaf
+
+		// Default Constructor
+		SurfaceBVHData() :
+			Built( false )
+		{}
+
+	};
+
+	// Object Data
+	extern SurfaceBVHData AllSurfaces; // Every surface of the building, built after the surface input
+
+	// Functions
+
+	void
+	BuildAllSurfacesBVH();
+
+	void
+	BuildSurfaceBVH(
+		SurfaceBVHData & Tree,
+		std::vector< int > const & SurfNums // Surfaces held by the hierarchy
+	);
+
+	int
+	BuildSurfaceBVHNode(
+		SurfaceBVHData & Tree,
+		int const First, // First entry of Tree.Surfs in the node (0 based)
+		int const Last // One past the last entry of Tree.Surfs in the node
+	);
+
+	void
+	RayCandidates(
+		SurfaceBVHData const & Tree,
+		Real64 const OrigX, // Origin of ray (m)
+		Real64 const OrigY,
+		Real64 const OrigZ,
+		Real64 const DirX, // Direction of ray
+		Real64 const DirY,
+		Real64 const DirZ,
+		Real64 const MaxDist, // Rays are followed this far, in units of the direction vector length
+		std::vector< int > & Candidates // Surfaces whose box the ray passes through, in surface order
+	);
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // SurfaceBVH
+
+} // EnergyPlus
+
+#endif
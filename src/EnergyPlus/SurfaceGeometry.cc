@@ -2,6 +2,8 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -20,6 +22,7 @@
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataReportingFlags.hh>
+#include <DataSystemVariables.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
@@ -28,6 +31,7 @@
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <ScheduleManager.hh>
+#include <SurfaceBVH.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 
@@ -108,6 +112,10 @@ namespace SurfaceGeometry {
 
 	// Object Data
 	Array1D< SurfaceData > SurfaceTmp; // Allocated/Deallocated during input processing
+	std::unordered_map< std::string, int > SurfaceTmpNames; // SurfaceTmp number by name, as set by SetSurfaceTmpName
+	std::unordered_map< std::string, int > SurfaceTmpNamesUC; // SurfaceTmp number by upper case name
+	std::unordered_map< std::string, int > ZoneNames; // Zone number by name, for the zones numbered up to NumZonesNamed
+	int NumZonesNamed( 0 );
 
 	// Functions
 
@@ -567,6 +575,9 @@ namespace SurfaceGeometry {
 		// Do the Stratosphere check
 		SetOutBulbTempAt( NumOfZones, Zone( {1,NumOfZones} ).ma( &ZoneData::Centroid ).z(), Zone( {1,NumOfZones} ).OutDryBulbTemp(), Zone( {1,NumOfZones} ).OutWetBulbTemp(), "Zone" );
 
+		// Surface vertices are final; build the hierarchy used by the obstruction ray tests
+		SurfaceBVH::BuildAllSurfacesBVH();
+
 		//  IF (ALLOCATED(ZoneSurfacesCount)) DEALLOCATE(ZoneSurfacesCount)
 		//  IF (ALLOCATED(ZoneSubSurfacesCount)) DEALLOCATE(ZoneSubSurfacesCount)
 		//  IF (ALLOCATED(ZoneShadingSurfacesCount)) DEALLOCATE(ZoneShadingSurfacesCount)
@@ -633,6 +644,246 @@ namespace SurfaceGeometry {
 
 	}
 
+	void
+	ClearSurfaceNames()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Empties the name indexes of SurfaceTmp and of the zones, as SurfaceTmp is made or released.
+
+		SurfaceTmpNames.clear();
+		SurfaceTmpNamesUC.clear();
+		ZoneNames.clear();
+		NumZonesNamed = 0;
+
+	}
+
+	void
+	SetSurfaceTmpName(
+		int const SurfNum, // Surface in SurfaceTmp
+		std::string const & Name
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Names a surface of SurfaceTmp, keeping the name indexes up to date.
+
+		// METHODOLOGY EMPLOYED:
+		// An index keeps the first surface named with each name; an entry left behind by a surface
+		// since renamed is replaced.  A lookup checks the entry against the surface, so an entry
+		// still left behind only sends it to a search of the list.
+
+		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
+		using InputProcessor::SameString;
+
+		std::string const & SurfName( SurfaceTmp( SurfNum ).Name = Name );
+		auto const Found( SurfaceTmpNames.find( SurfName ) );
+		if ( Found == SurfaceTmpNames.end() || SurfaceTmp( Found->second ).Name != SurfName ) SurfaceTmpNames[ SurfName ] = SurfNum;
+		std::string const SurfNameUC( MakeUPPERCase( SurfName ) );
+		auto const FoundUC( SurfaceTmpNamesUC.find( SurfNameUC ) );
+		if ( FoundUC == SurfaceTmpNamesUC.end() || ! SameString( SurfaceTmp( FoundUC->second ).Name, SurfNameUC ) ) SurfaceTmpNamesUC[ SurfNameUC ] = SurfNum;
+
+	}
+
+	int
+	FindSurfaceTmp(
+		std::string const & Name,
+		int const NumSurfaces // Surfaces of SurfaceTmp searched, from the first
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the first surface of SurfaceTmp with this name, as FindItemInList on the surface
+		// names does, or 0 if there is none.
+
+		// Using/Aliasing
+		using InputProcessor::FindItemInList;
+
+		auto const Found( SurfaceTmpNames.find( Name ) );
+		if ( Found == SurfaceTmpNames.end() ) return 0;
+		int const SurfNum( Found->second );
+		if ( SurfNum <= NumSurfaces && SurfaceTmp( SurfNum ).Name == Name ) return SurfNum;
+		return FindItemInList( Name, SurfaceTmp.Name(), min( NumSurfaces, int( SurfaceTmp.size() ) ) );
+
+	}
+
+	void
+	VerifySurfaceTmpName(
+		std::string const & NameToVerify,
+		int const NumOfNames, // Surfaces of SurfaceTmp already named
+		bool & ErrorFound,
+		bool & IsBlank,
+		std::string const & StringToDisplay
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Checks the name of a new surface as VerifyName does on the surface names of SurfaceTmp,
+		// through the name indexes.
+
+		// Using/Aliasing
+		using InputProcessor::FindItem;
+		using InputProcessor::MakeUPPERCase;
+		using InputProcessor::SameString;
+
+		int Found( 0 );
+
+		ErrorFound = false;
+		if ( NumOfNames > 0 ) {
+			Found = FindSurfaceTmp( NameToVerify, NumOfNames );
+			if ( Found == 0 ) { // As FindItem, match the name regardless of case
+				std::string const NameUC( MakeUPPERCase( NameToVerify ) );
+				auto const FoundUC( SurfaceTmpNamesUC.find( NameUC ) );
+				if ( FoundUC != SurfaceTmpNamesUC.end() ) {
+					Found = FoundUC->second;
+					if ( Found > NumOfNames || ! SameString( SurfaceTmp( Found ).Name, NameUC ) ) Found = FindItem( NameToVerify, SurfaceTmp.Name(), min( NumOfNames, int( SurfaceTmp.size() ) ) );
+				}
+			}
+			if ( Found != 0 ) {
+				ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify );
+				ErrorFound = true;
+			}
+		}
+
+		if ( NameToVerify.empty() ) {
+			ShowSevereError( StringToDisplay + ", cannot be blank" );
+			ErrorFound = true;
+			IsBlank = true;
+		} else {
+			IsBlank = false;
+		}
+
+	}
+
+	int
+	FindZoneNum( std::string const & Name )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the first zone with this name, as FindItemInList on the zone names does, or 0 if
+		// there is none.  The zones are indexed by name when first looked up.
+
+		// Using/Aliasing
+		using DataGlobals::NumOfZones;
+		using DataHeatBalance::Zone;
+		using InputProcessor::FindItemInList;
+
+		if ( NumZonesNamed != NumOfZones ) {
+			ZoneNames.clear();
+			for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) ZoneNames.emplace( Zone( ZoneNum ).Name, ZoneNum );
+			NumZonesNamed = NumOfZones;
+		}
+		auto const Found( ZoneNames.find( Name ) );
+		if ( Found == ZoneNames.end() ) return 0;
+		if ( Zone( Found->second ).Name == Name ) return Found->second;
+		return FindItemInList( Name, Zone.Name(), NumOfZones );
+
+	}
+
+	void
+	MergeCoplanarSurfaceTmp( int & NumSurfaces ) // Surfaces of SurfaceTmp, less those merged on return
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Merges the coplanar base surfaces of a zone that share their construction and exterior
+		// condition into one heat transfer surface, so that a model made of many small pieces of the
+		// same wall, roof or floor simulates few surfaces.
+
+		// METHODOLOGY EMPLOYED:
+		// Only a surface nothing else depends on is merged: a wall, roof or floor facing the outdoors
+		// or the ground, without subsurfaces, and named by no input object but itself and output
+		// variable requests.  The first surface of each coplanar group is kept with the area of the
+		// whole group; its vertices stay those of its own piece, which is what the shading and
+		// daylighting calculations see.  The output variables requested for a merged surface are
+		// reported for the surface it went into, and each merge is listed in the eio file.
+
+		// Using/Aliasing
+		using InputProcessor::IDFRecords;
+		using InputProcessor::MakeUPPERCase;
+		using InputProcessor::NumIDFRecords;
+		using OutputProcessor::AddReportKeyAlias;
+		using General::RoundSigDigits;
+		using namespace Vectors;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+		Real64 const NormalTolerance( 1.0e-6 ); // Largest 1 - cosine of the angle between the outward normals of coplanar surfaces
+		Real64 const PlaneTolerance( 0.001 ); // Largest distance (m) of a coplanar surface from the plane of another
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::unordered_map< std::string, int > NameReferences; // Times each name is given in the input, by upper case name
+		std::vector< int > Candidates; // Surfaces that may be merged
+		Array1D_int MergedInto( NumSurfaces, 0 ); // Surface each surface is merged into, 0 if kept
+		Array1D_int NewSurfNum( NumSurfaces, 0 ); // Number of each kept surface once the merged ones are removed
+		int NumMerged( 0 );
+		int NumKept( 0 );
+
+		for ( int Loop = 1; Loop <= NumIDFRecords; ++Loop ) {
+			auto const & record( IDFRecords( Loop ) );
+			if ( record.Name == "OUTPUT:VARIABLE" ) continue;
+			for ( int Alpha = 1; Alpha <= record.NumAlphas; ++Alpha ) {
+				if ( ! record.AlphBlank( Alpha ) ) ++NameReferences[ MakeUPPERCase( record.Alphas( Alpha ) ) ];
+			}
+		}
+
+		for ( int SurfNum = 1; SurfNum <= NumSurfaces; ++SurfNum ) {
+			auto const & surf( SurfaceTmp( SurfNum ) );
+			if ( ! surf.HeatTransSurf || surf.Zone == 0 || surf.Sides < 3 ) continue;
+			if ( surf.Class != SurfaceClass_Wall && surf.Class != SurfaceClass_Floor && surf.Class != SurfaceClass_Roof ) continue;
+			if ( surf.BaseSurf != SurfNum || surf.NumSubSurfaces > 0 ) continue;
+			if ( surf.ExtBoundCond != ExternalEnvironment && surf.ExtBoundCond != Ground && surf.ExtBoundCond != GroundFCfactorMethod ) continue;
+			auto const Found( NameReferences.find( MakeUPPERCase( surf.Name ) ) );
+			if ( Found == NameReferences.end() || Found->second != 1 ) continue;
+			Candidates.push_back( SurfNum );
+		}
+
+		for ( auto Into = Candidates.begin(); Into != Candidates.end(); ++Into ) {
+			if ( MergedInto( *Into ) != 0 ) continue;
+			auto & into( SurfaceTmp( *Into ) );
+			for ( auto Other = Into + 1; Other != Candidates.end(); ++Other ) {
+				if ( MergedInto( *Other ) != 0 ) continue;
+				auto const & other( SurfaceTmp( *Other ) );
+				if ( other.Zone != into.Zone || other.Class != into.Class || other.Construction != into.Construction ) continue;
+				if ( other.ExtBoundCond != into.ExtBoundCond || other.ExtSolar != into.ExtSolar || other.ExtWind != into.ExtWind ) continue;
+				if ( other.ViewFactorGround != into.ViewFactorGround ) continue;
+				if ( dot( into.NewellSurfaceNormalVector, other.NewellSurfaceNormalVector ) < 1.0 - NormalTolerance ) continue;
+				if ( std::abs( dot( into.NewellSurfaceNormalVector, other.Vertex( 1 ) - into.Vertex( 1 ) ) ) > PlaneTolerance ) continue;
+				MergedInto( *Other ) = *Into;
+				into.GrossArea += other.GrossArea;
+				into.Area += other.Area;
+				++into.MergedSurfaces;
+				++NumMerged;
+			}
+		}
+		if ( NumMerged == 0 ) return;
+
+		gio::write( OutputFileInits, fmtA ) << "! <Merged Surface>, Surface Name, Merged Into Surface Name, Zone Name";
+		for ( int SurfNum = 1; SurfNum <= NumSurfaces; ++SurfNum ) {
+			if ( MergedInto( SurfNum ) == 0 ) {
+				NewSurfNum( SurfNum ) = ++NumKept;
+				if ( NumKept != SurfNum ) SurfaceTmp( NumKept ) = SurfaceTmp( SurfNum );
+			} else {
+				auto const & into( SurfaceTmp( NewSurfNum( MergedInto( SurfNum ) ) ) );
+				gio::write( OutputFileInits, fmtA ) << " Merged Surface," + SurfaceTmp( SurfNum ).Name + ',' + into.Name + ',' + into.ZoneName;
+				AddReportKeyAlias( SurfaceTmp( SurfNum ).Name, into.Name );
+			}
+		}
+		for ( int SurfNum = 1; SurfNum <= NumKept; ++SurfNum ) {
+			if ( SurfaceTmp( SurfNum ).BaseSurf > 0 ) SurfaceTmp( SurfNum ).BaseSurf = NewSurfNum( SurfaceTmp( SurfNum ).BaseSurf );
+		}
+		ShowMessage( "Merged " + RoundSigDigits( NumMerged ) + " coplanar surfaces into others of the same construction and exterior condition; the merges are listed in the eio file." );
+
+		NumSurfaces = NumKept;
+		SurfaceTmp.redimension( NumSurfaces );
+		SurfaceWindow.redimension( NumSurfaces );
+		ClearSurfaceNames();
+		for ( int SurfNum = 1; SurfNum <= NumSurfaces; ++SurfNum ) {
+			SetSurfaceTmpName( SurfNum, std::string( SurfaceTmp( SurfNum ).Name ) );
+		}
+
+	}
+
 	void
 	GetSurfaceData( bool & ErrorsFound ) // If errors found in input
 	{
@@ -736,6 +987,7 @@ namespace SurfaceGeometry {
 		using ScheduleManager::GetScheduleMinValue;
 		using ScheduleManager::GetScheduleMaxValue;
 		using namespace DataErrorTracking;
+		using DataSystemVariables::MergeCoplanarSurfaces;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -925,6 +1177,7 @@ namespace SurfaceGeometry {
 		TotSurfaces = ( TotDetachedFixed + TotDetachedBldg + TotRectDetachedFixed + TotRectDetachedBldg ) * 2 + TotHTSurfs + TotHTSubs + TotShdSubs * 2 + TotIntMass + TotOverhangs * 2 + TotOverhangsProjection * 2 + TotFins * 4 + TotFinsProjection * 4 + TotDetailedWalls + TotDetailedRoofs + TotDetailedFloors + TotRectWindows + TotRectDoors + TotRectGlazedDoors + TotRectIZWindows + TotRectIZDoors + TotRectIZGlazedDoors + TotRectExtWalls + TotRectIntWalls + TotRectIZWalls + TotRectUGWalls + TotRectRoofs + TotRectCeilings + TotRectIZCeilings + TotRectGCFloors + TotRectIntFloors + TotRectIZFloors;
 
 		SurfaceTmp.allocate( TotSurfaces ); // Allocate the Surface derived type appropriately
+		ClearSurfaceNames();
 		// SurfaceTmp structure is allocated via derived type initialization.
 
 		SurfNum = 0;
@@ -966,8 +1219,6 @@ namespace SurfaceGeometry {
 		// add the "need to add" surfaces
 		//Debug    write(outputfiledebug,*) ' need to add ',NeedtoAddSurfaces+NeedToAddSubSurfaces
 		if ( NeedToAddSurfaces + NeedToAddSubSurfaces > 0 ) CurNewSurf = FirstTotalSurfaces;
-		auto const Zone_Name( Zone.Name() ); // Member array
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Surface_Name( Surface.Name() ); // Member array
 		for ( SurfNum = 1; SurfNum <= FirstTotalSurfaces; ++SurfNum ) {
 			if ( SurfaceTmp( SurfNum ).ExtBoundCond != UnenteredAdjacentZoneSurface ) continue;
@@ -976,7 +1227,7 @@ namespace SurfaceGeometry {
 			//Debug    write(outputfiledebug,*) ' adding surface=',curnewsurf
 			SurfaceTmp( CurNewSurf ) = SurfaceTmp( SurfNum );
 			//  Basic parameters are the same for both surfaces.
-			Found = FindItemInList( SurfaceTmp( SurfNum ).ExtBoundCondName, Zone_Name, NumOfZones );
+			Found = FindZoneNum( SurfaceTmp( SurfNum ).ExtBoundCondName );
 			if ( Found == 0 ) continue;
 			SurfaceTmp( CurNewSurf ).Zone = Found;
 			SurfaceTmp( CurNewSurf ).ZoneName = Zone( Found ).Name;
@@ -1023,7 +1274,7 @@ namespace SurfaceGeometry {
 			}
 
 			// Change Name
-			SurfaceTmp( CurNewSurf ).Name = "iz-" + SurfaceTmp( SurfNum ).Name;
+			SetSurfaceTmpName( CurNewSurf, "iz-" + SurfaceTmp( SurfNum ).Name );
 			//Debug   write(outputfiledebug,*) ' new surf name=',TRIM(SurfaceTmp(CurNewSurf)%Name)
 			//Debug   write(outputfiledebug,*) ' new surf in zone=',TRIM(surfacetmp(curnewsurf)%zoneName)
 			SurfaceTmp( CurNewSurf ).ExtBoundCond = UnreconciledZoneSurface;
@@ -1044,7 +1295,7 @@ namespace SurfaceGeometry {
 				//Debug        write(outputfiledebug,*) ' basesurf, extboundcondname=',TRIM(SurfaceTmp(CurNewSurf)%ExtBoundCondName)
 			} else {
 				// subsurface
-				Found = FindItemInList( "iz-" + SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, FirstTotalSurfaces + CurNewSurf - 1 );
+				Found = FindSurfaceTmp( "iz-" + SurfaceTmp( SurfNum ).BaseSurfName, FirstTotalSurfaces + CurNewSurf - 1 );
 				if ( Found > 0 ) {
 					SurfaceTmp( CurNewSurf ).BaseSurfName = "iz-" + SurfaceTmp( SurfNum ).BaseSurfName;
 					SurfaceTmp( CurNewSurf ).BaseSurf = Found;
@@ -1081,7 +1332,7 @@ namespace SurfaceGeometry {
 			if ( SameString( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp( SurfNum ).Name ) ) {
 				Found = SurfNum;
 			} else {
-				Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+				Found = FindSurfaceTmp( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 			}
 			if ( Found > 0 ) {
 				SurfaceTmp( SurfNum ).BaseSurf = Found;
@@ -1209,6 +1460,8 @@ namespace SurfaceGeometry {
 		//  ENDIF
 		//  DEALLOCATE(TestVertex)
 
+		if ( MergeCoplanarSurfaces && ! SurfError ) MergeCoplanarSurfaceTmp( TotSurfaces );
+
 		// The surfaces need to be hierarchical.  Input is allowed to be in any order.  In
 		// this section it is reordered into:
 
@@ -1305,6 +1558,7 @@ namespace SurfaceGeometry {
 		}
 
 		SurfaceTmp.deallocate(); // DeAllocate the Temp Surface derived type
+		ClearSurfaceNames();
 
 		//  For each Base Surface Type (Wall, Floor, Roof)
 
@@ -2344,7 +2598,6 @@ namespace SurfaceGeometry {
 
 		if ( ( TotDetachedFixed + TotDetachedBldg ) == 0 ) return;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 
 		for ( Item = 1; Item <= 2; ++Item ) {
 
@@ -2367,7 +2620,7 @@ namespace SurfaceGeometry {
 				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 				ErrorInName = false;
 				IsBlank = false;
-				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+				VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 				if ( ErrorInName ) {
 					ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 					ErrorsFound = true;
@@ -2375,7 +2628,7 @@ namespace SurfaceGeometry {
 				}
 
 				++SurfNum;
-				SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+				SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 				SurfaceTmp( SurfNum ).Class = ClassItem;
 				SurfaceTmp( SurfNum ).HeatTransSurf = false;
 				// Base transmittance of a shadowing (sub)surface
@@ -2507,7 +2760,6 @@ namespace SurfaceGeometry {
 
 		if ( TotRectDetachedFixed + TotRectDetachedBldg == 0 ) return;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 
 		for ( Item = 1; Item <= 2; ++Item ) {
 
@@ -2530,7 +2782,7 @@ namespace SurfaceGeometry {
 				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 				ErrorInName = false;
 				IsBlank = false;
-				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+				VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 				if ( ErrorInName ) {
 					ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 					ErrorsFound = true;
@@ -2538,7 +2790,7 @@ namespace SurfaceGeometry {
 				}
 
 				++SurfNum;
-				SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+				SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 				SurfaceTmp( SurfNum ).Class = ClassItem;
 				SurfaceTmp( SurfNum ).HeatTransSurf = false;
 
@@ -2741,9 +2993,7 @@ namespace SurfaceGeometry {
 
 		NeedToAddSurfaces = 0;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Construct_Name( Construct.Name() ); // Member array
-		auto const Zone_Name( Zone.Name() ); // Member array
 		auto const OSC_Name( OSC.Name() ); // Member array
 		auto const OSCM_Name( OSCM.Name() ); // Member array
 		for ( Item = 1; Item <= 4; ++Item ) {
@@ -2780,7 +3030,7 @@ namespace SurfaceGeometry {
 				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 				ErrorInName = false;
 				IsBlank = false;
-				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+				VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 				if ( ErrorInName ) {
 					ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 					ErrorsFound = true;
@@ -2788,7 +3038,7 @@ namespace SurfaceGeometry {
 				}
 
 				++SurfNum;
-				SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+				SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 				ArgPointer = 2;
 				if ( Item == 1 ) {
 					if ( cAlphaArgs( 2 ) == "CEILING" ) cAlphaArgs( 2 ) = "ROOF";
@@ -2827,7 +3077,7 @@ namespace SurfaceGeometry {
 
 				++ArgPointer;
 				SurfaceTmp( SurfNum ).ZoneName = cAlphaArgs( ArgPointer );
-				ZoneNum = FindItemInList( SurfaceTmp( SurfNum ).ZoneName, Zone_Name, NumOfZones );
+				ZoneNum = FindZoneNum( SurfaceTmp( SurfNum ).ZoneName );
 
 				if ( ZoneNum != 0 ) {
 					SurfaceTmp( SurfNum ).Zone = ZoneNum;
@@ -2920,7 +3170,7 @@ namespace SurfaceGeometry {
 					// will be set up later.
 					SurfaceTmp( SurfNum ).ExtBoundCond = UnenteredAdjacentZoneSurface;
 					// check OutsideFaceEnvironment for legal zone
-					Found = FindItemInList( SurfaceTmp( SurfNum ).ExtBoundCondName, Zone_Name, NumOfZones );
+					Found = FindZoneNum( SurfaceTmp( SurfNum ).ExtBoundCondName );
 					++NeedToAddSurfaces;
 
 					if ( Found == 0 ) {
@@ -3112,9 +3362,7 @@ namespace SurfaceGeometry {
 		int ClassItem;
 		int ZoneNum;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Construct_Name( Construct.Name() ); // Member array
-		auto const Zone_Name( Zone.Name() ); // Member array
 
 		for ( Item = 1; Item <= 10; ++Item ) {
 
@@ -3185,7 +3433,7 @@ namespace SurfaceGeometry {
 				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 				ErrorInName = false;
 				IsBlank = false;
-				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+				VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 				if ( ErrorInName ) {
 					ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 					ErrorsFound = true;
@@ -3198,7 +3446,7 @@ namespace SurfaceGeometry {
 				}
 
 				++SurfNum;
-				SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+				SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 				SurfaceTmp( SurfNum ).Class = BaseSurfIDs( ClassItem ); // Set class number
 
 				SurfaceTmp( SurfNum ).Construction = FindItemInList( cAlphaArgs( 2 ), Construct_Name, TotConstructs );
@@ -3219,7 +3467,7 @@ namespace SurfaceGeometry {
 				SurfaceTmp( SurfNum ).BaseSurfName = SurfaceTmp( SurfNum ).Name;
 
 				SurfaceTmp( SurfNum ).ZoneName = cAlphaArgs( 3 );
-				ZoneNum = FindItemInList( SurfaceTmp( SurfNum ).ZoneName, Zone_Name, NumOfZones );
+				ZoneNum = FindZoneNum( SurfaceTmp( SurfNum ).ZoneName );
 
 				if ( ZoneNum != 0 ) {
 					SurfaceTmp( SurfNum ).Zone = ZoneNum;
@@ -3259,7 +3507,7 @@ namespace SurfaceGeometry {
 				} else if ( SurfaceTmp( SurfNum ).ExtBoundCond == UnreconciledZoneSurface ) {
 					if ( GettingIZSurfaces ) {
 						SurfaceTmp( SurfNum ).ExtBoundCondName = cAlphaArgs( OtherSurfaceField );
-						Found = FindItemInList( SurfaceTmp( SurfNum ).ExtBoundCondName, Zone_Name, NumOfZones );
+						Found = FindZoneNum( SurfaceTmp( SurfNum ).ExtBoundCondName );
 						// see if match to zone, then it's an unentered other surface, else reconciled later
 						if ( Found > 0 ) {
 							++NeedToAddSurfaces;
@@ -3651,7 +3899,6 @@ namespace SurfaceGeometry {
 		int ValidChk;
 		int numSides;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Construct_Name( Construct.Name() ); // Member array
 		auto const OSC_Name( OSC.Name() ); // Member array
 		auto const WindowShadingControl_Name( WindowShadingControl.Name() ); // Member array
@@ -3676,7 +3923,7 @@ namespace SurfaceGeometry {
 			GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 			ErrorInName = false;
 			IsBlank = false;
-			VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+			VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 			if ( ErrorInName ) {
 				ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 				ErrorsFound = true;
@@ -3689,7 +3936,7 @@ namespace SurfaceGeometry {
 			}
 
 			++SurfNum;
-			SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+			SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 			ValidChk = FindItemInList( cAlphaArgs( 2 ), SubSurfCls, 6 );
 			if ( ValidChk == 0 ) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + SurfaceTmp( SurfNum ).Name + "\", invalid " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) );
@@ -3731,7 +3978,7 @@ namespace SurfaceGeometry {
 			//  The subsurface inherits properties from the base surface
 			//  Exterior conditions, Zone, etc.
 			//  We can figure out the base surface though, because they've all been entered
-			Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+			Found = FindSurfaceTmp( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 			if ( Found > 0 ) {
 				SurfaceTmp( SurfNum ).BaseSurf = Found;
 				SurfaceTmp( SurfNum ).ExtBoundCond = SurfaceTmp( Found ).ExtBoundCond;
@@ -3973,9 +4220,7 @@ namespace SurfaceGeometry {
 		int ClassItem;
 		int IZFound;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Construct_Name( Construct.Name() ); // Member array
-		auto const Zone_Name( Zone.Name() ); // Member array
 		auto const WindowShadingControl_Name( WindowShadingControl.Name() ); // Member array
 
 		for ( Item = 1; Item <= 6; ++Item ) {
@@ -4029,7 +4274,7 @@ namespace SurfaceGeometry {
 				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 				ErrorInName = false;
 				IsBlank = false;
-				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+				VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 				if ( ErrorInName ) {
 					ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 					ErrorsFound = true;
@@ -4042,7 +4287,7 @@ namespace SurfaceGeometry {
 				}
 
 				++SurfNum;
-				SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+				SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 				SurfaceTmp( SurfNum ).Class = SubSurfIDs( ClassItem ); // Set class number
 
 				SurfaceTmp( SurfNum ).Construction = FindItemInList( cAlphaArgs( 2 ), Construct_Name, TotConstructs );
@@ -4077,7 +4322,7 @@ namespace SurfaceGeometry {
 				//  The subsurface inherits properties from the base surface
 				//  Exterior conditions, Zone, etc.
 				//  We can figure out the base surface though, because they've all been entered
-				Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+				Found = FindSurfaceTmp( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 				if ( Found > 0 ) {
 					SurfaceTmp( SurfNum ).BaseSurf = Found;
 					SurfaceTmp( SurfNum ).ExtBoundCond = SurfaceTmp( Found ).ExtBoundCond;
@@ -4116,7 +4361,7 @@ namespace SurfaceGeometry {
 				if ( SurfaceTmp( SurfNum ).ExtBoundCond == UnreconciledZoneSurface ) { // "Surface" Base Surface
 					if ( GettingIZSurfaces ) {
 						SurfaceTmp( SurfNum ).ExtBoundCondName = cAlphaArgs( OtherSurfaceField );
-						IZFound = FindItemInList( SurfaceTmp( SurfNum ).ExtBoundCondName, Zone_Name, NumOfZones );
+						IZFound = FindZoneNum( SurfaceTmp( SurfNum ).ExtBoundCondName );
 						if ( IZFound > 0 ) SurfaceTmp( SurfNum ).ExtBoundCond = UnenteredAdjacentZoneSurface;
 					} else { // Interior Window
 						SurfaceTmp( SurfNum ).ExtBoundCondName = SurfaceTmp( SurfNum ).Name;
@@ -4517,7 +4762,6 @@ namespace SurfaceGeometry {
 		int ConstrNum; // Construction number
 		int Found; // when item is found
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 
 		// Warning if window has multiplier > 1 and SolarDistribution = FullExterior or FullInteriorExterior
 
@@ -4590,7 +4834,7 @@ namespace SurfaceGeometry {
 
 						// Lookup interzone surface of the base surface
 						// (Interzone surfaces have not been assigned yet, but all base surfaces should already be loaded.)
-						Found = FindItemInList( SurfaceTmp( SurfaceTmp( SurfNum ).BaseSurf ).ExtBoundCondName, SurfaceTmp_Name, SurfNum );
+						Found = FindSurfaceTmp( SurfaceTmp( SurfaceTmp( SurfNum ).BaseSurf ).ExtBoundCondName, SurfNum );
 						if ( Found != 0 ) SurfaceTmp( Found ).Area -= SurfaceTmp( SurfNum ).Area;
 					}
 
@@ -4858,7 +5102,6 @@ namespace SurfaceGeometry {
 		Real64 SchedMinValue;
 		Real64 SchedMaxValue;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 
 		if ( TotShdSubs > 0 && SolarDistribution == MinimalShadowing ) {
 			ShowWarningError( "Shading effects of Fins and Overhangs are ignored when Solar Distribution = MinimalShadowing" );
@@ -4875,7 +5118,7 @@ namespace SurfaceGeometry {
 			GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 			ErrorInName = false;
 			IsBlank = false;
-			VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+			VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 			if ( ErrorInName ) {
 				ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 				ErrorsFound = true;
@@ -4883,14 +5126,14 @@ namespace SurfaceGeometry {
 			}
 
 			++SurfNum;
-			SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+			SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 			SurfaceTmp( SurfNum ).Class = SurfaceClass_Shading;
 			SurfaceTmp( SurfNum ).HeatTransSurf = false;
 			SurfaceTmp( SurfNum ).BaseSurfName = cAlphaArgs( 2 );
 			//  The subsurface inherits properties from the base surface
 			//  Exterior conditions, Zone, etc.
 			//  We can figure out the base surface though, because they've all been entered
-			Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+			Found = FindSurfaceTmp( SurfaceTmp( SurfNum ).BaseSurfName, TotSurfaces );
 			if ( Found > 0 ) {
 				//SurfaceTmp(SurfNum)%BaseSurf=Found
 				SurfaceTmp( SurfNum ).ExtBoundCond = SurfaceTmp( Found ).ExtBoundCond;
@@ -5057,7 +5300,6 @@ namespace SurfaceGeometry {
 		Real64 TiltAngle;
 		bool MakeFin;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 
 		if ( ( TotOverhangs + TotOverhangsProjection + TotFins + TotFinsProjection ) > 0 && SolarDistribution == MinimalShadowing ) {
 			ShowWarningError( "Shading effects of Fins and Overhangs are ignored when Solar Distribution = MinimalShadowing" );
@@ -5080,7 +5322,7 @@ namespace SurfaceGeometry {
 				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 				ErrorInName = false;
 				IsBlank = false;
-				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+				VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 				if ( ErrorInName ) {
 					ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 					ErrorsFound = true;
@@ -5088,11 +5330,11 @@ namespace SurfaceGeometry {
 				}
 
 				++SurfNum;
-				SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+				SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 				SurfaceTmp( SurfNum ).Class = SurfaceClass_Shading;
 				SurfaceTmp( SurfNum ).HeatTransSurf = false;
 				// this object references a window or door....
-				Found = FindItemInList( cAlphaArgs( 2 ), SurfaceTmp_Name, TotSurfaces );
+				Found = FindSurfaceTmp( cAlphaArgs( 2 ), TotSurfaces );
 				if ( Found > 0 ) {
 					BaseSurfNum = SurfaceTmp( Found ).BaseSurf;
 					SurfaceTmp( SurfNum ).BaseSurfName = SurfaceTmp( Found ).BaseSurfName;
@@ -5207,7 +5449,7 @@ namespace SurfaceGeometry {
 					// for projection option:
 					//   N5,  \field Left Depth as Fraction of Window/Door Width
 					//        \units m
-					SurfaceTmp( SurfNum ).Name = SurfaceTmp( SurfNum ).Name + " Left";
+					SetSurfaceTmpName( SurfNum, SurfaceTmp( SurfNum ).Name + " Left" );
 					Length = rNumericArgs( 2 ) + rNumericArgs( 3 ) + SurfaceTmp( Found ).Height;
 					if ( Item == 3 ) {
 						Depth = rNumericArgs( 5 );
@@ -5282,7 +5524,7 @@ namespace SurfaceGeometry {
 					//        \units m
 
 					++SurfNum;
-					SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ) + " Right"; // Set the Surface Name in the Derived Type
+					SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) + " Right" ); // Set the Surface Name in the Derived Type
 					SurfaceTmp( SurfNum ).Class = SurfaceClass_Shading;
 					SurfaceTmp( SurfNum ).HeatTransSurf = false;
 					BaseSurfNum = SurfaceTmp( Found ).BaseSurf;
@@ -5424,16 +5666,14 @@ namespace SurfaceGeometry {
 		bool ErrorInName;
 		bool IsBlank;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Construct_Name( Construct.Name() ); // Member array
-		auto const Zone_Name( Zone.Name() ); // Member array
 
 		cCurrentModuleObject = "InternalMass";
 		for ( Loop = 1; Loop <= TotIntMass; ++Loop ) {
 			GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 			ErrorInName = false;
 			IsBlank = false;
-			VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
+			VerifySurfaceTmpName( cAlphaArgs( 1 ), SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
 			if ( ErrorInName ) {
 				ShowContinueError( "...each surface name must not duplicate other surface names (of any type)" );
 				ErrorsFound = true;
@@ -5441,7 +5681,7 @@ namespace SurfaceGeometry {
 			}
 
 			++SurfNum;
-			SurfaceTmp( SurfNum ).Name = cAlphaArgs( 1 ); // Set the Surface Name in the Derived Type
+			SetSurfaceTmpName( SurfNum, cAlphaArgs( 1 ) ); // Set the Surface Name in the Derived Type
 			SurfaceTmp( SurfNum ).Class = SurfaceClass_IntMass;
 			SurfaceTmp( SurfNum ).HeatTransSurf = true;
 			SurfaceTmp( SurfNum ).Construction = FindItemInList( cAlphaArgs( 2 ), Construct_Name, TotConstructs );
@@ -5457,7 +5697,7 @@ namespace SurfaceGeometry {
 				SurfaceTmp( SurfNum ).ConstructionStoredInputValue = SurfaceTmp( SurfNum ).Construction;
 			}
 			SurfaceTmp( SurfNum ).ZoneName = cAlphaArgs( 3 );
-			ZoneNum = FindItemInList( SurfaceTmp( SurfNum ).ZoneName, Zone_Name, NumOfZones );
+			ZoneNum = FindZoneNum( SurfaceTmp( SurfNum ).ZoneName );
 
 			if ( ZoneNum != 0 ) {
 				SurfaceTmp( SurfNum ).Zone = ZoneNum;
@@ -5535,7 +5775,6 @@ namespace SurfaceGeometry {
 		int GlConstrNum; // Glazing construction number
 		bool WrongSurfaceType;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Construct_Name( Construct.Name() ); // Member array
 
 		// For shading surfaces, initialize value of reflectance values to default values. These values
@@ -5556,7 +5795,7 @@ namespace SurfaceGeometry {
 		for ( Loop = 1; Loop <= TotShadingSurfaceReflectance; ++Loop ) {
 
 			GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NumAlpha, rNumericArgs, NumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
-			SurfNum = FindItemInList( cAlphaArgs( 1 ), SurfaceTmp_Name, TotSurfaces );
+			SurfNum = FindSurfaceTmp( cAlphaArgs( 1 ), TotSurfaces );
 			if ( SurfNum == 0 ) {
 				ShowWarningError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid specification" );
 				ShowContinueError( ".. not found " + cAlphaFieldNames( 1 ) + "=\"" + cAlphaArgs( 1 ) + "\"." );
@@ -5589,7 +5828,7 @@ namespace SurfaceGeometry {
 				}
 				SurfaceTmp( SurfNum ).ShadowSurfGlazingConstruct = GlConstrNum;
 			}
-			SurfNum = FindItemInList( "Mir-" + cAlphaArgs( 1 ), SurfaceTmp_Name, TotSurfaces );
+			SurfNum = FindSurfaceTmp( "Mir-" + cAlphaArgs( 1 ), TotSurfaces );
 			if ( SurfNum == 0 ) continue;
 			SurfaceTmp( SurfNum ).ShadowSurfGlazingFrac = rNumericArgs( 3 );
 			SurfaceTmp( SurfNum ).ShadowSurfDiffuseSolRefl = ( 1.0 - rNumericArgs( 3 ) ) * rNumericArgs( 1 );
@@ -6725,7 +6964,7 @@ namespace SurfaceGeometry {
 		NVert = SurfaceTmp( SurfNum ).Sides;
 		SurfaceTmp( SurfNum + 1 ).Vertex.allocate( NVert );
 		// doesn't work when Vertex are pointers  SurfaceTmp(SurfNum+1)=SurfaceTmp(SurfNum)
-		SurfaceTmp( SurfNum + 1 ).Name = SurfaceTmp( SurfNum ).Name;
+		SetSurfaceTmpName( SurfNum + 1, SurfaceTmp( SurfNum ).Name );
 		SurfaceTmp( SurfNum + 1 ).Construction = SurfaceTmp( SurfNum ).Construction;
 		SurfaceTmp( SurfNum + 1 ).ConstructionStoredInputValue = SurfaceTmp( SurfNum ).ConstructionStoredInputValue;
 		SurfaceTmp( SurfNum + 1 ).Class = SurfaceTmp( SurfNum ).Class;
@@ -6772,7 +7011,7 @@ namespace SurfaceGeometry {
 			--NVert;
 		}
 		++SurfNum;
-		SurfaceTmp( SurfNum ).Name = "Mir-" + SurfaceTmp( SurfNum - 1 ).Name;
+		SetSurfaceTmpName( SurfNum, "Mir-" + SurfaceTmp( SurfNum - 1 ).Name );
 
 		// TH 3/26/2010
 		SurfaceTmp( SurfNum ).MirroredSurf = true;
@@ -7953,14 +8192,13 @@ namespace SurfaceGeometry {
 		int SchNum;
 		int InslType;
 
-		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
 		auto const Material_Name( Material.Name() ); // Member array
 
 		cCurrentModuleObject = "SurfaceControl:MovableInsulation";
 		NMatInsul = GetNumObjectsFound( cCurrentModuleObject );
 		for ( Loop = 1; Loop <= NMatInsul; ++Loop ) {
 			GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, NAlphas, rNumericArgs, NNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
-			SurfNum = FindItemInList( cAlphaArgs( 2 ), SurfaceTmp_Name, TotSurfaces );
+			SurfNum = FindSurfaceTmp( cAlphaArgs( 2 ), TotSurfaces );
 			MaterNum = FindItemInList( cAlphaArgs( 3 ), Material_Name, TotMaterials );
 			SchNum = GetScheduleIndex( cAlphaArgs( 4 ) );
 			if ( SameString( cAlphaArgs( 1 ), "Outside" ) ) {
@@ -8150,6 +8388,9 @@ namespace SurfaceGeometry {
 				ZoneStruct.SurfaceFace( NActFaces ).SurfNum = SurfNum;
 				ZoneStruct.SurfaceFace( NActFaces ).FacePoints( {1,Surface( SurfNum ).Sides} ) = Surface( SurfNum ).Vertex( {1,Surface( SurfNum ).Sides} );
 				CreateNewellAreaVector( ZoneStruct.SurfaceFace( NActFaces ).FacePoints, ZoneStruct.SurfaceFace( NActFaces ).NSides, ZoneStruct.SurfaceFace( NActFaces ).NewellAreaVector );
+				if ( Surface( SurfNum ).MergedSurfaces > 0 ) { // The merged pieces lie in the plane of this one and add to its volume in proportion to area
+					ZoneStruct.SurfaceFace( NActFaces ).NewellAreaVector *= Surface( SurfNum ).GrossArea / VecLength( ZoneStruct.SurfaceFace( NActFaces ).NewellAreaVector );
+				}
 				SumAreas += VecLength( ZoneStruct.SurfaceFace( NActFaces ).NewellAreaVector );
 			}
 			ZoneStruct.NumSurfaceFaces = NActFaces;
@@ -9607,7 +9848,7 @@ namespace SurfaceGeometry {
 
 		SurfaceTmp( TotSurfaces ).Vertex.allocate( 4 );
 
-		SurfaceTmp( TotSurfaces ).Name = SurfaceTmp( SurfNum ).Name + ":2";
+		SetSurfaceTmpName( TotSurfaces, SurfaceTmp( SurfNum ).Name + ":2" );
 		SurfaceTmp( TotSurfaces ).Construction = IConst2;
 		SurfaceTmp( TotSurfaces ).ConstructionStoredInputValue = IConst2;
 		SurfaceTmp( TotSurfaces ).Class = SurfaceTmp( SurfNum ).Class;
@@ -1,6 +1,10 @@
 #ifndef SurfaceGeometry_hh_INCLUDED
 #define SurfaceGeometry_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -55,6 +59,10 @@ namespace SurfaceGeometry {
 
 	// Object Data
 	extern Array1D< SurfaceData > SurfaceTmp; // Allocated/Deallocated during input processing
+	extern std::unordered_map< std::string, int > SurfaceTmpNames; // SurfaceTmp number by name, as set by SetSurfaceTmpName
+	extern std::unordered_map< std::string, int > SurfaceTmpNamesUC; // SurfaceTmp number by upper case name
+	extern std::unordered_map< std::string, int > ZoneNames; // Zone number by name, for the zones numbered up to NumZonesNamed
+	extern int NumZonesNamed;
 
 	// Functions
 
@@ -64,6 +72,36 @@ namespace SurfaceGeometry {
 	void
 	AllocateModuleArrays();
 
+	void
+	ClearSurfaceNames();
+
+	void
+	SetSurfaceTmpName(
+		int const SurfNum, // Surface in SurfaceTmp
+		std::string const & Name
+	);
+
+	int
+	FindSurfaceTmp(
+		std::string const & Name,
+		int const NumSurfaces // Surfaces of SurfaceTmp searched, from the first
+	);
+
+	void
+	VerifySurfaceTmpName(
+		std::string const & NameToVerify,
+		int const NumOfNames, // Surfaces of SurfaceTmp already named
+		bool & ErrorFound,
+		bool & IsBlank,
+		std::string const & StringToDisplay
+	);
+
+	int
+	FindZoneNum( std::string const & Name );
+
+	void
+	MergeCoplanarSurfaceTmp( int & NumSurfaces ); // Surfaces of SurfaceTmp, less those merged on return
+
 	void
 	GetSurfaceData( bool & ErrorsFound ); // If errors found in input
 
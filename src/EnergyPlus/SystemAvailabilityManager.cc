@@ -2198,8 +2198,8 @@ namespace SystemAvailabilityManager {
 
 		int ScheduleIndex;
 		int DayScheduleIndex;
-		Array2D< Real64 > DayValues;
-		Array2D< Real64 > DayValuesTmr;
+		static Array2D< Real64 > DayValues; // Fan schedule values of today, kept allocated between calls
+		static Array2D< Real64 > DayValuesTmr; // Fan schedule values of tomorrow, kept allocated between calls
 		int JDay;
 		int TmrJDay;
 		int CurDayofWeek;
@@ -2241,13 +2241,15 @@ namespace SystemAvailabilityManager {
 		if ( KickOffSimulation ) {
 			AvailStatus = NoAction;
 		} else {
-			ScheduleIndex = GetScheduleIndex( OptStartSysAvailMgrData( SysAvailNum ).FanSched );
+			ScheduleIndex = OptStartSysAvailMgrData( SysAvailNum ).FanSchedPtr;
 			JDay = DayOfYear;
 			TmrJDay = JDay + 1;
 			TmrDayOfWeek = DayOfWeekTomorrow;
 
-			DayValues.allocate( NumOfTimeStepInHour, 24 );
-			DayValuesTmr.allocate( NumOfTimeStepInHour, 24 );
+			if ( ! allocated( DayValues ) ) {
+				DayValues.allocate( NumOfTimeStepInHour, 24 );
+				DayValuesTmr.allocate( NumOfTimeStepInHour, 24 );
+			}
 			if ( ! allocated( OptStartData.OptStartFlag ) ) {
 				OptStartData.OptStartFlag.allocate( NumOfZones );
 				OptStartData.OccStartTime.allocate( NumOfZones );
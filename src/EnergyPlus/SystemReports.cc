@@ -38,10 +38,12 @@
 #include <PackagedTerminalHeatPump.hh>
 #include <Psychrometrics.hh>
 #include <PurchasedAirManager.hh>
+#include <SimAirServingZones.hh>
 #include <SplitterComponent.hh>
 #include <UnitVentilator.hh>
 #include <UtilityRoutines.hh>
 #include <WindowAC.hh>
+#include <ZoneEquipmentManager.hh>
 #include <ZonePlenum.hh>
 
 namespace EnergyPlus {
@@ -948,6 +950,10 @@ namespace SystemReports {
 				}
 			}
 
+			// The plant connections are known now, so the independent air loops and zones are found again
+			SimAirServingZones::AirLoopGroupsSet = false;
+			ZoneEquipmentManager::ZoneEquipGroupsSet = false;
+
 			OneTimeFlag = false;
 
 		}
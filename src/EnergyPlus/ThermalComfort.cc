@@ -22,6 +22,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -457,8 +458,13 @@ namespace ThermalComfort {
 		// BG note (10/21/2005),  This formulation is based on the the BASIC program
 		// that is included in ASHRAE Standard 55 Normative Appendix D.
 
+		// With the ComfortWarmStart environment variable set, the clothing surface temperature
+		// of a comfort control evaluation starts from that of the previous evaluation of the
+		// occupant, which the root solve for the setpoint calls at nearby air temperatures.
+
 		// Using/Aliasing
 		using Psychrometrics::PsyPsatFnTemp;
+		using DataSystemVariables::ComfortWarmStart;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -487,12 +493,11 @@ namespace ThermalComfort {
 		Real64 PMV; // temporary variable to store calculated Fanger PMV value
 		Real64 PPD; // temporary variable to store calculated Fanger PPD value
 
-		for ( PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum ) {
+		// Optional argument is used to access people object when thermal comfort control is used
+		int const FirstPeopleNum( present( PNum ) ? int( PNum ) : 1 );
+		int const LastPeopleNum( present( PNum ) ? int( PNum ) : TotPeople );
 
-			// Optional argument is used to access people object when thermal comfort control is used
-			if ( present( PNum ) ) {
-				if ( PeopleNum != PNum ) continue;
-			}
+		for ( PeopleNum = FirstPeopleNum; PeopleNum <= LastPeopleNum; ++PeopleNum ) {
 
 			// If optional argument is used do not cycle regardless of thermal comfort reporting type
 			if ( ( ! People( PeopleNum ).Fanger ) && ( ! present( PNum ) ) ) continue;
@@ -609,7 +614,11 @@ namespace ThermalComfort {
 			P4 = 308.7 - 0.028 * IntHeatProd + P2 * pow_4( AbsRadTemp / 100.0 );
 
 			// First guess for clothed surface tempeature
-			AbsCloSurfTemp = AbsAirTemp + ( 35.5 - AirTemp ) / ( 3.5 * ( CloUnit + 0.1 ) );
+			if ( ComfortWarmStart && present( PNum ) ) {
+				AbsCloSurfTemp = ThermalComfortData( PeopleNum ).CloSurfTemp + TAbsConv;
+			} else {
+				AbsCloSurfTemp = AbsAirTemp + ( 35.5 - AirTemp ) / ( 3.5 * ( CloUnit + 0.1 ) );
+			}
 			XN = AbsCloSurfTemp / 100.0;
 			HcFor = 12.1 * std::sqrt( AirVel ); // Heat transfer coefficient by forced convection
 			IterNum = 0;
@@ -25,11 +25,11 @@
   NEED_TO_SPECIFY_TIMER
 #endif
 
-// int OMP_GET_THREAD_NUM, OMP_GET_NUM_THREADS, OMP_GET_MAX_THREADS;
 #ifdef _OPENMP
-#define THREADID(a) OMP_GET_THREAD_NUM()
-#define NUMTHREADS(a) OMP_GET_NUM_THREADS()
-#define MAXTHREADS(a) OMP_GET_MAX_THREADS()
+#include <omp.h>
+#define THREADID(a) omp_get_thread_num()
+#define NUMTHREADS(a) omp_get_num_threads()
+#define MAXTHREADS(a) omp_get_max_threads()
 #else
 #define THREADID(a) 1
 #define NUMTHREADS(a) 1
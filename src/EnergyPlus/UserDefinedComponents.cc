@@ -12,9 +12,11 @@
 #include <BranchNodeConnections.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
+#include <DataHVACGlobals.hh>
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataRuntimeLanguage.hh>
+#include <DataSystemVariables.hh>
 #include <DataWater.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -59,6 +61,7 @@ namespace UserDefinedComponents {
 	using DataGlobals::emsCallFromUserDefinedComponentModel;
 	using DataGlobals::BeginEnvrnFlag;
 	using DataGlobals::NumOfZones;
+	using DataSystemVariables::UserDefinedComponentMemoization;
 	using namespace DataPlant;
 	using namespace DataLoopNode;
 	using namespace DataRuntimeLanguage;
@@ -147,6 +150,8 @@ namespace UserDefinedComponents {
 		int CompNum;
 		int ThisLoop;
 		int Loop;
+		bool ProgramsMemoized; // True if the simulation programs ran last for the same internal variables
+		static std::vector< Real64 > ErlInputs; // Internal variables the simulation programs run with
 
 		//Autodesk:Uninit Initialize variables used uninitialized
 		ThisLoop = 0; //Autodesk:Uninit Force default initialization
@@ -214,14 +219,27 @@ namespace UserDefinedComponents {
 
 		InitPlantUserComponent( CompNum, ThisLoop, MyLoad );
 
-		if ( ThisLoop > 0 ) {
-			if ( UserPlantComp( CompNum ).Loop( ThisLoop ).ErlSimProgramMngr > 0 ) {
-				ManageEMS( emsCallFromUserDefinedComponentModel, UserPlantComp( CompNum ).Loop( ThisLoop ).ErlSimProgramMngr );
+		ProgramsMemoized = false;
+		if ( UserDefinedComponentMemoization ) {
+			ErlInputs.clear();
+			ErlInputs.push_back( ThisLoop ); // The programs of the connection called set the actuators last
+			for ( Loop = 1; Loop <= UserPlantComp( CompNum ).NumPlantConnections; ++Loop ) {
+				AppendErlInputs( ErlInputs, UserPlantComp( CompNum ).Loop( Loop ) );
 			}
+			AppendErlInputs( ErlInputs, UserPlantComp( CompNum ).Air );
+			ProgramsMemoized = ErlProgramsMemoized( UserPlantComp( CompNum ).Memo, ErlInputs );
 		}
 
-		if ( UserPlantComp( CompNum ).ErlSimProgramMngr > 0 ) {
-			ManageEMS( emsCallFromUserDefinedComponentModel, UserPlantComp( CompNum ).ErlSimProgramMngr );
+		if ( ! ProgramsMemoized ) {
+			if ( ThisLoop > 0 ) {
+				if ( UserPlantComp( CompNum ).Loop( ThisLoop ).ErlSimProgramMngr > 0 ) {
+					ManageEMS( emsCallFromUserDefinedComponentModel, UserPlantComp( CompNum ).Loop( ThisLoop ).ErlSimProgramMngr );
+				}
+			}
+
+			if ( UserPlantComp( CompNum ).ErlSimProgramMngr > 0 ) {
+				ManageEMS( emsCallFromUserDefinedComponentModel, UserPlantComp( CompNum ).ErlSimProgramMngr );
+			}
 		}
 
 		ReportPlantUserComponent( CompNum, ThisLoop );
@@ -278,6 +296,8 @@ namespace UserDefinedComponents {
 		Real64 EnthInlet;
 		Real64 EnthOutlet;
 		int CompNum;
+		int Loop;
+		static std::vector< Real64 > ErlInputs; // Internal variables the simulation program runs with
 
 		if ( GetInput ) {
 			GetUserDefinedComponents();
@@ -321,7 +341,16 @@ namespace UserDefinedComponents {
 		InitCoilUserDefined( CompNum );
 
 		if ( UserCoil( CompNum ).ErlSimProgramMngr > 0 ) {
-			ManageEMS( emsCallFromUserDefinedComponentModel, UserCoil( CompNum ).ErlSimProgramMngr );
+			if ( UserDefinedComponentMemoization ) {
+				ErlInputs.clear();
+				for ( Loop = 1; Loop <= UserCoil( CompNum ).NumAirConnections; ++Loop ) {
+					AppendErlInputs( ErlInputs, UserCoil( CompNum ).Air( Loop ) );
+				}
+				if ( UserCoil( CompNum ).PlantIsConnected ) AppendErlInputs( ErlInputs, UserCoil( CompNum ).Loop );
+			}
+			if ( ! UserDefinedComponentMemoization || ! ErlProgramsMemoized( UserCoil( CompNum ).Memo, ErlInputs ) ) {
+				ManageEMS( emsCallFromUserDefinedComponentModel, UserCoil( CompNum ).ErlSimProgramMngr );
+			}
 		}
 
 		ReportCoilUserDefined( CompNum );
@@ -397,6 +426,7 @@ namespace UserDefinedComponents {
 		Real64 MinHumRat;
 		Real64 SpecHumOut;
 		Real64 SpecHumIn;
+		static std::vector< Real64 > ErlInputs; // Internal variables the simulation program runs with
 
 		if ( GetInput ) {
 			GetUserDefinedComponents();
@@ -443,7 +473,21 @@ namespace UserDefinedComponents {
 		InitZoneAirUserDefined( CompNum, ZoneNum );
 
 		if ( UserZoneAirHVAC( CompNum ).ErlSimProgramMngr > 0 ) {
-			ManageEMS( emsCallFromUserDefinedComponentModel, UserZoneAirHVAC( CompNum ).ErlSimProgramMngr );
+			if ( UserDefinedComponentMemoization ) {
+				ErlInputs.clear();
+				ErlInputs.push_back( UserZoneAirHVAC( CompNum ).RemainingOutputToHeatingSP );
+				ErlInputs.push_back( UserZoneAirHVAC( CompNum ).RemainingOutputToCoolingSP );
+				ErlInputs.push_back( UserZoneAirHVAC( CompNum ).RemainingOutputReqToDehumidSP );
+				ErlInputs.push_back( UserZoneAirHVAC( CompNum ).RemainingOutputReqToHumidSP );
+				AppendErlInputs( ErlInputs, UserZoneAirHVAC( CompNum ).ZoneAir );
+				AppendErlInputs( ErlInputs, UserZoneAirHVAC( CompNum ).SourceAir );
+				for ( Loop = 1; Loop <= UserZoneAirHVAC( CompNum ).NumPlantConnections; ++Loop ) {
+					AppendErlInputs( ErlInputs, UserZoneAirHVAC( CompNum ).Loop( Loop ) );
+				}
+			}
+			if ( ! UserDefinedComponentMemoization || ! ErlProgramsMemoized( UserZoneAirHVAC( CompNum ).Memo, ErlInputs ) ) {
+				ManageEMS( emsCallFromUserDefinedComponentModel, UserZoneAirHVAC( CompNum ).ErlSimProgramMngr );
+			}
 		}
 
 		ReportZoneAirUserDefined( CompNum );
@@ -509,6 +553,7 @@ namespace UserDefinedComponents {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int CompNum;
 		int Loop;
+		static std::vector< Real64 > ErlInputs; // Internal variables the simulation program runs with
 
 		if ( GetInput ) {
 			GetUserDefinedComponents();
@@ -556,7 +601,21 @@ namespace UserDefinedComponents {
 		InitAirTerminalUserDefined( CompNum, ZoneNum );
 
 		if ( UserAirTerminal( CompNum ).ErlSimProgramMngr > 0 ) {
-			ManageEMS( emsCallFromUserDefinedComponentModel, UserAirTerminal( CompNum ).ErlSimProgramMngr );
+			if ( UserDefinedComponentMemoization ) {
+				ErlInputs.clear();
+				ErlInputs.push_back( UserAirTerminal( CompNum ).RemainingOutputToHeatingSP );
+				ErlInputs.push_back( UserAirTerminal( CompNum ).RemainingOutputToCoolingSP );
+				ErlInputs.push_back( UserAirTerminal( CompNum ).RemainingOutputReqToDehumidSP );
+				ErlInputs.push_back( UserAirTerminal( CompNum ).RemainingOutputReqToHumidSP );
+				AppendErlInputs( ErlInputs, UserAirTerminal( CompNum ).AirLoop );
+				AppendErlInputs( ErlInputs, UserAirTerminal( CompNum ).SourceAir );
+				for ( Loop = 1; Loop <= UserAirTerminal( CompNum ).NumPlantConnections; ++Loop ) {
+					AppendErlInputs( ErlInputs, UserAirTerminal( CompNum ).Loop( Loop ) );
+				}
+			}
+			if ( ! UserDefinedComponentMemoization || ! ErlProgramsMemoized( UserAirTerminal( CompNum ).Memo, ErlInputs ) ) {
+				ManageEMS( emsCallFromUserDefinedComponentModel, UserAirTerminal( CompNum ).ErlSimProgramMngr );
+			}
 		}
 
 		ReportAirTerminalUserDefined( CompNum );
@@ -2006,6 +2065,77 @@ namespace UserDefinedComponents {
 	//     incorporated into the EnergyPlus software package under license.   For a complete
 	//     list of contributors, see "Notice" located in main.cc.
 
+	void
+	AppendErlInputs(
+		std::vector< Real64 > & Inputs,
+		PlantConnectionStruct const & Loop
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the internal variables of a plant connection to those a simulation program runs with.
+
+		Inputs.push_back( Loop.MyLoad );
+		Inputs.push_back( Loop.InletRho );
+		Inputs.push_back( Loop.InletCp );
+		Inputs.push_back( Loop.InletMassFlowRate );
+		Inputs.push_back( Loop.InletTemp );
+
+	}
+
+	void
+	AppendErlInputs(
+		std::vector< Real64 > & Inputs,
+		AirConnectionStruct const & Air
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the internal variables of an air connection to those a simulation program runs with.
+
+		Inputs.push_back( Air.InletRho );
+		Inputs.push_back( Air.InletCp );
+		Inputs.push_back( Air.InletTemp );
+		Inputs.push_back( Air.InletHumRat );
+		Inputs.push_back( Air.InletMassFlowRate );
+
+	}
+
+	bool
+	ErlProgramsMemoized(
+		ErlProgramMemoStruct & Memo,
+		std::vector< Real64 > const & Inputs
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Tells whether the Erl simulation programs of a component may be skipped because they last ran
+		// in this system time step with the same internal variables, so that the values they actuated
+		// still hold. Otherwise the run about to be made is recorded.
+
+		// METHODOLOGY EMPLOYED:
+		// Only used with UserDefinedComponentMemoization, which asserts that the programs of the user
+		// defined components depend on nothing but their internal variables within a system time step.
+		// The values are compared exactly, as plant and HVAC iterations that change nothing repeat them
+		// bit for bit. Nothing is skipped in the first time step of an environment, or while a library
+		// callback is to be run at the calling point.
+
+		// Using/Aliasing
+		using DataGlobals::DayOfSim;
+		using DataGlobals::CurrentTime;
+		using DataGlobals::fCallingPointPtr;
+		using DataHVACGlobals::SysTimeElapsed;
+
+		Real64 const TimeStamp( ( DayOfSim - 1 ) * 24.0 + CurrentTime + SysTimeElapsed );
+		if ( Memo.Valid && ! BeginEnvrnFlag && fCallingPointPtr == nullptr && Memo.TimeStamp == TimeStamp && Memo.Inputs == Inputs ) return true;
+
+		Memo.Valid = true;
+		Memo.TimeStamp = TimeStamp;
+		Memo.Inputs = Inputs;
+		return false;
+
+	}
+
 	//     NOTICE: The U.S. Government is granted for itself and others acting on its
 	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
 	//     reproduce, prepare derivative works, and perform publicly and display publicly.
@@ -1,6 +1,9 @@
 #ifndef UserDefinedComponents_hh_INCLUDED
 #define UserDefinedComponents_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -308,6 +311,23 @@ namespace UserDefinedComponents {
 
 	};
 
+	struct ErlProgramMemoStruct
+	{
+		// Internal variables the Erl simulation programs of a component last ran with
+
+		// Members
+		bool Valid; // True once a run is recorded
+		Real64 TimeStamp; // Hours into the environment at the end of the system time step of the run
+		std::vector< Real64 > Inputs; // Internal variable values of the run
+
+		// Default Constructor
+		ErlProgramMemoStruct() :
+			Valid( false ),
+			TimeStamp( 0.0 )
+		{}
+
+	};
+
 	struct UserPlantComponentStruct
 	{
 		// Members
@@ -318,6 +338,7 @@ namespace UserDefinedComponents {
 		AirConnectionStruct Air;
 		WaterUseTankConnectionStruct Water;
 		ZoneInternalGainsStruct Zone;
+		ErlProgramMemoStruct Memo; // Last run of the Erl simulation programs (UserDefinedComponentMemoization)
 
 		// Default Constructor
 		UserPlantComponentStruct() :
@@ -358,6 +379,7 @@ namespace UserDefinedComponents {
 		PlantConnectionStruct Loop;
 		WaterUseTankConnectionStruct Water;
 		ZoneInternalGainsStruct Zone;
+		ErlProgramMemoStruct Memo; // Last run of the Erl simulation programs (UserDefinedComponentMemoization)
 
 		// Default Constructor
 		UserCoilComponentStruct() :
@@ -408,6 +430,7 @@ namespace UserDefinedComponents {
 		Real64 RemainingOutputToCoolingSP; // sensible load remaining for device, negative means cooling [W]
 		Real64 RemainingOutputReqToHumidSP; // latent load remaining for device, to humidification setpoint [kg/s]
 		Real64 RemainingOutputReqToDehumidSP; // latent load remaining for device, Negative means dehumidify [kg/s]
+		ErlProgramMemoStruct Memo; // Last run of the Erl simulation programs (UserDefinedComponentMemoization)
 
 		// Default Constructor
 		UserZoneHVACForcedAirComponentStruct() :
@@ -470,6 +493,7 @@ namespace UserDefinedComponents {
 		Real64 RemainingOutputToCoolingSP; // sensible load remaining for device, negative means cooling [W]
 		Real64 RemainingOutputReqToHumidSP; // latent load remaining for device, to humidification setpoint [kg/s]
 		Real64 RemainingOutputReqToDehumidSP; // latent load remaining for device, Negative means dehumidify [kg/s]
+		ErlProgramMemoStruct Memo; // Last run of the Erl simulation programs (UserDefinedComponentMemoization)
 
 		// Default Constructor
 		UserAirTerminalComponentStruct() :
@@ -607,6 +631,24 @@ namespace UserDefinedComponents {
 	void
 	ReportAirTerminalUserDefined( int const CompNum );
 
+	void
+	AppendErlInputs(
+		std::vector< Real64 > & Inputs,
+		PlantConnectionStruct const & Loop
+	);
+
+	void
+	AppendErlInputs(
+		std::vector< Real64 > & Inputs,
+		AirConnectionStruct const & Air
+	);
+
+	bool
+	ErlProgramsMemoized(
+		ErlProgramMemoStruct & Memo,
+		std::vector< Real64 > const & Inputs
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -7,6 +7,7 @@ extern "C" {
 // C++ Headers
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/char.functions.hh>
@@ -20,6 +21,8 @@ extern "C" {
 #include <UtilityRoutines.hh>
 #include <BranchInputManager.hh>
 #include <BranchNodeConnections.hh>
+#include <ColumnarOutput.hh>
+#include <CsvOutput.hh>
 #include <CommandLineInterface.hh>
 #include <DataEnvironment.hh>
 #include <DataErrorTracking.hh>
@@ -34,8 +37,10 @@ extern "C" {
 #include <ExternalInterface.hh>
 #include <General.hh>
 #include <GeneralRoutines.hh>
+#include <MemoryReport.hh>
 #include <NodeInputManager.hh>
 #include <OutputReports.hh>
+#include <OutputWriterThread.hh>
 #include <PlantManager.hh>
 #include <SimulationManager.hh>
 #include <SolarShading.hh>
@@ -229,10 +234,13 @@ CloseMiscOpenFiles()
 	// na
 
 	// Using/Aliasing
+	using ColumnarOutput::CloseColumnarOutput;
+	using CsvOutput::CloseCsvOutput;
 	using DaylightingManager::CloseReportIllumMaps;
 	using DaylightingManager::CloseDFSFile;
 	using DataGlobals::OutputFileDebug;
 	using DataReportingFlags::DebugOutput;
+	using OutputWriterThread::StopAllOutputWriters;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -254,8 +262,11 @@ CloseMiscOpenFiles()
 	//      INTEGER :: UnitNumber
 	//      INTEGER :: ios
 
+	StopAllOutputWriters();
 	CloseReportIllumMaps();
 	CloseDFSFile();
+	CloseColumnarOutput();
+	CloseCsvOutput();
 
 	//  In case some debug output was produced, it appears that the
 	//  position on the INQUIRE will not be 'ASIS' (3 compilers tested)
@@ -417,16 +428,22 @@ EndEnergyPlus()
 	if ( Seconds < 0.0 ) Seconds = 0.0;
 	gio::write( Elapsed, ETimeFmt ) << Hours << Minutes << Seconds;
 
+	std::string PeakMemory; // Peak resident memory appended to the completion message with --memory-report
+	if ( DataSystemVariables::MemoryUsageReport ) {
+		MemoryReport::ShowMemorySummary();
+		PeakMemory = "; Peak Memory=" + MemoryReport::MegaBytes( MemoryReport::ProcessPeakBytes() ) + " MB";
+	}
+
 	ShowMessage( "EnergyPlus Warmup Error Summary. During Warmup: " + NumWarningsDuringWarmup + " Warning; " + NumSevereDuringWarmup + " Severe Errors." );
 	ShowMessage( "EnergyPlus Sizing Error Summary. During Sizing: " + NumWarningsDuringSizing + " Warning; " + NumSevereDuringSizing + " Severe Errors." );
-	ShowMessage( "EnergyPlus Completed Successfully-- " + NumWarnings + " Warning; " + NumSevere + " Severe Errors; Elapsed Time=" + Elapsed );
+	ShowMessage( "EnergyPlus Completed Successfully-- " + NumWarnings + " Warning; " + NumSevere + " Severe Errors; Elapsed Time=" + Elapsed + PeakMemory );
 	DisplayString( "EnergyPlus Run Time=" + Elapsed );
 	tempfl = GetNewUnitNumber();
 	{ IOFlags flags; flags.ACTION( "write" ); gio::open( tempfl, DataStringGlobals::outputEndFileName, flags ); write_stat = flags.ios(); }
 	if ( write_stat != 0 ) {
 		DisplayString( "EndEnergyPlus: Could not open file " + DataStringGlobals::outputEndFileName + " for output (write)." );
 	}
-	gio::write( tempfl, fmtA ) << "EnergyPlus Completed Successfully-- " + NumWarnings + " Warning; " + NumSevere + " Severe Errors; Elapsed Time=" + Elapsed;
+	gio::write( tempfl, fmtA ) << "EnergyPlus Completed Successfully-- " + NumWarnings + " Warning; " + NumSevere + " Severe Errors; Elapsed Time=" + Elapsed + PeakMemory;
 	gio::close( tempfl );
 #ifdef EP_Detailed_Timings
 	epSummaryTimes( Time_Finish - Time_Start );
@@ -1244,7 +1261,7 @@ ShowRecurringSevereErrorAtEnd(
 	// of occurences and optional tracking of associated min, max, and sum values
 
 	// METHODOLOGY EMPLOYED:
-	// Calls StoreRecurringErrorMessage utility routine.
+	// Calls StoreDesignatedRecurringErrorMessage utility routine.
 
 	// REFERENCES:
 	// na
@@ -1268,14 +1285,10 @@ ShowRecurringSevereErrorAtEnd(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop;
-
-	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
-	}
+	// na
 
 	++TotalSevereErrors;
-	StoreRecurringErrorMessage( " ** Severe  ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	StoreDesignatedRecurringErrorMessage( " ** Severe  ** ", Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
 
 }
 
@@ -1304,7 +1317,7 @@ ShowRecurringWarningErrorAtEnd(
 	// of occurences and optional tracking of associated min, max, and sum values
 
 	// METHODOLOGY EMPLOYED:
-	// Calls StoreRecurringErrorMessage utility routine.
+	// Calls StoreDesignatedRecurringErrorMessage utility routine.
 
 	// REFERENCES:
 	// na
@@ -1328,14 +1341,10 @@ ShowRecurringWarningErrorAtEnd(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop;
-
-	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
-	}
+	// na
 
 	++TotalWarningErrors;
-	StoreRecurringErrorMessage( " ** Warning ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	StoreDesignatedRecurringErrorMessage( " ** Warning ** ", Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
 
 }
 
@@ -1364,7 +1373,7 @@ ShowRecurringContinueErrorAtEnd(
 	// of occurences and optional tracking of associated min, max, and sum values
 
 	// METHODOLOGY EMPLOYED:
-	// Calls StoreRecurringErrorMessage utility routine.
+	// Calls StoreDesignatedRecurringErrorMessage utility routine.
 
 	// REFERENCES:
 	// na
@@ -1388,13 +1397,72 @@ ShowRecurringContinueErrorAtEnd(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop;
+	// na
 
-	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
+	StoreDesignatedRecurringErrorMessage( " **   ~~~   ** ", Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+
+}
+
+void
+StoreDesignatedRecurringErrorMessage(
+	std::string const & Designation, // Error designation written ahead of the message, e.g. " ** Warning ** "
+	std::string const & Message, // Message automatically written to "error file" at end of simulation
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits, // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits, // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits // optional char string (<=15 length) of units for sum value
+)
+{
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// This subroutine counts a recurring error message against the message searches
+	// of the error summary and stores it, headed by its designation, for output at
+	// the end of the simulation.
+
+	// METHODOLOGY EMPLOYED:
+	// Recurring messages are nearly always repeated under the same index with the same
+	// text.  Such a repeat counts the message searches the text matched the first time
+	// and passes the stored message on to StoreRecurringErrorMessage, so it costs no
+	// substring search and no string building: only the counts and the max, min and
+	// sum updates.  Any other text goes through the searches as before.
+
+	// Using/Aliasing
+	using namespace DataErrorTracking;
+
+	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+	std::string DesignatedMessage; // Designation followed by the message
+	std::vector< int > SearchMatches; // MessageSearch entries found in the message
+
+	if ( MsgIndex > 0 && MsgIndex <= NumRecurringErrors ) {
+		auto const & error( RecurringErrors( MsgIndex ) );
+		if ( error.SearchMatchesKnown && error.Message.size() == Designation.size() + Message.size() && error.Message.compare( 0, Designation.size(), Designation ) == 0 && error.Message.compare( Designation.size(), std::string::npos, Message ) == 0 ) {
+			for ( int const Loop : error.SearchMatches ) ++MatchCounts( Loop );
+			StoreRecurringErrorMessage( error.Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+			return;
+		}
 	}
 
-	StoreRecurringErrorMessage( " **   ~~~   ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	for ( int Loop = 1; Loop <= SearchCounts; ++Loop ) {
+		if ( has( Message, MessageSearch( Loop ) ) ) {
+			++MatchCounts( Loop );
+			SearchMatches.push_back( Loop );
+		}
+	}
+
+	DesignatedMessage = Designation + Message;
+	StoreRecurringErrorMessage( DesignatedMessage, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+
+	// Keep the searches matched by the stored text for its repeats
+	if ( MsgIndex > 0 ) {
+		auto & error( RecurringErrors( MsgIndex ) );
+		if ( ! error.SearchMatchesKnown && error.Message == DesignatedMessage ) {
+			error.SearchMatches = SearchMatches;
+			error.SearchMatchesKnown = true;
+		}
+	}
 
 }
 
@@ -1451,8 +1519,10 @@ StoreRecurringErrorMessage(
 
 	// If Index is zero, then assign next available index and reallocate array
 	if ( ErrorMsgIndex == 0 ) {
-		RecurringErrors.redimension( ++NumRecurringErrors );
-		ErrorMsgIndex = NumRecurringErrors;
+		// The array grows by doubling so that each new message does not copy all of the stored ones
+		if ( NumRecurringErrors >= RecurringErrors.isize() ) RecurringErrors.redimension( max( 2 * NumRecurringErrors, 16 ) );
+		ErrorMsgIndex = ++NumRecurringErrors;
+		RecurringErrors( ErrorMsgIndex ) = RecurringErrorData();
 		// The message string only needs to be stored once when a new recurring message is created
 		RecurringErrors( ErrorMsgIndex ).Message = ErrorMessage;
 		RecurringErrors( ErrorMsgIndex ).Count = 1;
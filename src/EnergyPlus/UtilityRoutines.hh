@@ -193,6 +193,19 @@ ShowRecurringContinueErrorAtEnd(
 	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
 );
 
+void
+StoreDesignatedRecurringErrorMessage(
+	std::string const & Designation, // Error designation written ahead of the message, e.g. " ** Warning ** "
+	std::string const & Message, // Message automatically written to "error file" at end of simulation
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf = _, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf = _, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf = _, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits = "", // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits = "", // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
+);
+
 void
 StoreRecurringErrorMessage(
 	std::string const & ErrorMessage, // Message automatically written to "error file" at end of simulation
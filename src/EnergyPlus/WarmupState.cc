@@ -0,0 +1,304 @@
+// C++ Headers
+#include <fstream>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array.functions.hh>
+
+// EnergyPlus Headers
+#include <WarmupState.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataSystemVariables.hh>
+#include <DisplayRoutines.hh>
+#include <General.hh>
+#include <HeatBalanceManager.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace WarmupState {
+
+	// PURPOSE OF THIS MODULE:
+	// Saves the converged heat balance state at the end of the warmup of each environment to a
+	// file, so that a later run of the same building (with other HVAC or controls) can continue
+	// its warmup from it instead of from the initial conditions.
+
+	// METHODOLOGY EMPLOYED:
+	// With the WarmupStateFile environment variable set, the state is saved when the warmup of
+	// an environment converges.  A later run restores it at the end of its first warmup day,
+	// together with the peak temperatures and loads of the last saved warmup day, and the next
+	// day is checked against those; if it converges the warmup ends there instead of running the
+	// minimum number of warmup days.  The state held is the surface CTF histories and the zone
+	// air temperature and humidity histories, so it is only used for models whose surfaces all
+	// use the CTF algorithm and that have no ground heat transfer domains.  A state whose array
+	// sizes differ from those of the model is not used.
+
+	// File layout (native byte order): the signature, then for each environment the lengths of
+	// its key, array size list, real values and integer values (32 bit), the key characters, the
+	// array sizes (64 bit), the real values and the integer values.
+
+	// REFERENCES: na
+
+	// OTHER NOTES: na
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	std::string const WarmupStateMagic( "EPWUST01" ); // File signature and format version of the warmup state file
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool WarmupSeeded( false ); // True if the warmup of the current environment continues from a saved state
+
+	// Object Data
+	WarmupStateFileData WarmupStateFile;
+
+	// Functions
+
+	namespace {
+		void
+		ListStateArrays(
+			std::vector< Array< Real64 > * > & RealArrays,
+			std::vector< Array< int > * > & IntArrays
+		)
+		{
+			// The arrays of the heat balance state carried from one day to the next
+
+			using namespace DataHeatBalSurface;
+			using namespace DataHeatBalFanSys;
+
+			RealArrays = { &TH, &QH, &THM, &QHM, &TsrcHist, &QsrcHist, &TsrcHistM, &QsrcHistM, &TempSurfIn, &TempSurfInTmp, &TempSurfOut, &DataHeatBalance::TempEffBulkAir, &DataHeatBalance::MRT, &MAT, &ZT, &ZTAV, &TempTstatAir, &XMAT, &XM2T, &XM3T, &XM4T, &DSXMAT, &DSXM2T, &DSXM3T, &DSXM4T, &XMPT, &ZoneT1, &ZoneAirHumRat, &ZoneAirHumRatAvg, &WZoneTimeMinus1, &WZoneTimeMinus2, &WZoneTimeMinus3, &WZoneTimeMinus4, &DSWZoneTimeMinus1, &DSWZoneTimeMinus2, &DSWZoneTimeMinus3, &DSWZoneTimeMinus4, &WZoneTimeMinusP, &ZoneAirHumRatTemp, &WZoneTimeMinus1Temp, &WZoneTimeMinus2Temp, &WZoneTimeMinus3Temp, &ZoneAirHumRatOld, &ZoneW1, &HeatBalanceManager::MaxTempPrevDay, &HeatBalanceManager::MinTempPrevDay, &HeatBalanceManager::MaxHeatLoadPrevDay, &HeatBalanceManager::MaxCoolLoadPrevDay };
+			IntArrays = { &SUMH };
+		}
+	}
+
+	void
+	ReadWarmupStateFile( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the states saved in the warmup state file, if it exists.
+
+		// METHODOLOGY EMPLOYED:
+		// A file without the signature, or with a truncated record, is treated as empty from the
+		// first record that cannot be read.
+
+		WarmupStateFile.Read = true;
+		WarmupStateFile.FileName = FileName;
+		WarmupStateFile.States.clear();
+
+		std::ifstream File( FileName, std::ios::in | std::ios::binary );
+		if ( ! File.is_open() ) return;
+		char Magic[ 8 ];
+		File.read( Magic, 8 );
+		if ( ! File.good() || std::string( Magic, 8 ) != WarmupStateMagic ) return;
+
+		while ( true ) {
+			int Head[ 4 ]; // Lengths of the key, sizes, values and integer values
+			File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+			if ( ! File.good() || Head[ 0 ] < 0 || Head[ 1 ] < 0 || Head[ 2 ] < 0 || Head[ 3 ] < 0 ) break;
+			std::string Key( Head[ 0 ], ' ' );
+			WarmupStateData State;
+			State.Sizes.resize( Head[ 1 ] );
+			State.Values.resize( Head[ 2 ] );
+			State.IntValues.resize( Head[ 3 ] );
+			File.read( &Key[ 0 ], Head[ 0 ] );
+			File.read( reinterpret_cast< char * >( State.Sizes.data() ), Head[ 1 ] * sizeof( Int64 ) );
+			File.read( reinterpret_cast< char * >( State.Values.data() ), Head[ 2 ] * sizeof( Real64 ) );
+			File.read( reinterpret_cast< char * >( State.IntValues.data() ), Head[ 3 ] * sizeof( int ) );
+			if ( ! File.good() ) break; // Truncated record
+			WarmupStateFile.States[ Key ] = std::move( State );
+		}
+
+	}
+
+	void
+	WriteWarmupStateFile()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes all the states held to the warmup state file.
+
+		std::ofstream File( WarmupStateFile.FileName, std::ios::out | std::ios::binary | std::ios::trunc );
+		if ( File.is_open() ) {
+			File.write( WarmupStateMagic.c_str(), 8 );
+			for ( auto const & Saved : WarmupStateFile.States ) {
+				auto const & State( Saved.second );
+				int const Head[ 4 ] = { int( Saved.first.size() ), int( State.Sizes.size() ), int( State.Values.size() ), int( State.IntValues.size() ) };
+				File.write( reinterpret_cast< char const * >( Head ), sizeof( Head ) );
+				File.write( Saved.first.data(), Head[ 0 ] );
+				File.write( reinterpret_cast< char const * >( State.Sizes.data() ), Head[ 1 ] * sizeof( Int64 ) );
+				File.write( reinterpret_cast< char const * >( State.Values.data() ), Head[ 2 ] * sizeof( Real64 ) );
+				File.write( reinterpret_cast< char const * >( State.IntValues.data() ), Head[ 3 ] * sizeof( int ) );
+			}
+		}
+		if ( ! File.good() ) {
+			ShowWarningError( "WriteWarmupStateFile: Could not write warmup state file \"" + WarmupStateFile.FileName + "\"." );
+		}
+
+	}
+
+	bool
+	WarmupStateAvailable()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// True if the state of the model is fully held by the arrays saved.
+
+		using DataGlobals::NumOfZones;
+		using DataGlobals::AnySlabsInModel;
+		using DataGlobals::AnyBasementsInModel;
+		using DataHeatBalance::HeatTransferAlgosUsed;
+		using DataHeatBalance::UseCTF;
+
+		if ( NumOfZones <= 0 || AnySlabsInModel || AnyBasementsInModel ) return false;
+		for ( int AlgoNum = 1; AlgoNum <= HeatTransferAlgosUsed.isize(); ++AlgoNum ) {
+			if ( HeatTransferAlgosUsed( AlgoNum ) != UseCTF ) return false;
+		}
+		return true;
+
+	}
+
+	std::string
+	WarmupStateKey()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the key of the state of the current environment: its kind, whether it is run for
+		// sizing, and its name.
+
+		using General::TrimSigDigits;
+
+		return TrimSigDigits( DataGlobals::KindOfSim ) + ( DataGlobals::DoingSizing ? ",Sizing," : "," ) + DataEnvironment::EnvironmentName;
+
+	}
+
+	void
+	GatherWarmupState( WarmupStateData & State )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the heat balance state into State.
+
+		std::vector< Array< Real64 > * > RealArrays;
+		std::vector< Array< int > * > IntArrays;
+		ListStateArrays( RealArrays, IntArrays );
+
+		State.Sizes.clear();
+		State.Values.clear();
+		State.IntValues.clear();
+		for ( auto const Values : RealArrays ) {
+			State.Sizes.push_back( Int64( Values->size() ) );
+			for ( Array< Real64 >::size_type i = 0; i < Values->size(); ++i ) State.Values.push_back( ( *Values )[ i ] );
+		}
+		for ( auto const Values : IntArrays ) {
+			State.Sizes.push_back( Int64( Values->size() ) );
+			for ( Array< int >::size_type i = 0; i < Values->size(); ++i ) State.IntValues.push_back( ( *Values )[ i ] );
+		}
+
+	}
+
+	bool
+	ScatterWarmupState( WarmupStateData const & State )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Copies State into the heat balance state.  Returns false, changing nothing, if its array
+		// sizes are not those of the model.
+
+		std::vector< Array< Real64 > * > RealArrays;
+		std::vector< Array< int > * > IntArrays;
+		ListStateArrays( RealArrays, IntArrays );
+
+		if ( State.Sizes.size() != RealArrays.size() + IntArrays.size() ) return false;
+		std::size_t NumValues( 0 );
+		std::size_t NumIntValues( 0 );
+		for ( std::size_t ArrayNum = 0; ArrayNum < RealArrays.size(); ++ArrayNum ) {
+			if ( State.Sizes[ ArrayNum ] != Int64( RealArrays[ ArrayNum ]->size() ) ) return false;
+			NumValues += RealArrays[ ArrayNum ]->size();
+		}
+		for ( std::size_t ArrayNum = 0; ArrayNum < IntArrays.size(); ++ArrayNum ) {
+			if ( State.Sizes[ RealArrays.size() + ArrayNum ] != Int64( IntArrays[ ArrayNum ]->size() ) ) return false;
+			NumIntValues += IntArrays[ ArrayNum ]->size();
+		}
+		if ( State.Values.size() != NumValues || State.IntValues.size() != NumIntValues ) return false;
+
+		std::size_t Value( 0 );
+		for ( auto const Values : RealArrays ) {
+			for ( Array< Real64 >::size_type i = 0; i < Values->size(); ++i ) ( *Values )[ i ] = State.Values[ Value++ ];
+		}
+		Value = 0;
+		for ( auto const Values : IntArrays ) {
+			for ( Array< int >::size_type i = 0; i < Values->size(); ++i ) ( *Values )[ i ] = State.IntValues[ Value++ ];
+		}
+		return true;
+
+	}
+
+	void
+	SaveWarmupState()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the state at the end of the warmup of the current environment, if every zone
+		// passed the convergence checks.
+
+		using DataGlobals::NumOfZones;
+		using HeatBalanceManager::WarmupConvergenceValues;
+
+		if ( ! WarmupStateAvailable() ) return;
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( sum( WarmupConvergenceValues( ZoneNum ).PassFlag ) != 8 ) return; // Ended at the maximum number of warmup days
+		}
+		if ( ! WarmupStateFile.Read || WarmupStateFile.FileName != DataSystemVariables::WarmupStateFileName ) ReadWarmupStateFile( DataSystemVariables::WarmupStateFileName );
+
+		GatherWarmupState( WarmupStateFile.States[ WarmupStateKey() ] );
+		WriteWarmupStateFile();
+
+	}
+
+	bool
+	RestoreWarmupState()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets the state saved for the current environment, if there is one that fits the model.
+
+		if ( ! WarmupStateAvailable() ) return false;
+		if ( ! WarmupStateFile.Read || WarmupStateFile.FileName != DataSystemVariables::WarmupStateFileName ) ReadWarmupStateFile( DataSystemVariables::WarmupStateFileName );
+
+		auto const Found( WarmupStateFile.States.find( WarmupStateKey() ) );
+		if ( Found == WarmupStateFile.States.end() ) return false;
+		if ( ! ScatterWarmupState( Found->second ) ) return false;
+		DisplayString( "Continuing warmup from the state saved in \"" + WarmupStateFile.FileName + "\"" );
+		return true;
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // WarmupState
+
+} // EnergyPlus
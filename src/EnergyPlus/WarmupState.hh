@@ -0,0 +1,110 @@
+#ifndef WarmupState_hh_INCLUDED
+#define WarmupState_hh_INCLUDED
+
+// C++ Headers
+#include <map>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace WarmupState {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern std::string const WarmupStateMagic; // File signature and format version of the warmup state file
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool WarmupSeeded; // True if the warmup of the current environment continues from a saved state
+
+	// Types
+
+	struct WarmupStateData
+	{
+		// Heat balance state at the end of the last warmup day of an environment
+
+		// Members
+		std::vector< Int64 > Sizes; // Size of each state array, in the order they are listed
+		std::vector< Real64 > Values; // Values of the real arrays, one array after the other
+		std::vector< int > IntValues; // Values of the integer arrays
+
+		// Default Constructor
+		WarmupStateData()
+		{}
+
+	};
+
+	struct WarmupStateFileData
+	{
+		// Members
+		bool Read; // True once the file given has been read
+		std::string FileName; // Warmup state file name
+		std::map< std::string, WarmupStateData > States; // Saved state of each environment, by key
+
+		// Default Constructor
+		WarmupStateFileData() :
+			Read( false )
+		{}
+
+	};
+
+	// Object Data
+	extern WarmupStateFileData WarmupStateFile;
+
+	// Functions
+
+	void
+	ReadWarmupStateFile( std::string const & FileName );
+
+	void
+	WriteWarmupStateFile();
+
+	bool
+	WarmupStateAvailable();
+
+	std::string
+	WarmupStateKey();
+
+	void
+	GatherWarmupState( WarmupStateData & State );
+
+	bool
+	ScatterWarmupState( WarmupStateData const & State );
+
+	void
+	SaveWarmupState();
+
+	bool
+	RestoreWarmupState();
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // WarmupState
+
+} // EnergyPlus
+
+#endif
@@ -166,6 +166,7 @@ namespace WaterCoils {
 	// Object Data
 	Array1D< WaterCoilEquipConditions > WaterCoil;
 	Array1D< WaterCoilNumericFieldData > WaterCoilNumericFields;
+	Array1D< DetailedCoilAirSideData > DetailedCoilAirSide; // Last air side results of the detailed flat fin model
 
 	// MODULE SUBROUTINES:
 	//*************************************************************************
@@ -769,6 +770,7 @@ namespace WaterCoils {
 		// Using/Aliasing
 		using General::RoundSigDigits;
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 		using General::Iterate;
 		using General::SafeDivide;
 		using DataSizing::AutoSize;
@@ -887,6 +889,7 @@ namespace WaterCoils {
 			MyEnvrnFlag.allocate( NumWaterCoils );
 			MySizeFlag.allocate( NumWaterCoils );
 			CoilWarningOnceFlag.allocate( NumWaterCoils );
+			DetailedCoilAirSide.allocate( NumWaterCoils );
 			DesCpAir.allocate( NumWaterCoils );
 			MyUAAndFlowCalcFlag.allocate( NumWaterCoils );
 			MyCoilDesignFlag.allocate( NumWaterCoils );
@@ -993,7 +996,7 @@ namespace WaterCoils {
 							UA0 = 0.001 * WaterCoil( CoilNum ).DesTotWaterCoilLoad;
 							UA1 = WaterCoil( CoilNum ).DesTotWaterCoilLoad;
 							// Invert the simple heating coil model: given the design inlet conditions and the design load, fins the design UA
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleHeatingCoilUAResidual, UA0, UA1, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleHeatingCoilUAResidual, UA0, UA1, Par, RootSolverCallSiteIndex( "Design UA", "Coil:" + WaterCoil( CoilNum ).WaterCoilTypeA + ":Water", WaterCoil( CoilNum ).Name ) );
 							// if the numerical inversion failed, issue error messages.
 							if ( SolFla == -1 ) {
 								ShowSevereError( "Calculation of heating coil UA failed for coil " + WaterCoil( CoilNum ).Name );
@@ -1323,7 +1326,7 @@ namespace WaterCoils {
 				UA0 = 0.1 * WaterCoil( CoilNum ).UACoilExternal;
 				UA1 = 10.0 * WaterCoil( CoilNum ).UACoilExternal;
 				// Invert the simple cooling coil model: given the design inlet conditions and the design load, find the design UA
-				SolveRegulaFalsi( 0.001, MaxIte, SolFla, UA, SimpleCoolingCoilUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( 0.001, MaxIte, SolFla, UA, SimpleCoolingCoilUAResidual, UA0, UA1, Par, RootSolverCallSiteIndex( "Design UA", "Coil:" + WaterCoil( CoilNum ).WaterCoilTypeA + ":Water", WaterCoil( CoilNum ).Name ) );
 				// if the numerical inversion failed, issue error messages.
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Calculation of cooling coil design UA failed for coil " + WaterCoil( CoilNum ).Name );
@@ -1604,6 +1607,7 @@ namespace WaterCoils {
 		// Using/Aliasing
 		using namespace DataSizing;
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 		using General::TrimSigDigits;
 		using General::RoundSigDigits;
 		using PlantUtilities::RegisterPlantCompDesignFlow;
@@ -2417,112 +2421,139 @@ namespace WaterCoils {
 			//        known thermodynamic functions
 			// All coil calcs are done in KJoules.  Convert to KJ here and then convert
 			//  back to Joules at the end of the Subroutine.
-			DryAirSpecHeat = PsyCpAirFnWTdb( zero, TempAirIn ) * ConvK;
-			MoistAirSpecificHeat = PsyCpAirFnWTdb( InletAirHumRat, TempAirIn ) * ConvK;
 			InletAirEnthalpy = WaterCoil( CoilNum ).InletAirEnthalpy * ConvK;
 
-			EnterAirDewPoint = PsyTdpFnWPb( InletAirHumRat, OutBaroPress, RoutineName );
-			//       Ratio of secondary (fin) to total (secondary plus primary) surface areas
-			FinToTotSurfAreaRatio = WaterCoil( CoilNum ).FinSurfArea / WaterCoil( CoilNum ).TotCoilOutsideSurfArea;
-			//      known water and air flow parameters:
-			rho = GetDensityGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, TempWaterIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
-			//      water flow velocity - assuming number of water circuits = NumOfTubesPerRow
-			TubeWaterVel = WaterMassFlowRate * 4.0 / ( WaterCoil( CoilNum ).NumOfTubesPerRow * rho * Pi * WaterCoil( CoilNum ).TubeInsideDiam * WaterCoil( CoilNum ).TubeInsideDiam );
-			//      air mass flow rate per unit area
-			ScaledAirMassFlowRate = ( 1.0 + InletAirHumRat ) * AirMassFlow / WaterCoil( CoilNum ).MinAirFlowArea;
-			//      air flow Reynold's Number
-			AirReynoldsNo = WaterCoil( CoilNum ).CoilEffectiveInsideDiam * ScaledAirMassFlowRate / AirViscosity;
-			//       heat transfer coefficients and resistance components:
-			//              inside (water)
-			WaterToTubeThermResist = std::pow( WaterCoil( CoilNum ).TubeInsideDiam, 0.2 ) / ( WaterCoil( CoilNum ).TotTubeInsideArea * 1.429 * std::pow( TubeWaterVel, 0.8 ) );
-			//              metal and fouling
-			TubeFoulThermResist = ( 0.5 * ( WaterCoil( CoilNum ).TubeOutsideDiam - WaterCoil( CoilNum ).TubeInsideDiam ) / ( ConvK * WaterCoil( CoilNum ).TubeThermConductivity ) + TubeFoulFactor ) / WaterCoil( CoilNum ).TotTubeInsideArea;
-			//              outside (wet and dry coil)
-			FilmCoefEqnFactor = WaterCoil( CoilNum ).GeometryCoef1 * std::pow( AirReynoldsNo, WaterCoil( CoilNum ).GeometryCoef2 );
-			//       (1.23 is 1/Prandt(air)**(2/3))
-			AirSideDrySurfFilmCoef = 1.23 * FilmCoefEqnFactor * MoistAirSpecificHeat * ScaledAirMassFlowRate;
-			FilmCoefReynldsCorrelatnFact = 1.425 + AirReynoldsNo * ( -0.51e-3 + AirReynoldsNo * 0.263e-6 );
-			//       NOTE: the equation for FilmCoefReynldsCorrelatnFact generates valid results over
-			//             a limited range of Air Reynolds Numbers as indicated by
-			//             deleted code below.  Reynolds Numbers outside this range
-			//             may result in inaccurate results or failure of the coil
-			//             simulation to obtain a solution
-			//             Deleted code by J.C. Vanderzee
-
-			AirSideWetSurfFilmCoef = FilmCoefReynldsCorrelatnFact * AirSideDrySurfFilmCoef;
-			//--                     need wet fin efficiency for outside
-			RaisedInletWaterTemp = TempWaterIn + 0.5;
-
-			// By this statement the Inlet Air enthalpy will never be equal to AirEnthAtRsdInletWaterTemp
-			if ( ( RaisedInletWaterTemp - TempAirIn ) < 0.000001 ) {
-				RaisedInletWaterTemp = TempWaterIn + 0.3;
-			}
-			if ( TempAirIn < RaisedInletWaterTemp ) {
-				RaisedInletWaterTemp = TempAirIn - 0.3;
-			}
+			// The air side results do not depend on the water flow rate, which is all that changes
+			// while the coil controller iterates, so they are kept for the next call with the same inlet state
+			auto & AirSide( DetailedCoilAirSide( CoilNum ) );
+			if ( CalcMode != DesignCalc && AirSide.Valid && AirSide.AirMassFlow == AirMassFlow && AirSide.TempAirIn == TempAirIn && AirSide.InletAirHumRat == InletAirHumRat && AirSide.InletAirEnthalpy == WaterCoil( CoilNum ).InletAirEnthalpy && AirSide.TempWaterIn == TempWaterIn && AirSide.BaroPress == OutBaroPress ) {
+				MoistAirSpecificHeat = AirSide.MoistAirSpecificHeat;
+				EnterAirDewPoint = AirSide.EnterAirDewPoint;
+				CoilToAirThermResistWetSurf = AirSide.CoilToAirThermResistWetSurf;
+				CoilToAirThermResistDrySurf = AirSide.CoilToAirThermResistDrySurf;
+				rho = AirSide.WaterDensity;
+				Cp = AirSide.WaterSpecHeat;
+			} else {
+				DryAirSpecHeat = PsyCpAirFnWTdb( zero, TempAirIn ) * ConvK;
+				MoistAirSpecificHeat = PsyCpAirFnWTdb( InletAirHumRat, TempAirIn ) * ConvK;
+
+				EnterAirDewPoint = PsyTdpFnWPb( InletAirHumRat, OutBaroPress, RoutineName );
+				//       Ratio of secondary (fin) to total (secondary plus primary) surface areas
+				FinToTotSurfAreaRatio = WaterCoil( CoilNum ).FinSurfArea / WaterCoil( CoilNum ).TotCoilOutsideSurfArea;
+				//      known water and air flow parameters:
+				rho = GetDensityGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, TempWaterIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+				//      air mass flow rate per unit area
+				ScaledAirMassFlowRate = ( 1.0 + InletAirHumRat ) * AirMassFlow / WaterCoil( CoilNum ).MinAirFlowArea;
+				//      air flow Reynold's Number
+				AirReynoldsNo = WaterCoil( CoilNum ).CoilEffectiveInsideDiam * ScaledAirMassFlowRate / AirViscosity;
+				//       heat transfer coefficients and resistance components:
+				//              outside (wet and dry coil)
+				FilmCoefEqnFactor = WaterCoil( CoilNum ).GeometryCoef1 * std::pow( AirReynoldsNo, WaterCoil( CoilNum ).GeometryCoef2 );
+				//       (1.23 is 1/Prandt(air)**(2/3))
+				AirSideDrySurfFilmCoef = 1.23 * FilmCoefEqnFactor * MoistAirSpecificHeat * ScaledAirMassFlowRate;
+				FilmCoefReynldsCorrelatnFact = 1.425 + AirReynoldsNo * ( -0.51e-3 + AirReynoldsNo * 0.263e-6 );
+				//       NOTE: the equation for FilmCoefReynldsCorrelatnFact generates valid results over
+				//             a limited range of Air Reynolds Numbers as indicated by
+				//             deleted code below.  Reynolds Numbers outside this range
+				//             may result in inaccurate results or failure of the coil
+				//             simulation to obtain a solution
+				//             Deleted code by J.C. Vanderzee
+
+				AirSideWetSurfFilmCoef = FilmCoefReynldsCorrelatnFact * AirSideDrySurfFilmCoef;
+				//--                     need wet fin efficiency for outside
+				RaisedInletWaterTemp = TempWaterIn + 0.5;
+
+				// By this statement the Inlet Air enthalpy will never be equal to AirEnthAtRsdInletWaterTemp
+				if ( ( RaisedInletWaterTemp - TempAirIn ) < 0.000001 ) {
+					RaisedInletWaterTemp = TempWaterIn + 0.3;
+				}
+				if ( TempAirIn < RaisedInletWaterTemp ) {
+					RaisedInletWaterTemp = TempAirIn - 0.3;
+				}
 
-			RsdInletWaterTempSatAirHumRat = PsyWFnTdbRhPb( RaisedInletWaterTemp, unity, OutBaroPress, RoutineName );
-			AirEnthAtRsdInletWaterTemp = PsyHFnTdbW( RaisedInletWaterTemp, RsdInletWaterTempSatAirHumRat ) * ConvK;
+				RsdInletWaterTempSatAirHumRat = PsyWFnTdbRhPb( RaisedInletWaterTemp, unity, OutBaroPress, RoutineName );
+				AirEnthAtRsdInletWaterTemp = PsyHFnTdbW( RaisedInletWaterTemp, RsdInletWaterTempSatAirHumRat ) * ConvK;
 
-			SensToTotEnthDiffRatio = DryAirSpecHeat * ( TempAirIn - RaisedInletWaterTemp ) / ( InletAirEnthalpy - AirEnthAtRsdInletWaterTemp );
+				SensToTotEnthDiffRatio = DryAirSpecHeat * ( TempAirIn - RaisedInletWaterTemp ) / ( InletAirEnthalpy - AirEnthAtRsdInletWaterTemp );
 
-			EnterAirHumRatDiff = InletAirHumRat - RsdInletWaterTempSatAirHumRat;
-			DryFinEfficncy = 0.5 * ( WaterCoil( CoilNum ).EffectiveFinDiam - WaterCoil( CoilNum ).TubeOutsideDiam ) * std::sqrt( 2.0 * AirSideWetSurfFilmCoef / ( ConvK * WaterCoil( CoilNum ).FinThermConductivity * WaterCoil( CoilNum ).FinThickness ) );
-			if ( EnterAirHumRatDiff < 0 ) {
-				//       note that this condition indicates dry coil
-				EnterAirHumRatDiff = -EnterAirHumRatDiff;
-				SensToTotEnthDiffRatio = std::abs( SensToTotEnthDiffRatio );
-			}
+				EnterAirHumRatDiff = InletAirHumRat - RsdInletWaterTempSatAirHumRat;
+				DryFinEfficncy = 0.5 * ( WaterCoil( CoilNum ).EffectiveFinDiam - WaterCoil( CoilNum ).TubeOutsideDiam ) * std::sqrt( 2.0 * AirSideWetSurfFilmCoef / ( ConvK * WaterCoil( CoilNum ).FinThermConductivity * WaterCoil( CoilNum ).FinThickness ) );
+				if ( EnterAirHumRatDiff < 0 ) {
+					//       note that this condition indicates dry coil
+					EnterAirHumRatDiff = -EnterAirHumRatDiff;
+					SensToTotEnthDiffRatio = std::abs( SensToTotEnthDiffRatio );
+				}
 
-			if ( EnterAirHumRatDiff > 1.0 ) {
-				EnterAirHumRatDiff = 1.0;
-			} else if ( EnterAirHumRatDiff < 0.00001 ) {
-				EnterAirHumRatDiff = 0.00001;
-			}
+				if ( EnterAirHumRatDiff > 1.0 ) {
+					EnterAirHumRatDiff = 1.0;
+				} else if ( EnterAirHumRatDiff < 0.00001 ) {
+					EnterAirHumRatDiff = 0.00001;
+				}
 
-			if ( DryFinEfficncy > 1.0 ) {
-				DryFinEfficncy = 1.0;
-			} else if ( DryFinEfficncy < 0.00001 ) {
-				DryFinEfficncy = 0.00001;
-			}
+				if ( DryFinEfficncy > 1.0 ) {
+					DryFinEfficncy = 1.0;
+				} else if ( DryFinEfficncy < 0.00001 ) {
+					DryFinEfficncy = 0.00001;
+				}
 
-			if ( TempAirIn > 48.0 / 1.8 ) {
-				WetFinEfficncy = exp_47 * std::pow( SensToTotEnthDiffRatio, 0.09471 ) * std::pow( EnterAirHumRatDiff, 0.0108 ) * std::pow( DryFinEfficncy, -0.50303 );
-			} else {
-				WetFinEfficncy = exp_35 * std::pow( SensToTotEnthDiffRatio, 0.16081 ) * std::pow( EnterAirHumRatDiff, 0.01995 ) * std::pow( DryFinEfficncy, -0.52951 );
-			}
+				if ( TempAirIn > 48.0 / 1.8 ) {
+					WetFinEfficncy = exp_47 * std::pow( SensToTotEnthDiffRatio, 0.09471 ) * std::pow( EnterAirHumRatDiff, 0.0108 ) * std::pow( DryFinEfficncy, -0.50303 );
+				} else {
+					WetFinEfficncy = exp_35 * std::pow( SensToTotEnthDiffRatio, 0.16081 ) * std::pow( EnterAirHumRatDiff, 0.01995 ) * std::pow( DryFinEfficncy, -0.52951 );
+				}
 
-			if ( WetFinEfficncy > 1.0 ) WetFinEfficncy = 0.99;
-			if ( WetFinEfficncy < 0.0 ) WetFinEfficncy = 0.001;
-			//       wet coil fin efficiency
-
-			WetCoilFinEfficncy = 1.0 + FinToTotSurfAreaRatio * ( WetFinEfficncy - 1.0 );
-			//       wet coil outside thermal resistance = [1/UA] (wet coil)
-			CoilToAirThermResistWetSurf = MoistAirSpecificHeat / ( WaterCoil( CoilNum ).TotCoilOutsideSurfArea * AirSideWetSurfFilmCoef * WetCoilFinEfficncy );
-			//--                     and dry fin efficiency
-			DryFinEfficncy = 0.5 * ( WaterCoil( CoilNum ).EffectiveFinDiam - WaterCoil( CoilNum ).TubeOutsideDiam ) * std::sqrt( 2.0 * AirSideDrySurfFilmCoef / ( ConvK * WaterCoil( CoilNum ).FinThermConductivity * WaterCoil( CoilNum ).FinThickness ) );
-			//      NOTE: The same caveats on the validity of the FilmCoefReynldsCorrelatnFact equation
-			//            hold for the DryFinEfficncy equation.  Values of DryFinEfficncy outside the
-			//            specified range of validity are not guaranteed to
-			//            produce results
-			//             Deleted code by J.C. Vanderzee
-			//       dry coil fin efficiency
-			DryCoilEfficiency = 0.0;
-//Tuned Replaced by below to eliminate pow calls
-//			for ( CoefPointer = 1; CoefPointer <= 5; ++CoefPointer ) {
-//				DryCoilEfficiency += WaterCoil( CoilNum ).DryFinEfficncyCoef( CoefPointer ) * std::pow( DryFinEfficncy, CoefPointer - 1 );
-//			} // CoefPointer
-			auto const & dry_fin_eff_coef( WaterCoil( CoilNum ).DryFinEfficncyCoef );
-			auto DryFinEfficncy_pow( 1.0 );
-			for ( CoefPointer = 1; CoefPointer <= 5; ++CoefPointer ) {
-				DryCoilEfficiency += dry_fin_eff_coef( CoefPointer ) * DryFinEfficncy_pow;
-				DryFinEfficncy_pow *= DryFinEfficncy;
-			} // CoefPointer
-			DryCoilEfficiency = 1.0 + FinToTotSurfAreaRatio * ( DryCoilEfficiency - 1.0 );
-			//       dry coil outside thermal resistance = [1/UA] (dry coil)
-			CoilToAirThermResistDrySurf = 1.0 / ( WaterCoil( CoilNum ).TotCoilOutsideSurfArea * AirSideDrySurfFilmCoef * DryCoilEfficiency );
-			//       definitions made to simplify some of the expressions used below
-			Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, TempWaterIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+				if ( WetFinEfficncy > 1.0 ) WetFinEfficncy = 0.99;
+				if ( WetFinEfficncy < 0.0 ) WetFinEfficncy = 0.001;
+				//       wet coil fin efficiency
+
+				WetCoilFinEfficncy = 1.0 + FinToTotSurfAreaRatio * ( WetFinEfficncy - 1.0 );
+				//       wet coil outside thermal resistance = [1/UA] (wet coil)
+				CoilToAirThermResistWetSurf = MoistAirSpecificHeat / ( WaterCoil( CoilNum ).TotCoilOutsideSurfArea * AirSideWetSurfFilmCoef * WetCoilFinEfficncy );
+				//--                     and dry fin efficiency
+				DryFinEfficncy = 0.5 * ( WaterCoil( CoilNum ).EffectiveFinDiam - WaterCoil( CoilNum ).TubeOutsideDiam ) * std::sqrt( 2.0 * AirSideDrySurfFilmCoef / ( ConvK * WaterCoil( CoilNum ).FinThermConductivity * WaterCoil( CoilNum ).FinThickness ) );
+				//      NOTE: The same caveats on the validity of the FilmCoefReynldsCorrelatnFact equation
+				//            hold for the DryFinEfficncy equation.  Values of DryFinEfficncy outside the
+				//            specified range of validity are not guaranteed to
+				//            produce results
+				//             Deleted code by J.C. Vanderzee
+				//       dry coil fin efficiency
+				DryCoilEfficiency = 0.0;
+	//Tuned Replaced by below to eliminate pow calls
+	//			for ( CoefPointer = 1; CoefPointer <= 5; ++CoefPointer ) {
+	//				DryCoilEfficiency += WaterCoil( CoilNum ).DryFinEfficncyCoef( CoefPointer ) * std::pow( DryFinEfficncy, CoefPointer - 1 );
+	//			} // CoefPointer
+				auto const & dry_fin_eff_coef( WaterCoil( CoilNum ).DryFinEfficncyCoef );
+				auto DryFinEfficncy_pow( 1.0 );
+				for ( CoefPointer = 1; CoefPointer <= 5; ++CoefPointer ) {
+					DryCoilEfficiency += dry_fin_eff_coef( CoefPointer ) * DryFinEfficncy_pow;
+					DryFinEfficncy_pow *= DryFinEfficncy;
+				} // CoefPointer
+				DryCoilEfficiency = 1.0 + FinToTotSurfAreaRatio * ( DryCoilEfficiency - 1.0 );
+				//       dry coil outside thermal resistance = [1/UA] (dry coil)
+				CoilToAirThermResistDrySurf = 1.0 / ( WaterCoil( CoilNum ).TotCoilOutsideSurfArea * AirSideDrySurfFilmCoef * DryCoilEfficiency );
+				//       definitions made to simplify some of the expressions used below
+				Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, TempWaterIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+
+				AirSide.Valid = ( CalcMode != DesignCalc ); // the design calculation may precede sizing of the geometry
+				AirSide.AirMassFlow = AirMassFlow;
+				AirSide.TempAirIn = TempAirIn;
+				AirSide.InletAirHumRat = InletAirHumRat;
+				AirSide.InletAirEnthalpy = WaterCoil( CoilNum ).InletAirEnthalpy;
+				AirSide.TempWaterIn = TempWaterIn;
+				AirSide.BaroPress = OutBaroPress;
+				AirSide.MoistAirSpecificHeat = MoistAirSpecificHeat;
+				AirSide.EnterAirDewPoint = EnterAirDewPoint;
+				AirSide.CoilToAirThermResistWetSurf = CoilToAirThermResistWetSurf;
+				AirSide.CoilToAirThermResistDrySurf = CoilToAirThermResistDrySurf;
+				AirSide.WaterDensity = rho;
+				AirSide.WaterSpecHeat = Cp;
+			}
+			//      water flow velocity - assuming number of water circuits = NumOfTubesPerRow
+			TubeWaterVel = WaterMassFlowRate * 4.0 / ( WaterCoil( CoilNum ).NumOfTubesPerRow * rho * Pi * WaterCoil( CoilNum ).TubeInsideDiam * WaterCoil( CoilNum ).TubeInsideDiam );
+			//              inside (water)
+			WaterToTubeThermResist = std::pow( WaterCoil( CoilNum ).TubeInsideDiam, 0.2 ) / ( WaterCoil( CoilNum ).TotTubeInsideArea * 1.429 * std::pow( TubeWaterVel, 0.8 ) );
+			//              metal and fouling
+			TubeFoulThermResist = ( 0.5 * ( WaterCoil( CoilNum ).TubeOutsideDiam - WaterCoil( CoilNum ).TubeInsideDiam ) / ( ConvK * WaterCoil( CoilNum ).TubeThermConductivity ) + TubeFoulFactor ) / WaterCoil( CoilNum ).TotTubeInsideArea;
 			ScaledWaterSpecHeat = WaterMassFlowRate * Cp * ConvK / AirMassFlow;
 			DryCoilCoeff1 = 1.0 / ( AirMassFlow * MoistAirSpecificHeat ) - 1.0 / ( WaterMassFlowRate * Cp * ConvK );
 			//       perform initialisations for all wet solution
@@ -5486,6 +5517,7 @@ Label10: ;
 
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
+		using General::RootSolverCallSiteIndex;
 		using General::RoundSigDigits;
 
 		// Return value
@@ -552,6 +552,44 @@ namespace WaterCoils {
 		{}
 
 	};
+
+	struct DetailedCoilAirSideData
+	{
+		// Air side results of the detailed flat fin model and the inlet state they are for
+		// Members
+		bool Valid; // True once results are kept
+		Real64 AirMassFlow; // Air mass flow rate [kg/s]
+		Real64 TempAirIn; // Inlet air temperature [C]
+		Real64 InletAirHumRat; // Inlet air humidity ratio [kg/kg]
+		Real64 InletAirEnthalpy; // Inlet air enthalpy [J/kg]
+		Real64 TempWaterIn; // Inlet water temperature [C]
+		Real64 BaroPress; // Outdoor barometric pressure [Pa]
+		Real64 MoistAirSpecificHeat; // Inlet air specific heat [kJ/kg-K]
+		Real64 EnterAirDewPoint; // Inlet air dew point [C]
+		Real64 CoilToAirThermResistWetSurf; // Air side thermal resistance, wet coil
+		Real64 CoilToAirThermResistDrySurf; // Air side thermal resistance, dry coil
+		Real64 WaterDensity; // Inlet water density [kg/m3]
+		Real64 WaterSpecHeat; // Inlet water specific heat [J/kg-K]
+
+		// Default Constructor
+		DetailedCoilAirSideData() :
+			Valid( false ),
+			AirMassFlow( 0.0 ),
+			TempAirIn( 0.0 ),
+			InletAirHumRat( 0.0 ),
+			InletAirEnthalpy( 0.0 ),
+			TempWaterIn( 0.0 ),
+			BaroPress( 0.0 ),
+			MoistAirSpecificHeat( 0.0 ),
+			EnterAirDewPoint( 0.0 ),
+			CoilToAirThermResistWetSurf( 0.0 ),
+			CoilToAirThermResistDrySurf( 0.0 ),
+			WaterDensity( 0.0 ),
+			WaterSpecHeat( 0.0 )
+		{}
+
+	};
+
 	struct WaterCoilNumericFieldData
 	{
 		// Members
@@ -572,6 +610,7 @@ namespace WaterCoils {
 	// Object Data
 	extern Array1D< WaterCoilEquipConditions > WaterCoil;
 	extern Array1D< WaterCoilNumericFieldData > WaterCoilNumericFields;
+	extern Array1D< DetailedCoilAirSideData > DetailedCoilAirSide; // Last air side results of the detailed flat fin model
 
 	// Functions
 
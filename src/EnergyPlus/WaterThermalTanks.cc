@@ -25,6 +25,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <DXCoils.hh>
 #include <Fans.hh>
@@ -5066,6 +5067,7 @@ namespace WaterThermalTanks {
 		Real64 PLF; // Part load factor, modifies thermal efficiency to get total energy efficiency
 		Real64 Tsum; // Integrated tank temp over the timestep, dividing by time gives the average (C s)
 		Real64 deltaTsum; // Change in integrated tank temperature, dividing by time gives the average (C s)
+		MixedTankAnalyticSolution Solution; // Tank temperature solution of the current substep
 		Real64 Eloss; // Energy change due to ambient losses over the timestep (J)
 		Real64 Elosszone; // Energy change to the zone due to ambient losses over the timestep (J)
 		Real64 Euse; // Energy change due to use side mass flow over the timestep (J)
@@ -5218,7 +5220,8 @@ namespace WaterThermalTanks {
 					Qheat = Qoncycheat + Qheater + Qheatpump;
 
 					// Calculate time needed to recover to the setpoint at maximum heater capacity
-					TimeNeeded = CalcTimeNeeded( TankTemp, SetPointTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+					Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+					TimeNeeded = Solution.timeNeeded( SetPointTemp );
 
 					if ( TimeNeeded > TimeRemaining ) {
 						// Heater is at maximum capacity and heats for all of the remaining time
@@ -5226,7 +5229,8 @@ namespace WaterThermalTanks {
 
 						TimeNeeded = TimeRemaining;
 
-						NewTankTemp = CalcTankTemp( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat, TimeNeeded );
+						Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+						NewTankTemp = Solution.tankTemp( TimeNeeded );
 
 					} else { // TimeNeeded <= TimeRemaining
 						// Heater is at maximum capacity but will not heat for all of the remaining time (at maximum anyway)
@@ -5301,7 +5305,8 @@ namespace WaterThermalTanks {
 						Qunmet = Qneeded - Qheater;
 						Qheat = Qoncycheat + Qheater + Qheatpump;
 
-						NewTankTemp = CalcTankTemp( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat, TimeNeeded );
+						Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+						NewTankTemp = Solution.tankTemp( TimeNeeded );
 
 					} // Qneeded > Qmaxcap
 
@@ -5348,7 +5353,8 @@ namespace WaterThermalTanks {
 					Qheat = Qoffcycheat + Qheatpump;
 
 					// Calculate time needed for tank temperature to fall to minimum (setpoint - deadband)
-					TimeNeeded = CalcTimeNeeded( TankTemp, DeadBandTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+					Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+					TimeNeeded = Solution.timeNeeded( DeadBandTemp );
 
 					if ( TimeNeeded <= TimeRemaining ) {
 						// Heating will be needed in this timestep
@@ -5360,7 +5366,8 @@ namespace WaterThermalTanks {
 					} else { // TimeNeeded > TimeRemaining
 						// Heating will not be needed for all of the remaining time
 
-						NewTankTemp = CalcTankTemp( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat, TimeRemaining );
+						Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+						NewTankTemp = Solution.tankTemp( TimeRemaining );
 
 						if ( ( NewTankTemp < MaxTemp ) || ( Tank.IsChilledWaterTank ) ) {
 							// Neither heating nor venting is needed for all of the remaining time
@@ -5371,7 +5378,8 @@ namespace WaterThermalTanks {
 							// Venting will be needed in this timestep
 
 							// Calculate time needed for tank temperature to rise to the maximum
-							TimeNeeded = CalcTimeNeeded( TankTemp, MaxTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+							Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+							TimeNeeded = Solution.timeNeeded( MaxTemp );
 
 							NewTankTemp = MaxTemp;
 							Mode = VentMode;
@@ -5384,7 +5392,8 @@ namespace WaterThermalTanks {
 					Mode = CoolMode;
 					Qheat = Qheatpump;
 
-					NewTankTemp = CalcTankTemp( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat, TimeRemaining );
+					Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+					NewTankTemp = Solution.tankTemp( TimeRemaining );
 					TimeNeeded = TimeRemaining;
 				} else if ( ( TankTemp <= DeadBandTemp ) && ( Tank.IsChilledWaterTank ) ) {
 
@@ -5392,7 +5401,8 @@ namespace WaterThermalTanks {
 
 					Qheat = Qheatpump;
 
-					NewTankTemp = CalcTankTemp( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat, TimeRemaining );
+					Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+					NewTankTemp = Solution.tankTemp( TimeRemaining );
 					TimeNeeded = TimeRemaining;
 				} // TankTemp vs DeadBandTemp for heaters and chilled water tanks
 
@@ -5407,7 +5417,8 @@ namespace WaterThermalTanks {
 				LossFracToZone = Tank.OffCycLossFracToZone;
 				Qheat = Qoffcycheat + Qheatpump;
 
-				NewTankTemp = CalcTankTemp( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat, TimeRemaining );
+				Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+				NewTankTemp = Solution.tankTemp( TimeRemaining );
 
 				if ( NewTankTemp < MaxTemp ) {
 					// Venting is no longer needed because conditions have changed
@@ -5438,7 +5449,8 @@ namespace WaterThermalTanks {
 				assert( false );
 			}}
 
-			deltaTsum = CalcTempIntegral( TankTemp, NewTankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat, TimeNeeded );
+			Solution.setConditions( TankTemp, AmbientTemp, UseInletTemp, SourceInletTemp, TankMass, Cp, UseMassFlowRate, SourceMassFlowRate, LossCoeff, Qheat );
+			deltaTsum = Solution.tempIntegral( NewTankTemp, TimeNeeded );
 
 			// Update summed values
 			Tsum += deltaTsum;
@@ -5596,46 +5608,167 @@ namespace WaterThermalTanks {
 		// Special cases which cause the natural logarithm to blow up are trapped and interpreted as
 		// requiring an infinite amount of time because Tf can never be reached under the given conditions.
 
-		// Return value
-		Real64 CalcTimeNeeded;
+		MixedTankAnalyticSolution Solution;
+		Solution.setConditions( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, Q );
+		return Solution.timeNeeded( Tf );
 
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+	}
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
+	Real64
+	CalcTankTemp(
+		Real64 const Ti, // Initial tank temperature (C)
+		Real64 const Ta, // Ambient environment temperature (C)
+		Real64 const T1, // Temperature of flow 1 (C)
+		Real64 const T2, // Temperature of flow 2 (C)
+		Real64 const m, // Mass of tank fluid (kg)
+		Real64 const Cp, // Specific heat of fluid (J/kg deltaC)
+		Real64 const m1, // Mass flow rate 1 (kg/s)
+		Real64 const m2, // Mass flow rate 2 (kg/s)
+		Real64 const UA, // Heat loss coefficient to ambient environment (W/deltaC)
+		Real64 const Q, // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
+		Real64 const t // Time elapsed from Ti to Tf (s)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Peter Graham Ellis
+		//       DATE WRITTEN   February 2005
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the final tank temperature Tf after time t has elapsed given heat loss,
+		// mass flow rates and temperatures, and net heat transfer due to heater and parasitics.
+
+		// METHODOLOGY EMPLOYED:
+		// Equations are derived by solving the differential equation governing the tank energy balance.
+
+		MixedTankAnalyticSolution Solution;
+		Solution.setConditions( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, Q );
+		return Solution.tankTemp( t );
+
+	}
+
+	Real64
+	CalcTempIntegral(
+		Real64 const Ti, // Initial tank temperature (C)
+		Real64 const Tf, // Final tank temperature (C)
+		Real64 const Ta, // Ambient environment temperature (C)
+		Real64 const T1, // Temperature of flow 1 (C)
+		Real64 const T2, // Temperature of flow 2 (C)
+		Real64 const m, // Mass of tank fluid (kg)
+		Real64 const Cp, // Specific heat of fluid (J/kg deltaC)
+		Real64 const m1, // Mass flow rate 1 (kg/s)
+		Real64 const m2, // Mass flow rate 2 (kg/s)
+		Real64 const UA, // Heat loss coefficient to ambient environment (W/deltaC)
+		Real64 const Q, // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
+		Real64 const t // Time elapsed from Ti to Tf (s)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Peter Graham Ellis
+		//       DATE WRITTEN   February 2005
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the integral of the tank temperature from Ti to Tf.  The integral is added to a sum which is
+		// later divided by the elapsed time to yield the average tank temperature over the timestep.
+
+		// METHODOLOGY EMPLOYED:
+		// Equations are the mathematical integrals of the governing differential equations.
+
+		MixedTankAnalyticSolution Solution;
+		Solution.setConditions( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, Q );
+		return Solution.tempIntegral( Tf, t );
+
+	}
+
+	void
+	MixedTankAnalyticSolution::setConditions(
+		Real64 const Ti, // Initial tank temperature (C)
+		Real64 const Ta, // Ambient environment temperature (C)
+		Real64 const T1, // Temperature of flow 1 (C)
+		Real64 const T2, // Temperature of flow 2 (C)
+		Real64 const m, // Mass of tank fluid (kg)
+		Real64 const Cp, // Specific heat of fluid (J/kg deltaC)
+		Real64 const m1, // Mass flow rate 1 (kg/s)
+		Real64 const m2, // Mass flow rate 2 (kg/s)
+		Real64 const UA, // Heat loss coefficient to ambient environment (W/deltaC)
+		Real64 const Q // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the conditions of the solution and finds its coefficients.
+
+		// METHODOLOGY EMPLOYED:
+		// Nothing is found again when the conditions are those of the last call, which keeps the last exponential.
+
+		if ( Ti == this->Ti && Ta == this->Ta && T1 == this->T1 && T2 == this->T2 && m == this->m && Cp == this->Cp && m1 == this->m1 && m2 == this->m2 && UA == this->UA && Q == this->Q && Cp != 0.0 ) return;
+
+		this->Ti = Ti;
+		this->Ta = Ta;
+		this->T1 = T1;
+		this->T2 = T2;
+		this->m = m;
+		this->Cp = Cp;
+		this->m1 = m1;
+		this->m2 = m2;
+		this->UA = UA;
+		this->Q = Q;
+
+		NoExchange = ( UA / Cp + m1 + m2 == 0.0 );
+		if ( NoExchange ) {
+			a = Q / ( m * Cp );
+			b = 0.0;
+		} else {
+			a = ( Q / Cp + UA * Ta / Cp + m1 * T1 + m2 * T2 ) / m;
+			b = -( UA / Cp + m1 + m2 ) / m;
+		}
+		ExpTime = 0.0;
+		ExpValue = 1.0;
+
+	}
+
+	Real64
+	MixedTankAnalyticSolution::timeNeeded( Real64 const Tf ) const // Final tank temperature (C)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Calculates the time needed for the tank temperature to change from Ti to Tf (see CalcTimeNeeded).
+
+		// METHODOLOGY EMPLOYED:
+		// Special cases which cause the natural logarithm to blow up are trapped and interpreted as
+		// requiring an infinite amount of time because Tf can never be reached under the given conditions.
+
+		// FUNCTION PARAMETER DEFINITIONS:
 		Real64 const Infinity( 99999999.9 ); // A time interval much larger than any single timestep (s)
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 a; // Intermediate variable
-		Real64 b; // Intermediate variable
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 Tm; // Mixed temperature after an infinite amount of time has passed (C)
 		Real64 quotient; // Intermediate variable
 		Real64 t; // Time elapsed from Ti to Tf (s)
 
-		// FLOW:
 		if ( Tf == Ti ) {
 			// Already at Tf; no time is needed
 			t = 0.0;
 
 		} else {
 
-			if ( UA / Cp + m1 + m2 == 0.0 ) {
+			if ( NoExchange ) {
 
 				if ( Q == 0.0 ) {
 					// With no mass flow and no heat flow and Tf<>Ti, then Tf can never be reached
 					t = Infinity;
 
 				} else {
-					a = Q / ( m * Cp );
-
 					t = ( Tf - Ti ) / a;
 
 				}
 
 			} else {
-				a = ( Q / Cp + UA * Ta / Cp + m1 * T1 + m2 * T2 ) / m;
-				b = -( UA / Cp + m1 + m2 ) / m;
-
 				// Calculate the mixed temperature Tm of the tank after an infinite amount of time has passed
 				Tm = -a / b;
 
@@ -5665,137 +5798,64 @@ namespace WaterThermalTanks {
 
 		}
 
-		CalcTimeNeeded = t;
-
-		return CalcTimeNeeded;
+		return t;
 
 	}
 
 	Real64
-	CalcTankTemp(
-		Real64 const Ti, // Initial tank temperature (C)
-		Real64 const Ta, // Ambient environment temperature (C)
-		Real64 const T1, // Temperature of flow 1 (C)
-		Real64 const T2, // Temperature of flow 2 (C)
-		Real64 const m, // Mass of tank fluid (kg)
-		Real64 const Cp, // Specific heat of fluid (J/kg deltaC)
-		Real64 const m1, // Mass flow rate 1 (kg/s)
-		Real64 const m2, // Mass flow rate 2 (kg/s)
-		Real64 const UA, // Heat loss coefficient to ambient environment (W/deltaC)
-		Real64 const Q, // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
-		Real64 const t // Time elapsed from Ti to Tf (s)
-	)
+	MixedTankAnalyticSolution::tankTemp( Real64 const t ) // Time elapsed from Ti (s)
 	{
 
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Peter Graham Ellis
-		//       DATE WRITTEN   February 2005
-		//       MODIFIED       na
-		//       RE-ENGINEERED  na
-
-		// PURPOSE OF THIS SUBROUTINE:
-		// Calculates the final tank temperature Tf after time t has elapsed given heat loss,
-		// mass flow rates and temperatures, and net heat transfer due to heater and parasitics.
-
-		// METHODOLOGY EMPLOYED:
-		// Equations are derived by solving the differential equation governing the tank energy balance.
-
-		// Return value
-		Real64 CalcTankTemp;
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 a; // Intermediate variable
-		Real64 b; // Intermediate variable
-		Real64 Tf; // Final tank temperature (C)
-
-		// FLOW:
-		if ( UA / Cp + m1 + m2 == 0.0 ) {
-			a = Q / ( m * Cp );
-
-			Tf = a * t + Ti;
+		// PURPOSE OF THIS FUNCTION:
+		// Calculates the tank temperature after time t has elapsed (see CalcTankTemp).
 
+		if ( NoExchange ) {
+			return a * t + Ti;
 		} else {
-			a = ( Q / Cp + UA * Ta / Cp + m1 * T1 + m2 * T2 ) / m;
-			b = -( UA / Cp + m1 + m2 ) / m;
-
-			Tf = ( a / b + Ti ) * std::exp( b * t ) - a / b;
-
+			return ( a / b + Ti ) * expBT( t ) - a / b;
 		}
 
-		CalcTankTemp = Tf;
-
-		return CalcTankTemp;
-
 	}
 
 	Real64
-	CalcTempIntegral(
-		Real64 const Ti, // Initial tank temperature (C)
+	MixedTankAnalyticSolution::tempIntegral(
 		Real64 const Tf, // Final tank temperature (C)
-		Real64 const Ta, // Ambient environment temperature (C)
-		Real64 const T1, // Temperature of flow 1 (C)
-		Real64 const T2, // Temperature of flow 2 (C)
-		Real64 const m, // Mass of tank fluid (kg)
-		Real64 const Cp, // Specific heat of fluid (J/kg deltaC)
-		Real64 const m1, // Mass flow rate 1 (kg/s)
-		Real64 const m2, // Mass flow rate 2 (kg/s)
-		Real64 const UA, // Heat loss coefficient to ambient environment (W/deltaC)
-		Real64 const Q, // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
 		Real64 const t // Time elapsed from Ti to Tf (s)
 	)
 	{
 
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Peter Graham Ellis
-		//       DATE WRITTEN   February 2005
-		//       MODIFIED       na
-		//       RE-ENGINEERED  na
-
-		// PURPOSE OF THIS SUBROUTINE:
-		// Calculates the integral of the tank temperature from Ti to Tf.  The integral is added to a sum which is
-		// later divided by the elapsed time to yield the average tank temperature over the timestep.
-
-		// METHODOLOGY EMPLOYED:
-		// Equations are the mathematical integrals of the governing differential equations.
-
-		// Return value
-		Real64 CalcTempIntegral;
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 a; // Intermediate variable
-		Real64 b; // Intermediate variable
-		Real64 dTsum; // Integral of tank temperature (C s)
+		// PURPOSE OF THIS FUNCTION:
+		// Calculates the integral of the tank temperature from Ti to Tf (see CalcTempIntegral).
 
-		// FLOW:
 		if ( t == 0.0 ) {
-			dTsum = 0.0;
+			return 0.0;
 
 		} else if ( Tf == Ti ) { // Steady-state conditions
-			dTsum = Tf * t;
-
-		} else if ( UA / Cp + m1 + m2 == 0.0 ) {
-			a = Q / ( m * Cp );
+			return Tf * t;
 
+		} else if ( NoExchange ) {
 			// Integral of T(t) = a * t + Ti, evaluated from 0 to t
-			dTsum = 0.5 * a * t * t + Ti * t;
+			return 0.5 * a * t * t + Ti * t;
 
 		} else {
-			a = ( Q / Cp + UA * Ta / Cp + m1 * T1 + m2 * T2 ) / m;
-			b = -( UA / Cp + m1 + m2 ) / m;
-
 			// Integral of T(t) = (a / b + Ti) * EXP(b * t) - a / b, evaluated from 0 to t
-			dTsum = ( a / b + Ti ) * ( std::exp( b * t ) - 1.0 ) / b - a * t / b;
+			return ( a / b + Ti ) * ( expBT( t ) - 1.0 ) / b - a * t / b;
 		}
 
-		CalcTempIntegral = dTsum;
+	}
 
-		return CalcTempIntegral;
+	Real64
+	MixedTankAnalyticSolution::expBT( Real64 const t ) // Time elapsed from Ti (s)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives EXP(b * t), found again only for a new time.
+
+		if ( t != ExpTime ) {
+			ExpTime = t;
+			ExpValue = std::exp( b * t );
+		}
+		return ExpValue;
 
 	}
 
@@ -5861,8 +5921,11 @@ namespace WaterThermalTanks {
 		// node at a sub time step interval of one second.  Temperatures and energies change dynamically over the system
 		// time step.  Final node temperatures are reported as final instantaneous values as well as averages over the
 		// time step.  Heat transfer rates are averages over the time step.
+		// With the implicit solver, the heat balances are solved by the backward Euler method over the rest of the
+		// system time step, shortened to the time a heater reaches its set point or cut-in temperature.
 
 		// Using/Aliasing
+		using DataSystemVariables::StratifiedTankImplicitSolver;
 		using DataGlobals::TimeStep;
 		using DataGlobals::TimeStepZone;
 		using DataGlobals::HourOfDay;
@@ -6022,58 +6085,126 @@ namespace WaterThermalTanks {
 		if ( Tank.InletMode == InletModeFixed ) CalcNodeMassFlows( WaterThermalTankNum, InletModeFixed );
 
 		TimeRemaining = SecInTimeStep;
-		while ( TimeRemaining > 0.0 ) {
+		while ( StratifiedTankImplicitSolver && TimeRemaining > 0.0 ) {
 
 			if ( Tank.InletMode == InletModeSeeking ) CalcNodeMassFlows( WaterThermalTankNum, InletModeSeeking );
 
 			if ( ! Tank.IsChilledWaterTank ) {
+				ControlStratifiedTankHeaters( Tank, CycleOnCount1, CycleOnCount2, SetPointRecovered );
+				Qheater1 = Tank.HeaterOn1 ? Tank.MaxCapacity : 0.0;
+				Qheater2 = Tank.HeaterOn2 ? Tank.MaxCapacity2 : 0.0;
+			} else { // chilled water thank, no heating
+				Qheater1 = 0.0;
+				Qheater2 = 0.0;
+			}
 
-				// Control the first heater element (master)
-				if ( Tank.MaxCapacity > 0.0 ) {
-					NodeNum = Tank.HeaterNode1;
-					NodeTemp = Tank.Node( NodeNum ).Temp;
+			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+				Qfuel = ( Qheater1 + Qheater2 ) / Tank.Efficiency;
+				Qoncycfuel = Tank.OnCycParaLoad;
+				Qoffcycfuel = 0.0;
+			} else {
+				Qfuel = 0.0;
+				Qoncycfuel = 0.0;
+				Qoffcycfuel = Tank.OffCycParaLoad;
+			}
 
-					if ( Tank.HeaterOn1 ) {
-						if ( NodeTemp >= SetPointTemp1 ) {
-							Tank.HeaterOn1 = false;
-							SetPointRecovered = true;
+			// Solve over the rest of the time step; if a heater would switch, solve again up to the time its node
+			// reaches the switching temperature, interpolated between the start and the end of the first solve
+			Real64 Interval( TimeRemaining ); // Interval of constant heater operation (s)
+			CalcStratifiedTankNodeTempsImplicit( Tank, Interval, Cp, HPWHCondenserDeltaT, Qheater1, Qheater2 );
+			if ( ! Tank.IsChilledWaterTank && Interval > dt ) {
+				Real64 SwitchFraction( 1.0 ); // Fraction of the interval before the first heater switches
+				for ( int Heater = 1; Heater <= 2; ++Heater ) {
+					if ( ( Heater == 1 ? Tank.MaxCapacity : Tank.MaxCapacity2 ) <= 0.0 ) continue;
+					if ( Heater == 2 && Tank.ControlType == PriorityMasterSlave && Tank.HeaterOn1 ) continue;
+					auto const & HeaterNode( Tank.Node( Heater == 1 ? Tank.HeaterNode1 : Tank.HeaterNode2 ) );
+					if ( Heater == 1 ? Tank.HeaterOn1 : Tank.HeaterOn2 ) {
+						Real64 const SetPointTemp( Heater == 1 ? SetPointTemp1 : SetPointTemp2 );
+						if ( HeaterNode.NewTemp >= SetPointTemp ) {
+							SwitchFraction = min( SwitchFraction, ( SetPointTemp - HeaterNode.Temp ) / ( HeaterNode.NewTemp - HeaterNode.Temp ) );
 						}
-					} else { // Heater is off
-						if ( NodeTemp < MinTemp1 ) {
-							Tank.HeaterOn1 = true;
-							++CycleOnCount1;
+					} else {
+						Real64 const MinTemp( Heater == 1 ? MinTemp1 : MinTemp2 );
+						if ( HeaterNode.NewTemp < MinTemp ) {
+							SwitchFraction = min( SwitchFraction, ( HeaterNode.Temp - MinTemp ) / ( HeaterNode.Temp - HeaterNode.NewTemp ) );
 						}
 					}
 				}
+				if ( SwitchFraction < 1.0 ) {
+					Interval = max( dt, SwitchFraction * Interval );
+					CalcStratifiedTankNodeTempsImplicit( Tank, Interval, Cp, HPWHCondenserDeltaT, Qheater1, Qheater2 );
+				}
+			}
 
-				if ( Tank.HeaterOn1 ) {
-					Qheater1 = Tank.MaxCapacity;
-					Runtime1 += dt;
+			if ( Tank.HeaterOn1 ) Runtime1 += Interval;
+			if ( Tank.HeaterOn2 ) Runtime2 += Interval;
+			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) Runtime += Interval;
+
+			// Heat transfer rates at the end of the interval, as in the node heat balances
+			for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+				NodeTemp = Tank.Node( NodeNum ).NewTemp;
+
+				UseMassFlowRate = Tank.Node( NodeNum ).UseMassFlowRate * Tank.UseEffectiveness;
+				SourceMassFlowRate = Tank.Node( NodeNum ).SourceMassFlowRate * Tank.SourceEffectiveness;
+
+				Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+				Qsource = CalcStratifiedTankSourceSideHeatTransferRate( HPWHCondenserDeltaT, SourceInletTemp, Cp, SourceMassFlowRate, NodeTemp );
+
+				if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+					Qloss = Tank.Node( NodeNum ).OnCycLossCoeff * ( AmbientTemp - NodeTemp );
+					Qoncycheat = Tank.Node( NodeNum ).OnCycParaLoad * Tank.OnCycParaFracToTank;
+					Qneeded = max( -Quse - Qsource - Qloss - Qoncycheat, 0.0 );
 				} else {
-					Qheater1 = 0.0;
+					Qloss = Tank.Node( NodeNum ).OffCycLossCoeff * ( AmbientTemp - NodeTemp );
+					Qoffcycheat = Tank.Node( NodeNum ).OffCycParaLoad * Tank.OffCycParaFracToTank;
+					Qneeded = max( -Quse - Qsource - Qloss - Qoffcycheat, 0.0 );
 				}
+				Qlosszone = Qloss * Tank.SkinLossFracToZone;
+				Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
 
-				// Control the second heater element (slave)
-				if ( Tank.MaxCapacity2 > 0.0 ) {
-					if ( ( Tank.ControlType == PriorityMasterSlave ) && Tank.HeaterOn1 ) {
-						Tank.HeaterOn2 = false;
+				Esource += Qsource * Interval;
+				Eloss += Qloss * Interval;
+				Elosszone += Qlosszone * Interval;
+				Eneeded += Qneeded * Interval;
+				Eunmet += Qunmet * Interval;
+			}
 
-					} else {
-						NodeNum = Tank.HeaterNode2;
-						NodeTemp = Tank.Node( NodeNum ).Temp;
+			Euse += UseMassFlowRate * Cp * ( UseInletTemp - Tank.Node( Tank.UseOutletStratNode ).NewTemp ) * Interval;
 
-						if ( Tank.HeaterOn2 ) {
-							if ( NodeTemp >= SetPointTemp2 ) {
-								Tank.HeaterOn2 = false;
-								SetPointRecovered = true;
-							}
-						} else { // Heater is off
-							if ( NodeTemp < MinTemp2 ) {
-								Tank.HeaterOn2 = true;
-								++CycleOnCount2;
-							}
-						}
-					}
+			if ( ! Tank.IsChilledWaterTank ) {
+				if ( Tank.Node( 1 ).NewTemp > MaxTemp ) {
+					Event += Tank.Node( 1 ).Mass * Cp * ( MaxTemp - Tank.Node( 1 ).NewTemp );
+					Tank.Node( 1 ).NewTemp = MaxTemp;
+				}
+			}
+
+			// Calculation for standard ratings
+			if ( ! Tank.FirstRecoveryDone ) {
+				Tank.FirstRecoveryFuel += ( Qfuel + Qoffcycfuel + Qoncycfuel ) * Interval;
+				if ( SetPointRecovered ) Tank.FirstRecoveryDone = true;
+			}
+
+			// Update node temperatures
+			Tank.Node.Temp() = Tank.Node.NewTemp();
+			Tank.Node.TempSum() += Tank.Node.Temp() * Interval;
+
+			TimeRemaining -= Interval;
+
+		} // StratifiedTankImplicitSolver
+
+		while ( TimeRemaining > 0.0 ) {
+
+			if ( Tank.InletMode == InletModeSeeking ) CalcNodeMassFlows( WaterThermalTankNum, InletModeSeeking );
+
+			if ( ! Tank.IsChilledWaterTank ) {
+
+				ControlStratifiedTankHeaters( Tank, CycleOnCount1, CycleOnCount2, SetPointRecovered );
+
+				if ( Tank.HeaterOn1 ) {
+					Qheater1 = Tank.MaxCapacity;
+					Runtime1 += dt;
+				} else {
+					Qheater1 = 0.0;
 				}
 
 				if ( Tank.HeaterOn2 ) {
@@ -6301,6 +6432,168 @@ namespace WaterThermalTanks {
 		return Qsource;
 	}
 
+	void
+	ControlStratifiedTankHeaters(
+		WaterThermalTankData & Tank, // Water heater being simulated
+		int & CycleOnCount1, // Number of times heater 1 cycles on in the current time step
+		int & CycleOnCount2, // Number of times heater 2 cycles on in the current time step
+		bool & SetPointRecovered // Set when a heater reaches its set point
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Switches the heating elements of a stratified tank on and off by the temperatures of their nodes.
+
+		// METHODOLOGY EMPLOYED:
+		// A heater turns off when its node reaches the set point and on when its node falls below the set point less
+		// the dead band.  With master-slave priority the second heater is off while the first one is on.
+
+		// Control the first heater element (master)
+		if ( Tank.MaxCapacity > 0.0 ) {
+			Real64 const NodeTemp( Tank.Node( Tank.HeaterNode1 ).Temp );
+
+			if ( Tank.HeaterOn1 ) {
+				if ( NodeTemp >= Tank.SetPointTemp ) {
+					Tank.HeaterOn1 = false;
+					SetPointRecovered = true;
+				}
+			} else { // Heater is off
+				if ( NodeTemp < Tank.SetPointTemp - Tank.DeadBandDeltaTemp ) {
+					Tank.HeaterOn1 = true;
+					++CycleOnCount1;
+				}
+			}
+		}
+
+		// Control the second heater element (slave)
+		if ( Tank.MaxCapacity2 > 0.0 ) {
+			if ( ( Tank.ControlType == PriorityMasterSlave ) && Tank.HeaterOn1 ) {
+				Tank.HeaterOn2 = false;
+
+			} else {
+				Real64 const NodeTemp( Tank.Node( Tank.HeaterNode2 ).Temp );
+
+				if ( Tank.HeaterOn2 ) {
+					if ( NodeTemp >= Tank.SetPointTemp2 ) {
+						Tank.HeaterOn2 = false;
+						SetPointRecovered = true;
+					}
+				} else { // Heater is off
+					if ( NodeTemp < Tank.SetPointTemp2 - Tank.DeadBandDeltaTemp2 ) {
+						Tank.HeaterOn2 = true;
+						++CycleOnCount2;
+					}
+				}
+			}
+		}
+
+	}
+
+	void
+	CalcStratifiedTankNodeTempsImplicit(
+		WaterThermalTankData & Tank, // Water heater being simulated
+		Real64 const TimeInterval, // Interval over which the node temperatures change (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const HPWHCondenserDeltaT, // Temperature difference across the heat pump condenser (C)
+		Real64 const Qheater1, // Heating rate of heater 1 (W)
+		Real64 const Qheater2 // Heating rate of heater 2 (W)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the stratified tank node temperatures at the end of an interval of constant heater operation.
+
+		// METHODOLOGY EMPLOYED:
+		// Backward Euler: the node heat balances of CalcWaterThermalTankStratified are taken at the end of the
+		// interval, which gives a tridiagonal system, solved by the Thomas algorithm and stable for any interval.
+		// Inversion mixing is applied between the nodes inverted at the start or at the end of the interval, solving
+		// again while it is found between more nodes.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumNodes( Tank.Nodes );
+		bool const HeaterOn( Tank.HeaterOn1 || Tank.HeaterOn2 );
+		static Array1D< Real64 > Lower; // Coefficients of the upper node temperatures (W/K)
+		static Array1D< Real64 > Diag; // Coefficients of the node temperatures (W/K)
+		static Array1D< Real64 > Upper; // Coefficients of the lower node temperatures (W/K)
+		static Array1D< Real64 > Rhs; // Constant terms of the heat balances (W)
+		static Array1D_bool MixUp; // True if a node mixes with the node above it
+
+		if ( Diag.isize() < NumNodes ) {
+			Lower.allocate( NumNodes );
+			Diag.allocate( NumNodes );
+			Upper.allocate( NumNodes );
+			Rhs.allocate( NumNodes );
+			MixUp.allocate( NumNodes );
+		}
+
+		for ( int NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+			MixUp( NodeNum ) = ( NodeNum > 1 && Tank.Node( NodeNum - 1 ).Temp < Tank.Node( NodeNum ).Temp );
+		}
+
+		bool NewMixing( true );
+		while ( NewMixing ) {
+			for ( int NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+				auto const & node( Tank.Node( NodeNum ) );
+				Real64 const StorageCoeff( node.Mass * Cp / TimeInterval );
+				Real64 const UseCoeff( node.UseMassFlowRate * Tank.UseEffectiveness * Cp );
+				Real64 const SourceCoeff( node.SourceMassFlowRate * Tank.SourceEffectiveness * Cp );
+				Real64 LossCoeff;
+				Real64 Qheat;
+				if ( HeaterOn ) {
+					LossCoeff = node.OnCycLossCoeff;
+					Qheat = node.OnCycParaLoad * Tank.OnCycParaFracToTank;
+					if ( NodeNum == Tank.HeaterNode1 ) Qheat += Qheater1;
+					if ( NodeNum == Tank.HeaterNode2 ) Qheat += Qheater2;
+				} else {
+					LossCoeff = node.OffCycLossCoeff;
+					Qheat = node.OffCycParaLoad * Tank.OffCycParaFracToTank;
+				}
+
+				// Conduction, flow and inversion mixing with the nodes above and below
+				Real64 UpCoeff( 0.0 );
+				if ( NodeNum > 1 ) {
+					UpCoeff = node.CondCoeffUp + node.MassFlowFromUpper * Cp;
+					if ( MixUp( NodeNum ) ) UpCoeff += Tank.InversionMixingRate * Cp;
+				}
+				Real64 DnCoeff( 0.0 );
+				if ( NodeNum < NumNodes ) {
+					DnCoeff = node.CondCoeffDn + node.MassFlowFromLower * Cp;
+					if ( MixUp( NodeNum + 1 ) ) DnCoeff += Tank.InversionMixingRate * Cp;
+				}
+
+				Lower( NodeNum ) = -UpCoeff;
+				Upper( NodeNum ) = -DnCoeff;
+				Diag( NodeNum ) = StorageCoeff + UseCoeff + LossCoeff + UpCoeff + DnCoeff;
+				Rhs( NodeNum ) = StorageCoeff * node.Temp + UseCoeff * Tank.UseInletTemp + LossCoeff * Tank.AmbientTemp + Qheat;
+				if ( HPWHCondenserDeltaT > 0.0 ) {
+					Rhs( NodeNum ) += SourceCoeff * HPWHCondenserDeltaT;
+				} else {
+					Diag( NodeNum ) += SourceCoeff;
+					Rhs( NodeNum ) += SourceCoeff * Tank.SourceInletTemp;
+				}
+			}
+
+			for ( int NodeNum = 2; NodeNum <= NumNodes; ++NodeNum ) {
+				Real64 const Factor( Lower( NodeNum ) / Diag( NodeNum - 1 ) );
+				Diag( NodeNum ) -= Factor * Upper( NodeNum - 1 );
+				Rhs( NodeNum ) -= Factor * Rhs( NodeNum - 1 );
+			}
+			Tank.Node( NumNodes ).NewTemp = Rhs( NumNodes ) / Diag( NumNodes );
+			for ( int NodeNum = NumNodes - 1; NodeNum >= 1; --NodeNum ) {
+				Tank.Node( NodeNum ).NewTemp = ( Rhs( NodeNum ) - Upper( NodeNum ) * Tank.Node( NodeNum + 1 ).NewTemp ) / Diag( NodeNum );
+			}
+
+			NewMixing = false;
+			for ( int NodeNum = 2; NodeNum <= NumNodes; ++NodeNum ) {
+				if ( ! MixUp( NodeNum ) && Tank.Node( NodeNum - 1 ).NewTemp < Tank.Node( NodeNum ).NewTemp ) {
+					MixUp( NodeNum ) = true;
+					NewMixing = true;
+				}
+			}
+		}
+
+	}
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
@@ -6919,7 +7212,9 @@ namespace WaterThermalTanks {
 		using Fans::SimulateFanComponents;
 		using ScheduleManager::GetCurrentScheduleValue;
 		using General::SolveRegulaFalsi;
+		using General::SolveRootWarmStart;
 		using General::RoundSigDigits;
+		using DataSystemVariables::WarmStartRootSolves;
 		using Psychrometrics::CPHW; // , PsyWFnTdbTwbPb
 		using Psychrometrics::PsyRhoAirFnPbTdbW;
 		using Psychrometrics::PsyCpAirFnWTdb;
@@ -7253,7 +7548,14 @@ namespace WaterThermalTanks {
 				if (zeroResidual > 0.0) { // then iteration
 					{ auto const SELECT_CASE_var1(HeatPump.TankTypeNum);
 					if (SELECT_CASE_var1 == MixedWaterHeater) {
-						SolveRegulaFalsi(Acc, MaxIte, SolFla, HPPartLoadRatio, PLRResidualMixedTank, 0.0, 1.0, Par);
+						if (WarmStartRootSolves && MaxSpeedNum > 0) {
+							// start from the last ratio of this heat pump, the residual at zero is known
+							SolveRootWarmStart(Acc, MaxIte, SolFla, HPPartLoadRatio, PLRResidualMixedTank, 0.0, 1.0, Par, HeatPump.HeatingPLR, zeroResidual, _, HeatPump.FloatPLRSolveStats);
+						} else if (WarmStartRootSolves) {
+							SolveRootWarmStart(Acc, MaxIte, SolFla, HPPartLoadRatio, PLRResidualMixedTank, 0.0, 1.0, Par, HeatPump.HeatingPLR, _, _, HeatPump.FloatPLRSolveStats);
+						} else {
+							SolveRegulaFalsi(Acc, MaxIte, SolFla, HPPartLoadRatio, PLRResidualMixedTank, 0.0, 1.0, Par);
+						}
 					} else if (SELECT_CASE_var1 == StratifiedWaterHeater) {
 						SolveRegulaFalsi(Acc, MaxIte, SolFla, HPPartLoadRatio, PLRResidualStratifiedTank, 0.0, 1.0, Par);
 					}}
@@ -7,6 +7,7 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
+#include <General.hh>
 #include <VariableSpeedCoils.hh>
 
 namespace EnergyPlus {
@@ -118,6 +119,78 @@ namespace WaterThermalTanks {
 
 	// Types
 
+	struct MixedTankAnalyticSolution
+	{
+		// Analytic solution of the mixed tank energy balance for one set of conditions, factored so that the
+		// coefficients and the last exponential are found once for the several evaluations of a substep.
+
+		// Members
+		Real64 Ti; // Initial tank temperature (C)
+		Real64 Ta; // Ambient environment temperature (C)
+		Real64 T1; // Temperature of flow 1 (C)
+		Real64 T2; // Temperature of flow 2 (C)
+		Real64 m; // Mass of tank fluid (kg)
+		Real64 Cp; // Specific heat of fluid (J/kg deltaC)
+		Real64 m1; // Mass flow rate 1 (kg/s)
+		Real64 m2; // Mass flow rate 2 (kg/s)
+		Real64 UA; // Heat loss coefficient to ambient environment (W/deltaC)
+		Real64 Q; // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
+		bool NoExchange; // True if there is no loss or flow, so the temperature changes linearly
+		Real64 a; // Intermediate variable of the solution T(t) = (a / b + Ti) * EXP(b * t) - a / b
+		Real64 b; // Intermediate variable
+		Real64 ExpTime; // Time of the last exponential (s)
+		Real64 ExpValue; // EXP(b * ExpTime)
+
+		// Default Constructor
+		MixedTankAnalyticSolution() :
+			Ti( 0.0 ),
+			Ta( 0.0 ),
+			T1( 0.0 ),
+			T2( 0.0 ),
+			m( 0.0 ),
+			Cp( 0.0 ),
+			m1( 0.0 ),
+			m2( 0.0 ),
+			UA( 0.0 ),
+			Q( 0.0 ),
+			NoExchange( true ),
+			a( 0.0 ),
+			b( 0.0 ),
+			ExpTime( 0.0 ),
+			ExpValue( 1.0 )
+		{}
+
+		void
+		setConditions(
+			Real64 const Ti, // Initial tank temperature (C)
+			Real64 const Ta, // Ambient environment temperature (C)
+			Real64 const T1, // Temperature of flow 1 (C)
+			Real64 const T2, // Temperature of flow 2 (C)
+			Real64 const m, // Mass of tank fluid (kg)
+			Real64 const Cp, // Specific heat of fluid (J/kg deltaC)
+			Real64 const m1, // Mass flow rate 1 (kg/s)
+			Real64 const m2, // Mass flow rate 2 (kg/s)
+			Real64 const UA, // Heat loss coefficient to ambient environment (W/deltaC)
+			Real64 const Q // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
+		);
+
+		Real64
+		timeNeeded( Real64 const Tf ) const; // Final tank temperature (C)
+
+		Real64
+		tankTemp( Real64 const t ); // Time elapsed from Ti (s)
+
+		Real64
+		tempIntegral(
+			Real64 const Tf, // Final tank temperature (C)
+			Real64 const t // Time elapsed from Ti to Tf (s)
+		);
+
+		Real64
+		expBT( Real64 const t ); // Time elapsed from Ti (s)
+
+	};
+
 	struct StratifiedNodeData
 	{
 		// Members
@@ -776,6 +849,7 @@ namespace WaterThermalTanks {
 		int IterLimitExceededNum2; // Counter for recurring iteration limit warning messages
 		int RegulaFalsiFailedIndex2; // Index for recurring RegulaFalsi failed warning messages
 		int RegulaFalsiFailedNum2; // Counter for recurring RegulaFalsi failed warning messages
+		General::RootSolverStatistics FloatPLRSolveStats; // Counts of the float mode part load ratio solves started from the last ratio
 		bool FirstTimeThroughFlag; // Flag for saving water heater status
 		bool ShowSetPointWarning; // Warn when set point is greater than max tank temp limit
 		Real64 HPWaterHeaterSensibleCapacity; // sensible capacity delivered when HPWH is attached to a zone (W)
@@ -1456,6 +1530,24 @@ namespace WaterThermalTanks {
 		Real64 NodeTemp // temperature of the source inlet node (C)
 	);
 
+	void
+	ControlStratifiedTankHeaters(
+		WaterThermalTankData & Tank, // Water heater being simulated
+		int & CycleOnCount1, // Number of times heater 1 cycles on in the current time step
+		int & CycleOnCount2, // Number of times heater 2 cycles on in the current time step
+		bool & SetPointRecovered // Set when a heater reaches its set point
+	);
+
+	void
+	CalcStratifiedTankNodeTempsImplicit(
+		WaterThermalTankData & Tank, // Water heater being simulated
+		Real64 const TimeInterval, // Interval over which the node temperatures change (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const HPWHCondenserDeltaT, // Temperature difference across the heat pump condenser (C)
+		Real64 const Qheater1, // Heating rate of heater 1 (W)
+		Real64 const Qheater2 // Heating rate of heater 2 (W)
+	);
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
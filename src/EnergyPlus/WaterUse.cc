@@ -744,9 +744,7 @@ namespace WaterUse {
 
 		// Using/Aliasing
 		using ScheduleManager::GetCurrentScheduleValue;
-		using Psychrometrics::RhoH2O;
 		using DataEnvironment::WaterMainsTemp;
-		using DataHeatBalance::Zone;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -777,6 +775,29 @@ namespace WaterUse {
 			}
 		}
 
+		CalcEquipmentScheduledFlowRates( WaterEquipNum );
+
+		CalcEquipmentMixedFlowRates( WaterEquipNum );
+
+	}
+
+	void
+	CalcEquipmentScheduledFlowRates( int const WaterEquipNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculate the target temperature and the requested total flow rate of the equipment
+
+		// METHODOLOGY EMPLOYED:
+		// Only schedules, zone multipliers and the hot water temperature enter here, so for connected
+		// equipment this is called once per connection simulation rather than every heat recovery iteration.
+
+		// Using/Aliasing
+		using ScheduleManager::GetCurrentScheduleValue;
+		using Psychrometrics::RhoH2O;
+		using DataHeatBalance::Zone;
+
+		// FLOW:
 		if ( WaterEquipment( WaterEquipNum ).TargetTempSchedule > 0 ) {
 			WaterEquipment( WaterEquipNum ).TargetTemp = GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).TargetTempSchedule );
 		} else { // If no TargetTempSchedule, use all hot water
@@ -801,7 +822,19 @@ namespace WaterUse {
 
 		WaterEquipment( WaterEquipNum ).TotalMassFlowRate = WaterEquipment( WaterEquipNum ).TotalVolFlowRate * RhoH2O( InitConvTemp );
 
-		// Calculate hot and cold water mixing at the tap
+	}
+
+	void
+	CalcEquipmentMixedFlowRates( int const WaterEquipNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculate hot and cold water flow rates that meet the target temperature at the tap
+
+		// METHODOLOGY EMPLOYED:
+		// Splits the total flow rate from CalcEquipmentScheduledFlowRates between the current hot and cold water temperatures.
+
+		// FLOW:
 		if ( WaterEquipment( WaterEquipNum ).TotalMassFlowRate > 0.0 ) {
 			// Calculate the flow rates needed to meet the target temperature
 			if ( WaterEquipment( WaterEquipNum ).HotTemp == WaterEquipment( WaterEquipNum ).ColdTemp ) { // Avoid divide by zero
@@ -964,6 +997,8 @@ namespace WaterUse {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int InletNode;
 		int OutletNode;
+		int WaterEquipNum;
+		int Loop;
 		static bool MyOneTimeFlag( true ); // one time flag                    !DSU
 		static Array1D_bool SetLoopIndexFlag; // get loop number flag             !DSU
 		bool errFlag;
@@ -1036,6 +1071,13 @@ namespace WaterUse {
 			}
 		}
 
+		// The schedule driven demand of the equipment does not change during the heat recovery iteration
+		for ( Loop = 1; Loop <= WaterConnections( WaterConnNum ).NumWaterEquipment; ++Loop ) {
+			WaterEquipNum = WaterConnections( WaterConnNum ).WaterEquipment( Loop );
+			WaterEquipment( WaterEquipNum ).HotTemp = WaterConnections( WaterConnNum ).HotTemp;
+			CalcEquipmentScheduledFlowRates( WaterEquipNum );
+		} // Loop
+
 	}
 
 	void
@@ -1082,7 +1124,10 @@ namespace WaterUse {
 		for ( Loop = 1; Loop <= WaterConnections( WaterConnNum ).NumWaterEquipment; ++Loop ) {
 			WaterEquipNum = WaterConnections( WaterConnNum ).WaterEquipment( Loop );
 
-			CalcEquipmentFlowRates( WaterEquipNum );
+			// Only the mixing responds to the heat recovered cold water temperature
+			WaterEquipment( WaterEquipNum ).ColdTemp = WaterConnections( WaterConnNum ).ColdTemp;
+			WaterEquipment( WaterEquipNum ).HotTemp = WaterConnections( WaterConnNum ).HotTemp;
+			CalcEquipmentMixedFlowRates( WaterEquipNum );
 
 			WaterConnections( WaterConnNum ).ColdMassFlowRate += WaterEquipment( WaterEquipNum ).ColdMassFlowRate;
 			WaterConnections( WaterConnNum ).HotMassFlowRate += WaterEquipment( WaterEquipNum ).HotMassFlowRate;
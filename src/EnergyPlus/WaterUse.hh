@@ -480,6 +480,12 @@ namespace WaterUse {
 	void
 	CalcEquipmentFlowRates( int const WaterEquipNum );
 
+	void
+	CalcEquipmentScheduledFlowRates( int const WaterEquipNum );
+
+	void
+	CalcEquipmentMixedFlowRates( int const WaterEquipNum );
+
 	void
 	CalcEquipmentDrainTemp( int const WaterEquipNum );
 
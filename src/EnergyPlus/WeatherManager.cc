@@ -1,18 +1,25 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <fstream>
 #include <string>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
+#include <ObjexxFCL/environment.hh>
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
 #include <ObjexxFCL/Time_Date.hh>
 
+// Third-party Headers
+#include <zlib.h>
+
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <WeatherManager.hh>
+#include <CsvOutput.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
 #include <DataStringGlobals.hh>
@@ -65,6 +72,7 @@ namespace WeatherManager {
 	using namespace DataReportingFlags;
 	using DataSystemVariables::iASCII_CR;
 	using DataSystemVariables::iUnicode_end;
+	using DataSystemVariables::CacheWeatherFile;
 
 	using General::ProcessDateString; // , ValidateMonthDay
 	using General::RoundSigDigits;
@@ -144,6 +152,9 @@ namespace WeatherManager {
 	Real64 WeatherFileTimeZone( 0.0 );
 	Real64 WeatherFileElevation( 0.0 );
 	int WeatherFileUnitNumber; // File unit number for the weather file
+	bool WeatherFileInMemory( false ); // True when the weather file is read from WeatherFileLines rather than its unit
+	std::vector< std::string > WeatherFileLines; // Lines of the weather file, header included
+	int WeatherFileLineNum( 0 ); // Number of lines of WeatherFileLines already read
 	Array1D< Real64 > GroundTemps( 12, 18.0 ); // Bldg Surface
 	Array1D< Real64 > GroundTempsFC( 12, 0.0 ); // F or C factor method
 	Array1D< Real64 > SurfaceGroundTemps( 12, 13.0 ); // Surface
@@ -280,6 +291,7 @@ namespace WeatherManager {
 	Array1D< WeatherProperties > WPSkyTemperature;
 	Array1D< SpecialDayData > SpecialDays;
 	Array1D< DataPeriodData > DataPeriods;
+	Array1D< WeatherRecordData > WeatherRecords; // Interpreted data records, by line of WeatherFileLines
 
 	static gio::Fmt fmtA( "(A)" );
 	static gio::Fmt fmtAN( "(A,$)" );
@@ -1852,7 +1864,7 @@ namespace WeatherManager {
 		}
 
 		if (EndEnvrnFlag && (Environment(Envrn).KindOfEnvrn != ksDesignDay) && (Environment(Envrn).KindOfEnvrn != ksHVACSizeDesignDay)) {
-			gio::rewind( WeatherFileUnitNumber );
+			RewindWeatherFile();
 			SkipEPlusWFHeader();
 			ReportMissing_RangeData();
 		}
@@ -2455,7 +2467,7 @@ namespace WeatherManager {
 			WMinute = 0;
 			LastHourSet = false;
 			while ( ! Ready ) {
-				{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> WeatherDataLine; ReadStatus = flags.ios(); }
+				ReadStatus = ReadWeatherFileLine( WeatherDataLine );
 				if ( ReadStatus == 0 ) {
 					// Reduce ugly code
 					InterpretWeatherDataLine( WeatherDataLine, ErrorFound, WYear, WMonth, WDay, WHour, WMinute, DryBulb, DewPoint, RelHum, AtmPress, ETHoriz, ETDirect, IRHoriz, GLBHoriz, DirectRad, DiffuseRad, GLBHorizIllum, DirectNrmIllum, DiffuseHorizIllum, ZenLum, WindDir, WindSpeed, TotalSkyCover, OpaqueSkyCover, Visibility, CeilHeight, PresWeathObs, PresWeathConds, PrecipWater, AerosolOptDepth, SnowDepth, DaysSinceLastSnow, Albedo, LiquidPrecip );
@@ -2463,10 +2475,10 @@ namespace WeatherManager {
 					if ( NumRewinds > 0 ) {
 						ShowSevereError( "Multiple rewinds on EPW while searching for first day" );
 					} else {
-						gio::rewind( WeatherFileUnitNumber );
+						RewindWeatherFile();
 						++NumRewinds;
 						SkipEPlusWFHeader();
-						{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> WeatherDataLine; ReadStatus = flags.ios(); }
+						ReadStatus = ReadWeatherFileLine( WeatherDataLine );
 						InterpretWeatherDataLine( WeatherDataLine, ErrorFound, WYear, WMonth, WDay, WHour, WMinute, DryBulb, DewPoint, RelHum, AtmPress, ETHoriz, ETDirect, IRHoriz, GLBHoriz, DirectRad, DiffuseRad, GLBHorizIllum, DirectNrmIllum, DiffuseHorizIllum, ZenLum, WindDir, WindSpeed, TotalSkyCover, OpaqueSkyCover, Visibility, CeilHeight, PresWeathObs, PresWeathConds, PrecipWater, AerosolOptDepth, SnowDepth, DaysSinceLastSnow, Albedo, LiquidPrecip );
 
 					}
@@ -2488,7 +2500,7 @@ namespace WeatherManager {
 					RecordDateMatch = false;
 				}
 				if ( RecordDateMatch ) {
-					gio::backspace( WeatherFileUnitNumber );
+					BackspaceWeatherFile();
 					Ready = true;
 					if ( CurDayOfWeek <= 7 ) {
 						--CurDayOfWeek;
@@ -2509,7 +2521,7 @@ namespace WeatherManager {
 				} else {
 					//  Must skip this day
 					for ( Item = 2; Item <= NumIntervalsPerHour; ++Item ) {
-						{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> WeatherDataLine; ReadStatus = flags.ios(); }
+						ReadStatus = ReadWeatherFileLine( WeatherDataLine );
 						if ( ReadStatus != 0 ) {
 							gio::read( WeatherDataLine, fmtLD ) >> WYear >> WMonth >> WDay >> WHour >> WMinute;
 							BadRecord = RoundSigDigits( WYear ) + '/' + RoundSigDigits( WMonth ) + '/' + RoundSigDigits( WDay ) + BlankString + RoundSigDigits( WHour ) + ':' + RoundSigDigits( WMinute );
@@ -2517,7 +2529,7 @@ namespace WeatherManager {
 						}
 					}
 					for ( Item = 1; Item <= 23 * NumIntervalsPerHour; ++Item ) {
-						{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> WeatherDataLine; ReadStatus = flags.ios(); }
+						ReadStatus = ReadWeatherFileLine( WeatherDataLine );
 						if ( ReadStatus != 0 ) {
 							gio::read( WeatherDataLine, fmtLD ) >> WYear >> WMonth >> WDay >> WHour >> WMinute;
 							BadRecord = RoundSigDigits( WYear ) + '/' + RoundSigDigits( WMonth ) + '/' + RoundSigDigits( WDay ) + BlankString + RoundSigDigits( WHour ) + ':' + RoundSigDigits( WMinute );
@@ -2576,7 +2588,7 @@ namespace WeatherManager {
 			for ( Hour = 1; Hour <= 24; ++Hour ) {
 				for ( CurTimeStep = 1; CurTimeStep <= NumIntervalsPerHour; ++CurTimeStep ) {
 					HourRep = double( Hour - 1 ) + ( CurTime * double( CurTimeStep ) );
-					{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> WeatherDataLine; ReadStatus = flags.ios(); }
+					ReadStatus = ReadWeatherFileLine( WeatherDataLine );
 					if ( ReadStatus != 0 ) WeatherDataLine = BlankString;
 					if ( WeatherDataLine == BlankString ) {
 						if ( Hour == 1 ) {
@@ -2590,9 +2602,9 @@ namespace WeatherManager {
 					} else { // ReadStatus /=0
 						if ( ReadStatus < 0 && NumDataPeriods == 1 ) { // Standard End-of-file, rewind and position to first day...
 							if ( DataPeriods( 1 ).NumDays >= NumDaysInYear ) {
-								gio::rewind( WeatherFileUnitNumber );
+								RewindWeatherFile();
 								SkipEPlusWFHeader();
-								{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> WeatherDataLine; ReadStatus = flags.ios(); }
+								ReadStatus = ReadWeatherFileLine( WeatherDataLine );
 
 								InterpretWeatherDataLine( WeatherDataLine, ErrorFound, WYear, WMonth, WDay, WHour, WMinute, DryBulb, DewPoint, RelHum, AtmPress, ETHoriz, ETDirect, IRHoriz, GLBHoriz, DirectRad, DiffuseRad, GLBHorizIllum, DirectNrmIllum, DiffuseHorizIllum, ZenLum, WindDir, WindSpeed, TotalSkyCover, OpaqueSkyCover, Visibility, CeilHeight, PresWeathObs, PresWeathConds, PrecipWater, AerosolOptDepth, SnowDepth, DaysSinceLastSnow, Albedo, LiquidPrecip );
 							} else {
@@ -2874,7 +2886,7 @@ namespace WeatherManager {
 		} // Try Again While Loop
 
 		if ( BackSpaceAfterRead ) {
-			gio::backspace( WeatherFileUnitNumber );
+			BackspaceWeatherFile();
 		}
 
 		if ( NumIntervalsPerHour == 1 && NumOfTimeStepInHour > 1 ) {
@@ -3169,9 +3181,54 @@ namespace WeatherManager {
 		int Count;
 		static int LCount( 0 );
 		bool DateInError;
+		WeatherRecordData * Record( nullptr ); // Parsed values of this line of the weather file held in memory
+		int const MissedWeathCodes( Missed.WeathCodes );
 
 		++LCount;
 		ErrorFound = false;
+
+		// A line of the weather file held in memory is only parsed the first time it is read
+		if ( WeatherFileInMemory && WeatherFileLineNum > 0 && WeatherFileLineNum <= WeatherRecords.isize() ) {
+			if ( Line == WeatherFileLines[ WeatherFileLineNum - 1 ] ) Record = &WeatherRecords( WeatherFileLineNum );
+		}
+		if ( Record != nullptr && Record->Interpreted ) {
+			WYear = Record->WYear;
+			WMonth = Record->WMonth;
+			WDay = Record->WDay;
+			WHour = Record->WHour;
+			WMinute = Record->WMinute;
+			RField1 = Record->DryBulb;
+			RField2 = Record->DewPoint;
+			RField3 = Record->RelHum;
+			RField4 = Record->AtmPress;
+			RField5 = Record->ETHoriz;
+			RField6 = Record->ETDirect;
+			RField7 = Record->IRHoriz;
+			RField8 = Record->GLBHoriz;
+			RField9 = Record->DirectRad;
+			RField10 = Record->DiffuseRad;
+			RField11 = Record->GLBHorizIllum;
+			RField12 = Record->DirectNrmIllum;
+			RField13 = Record->DiffuseHorizIllum;
+			RField14 = Record->ZenLum;
+			RField15 = Record->WindDir;
+			RField16 = Record->WindSpeed;
+			RField17 = Record->TotalSkyCover;
+			RField18 = Record->OpaqueSkyCover;
+			RField19 = Record->Visibility;
+			RField20 = Record->CeilHeight;
+			WObs = Record->PresWeathObs;
+			WCodesArr = Record->PresWeathConds;
+			RField22 = Record->PrecipWater;
+			RField23 = Record->AerosolOptDepth;
+			RField24 = Record->SnowDepth;
+			RField25 = Record->DaysSinceLastSnow;
+			RField26 = Record->Albedo;
+			RField27 = Record->LiquidPrecip;
+			if ( Record->MissedWeathCodes ) ++Missed.WeathCodes;
+			return;
+		}
+
 		std::string const SaveLine = Line; // in case of errors
 
 		// Do the first five.  (To get to the DataSource field)
@@ -3341,6 +3398,44 @@ namespace WeatherManager {
 			WCodesArr = 9;
 		}
 
+		if ( Record != nullptr ) {
+			Record->Interpreted = true;
+			Record->MissedWeathCodes = ( Missed.WeathCodes != MissedWeathCodes );
+			Record->WYear = WYear;
+			Record->WMonth = WMonth;
+			Record->WDay = WDay;
+			Record->WHour = WHour;
+			Record->WMinute = WMinute;
+			Record->DryBulb = RField1;
+			Record->DewPoint = RField2;
+			Record->RelHum = RField3;
+			Record->AtmPress = RField4;
+			Record->ETHoriz = RField5;
+			Record->ETDirect = RField6;
+			Record->IRHoriz = RField7;
+			Record->GLBHoriz = RField8;
+			Record->DirectRad = RField9;
+			Record->DiffuseRad = RField10;
+			Record->GLBHorizIllum = RField11;
+			Record->DirectNrmIllum = RField12;
+			Record->DiffuseHorizIllum = RField13;
+			Record->ZenLum = RField14;
+			Record->WindDir = RField15;
+			Record->WindSpeed = RField16;
+			Record->TotalSkyCover = RField17;
+			Record->OpaqueSkyCover = RField18;
+			Record->Visibility = RField19;
+			Record->CeilHeight = RField20;
+			Record->PresWeathObs = WObs;
+			Record->PresWeathConds = WCodesArr;
+			Record->PrecipWater = RField22;
+			Record->AerosolOptDepth = RField23;
+			Record->SnowDepth = RField24;
+			Record->DaysSinceLastSnow = RField25;
+			Record->Albedo = RField26;
+			Record->LiquidPrecip = RField27;
+		}
+
 		return;
 
 Label900: ;
@@ -4490,8 +4585,17 @@ Label902: ;
 		{ IOFlags flags; gio::inquire( DataStringGlobals::inputWeatherFileName, flags ); unitnumber = flags.unit(); EPWOpen = flags.open(); }
 		if ( EPWOpen ) gio::close( unitnumber );
 
-		WeatherFileUnitNumber = GetNewUnitNumber();
-		{ IOFlags flags; flags.ACTION( "read" ); gio::open( WeatherFileUnitNumber, DataStringGlobals::inputWeatherFileName, flags ); if ( flags.err() ) goto Label9999; }
+		if ( CacheWeatherFile || WeatherFileIsCompressed( DataStringGlobals::inputWeatherFileName ) ) {
+			// Read the whole file once; reopening it starts again from the first line
+			if ( ! WeatherFileInMemory ) {
+				if ( ! LoadWeatherFileLines( DataStringGlobals::inputWeatherFileName ) ) goto Label9999;
+				WeatherFileInMemory = true;
+			}
+			WeatherFileLineNum = 0;
+		} else {
+			WeatherFileUnitNumber = GetNewUnitNumber();
+			{ IOFlags flags; flags.ACTION( "read" ); gio::open( WeatherFileUnitNumber, DataStringGlobals::inputWeatherFileName, flags ); if ( flags.err() ) goto Label9999; }
+		}
 
 		if ( ProcessHeader ) {
 			// Read in Header Information
@@ -4500,7 +4604,7 @@ Label902: ;
 			HdLine = 1; // Look for first Header
 			StillLooking = true;
 			while ( StillLooking ) {
-				{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> Line; if ( flags.end() ) goto Label9998; }
+				if ( ReadWeatherFileLine( Line ) < 0 ) goto Label9998;
 				endcol = len( Line );
 				if ( endcol > 0 ) {
 					if ( int( Line[ endcol - 1 ] ) == iUnicode_end ) {
@@ -4580,6 +4684,240 @@ Label9999: ;
 
 	}
 
+	bool
+	WeatherFileIsCompressed( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function reports back if the weather file is gzip compressed.
+
+		// METHODOLOGY EMPLOYED:
+		// Looks for the gzip magic number at the start of the file.
+
+		std::ifstream File( FileName, std::ios::in | std::ios::binary );
+		unsigned char Magic[ 2 ] = { 0, 0 };
+		File.read( reinterpret_cast< char * >( Magic ), 2 );
+		return ( File.gcount() == 2 && Magic[ 0 ] == 0x1f && Magic[ 1 ] == 0x8b );
+
+	}
+
+	bool
+	LoadWeatherFileLines( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function reads all lines of the weather file into WeatherFileLines, so the file
+		// is only read (and its data records parsed) once for all environments and warmup days.
+		// Returns false if the file could not be opened.
+
+		// METHODOLOGY EMPLOYED:
+		// The zlib gz functions read compressed and uncompressed files alike.  Line ends are
+		// removed as gio does.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const BufferSize( 4096 );
+
+		gzFile File( gzopen( FileName.c_str(), "rb" ) );
+		if ( File == nullptr ) return false;
+
+		WeatherFileLines.clear();
+		char Buffer[ BufferSize ];
+		std::string Line;
+		while ( gzgets( File, Buffer, BufferSize ) != nullptr ) {
+			Line += Buffer; // Long lines come in several pieces
+			if ( Line.back() != '\n' ) continue;
+			while ( ! Line.empty() && ( Line.back() == '\n' || Line.back() == '\r' ) ) Line.pop_back();
+			WeatherFileLines.push_back( Line );
+			Line.clear();
+		}
+		if ( ! Line.empty() ) { // Last line without a line end
+			while ( Line.back() == '\r' ) Line.pop_back();
+			WeatherFileLines.push_back( Line );
+		}
+		gzclose( File );
+
+		WeatherRecords.deallocate();
+		WeatherRecords.allocate( int( WeatherFileLines.size() ) );
+		WeatherFileLineNum = 0;
+		return true;
+
+	}
+
+	int
+	ReadWeatherFileLine( std::string & Line )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function reads the next line of the weather file and returns the read status
+		// (0 when read, negative at the end of the file, positive on other errors).
+
+		if ( WeatherFileInMemory ) {
+			if ( WeatherFileLineNum < int( WeatherFileLines.size() ) ) {
+				Line = WeatherFileLines[ WeatherFileLineNum ];
+				++WeatherFileLineNum;
+				return 0;
+			}
+			Line.clear();
+			return -1;
+		}
+
+		IOFlags flags;
+		gio::read( WeatherFileUnitNumber, fmtA, flags ) >> Line;
+		return flags.ios();
+
+	}
+
+	void
+	RewindWeatherFile()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine positions the weather file at its first line.
+
+		if ( WeatherFileInMemory ) {
+			WeatherFileLineNum = 0;
+		} else {
+			gio::rewind( WeatherFileUnitNumber );
+		}
+
+	}
+
+	void
+	BackspaceWeatherFile()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine positions the weather file back one line, so the last line is read again.
+
+		if ( WeatherFileInMemory ) {
+			if ( WeatherFileLineNum > 0 ) --WeatherFileLineNum;
+		} else {
+			gio::backspace( WeatherFileUnitNumber );
+		}
+
+	}
+
+	std::vector< std::string >
+	ReadWeatherFileHeaderLines( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the header lines of a weather file without reading its data
+		// records.  No lines are returned if the file could not be opened.
+
+		// METHODOLOGY EMPLOYED:
+		// The eight EPW header lines come before the first data record.  The zlib gz functions
+		// read compressed and uncompressed files alike, as in LoadWeatherFileLines.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const BufferSize( 4096 );
+		std::vector< std::string >::size_type const NumHeaderLines( 8 );
+
+		std::vector< std::string > Lines;
+		gzFile File( gzopen( FileName.c_str(), "rb" ) );
+		if ( File == nullptr ) return Lines;
+
+		char Buffer[ BufferSize ];
+		std::string Line;
+		while ( Lines.size() < NumHeaderLines && gzgets( File, Buffer, BufferSize ) != nullptr ) {
+			Line += Buffer; // Long lines come in several pieces
+			if ( Line.back() != '\n' ) continue;
+			while ( ! Line.empty() && ( Line.back() == '\n' || Line.back() == '\r' ) ) Line.pop_back();
+			Lines.push_back( Line );
+			Line.clear();
+		}
+		gzclose( File );
+		return Lines;
+
+	}
+
+	bool
+	SwitchWeatherFile( std::string const & FileName ) // Weather file read by the environments still to be simulated
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function points the environments still to be simulated at another weather file.
+		// It returns false, after a severe error, if the header of that file does not agree with
+		// the header of the weather file the input was processed with.
+
+		// METHODOLOGY EMPLOYED:
+		// The header is processed once, with the input, so the location, the holidays and daylight
+		// saving periods and the data periods of the new file must be those already processed.
+		// The ground temperatures already taken from the header are kept, with a warning when the
+		// new file has others.  Each environment then opens the new file without its header, as
+		// it opened the old one.
+
+		// Using/Aliasing
+		using InputProcessor::MakeUPPERCase;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static Array1D_string const MatchedHeader( 2, { "HOLIDAYS/DAYLIGHT SAVING", "DATA PERIODS" } );
+		static std::string const RoutineName( "SwitchWeatherFile: " );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::vector< std::string > const OldLines( ReadWeatherFileHeaderLines( DataStringGlobals::inputWeatherFileName ) );
+		std::vector< std::string > const NewLines( ReadWeatherFileHeaderLines( FileName ) );
+		bool HeadersAgree( true );
+
+		// Header line of the given kind, in upper case, or blank if the header has none
+		auto HeaderLine = []( std::vector< std::string > const & Lines, std::string const & Header ) -> std::string {
+			for ( auto const & Line : Lines ) {
+				std::string const UpperLine( MakeUPPERCase( stripped( Line ) ) );
+				if ( has_prefix( UpperLine, Header ) ) return UpperLine;
+			}
+			return std::string();
+		};
+		// Comma separated fields of a header line, stripped of blanks
+		auto HeaderFields = []( std::string const & Line ) -> std::vector< std::string > {
+			std::vector< std::string > Fields;
+			std::string::size_type Start( 0 );
+			while ( true ) {
+				std::string::size_type const Comma( Line.find( ',', Start ) );
+				Fields.push_back( stripped( Line.substr( Start, Comma == std::string::npos ? std::string::npos : Comma - Start ) ) );
+				if ( Comma == std::string::npos ) break;
+				Start = Comma + 1;
+			}
+			return Fields;
+		};
+
+		if ( NewLines.empty() ) {
+			ShowSevereError( RoutineName + "Could not open weather file \"" + FileName + "\"." );
+			return false;
+		}
+
+		// Latitude, longitude, time zone and elevation follow the city, state, country, source and WMO fields
+		std::vector< std::string > OldLocation( HeaderFields( HeaderLine( OldLines, "LOCATION" ) ) );
+		std::vector< std::string > NewLocation( HeaderFields( HeaderLine( NewLines, "LOCATION" ) ) );
+		OldLocation.resize( 10 );
+		NewLocation.resize( 10 );
+		if ( ! std::equal( OldLocation.begin() + 6, OldLocation.end(), NewLocation.begin() + 6 ) ) {
+			ShowSevereError( RoutineName + "The LOCATION of weather file \"" + FileName + "\" differs from that of \"" + DataStringGlobals::inputWeatherFileName + "\"." );
+			ShowContinueError( "...latitude, longitude, time zone and elevation [" + NewLocation[ 6 ] + ',' + NewLocation[ 7 ] + ',' + NewLocation[ 8 ] + ',' + NewLocation[ 9 ] + "] were expected to be [" + OldLocation[ 6 ] + ',' + OldLocation[ 7 ] + ',' + OldLocation[ 8 ] + ',' + OldLocation[ 9 ] + "]." );
+			HeadersAgree = false;
+		}
+		for ( int Loop = 1; Loop <= MatchedHeader.isize(); ++Loop ) {
+			if ( HeaderLine( NewLines, MatchedHeader( Loop ) ) == HeaderLine( OldLines, MatchedHeader( Loop ) ) ) continue;
+			ShowSevereError( RoutineName + "The " + MatchedHeader( Loop ) + " header of weather file \"" + FileName + "\" differs from that of \"" + DataStringGlobals::inputWeatherFileName + "\"." );
+			HeadersAgree = false;
+		}
+		if ( ! HeadersAgree ) {
+			ShowContinueError( "...the weather file header is processed once, with the input, for every weather file simulated." );
+			return false;
+		}
+		if ( HeaderLine( NewLines, "GROUND TEMPERATURES" ) != HeaderLine( OldLines, "GROUND TEMPERATURES" ) ) {
+			ShowWarningError( RoutineName + "The GROUND TEMPERATURES of weather file \"" + FileName + "\" differ from those of \"" + DataStringGlobals::inputWeatherFileName + "\"; the ground temperatures of \"" + DataStringGlobals::inputWeatherFileName + "\" are kept." );
+		}
+
+		CloseWeatherFile();
+		DataStringGlobals::inputWeatherFileName = FileName;
+		WeatherFileInMemory = false;
+		WeatherFileLines.clear();
+		WeatherRecords.deallocate();
+		WeatherFileLineNum = 0;
+		return true;
+
+	}
+
 	void
 	ResolveLocationInformation( bool & ErrorsFound ) // Set to true if no location evident
 	{
@@ -4993,6 +5331,7 @@ Label9999: ;
 				if ( PrintEndDataDictionary && DoOutputReporting ) {
 					gio::write( OutputFileStandard, EndOfHeaderFormat );
 					gio::write( OutputFileMeters, EndOfHeaderFormat );
+					CsvOutput::EndCsvDictionary();
 					PrintEndDataDictionary = false;
 				}
 				if ( DoOutputReporting ) {
@@ -5109,6 +5448,7 @@ Label9999: ;
 		// which will have to be completed to run the annual run.
 		if ( TotRunPers >= 1 || FullAnnualRun ) {
 			GetRunPeriodData( TotRunPers, ErrorsFound );
+			SliceRunPeriods( TotRunPers, ErrorsFound );
 		}
 
 		if ( RPD1 >= 1 || RPD2 >= 1 || TotRunPers >= 1 || FullAnnualRun ) {
@@ -5576,6 +5916,90 @@ Label9999: ;
 
 	}
 
+	void
+	SliceRunPeriods(
+		int const TotRunPers, // Total number of Run Periods requested
+		bool & ErrorsFound
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Limits the weather file run periods to the days of year given by the RunPeriodSlice
+		// environment variable ("first,last"), so that a long run period can be simulated as
+		// separate runs of parts of it, side by side.
+
+		// METHODOLOGY EMPLOYED:
+		// The run period starts RunPeriodSliceOverlapDays days ahead of the first day of the slice,
+		// within the run period, so that the days of the slice start from a building that has been
+		// simulated for a while rather than only warmed up on its first day; the results of those
+		// days are to be dropped when the slices are joined.  The day of week given by the run
+		// period moves with its start.  Only single year run periods that do not span the end of
+		// the year and do not use actual weather years are sliced.
+
+		// Using/Aliasing
+		using DataSystemVariables::cRunPeriodSlice;
+		using DataSystemVariables::cRunPeriodSliceOverlapDays;
+		using General::InvJulianDay;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtLD( "*" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string cEnvValue;
+		int SliceFirstDay( 0 ); // First day of year of the slice
+		int SliceLastDay( 0 ); // Last day of year of the slice
+		int OverlapDays( 0 ); // Days simulated ahead of the first day of the slice
+		int FirstDay; // First and last day of year simulated of the run period
+		int LastDay;
+		int Loop;
+
+		get_environment_variable( cRunPeriodSlice, cEnvValue );
+		if ( cEnvValue.empty() ) return;
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> SliceFirstDay >> SliceLastDay; if ( flags.err() ) SliceFirstDay = 0; }
+		if ( SliceFirstDay < 1 || SliceLastDay < SliceFirstDay ) {
+			ShowSevereError( "SliceRunPeriods: Environment variable " + cRunPeriodSlice + " must give the first and last day of year of the slice, found \"" + cEnvValue + "\"." );
+			ErrorsFound = true;
+			return;
+		}
+		get_environment_variable( cRunPeriodSliceOverlapDays, cEnvValue );
+		if ( ! cEnvValue.empty() ) {
+			{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> OverlapDays; if ( flags.err() ) OverlapDays = -1; }
+			if ( OverlapDays < 0 ) {
+				ShowSevereError( "SliceRunPeriods: Environment variable " + cRunPeriodSliceOverlapDays + " must give a number of days, found \"" + cEnvValue + "\"." );
+				ErrorsFound = true;
+				return;
+			}
+		}
+
+		for ( Loop = 1; Loop <= TotRunPers; ++Loop ) {
+			auto & runPeriod( RunPeriodInput( Loop ) );
+			if ( runPeriod.ActualWeather || runPeriod.BeginYear >= 100 || runPeriod.NumSimYears != 1 || runPeriod.StartDate > runPeriod.EndDate ) {
+				ShowWarningError( "SliceRunPeriods: Run period \"" + runPeriod.Title + "\" is simulated whole; only single year run periods within one year are sliced." );
+				continue;
+			}
+			FirstDay = max( runPeriod.StartDate, SliceFirstDay - OverlapDays );
+			LastDay = min( runPeriod.EndDate, SliceLastDay );
+			if ( FirstDay > LastDay ) {
+				ShowSevereError( "SliceRunPeriods: Run period \"" + runPeriod.Title + "\" has no days within the slice given by " + cRunPeriodSlice + '.' );
+				ErrorsFound = true;
+				continue;
+			}
+			if ( runPeriod.DayOfWeek != 0 ) {
+				runPeriod.DayOfWeek = mod( runPeriod.DayOfWeek - 1 + FirstDay - runPeriod.StartDate, 7 ) + 1;
+			}
+			InvJulianDay( FirstDay, runPeriod.StartMonth, runPeriod.StartDay, LeapYearAdd );
+			InvJulianDay( LastDay, runPeriod.EndMonth, runPeriod.EndDay, LeapYearAdd );
+			runPeriod.StartDate = FirstDay;
+			runPeriod.EndDate = LastDay;
+			runPeriod.MonWeekDay = 0;
+			if ( runPeriod.DayOfWeek != 0 ) {
+				SetupWeekDaysByMonth( runPeriod.StartMonth, runPeriod.StartDay, runPeriod.DayOfWeek, runPeriod.MonWeekDay );
+			}
+			ShowMessage( "SliceRunPeriods: Run period \"" + runPeriod.Title + "\" simulated from " + RoundSigDigits( runPeriod.StartMonth ) + '/' + RoundSigDigits( runPeriod.StartDay ) + " through " + RoundSigDigits( runPeriod.EndMonth ) + '/' + RoundSigDigits( runPeriod.EndDay ) + ", including " + RoundSigDigits( max( min( SliceFirstDay, LastDay + 1 ) - FirstDay, 0 ) ) + " overlap days." );
+		}
+
+	}
+
 	void
 	GetRunPeriodDesignData( bool & ErrorsFound )
 	{
@@ -8032,7 +8456,7 @@ Label9999: ;
 				if ( Pos == std::string::npos ) {
 					if ( len( Line ) == 0 ) {
 						while ( Pos == std::string::npos ) {
-							gio::read( WeatherFileUnitNumber, fmtA ) >> Line;
+							ReadWeatherFileLine( Line );
 							strip( Line );
 							uppercase( Line );
 							Pos = index( Line, ',' );
@@ -8087,7 +8511,7 @@ Label9999: ;
 			if ( Pos == std::string::npos ) {
 				if ( len( Line ) == 0 ) {
 					while ( Pos == std::string::npos && len( Line ) == 0 ) {
-						gio::read( WeatherFileUnitNumber, fmtA ) >> Line;
+						ReadWeatherFileLine( Line );
 						strip( Line );
 						Pos = index( Line, ',' );
 					}
@@ -8367,7 +8791,7 @@ Label9999: ;
 				if ( Pos == std::string::npos ) {
 					if ( len( Line ) == 0 ) {
 						while ( Pos == std::string::npos ) {
-							gio::read( WeatherFileUnitNumber, fmtA ) >> Line;
+							ReadWeatherFileLine( Line );
 							strip( Line );
 							uppercase( Line );
 							Pos = index( Line, ',' );
@@ -8514,7 +8938,7 @@ Label9999: ;
 				if ( Pos == std::string::npos ) {
 					if ( len( Line ) == 0 ) {
 						while ( Pos == std::string::npos ) {
-							gio::read( WeatherFileUnitNumber, fmtA ) >> Line;
+							ReadWeatherFileLine( Line );
 							strip( Line );
 							uppercase( Line );
 							Pos = index( Line, ',' );
@@ -8685,7 +9109,7 @@ Label9999: ;
 		// Headers should come in order
 		StillLooking = true;
 		while ( StillLooking ) {
-			{ IOFlags flags; gio::read( WeatherFileUnitNumber, fmtA, flags ) >> Line; if ( flags.end() ) goto Label9998; }
+			if ( ReadWeatherFileLine( Line ) < 0 ) goto Label9998;
 			uppercase( Line );
 			if ( has( Line, Header ) ) break;
 		}
@@ -8714,7 +9138,7 @@ Label9999: ;
 			if ( Pos == std::string::npos ) {
 				if ( len( Line ) == 0 ) {
 					while ( Pos == std::string::npos ) {
-						gio::read( WeatherFileUnitNumber, fmtA ) >> Line;
+						ReadWeatherFileLine( Line );
 						strip( Line );
 						uppercase( Line );
 						Pos = index( Line, ',' );
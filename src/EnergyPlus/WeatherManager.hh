@@ -1,8 +1,13 @@
 #ifndef WeatherManager_hh_INCLUDED
 #define WeatherManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array3D.hh>
@@ -91,6 +96,9 @@ namespace WeatherManager {
 	extern Real64 WeatherFileTimeZone;
 	extern Real64 WeatherFileElevation;
 	extern int WeatherFileUnitNumber; // File unit number for the weather file
+	extern bool WeatherFileInMemory; // True when the weather file is read from WeatherFileLines rather than its unit
+	extern std::vector< std::string > WeatherFileLines; // Lines of the weather file, header included
+	extern int WeatherFileLineNum; // Number of lines of WeatherFileLines already read
 	extern Array1D< Real64 > GroundTemps; // Bldg Surface
 	extern Array1D< Real64 > GroundTempsFC; // F or C factor method
 	extern Array1D< Real64 > SurfaceGroundTemps; // Surface
@@ -1150,6 +1158,88 @@ namespace WeatherManager {
 
 	};
 
+	struct WeatherRecordData
+	{
+		// Values of an EPW data record as given by InterpretWeatherDataLine
+
+		// Members
+		bool Interpreted; // True once the line has been interpreted
+		bool MissedWeathCodes; // True if the present weather codes were not valid
+		int WYear;
+		int WMonth;
+		int WDay;
+		int WHour;
+		int WMinute;
+		Real64 DryBulb;
+		Real64 DewPoint;
+		Real64 RelHum;
+		Real64 AtmPress;
+		Real64 ETHoriz;
+		Real64 ETDirect;
+		Real64 IRHoriz;
+		Real64 GLBHoriz;
+		Real64 DirectRad;
+		Real64 DiffuseRad;
+		Real64 GLBHorizIllum;
+		Real64 DirectNrmIllum;
+		Real64 DiffuseHorizIllum;
+		Real64 ZenLum;
+		Real64 WindDir;
+		Real64 WindSpeed;
+		Real64 TotalSkyCover;
+		Real64 OpaqueSkyCover;
+		Real64 Visibility;
+		Real64 CeilHeight;
+		int PresWeathObs;
+		Array1D_int PresWeathConds;
+		Real64 PrecipWater;
+		Real64 AerosolOptDepth;
+		Real64 SnowDepth;
+		Real64 DaysSinceLastSnow;
+		Real64 Albedo;
+		Real64 LiquidPrecip;
+
+		// Default Constructor
+		WeatherRecordData() :
+			Interpreted( false ),
+			MissedWeathCodes( false ),
+			WYear( 0 ),
+			WMonth( 0 ),
+			WDay( 0 ),
+			WHour( 0 ),
+			WMinute( 0 ),
+			DryBulb( 0.0 ),
+			DewPoint( 0.0 ),
+			RelHum( 0.0 ),
+			AtmPress( 0.0 ),
+			ETHoriz( 0.0 ),
+			ETDirect( 0.0 ),
+			IRHoriz( 0.0 ),
+			GLBHoriz( 0.0 ),
+			DirectRad( 0.0 ),
+			DiffuseRad( 0.0 ),
+			GLBHorizIllum( 0.0 ),
+			DirectNrmIllum( 0.0 ),
+			DiffuseHorizIllum( 0.0 ),
+			ZenLum( 0.0 ),
+			WindDir( 0.0 ),
+			WindSpeed( 0.0 ),
+			TotalSkyCover( 0.0 ),
+			OpaqueSkyCover( 0.0 ),
+			Visibility( 0.0 ),
+			CeilHeight( 0.0 ),
+			PresWeathObs( 0 ),
+			PresWeathConds( 9, 9 ),
+			PrecipWater( 0.0 ),
+			AerosolOptDepth( 0.0 ),
+			SnowDepth( 0.0 ),
+			DaysSinceLastSnow( 0.0 ),
+			Albedo( 0.0 ),
+			LiquidPrecip( 0.0 )
+		{}
+
+	};
+
 	// Object Data
 	extern DayWeatherVariables TodayVariables; // Today's daily weather variables | Derived Type for Storing Weather "Header" Data | Day of year for weather data | Year of weather data | Month of weather data | Day of month for weather data | Day of week for weather data | Daylight Saving Time Period indicator (0=no,1=yes) | Holiday indicator (0=no holiday, non-zero=holiday type) | Sine of the solar declination angle | Cosine of the solar declination angle | Value of the equation of time formula
 	extern DayWeatherVariables TomorrowVariables; // Tomorrow's daily weather variables | Derived Type for Storing Weather "Header" Data | Day of year for weather data | Year of weather data | Month of weather data | Day of month for weather data | Day of week for weather data | Daylight Saving Time Period indicator (0=no,1=yes) | Holiday indicator (0=no holiday, non-zero=holiday type) | Sine of the solar declination angle | Cosine of the solar declination angle | Value of the equation of time formula
@@ -1168,6 +1258,7 @@ namespace WeatherManager {
 	extern Array1D< WeatherProperties > WPSkyTemperature;
 	extern Array1D< SpecialDayData > SpecialDays;
 	extern Array1D< DataPeriodData > DataPeriods;
+	extern Array1D< WeatherRecordData > WeatherRecords; // Interpreted data records, by line of WeatherFileLines
 
 	// Functions
 
@@ -1350,6 +1441,27 @@ namespace WeatherManager {
 	void
 	CloseWeatherFile();
 
+	bool
+	WeatherFileIsCompressed( std::string const & FileName );
+
+	bool
+	LoadWeatherFileLines( std::string const & FileName );
+
+	int
+	ReadWeatherFileLine( std::string & Line );
+
+	void
+	RewindWeatherFile();
+
+	void
+	BackspaceWeatherFile();
+
+	std::vector< std::string >
+	ReadWeatherFileHeaderLines( std::string const & FileName );
+
+	bool
+	SwitchWeatherFile( std::string const & FileName ); // Weather file read by the environments still to be simulated
+
 	void
 	ResolveLocationInformation( bool & ErrorsFound ); // Set to true if no location evident
 
@@ -1374,6 +1486,12 @@ namespace WeatherManager {
 		bool & ErrorsFound
 	);
 
+	void
+	SliceRunPeriods(
+		int const TotRunPers, // Total number of Run Periods requested
+		bool & ErrorsFound
+	);
+
 	void
 	GetRunPeriodDesignData( bool & ErrorsFound );
 
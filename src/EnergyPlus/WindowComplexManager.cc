@@ -134,13 +134,18 @@ namespace WindowComplexManager {
 		// Set up the overall optical geometry for a BSDF window
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The state geometry of a window depends only on that window and the surfaces around it,
+		// so the windows are set up in parallel once their storage has been allocated.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using namespace Vectors;
+#ifdef HBIRE_USE_OMP
+		using DataSystemVariables::NumberBSDFThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -367,17 +372,31 @@ namespace WindowComplexManager {
 				if ( WindowStateList( IState, IWind ).InitInc == Calculate_Geometry ) {
 					ComplexWind( ISurf ).Geom( IState ).Inc = BasisList( WindowStateList( IState, IWind ).IncBasisIndx ); //Put in the basis structure from the BasisList
 					ComplexWind( ISurf ).Geom( IState ).Trn = BasisList( WindowStateList( IState, IWind ).TrnBasisIndx );
+				}
+
+			} //State loop
+		} //Complex Window loop
 
-					SetupComplexWindowStateGeometry( ISurf, IState, IConst, ComplexWind( ISurf ), ComplexWind( ISurf ).Geom( IState ), SurfaceWindow( ISurf ).ComplexFen.State( IState ) );
+		//  Calculate the state geometry, one window per thread; copied states are taken from an
+		//   earlier state of the same window, so the states of a window are done in order
+#ifdef HBIRE_USE_OMP
+		int const nThreads( ParallelLoopThreads( NumberBSDFThreads, NumComplexWind ) );
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads) if(nThreads > 1)
+#endif
+		for ( int iWind = 1; iWind <= NumComplexWind; ++iWind ) {
+			int const iSurf( WindowList( iWind ).SurfNo );
+			for ( int iState = 1; iState <= WindowList( iWind ).NumStates; ++iState ) {
+				int const iConst( WindowStateList( iState, iWind ).Konst );
+				if ( WindowStateList( iState, iWind ).InitInc == Calculate_Geometry ) {
+					SetupComplexWindowStateGeometry( iSurf, iState, iConst, ComplexWind( iSurf ), ComplexWind( iSurf ).Geom( iState ), SurfaceWindow( iSurf ).ComplexFen.State( iState ) );
 					//Note--setting up the state geometry will include constructing outgoing basis/surface
 					//  maps and those incoming maps that will not depend on shading.
 				} else {
-					SurfaceWindow( ISurf ).ComplexFen.State( IState ) = SurfaceWindow( ISurf ).ComplexFen.State( WindowStateList( IState, IWind ).CopyIncState ); //Note this overwrites Konst
-					SurfaceWindow( ISurf ).ComplexFen.State( IState ).Konst = IConst; //  so it has to be put back
+					SurfaceWindow( iSurf ).ComplexFen.State( iState ) = SurfaceWindow( iSurf ).ComplexFen.State( WindowStateList( iState, iWind ).CopyIncState ); //Note this overwrites Konst
+					SurfaceWindow( iSurf ).ComplexFen.State( iState ).Konst = iConst; //  so it has to be put back
 					//SurfaceWindow (ISurf )%ComplexFen%State(IState)%ThermConst = ThConst  !same for ThermConst
-					ComplexWind( ISurf ).Geom( IState ) = ComplexWind( ISurf ).Geom( WindowStateList( IState, IWind ).CopyIncState );
+					ComplexWind( iSurf ).Geom( iState ) = ComplexWind( iSurf ).Geom( WindowStateList( iState, iWind ).CopyIncState );
 				}
-
 			} //State loop
 		} //Complex Window loop
 		//  Allocate all beam-dependent complex fenestration quantities
@@ -664,7 +683,8 @@ namespace WindowComplexManager {
 		// On first call, calls the one-time initializition
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// Each window only touches its own geometry and state data, so the windows are
+		// initialized in parallel.
 
 		// REFERENCES:
 		// na
@@ -672,6 +692,10 @@ namespace WindowComplexManager {
 		// Using/Aliasing
 		using DataGlobals::KickOffSizing;
 		using DataGlobals::KickOffSimulation;
+#ifdef HBIRE_USE_OMP
+		using DataSystemVariables::NumberBSDFThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -688,11 +712,6 @@ namespace WindowComplexManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// LOGICAL,SAVE    ::  Once  =.TRUE.  !Flag for insuring things happen once
-		int NumStates; // Number of states for a given complex fen
-		int ISurf; // Index for sorting thru Surface array
-		int IState; // Index identifying the window state for a particular window
-		int IWind; // Index identifying a window in the WindowList
-
 		// !One-time initialization
 		//  IF (Once) THEN
 		//    ONCE = .FALSE.
@@ -708,10 +727,14 @@ namespace WindowComplexManager {
 
 		// Initialize the geometric quantities
 
-		for ( IWind = 1; IWind <= NumComplexWind; ++IWind ) {
-			ISurf = WindowList( IWind ).SurfNo;
-			NumStates = ComplexWind( ISurf ).NumStates;
-			for ( IState = 1; IState <= NumStates; ++IState ) {
+#ifdef HBIRE_USE_OMP
+		int const nThreads( ParallelLoopThreads( NumberBSDFThreads, NumComplexWind ) );
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads) if(nThreads > 1)
+#endif
+		for ( int IWind = 1; IWind <= NumComplexWind; ++IWind ) {
+			int const ISurf( WindowList( IWind ).SurfNo ); // Index for sorting thru Surface array
+			int const NumStates( ComplexWind( ISurf ).NumStates ); // Number of states for a given complex fen
+			for ( int IState = 1; IState <= NumStates; ++IState ) {
 				CFSShadeAndBeamInitialization( ISurf, IState, ComplexWind( ISurf ), ComplexWind( ISurf ).Geom( IState ), SurfaceWindow( ISurf ).ComplexFen.State( IState ) );
 			} //State loop
 		} //window loop
@@ -765,21 +788,21 @@ namespace WindowComplexManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 DotProd( 0.0 ); // temporary variable for testing dot products
+		static EP_THREAD_LOCAL Real64 DotProd( 0.0 ); // temporary variable for testing dot products
 		int I; // general purpose index
 		int IncRay; // Index of incident ray corresponding to beam direction
 		Real64 Theta; // Theta angle of incident ray correspongind to beam direction
 		Real64 Phi; // Phi angle of incident ray correspongind to beam direction
-		static int IHit( 0 ); // hit flag
+		static EP_THREAD_LOCAL int IHit( 0 ); // hit flag
 		int JSurf; // general purpose surface number
 		int Hour; // hour of day
 		int TotHits; // hit counter
 		int TS; // time step
 
 		// Object Data
-		static Vector SunDir( 0.0, 0.0, 1.0 ); // unit vector pointing toward sun (world CS)
-		static Vector Posit( 0.0, 0.0, 1.0 ); // vector location of current ground point
-		static Vector HitPt( 0.0, 0.0, 1.0 ); // vector location of ray intersection with a surface
+		static EP_THREAD_LOCAL Vector SunDir( 0.0, 0.0, 1.0 ); // unit vector pointing toward sun (world CS)
+		static EP_THREAD_LOCAL Vector Posit( 0.0, 0.0, 1.0 ); // vector location of current ground point
+		static EP_THREAD_LOCAL Vector HitPt( 0.0, 0.0, 1.0 ); // vector location of ray intersection with a surface
 
 		if ( KickOffSizing || KickOffSimulation ) return;
 
@@ -950,8 +973,8 @@ namespace WindowComplexManager {
 		int BkIncRay; // index of sun dir in back incidence basis
 		bool RegWindFnd; // flag for regular exterior back surf window
 		Array1D_int RegWinIndex; // bk surf nos of reg windows
-		static int NRegWin( 0 ); // no reg windows found as back surfaces
-		static int KRegWin( 0 ); // index of reg window as back surface
+		static EP_THREAD_LOCAL int NRegWin( 0 ); // no reg windows found as back surfaces
+		static EP_THREAD_LOCAL int KRegWin( 0 ); // index of reg window as back surface
 		Real64 Refl; // temporary reflectance
 		Array1D< Real64 > Absorb; // temporary layer absorptance
 
@@ -4109,10 +4132,10 @@ namespace WindowComplexManager {
 		//  REAL(r64)      :: V(4,3)                   ! Vertices of surfaces
 		//  REAL(r64)      :: A(4,3)                   ! Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
 		//  REAL(r64)      :: C(4,3)                   ! Vectors from vertices to intersection point
-		static Array2D< Real64 > V; // Vertices of surfaces
-		static Array2D< Real64 > A; // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
-		static Array2D< Real64 > C; // Vectors from vertices to intersection point
-		static bool firstTime( true );
+		static EP_THREAD_LOCAL Array2D< Real64 > V; // Vertices of surfaces
+		static EP_THREAD_LOCAL Array2D< Real64 > A; // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
+		static EP_THREAD_LOCAL Array2D< Real64 > C; // Vectors from vertices to intersection point
+		static EP_THREAD_LOCAL bool firstTime( true );
 
 		// FLOW:
 		IPIERC = 0;
@@ -16,6 +16,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <DaylightingManager.hh>
 #include <General.hh>
@@ -158,6 +159,8 @@ namespace WindowEquivalentLayer {
 
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS
+		using DataSystemVariables::EQLBeamPropertyTables;
+
 		int ConstrNum; // Construction number
 		int EQLConNum; // Construction number for equivalent layer windows
 		int SurfNum; // surface number
@@ -179,6 +182,13 @@ namespace WindowEquivalentLayer {
 
 		} //  end do for TotConstructs
 
+		if ( EQLBeamPropertyTables ) {
+			if ( ! allocated( CFSBeamTable ) ) CFSBeamTable.allocate( TotWinEquivLayerConstructs );
+			for ( EQLConNum = 1; EQLConNum <= TotWinEquivLayerConstructs; ++EQLConNum ) {
+				FormEQLBeamTable( CFS( EQLConNum ), CFSBeamTable( EQLConNum ) );
+			}
+		}
+
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( ! Construct( Surface( SurfNum ).Construction ).TypeIsWindow ) continue;
 			if ( ! Construct( Surface( SurfNum ).Construction ).WindowTypeEQL ) continue;
@@ -9176,6 +9186,110 @@ namespace WindowEquivalentLayer {
 		return root_4( J / ( StefanBoltzmann * max( Emiss, 0.001 ) ) ) - KelvinConv;
 	}
 
+	void
+	FormEQLBeamTable(
+		CFSTY & FS, // fenestration system
+		CFSBEAMTAB & Table // beam property table of FS
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Tabulates the beam absorptances and transmittance of a fenestration system from
+		// CalcEQLWindowOpticalProperty at 1 deg steps of incidence angle and, when FS has
+		// venetian blind layers, of the profile angle CalcEQLOpticalProperty passes on for them.
+
+		// METHODOLOGY EMPLOYED:
+		// Systems with controlled layers are left to the direct calculation, since the slat angle
+		// is set from the sun position there and is used again for the diffuse properties, and so
+		// are systems with both horizontal and vertical slats, which depend on two profile angles.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const NInc( 91 ); // Incidence angles, 0 to 90 deg
+		int const NProf( 181 ); // Profile angles, -90 to 90 deg
+		Real64 const DegToRad( 1.0 / RadiansToDeg );
+
+		bool HasVBHor( false );
+		bool HasVBVer( false );
+		static Array2D< Real64 > Abs1( 2, CFSMAXNL + 1 );
+
+		Table.Tabulated = false;
+		if ( FS.ISControlled ) return;
+		for ( int Lay = 1; Lay <= FS.NL; ++Lay ) {
+			if ( FS.L( Lay ).LTYPE == ltyVBHOR ) HasVBHor = true;
+			if ( FS.L( Lay ).LTYPE == ltyVBVER ) HasVBVer = true;
+		}
+		if ( HasVBHor && HasVBVer ) return;
+
+		// CalcEQLOpticalProperty gives horizontal slats their profile angle as HProfA and vertical ones as VProfA
+		Table.ProfAxis = 0;
+		if ( HasVBHor ) Table.ProfAxis = 2;
+		if ( HasVBVer ) Table.ProfAxis = 1;
+		Table.NInc = NInc;
+		Table.NProf = ( Table.ProfAxis == 0 ) ? 1 : NProf;
+		Table.Abs.allocate( 2, CFSMAXNL + 1, Table.NInc, Table.NProf );
+		for ( int IProf = 1; IProf <= Table.NProf; ++IProf ) {
+			Real64 const ProfA( ( Table.ProfAxis == 0 ) ? 0.0 : ( IProf - 91 ) * DegToRad );
+			Real64 const VProfA( ( Table.ProfAxis == 1 ) ? ProfA : 0.0 );
+			Real64 const HProfA( ( Table.ProfAxis == 2 ) ? ProfA : 0.0 );
+			for ( int IInc = 1; IInc <= Table.NInc; ++IInc ) {
+				CalcEQLWindowOpticalProperty( FS, isBEAM, Abs1, ( IInc - 1 ) * DegToRad, VProfA, HProfA );
+				for ( int Lay = 1; Lay <= CFSMAXNL + 1; ++Lay ) {
+					Table.Abs( 1, Lay, IInc, IProf ) = Abs1( 1, Lay );
+					Table.Abs( 2, Lay, IInc, IProf ) = Abs1( 2, Lay );
+				}
+			}
+		}
+		Table.Tabulated = true;
+
+	}
+
+	bool
+	InterpEQLBeamTable(
+		CFSBEAMTAB const & Table, // beam property table
+		Real64 const IncA, // angle of incidence, radians
+		Real64 const VProfA, // inc solar vertical profile angle, radians
+		Real64 const HProfA, // inc solar horizontal profile angle, radians
+		Array2A< Real64 > Abs1 // front and back absorptances by layer, with the transmittance after the last layer
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Interpolates the beam properties of a tabulated fenestration system linearly in the
+		// incidence angle and the profile angle; returns false, leaving Abs1 unchanged, if the
+		// system is not tabulated or the angles are outside the table.
+
+		// Argument array dimensioning
+		Abs1.dim( 2, CFSMAXNL+1 );
+
+		if ( ! Table.Tabulated ) return false;
+		Real64 const IncDeg( IncA * RadiansToDeg );
+		if ( IncDeg < 0.0 || IncDeg > Table.NInc - 1 ) return false;
+		int const IInc( min( int( IncDeg ) + 1, Table.NInc - 1 ) );
+		Real64 const FInc( IncDeg - ( IInc - 1 ) );
+
+		int IProf( 1 );
+		Real64 FProf( 0.0 );
+		if ( Table.NProf > 1 ) {
+			Real64 const ProfDeg( ( ( Table.ProfAxis == 1 ) ? VProfA : HProfA ) * RadiansToDeg + 90.0 );
+			if ( ProfDeg < 0.0 || ProfDeg > Table.NProf - 1 ) return false;
+			IProf = min( int( ProfDeg ) + 1, Table.NProf - 1 );
+			FProf = ProfDeg - ( IProf - 1 );
+		}
+
+		for ( int Side = 1; Side <= 2; ++Side ) {
+			for ( int Lay = 1; Lay <= CFSMAXNL + 1; ++Lay ) {
+				Real64 Val( ( 1.0 - FInc ) * Table.Abs( Side, Lay, IInc, IProf ) + FInc * Table.Abs( Side, Lay, IInc + 1, IProf ) );
+				if ( Table.NProf > 1 ) {
+					Real64 const ValP( ( 1.0 - FInc ) * Table.Abs( Side, Lay, IInc, IProf + 1 ) + FInc * Table.Abs( Side, Lay, IInc + 1, IProf + 1 ) );
+					Val = ( 1.0 - FProf ) * Val + FProf * ValP;
+				}
+				Abs1( Side, Lay ) = Val;
+			}
+		}
+		return true;
+
+	}
+
 	void
 	CalcEQLOpticalProperty(
 		int const SurfNum,
@@ -9205,6 +9319,7 @@ namespace WindowEquivalentLayer {
 		// Using/Aliasing
 		using DataEnvironment::SOLCOS;
 		using DaylightingManager::ProfileAngle;
+		using DataSystemVariables::EQLBeamPropertyTables;
 
 		// Argument array dimensioning
 		CFSAbs.dim( 2, CFSMAXNL+1 );
@@ -9255,7 +9370,9 @@ namespace WindowEquivalentLayer {
 			}
 			// Incident angle
 			IncAng = std::acos( CosIncAng( TimeStep, HourOfDay, SurfNum ) );
-			CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
+			if ( ! EQLBeamPropertyTables || ! InterpEQLBeamTable( CFSBeamTable( EQLNum ), IncAng, ProfAngVer, ProfAngHor, Abs1 ) ) {
+				CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
+			}
 			CFSAbs( 1, {1,CFSMAXNL + 1} ) = Abs1( 1, {1,CFSMAXNL + 1} );
 			CFSAbs( 2, {1,CFSMAXNL + 1} ) = Abs1( 2, {1,CFSMAXNL + 1} );
 		} else {
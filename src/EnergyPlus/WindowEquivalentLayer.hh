@@ -862,6 +862,21 @@ namespace WindowEquivalentLayer {
 		Real64 const Emiss // surface emissivity
 	);
 
+	void
+	FormEQLBeamTable(
+		CFSTY & FS, // fenestration system
+		CFSBEAMTAB & Table // beam property table of FS
+	);
+
+	bool
+	InterpEQLBeamTable(
+		CFSBEAMTAB const & Table, // beam property table
+		Real64 const IncA, // angle of incidence, radians
+		Real64 const VProfA, // inc solar vertical profile angle, radians
+		Real64 const HProfA, // inc solar horizontal profile angle, radians
+		Array2A< Real64 > Abs1 // front and back absorptances by layer, with the transmittance after the last layer
+	);
+
 	void
 	CalcEQLOpticalProperty(
 		int const SurfNum,
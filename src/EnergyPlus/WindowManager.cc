@@ -1,7 +1,9 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -22,6 +24,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -81,6 +84,7 @@ namespace WindowManager {
 	// Data
 	//MODULE PARAMETER DEFINITIONS:
 	static std::string const BlankString;
+	static std::string const GlazingOpticsCacheMagic( "EPGOC001" ); // File signature and format version of the glazing optics cache file
 
 	Real64 const sigma( 5.6697e-8 ); // Stefan-Boltzmann constant
 	Real64 const TKelvin( KelvinConv ); // conversion from Kelvin to Celsius
@@ -126,6 +130,10 @@ namespace WindowManager {
 	Array2D< Real64 > gwght( 5, 5, 0.0 ); // Gas molecular weights for each gap
 	Array2D< Real64 > gfract( 5, 5, 0.0 ); // Gas fractions for each gap
 	Array1D_int gnmix( 5, 0 ); // Number of gases in gap
+	Array3D< Real64 > gmixroot4( 5, 5, 5, 0.0 ); // root_4( gwght(i)/gwght(j) ) for gases i and j of each gap
+	Array3D< Real64 > gmixdowner( 5, 5, 5, 0.0 ); // Denominator factor of eqs. 61, 64 and 66 for gases i and j of each gap
+	Array3D< Real64 > gmixpsiterm( 5, 5, 5, 0.0 ); // Bracketed factor of eq. 64 for gases i and j of each gap
+	Array2D< Real64 > gmixkpfac( 5, 5, 0.0 ); // Factor of the viscosity in eq. 67 for each gas of each gap
 	Array1D< Real64 > gap( 5, 0.0 ); // Gap width (m)
 	Array1D< Real64 > thick( 5, 0.0 ); // Glass layer thickness (m)
 	Array1D< Real64 > scon( 5, 0.0 ); // Glass layer conductance--conductivity/thickness (W/m2-K)
@@ -203,6 +211,11 @@ namespace WindowManager {
 	Array1D< Real64 > rbvisPhi( 10, 0.0 ); // Glazing system visible back reflectance for each angle of incidence
 	Array1D< Real64 > CosPhiIndepVar( 10, 0.0 ); // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Object Data
+	Array1D< WindowHeatBalanceSolutionType > WindowHBSolution; // Last heat balance solution of each window surface
+	Array1D< WindowBatchType > WindowBatch; // Latest window solutions of each construction
+	GlazingOpticsCacheData GlazingOpticsCache;
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -415,6 +428,8 @@ namespace WindowManager {
 
 		W5InitGlassParameters();
 
+		InitGlazingOpticsCache( DataSystemVariables::GlazingOpticsCacheFileName );
+
 		// Calculate optical properties of blind-type layers entered with MATERIAL:WindowBlind
 		if ( TotBlinds > 0 ) CalcWindowBlindProperties();
 
@@ -631,6 +646,14 @@ namespace WindowManager {
 				}
 			} // End of loop over glass layers in the construction for front calculation
 
+			// Glazing systems whose layers and spectra are in the cache skip the spectral integration
+			std::vector< Real64 > OpticsKey; // Everything the system properties at each incidence angle depend on
+			bool OpticsCached( false );
+			if ( GlazingOpticsCache.Active ) {
+				OpticsKey = GlazingOpticsCacheKey( 1, NGlass, lquasi, lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+				OpticsCached = RestoreGlazingOpticsFromCache( OpticsKey, 1, NGlass );
+			}
+
 			// Loop over incidence angle from 0 to 90 deg in 10 deg increments.
 			// Get glass layer properties, then glazing system properties (which include the
 			// effect of inter-reflection among glass layers) at each incidence angle.
@@ -662,6 +685,7 @@ namespace WindowManager {
 						abBareSolPhi( IGlass, IPhi ) = max( 0.0, 1.0 - ( tBareSolPhi( IGlass, IPhi ) + rbBareSolPhi( IGlass, IPhi ) ) );
 					}
 				}
+				if ( OpticsCached ) continue;
 
 				// For each wavelength in the solar spectrum, calculate system properties
 				// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence.
@@ -695,6 +719,7 @@ namespace WindowManager {
 				VisibleSprectrumAverage( srbPhi, rbvisPhi( IPhi ) );
 
 			} // End of loop over incidence angles for front calculation
+			if ( GlazingOpticsCache.Active && ! OpticsCached ) SaveGlazingOpticsToCache( OpticsKey, 1, NGlass );
 
 			//  only used by between-glass shades or blinds
 			if ( AllGlassIsSpectralAverage ) {
@@ -794,11 +819,18 @@ namespace WindowManager {
 				}
 			} // End of loop over glass layers in the construction for back calculation
 
+			OpticsCached = false;
+			if ( GlazingOpticsCache.Active ) {
+				OpticsKey = GlazingOpticsCacheKey( 2, NGlass, lquasi, lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+				OpticsCached = RestoreGlazingOpticsFromCache( OpticsKey, 2, NGlass );
+			}
+
 			// Loop over incidence angle from 0 to 90 deg in 10 deg increments.
 			// Get bare glass layer properties, then glazing system properties at each incidence angle.
 			// The glazing system properties include the effect of inter-reflection among glass layers,
 			// but exclude the effect of a shade or blind if present in the construction.
 			for ( IPhi = 1; IPhi <= 10; ++IPhi ) {
+				if ( OpticsCached ) break;
 				Phi = double( IPhi - 1 ) * 10.0;
 				CosPhi = std::cos( Phi * DegToRadians );
 				if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
@@ -827,6 +859,7 @@ namespace WindowManager {
 				}
 
 			} // End of loop over incidence angles for back calculation
+			if ( GlazingOpticsCache.Active && ! OpticsCached ) SaveGlazingOpticsToCache( OpticsKey, 2, NGlass );
 
 			for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
 				IGlassBack = NGlass - IGlass + 1;
@@ -1296,6 +1329,12 @@ namespace WindowManager {
 
 		} // End of loop over constructions
 
+		if ( GlazingOpticsCache.Active ) {
+			ShowMessage( "InitGlassOpticalCalculations: " + TrimSigDigits( GlazingOpticsCache.NumHits ) + " glazing system calculations were taken from cache file \"" + GlazingOpticsCache.FileName + "\", " + TrimSigDigits( GlazingOpticsCache.NumMisses ) + " were done." );
+			GlazingOpticsCache.File.close();
+			GlazingOpticsCache.Active = false;
+		}
+
 		// Get effective glass and shade/blind emissivities for windows that have interior blind or
 		// shade. These are used to calculate zone MRT contribution from window when
 		// interior blind/shade is deployed.
@@ -1585,6 +1624,275 @@ namespace WindowManager {
 
 	}
 
+	void
+	InitGlazingOpticsCache( std::string const & FileName ) // Cache file name, empty for no cache
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the glazing system optics cache file and indexes the records it already holds.
+
+		// METHODOLOGY EMPLOYED:
+		// Same layout as the CTF cache: a signature, then appended records of the key hash, the
+		// key and value counts, the full key and the values.
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		GlazingOpticsCache.Active = false;
+		GlazingOpticsCache.Index.clear();
+		GlazingOpticsCache.NumHits = 0;
+		GlazingOpticsCache.NumMisses = 0;
+		if ( GlazingOpticsCache.File.is_open() ) GlazingOpticsCache.File.close();
+		if ( FileName.empty() ) return;
+
+		GlazingOpticsCache.FileName = FileName;
+
+		// Try the existing file first
+		auto & File( GlazingOpticsCache.File );
+		bool Valid( false );
+		File.open( FileName, std::ios::in | std::ios::out | std::ios::binary );
+		if ( File.is_open() ) {
+			File.seekg( 0, std::ios::end );
+			std::streamoff const FileSize( File.tellg() );
+			File.seekg( 0 );
+			char Magic[ 8 ];
+			File.read( Magic, 8 );
+			Valid = File.good() && ( std::string( Magic, 8 ) == GlazingOpticsCacheMagic );
+			while ( Valid ) { // Index the records
+				std::streamoff const Offset( File.tellg() );
+				std::uint64_t Hash( 0u );
+				int Head[ 2 ]; // Number of key entries and values
+				File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+				if ( File.gcount() == 0 && File.eof() ) break; // End of file
+				File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+				if ( ! File.good() || Head[ 0 ] < 0 || Head[ 1 ] < 0 ) {
+					Valid = false; // Truncated record
+					break;
+				}
+				std::streamoff const Skip( std::streamoff( Head[ 0 ] + Head[ 1 ] ) * sizeof( Real64 ) );
+				if ( File.tellg() + Skip > FileSize ) {
+					Valid = false; // Truncated record
+					break;
+				}
+				File.seekg( Skip, std::ios::cur );
+				GlazingOpticsCache.Index[ Hash ] = Offset;
+			}
+			File.clear();
+			if ( ! Valid ) File.close();
+		}
+
+		if ( ! Valid ) { // Start a new file
+			GlazingOpticsCache.Index.clear();
+			File.open( FileName, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc );
+			if ( ! File.is_open() ) {
+				ShowWarningError( "InitGlazingOpticsCache: Could not open glazing optics cache file \"" + FileName + "\"; glazing system properties are calculated without the cache." );
+				return;
+			}
+			File.write( GlazingOpticsCacheMagic.c_str(), 8 );
+			File.flush();
+		}
+
+		GlazingOpticsCache.Active = File.good();
+		if ( GlazingOpticsCache.Active ) {
+			ShowMessage( "InitGlazingOpticsCache: Using glazing optics cache file \"" + FileName + "\" with " + TrimSigDigits( int( GlazingOpticsCache.Index.size() ) ) + " cached glazing systems." );
+		}
+
+	}
+
+	std::vector< Real64 >
+	GlazingOpticsCacheKey(
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass, // Number of glass layers
+		bool const lquasi, // True if one or more glass layers have no spectral data
+		bool const SimpleGlazingSystem, // True if using the simple glazing system block model
+		Real64 const SimpleGlazingSHGC, // SHGC of the simple glazing system
+		Real64 const SimpleGlazingU // U-factor of the simple glazing system
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the cache key of a bare glazing system calculation: everything the incidence
+		// angle loop of InitGlassOpticalCalculations reads, i.e. the glass layer properties at
+		// normal incidence as loaded into numpt, wlt, t, rff and rbb, and the spectra.
+
+		std::vector< Real64 > Key;
+		Key.reserve( 8 + 2 * ( nume + numt3 ) + 4 * NGlass * MaxSpectralDataElements );
+		Key.push_back( Side );
+		Key.push_back( NGlass );
+		Key.push_back( lquasi ? 1.0 : 0.0 );
+		Key.push_back( SimpleGlazingSystem ? 1.0 : 0.0 );
+		Key.push_back( SimpleGlazingSystem ? SimpleGlazingSHGC : 0.0 );
+		Key.push_back( SimpleGlazingSystem ? SimpleGlazingU : 0.0 );
+		Key.push_back( nume );
+		Key.push_back( numt3 );
+		Key.insert( Key.end(), wle.data(), wle.data() + wle.size() );
+		Key.insert( Key.end(), e.data(), e.data() + e.size() );
+		Key.insert( Key.end(), wlt3.data(), wlt3.data() + wlt3.size() );
+		Key.insert( Key.end(), y30.data(), y30.data() + y30.size() );
+		for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+			Key.push_back( numpt( IGlass ) );
+			for ( int ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
+				if ( numpt( IGlass ) > 2 ) Key.push_back( wlt( IGlass, ILam ) ); // Wavelengths are used only with spectral data
+				Key.push_back( t( IGlass, ILam ) );
+				Key.push_back( rff( IGlass, ILam ) );
+				Key.push_back( rbb( IGlass, ILam ) );
+			}
+		}
+		return Key;
+
+	}
+
+	std::uint64_t
+	GlazingOpticsCacheHash( std::vector< Real64 > const & Key ) // Cache key
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the 64 bit FNV-1a hash of a cache key.
+
+		std::uint64_t Hash( 14695981039346656037ull ); // FNV offset basis
+		unsigned char const * Bytes( reinterpret_cast< unsigned char const * >( Key.data() ) );
+		for ( std::size_t i = 0, n = Key.size() * sizeof( Real64 ); i < n; ++i ) {
+			Hash ^= Bytes[ i ];
+			Hash *= 1099511628211ull; // FNV prime
+		}
+		return Hash;
+
+	}
+
+	int
+	GlazingOpticsCacheValues(
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass // Number of glass layers
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the number of values of a cache record: for the front calculation the system
+		// solar and visible transmittance and reflectances and the layer absorptances at the ten
+		// incidence angles, for the back calculation the layer back absorptances.
+
+		return ( Side == 1 ? 60 : 0 ) + 10 * NGlass;
+
+	}
+
+	bool
+	RestoreGlazingOpticsFromCache(
+		std::vector< Real64 > const & Key, // Cache key of the glazing system
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass // Number of glass layers
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sets the angular glazing system properties of the front (tsolPhi, rfsolPhi, rbsolPhi,
+		// tvisPhi, rfvisPhi, rbvisPhi and solabsPhi) or back (solabsBackPhi) calculation from the
+		// cache file, as the incidence angle loop leaves them.  Returns false if the key is not
+		// cached (or the record cannot be read).
+
+		// METHODOLOGY EMPLOYED:
+		// The stored key must match the whole key, not just its hash.
+
+		auto const Found( GlazingOpticsCache.Index.find( GlazingOpticsCacheHash( Key ) ) );
+		if ( Found == GlazingOpticsCache.Index.end() ) return false;
+
+		auto & File( GlazingOpticsCache.File );
+		File.clear();
+		File.seekg( Found->second );
+		std::uint64_t Hash( 0u );
+		int Head[ 2 ];
+		File.read( reinterpret_cast< char * >( &Hash ), sizeof( Hash ) );
+		File.read( reinterpret_cast< char * >( Head ), sizeof( Head ) );
+		if ( ! File.good() || Head[ 0 ] != int( Key.size() ) || Head[ 1 ] != GlazingOpticsCacheValues( Side, NGlass ) ) {
+			File.clear();
+			return false;
+		}
+		std::vector< Real64 > StoredKey( Key.size() );
+		std::vector< Real64 > Values( Head[ 1 ] );
+		File.read( reinterpret_cast< char * >( StoredKey.data() ), StoredKey.size() * sizeof( Real64 ) );
+		if ( ! File.good() || StoredKey != Key ) {
+			File.clear();
+			return false;
+		}
+		File.read( reinterpret_cast< char * >( Values.data() ), Values.size() * sizeof( Real64 ) );
+		if ( ! File.good() ) {
+			File.clear();
+			GlazingOpticsCache.Index.erase( Found );
+			return false;
+		}
+
+		Real64 const * Value( Values.data() );
+		for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+			if ( Side == 1 ) {
+				tsolPhi( IPhi ) = *Value++;
+				rfsolPhi( IPhi ) = *Value++;
+				rbsolPhi( IPhi ) = *Value++;
+				tvisPhi( IPhi ) = *Value++;
+				rfvisPhi( IPhi ) = *Value++;
+				rbvisPhi( IPhi ) = *Value++;
+			}
+			for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+				if ( Side == 1 ) {
+					solabsPhi( IGlass, IPhi ) = *Value++;
+				} else {
+					solabsBackPhi( IGlass, IPhi ) = *Value++;
+				}
+			}
+		}
+		++GlazingOpticsCache.NumHits;
+		return true;
+
+	}
+
+	void
+	SaveGlazingOpticsToCache(
+		std::vector< Real64 > const & Key, // Cache key of the glazing system
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass // Number of glass layers
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the angular glazing system properties of the front or back calculation to the
+		// cache file, in RestoreGlazingOpticsFromCache order.
+
+		std::uint64_t const Hash( GlazingOpticsCacheHash( Key ) );
+		if ( GlazingOpticsCache.Index.find( Hash ) != GlazingOpticsCache.Index.end() ) return;
+		int const Head[ 2 ] = { int( Key.size() ), GlazingOpticsCacheValues( Side, NGlass ) };
+		std::vector< Real64 > Values;
+		Values.reserve( Head[ 1 ] );
+		for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+			if ( Side == 1 ) {
+				Values.push_back( tsolPhi( IPhi ) );
+				Values.push_back( rfsolPhi( IPhi ) );
+				Values.push_back( rbsolPhi( IPhi ) );
+				Values.push_back( tvisPhi( IPhi ) );
+				Values.push_back( rfvisPhi( IPhi ) );
+				Values.push_back( rbvisPhi( IPhi ) );
+			}
+			for ( int IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+				Values.push_back( Side == 1 ? solabsPhi( IGlass, IPhi ) : solabsBackPhi( IGlass, IPhi ) );
+			}
+		}
+
+		auto & File( GlazingOpticsCache.File );
+		File.clear();
+		File.seekp( 0, std::ios::end );
+		std::streamoff const Offset( File.tellp() );
+		File.write( reinterpret_cast< char const * >( &Hash ), sizeof( Hash ) );
+		File.write( reinterpret_cast< char const * >( Head ), sizeof( Head ) );
+		File.write( reinterpret_cast< char const * >( Key.data() ), Key.size() * sizeof( Real64 ) );
+		File.write( reinterpret_cast< char const * >( Values.data() ), Values.size() * sizeof( Real64 ) );
+		File.flush();
+		if ( File.good() ) {
+			GlazingOpticsCache.Index[ Hash ] = Offset;
+			++GlazingOpticsCache.NumMisses;
+		} else {
+			ShowWarningError( "SaveGlazingOpticsToCache: Could not write glazing optics cache file \"" + GlazingOpticsCache.FileName + "\"; remaining glazing systems are calculated without the cache." );
+			GlazingOpticsCache.Active = false;
+		}
+
+	}
+
 	//****************************************************************************
 	// WINDOW 5 Optical Calculation Subroutines
 	//****************************************************************************
@@ -2384,6 +2692,7 @@ namespace WindowManager {
 							gcp( ICoeff, IMix, IGap ) = Material( LayPtr ).GasCp( ICoeff, IMix );
 						}
 					}
+					SetGapGasMixFactors( IGap );
 				}
 
 			} // End of loop over glass, gap and blind/shade layers in a window construction
@@ -2404,6 +2713,7 @@ namespace WindowManager {
 					gvis( ICoeff, 1, IGap ) = GasCoeffsVis( ICoeff, 1 );
 					gcp( ICoeff, 1, IGap ) = GasCoeffsCp( ICoeff, 1 );
 				}
+				SetGapGasMixFactors( IGap );
 			}
 
 			// Exterior convection coefficient, exterior air temperature and IR radiance
@@ -2772,6 +3082,8 @@ namespace WindowManager {
 		using Psychrometrics::PsyTdbFnHW;
 		using InputProcessor::SameString;
 		using ConvectionCoefficients::CalcISO15099WindowIntConvCoeff;
+		using DataSystemVariables::WindowHeatBalanceReuse;
+		using DataSystemVariables::WindowHeatBalanceBatch;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2921,6 +3233,40 @@ namespace WindowManager {
 
 		errtemp = errtemptol * 2.0;
 
+		// Inside film coefficient depends on the face temperatures with the detailed model not prescribed by the user
+		bool const IntConvFromFaceTemps( ( ( Surface( SurfNum ).IntConvCoeff == 0 ) && ( Zone( ZoneNum ).InsideConvectionAlgo == ASHRAETARP ) ) || ( Surface( SurfNum ).IntConvCoeff == -2 ) );
+
+		// An unshaded window without airflow takes its last solution again while its boundary conditions barely change
+		bool const SolutionReusable( WindowHeatBalanceReuse && ShadeFlag <= 0 && SurfaceWindow( SurfNum ).AirflowThisTS == 0.0 );
+		bool SolutionReused( false );
+		Real64 const hcinIn( hcin ); // Inside convection coefficient before the solution (W/m2-K)
+		ConstrNum = Surface( SurfNum ).Construction;
+		if ( SurfaceWindow( SurfNum ).StormWinFlag == 1 ) ConstrNum = Surface( SurfNum ).StormWinConstruction;
+		if ( SolutionReusable ) {
+			SolutionReused = ReuseWindowHeatBalanceSolution( SurfNum, ConstrNum );
+			if ( SolutionReused ) {
+				if ( IntConvFromFaceTemps ) HConvIn( SurfNum ) = hcin;
+				TAirflowGapOutlet = 0.0;
+				SurfaceWindow( SurfNum ).WindowCalcIterationsRep = 0;
+				errtemp = 0.0; // No iterations
+			}
+		}
+
+		// Windows of a construction whose solver inputs are all identical share one solution
+		bool const SolutionShareable( WindowHeatBalanceBatch && ShadeFlag <= 0 && SurfaceWindow( SurfNum ).AirflowThisTS == 0.0 );
+		bool SolutionShared( false );
+		static std::vector< Real64 > BatchKey; // Solver inputs of the window //Tuned Made static
+		if ( SolutionShareable && ! SolutionReused ) {
+			FormWindowBatchKey( SurfNum, IntConvFromFaceTemps, BatchKey );
+			int Iterations( 0 );
+			SolutionShared = FindWindowBatchSolution( ConstrNum, BatchKey, Iterations, errtemp );
+			if ( SolutionShared ) {
+				if ( IntConvFromFaceTemps ) HConvIn( SurfNum ) = hcin;
+				TAirflowGapOutlet = 0.0;
+				SurfaceWindow( SurfNum ).WindowCalcIterationsRep = Iterations;
+			}
+		}
+
 		while ( iter < MaxIterations && errtemp > errtemptol ) {
 
 			for ( i = 1; i <= nglfacep; ++i ) {
@@ -2932,7 +3278,7 @@ namespace WindowManager {
 			}
 
 			// call for new interior film coeff (since it is temperature dependent) if using Detailed inside coef model
-			if ( ( ( Surface( SurfNum ).IntConvCoeff == 0 ) && ( Zone( ZoneNum ).InsideConvectionAlgo == ASHRAETARP ) ) || ( Surface( SurfNum ).IntConvCoeff == -2 ) ) {
+			if ( IntConvFromFaceTemps ) {
 				// coef model is "detailed" and not prescribed by user
 				//need to find inside face index, varies with shade/blind etc.
 				if ( ShadeFlag == IntShadeOn || ShadeFlag == IntBlindOn ) {
@@ -3360,6 +3706,9 @@ namespace WindowManager {
 
 		}
 
+		if ( SolutionReusable && ! SolutionReused && errtemp <= errtemptol ) SaveWindowHeatBalanceSolution( SurfNum, ConstrNum, hcinIn );
+		if ( SolutionShareable && ! SolutionReused && ! SolutionShared && errtemp <= errtemptol ) AddWindowBatchSolution( ConstrNum, BatchKey, iter, errtemp );
+
 		// We have reached iteration limit or we have converged. If we have reached the
 		// iteration limit the following test relaxes the convergence tolerance.
 		// If we have converged (errtemp <= errtemptol) the following test has not effect.
@@ -3497,6 +3846,195 @@ namespace WindowManager {
 
 	//****************************************************************************
 
+	bool
+	ReuseWindowHeatBalanceSolution(
+		int const SurfNum, // Surface number
+		int const ConstrNum // Construction of the window, with the storm window if in place
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives back the last heat balance solution of an unshaded window in thetas and hcin
+		// when none of its boundary conditions moved by more than a small tolerance since.
+
+		// METHODOLOGY EMPLOYED:
+		// The tolerances keep the face temperatures well within the convergence tolerance of
+		// SolveForWindowTemperatures.  The saved boundary conditions are those the solution was
+		// found for, so differences do not add up over the time steps the solution is reused.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const TempTol( 0.002 ); // Tolerance on the air temperatures (K)
+		Real64 const HTol( 0.001 ); // Tolerance on the convection coefficients (W/m2-K)
+		Real64 const FluxTol( 0.01 ); // Tolerance on the radiances and absorbed radiation (W/m2)
+
+		if ( ! allocated( WindowHBSolution ) ) return false;
+		auto const & solution( WindowHBSolution( SurfNum ) );
+		if ( ! solution.Valid || solution.ConstrNum != ConstrNum ) return false;
+		if ( std::abs( tout - solution.tout ) > TempTol || std::abs( tin - solution.tin ) > TempTol ) return false;
+		if ( std::abs( hcout - solution.hcout ) > HTol || std::abs( hcin - solution.hcinIn ) > HTol ) return false;
+		if ( std::abs( Outir - solution.Outir ) > FluxTol || std::abs( Rmir - solution.Rmir ) > FluxTol ) return false;
+		for ( int i = 1; i <= nglface; ++i ) {
+			if ( std::abs( AbsRadGlassFace( i ) - solution.AbsRadGlassFace( i ) ) > FluxTol ) return false;
+		}
+
+		for ( int i = 1; i <= nglface; ++i ) {
+			thetas( i ) = solution.thetas( i );
+		}
+		hcin = solution.hcin;
+		return true;
+
+	}
+
+	//****************************************************************************
+
+	void
+	SaveWindowHeatBalanceSolution(
+		int const SurfNum, // Surface number
+		int const ConstrNum, // Construction of the window, with the storm window if in place
+		Real64 const hcinIn // Inside convection coefficient before the solution (W/m2-K)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the converged heat balance solution of an unshaded window with its boundary conditions.
+
+		if ( ! allocated( WindowHBSolution ) ) WindowHBSolution.allocate( TotSurfaces );
+		auto & solution( WindowHBSolution( SurfNum ) );
+		solution.Valid = true;
+		solution.ConstrNum = ConstrNum;
+		solution.tout = tout;
+		solution.tin = tin;
+		solution.hcout = hcout;
+		solution.hcinIn = hcinIn;
+		solution.Outir = Outir;
+		solution.Rmir = Rmir;
+		for ( int i = 1; i <= nglface; ++i ) {
+			solution.AbsRadGlassFace( i ) = AbsRadGlassFace( i );
+			solution.thetas( i ) = thetas( i );
+		}
+		solution.hcin = hcin;
+
+	}
+
+	//****************************************************************************
+
+	void
+	FormWindowBatchKey(
+		int const SurfNum, // Surface number
+		bool const IntConvFromFaceTemps, // True if the inside film coefficient is found from the face temperatures
+		std::vector< Real64 > & Key // Solver inputs
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gathers everything the heat balance iterations of an unshaded window without airflow
+		// depend on besides its construction: boundary conditions, absorbed radiation, starting
+		// face temperatures and the surface geometry used by the gap and inside convection.
+
+		// METHODOLOGY EMPLOYED:
+		// Two windows of a construction with equal keys go through the same arithmetic, so
+		// either one's solution is exactly that of the other.
+
+		using DataEnvironment::OutBaroPress;
+		using DataEnvironment::OutHumRat;
+		using DataHeatBalFanSys::ZoneAirHumRatAvg;
+
+		auto const & surface( Surface( SurfNum ) );
+		Key.clear();
+		Key.push_back( tout );
+		Key.push_back( tin );
+		Key.push_back( hcout );
+		Key.push_back( hcin );
+		Key.push_back( Outir );
+		Key.push_back( Rmir );
+		Key.push_back( tilt );
+		Key.push_back( surface.Height );
+		Key.push_back( SurfaceWindow( SurfNum ).EdgeGlCorrFac );
+		Key.push_back( IntConvFromFaceTemps ? 1.0 : 0.0 );
+		if ( IntConvFromFaceTemps ) { // Inputs of CalcISO15099WindowIntConvCoeff
+			Key.push_back( surface.Zone > 0 ? ZoneAirHumRatAvg( surface.Zone ) : OutHumRat );
+			Key.push_back( OutBaroPress );
+			Key.push_back( surface.Tilt );
+			Key.push_back( surface.SinTilt );
+			Key.push_back( surface.EMSOverrideIntConvCoef ? 1.0 : 0.0 );
+			Key.push_back( surface.EMSValueForIntConvCoef );
+		}
+		for ( int i = 1; i <= nglface; ++i ) {
+			Key.push_back( AbsRadGlassFace( i ) );
+			Key.push_back( thetas( i ) );
+		}
+
+	}
+
+	//****************************************************************************
+
+	bool
+	FindWindowBatchSolution(
+		int const ConstrNum, // Construction of the window, with the storm window if in place
+		std::vector< Real64 > const & Key, // Solver inputs of the window
+		int & Iterations, // Number of iterations of the solution
+		Real64 & ErrTemp // Final face temperature change of the iterations (K)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the solution of a window of the construction solved with the same inputs, in
+		// thetas and hcin, if there is one among the latest solutions kept.
+
+		if ( ! allocated( WindowBatch ) ) return false;
+		for ( auto const & solution : WindowBatch( ConstrNum ).Solutions ) {
+			if ( solution.Key != Key ) continue;
+			for ( int i = 1; i <= nglface; ++i ) {
+				thetas( i ) = solution.thetas[ i - 1 ];
+			}
+			hcin = solution.hcin;
+			Iterations = solution.Iterations;
+			ErrTemp = solution.errtemp;
+			return true;
+		}
+		return false;
+
+	}
+
+	//****************************************************************************
+
+	void
+	AddWindowBatchSolution(
+		int const ConstrNum, // Construction of the window, with the storm window if in place
+		std::vector< Real64 > const & Key, // Solver inputs of the window
+		int const Iterations, // Number of iterations of the solution
+		Real64 const ErrTemp // Final face temperature change of the iterations (K)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps the solution in thetas and hcin for the other windows of the construction,
+		// in place of the oldest one once the construction has MaxBatchSolutions.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MaxBatchSolutions( 8 ); // Solutions kept for each construction
+
+		if ( ! allocated( WindowBatch ) ) WindowBatch.allocate( TotConstructs );
+		auto & batch( WindowBatch( ConstrNum ) );
+		if ( int( batch.Solutions.size() ) < MaxBatchSolutions ) {
+			batch.Solutions.push_back( WindowBatchSolutionType() );
+			batch.Next = int( batch.Solutions.size() ) - 1;
+		}
+		auto & solution( batch.Solutions[ batch.Next ] );
+		solution.Key = Key;
+		solution.thetas.clear();
+		for ( int i = 1; i <= nglface; ++i ) {
+			solution.thetas.push_back( thetas( i ) );
+		}
+		solution.hcin = hcin;
+		solution.errtemp = ErrTemp;
+		solution.Iterations = Iterations;
+		batch.Next = ( batch.Next + 1 ) % MaxBatchSolutions;
+
+	}
+
+	//****************************************************************************
+
 	void
 	ExtOrIntShadeNaturalFlow(
 		int const SurfNum, // Surface number
@@ -4380,6 +4918,41 @@ namespace WindowManager {
 
 	//******************************************************************************
 
+	void
+	SetGapGasMixFactors( int const IGap ) // Gap number
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the factors of the gas mixture equations of WindowGasConductance that depend
+		// only on the molecular weights of the gases in a gap, once the gap has been filled,
+		// so that they are not found again for each temperature the properties are needed at.
+
+		// METHODOLOGY EMPLOYED:
+		// The expressions are those of WindowGasConductance, so the gas properties are unchanged.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
+		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
+
+		int const NMix( gnmix( IGap ) ); // Number of gases in the mixture
+		if ( NMix <= 1 ) return;
+
+		gmixkpfac( 1, IGap ) = 3.75 * ( gaslaw / gwght( 1, IGap ) );
+		for ( int i = 2; i <= NMix; ++i ) {
+			gmixkpfac( i, IGap ) = 3.75 * gaslaw / gwght( i, IGap );
+		}
+		for ( int i = 1; i <= NMix; ++i ) {
+			for ( int j = 1; j <= NMix; ++j ) {
+				gmixroot4( i, j, IGap ) = root_4( gwght( i, IGap ) / gwght( j, IGap ) );
+				gmixdowner( i, j, IGap ) = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+				gmixpsiterm( i, j, IGap ) = 1.0 + 2.41 * ( gwght( i, IGap ) - gwght( j, IGap ) ) * ( gwght( i, IGap ) - 0.142 * gwght( j, IGap ) ) / pow_2( gwght( i, IGap ) + gwght( j, IGap ) );
+			}
+		}
+
+	}
+
+	//******************************************************************************
+
 	void
 	WindowGasConductance(
 		Real64 const tleft, // Temperature of gap surface closest to outside (K)
@@ -4418,7 +4991,6 @@ namespace WindowManager {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const pres( 1.0e5 ); // Gap gas pressure (Pa)
 		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
-		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -4482,7 +5054,7 @@ namespace WindowManager {
 		} else if ( NMix > 1 ) { // Multiple gases; calculate mixture properties
 			molmix = frct( 1 ) * gwght( 1, IGap ); // initialize eq. 56
 			cpmixm = molmix * fcp( 1 ); // initialize eq. 58
-			kprime( 1 ) = 3.75 * ( gaslaw / gwght( 1, IGap ) ) * fvis( 1 ); // eq. 67
+			kprime( 1 ) = gmixkpfac( 1, IGap ) * fvis( 1 ); // eq. 67
 			kdblprm( 1 ) = fcon( 1 ) - kprime( 1 ); // eq. 67
 
 			// Initialize summations for eqns 60-66
@@ -4501,7 +5073,7 @@ namespace WindowManager {
 				fdens( i ) = pres * gwght( i, IGap ) / ( gaslaw * tmean );
 				molmix += frct( i ) * gwght( i, IGap ); // eq. 56
 				cpmixm += frct( i ) * fcp( i ) * gwght( i, IGap ); // eq. 58-59
-				kprime( i ) = 3.75 * gaslaw / gwght( i, IGap ) * fvis( i ); // eq. 67
+				kprime( i ) = gmixkpfac( i, IGap ) * fvis( i ); // eq. 67
 				kdblprm( i ) = fcon( i ) - kprime( i ); // eq. 68
 				mukpdwn( i ) = 1.0; // initialize denomonator of eq. 60
 				kpdown( i ) = 1.0; // initialize denomonator of eq. 63
@@ -4511,18 +5083,18 @@ namespace WindowManager {
 			for ( i = 1; i <= NMix; ++i ) {
 				for ( j = 1; j <= NMix; ++j ) {
 					// numerator of equation 61
-					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * root_4( gwght( j, IGap ) / gwght( i, IGap ) ) );
+					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * gmixroot4( j, i, IGap ) );
 					// denomonator of eq. 61, 64 and 66
-					downer = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					downer = gmixdowner( i, j, IGap );
 					// calculate the denominator of eq. 60
 					if ( i != j ) mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
 					// numerator of eq. 64; psiterm is the multiplied term in backets
-					psiup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * root_4( gwght( i, IGap ) / gwght( j, IGap ) ) );
-					psiterm = 1.0 + 2.41 * ( gwght( i, IGap ) - gwght( j, IGap ) ) * ( gwght( i, IGap ) - 0.142 * gwght( j, IGap ) ) / pow_2( gwght( i, IGap ) + gwght( j, IGap ) );
+					psiup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * gmixroot4( i, j, IGap ) );
+					psiterm = gmixpsiterm( i, j, IGap );
 					// using the common denominator, downer, calculate the denominator for eq. 63
 					if ( i != j ) kpdown( i ) += psiup * ( psiterm / downer ) * ( frct( j ) / frct( i ) );
-					// calculate the numerator of eq. 66
-					phikup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * root_4( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					// the numerator of eq. 66 is the same as that of eq. 64
+					phikup = psiup;
 					// using the common denominator, downer, calculate the denomonator for eq. 65
 					if ( i != j ) kdpdown( i ) += ( phikup / downer ) * ( frct( j ) / frct( i ) );
 				}
@@ -4587,7 +5159,6 @@ namespace WindowManager {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const pres( 1.0e5 ); // Gap gas pressure (Pa)
 		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
-		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -4641,9 +5212,9 @@ namespace WindowManager {
 			for ( i = 1; i <= NMix; ++i ) {
 				for ( j = 1; j <= NMix; ++j ) {
 					// numerator of equation 61
-					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * root_4( gwght( j, IGap ) / gwght( i, IGap ) ) );
+					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * gmixroot4( j, i, IGap ) );
 					// denomonator of eq. 61, 64 and 66
-					downer = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					downer = gmixdowner( i, j, IGap );
 					// calculate the denominator of eq. 60
 					if ( i != j ) mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
 				}
@@ -6603,6 +7174,7 @@ namespace WindowManager {
 						gcp( ICoeff, IMix, IGap ) = Material( LayPtr ).GasCp( ICoeff, IMix );
 					}
 				}
+				SetGapGasMixFactors( IGap );
 			}
 		}
 
@@ -1,8 +1,16 @@
 #ifndef WindowManager_hh_INCLUDED
 #define WindowManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2A.hh>
 #include <ObjexxFCL/Array3D.hh>
 
@@ -60,6 +68,10 @@ namespace WindowManager {
 	extern Array2D< Real64 > gwght; // Gas molecular weights for each gap
 	extern Array2D< Real64 > gfract; // Gas fractions for each gap
 	extern Array1D_int gnmix; // Number of gases in gap
+	extern Array3D< Real64 > gmixroot4; // root_4( gwght(i)/gwght(j) ) for gases i and j of each gap
+	extern Array3D< Real64 > gmixdowner; // Denominator factor of eqs. 61, 64 and 66 for gases i and j of each gap
+	extern Array3D< Real64 > gmixpsiterm; // Bracketed factor of eq. 64 for gases i and j of each gap
+	extern Array2D< Real64 > gmixkpfac; // Factor of the viscosity in eq. 67 for each gas of each gap
 	extern Array1D< Real64 > gap; // Gap width (m)
 	extern Array1D< Real64 > thick; // Glass layer thickness (m)
 	extern Array1D< Real64 > scon; // Glass layer conductance--conductivity/thickness (W/m2-K)
@@ -137,6 +149,107 @@ namespace WindowManager {
 	extern Array1D< Real64 > rbvisPhi; // Glazing system visible back reflectance for each angle of incidence
 	extern Array1D< Real64 > CosPhiIndepVar; // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Types
+
+	struct WindowHeatBalanceSolutionType
+	{
+		// Last converged heat balance solution of an unshaded window without airflow and the
+		// boundary conditions it was found for (WindowHeatBalanceReuse only)
+
+		// Members
+		bool Valid; // True once a solution has been saved
+		int ConstrNum; // Construction the solution was found for
+		Real64 tout; // Outside air temperature (K)
+		Real64 tin; // Inside air temperature (K)
+		Real64 hcout; // Outside convection coefficient (W/m2-K)
+		Real64 hcinIn; // Inside convection coefficient before the solution (W/m2-K)
+		Real64 Outir; // IR radiance of the exterior surround (W/m2)
+		Real64 Rmir; // IR radiance of the interior surround (W/m2)
+		Array1D< Real64 > AbsRadGlassFace; // Radiation absorbed by each glass face (W/m2)
+		Array1D< Real64 > thetas; // Glass face temperatures of the solution (K)
+		Real64 hcin; // Inside convection coefficient of the solution (W/m2-K)
+
+		// Default Constructor
+		WindowHeatBalanceSolutionType() :
+			Valid( false ),
+			ConstrNum( 0 ),
+			tout( 0.0 ),
+			tin( 0.0 ),
+			hcout( 0.0 ),
+			hcinIn( 0.0 ),
+			Outir( 0.0 ),
+			Rmir( 0.0 ),
+			AbsRadGlassFace( 10, 0.0 ),
+			thetas( 10, 0.0 ),
+			hcin( 0.0 )
+		{}
+
+	};
+
+	struct WindowBatchSolutionType
+	{
+		// Heat balance solution of an unshaded window without airflow with everything it was
+		// found from (WindowHeatBalanceBatch only)
+
+		// Members
+		std::vector< Real64 > Key; // Solver inputs, see FormWindowBatchKey
+		std::vector< Real64 > thetas; // Glass face temperatures of the solution (K)
+		Real64 hcin; // Inside convection coefficient of the solution (W/m2-K)
+		Real64 errtemp; // Final face temperature change of the iterations (K)
+		int Iterations; // Number of iterations of the solution
+
+		// Default Constructor
+		WindowBatchSolutionType() :
+			hcin( 0.0 ),
+			errtemp( 0.0 ),
+			Iterations( 0 )
+		{}
+
+	};
+
+	struct WindowBatchType
+	{
+		// Latest solutions of the windows of a construction (WindowHeatBalanceBatch only)
+
+		// Members
+		std::vector< WindowBatchSolutionType > Solutions;
+		int Next; // Solution replaced by the next one added (0 based)
+
+		// Default Constructor
+		WindowBatchType() :
+			Next( 0 )
+		{}
+
+	};
+
+	struct GlazingOpticsCacheData
+	{
+		// On-disk cache of the spectral integration of the bare glazing systems, keyed by the
+		// glass layer properties and the solar and photopic spectra, so later runs with the same
+		// glazing library skip it
+
+		// Members
+		bool Active; // True when glazing system properties are read from and written to the cache file
+		std::string FileName; // Cache file name
+		std::fstream File; // Cache file, records are appended as they are computed
+		std::map< std::uint64_t, std::streamoff > Index; // Record offset of each cached key hash
+		int NumHits; // Number of glazing system calculations taken from the cache
+		int NumMisses; // Number of glazing system calculations done and added to the cache
+
+		// Default Constructor
+		GlazingOpticsCacheData() :
+			Active( false ),
+			NumHits( 0 ),
+			NumMisses( 0 )
+		{}
+
+	};
+
+	// Object Data
+	extern Array1D< WindowHeatBalanceSolutionType > WindowHBSolution; // Last heat balance solution of each window surface
+	extern Array1D< WindowBatchType > WindowBatch; // Latest window solutions of each construction
+	extern GlazingOpticsCacheData GlazingOpticsCache;
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -151,6 +264,42 @@ namespace WindowManager {
 	void
 	W5InitGlassParameters();
 
+	void
+	InitGlazingOpticsCache( std::string const & FileName ); // Cache file name, empty for no cache
+
+	std::vector< Real64 >
+	GlazingOpticsCacheKey(
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass, // Number of glass layers
+		bool const lquasi, // True if one or more glass layers have no spectral data
+		bool const SimpleGlazingSystem, // True if using the simple glazing system block model
+		Real64 const SimpleGlazingSHGC, // SHGC of the simple glazing system
+		Real64 const SimpleGlazingU // U-factor of the simple glazing system
+	);
+
+	std::uint64_t
+	GlazingOpticsCacheHash( std::vector< Real64 > const & Key ); // Cache key
+
+	int
+	GlazingOpticsCacheValues(
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass // Number of glass layers
+	);
+
+	bool
+	RestoreGlazingOpticsFromCache(
+		std::vector< Real64 > const & Key, // Cache key of the glazing system
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass // Number of glass layers
+	);
+
+	void
+	SaveGlazingOpticsToCache(
+		std::vector< Real64 > const & Key, // Cache key of the glazing system
+		int const Side, // 1 for the front calculation, 2 for the back calculation
+		int const NGlass // Number of glass layers
+	);
+
 	//****************************************************************************
 	// WINDOW 5 Optical Calculation Subroutines
 	//****************************************************************************
@@ -225,6 +374,52 @@ namespace WindowManager {
 
 	//****************************************************************************
 
+	bool
+	ReuseWindowHeatBalanceSolution(
+		int const SurfNum, // Surface number
+		int const ConstrNum // Construction of the window, with the storm window if in place
+	);
+
+	//****************************************************************************
+
+	void
+	SaveWindowHeatBalanceSolution(
+		int const SurfNum, // Surface number
+		int const ConstrNum, // Construction of the window, with the storm window if in place
+		Real64 const hcinIn // Inside convection coefficient before the solution (W/m2-K)
+	);
+
+	//****************************************************************************
+
+	void
+	FormWindowBatchKey(
+		int const SurfNum, // Surface number
+		bool const IntConvFromFaceTemps, // True if the inside film coefficient is found from the face temperatures
+		std::vector< Real64 > & Key // Solver inputs
+	);
+
+	//****************************************************************************
+
+	bool
+	FindWindowBatchSolution(
+		int const ConstrNum, // Construction of the window, with the storm window if in place
+		std::vector< Real64 > const & Key, // Solver inputs of the window
+		int & Iterations, // Number of iterations of the solution
+		Real64 & ErrTemp // Final face temperature change of the iterations (K)
+	);
+
+	//****************************************************************************
+
+	void
+	AddWindowBatchSolution(
+		int const ConstrNum, // Construction of the window, with the storm window if in place
+		std::vector< Real64 > const & Key, // Solver inputs of the window
+		int const Iterations, // Number of iterations of the solution
+		Real64 const ErrTemp // Final face temperature change of the iterations (K)
+	);
+
+	//****************************************************************************
+
 	void
 	ExtOrIntShadeNaturalFlow(
 		int const SurfNum, // Surface number
@@ -295,6 +490,11 @@ namespace WindowManager {
 
 	//******************************************************************************
 
+	void
+	SetGapGasMixFactors( int const IGap ); // Gap number
+
+	//******************************************************************************
+
 	void
 	WindowGasConductance(
 		Real64 const tleft, // Temperature of gap surface closest to outside (K)
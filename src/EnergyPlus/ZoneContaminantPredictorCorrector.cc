@@ -1478,9 +1478,26 @@ namespace ZoneContaminantPredictorCorrector {
 		Real64 ZoneAirGCSetPoint; // Zone generic contaminant setpoint
 		Real64 GCGain; // Zone generic contaminant internal load
 		//  REAL(r64) :: Temp                      ! Zone generic contaminant internal load
+		static Array1D_int ControllingContZoneNum; // First available contaminant controller of each zone, 0 if none
 
 		// FLOW:
 
+		// Find the controller of each zone once: the first available controller, in input order, whose
+		// controlled zone or zone list holds the zone, as the search over all controllers for each zone found
+		if ( ! allocated( ControllingContZoneNum ) || isize( ControllingContZoneNum ) != NumOfZones ) ControllingContZoneNum.dimension( NumOfZones, 0 );
+		ControllingContZoneNum = 0;
+		for ( ContControlledZoneNum = 1; ContControlledZoneNum <= NumContControlledZones; ++ContControlledZoneNum ) {
+			auto const & ContZone( ContaminantControlledZone( ContControlledZoneNum ) );
+			if ( ContZone.NumOfZones < 1 ) continue;
+			if ( GetCurrentScheduleValue( ContZone.AvaiSchedPtr ) <= 0.0 ) continue;
+			ZoneNum = ContZone.ActualZoneNum;
+			if ( ZoneNum >= 1 && ZoneNum <= NumOfZones && ControllingContZoneNum( ZoneNum ) == 0 ) ControllingContZoneNum( ZoneNum ) = ContControlledZoneNum;
+			for ( I = 1; I <= ContZone.NumOfZones; ++I ) {
+				ZoneNum = ContZone.ControlZoneNum( I );
+				if ( ZoneNum >= 1 && ZoneNum <= NumOfZones && ControllingContZoneNum( ZoneNum ) == 0 ) ControllingContZoneNum( ZoneNum ) = ContControlledZoneNum;
+			}
+		}
+
 		// Update zone CO2
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
@@ -1565,30 +1582,14 @@ namespace ZoneContaminantPredictorCorrector {
 				ZoneSysContDemand( ZoneNum ).OutputRequiredToCO2SP = 0.0;
 
 				// Check to see if this is a "CO2 controlled zone"
-				ControlledCO2ZoneFlag = false;
-				// Check all the controlled zones to see if it matches the zone simulated
-				for ( ContControlledZoneNum = 1; ContControlledZoneNum <= NumContControlledZones; ++ContControlledZoneNum ) {
-					if ( GetCurrentScheduleValue( ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr ) > 0.0 ) {
-						ZoneAirCO2SetPoint = ZoneCO2SetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
-						if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointOn ) {
-							ZoneAirCO2SetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointValue;
-						}
-						if ( ContaminantControlledZone( ContControlledZoneNum ).NumOfZones >= 1 ) {
-							if ( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum != ZoneNum ) {
-								for ( I = 1; I <= ContaminantControlledZone( ContControlledZoneNum ).NumOfZones; ++I ) {
-									if ( ContaminantControlledZone( ContControlledZoneNum ).ControlZoneNum( I ) == ZoneNum ) {
-										ControlledCO2ZoneFlag = true;
-										break;
-									}
-								}
-								if ( ControlledCO2ZoneFlag ) break;
-							} else {
-								ControlledCO2ZoneFlag = true;
-								break;
-							}
-						}
+				ContControlledZoneNum = ControllingContZoneNum( ZoneNum );
+				ControlledCO2ZoneFlag = ( ContControlledZoneNum > 0 );
+				if ( ControlledCO2ZoneFlag ) {
+					ZoneAirCO2SetPoint = ZoneCO2SetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
+					if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointOn ) {
+						ZoneAirCO2SetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointValue;
 					}
-				} // CO2ControlledZoneNum
+				}
 
 				if ( ControlledCO2ZoneFlag ) {
 					// The density of air
@@ -1647,30 +1648,14 @@ namespace ZoneContaminantPredictorCorrector {
 				ZoneSysContDemand( ZoneNum ).OutputRequiredToGCSP = 0.0;
 
 				// Check to see if this is a "GC controlled zone"
-				ControlledGCZoneFlag = false;
-				// Check all the controlled zones to see if it matches the zone simulated
-				for ( ContControlledZoneNum = 1; ContControlledZoneNum <= NumContControlledZones; ++ContControlledZoneNum ) {
-					if ( GetCurrentScheduleValue( ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr ) > 0.0 ) {
-						ZoneAirGCSetPoint = ZoneGCSetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
-						if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointOn ) {
-							ZoneAirGCSetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointValue;
-						}
-						if ( ContaminantControlledZone( ContControlledZoneNum ).NumOfZones >= 1 ) {
-							if ( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum != ZoneNum ) {
-								for ( I = 1; I <= ContaminantControlledZone( ContControlledZoneNum ).NumOfZones; ++I ) {
-									if ( ContaminantControlledZone( ContControlledZoneNum ).ControlZoneNum( I ) == ZoneNum ) {
-										ControlledGCZoneFlag = true;
-										break;
-									}
-								}
-								if ( ControlledGCZoneFlag ) break;
-							} else {
-								ControlledGCZoneFlag = true;
-								break;
-							}
-						}
+				ContControlledZoneNum = ControllingContZoneNum( ZoneNum );
+				ControlledGCZoneFlag = ( ContControlledZoneNum > 0 );
+				if ( ControlledGCZoneFlag ) {
+					ZoneAirGCSetPoint = ZoneGCSetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
+					if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointOn ) {
+						ZoneAirGCSetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointValue;
 					}
-				} // GCControlledZoneNum
+				}
 
 				if ( ControlledGCZoneFlag ) {
 					// The density of air
@@ -22,6 +22,7 @@
 #include <DataHeatBalFanSys.hh>
 #include <DataHVACGlobals.hh>
 #include <DataLoopNode.hh>
+#include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSizing.hh>
@@ -49,6 +50,7 @@
 #include <LowTempRadiantSystem.hh>
 #include <OutdoorAirUnit.hh>
 #include <PackagedTerminalHeatPump.hh>
+#include <Profiler.hh>
 #include <Psychrometrics.hh>
 #include <PurchasedAirManager.hh>
 #include <RefrigeratedCase.hh>
@@ -131,6 +133,9 @@ namespace ZoneEquipmentManager {
 	Array1D_int DefaultSimOrder;
 	int NumOfTimeStepInDay; // number of zone time steps in a day
 	bool GetZoneEquipmentInputFlag( true );
+	bool ZoneEquipGroupsSet( false ); // True once the independent groups of controlled zones have been found
+	int NumZoneEquipGroups( 0 ); // Number of groups of controlled zones whose equipment shares nothing with other groups
+	Array1D_int ZoneEquipGroup; // Group of each controlled zone (0 if not controlled)
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE ZoneEquipmentManager
 
@@ -1693,6 +1698,51 @@ namespace ZoneEquipmentManager {
 		}
 	}
 
+	void
+	DeallocateZoneSizingSequences( Array2D< ZoneSizingData > & DesDayZoneSizing ) // ZoneSizing or CalcZoneSizing
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Deallocate the daily sequences of a design day by zone sizing array once the sizing
+		// calculation that reads them is complete; only the zone by zone final sizing arrays
+		// are used after sizing.
+
+		// METHODOLOGY EMPLOYED:
+		// Use the DEALLOCATE command. The sequences of CalcZoneSizing are last read in
+		// UpdateZoneSizing( EndZoneSizingCalc ) and those of ZoneSizing in the system sizing.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int DesDayNum; // design day index
+		int CtrlZoneNum; // controlled zone index
+
+		if ( ! allocated( DesDayZoneSizing ) ) return;
+
+		for ( DesDayNum = 1; DesDayNum <= DesDayZoneSizing.isize1(); ++DesDayNum ) {
+			for ( CtrlZoneNum = 1; CtrlZoneNum <= DesDayZoneSizing.isize2(); ++CtrlZoneNum ) {
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatFlowSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolFlowSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatLoadSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolLoadSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatZoneTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatOutTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatZoneRetTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatTstatTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).DesHeatSetPtSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolZoneTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolOutTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolZoneRetTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolTstatTempSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).DesCoolSetPtSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatZoneHumRatSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolZoneHumRatSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).HeatOutHumRatSeq.deallocate();
+				DesDayZoneSizing( DesDayNum, CtrlZoneNum ).CoolOutHumRatSeq.deallocate();
+			}
+		}
+
+	}
+
 	void
 	UpdateZoneSizing( int const CallIndicator )
 	{
@@ -2778,6 +2828,7 @@ namespace ZoneEquipmentManager {
 				}
 
 				{ auto const SELECT_CASE_var( ZoneEquipTypeNum );
+				Profiler::ComponentTimer const Timer( PrioritySimOrder( EquipTypeNum ).EquipType, PrioritySimOrder( EquipTypeNum ).EquipName );
 
 				if ( SELECT_CASE_var == AirDistUnit_Num ) { // 'ZoneHVAC:AirDistributionUnit'
 
@@ -2974,6 +3025,9 @@ namespace ZoneEquipmentManager {
 		CurZoneEqNum = 0;
 		FirstPassZoneEquip = false;
 
+		// The equipment indexes are known once each zone has been simulated
+		if ( ! ZoneEquipGroupsSet ) SetZoneEquipGroups();
+
 		//This is the call to the Supply Air Path after the components are simulated to update
 		//  the path inlets
 
@@ -3033,6 +3087,86 @@ namespace ZoneEquipmentManager {
 
 	}
 
+	void
+	SetZoneEquipGroups()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sorts the controlled zones into groups whose zone equipment shares no air loop, no plant
+		// loop and no VRF condenser with the equipment of another group, so the groups do not
+		// affect one another within an HVAC iteration.
+
+		// METHODOLOGY EMPLOYED:
+		// Union-find over the controlled zones, joined by air loop, by the plant loops of their
+		// plant connected equipment (as found by the energy reports) and by the condenser of
+		// their VRF terminal units.  Groups are numbered in the order of their first zone.
+
+		// Using/Aliasing
+		using DataAirSystems::ZoneCompToPlant;
+		using DataAirSystems::ZoneSubCompToPlant;
+		using DataAirSystems::ZoneSubSubCompToPlant;
+		using DataHVACGlobals::NumPrimaryAirSys;
+		using DataPlant::TotNumLoops;
+		using HVACVariableRefrigerantFlow::VRFTU;
+
+		Array1D_int Parent( NumOfZones ); // Union-find forest over the controlled zones
+		for ( int ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) Parent( ControlledZoneNum ) = ControlledZoneNum;
+		auto FindRoot = [ &Parent ]( int ControlledZoneNum ) -> int {
+			while ( Parent( ControlledZoneNum ) != ControlledZoneNum ) {
+				Parent( ControlledZoneNum ) = Parent( Parent( ControlledZoneNum ) );
+				ControlledZoneNum = Parent( ControlledZoneNum );
+			}
+			return ControlledZoneNum;
+		};
+		// First controlled zone found using each air loop, plant loop and VRF condenser
+		Array1D_int AirLoopZone( NumPrimaryAirSys, 0 );
+		Array1D_int PlantLoopZone( TotNumLoops, 0 );
+		Array1D_int VRFSysZone( VRFTU.isize(), 0 );
+		auto Join = [ & ]( Array1D_int & FirstZone, int const Num, int const ControlledZoneNum ) {
+			if ( Num < 1 || Num > FirstZone.isize() ) return;
+			if ( ControlledZoneNum < 1 || ControlledZoneNum > NumOfZones ) return;
+			if ( FirstZone( Num ) == 0 ) {
+				FirstZone( Num ) = ControlledZoneNum;
+			} else {
+				Parent( FindRoot( ControlledZoneNum ) ) = FindRoot( FirstZone( Num ) );
+			}
+		};
+
+		for ( int ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			Join( AirLoopZone, ZoneEquipConfig( ControlledZoneNum ).AirLoopNum, ControlledZoneNum );
+			if ( ControlledZoneNum > ZoneEquipList.isize() ) continue;
+			auto const & equipList( ZoneEquipList( ControlledZoneNum ) );
+			for ( int EquipNum = 1; EquipNum <= equipList.NumOfEquipTypes; ++EquipNum ) {
+				if ( equipList.EquipType_Num( EquipNum ) != VRFTerminalUnit_Num ) continue;
+				int const TUNum( equipList.EquipIndex( EquipNum ) );
+				if ( TUNum < 1 || TUNum > VRFTU.isize() ) continue;
+				Join( VRFSysZone, VRFTU( TUNum ).VRFSysNum, ControlledZoneNum );
+			}
+		}
+		for ( int Num = 1; Num <= ZoneCompToPlant.isize(); ++Num ) {
+			Join( PlantLoopZone, ZoneCompToPlant( Num ).PlantLoopNum, ZoneCompToPlant( Num ).ZoneEqListNum );
+		}
+		for ( int Num = 1; Num <= ZoneSubCompToPlant.isize(); ++Num ) {
+			Join( PlantLoopZone, ZoneSubCompToPlant( Num ).PlantLoopNum, ZoneSubCompToPlant( Num ).ZoneEqListNum );
+		}
+		for ( int Num = 1; Num <= ZoneSubSubCompToPlant.isize(); ++Num ) {
+			Join( PlantLoopZone, ZoneSubSubCompToPlant( Num ).PlantLoopNum, ZoneSubSubCompToPlant( Num ).ZoneEqListNum );
+		}
+
+		ZoneEquipGroup.dimension( NumOfZones, 0 );
+		Array1D_int RootGroup( NumOfZones, 0 );
+		NumZoneEquipGroups = 0;
+		for ( int ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum ) {
+			if ( ! ZoneEquipConfig( ControlledZoneNum ).IsControlled ) continue;
+			int const Root( FindRoot( ControlledZoneNum ) );
+			if ( RootGroup( Root ) == 0 ) RootGroup( Root ) = ++NumZoneEquipGroups;
+			ZoneEquipGroup( ControlledZoneNum ) = RootGroup( Root );
+		}
+		ZoneEquipGroupsSet = true;
+
+	}
+
 	void
 	SetZoneEquipSimOrder(
 		int const ControlledZoneNum,
@@ -3986,8 +4120,7 @@ namespace ZoneEquipmentManager {
 		static std::string const RoutineNameMixing( "CalcAirFlowSimple:Mixing" );
 		static std::string const RoutineNameCrossMixing( "CalcAirFlowSimple:CrossMixing" );
 		static std::string const RoutineNameRefrigerationDoorMixing( "CalcAirFlowSimple:RefrigerationDoorMixing" );
-		static std::string const RoutineNameInfiltration( "CalcAirFlowSimple:Infiltration" );
-		static std::string const RoutineNameZoneAirBalance( "CalcAirFlowSimple:ZoneAirBalance" );
+		static std::string const RoutineNameOutdoorAir( "CalcAirFlowSimple:OutdoorAir" );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -4025,6 +4158,9 @@ namespace ZoneEquipmentManager {
 		Real64 VAMFL_temp;
 		static Array1D< Real64 > ZMAT; // Zone air temperature
 		static Array1D< Real64 > ZHumRat; // Zone air humidity ratio
+		static Array1D_bool ZoneOutAirFlow; // TRUE for the zones with infiltration, ventilation or a zone air balance
+		static Array1D< Real64 > ZoneOutAirDensity; // Density of the outdoor air at the zone (kg/m^3)
+		static Array1D< Real64 > ZoneOutCpAir; // Heat capacity of the outdoor air at the zone (J/kg-C)
 		Real64 Cw; // Opening effectivenss
 		Real64 Cd; // Discharge coefficent
 		Real64 angle; // Angle between wind direction and effective angle
@@ -4065,6 +4201,9 @@ namespace ZoneEquipmentManager {
 
 		if ( ! allocated( ZMAT ) ) ZMAT.allocate( NumOfZones );
 		if ( ! allocated( ZHumRat ) ) ZHumRat.allocate( NumOfZones );
+		if ( ! allocated( ZoneOutAirFlow ) ) ZoneOutAirFlow.allocate( NumOfZones );
+		if ( ! allocated( ZoneOutAirDensity ) ) ZoneOutAirDensity.allocate( NumOfZones );
+		if ( ! allocated( ZoneOutCpAir ) ) ZoneOutCpAir.allocate( NumOfZones );
 		if ( ! allocated( VentMCP ) ) VentMCP.allocate( TotVentilation );
 
 		// Allocate module level logical arrays for MIXING and CROSS MIXING reporting
@@ -4122,6 +4261,17 @@ namespace ZoneEquipmentManager {
 			}
 		}
 
+		// Outdoor air properties once for each zone with outdoor air flow objects, rather than for each object
+		ZoneOutAirFlow = false;
+		for ( j = 1; j <= TotVentilation; ++j ) ZoneOutAirFlow( Ventilation( j ).ZonePtr ) = true;
+		for ( j = 1; j <= TotInfiltration; ++j ) ZoneOutAirFlow( Infiltration( j ).ZonePtr ) = true;
+		for ( j = 1; j <= TotZoneAirBalance; ++j ) ZoneOutAirFlow( ZoneAirBalance( j ).ZonePtr ) = true;
+		for ( NZ = 1; NZ <= NumOfZones; ++NZ ) {
+			if ( ! ZoneOutAirFlow( NZ ) ) continue;
+			ZoneOutAirDensity( NZ ) = PsyRhoAirFnPbTdbW( OutBaroPress, Zone( NZ ).OutDryBulbTemp, OutHumRat, RoutineNameOutdoorAir );
+			ZoneOutCpAir( NZ ) = PsyCpAirFnWTdb( OutHumRat, Zone( NZ ).OutDryBulbTemp );
+		}
+
 		// Process the scheduled Ventilation for air heat balance
 		if ( TotVentilation > 0 ) {
 			ZnAirRpt.VentilFanElec() = 0.0;
@@ -4142,8 +4292,8 @@ namespace ZoneEquipmentManager {
 			Ventilation( j ).FanPower = 0.0;
 			TempExt = Zone( NZ ).OutDryBulbTemp;
 			WindExt = Zone( NZ ).WindSpeed;
-			AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, TempExt, OutHumRat );
-			CpAir = PsyCpAirFnWTdb( OutHumRat, TempExt );
+			AirDensity = ZoneOutAirDensity( NZ );
+			CpAir = ZoneOutCpAir( NZ );
 			//CR7751 should maybe use code below, indoor conditions instead of outdoor conditions
 			//   AirDensity = PsyRhoAirFnPbTdbW(OutBaroPress, ZMAT(NZ), ZHumRat(NZ))
 			//   CpAir = PsyCpAirFnWTdb(ZHumRat(NZ),ZMAT(NZ))
@@ -4716,8 +4866,8 @@ namespace ZoneEquipmentManager {
 
 			TempExt = Zone( NZ ).OutDryBulbTemp;
 			WindExt = Zone( NZ ).WindSpeed;
-			AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, TempExt, OutHumRat, RoutineNameInfiltration );
-			CpAir = PsyCpAirFnWTdb( OutHumRat, TempExt );
+			AirDensity = ZoneOutAirDensity( NZ );
+			CpAir = ZoneOutCpAir( NZ );
 			//CR7751  should maybe use code below, indoor conditions instead of outdoor conditions
 			//   AirDensity = PsyRhoAirFnPbTdbW(OutBaroPress, ZMAT(NZ), ZHumRat(NZ))
 			//   CpAir = PsyCpAirFnWTdb(ZHumRat(NZ),ZMAT(NZ))
@@ -4825,8 +4975,8 @@ namespace ZoneEquipmentManager {
 					}
 				}
 				NZ = ZoneAirBalance( j ).ZonePtr;
-				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Zone( NZ ).OutDryBulbTemp, OutHumRat, RoutineNameZoneAirBalance );
-				CpAir = PsyCpAirFnWTdb( OutHumRat, Zone( NZ ).OutDryBulbTemp );
+				AirDensity = ZoneOutAirDensity( NZ );
+				CpAir = ZoneOutCpAir( NZ );
 				ZoneAirBalance( j ).ERVMassFlowRate *= AirDensity;
 				MDotOA( NZ ) = std::sqrt( pow_2( ZoneAirBalance( j ).NatMassFlowRate ) + pow_2( ZoneAirBalance( j ).IntMassFlowRate ) + pow_2( ZoneAirBalance( j ).ExhMassFlowRate ) + pow_2( ZoneAirBalance( j ).ERVMassFlowRate ) + pow_2( ZoneAirBalance( j ).InfMassFlowRate ) + pow_2( AirDensity * ZoneAirBalance( j ).InducedAirRate * GetCurrentScheduleValue( ZoneAirBalance( j ).InducedAirSchedPtr ) ) ) + ZoneAirBalance( j ).BalMassFlowRate;
 				MDotCPOA( NZ ) = MDotOA( NZ ) * CpAir;
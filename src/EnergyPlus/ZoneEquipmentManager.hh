@@ -3,11 +3,13 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
+#include <DataSizing.hh>
 
 namespace EnergyPlus {
 
@@ -26,6 +28,9 @@ namespace ZoneEquipmentManager {
 	extern Array1D_int DefaultSimOrder;
 	extern int NumOfTimeStepInDay; // number of zone time steps in a day
 	extern bool GetZoneEquipmentInputFlag;
+	extern bool ZoneEquipGroupsSet; // True once the independent groups of controlled zones have been found
+	extern int NumZoneEquipGroups; // Number of groups of controlled zones whose equipment shares nothing with other groups
+	extern Array1D_int ZoneEquipGroup; // Group of each controlled zone (0 if not controlled)
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE ZoneEquipmentManager
 
@@ -95,6 +100,9 @@ namespace ZoneEquipmentManager {
 	void
 	RezeroZoneSizingArrays();
 
+	void
+	DeallocateZoneSizingSequences( Array2D< DataSizing::ZoneSizingData > & DesDayZoneSizing ); // ZoneSizing or CalcZoneSizing
+
 	void
 	UpdateZoneSizing( int const CallIndicator );
 
@@ -104,6 +112,9 @@ namespace ZoneEquipmentManager {
 		bool & SimAir
 	);
 
+	void
+	SetZoneEquipGroups();
+
 	void
 	SetZoneEquipSimOrder(
 		int const ControlledZoneNum,
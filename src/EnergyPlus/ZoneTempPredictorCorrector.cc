@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <string>
 
@@ -21,6 +22,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -169,6 +171,12 @@ namespace ZoneTempPredictorCorrector {
 	Array1D< Real64 > ZoneTempOscillate;
 	Real64 AnyZoneTempOscillate;
 
+	// Plenums of each zone, found once for the zone sums
+	Array1D_int ZoneRetPlenumOfZone; // Return plenum of each zone, 0 if none
+	Array1D_int ZoneSupPlenumOfZone; // Supply plenum of each zone, 0 if none
+	int NumZoneRetPlenumsFound( -1 ); // Numbers of plenums when the plenums of the zones were found
+	int NumZoneSupPlenumsFound( -1 );
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Object Data
@@ -180,6 +188,7 @@ namespace ZoneTempPredictorCorrector {
 	Array1D< ZoneComfortFangerControlType > SetPointSingleCoolingFanger;
 	Array1D< ZoneComfortFangerControlType > SetPointSingleHeatCoolFanger;
 	Array1D< ZoneComfortFangerControlType > SetPointDualHeatCoolFanger;
+	Array1D< ZoneSumsData > ZoneSums; // Heat balance sums of each zone, found for all the zones together
 
 	// Functions
 
@@ -2488,14 +2497,6 @@ namespace ZoneTempPredictorCorrector {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 SumIntGain; // Zone sum of convective internal gains
-		Real64 SumHA; // Zone sum of Hc*Area
-		Real64 SumHATsurf; // Zone sum of Hc*Area*Tsurf
-		Real64 SumHATref; // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
-		Real64 SumMCp; // Zone sum of MassFlowRate*Cp
-		Real64 SumMCpT; // Zone sum of MassFlowRate*Cp*T
-		Real64 SumSysMCp; // Zone sum of air system MassFlowRate*Cp
-		Real64 SumSysMCpT; // Zone sum of air system MassFlowRate*Cp*T
 		Real64 TempDepCoef; // Formerly CoefSumha
 		Real64 TempIndCoef; // Formerly CoefSumhat
 		Real64 AirCap; // Formerly CoefAirrat
@@ -2575,6 +2576,9 @@ namespace ZoneTempPredictorCorrector {
 			}
 		}
 
+		// Calculate the various heat balance sums: they only read the state of their own zone, which the loop below does not change
+		CalcAllZoneSums( controlledZoneEquipConfigNums );
+
 		// Update zone temperatures
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
@@ -2639,13 +2643,13 @@ namespace ZoneTempPredictorCorrector {
 			AIRRAT( ZoneNum ) = Zone( ZoneNum ).Volume * ZoneVolCapMultpSens * PsyRhoAirFnPbTdbW( OutBaroPress, MAT( ZoneNum ), ZoneAirHumRat( ZoneNum ) ) * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), MAT( ZoneNum ) ) / ( TimeStepSys * SecInHour );
 			AirCap = AIRRAT( ZoneNum );
 
-			// Calculate the various heat balance sums
+			// The various heat balance sums, found for all the zones above
 
 			// NOTE: SumSysMCp and SumSysMCpT are not used in the predict step
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			auto const & sums( ZoneSums( ZoneNum ) );
 
-			TempDepCoef = SumHA + SumMCp;
-			TempIndCoef = SumIntGain + SumHATsurf - SumHATref + SumMCpT + SysDepZoneLoadsLagged( ZoneNum );
+			TempDepCoef = sums.SumHA + sums.SumMCp;
+			TempIndCoef = sums.SumIntGain + sums.SumHATsurf - sums.SumHATref + sums.SumMCpT + SysDepZoneLoadsLagged( ZoneNum );
 			if ( AirModel( ZoneNum ).AirModelType == RoomAirModel_Mixing ) {
 				TempHistoryTerm = AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) );
 				TempDepZnLd( ZoneNum ) = ( 11.0 / 6.0 ) * AirCap + TempDepCoef;
@@ -3655,6 +3659,13 @@ namespace ZoneTempPredictorCorrector {
 			}
 		}
 
+		// With only well mixed zones the air models leave the zone sums unchanged, so they can be found for all the zones first
+		bool AllZonesMixing( ! UCSDModelUsed && ! MundtModelUsed && allocated( AirModel ) );
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones && AllZonesMixing; ++ZoneNum ) {
+			if ( AirModel( ZoneNum ).AirModelType != RoomAirModel_Mixing ) AllZonesMixing = false;
+		}
+		if ( AllZonesMixing ) CalcAllZoneSums( controlledZoneEquipConfigNums );
+
 		// Update zone temperatures
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
@@ -3703,7 +3714,19 @@ namespace ZoneTempPredictorCorrector {
 			ManageAirModel( ZoneNum );
 
 			// Calculate the various heat balance sums
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			if ( AllZonesMixing ) {
+				auto const & sums( ZoneSums( ZoneNum ) );
+				SumIntGain = sums.SumIntGain;
+				SumHA = sums.SumHA;
+				SumHATsurf = sums.SumHATsurf;
+				SumHATref = sums.SumHATref;
+				SumMCp = sums.SumMCp;
+				SumMCpT = sums.SumMCpT;
+				SumSysMCp = sums.SumSysMCp;
+				SumSysMCpT = sums.SumSysMCpT;
+			} else {
+				CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			}
 			//    ZoneTempHistoryTerm = (3.0D0 * ZTM1(ZoneNum) - (3.0D0/2.0D0) * ZTM2(ZoneNum) + (1.0D0/3.0D0) * ZTM3(ZoneNum))
 			ZoneNodeNum = Zone( ZoneNum ).SystemZoneNodeNumber;
 
@@ -4061,6 +4084,69 @@ namespace ZoneTempPredictorCorrector {
 
 	}
 
+	void
+	RespaceHistoryValues(
+		Real64 const OldTimeStep,
+		Real64 const NewTimeStep,
+		Real64 const Val0, // Value now
+		Real64 & Val1, // Values one, two and three timesteps back, respaced on return
+		Real64 & Val2,
+		Real64 & Val3
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gives a history of values now one, two and three timesteps back at a new timestep, from
+		// the history at the old timestep.
+
+		// METHODOLOGY EMPLOYED:
+		// Linear interpolation between the old history points; a point further back than the old
+		// history takes its oldest value.
+
+		Real64 const Old[ 4 ] = { Val0, Val1, Val2, Val3 };
+		Real64 New[ 3 ];
+
+		for ( int Back = 1; Back <= 3; ++Back ) {
+			Real64 const OldSteps( Back * NewTimeStep / OldTimeStep ); // Old timesteps back of this point
+			int const Before( static_cast< int >( OldSteps ) );
+			if ( Before >= 3 ) {
+				New[ Back - 1 ] = Old[ 3 ];
+			} else {
+				New[ Back - 1 ] = Old[ Before ] + ( Old[ Before + 1 ] - Old[ Before ] ) * ( OldSteps - Before );
+			}
+		}
+		Val1 = New[ 0 ];
+		Val2 = New[ 1 ];
+		Val3 = New[ 2 ];
+
+	}
+
+	void
+	RespaceSystemTimestepHistories(
+		Real64 const OldTimeStep,
+		Real64 const NewTimeStep
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Respaces the system timestep histories of the zone air temperatures and humidity ratios
+		// when the system timestep changes within a zone timestep.
+
+		// METHODOLOGY EMPLOYED:
+		// The histories have just been pushed, so the latest value of each is the value now.
+
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			RespaceHistoryValues( OldTimeStep, NewTimeStep, DSXMAT( ZoneNum ), DSXM2T( ZoneNum ), DSXM3T( ZoneNum ), DSXM4T( ZoneNum ) );
+			RespaceHistoryValues( OldTimeStep, NewTimeStep, DSWZoneTimeMinus1( ZoneNum ), DSWZoneTimeMinus2( ZoneNum ), DSWZoneTimeMinus3( ZoneNum ), DSWZoneTimeMinus4( ZoneNum ) );
+			if ( IsZoneDV( ZoneNum ) || IsZoneUI( ZoneNum ) ) {
+				RespaceHistoryValues( OldTimeStep, NewTimeStep, DSXMATFloor( ZoneNum ), DSXM2TFloor( ZoneNum ), DSXM3TFloor( ZoneNum ), DSXM4TFloor( ZoneNum ) );
+				RespaceHistoryValues( OldTimeStep, NewTimeStep, DSXMATOC( ZoneNum ), DSXM2TOC( ZoneNum ), DSXM3TOC( ZoneNum ), DSXM4TOC( ZoneNum ) );
+				RespaceHistoryValues( OldTimeStep, NewTimeStep, DSXMATMX( ZoneNum ), DSXM2TMX( ZoneNum ), DSXM3TMX( ZoneNum ), DSXM4TMX( ZoneNum ) );
+			}
+		}
+
+	}
+
 	void
 	RevertZoneTimestepHistories()
 	{
@@ -4216,29 +4302,13 @@ namespace ZoneTempPredictorCorrector {
 		ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 
 		// Check to see if this is a controlled zone
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ZoneEquipConfigNum = ControlledZoneEquipConfigNum( ZoneNum, controlledZoneEquipConfigNums );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		FindZonePlenums( ZoneNum, ZoneRetPlenumNum, ZoneSupPlenumNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		if ( ControlledZoneAirFlag ) { // If there is system flow then calculate the flow rates
 
@@ -4476,6 +4546,73 @@ namespace ZoneTempPredictorCorrector {
 
 	}
 
+	int
+	ControlledZoneEquipConfigNum(
+		int const ZoneNum, // Zone number
+		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the zone equipment configuration of the controlled zone, 0 if the zone is not controlled.
+
+		// METHODOLOGY EMPLOYED:
+		// The configurations are numbered as their zones, so the configuration of the zone's own
+		// number is found by a binary search of the sorted list before the list is searched in order.
+
+		// Using/Aliasing
+		using DataZoneEquipment::ZoneEquipConfig;
+
+		if ( std::binary_search( controlledZoneEquipConfigNums.begin(), controlledZoneEquipConfigNums.end(), ZoneNum ) && ZoneEquipConfig( ZoneNum ).ActualZoneNum == ZoneNum ) return ZoneNum;
+		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
+			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) return controlledZoneEquipConfigNums[ i ];
+		}
+		return 0;
+
+	}
+
+	void
+	FindZonePlenums(
+		int const ZoneNum, // Zone number
+		int & ZoneRetPlenumNum, // Return plenum of the zone, 0 if none
+		int & ZoneSupPlenumNum // Supply plenum of the zone, 0 if none
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gives the return and supply plenums that the zone is, if any.
+
+		// METHODOLOGY EMPLOYED:
+		// The plenums of all the zones are found together the first time, and again whenever the
+		// numbers of zones or plenums change, as when the plenum input is read after the first zone sums.
+		// The first plenum of a zone is kept, as in a search of the plenums in order.
+
+		// Using/Aliasing
+		using ZonePlenum::ZoneRetPlenCond;
+		using ZonePlenum::ZoneSupPlenCond;
+		using ZonePlenum::NumZoneReturnPlenums;
+		using ZonePlenum::NumZoneSupplyPlenums;
+
+		int const NumZones( max( NumOfZones, ZoneNum ) );
+		if ( NumZoneRetPlenumsFound != NumZoneReturnPlenums || NumZoneSupPlenumsFound != NumZoneSupplyPlenums || int( ZoneRetPlenumOfZone.size() ) != NumZones ) {
+			ZoneRetPlenumOfZone.dimension( NumZones, 0 );
+			ZoneSupPlenumOfZone.dimension( NumZones, 0 );
+			for ( int PlenumNum = NumZoneReturnPlenums; PlenumNum >= 1; --PlenumNum ) {
+				int const PlenumZoneNum( ZoneRetPlenCond( PlenumNum ).ActualZoneNum );
+				if ( PlenumZoneNum >= 1 && PlenumZoneNum <= NumZones ) ZoneRetPlenumOfZone( PlenumZoneNum ) = PlenumNum;
+			}
+			for ( int PlenumNum = NumZoneSupplyPlenums; PlenumNum >= 1; --PlenumNum ) {
+				int const PlenumZoneNum( ZoneSupPlenCond( PlenumNum ).ActualZoneNum );
+				if ( PlenumZoneNum >= 1 && PlenumZoneNum <= NumZones ) ZoneSupPlenumOfZone( PlenumZoneNum ) = PlenumNum;
+			}
+			NumZoneRetPlenumsFound = NumZoneReturnPlenums;
+			NumZoneSupPlenumsFound = NumZoneSupplyPlenums;
+		}
+		ZoneRetPlenumNum = ZoneRetPlenumOfZone( ZoneNum );
+		ZoneSupPlenumNum = ZoneSupPlenumOfZone( ZoneNum );
+
+	}
+
 	void
 	CalcZoneSums(
 		int const ZoneNum, // Zone number
@@ -4592,30 +4729,13 @@ namespace ZoneTempPredictorCorrector {
 		// Sum all system air flow: SumSysMCp, SumSysMCpT
 		// Check to see if this is a controlled zone
 
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ZoneEquipConfigNum = ControlledZoneEquipConfigNum( ZoneNum, controlledZoneEquipConfigNums );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		// BG feb 2008 repeating this do loop every time seems crazy, store ControlledZoneAirFlag in Zone structure?
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		FindZonePlenums( ZoneNum, ZoneRetPlenumNum, ZoneSupPlenumNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
@@ -4784,6 +4904,65 @@ namespace ZoneTempPredictorCorrector {
 
 	}
 
+	void
+	CalcAllZoneSums( std::vector< int > const & controlledZoneEquipConfigNums ) // Precomputed controlled equip nums
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the heat balance sums of CalcZoneSums for all the zones, into ZoneSums.
+
+		// METHODOLOGY EMPLOYED:
+		// The sums of a zone read only the conditions of the zone, its surfaces and its inlet
+		// nodes, and write only the heat gains of its own airflow windows, so the zones are summed
+		// side by side on the threads when built with OpenMP.  Each zone is summed in the same
+		// order by one thread, so the sums do not depend on the number of threads.  A zone that
+		// is not controlled but has a surface convecting to the supply air is summed afterwards,
+		// on the main thread, for the fatal error that CalcZoneSums gives it.
+
+		// Using/Aliasing
+		using DataSurfaces::Surface;
+		using DataSurfaces::ZoneSupplyAirTemp;
+		using DataSystemVariables::NumberZoneSumsThreads;
+		using DataSystemVariables::ParallelLoopThreads;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MinZonesPerThread( 16 ); // Smallest share of the zones worth handing to a thread
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneRetPlenumNum;
+		int ZoneSupPlenumNum;
+
+		if ( int( ZoneSums.size() ) != NumOfZones ) ZoneSums.allocate( NumOfZones );
+		if ( NumOfZones == 0 ) return;
+		FindZonePlenums( 1, ZoneRetPlenumNum, ZoneSupPlenumNum ); // Finds the plenums of all the zones, ahead of the threads
+
+		int const nThreads( ParallelLoopThreads( NumberZoneSumsThreads, NumOfZones, MinZonesPerThread ) );
+		std::vector< char > Deferred( NumOfZones, 0 ); // Zones summed on the main thread afterwards
+#ifdef HBIRE_USE_OMP
+#pragma omp parallel for schedule(static) num_threads(nThreads) if(nThreads > 1)
+#endif
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( nThreads > 1 && ControlledZoneEquipConfigNum( ZoneNum, controlledZoneEquipConfigNums ) == 0 ) {
+				auto const & zone( Zone( ZoneNum ) );
+				for ( int SurfNum = zone.SurfaceFirst; SurfNum <= zone.SurfaceLast; ++SurfNum ) {
+					if ( Surface( SurfNum ).HeatTransSurf && Surface( SurfNum ).TAirRef == ZoneSupplyAirTemp ) {
+						Deferred[ ZoneNum - 1 ] = 1;
+						break;
+					}
+				}
+				if ( Deferred[ ZoneNum - 1 ] ) continue;
+			}
+			auto & sums( ZoneSums( ZoneNum ) );
+			CalcZoneSums( ZoneNum, sums.SumIntGain, sums.SumHA, sums.SumHATsurf, sums.SumHATref, sums.SumMCp, sums.SumMCpT, sums.SumSysMCp, sums.SumSysMCpT, controlledZoneEquipConfigNums );
+		}
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ! Deferred[ ZoneNum - 1 ] ) continue;
+			auto & sums( ZoneSums( ZoneNum ) );
+			CalcZoneSums( ZoneNum, sums.SumIntGain, sums.SumHA, sums.SumHATsurf, sums.SumHATref, sums.SumMCp, sums.SumMCpT, sums.SumSysMCp, sums.SumSysMCpT, controlledZoneEquipConfigNums );
+		}
+
+	}
+
 	void
 	CalcZoneComponentLoadSums(
 		int const ZoneNum, // Zone number
@@ -4912,29 +5091,13 @@ namespace ZoneTempPredictorCorrector {
 		// Check to see if this is a controlled zone
 
 		// CR 7384 continuation needed below.  eliminate do loop for speed and clarity
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ZoneEquipConfigNum = ControlledZoneEquipConfigNum( ZoneNum, controlledZoneEquipConfigNums );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		FindZonePlenums( ZoneNum, ZoneRetPlenumNum, ZoneSupPlenumNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
@@ -96,6 +96,12 @@ namespace ZoneTempPredictorCorrector {
 	extern Array1D< Real64 > ZoneTempOscillate;
 	extern Real64 AnyZoneTempOscillate;
 
+	// Plenums of each zone, found once for the zone sums
+	extern Array1D_int ZoneRetPlenumOfZone; // Return plenum of each zone, 0 if none
+	extern Array1D_int ZoneSupPlenumOfZone; // Supply plenum of each zone, 0 if none
+	extern int NumZoneRetPlenumsFound; // Numbers of plenums when the plenums of the zones were found
+	extern int NumZoneSupPlenumsFound;
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Types
@@ -178,6 +184,32 @@ namespace ZoneTempPredictorCorrector {
 
 	};
 
+	struct ZoneSumsData
+	{
+		// Members
+		Real64 SumIntGain; // Zone sum of convective internal gains
+		Real64 SumHA; // Zone sum of Hc*Area
+		Real64 SumHATsurf; // Zone sum of Hc*Area*Tsurf
+		Real64 SumHATref; // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
+		Real64 SumMCp; // Zone sum of MassFlowRate*Cp
+		Real64 SumMCpT; // Zone sum of MassFlowRate*Cp*T
+		Real64 SumSysMCp; // Zone sum of air system MassFlowRate*Cp
+		Real64 SumSysMCpT; // Zone sum of air system MassFlowRate*Cp*T
+
+		// Default Constructor
+		ZoneSumsData() :
+			SumIntGain( 0.0 ),
+			SumHA( 0.0 ),
+			SumHATsurf( 0.0 ),
+			SumHATref( 0.0 ),
+			SumMCp( 0.0 ),
+			SumMCpT( 0.0 ),
+			SumSysMCp( 0.0 ),
+			SumSysMCpT( 0.0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< ZoneTempControlType > SetPointSingleHeating;
 	extern Array1D< ZoneTempControlType > SetPointSingleCooling;
@@ -187,6 +219,7 @@ namespace ZoneTempPredictorCorrector {
 	extern Array1D< ZoneComfortFangerControlType > SetPointSingleCoolingFanger;
 	extern Array1D< ZoneComfortFangerControlType > SetPointSingleHeatCoolFanger;
 	extern Array1D< ZoneComfortFangerControlType > SetPointDualHeatCoolFanger;
+	extern Array1D< ZoneSumsData > ZoneSums; // Heat balance sums of each zone, found for all the zones together
 
 	// Functions
 
@@ -235,6 +268,22 @@ namespace ZoneTempPredictorCorrector {
 	void
 	PushSystemTimestepHistories();
 
+	void
+	RespaceHistoryValues(
+		Real64 const OldTimeStep,
+		Real64 const NewTimeStep,
+		Real64 const Val0, // Value now
+		Real64 & Val1, // Values one, two and three timesteps back, respaced on return
+		Real64 & Val2,
+		Real64 & Val3
+	);
+
+	void
+	RespaceSystemTimestepHistories(
+		Real64 const OldTimeStep,
+		Real64 const NewTimeStep
+	);
+
 	void
 	RevertZoneTimestepHistories();
 
@@ -260,6 +309,19 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & newVal4 // unused 1208
 	);
 
+	int
+	ControlledZoneEquipConfigNum(
+		int const ZoneNum, // Zone number
+		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+	);
+
+	void
+	FindZonePlenums(
+		int const ZoneNum, // Zone number
+		int & ZoneRetPlenumNum, // Return plenum of the zone, 0 if none
+		int & ZoneSupPlenumNum // Supply plenum of the zone, 0 if none
+	);
+
 	void
 	CalcZoneSums(
 		int const ZoneNum, // Zone number
@@ -274,6 +336,9 @@ namespace ZoneTempPredictorCorrector {
 		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
 	);
 
+	void
+	CalcAllZoneSums( std::vector< int > const & controlledZoneEquipConfigNums ); // Precomputed controlled equip nums
+
 	void
 	CalcZoneComponentLoadSums(
 		int const ZoneNum, // Zone number
@@ -1,10 +1,13 @@
+#include <cstdlib>
+#include <iostream>
 #include <EnergyPlusPgm.hh>
 #include <CommandLineInterface.hh>
 using EnergyPlus::CommandLineInterface::ProcessArgs;
+using EnergyPlus::CommandLineInterface::ServeRuns;
 
 int
 main( int argc, const char * argv[] )
 {
-	ProcessArgs( argc, argv );
+	if ( ProcessArgs( argc, argv ) == ServeRuns ) return EnergyPlusPgmServe( std::cin, std::cout ) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 	EnergyPlusPgm();
 }
@@ -4,7 +4,9 @@
 #include <EnergyPlusAPI.hh>
 
 // C++ Headers
+#include <iosfwd>
 #include <string>
+#include <vector>
 
 	// Functions
 
@@ -14,10 +16,70 @@
 	void ENERGYPLUSLIB_API
 	EnergyPlusPgm( std::string const & filepath = std::string() );
 
+	void ENERGYPLUSLIB_API
+	EnergyPlusPgmFromBuffer(
+		std::string const & InputData, // Contents of an input data file
+		std::string const & filepath = std::string()
+	);
+
+	int ENERGYPLUSLIB_API
+	EnergyPlusPgmRunMany(
+		std::vector< std::string > const & RunDirectories,
+		int const MaxConcurrentRuns = 1
+	);
+
+	int ENERGYPLUSLIB_API
+	EnergyPlusPgmRunVariants(
+		std::string const & filepath, // Directory of the base run
+		std::vector< std::string > const & RunDirectories, // Run directory of each variant
+		std::vector< std::vector< std::string > > const & InputOverrides, // Input fields changed for each variant
+		int const MaxConcurrentRuns = 1
+	);
+
+	int ENERGYPLUSLIB_API
+	EnergyPlusPgmServe(
+		std::istream & Requests, // Options and input file of each run, one line per run
+		std::ostream & Results // Exit status of each run, one line per run
+	);
+
 	void ENERGYPLUSLIB_API
 	StoreProgressCallback( void ( *f )( int const ) );
 
 	void ENERGYPLUSLIB_API
 	StoreMessageCallback( void ( *f )( std::string const & ) );
 
+	void ENERGYPLUSLIB_API
+	StoreCallingPointCallback( void ( *f )( int const ) ); // Called with the EMS calling point (emsCallFrom... in DataGlobals)
+
+	int ENERGYPLUSLIB_API
+	GetVariableHandle(
+		std::string const & VarName, // Output variable name, without units
+		std::string const & KeyName // Key of the output variable, such as the zone name
+	);
+
+	double ENERGYPLUSLIB_API
+	GetVariableValue( int const Handle );
+
+	void ENERGYPLUSLIB_API
+	GetVariableValues(
+		std::vector< int > const & Handles, // Handles from GetVariableHandle
+		std::vector< double > & Values // Current value of each variable, 0 for a handle not set up
+	);
+
+	int ENERGYPLUSLIB_API
+	GetActuatorHandle(
+		std::string const & ComponentType, // Actuated component type, as in EnergyManagementSystem:Actuator
+		std::string const & ControlType, // Actuated component control type
+		std::string const & UniqueKey // Actuated component unique name
+	);
+
+	void ENERGYPLUSLIB_API
+	SetActuatorValue(
+		int const Handle,
+		double const Value
+	);
+
+	void ENERGYPLUSLIB_API
+	ResetActuator( int const Handle );
+
 #endif
@@ -0,0 +1,960 @@
+// ScalingModelGenerator
+//
+// Writes a synthetic EnergyPlus input file of a chosen size, so that the time and memory of the
+// input processing, shadowing, radiant exchange and HVAC simulation can be measured against the
+// size of the model.  The same arguments always give the same file.
+//
+// The model is a grid of detached box zones.  Each zone has a floor on the ground, a roof, and
+// its walls split into pieces so that it has the requested number of heat transfer surfaces, plus
+// one window on the south wall.  The shading surfaces are fins standing south of the zones.  Each
+// air loop serves its share of the zones through uncontrolled terminals, with a fan and a heating
+// coil held to a supply air temperature; the coils are hot water coils on the plant loops, each
+// with a pump and a boiler, or gas coils when there is no plant loop.  Everything is hard sized,
+// and only the design days are simulated, so no sizing or weather file is needed.
+//
+// Usage: ScalingModelGenerator [options] <output file>
+//   --zones=N              zones (default 10)
+//   --surfaces=M           heat transfer surfaces per zone besides the window, at least 6 (default 6)
+//   --shading=K            shading surfaces (default 0)
+//   --airloops=L           air loops, at most one per zone (default 1)
+//   --plantloops=P         plant loops, at most one per air loop (default 1)
+
+// C++ Headers
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+	// Zone dimensions and spacing of the zone grid [m]
+	double const ZoneWidth( 10.0 );
+	double const ZoneDepth( 10.0 );
+	double const ZoneHeight( 3.0 );
+	double const ZonePitch( 16.0 );
+
+	// Hard sizes per zone served
+	double const ZoneAirFlow( 0.3 ); // Supply air flow rate [m3/s]
+	double const CoilWaterFlow( 0.00015 ); // Heating coil water flow rate [m3/s]
+	double const CoilUA( 150.0 ); // Heating coil UA [W/K]
+	double const HeatingCapacity( 6000.0 ); // Boiler or gas coil capacity [W]
+
+	struct ModelSize
+	{
+		int Zones;
+		int Surfaces;
+		int Shading;
+		int AirLoops;
+		int PlantLoops;
+
+		ModelSize() :
+			Zones( 10 ),
+			Surfaces( 6 ),
+			Shading( 0 ),
+			AirLoops( 1 ),
+			PlantLoops( 1 )
+		{}
+	};
+
+	struct Point
+	{
+		double X;
+		double Y;
+		double Z;
+	};
+
+	std::string
+	Num( double const Value )
+	{
+		char Buffer[ 32 ];
+		std::snprintf( Buffer, sizeof( Buffer ), "%.6g", Value );
+		return Buffer;
+	}
+
+	std::string
+	Num( int const Value )
+	{
+		return std::to_string( Value );
+	}
+
+	// Writes objects with one commented field per line, as the example files are written
+	class IdfWriter
+	{
+
+	public:
+
+		explicit
+		IdfWriter( std::ostream & Stream ) :
+			Stream_( Stream )
+		{}
+
+		void
+		Object( std::string const & Type )
+		{
+			Type_ = Type;
+			Fields_.clear();
+		}
+
+		void
+		Field(
+			std::string const & Value,
+			std::string const & Comment
+		)
+		{
+			Fields_.emplace_back( Value, Comment );
+		}
+
+		void
+		Vertices( std::vector< Point > const & Points )
+		{
+			Field( Num( int( Points.size() ) ), "Number of Vertices" );
+			for ( std::size_t i = 0; i < Points.size(); ++i ) {
+				Fields_.emplace_back( Num( Points[ i ].X ) + ',' + Num( Points[ i ].Y ) + ',' + Num( Points[ i ].Z ), "X,Y,Z ==> Vertex " + std::to_string( i + 1 ) + " {m}" );
+			}
+		}
+
+		void
+		End()
+		{
+			Stream_ << "  " << Type_ << ",\n";
+			for ( std::size_t i = 0; i < Fields_.size(); ++i ) {
+				std::string Line( "    " + Fields_[ i ].first + ( i + 1 < Fields_.size() ? ',' : ';' ) );
+				if ( Line.size() < 29 ) Line.resize( 29, ' ' );
+				Stream_ << Line << "  !- " << Fields_[ i ].second << '\n';
+			}
+			Stream_ << '\n';
+		}
+
+	private:
+
+		std::ostream & Stream_;
+		std::string Type_;
+		std::vector< std::pair< std::string, std::string > > Fields_;
+
+	};
+
+	std::string
+	ZoneName( int const ZoneNum )
+	{
+		return "Zone " + std::to_string( ZoneNum );
+	}
+
+	std::string
+	AirLoopName( int const LoopNum )
+	{
+		return "Air Loop " + std::to_string( LoopNum );
+	}
+
+	std::string
+	PlantLoopName( int const LoopNum )
+	{
+		return "Plant Loop " + std::to_string( LoopNum );
+	}
+
+	// Zones served by the air loop, the zones being dealt to the loops in turn
+	std::vector< int >
+	ZonesOfAirLoop(
+		ModelSize const & Size,
+		int const LoopNum
+	)
+	{
+		std::vector< int > Zones;
+		for ( int ZoneNum = LoopNum; ZoneNum <= Size.Zones; ZoneNum += Size.AirLoops ) Zones.push_back( ZoneNum );
+		return Zones;
+	}
+
+	// Air loops whose heating coils are on the plant loop, the air loops being dealt to the plant loops in turn
+	std::vector< int >
+	AirLoopsOfPlantLoop(
+		ModelSize const & Size,
+		int const LoopNum
+	)
+	{
+		std::vector< int > Loops;
+		for ( int AirLoopNum = LoopNum; AirLoopNum <= Size.AirLoops; AirLoopNum += Size.PlantLoops ) Loops.push_back( AirLoopNum );
+		return Loops;
+	}
+
+	int
+	ZonesOfPlantLoop(
+		ModelSize const & Size,
+		int const LoopNum
+	)
+	{
+		int Zones( 0 );
+		for ( int const AirLoopNum : AirLoopsOfPlantLoop( Size, LoopNum ) ) Zones += int( ZonesOfAirLoop( Size, AirLoopNum ).size() );
+		return Zones;
+	}
+
+	void
+	WriteSimulationObjects( IdfWriter & Idf )
+	{
+		Idf.Object( "Version" );
+		Idf.Field( "8.3", "Version Identifier" );
+		Idf.End();
+
+		Idf.Object( "SimulationControl" );
+		Idf.Field( "No", "Do Zone Sizing Calculation" );
+		Idf.Field( "No", "Do System Sizing Calculation" );
+		Idf.Field( "No", "Do Plant Sizing Calculation" );
+		Idf.Field( "Yes", "Run Simulation for Sizing Periods" );
+		Idf.Field( "No", "Run Simulation for Weather File Run Periods" );
+		Idf.End();
+
+		Idf.Object( "Building" );
+		Idf.Field( "Scaling Model", "Name" );
+		Idf.Field( "0", "North Axis {deg}" );
+		Idf.Field( "Suburbs", "Terrain" );
+		Idf.Field( "0.04", "Loads Convergence Tolerance Value" );
+		Idf.Field( "0.4", "Temperature Convergence Tolerance Value {deltaC}" );
+		Idf.Field( "FullExterior", "Solar Distribution" );
+		Idf.Field( "25", "Maximum Number of Warmup Days" );
+		Idf.Field( "6", "Minimum Number of Warmup Days" );
+		Idf.End();
+
+		Idf.Object( "Timestep" );
+		Idf.Field( "4", "Number of Timesteps per Hour" );
+		Idf.End();
+
+		Idf.Object( "Site:Location" );
+		Idf.Field( "CHICAGO_IL_USA TMY2-94846", "Name" );
+		Idf.Field( "41.78", "Latitude {deg}" );
+		Idf.Field( "-87.75", "Longitude {deg}" );
+		Idf.Field( "-6.00", "Time Zone {hr}" );
+		Idf.Field( "190.00", "Elevation {m}" );
+		Idf.End();
+
+		struct DesignDay
+		{
+			char const * Name;
+			char const * Month;
+			char const * Day;
+			char const * DayType;
+			char const * MaxDryBulb;
+			char const * Range;
+			char const * WetBulb;
+		};
+		DesignDay const DesignDays[] = {
+			{ "CHICAGO_IL_USA Annual Heating 99% Design Conditions DB", "1", "21", "WinterDesignDay", "-17.3", "0.0", "-17.3" },
+			{ "CHICAGO_IL_USA Annual Cooling 1% Design Conditions DB/MCWB", "7", "21", "SummerDesignDay", "31.5", "10.7", "23.0" }
+		};
+		for ( auto const & Day : DesignDays ) {
+			Idf.Object( "SizingPeriod:DesignDay" );
+			Idf.Field( Day.Name, "Name" );
+			Idf.Field( Day.Month, "Month" );
+			Idf.Field( Day.Day, "Day of Month" );
+			Idf.Field( Day.DayType, "Day Type" );
+			Idf.Field( Day.MaxDryBulb, "Maximum Dry-Bulb Temperature {C}" );
+			Idf.Field( Day.Range, "Daily Dry-Bulb Temperature Range {deltaC}" );
+			Idf.Field( "", "Dry-Bulb Temperature Range Modifier Type" );
+			Idf.Field( "", "Dry-Bulb Temperature Range Modifier Day Schedule Name" );
+			Idf.Field( "Wetbulb", "Humidity Condition Type" );
+			Idf.Field( Day.WetBulb, "Wetbulb or DewPoint at Maximum Dry-Bulb {C}" );
+			Idf.Field( "", "Humidity Condition Day Schedule Name" );
+			Idf.Field( "", "Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}" );
+			Idf.Field( "", "Enthalpy at Maximum Dry-Bulb {J/kg}" );
+			Idf.Field( "", "Daily Wet-Bulb Temperature Range {deltaC}" );
+			Idf.Field( "99063.", "Barometric Pressure {Pa}" );
+			Idf.Field( "4.9", "Wind Speed {m/s}" );
+			Idf.Field( "270", "Wind Direction {deg}" );
+			Idf.Field( "No", "Rain Indicator" );
+			Idf.Field( "No", "Snow Indicator" );
+			Idf.Field( "No", "Daylight Saving Time Indicator" );
+			Idf.Field( "ASHRAEClearSky", "Solar Model Indicator" );
+			Idf.Field( "", "Beam Solar Day Schedule Name" );
+			Idf.Field( "", "Diffuse Solar Day Schedule Name" );
+			Idf.Field( "", "ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}" );
+			Idf.Field( "", "ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}" );
+			Idf.Field( Day.DayType[ 0 ] == 'W' ? "0.0" : "1.0", "Sky Clearness" );
+			Idf.End();
+		}
+
+		Idf.Object( "Site:GroundTemperature:BuildingSurface" );
+		char const * const Months[] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+		for ( auto const Month : Months ) Idf.Field( "18", std::string( Month ) + " Ground Temperature {C}" );
+		Idf.End();
+
+		Idf.Object( "GlobalGeometryRules" );
+		Idf.Field( "UpperLeftCorner", "Starting Vertex Position" );
+		Idf.Field( "CounterClockWise", "Vertex Entry Direction" );
+		Idf.Field( "Relative", "Coordinate System" );
+		Idf.End();
+
+		Idf.Object( "ScheduleTypeLimits" );
+		Idf.Field( "Any Number", "Name" );
+		Idf.End();
+
+		struct ConstantSchedule
+		{
+			char const * Name;
+			char const * Value;
+		};
+		ConstantSchedule const Schedules[] = {
+			{ "Always On", "1" },
+			{ "Thermostat Control Type", "4" },
+			{ "Heating Setpoint", "20" },
+			{ "Cooling Setpoint", "24" },
+			{ "Supply Air Temperature", "30" },
+			{ "Hot Water Temperature", "80" }
+		};
+		for ( auto const & Schedule : Schedules ) {
+			Idf.Object( "Schedule:Constant" );
+			Idf.Field( Schedule.Name, "Name" );
+			Idf.Field( "Any Number", "Schedule Type Limits Name" );
+			Idf.Field( Schedule.Value, "Hourly Value" );
+			Idf.End();
+		}
+	}
+
+	void
+	WriteConstructions( IdfWriter & Idf )
+	{
+		struct MaterialLayer
+		{
+			char const * Name;
+			char const * Roughness;
+			char const * Thickness;
+			char const * Conductivity;
+			char const * Density;
+			char const * SpecificHeat;
+		};
+		MaterialLayer const Materials[] = {
+			{ "Brick", "MediumRough", "0.1016", "0.89", "1920", "790" },
+			{ "Insulation", "MediumRough", "0.0508", "0.03", "43", "1210" },
+			{ "Gypsum", "Smooth", "0.0127", "0.16", "800", "1090" },
+			{ "Roof Membrane", "VeryRough", "0.0095", "0.16", "1121", "1460" },
+			{ "Concrete", "MediumRough", "0.1016", "1.311", "2240", "836" }
+		};
+		for ( auto const & Material : Materials ) {
+			Idf.Object( "Material" );
+			Idf.Field( Material.Name, "Name" );
+			Idf.Field( Material.Roughness, "Roughness" );
+			Idf.Field( Material.Thickness, "Thickness {m}" );
+			Idf.Field( Material.Conductivity, "Conductivity {W/m-K}" );
+			Idf.Field( Material.Density, "Density {kg/m3}" );
+			Idf.Field( Material.SpecificHeat, "Specific Heat {J/kg-K}" );
+			Idf.Field( "0.9", "Thermal Absorptance" );
+			Idf.Field( "0.7", "Solar Absorptance" );
+			Idf.Field( "0.7", "Visible Absorptance" );
+			Idf.End();
+		}
+
+		Idf.Object( "WindowMaterial:SimpleGlazingSystem" );
+		Idf.Field( "Double Glazing", "Name" );
+		Idf.Field( "2.5", "U-Factor {W/m2-K}" );
+		Idf.Field( "0.4", "Solar Heat Gain Coefficient" );
+		Idf.Field( "0.6", "Visible Transmittance" );
+		Idf.End();
+
+		struct ConstructionLayers
+		{
+			char const * Name;
+			std::vector< char const * > Layers;
+		};
+		ConstructionLayers const Constructions[] = {
+			{ "Exterior Wall", { "Brick", "Insulation", "Gypsum" } },
+			{ "Roof", { "Roof Membrane", "Insulation", "Gypsum" } },
+			{ "Floor", { "Concrete" } },
+			{ "Window", { "Double Glazing" } }
+		};
+		for ( auto const & Construction : Constructions ) {
+			Idf.Object( "Construction" );
+			Idf.Field( Construction.Name, "Name" );
+			for ( std::size_t i = 0; i < Construction.Layers.size(); ++i ) {
+				Idf.Field( Construction.Layers[ i ], i == 0 ? "Outside Layer" : "Layer " + std::to_string( i + 1 ) );
+			}
+			Idf.End();
+		}
+	}
+
+	void
+	WriteSurface(
+		IdfWriter & Idf,
+		std::string const & Name,
+		std::string const & SurfaceType,
+		std::string const & Construction,
+		int const ZoneNum,
+		std::vector< Point > const & Points
+	)
+	{
+		bool const Ground( SurfaceType == "Floor" );
+		Idf.Object( "BuildingSurface:Detailed" );
+		Idf.Field( Name, "Name" );
+		Idf.Field( SurfaceType, "Surface Type" );
+		Idf.Field( Construction, "Construction Name" );
+		Idf.Field( ZoneName( ZoneNum ), "Zone Name" );
+		Idf.Field( Ground ? "Ground" : "Outdoors", "Outside Boundary Condition" );
+		Idf.Field( "", "Outside Boundary Condition Object" );
+		Idf.Field( Ground ? "NoSun" : "SunExposed", "Sun Exposure" );
+		Idf.Field( Ground ? "NoWind" : "WindExposed", "Wind Exposure" );
+		Idf.Field( "autocalculate", "View Factor to Ground" );
+		Idf.Vertices( Points );
+		Idf.End();
+	}
+
+	void
+	WriteZones(
+		IdfWriter & Idf,
+		ModelSize const & Size
+	)
+	{
+		int const Columns( int( std::ceil( std::sqrt( double( Size.Zones ) ) ) ) );
+		double const W( ZoneWidth );
+		double const D( ZoneDepth );
+		double const H( ZoneHeight );
+		int const WallPieces( Size.Surfaces - 2 );
+
+		for ( int ZoneNum = 1; ZoneNum <= Size.Zones; ++ZoneNum ) {
+			std::string const Zone( ZoneName( ZoneNum ) );
+			Idf.Object( "Zone" );
+			Idf.Field( Zone, "Name" );
+			Idf.Field( "0", "Direction of Relative North {deg}" );
+			Idf.Field( Num( ZonePitch * ( ( ZoneNum - 1 ) % Columns ) ), "X Origin {m}" );
+			Idf.Field( Num( ZonePitch * ( ( ZoneNum - 1 ) / Columns ) ), "Y Origin {m}" );
+			Idf.Field( "0", "Z Origin {m}" );
+			Idf.Field( "1", "Type" );
+			Idf.Field( "1", "Multiplier" );
+			Idf.End();
+
+			WriteSurface( Idf, Zone + " Floor", "Floor", "Floor", ZoneNum, { { W, D, 0.0 }, { W, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, D, 0.0 } } );
+			WriteSurface( Idf, Zone + " Roof", "Roof", "Roof", ZoneNum, { { 0.0, D, H }, { 0.0, 0.0, H }, { W, 0.0, H }, { W, D, H } } );
+
+			// The walls, south, east, north and west, each split along its length into pieces.  Each
+			// piece runs from Start to Start + Step, seen from outside from left to right.
+			int WallNum( 0 );
+			for ( int Side = 0; Side < 4; ++Side ) {
+				int const Pieces( WallPieces / 4 + ( Side < WallPieces % 4 ? 1 : 0 ) );
+				double const Length( Side % 2 == 0 ? W : D );
+				double const Step( Length / Pieces );
+				for ( int Piece = 0; Piece < Pieces; ++Piece ) {
+					double const A( Piece * Step );
+					double const B( ( Piece + 1 ) * Step );
+					std::vector< Point > Points;
+					if ( Side == 0 ) { // South, y = 0, left to right along +x
+						Points = { { A, 0.0, H }, { A, 0.0, 0.0 }, { B, 0.0, 0.0 }, { B, 0.0, H } };
+					} else if ( Side == 1 ) { // East, x = W, left to right along +y
+						Points = { { W, A, H }, { W, A, 0.0 }, { W, B, 0.0 }, { W, B, H } };
+					} else if ( Side == 2 ) { // North, y = D, left to right along -x
+						Points = { { W - A, D, H }, { W - A, D, 0.0 }, { W - B, D, 0.0 }, { W - B, D, H } };
+					} else { // West, x = 0, left to right along -y
+						Points = { { 0.0, D - A, H }, { 0.0, D - A, 0.0 }, { 0.0, D - B, 0.0 }, { 0.0, D - B, H } };
+					}
+					++WallNum;
+					std::string const Wall( Zone + " Wall " + std::to_string( WallNum ) );
+					WriteSurface( Idf, Wall, "Wall", "Exterior Wall", ZoneNum, Points );
+
+					// The window on the first piece of the south wall, when it is wide enough
+					if ( Side == 0 && Piece == 0 && Step > 1.5 ) {
+						Idf.Object( "FenestrationSurface:Detailed" );
+						Idf.Field( Zone + " Window", "Name" );
+						Idf.Field( "Window", "Surface Type" );
+						Idf.Field( "Window", "Construction Name" );
+						Idf.Field( Wall, "Building Surface Name" );
+						Idf.Field( "", "Outside Boundary Condition Object" );
+						Idf.Field( "autocalculate", "View Factor to Ground" );
+						Idf.Field( "", "Shading Control Name" );
+						Idf.Field( "", "Frame and Divider Name" );
+						Idf.Field( "1", "Multiplier" );
+						Idf.Vertices( { { A + 0.5, 0.0, H - 0.6 }, { A + 0.5, 0.0, 0.9 }, { B - 0.5, 0.0, 0.9 }, { B - 0.5, 0.0, H - 0.6 } } );
+						Idf.End();
+					}
+				}
+			}
+
+			Idf.Object( "ZoneControl:Thermostat" );
+			Idf.Field( Zone + " Thermostat", "Name" );
+			Idf.Field( Zone, "Zone or ZoneList Name" );
+			Idf.Field( "Thermostat Control Type", "Control Type Schedule Name" );
+			Idf.Field( "ThermostatSetpoint:DualSetpoint", "Control 1 Object Type" );
+			Idf.Field( "Dual Setpoint", "Control 1 Name" );
+			Idf.End();
+		}
+
+		Idf.Object( "ThermostatSetpoint:DualSetpoint" );
+		Idf.Field( "Dual Setpoint", "Name" );
+		Idf.Field( "Heating Setpoint", "Heating Setpoint Temperature Schedule Name" );
+		Idf.Field( "Cooling Setpoint", "Cooling Setpoint Temperature Schedule Name" );
+		Idf.End();
+	}
+
+	void
+	WriteShading(
+		IdfWriter & Idf,
+		ModelSize const & Size
+	)
+	{
+		// Fins 2 m deep standing south of the zones, dealt to the zones in turn: nine along the south
+		// wall of a zone, then nine more above them, and so on
+		int const Columns( int( std::ceil( std::sqrt( double( Size.Zones ) ) ) ) );
+		for ( int FinNum = 1; FinNum <= Size.Shading; ++FinNum ) {
+			int const ZoneNum( ( FinNum - 1 ) % Size.Zones + 1 );
+			int const FinOfZone( ( FinNum - 1 ) / Size.Zones );
+			double const X( ZonePitch * ( ( ZoneNum - 1 ) % Columns ) + 1.0 + FinOfZone % 9 );
+			double const Y( ZonePitch * ( ( ZoneNum - 1 ) / Columns ) );
+			double const Z( ZoneHeight * ( FinOfZone / 9 ) );
+			Idf.Object( "Shading:Building:Detailed" );
+			Idf.Field( "Fin " + std::to_string( FinNum ), "Name" );
+			Idf.Field( "", "Transmittance Schedule Name" );
+			Idf.Vertices( { { X, Y, Z + ZoneHeight }, { X, Y, Z }, { X, Y - 2.0, Z }, { X, Y - 2.0, Z + ZoneHeight } } );
+			Idf.End();
+		}
+	}
+
+	void
+	WriteBranch(
+		IdfWriter & Idf,
+		std::string const & Name,
+		std::vector< std::vector< std::string > > const & Components // Type, name, inlet node and outlet node of each
+	)
+	{
+		Idf.Object( "Branch" );
+		Idf.Field( Name, "Name" );
+		Idf.Field( "", "Maximum Flow Rate {m3/s}" );
+		Idf.Field( "", "Pressure Drop Curve Name" );
+		for ( std::size_t i = 0; i < Components.size(); ++i ) {
+			std::string const Component( "Component " + std::to_string( i + 1 ) );
+			Idf.Field( Components[ i ][ 0 ], Component + " Object Type" );
+			Idf.Field( Components[ i ][ 1 ], Component + " Name" );
+			Idf.Field( Components[ i ][ 2 ], Component + " Inlet Node Name" );
+			Idf.Field( Components[ i ][ 3 ], Component + " Outlet Node Name" );
+			Idf.Field( "Active", Component + " Branch Control Type" );
+		}
+		Idf.End();
+	}
+
+	void
+	WriteNameList(
+		IdfWriter & Idf,
+		std::string const & Type,
+		std::string const & Name,
+		std::vector< std::string > const & Items,
+		std::string const & ItemComment // Comment of each item, before its number
+	)
+	{
+		Idf.Object( Type );
+		Idf.Field( Name, "Name" );
+		for ( std::size_t i = 0; i < Items.size(); ++i ) {
+			Idf.Field( Items[ i ], ItemComment + ' ' + std::to_string( i + 1 ) + " Name" );
+		}
+		Idf.End();
+	}
+
+	void
+	WriteAirLoops(
+		IdfWriter & Idf,
+		ModelSize const & Size
+	)
+	{
+		for ( int LoopNum = 1; LoopNum <= Size.AirLoops; ++LoopNum ) {
+			std::string const Loop( AirLoopName( LoopNum ) );
+			std::vector< int > const Zones( ZonesOfAirLoop( Size, LoopNum ) );
+			double const AirFlow( ZoneAirFlow * Zones.size() );
+			bool const WaterCoil( Size.PlantLoops > 0 );
+
+			Idf.Object( "AirLoopHVAC" );
+			Idf.Field( Loop, "Name" );
+			Idf.Field( WaterCoil ? Loop + " Controllers" : "", "Controller List Name" );
+			Idf.Field( "", "Availability Manager List Name" );
+			Idf.Field( Num( AirFlow ), "Design Supply Air Flow Rate {m3/s}" );
+			Idf.Field( Loop + " Branches", "Branch List Name" );
+			Idf.Field( "", "Connector List Name" );
+			Idf.Field( Loop + " Supply Inlet", "Supply Side Inlet Node Name" );
+			Idf.Field( Loop + " Demand Outlet", "Demand Side Outlet Node Name" );
+			Idf.Field( Loop + " Demand Inlet", "Demand Side Inlet Node Names" );
+			Idf.Field( Loop + " Supply Outlet", "Supply Side Outlet Node Names" );
+			Idf.End();
+
+			WriteNameList( Idf, "BranchList", Loop + " Branches", { Loop + " Main Branch" }, "Branch" );
+			WriteBranch( Idf, Loop + " Main Branch", {
+				{ "Fan:ConstantVolume", Loop + " Fan", Loop + " Supply Inlet", Loop + " Fan Outlet" },
+				{ WaterCoil ? "Coil:Heating:Water" : "Coil:Heating:Gas", Loop + " Heating Coil", Loop + " Fan Outlet", Loop + " Supply Outlet" } } );
+
+			Idf.Object( "Fan:ConstantVolume" );
+			Idf.Field( Loop + " Fan", "Name" );
+			Idf.Field( "Always On", "Availability Schedule Name" );
+			Idf.Field( "0.7", "Fan Total Efficiency" );
+			Idf.Field( "600", "Pressure Rise {Pa}" );
+			Idf.Field( Num( AirFlow ), "Maximum Flow Rate {m3/s}" );
+			Idf.Field( "0.9", "Motor Efficiency" );
+			Idf.Field( "1", "Motor In Airstream Fraction" );
+			Idf.Field( Loop + " Supply Inlet", "Air Inlet Node Name" );
+			Idf.Field( Loop + " Fan Outlet", "Air Outlet Node Name" );
+			Idf.End();
+
+			if ( WaterCoil ) {
+				Idf.Object( "Coil:Heating:Water" );
+				Idf.Field( Loop + " Heating Coil", "Name" );
+				Idf.Field( "Always On", "Availability Schedule Name" );
+				Idf.Field( Num( CoilUA * Zones.size() ), "U-Factor Times Area Value {W/K}" );
+				Idf.Field( Num( CoilWaterFlow * Zones.size() ), "Maximum Water Flow Rate {m3/s}" );
+				Idf.Field( Loop + " Heating Coil Water Inlet", "Water Inlet Node Name" );
+				Idf.Field( Loop + " Heating Coil Water Outlet", "Water Outlet Node Name" );
+				Idf.Field( Loop + " Fan Outlet", "Air Inlet Node Name" );
+				Idf.Field( Loop + " Supply Outlet", "Air Outlet Node Name" );
+				Idf.Field( "UFactorTimesAreaAndDesignWaterFlowRate", "Performance Input Method" );
+				Idf.End();
+
+				Idf.Object( "AirLoopHVAC:ControllerList" );
+				Idf.Field( Loop + " Controllers", "Name" );
+				Idf.Field( "Controller:WaterCoil", "Controller 1 Object Type" );
+				Idf.Field( Loop + " Heating Coil Controller", "Controller 1 Name" );
+				Idf.End();
+
+				Idf.Object( "Controller:WaterCoil" );
+				Idf.Field( Loop + " Heating Coil Controller", "Name" );
+				Idf.Field( "Temperature", "Control Variable" );
+				Idf.Field( "Normal", "Action" );
+				Idf.Field( "Flow", "Actuator Variable" );
+				Idf.Field( Loop + " Supply Outlet", "Sensor Node Name" );
+				Idf.Field( Loop + " Heating Coil Water Inlet", "Actuator Node Name" );
+				Idf.Field( "0.01", "Controller Convergence Tolerance {deltaC}" );
+				Idf.Field( Num( CoilWaterFlow * Zones.size() ), "Maximum Actuated Flow {m3/s}" );
+				Idf.Field( "0", "Minimum Actuated Flow {m3/s}" );
+				Idf.End();
+			} else {
+				Idf.Object( "Coil:Heating:Gas" );
+				Idf.Field( Loop + " Heating Coil", "Name" );
+				Idf.Field( "Always On", "Availability Schedule Name" );
+				Idf.Field( "0.8", "Gas Burner Efficiency" );
+				Idf.Field( Num( HeatingCapacity * Zones.size() ), "Nominal Capacity {W}" );
+				Idf.Field( Loop + " Fan Outlet", "Air Inlet Node Name" );
+				Idf.Field( Loop + " Supply Outlet", "Air Outlet Node Name" );
+				Idf.Field( Loop + " Supply Outlet", "Temperature Setpoint Node Name" );
+				Idf.End();
+			}
+
+			Idf.Object( "SetpointManager:Scheduled" );
+			Idf.Field( Loop + " Supply Air Temperature Manager", "Name" );
+			Idf.Field( "Temperature", "Control Variable" );
+			Idf.Field( "Supply Air Temperature", "Schedule Name" );
+			Idf.Field( Loop + " Supply Outlet", "Setpoint Node or NodeList Name" );
+			Idf.End();
+
+			// The demand side: a splitter to the zone terminals and a mixer of the zone returns
+			std::vector< std::string > SupplyNodes;
+			std::vector< std::string > ReturnNodes;
+			for ( int const ZoneNum : Zones ) {
+				SupplyNodes.push_back( ZoneName( ZoneNum ) + " Supply Inlet" );
+				ReturnNodes.push_back( ZoneName( ZoneNum ) + " Return Outlet" );
+			}
+
+			Idf.Object( "AirLoopHVAC:SupplyPath" );
+			Idf.Field( Loop + " Supply Path", "Name" );
+			Idf.Field( Loop + " Demand Inlet", "Supply Air Path Inlet Node Name" );
+			Idf.Field( "AirLoopHVAC:ZoneSplitter", "Component 1 Object Type" );
+			Idf.Field( Loop + " Zone Splitter", "Component 1 Name" );
+			Idf.End();
+
+			Idf.Object( "AirLoopHVAC:ZoneSplitter" );
+			Idf.Field( Loop + " Zone Splitter", "Name" );
+			Idf.Field( Loop + " Demand Inlet", "Inlet Node Name" );
+			for ( std::size_t i = 0; i < SupplyNodes.size(); ++i ) Idf.Field( SupplyNodes[ i ], "Outlet " + std::to_string( i + 1 ) + " Node Name" );
+			Idf.End();
+
+			Idf.Object( "AirLoopHVAC:ReturnPath" );
+			Idf.Field( Loop + " Return Path", "Name" );
+			Idf.Field( Loop + " Demand Outlet", "Return Air Path Outlet Node Name" );
+			Idf.Field( "AirLoopHVAC:ZoneMixer", "Component 1 Object Type" );
+			Idf.Field( Loop + " Zone Mixer", "Component 1 Name" );
+			Idf.End();
+
+			Idf.Object( "AirLoopHVAC:ZoneMixer" );
+			Idf.Field( Loop + " Zone Mixer", "Name" );
+			Idf.Field( Loop + " Demand Outlet", "Outlet Node Name" );
+			for ( std::size_t i = 0; i < ReturnNodes.size(); ++i ) Idf.Field( ReturnNodes[ i ], "Inlet " + std::to_string( i + 1 ) + " Node Name" );
+			Idf.End();
+		}
+
+		// The zone equipment, for the zones served by an air loop
+		for ( int ZoneNum = 1; ZoneNum <= ( Size.AirLoops > 0 ? Size.Zones : 0 ); ++ZoneNum ) {
+			std::string const Zone( ZoneName( ZoneNum ) );
+			Idf.Object( "ZoneHVAC:EquipmentConnections" );
+			Idf.Field( Zone, "Zone Name" );
+			Idf.Field( Zone + " Equipment", "Zone Conditioning Equipment List Name" );
+			Idf.Field( Zone + " Supply Inlet", "Zone Air Inlet Node or NodeList Name" );
+			Idf.Field( "", "Zone Air Exhaust Node or NodeList Name" );
+			Idf.Field( Zone + " Air Node", "Zone Air Node Name" );
+			Idf.Field( Zone + " Return Outlet", "Zone Return Air Node Name" );
+			Idf.End();
+
+			Idf.Object( "ZoneHVAC:EquipmentList" );
+			Idf.Field( Zone + " Equipment", "Name" );
+			Idf.Field( "AirTerminal:SingleDuct:Uncontrolled", "Zone Equipment 1 Object Type" );
+			Idf.Field( Zone + " Terminal", "Zone Equipment 1 Name" );
+			Idf.Field( "1", "Zone Equipment 1 Cooling Sequence" );
+			Idf.Field( "1", "Zone Equipment 1 Heating or No-Load Sequence" );
+			Idf.End();
+
+			Idf.Object( "AirTerminal:SingleDuct:Uncontrolled" );
+			Idf.Field( Zone + " Terminal", "Name" );
+			Idf.Field( "Always On", "Availability Schedule Name" );
+			Idf.Field( Zone + " Supply Inlet", "Zone Supply Air Node Name" );
+			Idf.Field( Num( ZoneAirFlow ), "Maximum Air Flow Rate {m3/s}" );
+			Idf.End();
+		}
+	}
+
+	void
+	WritePlantLoops(
+		IdfWriter & Idf,
+		ModelSize const & Size
+	)
+	{
+		for ( int LoopNum = 1; LoopNum <= Size.PlantLoops; ++LoopNum ) {
+			std::string const Loop( PlantLoopName( LoopNum ) );
+			int const Zones( ZonesOfPlantLoop( Size, LoopNum ) );
+			std::string const WaterFlow( Num( CoilWaterFlow * Zones ) );
+
+			Idf.Object( "PlantLoop" );
+			Idf.Field( Loop, "Name" );
+			Idf.Field( "Water", "Fluid Type" );
+			Idf.Field( "", "User Defined Fluid Type" );
+			Idf.Field( Loop + " Operation", "Plant Equipment Operation Scheme Name" );
+			Idf.Field( Loop + " Supply Outlet", "Loop Temperature Setpoint Node Name" );
+			Idf.Field( "100", "Maximum Loop Temperature {C}" );
+			Idf.Field( "10", "Minimum Loop Temperature {C}" );
+			Idf.Field( WaterFlow, "Maximum Loop Flow Rate {m3/s}" );
+			Idf.Field( "0", "Minimum Loop Flow Rate {m3/s}" );
+			Idf.Field( "autocalculate", "Plant Loop Volume {m3}" );
+			Idf.Field( Loop + " Supply Inlet", "Plant Side Inlet Node Name" );
+			Idf.Field( Loop + " Supply Outlet", "Plant Side Outlet Node Name" );
+			Idf.Field( Loop + " Supply Branches", "Plant Side Branch List Name" );
+			Idf.Field( Loop + " Supply Connectors", "Plant Side Connector List Name" );
+			Idf.Field( Loop + " Demand Inlet", "Demand Side Inlet Node Name" );
+			Idf.Field( Loop + " Demand Outlet", "Demand Side Outlet Node Name" );
+			Idf.Field( Loop + " Demand Branches", "Demand Side Branch List Name" );
+			Idf.Field( Loop + " Demand Connectors", "Demand Side Connector List Name" );
+			Idf.Field( "SequentialLoad", "Load Distribution Scheme" );
+			Idf.Field( "", "Availability Manager List Name" );
+			Idf.Field( "SingleSetPoint", "Plant Loop Demand Calculation Scheme" );
+			Idf.End();
+
+			Idf.Object( "SetpointManager:Scheduled" );
+			Idf.Field( Loop + " Temperature Manager", "Name" );
+			Idf.Field( "Temperature", "Control Variable" );
+			Idf.Field( "Hot Water Temperature", "Schedule Name" );
+			Idf.Field( Loop + " Supply Outlet", "Setpoint Node or NodeList Name" );
+			Idf.End();
+
+			Idf.Object( "PlantEquipmentOperationSchemes" );
+			Idf.Field( Loop + " Operation", "Name" );
+			Idf.Field( "PlantEquipmentOperation:HeatingLoad", "Control Scheme 1 Object Type" );
+			Idf.Field( Loop + " Heating Operation", "Control Scheme 1 Name" );
+			Idf.Field( "Always On", "Control Scheme 1 Schedule Name" );
+			Idf.End();
+
+			Idf.Object( "PlantEquipmentOperation:HeatingLoad" );
+			Idf.Field( Loop + " Heating Operation", "Name" );
+			Idf.Field( "0", "Load Range 1 Lower Limit {W}" );
+			Idf.Field( "1000000000000000", "Load Range 1 Upper Limit {W}" );
+			Idf.Field( Loop + " Equipment", "Range 1 Equipment List Name" );
+			Idf.End();
+
+			Idf.Object( "PlantEquipmentList" );
+			Idf.Field( Loop + " Equipment", "Name" );
+			Idf.Field( "Boiler:HotWater", "Equipment 1 Object Type" );
+			Idf.Field( Loop + " Boiler", "Equipment 1 Name" );
+			Idf.End();
+
+			// The supply side: the pump, the boiler beside a bypass, and an outlet pipe
+			WriteNameList( Idf, "BranchList", Loop + " Supply Branches", { Loop + " Supply Inlet Branch", Loop + " Boiler Branch", Loop + " Supply Bypass Branch", Loop + " Supply Outlet Branch" }, "Branch" );
+			WriteBranch( Idf, Loop + " Supply Inlet Branch", { { "Pump:ConstantSpeed", Loop + " Pump", Loop + " Supply Inlet", Loop + " Pump Outlet" } } );
+			WriteBranch( Idf, Loop + " Boiler Branch", { { "Boiler:HotWater", Loop + " Boiler", Loop + " Boiler Inlet", Loop + " Boiler Outlet" } } );
+			WriteBranch( Idf, Loop + " Supply Bypass Branch", { { "Pipe:Adiabatic", Loop + " Supply Bypass Pipe", Loop + " Supply Bypass Inlet", Loop + " Supply Bypass Outlet" } } );
+			WriteBranch( Idf, Loop + " Supply Outlet Branch", { { "Pipe:Adiabatic", Loop + " Supply Outlet Pipe", Loop + " Supply Outlet Pipe Inlet", Loop + " Supply Outlet" } } );
+
+			Idf.Object( "Pump:ConstantSpeed" );
+			Idf.Field( Loop + " Pump", "Name" );
+			Idf.Field( Loop + " Supply Inlet", "Inlet Node Name" );
+			Idf.Field( Loop + " Pump Outlet", "Outlet Node Name" );
+			Idf.Field( WaterFlow, "Rated Flow Rate {m3/s}" );
+			Idf.Field( "179352", "Rated Pump Head {Pa}" );
+			Idf.Field( Num( 400.0 * CoilWaterFlow * Zones / 0.001 ), "Rated Power Consumption {W}" );
+			Idf.Field( "0.9", "Motor Efficiency" );
+			Idf.Field( "0", "Fraction of Motor Inefficiencies to Fluid Stream" );
+			Idf.Field( "Intermittent", "Pump Control Type" );
+			Idf.End();
+
+			Idf.Object( "Boiler:HotWater" );
+			Idf.Field( Loop + " Boiler", "Name" );
+			Idf.Field( "NaturalGas", "Fuel Type" );
+			Idf.Field( Num( HeatingCapacity * Zones ), "Nominal Capacity {W}" );
+			Idf.Field( "0.8", "Nominal Thermal Efficiency" );
+			Idf.Field( "LeavingBoiler", "Efficiency Curve Temperature Evaluation Variable" );
+			Idf.Field( "", "Normalized Boiler Efficiency Curve Name" );
+			Idf.Field( "80", "Design Water Outlet Temperature {C}" );
+			Idf.Field( WaterFlow, "Design Water Flow Rate {m3/s}" );
+			Idf.Field( "0", "Minimum Part Load Ratio" );
+			Idf.Field( "1.1", "Maximum Part Load Ratio" );
+			Idf.Field( "1", "Optimum Part Load Ratio" );
+			Idf.Field( Loop + " Boiler Inlet", "Boiler Water Inlet Node Name" );
+			Idf.Field( Loop + " Boiler Outlet", "Boiler Water Outlet Node Name" );
+			Idf.Field( "100", "Water Outlet Upper Temperature Limit {C}" );
+			Idf.Field( "LeavingSetpointModulated", "Boiler Flow Mode" );
+			Idf.Field( "0", "Parasitic Electric Load {W}" );
+			Idf.End();
+
+			// The demand side: an inlet pipe, the heating coils of the air loops beside a bypass, and an outlet pipe
+			std::vector< std::string > DemandBranches( 1, Loop + " Demand Inlet Branch" );
+			for ( int const AirLoopNum : AirLoopsOfPlantLoop( Size, LoopNum ) ) DemandBranches.push_back( AirLoopName( AirLoopNum ) + " Heating Coil Branch" );
+			DemandBranches.push_back( Loop + " Demand Bypass Branch" );
+			DemandBranches.push_back( Loop + " Demand Outlet Branch" );
+			WriteNameList( Idf, "BranchList", Loop + " Demand Branches", DemandBranches, "Branch" );
+			WriteBranch( Idf, Loop + " Demand Inlet Branch", { { "Pipe:Adiabatic", Loop + " Demand Inlet Pipe", Loop + " Demand Inlet", Loop + " Demand Inlet Pipe Outlet" } } );
+			for ( int const AirLoopNum : AirLoopsOfPlantLoop( Size, LoopNum ) ) {
+				std::string const AirLoop( AirLoopName( AirLoopNum ) );
+				WriteBranch( Idf, AirLoop + " Heating Coil Branch", { { "Coil:Heating:Water", AirLoop + " Heating Coil", AirLoop + " Heating Coil Water Inlet", AirLoop + " Heating Coil Water Outlet" } } );
+			}
+			WriteBranch( Idf, Loop + " Demand Bypass Branch", { { "Pipe:Adiabatic", Loop + " Demand Bypass Pipe", Loop + " Demand Bypass Inlet", Loop + " Demand Bypass Outlet" } } );
+			WriteBranch( Idf, Loop + " Demand Outlet Branch", { { "Pipe:Adiabatic", Loop + " Demand Outlet Pipe", Loop + " Demand Outlet Pipe Inlet", Loop + " Demand Outlet" } } );
+
+			char const * const Sides[] = { "Supply", "Demand" };
+			for ( auto const Side : Sides ) {
+				std::string const Prefix( Loop + ' ' + Side );
+				std::vector< std::string > Parallel;
+				if ( Side[ 0 ] == 'S' ) {
+					Parallel = { Loop + " Boiler Branch", Loop + " Supply Bypass Branch" };
+				} else {
+					Parallel.assign( DemandBranches.begin() + 1, DemandBranches.end() - 1 );
+				}
+
+				Idf.Object( "ConnectorList" );
+				Idf.Field( Prefix + " Connectors", "Name" );
+				Idf.Field( "Connector:Splitter", "Connector 1 Object Type" );
+				Idf.Field( Prefix + " Splitter", "Connector 1 Name" );
+				Idf.Field( "Connector:Mixer", "Connector 2 Object Type" );
+				Idf.Field( Prefix + " Mixer", "Connector 2 Name" );
+				Idf.End();
+
+				Idf.Object( "Connector:Splitter" );
+				Idf.Field( Prefix + " Splitter", "Name" );
+				Idf.Field( Prefix + " Inlet Branch", "Inlet Branch Name" );
+				for ( std::size_t i = 0; i < Parallel.size(); ++i ) Idf.Field( Parallel[ i ], "Outlet Branch " + std::to_string( i + 1 ) + " Name" );
+				Idf.End();
+
+				Idf.Object( "Connector:Mixer" );
+				Idf.Field( Prefix + " Mixer", "Name" );
+				Idf.Field( Prefix + " Outlet Branch", "Outlet Branch Name" );
+				for ( std::size_t i = 0; i < Parallel.size(); ++i ) Idf.Field( Parallel[ i ], "Inlet Branch " + std::to_string( i + 1 ) + " Name" );
+				Idf.End();
+			}
+
+			char const * const Pipes[] = { " Supply Bypass Pipe", " Supply Outlet Pipe", " Demand Inlet Pipe", " Demand Bypass Pipe", " Demand Outlet Pipe" };
+			char const * const PipeInlets[] = { " Supply Bypass Inlet", " Supply Outlet Pipe Inlet", " Demand Inlet", " Demand Bypass Inlet", " Demand Outlet Pipe Inlet" };
+			char const * const PipeOutlets[] = { " Supply Bypass Outlet", " Supply Outlet", " Demand Inlet Pipe Outlet", " Demand Bypass Outlet", " Demand Outlet" };
+			for ( int i = 0; i < 5; ++i ) {
+				Idf.Object( "Pipe:Adiabatic" );
+				Idf.Field( Loop + Pipes[ i ], "Name" );
+				Idf.Field( Loop + PipeInlets[ i ], "Inlet Node Name" );
+				Idf.Field( Loop + PipeOutlets[ i ], "Outlet Node Name" );
+				Idf.End();
+			}
+		}
+	}
+
+	void
+	WriteOutputs( IdfWriter & Idf )
+	{
+		Idf.Object( "Output:Variable" );
+		Idf.Field( "*", "Key Value" );
+		Idf.Field( "Zone Mean Air Temperature", "Variable Name" );
+		Idf.Field( "Hourly", "Reporting Frequency" );
+		Idf.End();
+	}
+
+	bool
+	ParseOption(
+		std::string const & Arg,
+		std::string const & Option,
+		int & Value
+	)
+	{
+		std::string const Prefix( "--" + Option + '=' );
+		if ( Arg.compare( 0, Prefix.size(), Prefix ) != 0 ) return false;
+		char * End( nullptr );
+		long const Parsed( std::strtol( Arg.c_str() + Prefix.size(), &End, 10 ) );
+		if ( End == Arg.c_str() + Prefix.size() || *End != '\0' || Parsed < 0 || Parsed > 1000000 ) {
+			std::cerr << "ScalingModelGenerator: invalid value in " << Arg << '\n';
+			std::exit( EXIT_FAILURE );
+		}
+		Value = int( Parsed );
+		return true;
+	}
+
+	void
+	Usage()
+	{
+		std::cerr << "Usage: ScalingModelGenerator [--zones=N] [--surfaces=M] [--shading=K] [--airloops=L] [--plantloops=P] <output file>\n";
+	}
+
+}
+
+int
+main(
+	int argc,
+	char * argv[]
+)
+{
+	ModelSize Size;
+	std::string OutputFile;
+	for ( int i = 1; i < argc; ++i ) {
+		std::string const Arg( argv[ i ] );
+		if ( ParseOption( Arg, "zones", Size.Zones ) ) continue;
+		if ( ParseOption( Arg, "surfaces", Size.Surfaces ) ) continue;
+		if ( ParseOption( Arg, "shading", Size.Shading ) ) continue;
+		if ( ParseOption( Arg, "airloops", Size.AirLoops ) ) continue;
+		if ( ParseOption( Arg, "plantloops", Size.PlantLoops ) ) continue;
+		if ( Arg.compare( 0, 2, "--" ) == 0 || ! OutputFile.empty() ) {
+			Usage();
+			return EXIT_FAILURE;
+		}
+		OutputFile = Arg;
+	}
+	if ( OutputFile.empty() ) {
+		Usage();
+		return EXIT_FAILURE;
+	}
+	if ( Size.Zones < 1 ) {
+		std::cerr << "ScalingModelGenerator: the model needs at least one zone\n";
+		return EXIT_FAILURE;
+	}
+	if ( Size.Surfaces < 6 ) {
+		std::cerr << "ScalingModelGenerator: a zone needs at least 6 surfaces, a floor, a roof and four walls\n";
+		return EXIT_FAILURE;
+	}
+	if ( Size.AirLoops > Size.Zones ) {
+		std::cerr << "ScalingModelGenerator: each air loop needs at least one zone, so there can be at most " << Size.Zones << " air loops\n";
+		return EXIT_FAILURE;
+	}
+	if ( Size.PlantLoops > Size.AirLoops ) {
+		std::cerr << "ScalingModelGenerator: each plant loop needs at least one air loop heating coil, so there can be at most " << Size.AirLoops << " plant loops\n";
+		return EXIT_FAILURE;
+	}
+
+	std::ofstream Stream( OutputFile );
+	if ( ! Stream ) {
+		std::cerr << "ScalingModelGenerator: could not open " << OutputFile << " for output\n";
+		return EXIT_FAILURE;
+	}
+	Stream << "! Scaling model: " << Size.Zones << " zones, " << Size.Surfaces << " surfaces per zone, " << Size.Shading << " shading surfaces, " << Size.AirLoops << " air loops, " << Size.PlantLoops << " plant loops\n";
+	Stream << "! Written by ScalingModelGenerator\n\n";
+
+	IdfWriter Idf( Stream );
+	WriteSimulationObjects( Idf );
+	WriteConstructions( Idf );
+	WriteZones( Idf, Size );
+	WriteShading( Idf, Size );
+	WriteAirLoops( Idf, Size );
+	WritePlantLoops( Idf, Size );
+	WriteOutputs( Idf );
+
+	if ( ! Stream ) {
+		std::cerr << "ScalingModelGenerator: could not write " << OutputFile << '\n';
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -125,6 +125,12 @@ int SERVER_VERSION = 0;
 
 // Global variable to check for FMUExport case
 int FMUEXPORT = 0;
+
+// Set to 1 once the server accepted the binary protocol
+int BINARY_PROTOCOL = 0;
+// Frame buffer of the binary protocol, kept from one exchange to the next
+static char *BINARY_BUFFER = NULL;
+static int BINARY_BUFFER_LENGTH = 0;
 ////////////////////////////////////////////////////////////////
 /// Appends a character array to another character array.
 ///
@@ -643,9 +649,202 @@ int establishclientsocket(const char *const docname){
   // or read from the buffer
   REQUIRED_READ_LENGTH  = 0;
   REQUIRED_WRITE_LENGTH = 0;
+  BINARY_PROTOCOL = 0;
   return sockfd;
 }
 
+/////////////////////////////////////////////////////////////////
+/// Sends a whole character buffer to the socket.
+///
+///\param sockfd The socket file descripter.
+///\param buffer The characters to send.
+///\param nCha The number of characters to send.
+///\return The number of characters sent, or a negative value if an error occured.
+static int sendall(const int sockfd, const char *buffer, const int nCha){
+  int nSen = 0;
+  int retVal;
+  while ( nSen < nCha ){
+    retVal = send(sockfd, buffer + nSen, nCha - nSen, 0);
+    if ( retVal < 0 ){
+      fprintf(stderr, "Error: Unspecified error when writing to socket.\n");
+      return retVal;
+    }
+    nSen += retVal;
+  }
+  return nSen;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Receives a given number of characters from the socket.
+///
+///\param sockfd The socket file descripter.
+///\param buffer The buffer into which the characters will be written.
+///\param nCha The number of characters to receive.
+///\return The number of characters received, or a negative value if an error occured.
+static int recvall(const int sockfd, char *buffer, const int nCha){
+  int nRec = 0;
+  int retVal;
+  while ( nRec < nCha ){
+    retVal = recv(sockfd, buffer + nRec, nCha - nRec, 0);
+    if ( retVal == 0 ){
+      fprintf(stderr, "Error: The server closed the socket while the client was reading.\n");
+      return -1;
+    }
+    if ( retVal < 0 ){
+      fprintf(stderr, "Error: Unspecified error when reading from socket.\n");
+      return retVal;
+    }
+    nRec += retVal;
+  }
+  return nRec;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Asks the server to exchange binary frames instead of text.
+///
+/// The client sends the line "binary <version> <little|big>\n", with
+/// its main version number and byte order. The server accepts by sending
+/// the same line back; any other line keeps the text protocol.
+/// In the binary protocol, each message is one frame of five \c int
+/// (version, flag, number of doubles, integers and booleans), the
+/// simulation time as a \c double, and the double values, all in the
+/// byte order of the client.
+/// This method must be called after \c establishclientsocket and
+/// before the first exchange.
+///
+///\param sockfd Socket file descripter
+///\return 1 if the server accepted the binary protocol, 0 if it did not,
+///        or a negative value if an error occured.
+int negotiatebinaryprotocol(const int *sockfd){
+  char request[BUFFER_LENGTH];
+  char reply[BUFFER_LENGTH];
+  const int one = 1;
+  int i, retVal;
+  BINARY_PROTOCOL = 0;
+  if (*sockfd < 0 ){
+    fprintf(stderr, "Error: Called negotiatebinaryprotocol with negative socket number.\n");
+    return -1;
+  }
+  sprintf(request, "binary %d %s\n", MAINVERSION,
+	  ( *(const char *)&one == 1 ) ? "little" : "big");
+  retVal = sendall(*sockfd, request, strlen(request));
+  if ( retVal < 0 )
+    return retVal;
+  memset(reply, '\0', BUFFER_LENGTH);
+  for(i = 0; i < BUFFER_LENGTH - 1; i++){
+    retVal = recvall(*sockfd, &reply[i], 1);
+    if ( retVal < 0 )
+      return retVal;
+    if ( reply[i] == '\n' )
+      break;
+  }
+#ifdef NDEBUG
+  if (f1 != NULL)
+    fprintf(f1, "Binary protocol request: %sServer reply: %s\n", request, reply);
+#endif
+  if ( 0 == strcmp(request, reply) )
+    BINARY_PROTOCOL = 1;
+  return BINARY_PROTOCOL;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Writes one binary frame to the socket.
+///
+/// The frame is assembled in a buffer that is kept from one call
+/// to the next, and sent in one piece.
+///
+///\param sockfd Socket file descripter
+///\param flaWri Communication flag to write to the socket stream.
+///\param nDblWri Number of double values to write.
+///\param nIntWri Number of integer values to write.
+///\param nBooWri Number of boolean values to write.
+///\param curSimTim Current simulation time in seconds.
+///\param dblValWri Double values to write.
+///\return The number of characters sent, or a negative value if an error occured.
+static int writebinarytosocket(const int *sockfd,
+			       const int *flaWri,
+			       const int *nDblWri, const int *nIntWri, const int *nBooWri,
+			       double *curSimTim,
+			       double dblValWri[]){
+  int header[5];
+  double tim = 0;
+  int nCha;
+  char *newBuffer;
+  if ( ( *nIntWri > 0 ) || ( *nBooWri > 0 ) ){
+    fprintf(stderr, "Error: Integers and booleans are currently not\n");
+    fprintf(stderr, "       implemented in the binary protocol of utilSocket.\n");
+    return -1;
+  }
+  header[0] = MAINVERSION;
+  header[1] = *flaWri;
+  header[2] = 0;
+  header[3] = 0;
+  header[4] = 0;
+  // As in the text protocol, only a zero flag carries data
+  if ( *flaWri == 0 ){
+    header[2] = *nDblWri;
+    tim = *curSimTim;
+  }
+  nCha = sizeof(header) + sizeof(double) * (1 + header[2]);
+  if ( BINARY_BUFFER_LENGTH < nCha ){
+    newBuffer = realloc(BINARY_BUFFER, nCha);
+    if (newBuffer == NULL) {
+      perror("realloc failed in writebinarytosocket.");
+      return -1;
+    }
+    BINARY_BUFFER = newBuffer;
+    BINARY_BUFFER_LENGTH = nCha;
+  }
+  memcpy(BINARY_BUFFER, header, sizeof(header));
+  memcpy(BINARY_BUFFER + sizeof(header), &tim, sizeof(double));
+  if ( header[2] > 0 )
+    memcpy(BINARY_BUFFER + sizeof(header) + sizeof(double), dblValWri, sizeof(double) * header[2]);
+  return sendall(*sockfd, BINARY_BUFFER, nCha);
+}
+
+/////////////////////////////////////////////////////////////////
+/// Reads one binary frame from the socket.
+///
+/// The double values are received directly into \c dblValRea.
+///
+///\param sockfd Socket file descripter
+///\param flaRea Communication flag read from the socket stream.
+///\param nDblRea Number of double values read.
+///\param nIntRea Number of integer values read.
+///\param nBooRea Number of boolean values read.
+///\param curSimTim Current simulation time in seconds read from socket.
+///\param dblValRea Double values read from socket.
+///\return 0 if no error occurred.
+static int readbinaryfromsocket(const int *sockfd, int *flaRea,
+				int *nDblRea, int *nIntRea, int *nBooRea,
+				double *curSimTim,
+				double dblValRea[]){
+  int header[5];
+  char headerBuffer[sizeof(header) + sizeof(double)];
+  int retVal;
+  retVal = recvall(*sockfd, headerBuffer, sizeof(headerBuffer));
+  if ( retVal < 0 )
+    return retVal;
+  memcpy(header, headerBuffer, sizeof(header));
+  memcpy(curSimTim, headerBuffer + sizeof(header), sizeof(double));
+  SERVER_VERSION = header[0];
+  *flaRea  = header[1];
+  *nDblRea = header[2];
+  *nIntRea = header[3];
+  *nBooRea = header[4];
+  if ( ( *nDblRea < 0 ) || ( *nIntRea != 0 ) || ( *nBooRea != 0 ) ){
+    fprintf(stderr, "Error: Received a binary frame with %d doubles, %d integers and %d booleans.\n",
+	    *nDblRea, *nIntRea, *nBooRea);
+    return -1;
+  }
+  if ( *nDblRea > 0 ){
+    retVal = recvall(*sockfd, (char *) dblValRea, sizeof(double) * (*nDblRea));
+    if ( retVal < 0 )
+      return retVal;
+  }
+  return 0;
+}
+
 /////////////////////////////////////////////////////////////////
 /// Writes data to the socket.
 ///
@@ -694,6 +893,10 @@ if (*sockfd < 0 ){
     return -1; // return a negative value in case of an error
   }
 
+  if ( BINARY_PROTOCOL )
+    return writebinarytosocket(sockfd, flaWri, nDblWri, nIntWri, nBooWri,
+			       curSimTim, dblValWri);
+
   /////////////////////////////////////////////////////
   // allocate storage for buffer
 #ifdef NDEBUG
@@ -780,6 +983,7 @@ int sendclientmessage(const int *sockfd, const int *flaWri){
   int zI = 0;
   int retVal = 0;
   double zD = 0;
+  char ackBuf[5 * sizeof(int) + sizeof(double)];
   int bufLen = HEADER_LENGTH;
   char inpBuf[HEADER_LENGTH];
   memset(inpBuf, '\0', HEADER_LENGTH);
@@ -795,7 +999,11 @@ int sendclientmessage(const int *sockfd, const int *flaWri){
       // No error. Wait for acknowledgement. This is needed on Windows for E+.
       // Otherwise, E+ sometimes terminates and breaks the socket connection before
       // Ptolemy read the message.
-      retVal = readbufferfromsocket(sockfd, inpBuf, &bufLen);
+      // In the binary protocol, the acknowledgement is a frame without values.
+      if ( BINARY_PROTOCOL )
+        retVal = recvall(*sockfd, ackBuf, sizeof(ackBuf));
+      else
+        retVal = readbufferfromsocket(sockfd, inpBuf, &bufLen);
     }
   }
   else
@@ -912,6 +1120,9 @@ int readfromsocket(const int *sockfd, int *flaRea,
 #endif
     return -1; // return a negative value in case of an error
   }
+  if ( BINARY_PROTOCOL )
+    return readbinaryfromsocket(sockfd, flaRea, nDblRea, nIntRea, nBooRea,
+				curSimTim, dblValRea);
   // In the first call, set the socket buffer length
   // This is done here since we know how many data we need to read.
   if ( REQUIRED_READ_LENGTH < 1 ){
@@ -142,6 +142,9 @@ extern int REQUIRED_WRITE_LENGTH;
 /// version number of the server
 extern int SERVER_VERSION;
 
+/// Set to 1 once the server accepted the binary protocol
+extern int BINARY_PROTOCOL;
+
 ////////////////////////////////////////////////////////////////
 /// Appends a character array to another character array.
 ///
@@ -271,6 +274,20 @@ int getmainversionnumber();
 /// \return The socket file descripter, or a negative value if an error occured.
 int establishclientsocket(const char *const docname);
 
+/////////////////////////////////////////////////////////////////
+/// Asks the server to exchange binary frames instead of text.
+///
+/// The client sends the line "binary <version> <little|big>\n", with
+/// its main version number and byte order. The server accepts by sending
+/// the same line back; any other line keeps the text protocol.
+/// This method must be called after \c establishclientsocket and
+/// before the first exchange.
+///
+///\param sockfd Socket file descripter
+///\return 1 if the server accepted the binary protocol, 0 if it did not,
+///        or a negative value if an error occured.
+int negotiatebinaryprotocol(const int *sockfd);
+
 /////////////////////////////////////////////////////////////////
 /// Writes data to the socket.
 ///
@@ -0,0 +1,175 @@
+// EnergyPlus::AirflowNetworkSolver Microbenchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/AirflowNetworkSolver.hh>
+#include <EnergyPlus/DataAirflowNetwork.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::DataAirflowNetwork;
+using namespace ObjexxFCL;
+
+namespace {
+
+	int const NumZones( 40 ); // Zone nodes of the network
+	int const NumExternal( 20 ); // External nodes of the network
+
+	// Builds a multizone network of surface cracks only: each zone is linked to the next zone
+	// around a ring, to the zone five along, and to two external nodes at fixed pressures.
+	void
+	SetUpCrackNetwork()
+	{
+		int const NumNodes( NumZones + NumExternal );
+		int NumLinks( 0 );
+		for ( int z = 1; z <= NumZones; ++z ) NumLinks += ( z + 5 <= NumZones ? 4 : 3 );
+
+		AirflowNetworkNumOfNodes = NumNodes;
+		AirflowNetworkNumOfLinks = NumLinks;
+		NumOfLinksMultiZone = NumLinks;
+
+		AirflowNetworkCompData.allocate( 1 );
+		AirflowNetworkCompData( 1 ).CompTypeNum = CompTypeNum_SCR;
+		AirflowNetworkCompData( 1 ).TypeNum = 1;
+		MultizoneSurfaceCrackData.allocate( 1 );
+		MultizoneSurfaceCrackData( 1 ).FlowCoef = 0.01;
+		MultizoneSurfaceCrackData( 1 ).FlowExpo = 0.65;
+		MultizoneSurfaceCrackData( 1 ).StandardT = 20.0;
+		MultizoneSurfaceCrackData( 1 ).StandardP = 101325.0;
+		MultizoneSurfaceCrackData( 1 ).StandardW = 0.0;
+
+		std::vector< double > const ExternalPressure( UniformSamples( NumExternal, -20.0, 20.0 ) );
+		std::vector< double > const ZoneTemp( UniformSamples( NumZones, 18.0, 26.0, 7u ) );
+		AirflowNetworkNodeData.allocate( NumNodes );
+		AirflowNetworkNodeSimu.allocate( NumNodes );
+		for ( int n = 1; n <= NumNodes; ++n ) {
+			AirflowNetworkNodeData( n ).NodeTypeNum = ( n <= NumZones ? 0 : 1 );
+			AirflowNetworkNodeSimu( n ).TZ = ( n <= NumZones ? ZoneTemp[ n - 1 ] : 5.0 );
+			AirflowNetworkNodeSimu( n ).WZ = 0.006;
+			AirflowNetworkNodeSimu( n ).PZ = ( n <= NumZones ? 0.0 : ExternalPressure[ n - NumZones - 1 ] );
+		}
+
+		AirflowNetworkLinkageData.allocate( NumLinks );
+		MultizoneSurfaceData.allocate( NumLinks );
+		AirflowNetworkLinkSimu.allocate( NumLinks );
+		int i( 0 );
+		auto AddLink = [&]( int const Node1, int const Node2 ) {
+			++i;
+			AirflowNetworkLinkageData( i ).NodeNums( 1 ) = Node1;
+			AirflowNetworkLinkageData( i ).NodeNums( 2 ) = Node2;
+			AirflowNetworkLinkageData( i ).CompNum = 1;
+			MultizoneSurfaceData( i ).Factor = 0.5 + 0.1 * ( i % 10 );
+		};
+		for ( int z = 1; z <= NumZones; ++z ) {
+			AddLink( z, z % NumZones + 1 );
+			if ( z + 5 <= NumZones ) AddLink( z, z + 5 );
+			AddLink( z, NumZones + 1 + z % NumExternal );
+			AddLink( z, NumZones + 1 + ( z * 7 ) % NumExternal );
+		}
+
+		AirflowNetworkSolver::AllocateAirflowNetworkData();
+
+		std::vector< double > const StackPressure( UniformSamples( NumLinks, -2.0, 2.0, 11u ) );
+		for ( int Link = 1; Link <= NumLinks; ++Link ) {
+			AirflowNetworkSolver::DpL( Link, 1 ) = StackPressure[ Link - 1 ];
+			AirflowNetworkSolver::PS( Link ) = 0.0;
+		}
+		for ( int n = 1; n <= NumNodes; ++n ) {
+			AirflowNetworkSolver::RHOZ( n ) = Psychrometrics::PsyRhoAirFnPbTdbW( 101325.0 + AirflowNetworkSolver::PZ( n ), AirflowNetworkSolver::TZ( n ), AirflowNetworkSolver::WZ( n ) );
+			AirflowNetworkSolver::SQRTDZ( n ) = std::sqrt( AirflowNetworkSolver::RHOZ( n ) );
+			AirflowNetworkSolver::VISCZ( n ) = 1.71432e-5 + 4.828e-8 * AirflowNetworkSolver::TZ( n );
+		}
+
+		AirflowNetworkSimu.InitFlag = 0;
+		AirflowNetworkSimu.MaxIteration = 500;
+		AirflowNetworkSimu.RelTol = 1.0e-4;
+		AirflowNetworkSimu.AbsTol = 1.0e-6;
+		AirflowNetworkSimu.ConvLimit = -0.5;
+		AirflowNetworkSimu.MaxPressure = 500.0;
+	}
+
+	void
+	TearDownCrackNetwork()
+	{
+		AirflowNetworkSolver::CrackBatch = AirflowNetworkSolver::CrackBatchData();
+		AirflowNetworkSolver::SparseJacobian = AirflowNetworkSolver::SparseJacobianData();
+		AirflowNetworkSolver::JacobianFactored = false;
+		AirflowNetworkCompData.deallocate();
+		MultizoneSurfaceCrackData.deallocate();
+		AirflowNetworkNodeData.deallocate();
+		AirflowNetworkNodeSimu.deallocate();
+		AirflowNetworkLinkageData.deallocate();
+		MultizoneSurfaceData.deallocate();
+		AirflowNetworkLinkSimu.deallocate();
+		AirflowNetworkNumOfNodes = 0;
+		AirflowNetworkNumOfLinks = 0;
+		NumOfLinksMultiZone = 0;
+	}
+
+}
+
+TEST( AirflowNetworkSolverBenchmark, FILJAC )
+{
+	SetUpCrackNetwork();
+	int const NNZE( AirflowNetworkSolver::IK( AirflowNetworkNumOfNodes + 1 ) - 1 );
+
+	Real64 Sum( 0.0 );
+	TimeKernel( "FILJAC", [&]( long const ) {
+		AirflowNetworkSolver::FILJAC( NNZE, 0 );
+		Sum += AirflowNetworkSolver::SUMF( 1 );
+	} );
+	EXPECT_TRUE( std::isfinite( Sum ) );
+
+	TearDownCrackNetwork();
+}
+
+TEST( AirflowNetworkSolverBenchmark, FACSKY )
+{
+	SetUpCrackNetwork();
+	int const NumNodes( AirflowNetworkNumOfNodes );
+	auto const & IK( AirflowNetworkSolver::IK );
+	AirflowNetworkSolver::FILJAC( IK( NumNodes + 1 ) - 1, 0 );
+	Array1D< Real64 > const AU( AirflowNetworkSolver::AU );
+	Array1D< Real64 > const AD( AirflowNetworkSolver::AD );
+	Array1D< Real64 > WorkAU( AU );
+	Array1D< Real64 > WorkAD( AD );
+
+	Real64 Sum( 0.0 );
+	TimeKernel( "FACSKY", [&]( long const ) {
+		WorkAU = AU;
+		WorkAD = AD;
+		AirflowNetworkSolver::FACSKY( WorkAU, WorkAD, WorkAU, IK, NumNodes, 0 );
+		Sum += WorkAD( NumZones );
+	} );
+	EXPECT_TRUE( std::isfinite( Sum ) );
+
+	TearDownCrackNetwork();
+}
+
+TEST( AirflowNetworkSolverBenchmark, SOLVZP )
+{
+	SetUpCrackNetwork();
+
+	int TotalIterations( 0 );
+	long TotalCalls( 0 );
+	TimeKernel( "SOLVZP", [&]( long const ) {
+		for ( int n = 1; n <= NumZones; ++n ) AirflowNetworkSolver::PZ( n ) = 0.0;
+		int ITER( 0 );
+		AirflowNetworkSolver::SOLVZP( AirflowNetworkSolver::IK, AirflowNetworkSolver::AD, AirflowNetworkSolver::AU, ITER );
+		TotalIterations += ITER;
+		++TotalCalls;
+	} );
+	EXPECT_LT( TotalIterations, TotalCalls * AirflowNetworkSimu.MaxIteration ); // Every solve converged
+
+	TearDownCrackNetwork();
+}
@@ -0,0 +1,76 @@
+#ifndef EnergyPlus_Benchmark_hh_INCLUDED
+#define EnergyPlus_Benchmark_hh_INCLUDED
+
+// EnergyPlus Microbenchmark Support
+
+// C++ Headers
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+namespace EnergyPlus {
+
+namespace Benchmark {
+
+	// Calls the kernel with the call number 0, 1, 2, ... in doubling batches until MinTime seconds
+	// have passed, then prints the time per call and records it as the test property "<Name>_ns".
+	// The kernel should fold its results into a value the test checks, so that they are not
+	// optimized away.
+	template< typename Kernel >
+	double
+	TimeKernel(
+		std::string const & Name,
+		Kernel && kernel,
+		double const MinTime = 0.25 // Least time the kernel is timed (s)
+	)
+	{
+		typedef std::chrono::steady_clock Clock;
+		kernel( 0 ); // Warms the caches and any lazy initialization
+		long Calls( 0 );
+		long Batch( 1 );
+		double Elapsed( 0.0 );
+		Clock::time_point const Start( Clock::now() );
+		while ( Elapsed < MinTime ) {
+			for ( long Call = Calls, End = Calls + Batch; Call < End; ++Call ) kernel( Call );
+			Calls += Batch;
+			Batch *= 2;
+			Elapsed = std::chrono::duration< double >( Clock::now() - Start ).count();
+		}
+		double const TimePerCall( 1.0e9 * Elapsed / Calls );
+		std::printf( "[ BENCH    ] %s: %.1f ns/call (%ld calls)\n", Name.c_str(), TimePerCall, Calls );
+		::testing::Test::RecordProperty( Name + "_ns", std::to_string( TimePerCall ) );
+		return TimePerCall;
+	}
+
+	// Uniform samples in [Low,High) from a fixed seed, so that every run times the same inputs
+	inline
+	std::vector< double >
+	UniformSamples(
+		std::size_t const Count,
+		double const Low,
+		double const High,
+		unsigned const Seed = 5489u
+	)
+	{
+		std::mt19937 Generator( Seed );
+		std::uniform_real_distribution< double > Distribution( Low, High );
+		std::vector< double > Samples( Count );
+		for ( auto & Sample : Samples ) Sample = Distribution( Generator );
+		return Samples;
+	}
+
+	// Number of input samples cycled through by the kernels: a power of two, so that a call number
+	// masked with SampleMask picks a sample
+	std::size_t const NumSamples( 4096 );
+	long const SampleMask( 4095 );
+
+} // Benchmark
+
+} // EnergyPlus
+
+#endif
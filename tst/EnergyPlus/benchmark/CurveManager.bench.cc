@@ -0,0 +1,88 @@
+// EnergyPlus::CurveManager Microbenchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/CurveManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::CurveManager;
+
+namespace {
+
+	// The curves of a DX cooling coil: capacity and EIR against the entering wet bulb and outdoor
+	// dry bulb temperatures, their flow fraction modifiers and the part load fraction curve
+	void
+	SetupCoilCurves()
+	{
+		NumCurves = 5;
+		PerfCurve.allocate( NumCurves );
+		for ( int CurveNum = 1; CurveNum <= 2; ++CurveNum ) {
+			auto & Curve( PerfCurve( CurveNum ) );
+			Curve.CurveType = BiQuadratic;
+			Curve.Coeff1 = ( CurveNum == 1 ? 0.942587793 : 0.342414409 );
+			Curve.Coeff2 = ( CurveNum == 1 ? 0.009543347 : 0.034885008 );
+			Curve.Coeff3 = ( CurveNum == 1 ? 0.000683770 : -0.000623700 );
+			Curve.Coeff4 = ( CurveNum == 1 ? -0.011042676 : 0.004977216 );
+			Curve.Coeff5 = ( CurveNum == 1 ? 0.000005249 : 0.000437951 );
+			Curve.Coeff6 = ( CurveNum == 1 ? -0.000009720 : -0.000728028 );
+			Curve.Var1Min = 12.77778;
+			Curve.Var1Max = 23.88889;
+			Curve.Var2Min = 18.0;
+			Curve.Var2Max = 46.11111;
+		}
+		for ( int CurveNum = 3; CurveNum <= 4; ++CurveNum ) {
+			auto & Curve( PerfCurve( CurveNum ) );
+			Curve.CurveType = Quadratic;
+			Curve.Coeff1 = ( CurveNum == 3 ? 0.8 : 1.1552 );
+			Curve.Coeff2 = ( CurveNum == 3 ? 0.2 : -0.1808 );
+			Curve.Coeff3 = ( CurveNum == 3 ? 0.0 : 0.0256 );
+			Curve.Var1Min = 0.5;
+			Curve.Var1Max = 1.5;
+		}
+		auto & Curve( PerfCurve( 5 ) );
+		Curve.CurveType = Quadratic;
+		Curve.Coeff1 = 0.85;
+		Curve.Coeff2 = 0.15;
+		Curve.Var1Min = 0.0;
+		Curve.Var1Max = 1.0;
+		Curve.CurveMinPresent = true;
+		Curve.CurveMin = 0.7;
+		for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) {
+			PerfCurve( CurveNum ).InterpolationType = EvaluateCurveToLimits;
+		}
+	}
+
+}
+
+TEST( CurveManagerBenchmark, CurveValue )
+{
+	SetupCoilCurves();
+
+	std::vector< double > const WetBulb( UniformSamples( NumSamples, 10.0, 26.0, 1u ) );
+	std::vector< double > const OutdoorDryBulb( UniformSamples( NumSamples, 15.0, 48.0, 2u ) );
+	std::vector< double > const FlowFraction( UniformSamples( NumSamples, 0.6, 1.2, 3u ) );
+	std::vector< double > const PartLoadRatio( UniformSamples( NumSamples, 0.0, 1.0, 4u ) );
+
+	// A coil evaluation calls each of its curves once
+	Real64 Sum( 0.0 );
+	auto const CoilCurves( [&]( long const Call ) {
+		long const i( Call & SampleMask );
+		Sum += CurveValue( 1, WetBulb[ i ], OutdoorDryBulb[ i ] ) * CurveValue( 3, FlowFraction[ i ] );
+		Sum += CurveValue( 2, WetBulb[ i ], OutdoorDryBulb[ i ] ) * CurveValue( 4, FlowFraction[ i ] );
+		Sum += CurveValue( 5, PartLoadRatio[ i ] );
+	} );
+	TimeKernel( "CurveValue_ByType", CoilCurves );
+	for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) BindCurveEvaluator( CurveNum );
+	TimeKernel( "CurveValue_Bound", CoilCurves );
+	EXPECT_TRUE( std::isfinite( Sum ) );
+
+	PerfCurve.deallocate();
+	NumCurves = 0;
+}
@@ -0,0 +1,48 @@
+// EnergyPlus::FluidProperties Microbenchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/FluidProperties.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::FluidProperties;
+
+TEST( FluidPropertiesBenchmark, GetSatPressureRefrig )
+{
+	// R22 saturation pressures on the irregular temperature steps of the refrigerant tables
+	bool const SaveGetInput( GetInput );
+	GetInput = false;
+	NumOfRefrigerants = 1;
+	RefrigData.allocate( 1 );
+	auto & refrig( RefrigData( 1 ) );
+	refrig.Name = "R22";
+	refrig.PsTemps = Array1D< Real64 >( { -60.0, -50.0, -40.0, -35.0, -30.0, -25.0, -20.0, -15.0, -10.0, -5.0, 0.0, 2.0, 4.0, 6.0, 8.0, 10.0, 15.0, 20.0, 25.0, 30.0, 35.0, 40.0, 45.0, 50.0, 55.0, 60.0, 70.0, 80.0, 90.0 } );
+	refrig.PsValues.allocate( refrig.PsTemps.isize() );
+	for ( int i = 1; i <= refrig.PsTemps.isize(); ++i ) {
+		refrig.PsValues( i ) = 1.0e3 * std::exp( 6.5 + 0.0235 * refrig.PsTemps( i ) - 5.0e-5 * refrig.PsTemps( i ) * refrig.PsTemps( i ) );
+	}
+	refrig.PsLowTempIndex = 1;
+	refrig.PsHighTempIndex = refrig.PsTemps.isize();
+	BuildAxisIndex( refrig.PsTempAxis, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+
+	// Evaporating through condensing temperatures of refrigeration and DX equipment
+	std::vector< double > const Temperature( UniformSamples( NumSamples, -40.0, 60.0 ) );
+
+	int RefrigIndex( 1 );
+	Real64 Sum( 0.0 );
+	TimeKernel( "GetSatPressureRefrig", [&]( long const Call ) {
+		Sum += GetSatPressureRefrig( "R22", Temperature[ Call & SampleMask ], RefrigIndex, "FluidPropertiesBenchmark" );
+	} );
+	EXPECT_TRUE( std::isfinite( Sum ) );
+
+	RefrigData.deallocate();
+	NumOfRefrigerants = 0;
+	GetInput = SaveGetInput;
+}
@@ -0,0 +1,52 @@
+// EnergyPlus::HeatBalanceIntRadExchange Microbenchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceIntRadExchangeBenchmark, CalcScriptF )
+{
+	// Zones of a box with furniture, a perimeter office and a large open plan zone
+	int const ZoneSizes[] = { 6, 24, 80 };
+	for ( int const N : ZoneSizes ) {
+		std::vector< double > const Area( UniformSamples( N, 2.0, 60.0, unsigned( N ) ) );
+		Array1D< Real64 > A( N );
+		Array1D< Real64 > Emiss( N );
+		Real64 TotalArea( 0.0 );
+		for ( int i = 1; i <= N; ++i ) {
+			A( i ) = Area[ i - 1 ];
+			Emiss( i ) = ( i % 5 == 0 ? 0.84 : 0.9 ); // Some glazing
+			TotalArea += A( i );
+		}
+		// The area weighted view factors of the approximate interior exchange, held transposed
+		Array2D< Real64 > F( N, N, 0.0 );
+		for ( int i = 1; i <= N; ++i ) {
+			for ( int j = 1; j <= N; ++j ) {
+				if ( i != j ) F( j, i ) = A( j ) / ( TotalArea - A( i ) );
+			}
+		}
+		Array2D< Real64 > ScriptF( N, N );
+
+		Real64 Sum( 0.0 );
+		TimeKernel( "CalcScriptF_" + std::to_string( N ), [&]( long const ) {
+			CalcScriptF( N, A, F, Emiss, ScriptF );
+			Sum += ScriptF( 1, N );
+		} );
+		EXPECT_TRUE( std::isfinite( Sum ) );
+	}
+}
@@ -0,0 +1,96 @@
+// EnergyPlus::HeatBalanceSurfaceManager Microbenchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <HeatBalanceSurfaceManager.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataSurfaces.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::HeatBalanceSurfaceManager;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataHeatBalFanSys;
+using namespace EnergyPlus::DataHeatBalSurface;
+using namespace EnergyPlus::DataSurfaces;
+
+TEST( HeatBalanceSurfaceManagerBenchmark, CTFHistoryTerms )
+{
+	// A large building: 2000 surfaces over 40 constructions of 4 to 18 terms, one in ten with a source
+	TotConstructs = 40;
+	Construct.allocate( TotConstructs );
+	for ( int ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
+		auto & construct( Construct( ConstrNum ) );
+		construct.NumCTFTerms = 4 + ( 7 * ConstrNum ) % 15;
+		construct.SourceSinkPresent = ( ConstrNum % 10 == 0 );
+		for ( int Term = 1; Term <= construct.NumCTFTerms; ++Term ) {
+			construct.CTFOutside( Term ) = 0.9 / ( Term + ConstrNum );
+			construct.CTFCross( Term ) = 0.3 / ( Term + ConstrNum );
+			construct.CTFInside( Term ) = 0.7 / ( Term + ConstrNum );
+			construct.CTFFlux( Term ) = 0.1 / ( Term + ConstrNum );
+			construct.CTFSourceIn( Term ) = 0.05 * Term;
+			construct.CTFSourceOut( Term ) = 0.02 * Term;
+		}
+	}
+
+	TotSurfaces = 2000;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).HeatTransSurf = true;
+		Surface( SurfNum ).Class = ( SurfNum % 4 == 0 ? SurfaceClass_Window : SurfaceClass_Wall );
+		Surface( SurfNum ).HeatTransferAlgorithm = HeatTransferModel_CTF;
+		Surface( SurfNum ).Construction = 1 + ( SurfNum * 13 ) % TotConstructs;
+	}
+
+	std::vector< double > const Temperature( UniformSamples( 2 * MaxCTFTerms * TotSurfaces, 10.0, 30.0, 1u ) );
+	std::vector< double > const Flux( UniformSamples( 2 * MaxCTFTerms * TotSurfaces, -20.0, 20.0, 2u ) );
+	TH.dimension( 2, MaxCTFTerms, TotSurfaces, 0.0 );
+	QH.dimension( 2, MaxCTFTerms, TotSurfaces, 0.0 );
+	for ( std::size_t l = 0; l < TH.size(); ++l ) {
+		TH[ l ] = Temperature[ l ];
+		QH[ l ] = Flux[ l ];
+	}
+	QsrcHist.dimension( TotSurfaces, MaxCTFTerms, 100.0 );
+	TsrcHist.dimension( TotSurfaces, MaxCTFTerms, 25.0 );
+	CTFConstInPart.dimension( TotSurfaces, 0.0 );
+	CTFConstOutPart.dimension( TotSurfaces, 0.0 );
+	CTFTsrcConstPart.dimension( TotSurfaces, 0.0 );
+
+	// One call covers every surface, as each zone time step does
+	Real64 Sum( 0.0 );
+	TimeKernel( "CalcCTFHistoryTerms", [&]( long const ) {
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( Surface( SurfNum ).Class == SurfaceClass_Window ) continue;
+			CalcCTFHistoryTerms( SurfNum );
+		}
+		Sum += CTFConstInPart( 1 );
+	} );
+	CTFHistoryBatchesChanged = true;
+	TimeKernel( "CalcCTFHistoryTermsBatched", [&]( long const ) {
+		CalcCTFHistoryTermsBatched();
+		Sum += CTFConstInPart( 1 );
+	} );
+	EXPECT_TRUE( std::isfinite( Sum ) );
+
+	CTFHistoryBatch.deallocate();
+	CTFHistoryBatchesChanged = true;
+	CTFConstInPart.deallocate();
+	CTFConstOutPart.deallocate();
+	CTFTsrcConstPart.deallocate();
+	TH.deallocate();
+	QH.deallocate();
+	QsrcHist.deallocate();
+	TsrcHist.deallocate();
+	Surface.deallocate();
+	Construct.deallocate();
+	TotSurfaces = 0;
+	TotConstructs = 0;
+}
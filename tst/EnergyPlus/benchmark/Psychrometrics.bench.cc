@@ -0,0 +1,38 @@
+// EnergyPlus::Psychrometrics Microbenchmarks
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/Psychrometrics.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::Psychrometrics;
+
+TEST( PsychrometricsBenchmark, PsyTwbFnTdbWPb )
+{
+	InitializePsychRoutines();
+
+	// Coil entering and leaving air through outdoor conditions: dry bulb, relative humidity and
+	// the barometric pressure of sites from sea level to about 1800 m
+	std::vector< double > const Tdb( UniformSamples( NumSamples, -20.0, 45.0, 1u ) );
+	std::vector< double > const RH( UniformSamples( NumSamples, 0.05, 0.95, 2u ) );
+	std::vector< double > const Pb( UniformSamples( NumSamples, 82000.0, 101325.0, 3u ) );
+	std::vector< double > W( NumSamples );
+	for ( std::size_t i = 0; i < NumSamples; ++i ) {
+		W[ i ] = std::max( PsyWFnTdbRhPb( Tdb[ i ], RH[ i ], Pb[ i ] ), 1.0e-5 );
+	}
+
+	Real64 Sum( 0.0 );
+	TimeKernel( "PsyTwbFnTdbWPb", [&]( long const Call ) {
+		long const i( Call & SampleMask );
+		Sum += PsyTwbFnTdbWPb( Tdb[ i ], W[ i ], Pb[ i ] );
+	} );
+	EXPECT_TRUE( std::isfinite( Sum ) );
+}
@@ -0,0 +1,65 @@
+// EnergyPlus::SolarShading Microbenchmarks
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/SolarShading.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Benchmark;
+using namespace EnergyPlus::SolarShading;
+
+TEST( SolarShadingBenchmark, CLIPPOLY )
+{
+	// Shadows of overhangs and neighbouring buildings: parallelograms of about the size of the
+	// receiving wall, anywhere from clear of it to covering it
+	int const NumPairs( 256 );
+	int const SaveTotSurfaces( DataSurfaces::TotSurfaces );
+	int const SaveMaxVertices( DataSurfaces::MaxVerticesPerSurface );
+	DataSurfaces::TotSurfaces = 1;
+	DataSurfaces::MaxVerticesPerSurface = 4;
+	MaxHCV = 15;
+	MaxHCS = NumPairs;
+	AllocateShadowingThreadArrays();
+
+	std::vector< double > const Width( UniformSamples( NumPairs, 3.0, 30.0, 1u ) );
+	std::vector< double > const Height( UniformSamples( NumPairs, 3.0, 10.0, 2u ) );
+	std::vector< double > const OffsetX( UniformSamples( NumPairs, -1.0, 1.0, 3u ) );
+	std::vector< double > const OffsetY( UniformSamples( NumPairs, -1.0, 1.0, 4u ) );
+	std::vector< double > const Shear( UniformSamples( NumPairs, -0.5, 0.5, 5u ) );
+	for ( int Pair = 0; Pair < NumPairs; ++Pair ) {
+		double const W( Width[ Pair ] );
+		double const H( Height[ Pair ] );
+		// Receiving surface, counterclockwise
+		XVS( 1 ) = 0.0; YVS( 1 ) = 0.0;
+		XVS( 2 ) = W; YVS( 2 ) = 0.0;
+		XVS( 3 ) = W; YVS( 3 ) = H;
+		XVS( 4 ) = 0.0; YVS( 4 ) = H;
+		HTRANS1( Pair + 1, 4 );
+		// Shadow
+		double const X0( OffsetX[ Pair ] * W );
+		double const Y0( OffsetY[ Pair ] * H );
+		double const S( Shear[ Pair ] * H );
+		XVS( 1 ) = X0; YVS( 1 ) = Y0;
+		XVS( 2 ) = X0 + W; YVS( 2 ) = Y0;
+		XVS( 3 ) = X0 + W + S; YVS( 3 ) = Y0 + H;
+		XVS( 4 ) = X0 + S; YVS( 4 ) = Y0 + H;
+		HTRANS1( NumPairs + Pair + 1, 4 );
+	}
+
+	long Vertices( 0 );
+	TimeKernel( "CLIPPOLY", [&]( long const Call ) {
+		int const Pair( int( Call % NumPairs ) );
+		int NV3( 0 );
+		OverlapStatus = PartialOverlap;
+		CLIPPOLY( NumPairs + Pair + 1, Pair + 1, 4, 4, NV3 );
+		Vertices += NV3;
+	} );
+	EXPECT_GT( Vertices, 0 );
+
+	DataSurfaces::TotSurfaces = SaveTotSurfaces;
+	DataSurfaces::MaxVerticesPerSurface = SaveMaxVertices;
+}
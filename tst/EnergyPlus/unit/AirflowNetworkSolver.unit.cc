@@ -4,8 +4,9 @@
 #include <gtest/gtest.h>
 
 // C++ Headers
+#include <algorithm>
 //#include <cassert>
-//#include <cmath>
+#include <cmath>
 //#include <string>
 
 // ObjexxFCL Headers
@@ -88,3 +89,170 @@ TEST( AirflowNetworkSolverTest, HorizontalOpening )
 }
 
 
+
+TEST( AirflowNetworkSolverTest, SparseSolverMatchesSkyline )
+{
+
+	ShowMessage( "Begin Test: AirflowNetworkSolverTest, SparseSolverMatchesSkyline" );
+
+	// Five nodes: a ring of four with a fifth node linked to the first and third
+	NetworkNumOfNodes = 5;
+	NetworkNumOfLinks = 6;
+	int const Links[ 6 ][ 2 ] = { { 1, 2 }, { 2, 3 }, { 3, 4 }, { 4, 1 }, { 5, 1 }, { 3, 5 } };
+	AirflowNetworkLinkageData.allocate( NetworkNumOfLinks );
+	for ( int M = 1; M <= NetworkNumOfLinks; ++M ) {
+		AirflowNetworkLinkageData( M ).NodeNums( 1 ) = Links[ M - 1 ][ 0 ];
+		AirflowNetworkLinkageData( M ).NodeNums( 2 ) = Links[ M - 1 ][ 1 ];
+	}
+	ID.allocate( NetworkNumOfNodes );
+	for ( int n = 1; n <= NetworkNumOfNodes; ++n ) ID( n ) = n;
+	IK.allocate( NetworkNumOfNodes + 1 );
+	SETSKY();
+	AU.dimension( IK( NetworkNumOfNodes + 1 ), 0.0 );
+	AD.dimension( NetworkNumOfNodes, 0.0 );
+
+	// Symmetric, diagonally dominant Jacobian on the links
+	for ( int M = 1; M <= NetworkNumOfLinks; ++M ) {
+		int const Lo( std::min( Links[ M - 1 ][ 0 ], Links[ M - 1 ][ 1 ] ) );
+		int const Hi( std::max( Links[ M - 1 ][ 0 ], Links[ M - 1 ][ 1 ] ) );
+		Real64 const DF( 0.5 + 0.25 * M );
+		AU( IK( Hi + 1 ) - Hi + Lo ) -= DF;
+		AD( Lo ) += DF;
+		AD( Hi ) += DF;
+	}
+	AD( 2 ) += 1.0;
+	Array1D< Real64 > B( NetworkNumOfNodes );
+	for ( int n = 1; n <= NetworkNumOfNodes; ++n ) B( n ) = 1.0 - 0.3 * n;
+
+	Array1D< Real64 > SparseX( B );
+	EXPECT_FALSE( SparseJacobian.SymbolicDone );
+	SETSPR();
+	EXPECT_TRUE( SparseJacobian.SymbolicDone );
+	FACSPR( AD, AU );
+	SLVSPR( SparseX );
+
+	// The kept factors leave the Jacobian alone and solve again without refactoring
+	newIK = IK;
+	newAU = AU;
+	Array1D< Real64 > const SavedAD( AD );
+	SolverFactorizations = 0;
+	FACJAC();
+	Array1D< Real64 > KeptX( B );
+	SLVJAC( KeptX );
+	Array1D< Real64 > KeptX2( B );
+	SLVJAC( KeptX2 );
+	EXPECT_EQ( 1, SolverFactorizations );
+	for ( int n = 1; n <= NetworkNumOfNodes; ++n ) {
+		EXPECT_DOUBLE_EQ( SavedAD( n ), AD( n ) );
+		EXPECT_NEAR( SparseX( n ), KeptX( n ), 1.0e-12 );
+		EXPECT_DOUBLE_EQ( KeptX( n ), KeptX2( n ) );
+	}
+
+	Array1D< Real64 > SkylineX( B );
+	FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, 0 );
+	SLVSKY( AU, AD, AU, SkylineX, IK, NetworkNumOfNodes, 0 );
+	for ( int n = 1; n <= NetworkNumOfNodes; ++n ) {
+		EXPECT_NEAR( SkylineX( n ), SparseX( n ), 1.0e-12 );
+	}
+
+	SparseJacobian = SparseJacobianData();
+	SolverFactorizations = 0;
+	JacIK.deallocate();
+	JacAD.deallocate();
+	JacAU.deallocate();
+	newAU.deallocate();
+	newIK.deallocate();
+	AD.deallocate();
+	AU.deallocate();
+	IK.deallocate();
+	ID.deallocate();
+	AirflowNetworkLinkageData.deallocate();
+	NetworkNumOfLinks = 0;
+	NetworkNumOfNodes = 0;
+}
+
+TEST( AirflowNetworkSolverTest, CrackBatchMatchesAFESCR )
+{
+
+	ShowMessage( "Begin Test: AirflowNetworkSolverTest, CrackBatchMatchesAFESCR" );
+
+	// Three nodes; two cracks and one other component link between them
+	NetworkNumOfNodes = 3;
+	NetworkNumOfLinks = 3;
+	NumOfLinksMultiZone = 3;
+	AirflowNetworkCompData.allocate( 2 );
+	AirflowNetworkCompData( 1 ).CompTypeNum = CompTypeNum_SCR;
+	AirflowNetworkCompData( 1 ).TypeNum = 1;
+	AirflowNetworkCompData( 2 ).CompTypeNum = CompTypeNum_HOP;
+	AirflowNetworkCompData( 2 ).TypeNum = 1;
+	MultizoneSurfaceCrackData.allocate( 1 );
+	MultizoneSurfaceCrackData( 1 ).FlowCoef = 0.01;
+	MultizoneSurfaceCrackData( 1 ).FlowExpo = 0.65;
+	MultizoneSurfaceCrackData( 1 ).StandardT = 20.0;
+	MultizoneSurfaceCrackData( 1 ).StandardP = 101325.0;
+	MultizoneSurfaceCrackData( 1 ).StandardW = 0.0;
+	MultizoneSurfaceData.allocate( NetworkNumOfLinks );
+	AirflowNetworkLinkageData.allocate( NetworkNumOfLinks );
+	int const Links[ 3 ][ 3 ] = { { 1, 2, 1 }, { 2, 3, 2 }, { 3, 1, 1 } };
+	for ( int i = 1; i <= NetworkNumOfLinks; ++i ) {
+		AirflowNetworkLinkageData( i ).NodeNums( 1 ) = Links[ i - 1 ][ 0 ];
+		AirflowNetworkLinkageData( i ).NodeNums( 2 ) = Links[ i - 1 ][ 1 ];
+		AirflowNetworkLinkageData( i ).CompNum = Links[ i - 1 ][ 2 ];
+		MultizoneSurfaceData( i ).Factor = 0.5 * i;
+	}
+
+	RHOZ.allocate( NetworkNumOfNodes );
+	SQRTDZ.allocate( NetworkNumOfNodes );
+	VISCZ.allocate( NetworkNumOfNodes );
+	TZ.allocate( NetworkNumOfNodes );
+	AirflowNetworkSolver::PZ.allocate( NetworkNumOfNodes );
+	for ( int n = 1; n <= NetworkNumOfNodes; ++n ) {
+		TZ( n ) = 15.0 + 3.0 * n;
+		RHOZ( n ) = 1.25 - 0.02 * n;
+		SQRTDZ( n ) = std::sqrt( RHOZ( n ) );
+		VISCZ( n ) = 1.71432e-5 + 4.828e-8 * TZ( n );
+		AirflowNetworkSolver::PZ( n ) = 2.0 - 1.5 * n;
+	}
+	PS.dimension( NetworkNumOfLinks, 0.0 );
+	PW.dimension( NetworkNumOfLinks, 0.0 );
+	DpL.dimension( NetworkNumOfLinks, 2, 0.0 );
+	DpL( 3, 1 ) = 0.3;
+
+	SETCRK();
+	EXPECT_TRUE( CrackBatch.Built );
+	ASSERT_EQ( 2u, CrackBatch.Link.size() );
+	EXPECT_EQ( 0, CrackBatch.Pos[ 1 ] );
+	EXPECT_EQ( 2, CrackBatch.Pos[ 2 ] );
+
+	Array1D< Real64 > F( 2 );
+	Array1D< Real64 > DF( 2 );
+	int NF;
+	for ( int LFLAG = 0; LFLAG <= 1; ++LFLAG ) {
+		AFESCRBatch( LFLAG );
+		for ( int k = 0; k < 2; ++k ) {
+			int const i( CrackBatch.Link[ k ] );
+			int const n( AirflowNetworkLinkageData( i ).NodeNums( 1 ) );
+			int const M( AirflowNetworkLinkageData( i ).NodeNums( 2 ) );
+			AFESCR( 1, LFLAG, AirflowNetworkSolver::PZ( n ) - AirflowNetworkSolver::PZ( M ) + DpL( i, 1 ) + PW( i ), i, n, M, F, DF, NF );
+			EXPECT_EQ( F( 1 ), CrackBatch.F[ k ] );
+			EXPECT_EQ( DF( 1 ), CrackBatch.DF[ k ] );
+		}
+	}
+
+	CrackBatch = CrackBatchData();
+	DpL.deallocate();
+	PW.deallocate();
+	PS.deallocate();
+	AirflowNetworkSolver::PZ.deallocate();
+	TZ.deallocate();
+	VISCZ.deallocate();
+	SQRTDZ.deallocate();
+	RHOZ.deallocate();
+	AirflowNetworkLinkageData.deallocate();
+	MultizoneSurfaceData.deallocate();
+	MultizoneSurfaceCrackData.deallocate();
+	AirflowNetworkCompData.deallocate();
+	NumOfLinksMultiZone = 0;
+	NetworkNumOfLinks = 0;
+	NetworkNumOfNodes = 0;
+}
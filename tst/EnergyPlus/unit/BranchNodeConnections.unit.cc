@@ -0,0 +1,75 @@
+// EnergyPlus::BranchNodeConnections Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <BranchNodeConnections.hh>
+#include <DataBranchNodeConnections.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::BranchNodeConnections;
+using namespace EnergyPlus::DataBranchNodeConnections;
+using namespace ObjexxFCL;
+
+namespace {
+
+	void
+	ClearNodeConnections()
+	{
+		NodeConnections.deallocate();
+		NumOfNodeConnections = 0;
+		MaxNumOfNodeConnections = 0;
+		CompSets.deallocate();
+		NumCompSets = 0;
+		NodeConnectionsOfNode.clear();
+		FirstNodeConnectionOfObject.clear();
+		NumCompSetsOfParent.clear();
+	}
+
+}
+
+TEST( BranchNodeConnectionsTest, NodeConnectionIndexes )
+{
+	ClearNodeConnections();
+	bool errFlag( false );
+
+	RegisterNodeConnection( 1, "SUPPLY INLET", "AirLoopHVAC", "Main Loop", "Inlet", 1, true, errFlag );
+	RegisterNodeConnection( 2, "SUPPLY OUTLET", "AirLoopHVAC", "Main Loop", "Outlet", 1, true, errFlag );
+	RegisterNodeConnection( 1, "SUPPLY INLET", "Fan:ConstantVolume", "Supply Fan", "Inlet", 1, false, errFlag );
+	RegisterNodeConnection( 2, "SUPPLY OUTLET", "Fan:ConstantVolume", "Supply Fan", "Outlet", 1, false, errFlag );
+	RegisterNodeConnection( 1, "SUPPLY INLET", "Fan:ConstantVolume", "Supply Fan", "Inlet", 1, false, errFlag ); // Repeat, not stored again
+	RegisterNodeConnection( 3, "MIXED AIR", "SetpointManager:MixedAir", "Mixed Air Manager", "Sensor", 1, false, errFlag );
+	EXPECT_FALSE( errFlag );
+	EXPECT_EQ( 5, NumOfNodeConnections );
+
+	ASSERT_EQ( 2u, NodeConnectionsOfNodeNumber( 1 ).size() );
+	EXPECT_EQ( 1, NodeConnectionsOfNodeNumber( 1 )[ 0 ] );
+	EXPECT_EQ( 3, NodeConnectionsOfNodeNumber( 1 )[ 1 ] );
+	EXPECT_TRUE( NodeConnectionsOfNodeNumber( 4 ).empty() );
+
+	EXPECT_TRUE( IsParentObject( "AIRLOOPHVAC", "Main Loop" ) );
+	EXPECT_FALSE( IsParentObject( "FAN:CONSTANTVOLUME", "Supply Fan" ) );
+
+	// The sensor node has no other connection
+	bool ErrorsFound( false );
+	CheckNodeConnections( ErrorsFound );
+	EXPECT_TRUE( ErrorsFound );
+
+	RegisterNodeConnection( 3, "MIXED AIR", "OutdoorAir:Mixer", "Mixer", "Outlet", 1, false, errFlag );
+	ErrorsFound = false;
+	CheckNodeConnections( ErrorsFound );
+	EXPECT_FALSE( ErrorsFound );
+
+	SetUpCompSets( "UNDEFINED", "UNDEFINED", "Fan:ConstantVolume", "Supply Fan", "SUPPLY INLET", "SUPPLY OUTLET" );
+	EXPECT_FALSE( IsParentObjectCompSet( "AIRLOOPHVAC", "Main Loop" ) );
+	SetUpCompSets( "AirLoopHVAC", "Main Loop", "Fan:ConstantVolume", "Supply Fan", "SUPPLY INLET", "SUPPLY OUTLET" );
+	EXPECT_EQ( 1, NumCompSets );
+	EXPECT_TRUE( IsParentObjectCompSet( "AIRLOOPHVAC", "Main Loop" ) );
+	EXPECT_FALSE( IsParentObjectCompSet( "UNDEFINED", "UNDEFINED" ) );
+
+	ClearNodeConnections();
+}
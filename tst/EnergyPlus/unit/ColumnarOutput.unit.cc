@@ -0,0 +1,90 @@
+// EnergyPlus::ColumnarOutput Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ColumnarOutput.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ColumnarOutput;
+using namespace EnergyPlus::OutputProcessor;
+
+TEST( ColumnarOutputTest, WriteAndReadBack )
+{
+	ShowMessage( "Begin Test: ColumnarOutputTest, WriteAndReadBack" );
+
+	std::string const FileName( "ColumnarOutputTest.col" );
+	OpenColumnarOutput( FileName, true );
+	ASSERT_TRUE( WriteColumnarOutput );
+	EXPECT_TRUE( ColumnarOutputOnly );
+	DataEnvironment::CurEnvirNum = 1;
+
+	WriteColumnarDictionaryItem( 7, ReportHourly, AveragedVar, ZoneVar, false, "ZONE ONE", "Zone Mean Air Temperature", "C" );
+	WriteColumnarDictionaryItem( 9, ReportDaily, SummedVar, ZoneVar, true, "", "Electricity:Facility", "J" );
+
+	// More hours than fit in one chunk; each stamp is given twice, as for the eso and mtr files
+	int const NumHours( 2 * ChunkSize + 100 );
+	for ( int Loop = 0; Loop < NumHours; ++Loop ) {
+		int const DayOfSim( Loop / 24 + 1 );
+		int const Hour( Loop % 24 + 1 );
+		WriteColumnarTimeIndex( ReportHourly, DayOfSim, 1, DayOfSim, Hour, 0, 0.0, 60.0, "Monday" );
+		WriteColumnarTimeIndex( ReportHourly, DayOfSim, 1, DayOfSim, Hour, 0, 0.0, 60.0, "Monday" );
+		if ( Loop % 3 != 0 ) WriteColumnarValue( 7, 20.0 + 0.01 * Loop ); // Scheduled off every third hour
+		if ( Hour == 24 ) {
+			WriteColumnarTimeIndex( ReportDaily, DayOfSim, 1, DayOfSim, 0, 0, 0.0, 0.0, "Monday" );
+			WriteColumnarValue( 9, 1.0e6 * DayOfSim, 1.0, 1010100 + DayOfSim, 5.0e5, 1010200 + DayOfSim );
+		}
+	}
+	WriteColumnarValue( 11, 1.0 ); // Not in the dictionary
+	CloseColumnarOutput();
+	EXPECT_FALSE( WriteColumnarOutput );
+
+	Array1D< ColumnarTimeTable > Tables;
+	std::vector< ColumnarSeries > Columns;
+	ASSERT_TRUE( ReadColumnarOutput( FileName, Tables, Columns ) );
+	std::remove( FileName.c_str() );
+
+	ASSERT_EQ( NumTimeTables, Tables.isize() );
+	ASSERT_EQ( NumHours, Tables( 1 ).NumRows );
+	EXPECT_EQ( 1, Tables( 1 ).Rows[ 0 ].Hour );
+	EXPECT_EQ( 60.0, Tables( 1 ).Rows[ 0 ].EndMinute );
+	EXPECT_EQ( "Monday", Tables( 1 ).Rows[ 0 ].DayType );
+	EXPECT_EQ( NumHours / 24 + 1, Tables( 1 ).Rows[ NumHours - 1 ].DayOfSim );
+	EXPECT_EQ( NumHours / 24, Tables( 2 ).NumRows );
+	EXPECT_EQ( 0, Tables( 3 ).NumRows );
+
+	ASSERT_EQ( 2u, Columns.size() );
+	auto const & Temperature( Columns[ 0 ] );
+	EXPECT_EQ( 7, Temperature.ReportID );
+	EXPECT_EQ( "Zone Mean Air Temperature", Temperature.VariableName );
+	EXPECT_EQ( "C", Temperature.Units );
+	EXPECT_EQ( 1, Temperature.Table );
+	ASSERT_EQ( std::size_t( NumHours - ( NumHours + 2 ) / 3 ), Temperature.Values.size() );
+	ASSERT_EQ( Temperature.Values.size(), Temperature.Rows.size() );
+	EXPECT_TRUE( Temperature.MinValues.empty() );
+	for ( std::size_t Loop = 0; Loop < Temperature.Rows.size(); ++Loop ) {
+		int const Row( Temperature.Rows[ Loop ] );
+		EXPECT_NE( 0, Row % 3 );
+		EXPECT_EQ( 20.0 + 0.01 * Row, Temperature.Values[ Loop ] );
+	}
+
+	auto const & Meter( Columns[ 1 ] );
+	EXPECT_TRUE( Meter.Meter );
+	EXPECT_EQ( 2, Meter.Table );
+	ASSERT_EQ( std::size_t( NumHours / 24 ), Meter.Values.size() );
+	EXPECT_EQ( 0, Meter.Rows[ 0 ] );
+	EXPECT_EQ( 2.0e6, Meter.Values[ 1 ] );
+	EXPECT_EQ( 1.0, Meter.MinValues[ 1 ] );
+	EXPECT_EQ( 1010102, Meter.MinValueDates[ 1 ] );
+	EXPECT_EQ( 1010202, Meter.MaxValueDates[ 1 ] );
+
+	DataEnvironment::CurEnvirNum = 0;
+}
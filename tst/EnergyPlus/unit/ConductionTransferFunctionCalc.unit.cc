@@ -0,0 +1,85 @@
+// EnergyPlus::ConductionTransferFunctionCalc Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ConductionTransferFunctionCalc.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ConductionTransferFunctionCalc;
+using namespace EnergyPlus::DataHeatBalance;
+
+TEST( ConductionTransferFunctionCalcTest, CTFCacheRoundTrip )
+{
+	ShowMessage( "Begin Test: ConductionTransferFunctionCalcTest, CTFCacheRoundTrip" );
+
+	std::string const CacheFile( "eplus_test_ctf_cache.bin" );
+	std::remove( CacheFile.c_str() );
+
+	Construct.allocate( 2 );
+	s0.allocate( 3, 4 );
+	std::vector< Real64 > Key = { 0.25, 19.0, 1.0, 0.1, 0.04, 1.1, 1800.0, 840.0 };
+
+	InitCTFCache( CacheFile );
+	ASSERT_TRUE( CTFCache.Active );
+	EXPECT_EQ( 0u, CTFCache.Index.size() );
+	EXPECT_FALSE( RestoreCTFsFromCache( Key, 1 ) );
+
+	Construct( 1 ).CTFTimeStep = 0.5;
+	Construct( 1 ).NumCTFTerms = 2;
+	Construct( 1 ).NumHistories = 1;
+	for ( int i = 1; i <= 3; ++i ) {
+		for ( int j = 1; j <= 4; ++j ) {
+			s0( i, j ) = 0.1 * i + 0.01 * j;
+		}
+	}
+	s.allocate( 3, 4, 2 );
+	s = 0.0;
+	s( 1, 1, 2 ) = -0.375;
+	s( 3, 4, 1 ) = 1.0 / 3.0;
+	e.dimension( 2, 0.0 );
+	e( 1 ) = 0.0625;
+	e( 2 ) = -1.0e-7;
+	SaveCTFsToCache( Key, 1 );
+	EXPECT_EQ( 1, CTFCache.NumMisses );
+
+	// A later run restores the same results into another construction
+	InitCTFCache( CacheFile );
+	ASSERT_TRUE( CTFCache.Active );
+	EXPECT_EQ( 1u, CTFCache.Index.size() );
+	s0 = 0.0;
+	s.deallocate();
+	e.deallocate();
+	ASSERT_TRUE( RestoreCTFsFromCache( Key, 2 ) );
+	EXPECT_EQ( 1, CTFCache.NumHits );
+	EXPECT_EQ( 0.5, Construct( 2 ).CTFTimeStep );
+	EXPECT_EQ( 2, Construct( 2 ).NumCTFTerms );
+	EXPECT_EQ( 1, Construct( 2 ).NumHistories );
+	EXPECT_EQ( 0.1 * 2 + 0.01 * 3, s0( 2, 3 ) );
+	EXPECT_EQ( -0.375, s( 1, 1, 2 ) );
+	EXPECT_EQ( 1.0 / 3.0, s( 3, 4, 1 ) );
+	EXPECT_EQ( 0.0, s( 2, 2, 1 ) );
+	EXPECT_EQ( 0.0625, e( 1 ) );
+	EXPECT_EQ( -1.0e-7, e( 2 ) );
+
+	// Any change in the layer properties misses the cache
+	Key.back() = 841.0;
+	EXPECT_FALSE( RestoreCTFsFromCache( Key, 2 ) );
+
+	// No file name turns the cache off
+	InitCTFCache( "" );
+	EXPECT_FALSE( CTFCache.Active );
+	std::remove( CacheFile.c_str() );
+
+	Construct.deallocate();
+	s0.deallocate();
+	s.deallocate();
+	e.deallocate();
+}
@@ -7,6 +7,8 @@
 
 // EnergyPlus Headers
 #include <ConvectionCoefficients.hh>
+#include <DataHeatBalance.hh>
+#include <DataSurfaces.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
 using namespace EnergyPlus;
@@ -52,4 +54,39 @@ TEST( ConvectionCoefficientsTest, ConvectionCofficients )
 
 }
 
+TEST( ConvectionCoefficientsTest, TARPIntConvCoeffReuse )
+{
+
+	ShowMessage( "Begin Test: ConvectionCoefficientsTest, TARPIntConvCoeffReuse" );
+
+	using DataHeatBalance::HConvIn;
+	using DataSurfaces::Surface;
+
+	Surface.allocate( 2 );
+	HConvIn.dimension( 2, 0.0 );
+	Surface( 1 ).CosTilt = 0.0; // Wall
+	Surface( 2 ).CosTilt = 1.0; // Floor
+
+	CalcASHRAEDetailedIntConvCoeff( 1, 25.0, 20.0 );
+	CalcASHRAEDetailedIntConvCoeff( 2, 25.0, 20.0 );
+	EXPECT_DOUBLE_EQ( CalcASHRAEVerticalWall( 5.0 ), HConvIn( 1 ) );
+	Real64 const HcFloorWarm( HConvIn( 2 ) );
+	EXPECT_DOUBLE_EQ( CalcWaltonStableHorizontalOrTilt( 5.0, 1.0 ), HcFloorWarm );
+
+	// Same conditions reuse the coefficient, changed ones recalculate it
+	HConvIn = 0.0;
+	CalcASHRAEDetailedIntConvCoeff( 2, 25.0, 20.0 );
+	EXPECT_DOUBLE_EQ( HcFloorWarm, HConvIn( 2 ) );
+	CalcASHRAEDetailedIntConvCoeff( 2, 15.0, 20.0 );
+	EXPECT_DOUBLE_EQ( CalcWaltonUnstableHorizontalOrTilt( -5.0, 1.0 ), HConvIn( 2 ) );
+	Surface( 2 ).CosTilt = -1.0; // Ceiling
+	CalcASHRAEDetailedIntConvCoeff( 2, 15.0, 20.0 );
+	EXPECT_DOUBLE_EQ( CalcWaltonStableHorizontalOrTilt( -5.0, -1.0 ), HConvIn( 2 ) );
+
+	TARPIntDeltaTemp.deallocate();
+	TARPIntCosTilt.deallocate();
+	TARPIntHConvIn.deallocate();
+	HConvIn.deallocate();
+	Surface.deallocate();
 
+}
@@ -0,0 +1,100 @@
+// EnergyPlus::CsvOutput Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CsvOutput.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CsvOutput;
+using namespace EnergyPlus::OutputProcessor;
+
+namespace {
+	std::string
+	ReadCsvFile( std::string const & FileName )
+	{
+		std::ifstream Stream( FileName );
+		std::stringstream Text;
+		Text << Stream.rdbuf();
+		return Text.str();
+	}
+}
+
+TEST( CsvOutputTest, ColumnHeading )
+{
+	ShowMessage( "Begin Test: CsvOutputTest, ColumnHeading" );
+
+	EXPECT_EQ( "ZONE ONE:Zone Mean Air Temperature [C](Hourly)", CsvColumnHeading( "ZONE ONE,Zone Mean Air Temperature [C] !Hourly" ) );
+	EXPECT_EQ( "Electricity:Facility [J](Daily)", CsvColumnHeading( "Electricity:Facility [J] !Daily [Value,Min,Hour,Minute,Max,Hour,Minute]" ) );
+	EXPECT_EQ( "ZONE ONE:Zone Mean Air Temperature [C](Daily:ON PERIOD)", CsvColumnHeading( "ZONE ONE,Zone Mean Air Temperature [C] !Daily [Value,Min,Hour,Minute,Max,Hour,Minute],ON PERIOD" ) );
+	EXPECT_EQ( "Cumulative Electricity:Facility [J](RunPeriod)", CsvColumnHeading( "Cumulative Electricity:Facility [J] !RunPeriod [Value,Min,Month,Day,Hour,Minute,Max,Month,Day,Hour,Minute]" ) );
+}
+
+TEST( CsvOutputTest, WriteDuringRun )
+{
+	ShowMessage( "Begin Test: CsvOutputTest, WriteDuringRun" );
+
+	std::string const SavedCsvFileName( DataStringGlobals::outputCsvFileName );
+	std::string const SavedMtrCsvFileName( DataStringGlobals::outputMtrCsvFileName );
+	DataStringGlobals::outputCsvFileName = "CsvOutputTest.csv";
+	DataStringGlobals::outputMtrCsvFileName = "CsvOutputTestMeter.csv";
+	DataSystemVariables::CsvOutputDuringRun = true;
+	InitCsvOutput();
+	ASSERT_TRUE( WriteCsvOutput );
+
+	AddCsvColumn( EsoCsv, 7, "ZONE ONE,Zone Mean Air Temperature [C] !Hourly" );
+	AddCsvColumn( EsoCsv, 8, "ZONE ONE,Zone Air System Sensible Heating Rate [W] !Hourly" );
+	AddCsvColumn( EsoCsv, 9, "Electricity:Facility [J] !Daily [Value,Min,Hour,Minute,Max,Hour,Minute]" );
+	AddCsvColumn( MtrCsv, 10, "Electricity:Facility [J] !TimeStep" );
+	EndCsvDictionary();
+	AddCsvColumn( EsoCsv, 11, "ZONE ONE,Zone Air Relative Humidity [%] !Hourly" ); // After the end of the dictionary
+
+	WriteCsvTimeStamp( EsoCsv, ReportHourly, 1, 1, 1, 1, 60.0 );
+	WriteCsvValue( EsoCsv, 7, "20.0" );
+	WriteCsvValue( EsoCsv, 11, "50.0" );
+	WriteCsvTimeStamp( EsoCsv, ReportHourly, 1, 1, 1, 2, 60.0 );
+	WriteCsvValue( EsoCsv, 7, "21.5" );
+	WriteCsvValue( EsoCsv, 8, "100.0" );
+	WriteCsvTimeStamp( EsoCsv, ReportHourly, 1, 1, 1, 3, 60.0 );
+	WriteCsvValue( EsoCsv, 8, "50.0" );
+	WriteCsvTimeStamp( EsoCsv, ReportDaily, 1, 1, 1, 0, 60.0 ); // Daily values go in the last hourly row
+	WriteCsvValue( EsoCsv, 9, "1000000." );
+
+	WriteCsvTimeStamp( MtrCsv, ReportTimeStep, 1, 1, 1, 1, 15.0 );
+	WriteCsvValue( MtrCsv, 10, "5.0" );
+	WriteCsvTimeStamp( MtrCsv, ReportTimeStep, 1, 1, 1, 1, 30.0 );
+	WriteCsvValue( MtrCsv, 10, "6.0" );
+
+	CloseCsvFile( EsoCsv, true );
+	EXPECT_TRUE( WriteCsvOutput );
+	CloseCsvFile( MtrCsv, true );
+	EXPECT_FALSE( WriteCsvOutput );
+	EXPECT_TRUE( CsvFileWritten( EsoCsv ) );
+	EXPECT_TRUE( CsvFileWritten( MtrCsv ) );
+	CloseCsvOutput();
+	EXPECT_FALSE( CsvFileWritten( EsoCsv ) );
+
+	EXPECT_EQ( "Date/Time,ZONE ONE:Zone Mean Air Temperature [C](Hourly),ZONE ONE:Zone Air System Sensible Heating Rate [W](Hourly),Electricity:Facility [J](Daily) \n"
+		" 01/01  01:00:00,20.0 \n"
+		" 01/01  02:00:00,21.5,100.0 \n"
+		" 01/01  03:00:00,,50.0,1000000. \n", ReadCsvFile( DataStringGlobals::outputCsvFileName ) );
+	EXPECT_EQ( "Date/Time,Electricity:Facility [J](TimeStep) \n"
+		" 01/01  00:15:00,5.0 \n"
+		" 01/01  00:30:00,6.0 \n", ReadCsvFile( DataStringGlobals::outputMtrCsvFileName ) );
+
+	std::remove( DataStringGlobals::outputCsvFileName.c_str() );
+	std::remove( DataStringGlobals::outputMtrCsvFileName.c_str() );
+	DataStringGlobals::outputCsvFileName = SavedCsvFileName;
+	DataStringGlobals::outputMtrCsvFileName = SavedMtrCsvFileName;
+	DataSystemVariables::CsvOutputDuringRun = false;
+}
@@ -0,0 +1,160 @@
+// EnergyPlus::CurveManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+
+TEST( CurveManagerTest, BoundEvaluatorMatchesCurveType )
+{
+	ShowMessage( "Begin Test: CurveManagerTest, BoundEvaluatorMatchesCurveType" );
+
+	int const CurveTypes[] = { Linear, Quadratic, Cubic, Quartic, BiQuadratic, QuadraticLinear, CubicLinear, BiCubic, ChillerPartLoadWithLift, TriQuadratic, Exponent, FanPressureRise, ExponentialSkewNormal, Sigmoid, RectangularHyperbola1, RectangularHyperbola2, ExponentialDecay, DoubleExponentialDecay };
+	NumCurves = sizeof( CurveTypes ) / sizeof( CurveTypes[ 0 ] );
+	PerfCurve.allocate( NumCurves );
+	for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) {
+		auto & Curve( PerfCurve( CurveNum ) );
+		Curve.CurveType = CurveTypes[ CurveNum - 1 ];
+		Curve.InterpolationType = EvaluateCurveToLimits;
+		Curve.Coeff1 = 0.9;
+		Curve.Coeff2 = 0.31;
+		Curve.Coeff3 = -0.02;
+		Curve.Coeff4 = 0.7;
+		Curve.Coeff5 = 1.3;
+		Curve.Coeff6 = -0.004;
+		Curve.Coeff7 = 0.0005;
+		Curve.Coeff8 = 0.0002;
+		Curve.Coeff9 = -0.0003;
+		Curve.Coeff10 = 0.0001;
+		Curve.Coeff11 = 0.00002;
+		Curve.Coeff12 = -0.00001;
+		Curve.Var1Min = 0.1;
+		Curve.Var1Max = 30.0;
+		Curve.Var2Min = 0.1;
+		Curve.Var2Max = 40.0;
+		Curve.Var3Min = 0.0;
+		Curve.Var3Max = 1.0;
+		if ( Curve.CurveType == TriQuadratic ) {
+			Curve.Tri2ndOrder.allocate( 1 );
+			Curve.Tri2ndOrder( 1 ).CoeffA0 = 1.1;
+			Curve.Tri2ndOrder( 1 ).CoeffA8 = 0.02;
+			Curve.Tri2ndOrder( 1 ).CoeffA26 = -0.003;
+		}
+	}
+	PerfCurve( 2 ).CurveMinPresent = true;
+	PerfCurve( 2 ).CurveMin = 1.0;
+	PerfCurve( 3 ).CurveMaxPresent = true;
+	PerfCurve( 3 ).CurveMax = 2.0;
+
+	Real64 const Var1s[] = { 0.0, 0.5, 12.0, 45.0 };
+	for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) {
+		EXPECT_TRUE( PerfCurve( CurveNum ).Evaluator == nullptr );
+		for ( Real64 const Var1 : Var1s ) {
+			Real64 const ByType( CurveValue( CurveNum, Var1, 25.0, 0.4 ) );
+			BindCurveEvaluator( CurveNum );
+			EXPECT_EQ( ByType, CurveValue( CurveNum, Var1, 25.0, 0.4 ) );
+			PerfCurve( CurveNum ).Evaluator = nullptr;
+		}
+	}
+
+	// Changed output limits are seen by the bound evaluator
+	BindCurveEvaluator( 1 );
+	bool ErrorsFound( false );
+	SetCurveOutputMinMaxValues( 1, ErrorsFound, _, 1.5 );
+	EXPECT_FALSE( ErrorsFound );
+	EXPECT_TRUE( PerfCurve( 1 ).Evaluator != nullptr );
+	EXPECT_DOUBLE_EQ( 1.5, CurveValue( 1, 12.0 ) );
+
+	// Tables are still evaluated through CurveValue
+	PerfCurve( 1 ).InterpolationType = LinearInterpolationOfTable;
+	BindCurveEvaluator( 1 );
+	EXPECT_TRUE( PerfCurve( 1 ).Evaluator == nullptr );
+
+	PerfCurve.deallocate();
+	NumCurves = 0;
+}
+
+TEST( CurveManagerTest, TableLookupFourVariables )
+{
+	ShowMessage( "Begin Test: CurveManagerTest, TableLookupFourVariables" );
+
+	// Table of a function linear in each variable, which linear Lagrange interpolation reproduces
+	NumCurves = 1;
+	PerfCurve.allocate( NumCurves );
+	auto & Curve( PerfCurve( 1 ) );
+	Curve.InterpolationType = LagrangeInterpolationLinearExtrapolation;
+	Curve.TableIndex = 1;
+	Curve.Var1Min = Curve.Var2Min = Curve.Var3Min = Curve.Var4Min = -100.0;
+	Curve.Var1Max = Curve.Var2Max = Curve.Var3Max = Curve.Var4Max = 100.0;
+
+	TableLookup.allocate( 1 );
+	auto & Table( TableLookup( 1 ) );
+	Table.NumIndependentVars = 4;
+	Table.InterpolationOrder = 2;
+	Table.X1Var = Array1D< Real64 >( { 0.0, 1.0, 2.5, 4.0, 7.0 } );
+	Table.X2Var = Array1D< Real64 >( { -1.0, 0.0, 2.0, 3.0 } );
+	Table.X3Var = Array1D< Real64 >( { 10.0, 12.0, 15.0, 20.0, 21.0, 30.0 } );
+	Table.X4Var = Array1D< Real64 >( { 0.2, 0.4, 0.9 } );
+	Table.NumX1Vars = Table.X1Var.isize();
+	Table.NumX2Vars = Table.X2Var.isize();
+	Table.NumX3Vars = Table.X3Var.isize();
+	Table.NumX4Vars = Table.X4Var.isize();
+	Table.NumX5Vars = 1;
+	auto const F = []( Real64 const X1, Real64 const X2, Real64 const X3, Real64 const X4 ) { return 1.0 + X1 + 2.0 * X2 + 0.1 * X1 * X3 - 3.0 * X4 * X2 + 0.5 * X3 * X4; };
+	Table.TableLookupZData.allocate( 1, Table.NumX4Vars, Table.NumX3Vars, Table.NumX2Vars, Table.NumX1Vars );
+	for ( int I4 = 1; I4 <= Table.NumX4Vars; ++I4 ) {
+		for ( int I3 = 1; I3 <= Table.NumX3Vars; ++I3 ) {
+			for ( int I2 = 1; I2 <= Table.NumX2Vars; ++I2 ) {
+				for ( int I1 = 1; I1 <= Table.NumX1Vars; ++I1 ) {
+					Table.TableLookupZData( 1, I4, I3, I2, I1 ) = F( Table.X1Var( I1 ), Table.X2Var( I2 ), Table.X3Var( I3 ), Table.X4Var( I4 ) );
+				}
+			}
+		}
+	}
+
+	// Between points, on points and beyond the axes
+	Real64 const Points[][ 4 ] = { { 0.5, 0.5, 11.0, 0.3 }, { 2.5, 2.0, 20.0, 0.4 }, { 2.5, 1.0, 25.0, 0.9 }, { -1.0, 4.0, 5.0, 1.2 }, { 8.0, -2.0, 31.0, 0.1 } };
+	for ( auto const & P : Points ) {
+		EXPECT_NEAR( F( P[ 0 ], P[ 1 ], P[ 2 ], P[ 3 ] ), TableLookupObject( 1, P[ 0 ], P[ 1 ], P[ 2 ], P[ 3 ] ), 1.0e-9 );
+	}
+
+	// The stencil of an axis is that of DLAG
+	TableAxisStencil Stencil;
+	FindTableAxisStencil( 16.0, Table.X3Var, Table.NumX3Vars, 2, Stencil );
+	EXPECT_EQ( 3, Stencil.Lo );
+	EXPECT_EQ( 4, Stencil.Hi );
+	EXPECT_FALSE( Stencil.Exact );
+	FindTableAxisStencil( 21.0, Table.X3Var, Table.NumX3Vars, 3, Stencil );
+	EXPECT_TRUE( Stencil.Exact );
+	EXPECT_EQ( 5, Stencil.Lo );
+	FindTableAxisStencil( 40.0, Table.X3Var, Table.NumX3Vars, 3, Stencil );
+	EXPECT_EQ( 1, Stencil.Extrap );
+	EXPECT_EQ( 5, Stencil.Lo );
+	EXPECT_EQ( 6, Stencil.Hi );
+
+	TableLookup.deallocate();
+	PerfCurve.deallocate();
+	NumCurves = 0;
+}
+
+TEST( CurveManagerTest, MoodyFrictionFactorRoughnessTerm )
+{
+	ShowMessage( "Begin Test: CurveManagerTest, MoodyFrictionFactorRoughnessTerm" );
+
+	// Alternating between two pipes must not reuse the roughness term of the other
+	Real64 const RoughnessRatios[] = { 0.0001, 0.002, 0.0001, 0.002 };
+	Real64 const ReynoldsNumbers[] = { 5.0e4, 1.2e5, 2.0e5, 5.0e4 };
+	for ( int i = 0; i < 4; ++i ) {
+		Real64 const Expected( std::pow( -1.8 * std::log10( std::pow( RoughnessRatios[ i ] / 3.7, 1.11 ) + 6.9 / ReynoldsNumbers[ i ] ), -2.0 ) );
+		EXPECT_EQ( Expected, CalculateMoodyFrictionFactor( ReynoldsNumbers[ i ], RoughnessRatios[ i ] ) );
+	}
+	EXPECT_EQ( 0.0, CalculateMoodyFrictionFactor( 5.0e4, 0.0 ) );
+}
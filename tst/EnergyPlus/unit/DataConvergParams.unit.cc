@@ -0,0 +1,36 @@
+// EnergyPlus::DataConvergParams Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array.functions.hh>
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <DataConvergParams.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataConvergParams;
+using namespace ObjexxFCL;
+
+TEST( DataConvergParamsTest, ConvergLogStackMatchesShiftedStack )
+{
+	ConvergLogStackData Stack;
+	Array1D< Real64 > Shifted( ConvergLogStackDepth, 0.0 );
+
+	for ( int Iter = 1; Iter <= 3 * ConvergLogStackDepth + 4; ++Iter ) {
+		Real64 const Value( 0.1 * Iter * Iter - 1.7 * Iter );
+		Stack.push( Value );
+		for ( int i = ConvergLogStackDepth; i > 1; --i ) {
+			Shifted( i ) = Shifted( i - 1 );
+		}
+		Shifted( 1 ) = Value;
+
+		for ( int StackDepth = 1; StackDepth <= ConvergLogStackDepth; ++StackDepth ) {
+			EXPECT_EQ( Shifted( StackDepth ), Stack( StackDepth ) );
+		}
+		EXPECT_EQ( sum( Shifted ), Stack.sum() );
+		EXPECT_EQ( sum( ConvergLogStackARR * Shifted ), Stack.weighted_sum( ConvergLogStackARR ) );
+	}
+}
@@ -0,0 +1,200 @@
+// EnergyPlus::DaylightingManager Unit Tests
+
+// C++ Headers
+#include <cstdio>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DaylightingManager.hh>
+#include <EnergyPlus/DataDaylighting.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DaylightingManager;
+using namespace EnergyPlus::DataDaylighting;
+using namespace EnergyPlus::DataGlobals;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataSurfaces;
+using namespace ObjexxFCL;
+
+TEST( DaylightingManagerTest, DaylightingCacheRoundTrip )
+{
+	ShowMessage( "Begin Test: DaylightingManagerTest, DaylightingCacheRoundTrip" );
+
+	std::string const CacheFile( "eplus_test_daylighting_cache.bin" );
+	std::remove( CacheFile.c_str() );
+
+	NumOfZones = 1;
+	TotSurfaces = 1;
+	Surface.allocate( TotSurfaces );
+	SurfaceWindow.allocate( TotSurfaces );
+	Surface( 1 ).Class = SurfaceClass_Window;
+	Surface( 1 ).Construction = 1;
+	ZoneDaylight.allocate( NumOfZones );
+	auto & zone( ZoneDaylight( 1 ) );
+	zone.TotalDaylRefPoints = 1;
+	zone.NumOfDayltgExtWins = 1;
+	zone.DayltgExtWinSurfNums.dimension( 1, 1 );
+	zone.SolidAngAtRefPt.dimension( 1, 1, 0.0 );
+	zone.SolidAngAtRefPtWtd.dimension( 1, 1, 0.0 );
+	zone.DaylIllFacSky.dimension( 24, 2, 4, 1, 1, 0.0 );
+	zone.DaylSourceFacSky.dimension( 24, 2, 4, 1, 1, 0.0 );
+	zone.DaylBackFacSky.dimension( 24, 2, 4, 1, 1, 0.0 );
+	zone.DaylIllFacSun.dimension( 24, 2, 1, 1, 0.0 );
+	zone.DaylIllFacSunDisk.dimension( 24, 2, 1, 1, 0.0 );
+	zone.DaylSourceFacSun.dimension( 24, 2, 1, 1, 0.0 );
+	zone.DaylSourceFacSunDisk.dimension( 24, 2, 1, 1, 0.0 );
+	zone.DaylBackFacSun.dimension( 24, 2, 1, 1, 0.0 );
+	zone.DaylBackFacSunDisk.dimension( 24, 2, 1, 1, 0.0 );
+	SUNCOSHR.dimension( 24, 3, 0.0 );
+	SUNCOSHR( 12, 3 ) = 0.9;
+
+	InitDaylightingCache( CacheFile );
+	ASSERT_TRUE( DaylightingCache.Active );
+	EXPECT_EQ( 0u, DaylightingCache.Index.size() );
+	EXPECT_FALSE( DaylightingCache.ZoneCalculated( 1 ) );
+	EXPECT_TRUE( DaylightingCacheUsable( 1 ) );
+	EXPECT_FALSE( RestoreDayltgCoeffsFromCache( 1, false ) );
+
+	zone.SolidAngAtRefPt( 1, 1 ) = 0.3;
+	zone.DaylIllFacSky( 12, 1, 4, 1, 1 ) = 0.02;
+	zone.DaylBackFacSunDisk( 12, 2, 1, 1 ) = 1.5;
+	SaveDayltgCoeffsToCache( 1, false );
+	EXPECT_EQ( 1, DaylightingCache.NumMisses );
+
+	// The factors come back for the same sun positions
+	zone.SolidAngAtRefPt = 0.0;
+	zone.DaylIllFacSky = 0.0;
+	zone.DaylBackFacSunDisk = 0.0;
+	ASSERT_TRUE( RestoreDayltgCoeffsFromCache( 1, false ) );
+	EXPECT_EQ( 1, DaylightingCache.NumHits );
+	EXPECT_DOUBLE_EQ( 0.3, zone.SolidAngAtRefPt( 1, 1 ) );
+	EXPECT_DOUBLE_EQ( 0.02, zone.DaylIllFacSky( 12, 1, 4, 1, 1 ) );
+	EXPECT_DOUBLE_EQ( 1.5, zone.DaylBackFacSunDisk( 12, 2, 1, 1 ) );
+
+	// Other sun positions or ground reflectance are not cached
+	SUNCOSHR( 12, 3 ) = 0.8;
+	EXPECT_FALSE( RestoreDayltgCoeffsFromCache( 1, false ) );
+	SUNCOSHR( 12, 3 ) = 0.9;
+	DataEnvironment::GndReflectanceForDayltg += 0.1;
+	EXPECT_FALSE( RestoreDayltgCoeffsFromCache( 1, false ) );
+	DataEnvironment::GndReflectanceForDayltg -= 0.1;
+
+	// The record is found again by a later run with the same input
+	InitDaylightingCache( CacheFile );
+	ASSERT_TRUE( DaylightingCache.Active );
+	EXPECT_EQ( 1u, DaylightingCache.Index.size() );
+	EXPECT_TRUE( RestoreDayltgCoeffsFromCache( 1, false ) );
+
+	// Zones seen through a tubular daylighting device are always calculated
+	SurfaceWindow( 1 ).OriginalClass = SurfaceClass_TDD_Diffuser;
+	EXPECT_FALSE( DaylightingCacheUsable( 1 ) );
+	SurfaceWindow( 1 ).OriginalClass = SurfaceClass_Window;
+
+	// Changed input starts the file over
+	Surface( 1 ).Construction = 2;
+	InitDaylightingCache( CacheFile );
+	ASSERT_TRUE( DaylightingCache.Active );
+	EXPECT_EQ( 0u, DaylightingCache.Index.size() );
+	EXPECT_FALSE( RestoreDayltgCoeffsFromCache( 1, false ) );
+
+	// No file name turns the cache off
+	InitDaylightingCache( "" );
+	EXPECT_FALSE( DaylightingCache.Active );
+	EXPECT_FALSE( DaylightingCacheUsable( 1 ) );
+	std::remove( CacheFile.c_str() );
+
+	ZoneDaylight.deallocate();
+	Surface.deallocate();
+	SurfaceWindow.deallocate();
+	SUNCOSHR = 0.0;
+	TotSurfaces = 0;
+	NumOfZones = 0;
+}
+
+TEST( DaylightingManagerTest, StoreDaylFactor )
+{
+	ShowMessage( "Begin Test: DaylightingManagerTest, StoreDaylFactor" );
+
+	DaylFactorType Factor( 0.0 );
+	Real64 MaxError( 0.0 );
+	StoreDaylFactor( Factor, 0.0, MaxError ); // A zero factor has no relative error
+	EXPECT_EQ( 0.0, MaxError );
+	StoreDaylFactor( Factor, 0.1, MaxError );
+	EXPECT_EQ( DaylFactorType( 0.1 ), Factor );
+#ifdef EP_DAYLIGHTING_FLOAT_FACTORS
+	EXPECT_GT( MaxError, 0.0 );
+	EXPECT_LT( MaxError, 1.0e-7 );
+#else
+	EXPECT_EQ( 0.0, MaxError );
+#endif
+	Real64 const FirstError( MaxError );
+	StoreDaylFactor( Factor, 0.5, MaxError ); // Exact in either precision
+	EXPECT_EQ( FirstError, MaxError );
+}
+
+TEST( DaylightingManagerTest, DayltgInterpolateMapFactors )
+{
+	ShowMessage( "Begin Test: DaylightingManagerTest, DayltgInterpolateMapFactors" );
+
+	int const NumPoints( 3 );
+	IllumMapCalc.allocate( 1 );
+	auto & map( IllumMapCalc( 1 ) );
+	map.TotalMapRefPoints = NumPoints;
+	map.DaylIllFacSky.dimension( 24, 2, 4, 2, NumPoints, 0.0 );
+	map.DaylSourceFacSky.dimension( 24, 2, 4, 2, NumPoints, 0.0 );
+	map.DaylBackFacSky.dimension( 24, 2, 4, 2, NumPoints, 0.0 );
+	map.DaylIllFacSun.dimension( 24, 2, 2, NumPoints, 0.0 );
+	map.DaylIllFacSunDisk.dimension( 24, 2, 2, NumPoints, 0.0 );
+	map.DaylSourceFacSun.dimension( 24, 2, 2, NumPoints, 0.0 );
+	map.DaylSourceFacSunDisk.dimension( 24, 2, 2, NumPoints, 0.0 );
+	map.DaylBackFacSun.dimension( 24, 2, 2, NumPoints, 0.0 );
+	map.DaylBackFacSunDisk.dimension( 24, 2, 2, NumPoints, 0.0 );
+	map.IllumFromWinAtMapPt.dimension( 2, 2, NumPoints, 0.0 );
+	map.BackLumFromWinAtMapPt.dimension( 2, 2, NumPoints, 0.0 );
+	map.SourceLumFromWinAtMapPt.dimension( 2, 2, NumPoints, 0.0 );
+	for ( int IL = 1; IL <= NumPoints; ++IL ) {
+		for ( int ISky = 1; ISky <= 4; ++ISky ) {
+			map.DaylIllFacSky( 11, 2, ISky, 2, IL ) = 0.01 * ISky + 0.001 * IL;
+			map.DaylIllFacSky( 12, 2, ISky, 2, IL ) = 0.02 * ISky + 0.001 * IL;
+		}
+		map.DaylIllFacSun( 11, 2, 2, IL ) = 0.05 * IL;
+		map.DaylIllFacSun( 12, 2, 2, IL ) = 0.06 * IL;
+		map.DaylIllFacSunDisk( 12, 2, 2, IL ) = 0.1;
+		map.DaylSourceFacSun( 12, 2, 2, IL ) = -1.0; // Negative source luminance is clipped
+	}
+	HourOfDay = 12;
+	PreviousHour = 11;
+	WeightNow = 0.75;
+	WeightPreviousHour = 0.25;
+	DataEnvironment::HISUNF = 1000.0;
+	Array1D< Real64 > HorIllSky( 4, { 100.0, 200.0, 300.0, 400.0 } );
+
+	DayltgInterpolateMapFactors( 1, 2, 2, false, 0.5, 2, 3, 0.4, HorIllSky, 1.1 );
+	for ( int IL = 1; IL <= NumPoints; ++IL ) {
+		Real64 const SkyFac2( 0.5 * ( 0.75 * map.DaylIllFacSky( 12, 2, 2, 2, IL ) + 0.25 * map.DaylIllFacSky( 11, 2, 2, 2, IL ) ) );
+		Real64 const SkyFac3( 0.5 * ( 0.75 * map.DaylIllFacSky( 12, 2, 3, 2, IL ) + 0.25 * map.DaylIllFacSky( 11, 2, 3, 2, IL ) ) );
+		Real64 const SunFac( 0.5 * ( 0.75 * map.DaylIllFacSun( 12, 2, 2, IL ) + 0.25 * map.DaylIllFacSun( 11, 2, 2, IL ) ) );
+		EXPECT_DOUBLE_EQ( SunFac * 1000.0 + 1.1 * ( SkyFac2 * 0.4 * 200.0 + SkyFac3 * 0.6 * 300.0 ), map.IllumFromWinAtMapPt( 2, 2, IL ) );
+		EXPECT_EQ( 0.0, map.SourceLumFromWinAtMapPt( 2, 2, IL ) );
+		EXPECT_EQ( 0.0, map.IllumFromWinAtMapPt( 1, 2, IL ) ); // Other windows are not set
+	}
+
+	// The sun disk is added unless the slats block the beam
+	Real64 const WithoutDisk( map.IllumFromWinAtMapPt( 2, 2, 1 ) );
+	DayltgInterpolateMapFactors( 1, 2, 2, true, 0.5, 2, 3, 0.4, HorIllSky, 1.1 );
+	EXPECT_DOUBLE_EQ( WithoutDisk + 0.5 * 0.75 * 0.1 * 1000.0, map.IllumFromWinAtMapPt( 2, 2, 1 ) );
+
+	IllumMapCalc.deallocate();
+	HourOfDay = 0;
+	PreviousHour = 0;
+	WeightNow = 0.0;
+	WeightPreviousHour = 0.0;
+	DataEnvironment::HISUNF = 0.0;
+}
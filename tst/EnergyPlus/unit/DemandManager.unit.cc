@@ -0,0 +1,59 @@
+// EnergyPlus::DemandManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DemandManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DemandManager;
+using namespace EnergyPlus::DataHeatBalance;
+
+TEST( DemandManagerTest, LimitChangedZone )
+{
+
+	ShowMessage( "Begin Test: DemandManagerTest, LimitChangedZone" );
+
+	bool CanReduceDemand( false );
+
+	DataGlobals::NumOfZones = 3;
+	Lights.allocate( 1 );
+	Lights( 1 ).ZonePtr = 2;
+	Lights( 1 ).DesignLevel = 1000.0;
+	Lights( 1 ).Power = 1000.0;
+	DemandMgr.allocate( 1 );
+	DemandMgr( 1 ).Type = ManagerTypeLights;
+	DemandMgr( 1 ).LowerLimit = 0.5;
+	LimitChangedZone.deallocate();
+
+	// Checking whether the load can be reduced changes no limit
+	LoadInterface( CheckCanReduce, 1, 1, CanReduceDemand );
+	EXPECT_TRUE( CanReduceDemand );
+	ASSERT_EQ( 3, LimitChangedZone.isize() );
+	EXPECT_FALSE( LimitChangedZone( 2 ) );
+
+	LoadInterface( SetLimit, 1, 1, CanReduceDemand );
+	EXPECT_TRUE( Lights( 1 ).ManageDemand );
+	EXPECT_EQ( 500.0, Lights( 1 ).DemandLimit );
+	EXPECT_FALSE( LimitChangedZone( 1 ) );
+	EXPECT_TRUE( LimitChangedZone( 2 ) );
+	EXPECT_FALSE( LimitChangedZone( 3 ) );
+
+	// Setting the same limit again leaves the zone heat balance as it is
+	LimitChangedZone = false;
+	LoadInterface( SetLimit, 1, 1, CanReduceDemand );
+	EXPECT_FALSE( LimitChangedZone( 2 ) );
+
+	LoadInterface( ClearLimit, 1, 1, CanReduceDemand );
+	EXPECT_FALSE( Lights( 1 ).ManageDemand );
+	EXPECT_TRUE( LimitChangedZone( 2 ) );
+
+	Lights.deallocate();
+	DemandMgr.deallocate();
+	LimitChangedZone.deallocate();
+	DataGlobals::NumOfZones = 0;
+}
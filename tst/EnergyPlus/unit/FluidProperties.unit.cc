@@ -0,0 +1,87 @@
+// EnergyPlus::FluidProperties Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FluidProperties.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::FluidProperties;
+
+TEST( FluidPropertiesTest, FindArrayIndexWithAxis )
+{
+	ShowMessage( "Begin Test: FluidPropertiesTest, FindArrayIndexWithAxis" );
+
+	// Irregular spacing, like the refrigerant temperature tables
+	Array1D< Real64 > Temps( { -70.0, -60.0, -55.0, -50.0, -48.0, -46.0, -45.5, -45.0, -20.0, 0.0, 0.5, 1.0, 40.0, 90.0 } );
+	FluidPropsAxisIndex Axis;
+
+	for ( int LowBound = 1; LowBound <= 3; ++LowBound ) {
+		int const UpperBound( Temps.isize() - LowBound + 1 );
+		BuildAxisIndex( Axis, Temps, LowBound, UpperBound );
+		ASSERT_FALSE( Axis.Start.empty() );
+		for ( Real64 Value = -80.0; Value <= 100.0; Value += 0.125 ) {
+			EXPECT_EQ( FindArrayIndex( Value, Temps, LowBound, UpperBound ), FindArrayIndex( Value, Temps, LowBound, UpperBound, Axis ) );
+		}
+		for ( int i = 1; i <= Temps.isize(); ++i ) {
+			EXPECT_EQ( FindArrayIndex( Temps( i ), Temps, LowBound, UpperBound ), FindArrayIndex( Temps( i ), Temps, LowBound, UpperBound, Axis ) );
+		}
+		// Other bounds than the index was built for are still searched
+		EXPECT_EQ( FindArrayIndex( 0.25, Temps, 1, 12 ), FindArrayIndex( 0.25, Temps, 1, 12, Axis ) );
+	}
+
+	// Tables out of order are not indexed
+	Temps( 5 ) = -65.0;
+	BuildAxisIndex( Axis, Temps, 1, Temps.isize() );
+	EXPECT_TRUE( Axis.Start.empty() );
+}
+
+TEST( FluidPropertiesTest, GlycolPropsHandle )
+{
+	ShowMessage( "Begin Test: FluidPropertiesTest, GlycolPropsHandle" );
+
+	bool const SaveGetInput( GetInput );
+	GetInput = false;
+	NumOfRefrigerants = 0;
+	NumOfGlycols = 1;
+	GlycolData.allocate( 1 );
+	auto & glycol( GlycolData( 1 ) );
+	glycol.Name = "TESTGLYCOL";
+	glycol.CpDataPresent = true;
+	glycol.CpTemps = Array1D< Real64 >( { 0.0, 5.0, 10.0, 20.0, 40.0, 60.0, 100.0 } );
+	glycol.CpValues = Array1D< Real64 >( { 4217.0, 4202.0, 4192.0, 4182.0, 4179.0, 4184.0, 4216.0 } );
+	glycol.CpLowTempIndex = 1;
+	glycol.CpHighTempIndex = 7;
+	glycol.CpLowTempValue = 0.0;
+	glycol.CpHighTempValue = 100.0;
+	glycol.RhoDataPresent = true;
+	glycol.RhoTemps = glycol.CpTemps;
+	glycol.RhoValues = Array1D< Real64 >( { 999.8, 999.9, 999.7, 998.2, 992.2, 983.2, 958.4 } );
+	glycol.RhoLowTempIndex = 1;
+	glycol.RhoHighTempIndex = 7;
+	glycol.RhoLowTempValue = 0.0;
+	glycol.RhoHighTempValue = 100.0;
+	InitializeFluidAxisIndexes();
+	EXPECT_FALSE( glycol.CpTempAxis.Start.empty() );
+
+	GlycolPropsHandle Handle( 1 );
+	for ( Real64 Temperature = 0.0; Temperature <= 100.0; Temperature += 0.25 ) {
+		int GlycolIndex( 1 );
+		EXPECT_EQ( GetSpecificHeatGlycol( "TESTGLYCOL", Temperature, GlycolIndex, "Test" ), GetSpecificHeatGlycol( Handle, Temperature, "Test" ) );
+		EXPECT_EQ( GetDensityGlycol( "TESTGLYCOL", Temperature, GlycolIndex, "Test" ), GetDensityGlycol( Handle, Temperature, "Test" ) );
+	}
+
+	// The last result is given back at the same temperature
+	EXPECT_TRUE( Handle.CpSaved );
+	EXPECT_DOUBLE_EQ( 100.0, Handle.CpTemp );
+	Handle.Cp = 1.0;
+	EXPECT_DOUBLE_EQ( 1.0, GetSpecificHeatGlycol( Handle, 100.0, "Test" ) );
+	EXPECT_NEAR( 4215.6, GetSpecificHeatGlycol( Handle, 99.5, "Test" ), 1.0e-9 );
+	EXPECT_DOUBLE_EQ( 99.5, Handle.CpTemp );
+
+	GlycolData.deallocate();
+	NumOfGlycols = 0;
+	GetInput = SaveGetInput;
+}
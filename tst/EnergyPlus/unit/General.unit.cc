@@ -0,0 +1,173 @@
+// EnergyPlus::General Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/General.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::General;
+using namespace ObjexxFCL;
+
+namespace {
+
+	int NumResidualCalls( 0 );
+
+	Real64
+	CubicResidual(
+		Real64 const X,
+		Array1< Real64 > const & Par
+	)
+	{
+		++NumResidualCalls;
+		return X * X * X - Par( 1 );
+	}
+
+}
+
+TEST( GeneralTest, SolveRootWarmStart )
+{
+	ShowMessage( "Begin Test: GeneralTest, SolveRootWarmStart" );
+
+	Array1D< Real64 > Par( 1, 0.125 ); // Root at 0.5
+	Real64 const Eps( 1.0e-8 );
+	int Flag( 0 );
+	Real64 XRes( 0.0 );
+
+	// Same root as the regula falsi solver
+	SolveRegulaFalsi( Eps, 500, Flag, XRes, CubicResidual, 0.0, 1.0, Par );
+	EXPECT_GT( Flag, 0 );
+	EXPECT_NEAR( 0.5, XRes, 1.0e-6 );
+	int const RegulaFalsiCalls( NumResidualCalls );
+
+	RootSolverStatistics Stats;
+	NumResidualCalls = 0;
+	SolveRootWarmStart( Eps, 500, Flag, XRes, CubicResidual, 0.0, 1.0, Par, 0.9, _, _, Stats );
+	EXPECT_GT( Flag, 0 );
+	EXPECT_NEAR( 0.5, XRes, 1.0e-6 );
+	EXPECT_LT( NumResidualCalls, RegulaFalsiCalls );
+	EXPECT_EQ( NumResidualCalls, Stats.NumEvaluations );
+	EXPECT_EQ( Flag, Stats.NumIterations );
+
+	// A starting estimate at the solution needs one evaluation beyond the known bound residuals
+	NumResidualCalls = 0;
+	SolveRootWarmStart( Eps, 500, Flag, XRes, CubicResidual, 0.0, 1.0, Par, 0.5, -0.125, 0.875, Stats );
+	EXPECT_EQ( 1, Flag );
+	EXPECT_DOUBLE_EQ( 0.5, XRes );
+	EXPECT_EQ( 1, NumResidualCalls );
+	EXPECT_EQ( 1, Stats.NumWarmStarts );
+	EXPECT_EQ( 2, Stats.NumSolves );
+
+	// Bounds that do not bracket the root
+	SolveRootWarmStart( Eps, 500, Flag, XRes, CubicResidual, 0.6, 1.0, Par, 0.8, _, _, Stats );
+	EXPECT_EQ( -2, Flag );
+	EXPECT_DOUBLE_EQ( 0.6, XRes );
+	EXPECT_EQ( 1, Stats.NumNotBracketed );
+}
+
+TEST( GeneralTest, SearchSpeedLevel )
+{
+	ShowMessage( "Begin Test: GeneralTest, SearchSpeedLevel" );
+
+	// Output of a ten speed unit, the load met from speed 7
+	Real64 const Output[] = { 0.0, 1000.0, 1900.0, 2700.0, 3400.0, 4000.0, 4500.0, 5100.0, 5600.0, 6000.0, 6300.0 };
+	Real64 const Load( 4800.0 );
+	int NumTrials( 0 );
+	auto Residual = [&]( int const Speed ) -> Real64 {
+		++NumTrials;
+		return Output[ Speed ] - Load;
+	};
+
+	// Same speed as trying each speed in turn, in fewer trials
+	EXPECT_EQ( 7, SearchSpeedLevel( 1, Output[ 1 ] - Load, 10, Output[ 10 ] - Load, Residual ) );
+	EXPECT_LE( NumTrials, 4 );
+
+	// Every speed of the bracket can be the result
+	for ( int Speed = 2; Speed <= 10; ++Speed ) {
+		Real64 const SpeedLoad( Output[ Speed ] - 10.0 );
+		EXPECT_EQ( Speed, SearchSpeedLevel( 1, Output[ 1 ] - SpeedLoad, 10, Output[ 10 ] - SpeedLoad, [&]( int const S ) -> Real64 { return Output[ S ] - SpeedLoad; } ) );
+	}
+
+	// Adjacent speeds need no trial
+	NumTrials = 0;
+	EXPECT_EQ( 2, SearchSpeedLevel( 1, -1.0, 2, 1.0, Residual ) );
+	EXPECT_EQ( 0, NumTrials );
+}
+
+TEST( GeneralTest, RootSolverCallSiteStatistics )
+{
+	ShowMessage( "Begin Test: GeneralTest, RootSolverCallSiteStatistics" );
+
+	Array1D< Real64 > Par( 1, 0.125 );
+	int Flag( 0 );
+	Real64 XRes( 0.0 );
+
+	// Nothing is kept unless the statistics are reported
+	EXPECT_EQ( 0, RootSolverCallSiteIndex( "Part Load Ratio", "Test:Unit", "UNIT 1" ) );
+
+	DataSystemVariables::ReportRootSolverStatistics = true;
+	int const Site1( RootSolverCallSiteIndex( "Part Load Ratio", "Test:Unit", "UNIT 1" ) );
+	int const Site2( RootSolverCallSiteIndex( "Part Load Ratio", "Test:Unit", "UNIT 2" ) );
+	EXPECT_EQ( 1, Site1 );
+	EXPECT_EQ( 2, Site2 );
+	EXPECT_EQ( Site1, RootSolverCallSiteIndex( "Part Load Ratio", "Test:Unit", "UNIT 1" ) );
+
+	SolveRegulaFalsi( 1.0e-8, 500, Flag, XRes, CubicResidual, 0.0, 1.0, Par, Site1 );
+	int const Iterations( Flag );
+	SolveRegulaFalsi( 1.0e-8, 500, Flag, XRes, CubicResidual, 0.0, 1.0, Par, Site1 );
+	SolveRegulaFalsi( 1.0e-8, 500, Flag, XRes, CubicResidual, 0.6, 1.0, Par, Site2 );
+	SolveRegulaFalsi( 1.0e-8, 2, Flag, XRes, CubicResidual, 0.0, 1.0, Par );
+
+	EXPECT_EQ( 2, RootSolverCallSites[ Site1 - 1 ].Stats.NumSolves );
+	EXPECT_EQ( 2 * Iterations, RootSolverCallSites[ Site1 - 1 ].Stats.NumIterations );
+	EXPECT_EQ( 2 * ( Iterations + 2 ), RootSolverCallSites[ Site1 - 1 ].Stats.NumEvaluations );
+	EXPECT_EQ( 1, RootSolverCallSites[ Site2 - 1 ].Stats.NumNotBracketed );
+	ASSERT_EQ( 3u, RootSolverCallSites.size() ); // Solves without a call site are counted together
+	EXPECT_EQ( 1, RootSolverCallSites[ 2 ].Stats.NumNotConverged );
+
+	DataSystemVariables::ReportRootSolverStatistics = false;
+	RootSolverCallSites.clear();
+	RootSolverCallSiteMap.clear();
+}
+
+TEST( GeneralTest, FormatFixedAndListDirected )
+{
+	ShowMessage( "Begin Test: GeneralTest, FormatFixedAndListDirected" );
+
+	// Same text as the gio formats they stand for
+	Real64 const Values[] = { 0.0, -0.0, 1.0, -1.5, 0.05, 0.1, 9.995, -0.004, 12.345, 123456.789, 9.999999999999999e16, 1.0e17, 1.0e20, -1.0e-3, 1.0e-300 };
+	static gio::Fmt fmtLD( "*" );
+	static gio::Fmt fmtF12p2( "(F12.2)" );
+	static gio::Fmt fmtF12p0( "(F12.0)" );
+	char Buffer[ 32 ];
+	for ( Real64 const Value : Values ) {
+		std::string Expected;
+		gio::write( Expected, fmtLD ) << Value;
+		EXPECT_EQ( Expected.length(), FormatListDirected( Buffer, Value ) );
+		EXPECT_EQ( Expected, std::string( Buffer ) );
+		gio::write( Expected, fmtF12p2 ) << Value;
+		FormatFixed( Buffer, Value, 12, 2 );
+		EXPECT_EQ( Expected, std::string( Buffer ) );
+		gio::write( Expected, fmtF12p0 ) << Value;
+		FormatFixed( Buffer, Value, 12, 0 );
+		EXPECT_EQ( Expected, std::string( Buffer ) );
+	}
+
+	// Lead zero dropped, then asterisks, when the value does not fit
+	FormatFixed( Buffer, 0.25, 3, 2 );
+	EXPECT_EQ( ".25", std::string( Buffer ) );
+	FormatFixed( Buffer, -0.25, 4, 2 );
+	EXPECT_EQ( "-.25", std::string( Buffer ) );
+	FormatFixed( Buffer, 123.25, 4, 2 );
+	EXPECT_EQ( "****", std::string( Buffer ) );
+
+	// Trimming and rounding keep working from the list directed text
+	EXPECT_EQ( "12.34", TrimSigDigits( 12.3456, 2 ) );
+	EXPECT_EQ( "12.35", RoundSigDigits( 12.3456, 2 ) );
+}
@@ -0,0 +1,39 @@
+// EnergyPlus::GlobalNames Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/GlobalNames.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::GlobalNames;
+
+TEST( GlobalNamesTest, VerifyUniqueCoilName )
+{
+	ShowMessage( "Begin Test: GlobalNamesTest, VerifyUniqueCoilName" );
+
+	int const NumCoilsBefore( NumCoils );
+	bool ErrorFound( false );
+
+	// Enough coils to grow the list past its first allocations
+	for ( int Loop = 1; Loop <= 20; ++Loop ) {
+		VerifyUniqueCoilName( "Coil:Heating:Electric", "GLOBALNAMES TEST COIL " + std::to_string( Loop ), ErrorFound, "Coil:Heating:Electric Name" );
+		EXPECT_FALSE( ErrorFound );
+	}
+	EXPECT_EQ( NumCoilsBefore + 20, NumCoils );
+	EXPECT_EQ( "GLOBALNAMES TEST COIL 13", CoilNames( NumCoilsBefore + 13 ).CompName );
+	EXPECT_EQ( "COIL:HEATING:ELECTRIC", CoilNames( NumCoilsBefore + 13 ).CompType );
+	EXPECT_EQ( NumCoilsBefore + 13, CoilNamesIndex.at( "GLOBALNAMES TEST COIL 13" ) );
+
+	// A repeated name is refused and not added again
+	VerifyUniqueCoilName( "Coil:Cooling:DX:SingleSpeed", "GLOBALNAMES TEST COIL 7", ErrorFound, "Coil:Cooling:DX:SingleSpeed Name" );
+	EXPECT_TRUE( ErrorFound );
+	EXPECT_EQ( NumCoilsBefore + 20, NumCoils );
+
+	// Names are matched as given, like the list search they replace
+	VerifyUniqueCoilName( "Coil:Heating:Electric", "GlobalNames Test Coil 7", ErrorFound, "Coil:Heating:Electric Name" );
+	EXPECT_FALSE( ErrorFound );
+	EXPECT_EQ( NumCoilsBefore + 21, NumCoils );
+}
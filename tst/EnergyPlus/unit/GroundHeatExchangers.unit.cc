@@ -3,10 +3,14 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array.functions.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus/GroundHeatExchangers.hh>
 #include <EnergyPlus/DataPlant.hh>
 #include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
 using namespace EnergyPlus;
@@ -263,3 +267,138 @@ TEST( SlinkyGroundHeatExchangerTest, CalcGroundHeatExchanger )
 	EXPECT_NEAR( 18.91819, thisGLHE.GFNC( 28 ), 0.0001 );
 
 }
+
+TEST( VerticalGroundHeatExchangerTest, FiniteLineSource )
+{
+	ShowMessage( "Begin Test: VerticalGroundHeatExchangerTest, FiniteLineSource" );
+
+	// Borehole of unit length with the steady state time of 1
+	Real64 const radiusRatio( 0.0005 );
+	Real64 const depthRatio( 0.01 );
+	Real64 const diffusivity( 1.0 / 9.0 );
+
+	// Before the ends matter the response is that of the infinite line source, E1(x)/2, E1(x) = -gamma - ln(x) + x for small x
+	Real64 const time( std::exp( -8.5 ) );
+	Real64 const x( pow_2( radiusRatio ) / ( 4.0 * diffusivity * time ) );
+	EXPECT_NEAR( 0.5 * ( -0.5772156649 - std::log( x ) + x ), finiteLineSourceResponse( radiusRatio, 1.0, depthRatio, diffusivity, time ), 0.01 );
+
+	// Steady state g-function of a single borehole
+	EXPECT_NEAR( 6.64, finiteLineSourceResponse( radiusRatio, 1.0, depthRatio, diffusivity, std::exp( 3.0 ) ), 0.01 );
+
+	// No response where the heat has not yet reached
+	EXPECT_DOUBLE_EQ( 0.0, finiteLineSourceResponse( 1.0, 1.0, depthRatio, diffusivity, 1.0e-4 ) );
+
+	// The field g-function is the mean over the boreholes of the responses to all boreholes
+	int const numX( 3 );
+	int const numY( 2 );
+	Real64 const spacingRatio( 0.05 );
+	Array1D< Real64 > LNTTS( 3 );
+	LNTTS( 1 ) = -4.0;
+	LNTTS( 2 ) = -1.0;
+	LNTTS( 3 ) = 2.0;
+	Array1D< Real64 > GFNC( 3, 0.0 );
+	calcBoreholeFieldGFunctions( numX, numY, spacingRatio, radiusRatio, depthRatio, LNTTS, GFNC );
+	for ( int timeNum = 1; timeNum <= 3; ++timeNum ) {
+		Real64 gFunc( 0.0 );
+		for ( int i1 = 0; i1 < numX; ++i1 ) {
+			for ( int j1 = 0; j1 < numY; ++j1 ) {
+				for ( int i2 = 0; i2 < numX; ++i2 ) {
+					for ( int j2 = 0; j2 < numY; ++j2 ) {
+						Real64 const dist( ( i1 == i2 && j1 == j2 ) ? radiusRatio : spacingRatio * std::sqrt( Real64( pow_2( i1 - i2 ) + pow_2( j1 - j2 ) ) ) );
+						gFunc += finiteLineSourceResponse( dist, 1.0, depthRatio, diffusivity, std::exp( LNTTS( timeNum ) ) );
+					}
+				}
+			}
+		}
+		EXPECT_NEAR( gFunc / ( numX * numY ), GFNC( timeNum ), 1.0e-10 );
+	}
+	EXPECT_GT( GFNC( 3 ), GFNC( 2 ) );
+	EXPECT_GT( GFNC( 2 ), GFNC( 1 ) );
+}
+
+TEST( SlinkyGroundHeatExchangerTest, AdaptiveQuadrature )
+{
+	ShowMessage( "Begin Test: SlinkyGroundHeatExchangerTest, AdaptiveQuadrature" );
+
+	// Smooth periodic function and a narrow peak inside the interval
+	auto smooth = []( Real64 const x ) { return 1.0 + std::cos( x ); };
+	EXPECT_NEAR( 2.0 * DataGlobals::Pi, integrateAdaptiveSimpson( smooth, 0.0, 2.0 * DataGlobals::Pi, 1.0e-8, 0.0 ), 1.0e-8 );
+	auto peak = []( Real64 const x ) { return 1.0 / ( 1.0e-4 + pow_2( x - 1.0 ) ); };
+	Real64 const peakIntegral( 100.0 * ( std::atan( 100.0 * 2.0 ) + std::atan( 100.0 * 1.0 ) ) ); // from 0 to 3
+	EXPECT_NEAR( 1.0, integrateAdaptiveSimpson( peak, 0.0, 3.0, 1.0e-8, 0.0 ) / peakIntegral, 1.0e-6 );
+
+	// The slinky g-functions are close to those of the fixed integration grids, which are coarse
+	// near the peak of a ring's response to itself
+	slinkyGFunctionCache.clear();
+	GLHESlinky thisGLHE;
+	thisGLHE.numCoils = 100;
+	thisGLHE.numTrenches = 2;
+	thisGLHE.maxSimYears = 10;
+	thisGLHE.coilPitch = 0.4;
+	thisGLHE.coilDepth = 1.5;
+	thisGLHE.coilDiameter = 0.8;
+	thisGLHE.pipeOutDia = 0.034;
+	thisGLHE.trenchSpacing = 3.0;
+	thisGLHE.diffusivityGround = 3.0e-007;
+	thisGLHE.AGG = 192;
+	thisGLHE.SubAGG = 15;
+	thisGLHE.calcGFunctions();
+	Real64 const fixedGFunc( thisGLHE.GFNC( 28 ) );
+
+	DataSystemVariables::SlinkyAdaptiveQuadrature = true;
+	slinkyGFunctionCache.clear();
+	thisGLHE.calcGFunctions();
+	DataSystemVariables::SlinkyAdaptiveQuadrature = false;
+	EXPECT_NEAR( 19.08237, fixedGFunc, 0.0001 );
+	EXPECT_NEAR( 19.06321, thisGLHE.GFNC( 28 ), 0.0001 );
+	slinkyGFunctionCache.clear();
+}
+
+TEST( GroundHeatExchangerTest, MultilevelLoadAggregation )
+{
+	ShowMessage( "Begin Test: GroundHeatExchangerTest, MultilevelLoadAggregation" );
+
+	// G-function of Log10( t ), with the ground conductivity making the resistance the g-function
+	GLHESlinky thisGLHE;
+	thisGLHE.NPairs = 2;
+	thisGLHE.LNTTS.allocate( thisGLHE.NPairs );
+	thisGLHE.GFNC.allocate( thisGLHE.NPairs );
+	thisGLHE.LNTTS( 1 ) = -2.0;
+	thisGLHE.LNTTS( 2 ) = 8.0;
+	thisGLHE.GFNC = thisGLHE.LNTTS;
+	thisGLHE.timeSSFactor = 1.0;
+	thisGLHE.kGround = 1.0 / ( 2.0 * Pi );
+	thisGLHE.AGG = 192;
+	thisGLHE.SubAGG = 15;
+	thisGLHE.QnHr.dimension( 730 + thisGLHE.AGG + thisGLHE.SubAGG, 0.0 );
+	thisGLHE.QnAggLevel.dimension( numAggBins, numAggLevels, 0.0 );
+
+	// Three years of a daily and a yearly cycle, most recent hour first
+	int const numHours( 3 * 8760 );
+	Array1D< Real64 > hourlyQn( numHours + 1, 0.0 );
+	for ( int hour = 1; hour <= numHours; ++hour ) {
+		hourlyQn( numHours - hour + 1 ) = 10.0 + 5.0 * std::sin( 2.0 * Pi * hour / 24.0 ) + 20.0 * std::sin( 2.0 * Pi * hour / 8760.0 );
+		thisGLHE.aggregateLoadLevels( thisGLHE.QnHr( thisGLHE.SubAGG + thisGLHE.AGG ) );
+		thisGLHE.QnHr = eoshift( thisGLHE.QnHr, -1, hourlyQn( numHours - hour + 1 ) );
+	}
+
+	// The aggregation keeps the load of the hours older than the hourly history
+	Real64 aggregatedEnergy( 0.0 );
+	for ( int level = 1; level <= numAggLevels; ++level ) {
+		for ( int bin = 1; bin <= numAggBins; ++bin ) {
+			aggregatedEnergy += std::pow( 2.0, level ) * thisGLHE.QnAggLevel( bin, level );
+		}
+	}
+	Real64 olderEnergy( 0.0 );
+	for ( int hour = thisGLHE.SubAGG + thisGLHE.AGG + 1; hour <= numHours; ++hour ) {
+		olderEnergy += hourlyQn( hour );
+	}
+	EXPECT_NEAR( olderEnergy, aggregatedEnergy, 1.0e-8 * olderEnergy );
+
+	// The response is close to that of the full hourly history
+	Real64 hourlyResponse( 0.0 );
+	for ( int hour = thisGLHE.SubAGG + 1; hour <= numHours; ++hour ) {
+		hourlyResponse += ( hourlyQn( hour ) - hourlyQn( hour + 1 ) ) * std::log10( Real64( hour ) );
+	}
+	EXPECT_NEAR( hourlyResponse, thisGLHE.calcMultilevelLoadResponse(), 0.001 * std::abs( hourlyResponse ) );
+}
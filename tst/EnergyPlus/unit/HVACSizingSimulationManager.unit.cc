@@ -273,7 +273,7 @@ TEST_F( HVACSizingSimulationManagerTest, WeatherFileDaysTest3 )
 	// first timestep
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 0 ].subSteps[ 0 ].LogDataValue );
+				.ztStepObj[ 0 ].subStepValues[ 0 ] );
 
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -282,7 +282,7 @@ TEST_F( HVACSizingSimulationManagerTest, WeatherFileDaysTest3 )
 	// last timestep of first hour
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 3 ].subSteps[ 2 ].LogDataValue );
+				.ztStepObj[ 3 ].subStepValues[ 2 ] );
 
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -291,7 +291,7 @@ TEST_F( HVACSizingSimulationManagerTest, WeatherFileDaysTest3 )
 	// first timestep of second hour
 	EXPECT_DOUBLE_EQ( 0.2 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 7 ].subSteps[ 0 ].LogDataValue );
+				.ztStepObj[ 7 ].subStepValues[ 0 ] );
 
 	EXPECT_DOUBLE_EQ( 0.2 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -300,7 +300,7 @@ TEST_F( HVACSizingSimulationManagerTest, WeatherFileDaysTest3 )
 	// last timestep of first DD, hour = 24
 	EXPECT_DOUBLE_EQ( 2.4 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 95 ].subSteps[ 2 ].LogDataValue );
+				.ztStepObj[ 95 ].subStepValues[ 2 ] );
 
 	EXPECT_DOUBLE_EQ( 2.4 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -309,7 +309,7 @@ TEST_F( HVACSizingSimulationManagerTest, WeatherFileDaysTest3 )
 	// first timestep of second DD, hour = 1
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 96 ].subSteps[ 0 ].LogDataValue );
+				.ztStepObj[ 96 ].subStepValues[ 0 ] );
 
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -415,7 +415,7 @@ TEST_F( HVACSizingSimulationManagerTest, TopDownTestSysTimestep3 )
 	// first timestep
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 0 ].subSteps[ 0 ].LogDataValue );
+				.ztStepObj[ 0 ].subStepValues[ 0 ] );
 
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -424,7 +424,7 @@ TEST_F( HVACSizingSimulationManagerTest, TopDownTestSysTimestep3 )
 	// last timestep of first hour
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 3 ].subSteps[ 2 ].LogDataValue );
+				.ztStepObj[ 3 ].subStepValues[ 2 ] );
 
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -433,7 +433,7 @@ TEST_F( HVACSizingSimulationManagerTest, TopDownTestSysTimestep3 )
 	// first timestep of second hour
 	EXPECT_DOUBLE_EQ( 0.2 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 7 ].subSteps[ 0 ].LogDataValue );
+				.ztStepObj[ 7 ].subStepValues[ 0 ] );
 
 	EXPECT_DOUBLE_EQ( 0.2 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -442,7 +442,7 @@ TEST_F( HVACSizingSimulationManagerTest, TopDownTestSysTimestep3 )
 	// last timestep of first DD, hour = 24
 	EXPECT_DOUBLE_EQ( 2.4 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 95 ].subSteps[ 2 ].LogDataValue );
+				.ztStepObj[ 95 ].subStepValues[ 2 ] );
 
 	EXPECT_DOUBLE_EQ( 2.4 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
@@ -451,7 +451,7 @@ TEST_F( HVACSizingSimulationManagerTest, TopDownTestSysTimestep3 )
 	// first timestep of second DD, hour = 1
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
-				.ztStepObj[ 96 ].subSteps[ 0 ].LogDataValue );
+				.ztStepObj[ 96 ].subStepValues[ 0 ] );
 
 	EXPECT_DOUBLE_EQ( 0.1 , testSizeSimManagerObj.sizingLogger
 			.logObjs[ testSizeSimManagerObj.plantCoincAnalyObjs[ 0 ].supplyInletNodeFlow_LogIndex ]
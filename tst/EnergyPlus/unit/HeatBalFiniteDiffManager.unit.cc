@@ -0,0 +1,104 @@
+// EnergyPlus::HeatBalFiniteDiffManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <HeatBalFiniteDiffManager.hh>
+#include <DataHeatBalance.hh>
+#include <DataSurfaces.hh>
+#include <UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalFiniteDiffManager;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataSurfaces;
+
+TEST( HeatBalFiniteDiffManagerTest, InteriorNodeLineEqns )
+{
+	ShowMessage( "Begin Test: HeatBalFiniteDiffManagerTest, InteriorNodeLineEqns" );
+
+	// One layer of 7 nodes, the end nodes held fixed
+	int const TotNodes( 7 );
+	int const Delt( 180 );
+	TotMaterials = 1;
+	Material.allocate( TotMaterials );
+	Material( 1 ).Conductivity = 0.5;
+	Material( 1 ).Density = 1200.0;
+	Material( 1 ).SpecHeat = 1000.0;
+	MaterialFD.allocate( TotMaterials );
+	MaterialFD( 1 ).TempCond.dimension( 2, 3, -100.0 );
+	MaterialFD( 1 ).TempEnth.dimension( 2, 3, -100.0 );
+	TotConstructs = 1;
+	Construct.allocate( TotConstructs );
+	Construct( 1 ).TotLayers = 1;
+	Construct( 1 ).LayerPoint( 1 ) = 1;
+	ConstructFD.allocate( TotConstructs );
+	ConstructFD( 1 ).DelX.dimension( 1, 0.01 );
+	TotSurfaces = 1;
+	Surface.allocate( TotSurfaces );
+	Surface( 1 ).Construction = 1;
+
+	Array1D< Real64 > TD( TotNodes );
+	for ( int i = 1; i <= TotNodes; ++i ) TD( i ) = 15.0 + 0.5 * i;
+	Array1D< Real64 > TDTStart( TD );
+	TDTStart( 1 ) = 30.0;
+	TDTStart( TotNodes ) = 10.0;
+	Array1D< Real64 > EnthOld( TotNodes, 0.0 );
+	Array1D< Real64 > EnthNew( TotNodes, 0.0 );
+	Array1D< Real64 > Unused( TotNodes, 0.0 );
+
+	// The solution the node sweeps converge to
+	auto Converged = [&]( Array1D< Real64 > & TDT ) {
+		for ( int Sweep = 1; Sweep <= 20000; ++Sweep ) {
+			for ( int i = 2; i < TotNodes; ++i ) {
+				InteriorNodeEqns( Delt, i, 1, 1, Unused, Unused, Unused, Unused, Unused, TD, TDT, EnthOld, EnthNew );
+			}
+		}
+	};
+
+	// Constant properties: one line solve gives the converged sweeps, for both schemes
+	for ( int Scheme : { FullyImplicitFirstOrder, CrankNicholsonSecondOrder } ) {
+		CondFDSchemeType = Scheme;
+		Array1D< Real64 > TDTSweep( TDTStart );
+		Converged( TDTSweep );
+		Array1D< Real64 > TDTLine( TDTStart );
+		InteriorNodeLineEqns( Delt, 2, TotNodes - 1, 1, 1, TD, TDTLine, EnthOld, EnthNew );
+		for ( int i = 1; i <= TotNodes; ++i ) {
+			EXPECT_NEAR( TDTSweep( i ), TDTLine( i ), 1.0e-9 );
+		}
+	}
+
+	// Temperature dependent conductivity and a phase change: repeated line solves reach the same temperatures
+	CondFDSchemeType = FullyImplicitFirstOrder;
+	MaterialFD( 1 ).tk1 = 0.002;
+	MaterialFD( 1 ).TempEnth.dimension( 2, 4 );
+	Real64 const Temps[] = { -20.0, 20.0, 22.0, 60.0 };
+	Real64 const Enths[] = { 0.0, 40000.0, 46000.0, 84000.0 }; // A latent heat small enough for the iterations to converge
+	for ( int Pt = 1; Pt <= 4; ++Pt ) {
+		MaterialFD( 1 ).TempEnth( 1, Pt ) = Temps[ Pt - 1 ];
+		MaterialFD( 1 ).TempEnth( 2, Pt ) = Enths[ Pt - 1 ];
+	}
+	Array1D< Real64 > TDTSweep( TDTStart );
+	Converged( TDTSweep );
+	Array1D< Real64 > TDTLine( TDTStart );
+	for ( int Iter = 1; Iter <= 200; ++Iter ) {
+		InteriorNodeLineEqns( Delt, 2, TotNodes - 1, 1, 1, TD, TDTLine, EnthOld, EnthNew );
+	}
+	for ( int i = 1; i <= TotNodes; ++i ) {
+		EXPECT_NEAR( TDTSweep( i ), TDTLine( i ), 1.0e-6 );
+	}
+
+	CondFDSchemeType = FullyImplicitFirstOrder;
+	Surface.deallocate();
+	ConstructFD.deallocate();
+	Construct.deallocate();
+	MaterialFD.deallocate();
+	Material.deallocate();
+	TotSurfaces = 0;
+	TotConstructs = 0;
+	TotMaterials = 0;
+}
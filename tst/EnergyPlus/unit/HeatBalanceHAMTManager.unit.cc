@@ -0,0 +1,60 @@
+// EnergyPlus::HeatBalanceHAMTManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <HeatBalanceHAMTManager.hh>
+#include <UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceHAMTManager;
+
+TEST( HeatBalanceHAMTManagerTest, InterpLookupMatchesSearch )
+{
+	ShowMessage( "Begin Test: HeatBalanceHAMTManagerTest, InterpLookupMatchesSearch" );
+
+	// Isotherm like table with uneven spacing and a repeated abscissa
+	int const ndata( 7 );
+	Array1D< Real64 > xx( 27, 0.0 );
+	Array1D< Real64 > yy( 27, 0.0 );
+	Real64 const X[] = { 0.0, 0.05, 0.3, 0.3, 0.8, 0.97, 1.0 };
+	Real64 const Y[] = { 0.0, 2.0, 9.0, 9.5, 25.0, 70.0, 180.0 };
+	for ( int i = 1; i <= ndata; ++i ) {
+		xx( i ) = X[ i - 1 ];
+		yy( i ) = Y[ i - 1 ];
+	}
+
+	PropertyLookupData Lookup;
+	SetupPropertyLookup( Lookup, ndata, xx );
+	EXPECT_FALSE( Lookup.FirstStep.empty() );
+
+	for ( int k = -10; k <= 1020; ++k ) {
+		Real64 const Value( 0.001 * k );
+		Real64 Out;
+		Real64 Grad;
+		interp( ndata, xx, yy, Value, Out, Grad );
+		Real64 LookupOut;
+		Real64 LookupGrad;
+		interp( Lookup, ndata, xx, yy, Value, LookupOut, LookupGrad );
+		EXPECT_EQ( Out, LookupOut );
+		EXPECT_EQ( Grad, LookupGrad );
+	}
+	for ( int i = 1; i <= ndata; ++i ) { // Exactly on the data points
+		Real64 Out;
+		Real64 LookupOut;
+		interp( ndata, xx, yy, xx( i ), Out );
+		interp( Lookup, ndata, xx, yy, xx( i ), LookupOut );
+		EXPECT_EQ( Out, LookupOut );
+	}
+
+	// Tables that are not in order are searched from the start
+	xx( 5 ) = 0.2;
+	SetupPropertyLookup( Lookup, ndata, xx );
+	EXPECT_TRUE( Lookup.FirstStep.empty() );
+	Real64 Out;
+	Real64 LookupOut;
+	interp( ndata, xx, yy, 0.5, Out );
+	interp( Lookup, ndata, xx, yy, 0.5, LookupOut );
+	EXPECT_EQ( Out, LookupOut );
+}
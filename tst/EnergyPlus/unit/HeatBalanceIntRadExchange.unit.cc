@@ -0,0 +1,156 @@
+// EnergyPlus::HeatBalanceIntRadExchange Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array.functions.hh>
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceIntRadExchangeTest, CalcMatrixInverse )
+{
+	ShowMessage( "Begin Test: HeatBalanceIntRadExchangeTest, CalcMatrixInverse" );
+
+	int const N( 5 );
+	Array2D< Real64 > A( N, N );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			A( i, j ) = ( i == j ? 0.5 : 1.0 / ( i + 2 * j ) ) - 0.1 * ( ( i * j ) % 3 );
+		}
+	}
+	A( 1, 1 ) = 0.0; // Needs a row swap
+	Array2D< Real64 > Original( A );
+	Array2D< Real64 > Inverse( N, N );
+	CalcMatrixInverse( A, Inverse );
+
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			Real64 Product( 0.0 );
+			for ( int k = 1; k <= N; ++k ) Product += Original( i, k ) * Inverse( k, j );
+			EXPECT_NEAR( ( i == j ? 1.0 : 0.0 ), Product, 1.0e-12 );
+		}
+	}
+}
+
+TEST( HeatBalanceIntRadExchangeTest, CalcScriptF )
+{
+	ShowMessage( "Begin Test: HeatBalanceIntRadExchangeTest, CalcScriptF" );
+
+	// Parallel plates: ScriptF = 1/(1/e1+1/e2-1)
+	{
+		Array1D< Real64 > A( 2, 1.0 );
+		Array2D< Real64 > F( 2, 2, 0.0 );
+		F( 1, 2 ) = F( 2, 1 ) = 1.0;
+		Array1D< Real64 > Emiss( 2 );
+		Emiss( 1 ) = 0.9;
+		Emiss( 2 ) = 0.5;
+		Array2D< Real64 > ScriptF( 2, 2 );
+		CalcScriptF( 2, A, F, Emiss, ScriptF );
+		Real64 const Exchange( 1.0 / ( 1.0 / 0.9 + 1.0 / 0.5 - 1.0 ) );
+		EXPECT_NEAR( Exchange, ScriptF( 1, 2 ), 1.0e-12 );
+		EXPECT_NEAR( Exchange, ScriptF( 2, 1 ), 1.0e-12 );
+		EXPECT_NEAR( 0.9 - Exchange, ScriptF( 1, 1 ), 1.0e-12 );
+		EXPECT_NEAR( 0.5 - Exchange, ScriptF( 2, 2 ), 1.0e-12 );
+	}
+
+	// Long triangular duct with 3-4-5 sides: F(i,j) = (Li+Lj-Lk)/(2*Li)
+	{
+		int const N( 3 );
+		Array1D< Real64 > A( N );
+		A( 1 ) = 3.0;
+		A( 2 ) = 4.0;
+		A( 3 ) = 5.0;
+		Array2D< Real64 > F( N, N, 0.0 ); // Held transposed: F(j,i) is the view factor from i to j
+		for ( int i = 1; i <= N; ++i ) {
+			for ( int j = 1; j <= N; ++j ) {
+				if ( i != j ) F( j, i ) = ( A( i ) + A( j ) - A( 6 - i - j ) ) / ( 2.0 * A( i ) );
+			}
+		}
+		Array1D< Real64 > Emiss( N );
+		Emiss( 1 ) = 0.9;
+		Emiss( 2 ) = 0.3;
+		Emiss( 3 ) = 0.6;
+		Array2D< Real64 > ScriptF( N, N );
+		CalcScriptF( N, A, F, Emiss, ScriptF );
+		for ( int i = 1; i <= N; ++i ) {
+			Real64 Sum( 0.0 );
+			for ( int j = 1; j <= N; ++j ) {
+				Sum += ScriptF( i, j );
+				EXPECT_NEAR( A( i ) * ScriptF( i, j ), A( j ) * ScriptF( j, i ), 1.0e-12 ); // Reciprocity
+			}
+			EXPECT_NEAR( Emiss( i ), Sum, 1.0e-12 ); // An isothermal enclosure is in balance
+		}
+	}
+}
+
+TEST( HeatBalanceIntRadExchangeTest, UpdateScriptF )
+{
+	ShowMessage( "Begin Test: HeatBalanceIntRadExchangeTest, UpdateScriptF" );
+
+	// Enclosure of 12 surfaces with F(i,j) = A(j)/sum(A), which is complete and reciprocal
+	int const N( 12 );
+	Array1D< Real64 > A( N );
+	for ( int i = 1; i <= N; ++i ) A( i ) = 1.0 + 0.5 * ( i % 4 );
+	Real64 const TotArea( sum( A ) );
+	Array2D< Real64 > F( N, N );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			F( j, i ) = A( j ) / TotArea;
+		}
+	}
+	Array1D< Real64 > Emiss( N );
+	for ( int i = 1; i <= N; ++i ) Emiss( i ) = 0.9 - 0.05 * ( i % 5 );
+
+	Array2D< Real64 > Cinverse;
+	Array1D< Real64 > CinverseEmiss;
+	int NumUpdates( 0 );
+	Array2D< Real64 > ScriptF( N, N );
+	Array2D< Real64 > ExpectedScriptF( N, N );
+
+	// First call forms the inverse
+	UpdateScriptF( N, A, F, Emiss, false, Cinverse, CinverseEmiss, NumUpdates, ScriptF );
+	CalcScriptF( N, A, F, Emiss, ExpectedScriptF );
+	EXPECT_EQ( 0, NumUpdates );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			EXPECT_DOUBLE_EQ( ExpectedScriptF( i, j ), ScriptF( i, j ) );
+		}
+	}
+
+	// Two shades deploy: the inverse is updated
+	Emiss( 3 ) = 0.2;
+	Emiss( 10 ) = 0.95;
+	UpdateScriptF( N, A, F, Emiss, false, Cinverse, CinverseEmiss, NumUpdates, ScriptF );
+	CalcScriptF( N, A, F, Emiss, ExpectedScriptF );
+	EXPECT_EQ( 1, NumUpdates );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			EXPECT_NEAR( ExpectedScriptF( i, j ), ScriptF( i, j ), 1.0e-12 );
+		}
+	}
+
+	// Too many changes at once: formed from scratch
+	for ( int i = 1; i <= 6; ++i ) Emiss( i ) = 0.5;
+	UpdateScriptF( N, A, F, Emiss, false, Cinverse, CinverseEmiss, NumUpdates, ScriptF );
+	EXPECT_EQ( 0, NumUpdates );
+
+	// Asked to refresh
+	Emiss( 12 ) = 0.3;
+	UpdateScriptF( N, A, F, Emiss, true, Cinverse, CinverseEmiss, NumUpdates, ScriptF );
+	CalcScriptF( N, A, F, Emiss, ExpectedScriptF );
+	EXPECT_EQ( 0, NumUpdates );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			EXPECT_DOUBLE_EQ( ExpectedScriptF( i, j ), ScriptF( i, j ) );
+		}
+	}
+}
@@ -0,0 +1,247 @@
+// EnergyPlus::HeatBalanceSurfaceManager Unit Tests
+
+// C++ Headers
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <HeatBalanceSurfaceManager.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataSurfaces.hh>
+#include <UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceSurfaceManager;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataHeatBalFanSys;
+using namespace EnergyPlus::DataHeatBalSurface;
+using namespace EnergyPlus::DataSurfaces;
+
+TEST( HeatBalanceSurfaceManagerTest, IsReentrantInsideSurface )
+{
+	ShowMessage( "Begin Test: HeatBalanceSurfaceManagerTest, IsReentrantInsideSurface" );
+
+	TotConstructs = 2;
+	Construct.allocate( TotConstructs );
+	Construct( 2 ).SourceSinkPresent = true;
+
+	TotSurfaces = 5;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).HeatTransSurf = true;
+		Surface( SurfNum ).Zone = 1;
+		Surface( SurfNum ).Class = SurfaceClass_Wall;
+		Surface( SurfNum ).HeatTransferAlgorithm = HeatTransferModel_CTF;
+		Surface( SurfNum ).Construction = 1;
+	}
+	Surface( 2 ).Class = SurfaceClass_Window;
+	Surface( 3 ).HeatTransferAlgorithm = HeatTransferModel_CondFD;
+	Surface( 4 ).Construction = 2;
+	Surface( 5 ).MaterialMovInsulInt = 1;
+
+	EXPECT_TRUE( IsReentrantInsideSurface( 1 ) );
+	EXPECT_FALSE( IsReentrantInsideSurface( 2 ) );
+	EXPECT_FALSE( IsReentrantInsideSurface( 3 ) );
+	EXPECT_FALSE( IsReentrantInsideSurface( 4 ) );
+	EXPECT_FALSE( IsReentrantInsideSurface( 5 ) );
+
+	Surface.deallocate();
+	Construct.deallocate();
+	TotSurfaces = 0;
+	TotConstructs = 0;
+}
+
+TEST( HeatBalanceSurfaceManagerTest, IsHAMTSweepSurface )
+{
+	ShowMessage( "Begin Test: HeatBalanceSurfaceManagerTest, IsHAMTSweepSurface" );
+
+	TotSurfaces = 5;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).HeatTransSurf = true;
+		Surface( SurfNum ).Zone = 1;
+		Surface( SurfNum ).Class = SurfaceClass_Wall;
+		Surface( SurfNum ).HeatTransferAlgorithm = HeatTransferModel_HAMT;
+		Surface( SurfNum ).Construction = 1;
+	}
+	Surface( 2 ).HeatTransferAlgorithm = HeatTransferModel_CondFD;
+	Surface( 3 ).MaterialMovInsulInt = 1;
+	Surface( 4 ).MaterialMovInsulInt = 1;
+	Surface( 4 ).ExtBoundCond = 4; // Partition, insulation not used
+	Surface( 5 ).Zone = 0;
+
+	EXPECT_TRUE( IsHAMTSweepSurface( 1 ) );
+	EXPECT_FALSE( IsHAMTSweepSurface( 2 ) );
+	EXPECT_FALSE( IsHAMTSweepSurface( 3 ) );
+	EXPECT_TRUE( IsHAMTSweepSurface( 4 ) );
+	EXPECT_FALSE( IsHAMTSweepSurface( 5 ) );
+
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
+
+TEST( HeatBalanceSurfaceManagerTest, PackSurfaceHotState )
+{
+	ShowMessage( "Begin Test: HeatBalanceSurfaceManagerTest, PackSurfaceHotState" );
+
+	TotConstructs = 2;
+	Construct.allocate( TotConstructs );
+	Construct( 1 ).CTFOutside( 0 ) = 1.5;
+	Construct( 1 ).CTFCross( 0 ) = 0.5;
+	Construct( 1 ).CTFInside( 0 ) = 2.5;
+	Construct( 2 ).CTFInside( 0 ) = 4.0;
+
+	TotSurfaces = 3;
+	Surface.allocate( TotSurfaces );
+	Surface( 1 ).Construction = 1;
+	Surface( 1 ).Class = SurfaceClass_Wall;
+	Surface( 1 ).Area = 10.0;
+	Surface( 2 ).Construction = 2;
+	Surface( 2 ).Class = SurfaceClass_Floor;
+	Surface( 2 ).Area = 20.0;
+	Surface( 2 ).ExtBoundCond = 2;
+	Surface( 3 ).Construction = 1;
+	Surface( 3 ).Class = SurfaceClass_Window;
+	Surface( 3 ).Area = 2.0;
+
+	CTFConstInPart.dimension( TotSurfaces, 0.0 );
+	CTFConstOutPart.dimension( TotSurfaces, 0.0 );
+	QsrcHist.dimension( TotSurfaces, 2, 0.0 );
+	CTFConstInPart( 3 ) = 7.0;
+	CTFConstOutPart( 2 ) = -3.0;
+
+	// Packed in the order given, not by surface number
+	SurfaceHotStateData HotState;
+	std::vector< int > SurfNums = { 3, 2, 1 };
+	PackSurfaceHotState( HotState, SurfNums );
+
+	EXPECT_EQ( 3, HotState.NumSurfs );
+	EXPECT_EQ( 3, HotState.SurfNum( 1 ) );
+	EXPECT_EQ( 1, HotState.SurfNum( 3 ) );
+	EXPECT_EQ( 2, HotState.ConstrNum( 2 ) );
+	EXPECT_FALSE( HotState.OpaqueClass( 1 ) );
+	EXPECT_TRUE( HotState.OpaqueClass( 2 ) );
+	EXPECT_TRUE( HotState.Partition( 2 ) );
+	EXPECT_FALSE( HotState.Partition( 3 ) );
+	EXPECT_DOUBLE_EQ( 20.0, HotState.Area( 2 ) );
+	EXPECT_DOUBLE_EQ( 2.5, HotState.CTFInside0( 1 ) );
+	EXPECT_DOUBLE_EQ( 4.0, HotState.CTFInside0( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.5, HotState.CTFCross0( 3 ) );
+	EXPECT_DOUBLE_EQ( 7.0, HotState.CTFConstIn( 1 ) );
+	EXPECT_DOUBLE_EQ( -3.0, HotState.CTFConstOut( 2 ) );
+
+	// Shrinking keeps the storage but reports the new count
+	SurfNums = { 1 };
+	PackSurfaceHotState( HotState, SurfNums );
+	EXPECT_EQ( 1, HotState.NumSurfs );
+	EXPECT_EQ( 1, HotState.SurfNum( 1 ) );
+	EXPECT_EQ( 3u, HotState.SurfNum.size() );
+
+	CTFConstInPart.deallocate();
+	CTFConstOutPart.deallocate();
+	QsrcHist.deallocate();
+	Surface.deallocate();
+	Construct.deallocate();
+	TotSurfaces = 0;
+	TotConstructs = 0;
+}
+
+TEST( HeatBalanceSurfaceManagerTest, CTFHistoryTermsBatched )
+{
+	ShowMessage( "Begin Test: HeatBalanceSurfaceManagerTest, CTFHistoryTermsBatched" );
+
+	// Two surfaces share a plain construction, one has an embedded source and one has no history terms
+	TotConstructs = 3;
+	Construct.allocate( TotConstructs );
+	Construct( 1 ).NumCTFTerms = 4;
+	Construct( 2 ).NumCTFTerms = 3;
+	Construct( 2 ).SourceSinkPresent = true;
+	Construct( 3 ).NumCTFTerms = 1;
+	for ( int ConstrNum = 1; ConstrNum <= 2; ++ConstrNum ) {
+		for ( int Term = 1; Term <= Construct( ConstrNum ).NumCTFTerms; ++Term ) {
+			Construct( ConstrNum ).CTFOutside( Term ) = 0.9 / ( Term + ConstrNum );
+			Construct( ConstrNum ).CTFCross( Term ) = 0.3 / ( Term + ConstrNum );
+			Construct( ConstrNum ).CTFInside( Term ) = 0.7 / ( Term + ConstrNum );
+			Construct( ConstrNum ).CTFFlux( Term ) = 0.1 / ( Term + ConstrNum );
+			Construct( ConstrNum ).CTFSourceIn( Term ) = 0.05 * Term;
+			Construct( ConstrNum ).CTFSourceOut( Term ) = 0.02 * Term;
+		}
+	}
+
+	TotSurfaces = 5;
+	Surface.allocate( TotSurfaces );
+	int const SurfConstr[] = { 1, 2, 1, 3, 1 };
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).HeatTransSurf = true;
+		Surface( SurfNum ).Class = SurfaceClass_Wall;
+		Surface( SurfNum ).HeatTransferAlgorithm = HeatTransferModel_CTF;
+		Surface( SurfNum ).Construction = SurfConstr[ SurfNum - 1 ];
+	}
+	Surface( 5 ).Class = SurfaceClass_Window; // Not part of the CTF sums
+
+	TH.dimension( 2, MaxCTFTerms, TotSurfaces, 0.0 );
+	QH.dimension( 2, MaxCTFTerms, TotSurfaces, 0.0 );
+	QsrcHist.dimension( TotSurfaces, MaxCTFTerms, 0.0 );
+	TsrcHist.dimension( TotSurfaces, MaxCTFTerms, 0.0 );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		for ( int Term = 1; Term <= MaxCTFTerms; ++Term ) {
+			TH( 1, Term, SurfNum ) = 10.0 + 0.37 * Term + SurfNum;
+			TH( 2, Term, SurfNum ) = 20.0 - 0.21 * Term + 0.5 * SurfNum;
+			QH( 1, Term, SurfNum ) = 3.0 * Term - SurfNum;
+			QH( 2, Term, SurfNum ) = -1.5 * Term + 2.0 * SurfNum;
+			QsrcHist( SurfNum, Term ) = 100.0 * Term;
+			TsrcHist( SurfNum, Term ) = 25.0 + Term;
+		}
+	}
+
+	CTFConstInPart.dimension( TotSurfaces, 0.0 );
+	CTFConstOutPart.dimension( TotSurfaces, 0.0 );
+	CTFTsrcConstPart.dimension( TotSurfaces, 0.0 );
+
+	// Scalar reference
+	Array1D< Real64 > RefIn( TotSurfaces, 0.0 );
+	Array1D< Real64 > RefOut( TotSurfaces, 0.0 );
+	Array1D< Real64 > RefTsrc( TotSurfaces, 0.0 );
+	for ( int SurfNum = 1; SurfNum <= 4; ++SurfNum ) {
+		CalcCTFHistoryTerms( SurfNum );
+		RefIn( SurfNum ) = CTFConstInPart( SurfNum );
+		RefOut( SurfNum ) = CTFConstOutPart( SurfNum );
+		RefTsrc( SurfNum ) = CTFTsrcConstPart( SurfNum );
+	}
+	EXPECT_DOUBLE_EQ( 0.0, RefIn( 4 ) );
+	EXPECT_NE( 0.0, RefTsrc( 2 ) );
+
+	CTFConstInPart = 0.0;
+	CTFConstOutPart = 0.0;
+	CTFTsrcConstPart = 0.0;
+	CTFHistoryBatchesChanged = true;
+	CalcCTFHistoryTermsBatched();
+
+	ASSERT_EQ( 1, CTFHistoryBatch.isize() );
+	EXPECT_EQ( 1, CTFHistoryBatch( 1 ).ConstrNum );
+	EXPECT_EQ( 2u, CTFHistoryBatch( 1 ).SurfNums.size() );
+	for ( int SurfNum = 1; SurfNum <= 4; ++SurfNum ) {
+		EXPECT_DOUBLE_EQ( RefIn( SurfNum ), CTFConstInPart( SurfNum ) );
+		EXPECT_DOUBLE_EQ( RefOut( SurfNum ), CTFConstOutPart( SurfNum ) );
+		EXPECT_DOUBLE_EQ( RefTsrc( SurfNum ), CTFTsrcConstPart( SurfNum ) );
+	}
+	EXPECT_DOUBLE_EQ( 0.0, CTFConstInPart( 5 ) );
+
+	CTFHistoryBatch.deallocate();
+	CTFHistoryBatchesChanged = true;
+	CTFConstInPart.deallocate();
+	CTFConstOutPart.deallocate();
+	CTFTsrcConstPart.deallocate();
+	TH.deallocate();
+	QH.deallocate();
+	QsrcHist.deallocate();
+	TsrcHist.deallocate();
+	Surface.deallocate();
+	Construct.deallocate();
+	TotSurfaces = 0;
+	TotConstructs = 0;
+}
@@ -0,0 +1,276 @@
+// EnergyPlus::InputProcessor Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <InputProcessor.hh>
+#include <DataSystemVariables.hh>
+#include <DataStringGlobals.hh>
+#include <UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::InputProcessor;
+
+TEST( InputProcessorTest, IDDCacheRoundTrip )
+{
+	ShowMessage( "Begin Test: InputProcessorTest, IDDCacheRoundTrip" );
+
+	std::string const CacheFile( "eplusout_iddcache_test.bin" );
+	std::uint64_t const Hash( IDDCacheHash( "!IDD_Version 8.3.0\nLead Input;\n" ) );
+	EXPECT_NE( Hash, IDDCacheHash( "!IDD_Version 8.3.0\nLead Input; \n" ) );
+
+	DataStringGlobals::IDDVerString = "!IDD_Version 8.3.0";
+	MaxSectionDefs = 3;
+	NumSectionDefs = 2;
+	SectionDef.allocate( MaxSectionDefs );
+	SectionDef( 1 ).Name = "LEAD INPUT";
+	SectionDef( 2 ).Name = "SIMULATION DATA";
+	MaxObjectDefs = 2;
+	NumObjectDefs = 1;
+	ObjectDef.allocate( MaxObjectDefs );
+	auto & Object( ObjectDef( 1 ) );
+	Object.Name = "TIMESTEP";
+	Object.NumParams = 2;
+	Object.NumAlpha = 1;
+	Object.NumNumeric = 1;
+	Object.MinNumFields = 1;
+	Object.UniqueObject = true;
+	Object.ObsPtr = 1;
+	Object.AlphaOrNumeric.allocate( 2 );
+	Object.AlphaOrNumeric( 1 ) = true;
+	Object.AlphaOrNumeric( 2 ) = false;
+	Object.ReqField.dimension( 2, false );
+	Object.ReqField( 2 ) = true;
+	Object.AlphRetainCase.dimension( 2, false );
+	Object.AlphFieldChks.allocate( 1 );
+	Object.AlphFieldChks( 1 ) = "Name";
+	Object.AlphFieldDefs.allocate( 1 );
+	Object.AlphFieldDefs( 1 ) = "Default Name";
+	Object.NumRangeChks.allocate( 1 );
+	Object.NumRangeChks( 1 ).MinMaxChk = true;
+	Object.NumRangeChks( 1 ).FieldNumber = 2;
+	Object.NumRangeChks( 1 ).FieldName = "Number of Timesteps per Hour";
+	Object.NumRangeChks( 1 ).MinMaxString.x = ">=1";
+	Object.NumRangeChks( 1 ).MinMaxValue.x = 1.0;
+	Object.NumRangeChks( 1 ).MinMaxValue.y = 60.0;
+	Object.NumRangeChks( 1 ).WhichMinMax.y = 3;
+	Object.NumRangeChks( 1 ).DefaultChk = true;
+	Object.NumRangeChks( 1 ).Default = 6.0;
+	NumObsoleteObjects = 1;
+	ObsoleteObjectsRepNames.allocate( 1 );
+	ObsoleteObjectsRepNames( 1 ) = "Timestep in Hour";
+	MaxAlphaArgsFound = 7;
+	MaxNumericArgsFound = 9;
+
+	WriteIDDCache( CacheFile, Hash );
+
+	// Other IDD text: definitions are left alone
+	EXPECT_FALSE( ReadIDDCache( CacheFile, Hash + 1u ) );
+	EXPECT_EQ( 1, NumObjectDefs );
+
+	SectionDef.deallocate();
+	ObjectDef.deallocate();
+	ObsoleteObjectsRepNames.deallocate();
+	NumSectionDefs = NumObjectDefs = NumObsoleteObjects = 0;
+	MaxAlphaArgsFound = MaxNumericArgsFound = 0;
+	DataStringGlobals::IDDVerString.clear();
+
+	ASSERT_TRUE( ReadIDDCache( CacheFile, Hash ) );
+	EXPECT_EQ( "!IDD_Version 8.3.0", DataStringGlobals::IDDVerString );
+	EXPECT_EQ( 2, NumSectionDefs );
+	EXPECT_EQ( 3, SectionDef.isize() );
+	EXPECT_EQ( "SIMULATION DATA", SectionDef( 2 ).Name );
+	EXPECT_EQ( 1, NumObjectDefs );
+	EXPECT_EQ( 2, MaxObjectDefs );
+	EXPECT_EQ( "TIMESTEP", ObjectDef( 1 ).Name );
+	EXPECT_EQ( 2, ObjectDef( 1 ).NumParams );
+	EXPECT_TRUE( ObjectDef( 1 ).UniqueObject );
+	EXPECT_FALSE( ObjectDef( 1 ).RequiredObject );
+	EXPECT_TRUE( ObjectDef( 1 ).AlphaOrNumeric( 1 ) );
+	EXPECT_FALSE( ObjectDef( 1 ).AlphaOrNumeric( 2 ) );
+	EXPECT_TRUE( ObjectDef( 1 ).ReqField( 2 ) );
+	EXPECT_EQ( "Default Name", ObjectDef( 1 ).AlphFieldDefs( 1 ) );
+	ASSERT_EQ( 1, ObjectDef( 1 ).NumRangeChks.isize() );
+	EXPECT_EQ( "Number of Timesteps per Hour", ObjectDef( 1 ).NumRangeChks( 1 ).FieldName );
+	EXPECT_EQ( ">=1", ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxString.x );
+	EXPECT_DOUBLE_EQ( 60.0, ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxValue.y );
+	EXPECT_EQ( 3, ObjectDef( 1 ).NumRangeChks( 1 ).WhichMinMax.y );
+	EXPECT_DOUBLE_EQ( 6.0, ObjectDef( 1 ).NumRangeChks( 1 ).Default );
+	EXPECT_EQ( 1, NumObsoleteObjects );
+	EXPECT_EQ( "Timestep in Hour", ObsoleteObjectsRepNames( 1 ) );
+	EXPECT_EQ( 7, MaxAlphaArgsFound );
+	EXPECT_EQ( 9, MaxNumericArgsFound );
+
+	// A truncated file is not used
+	std::string Image;
+	{
+		std::ifstream File( CacheFile, std::ios::in | std::ios::binary );
+		Image.assign( ( std::istreambuf_iterator< char >( File ) ), std::istreambuf_iterator< char >() );
+	}
+	{
+		std::ofstream File( CacheFile, std::ios::out | std::ios::binary | std::ios::trunc );
+		File.write( Image.data(), Image.size() - 3 );
+	}
+	EXPECT_FALSE( ReadIDDCache( CacheFile, Hash ) );
+	EXPECT_FALSE( ReadIDDCache( CacheFile + ".missing", Hash ) );
+
+	std::remove( CacheFile.c_str() );
+	SectionDef.deallocate();
+	ObjectDef.deallocate();
+	ObsoleteObjectsRepNames.deallocate();
+	NumSectionDefs = NumObjectDefs = NumObsoleteObjects = 0;
+	MaxSectionDefs = MaxObjectDefs = 0;
+	MaxAlphaArgsFound = MaxNumericArgsFound = 0;
+	DataStringGlobals::IDDVerString.clear();
+}
+
+TEST( InputProcessorTest, ObjectRecordIndex )
+{
+	ShowMessage( "Begin Test: InputProcessorTest, ObjectRecordIndex" );
+
+	bool const SaveSortedIDD( DataSystemVariables::SortedIDD );
+	DataSystemVariables::SortedIDD = true;
+
+	// Sorted list of object types, as left by ProcessInput
+	NumObjectDefs = 3;
+	ObjectDef.allocate( NumObjectDefs );
+	ObjectDef( 1 ).Name = "ZONE";
+	ObjectDef( 2 ).Name = "MATERIAL";
+	ObjectDef( 3 ).Name = "CONSTRUCTION";
+	for ( int Loop = 1; Loop <= NumObjectDefs; ++Loop ) ObjectDef( Loop ).NumFound = 2;
+	ListOfObjects.allocate( NumObjectDefs );
+	ListOfObjects( 1 ) = "CONSTRUCTION";
+	ListOfObjects( 2 ) = "MATERIAL";
+	ListOfObjects( 3 ) = "ZONE";
+	iListOfObjects.allocate( NumObjectDefs );
+	iListOfObjects( 1 ) = 3;
+	iListOfObjects( 2 ) = 2;
+	iListOfObjects( 3 ) = 1;
+	BuildListOfObjectsIndex();
+
+	EXPECT_EQ( 1, FindObjectDefinition( "ZONE" ) );
+	EXPECT_EQ( 3, FindObjectDefinition( "Construction" ) );
+	EXPECT_EQ( 0, FindObjectDefinition( "SCHEDULE:COMPACT" ) );
+
+	// Types interleaved in the file; item numbers count within a type
+	std::string const Types[] = { "MATERIAL", "ZONE", "MATERIAL", "ZONE", "CONSTRUCTION" };
+	std::string const Names[] = { "M1", "Z1", "M2", "Z1", "C1" };
+	NumIDFRecords = 5;
+	IDFRecords.allocate( NumIDFRecords );
+	for ( int Record = 1; Record <= NumIDFRecords; ++Record ) {
+		IDFRecords( Record ).Name = Types[ Record - 1 ];
+		IDFRecords( Record ).NumAlphas = 1;
+		IDFRecords( Record ).Alphas.dimension( 1, Names[ Record - 1 ] );
+	}
+	ObjectRecords.deallocate();
+	NumIndexedRecords = 0;
+	ObjectStartRecord.dimension( NumObjectDefs, 0 );
+	ObjectStartRecord( 1 ) = 2;
+	ObjectStartRecord( 2 ) = 1;
+	ObjectStartRecord( 3 ) = 5;
+
+	EXPECT_EQ( 3, FindObjectRecord( 2, 2 ) );
+	EXPECT_EQ( 0, FindObjectRecord( 3, 2 ) );
+	EXPECT_EQ( 2, GetObjectItemNum( "MATERIAL", "M2" ) );
+	EXPECT_EQ( 1, GetObjectItemNum( "ZONE", "Z1" ) ); // First of the duplicates
+	EXPECT_EQ( 0, GetObjectItemNum( "ZONE", "z1" ) ); // Names are matched exactly
+	EXPECT_EQ( -1, GetObjectItemNum( "SCHEDULE:COMPACT", "S1" ) );
+	EXPECT_EQ( 4, FindNextRecord( "ZONE", 2 ) );
+	EXPECT_EQ( 0, FindNextRecord( "ZONE", 4 ) );
+
+	// Records added later are picked up
+	IDFRecords.redimension( 6 );
+	NumIDFRecords = 6;
+	IDFRecords( 6 ).Name = "CONSTRUCTION";
+	IDFRecords( 6 ).NumAlphas = 1;
+	IDFRecords( 6 ).Alphas.dimension( 1, "C2" );
+	EXPECT_EQ( 6, FindNextRecord( "CONSTRUCTION", 5 ) );
+	EXPECT_EQ( 2, GetObjectItemNum( "CONSTRUCTION", "C2" ) );
+
+	IDFRecords.deallocate();
+	ObjectRecords.deallocate();
+	ObjectStartRecord.deallocate();
+	ListOfObjects.deallocate();
+	iListOfObjects.deallocate();
+	ObjectDef.deallocate();
+	BuildListOfObjectsIndex();
+	NumIndexedRecords = 0;
+	NumIDFRecords = 0;
+	NumObjectDefs = 0;
+	DataSystemVariables::SortedIDD = SaveSortedIDD;
+}
+
+TEST( InputProcessorTest, OverrideInputField )
+{
+	ShowMessage( "Begin Test: InputProcessorTest, OverrideInputField" );
+
+	bool const SaveSortedIDD( DataSystemVariables::SortedIDD );
+	DataSystemVariables::SortedIDD = false;
+
+	NumObjectDefs = 1;
+	ObjectDef.allocate( NumObjectDefs );
+	auto & Def( ObjectDef( 1 ) );
+	Def.Name = "SCHEDULE:CONSTANT";
+	Def.NumFound = 1;
+	Def.NumParams = 3;
+	Def.NumAlpha = 2;
+	Def.NumNumeric = 1;
+	Def.NameAlpha1 = true;
+	Def.AlphaOrNumeric.dimension( 3, true );
+	Def.AlphaOrNumeric( 3 ) = false;
+	Def.AlphRetainCase.dimension( 2, false );
+	Def.NumRangeChks.allocate( 1 );
+	Def.NumRangeChks( 1 ).AutoSizable = true;
+	Def.NumRangeChks( 1 ).AutoSizeValue = -99999.0;
+	ListOfObjects.allocate( NumObjectDefs );
+	ListOfObjects( 1 ) = Def.Name;
+	BuildListOfObjectsIndex();
+
+	NumIDFRecords = 1;
+	IDFRecords.allocate( NumIDFRecords );
+	auto & Record( IDFRecords( 1 ) );
+	Record.Name = Def.Name;
+	Record.ObjectDefPtr = 1;
+	Record.NumAlphas = 2;
+	Record.NumNumbers = 1;
+	Record.Alphas.allocate( 2 );
+	Record.Alphas( 1 ) = "HEATING SETPOINT";
+	Record.Alphas( 2 ) = "TEMPERATURE";
+	Record.AlphBlank.dimension( 2, false );
+	Record.Numbers.dimension( 1, 21.0 );
+	Record.NumBlank.dimension( 1, false );
+	ObjectRecords.deallocate();
+	NumIndexedRecords = 0;
+	ObjectStartRecord.dimension( NumObjectDefs, 1 );
+
+	EXPECT_TRUE( OverrideInputField( "Schedule:Constant", "Heating Setpoint", 3, "19.5" ) );
+	EXPECT_DOUBLE_EQ( 19.5, Record.Numbers( 1 ) );
+	EXPECT_TRUE( OverrideInputField( "Schedule:Constant", "Heating Setpoint", 2, "Any Number" ) );
+	EXPECT_EQ( "ANY NUMBER", Record.Alphas( 2 ) );
+	EXPECT_TRUE( OverrideInputField( "Schedule:Constant", "Heating Setpoint", 3, "Autosize" ) );
+	EXPECT_DOUBLE_EQ( -99999.0, Record.Numbers( 1 ) );
+
+	EXPECT_FALSE( OverrideInputField( "Schedule:Constant", "Heating Setpoint", 1, "Other" ) ); // Name
+	EXPECT_FALSE( OverrideInputField( "Schedule:Constant", "Heating Setpoint", 4, "1.0" ) );
+	EXPECT_FALSE( OverrideInputField( "Schedule:Constant", "Heating Setpoint", 3, "warm" ) );
+	EXPECT_FALSE( OverrideInputField( "Schedule:Constant", "Cooling Setpoint", 3, "24.0" ) );
+	EXPECT_FALSE( OverrideInputField( "Schedule:Compact", "Heating Setpoint", 3, "24.0" ) );
+
+	IDFRecords.deallocate();
+	ObjectRecords.deallocate();
+	ObjectStartRecord.deallocate();
+	ListOfObjects.deallocate();
+	ObjectDef.deallocate();
+	BuildListOfObjectsIndex();
+	NumIndexedRecords = 0;
+	NumIDFRecords = 0;
+	NumObjectDefs = 0;
+	DataSystemVariables::SortedIDD = SaveSortedIDD;
+}
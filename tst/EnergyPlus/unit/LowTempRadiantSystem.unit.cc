@@ -6,9 +6,12 @@
 // EnergyPlus Headers
 #include <EnergyPlus/LowTempRadiantSystem.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
 #include <EnergyPlus/DataPlant.hh>
 #include <EnergyPlus/DataZoneEquipment.hh>
 #include <EnergyPlus/DataSizing.hh>
+#include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/FluidProperties.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 #include <ObjexxFCL/gio.hh>
@@ -274,3 +277,47 @@ TEST_F( LowTempRadiantSystemTest, SizeLowTempRadiantVariableFlow )
 	EXPECT_NEAR( ExpectedResult2, HydrRadSys( RadSysNum ).WaterVolFlowMaxCool, 0.1 );
 
 }
+
+TEST_F( LowTempRadiantSystemTest, InsideSurfTempFromLinearizedHeatBalance )
+{
+	using DataHeatBalFanSys::QRadSysSource;
+	using DataHeatBalFanSys::RadSysTiHBConstCoef;
+	using DataHeatBalFanSys::RadSysTiHBToutCoef;
+	using DataHeatBalFanSys::RadSysTiHBQsrcCoef;
+	using DataHeatBalFanSys::RadSysToHBConstCoef;
+	using DataHeatBalFanSys::RadSysToHBTinCoef;
+	using DataHeatBalFanSys::RadSysToHBQsrcCoef;
+	using DataHeatBalSurface::TH;
+	using DataSurfaces::Surface;
+
+	Surface.allocate( 1 );
+	Surface( 1 ).Area = 20.0;
+	QRadSysSource.dimension( 1, -600.0 );
+	RadSysTiHBConstCoef.dimension( 1, 14.0 );
+	RadSysTiHBToutCoef.dimension( 1, 0.2 );
+	RadSysTiHBQsrcCoef.dimension( 1, 0.05 );
+	RadSysToHBConstCoef.dimension( 1, 8.0 );
+	RadSysToHBTinCoef.dimension( 1, 0.3 );
+	RadSysToHBQsrcCoef.dimension( 1, 0.02 );
+	TH.dimension( 2, 2, 1, 21.5 );
+
+	// Without the linear coupling, the temperature of the last heat balance is kept
+	EXPECT_DOUBLE_EQ( 21.5, RadSysInsideSurfTemp( 1, false ) );
+
+	// With it, the inside and outside surface equations both hold for the source flux
+	Real64 const SourceFlux( -600.0 / 20.0 );
+	Real64 const InsideTemp( RadSysInsideSurfTemp( 1, true ) );
+	Real64 const OutsideTemp( RadSysToHBConstCoef( 1 ) + RadSysToHBTinCoef( 1 ) * InsideTemp + RadSysToHBQsrcCoef( 1 ) * SourceFlux );
+	EXPECT_NEAR( RadSysTiHBConstCoef( 1 ) + RadSysTiHBToutCoef( 1 ) * OutsideTemp + RadSysTiHBQsrcCoef( 1 ) * SourceFlux, InsideTemp, 1.0e-12 );
+
+	Surface.deallocate();
+	QRadSysSource.deallocate();
+	RadSysTiHBConstCoef.deallocate();
+	RadSysTiHBToutCoef.deallocate();
+	RadSysTiHBQsrcCoef.deallocate();
+	RadSysToHBConstCoef.deallocate();
+	RadSysToHBTinCoef.deallocate();
+	RadSysToHBQsrcCoef.deallocate();
+	TH.deallocate();
+
+}
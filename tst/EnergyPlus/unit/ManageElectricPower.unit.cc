@@ -3,6 +3,10 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array.functions.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus/ExteriorEnergyUse.hh>
 #include <EnergyPlus/ManageElectricPower.hh>
@@ -51,3 +55,36 @@ TEST( ManageElectricPowerTest, BatteryDischargeTest )
 
 	PerfCurve.deallocate();
 }
+
+TEST( ManageElectricPowerTest, RainflowCycleCounting )
+{
+	ShowMessage( "Begin Test: ManageElectricPowerTest, RainflowCycleCounting" );
+
+	int const NumBins( 10 );
+	int const Dim( 20 );
+	Array1D< Real64 > B1( Dim, 0.0 );
+	Array1D< Real64 > X( Dim, 0.0 );
+	Array1D< Real64 > Nmb( NumBins, 0.0 );
+	Array1D< Real64 > OneNmb( NumBins, 0.0 );
+	int count( 2 ); // Index 1 is for initial SOC, so new input starts from index 2.
+	B1( 1 ) = 0.5;
+
+	Real64 const Extremes[] = { 0.92, 0.33, 0.71, 0.24, 0.86, 0.45, 0.63, 0.14, 0.97 };
+	for ( Real64 const Input : Extremes ) {
+		B1( count ) = Input;
+		Rainflow( NumBins, Input, B1, X, count, Nmb, OneNmb, Dim );
+	}
+
+	// The cycles 0.71-0.33, 0.63-0.45 and 0.86-0.24 and the half cycles 0.5-0.92 and 0.92-0.14 are counted,
+	// only the last two points are left to be counted
+	EXPECT_EQ( 3, count );
+	EXPECT_DOUBLE_EQ( 0.14, B1( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.97, B1( 2 ) );
+	EXPECT_DOUBLE_EQ( 1.0, Nmb( 2 ) );
+	EXPECT_DOUBLE_EQ( 1.0, Nmb( 4 ) );
+	EXPECT_DOUBLE_EQ( 0.5, Nmb( 5 ) );
+	EXPECT_DOUBLE_EQ( 1.0, Nmb( 7 ) );
+	EXPECT_DOUBLE_EQ( 0.5, Nmb( 8 ) );
+	EXPECT_DOUBLE_EQ( 4.0, sum( Nmb ) );
+	EXPECT_DOUBLE_EQ( 4.0, sum( OneNmb ) );
+}
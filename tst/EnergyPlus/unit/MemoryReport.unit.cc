@@ -0,0 +1,51 @@
+// EnergyPlus::MemoryReport Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/MemoryReport.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/ScheduleManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::MemoryReport;
+
+TEST( MemoryReportTest, ScheduleGroup )
+{
+	ShowMessage( "Begin Test: MemoryReportTest, ScheduleGroup" );
+
+	using ScheduleManager::DaySchedule;
+
+	// Snapshots are not taken without --memory-report
+	DataSystemVariables::MemoryUsageReport = false;
+	MemoryGroups.clear();
+	TakeMemorySnapshot( true );
+	EXPECT_TRUE( MemoryGroups.empty() );
+
+	Int64 const EmptyBytes( MemoryGroupBytes( ScheduleArrays ) );
+	DaySchedule.allocate( 2 );
+	DaySchedule( 1 ).TSValue.allocate( 4, 24 );
+	DaySchedule( 2 ).TSValue.allocate( 6, 24 );
+	Int64 const Bytes( MemoryGroupBytes( ScheduleArrays ) );
+	EXPECT_EQ( Int64( 2 * sizeof( ScheduleManager::DayScheduleData ) + 10 * 24 * sizeof( Real64 ) ), Bytes - EmptyBytes );
+
+	// The peak is the most found at any snapshot, while the bytes after initialization stay
+	DataSystemVariables::MemoryUsageReport = true;
+	TakeMemorySnapshot( true );
+	ASSERT_EQ( std::size_t( NumMemoryGroups ), MemoryGroups.size() );
+	EXPECT_EQ( Bytes, MemoryGroups[ ScheduleArrays - 1 ].InitBytes );
+	DaySchedule( 2 ).TSValue.allocate( 12, 24 );
+	TakeMemorySnapshot( false );
+	DaySchedule( 2 ).TSValue.deallocate();
+	TakeMemorySnapshot( false );
+	EXPECT_EQ( Bytes, MemoryGroups[ ScheduleArrays - 1 ].InitBytes );
+	EXPECT_EQ( Bytes + Int64( 6 * 24 * sizeof( Real64 ) ), MemoryGroups[ ScheduleArrays - 1 ].PeakBytes );
+	EXPECT_GE( PeakProcessBytes, InitProcessBytes );
+	EXPECT_EQ( "1.50", MegaBytes( 1572864 ) );
+
+	DataSystemVariables::MemoryUsageReport = false;
+	MemoryGroups.clear();
+	DaySchedule.deallocate();
+}
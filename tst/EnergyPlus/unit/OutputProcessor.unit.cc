@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataOutputs.hh>
 #include <EnergyPlus/OutputProcessor.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
@@ -61,3 +62,233 @@ TEST( OutputProcessor, TestGetMeteredVariables )
 	VarMeterArrays.deallocate();
 	EnergyMeters.deallocate();
 }
+
+TEST( OutputProcessor, MeterAggregationPlan )
+{
+	ShowMessage( "Begin Test: OutputProcessor, MeterAggregationPlan" );
+
+	// An HVAC variable on two meters and a custom meter, a zone variable on one meter, and an unmetered one
+	Reference< RealVariables > HVACVar;
+	Reference< RealVariables > ZoneVar;
+	Reference< RealVariables > OtherVar;
+	HVACVar.allocate();
+	ZoneVar.allocate();
+	OtherVar.allocate();
+	NumOfRVariable = 3;
+	RVariableTypes.allocate( NumOfRVariable );
+	RVariableTypes( 1 ).IndexType = 2;
+	RVariableTypes( 1 ).VarPtr = HVACVar;
+	RVariableTypes( 2 ).IndexType = 1;
+	RVariableTypes( 2 ).VarPtr = ZoneVar;
+	RVariableTypes( 3 ).IndexType = 1;
+	RVariableTypes( 3 ).VarPtr = OtherVar;
+
+	NumVarMeterArrays = 2;
+	VarMeterArrays.allocate( NumVarMeterArrays );
+	VarMeterArrays( 1 ).NumOnMeters = 2;
+	VarMeterArrays( 1 ).OnMeters( 1 ) = 1;
+	VarMeterArrays( 1 ).OnMeters( 2 ) = 3;
+	VarMeterArrays( 1 ).NumOnCustomMeters = 1;
+	VarMeterArrays( 1 ).OnCustomMeters.allocate( 1 );
+	VarMeterArrays( 1 ).OnCustomMeters( 1 ) = 2;
+	VarMeterArrays( 2 ).NumOnMeters = 1;
+	VarMeterArrays( 2 ).OnMeters( 1 ) = 1;
+
+	HVACVar().MeterArrayPtr = 1;
+	HVACVar().TSValue = 2.5;
+	HVACVar().ZoneMult = 2;
+	HVACVar().ZoneListMult = 1;
+	ZoneVar().MeterArrayPtr = 2;
+	ZoneVar().TSValue = 0.1;
+	ZoneVar().ZoneMult = 1;
+	ZoneVar().ZoneListMult = 3;
+	OtherVar().TSValue = 7.0;
+
+	NumEnergyMeters = 3;
+	MeterValue.dimension( NumEnergyMeters, 0.0 );
+	MeterPlan.Built = false;
+
+	UpdateMeterValuesFromPlan();
+
+	EXPECT_TRUE( MeterPlan.Built );
+	ASSERT_EQ( 2, MeterPlan.NumSources );
+	EXPECT_EQ( 2, MeterPlan.SourceVar( 1 ) ); // Zone variables come first
+	EXPECT_EQ( 1, MeterPlan.SourceVar( 2 ) );
+	EXPECT_EQ( 5, MeterPlan.RowStart( NumEnergyMeters + 1 ) ); // Four entries
+
+	// Same sums as one UpdateMeterValues call per variable in the time step loop order
+	Array1D< Real64 > PlanValue( MeterValue );
+	MeterValue = 0.0;
+	UpdateMeterValues( 0.1 * 1 * 3, VarMeterArrays( 2 ).NumOnMeters, VarMeterArrays( 2 ).OnMeters );
+	UpdateMeterValues( 2.5 * 2 * 1, VarMeterArrays( 1 ).NumOnMeters, VarMeterArrays( 1 ).OnMeters, VarMeterArrays( 1 ).NumOnCustomMeters, VarMeterArrays( 1 ).OnCustomMeters );
+	for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+		EXPECT_EQ( MeterValue( Meter ), PlanValue( Meter ) );
+	}
+	EXPECT_DOUBLE_EQ( 5.3, PlanValue( 1 ) );
+	EXPECT_DOUBLE_EQ( 5.0, PlanValue( 2 ) );
+
+	// Attaching another meter makes the plan stale
+	int MeterArrayPtr( 2 );
+	bool ErrorsFound( false );
+	AttachCustomMeters( "J", 2, MeterArrayPtr, 3, ErrorsFound );
+	EXPECT_FALSE( MeterPlan.Built );
+	MeterValue = 0.0;
+	UpdateMeterValuesFromPlan();
+	EXPECT_DOUBLE_EQ( 5.3, MeterValue( 3 ) );
+
+	// Clean up
+	MeterPlan = MeterAggregationPlanType();
+	MeterValue.deallocate();
+	NumEnergyMeters = 0;
+	VarMeterArrays.deallocate();
+	NumVarMeterArrays = 0;
+	RVariableTypes.deallocate();
+	NumOfRVariable = 0;
+	HVACVar.deallocate();
+	ZoneVar.deallocate();
+	OtherVar.deallocate();
+}
+
+TEST( OutputProcessor, OutputVariableRequested )
+{
+	ShowMessage( "Begin Test: OutputProcessor, OutputVariableRequested" );
+
+	// One variable requested for every key, one for a single key
+	DataOutputs::NumConsideredOutputVariables = 2;
+	DataOutputs::OutputVariablesForSimulation.allocate( 2 );
+	DataOutputs::OutputVariablesForSimulation( 1 ) = DataOutputs::OutputReportingVariables( "*", "SURFACE HEAT STORAGE RATE", 0, 0 );
+	DataOutputs::OutputVariablesForSimulation( 2 ) = DataOutputs::OutputReportingVariables( "WALL 1", "SURFACE INSIDE FACE SOLAR RADIATION HEAT GAIN RATE", 0, 0 );
+
+	EXPECT_TRUE( OutputVariableRequested( "Surface Heat Storage Rate [W]", "Roof" ) );
+	EXPECT_TRUE( OutputVariableRequested( "Surface Heat Storage Rate", "Wall 1" ) );
+	EXPECT_TRUE( OutputVariableRequested( "Surface Inside Face Solar Radiation Heat Gain Rate [W]", "Wall 1" ) );
+	EXPECT_FALSE( OutputVariableRequested( "Surface Inside Face Solar Radiation Heat Gain Rate [W]", "Roof" ) );
+	EXPECT_FALSE( OutputVariableRequested( "Surface Heat Storage Energy [J]", "Roof" ) );
+
+	// Same answers once the list is indexed by name
+	DataOutputs::IndexOutputVariablesForSimulation();
+	EXPECT_TRUE( OutputVariableRequested( "Surface Heat Storage Rate [W]", "Roof" ) );
+	EXPECT_TRUE( OutputVariableRequested( "Surface Inside Face Solar Radiation Heat Gain Rate [W]", "Wall 1" ) );
+	EXPECT_FALSE( OutputVariableRequested( "Surface Inside Face Solar Radiation Heat Gain Rate [W]", "Roof" ) );
+	EXPECT_FALSE( OutputVariableRequested( "Surface Heat Storage Energy [J]", "Roof" ) );
+
+	DataOutputs::OutputVariablesForSimulationByName.clear();
+	DataOutputs::OutputVariablesForSimulation.deallocate();
+	DataOutputs::NumConsideredOutputVariables = 0;
+}
+
+TEST( OutputProcessor, BuildKeyVarList )
+{
+	ShowMessage( "Begin Test: OutputProcessor, BuildKeyVarList" );
+
+	// Requests of one variable name: for one key hourly, for all keys daily, the same key again
+	// hourly in other case, and another key at each timestep
+	ReqRepVars.allocate( 4 );
+	ReqRepVars( 1 ) = ReqReportVariables( "Wall 1", "Surface Heat Storage Rate", 1, 0, "", false );
+	ReqRepVars( 2 ) = ReqReportVariables( "", "Surface Heat Storage Rate", 2, 0, "", false );
+	ReqRepVars( 3 ) = ReqReportVariables( "WALL 1", "SURFACE HEAT STORAGE RATE", 1, 0, "", false );
+	ReqRepVars( 4 ) = ReqReportVariables( "Roof", "Surface Heat Storage Rate", 0, 0, "", false );
+	ReqReportVariableGroup Group;
+	Group.ReqRepVarNums = { 1, 2, 3, 4 };
+	Group.ReqRepVarNumsByKey[ "WALL 1" ] = { 1, 3 };
+	Group.ReqRepVarNumsByKey[ "" ] = { 2 };
+	Group.ReqRepVarNumsByKey[ "ROOF" ] = { 4 };
+	ReportList.allocate( 10 );
+	NumReportList = 10;
+
+	// The duplicate hourly request is marked used but not listed twice
+	ReportList = 0;
+	NumExtraVars = 0;
+	BuildKeyVarList( "wall 1", Group );
+	AddBlankKeys( Group );
+	EXPECT_EQ( 2, NumExtraVars );
+	EXPECT_EQ( 1, ReportList( 1 ) );
+	EXPECT_EQ( 2, ReportList( 2 ) );
+	EXPECT_TRUE( ReqRepVars( 1 ).Used );
+	EXPECT_TRUE( ReqRepVars( 3 ).Used );
+	EXPECT_FALSE( ReqRepVars( 4 ).Used );
+
+	// A key that is an alias of this key is found too
+	AddReportKeyAlias( "Roof", "Wall 1" );
+	ReportList = 0;
+	NumExtraVars = 0;
+	BuildKeyVarList( "Wall 1", Group );
+	EXPECT_EQ( 2, NumExtraVars );
+	EXPECT_EQ( 1, ReportList( 1 ) );
+	EXPECT_EQ( 4, ReportList( 2 ) );
+	EXPECT_TRUE( ReqRepVars( 4 ).Used );
+
+	ReportKeyAliases.clear();
+	ReportList.deallocate();
+	NumReportList = 0;
+	NumExtraVars = 0;
+	ReqRepVars.deallocate();
+}
+
+TEST( OutputProcessor, BuildVariableReportLists )
+{
+	ShowMessage( "Begin Test: OutputProcessor, BuildVariableReportLists" );
+
+	// A zone variable reported hourly, an HVAC variable only on a meter, and a zone variable reported monthly
+	NumOfRVariable = 3;
+	RVariableTypes.allocate( NumOfRVariable );
+	Array1D_int const IndexTypes( 3, { ZoneVar, HVACVar, ZoneVar } );
+	Array1D_bool const Reports( 3, { true, false, true } );
+	Array1D_int const ReportFreqs( 3, { ReportHourly, ReportHourly, ReportMonthly } );
+	for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+		RVariableTypes( Loop ).IndexType = IndexTypes( Loop );
+		RVariableTypes( Loop ).VarPtr.allocate();
+		RVariableTypes( Loop ).VarPtr().Report = Reports( Loop );
+		RVariableTypes( Loop ).VarPtr().ReportFreq = ReportFreqs( Loop );
+	}
+
+	BuildVariableReportLists();
+	EXPECT_EQ( std::vector< int >( { 1, 3 } ), VariableReportLists( ZoneVar ).RVariableNums );
+	EXPECT_EQ( std::vector< int >( { 1, 3 } ), VariableReportLists( ZoneVar ).ReportedRVariableNums );
+	EXPECT_TRUE( VariableReportLists( ZoneVar ).UnreportedRVariableNums.empty() );
+	EXPECT_EQ( std::vector< int >( { 1 } ), VariableReportLists( ZoneVar ).ReportedRVariableNumsByFreq( ReportHourly ) );
+	EXPECT_EQ( std::vector< int >( { 3 } ), VariableReportLists( ZoneVar ).ReportedRVariableNumsByFreq( ReportMonthly ) );
+	EXPECT_TRUE( VariableReportLists( ZoneVar ).ReportedRVariableNumsByFreq( ReportDaily ).empty() );
+	EXPECT_EQ( std::vector< int >( { 2 } ), VariableReportLists( HVACVar ).RVariableNums );
+	EXPECT_TRUE( VariableReportLists( HVACVar ).ReportedRVariableNums.empty() );
+	EXPECT_EQ( std::vector< int >( { 2 } ), VariableReportLists( HVACVar ).UnreportedRVariableNums );
+	EXPECT_EQ( 3, VariableReportListsNumRVariable );
+
+	for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+		RVariableTypes( Loop ).VarPtr.deallocate();
+	}
+	RVariableTypes.deallocate();
+	NumOfRVariable = 0;
+	BuildVariableReportLists();
+	VariableReportListsNumRVariable = -1;
+}
+
+TEST( OutputProcessor, GetInternalVariableValuePtr )
+{
+	ShowMessage( "Begin Test: OutputProcessor, GetInternalVariableValuePtr" );
+
+	Real64 ActualVariable( 21.5 );
+	Reference< RealVariables > RVar;
+	RVar.allocate();
+	RVar().Which >>= ActualVariable;
+	NumOfRVariable = 1;
+	RVariableTypes.allocate( NumOfRVariable );
+	RVariableTypes( 1 ).VarPtr = RVar;
+
+	// The address given is read as the value GetInternalVariableValue gives
+	Real64 const * ValuePtr( GetInternalVariableValuePtr( 2, 1 ) );
+	ASSERT_TRUE( ValuePtr != nullptr );
+	EXPECT_DOUBLE_EQ( 21.5, *ValuePtr );
+	ActualVariable = -3.0;
+	EXPECT_DOUBLE_EQ( GetInternalVariableValue( 2, 1 ), *ValuePtr );
+
+	// Other types of variable and indexes out of range give null
+	EXPECT_TRUE( GetInternalVariableValuePtr( 1, 1 ) == nullptr );
+	EXPECT_TRUE( GetInternalVariableValuePtr( 3, 1 ) == nullptr );
+	EXPECT_TRUE( GetInternalVariableValuePtr( 2, 2 ) == nullptr );
+	EXPECT_TRUE( GetInternalVariableValuePtr( 0, 0 ) == nullptr );
+
+	RVariableTypes.deallocate();
+	NumOfRVariable = 0;
+	RVar.deallocate();
+}
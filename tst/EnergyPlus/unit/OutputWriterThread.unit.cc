@@ -0,0 +1,50 @@
+// EnergyPlus::OutputWriterThread Unit Tests
+
+// C++ Headers
+#include <sstream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/OutputWriterThread.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::OutputWriterThread;
+
+TEST( OutputWriterThreadTest, WritesInOrder )
+{
+	ShowMessage( "Begin Test: OutputWriterThreadTest, WritesInOrder" );
+
+	std::ostringstream Stream;
+	std::ostringstream Expected;
+	std::ostream * Out( &Stream );
+	Stream << "Program Version\n";
+	Expected << "Program Version\n";
+
+	StartOutputWriter( Out );
+	EXPECT_EQ( 1u, WriterBuffers.size() );
+	StartOutputWriter( Out ); // Already started
+	EXPECT_EQ( 1u, WriterBuffers.size() );
+
+	// Several blocks worth of records
+	for ( int i = 1; i <= 40000; ++i ) {
+		*Out << i << ',' << 0.5 * i << ",Zone Air Temperature\n";
+		Expected << i << ',' << 0.5 * i << ",Zone Air Temperature\n";
+	}
+	Out->flush();
+	EXPECT_EQ( Expected.str(), Stream.str() );
+
+	*Out << "End of Data\n";
+	Expected << "End of Data\n";
+	StopOutputWriter( Out );
+	EXPECT_TRUE( WriterBuffers.empty() );
+	EXPECT_EQ( Expected.str(), Stream.str() );
+
+	// The stream has its own buffer back
+	Stream << "After";
+	EXPECT_EQ( Expected.str() + "After", Stream.str() );
+	StopAllOutputWriters();
+}
@@ -0,0 +1,47 @@
+// EnergyPlus::Photovoltaics Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataPhotovoltaics.hh>
+#include <EnergyPlus/Photovoltaics.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataPhotovoltaics;
+using namespace EnergyPlus::Photovoltaics;
+
+TEST( PhotovoltaicsTest, MatchModuleGroupConditions )
+{
+	ShowMessage( "Begin Test: PhotovoltaicsTest, MatchModuleGroupConditions" );
+
+	PVModuleGroups.allocate( 2 );
+	PVModuleGroups( 1 ).PVModelType = iSandiaPVModel;
+	PVModuleGroups( 2 ).PVModelType = iTRNSYSPVModel;
+
+	// Nothing is kept before the first evaluation of a group
+	EXPECT_FALSE( MatchModuleGroupConditions( 1, { 500.0, 100.0, 30.0, 40.0, 0.0, 35.0 } ) );
+	EXPECT_FALSE( PVModuleGroups( 1 ).Evaluated );
+	PVModuleGroups( 1 ).SNLPVCalc.Pmp = 150.0;
+	PVModuleGroups( 1 ).Evaluated = true;
+
+	// The next generator at the same conditions uses the kept results
+	EXPECT_TRUE( MatchModuleGroupConditions( 1, { 500.0, 100.0, 30.0, 40.0, 0.0, 35.0 } ) );
+	EXPECT_DOUBLE_EQ( 150.0, PVModuleGroups( 1 ).SNLPVCalc.Pmp );
+
+	// Any other condition, here a shaded generator, is evaluated and becomes the kept one
+	EXPECT_FALSE( MatchModuleGroupConditions( 1, { 20.0, 100.0, 30.0, 40.0, 0.0, 35.0 } ) );
+	EXPECT_FALSE( PVModuleGroups( 1 ).Evaluated );
+	PVModuleGroups( 1 ).Evaluated = true;
+	EXPECT_TRUE( MatchModuleGroupConditions( 1, { 20.0, 100.0, 30.0, 40.0, 0.0, 35.0 } ) );
+	EXPECT_FALSE( MatchModuleGroupConditions( 1, { 500.0, 100.0, 30.0, 40.0, 0.0, 35.0 } ) );
+
+	// Groups are kept apart
+	EXPECT_FALSE( MatchModuleGroupConditions( 2, { 500.0, 293.15, 0.0 } ) );
+	PVModuleGroups( 2 ).Evaluated = true;
+	EXPECT_TRUE( MatchModuleGroupConditions( 2, { 500.0, 293.15, 0.0 } ) );
+	EXPECT_FALSE( MatchModuleGroupConditions( 1, { 500.0, 293.15, 0.0 } ) );
+
+	PVModuleGroups.deallocate();
+}
@@ -0,0 +1,84 @@
+// EnergyPlus::PlantPipingSystemsManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <PlantPipingSystemsManager.hh>
+#include <DataPlantPipingSystems.hh>
+#include <UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::PlantPipingSystemsManager;
+using namespace EnergyPlus::DataPlantPipingSystems;
+
+TEST( PlantPipingSystemsManagerTest, SolveFieldCellTemperatures )
+{
+	ShowMessage( "Begin Test: PlantPipingSystemsManagerTest, SolveFieldCellTemperatures" );
+
+	// A row of six cells: fixed temperatures at both ends and four field cells between
+	PipingSystemDomains.allocate( 1 );
+	auto & domain( PipingSystemDomains( 1 ) );
+	domain.SimControls.Convergence_CurrentToPrevIteration = 1.0e-6;
+	domain.Cells.allocate( { 0, 5 }, { 0, 0 }, { 0, 0 } );
+	for ( int X = 0; X <= 5; ++X ) {
+		auto & cell( domain.Cells( X, 0, 0 ) );
+		cell.X_index = X;
+		cell.Y_index = 0;
+		cell.Z_index = 0;
+		cell.X_min = X;
+		cell.X_max = X + 1.0;
+		cell.Y_min = 0.0;
+		cell.Y_max = 2.0;
+		cell.Z_min = 0.0;
+		cell.Z_max = 1.5;
+		cell.CellType = CellType_GeneralField;
+		cell.MyBase.Properties.Conductivity = 1.0 + 0.2 * X;
+		cell.MyBase.Beta = 0.4 + 0.1 * X;
+		cell.MyBase.Temperature = 10.0;
+		cell.MyBase.Temperature_PrevTimeStep = 10.0 + X;
+		cell.NeighborInformation.allocate( 2 );
+		cell.NeighborInformation( 1 ).Direction = Direction_PositiveX;
+		cell.NeighborInformation( 2 ).Direction = Direction_NegativeX;
+		for ( int Dir = 1; Dir <= 2; ++Dir ) {
+			cell.NeighborInformation( Dir ).Value.ThisCentroidToNeighborWall = 0.5;
+			cell.NeighborInformation( Dir ).Value.ThisWallToNeighborCentroid = 0.5;
+		}
+	}
+	domain.Cells( 0, 0, 0 ).CellType = CellType_FarfieldBoundary;
+	domain.Cells( 0, 0, 0 ).MyBase.Temperature = 5.0;
+	domain.Cells( 5, 0, 0 ).CellType = CellType_FarfieldBoundary;
+	domain.Cells( 5, 0, 0 ).MyBase.Temperature = 20.0;
+
+	// The kept neighbors give the same cell balance
+	SetupFieldCellSolver( 1 );
+	EXPECT_EQ( 2, domain.FieldSolver.Np[ 1 ] - domain.FieldSolver.Np[ 0 ] );
+	EXPECT_EQ( -1, domain.FieldSolver.NbPos[ 1 ] );
+	for ( int X = 1; X <= 4; ++X ) {
+		EXPECT_EQ( EvaluateFieldCellTemperature( 1, domain.Cells( X, 0, 0 ) ), EvaluateCachedFieldCellTemperature( 1, X - 1 ) );
+	}
+
+	// Reference: point Gauss-Seidel sweeps run to convergence
+	for ( int Sweep = 1; Sweep <= 2000; ++Sweep ) {
+		for ( int X = 1; X <= 4; ++X ) {
+			domain.Cells( X, 0, 0 ).MyBase.Temperature = EvaluateFieldCellTemperature( 1, domain.Cells( X, 0, 0 ) );
+		}
+	}
+	Real64 Reference[ 4 ];
+	for ( int X = 1; X <= 4; ++X ) {
+		Reference[ X - 1 ] = domain.Cells( X, 0, 0 ).MyBase.Temperature;
+		domain.Cells( X, 0, 0 ).MyBase.Temperature = 10.0;
+	}
+
+	SolveFieldCellTemperatures( 1 );
+	EXPECT_TRUE( domain.FieldSolver.Built );
+	ASSERT_EQ( 4u, domain.FieldSolver.CellX.size() );
+	EXPECT_EQ( -1, domain.FieldSolver.CellPos( 0, 0, 0 ) );
+	EXPECT_LE( domain.FieldSolver.Iterations, 6 );
+	for ( int X = 1; X <= 4; ++X ) {
+		EXPECT_NEAR( Reference[ X - 1 ], domain.Cells( X, 0, 0 ).MyBase.Temperature, 1.0e-7 );
+	}
+	EXPECT_DOUBLE_EQ( 5.0, domain.Cells( 0, 0, 0 ).MyBase.Temperature );
+
+	PipingSystemDomains.deallocate();
+}
@@ -0,0 +1,111 @@
+// EnergyPlus::Profiler Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/Profiler.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Profiler;
+
+TEST( ProfilerTest, NestedZones )
+{
+	ShowMessage( "Begin Test: ProfilerTest, NestedZones" );
+
+	int const OuterNum( RegisterProfileZone( "ProfilerTestOuter" ) );
+	int const InnerNum( RegisterProfileZone( "ProfilerTestInner" ) );
+	EXPECT_NE( OuterNum, InnerNum );
+	EXPECT_EQ( OuterNum, RegisterProfileZone( "ProfilerTestOuter" ) );
+
+	// Inactive zones are not recorded
+	DataSystemVariables::SimulationProfile = false;
+	ProfileTree = ProfileTreeData();
+	{
+		ProfileZone const Profile( OuterNum );
+	}
+	EXPECT_EQ( 1u, ProfileTree.Nodes.size() );
+
+	DataSystemVariables::SimulationProfile = true;
+	for ( int Pass = 1; Pass <= 3; ++Pass ) {
+		ProfileZone const OuterProfile( OuterNum );
+		ProfileZone const InnerProfile( InnerNum );
+		ProfileZone const InnerAgainProfile( InnerNum ); // Recursion gets its own node
+	}
+	{
+		ProfileZone const Profile( InnerNum ); // Same zone outside the outer zone is a different path
+	}
+	ASSERT_EQ( 5u, ProfileTree.Nodes.size() );
+	EXPECT_EQ( 0, ProfileTree.Current );
+	int const Outer( 1 ); // First node added
+	EXPECT_EQ( OuterNum, ProfileTree.Nodes[ Outer ].ZoneNum );
+	EXPECT_EQ( 3, ProfileTree.Nodes[ Outer ].Calls );
+	int const Inner( ProfileTree.Nodes[ Outer ].FirstChild );
+	ASSERT_GT( Inner, 0 );
+	EXPECT_EQ( InnerNum, ProfileTree.Nodes[ Inner ].ZoneNum );
+	EXPECT_EQ( 3, ProfileTree.Nodes[ Inner ].Calls );
+	EXPECT_EQ( -1, ProfileTree.Nodes[ Inner ].NextSibling );
+	EXPECT_LE( ProfileTree.Nodes[ Inner ].Time, ProfileTree.Nodes[ Outer ].Time );
+	EXPECT_EQ( 1, ProfileTree.Nodes[ ProfileTree.Nodes[ 0 ].FirstChild ].Calls ); // Latest root zone first
+
+	// Summary of a zone still open counts it up to now and leaves the tree as it was
+	DataStringGlobals::outputProfFileName = "ProfilerTest.prof";
+	{
+		ProfileZone const Profile( OuterNum );
+		WriteProfileSummary();
+		EXPECT_EQ( 1, ProfileTree.Current );
+	}
+	std::ifstream File( DataStringGlobals::outputProfFileName );
+	EXPECT_TRUE( File.good() );
+	std::string Line;
+	while ( std::getline( File, Line ) ) {
+		EXPECT_EQ( 0u, Line.find( "ProfilerTest" ) );
+		EXPECT_NE( std::string::npos, Line.find( ' ' ) );
+	}
+	File.close();
+	std::remove( DataStringGlobals::outputProfFileName.c_str() );
+
+	DataSystemVariables::SimulationProfile = false;
+	DataStringGlobals::outputProfFileName = "eplusout.prof";
+	ProfileTree = ProfileTreeData();
+}
+
+TEST( ProfilerTest, ComponentTimer )
+{
+	ShowMessage( "Begin Test: ProfilerTest, ComponentTimer" );
+
+	ComponentTiming.clear();
+	ComponentTimingMap.clear();
+
+	DataSystemVariables::ComponentRuntimeAccounting = false;
+	{
+		ComponentTimer const Timer( "Fan:ConstantVolume", "Supply Fan" );
+	}
+	EXPECT_TRUE( ComponentTiming.empty() );
+
+	DataSystemVariables::ComponentRuntimeAccounting = true;
+	for ( int Pass = 1; Pass <= 2; ++Pass ) {
+		ComponentTimer const Fan( "Fan:ConstantVolume", "Supply Fan" );
+		ComponentTimer const Coil( "Coil:Heating:Gas", "Supply Fan" ); // Same name, other type
+	}
+	ASSERT_EQ( 2u, ComponentTiming.size() );
+	EXPECT_EQ( 0, ComponentTimingIndex( "Fan:ConstantVolume", "Supply Fan" ) );
+	EXPECT_EQ( 1, ComponentTimingIndex( "Coil:Heating:Gas", "Supply Fan" ) );
+	EXPECT_EQ( "Coil:Heating:Gas", ComponentTiming[ 1 ].CompType );
+	EXPECT_EQ( "Supply Fan", ComponentTiming[ 1 ].CompName );
+	EXPECT_EQ( 2, ComponentTiming[ 0 ].Calls );
+	EXPECT_EQ( 2, ComponentTiming[ 1 ].Calls );
+	EXPECT_LE( ComponentTiming[ 1 ].Time, ComponentTiming[ 0 ].Time );
+
+	DataSystemVariables::ComponentRuntimeAccounting = false;
+	ComponentTiming.clear();
+	ComponentTimingMap.clear();
+}
@@ -0,0 +1,88 @@
+// EnergyPlus::Psychrometrics Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/Psychrometrics.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Psychrometrics;
+
+TEST( PsychrometricsTest, BatchMatchesScalar )
+{
+	ShowMessage( "Begin Test: PsychrometricsTest, BatchMatchesScalar" );
+
+	InitializePsychRoutines();
+
+	int const n( 7 );
+	Real64 const Pb( 101325.0 );
+	Array1D< Real64 > Tdb( n );
+	Array1D< Real64 > W( n );
+	for ( int i = 1; i <= n; ++i ) {
+		Tdb( i ) = -10.0 + 7.5 * i;
+		W( i ) = 0.002 * i;
+	}
+	W( 1 ) = 0.0; // Below the humidity ratio floor
+
+	Array1D< Real64 > Rho( n ), H( n ), Cp( n ), T( n ), W2( n ), Psat( n ), Twb( n );
+	PsyRhoAirFnPbTdbW( Pb, Tdb, W, Rho );
+	PsyHFnTdbW( Tdb, W, H );
+	PsyCpAirFnWTdb( W, Tdb, Cp );
+	PsyTdbFnHW( H, W, T );
+	PsyWFnTdbH( Tdb, H, W2 );
+	PsyPsatFnTemp( Tdb, Psat );
+	PsyTwbFnTdbWPb( Tdb, W, Pb, Twb );
+
+	for ( int i = 1; i <= n; ++i ) {
+		EXPECT_DOUBLE_EQ( PsyRhoAirFnPbTdbW( Pb, Tdb( i ), W( i ) ), Rho( i ) );
+		EXPECT_DOUBLE_EQ( PsyHFnTdbW( Tdb( i ), W( i ) ), H( i ) );
+		EXPECT_DOUBLE_EQ( PsyCpAirFnWTdb( W( i ), Tdb( i ) ), Cp( i ) );
+		EXPECT_DOUBLE_EQ( PsyTdbFnHW( H( i ), W( i ) ), T( i ) );
+		EXPECT_DOUBLE_EQ( PsyWFnTdbH( Tdb( i ), H( i ) ), W2( i ) );
+		EXPECT_DOUBLE_EQ( PsyPsatFnTemp( Tdb( i ) ), Psat( i ) );
+		EXPECT_DOUBLE_EQ( PsyTwbFnTdbWPb( Tdb( i ), W( i ), Pb ), Twb( i ) );
+		EXPECT_NEAR( Tdb( i ), T( i ), 1.0e-9 );
+	}
+	EXPECT_NEAR( 1.0e-5, W2( 1 ), 1.0e-12 );
+}
+
+TEST( PsychrometricsTest, SetAssociativeCaches )
+{
+	ShowMessage( "Begin Test: PsychrometricsTest, SetAssociativeCaches" );
+
+	// Sizes are rounded up to whole power of 2 numbers of sets
+	SetPsychCacheSizes( 10, 20, 3, 24 );
+	EXPECT_EQ( 4 * twbcache_ways, twbcache_size );
+	EXPECT_EQ( 3, twbcache_mask );
+	EXPECT_EQ( psatcache_ways, psatcache_size );
+	EXPECT_EQ( 0, psatcache_mask );
+	EXPECT_EQ( psatcache_size, cached_Psat.isize() );
+
+	// One set: the newest value is in front and the oldest is dropped when it is full
+	Array1D< Real64 > Psat( psatcache_ways + 1 );
+	for ( int i = 1; i <= psatcache_ways + 1; ++i ) {
+		Psat( i ) = PsyPsatFnTemp( 5.0 * i );
+		EXPECT_NEAR( PsyPsatFnTemp_raw( 5.0 * i ), Psat( i ), 1.0e-3 );
+		EXPECT_DOUBLE_EQ( Psat( i ), cached_Psat( 0 ).Psat );
+	}
+	for ( int Way = 0; Way < psatcache_ways; ++Way ) {
+		EXPECT_NE( Psat( 1 ), cached_Psat( Way ).Psat );
+	}
+
+	// A value found further back in the set moves forward one place
+	EXPECT_DOUBLE_EQ( Psat( 2 ), cached_Psat( psatcache_ways - 1 ).Psat );
+	EXPECT_DOUBLE_EQ( Psat( 2 ), PsyPsatFnTemp( 10.0 ) );
+	EXPECT_DOUBLE_EQ( Psat( 2 ), cached_Psat( psatcache_ways - 2 ).Psat );
+
+	// Wet-bulb results are the same as without the cache to the cache precision
+	for ( int i = 1; i <= 40; ++i ) {
+		Real64 const Tdb( 0.75 * i );
+		Real64 const W( 0.0005 * i );
+		EXPECT_NEAR( PsyTwbFnTdbWPb_raw( Tdb, W, 101325.0 ), PsyTwbFnTdbWPb( Tdb, W, 101325.0 ), 1.0e-3 );
+	}
+	EXPECT_NEAR( PsyTwbFnTdbWPb_raw( 30.0, 0.02, 101325.0 ), PsyTwbFnTdbWPb( 30.0, 0.02, 101325.0 ), 1.0e-3 );
+
+	InitializePsychRoutines();
+}
@@ -0,0 +1,146 @@
+// EnergyPlus::RuntimeLanguageProcessor Unit Tests
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/RuntimeLanguageProcessor.hh>
+#include <EnergyPlus/DataRuntimeLanguage.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RuntimeLanguageProcessor;
+using namespace EnergyPlus::DataRuntimeLanguage;
+
+TEST( RuntimeLanguageProcessorTest, CompiledExpressionsMatchInterpreter )
+{
+	ShowMessage( "Begin Test: RuntimeLanguageProcessorTest, CompiledExpressionsMatchInterpreter" );
+
+	False = SetErlValueNumber( 0.0 );
+	True = SetErlValueNumber( 1.0 );
+	NumErlStacks = 1;
+	ErlStack.allocate( NumErlStacks );
+	ErlStack( 1 ).Name = "TEST";
+
+	std::vector< std::string > const Lines = {
+		"X + Y * 2", "(X - 1) / Y", "X / (Y - Y)", "X ^ 0.5", "Y ^ 0.5", "(@Exp X) + 1", "@Exp 800", "@Ln (X - X)",
+		"@Max X Y", "@Mod Y 3", "@Round X", "X == Y", "X <> Y", "X >= Y && Y > 0", "X < 0 || Y < 0", "X <= Y",
+		"N == N", "N + 1", "E * 2", "E", "(E)", "X", "5", "2 * 3 + X", "-X + 1", "@CpHW X", "@RANDOMUNIFORM 0 1"
+	};
+	std::vector< int > ExpressionNums;
+	for ( auto const & Line : Lines ) {
+		int ExpressionNum( 0 );
+		ParseExpression( Line, 1, ExpressionNum, Line );
+		ASSERT_GT( ExpressionNum, 0 );
+		ExpressionNums.push_back( ExpressionNum );
+	}
+	int const X( FindEMSVariable( "X", 1 ) );
+	int const Y( FindEMSVariable( "Y", 1 ) );
+	int const N( FindEMSVariable( "N", 1 ) );
+	int const E( FindEMSVariable( "E", 1 ) );
+	ErlVariable( N ).Value.Type = ValueNull;
+	ErlVariable( E ).Value.Type = ValueError;
+	ErlVariable( E ).Value.Number = 3.0;
+	ErlVariable( E ).Value.Error = "Earlier error";
+
+	Real64 const XValues[] = { -2.5, 0.0, 3.0 };
+	for ( Real64 const XValue : XValues ) {
+		ErlVariable( X ).Value.Number = XValue;
+		ErlVariable( Y ).Value.Number = 4.0;
+		for ( std::size_t LineNum = 0; LineNum < Lines.size(); ++LineNum ) {
+			if ( Lines[ LineNum ][ 0 ] == '@' && Lines[ LineNum ][ 1 ] == 'R' ) continue; // random numbers differ on each call
+			ErlValueType const Expected( EvaluateExpression( ExpressionNums[ LineNum ] ) );
+			ErlValueType const Value( EvaluateCompiledExpression( ExpressionNums[ LineNum ] ) );
+			EXPECT_EQ( Expected.Type, Value.Type ) << Lines[ LineNum ];
+			EXPECT_EQ( Expected.Number, Value.Number ) << Lines[ LineNum ];
+			EXPECT_EQ( Expected.Error, Value.Error ) << Lines[ LineNum ];
+		}
+	}
+
+	// Operations on constants are done once, random numbers are left to the interpreter
+	EXPECT_TRUE( ErlCompiledExpression( ExpressionNums[ 23 ] ).Compiled );
+	EXPECT_EQ( 1u, ErlCompiledExpression( ExpressionNums[ 23 ] ).Code.size() );
+	EXPECT_FALSE( ErlCompiledExpression( ExpressionNums[ 26 ] ).Compiled );
+
+	// A new Erl variable compiles the expressions again
+	int ExpressionNum( 0 );
+	ParseExpression( "Z * X", 1, ExpressionNum, "Z * X" );
+	ErlVariable( FindEMSVariable( "Z", 1 ) ).Value.Number = 0.5;
+	EXPECT_EQ( 0.5 * ErlVariable( X ).Value.Number, EvaluateCompiledExpression( ExpressionNum ).Number );
+	EXPECT_EQ( NumErlVariables, CompiledNumErlVariables );
+
+	ErlStack.deallocate();
+	ErlVariable.deallocate();
+	ErlExpression.deallocate();
+	ErlCompiledExpression.deallocate();
+	NumErlStacks = 0;
+	NumErlVariables = 0;
+	NumExpressions = 0;
+	CompiledNumExpressions = -1;
+	CompiledNumErlVariables = -1;
+}
+
+TEST( RuntimeLanguageProcessorTest, ProfileCountsCallsAndInstructions )
+{
+	ShowMessage( "Begin Test: RuntimeLanguageProcessorTest, ProfileCountsCallsAndInstructions" );
+
+	False = SetErlValueNumber( 0.0 );
+	True = SetErlValueNumber( 1.0 );
+	NumErlPrograms = 1;
+	NumErlSubroutines = 1;
+	NumErlStacks = 2;
+	ErlStack.allocate( NumErlStacks );
+	ErlStackProfile.allocate( NumErlStacks );
+	ErlStack( 1 ).Name = "MAIN";
+	ErlStack( 1 ).NumLines = 2;
+	ErlStack( 1 ).Line.allocate( 2 );
+	ErlStack( 1 ).Line( 1 ) = "SET X = 2";
+	ErlStack( 1 ).Line( 2 ) = "RUN SUB";
+	ErlStack( 2 ).Name = "SUB";
+	ErlStack( 2 ).NumLines = 3;
+	ErlStack( 2 ).Line.allocate( 3 );
+	ErlStack( 2 ).Line( 1 ) = "SET Y = X + 1";
+	ErlStack( 2 ).Line( 2 ) = "RETURN";
+	ErlStack( 2 ).Line( 3 ) = "SET Y = 0";
+	NewEMSVariable( "X", 0 ); // global variables, shared by the program and the subroutine
+	int const Y( NewEMSVariable( "Y", 0 ) );
+	ParseStack( 1 );
+	ParseStack( 2 );
+	ASSERT_EQ( 0, ErlStack( 1 ).NumErrors );
+	ASSERT_EQ( 0, ErlStack( 2 ).NumErrors );
+
+	OutputEMSProfile = true;
+	EvaluateStack( 1 );
+	EvaluateStack( 1 );
+	EXPECT_EQ( 3.0, ErlVariable( Y ).Value.Number );
+
+	EXPECT_EQ( 2, ErlStackProfile( 1 ).NumCalls );
+	EXPECT_EQ( 4, ErlStackProfile( 1 ).NumInstructions );
+	EXPECT_EQ( 2, ErlStackProfile( 2 ).NumCalls );
+	EXPECT_EQ( 4, ErlStackProfile( 2 ).NumInstructions ); // stops at the RETURN
+	EXPECT_LE( ErlStackProfile( 1 ).SelfTime, ErlStackProfile( 1 ).Time );
+	EXPECT_GE( ErlStackProfile( 1 ).Time, ErlStackProfile( 2 ).Time );
+	EXPECT_DOUBLE_EQ( ErlStackProfile( 2 ).SelfTime, ErlStackProfile( 2 ).Time );
+
+	OutputEMSProfile = false;
+	EvaluateStack( 1 );
+	EXPECT_EQ( 2, ErlStackProfile( 1 ).NumCalls );
+
+	ErlStack.deallocate();
+	ErlStackProfile.deallocate();
+	ErlVariable.deallocate();
+	ErlExpression.deallocate();
+	ErlCompiledExpression.deallocate();
+	NumErlPrograms = 0;
+	NumErlSubroutines = 0;
+	NumErlStacks = 0;
+	NumErlVariables = 0;
+	NumExpressions = 0;
+	CompiledNumExpressions = -1;
+	CompiledNumErlVariables = -1;
+	ProfileNestedTime = 0.0;
+}
@@ -0,0 +1,69 @@
+// EnergyPlus::RuntimeMetrics Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/RuntimeMetrics.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RuntimeMetrics;
+
+TEST( RuntimeMetricsTest, MetricsFile )
+{
+	ShowMessage( "Begin Test: RuntimeMetricsTest, MetricsFile" );
+
+	// Nothing is kept without a metrics file
+	DataSystemVariables::RuntimeMetricsFileName = "";
+	InitRuntimeMetrics();
+	EXPECT_FALSE( Metrics.Active );
+	CountHVACIterations( 3 );
+	EXPECT_EQ( 0, Metrics.SystemTimeSteps );
+
+	std::string const FileName( "eplusout.runtime_metrics.json" );
+	DataSystemVariables::RuntimeMetricsFileName = FileName;
+	DataEnvironment::EnvironmentName = "CHICAGO \"OHARE\" ANNUAL";
+	DataGlobals::TimeStepZone = 0.25;
+	InitRuntimeMetrics();
+	ASSERT_TRUE( Metrics.Active );
+
+	CountHVACIterations( 2 );
+	CountHVACIterations( 6 );
+	UpdateRuntimeMetrics();
+	EXPECT_EQ( 2, Metrics.SystemTimeSteps );
+	EXPECT_DOUBLE_EQ( 0.25, Metrics.SimulatedHours );
+
+	std::string const JSON( RuntimeMetricsJSON( "Simulating", Metrics.LastWriteTime + 1.0 ) );
+	EXPECT_NE( std::string::npos, JSON.find( "\"Status\": \"Simulating\"," ) );
+	EXPECT_NE( std::string::npos, JSON.find( "\"EnvironmentName\": \"CHICAGO \\\"OHARE\\\" ANNUAL\"," ) );
+	EXPECT_NE( std::string::npos, JSON.find( "\"IntervalSimulatedToWallTimeRatio\": 900.00," ) );
+	EXPECT_NE( std::string::npos, JSON.find( "\"IntervalHVACIterationsPerTimeStep\": 4.00," ) );
+	EXPECT_NE( std::string::npos, JSON.find( "\"IntervalMaxHVACIterations\": 6," ) );
+
+	// The file holds the last write, and the interval restarts with it
+	EndRuntimeMetrics();
+	EXPECT_FALSE( Metrics.Active );
+	EXPECT_EQ( 0, Metrics.IntervalMaxHVACIterations );
+	std::ifstream File( FileName );
+	ASSERT_TRUE( File.good() );
+	std::stringstream Contents;
+	Contents << File.rdbuf();
+	File.close();
+	EXPECT_EQ( '{', Contents.str().front() );
+	EXPECT_NE( std::string::npos, Contents.str().find( "\"Status\": \"Completed\"," ) );
+	EXPECT_NE( std::string::npos, Contents.str().find( "\"HVACIterations\": 8," ) );
+
+	std::remove( FileName.c_str() );
+	DataSystemVariables::RuntimeMetricsFileName = "";
+	DataEnvironment::EnvironmentName = "";
+	DataGlobals::TimeStepZone = 0.0;
+}
@@ -409,6 +409,31 @@ namespace EnergyPlus {
 		EXPECT_EQ(2, reportExtendedData.size());
 	}
 
+	TEST_F( SQLiteFixture, reportDataBatches ) {
+		ShowMessage( "Begin Test: SQLiteFixture, reportDataBatches" );
+		sqlite_test->startWriterThread();
+		sqlite_test->sqliteBegin();
+		sqlite_test->createSQLiteTimeIndexRecord( 4, 1, 1, 0 );
+		sqlite_test->createSQLiteReportDictionaryRecord( 1, 1, "Zone", "Environment", "Site Outdoor Air Drybulb Temperature", 1, "C", 1, false, _ );
+		// Two full multi-row inserts and the rest one row at a time
+		for ( int i = 0; i < 250; ++i ) {
+			sqlite_test->createSQLiteReportDataRecord( 1, i );
+		}
+		sqlite_test->flushReportData();
+		auto reportData = queryResult("SELECT * FROM ReportData ORDER BY ReportDataIndex;", "ReportData");
+		sqlite_test->sqliteCommit();
+
+		ASSERT_EQ(250, reportData.size());
+		int const firstIndex = std::stoi(reportData[0][0]);
+		for ( int i = 0; i < 250; ++i ) {
+			EXPECT_EQ(firstIndex + i, std::stoi(reportData[i][0]));
+			EXPECT_EQ("1", reportData[i][1]);
+			EXPECT_EQ("1", reportData[i][2]);
+			EXPECT_EQ(i, std::stoi(reportData[i][3]));
+		}
+		EXPECT_EQ("", ss->str());
+	}
+
 	TEST_F( SQLiteFixture, addSQLiteZoneSizingRecord ) {
 		ShowMessage( "Begin Test: SQLiteFixture, addSQLiteZoneSizingRecord" );
 		sqlite_test->sqliteBegin();
@@ -451,6 +476,22 @@ namespace EnergyPlus {
 		EXPECT_EQ(testResult1, result[1]);
 	}
 
+	TEST_F( SQLiteFixture, addSQLiteHVACConvergenceRecord ) {
+		ShowMessage( "Begin Test: SQLiteFixture, addSQLiteHVACConvergenceRecord" );
+		EXPECT_EQ(0, columnCount("HVACConvergence"));
+		sqlite_test->sqliteBegin();
+		sqlite_test->addSQLiteHVACConvergenceRecord( 1, 2, 14, 3, 0.25, true, 2, 5, 40, 12, true );
+		sqlite_test->addSQLiteHVACConvergenceRecord( 1, 2, 14, 3, 0.5, false, 6, 21, 160, 98, false );
+		auto result = queryResult("SELECT * FROM HVACConvergence;", "HVACConvergence");
+		sqlite_test->sqliteCommit();
+
+		ASSERT_EQ(2, result.size());
+		std::vector<std::string> testResult0 {"1", "1", "2", "14", "3", "0.25", "1", "2", "5", "40", "12", "1"};
+		std::vector<std::string> testResult1 {"2", "1", "2", "14", "3", "0.5", "0", "6", "21", "160", "98", "0"};
+		EXPECT_EQ(testResult0, result[0]);
+		EXPECT_EQ(testResult1, result[1]);
+	}
+
 	TEST_F( SQLiteFixture, privateMethods ) {
 		ShowMessage( "Begin Test: SQLiteFixture, privateMethods" );
 		// test storageType
@@ -0,0 +1,222 @@
+// EnergyPlus::ScheduleManager Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ScheduleManager.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ScheduleManager;
+
+TEST( ScheduleManagerTest, ActiveDaySchedules )
+{
+	ShowMessage( "Begin Test: ScheduleManagerTest, ActiveDaySchedules" );
+
+	DataGlobals::NumOfTimeStepInHour = 4;
+	ScheduleInputProcessed = true;
+	ActiveDayValid = false;
+
+	// Day schedule 1 is hour + timestep / 10, day schedule 2 is its negative
+	NumDaySchedules = 2;
+	DaySchedule.allocate( NumDaySchedules );
+	for ( int DayNum = 1; DayNum <= NumDaySchedules; ++DayNum ) {
+		DaySchedule( DayNum ).TSValue.allocate( DataGlobals::NumOfTimeStepInHour, 24 );
+		for ( int Hour = 1; Hour <= 24; ++Hour ) {
+			for ( int TS = 1; TS <= DataGlobals::NumOfTimeStepInHour; ++TS ) {
+				DaySchedule( DayNum ).TSValue( TS, Hour ) = ( DayNum == 1 ? 1.0 : -1.0 ) * ( Hour + 0.1 * TS );
+			}
+		}
+	}
+	// Week schedule 1 uses day 1 on weekdays and day 2 at weekends and holidays
+	NumWeekSchedules = 1;
+	WeekSchedule.allocate( NumWeekSchedules );
+	WeekSchedule( 1 ).DaySchedulePointer = 1;
+	WeekSchedule( 1 ).DaySchedulePointer( 1 ) = 2;
+	WeekSchedule( 1 ).DaySchedulePointer( 7 ) = 2;
+	WeekSchedule( 1 ).DaySchedulePointer( 8 ) = 2;
+	NumSchedules = 2;
+	Schedule.allocate( NumSchedules );
+	Schedule( 1 ).WeekSchedulePointer = 1;
+	Schedule( 2 ).WeekSchedulePointer = 1;
+
+	DataEnvironment::DayOfYear_Schedule = 10;
+	DataEnvironment::DayOfWeek = 2;
+	DataEnvironment::HolidayIndex = 0;
+	DataEnvironment::DSTIndicator = 0;
+	DataGlobals::HourOfDay = 5;
+	DataGlobals::TimeStep = 3;
+	UpdateScheduleValues();
+	EXPECT_TRUE( ActiveDayIsCurrent() );
+	EXPECT_DOUBLE_EQ( 5.3, GetCurrentScheduleValue( 1 ) );
+	EXPECT_DOUBLE_EQ( 5.3, GetCurrentScheduleValue( 2 ) );
+	EXPECT_DOUBLE_EQ( 5.1, LookUpScheduleValue( 1, 5, 1 ) );
+
+	// Daylight saving time past midnight uses the first hour of the same day
+	DataEnvironment::DSTIndicator = 1;
+	DataGlobals::HourOfDay = 24;
+	UpdateScheduleValues();
+	EXPECT_DOUBLE_EQ( 1.3, GetCurrentScheduleValue( 1 ) );
+	DataEnvironment::DSTIndicator = 0;
+
+	// A new day or a holiday resolves the day schedules again
+	DataEnvironment::DayOfYear_Schedule = 11;
+	DataEnvironment::DayOfWeek = 7;
+	DataGlobals::HourOfDay = 1;
+	DataGlobals::TimeStep = 4;
+	UpdateScheduleValues();
+	EXPECT_EQ( 2, ActiveDaySchedulePtr( 1 ) );
+	EXPECT_DOUBLE_EQ( -1.4, GetCurrentScheduleValue( 2 ) );
+	DataEnvironment::DayOfWeek = 4;
+	DataEnvironment::HolidayIndex = 1;
+	UpdateScheduleValues();
+	EXPECT_DOUBLE_EQ( -1.4, GetCurrentScheduleValue( 1 ) );
+	DataEnvironment::HolidayIndex = 0;
+	UpdateScheduleValues();
+	EXPECT_DOUBLE_EQ( 1.4, GetCurrentScheduleValue( 1 ) );
+
+	// Values set by the external interface are seen the same day
+	int DayNum( 1 );
+	Real64 Value( 42.0 );
+	ExternalInterfaceSetSchedule( DayNum, Value );
+	UpdateScheduleValues();
+	EXPECT_DOUBLE_EQ( 42.0, GetCurrentScheduleValue( 1 ) );
+
+	Schedule.deallocate();
+	WeekSchedule.deallocate();
+	DaySchedule.deallocate();
+	ActiveDaySchedulePtr.deallocate();
+	ActiveDayValues.deallocate();
+	ActiveDayValid = false;
+	NumSchedules = 0;
+	NumWeekSchedules = 0;
+	NumDaySchedules = 0;
+	ScheduleInputProcessed = false;
+	DataGlobals::HourOfDay = 0;
+	DataGlobals::TimeStep = 0;
+	DataGlobals::NumOfTimeStepInHour = 0;
+	DataEnvironment::DayOfYear_Schedule = 0;
+	DataEnvironment::DayOfWeek = 0;
+}
+
+TEST( ScheduleManagerTest, ShareDuplicateDaySchedules )
+{
+	ShowMessage( "Begin Test: ScheduleManagerTest, ShareDuplicateDaySchedules" );
+
+	DataGlobals::NumOfTimeStepInHour = 2;
+	ScheduleInputProcessed = true;
+
+	// Day schedules 2 and 4 repeat 1, 3 differs in one value and 5 differs only in interpolation
+	NumDaySchedules = 5;
+	DaySchedule.allocate( NumDaySchedules );
+	for ( int DayNum = 1; DayNum <= NumDaySchedules; ++DayNum ) {
+		DaySchedule( DayNum ).Name = "DAY" + std::to_string( DayNum );
+		DaySchedule( DayNum ).ScheduleTypePtr = 1;
+		DaySchedule( DayNum ).TSValue.allocate( DataGlobals::NumOfTimeStepInHour, 24 );
+		for ( int Hour = 1; Hour <= 24; ++Hour ) {
+			for ( int TS = 1; TS <= DataGlobals::NumOfTimeStepInHour; ++TS ) {
+				DaySchedule( DayNum ).TSValue( TS, Hour ) = Hour + 0.5 * TS;
+			}
+		}
+	}
+	DaySchedule( 3 ).TSValue( 2, 24 ) = 0.0;
+	DaySchedule( 5 ).IntervalInterpolated = true;
+	NumWeekSchedules = 1;
+	WeekSchedule.allocate( NumWeekSchedules );
+	for ( int DayT = 1; DayT <= MaxDayTypes; ++DayT ) {
+		WeekSchedule( 1 ).DaySchedulePointer( DayT ) = 1 + ( DayT - 1 ) % NumDaySchedules;
+	}
+
+	// Day schedule 1 is outside the range, so day schedule 2 holds the values of 2 and 4
+	ShareDuplicateDaySchedules( 2, NumDaySchedules );
+	EXPECT_EQ( 0, DaySchedule( 1 ).SameAs );
+	EXPECT_EQ( 0, DaySchedule( 2 ).SameAs );
+	EXPECT_EQ( 0, DaySchedule( 3 ).SameAs );
+	EXPECT_EQ( 2, DaySchedule( 4 ).SameAs );
+	EXPECT_EQ( 0, DaySchedule( 5 ).SameAs );
+	EXPECT_TRUE( DaySchedule( 4 ).TSValue.empty() );
+	EXPECT_FALSE( DaySchedule( 1 ).TSValue.empty() );
+	EXPECT_EQ( 1, WeekSchedule( 1 ).DaySchedulePointer( 1 ) );
+	EXPECT_EQ( 2, WeekSchedule( 1 ).DaySchedulePointer( 4 ) );
+	EXPECT_EQ( 2, WeekSchedule( 1 ).DaySchedulePointer( 9 ) );
+	EXPECT_EQ( 5, WeekSchedule( 1 ).DaySchedulePointer( 5 ) );
+
+	// Look ups by name give the day schedule holding the values
+	std::string Name( "DAY4" );
+	EXPECT_EQ( 2, GetDayScheduleIndex( Name ) );
+	Array2D< Real64 > DayValues( DataGlobals::NumOfTimeStepInHour, 24 );
+	GetSingleDayScheduleValues( 4, DayValues );
+	EXPECT_DOUBLE_EQ( 24.0 + 1.0, DayValues( 2, 24 ) );
+
+	WeekSchedule.deallocate();
+	DaySchedule.deallocate();
+	NumWeekSchedules = 0;
+	NumDaySchedules = 0;
+	ScheduleInputProcessed = false;
+	DataGlobals::NumOfTimeStepInHour = 0;
+}
+
+TEST( ScheduleManagerTest, ScheduleFileCacheRoundTrip )
+{
+	ShowMessage( "Begin Test: ScheduleManagerTest, ScheduleFileCacheRoundTrip" );
+
+	std::string const CacheFile( "eplus_test_schedule_file_cache.bin" );
+	std::string const CSVFile( "eplus_test_schedule_file.csv" );
+	std::remove( CacheFile.c_str() );
+	{
+		std::ofstream CSV( CSVFile );
+		CSV << "Hour,Occupancy,Lighting\n1,0.25,0.5\n2,0.75,1.0\n";
+	}
+
+	std::vector< Real64 > const Key( ScheduleFileCacheKey( CSVFile, 2, 1, 8760, "," ) );
+	ASSERT_FALSE( Key.empty() );
+	std::vector< Real64 > const OtherColumnKey( ScheduleFileCacheKey( CSVFile, 3, 1, 8760, "," ) );
+	EXPECT_NE( Key, OtherColumnKey );
+
+	Array1D< Real64 > Values( 8760, 0.0 );
+	int RowCount( 0 );
+	int NumErrors( 0 );
+	InitScheduleFileCache( CacheFile );
+	ASSERT_TRUE( ScheduleFileCache.Active );
+	EXPECT_FALSE( RestoreScheduleFileFromCache( Key, 8760, RowCount, NumErrors, Values ) );
+	Values( 1 ) = 0.25;
+	Values( 2 ) = 0.75;
+	SaveScheduleFileToCache( Key, 3, 1, Values );
+	EXPECT_EQ( 1, ScheduleFileCache.NumMisses );
+
+	// A later run restores the same column
+	InitScheduleFileCache( CacheFile );
+	ASSERT_TRUE( ScheduleFileCache.Active );
+	EXPECT_EQ( 1u, ScheduleFileCache.Index.size() );
+	Values = 0.0;
+	EXPECT_FALSE( RestoreScheduleFileFromCache( OtherColumnKey, 8760, RowCount, NumErrors, Values ) );
+	ASSERT_TRUE( RestoreScheduleFileFromCache( Key, 8760, RowCount, NumErrors, Values ) );
+	EXPECT_EQ( 3, RowCount );
+	EXPECT_EQ( 1, NumErrors );
+	EXPECT_EQ( 0.25, Values( 1 ) );
+	EXPECT_EQ( 0.75, Values( 2 ) );
+	EXPECT_EQ( 0.0, Values( 3 ) );
+	EXPECT_EQ( 1, ScheduleFileCache.NumHits );
+
+	// Editing the file changes the key
+	{
+		std::ofstream CSV( CSVFile );
+		CSV << "Hour,Occupancy,Lighting\n1,0.5,0.5\n2,0.75,1.0\n";
+	}
+	EXPECT_NE( Key, ScheduleFileCacheKey( CSVFile, 2, 1, 8760, "," ) );
+	EXPECT_TRUE( ScheduleFileCacheKey( "eplus_test_missing_schedule_file.csv", 2, 1, 8760, "," ).empty() );
+
+	InitScheduleFileCache( "" );
+	EXPECT_FALSE( ScheduleFileCache.Active );
+	std::remove( CacheFile.c_str() );
+	std::remove( CSVFile.c_str() );
+}
@@ -0,0 +1,61 @@
+// EnergyPlus::SimAirServingZones Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/SimAirServingZones.hh>
+#include <EnergyPlus/DataAirLoop.hh>
+#include <EnergyPlus/DataAirSystems.hh>
+#include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SimAirServingZones;
+using namespace EnergyPlus::DataAirSystems;
+
+TEST( SimAirServingZonesTest, AirLoopGroups )
+{
+	ShowMessage( "Begin Test: SimAirServingZonesTest, AirLoopGroups" );
+
+	// Loops 1 and 3 share node 1, loop 4 shares a plant loop with loop 2 and loop 5 stands alone
+	DataLoopNode::NumOfNodes = 10;
+	DataPlant::TotNumLoops = 2;
+	DataHVACGlobals::NumPrimaryAirSys = 5;
+	PrimaryAirSystem.allocate( DataHVACGlobals::NumPrimaryAirSys );
+	for ( int AirLoopNum = 1; AirLoopNum <= DataHVACGlobals::NumPrimaryAirSys; ++AirLoopNum ) {
+		auto & airSys( PrimaryAirSystem( AirLoopNum ) );
+		airSys.NumBranches = 1;
+		airSys.Branch.allocate( 1 );
+		airSys.Branch( 1 ).TotalNodes = 2;
+		airSys.Branch( 1 ).NodeNum.allocate( 2 );
+		airSys.Branch( 1 ).NodeNum( 1 ) = 2 * AirLoopNum - 1;
+		airSys.Branch( 1 ).NodeNum( 2 ) = 2 * AirLoopNum;
+	}
+	PrimaryAirSystem( 3 ).Branch( 1 ).NodeNum( 1 ) = 1;
+	AirSysCompToPlant.allocate( 2 );
+	AirSysCompToPlant( 1 ).AirLoopNum = 4;
+	AirSysCompToPlant( 1 ).PlantLoopNum = 2;
+	AirSysCompToPlant( 2 ).AirLoopNum = 2;
+	AirSysCompToPlant( 2 ).PlantLoopNum = 2;
+
+	SetAirLoopGroups();
+	EXPECT_TRUE( AirLoopGroupsSet );
+	EXPECT_EQ( 3, NumAirLoopGroups );
+	EXPECT_EQ( 1, AirLoopGroup( 1 ) );
+	EXPECT_EQ( 2, AirLoopGroup( 2 ) );
+	EXPECT_EQ( 1, AirLoopGroup( 3 ) );
+	EXPECT_EQ( 2, AirLoopGroup( 4 ) );
+	EXPECT_EQ( 3, AirLoopGroup( 5 ) );
+
+	AirSysCompToPlant.deallocate();
+	PrimaryAirSystem.deallocate();
+	AirLoopGroup.deallocate();
+	AirLoopGroupsSet = false;
+	NumAirLoopGroups = 0;
+	DataHVACGlobals::NumPrimaryAirSys = 0;
+	DataPlant::TotNumLoops = 0;
+	DataLoopNode::NumOfNodes = 0;
+}
@@ -0,0 +1,37 @@
+// EnergyPlus::SimulationManager Unit Tests
+
+// C++ Headers
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <SimulationManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SimulationManager;
+
+TEST( SimulationManagerTest, JoinReportSegments )
+{
+	// Two workers began before the end of the data dictionary; the second added an item
+	std::istringstream First( "7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Hourly\nEnd of Data Dictionary\n1,WINTER DAY\n2,1,1,21\n7,-5.0\n" );
+	std::istringstream Second( "7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Hourly\n9,1,Environment,Site Wind Speed [m/s] !Hourly\nEnd of Data Dictionary\n1,SUMMER DAY\n2,1,7,21\n7,30.0\n9,4.0\nEnd of Data\n" );
+	// A segment written after the marker holds data only
+	std::istringstream Third( "1,RUN PERIOD\n2,1,1,1\n7,2.5\n" );
+
+	std::ostringstream Joined;
+	JoinReportSegments( std::vector< std::istream * >( { &First, &Second, &Third } ), Joined );
+
+	EXPECT_EQ(
+		"7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Hourly\n"
+		"9,1,Environment,Site Wind Speed [m/s] !Hourly\n"
+		"End of Data Dictionary\n"
+		"1,WINTER DAY\n2,1,1,21\n7,-5.0\n"
+		"1,SUMMER DAY\n2,1,7,21\n7,30.0\n9,4.0\n"
+		"1,RUN PERIOD\n2,1,1,1\n7,2.5\n", Joined.str() );
+
+	EXPECT_EQ( "eplusout.eso.env3", EnvironmentSegmentFileName( "eplusout.eso", 3 ) );
+}
@@ -1,15 +1,24 @@
 // EnergyPlus::SolarShading Unit Tests
 
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
 #include <EnergyPlus/SolarShading.hh>
 #include <EnergyPlus/DataBSDFWindow.hh>
+#include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataShadowingCombinations.hh>
 #include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/SolarReflectionManager.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
 using namespace EnergyPlus;
@@ -19,6 +28,7 @@ using namespace EnergyPlus::DataGlobals;
 using namespace EnergyPlus::DataSystemVariables;
 using namespace EnergyPlus::DataHeatBalance;
 using namespace EnergyPlus::DataBSDFWindow;
+using namespace EnergyPlus::DataShadowingCombinations;
 using namespace ObjexxFCL;
 
 TEST( SolarShadingTest, CalcPerSolarBeamTest )
@@ -145,3 +155,312 @@ TEST( SolarShadingTest, SurfaceScheduledSolarInc )
 
 	SurfIncSolSSG.deallocate();
 }
+
+TEST( SolarShadingTest, ShadowCacheRoundTrip )
+{
+	ShowMessage( "Begin Test: SolarShadingTest, ShadowCacheRoundTrip" );
+
+	std::string const CacheFile( "eplus_test_shadow_cache.bin" );
+	std::remove( CacheFile.c_str() );
+
+	int const NumTimeSteps( 2 );
+	TotSurfaces = 3;
+	MaxBkSurf = 2;
+	Surface.allocate( TotSurfaces );
+	SurfaceWindow.allocate( TotSurfaces );
+	ShadowComb.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).Class = SurfaceClass_Wall;
+		Surface( SurfNum ).Area = 10.0 * SurfNum;
+	}
+	Surface( 3 ).Class = SurfaceClass_Window;
+	Surface( 3 ).BaseSurf = 1;
+	SAREA.dimension( TotSurfaces, 0.0 );
+	SUNCOS.dimension( 3, 0.0 );
+	SunlitFracWithoutReveal.dimension( NumTimeSteps, 24, TotSurfaces, 0.0 );
+	BackSurfaces.dimension( NumTimeSteps, 24, MaxBkSurf, TotSurfaces, 0 );
+	OverlapAreas.dimension( NumTimeSteps, 24, MaxBkSurf, TotSurfaces, 0.0 );
+
+	InitShadowCache( CacheFile );
+	ASSERT_TRUE( ShadowCache.Active );
+	EXPECT_EQ( 0u, ShadowCache.Index.size() );
+
+	// Nothing is cached for a new sun position
+	SUNCOS( 1 ) = 0.3;
+	SUNCOS( 2 ) = -0.4;
+	SUNCOS( 3 ) = std::sqrt( 0.75 );
+	EXPECT_FALSE( RestoreShadowFromCache( 12, 1 ) );
+
+	SAREA( 1 ) = 4.5;
+	SAREA( 3 ) = 0.25;
+	SunlitFracWithoutReveal( 1, 12, 3 ) = 0.8;
+	BackSurfaces( 1, 12, 2, 3 ) = 2;
+	OverlapAreas( 1, 12, 2, 3 ) = 0.125;
+	SaveShadowToCache( 12, 1 );
+	EXPECT_EQ( 1, ShadowCache.NumMisses );
+
+	// Sun positions within the quantum share a record; the results go to the requested hour and time step
+	SAREA = 99.0;
+	SUNCOS( 1 ) += 0.1 * ShadowCacheSunQuantum;
+	ASSERT_TRUE( RestoreShadowFromCache( 13, 2 ) );
+	EXPECT_EQ( 1, ShadowCache.NumHits );
+	EXPECT_DOUBLE_EQ( 4.5, SAREA( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.0, SAREA( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.25, SAREA( 3 ) );
+	EXPECT_DOUBLE_EQ( 0.8, SunlitFracWithoutReveal( 2, 13, 3 ) );
+	EXPECT_EQ( 2, BackSurfaces( 2, 13, 2, 3 ) );
+	EXPECT_DOUBLE_EQ( 0.125, OverlapAreas( 2, 13, 2, 3 ) );
+
+	// Sky patch records (hour 0) are kept apart from the sun positions in the same direction
+	EXPECT_FALSE( RestoreShadowFromCache( 0, 0 ) );
+	SAREA = 0.0;
+	SAREA( 2 ) = 7.0;
+	SaveShadowToCache( 0, 0 );
+	SAREA = 99.0;
+	ASSERT_TRUE( RestoreShadowFromCache( 0, 0 ) );
+	EXPECT_DOUBLE_EQ( 0.0, SAREA( 1 ) );
+	EXPECT_DOUBLE_EQ( 7.0, SAREA( 2 ) );
+	ASSERT_TRUE( RestoreShadowFromCache( 12, 1 ) );
+	EXPECT_DOUBLE_EQ( 4.5, SAREA( 1 ) );
+
+	// The record is found again by a later run with the same geometry
+	InitShadowCache( CacheFile );
+	ASSERT_TRUE( ShadowCache.Active );
+	EXPECT_EQ( 2u, ShadowCache.Index.size() );
+	EXPECT_TRUE( RestoreShadowFromCache( 12, 1 ) );
+	EXPECT_TRUE( RestoreShadowFromCache( 0, 0 ) );
+
+	// Changed geometry starts the file over
+	std::uint64_t const Hash( ShadowGeometryHash() );
+	Surface( 2 ).Area = 21.0;
+	EXPECT_NE( Hash, ShadowGeometryHash() );
+	InitShadowCache( CacheFile );
+	ASSERT_TRUE( ShadowCache.Active );
+	EXPECT_EQ( 0u, ShadowCache.Index.size() );
+	EXPECT_FALSE( RestoreShadowFromCache( 12, 1 ) );
+
+	// No file name turns the cache off
+	InitShadowCache( "" );
+	EXPECT_FALSE( ShadowCache.Active );
+	std::remove( CacheFile.c_str() );
+
+	Surface.deallocate();
+	SurfaceWindow.deallocate();
+	ShadowComb.deallocate();
+	SAREA.deallocate();
+	SUNCOS.deallocate();
+	SunlitFracWithoutReveal.deallocate();
+	BackSurfaces.deallocate();
+	OverlapAreas.deallocate();
+	TotSurfaces = 0;
+	MaxBkSurf = 20;
+}
+
+TEST( SolarShadingTest, FactorCacheRoundTrip )
+{
+	ShowMessage( "Begin Test: SolarShadingTest, FactorCacheRoundTrip" );
+
+	std::string const CacheFile( "eplus_test_factor_cache.bin" );
+	std::remove( CacheFile.c_str() );
+
+	TotSurfaces = 2;
+	MaxBkSurf = 1;
+	Surface.allocate( TotSurfaces );
+	SurfaceWindow.allocate( TotSurfaces );
+	ShadowComb.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).Class = SurfaceClass_Wall;
+		Surface( SurfNum ).Area = 10.0 * SurfNum;
+	}
+	SAREA.dimension( TotSurfaces, 0.0 );
+	SUNCOS.dimension( 3, 0.0 );
+	SunlitFracWithoutReveal.dimension( 1, 24, TotSurfaces, 0.0 );
+	BackSurfaces.dimension( 1, 24, MaxBkSurf, TotSurfaces, 0 );
+	OverlapAreas.dimension( 1, 24, MaxBkSurf, TotSurfaces, 0.0 );
+	SUNCOSHR.dimension( 24, 3, 0.0 );
+
+	InitShadowCache( CacheFile );
+	ASSERT_TRUE( ShadowCache.Active );
+
+	// The reflection factors of an hour are keyed by its sun direction and kept apart by kind
+	SUNCOSHR( 10, 1 ) = 0.3;
+	SUNCOSHR( 10, 2 ) = -0.4;
+	SUNCOSHR( 10, 3 ) = std::sqrt( 0.75 );
+	SUNCOS( 1 ) = 0.3;
+	SUNCOS( 2 ) = -0.4;
+	SUNCOS( 3 ) = std::sqrt( 0.75 );
+	auto const DiffKey( SolarReflectionManager::ReflCacheKey( 10, ShadowCacheBmToDiffReflKey ) );
+	EXPECT_NE( ShadowCacheKey( 10 ), DiffKey );
+	EXPECT_NE( SolarReflectionManager::ReflCacheKey( 10, ShadowCacheBmToBmReflKey ), DiffKey );
+	EXPECT_NE( SolarReflectionManager::ReflCacheKey( 0, ShadowCacheSkyReflKey ), DiffKey );
+
+	std::vector< Real64 > Factors( 2 * TotSurfaces, 0.0 );
+	EXPECT_FALSE( RestoreFactorsFromCache( DiffKey, Factors ) );
+	Factors[ 1 ] = 0.125;
+	Factors[ 2 ] = 0.5;
+	SaveFactorsToCache( DiffKey, Factors );
+	SAREA( 1 ) = 4.5;
+	SaveShadowToCache( 10, 1 );
+
+	// Entries not in the record come back as zero
+	std::vector< Real64 > Restored( 2 * TotSurfaces, 9.0 );
+	ASSERT_TRUE( RestoreFactorsFromCache( DiffKey, Restored ) );
+	EXPECT_EQ( Factors, Restored );
+
+	// A later run indexes the factor records with the SHADOW records
+	InitShadowCache( CacheFile );
+	ASSERT_TRUE( ShadowCache.Active );
+	EXPECT_EQ( 2u, ShadowCache.Index.size() );
+	Restored.assign( 2 * TotSurfaces, 9.0 );
+	ASSERT_TRUE( RestoreFactorsFromCache( DiffKey, Restored ) );
+	EXPECT_EQ( Factors, Restored );
+	SAREA = 0.0;
+	ASSERT_TRUE( RestoreShadowFromCache( 10, 1 ) );
+	EXPECT_DOUBLE_EQ( 4.5, SAREA( 1 ) );
+
+	// A record with entries beyond the requested factors is not used
+	Restored.assign( 2, 0.0 );
+	EXPECT_FALSE( RestoreFactorsFromCache( DiffKey, Restored ) );
+
+	InitShadowCache( "" );
+	std::remove( CacheFile.c_str() );
+
+	Surface.deallocate();
+	SurfaceWindow.deallocate();
+	ShadowComb.deallocate();
+	SAREA.deallocate();
+	SUNCOS.deallocate();
+	SunlitFracWithoutReveal.deallocate();
+	BackSurfaces.deallocate();
+	OverlapAreas.deallocate();
+	SUNCOSHR.deallocate();
+	TotSurfaces = 0;
+	MaxBkSurf = 20;
+}
+
+TEST( SolarShadingTest, ShadowCasterBVHCandidates )
+{
+	ShowMessage( "Begin Test: SolarShadingTest, ShadowCasterBVHCandidates" );
+
+	// Surface 1 is a south facing wall, the others are north facing panels in front of it, behind it or below it
+	int const NumPanels( 30 );
+	TotSurfaces = NumPanels + 1;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Surface( SurfNum ).Sides = 4;
+		Surface( SurfNum ).Vertex.allocate( 4 );
+	}
+	Surface( 1 ).Vertex( 1 ) = Vector( 0.0, 0.0, 3.0 );
+	Surface( 1 ).Vertex( 2 ) = Vector( 0.0, 0.0, 0.0 );
+	Surface( 1 ).Vertex( 3 ) = Vector( 10.0, 0.0, 0.0 );
+	Surface( 1 ).Vertex( 4 ) = Vector( 10.0, 0.0, 3.0 );
+	Surface( 1 ).Centroid = Vector( 5.0, 0.0, 1.5 );
+	std::vector< int > Casters;
+	for ( int Panel = 1; Panel <= NumPanels; ++Panel ) {
+		int const SurfNum( Panel + 1 );
+		Real64 const X( 0.7 * Panel );
+		Real64 const Y( ( Panel % 3 == 0 ) ? 2.0 + Panel : -1.0 - Panel ); // Every third panel is behind the wall
+		Real64 const Z( ( Panel % 5 == 0 ) ? -2.5 : 0.2 * Panel ); // Every fifth panel is below the wall
+		Surface( SurfNum ).Vertex( 1 ) = Vector( X + 1.0, Y, Z + 1.0 );
+		Surface( SurfNum ).Vertex( 2 ) = Vector( X + 1.0, Y, Z );
+		Surface( SurfNum ).Vertex( 3 ) = Vector( X, Y, Z );
+		Surface( SurfNum ).Vertex( 4 ) = Vector( X, Y, Z + 1.0 );
+		Surface( SurfNum ).Centroid = Vector( X + 0.5, Y, Z + 0.5 );
+		Casters.push_back( SurfNum );
+	}
+
+	BuildShadowCasterBVH( Casters );
+	EXPECT_EQ( NumPanels, int( ShadowCasterBVHSurfs.size() ) );
+
+	std::vector< int > Candidates;
+	Real64 const ZMIN( 0.0 );
+	GatherShadowCasterCandidates( 1, ZMIN, Candidates );
+
+	// Every panel that can shade the wall is a candidate. The panels behind or below the wall cannot shade it,
+	// but one of them can still be a candidate when it shares a leaf box with panels that can
+	int NumCanShade( 0 );
+	for ( int SurfNum = 2; SurfNum <= TotSurfaces; ++SurfNum ) {
+		bool CannotShade( true );
+		CHKGSS( 1, SurfNum, ZMIN, CannotShade );
+		bool const IsCandidate( std::find( Candidates.begin(), Candidates.end(), SurfNum ) != Candidates.end() );
+		if ( ! CannotShade ) {
+			++NumCanShade;
+			EXPECT_TRUE( IsCandidate );
+		}
+		int const Panel( SurfNum - 1 );
+		if ( Panel % 3 == 0 || Panel % 5 == 0 ) EXPECT_TRUE( CannotShade );
+	}
+	EXPECT_EQ( 16, NumCanShade );
+	EXPECT_LT( int( Candidates.size() ), NumPanels );
+
+	ShadowCasterBVH.clear();
+	ShadowCasterBVHSurfs.clear();
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
+
+TEST( SolarShadingTest, AnisoSkyViewFactorsLowSun )
+{
+	ShowMessage( "Begin Test: SolarShadingTest, AnisoSkyViewFactorsLowSun" );
+
+	// A roof, a south wall and a north wall that does not see the sun, with the sun low in the south
+	TotSurfaces = 3;
+	Surface.allocate( TotSurfaces );
+	Surface( 1 ).ExtSolar = true;
+	Surface( 1 ).OutNormVec = Vector( 0.0, 0.0, 1.0 );
+	Surface( 1 ).Tilt = 0.0;
+	Surface( 1 ).SinTilt = 0.0;
+	Surface( 1 ).ViewFactorSky = 1.0;
+	Surface( 2 ).ExtSolar = true;
+	Surface( 2 ).OutNormVec = Vector( 0.0, -1.0, 0.0 );
+	Surface( 2 ).Tilt = 90.0;
+	Surface( 2 ).SinTilt = 1.0;
+	Surface( 2 ).ViewFactorSky = 0.5;
+	Surface( 3 ).ExtSolar = false;
+	Surface( 3 ).OutNormVec = Vector( 0.0, 1.0, 0.0 );
+	InitAnisoSkySurfaces();
+	EXPECT_EQ( 2, int( AnisoSkySurfaces.SurfNum.size() ) );
+
+	Real64 const ZenithAng( 87.0 * DegToRadians );
+	DataEnvironment::SOLCOS( 1 ) = 0.0;
+	DataEnvironment::SOLCOS( 2 ) = -std::sin( ZenithAng );
+	DataEnvironment::SOLCOS( 3 ) = std::cos( ZenithAng );
+	DataEnvironment::Elevation = 0.0;
+	DataEnvironment::BeamSolarRad = 200.0;
+	DataEnvironment::DifSolarRad = 100.0;
+	TimeStep = 1;
+	HourOfDay = 1;
+	AnisoSkyMult.dimension( TotSurfaces, 1.0 );
+	MultIsoSky.dimension( TotSurfaces, 0.0 );
+	MultCircumSolar.dimension( TotSurfaces, 0.0 );
+	MultHorizonZenith.dimension( TotSurfaces, 0.0 );
+	DifShdgRatioIsoSky.dimension( TotSurfaces, 1.0 );
+	DifShdgRatioHoriz.dimension( TotSurfaces, 1.0 );
+	SunlitFrac.dimension( 1, 24, TotSurfaces, 1.0 );
+
+	AnisoSkyViewFactors();
+
+	// With the sun below 5 degrees the roof sees all of the circumsolar brightening and no horizon brightening
+	EXPECT_GT( MultCircumSolar( 1 ), 0.0 );
+	EXPECT_NEAR( 1.0, MultIsoSky( 1 ) + MultCircumSolar( 1 ), 1.0e-12 );
+	EXPECT_DOUBLE_EQ( 0.0, MultHorizonZenith( 1 ) );
+	EXPECT_NEAR( 1.0, AnisoSkyMult( 1 ), 1.0e-12 );
+	EXPECT_DOUBLE_EQ( 0.5 * MultIsoSky( 1 ), MultIsoSky( 2 ) );
+	EXPECT_NEAR( MultCircumSolar( 1 ) * std::sin( ZenithAng ) / 0.0871557, MultCircumSolar( 2 ), 1.0e-12 );
+	EXPECT_DOUBLE_EQ( std::max( 0.0, MultIsoSky( 2 ) + MultCircumSolar( 2 ) + MultHorizonZenith( 2 ) ), AnisoSkyMult( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.0, AnisoSkyMult( 3 ) );
+
+	AnisoSkySurfaces = AnisoSkySurfaceData();
+	AnisoSkyMult.deallocate();
+	MultIsoSky.deallocate();
+	MultCircumSolar.deallocate();
+	MultHorizonZenith.deallocate();
+	DifShdgRatioIsoSky.deallocate();
+	DifShdgRatioHoriz.deallocate();
+	SunlitFrac.deallocate();
+	DataEnvironment::SOLCOS = 0.0;
+	DataEnvironment::BeamSolarRad = 0.0;
+	DataEnvironment::DifSolarRad = 0.0;
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
@@ -0,0 +1,69 @@
+// EnergyPlus::SurfaceBVH Unit Tests
+
+// C++ Headers
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/SurfaceBVH.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SurfaceBVH;
+using namespace EnergyPlus::DataSurfaces;
+
+TEST( SurfaceBVHTest, RayCandidates )
+{
+	ShowMessage( "Begin Test: SurfaceBVHTest, RayCandidates" );
+
+	// A row of 1 m square vertical panels facing +y, one every 2 m along x
+	int const NumPanels( 20 );
+	TotSurfaces = NumPanels;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= NumPanels; ++SurfNum ) {
+		Real64 const X0( 2.0 * ( SurfNum - 1 ) );
+		Surface( SurfNum ).Sides = 4;
+		Surface( SurfNum ).Vertex.allocate( 4 );
+		Surface( SurfNum ).Vertex( 1 ) = Vector( X0, 5.0, 1.0 );
+		Surface( SurfNum ).Vertex( 2 ) = Vector( X0, 5.0, 0.0 );
+		Surface( SurfNum ).Vertex( 3 ) = Vector( X0 + 1.0, 5.0, 0.0 );
+		Surface( SurfNum ).Vertex( 4 ) = Vector( X0 + 1.0, 5.0, 1.0 );
+	}
+
+	std::vector< int > Candidates;
+
+	// Not built: every surface is a candidate
+	RayCandidates( AllSurfaces, 0.5, 0.0, 0.5, 0.0, 1.0, 0.0, std::numeric_limits< Real64 >::max(), Candidates );
+	EXPECT_EQ( NumPanels, int( Candidates.size() ) );
+
+	BuildAllSurfacesBVH();
+	EXPECT_TRUE( AllSurfaces.Built );
+	EXPECT_EQ( NumPanels, int( AllSurfaces.Surfs.size() ) );
+
+	// Ray toward panel 6, parallel to the other panels' boxes in x: only the panels of its leaf are candidates
+	RayCandidates( AllSurfaces, 10.5, 0.0, 0.5, 0.0, 1.0, 0.0, std::numeric_limits< Real64 >::max(), Candidates );
+	EXPECT_TRUE( std::find( Candidates.begin(), Candidates.end(), 6 ) != Candidates.end() );
+	EXPECT_LE( Candidates.size(), 4u );
+
+	// Too short to reach the row, or pointing away from it
+	RayCandidates( AllSurfaces, 10.5, 0.0, 0.5, 0.0, 1.0, 0.0, 4.0, Candidates );
+	EXPECT_TRUE( Candidates.empty() );
+	RayCandidates( AllSurfaces, 10.5, 0.0, 0.5, 0.0, -1.0, 0.0, std::numeric_limits< Real64 >::max(), Candidates );
+	EXPECT_TRUE( Candidates.empty() );
+
+	// Ray along the row crosses every box; candidates come back in surface order
+	RayCandidates( AllSurfaces, -1.0, 5.0, 0.5, 1.0, 0.0, 0.0, std::numeric_limits< Real64 >::max(), Candidates );
+	ASSERT_EQ( NumPanels, int( Candidates.size() ) );
+	for ( int i = 0; i < NumPanels; ++i ) {
+		EXPECT_EQ( i + 1, Candidates[ i ] );
+	}
+
+	AllSurfaces = SurfaceBVHData();
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
@@ -0,0 +1,145 @@
+// EnergyPlus::SurfaceGeometry Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/SurfaceGeometry.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/InputProcessor.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::SurfaceGeometry;
+using DataVectorTypes::Vector;
+
+TEST( SurfaceGeometryTest, SurfaceNameIndex )
+{
+	ShowMessage( "Begin Test: SurfaceGeometryTest, SurfaceNameIndex" );
+
+	bool ErrorInName( false );
+	bool IsBlank( false );
+
+	SurfaceTmp.allocate( 5 );
+	ClearSurfaceNames();
+	SetSurfaceTmpName( 1, "WALL 1" );
+	SetSurfaceTmpName( 2, "WINDOW 1" );
+	SetSurfaceTmpName( 3, "Mir-WALL 1" );
+
+	EXPECT_EQ( 2, FindSurfaceTmp( "WINDOW 1", 5 ) );
+	EXPECT_EQ( 0, FindSurfaceTmp( "WINDOW 1", 1 ) ); // Beyond the surfaces searched
+	EXPECT_EQ( 0, FindSurfaceTmp( "window 1", 5 ) ); // Matched exactly, as by FindItemInList
+	EXPECT_EQ( 0, FindSurfaceTmp( "ROOF 1", 5 ) );
+
+	// A renamed surface is found by its new name only
+	SetSurfaceTmpName( 2, "WINDOW 1 Left" );
+	EXPECT_EQ( 0, FindSurfaceTmp( "WINDOW 1", 5 ) );
+	EXPECT_EQ( 2, FindSurfaceTmp( "WINDOW 1 Left", 5 ) );
+	SetSurfaceTmpName( 4, "WINDOW 1" );
+	EXPECT_EQ( 4, FindSurfaceTmp( "WINDOW 1", 5 ) );
+
+	// Duplicates are found regardless of case, as by VerifyName
+	VerifySurfaceTmpName( "MIR-WALL 1", 4, ErrorInName, IsBlank, "Test Name" );
+	EXPECT_TRUE( ErrorInName );
+	VerifySurfaceTmpName( "WALL 1", 4, ErrorInName, IsBlank, "Test Name" );
+	EXPECT_TRUE( ErrorInName );
+	VerifySurfaceTmpName( "WALL 2", 4, ErrorInName, IsBlank, "Test Name" );
+	EXPECT_FALSE( ErrorInName );
+	EXPECT_FALSE( IsBlank );
+	VerifySurfaceTmpName( "", 4, ErrorInName, IsBlank, "Test Name" );
+	EXPECT_TRUE( ErrorInName );
+	EXPECT_TRUE( IsBlank );
+
+	SurfaceTmp.deallocate();
+	ClearSurfaceNames();
+
+	DataGlobals::NumOfZones = 2;
+	DataHeatBalance::Zone.allocate( 2 );
+	DataHeatBalance::Zone( 1 ).Name = "ZONE 1";
+	DataHeatBalance::Zone( 2 ).Name = "ZONE 2";
+	EXPECT_EQ( 2, FindZoneNum( "ZONE 2" ) );
+	EXPECT_EQ( 0, FindZoneNum( "ZONE 3" ) );
+
+	DataHeatBalance::Zone.deallocate();
+	DataGlobals::NumOfZones = 0;
+	ClearSurfaceNames();
+}
+
+TEST( SurfaceGeometryTest, MergeCoplanarSurfaces )
+{
+	ShowMessage( "Begin Test: SurfaceGeometryTest, MergeCoplanarSurfaces" );
+
+	int NumSurfaces( 4 );
+	Real64 const PlaneY[ 4 ] = { 0.0, 0.0, 0.5, 0.0 }; // Surface 3 lies in another plane
+
+	DataGlobals::OutputFileInits = GetNewUnitNumber();
+	{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( DataGlobals::OutputFileInits, "eplusout.eio", flags ); }
+
+	SurfaceTmp.allocate( NumSurfaces );
+	ClearSurfaceNames();
+	InputProcessor::NumIDFRecords = NumSurfaces + 1;
+	InputProcessor::IDFRecords.allocate( NumSurfaces + 1 );
+	for ( int SurfNum = 1; SurfNum <= NumSurfaces; ++SurfNum ) {
+		auto & surf( SurfaceTmp( SurfNum ) );
+		SetSurfaceTmpName( SurfNum, "WALL " + std::to_string( SurfNum ) );
+		surf.HeatTransSurf = true;
+		surf.Class = SurfaceClass_Wall;
+		surf.BaseSurf = SurfNum;
+		surf.Zone = 1;
+		surf.ZoneName = "ZONE 1";
+		surf.Construction = 1;
+		surf.ExtBoundCond = ExternalEnvironment;
+		surf.ExtSolar = true;
+		surf.ExtWind = true;
+		surf.Sides = 4;
+		surf.Vertex.allocate( 4 );
+		surf.Vertex( 1 ) = Vector( SurfNum - 1.0, PlaneY[ SurfNum - 1 ], 0.0 );
+		surf.NewellSurfaceNormalVector = Vector( 0.0, -1.0, 0.0 );
+		surf.GrossArea = surf.Area = 2.0;
+		auto & record( InputProcessor::IDFRecords( SurfNum ) );
+		record.Name = "BUILDINGSURFACE:DETAILED";
+		record.NumAlphas = 1;
+		record.Alphas.allocate( 1 );
+		record.AlphBlank.dimension( 1, false );
+		record.Alphas( 1 ) = surf.Name;
+	}
+	// Surface 4 is named by another object, so it is kept
+	auto & record( InputProcessor::IDFRecords( NumSurfaces + 1 ) );
+	record.Name = "SURFACEPROPERTY:CONVECTIONCOEFFICIENTS";
+	record.NumAlphas = 1;
+	record.Alphas.allocate( 1 );
+	record.AlphBlank.dimension( 1, false );
+	record.Alphas( 1 ) = "Wall 4";
+
+	MergeCoplanarSurfaceTmp( NumSurfaces );
+
+	EXPECT_EQ( 3, NumSurfaces );
+	EXPECT_EQ( "WALL 1", SurfaceTmp( 1 ).Name );
+	EXPECT_DOUBLE_EQ( 4.0, SurfaceTmp( 1 ).Area );
+	EXPECT_DOUBLE_EQ( 4.0, SurfaceTmp( 1 ).GrossArea );
+	EXPECT_EQ( 1, SurfaceTmp( 1 ).MergedSurfaces );
+	EXPECT_EQ( "WALL 3", SurfaceTmp( 2 ).Name );
+	EXPECT_EQ( 2, SurfaceTmp( 2 ).BaseSurf );
+	EXPECT_DOUBLE_EQ( 2.0, SurfaceTmp( 2 ).Area );
+	EXPECT_EQ( "WALL 4", SurfaceTmp( 3 ).Name );
+	EXPECT_EQ( 0, SurfaceTmp( 3 ).MergedSurfaces );
+	EXPECT_EQ( 3, FindSurfaceTmp( "WALL 4", NumSurfaces ) );
+	EXPECT_EQ( 0, FindSurfaceTmp( "WALL 2", NumSurfaces ) );
+	EXPECT_TRUE( OutputProcessor::IsReportKeyAlias( "Wall 2", "WALL 1" ) );
+	EXPECT_FALSE( OutputProcessor::IsReportKeyAlias( "Wall 3", "WALL 1" ) );
+
+	{ IOFlags flags; flags.DISPOSE( "DELETE" ); gio::close( DataGlobals::OutputFileInits, flags ); }
+	SurfaceTmp.deallocate();
+	SurfaceWindow.deallocate();
+	ClearSurfaceNames();
+	InputProcessor::IDFRecords.deallocate();
+	InputProcessor::NumIDFRecords = 0;
+	OutputProcessor::ReportKeyAliases.clear();
+}
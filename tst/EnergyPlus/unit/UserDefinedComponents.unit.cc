@@ -0,0 +1,50 @@
+// EnergyPlus::UserDefinedComponents Unit Tests
+
+// C++ Headers
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <UserDefinedComponents.hh>
+#include <DataGlobals.hh>
+#include <DataHVACGlobals.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::UserDefinedComponents;
+
+TEST( UserDefinedComponents, ErlProgramsMemoized )
+{
+	DataGlobals::BeginEnvrnFlag = false;
+	DataGlobals::DayOfSim = 2;
+	DataGlobals::CurrentTime = 10.25;
+	DataHVACGlobals::SysTimeElapsed = 0.0;
+
+	ErlProgramMemoStruct Memo;
+	PlantConnectionStruct Loop;
+	Loop.MyLoad = 1500.0;
+	Loop.InletTemp = 45.0;
+	Loop.InletMassFlowRate = 0.2;
+	std::vector< Real64 > Inputs;
+	AppendErlInputs( Inputs, Loop );
+	EXPECT_EQ( 5u, Inputs.size() );
+
+	EXPECT_FALSE( ErlProgramsMemoized( Memo, Inputs ) ); // Nothing has run yet
+	EXPECT_TRUE( ErlProgramsMemoized( Memo, Inputs ) ); // Repeated sub iteration
+
+	Inputs[ 3 ] = 0.2000001;
+	EXPECT_FALSE( ErlProgramsMemoized( Memo, Inputs ) ); // Inlet flow changed
+	EXPECT_TRUE( ErlProgramsMemoized( Memo, Inputs ) );
+
+	DataHVACGlobals::SysTimeElapsed = 0.125;
+	EXPECT_FALSE( ErlProgramsMemoized( Memo, Inputs ) ); // Next system time step
+
+	DataGlobals::BeginEnvrnFlag = true;
+	EXPECT_FALSE( ErlProgramsMemoized( Memo, Inputs ) ); // Never skipped in the first time step of an environment
+
+	DataGlobals::BeginEnvrnFlag = false;
+	DataGlobals::DayOfSim = 0;
+	DataGlobals::CurrentTime = 0.0;
+	DataHVACGlobals::SysTimeElapsed = 0.0;
+}
@@ -0,0 +1,59 @@
+// EnergyPlus::UtilityRoutines Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataErrorTracking.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataErrorTracking;
+
+TEST( UtilityRoutinesTest, RecurringErrorRepeats )
+{
+	int const NumErrors( NumRecurringErrors );
+	int const TotalWarnings( TotalWarningErrors );
+	int const TotalSevere( TotalSevereErrors );
+	int const LowTempMatches( MatchCounts( 16 ) ); // "Temperature (low) out o"
+	int const HeatBalanceMatches( MatchCounts( 14 ) ); // "Zone Air Heat Balance"
+	int MsgIndex( 0 );
+
+	// Repeats of the same text count the searches it matched and the statistics
+	for ( int i = 1; i <= 3; ++i ) {
+		ShowRecurringWarningErrorAtEnd( "Temperature (low) out of bounds in coil", MsgIndex, Real64( i ), Real64( -i ) );
+	}
+	EXPECT_EQ( NumErrors + 1, NumRecurringErrors );
+	EXPECT_EQ( NumErrors + 1, MsgIndex );
+	EXPECT_EQ( " ** Warning ** Temperature (low) out of bounds in coil", RecurringErrors( MsgIndex ).Message );
+	EXPECT_EQ( 3, RecurringErrors( MsgIndex ).Count );
+	EXPECT_DOUBLE_EQ( 3.0, RecurringErrors( MsgIndex ).MaxValue );
+	EXPECT_DOUBLE_EQ( -3.0, RecurringErrors( MsgIndex ).MinValue );
+	EXPECT_EQ( LowTempMatches + 3, MatchCounts( 16 ) );
+	EXPECT_EQ( TotalWarnings + 3, TotalWarningErrors );
+
+	// Other text under the same index is still searched as it is passed
+	ShowRecurringWarningErrorAtEnd( "Zone Air Heat Balance deviation", MsgIndex );
+	EXPECT_EQ( 4, RecurringErrors( MsgIndex ).Count );
+	EXPECT_EQ( LowTempMatches + 3, MatchCounts( 16 ) );
+	EXPECT_EQ( HeatBalanceMatches + 1, MatchCounts( 14 ) );
+
+	// New messages get their own indexes as the store grows
+	int MsgIndex2( 0 );
+	int MsgIndex3( 0 );
+	ShowRecurringSevereErrorAtEnd( "Temperature (low) out of bounds in coil", MsgIndex2 );
+	ShowRecurringContinueErrorAtEnd( "continued", MsgIndex3 );
+	EXPECT_EQ( NumErrors + 2, MsgIndex2 );
+	EXPECT_EQ( NumErrors + 3, MsgIndex3 );
+	EXPECT_EQ( " ** Severe  ** Temperature (low) out of bounds in coil", RecurringErrors( MsgIndex2 ).Message );
+	EXPECT_EQ( " **   ~~~   ** continued", RecurringErrors( MsgIndex3 ).Message );
+	EXPECT_DOUBLE_EQ( 3.0, RecurringErrors( MsgIndex ).MaxValue );
+	EXPECT_EQ( LowTempMatches + 4, MatchCounts( 16 ) );
+
+	NumRecurringErrors = NumErrors;
+	TotalWarningErrors = TotalWarnings;
+	TotalSevereErrors = TotalSevere;
+	MatchCounts( 16 ) = LowTempMatches;
+	MatchCounts( 14 ) = HeatBalanceMatches;
+
+}
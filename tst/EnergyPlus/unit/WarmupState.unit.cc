@@ -0,0 +1,84 @@
+// EnergyPlus::WarmupState Unit Tests
+
+// C++ Headers
+#include <cstdio>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+#include <EnergyPlus/WarmupState.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WarmupState;
+
+TEST( WarmupStateTest, GatherAndScatter )
+{
+	ShowMessage( "Begin Test: WarmupStateTest, GatherAndScatter" );
+
+	DataHeatBalSurface::TH.dimension( 2, 3, 4, 18.0 );
+	DataHeatBalSurface::SUMH.dimension( 4, 2 );
+	DataHeatBalFanSys::MAT.dimension( 2, 21.0 );
+	HeatBalanceManager::MaxTempPrevDay.dimension( 2, 25.0 );
+	DataHeatBalSurface::TH( 2, 3, 4 ) = 30.0;
+
+	WarmupStateData State;
+	GatherWarmupState( State );
+	EXPECT_EQ( std::size_t( 4 ), State.IntValues.size() );
+
+	DataHeatBalSurface::TH = 0.0;
+	DataHeatBalSurface::SUMH = 0;
+	DataHeatBalFanSys::MAT = 0.0;
+	HeatBalanceManager::MaxTempPrevDay = 0.0;
+	EXPECT_TRUE( ScatterWarmupState( State ) );
+	EXPECT_EQ( 18.0, DataHeatBalSurface::TH( 1, 1, 1 ) );
+	EXPECT_EQ( 30.0, DataHeatBalSurface::TH( 2, 3, 4 ) );
+	EXPECT_EQ( 2, DataHeatBalSurface::SUMH( 4 ) );
+	EXPECT_EQ( 21.0, DataHeatBalFanSys::MAT( 2 ) );
+	EXPECT_EQ( 25.0, HeatBalanceManager::MaxTempPrevDay( 1 ) );
+
+	// A state of another model is not used
+	DataHeatBalFanSys::MAT.dimension( 3, 0.0 );
+	EXPECT_FALSE( ScatterWarmupState( State ) );
+	EXPECT_EQ( 0.0, DataHeatBalFanSys::MAT( 1 ) );
+
+	DataHeatBalSurface::TH.deallocate();
+	DataHeatBalSurface::SUMH.deallocate();
+	DataHeatBalFanSys::MAT.deallocate();
+	HeatBalanceManager::MaxTempPrevDay.deallocate();
+}
+
+TEST( WarmupStateTest, WriteAndReadBack )
+{
+	ShowMessage( "Begin Test: WarmupStateTest, WriteAndReadBack" );
+
+	std::string const FileName( "WarmupStateTest.wus" );
+	WarmupStateFile.FileName = FileName;
+	WarmupStateFile.States.clear();
+	auto & State( WarmupStateFile.States[ "1,Sizing,CHICAGO_IL_USA ANNUAL HEATING 99% DESIGN CONDITIONS DB" ] );
+	State.Sizes = { 3, 0, 1 };
+	State.Values = { 1.5, -2.0, 3.25 };
+	State.IntValues = { 7 };
+	WarmupStateFile.States[ "1,Other" ].Sizes = { 0 };
+	WriteWarmupStateFile();
+
+	WarmupStateFile.States.clear();
+	ReadWarmupStateFile( FileName );
+	std::remove( FileName.c_str() );
+	EXPECT_TRUE( WarmupStateFile.Read );
+	ASSERT_EQ( 2u, WarmupStateFile.States.size() );
+	auto const & ReadState( WarmupStateFile.States[ "1,Sizing,CHICAGO_IL_USA ANNUAL HEATING 99% DESIGN CONDITIONS DB" ] );
+	EXPECT_EQ( std::vector< Int64 >( { 3, 0, 1 } ), ReadState.Sizes );
+	EXPECT_EQ( std::vector< Real64 >( { 1.5, -2.0, 3.25 } ), ReadState.Values );
+	EXPECT_EQ( std::vector< int >( { 7 } ), ReadState.IntValues );
+	EXPECT_TRUE( WarmupStateFile.States[ "1,Other" ].Values.empty() );
+
+	// A missing file holds no states
+	ReadWarmupStateFile( FileName );
+	EXPECT_TRUE( WarmupStateFile.States.empty() );
+	WarmupStateFile = WarmupStateFileData();
+}
@@ -57,3 +57,76 @@ TEST( HeatPumpWaterHeaterTests, TestQsourceCalcs )
 	EXPECT_DOUBLE_EQ(Qsource, SourceMassFlowRate * Cp * DeltaT);
 	
 }
+
+TEST( StratifiedTankTests, ImplicitNodeTemps )
+{
+	ShowMessage( "Begin Test: StratifiedTankTests, ImplicitNodeTemps" );
+	Real64 const Cp = 4178.; // water, J/(kg * K)
+	Real64 const TimeInterval = 600.0; // s, far longer than the explicit step could take
+	Real64 const Qheater = 4500.0; // W
+
+	WaterThermalTanks::WaterThermalTankData Tank;
+	Tank.Nodes = 3;
+	Tank.Node.allocate( Tank.Nodes );
+	Tank.HeaterNode1 = 3;
+	Tank.HeaterOn1 = true;
+	Tank.AmbientTemp = 20.0;
+	Tank.InversionMixingRate = 10.0; // kg/s
+	for ( int NodeNum = 1; NodeNum <= Tank.Nodes; ++NodeNum ) {
+		auto & node( Tank.Node( NodeNum ) );
+		node.Mass = 50.0;
+		node.Temp = 60.0 - 10.0 * NodeNum;
+		node.OnCycLossCoeff = 1.0;
+		if ( NodeNum > 1 ) node.CondCoeffUp = 5.0;
+		if ( NodeNum < Tank.Nodes ) node.CondCoeffDn = 5.0;
+	}
+
+	WaterThermalTanks::CalcStratifiedTankNodeTempsImplicit( Tank, TimeInterval, Cp, 0.0, Qheater, 0.0 );
+
+	// The stored energy changes by the heat added less the losses at the end of the interval
+	Real64 StoredEnergy = 0.0;
+	Real64 LostEnergy = 0.0;
+	for ( int NodeNum = 1; NodeNum <= Tank.Nodes; ++NodeNum ) {
+		auto const & node( Tank.Node( NodeNum ) );
+		StoredEnergy += node.Mass * Cp * ( node.NewTemp - node.Temp );
+		LostEnergy += node.OnCycLossCoeff * ( node.NewTemp - Tank.AmbientTemp ) * TimeInterval;
+	}
+	EXPECT_NEAR( Qheater * TimeInterval - LostEnergy, StoredEnergy, 1.0e-6 * Qheater * TimeInterval );
+
+	// The heated bottom node becomes warmer than the node above it, which mixes them
+	EXPECT_GT( Tank.Node( 3 ).NewTemp, Tank.Node( 3 ).Temp );
+	EXPECT_GT( Tank.Node( 2 ).NewTemp + 0.5, Tank.Node( 3 ).NewTemp );
+	EXPECT_LT( Tank.Node( 2 ).NewTemp, Tank.Node( 1 ).NewTemp + 0.5 );
+}
+
+TEST( MixedTankTests, AnalyticSolutionReuse )
+{
+	ShowMessage( "Begin Test: MixedTankTests, AnalyticSolutionReuse" );
+	Real64 const Ti = 50.0;
+	Real64 const Ta = 20.0;
+	Real64 const T1 = 10.0;
+	Real64 const T2 = 70.0;
+	Real64 const m = 200.0;
+	Real64 const Cp = 4178.; // water, J/(kg * K)
+	Real64 const m1 = 0.05;
+	Real64 const m2 = 0.02;
+	Real64 const UA = 2.0;
+	Real64 const Q = 3000.0;
+	Real64 const t = 900.0;
+
+	WaterThermalTanks::MixedTankAnalyticSolution Solution;
+	Solution.setConditions( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, Q );
+	Real64 const Tf = Solution.tankTemp( t );
+	EXPECT_DOUBLE_EQ( WaterThermalTanks::CalcTankTemp( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, Q, t ), Tf );
+
+	// Setting the same conditions again keeps the exponential of the last time
+	Solution.setConditions( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, Q );
+	EXPECT_DOUBLE_EQ( t, Solution.ExpTime );
+	EXPECT_DOUBLE_EQ( WaterThermalTanks::CalcTempIntegral( Ti, Tf, Ta, T1, T2, m, Cp, m1, m2, UA, Q, t ), Solution.tempIntegral( Tf, t ) );
+	EXPECT_NEAR( t, Solution.timeNeeded( Tf ), 1.0e-6 );
+
+	// New conditions give a new solution
+	Solution.setConditions( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, 0.0 );
+	EXPECT_DOUBLE_EQ( 0.0, Solution.ExpTime );
+	EXPECT_DOUBLE_EQ( WaterThermalTanks::CalcTankTemp( Ti, Ta, T1, T2, m, Cp, m1, m2, UA, 0.0, t ), Solution.tankTemp( t ) );
+}
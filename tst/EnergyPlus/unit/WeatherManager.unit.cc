@@ -0,0 +1,122 @@
+// EnergyPlus::WeatherManager Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// Third-party Headers
+#include <zlib.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/WeatherManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WeatherManager;
+
+TEST( WeatherManagerTest, CompressedWeatherFileInMemory )
+{
+	ShowMessage( "Begin Test: WeatherManagerTest, CompressedWeatherFileInMemory" );
+
+	std::string const FileName( "WeatherManagerTest.epw.gz" );
+	std::string const DataLine( "1999,1,1,1,60,C9C9C9C9*0?9?9?9?9?9?9?9*0C8C8C8C8*0*0E8*0*0,-3.9,-8.3,71,99100,0,0,261,0,0,0,0,0,0,0,160,3.1,0,0,11.3,77777,9,999999999,0,0.0000,0,88,0.000,0.0,0.0" );
+	std::string const LongLine( 5000, 'x' ); // Longer than one read of the file
+
+	gzFile File( gzopen( FileName.c_str(), "wb" ) );
+	ASSERT_TRUE( File != nullptr );
+	gzputs( File, "LOCATION,Test\r\n" );
+	gzputs( File, ( LongLine + "\n" ).c_str() );
+	gzputs( File, DataLine.c_str() ); // No line end on the last line
+	gzclose( File );
+
+	EXPECT_TRUE( WeatherFileIsCompressed( FileName ) );
+	ASSERT_TRUE( LoadWeatherFileLines( FileName ) );
+	WeatherFileInMemory = true;
+	ASSERT_EQ( 3u, WeatherFileLines.size() );
+	EXPECT_EQ( 3, WeatherRecords.isize() );
+
+	std::string Line;
+	EXPECT_EQ( 0, ReadWeatherFileLine( Line ) );
+	EXPECT_EQ( "LOCATION,Test", Line );
+	EXPECT_EQ( 0, ReadWeatherFileLine( Line ) );
+	EXPECT_EQ( LongLine, Line );
+	BackspaceWeatherFile();
+	EXPECT_EQ( 0, ReadWeatherFileLine( Line ) );
+	EXPECT_EQ( LongLine, Line );
+	EXPECT_EQ( 0, ReadWeatherFileLine( Line ) );
+	EXPECT_EQ( DataLine, Line );
+	EXPECT_GT( 0, ReadWeatherFileLine( Line ) );
+
+	// The data record is parsed when first read and given back unchanged afterwards
+	bool ErrorFound;
+	int WYear, WMonth, WDay, WHour, WMinute, PresWeathObs;
+	Real64 DryBulb, DewPoint, RelHum, AtmPress, ETHoriz, ETDirect, IRHoriz, GLBHoriz, DirectRad, DiffuseRad, GLBHorizIllum, DirectNrmIllum, DiffuseHorizIllum, ZenLum, WindDir, WindSpeed, TotalSkyCover, OpaqueSkyCover, Visibility, CeilHeight, PrecipWater, AerosolOptDepth, SnowDepth, DaysSinceLastSnow, Albedo, LiquidPrecip;
+	Array1D_int PresWeathConds( 9 );
+	for ( int Pass = 1; Pass <= 2; ++Pass ) {
+		RewindWeatherFile();
+		for ( int LineNum = 1; LineNum <= 3; ++LineNum ) ReadWeatherFileLine( Line );
+		DryBulb = 0.0;
+		WindSpeed = 0.0;
+		InterpretWeatherDataLine( Line, ErrorFound, WYear, WMonth, WDay, WHour, WMinute, DryBulb, DewPoint, RelHum, AtmPress, ETHoriz, ETDirect, IRHoriz, GLBHoriz, DirectRad, DiffuseRad, GLBHorizIllum, DirectNrmIllum, DiffuseHorizIllum, ZenLum, WindDir, WindSpeed, TotalSkyCover, OpaqueSkyCover, Visibility, CeilHeight, PresWeathObs, PresWeathConds, PrecipWater, AerosolOptDepth, SnowDepth, DaysSinceLastSnow, Albedo, LiquidPrecip );
+		EXPECT_TRUE( WeatherRecords( 3 ).Interpreted );
+		EXPECT_EQ( 1999, WYear );
+		EXPECT_EQ( 1, WHour );
+		EXPECT_DOUBLE_EQ( -3.9, DryBulb );
+		EXPECT_DOUBLE_EQ( 99100.0, AtmPress );
+		EXPECT_DOUBLE_EQ( 3.1, WindSpeed );
+		EXPECT_EQ( 9, PresWeathObs );
+	}
+
+	WeatherFileInMemory = false;
+	WeatherFileLines.clear();
+	WeatherRecords.deallocate();
+	WeatherFileLineNum = 0;
+	std::remove( FileName.c_str() );
+}
+
+TEST( WeatherManagerTest, SwitchWeatherFileHeaders )
+{
+	ShowMessage( "Begin Test: WeatherManagerTest, SwitchWeatherFileHeaders" );
+
+	auto WriteHeader = []( std::string const & FileName, std::string const & City, std::string const & GroundTemps, std::string const & DataPeriods ) {
+		std::ofstream File( FileName );
+		File << "LOCATION," << City << ",IL,USA,TMY2-94846,725300,41.78,-87.75,-6.0,190.0\n";
+		File << "DESIGN CONDITIONS,0\n";
+		File << "TYPICAL/EXTREME PERIODS,0\n";
+		File << "GROUND TEMPERATURES," << GroundTemps << "\n";
+		File << "HOLIDAYS/DAYLIGHT SAVING,No,0,0,0\n";
+		File << "COMMENTS 1,Test\n";
+		File << "COMMENTS 2,Test\n";
+		File << "DATA PERIODS," << DataPeriods << "\n";
+	};
+	std::string const BaseFileName( "WeatherManagerTestBase.epw" );
+	std::string const MorphFileName( "WeatherManagerTestMorph.epw" );
+	std::string const OtherFileName( "WeatherManagerTestOther.epw" );
+	WriteHeader( BaseFileName, "CHICAGO", "1,.5,,,,-1.89", "1,1,Data,Sunday, 1/ 1,12/31" );
+	WriteHeader( MorphFileName, "CHICAGO 2050", "1,.5,,,,-0.42", "1,1,Data,Sunday, 1/ 1,12/31" );
+	WriteHeader( OtherFileName, "CHICAGO", "1,.5,,,,-1.89", "1,1,Data,Monday, 1/ 1,12/31" );
+
+	EXPECT_EQ( 8u, ReadWeatherFileHeaderLines( BaseFileName ).size() );
+	EXPECT_TRUE( ReadWeatherFileHeaderLines( "WeatherManagerTestMissing.epw" ).empty() );
+
+	// Only the city and the ground temperatures differ; the data records are read from the new file
+	DataStringGlobals::inputWeatherFileName = BaseFileName;
+	EXPECT_TRUE( SwitchWeatherFile( MorphFileName ) );
+	EXPECT_EQ( MorphFileName, DataStringGlobals::inputWeatherFileName );
+	EXPECT_FALSE( WeatherFileInMemory );
+
+	// The data periods begin on another day of the week
+	EXPECT_FALSE( SwitchWeatherFile( OtherFileName ) );
+	EXPECT_EQ( MorphFileName, DataStringGlobals::inputWeatherFileName );
+	EXPECT_FALSE( SwitchWeatherFile( "WeatherManagerTestMissing.epw" ) );
+
+	DataStringGlobals::inputWeatherFileName.clear();
+	std::remove( BaseFileName.c_str() );
+	std::remove( MorphFileName.c_str() );
+	std::remove( OtherFileName.c_str() );
+}
@@ -0,0 +1,77 @@
+// EnergyPlus::WindowEquivalentLayer Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/WindowEquivalentLayer.hh>
+#include <EnergyPlus/DataWindowEquivalentLayer.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowEquivalentLayer;
+using namespace EnergyPlus::DataWindowEquivalentLayer;
+using namespace ObjexxFCL;
+
+TEST( WindowEquivalentLayerTest, BeamTableInterpolation )
+{
+	ShowMessage( "Begin Test: WindowEquivalentLayerTest, BeamTableInterpolation" );
+
+	// Table linear in both angles, so interpolation gives it back exactly
+	CFSBEAMTAB Table;
+	Table.ProfAxis = 2;
+	Table.NInc = 91;
+	Table.NProf = 181;
+	Table.Abs.allocate( 2, CFSMAXNL + 1, Table.NInc, Table.NProf );
+	for ( int IProf = 1; IProf <= Table.NProf; ++IProf ) {
+		for ( int IInc = 1; IInc <= Table.NInc; ++IInc ) {
+			for ( int Lay = 1; Lay <= CFSMAXNL + 1; ++Lay ) {
+				for ( int Side = 1; Side <= 2; ++Side ) {
+					Table.Abs( Side, Lay, IInc, IProf ) = Lay + 0.01 * ( IInc - 1 ) + 0.001 * Side * ( IProf - 91 );
+				}
+			}
+		}
+	}
+	Array2D< Real64 > Abs1( 2, CFSMAXNL + 1, -1.0 );
+	EXPECT_FALSE( InterpEQLBeamTable( Table, 0.5, 0.0, 0.2, Abs1 ) ); // Not tabulated yet
+	EXPECT_DOUBLE_EQ( -1.0, Abs1( 1, 1 ) );
+	Table.Tabulated = true;
+
+	Real64 const IncDeg( 37.25 );
+	Real64 const ProfDeg( -12.5 );
+	ASSERT_TRUE( InterpEQLBeamTable( Table, IncDeg / RadiansToDeg, 0.3, ProfDeg / RadiansToDeg, Abs1 ) );
+	for ( int Lay = 1; Lay <= CFSMAXNL + 1; ++Lay ) {
+		EXPECT_NEAR( Lay + 0.01 * IncDeg + 0.001 * ProfDeg, Abs1( 1, Lay ), 1.0e-9 );
+		EXPECT_NEAR( Lay + 0.01 * IncDeg + 0.002 * ProfDeg, Abs1( 2, Lay ), 1.0e-9 );
+	}
+
+	// Both ends of the incidence angle range
+	ASSERT_TRUE( InterpEQLBeamTable( Table, 90.0 / RadiansToDeg, 0.0, 0.0, Abs1 ) );
+	EXPECT_NEAR( 1.9, Abs1( 1, 1 ), 1.0e-9 );
+	ASSERT_TRUE( InterpEQLBeamTable( Table, 0.0, 0.0, 0.0, Abs1 ) );
+	EXPECT_NEAR( 1.0, Abs1( 1, 1 ), 1.0e-9 );
+
+	// Profile angles outside the table are left to the direct calculation
+	EXPECT_FALSE( InterpEQLBeamTable( Table, 0.5, 0.0, 100.0 / RadiansToDeg, Abs1 ) );
+}
+
+TEST( WindowEquivalentLayerTest, BeamTableNotFormedForControlledOrCrossedSlats )
+{
+	ShowMessage( "Begin Test: WindowEquivalentLayerTest, BeamTableNotFormedForControlledOrCrossedSlats" );
+
+	CFSTY FS;
+	CFSBEAMTAB Table;
+	FS.NL = 2;
+	FS.L( 1 ).LTYPE = ltyVBHOR;
+	FS.L( 2 ).LTYPE = ltyVBVER;
+	FormEQLBeamTable( FS, Table );
+	EXPECT_FALSE( Table.Tabulated );
+
+	FS.NL = 1;
+	FS.ISControlled = true;
+	FormEQLBeamTable( FS, Table );
+	EXPECT_FALSE( Table.Tabulated );
+}
@@ -0,0 +1,216 @@
+// EnergyPlus::WindowManager Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/WindowManager.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowManager;
+
+TEST( WindowManagerTest, GasMixtureOfOneGasMatchesTheGas )
+{
+	ShowMessage( "Begin Test: WindowManagerTest, GasMixtureOfOneGasMatchesTheGas" );
+
+	// Air coefficients; gap 1 holds air alone, gap 2 a mixture of air with itself
+	Real64 const Con[ 3 ] = { 2.873e-3, 7.760e-5, 0.0 };
+	Real64 const Vis[ 3 ] = { 3.723e-6, 4.940e-8, 0.0 };
+	Real64 const Cp[ 3 ] = { 1002.737, 1.2324e-2, 0.0 };
+	for ( int IGap = 1; IGap <= 2; ++IGap ) {
+		gap( IGap ) = 0.0127;
+		gnmix( IGap ) = IGap;
+		for ( int IMix = 1; IMix <= IGap; ++IMix ) {
+			gwght( IMix, IGap ) = 28.97;
+			gfract( IMix, IGap ) = 1.0 / IGap;
+			for ( int ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+				gcon( ICoeff, IMix, IGap ) = Con[ ICoeff - 1 ];
+				gvis( ICoeff, IMix, IGap ) = Vis[ ICoeff - 1 ];
+				gcp( ICoeff, IMix, IGap ) = Cp[ ICoeff - 1 ];
+			}
+		}
+		SetGapGasMixFactors( IGap );
+	}
+	EXPECT_DOUBLE_EQ( 1.0, gmixroot4( 1, 2, 2 ) );
+	EXPECT_DOUBLE_EQ( 4.0, gmixdowner( 1, 2, 2 ) );
+	EXPECT_DOUBLE_EQ( 1.0, gmixpsiterm( 2, 1, 2 ) );
+
+	Real64 con1, pr1, gr1, con2, pr2, gr2;
+	WindowGasConductance( 290.0, 280.0, 1, con1, pr1, gr1 );
+	WindowGasConductance( 290.0, 280.0, 2, con2, pr2, gr2 );
+	EXPECT_NEAR( con1, con2, 1.0e-12 );
+	EXPECT_NEAR( pr1, pr2, 1.0e-12 );
+	EXPECT_NEAR( gr1, gr2, 1.0e-6 * gr1 );
+
+	Real64 dens1, visc1, dens2, visc2;
+	WindowGasPropertiesAtTemp( 285.0, 1, dens1, visc1 );
+	WindowGasPropertiesAtTemp( 285.0, 2, dens2, visc2 );
+	EXPECT_NEAR( dens1, dens2, 1.0e-12 );
+	EXPECT_NEAR( visc1, visc2, 1.0e-15 );
+
+	gnmix = 0;
+}
+
+TEST( WindowManagerTest, HeatBalanceSolutionReusedWithinTolerance )
+{
+	ShowMessage( "Begin Test: WindowManagerTest, HeatBalanceSolutionReusedWithinTolerance" );
+
+	DataSurfaces::TotSurfaces = 1;
+	nglface = 2;
+	tout = 273.15;
+	tin = 294.15;
+	hcout = 20.0;
+	hcin = 3.0;
+	Outir = 300.0;
+	Rmir = 420.0;
+	AbsRadGlassFace( 1 ) = 10.0;
+	AbsRadGlassFace( 2 ) = 5.0;
+	thetas( 1 ) = 276.0;
+	thetas( 2 ) = 285.0;
+	EXPECT_FALSE( ReuseWindowHeatBalanceSolution( 1, 1 ) );
+	Real64 const hcinIn( hcin );
+	hcin = 2.5; // As found with the face temperatures
+	SaveWindowHeatBalanceSolution( 1, 1, hcinIn );
+
+	thetas = 0.0;
+	hcin = hcinIn;
+	tout += 0.001;
+	EXPECT_FALSE( ReuseWindowHeatBalanceSolution( 1, 2 ) ); // Other construction
+	ASSERT_TRUE( ReuseWindowHeatBalanceSolution( 1, 1 ) );
+	EXPECT_DOUBLE_EQ( 276.0, thetas( 1 ) );
+	EXPECT_DOUBLE_EQ( 285.0, thetas( 2 ) );
+	EXPECT_DOUBLE_EQ( 2.5, hcin );
+
+	hcin = hcinIn;
+	AbsRadGlassFace( 2 ) += 1.0;
+	EXPECT_FALSE( ReuseWindowHeatBalanceSolution( 1, 1 ) );
+
+	WindowHBSolution.deallocate();
+	DataSurfaces::TotSurfaces = 0;
+	AbsRadGlassFace = 0.0;
+	thetas = 0.0;
+}
+
+TEST( WindowManagerTest, BatchSolutionSharedForIdenticalInputs )
+{
+	ShowMessage( "Begin Test: WindowManagerTest, BatchSolutionSharedForIdenticalInputs" );
+
+	DataHeatBalance::TotConstructs = 2;
+	nglface = 2;
+	std::vector< Real64 > Key( { 273.15, 294.15, 20.0, 3.0 } );
+	thetas( 1 ) = 276.0;
+	thetas( 2 ) = 285.0;
+	hcin = 2.5;
+	int Iterations( 0 );
+	Real64 ErrTemp( 1.0 );
+	EXPECT_FALSE( FindWindowBatchSolution( 1, Key, Iterations, ErrTemp ) );
+	AddWindowBatchSolution( 1, Key, 7, 0.01 );
+
+	thetas = 0.0;
+	hcin = 0.0;
+	EXPECT_FALSE( FindWindowBatchSolution( 2, Key, Iterations, ErrTemp ) ); // Other construction
+	ASSERT_TRUE( FindWindowBatchSolution( 1, Key, Iterations, ErrTemp ) );
+	EXPECT_DOUBLE_EQ( 276.0, thetas( 1 ) );
+	EXPECT_DOUBLE_EQ( 285.0, thetas( 2 ) );
+	EXPECT_DOUBLE_EQ( 2.5, hcin );
+	EXPECT_EQ( 7, Iterations );
+	EXPECT_DOUBLE_EQ( 0.01, ErrTemp );
+
+	// Any input differing, however little, is another solution
+	std::vector< Real64 > OtherKey( Key );
+	OtherKey[ 0 ] += 1.0e-12;
+	EXPECT_FALSE( FindWindowBatchSolution( 1, OtherKey, Iterations, ErrTemp ) );
+
+	// The oldest solution gives way once the construction has eight
+	for ( int Sol = 1; Sol <= 8; ++Sol ) {
+		OtherKey[ 1 ] = Sol;
+		AddWindowBatchSolution( 1, OtherKey, Sol, 0.01 );
+	}
+	EXPECT_EQ( 8u, WindowBatch( 1 ).Solutions.size() );
+	EXPECT_FALSE( FindWindowBatchSolution( 1, Key, Iterations, ErrTemp ) );
+	EXPECT_TRUE( FindWindowBatchSolution( 1, OtherKey, Iterations, ErrTemp ) );
+	EXPECT_EQ( 8, Iterations );
+
+	WindowBatch.deallocate();
+	DataHeatBalance::TotConstructs = 0;
+	thetas = 0.0;
+}
+
+TEST( WindowManagerTest, GlazingOpticsCacheRoundTrip )
+{
+	ShowMessage( "Begin Test: WindowManagerTest, GlazingOpticsCacheRoundTrip" );
+
+	std::string const CacheFile( "eplus_test_glazing_optics_cache.bin" );
+	std::remove( CacheFile.c_str() );
+
+	// Two glass layers without spectral data
+	for ( int IGlass = 1; IGlass <= 2; ++IGlass ) {
+		numpt( IGlass ) = 2;
+		t( IGlass, 1 ) = 0.8;
+		t( IGlass, 2 ) = 0.88;
+		rff( IGlass, 1 ) = 0.07;
+		rff( IGlass, 2 ) = 0.08;
+		rbb( IGlass, 1 ) = 0.07;
+		rbb( IGlass, 2 ) = 0.08;
+	}
+	std::vector< Real64 > const FrontKey( GlazingOpticsCacheKey( 1, 2, true, false, 0.0, 0.0 ) );
+	std::vector< Real64 > const BackKey( GlazingOpticsCacheKey( 2, 2, true, false, 0.0, 0.0 ) );
+	EXPECT_NE( GlazingOpticsCacheHash( FrontKey ), GlazingOpticsCacheHash( BackKey ) );
+
+	InitGlazingOpticsCache( CacheFile );
+	ASSERT_TRUE( GlazingOpticsCache.Active );
+	EXPECT_FALSE( RestoreGlazingOpticsFromCache( FrontKey, 1, 2 ) );
+	for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+		tsolPhi( IPhi ) = 0.6 - 0.01 * IPhi;
+		rbvisPhi( IPhi ) = 0.15 + 0.001 * IPhi;
+		solabsPhi( 2, IPhi ) = 0.05 + 1.0e-9 * IPhi;
+		solabsBackPhi( 1, IPhi ) = 0.04 + 0.002 * IPhi;
+	}
+	SaveGlazingOpticsToCache( FrontKey, 1, 2 );
+	SaveGlazingOpticsToCache( BackKey, 2, 2 );
+	EXPECT_EQ( 2, GlazingOpticsCache.NumMisses );
+
+	// A later run restores the same results
+	InitGlazingOpticsCache( CacheFile );
+	ASSERT_TRUE( GlazingOpticsCache.Active );
+	EXPECT_EQ( 2u, GlazingOpticsCache.Index.size() );
+	tsolPhi = 0.0;
+	rbvisPhi = 0.0;
+	solabsPhi = 0.0;
+	solabsBackPhi = 0.0;
+	ASSERT_TRUE( RestoreGlazingOpticsFromCache( FrontKey, 1, 2 ) );
+	EXPECT_EQ( 0.0, solabsBackPhi( 1, 3 ) ); // The front record holds the front properties only
+	ASSERT_TRUE( RestoreGlazingOpticsFromCache( BackKey, 2, 2 ) );
+	EXPECT_EQ( 2, GlazingOpticsCache.NumHits );
+	for ( int IPhi = 1; IPhi <= 10; ++IPhi ) {
+		EXPECT_EQ( 0.6 - 0.01 * IPhi, tsolPhi( IPhi ) );
+		EXPECT_EQ( 0.15 + 0.001 * IPhi, rbvisPhi( IPhi ) );
+		EXPECT_EQ( 0.05 + 1.0e-9 * IPhi, solabsPhi( 2, IPhi ) );
+		EXPECT_EQ( 0.04 + 0.002 * IPhi, solabsBackPhi( 1, IPhi ) );
+	}
+
+	// Any change in a layer property misses the cache
+	rbb( 2, 1 ) = 0.071;
+	EXPECT_FALSE( RestoreGlazingOpticsFromCache( GlazingOpticsCacheKey( 1, 2, true, false, 0.0, 0.0 ), 1, 2 ) );
+
+	// No file name turns the cache off
+	InitGlazingOpticsCache( "" );
+	EXPECT_FALSE( GlazingOpticsCache.Active );
+	std::remove( CacheFile.c_str() );
+
+	numpt = 0;
+	t = 0.0;
+	rff = 0.0;
+	rbb = 0.0;
+	tsolPhi = 0.0;
+	rbvisPhi = 0.0;
+	solabsPhi = 0.0;
+	solabsBackPhi = 0.0;
+}
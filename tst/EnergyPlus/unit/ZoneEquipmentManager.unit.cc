@@ -0,0 +1,61 @@
+// EnergyPlus::ZoneEquipmentManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ZoneEquipmentManager.hh>
+#include <EnergyPlus/DataAirSystems.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/DataZoneEquipment.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ZoneEquipmentManager;
+using namespace EnergyPlus::DataZoneEquipment;
+
+TEST( ZoneEquipmentManagerTest, ZoneEquipGroups )
+{
+	ShowMessage( "Begin Test: ZoneEquipmentManagerTest, ZoneEquipGroups" );
+
+	// Zones 1 and 3 are on one air loop, zones 2 and 4 share a plant loop, zone 5 is not controlled
+	DataGlobals::NumOfZones = 6;
+	DataHVACGlobals::NumPrimaryAirSys = 1;
+	DataPlant::TotNumLoops = 2;
+	ZoneEquipConfig.allocate( DataGlobals::NumOfZones );
+	ZoneEquipList.allocate( DataGlobals::NumOfZones );
+	for ( int ZoneNum = 1; ZoneNum <= DataGlobals::NumOfZones; ++ZoneNum ) {
+		ZoneEquipConfig( ZoneNum ).IsControlled = ( ZoneNum != 5 );
+	}
+	ZoneEquipConfig( 1 ).AirLoopNum = 1;
+	ZoneEquipConfig( 3 ).AirLoopNum = 1;
+	DataAirSystems::ZoneCompToPlant.allocate( 3 );
+	DataAirSystems::ZoneCompToPlant( 1 ).ZoneEqListNum = 4;
+	DataAirSystems::ZoneCompToPlant( 1 ).PlantLoopNum = 2;
+	DataAirSystems::ZoneCompToPlant( 2 ).ZoneEqListNum = 2;
+	DataAirSystems::ZoneCompToPlant( 2 ).PlantLoopNum = 2;
+	DataAirSystems::ZoneCompToPlant( 3 ).ZoneEqListNum = 6;
+	DataAirSystems::ZoneCompToPlant( 3 ).PlantLoopNum = 1;
+
+	SetZoneEquipGroups();
+	EXPECT_TRUE( ZoneEquipGroupsSet );
+	EXPECT_EQ( 3, NumZoneEquipGroups );
+	EXPECT_EQ( 1, ZoneEquipGroup( 1 ) );
+	EXPECT_EQ( 2, ZoneEquipGroup( 2 ) );
+	EXPECT_EQ( 1, ZoneEquipGroup( 3 ) );
+	EXPECT_EQ( 2, ZoneEquipGroup( 4 ) );
+	EXPECT_EQ( 0, ZoneEquipGroup( 5 ) );
+	EXPECT_EQ( 3, ZoneEquipGroup( 6 ) );
+
+	DataAirSystems::ZoneCompToPlant.deallocate();
+	ZoneEquipList.deallocate();
+	ZoneEquipConfig.deallocate();
+	ZoneEquipGroup.deallocate();
+	ZoneEquipGroupsSet = false;
+	NumZoneEquipGroups = 0;
+	DataPlant::TotNumLoops = 0;
+	DataHVACGlobals::NumPrimaryAirSys = 0;
+	DataGlobals::NumOfZones = 0;
+}
@@ -229,3 +229,76 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	ZoneW1.deallocate();
 
 }
+
+TEST( ZoneTempPredictorCorrector, ZoneSumsLinks )
+{
+	ShowMessage( "Begin Test: ZoneTempPredictorCorrector, ZoneSumsLinks" );
+
+	NumOfZones = 4;
+	ZoneEquipConfig.allocate( 4 );
+	for ( int ZoneNum = 1; ZoneNum <= 4; ++ZoneNum ) ZoneEquipConfig( ZoneNum ).ActualZoneNum = ZoneNum;
+	std::vector< int > controlledZoneEquipConfigNums;
+	controlledZoneEquipConfigNums.push_back( 1 );
+	controlledZoneEquipConfigNums.push_back( 3 );
+
+	EXPECT_EQ( 1, ControlledZoneEquipConfigNum( 1, controlledZoneEquipConfigNums ) );
+	EXPECT_EQ( 0, ControlledZoneEquipConfigNum( 2, controlledZoneEquipConfigNums ) );
+	EXPECT_EQ( 3, ControlledZoneEquipConfigNum( 3, controlledZoneEquipConfigNums ) );
+
+	NumZoneReturnPlenums = 2;
+	ZoneRetPlenCond.allocate( 2 );
+	ZoneRetPlenCond( 1 ).ActualZoneNum = 4;
+	ZoneRetPlenCond( 2 ).ActualZoneNum = 4;
+	NumZoneSupplyPlenums = 1;
+	ZoneSupPlenCond.allocate( 1 );
+	ZoneSupPlenCond( 1 ).ActualZoneNum = 2;
+
+	int ZoneRetPlenumNum;
+	int ZoneSupPlenumNum;
+	FindZonePlenums( 4, ZoneRetPlenumNum, ZoneSupPlenumNum );
+	EXPECT_EQ( 1, ZoneRetPlenumNum ); // The first plenum of the zone
+	EXPECT_EQ( 0, ZoneSupPlenumNum );
+	FindZonePlenums( 2, ZoneRetPlenumNum, ZoneSupPlenumNum );
+	EXPECT_EQ( 0, ZoneRetPlenumNum );
+	EXPECT_EQ( 1, ZoneSupPlenumNum );
+
+	// Plenums read later are found
+	NumZoneReturnPlenums = 3;
+	ZoneRetPlenCond.redimension( 3 );
+	ZoneRetPlenCond( 3 ).ActualZoneNum = 1;
+	FindZonePlenums( 1, ZoneRetPlenumNum, ZoneSupPlenumNum );
+	EXPECT_EQ( 3, ZoneRetPlenumNum );
+
+	NumOfZones = 0;
+	NumZoneReturnPlenums = 0;
+	NumZoneSupplyPlenums = 0;
+	ZoneEquipConfig.deallocate();
+	ZoneRetPlenCond.deallocate();
+	ZoneSupPlenCond.deallocate();
+
+}
+
+TEST( ZoneTempPredictorCorrector, RespaceHistoryValues )
+{
+	ShowMessage( "Begin Test: ZoneTempPredictorCorrector, RespaceHistoryValues" );
+
+	// A history falling 1 C per old timestep
+	Real64 Val1( 19.0 );
+	Real64 Val2( 18.0 );
+	Real64 Val3( 17.0 );
+
+	// Halving the timestep puts the points between the old ones
+	RespaceHistoryValues( 0.1, 0.05, 20.0, Val1, Val2, Val3 );
+	EXPECT_DOUBLE_EQ( 19.5, Val1 );
+	EXPECT_DOUBLE_EQ( 19.0, Val2 );
+	EXPECT_DOUBLE_EQ( 18.5, Val3 );
+
+	// Doubling it runs past the old history, which holds its oldest value
+	Val1 = 19.0;
+	Val2 = 18.0;
+	Val3 = 17.0;
+	RespaceHistoryValues( 0.1, 0.2, 20.0, Val1, Val2, Val3 );
+	EXPECT_DOUBLE_EQ( 18.0, Val1 );
+	EXPECT_DOUBLE_EQ( 17.0, Val2 );
+	EXPECT_DOUBLE_EQ( 17.0, Val3 );
+}